@@ -0,0 +1,3223 @@
+/*******************************************************************************
+ * Size: 24 px
+ * Bpp: 4
+ * Opts: skaalattu Arial_70.c:stä (tools/font_build.py, ei TTF:ää)
+ ******************************************************************************/
+
+#include "lvgl.h"
+
+#ifndef ARIAL_24
+#define ARIAL_24 1
+#endif
+
+#if ARIAL_24
+
+/*Store the image of the glyphs*/
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
+    /* U+0020 " " */
+
+    /* U+0021 "!" */
+    0x22, 0x1e, 0xfa, 0xef, 0xae, 0xfa, 0xef, 0xad,
+    0xf9, 0xcf, 0x8b, 0xf7, 0xaf, 0x69, 0xf5, 0x8f,
+    0x47, 0xf3, 0x6f, 0x23, 0xb1, 0x0, 0x5, 0x63,
+    0xdf, 0x9d, 0xf9,
+
+    /* U+0022 "\"" */
+    0x11, 0x10, 0x11, 0x1d, 0xe7, 0x1d, 0xe6, 0xef,
+    0x71, 0xef, 0x6d, 0xf7, 0x1e, 0xf6, 0xbf, 0x60,
+    0xdf, 0x49, 0xf3, 0xb, 0xe2, 0x6f, 0x10, 0x8d,
+    0x0,
+
+    /* U+0023 "#" */
+    0x0, 0x0, 0x27, 0x40, 0x0, 0x67, 0x0, 0x0,
+    0x6, 0xf6, 0x0, 0x1d, 0xd0, 0x0, 0x0, 0x9f,
+    0x30, 0x2, 0xfa, 0x0, 0x0, 0xc, 0xe1, 0x0,
+    0x5f, 0x70, 0x0, 0x1, 0xec, 0x0, 0x8, 0xf4,
+    0x4, 0x55, 0x7f, 0xb5, 0x55, 0xcf, 0x65, 0xbf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x66, 0xbf,
+    0x76, 0x67, 0xfb, 0x66, 0x0, 0xc, 0xd1, 0x0,
+    0x5f, 0x60, 0x0, 0x1, 0xeb, 0x0, 0x8, 0xf3,
+    0x0, 0x0, 0x4f, 0x80, 0x0, 0xce, 0x10, 0x6,
+    0x8b, 0xfb, 0x88, 0x8e, 0xe8, 0x88, 0xbf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf2, 0x3d, 0xd4, 0x33,
+    0x8f, 0x73, 0x33, 0x1, 0xeb, 0x0, 0x9, 0xf3,
+    0x0, 0x0, 0x4f, 0x80, 0x0, 0xce, 0x10, 0x0,
+    0x7, 0xf5, 0x0, 0x1e, 0xb0, 0x0, 0x0, 0xaf,
+    0x20, 0x3, 0xf8, 0x0, 0x0, 0x2, 0x20, 0x0,
+    0x13, 0x10, 0x0, 0x0,
+
+    /* U+0024 "$" */
+    0x0, 0x0, 0x1, 0xa2, 0x0, 0x0, 0x0, 0x0,
+    0x16, 0xaf, 0xb6, 0x20, 0x0, 0x0, 0x4d, 0xff,
+    0xff, 0xfe, 0x40, 0x0, 0x2e, 0xfa, 0x4e, 0x6a,
+    0xfe, 0x20, 0x8, 0xfb, 0x2, 0xe3, 0xc, 0xf8,
+    0x0, 0xbf, 0x60, 0x2e, 0x30, 0x6a, 0x60, 0xb,
+    0xf6, 0x2, 0xe3, 0x0, 0x0, 0x0, 0x8f, 0xc1,
+    0x2e, 0x30, 0x0, 0x0, 0x2, 0xef, 0xc7, 0xe3,
+    0x0, 0x0, 0x0, 0x4, 0xdf, 0xff, 0xd8, 0x30,
+    0x0, 0x0, 0x1, 0x6b, 0xff, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x2e, 0x7a, 0xff, 0x70, 0x0, 0x0,
+    0x2, 0xe3, 0x7, 0xfe, 0x0, 0x12, 0x0, 0x2e,
+    0x30, 0x1f, 0xf2, 0x1d, 0xf2, 0x2, 0xe3, 0x1,
+    0xef, 0x30, 0xef, 0x70, 0x2e, 0x30, 0x3f, 0xf1,
+    0x8, 0xfe, 0x32, 0xe3, 0x1c, 0xfa, 0x0, 0x1c,
+    0xfe, 0xaf, 0xad, 0xfd, 0x20, 0x0, 0x19, 0xef,
+    0xff, 0xfa, 0x20, 0x0, 0x0, 0x0, 0x4e, 0x51,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xe3, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x16, 0x10, 0x0, 0x0,
+
+    /* U+0025 "%" */
+    0x0, 0x37, 0x73, 0x0, 0x0, 0x0, 0x5, 0x71,
+    0x0, 0x0, 0x6e, 0xee, 0xe7, 0x0, 0x0, 0x2,
+    0xea, 0x0, 0x0, 0x2e, 0xd3, 0x2b, 0xf3, 0x0,
+    0x0, 0x8f, 0x30, 0x0, 0x6, 0xf6, 0x0, 0x4f,
+    0x80, 0x0, 0x2e, 0xa0, 0x0, 0x0, 0x9f, 0x40,
+    0x2, 0xfa, 0x0, 0x9, 0xf2, 0x0, 0x0, 0x9,
+    0xf4, 0x0, 0x2f, 0xb0, 0x2, 0xf9, 0x0, 0x0,
+    0x0, 0x7f, 0x50, 0x3, 0xf9, 0x0, 0x9f, 0x20,
+    0x0, 0x0, 0x3, 0xfa, 0x0, 0x9f, 0x50, 0x2f,
+    0x90, 0x0, 0x0, 0x0, 0x9, 0xfc, 0xcf, 0xa0,
+    0xa, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x6, 0xbb,
+    0x61, 0x3, 0xf8, 0x0, 0x14, 0x42, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xae, 0x20, 0x3d, 0xff, 0xe6,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0x80, 0xd, 0xe5,
+    0x3b, 0xf4, 0x0, 0x0, 0x0, 0xb, 0xe1, 0x4,
+    0xf9, 0x0, 0x3f, 0xa0, 0x0, 0x0, 0x4, 0xf7,
+    0x0, 0x7f, 0x60, 0x1, 0xec, 0x0, 0x0, 0x0,
+    0xbd, 0x10, 0x7, 0xf5, 0x0, 0x1e, 0xd0, 0x0,
+    0x0, 0x4f, 0x70, 0x0, 0x5f, 0x70, 0x2, 0xeb,
+    0x0, 0x0, 0xc, 0xd1, 0x0, 0x2, 0xec, 0x10,
+    0x8f, 0x60, 0x0, 0x5, 0xf6, 0x0, 0x0, 0x7,
+    0xfe, 0xcf, 0xb1, 0x0, 0x0, 0x89, 0x10, 0x0,
+    0x0, 0x4, 0x9a, 0x60, 0x0,
+
+    /* U+0026 "&" */
+    0x0, 0x0, 0x26, 0x75, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x6e, 0xff, 0xfd, 0x40, 0x0, 0x0, 0x0,
+    0x4f, 0xe7, 0x49, 0xfe, 0x10, 0x0, 0x0, 0xa,
+    0xf8, 0x0, 0xc, 0xf5, 0x0, 0x0, 0x0, 0xcf,
+    0x70, 0x0, 0xbf, 0x60, 0x0, 0x0, 0x9, 0xfd,
+    0x10, 0x2e, 0xf3, 0x0, 0x0, 0x0, 0x3e, 0xfa,
+    0x4d, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x18, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x3d, 0xfd, 0xcf, 0xe2,
+    0x0, 0x10, 0x0, 0x2d, 0xfb, 0x22, 0xdf, 0xc1,
+    0x1e, 0xb2, 0x9, 0xfc, 0x10, 0x4, 0xef, 0x96,
+    0xfe, 0x10, 0xdf, 0x60, 0x0, 0x6, 0xff, 0xef,
+    0x90, 0xe, 0xf5, 0x0, 0x0, 0x9, 0xff, 0xf2,
+    0x0, 0xcf, 0xa0, 0x0, 0x0, 0x3f, 0xfe, 0x20,
+    0x6, 0xff, 0x50, 0x0, 0x3c, 0xff, 0xfd, 0x20,
+    0xb, 0xff, 0xa8, 0xaf, 0xfc, 0x5e, 0xfd, 0x30,
+    0x18, 0xff, 0xff, 0xe8, 0x10, 0x4e, 0xc1, 0x0,
+    0x1, 0x45, 0x41, 0x0, 0x0, 0x21, 0x0,
+
+    /* U+0027 "'" */
+    0x11, 0x1d, 0xe6, 0xef, 0x7e, 0xf7, 0xdf, 0x5a,
+    0xf2, 0x7e, 0x10,
+
+    /* U+0028 "(" */
+    0x0, 0x0, 0x34, 0x0, 0x1, 0xda, 0x0, 0x9,
+    0xe2, 0x0, 0x4f, 0x90, 0x0, 0xbe, 0x20, 0x3,
+    0xfb, 0x0, 0x9, 0xf6, 0x0, 0xe, 0xf2, 0x0,
+    0x3f, 0xd1, 0x0, 0x5f, 0xc0, 0x0, 0x7f, 0xa0,
+    0x0, 0x8f, 0xa0, 0x0, 0x8f, 0xa0, 0x0, 0x7f,
+    0xb0, 0x0, 0x5f, 0xc0, 0x0, 0x2f, 0xe1, 0x0,
+    0xd, 0xf3, 0x0, 0x8, 0xf7, 0x0, 0x2, 0xec,
+    0x0, 0x0, 0xaf, 0x40, 0x0, 0x3e, 0xa0, 0x0,
+    0x8, 0xf3, 0x0, 0x1, 0xcb, 0x0, 0x0, 0x12,
+
+    /* U+0029 ")" */
+    0x25, 0x10, 0x0, 0x2, 0xe8, 0x0, 0x0, 0x8,
+    0xf3, 0x0, 0x0, 0x1e, 0xb0, 0x0, 0x0, 0x8f,
+    0x50, 0x0, 0x3, 0xfc, 0x0, 0x0, 0xc, 0xf3,
+    0x0, 0x0, 0x9f, 0x80, 0x0, 0x5, 0xfb, 0x0,
+    0x0, 0x3f, 0xd1, 0x0, 0x2, 0xee, 0x20, 0x0,
+    0x2e, 0xe2, 0x0, 0x2, 0xee, 0x20, 0x0, 0x2f,
+    0xe2, 0x0, 0x4, 0xfd, 0x0, 0x0, 0x6f, 0xb0,
+    0x0, 0xa, 0xf7, 0x0, 0x1, 0xde, 0x20, 0x0,
+    0x4f, 0xa0, 0x0, 0xa, 0xf4, 0x0, 0x2, 0xea,
+    0x0, 0x0, 0x9e, 0x20, 0x0, 0x3e, 0x60, 0x0,
+    0x1, 0x20, 0x0, 0x0,
+
+    /* U+002A "*" */
+    0x0, 0x2, 0x73, 0x0, 0x0, 0x0, 0x3f, 0x60,
+    0x0, 0x7, 0x43, 0xe5, 0x38, 0x12, 0xef, 0xdf,
+    0xcf, 0xf5, 0x2, 0x5c, 0xfd, 0x74, 0x0, 0x4,
+    0xeb, 0xf7, 0x0, 0x2, 0xed, 0x1a, 0xf5, 0x0,
+    0x6, 0x40, 0x28, 0x10,
+
+    /* U+002B "+" */
+    0x0, 0x0, 0x1, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x1e, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xe1,
+    0x0, 0x0, 0x0, 0x0, 0x1e, 0xe1, 0x0, 0x0,
+    0x0, 0x0, 0x1e, 0xe1, 0x0, 0x0, 0x58, 0x88,
+    0x8e, 0xe8, 0x88, 0x85, 0xaf, 0xff, 0xff, 0xff,
+    0xff, 0xfa, 0x47, 0x77, 0x8e, 0xe7, 0x77, 0x75,
+    0x0, 0x0, 0x1e, 0xe1, 0x0, 0x0, 0x0, 0x0,
+    0x1e, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xe1,
+    0x0, 0x0, 0x0, 0x0, 0x1e, 0xe1, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0x40, 0x0, 0x0,
+
+    /* U+002C "," */
+    0x56, 0x3d, 0xf8, 0xdf, 0x80, 0xb7, 0x1e, 0x5b,
+    0xb1, 0x21, 0x0,
+
+    /* U+002D "-" */
+    0x14, 0x44, 0x44, 0x41, 0x4f, 0xff, 0xff, 0xf4,
+    0x3d, 0xdd, 0xdd, 0xd3,
+
+    /* U+002E "." */
+    0x56, 0x3c, 0xf9, 0xcf, 0x90,
+
+    /* U+002F "/" */
+    0x0, 0x0, 0x15, 0x30, 0x0, 0x4, 0xf7, 0x0,
+    0x0, 0x8f, 0x30, 0x0, 0xc, 0xd0, 0x0, 0x2,
+    0xe9, 0x0, 0x0, 0x6f, 0x50, 0x0, 0xa, 0xe1,
+    0x0, 0x1, 0xeb, 0x0, 0x0, 0x4f, 0x70, 0x0,
+    0x8, 0xf3, 0x0, 0x0, 0xcd, 0x10, 0x0, 0x2e,
+    0x90, 0x0, 0x5, 0xf5, 0x0, 0x0, 0xaf, 0x10,
+    0x0, 0xe, 0xc0, 0x0, 0x3, 0xf8, 0x0, 0x0,
+    0x7f, 0x30, 0x0, 0xb, 0xe1, 0x0, 0x0, 0x54,
+    0x0, 0x0, 0x0,
+
+    /* U+0030 "0" */
+    0x0, 0x0, 0x12, 0x20, 0x0, 0x0, 0x0, 0x3b,
+    0xef, 0xec, 0x40, 0x0, 0x3, 0xef, 0xc9, 0xcf,
+    0xf5, 0x0, 0xc, 0xf8, 0x0, 0x6, 0xfe, 0x10,
+    0x4f, 0xd1, 0x0, 0x0, 0xaf, 0x70, 0x9f, 0x80,
+    0x0, 0x0, 0x5f, 0xc0, 0xcf, 0x60, 0x0, 0x0,
+    0x2f, 0xf0, 0xef, 0x40, 0x0, 0x0, 0x1f, 0xf2,
+    0xff, 0x30, 0x0, 0x0, 0x1e, 0xf3, 0xff, 0x20,
+    0x0, 0x0, 0x1e, 0xf3, 0xff, 0x30, 0x0, 0x0,
+    0x1e, 0xf3, 0xef, 0x40, 0x0, 0x0, 0x1f, 0xf2,
+    0xcf, 0x50, 0x0, 0x0, 0x2f, 0xf0, 0x9f, 0x70,
+    0x0, 0x0, 0x4f, 0xc0, 0x5f, 0xc0, 0x0, 0x0,
+    0x9f, 0x80, 0x1d, 0xf6, 0x0, 0x4, 0xef, 0x20,
+    0x5, 0xff, 0x96, 0x9e, 0xf8, 0x0, 0x0, 0x5e,
+    0xff, 0xfe, 0x70, 0x0, 0x0, 0x0, 0x45, 0x41,
+    0x0, 0x0,
+
+    /* U+0031 "1" */
+    0x0, 0x0, 0x1, 0x30, 0x0, 0x1, 0xce, 0x0,
+    0x1, 0xaf, 0xe0, 0x1, 0xaf, 0xfe, 0x6, 0xdf,
+    0xef, 0xe6, 0xff, 0xa4, 0xfe, 0x6b, 0x40, 0x2f,
+    0xe0, 0x0, 0x2, 0xfe, 0x0, 0x0, 0x2f, 0xe0,
+    0x0, 0x2, 0xfe, 0x0, 0x0, 0x2f, 0xe0, 0x0,
+    0x2, 0xfe, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x2,
+    0xfe, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x2, 0xfe,
+    0x0, 0x0, 0x2f, 0xe0, 0x0, 0x2, 0xfe,
+
+    /* U+0032 "2" */
+    0x0, 0x0, 0x2, 0x22, 0x10, 0x0, 0x0, 0x0,
+    0x5c, 0xef, 0xfd, 0x81, 0x0, 0x0, 0x8f, 0xfb,
+    0x9a, 0xef, 0xc1, 0x0, 0x4f, 0xe5, 0x0, 0x2,
+    0xdf, 0x90, 0x9, 0xf9, 0x0, 0x0, 0x5, 0xfe,
+    0x0, 0xae, 0x50, 0x0, 0x0, 0x2f, 0xf1, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xbf, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf7, 0x0, 0x0,
+    0x0, 0x1, 0x9f, 0xe6, 0x0, 0x0, 0x0, 0x1,
+    0xbf, 0xe4, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xd3,
+    0x0, 0x0, 0x0, 0x1, 0xbf, 0xc2, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xe3, 0x11, 0x11, 0x11, 0x10,
+    0x1e, 0xff, 0xff, 0xff, 0xff, 0xff, 0x14, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf1,
+
+    /* U+0033 "3" */
+    0x0, 0x0, 0x22, 0x20, 0x0, 0x0, 0x0, 0x5c,
+    0xff, 0xeb, 0x40, 0x0, 0x7, 0xff, 0xb9, 0xbf,
+    0xf5, 0x0, 0x3f, 0xf5, 0x0, 0x6, 0xfe, 0x10,
+    0x9f, 0xa0, 0x0, 0x0, 0xdf, 0x50, 0x47, 0x40,
+    0x0, 0x0, 0xbf, 0x60, 0x0, 0x0, 0x0, 0x2,
+    0xef, 0x30, 0x0, 0x0, 0x1, 0x5d, 0xf9, 0x0,
+    0x0, 0x0, 0x9e, 0xff, 0x90, 0x0, 0x0, 0x0,
+    0x9a, 0xbe, 0xfa, 0x10, 0x0, 0x0, 0x0, 0x3,
+    0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf1,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf3, 0x8b, 0x30,
+    0x0, 0x0, 0x1f, 0xf3, 0xcf, 0x80, 0x0, 0x0,
+    0x5f, 0xf1, 0x6f, 0xe3, 0x0, 0x2, 0xdf, 0x90,
+    0xb, 0xfe, 0x96, 0x8e, 0xfc, 0x10, 0x1, 0x8e,
+    0xff, 0xff, 0x91, 0x0, 0x0, 0x1, 0x45, 0x41,
+    0x0, 0x0,
+
+    /* U+0034 "4" */
+    0x0, 0x0, 0x0, 0x0, 0x22, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5f, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0x2d, 0xfd, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
+    0xd0, 0x0, 0x0, 0x0, 0x6, 0xfc, 0xfd, 0x0,
+    0x0, 0x0, 0x3, 0xec, 0x5f, 0xd0, 0x0, 0x0,
+    0x1, 0xce, 0x34, 0xfd, 0x0, 0x0, 0x0, 0x8f,
+    0x70, 0x4f, 0xd0, 0x0, 0x0, 0x4f, 0xb1, 0x4,
+    0xfd, 0x0, 0x0, 0x1d, 0xe2, 0x0, 0x4f, 0xd0,
+    0x0, 0xa, 0xf6, 0x0, 0x4, 0xfd, 0x0, 0x6,
+    0xfb, 0x22, 0x22, 0x5f, 0xd2, 0x20, 0xaf, 0xee,
+    0xee, 0xee, 0xff, 0xee, 0x39, 0xdd, 0xdd, 0xdd,
+    0xef, 0xfd, 0xd2, 0x0, 0x0, 0x0, 0x4, 0xfd,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xfd, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xd0, 0x0,
+
+    /* U+0035 "5" */
+    0x1, 0xbc, 0xcc, 0xcc, 0xcc, 0x70, 0x3, 0xff,
+    0xff, 0xff, 0xff, 0x90, 0x6, 0xfb, 0x33, 0x33,
+    0x33, 0x20, 0x9, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xe, 0xe1,
+    0x14, 0x42, 0x0, 0x0, 0x3f, 0xda, 0xff, 0xff,
+    0xb2, 0x0, 0x5f, 0xfe, 0xa9, 0xae, 0xfd, 0x20,
+    0x7f, 0xd3, 0x0, 0x3, 0xdf, 0xb0, 0x12, 0x10,
+    0x0, 0x0, 0x4f, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x1e, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf5,
+    0x78, 0x30, 0x0, 0x0, 0x1e, 0xf4, 0xcf, 0x80,
+    0x0, 0x0, 0x5f, 0xe1, 0x7f, 0xe3, 0x0, 0x2,
+    0xdf, 0x80, 0x1b, 0xfe, 0x96, 0x8e, 0xfb, 0x10,
+    0x1, 0x9f, 0xff, 0xff, 0x91, 0x0, 0x0, 0x1,
+    0x45, 0x41, 0x0, 0x0,
+
+    /* U+0036 "6" */
+    0x0, 0x0, 0x1, 0x22, 0x10, 0x0, 0x0, 0x0,
+    0x19, 0xdf, 0xfd, 0x91, 0x0, 0x0, 0x2c, 0xfd,
+    0xaa, 0xef, 0xc1, 0x0, 0xb, 0xfb, 0x10, 0x2,
+    0xdf, 0x70, 0x3, 0xfd, 0x10, 0x0, 0x6, 0xfc,
+    0x0, 0x8f, 0x80, 0x0, 0x0, 0x13, 0x20, 0xc,
+    0xf4, 0x0, 0x12, 0x0, 0x0, 0x0, 0xef, 0x15,
+    0xcf, 0xfe, 0x81, 0x0, 0x1f, 0xe8, 0xfe, 0xbc,
+    0xff, 0xb1, 0x2, 0xff, 0xf9, 0x10, 0x4, 0xef,
+    0x80, 0x2f, 0xfc, 0x10, 0x0, 0x6, 0xfe, 0x1,
+    0xff, 0x70, 0x0, 0x0, 0x1f, 0xf3, 0xe, 0xf5,
+    0x0, 0x0, 0x1, 0xef, 0x40, 0xbf, 0x70, 0x0,
+    0x0, 0x1e, 0xf2, 0x7, 0xfb, 0x0, 0x0, 0x4,
+    0xfe, 0x0, 0x2e, 0xf6, 0x0, 0x1, 0xcf, 0x80,
+    0x0, 0x5f, 0xfa, 0x67, 0xdf, 0xc1, 0x0, 0x0,
+    0x4d, 0xff, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x3,
+    0x54, 0x20, 0x0, 0x0,
+
+    /* U+0037 "7" */
+    0xac, 0xcc, 0xcc, 0xcc, 0xcc, 0xc3, 0xdf, 0xff,
+    0xff, 0xff, 0xff, 0xf4, 0x34, 0x44, 0x44, 0x44,
+    0xcf, 0xa0, 0x0, 0x0, 0x0, 0x7, 0xfd, 0x10,
+    0x0, 0x0, 0x0, 0x3e, 0xf4, 0x0, 0x0, 0x0,
+    0x0, 0xbf, 0x90, 0x0, 0x0, 0x0, 0x5, 0xfe,
+    0x10, 0x0, 0x0, 0x0, 0x1c, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x5f, 0xe1, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0x80, 0x0, 0x0, 0x0, 0x2, 0xef, 0x30,
+    0x0, 0x0, 0x0, 0x6, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x1e,
+    0xf4, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xe2, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xd0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x13,
+    0x20, 0x0, 0x0, 0x0,
+
+    /* U+0038 "8" */
+    0x0, 0x0, 0x12, 0x20, 0x0, 0x0, 0x0, 0x4b,
+    0xef, 0xec, 0x50, 0x0, 0x5, 0xef, 0xc9, 0xbf,
+    0xf7, 0x0, 0x1d, 0xf8, 0x0, 0x5, 0xff, 0x30,
+    0x4f, 0xd1, 0x0, 0x0, 0xbf, 0x70, 0x5f, 0xc0,
+    0x0, 0x0, 0x9f, 0x90, 0x2f, 0xe2, 0x0, 0x0,
+    0xcf, 0x60, 0x9, 0xfc, 0x30, 0x29, 0xfd, 0x10,
+    0x0, 0x7f, 0xfe, 0xff, 0xa2, 0x0, 0x6, 0xdf,
+    0xdc, 0xdf, 0xe6, 0x0, 0x5f, 0xf7, 0x10, 0x15,
+    0xef, 0x60, 0xcf, 0x90, 0x0, 0x0, 0x5f, 0xe1,
+    0xef, 0x30, 0x0, 0x0, 0x1e, 0xf4, 0xff, 0x30,
+    0x0, 0x0, 0xd, 0xf4, 0xdf, 0x60, 0x0, 0x0,
+    0x2f, 0xf2, 0x7f, 0xd3, 0x0, 0x1, 0xaf, 0xb0,
+    0x1b, 0xfe, 0x96, 0x7d, 0xfe, 0x20, 0x1, 0x8e,
+    0xff, 0xff, 0xb2, 0x0, 0x0, 0x1, 0x45, 0x42,
+    0x0, 0x0,
+
+    /* U+0039 "9" */
+    0x0, 0x0, 0x22, 0x10, 0x0, 0x0, 0x0, 0x5c,
+    0xef, 0xeb, 0x30, 0x0, 0x7, 0xff, 0xc9, 0xbf,
+    0xe5, 0x0, 0x4f, 0xf8, 0x0, 0x5, 0xee, 0x20,
+    0xaf, 0xa0, 0x0, 0x0, 0x8f, 0x90, 0xef, 0x50,
+    0x0, 0x0, 0x3f, 0xe0, 0xff, 0x30, 0x0, 0x0,
+    0x1f, 0xf2, 0xef, 0x40, 0x0, 0x0, 0x2f, 0xf4,
+    0xbf, 0x80, 0x0, 0x0, 0x6f, 0xf4, 0x6f, 0xe5,
+    0x0, 0x3, 0xef, 0xf4, 0xb, 0xff, 0xb8, 0xae,
+    0xcd, 0xf4, 0x1, 0x9e, 0xff, 0xe9, 0x2d, 0xf3,
+    0x0, 0x2, 0x44, 0x20, 0x1f, 0xf1, 0x1, 0x0,
+    0x0, 0x0, 0x4f, 0xc0, 0x8e, 0x70, 0x0, 0x0,
+    0xaf, 0x80, 0x5f, 0xd1, 0x0, 0x5, 0xfe, 0x20,
+    0xc, 0xfd, 0x76, 0xaf, 0xf5, 0x0, 0x1, 0xaf,
+    0xff, 0xfd, 0x40, 0x0, 0x0, 0x2, 0x55, 0x30,
+    0x0, 0x0,
+
+    /* U+003A ":" */
+    0x45, 0x3c, 0xf9, 0xcf, 0x91, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x56,
+    0x3c, 0xf9, 0xcf, 0x90,
+
+    /* U+003B ";" */
+    0x45, 0x3d, 0xf8, 0xdf, 0x81, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x56,
+    0x3d, 0xf8, 0xdf, 0x80, 0xb7, 0x1e, 0x5b, 0xb1,
+    0x21, 0x0,
+
+    /* U+003C "<" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xba, 0x0, 0x0, 0x0, 0x17,
+    0xdf, 0xfa, 0x0, 0x0, 0x39, 0xff, 0xfb, 0x50,
+    0x1, 0x6c, 0xff, 0xe9, 0x30, 0x0, 0x6d, 0xff,
+    0xc6, 0x10, 0x0, 0x0, 0xaf, 0xe6, 0x0, 0x0,
+    0x0, 0x0, 0x7e, 0xfe, 0xa5, 0x10, 0x0, 0x0,
+    0x1, 0x7c, 0xff, 0xd7, 0x20, 0x0, 0x0, 0x1,
+    0x5b, 0xef, 0xea, 0x30, 0x0, 0x0, 0x0, 0x39,
+    0xef, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x16, 0xca,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+
+    /* U+003D "=" */
+    0xaf, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x9e, 0xee,
+    0xee, 0xee, 0xee, 0xea, 0x1, 0x11, 0x11, 0x11,
+    0x11, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8b, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xb8, 0xaf, 0xff, 0xff, 0xff,
+    0xff, 0xfa, 0x23, 0x33, 0x33, 0x33, 0x33, 0x32,
+
+    /* U+003E ">" */
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xab, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xfd, 0x71, 0x0,
+    0x0, 0x0, 0x5, 0xbf, 0xff, 0xa3, 0x0, 0x0,
+    0x0, 0x3, 0x9e, 0xff, 0xc6, 0x10, 0x0, 0x0,
+    0x1, 0x6c, 0xff, 0xe6, 0x0, 0x0, 0x0, 0x0,
+    0x6e, 0xfa, 0x0, 0x0, 0x1, 0x4b, 0xef, 0xe7,
+    0x0, 0x2, 0x7d, 0xff, 0xc7, 0x10, 0x4, 0x9e,
+    0xff, 0xb5, 0x10, 0x0, 0x9f, 0xfe, 0x93, 0x0,
+    0x0, 0x0, 0xac, 0x61, 0x0, 0x0, 0x0, 0x0,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+003F "?" */
+    0x0, 0x3, 0x67, 0x64, 0x10, 0x0, 0x1, 0xaf,
+    0xff, 0xff, 0xc4, 0x0, 0xc, 0xfd, 0x74, 0x6c,
+    0xfe, 0x30, 0x6f, 0xe3, 0x0, 0x1, 0xbf, 0xc0,
+    0xbf, 0x80, 0x0, 0x0, 0x3f, 0xf1, 0x7a, 0x30,
+    0x0, 0x0, 0x1f, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x5f, 0xe0, 0x0, 0x0, 0x0, 0x3, 0xef, 0x70,
+    0x0, 0x0, 0x0, 0x4e, 0xfa, 0x0, 0x0, 0x0,
+    0x4, 0xef, 0x90, 0x0, 0x0, 0x0, 0x1c, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x4f, 0xd1, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x6c, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x46, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xc0, 0x0, 0x0,
+
+    /* U+0040 "@" */
+    0x0, 0x0, 0x0, 0x0, 0x24, 0x67, 0x76, 0x31,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xbe,
+    0xff, 0xff, 0xff, 0xd8, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x2b, 0xff, 0xc7, 0x54, 0x46, 0x9d, 0xfe,
+    0x60, 0x0, 0x0, 0x0, 0x3d, 0xfb, 0x30, 0x0,
+    0x0, 0x0, 0x16, 0xef, 0x70, 0x0, 0x0, 0x1d,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xdf,
+    0x50, 0x0, 0xa, 0xf7, 0x0, 0x1, 0x6a, 0x94,
+    0x1, 0x54, 0x3, 0xed, 0x0, 0x4, 0xfa, 0x0,
+    0x4, 0xef, 0xff, 0xf9, 0x6f, 0xb0, 0x8, 0xf5,
+    0x0, 0xaf, 0x30, 0x4, 0xef, 0x82, 0x29, 0xfe,
+    0xf7, 0x0, 0x2f, 0xa0, 0x1e, 0xb0, 0x1, 0xdf,
+    0x70, 0x0, 0xa, 0xff, 0x40, 0x1, 0xdd, 0x5,
+    0xf6, 0x0, 0x7f, 0xc0, 0x0, 0x0, 0x6f, 0xe2,
+    0x0, 0xc, 0xe0, 0x8f, 0x30, 0xd, 0xf6, 0x0,
+    0x0, 0x4, 0xfc, 0x0, 0x1, 0xdd, 0xa, 0xf1,
+    0x2, 0xfe, 0x20, 0x0, 0x0, 0x6f, 0x90, 0x0,
+    0x2f, 0xb0, 0xaf, 0x10, 0x3f, 0xe1, 0x0, 0x0,
+    0x9, 0xf6, 0x0, 0x7, 0xf7, 0xa, 0xf2, 0x3,
+    0xfe, 0x10, 0x0, 0x1, 0xef, 0x30, 0x1, 0xde,
+    0x10, 0x8f, 0x40, 0x1e, 0xf3, 0x0, 0x0, 0x9f,
+    0xe1, 0x1, 0xaf, 0x70, 0x5, 0xf7, 0x0, 0x9f,
+    0xb1, 0x1, 0x9f, 0xfd, 0x13, 0xbf, 0xa0, 0x0,
+    0x1e, 0xc1, 0x2, 0xdf, 0xdb, 0xee, 0x8f, 0xfe,
+    0xff, 0x91, 0x0, 0x0, 0x9f, 0x60, 0x2, 0xae,
+    0xfa, 0x21, 0xaf, 0xeb, 0x50, 0x3, 0x42, 0x2,
+    0xee, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xee, 0x20, 0x5, 0xfe, 0x60, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xee, 0x40, 0x0, 0x5,
+    0xef, 0xc6, 0x20, 0x0, 0x0, 0x1, 0x5c, 0xfe,
+    0x40, 0x0, 0x0, 0x3, 0xaf, 0xfe, 0xca, 0x99,
+    0xac, 0xef, 0xfa, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x38, 0xbd, 0xef, 0xff, 0xec, 0x83, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x12, 0x22, 0x21,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+0041 "A" */
+    0x0, 0x0, 0x0, 0x12, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xf4, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xee, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xf9, 0xee, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0xf4, 0xaf, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xe1, 0x5f, 0xd0, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0x90, 0x1d, 0xf5, 0x0, 0x0,
+    0x0, 0x1, 0xef, 0x40, 0x9, 0xfb, 0x0, 0x0,
+    0x0, 0x6, 0xfc, 0x0, 0x3, 0xff, 0x20, 0x0,
+    0x0, 0xb, 0xf7, 0x0, 0x0, 0xcf, 0x80, 0x0,
+    0x0, 0x3f, 0xf3, 0x11, 0x11, 0x8f, 0xe1, 0x0,
+    0x0, 0x8f, 0xfe, 0xee, 0xee, 0xef, 0xf6, 0x0,
+    0x1, 0xdf, 0xdd, 0xdd, 0xdd, 0xde, 0xfc, 0x0,
+    0x5, 0xfe, 0x20, 0x0, 0x0, 0x5, 0xff, 0x30,
+    0xa, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x90,
+    0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xe1,
+    0x7f, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf6,
+    0xdf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfc,
+
+    /* U+0042 "B" */
+    0x2, 0x22, 0x22, 0x22, 0x10, 0x0, 0x0, 0x4f,
+    0xff, 0xff, 0xff, 0xec, 0x81, 0x0, 0x4f, 0xfe,
+    0xee, 0xee, 0xef, 0xfc, 0x10, 0x4f, 0xe1, 0x0,
+    0x0, 0x15, 0xef, 0x70, 0x4f, 0xe1, 0x0, 0x0,
+    0x0, 0x8f, 0xc0, 0x4f, 0xe1, 0x0, 0x0, 0x0,
+    0x5f, 0xd0, 0x4f, 0xe1, 0x0, 0x0, 0x0, 0x8f,
+    0xa0, 0x4f, 0xe1, 0x0, 0x0, 0x16, 0xee, 0x30,
+    0x4f, 0xfe, 0xee, 0xee, 0xef, 0xe4, 0x0, 0x4f,
+    0xff, 0xff, 0xff, 0xff, 0xfa, 0x20, 0x4f, 0xe3,
+    0x22, 0x22, 0x26, 0xdf, 0xc1, 0x4f, 0xe1, 0x0,
+    0x0, 0x0, 0x2e, 0xf7, 0x4f, 0xe1, 0x0, 0x0,
+    0x0, 0xa, 0xfa, 0x4f, 0xe1, 0x0, 0x0, 0x0,
+    0xa, 0xfb, 0x4f, 0xe1, 0x0, 0x0, 0x0, 0x1e,
+    0xf7, 0x4f, 0xe2, 0x11, 0x11, 0x14, 0xcf, 0xe2,
+    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x4f,
+    0xff, 0xff, 0xff, 0xec, 0x93, 0x0,
+
+    /* U+0043 "C" */
+    0x0, 0x0, 0x1, 0x35, 0x54, 0x20, 0x0, 0x0,
+    0x0, 0x1, 0x7d, 0xff, 0xff, 0xea, 0x30, 0x0,
+    0x0, 0x3d, 0xff, 0xc9, 0x9b, 0xef, 0xe5, 0x0,
+    0x2, 0xdf, 0xc4, 0x0, 0x0, 0x2b, 0xfe, 0x20,
+    0xa, 0xfd, 0x10, 0x0, 0x0, 0x1, 0xdf, 0xa0,
+    0x2f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xa1,
+    0x7f, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x1c, 0x92,
+    0x2e, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xe2,
+    0x9, 0xfd, 0x20, 0x0, 0x0, 0x1, 0xdf, 0xa0,
+    0x2, 0xdf, 0xc4, 0x0, 0x0, 0x3c, 0xfe, 0x20,
+    0x0, 0x3d, 0xff, 0xca, 0x9c, 0xff, 0xe4, 0x0,
+    0x0, 0x2, 0x9e, 0xff, 0xff, 0xfa, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x35, 0x54, 0x10, 0x0, 0x0,
+
+    /* U+0044 "D" */
+    0x2, 0x22, 0x22, 0x22, 0x21, 0x0, 0x0, 0x0,
+    0x3e, 0xff, 0xff, 0xff, 0xed, 0xa3, 0x0, 0x0,
+    0x3f, 0xfe, 0xee, 0xee, 0xef, 0xff, 0x70, 0x0,
+    0x3f, 0xf2, 0x0, 0x0, 0x14, 0xbf, 0xf6, 0x0,
+    0x3f, 0xf2, 0x0, 0x0, 0x0, 0xa, 0xfe, 0x10,
+    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x1, 0xef, 0x70,
+    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xb0,
+    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xd1,
+    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xe1,
+    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xe1,
+    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xe1,
+    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xd1,
+    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xa0,
+    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x2, 0xff, 0x50,
+    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x1b, 0xfd, 0x10,
+    0x3f, 0xf2, 0x11, 0x11, 0x26, 0xcf, 0xf4, 0x0,
+    0x3f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x50, 0x0,
+    0x3f, 0xff, 0xff, 0xff, 0xeb, 0x82, 0x0, 0x0,
+
+    /* U+0045 "E" */
+    0x2, 0x22, 0x22, 0x22, 0x22, 0x22, 0x21, 0x2e,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x2f, 0xfe,
+    0xee, 0xee, 0xee, 0xee, 0xe5, 0x2f, 0xf2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2f, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2f, 0xfe, 0xdd, 0xdd, 0xdd, 0xdd, 0x90, 0x2f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x2f, 0xf4,
+    0x22, 0x22, 0x22, 0x22, 0x10, 0x2f, 0xf2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2f, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2f, 0xf3, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x2f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
+
+    /* U+0046 "F" */
+    0x2, 0x22, 0x22, 0x22, 0x22, 0x22, 0x11, 0xef,
+    0xff, 0xff, 0xff, 0xff, 0xf8, 0x1e, 0xfe, 0xdd,
+    0xdd, 0xdd, 0xdd, 0x71, 0xef, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x1e, 0xf4, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xef, 0x40, 0x0, 0x0, 0x0, 0x0, 0x1e,
+    0xf4, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0x1e, 0xfe, 0xee, 0xee,
+    0xee, 0xe4, 0x1, 0xef, 0xff, 0xff, 0xff, 0xff,
+    0x50, 0x1e, 0xf5, 0x22, 0x22, 0x22, 0x21, 0x1,
+    0xef, 0x40, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xf4,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x1e, 0xf4, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xef, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x1e, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x1, 0xcd,
+    0x30, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+0047 "G" */
+    0x0, 0x0, 0x0, 0x24, 0x55, 0x31, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xcf, 0xff, 0xff, 0xe9, 0x20,
+    0x0, 0x0, 0x1b, 0xff, 0xda, 0x99, 0xcf, 0xfe,
+    0x40, 0x0, 0x1b, 0xfe, 0x61, 0x0, 0x0, 0x3c,
+    0xfd, 0x10, 0x7, 0xfe, 0x40, 0x0, 0x0, 0x0,
+    0x1d, 0xf7, 0x0, 0xdf, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xb0, 0x4f, 0xe2, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x20, 0x8, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xfa, 0x0, 0x0,
+    0x1, 0x99, 0x99, 0x99, 0x91, 0xaf, 0xa0, 0x0,
+    0x0, 0x2f, 0xff, 0xff, 0xff, 0x28, 0xfc, 0x0,
+    0x0, 0x1, 0x77, 0x77, 0x7f, 0xf2, 0x5f, 0xe2,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0x21, 0xdf,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xf2, 0x7,
+    0xff, 0x50, 0x0, 0x0, 0x0, 0x4, 0xff, 0x20,
+    0xb, 0xff, 0x92, 0x0, 0x0, 0x29, 0xef, 0xe2,
+    0x0, 0x1a, 0xff, 0xfd, 0xbb, 0xdf, 0xff, 0xc3,
+    0x0, 0x0, 0x4, 0xbf, 0xff, 0xff, 0xfb, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x13, 0x55, 0x41, 0x0,
+    0x0, 0x0,
+
+    /* U+0048 "H" */
+    0x2, 0x20, 0x0, 0x0, 0x0, 0x0, 0x22, 0x12,
+    0xef, 0x30, 0x0, 0x0, 0x0, 0xd, 0xf6, 0x2e,
+    0xf3, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x62, 0xef,
+    0x30, 0x0, 0x0, 0x0, 0xd, 0xf6, 0x2e, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0xdf, 0x62, 0xef, 0x30,
+    0x0, 0x0, 0x0, 0xd, 0xf6, 0x2e, 0xf3, 0x0,
+    0x0, 0x0, 0x0, 0xdf, 0x62, 0xef, 0x30, 0x0,
+    0x0, 0x0, 0xd, 0xf6, 0x2e, 0xfe, 0xee, 0xee,
+    0xee, 0xee, 0xff, 0x62, 0xef, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf6, 0x2e, 0xf4, 0x22, 0x22, 0x22,
+    0x22, 0xdf, 0x62, 0xef, 0x30, 0x0, 0x0, 0x0,
+    0xd, 0xf6, 0x2e, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0x62, 0xef, 0x30, 0x0, 0x0, 0x0, 0xd,
+    0xf6, 0x2e, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xdf,
+    0x62, 0xef, 0x30, 0x0, 0x0, 0x0, 0xd, 0xf6,
+    0x2e, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x62,
+    0xef, 0x30, 0x0, 0x0, 0x0, 0xd, 0xf6,
+
+    /* U+0049 "I" */
+    0x22, 0x1b, 0xf8, 0xbf, 0x8b, 0xf8, 0xbf, 0x8b,
+    0xf8, 0xbf, 0x8b, 0xf8, 0xbf, 0x8b, 0xf8, 0xbf,
+    0x8b, 0xf8, 0xbf, 0x8b, 0xf8, 0xbf, 0x8b, 0xf8,
+    0xbf, 0x8b, 0xf8,
+
+    /* U+004A "J" */
+    0x0, 0x0, 0x0, 0x0, 0x22, 0x0, 0x0, 0x0,
+    0x0, 0x2f, 0xf3, 0x0, 0x0, 0x0, 0x2, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0x2f, 0xf3, 0x0, 0x0,
+    0x0, 0x2, 0xff, 0x30, 0x0, 0x0, 0x0, 0x2f,
+    0xf3, 0x0, 0x0, 0x0, 0x2, 0xff, 0x30, 0x0,
+    0x0, 0x0, 0x2f, 0xf3, 0x0, 0x0, 0x0, 0x2,
+    0xff, 0x30, 0x0, 0x0, 0x0, 0x2f, 0xf3, 0x0,
+    0x0, 0x0, 0x2, 0xff, 0x30, 0x0, 0x0, 0x0,
+    0x2f, 0xf3, 0x1, 0x10, 0x0, 0x2, 0xff, 0x24,
+    0xdb, 0x0, 0x0, 0x2f, 0xf2, 0x3f, 0xe1, 0x0,
+    0x4, 0xfe, 0x11, 0xef, 0x70, 0x1, 0xbf, 0xb0,
+    0x8, 0xff, 0xcb, 0xdf, 0xf4, 0x0, 0x8, 0xff,
+    0xff, 0xd5, 0x0, 0x0, 0x1, 0x45, 0x30, 0x0,
+    0x0,
+
+    /* U+004B "K" */
+    0x12, 0x20, 0x0, 0x0, 0x0, 0x1, 0x22, 0x14,
+    0xfe, 0x10, 0x0, 0x0, 0x2, 0xdf, 0xd2, 0x4f,
+    0xe1, 0x0, 0x0, 0x3, 0xdf, 0xc2, 0x4, 0xfe,
+    0x10, 0x0, 0x3, 0xdf, 0xc2, 0x0, 0x4f, 0xe1,
+    0x0, 0x3, 0xdf, 0xc1, 0x0, 0x4, 0xfe, 0x10,
+    0x3, 0xdf, 0xc1, 0x0, 0x0, 0x4f, 0xe1, 0x3,
+    0xdf, 0xb1, 0x0, 0x0, 0x4, 0xfe, 0x13, 0xdf,
+    0xb1, 0x0, 0x0, 0x0, 0x4f, 0xe4, 0xef, 0xfd,
+    0x10, 0x0, 0x0, 0x4, 0xff, 0xef, 0xbe, 0xfa,
+    0x0, 0x0, 0x0, 0x4f, 0xff, 0x91, 0x5f, 0xf6,
+    0x0, 0x0, 0x4, 0xff, 0x90, 0x0, 0x9f, 0xe3,
+    0x0, 0x0, 0x4f, 0xe1, 0x0, 0x1, 0xdf, 0xd1,
+    0x0, 0x4, 0xfe, 0x10, 0x0, 0x4, 0xff, 0x90,
+    0x0, 0x4f, 0xe1, 0x0, 0x0, 0x8, 0xff, 0x60,
+    0x4, 0xfe, 0x10, 0x0, 0x0, 0xc, 0xfe, 0x30,
+    0x4f, 0xe1, 0x0, 0x0, 0x0, 0x2e, 0xfc, 0x14,
+    0xfe, 0x10, 0x0, 0x0, 0x0, 0x6f, 0xf9,
+
+    /* U+004C "L" */
+    0x12, 0x20, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xe1,
+    0x0, 0x0, 0x0, 0x0, 0x4f, 0xe1, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xe1, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xe1,
+    0x0, 0x0, 0x0, 0x0, 0x4f, 0xe1, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xe1, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xe1,
+    0x0, 0x0, 0x0, 0x0, 0x4f, 0xe1, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xe1, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xe1,
+    0x0, 0x0, 0x0, 0x0, 0x4f, 0xe1, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xe2, 0x11, 0x11, 0x11, 0x10,
+    0x4f, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x4f, 0xff,
+    0xff, 0xff, 0xff, 0xf8,
+
+    /* U+004D "M" */
+    0x2, 0x22, 0x10, 0x0, 0x0, 0x0, 0x0, 0x22,
+    0x20, 0x3f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x2,
+    0xef, 0xf3, 0x3f, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xf3, 0x3f, 0xff, 0xe2, 0x0, 0x0,
+    0x0, 0xc, 0xff, 0xf3, 0x3f, 0xeb, 0xf6, 0x0,
+    0x0, 0x0, 0x2f, 0xce, 0xf3, 0x3f, 0xe6, 0xfb,
+    0x0, 0x0, 0x0, 0x7f, 0x7e, 0xf3, 0x3f, 0xe2,
+    0xee, 0x20, 0x0, 0x0, 0xce, 0x2e, 0xf3, 0x3f,
+    0xe1, 0xaf, 0x60, 0x0, 0x3, 0xfa, 0x1e, 0xf3,
+    0x3f, 0xe1, 0x4f, 0xb0, 0x0, 0x8, 0xf5, 0x1e,
+    0xf3, 0x3f, 0xe1, 0x1d, 0xe2, 0x0, 0xd, 0xe1,
+    0x1e, 0xf3, 0x3f, 0xe1, 0x9, 0xf6, 0x0, 0x3f,
+    0x90, 0x1e, 0xf3, 0x3f, 0xe1, 0x4, 0xfc, 0x0,
+    0x8f, 0x40, 0x1e, 0xf3, 0x3f, 0xe1, 0x1, 0xde,
+    0x20, 0xdd, 0x0, 0x1e, 0xf3, 0x3f, 0xe1, 0x0,
+    0x9f, 0x74, 0xf8, 0x0, 0x1e, 0xf3, 0x3f, 0xe1,
+    0x0, 0x4f, 0xb9, 0xf3, 0x0, 0x1e, 0xf3, 0x3f,
+    0xe1, 0x0, 0x1d, 0xfe, 0xd0, 0x0, 0x1e, 0xf3,
+    0x3f, 0xe1, 0x0, 0x9, 0xff, 0x80, 0x0, 0x1e,
+    0xf3, 0x3f, 0xe1, 0x0, 0x3, 0xff, 0x30, 0x0,
+    0x1e, 0xf3,
+
+    /* U+004E "N" */
+    0x2, 0x21, 0x0, 0x0, 0x0, 0x0, 0x22, 0x13,
+    0xff, 0x90, 0x0, 0x0, 0x0, 0xc, 0xf6, 0x3f,
+    0xff, 0x40, 0x0, 0x0, 0x0, 0xcf, 0x63, 0xff,
+    0xfd, 0x10, 0x0, 0x0, 0xc, 0xf6, 0x3f, 0xfe,
+    0xf9, 0x0, 0x0, 0x0, 0xcf, 0x63, 0xfe, 0x7f,
+    0xf4, 0x0, 0x0, 0xc, 0xf6, 0x3f, 0xe1, 0xaf,
+    0xd1, 0x0, 0x0, 0xcf, 0x63, 0xfe, 0x12, 0xef,
+    0x90, 0x0, 0xc, 0xf6, 0x3f, 0xe1, 0x5, 0xff,
+    0x50, 0x0, 0xcf, 0x63, 0xfe, 0x10, 0xa, 0xfd,
+    0x10, 0xc, 0xf6, 0x3f, 0xe1, 0x0, 0x2d, 0xf9,
+    0x0, 0xcf, 0x63, 0xfe, 0x10, 0x0, 0x5f, 0xf5,
+    0xc, 0xf6, 0x3f, 0xe1, 0x0, 0x0, 0xaf, 0xd1,
+    0xcf, 0x63, 0xfe, 0x10, 0x0, 0x1, 0xdf, 0x9c,
+    0xf6, 0x3f, 0xe1, 0x0, 0x0, 0x5, 0xff, 0xff,
+    0x63, 0xfe, 0x10, 0x0, 0x0, 0xa, 0xff, 0xf6,
+    0x3f, 0xe1, 0x0, 0x0, 0x0, 0x1e, 0xff, 0x63,
+    0xfe, 0x10, 0x0, 0x0, 0x0, 0x5f, 0xf6,
+
+    /* U+004F "O" */
+    0x0, 0x0, 0x1, 0x35, 0x54, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x17, 0xdf, 0xff, 0xff, 0xc5, 0x0,
+    0x0, 0x0, 0x2c, 0xff, 0xda, 0x9a, 0xef, 0xf9,
+    0x10, 0x0, 0x1d, 0xfd, 0x50, 0x0, 0x1, 0x7f,
+    0xfa, 0x0, 0x9, 0xfd, 0x20, 0x0, 0x0, 0x0,
+    0x5f, 0xf5, 0x2, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0xc0, 0x7f, 0xd1, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0x3a, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xe, 0xf6, 0xcf, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xcf, 0x8c, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xc, 0xf9, 0xcf, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xcf, 0x8a, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xe, 0xf6, 0x6f, 0xd1,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x32, 0xef,
+    0x60, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xc0, 0x8,
+    0xfe, 0x30, 0x0, 0x0, 0x0, 0x5f, 0xf5, 0x0,
+    0x1c, 0xfd, 0x50, 0x0, 0x1, 0x7f, 0xf9, 0x0,
+    0x0, 0x2b, 0xff, 0xda, 0x9b, 0xef, 0xf9, 0x10,
+    0x0, 0x0, 0x6, 0xdf, 0xff, 0xff, 0xb4, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x24, 0x54, 0x10, 0x0,
+    0x0, 0x0,
+
+    /* U+0050 "P" */
+    0x2, 0x22, 0x22, 0x22, 0x21, 0x0, 0x0, 0x3,
+    0xef, 0xff, 0xff, 0xff, 0xec, 0x61, 0x0, 0x3f,
+    0xfe, 0xee, 0xee, 0xee, 0xff, 0xa0, 0x3, 0xff,
+    0x20, 0x0, 0x0, 0x28, 0xff, 0x60, 0x3f, 0xf2,
+    0x0, 0x0, 0x0, 0xb, 0xfb, 0x3, 0xff, 0x20,
+    0x0, 0x0, 0x0, 0x6f, 0xd1, 0x3f, 0xf2, 0x0,
+    0x0, 0x0, 0x7, 0xfd, 0x13, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0xbf, 0xb0, 0x3f, 0xf2, 0x0, 0x0,
+    0x2, 0x9f, 0xf5, 0x3, 0xff, 0xed, 0xdd, 0xde,
+    0xff, 0xf9, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xfe,
+    0xc6, 0x0, 0x3, 0xff, 0x42, 0x22, 0x22, 0x10,
+    0x0, 0x0, 0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+0051 "Q" */
+    0x0, 0x0, 0x1, 0x35, 0x54, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x18, 0xdf, 0xff, 0xfe, 0xb4, 0x0,
+    0x0, 0x0, 0x3d, 0xff, 0xc9, 0x9b, 0xef, 0xf8,
+    0x0, 0x0, 0x2d, 0xfc, 0x40, 0x0, 0x1, 0x9f,
+    0xf8, 0x0, 0xb, 0xfc, 0x10, 0x0, 0x0, 0x0,
+    0x7f, 0xf4, 0x3, 0xff, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0xcf, 0xa0, 0x8f, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xfe, 0x2c, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2e, 0xf4, 0xef, 0x60, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xef, 0x6e, 0xf6, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xe, 0xf7, 0xef, 0x60, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xef, 0x6c, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2e, 0xf4, 0x8f, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xfe, 0x23, 0xff,
+    0x40, 0x0, 0x2, 0x72, 0x0, 0xbf, 0xb0, 0xa,
+    0xfd, 0x20, 0x0, 0x7f, 0xe7, 0x7f, 0xf4, 0x0,
+    0x2d, 0xfd, 0x40, 0x1, 0x6d, 0xff, 0xf8, 0x0,
+    0x0, 0x2c, 0xff, 0xca, 0x9b, 0xef, 0xff, 0x60,
+    0x0, 0x0, 0x17, 0xdf, 0xff, 0xff, 0xb7, 0xef,
+    0xc4, 0x0, 0x0, 0x0, 0x25, 0x54, 0x10, 0x2,
+    0xaf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x21,
+
+    /* U+0052 "R" */
+    0x2, 0x22, 0x22, 0x22, 0x22, 0x10, 0x0, 0x0,
+    0x2f, 0xff, 0xff, 0xff, 0xff, 0xec, 0x60, 0x0,
+    0x2f, 0xfc, 0xbb, 0xbb, 0xbc, 0xef, 0xf8, 0x0,
+    0x2f, 0xf2, 0x0, 0x0, 0x0, 0x1a, 0xff, 0x30,
+    0x2f, 0xf2, 0x0, 0x0, 0x0, 0x1, 0xef, 0x70,
+    0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x90,
+    0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x80,
+    0x2f, 0xf2, 0x0, 0x0, 0x0, 0x8, 0xff, 0x30,
+    0x2f, 0xf9, 0x88, 0x88, 0x89, 0xdf, 0xf8, 0x0,
+    0x2f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x60, 0x0,
+    0x2f, 0xf8, 0x77, 0x7b, 0xff, 0x70, 0x0, 0x0,
+    0x2f, 0xf2, 0x0, 0x0, 0x5f, 0xf8, 0x0, 0x0,
+    0x2f, 0xf2, 0x0, 0x0, 0x7, 0xff, 0x60, 0x0,
+    0x2f, 0xf2, 0x0, 0x0, 0x0, 0xbf, 0xe2, 0x0,
+    0x2f, 0xf2, 0x0, 0x0, 0x0, 0x2e, 0xfb, 0x0,
+    0x2f, 0xf2, 0x0, 0x0, 0x0, 0x7, 0xff, 0x60,
+    0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xe2,
+    0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfa,
+
+    /* U+0053 "S" */
+    0x0, 0x0, 0x25, 0x66, 0x41, 0x0, 0x0, 0x0,
+    0x4b, 0xff, 0xff, 0xfe, 0x92, 0x0, 0x4, 0xef,
+    0xea, 0x99, 0xcf, 0xfd, 0x20, 0xc, 0xfa, 0x10,
+    0x0, 0x3, 0xdf, 0xa0, 0x3f, 0xe2, 0x0, 0x0,
+    0x0, 0x5f, 0xf1, 0x4f, 0xe1, 0x0, 0x0, 0x0,
+    0xc, 0xb2, 0x2e, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9, 0xff, 0xc7, 0x41, 0x0, 0x0, 0x0,
+    0x1, 0x9f, 0xff, 0xfe, 0xb7, 0x20, 0x0, 0x0,
+    0x3, 0x9d, 0xff, 0xff, 0xf9, 0x10, 0x0, 0x0,
+    0x1, 0x26, 0xad, 0xff, 0xb1, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x7f, 0xf6, 0x79, 0x30, 0x0, 0x0,
+    0x0, 0xa, 0xfa, 0xcf, 0x70, 0x0, 0x0, 0x0,
+    0x7, 0xfb, 0x8f, 0xd2, 0x0, 0x0, 0x0, 0xb,
+    0xf8, 0x2e, 0xfd, 0x51, 0x0, 0x1, 0x9f, 0xe2,
+    0x4, 0xef, 0xfd, 0xbb, 0xce, 0xff, 0x60, 0x0,
+    0x2a, 0xef, 0xff, 0xff, 0xb3, 0x0, 0x0, 0x0,
+    0x3, 0x55, 0x41, 0x0, 0x0,
+
+    /* U+0054 "T" */
+    0x12, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x6,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x6e,
+    0xee, 0xee, 0xff, 0xee, 0xee, 0xee, 0x20, 0x0,
+    0x0, 0xc, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xc, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xcf, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xc, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xcf, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0xf8, 0x0, 0x0, 0x0,
+
+    /* U+0055 "U" */
+    0x2, 0x20, 0x0, 0x0, 0x0, 0x0, 0x22, 0x12,
+    0xff, 0x20, 0x0, 0x0, 0x0, 0xd, 0xf6, 0x2f,
+    0xf2, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x62, 0xff,
+    0x20, 0x0, 0x0, 0x0, 0xd, 0xf6, 0x2f, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0xdf, 0x62, 0xff, 0x20,
+    0x0, 0x0, 0x0, 0xd, 0xf6, 0x2f, 0xf2, 0x0,
+    0x0, 0x0, 0x0, 0xdf, 0x62, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0xd, 0xf6, 0x2f, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0x62, 0xff, 0x20, 0x0, 0x0,
+    0x0, 0xd, 0xf6, 0x2f, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0xdf, 0x62, 0xff, 0x30, 0x0, 0x0, 0x0,
+    0xe, 0xf6, 0x1e, 0xf4, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0x50, 0xdf, 0x60, 0x0, 0x0, 0x0, 0x2f,
+    0xf3, 0xa, 0xfc, 0x10, 0x0, 0x0, 0x8, 0xfd,
+    0x10, 0x4f, 0xfa, 0x20, 0x0, 0x16, 0xff, 0x80,
+    0x0, 0x8f, 0xfe, 0xcb, 0xbe, 0xff, 0xb1, 0x0,
+    0x0, 0x5d, 0xff, 0xff, 0xfe, 0x70, 0x0, 0x0,
+    0x0, 0x2, 0x45, 0x53, 0x0, 0x0, 0x0,
+
+    /* U+0056 "V" */
+    0x22, 0x10, 0x0, 0x0, 0x0, 0x0, 0x1, 0x22,
+    0xaf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf8,
+    0x4f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf3,
+    0xd, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xb0,
+    0x7, 0xfd, 0x10, 0x0, 0x0, 0x0, 0xdf, 0x60,
+    0x2, 0xff, 0x30, 0x0, 0x0, 0x3, 0xfe, 0x10,
+    0x0, 0xbf, 0x90, 0x0, 0x0, 0x9, 0xf9, 0x0,
+    0x0, 0x5f, 0xd1, 0x0, 0x0, 0x1e, 0xf3, 0x0,
+    0x0, 0x1d, 0xf5, 0x0, 0x0, 0x5f, 0xc0, 0x0,
+    0x0, 0x8, 0xfa, 0x0, 0x0, 0xbf, 0x60, 0x0,
+    0x0, 0x3, 0xfe, 0x20, 0x2, 0xfe, 0x10, 0x0,
+    0x0, 0x0, 0xbf, 0x60, 0x7, 0xfa, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xb0, 0xc, 0xf4, 0x0, 0x0,
+    0x0, 0x0, 0x1e, 0xe2, 0x3f, 0xd0, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xf7, 0x8f, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xfc, 0xde, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xcf, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xf5, 0x0, 0x0, 0x0,
+
+    /* U+0057 "W" */
+    0x12, 0x10, 0x0, 0x0, 0x0, 0x22, 0x20, 0x0,
+    0x0, 0x0, 0x22, 0x18, 0xfb, 0x0, 0x0, 0x0,
+    0x3f, 0xfe, 0x0, 0x0, 0x0, 0x2e, 0xf3, 0x4f,
+    0xe1, 0x0, 0x0, 0x7, 0xff, 0xf3, 0x0, 0x0,
+    0x5, 0xfe, 0x1, 0xef, 0x40, 0x0, 0x0, 0xbf,
+    0xbf, 0x70, 0x0, 0x0, 0x8f, 0xa0, 0xb, 0xf7,
+    0x0, 0x0, 0x1e, 0xe4, 0xfc, 0x0, 0x0, 0xc,
+    0xf6, 0x0, 0x7f, 0xb0, 0x0, 0x5, 0xfa, 0xf,
+    0xf1, 0x0, 0x1, 0xee, 0x20, 0x3, 0xfd, 0x10,
+    0x0, 0x9f, 0x60, 0xbf, 0x50, 0x0, 0x4f, 0xc0,
+    0x0, 0xe, 0xf3, 0x0, 0xd, 0xf2, 0x6, 0xf9,
+    0x0, 0x8, 0xf8, 0x0, 0x0, 0xaf, 0x60, 0x2,
+    0xfc, 0x0, 0x2f, 0xd1, 0x0, 0xcf, 0x40, 0x0,
+    0x6, 0xfa, 0x0, 0x6f, 0x80, 0x0, 0xdf, 0x30,
+    0x1e, 0xe1, 0x0, 0x0, 0x3f, 0xd0, 0xb, 0xf4,
+    0x0, 0x9, 0xf7, 0x4, 0xfb, 0x0, 0x0, 0x0,
+    0xdf, 0x21, 0xee, 0x10, 0x0, 0x5f, 0xb0, 0x8f,
+    0x70, 0x0, 0x0, 0x9, 0xf5, 0x4f, 0xb0, 0x0,
+    0x1, 0xee, 0x1b, 0xf3, 0x0, 0x0, 0x0, 0x5f,
+    0x88, 0xf6, 0x0, 0x0, 0xb, 0xf4, 0xed, 0x10,
+    0x0, 0x0, 0x2, 0xeb, 0xcf, 0x30, 0x0, 0x0,
+    0x7f, 0x9f, 0x90, 0x0, 0x0, 0x0, 0xc, 0xee,
+    0xd0, 0x0, 0x0, 0x3, 0xfe, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xf9, 0x0, 0x0, 0x0, 0xe,
+    0xfe, 0x20, 0x0, 0x0, 0x0, 0x4, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0xaf, 0xc0, 0x0, 0x0,
+
+    /* U+0058 "X" */
+    0x2, 0x22, 0x0, 0x0, 0x0, 0x0, 0x2, 0x21,
+    0xa, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x8f, 0xd1,
+    0x1, 0xdf, 0xb0, 0x0, 0x0, 0x5, 0xfe, 0x30,
+    0x0, 0x4f, 0xf7, 0x0, 0x0, 0x2e, 0xf7, 0x0,
+    0x0, 0x8, 0xfe, 0x30, 0x1, 0xcf, 0xa0, 0x0,
+    0x0, 0x1, 0xcf, 0xc1, 0x9, 0xfd, 0x10, 0x0,
+    0x0, 0x0, 0x2e, 0xf8, 0x5f, 0xe3, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xff, 0xef, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9f, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x2e, 0xf8, 0x8f, 0xe3, 0x0, 0x0,
+    0x0, 0x1, 0xbf, 0xb1, 0x1c, 0xfd, 0x10, 0x0,
+    0x0, 0x8, 0xfe, 0x20, 0x3, 0xef, 0x90, 0x0,
+    0x0, 0x5f, 0xf6, 0x0, 0x0, 0x7f, 0xf5, 0x0,
+    0x2, 0xef, 0x90, 0x0, 0x0, 0xb, 0xfe, 0x20,
+    0xb, 0xfd, 0x10, 0x0, 0x0, 0x2, 0xef, 0xb0,
+    0x8f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf7,
+
+    /* U+0059 "Y" */
+    0x22, 0x20, 0x0, 0x0, 0x0, 0x0, 0x2, 0x22,
+    0x8f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf6,
+    0x1c, 0xfd, 0x10, 0x0, 0x0, 0x1, 0xdf, 0xa0,
+    0x3, 0xef, 0x80, 0x0, 0x0, 0x9, 0xfd, 0x10,
+    0x0, 0x7f, 0xf4, 0x0, 0x0, 0x4f, 0xf4, 0x0,
+    0x0, 0xc, 0xfc, 0x10, 0x1, 0xdf, 0x90, 0x0,
+    0x0, 0x3, 0xef, 0x80, 0x8, 0xfd, 0x10, 0x0,
+    0x0, 0x0, 0x7f, 0xe3, 0x3f, 0xf3, 0x0, 0x0,
+    0x0, 0x0, 0x1c, 0xfb, 0xbf, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xef, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xe3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xe1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xe1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xe1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xe1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xe1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xe1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xe1, 0x0, 0x0, 0x0,
+
+    /* U+005A "Z" */
+    0x1, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x0,
+    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x7,
+    0xee, 0xee, 0xee, 0xee, 0xef, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7, 0xff, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xef, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xdf, 0xc1, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xbf, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xf9, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2d, 0xfb, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x1b, 0xfd, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xfe, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xef, 0x81, 0x11, 0x11, 0x11, 0x11, 0x10,
+    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x18,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
+
+    /* U+005B "[" */
+    0x12, 0x22, 0x21, 0x6f, 0xff, 0xf4, 0x6f, 0xd9,
+    0x93, 0x6f, 0xb0, 0x0, 0x6f, 0xb0, 0x0, 0x6f,
+    0xb0, 0x0, 0x6f, 0xb0, 0x0, 0x6f, 0xb0, 0x0,
+    0x6f, 0xb0, 0x0, 0x6f, 0xb0, 0x0, 0x6f, 0xb0,
+    0x0, 0x6f, 0xb0, 0x0, 0x6f, 0xb0, 0x0, 0x6f,
+    0xb0, 0x0, 0x6f, 0xb0, 0x0, 0x6f, 0xb0, 0x0,
+    0x6f, 0xb0, 0x0, 0x6f, 0xb0, 0x0, 0x6f, 0xb0,
+    0x0, 0x6f, 0xb0, 0x0, 0x6f, 0xb0, 0x0, 0x6f,
+    0xfe, 0xe4, 0x5c, 0xcc, 0xc3,
+
+    /* U+005C "\\" */
+    0x53, 0x0, 0x0, 0xc, 0xd1, 0x0, 0x0, 0x7f,
+    0x30, 0x0, 0x3, 0xf7, 0x0, 0x0, 0xe, 0xb0,
+    0x0, 0x0, 0xae, 0x10, 0x0, 0x5, 0xf5, 0x0,
+    0x0, 0x2e, 0x90, 0x0, 0x0, 0xcd, 0x10, 0x0,
+    0x8, 0xf3, 0x0, 0x0, 0x4f, 0x70, 0x0, 0x1,
+    0xeb, 0x0, 0x0, 0xa, 0xe1, 0x0, 0x0, 0x6f,
+    0x50, 0x0, 0x2, 0xe9, 0x0, 0x0, 0xc, 0xd0,
+    0x0, 0x0, 0x8f, 0x30, 0x0, 0x4, 0xf6, 0x0,
+    0x0, 0x15, 0x30,
+
+    /* U+005D "]" */
+    0x12, 0x22, 0x20, 0x8f, 0xff, 0xf2, 0x59, 0x9f,
+    0xf2, 0x0, 0x1e, 0xf2, 0x0, 0x1e, 0xf2, 0x0,
+    0x1e, 0xf2, 0x0, 0x1e, 0xf2, 0x0, 0x1e, 0xf2,
+    0x0, 0x1e, 0xf2, 0x0, 0x1e, 0xf2, 0x0, 0x1e,
+    0xf2, 0x0, 0x1e, 0xf2, 0x0, 0x1e, 0xf2, 0x0,
+    0x1e, 0xf2, 0x0, 0x1e, 0xf2, 0x0, 0x1e, 0xf2,
+    0x0, 0x1e, 0xf2, 0x0, 0x1e, 0xf2, 0x0, 0x1e,
+    0xf2, 0x0, 0x1e, 0xf2, 0x0, 0x1e, 0xf2, 0x7e,
+    0xef, 0xf2, 0x7c, 0xcc, 0xc2,
+
+    /* U+005E "^" */
+    0x0, 0x0, 0x4a, 0x60, 0x0, 0x0, 0x0, 0xb,
+    0xfe, 0x10, 0x0, 0x0, 0x3, 0xff, 0xf6, 0x0,
+    0x0, 0x0, 0x9f, 0x7e, 0xc0, 0x0, 0x0, 0x2e,
+    0xd1, 0xaf, 0x50, 0x0, 0x7, 0xf8, 0x4, 0xfb,
+    0x0, 0x1, 0xde, 0x20, 0xc, 0xf3, 0x0, 0x6f,
+    0xa0, 0x0, 0x6f, 0xa0, 0xc, 0xf5, 0x0, 0x1,
+    0xee, 0x22, 0xba, 0x10, 0x0, 0x8, 0xc5,
+
+    /* U+005F "_" */
+    0x4b, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x74,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xc7,
+
+    /* U+0060 "`" */
+    0x45, 0x40, 0x5, 0xff, 0x40, 0x7, 0xfb, 0x0,
+    0x9, 0xe3,
+
+    /* U+0061 "a" */
+    0x0, 0x1, 0x69, 0xaa, 0x84, 0x0, 0x0, 0x5,
+    0xef, 0xff, 0xff, 0xfa, 0x0, 0x3, 0xff, 0x82,
+    0x12, 0x8f, 0xf5, 0x0, 0x9f, 0xa0, 0x0, 0x0,
+    0xaf, 0x90, 0x2, 0x52, 0x0, 0x0, 0x7, 0xfa,
+    0x0, 0x0, 0x1, 0x23, 0x69, 0xdf, 0xa0, 0x0,
+    0x3a, 0xde, 0xff, 0xfe, 0xfa, 0x0, 0x5e, 0xfd,
+    0xb8, 0x52, 0x7f, 0xa0, 0xd, 0xf9, 0x10, 0x0,
+    0x8, 0xfa, 0x2, 0xff, 0x20, 0x0, 0x0, 0xbf,
+    0xa0, 0x1f, 0xf5, 0x0, 0x0, 0x6f, 0xfa, 0x0,
+    0xaf, 0xe7, 0x56, 0xaf, 0xdf, 0xc0, 0x1, 0xbf,
+    0xff, 0xfd, 0x62, 0xff, 0x20, 0x0, 0x25, 0x53,
+    0x0, 0x1, 0x10,
+
+    /* U+0062 "b" */
+    0x12, 0x10, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xa0,
+    0x69, 0xa7, 0x20, 0x0, 0x6f, 0xbc, 0xff, 0xff,
+    0xf6, 0x0, 0x6f, 0xfe, 0x71, 0x29, 0xff, 0x40,
+    0x6f, 0xf5, 0x0, 0x0, 0x9f, 0xb0, 0x6f, 0xc0,
+    0x0, 0x0, 0x2f, 0xf1, 0x6f, 0x90, 0x0, 0x0,
+    0xd, 0xf4, 0x6f, 0x80, 0x0, 0x0, 0xc, 0xf5,
+    0x6f, 0x80, 0x0, 0x0, 0xc, 0xf5, 0x6f, 0xa0,
+    0x0, 0x0, 0x1e, 0xf3, 0x6f, 0xd1, 0x0, 0x0,
+    0x4f, 0xe0, 0x6f, 0xf8, 0x0, 0x2, 0xcf, 0x80,
+    0x6f, 0xef, 0xa6, 0x7d, 0xfc, 0x10, 0x6f, 0x88,
+    0xff, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x15, 0x52,
+    0x0, 0x0,
+
+    /* U+0063 "c" */
+    0x0, 0x0, 0x49, 0xa9, 0x61, 0x0, 0x0, 0x2c,
+    0xff, 0xff, 0xfd, 0x30, 0x1, 0xdf, 0xc4, 0x13,
+    0xaf, 0xd1, 0x7, 0xfd, 0x10, 0x0, 0x1d, 0xf5,
+    0xc, 0xf6, 0x0, 0x0, 0x5, 0x63, 0xe, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0x1f, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0xe, 0xf4, 0x0, 0x0, 0x3, 0x63, 0xb, 0xf8,
+    0x0, 0x0, 0x8, 0xf9, 0x5, 0xfe, 0x30, 0x0,
+    0x2e, 0xf4, 0x0, 0x9f, 0xe9, 0x68, 0xef, 0x90,
+    0x0, 0x7, 0xef, 0xff, 0xe7, 0x0, 0x0, 0x0,
+    0x14, 0x54, 0x10, 0x0,
+
+    /* U+0064 "d" */
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x21, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfa,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xfa, 0x0, 0x1,
+    0x6a, 0xa7, 0x17, 0xfa, 0x0, 0x4e, 0xff, 0xff,
+    0xda, 0xfa, 0x2, 0xef, 0xa3, 0x15, 0xdf, 0xfa,
+    0x8, 0xfb, 0x0, 0x0, 0x3e, 0xfa, 0xd, 0xf5,
+    0x0, 0x0, 0xa, 0xfa, 0x1f, 0xf1, 0x0, 0x0,
+    0x7, 0xfa, 0x3f, 0xe1, 0x0, 0x0, 0x5, 0xfa,
+    0x2f, 0xe1, 0x0, 0x0, 0x5, 0xfa, 0x1f, 0xf2,
+    0x0, 0x0, 0x7, 0xfa, 0xb, 0xf7, 0x0, 0x0,
+    0xb, 0xfa, 0x5, 0xfe, 0x30, 0x0, 0x5f, 0xfa,
+    0x0, 0xaf, 0xe8, 0x6a, 0xfe, 0xfa, 0x0, 0x8,
+    0xff, 0xff, 0xa6, 0xfa, 0x0, 0x0, 0x14, 0x52,
+    0x0, 0x0,
+
+    /* U+0065 "e" */
+    0x0, 0x0, 0x49, 0xa9, 0x61, 0x0, 0x0, 0x2,
+    0xbf, 0xff, 0xff, 0xe4, 0x0, 0x1, 0xcf, 0xc4,
+    0x12, 0x9f, 0xe3, 0x0, 0x7f, 0xd1, 0x0, 0x0,
+    0x9f, 0xa0, 0xc, 0xf7, 0x0, 0x0, 0x2, 0xff,
+    0x11, 0xff, 0x63, 0x33, 0x33, 0x3e, 0xf4, 0x2f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x52, 0xff, 0x88,
+    0x88, 0x88, 0x88, 0x83, 0xe, 0xf3, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xbf, 0x80, 0x0, 0x0, 0x2c,
+    0xb2, 0x5, 0xfe, 0x40, 0x0, 0xa, 0xfc, 0x0,
+    0xa, 0xff, 0xa6, 0x7c, 0xfe, 0x40, 0x0, 0x7,
+    0xef, 0xff, 0xfc, 0x30, 0x0, 0x0, 0x0, 0x35,
+    0x52, 0x0, 0x0,
+
+    /* U+0066 "f" */
+    0x0, 0x1, 0x45, 0x41, 0x0, 0x2c, 0xff, 0xf6,
+    0x0, 0xaf, 0xe9, 0x92, 0x0, 0xdf, 0x50, 0x0,
+    0x0, 0xef, 0x30, 0x0, 0x34, 0xef, 0x64, 0x20,
+    0xcf, 0xff, 0xff, 0x90, 0x46, 0xef, 0x76, 0x30,
+    0x0, 0xef, 0x30, 0x0, 0x0, 0xef, 0x30, 0x0,
+    0x0, 0xef, 0x30, 0x0, 0x0, 0xef, 0x30, 0x0,
+    0x0, 0xef, 0x30, 0x0, 0x0, 0xef, 0x30, 0x0,
+    0x0, 0xef, 0x30, 0x0, 0x0, 0xef, 0x30, 0x0,
+    0x0, 0xef, 0x30, 0x0, 0x0, 0xef, 0x30, 0x0,
+    0x0, 0x23, 0x0, 0x0,
+
+    /* U+0067 "g" */
+    0x0, 0x1, 0x6a, 0xa7, 0x21, 0x64, 0x0, 0x4e,
+    0xff, 0xff, 0xe7, 0xfb, 0x2, 0xef, 0xa3, 0x15,
+    0xdf, 0xfb, 0x9, 0xfb, 0x0, 0x0, 0x2e, 0xfb,
+    0xe, 0xf4, 0x0, 0x0, 0x8, 0xfb, 0x2f, 0xe1,
+    0x0, 0x0, 0x5, 0xfb, 0x3f, 0xe1, 0x0, 0x0,
+    0x4, 0xfb, 0x3f, 0xe1, 0x0, 0x0, 0x4, 0xfb,
+    0x1f, 0xf2, 0x0, 0x0, 0x7, 0xfb, 0xb, 0xf8,
+    0x0, 0x0, 0xc, 0xfb, 0x4, 0xfe, 0x50, 0x1,
+    0x9f, 0xfb, 0x0, 0x8f, 0xfc, 0xbd, 0xfc, 0xfb,
+    0x0, 0x5, 0xcf, 0xfc, 0x56, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xfa, 0xa, 0xb3, 0x0, 0x0,
+    0xa, 0xf7, 0x9, 0xfa, 0x10, 0x0, 0x6f, 0xf2,
+    0x2, 0xef, 0xda, 0x9c, 0xff, 0x70, 0x0, 0x2a,
+    0xdf, 0xfe, 0xb4, 0x0, 0x0, 0x0, 0x12, 0x21,
+    0x0, 0x0,
+
+    /* U+0068 "h" */
+    0x12, 0x10, 0x0, 0x0, 0x0, 0x6, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xb0, 0x0, 0x0, 0x0,
+    0x6, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xb0,
+    0x0, 0x0, 0x0, 0x6, 0xfb, 0x4, 0x9a, 0x94,
+    0x0, 0x6f, 0xbb, 0xff, 0xff, 0xfa, 0x6, 0xff,
+    0xe7, 0x33, 0x8f, 0xf5, 0x6f, 0xf5, 0x0, 0x0,
+    0xaf, 0x96, 0xfd, 0x10, 0x0, 0x7, 0xfa, 0x6f,
+    0xb0, 0x0, 0x0, 0x6f, 0xb6, 0xfb, 0x0, 0x0,
+    0x6, 0xfb, 0x6f, 0xb0, 0x0, 0x0, 0x6f, 0xb6,
+    0xfb, 0x0, 0x0, 0x6, 0xfb, 0x6f, 0xb0, 0x0,
+    0x0, 0x6f, 0xb6, 0xfb, 0x0, 0x0, 0x6, 0xfb,
+    0x6f, 0xb0, 0x0, 0x0, 0x6f, 0xb6, 0xfb, 0x0,
+    0x0, 0x6, 0xfb,
+
+    /* U+0069 "i" */
+    0x12, 0x26, 0xfb, 0x6f, 0xb2, 0x43, 0x0, 0x2,
+    0x64, 0x6f, 0xb6, 0xfb, 0x6f, 0xb6, 0xfb, 0x6f,
+    0xb6, 0xfb, 0x6f, 0xb6, 0xfb, 0x6f, 0xb6, 0xfb,
+    0x6f, 0xb6, 0xfb,
+
+    /* U+006A "j" */
+    0x0, 0x12, 0x10, 0x6, 0xfa, 0x0, 0x6f, 0xa0,
+    0x2, 0x53, 0x0, 0x0, 0x0, 0x3, 0x64, 0x0,
+    0x6f, 0xa0, 0x6, 0xfa, 0x0, 0x6f, 0xa0, 0x6,
+    0xfa, 0x0, 0x6f, 0xa0, 0x6, 0xfa, 0x0, 0x6f,
+    0xa0, 0x6, 0xfa, 0x0, 0x6f, 0xa0, 0x6, 0xfa,
+    0x0, 0x6f, 0xa0, 0x6, 0xfa, 0x0, 0x6f, 0xa0,
+    0x7, 0xfa, 0x0, 0xaf, 0x8a, 0xbf, 0xf4, 0xef,
+    0xe8, 0x1, 0x21, 0x0,
+
+    /* U+006B "k" */
+    0x12, 0x10, 0x0, 0x0, 0x0, 0x6, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xb0, 0x0, 0x0, 0x0,
+    0x6, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xb0,
+    0x0, 0x0, 0x0, 0x6, 0xfb, 0x0, 0x0, 0x36,
+    0x61, 0x6f, 0xb0, 0x0, 0x4e, 0xf8, 0x6, 0xfb,
+    0x0, 0x4e, 0xf7, 0x0, 0x6f, 0xb0, 0x4e, 0xf7,
+    0x0, 0x6, 0xfb, 0x4e, 0xf6, 0x0, 0x0, 0x6f,
+    0xde, 0xfd, 0x10, 0x0, 0x6, 0xff, 0xee, 0xf8,
+    0x0, 0x0, 0x6f, 0xe5, 0x4f, 0xe4, 0x0, 0x6,
+    0xfb, 0x0, 0x9f, 0xc1, 0x0, 0x6f, 0xb0, 0x1,
+    0xdf, 0x80, 0x6, 0xfb, 0x0, 0x5, 0xff, 0x40,
+    0x6f, 0xb0, 0x0, 0xa, 0xfd, 0x16, 0xfb, 0x0,
+    0x0, 0x2e, 0xf9,
+
+    /* U+006C "l" */
+    0x12, 0x17, 0xfa, 0x7f, 0xa7, 0xfa, 0x7f, 0xa7,
+    0xfa, 0x7f, 0xa7, 0xfa, 0x7f, 0xa7, 0xfa, 0x7f,
+    0xa7, 0xfa, 0x7f, 0xa7, 0xfa, 0x7f, 0xa7, 0xfa,
+    0x7f, 0xa7, 0xfa,
+
+    /* U+006D "m" */
+    0x26, 0x30, 0x59, 0xa8, 0x20, 0x2, 0x8a, 0x94,
+    0x0, 0x6f, 0x8b, 0xff, 0xff, 0xe3, 0x6f, 0xff,
+    0xff, 0x80, 0x6f, 0xee, 0x73, 0x4c, 0xfd, 0xf9,
+    0x33, 0x9f, 0xe2, 0x6f, 0xf5, 0x0, 0x4, 0xff,
+    0x90, 0x0, 0xc, 0xf5, 0x6f, 0xd1, 0x0, 0x1,
+    0xff, 0x40, 0x0, 0xa, 0xf7, 0x6f, 0xb0, 0x0,
+    0x1, 0xef, 0x20, 0x0, 0xa, 0xf7, 0x6f, 0xb0,
+    0x0, 0x1, 0xef, 0x20, 0x0, 0xa, 0xf7, 0x6f,
+    0xb0, 0x0, 0x1, 0xef, 0x20, 0x0, 0xa, 0xf7,
+    0x6f, 0xb0, 0x0, 0x1, 0xef, 0x20, 0x0, 0xa,
+    0xf7, 0x6f, 0xb0, 0x0, 0x1, 0xef, 0x20, 0x0,
+    0xa, 0xf7, 0x6f, 0xb0, 0x0, 0x1, 0xef, 0x20,
+    0x0, 0xa, 0xf7, 0x6f, 0xb0, 0x0, 0x1, 0xef,
+    0x20, 0x0, 0xa, 0xf7, 0x6f, 0xb0, 0x0, 0x1,
+    0xef, 0x20, 0x0, 0xa, 0xf7,
+
+    /* U+006E "n" */
+    0x26, 0x30, 0x59, 0xa9, 0x40, 0x6, 0xf8, 0xbf,
+    0xff, 0xff, 0xa0, 0x6f, 0xee, 0x73, 0x39, 0xff,
+    0x46, 0xff, 0x40, 0x0, 0xa, 0xf9, 0x6f, 0xd1,
+    0x0, 0x0, 0x7f, 0xa6, 0xfb, 0x0, 0x0, 0x6,
+    0xfa, 0x6f, 0xb0, 0x0, 0x0, 0x6f, 0xa6, 0xfb,
+    0x0, 0x0, 0x6, 0xfa, 0x6f, 0xb0, 0x0, 0x0,
+    0x6f, 0xa6, 0xfb, 0x0, 0x0, 0x6, 0xfa, 0x6f,
+    0xb0, 0x0, 0x0, 0x6f, 0xa6, 0xfb, 0x0, 0x0,
+    0x6, 0xfa, 0x6f, 0xb0, 0x0, 0x0, 0x6f, 0xa0,
+
+    /* U+006F "o" */
+    0x0, 0x0, 0x59, 0xa9, 0x61, 0x0, 0x0, 0x3,
+    0xcf, 0xff, 0xff, 0xe5, 0x0, 0x2, 0xdf, 0xc4,
+    0x13, 0x9f, 0xf4, 0x0, 0x9f, 0xc1, 0x0, 0x0,
+    0x9f, 0xc0, 0xe, 0xf5, 0x0, 0x0, 0x2, 0xff,
+    0x32, 0xff, 0x10, 0x0, 0x0, 0xc, 0xf6, 0x3f,
+    0xe1, 0x0, 0x0, 0x0, 0xbf, 0x73, 0xfe, 0x10,
+    0x0, 0x0, 0xb, 0xf6, 0x1f, 0xf2, 0x0, 0x0,
+    0x0, 0xdf, 0x50, 0xcf, 0x70, 0x0, 0x0, 0x3f,
+    0xf1, 0x6, 0xfe, 0x30, 0x0, 0x1c, 0xfa, 0x0,
+    0xb, 0xfe, 0x96, 0x8d, 0xfd, 0x20, 0x0, 0x18,
+    0xef, 0xff, 0xfa, 0x10, 0x0, 0x0, 0x1, 0x45,
+    0x41, 0x0, 0x0,
+
+    /* U+0070 "p" */
+    0x25, 0x30, 0x59, 0x96, 0x10, 0x0, 0x6f, 0x8b,
+    0xff, 0xff, 0xe5, 0x0, 0x6f, 0xfe, 0x71, 0x28,
+    0xff, 0x30, 0x6f, 0xf6, 0x0, 0x0, 0x8f, 0xb0,
+    0x6f, 0xd1, 0x0, 0x0, 0x2f, 0xf1, 0x6f, 0x90,
+    0x0, 0x0, 0xd, 0xf4, 0x6f, 0x80, 0x0, 0x0,
+    0xc, 0xf5, 0x6f, 0x80, 0x0, 0x0, 0xc, 0xf5,
+    0x6f, 0xa0, 0x0, 0x0, 0x1e, 0xf3, 0x6f, 0xd1,
+    0x0, 0x0, 0x4f, 0xe0, 0x6f, 0xf8, 0x0, 0x1,
+    0xcf, 0x80, 0x6f, 0xff, 0xb6, 0x7d, 0xfc, 0x10,
+    0x6f, 0xb8, 0xff, 0xff, 0x91, 0x0, 0x6f, 0xb0,
+    0x15, 0x51, 0x0, 0x0, 0x6f, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x5c, 0x80,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+0071 "q" */
+    0x0, 0x1, 0x59, 0x96, 0x11, 0x53, 0x0, 0x3d,
+    0xff, 0xff, 0xd7, 0xfa, 0x1, 0xef, 0xa2, 0x15,
+    0xdf, 0xfa, 0x8, 0xfb, 0x10, 0x0, 0x3e, 0xfa,
+    0xd, 0xf5, 0x0, 0x0, 0xa, 0xfa, 0x1f, 0xf2,
+    0x0, 0x0, 0x6, 0xfa, 0x2f, 0xe1, 0x0, 0x0,
+    0x5, 0xfa, 0x2f, 0xf1, 0x0, 0x0, 0x5, 0xfa,
+    0xe, 0xf3, 0x0, 0x0, 0x6, 0xfa, 0xb, 0xf7,
+    0x0, 0x0, 0xa, 0xfa, 0x5, 0xfe, 0x30, 0x0,
+    0x5f, 0xfa, 0x0, 0x9f, 0xe8, 0x69, 0xff, 0xfa,
+    0x0, 0x7, 0xef, 0xff, 0xa8, 0xfa, 0x0, 0x0,
+    0x14, 0x52, 0x7, 0xfa, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfa,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xfa, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xc8,
+
+    /* U+0072 "r" */
+    0x36, 0x32, 0x9a, 0x60, 0x7f, 0x8d, 0xff, 0xe3,
+    0x7f, 0xee, 0x98, 0x90, 0x7f, 0xf5, 0x0, 0x0,
+    0x7f, 0xd1, 0x0, 0x0, 0x7f, 0xb0, 0x0, 0x0,
+    0x7f, 0xa0, 0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0,
+    0x7f, 0xa0, 0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0,
+    0x7f, 0xa0, 0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0,
+    0x7f, 0xa0, 0x0, 0x0,
+
+    /* U+0073 "s" */
+    0x0, 0x4, 0x8a, 0xa7, 0x20, 0x0, 0x1, 0xbf,
+    0xff, 0xff, 0xf7, 0x0, 0x9, 0xfb, 0x31, 0x27,
+    0xff, 0x30, 0xd, 0xf3, 0x0, 0x0, 0xae, 0x60,
+    0xd, 0xf8, 0x10, 0x0, 0x11, 0x0, 0x7, 0xff,
+    0xda, 0x62, 0x0, 0x0, 0x0, 0x8e, 0xff, 0xfe,
+    0xc5, 0x0, 0x0, 0x1, 0x59, 0xdf, 0xff, 0x70,
+    0x0, 0x10, 0x0, 0x3, 0xbf, 0xe0, 0x2b, 0xc1,
+    0x0, 0x0, 0x2f, 0xf1, 0xd, 0xf6, 0x0, 0x0,
+    0x6f, 0xd0, 0x6, 0xff, 0xa6, 0x69, 0xef, 0x50,
+    0x0, 0x6e, 0xff, 0xff, 0xd5, 0x0, 0x0, 0x0,
+    0x35, 0x53, 0x0, 0x0,
+
+    /* U+0074 "t" */
+    0x0, 0x29, 0x10, 0x0, 0x1d, 0xf1, 0x0, 0x1,
+    0xef, 0x10, 0x0, 0x1e, 0xf1, 0x0, 0x5a, 0xff,
+    0xa9, 0x29, 0xff, 0xff, 0xf3, 0x2, 0xef, 0x20,
+    0x0, 0x1e, 0xf1, 0x0, 0x1, 0xef, 0x10, 0x0,
+    0x1e, 0xf1, 0x0, 0x1, 0xef, 0x10, 0x0, 0x1e,
+    0xf1, 0x0, 0x1, 0xef, 0x10, 0x0, 0x1e, 0xf2,
+    0x0, 0x0, 0xef, 0x41, 0x0, 0xc, 0xff, 0xe4,
+    0x0, 0x3c, 0xfe, 0x60,
+
+    /* U+0075 "u" */
+    0x25, 0x30, 0x0, 0x0, 0x35, 0x37, 0xfa, 0x0,
+    0x0, 0x7, 0xfa, 0x7f, 0xa0, 0x0, 0x0, 0x7f,
+    0xa7, 0xfa, 0x0, 0x0, 0x7, 0xfa, 0x7f, 0xa0,
+    0x0, 0x0, 0x7f, 0xa7, 0xfa, 0x0, 0x0, 0x7,
+    0xfa, 0x7f, 0xa0, 0x0, 0x0, 0x7f, 0xa7, 0xfa,
+    0x0, 0x0, 0x7, 0xfa, 0x7f, 0xa0, 0x0, 0x0,
+    0x8f, 0xa6, 0xfb, 0x0, 0x0, 0xb, 0xfa, 0x4f,
+    0xe3, 0x0, 0x6, 0xff, 0xa0, 0xdf, 0xe9, 0x7b,
+    0xfc, 0xfa, 0x3, 0xcf, 0xff, 0xe7, 0x4f, 0xa0,
+    0x0, 0x25, 0x41, 0x0, 0x10,
+
+    /* U+0076 "v" */
+    0x35, 0x30, 0x0, 0x0, 0x3, 0x53, 0x6f, 0xc0,
+    0x0, 0x0, 0xb, 0xf6, 0x1e, 0xf3, 0x0, 0x0,
+    0x2f, 0xe1, 0x9, 0xf8, 0x0, 0x0, 0x8f, 0x90,
+    0x4, 0xfd, 0x10, 0x0, 0xcf, 0x40, 0x0, 0xcf,
+    0x40, 0x3, 0xfd, 0x0, 0x0, 0x7f, 0xa0, 0x9,
+    0xf7, 0x0, 0x0, 0x2e, 0xe1, 0x1d, 0xe2, 0x0,
+    0x0, 0xa, 0xf5, 0x5f, 0xb0, 0x0, 0x0, 0x5,
+    0xfa, 0xaf, 0x50, 0x0, 0x0, 0x1, 0xde, 0xed,
+    0x10, 0x0, 0x0, 0x0, 0x8f, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x3f, 0xf3, 0x0, 0x0,
+
+    /* U+0077 "w" */
+    0x55, 0x20, 0x0, 0x2, 0x54, 0x0, 0x0, 0x5,
+    0x51, 0xaf, 0x70, 0x0, 0xa, 0xfe, 0x10, 0x0,
+    0x3f, 0xd1, 0x5f, 0xb0, 0x0, 0x1d, 0xff, 0x40,
+    0x0, 0x7f, 0x80, 0x1f, 0xe1, 0x0, 0x3f, 0xef,
+    0x70, 0x0, 0xbf, 0x40, 0xb, 0xf5, 0x0, 0x7f,
+    0x8f, 0xb0, 0x1, 0xed, 0x10, 0x7, 0xf9, 0x0,
+    0xbe, 0x3d, 0xe1, 0x5, 0xf9, 0x0, 0x2, 0xfd,
+    0x11, 0xec, 0xa, 0xf4, 0xa, 0xf4, 0x0, 0x0,
+    0xcf, 0x24, 0xf8, 0x6, 0xf8, 0xe, 0xe1, 0x0,
+    0x0, 0x8f, 0x68, 0xf4, 0x2, 0xfc, 0x4f, 0xa0,
+    0x0, 0x0, 0x3f, 0xbc, 0xe1, 0x0, 0xdf, 0x9f,
+    0x50, 0x0, 0x0, 0xd, 0xff, 0xb0, 0x0, 0x9f,
+    0xfe, 0x10, 0x0, 0x0, 0x9, 0xff, 0x70, 0x0,
+    0x5f, 0xfb, 0x0, 0x0, 0x0, 0x4, 0xff, 0x30,
+    0x0, 0x1f, 0xf6, 0x0, 0x0,
+
+    /* U+0078 "x" */
+    0x26, 0x62, 0x0, 0x0, 0x16, 0x62, 0x1c, 0xfb,
+    0x0, 0x0, 0xaf, 0xc0, 0x3, 0xef, 0x60, 0x6,
+    0xfe, 0x20, 0x0, 0x7f, 0xe2, 0x3e, 0xf5, 0x0,
+    0x0, 0xb, 0xfb, 0xcf, 0x90, 0x0, 0x0, 0x2,
+    0xdf, 0xfc, 0x10, 0x0, 0x0, 0x0, 0x7f, 0xf6,
+    0x0, 0x0, 0x0, 0x1, 0xdf, 0xfd, 0x10, 0x0,
+    0x0, 0xa, 0xfb, 0xbf, 0xa0, 0x0, 0x0, 0x6f,
+    0xe2, 0x2e, 0xf6, 0x0, 0x2, 0xef, 0x60, 0x6,
+    0xfe, 0x20, 0xb, 0xfb, 0x0, 0x0, 0xbf, 0xb0,
+    0x7f, 0xe2, 0x0, 0x0, 0x2e, 0xf7,
+
+    /* U+0079 "y" */
+    0x35, 0x40, 0x0, 0x0, 0x2, 0x54, 0x4f, 0xe1,
+    0x0, 0x0, 0xa, 0xf7, 0xd, 0xf5, 0x0, 0x0,
+    0x1e, 0xf2, 0x8, 0xfa, 0x0, 0x0, 0x6f, 0xb0,
+    0x3, 0xfe, 0x20, 0x0, 0xbf, 0x50, 0x0, 0xcf,
+    0x60, 0x2, 0xee, 0x10, 0x0, 0x6f, 0xb0, 0x7,
+    0xf9, 0x0, 0x0, 0x1e, 0xe2, 0xc, 0xf4, 0x0,
+    0x0, 0xa, 0xf7, 0x3f, 0xd0, 0x0, 0x0, 0x4,
+    0xfc, 0x8f, 0x70, 0x0, 0x0, 0x0, 0xde, 0xde,
+    0x20, 0x0, 0x0, 0x0, 0x8f, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0x2e, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x2e, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x90,
+    0x0, 0x0, 0x1, 0x3, 0xdf, 0x30, 0x0, 0x0,
+    0x9, 0xee, 0xf9, 0x0, 0x0, 0x0, 0x8, 0xfe,
+    0xa1, 0x0, 0x0, 0x0, 0x1, 0x22, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+007A "z" */
+    0x5, 0x55, 0x55, 0x55, 0x55, 0x51, 0x1f, 0xff,
+    0xff, 0xff, 0xff, 0xf2, 0x5, 0x55, 0x55, 0x56,
+    0xef, 0xb0, 0x0, 0x0, 0x0, 0x9, 0xfc, 0x10,
+    0x0, 0x0, 0x0, 0x8f, 0xd2, 0x0, 0x0, 0x0,
+    0x7, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x5e, 0xe5,
+    0x0, 0x0, 0x0, 0x4, 0xef, 0x60, 0x0, 0x0,
+    0x0, 0x2d, 0xf8, 0x0, 0x0, 0x0, 0x1, 0xdf,
+    0xa0, 0x0, 0x0, 0x0, 0x1c, 0xfb, 0x10, 0x0,
+    0x0, 0x0, 0x7f, 0xfc, 0xbc, 0xcc, 0xcc, 0xc6,
+    0x8f, 0xff, 0xff, 0xff, 0xff, 0xf7,
+
+    /* U+007B "{" */
+    0x0, 0x0, 0x2, 0x42, 0x0, 0x1, 0xbf, 0xf7,
+    0x0, 0x7, 0xfd, 0x94, 0x0, 0xc, 0xf4, 0x0,
+    0x0, 0xd, 0xf2, 0x0, 0x0, 0xe, 0xe2, 0x0,
+    0x0, 0xe, 0xe2, 0x0, 0x0, 0xe, 0xe2, 0x0,
+    0x0, 0x1e, 0xd1, 0x0, 0x0, 0x4f, 0xb0, 0x0,
+    0x13, 0xcf, 0x50, 0x0, 0x4f, 0xe6, 0x0, 0x0,
+    0x4e, 0xf9, 0x0, 0x0, 0x1, 0xaf, 0x70, 0x0,
+    0x0, 0x3f, 0xc0, 0x0, 0x0, 0x1e, 0xe1, 0x0,
+    0x0, 0xe, 0xe2, 0x0, 0x0, 0xe, 0xe2, 0x0,
+    0x0, 0xd, 0xe2, 0x0, 0x0, 0xd, 0xf2, 0x0,
+    0x0, 0xb, 0xf5, 0x0, 0x0, 0x7, 0xfe, 0xb5,
+    0x0, 0x1, 0x9e, 0xf7, 0x0, 0x0, 0x1, 0x21,
+
+    /* U+007C "|" */
+    0x45, 0xc, 0xe1, 0xce, 0x1c, 0xe1, 0xce, 0x1c,
+    0xe1, 0xce, 0x1c, 0xe1, 0xce, 0x1c, 0xe1, 0xce,
+    0x1c, 0xe1, 0xce, 0x1c, 0xe1, 0xce, 0x1c, 0xe1,
+    0xce, 0x1c, 0xe1, 0xce, 0x1c, 0xe1, 0xce, 0x1c,
+    0xe1, 0xce, 0x12, 0x20,
+
+    /* U+007D "}" */
+    0x24, 0x20, 0x0, 0x0, 0x7f, 0xfb, 0x10, 0x0,
+    0x49, 0xdf, 0x80, 0x0, 0x0, 0x4f, 0xc0, 0x0,
+    0x0, 0x2e, 0xc0, 0x0, 0x0, 0x2e, 0xd1, 0x0,
+    0x0, 0x2e, 0xd1, 0x0, 0x0, 0x1e, 0xd1, 0x0,
+    0x0, 0x1e, 0xe1, 0x0, 0x0, 0xc, 0xf4, 0x0,
+    0x0, 0x5, 0xfc, 0x41, 0x0, 0x0, 0x6e, 0xf5,
+    0x0, 0x0, 0x8f, 0xe4, 0x0, 0x6, 0xfa, 0x10,
+    0x0, 0xc, 0xf3, 0x0, 0x0, 0x1e, 0xe1, 0x0,
+    0x0, 0x1e, 0xd1, 0x0, 0x0, 0x2e, 0xd1, 0x0,
+    0x0, 0x2e, 0xd1, 0x0, 0x0, 0x2e, 0xc0, 0x0,
+    0x0, 0x5f, 0xb0, 0x0, 0x5b, 0xef, 0x60, 0x0,
+    0x7f, 0xe9, 0x10, 0x0, 0x12, 0x10, 0x0, 0x0,
+
+    /* U+007E "~" */
+    0x1, 0x44, 0x20, 0x0, 0x0, 0x1, 0x5d, 0xff,
+    0xfc, 0x72, 0x0, 0x3c, 0xef, 0xee, 0xff, 0xfe,
+    0xcc, 0xff, 0xd5, 0x11, 0x39, 0xef, 0xff, 0xf8,
+    0x20, 0x0, 0x0, 0x15, 0x76, 0x30,
+
+    /* U+00A0 " " */
+
+    /* U+00A1 "¡" */
+    0x15, 0x51, 0x3f, 0xf4, 0x3f, 0xf4, 0x1, 0x10,
+    0x1, 0x10, 0xa, 0xa0, 0xc, 0xc0, 0xd, 0xc0,
+    0xe, 0xd1, 0x1e, 0xe1, 0x1e, 0xf2, 0x2e, 0xf2,
+    0x3f, 0xf3, 0x4f, 0xf4, 0x4f, 0xf5, 0x4f, 0xf5,
+    0x4f, 0xf5, 0x3c, 0xc4,
+
+    /* U+00A2 "¢" */
+    0x0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x1c, 0x60, 0x0, 0x0, 0x0, 0x3, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x7d, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0x90, 0x0, 0x0, 0x38, 0xaa, 0xf6,
+    0x0, 0x0, 0x9f, 0xff, 0xff, 0xf6, 0x0, 0x9f,
+    0xd5, 0x1a, 0xdf, 0xf4, 0x2f, 0xf3, 0x1, 0xd7,
+    0x8f, 0xa7, 0xfb, 0x0, 0x4f, 0x32, 0x74, 0xaf,
+    0x80, 0x8, 0xd0, 0x0, 0xb, 0xf6, 0x0, 0xc9,
+    0x0, 0x0, 0xbf, 0x70, 0x2e, 0x40, 0x0, 0x9,
+    0xf9, 0x6, 0xe1, 0x0, 0x75, 0x5f, 0xc1, 0xbb,
+    0x0, 0x4f, 0xe1, 0xdf, 0x8e, 0x60, 0x1c, 0xf8,
+    0x4, 0xff, 0xf8, 0x7d, 0xfc, 0x10, 0x4, 0xef,
+    0xff, 0xf9, 0x10, 0x0, 0xd, 0xa5, 0x41, 0x0,
+    0x0, 0x3, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x7d,
+    0x10, 0x0, 0x0, 0x0, 0xc, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0x85, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+00A3 "£" */
+    0x0, 0x0, 0x14, 0x77, 0x41, 0x0, 0x0, 0x0,
+    0x5d, 0xff, 0xff, 0xd5, 0x0, 0x0, 0x5f, 0xfa,
+    0x55, 0xaf, 0xf4, 0x0, 0xd, 0xf8, 0x0, 0x0,
+    0x9f, 0xc0, 0x3, 0xff, 0x20, 0x0, 0x2, 0xff,
+    0x20, 0x4f, 0xe1, 0x0, 0x0, 0x4, 0x30, 0x3,
+    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x24, 0xdf, 0xa4, 0x44,
+    0x10, 0x0, 0x7, 0xff, 0xff, 0xff, 0xf5, 0x0,
+    0x0, 0x37, 0x8f, 0xf8, 0x77, 0x20, 0x0, 0x0,
+    0x1, 0xef, 0x30, 0x0, 0x0, 0x0, 0x0, 0x1e,
+    0xe2, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfb, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xbe, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xa6, 0x53, 0x10, 0x0, 0x20,
+    0x7f, 0xff, 0xff, 0xfe, 0xca, 0xcf, 0x44, 0xfb,
+    0x75, 0x69, 0xdf, 0xff, 0xf7, 0x2, 0x0, 0x0,
+    0x0, 0x25, 0x41, 0x0,
+
+    /* U+00A4 "¤" */
+    0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6c, 0x10,
+    0x35, 0x41, 0x9, 0xa0, 0xcf, 0xcd, 0xff, 0xfe,
+    0xbf, 0xe2, 0x1c, 0xff, 0xc9, 0xbf, 0xfe, 0x30,
+    0xd, 0xf7, 0x0, 0x4, 0xef, 0x20, 0x3f, 0xc0,
+    0x0, 0x0, 0x9f, 0x70, 0x5f, 0x90, 0x0, 0x0,
+    0x6f, 0x90, 0x4f, 0xb0, 0x0, 0x0, 0x8f, 0x70,
+    0x1d, 0xf5, 0x0, 0x2, 0xef, 0x30, 0xb, 0xfe,
+    0x96, 0x8e, 0xfe, 0x10, 0x9f, 0xee, 0xff, 0xff,
+    0xdf, 0xc1, 0x9d, 0x32, 0x68, 0x73, 0x1b, 0xc1,
+    0x2, 0x0, 0x0, 0x0, 0x1, 0x10,
+
+    /* U+00A5 "¥" */
+    0x22, 0x10, 0x0, 0x0, 0x0, 0x12, 0x20, 0xaf,
+    0xa0, 0x0, 0x0, 0x0, 0x9f, 0xd1, 0x2e, 0xf4,
+    0x0, 0x0, 0x2, 0xff, 0x50, 0x8, 0xfc, 0x10,
+    0x0, 0xa, 0xfb, 0x0, 0x1, 0xdf, 0x60, 0x0,
+    0x4f, 0xf3, 0x0, 0x0, 0x5f, 0xd1, 0x0, 0xbf,
+    0x90, 0x0, 0x0, 0xb, 0xf8, 0x5, 0xfe, 0x10,
+    0x0, 0x0, 0x3, 0xfe, 0x3c, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xcf, 0xd1, 0x0, 0x0, 0x4e,
+    0xee, 0xef, 0xff, 0xfe, 0xee, 0x70, 0x4c, 0xcc,
+    0xcd, 0xfe, 0xcc, 0xcc, 0x60, 0x0, 0x0, 0x6,
+    0xfb, 0x0, 0x0, 0x0, 0x26, 0x66, 0x6a, 0xfc,
+    0x66, 0x66, 0x30, 0x4f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x80, 0x13, 0x33, 0x38, 0xfc, 0x33, 0x33,
+    0x20, 0x0, 0x0, 0x6, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xfb, 0x0, 0x0, 0x0,
+
+    /* U+00A6 "¦" */
+    0x67, 0x1c, 0xe1, 0xce, 0x1c, 0xe1, 0xce, 0x1c,
+    0xe1, 0xce, 0x1c, 0xe1, 0xce, 0x19, 0xb1, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x20, 0xce, 0x1c, 0xe1,
+    0xce, 0x1c, 0xe1, 0xce, 0x1c, 0xe1, 0xce, 0x1c,
+    0xe1, 0xce, 0x12, 0x20,
+
+    /* U+00A7 "§" */
+    0x0, 0x0, 0x2, 0x22, 0x0, 0x0, 0x0, 0x0,
+    0x4c, 0xff, 0xec, 0x50, 0x0, 0x0, 0x4e, 0xfb,
+    0x9b, 0xff, 0x50, 0x0, 0xb, 0xf8, 0x0, 0x8,
+    0xfd, 0x0, 0x0, 0xef, 0x20, 0x0, 0x2e, 0xe2,
+    0x0, 0xb, 0xf8, 0x0, 0x0, 0x10, 0x0, 0x0,
+    0x4e, 0xfa, 0x10, 0x0, 0x0, 0x0, 0x2, 0xcf,
+    0xfd, 0x50, 0x0, 0x0, 0x4, 0xed, 0x6c, 0xff,
+    0xa2, 0x0, 0x0, 0xcf, 0x30, 0x17, 0xef, 0xe6,
+    0x0, 0x1f, 0xd1, 0x0, 0x3, 0xbf, 0xf6, 0x0,
+    0xef, 0x30, 0x0, 0x1, 0x9f, 0xe1, 0x8, 0xfd,
+    0x40, 0x0, 0x1, 0xdf, 0x30, 0x1b, 0xfe, 0x81,
+    0x0, 0xc, 0xf2, 0x0, 0x18, 0xef, 0xd5, 0x5,
+    0xfb, 0x0, 0x0, 0x3, 0xbf, 0xfc, 0xe9, 0x10,
+    0x0, 0x0, 0x0, 0x6e, 0xfe, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x2c, 0xfd, 0x10, 0x0, 0x34, 0x0,
+    0x0, 0x1d, 0xf5, 0x0, 0x3f, 0xe2, 0x0, 0x0,
+    0xbf, 0x60, 0x0, 0xdf, 0x90, 0x0, 0x3e, 0xf3,
+    0x0, 0x4, 0xef, 0xda, 0xbe, 0xfa, 0x0, 0x0,
+    0x4, 0xbe, 0xff, 0xd7, 0x0, 0x0, 0x0, 0x0,
+    0x12, 0x21, 0x0, 0x0,
+
+    /* U+00A8 "¨" */
+    0x12, 0x20, 0x2, 0x21, 0x4f, 0xd1, 0xd, 0xf4,
+    0x4f, 0xd1, 0xd, 0xf4, 0x14, 0x30, 0x3, 0x41,
+
+    /* U+00A9 "©" */
+    0x0, 0x0, 0x0, 0x12, 0x33, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x28, 0xdf, 0xff, 0xec, 0x61,
+    0x0, 0x0, 0x0, 0x6, 0xee, 0xa6, 0x44, 0x6b,
+    0xfd, 0x40, 0x0, 0x0, 0x8f, 0xa2, 0x0, 0x0,
+    0x0, 0x3c, 0xe5, 0x0, 0x5, 0xf8, 0x0, 0x2,
+    0x55, 0x20, 0x1, 0xbe, 0x20, 0x1d, 0xb0, 0x2,
+    0xbf, 0xff, 0xfa, 0x0, 0x1d, 0xa0, 0x6f, 0x30,
+    0x1c, 0xe5, 0x0, 0x6f, 0x90, 0x7, 0xf2, 0xac,
+    0x0, 0x6f, 0x50, 0x0, 0x6, 0x70, 0x2, 0xe7,
+    0xd9, 0x0, 0xae, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0xd9, 0xe8, 0x0, 0xbd, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xbb, 0xe9, 0x0, 0xad, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0xca, 0xbc, 0x0, 0x7f, 0x40, 0x0,
+    0x7, 0xc1, 0x1, 0xe7, 0x6f, 0x20, 0x2d, 0xc3,
+    0x0, 0x5e, 0xa0, 0x6, 0xf3, 0x1e, 0xa0, 0x4,
+    0xde, 0xcd, 0xfc, 0x10, 0x1d, 0xb0, 0x6, 0xf7,
+    0x0, 0x16, 0x88, 0x50, 0x0, 0xae, 0x30, 0x0,
+    0x9f, 0x81, 0x0, 0x0, 0x0, 0x2b, 0xf6, 0x0,
+    0x0, 0x8, 0xfd, 0x84, 0x22, 0x59, 0xee, 0x50,
+    0x0, 0x0, 0x0, 0x3a, 0xef, 0xff, 0xfe, 0x82,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x13, 0x55, 0x30,
+    0x0, 0x0, 0x0,
+
+    /* U+00AA "ª" */
+    0x0, 0x13, 0x43, 0x10, 0x0, 0x4d, 0xfe, 0xfd,
+    0x40, 0xd, 0xd4, 0x25, 0xec, 0x0, 0x44, 0x0,
+    0x1c, 0xd0, 0x2, 0x7a, 0xce, 0xfe, 0x2, 0xef,
+    0xb9, 0x6d, 0xe0, 0x6f, 0x70, 0x1, 0xde, 0x5,
+    0xf9, 0x12, 0x9f, 0xe1, 0x1b, 0xfe, 0xec, 0xae,
+    0x20, 0x15, 0x64, 0x1, 0x31,
+
+    /* U+00AB "«" */
+    0x0, 0x0, 0x44, 0x0, 0x15, 0x20, 0x0, 0x5f,
+    0x80, 0xb, 0xe2, 0x0, 0x2d, 0xd1, 0x7, 0xf8,
+    0x0, 0xa, 0xf6, 0x3, 0xed, 0x10, 0x6, 0xfc,
+    0x11, 0xbf, 0x60, 0x2, 0xef, 0x40, 0x7f, 0xc0,
+    0x0, 0x2e, 0xf4, 0x7, 0xfc, 0x0, 0x0, 0x6f,
+    0xc1, 0x1b, 0xf6, 0x0, 0x0, 0xaf, 0x60, 0x3e,
+    0xd1, 0x0, 0x2, 0xdd, 0x10, 0x6f, 0x80, 0x0,
+    0x4, 0xf8, 0x0, 0xbf, 0x20, 0x0, 0x4, 0x40,
+    0x1, 0x52,
+
+    /* U+00AC "¬" */
+    0x9e, 0xee, 0xee, 0xee, 0xee, 0xe9, 0xaf, 0xff,
+    0xff, 0xff, 0xff, 0xfa, 0x11, 0x11, 0x11, 0x11,
+    0x15, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfa,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xfa, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xfa, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x1, 0x32,
+
+    /* U+00AD "­" */
+    0x14, 0x44, 0x44, 0x41, 0x4f, 0xff, 0xff, 0xf4,
+    0x3d, 0xdd, 0xdd, 0xd3,
+
+    /* U+00AE "®" */
+    0x0, 0x0, 0x0, 0x12, 0x33, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x28, 0xdf, 0xff, 0xec, 0x61,
+    0x0, 0x0, 0x0, 0x6, 0xee, 0xa6, 0x44, 0x6b,
+    0xfd, 0x40, 0x0, 0x0, 0x8f, 0xa2, 0x0, 0x0,
+    0x0, 0x3c, 0xe5, 0x0, 0x5, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xbe, 0x20, 0x1d, 0xb0, 0x1e,
+    0xff, 0xfe, 0xc4, 0x0, 0x1d, 0xa0, 0x6f, 0x30,
+    0x1e, 0xa4, 0x46, 0xdf, 0x20, 0x7, 0xf2, 0xac,
+    0x0, 0x1e, 0x80, 0x0, 0x5f, 0x50, 0x2, 0xe7,
+    0xd9, 0x0, 0x1e, 0x80, 0x1, 0xaf, 0x20, 0x0,
+    0xd9, 0xe8, 0x0, 0x1e, 0xee, 0xee, 0xe6, 0x0,
+    0x0, 0xbb, 0xe9, 0x0, 0x1e, 0xb6, 0xae, 0x50,
+    0x0, 0x0, 0xca, 0xbc, 0x0, 0x1e, 0x80, 0x9,
+    0xe3, 0x0, 0x1, 0xe7, 0x6f, 0x20, 0x1e, 0x80,
+    0x1, 0xec, 0x0, 0x6, 0xf3, 0x1e, 0xa0, 0x1e,
+    0x80, 0x0, 0x6f, 0x60, 0x1d, 0xb0, 0x6, 0xf7,
+    0x16, 0x30, 0x0, 0x6, 0x51, 0xae, 0x30, 0x0,
+    0x9f, 0x81, 0x0, 0x0, 0x0, 0x2b, 0xf6, 0x0,
+    0x0, 0x8, 0xfd, 0x84, 0x22, 0x59, 0xee, 0x50,
+    0x0, 0x0, 0x0, 0x3a, 0xef, 0xff, 0xfe, 0x82,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x13, 0x55, 0x30,
+    0x0, 0x0, 0x0,
+
+    /* U+00AF "¯" */
+    0x4a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x65,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xc8,
+
+    /* U+00B0 "°" */
+    0x0, 0x37, 0x61, 0x0, 0x8, 0xec, 0xdd, 0x30,
+    0x4f, 0x50, 0x1b, 0xb0, 0x7c, 0x0, 0x5, 0xe1,
+    0x6d, 0x10, 0x7, 0xd0, 0x1d, 0xb4, 0x7e, 0x70,
+    0x3, 0xbf, 0xe7, 0x0,
+
+    /* U+00B1 "±" */
+    0x0, 0x0, 0x3, 0x63, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x6, 0xf8, 0x0, 0x0,
+    0x1, 0x99, 0x99, 0xcf, 0xc9, 0x99, 0x92, 0x2f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x41, 0x55, 0x55,
+    0xaf, 0xb5, 0x55, 0x51, 0x0, 0x0, 0x6, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6e, 0x80, 0x0, 0x0, 0x1, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x1, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xe4, 0x2f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x40,
+
+    /* U+00B2 "²" */
+    0x0, 0x24, 0x43, 0x0, 0x7, 0xef, 0xef, 0xb1,
+    0x3f, 0xb3, 0x2a, 0xf7, 0x14, 0x20, 0x5, 0xf7,
+    0x0, 0x0, 0x2c, 0xe2, 0x0, 0x4, 0xee, 0x40,
+    0x0, 0x8f, 0xc2, 0x0, 0x9, 0xfa, 0x10, 0x0,
+    0x6f, 0xfe, 0xee, 0xe8, 0x46, 0x66, 0x66, 0x64,
+
+    /* U+00B3 "³" */
+    0x0, 0x24, 0x42, 0x0, 0x8, 0xfe, 0xee, 0x80,
+    0x3e, 0xa2, 0x2d, 0xe2, 0x2, 0x10, 0x1c, 0xe2,
+    0x0, 0x6, 0xde, 0x50, 0x0, 0x6, 0x9e, 0xc1,
+    0x0, 0x0, 0x5, 0xf7, 0x6e, 0x60, 0x8, 0xf7,
+    0x1d, 0xfc, 0xdf, 0xc1, 0x1, 0x69, 0x96, 0x10,
+
+    /* U+00B4 "´" */
+    0x0, 0x45, 0x40, 0x4f, 0xf5, 0xb, 0xf7, 0x3,
+    0xea, 0x0,
+
+    /* U+00B5 "µ" */
+    0x15, 0x50, 0x0, 0x0, 0x15, 0x52, 0xfd, 0x10,
+    0x0, 0x2, 0xfe, 0x2f, 0xd1, 0x0, 0x0, 0x2f,
+    0xe2, 0xfd, 0x10, 0x0, 0x2, 0xfe, 0x2f, 0xd1,
+    0x0, 0x0, 0x2f, 0xe2, 0xfd, 0x10, 0x0, 0x2,
+    0xfe, 0x2f, 0xe1, 0x0, 0x0, 0x2f, 0xe2, 0xfe,
+    0x10, 0x0, 0x3, 0xfe, 0x2f, 0xf1, 0x0, 0x0,
+    0x4f, 0xe2, 0xff, 0x40, 0x0, 0x7, 0xfe, 0x2f,
+    0xfb, 0x10, 0x2, 0xdf, 0xe2, 0xff, 0xfd, 0x9a,
+    0xee, 0xfe, 0x2f, 0xd7, 0xff, 0xfe, 0x5e, 0xe2,
+    0xfd, 0x11, 0x54, 0x10, 0x11, 0x2f, 0xd1, 0x0,
+    0x0, 0x0, 0x2, 0xfd, 0x10, 0x0, 0x0, 0x0,
+    0x2f, 0xd1, 0x0, 0x0, 0x0, 0x2, 0xcb, 0x10,
+    0x0, 0x0, 0x0,
+
+    /* U+00B6 "¶" */
+    0x0, 0x0, 0x12, 0x22, 0x22, 0x22, 0x20, 0x17,
+    0xce, 0xff, 0xff, 0xff, 0xfe, 0x1b, 0xff, 0xff,
+    0xfe, 0xef, 0xfe, 0xd7, 0xff, 0xff, 0xfa, 0x0,
+    0xbf, 0x40, 0xdf, 0xff, 0xff, 0xa0, 0xb, 0xf4,
+    0xf, 0xff, 0xff, 0xfa, 0x0, 0xbf, 0x40, 0xef,
+    0xff, 0xff, 0xa0, 0xb, 0xf4, 0xb, 0xff, 0xff,
+    0xfa, 0x0, 0xbf, 0x40, 0x4f, 0xff, 0xff, 0xa0,
+    0xb, 0xf4, 0x0, 0x6e, 0xff, 0xfa, 0x0, 0xbf,
+    0x40, 0x0, 0x26, 0x9f, 0xa0, 0xb, 0xf4, 0x0,
+    0x0, 0x4, 0xfa, 0x0, 0xbf, 0x40, 0x0, 0x0,
+    0x4f, 0xa0, 0xb, 0xf4, 0x0, 0x0, 0x4, 0xfa,
+    0x0, 0xbf, 0x40, 0x0, 0x0, 0x4f, 0xa0, 0xb,
+    0xf4, 0x0, 0x0, 0x4, 0xfa, 0x0, 0xbf, 0x40,
+    0x0, 0x0, 0x4f, 0xa0, 0xb, 0xf4, 0x0, 0x0,
+    0x4, 0xfa, 0x0, 0xbf, 0x40, 0x0, 0x0, 0x4f,
+    0xa0, 0xb, 0xf4, 0x0, 0x0, 0x4, 0xfa, 0x0,
+    0xbf, 0x40, 0x0, 0x0, 0x4f, 0xa0, 0xb, 0xf4,
+    0x0, 0x0, 0x4, 0xfa, 0x0, 0xbf, 0x40, 0x0,
+    0x0, 0x3c, 0x80, 0x9, 0xc4, 0x0,
+
+    /* U+00B7 "·" */
+    0x3e, 0xe3, 0x3f, 0xf3, 0x27, 0x71,
+
+    /* U+00B8 "¸" */
+    0x0, 0x53, 0x0, 0x2, 0xe7, 0x0, 0x4, 0xcf,
+    0xa1, 0x0, 0xb, 0xf4, 0x7a, 0xcf, 0xd2, 0x8c,
+    0xc9, 0x20,
+
+    /* U+00B9 "¹" */
+    0x0, 0x4, 0x30, 0x8, 0xf9, 0x3b, 0xff, 0x9b,
+    0xc7, 0xf9, 0x20, 0x3f, 0x90, 0x3, 0xf9, 0x0,
+    0x3f, 0x90, 0x3, 0xf9, 0x0, 0x3f, 0x90, 0x1,
+    0x64,
+
+    /* U+00BA "º" */
+    0x0, 0x13, 0x42, 0x0, 0x0, 0x2c, 0xff, 0xfa,
+    0x10, 0xc, 0xe7, 0x49, 0xf9, 0x4, 0xf8, 0x0,
+    0xc, 0xe1, 0x6f, 0x50, 0x0, 0x8f, 0x37, 0xf4,
+    0x0, 0x8, 0xf3, 0x5f, 0x70, 0x0, 0xbe, 0x11,
+    0xde, 0x52, 0x7f, 0xa0, 0x3, 0xdf, 0xff, 0xb1,
+    0x0, 0x1, 0x56, 0x40, 0x0,
+
+    /* U+00BB "»" */
+    0x15, 0x30, 0x3, 0x51, 0x0, 0x0, 0xcd, 0x20,
+    0x5f, 0x80, 0x0, 0x5, 0xfa, 0x0, 0xbf, 0x40,
+    0x0, 0xa, 0xf6, 0x3, 0xed, 0x10, 0x0, 0x3e,
+    0xe2, 0x9, 0xfa, 0x0, 0x0, 0x8f, 0xb0, 0x2e,
+    0xf5, 0x0, 0x8, 0xfb, 0x2, 0xef, 0x50, 0x3,
+    0xee, 0x20, 0x9f, 0x90, 0x0, 0xbf, 0x50, 0x3e,
+    0xd1, 0x0, 0x5f, 0xa0, 0xb, 0xf4, 0x0, 0x1d,
+    0xd1, 0x5, 0xf8, 0x0, 0x1, 0x52, 0x0, 0x34,
+    0x10, 0x0,
+
+    /* U+00BC "¼" */
+    0x0, 0x4, 0x30, 0x0, 0x0, 0x0, 0x0, 0x27,
+    0x40, 0x0, 0x8, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x1c, 0xd2, 0x0, 0x3b, 0xff, 0x90, 0x0, 0x0,
+    0x0, 0x8, 0xf5, 0x0, 0xb, 0xc6, 0xf9, 0x0,
+    0x0, 0x0, 0x4, 0xf9, 0x0, 0x0, 0x20, 0x3f,
+    0x90, 0x0, 0x0, 0x1, 0xdc, 0x10, 0x0, 0x0,
+    0x3, 0xf9, 0x0, 0x0, 0x0, 0xae, 0x30, 0x0,
+    0x0, 0x0, 0x3f, 0x90, 0x0, 0x0, 0x6f, 0x70,
+    0x0, 0x0, 0x0, 0x3, 0xf9, 0x0, 0x0, 0x2e,
+    0xb0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x90, 0x0,
+    0x1c, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x1, 0x64,
+    0x0, 0x8, 0xf5, 0x0, 0x0, 0x16, 0x30, 0x0,
+    0x0, 0x0, 0x4, 0xf9, 0x0, 0x0, 0x1b, 0xf7,
+    0x0, 0x0, 0x0, 0x1, 0xdc, 0x10, 0x0, 0x9,
+    0xff, 0x70, 0x0, 0x0, 0x0, 0xae, 0x30, 0x0,
+    0x8, 0xfb, 0xf7, 0x0, 0x0, 0x0, 0x6f, 0x70,
+    0x0, 0x6, 0xf9, 0x4f, 0x70, 0x0, 0x0, 0x2e,
+    0xb0, 0x0, 0x4, 0xea, 0x14, 0xf7, 0x0, 0x0,
+    0x1b, 0xe2, 0x0, 0x0, 0xbf, 0xcb, 0xcf, 0xd7,
+    0x0, 0x7, 0xf5, 0x0, 0x0, 0x6, 0x88, 0x8a,
+    0xfb, 0x50, 0x3, 0xea, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0x70, 0x0, 0x8a, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x52, 0x0,
+
+    /* U+00BD "½" */
+    0x0, 0x4, 0x30, 0x0, 0x0, 0x0, 0x0, 0x57,
+    0x20, 0x0, 0x8, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x3e, 0xa0, 0x0, 0x3b, 0xff, 0x90, 0x0, 0x0,
+    0x0, 0x1c, 0xd2, 0x0, 0xb, 0xc6, 0xf9, 0x0,
+    0x0, 0x0, 0x8, 0xf5, 0x0, 0x0, 0x20, 0x3f,
+    0x90, 0x0, 0x0, 0x4, 0xf9, 0x0, 0x0, 0x0,
+    0x3, 0xf9, 0x0, 0x0, 0x1, 0xdc, 0x10, 0x0,
+    0x0, 0x0, 0x3f, 0x90, 0x0, 0x0, 0xaf, 0x30,
+    0x0, 0x0, 0x0, 0x3, 0xf9, 0x0, 0x0, 0x6f,
+    0x70, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x90, 0x0,
+    0x2e, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x64,
+    0x0, 0x1c, 0xe2, 0x0, 0x58, 0x86, 0x20, 0x0,
+    0x0, 0x0, 0x8, 0xf5, 0x0, 0xaf, 0xdd, 0xfd,
+    0x20, 0x0, 0x0, 0x4, 0xf9, 0x0, 0x4e, 0xa1,
+    0x8, 0xf7, 0x0, 0x0, 0x1, 0xdc, 0x10, 0x1,
+    0x21, 0x0, 0x6f, 0x70, 0x0, 0x0, 0x9e, 0x40,
+    0x0, 0x0, 0x0, 0x4e, 0xd2, 0x0, 0x0, 0x5f,
+    0x70, 0x0, 0x0, 0x0, 0x7e, 0xd3, 0x0, 0x0,
+    0x2e, 0xb0, 0x0, 0x0, 0x1, 0xaf, 0xb2, 0x0,
+    0x0, 0xb, 0xe2, 0x0, 0x0, 0x0, 0xbf, 0x91,
+    0x11, 0x10, 0x7, 0xf5, 0x0, 0x0, 0x0, 0x6f,
+    0xff, 0xff, 0xf9, 0x1, 0xa8, 0x0, 0x0, 0x0,
+    0x3, 0x55, 0x55, 0x55, 0x30,
+
+    /* U+00BE "¾" */
+    0x0, 0x36, 0x63, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0x74, 0x0, 0x9, 0xfe, 0xef, 0x90, 0x0, 0x0,
+    0x0, 0x1c, 0xd2, 0x0, 0x3e, 0x91, 0x1d, 0xe2,
+    0x0, 0x0, 0x0, 0x8f, 0x50, 0x0, 0x1, 0x10,
+    0x1c, 0xe1, 0x0, 0x0, 0x4, 0xf9, 0x0, 0x0,
+    0x0, 0x6, 0xde, 0x50, 0x0, 0x0, 0x1d, 0xc1,
+    0x0, 0x0, 0x0, 0x6, 0x9e, 0xc1, 0x0, 0x0,
+    0xae, 0x30, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf7,
+    0x0, 0x6, 0xf7, 0x0, 0x0, 0x0, 0x6d, 0x40,
+    0x7, 0xf7, 0x0, 0x2e, 0xb0, 0x0, 0x0, 0x0,
+    0x2e, 0xea, 0xbf, 0xd2, 0x1, 0xce, 0x20, 0x0,
+    0x0, 0x0, 0x2, 0x9b, 0xb8, 0x20, 0x8, 0xf5,
+    0x0, 0x0, 0x16, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0x90, 0x0, 0x1, 0xbf, 0x70, 0x0, 0x0,
+    0x0, 0x1, 0xdc, 0x10, 0x0, 0xa, 0xff, 0x70,
+    0x0, 0x0, 0x0, 0xa, 0xe3, 0x0, 0x0, 0x8f,
+    0xbf, 0x70, 0x0, 0x0, 0x0, 0x6f, 0x70, 0x0,
+    0x6, 0xf9, 0x4f, 0x70, 0x0, 0x0, 0x2, 0xeb,
+    0x0, 0x0, 0x4e, 0xb1, 0x4f, 0x70, 0x0, 0x0,
+    0x1b, 0xe2, 0x0, 0x0, 0xbf, 0xcb, 0xcf, 0xd7,
+    0x0, 0x0, 0x7f, 0x50, 0x0, 0x0, 0x68, 0x88,
+    0xaf, 0xb5, 0x0, 0x3, 0xea, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0x70, 0x0, 0x8, 0xa1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x15, 0x20,
+
+    /* U+00BF "¿" */
+    0x0, 0x0, 0x4, 0x53, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x21, 0x0, 0x0, 0x0, 0x0,
+    0x9, 0xe7, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0x2e, 0xf3, 0x0, 0x0,
+    0x0, 0x2, 0xcf, 0xa0, 0x0, 0x0, 0x0, 0x3d,
+    0xfc, 0x10, 0x0, 0x0, 0x2, 0xdf, 0xb1, 0x0,
+    0x0, 0x0, 0xa, 0xfb, 0x10, 0x0, 0x0, 0x0,
+    0x1e, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xe1,
+    0x0, 0x0, 0x5, 0xfb, 0x1e, 0xf5, 0x0, 0x0,
+    0xa, 0xf9, 0xa, 0xfd, 0x30, 0x0, 0x6f, 0xf3,
+    0x1, 0xcf, 0xeb, 0x9c, 0xff, 0x80, 0x0, 0x18,
+    0xde, 0xfe, 0xc5, 0x0, 0x0, 0x0, 0x12, 0x22,
+    0x0, 0x0,
+
+    /* U+00C0 "À" */
+    0x0, 0x0, 0x4, 0x76, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xdf, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3e, 0xe1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xc6, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x12, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xf4, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xef, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xf9, 0xee, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0xf4, 0xaf, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xe1, 0x5f, 0xd0, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0x90, 0x1e, 0xf5, 0x0, 0x0,
+    0x0, 0x1, 0xef, 0x40, 0x9, 0xfb, 0x0, 0x0,
+    0x0, 0x6, 0xfc, 0x0, 0x3, 0xff, 0x20, 0x0,
+    0x0, 0xb, 0xf7, 0x0, 0x0, 0xcf, 0x80, 0x0,
+    0x0, 0x3f, 0xf3, 0x11, 0x11, 0x8f, 0xe1, 0x0,
+    0x0, 0x8f, 0xfe, 0xee, 0xee, 0xef, 0xf6, 0x0,
+    0x1, 0xdf, 0xdd, 0xdd, 0xdd, 0xde, 0xfb, 0x0,
+    0x5, 0xfe, 0x20, 0x0, 0x0, 0x5, 0xff, 0x30,
+    0xa, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x90,
+    0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xe1,
+    0x7f, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf6,
+    0xdf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfc,
+
+    /* U+00C1 "Á" */
+    0x0, 0x0, 0x0, 0x1, 0x77, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xfd, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2e, 0xe3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6c, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x12, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xf4, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xef, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xf9, 0xee, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0xf4, 0xaf, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xe1, 0x5f, 0xd0, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0x90, 0x1e, 0xf5, 0x0, 0x0,
+    0x0, 0x1, 0xef, 0x40, 0x9, 0xfb, 0x0, 0x0,
+    0x0, 0x6, 0xfc, 0x0, 0x3, 0xff, 0x20, 0x0,
+    0x0, 0xb, 0xf7, 0x0, 0x0, 0xcf, 0x80, 0x0,
+    0x0, 0x3f, 0xf3, 0x11, 0x11, 0x8f, 0xe1, 0x0,
+    0x0, 0x8f, 0xfe, 0xee, 0xee, 0xef, 0xf6, 0x0,
+    0x1, 0xdf, 0xdd, 0xdd, 0xdd, 0xde, 0xfb, 0x0,
+    0x5, 0xfe, 0x20, 0x0, 0x0, 0x5, 0xff, 0x30,
+    0xa, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x90,
+    0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xe1,
+    0x7f, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf6,
+    0xdf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfc,
+
+    /* U+00C2 "Â" */
+    0x0, 0x0, 0x0, 0x47, 0x61, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xef, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1d, 0xf6, 0xbf, 0x60, 0x0, 0x0,
+    0x0, 0x0, 0x8c, 0x90, 0x3c, 0xc2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x12, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xf4, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xee, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xf9, 0xee, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0xf4, 0xaf, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xe1, 0x5f, 0xd0, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0x90, 0x1d, 0xf5, 0x0, 0x0,
+    0x0, 0x1, 0xef, 0x40, 0x9, 0xfb, 0x0, 0x0,
+    0x0, 0x6, 0xfc, 0x0, 0x3, 0xff, 0x20, 0x0,
+    0x0, 0xb, 0xf7, 0x0, 0x0, 0xcf, 0x80, 0x0,
+    0x0, 0x3f, 0xf3, 0x11, 0x11, 0x8f, 0xe1, 0x0,
+    0x0, 0x8f, 0xfe, 0xee, 0xee, 0xef, 0xf6, 0x0,
+    0x1, 0xdf, 0xdd, 0xdd, 0xdd, 0xde, 0xfc, 0x0,
+    0x5, 0xfe, 0x20, 0x0, 0x0, 0x5, 0xff, 0x30,
+    0xa, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x90,
+    0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xe1,
+    0x7f, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf6,
+    0xdf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfc,
+
+    /* U+00C3 "Ã" */
+    0x0, 0x0, 0x18, 0xb8, 0x30, 0x8a, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xce, 0xed, 0xfa, 0x0, 0x0,
+    0x0, 0x0, 0xb9, 0x2, 0x8c, 0xa2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x12, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xe4, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xef, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xfa, 0xee, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0xf4, 0xaf, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x3f, 0xe1, 0x5f, 0xd0, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0x90, 0x1e, 0xf5, 0x0, 0x0,
+    0x0, 0x1, 0xef, 0x40, 0x9, 0xfb, 0x0, 0x0,
+    0x0, 0x5, 0xfd, 0x10, 0x3, 0xff, 0x20, 0x0,
+    0x0, 0xb, 0xf7, 0x0, 0x0, 0xcf, 0x80, 0x0,
+    0x0, 0x3f, 0xf3, 0x11, 0x11, 0x8f, 0xe1, 0x0,
+    0x0, 0x8f, 0xfe, 0xee, 0xee, 0xef, 0xf5, 0x0,
+    0x1, 0xdf, 0xdd, 0xdd, 0xdd, 0xde, 0xfb, 0x0,
+    0x5, 0xfe, 0x20, 0x0, 0x0, 0x5, 0xff, 0x30,
+    0xa, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x90,
+    0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xe1,
+    0x7f, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf6,
+    0xdf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfc,
+
+    /* U+00C4 "Ä" */
+    0x0, 0x0, 0x59, 0x50, 0x29, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xa0, 0x3f, 0xf1, 0x0, 0x0,
+    0x0, 0x0, 0x7c, 0x80, 0x2c, 0xc1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x12, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xf4, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xef, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xf9, 0xee, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0xf4, 0xaf, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xe1, 0x5f, 0xd0, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0x90, 0x1e, 0xf5, 0x0, 0x0,
+    0x0, 0x1, 0xef, 0x40, 0x9, 0xfb, 0x0, 0x0,
+    0x0, 0x6, 0xfc, 0x0, 0x3, 0xff, 0x20, 0x0,
+    0x0, 0xb, 0xf7, 0x0, 0x0, 0xcf, 0x80, 0x0,
+    0x0, 0x3f, 0xf3, 0x11, 0x11, 0x8f, 0xe1, 0x0,
+    0x0, 0x8f, 0xfe, 0xee, 0xee, 0xef, 0xf6, 0x0,
+    0x1, 0xdf, 0xdd, 0xdd, 0xdd, 0xde, 0xfb, 0x0,
+    0x5, 0xfe, 0x20, 0x0, 0x0, 0x5, 0xff, 0x30,
+    0xa, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x90,
+    0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xe1,
+    0x7f, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf6,
+    0xdf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfc,
+
+    /* U+00C5 "Å" */
+    0x0, 0x0, 0x0, 0x5a, 0x81, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xc3, 0x69, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0x90, 0x1c, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xc6, 0x98, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xf4, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xef, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xfa, 0xee, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0xf5, 0xaf, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x3f, 0xe1, 0x5f, 0xd0, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0x90, 0x1e, 0xf5, 0x0, 0x0,
+    0x0, 0x1, 0xef, 0x40, 0x9, 0xfb, 0x0, 0x0,
+    0x0, 0x5, 0xfd, 0x10, 0x3, 0xff, 0x20, 0x0,
+    0x0, 0xb, 0xf7, 0x0, 0x0, 0xcf, 0x80, 0x0,
+    0x0, 0x2f, 0xf3, 0x11, 0x11, 0x8f, 0xe1, 0x0,
+    0x0, 0x8f, 0xfe, 0xee, 0xee, 0xef, 0xf5, 0x0,
+    0x0, 0xdf, 0xdd, 0xdd, 0xdd, 0xde, 0xfb, 0x0,
+    0x5, 0xfe, 0x20, 0x0, 0x0, 0x5, 0xff, 0x30,
+    0xa, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x90,
+    0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xe1,
+    0x7f, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf6,
+    0xdf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfc,
+
+    /* U+00C6 "Æ" */
+    0x0, 0x0, 0x0, 0x0, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x10, 0x0, 0x0, 0x0, 0x2e,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0xee, 0xff, 0xee, 0xee,
+    0xee, 0xee, 0x50, 0x0, 0x0, 0x1, 0xef, 0x70,
+    0x8f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xe1, 0x8, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1d, 0xf7, 0x0, 0x8f,
+    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0xfe, 0x10, 0x8, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xdf, 0x80, 0x0, 0x8f, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xe2,
+    0x0, 0x8, 0xff, 0xdd, 0xdd, 0xdd, 0xda, 0x0,
+    0x0, 0x1d, 0xf9, 0x0, 0x0, 0x8f, 0xff, 0xff,
+    0xff, 0xff, 0xb0, 0x0, 0x6, 0xfe, 0x20, 0x0,
+    0x8, 0xfb, 0x22, 0x22, 0x22, 0x21, 0x0, 0x0,
+    0xcf, 0xfd, 0xdd, 0xdd, 0xef, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff,
+    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfa,
+    0x33, 0x33, 0x33, 0x9f, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0x30, 0x0, 0x0, 0x8, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xa0, 0x0,
+    0x0, 0x0, 0x8f, 0xb1, 0x11, 0x11, 0x11, 0x11,
+    0x4f, 0xf3, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xab, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xfa,
+
+    /* U+00C7 "Ç" */
+    0x0, 0x0, 0x1, 0x47, 0x76, 0x30, 0x0, 0x0,
+    0x0, 0x2, 0x9e, 0xff, 0xff, 0xfc, 0x40, 0x0,
+    0x0, 0x4d, 0xfe, 0xa8, 0x79, 0xdf, 0xf6, 0x0,
+    0x2, 0xef, 0xb2, 0x0, 0x0, 0x1a, 0xfe, 0x30,
+    0xb, 0xfc, 0x10, 0x0, 0x0, 0x1, 0xcf, 0xa0,
+    0x3f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x5d, 0x91,
+    0x7f, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0,
+    0x5f, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xb2,
+    0x1e, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xe2,
+    0x8, 0xfd, 0x20, 0x0, 0x0, 0x2, 0xef, 0x90,
+    0x1, 0xdf, 0xd5, 0x10, 0x1, 0x4d, 0xfd, 0x20,
+    0x0, 0x2d, 0xff, 0xeb, 0xbd, 0xff, 0xd3, 0x0,
+    0x0, 0x1, 0x7d, 0xff, 0xff, 0xe8, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0x62, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7d, 0xe7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xef, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xbd, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1a, 0xcb, 0x71, 0x0, 0x0, 0x0,
+
+    /* U+00C8 "È" */
+    0x0, 0x0, 0x27, 0x73, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xcf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2c, 0x90, 0x0, 0x0, 0x2, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x21, 0x2e, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf5, 0x2f, 0xfe, 0xee, 0xee, 0xee, 0xee,
+    0xe5, 0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
+    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2f, 0xfe, 0xdd, 0xdd,
+    0xdd, 0xdd, 0x90, 0x2f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xa0, 0x2f, 0xf4, 0x22, 0x22, 0x22, 0x22,
+    0x10, 0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
+    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf3, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x2f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfb, 0x2f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfb,
+
+    /* U+00C9 "É" */
+    0x0, 0x0, 0x0, 0x6, 0x75, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5f, 0xe3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xbf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xc8, 0x0, 0x0, 0x0, 0x2, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x21, 0x2e, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf5, 0x2f, 0xfe, 0xee, 0xee, 0xee, 0xee,
+    0xe5, 0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
+    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2f, 0xfe, 0xdd, 0xdd,
+    0xdd, 0xdd, 0x90, 0x2f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xa0, 0x2f, 0xf4, 0x22, 0x22, 0x22, 0x22,
+    0x10, 0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
+    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf3, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x2f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfb, 0x2f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfb,
+
+    /* U+00CA "Ê" */
+    0x0, 0x0, 0x1, 0x67, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x9, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xc5, 0xfc, 0x10, 0x0, 0x0, 0x2, 0xcc,
+    0x30, 0x9c, 0x80, 0x0, 0x2, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x21, 0x2e, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf5, 0x2f, 0xfe, 0xee, 0xee, 0xee, 0xee,
+    0xe5, 0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
+    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2f, 0xfe, 0xdd, 0xdd,
+    0xdd, 0xdd, 0x90, 0x2f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xa0, 0x2f, 0xf4, 0x22, 0x22, 0x22, 0x22,
+    0x10, 0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
+    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf3, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x2f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfb, 0x2f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfb,
+
+    /* U+00CB "Ë" */
+    0x0, 0x1, 0x89, 0x20, 0x69, 0x50, 0x0, 0x0,
+    0x1, 0xef, 0x30, 0xaf, 0x80, 0x0, 0x0, 0x1,
+    0xbc, 0x20, 0x8c, 0x70, 0x0, 0x2, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x21, 0x2e, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf5, 0x2f, 0xfe, 0xee, 0xee, 0xee,
+    0xee, 0xe5, 0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
+    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xfe, 0xdd,
+    0xdd, 0xdd, 0xdd, 0x90, 0x2f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xa0, 0x2f, 0xf4, 0x22, 0x22, 0x22,
+    0x22, 0x10, 0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
+    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf3,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x2f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfb, 0x2f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfb,
+
+    /* U+00CC "Ì" */
+    0x17, 0x74, 0x0, 0x9f, 0xd1, 0x0, 0xbf, 0x60,
+    0x2, 0xba, 0x0, 0x22, 0x10, 0xb, 0xf8, 0x0,
+    0xbf, 0x80, 0xb, 0xf8, 0x0, 0xbf, 0x80, 0xb,
+    0xf8, 0x0, 0xbf, 0x80, 0xb, 0xf8, 0x0, 0xbf,
+    0x80, 0xb, 0xf8, 0x0, 0xbf, 0x80, 0xb, 0xf8,
+    0x0, 0xbf, 0x80, 0xb, 0xf8, 0x0, 0xbf, 0x80,
+    0xb, 0xf8, 0x0, 0xbf, 0x80, 0xb, 0xf8,
+
+    /* U+00CD "Í" */
+    0x0, 0x67, 0x50, 0x4f, 0xe4, 0xb, 0xf7, 0x2,
+    0xc9, 0x0, 0x2, 0x21, 0x0, 0xbf, 0x80, 0xb,
+    0xf8, 0x0, 0xbf, 0x80, 0xb, 0xf8, 0x0, 0xbf,
+    0x80, 0xb, 0xf8, 0x0, 0xbf, 0x80, 0xb, 0xf8,
+    0x0, 0xbf, 0x80, 0xb, 0xf8, 0x0, 0xbf, 0x80,
+    0xb, 0xf8, 0x0, 0xbf, 0x80, 0xb, 0xf8, 0x0,
+    0xbf, 0x80, 0xb, 0xf8, 0x0, 0xbf, 0x80,
+
+    /* U+00CE "Î" */
+    0x0, 0x16, 0x74, 0x0, 0x0, 0x8f, 0xfe, 0x30,
+    0x5, 0xfd, 0x5f, 0xd2, 0x1c, 0xc4, 0x8, 0xc8,
+    0x0, 0x2, 0x21, 0x0, 0x0, 0xb, 0xf8, 0x0,
+    0x0, 0xb, 0xf8, 0x0, 0x0, 0xb, 0xf8, 0x0,
+    0x0, 0xb, 0xf8, 0x0, 0x0, 0xb, 0xf8, 0x0,
+    0x0, 0xb, 0xf8, 0x0, 0x0, 0xb, 0xf8, 0x0,
+    0x0, 0xb, 0xf8, 0x0, 0x0, 0xb, 0xf8, 0x0,
+    0x0, 0xb, 0xf8, 0x0, 0x0, 0xb, 0xf8, 0x0,
+    0x0, 0xb, 0xf8, 0x0, 0x0, 0xb, 0xf8, 0x0,
+    0x0, 0xb, 0xf8, 0x0, 0x0, 0xb, 0xf8, 0x0,
+    0x0, 0xb, 0xf8, 0x0, 0x0, 0xb, 0xf8, 0x0,
+
+    /* U+00CF "Ï" */
+    0x89, 0x20, 0x59, 0x5e, 0xf4, 0x8, 0xf9, 0xcc,
+    0x30, 0x7c, 0x80, 0x2, 0x21, 0x0, 0x0, 0xbf,
+    0x80, 0x0, 0xb, 0xf8, 0x0, 0x0, 0xbf, 0x80,
+    0x0, 0xb, 0xf8, 0x0, 0x0, 0xbf, 0x80, 0x0,
+    0xb, 0xf8, 0x0, 0x0, 0xbf, 0x80, 0x0, 0xb,
+    0xf8, 0x0, 0x0, 0xbf, 0x80, 0x0, 0xb, 0xf8,
+    0x0, 0x0, 0xbf, 0x80, 0x0, 0xb, 0xf8, 0x0,
+    0x0, 0xbf, 0x80, 0x0, 0xb, 0xf8, 0x0, 0x0,
+    0xbf, 0x80, 0x0, 0xb, 0xf8, 0x0, 0x0, 0xbf,
+    0x80, 0x0,
+
+    /* U+00D0 "Ð" */
+    0x0, 0x22, 0x22, 0x22, 0x22, 0x10, 0x0, 0x0,
+    0x0, 0x3e, 0xff, 0xff, 0xff, 0xed, 0xa3, 0x0,
+    0x0, 0x3, 0xff, 0xee, 0xee, 0xee, 0xff, 0xf7,
+    0x0, 0x0, 0x3f, 0xf2, 0x0, 0x0, 0x14, 0xbf,
+    0xf6, 0x0, 0x3, 0xff, 0x20, 0x0, 0x0, 0x0,
+    0xaf, 0xe1, 0x0, 0x3f, 0xf2, 0x0, 0x0, 0x0,
+    0x1, 0xef, 0x70, 0x3, 0xff, 0x20, 0x0, 0x0,
+    0x0, 0x9, 0xfb, 0x0, 0x3f, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xd1, 0x46, 0xff, 0x54, 0x44,
+    0x30, 0x0, 0x5, 0xfe, 0x1f, 0xff, 0xff, 0xff,
+    0xfd, 0x0, 0x0, 0x4f, 0xe1, 0x46, 0xff, 0x64,
+    0x44, 0x40, 0x0, 0x5, 0xfe, 0x10, 0x3f, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xd1, 0x3, 0xff,
+    0x20, 0x0, 0x0, 0x0, 0xb, 0xfa, 0x0, 0x3f,
+    0xf2, 0x0, 0x0, 0x0, 0x2, 0xff, 0x50, 0x3,
+    0xff, 0x20, 0x0, 0x0, 0x1, 0xbf, 0xd1, 0x0,
+    0x3f, 0xf2, 0x11, 0x11, 0x25, 0xcf, 0xf4, 0x0,
+    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe5, 0x0,
+    0x0, 0x3f, 0xff, 0xff, 0xff, 0xec, 0x82, 0x0,
+    0x0,
+
+    /* U+00D1 "Ñ" */
+    0x0, 0x0, 0x2b, 0xda, 0x40, 0xbb, 0x0, 0x0,
+    0x0, 0xb, 0xeb, 0xef, 0xef, 0x80, 0x0, 0x0,
+    0x0, 0xa8, 0x1, 0x7b, 0x81, 0x0, 0x0, 0x22,
+    0x10, 0x0, 0x0, 0x0, 0x2, 0x21, 0x3f, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0xcf, 0x63, 0xff, 0xf4,
+    0x0, 0x0, 0x0, 0xc, 0xf6, 0x3f, 0xff, 0xd1,
+    0x0, 0x0, 0x0, 0xcf, 0x63, 0xff, 0xef, 0x90,
+    0x0, 0x0, 0xc, 0xf6, 0x3f, 0xe7, 0xff, 0x40,
+    0x0, 0x0, 0xcf, 0x63, 0xfe, 0x1a, 0xfd, 0x10,
+    0x0, 0xc, 0xf6, 0x3f, 0xe1, 0x2e, 0xf9, 0x0,
+    0x0, 0xcf, 0x63, 0xfe, 0x10, 0x5f, 0xf5, 0x0,
+    0xc, 0xf6, 0x3f, 0xe1, 0x0, 0xaf, 0xd1, 0x0,
+    0xcf, 0x63, 0xfe, 0x10, 0x2, 0xdf, 0x90, 0xc,
+    0xf6, 0x3f, 0xe1, 0x0, 0x5, 0xff, 0x50, 0xcf,
+    0x63, 0xfe, 0x10, 0x0, 0xa, 0xfd, 0x1c, 0xf6,
+    0x3f, 0xe1, 0x0, 0x0, 0x1d, 0xf9, 0xcf, 0x63,
+    0xfe, 0x10, 0x0, 0x0, 0x5f, 0xff, 0xf6, 0x3f,
+    0xe1, 0x0, 0x0, 0x0, 0xaf, 0xff, 0x63, 0xfe,
+    0x10, 0x0, 0x0, 0x1, 0xef, 0xf6, 0x3f, 0xe1,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0x60,
+
+    /* U+00D2 "Ò" */
+    0x0, 0x0, 0x3, 0x77, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1c, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2d, 0xe2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4c, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x35, 0x54, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x17, 0xdf, 0xff, 0xff,
+    0xc5, 0x0, 0x0, 0x0, 0x2c, 0xff, 0xda, 0x9a,
+    0xef, 0xf9, 0x10, 0x0, 0x1d, 0xfd, 0x50, 0x0,
+    0x1, 0x7f, 0xfa, 0x0, 0x9, 0xfd, 0x20, 0x0,
+    0x0, 0x0, 0x5f, 0xf5, 0x2, 0xff, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xc0, 0x7f, 0xd1, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0x3a, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xe, 0xf6, 0xcf, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x8c, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf9, 0xcf,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x8a,
+    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf6,
+    0x6f, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0x32, 0xef, 0x60, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xc0, 0x8, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x5f,
+    0xf5, 0x0, 0x1c, 0xfd, 0x50, 0x0, 0x1, 0x7f,
+    0xf9, 0x0, 0x0, 0x2b, 0xff, 0xda, 0x9b, 0xef,
+    0xf9, 0x10, 0x0, 0x0, 0x6, 0xdf, 0xff, 0xff,
+    0xb4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x54,
+    0x10, 0x0, 0x0, 0x0,
+
+    /* U+00D3 "Ó" */
+    0x0, 0x0, 0x0, 0x0, 0x47, 0x61, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1d, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xab, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x35, 0x54, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x17, 0xdf, 0xff, 0xff,
+    0xc5, 0x0, 0x0, 0x0, 0x2c, 0xff, 0xda, 0x9a,
+    0xef, 0xf9, 0x10, 0x0, 0x1d, 0xfd, 0x50, 0x0,
+    0x1, 0x7f, 0xfa, 0x0, 0x9, 0xfd, 0x20, 0x0,
+    0x0, 0x0, 0x5f, 0xf5, 0x2, 0xff, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xc0, 0x7f, 0xd1, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0x3a, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xe, 0xf6, 0xcf, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x8c, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf9, 0xcf,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x8a,
+    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf6,
+    0x6f, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0x32, 0xef, 0x60, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xc0, 0x8, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x5f,
+    0xf5, 0x0, 0x1c, 0xfd, 0x50, 0x0, 0x1, 0x7f,
+    0xf9, 0x0, 0x0, 0x2b, 0xff, 0xda, 0x9b, 0xef,
+    0xf9, 0x10, 0x0, 0x0, 0x6, 0xdf, 0xff, 0xff,
+    0xb4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x54,
+    0x10, 0x0, 0x0, 0x0,
+
+    /* U+00D4 "Ô" */
+    0x0, 0x0, 0x0, 0x16, 0x74, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0xe3, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xfd, 0x5f, 0xd1, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xbc, 0x40, 0x8c, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x35, 0x54, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x17, 0xdf, 0xff, 0xff,
+    0xc5, 0x0, 0x0, 0x0, 0x2c, 0xff, 0xda, 0x9a,
+    0xef, 0xf9, 0x10, 0x0, 0x1d, 0xfd, 0x50, 0x0,
+    0x1, 0x7f, 0xfa, 0x0, 0x9, 0xfd, 0x20, 0x0,
+    0x0, 0x0, 0x5f, 0xf5, 0x2, 0xff, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xc0, 0x7f, 0xd1, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0x3a, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xe, 0xf6, 0xcf, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x8c, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf9, 0xcf,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x8a,
+    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf6,
+    0x6f, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0x32, 0xef, 0x60, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xc0, 0x8, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x5f,
+    0xf5, 0x0, 0x1c, 0xfd, 0x50, 0x0, 0x1, 0x7f,
+    0xf9, 0x0, 0x0, 0x2b, 0xff, 0xda, 0x9b, 0xef,
+    0xf9, 0x10, 0x0, 0x0, 0x6, 0xdf, 0xff, 0xff,
+    0xb4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x54,
+    0x10, 0x0, 0x0, 0x0,
+
+    /* U+00D5 "Õ" */
+    0x0, 0x0, 0x5, 0xb9, 0x50, 0x4b, 0x30, 0x0,
+    0x0, 0x0, 0x4, 0xfd, 0xdf, 0xde, 0xe1, 0x0,
+    0x0, 0x0, 0x0, 0x6c, 0x21, 0x6b, 0xb4, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x13, 0x55, 0x42, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x7d, 0xff, 0xff, 0xfc,
+    0x50, 0x0, 0x0, 0x2, 0xcf, 0xfd, 0xa9, 0xae,
+    0xff, 0x91, 0x0, 0x1, 0xdf, 0xd5, 0x0, 0x0,
+    0x17, 0xff, 0xa0, 0x0, 0x9f, 0xd2, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0x50, 0x2f, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0xa, 0xfc, 0x7, 0xfd, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xf3, 0xaf, 0xa0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xef, 0x6c, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xc, 0xf8, 0xcf, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x9c, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf8, 0xaf,
+    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x66,
+    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf3,
+    0x2e, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfc,
+    0x0, 0x8f, 0xe3, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0x50, 0x1, 0xcf, 0xd5, 0x0, 0x0, 0x17, 0xff,
+    0x90, 0x0, 0x2, 0xbf, 0xfd, 0xa9, 0xbe, 0xff,
+    0x91, 0x0, 0x0, 0x0, 0x6d, 0xff, 0xff, 0xfb,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x2, 0x45, 0x41,
+    0x0, 0x0, 0x0,
+
+    /* U+00D6 "Ö" */
+    0x0, 0x0, 0x8, 0x92, 0x5, 0x95, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xdf, 0x40, 0x9f, 0xa0, 0x0,
+    0x0, 0x0, 0x0, 0x1b, 0xc3, 0x7, 0xc8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x13, 0x55, 0x42, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x7d, 0xff, 0xff, 0xfc,
+    0x50, 0x0, 0x0, 0x2, 0xcf, 0xfd, 0xa9, 0xae,
+    0xff, 0x91, 0x0, 0x1, 0xdf, 0xd5, 0x0, 0x0,
+    0x17, 0xff, 0xa0, 0x0, 0x9f, 0xd2, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0x50, 0x2f, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0xa, 0xfc, 0x7, 0xfd, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xf3, 0xaf, 0xa0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xef, 0x6c, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xc, 0xf8, 0xcf, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x9c, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf8, 0xaf,
+    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x66,
+    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf3,
+    0x2e, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfc,
+    0x0, 0x8f, 0xe3, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0x50, 0x1, 0xcf, 0xd5, 0x0, 0x0, 0x17, 0xff,
+    0x90, 0x0, 0x2, 0xbf, 0xfd, 0xa9, 0xbe, 0xff,
+    0x91, 0x0, 0x0, 0x0, 0x6d, 0xff, 0xff, 0xfb,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x2, 0x45, 0x41,
+    0x0, 0x0, 0x0,
+
+    /* U+00D7 "×" */
+    0x14, 0x0, 0x0, 0x0, 0x40, 0xaf, 0x60, 0x0,
+    0x5, 0xfa, 0x7f, 0xf6, 0x0, 0x6f, 0xf7, 0x7,
+    0xff, 0x66, 0xff, 0x70, 0x0, 0x7f, 0xff, 0xf7,
+    0x0, 0x0, 0xa, 0xff, 0xa0, 0x0, 0x0, 0x6f,
+    0xff, 0xf6, 0x0, 0x6, 0xff, 0x77, 0xff, 0x60,
+    0x6f, 0xf7, 0x0, 0x7f, 0xf6, 0xbf, 0x70, 0x0,
+    0x7, 0xfb, 0x15, 0x0, 0x0, 0x0, 0x51,
+
+    /* U+00D8 "Ø" */
+    0x0, 0x0, 0x1, 0x25, 0x54, 0x20, 0x0, 0x6,
+    0x20, 0x0, 0x17, 0xdf, 0xff, 0xff, 0xb4, 0x7,
+    0xf7, 0x0, 0x2c, 0xff, 0xda, 0x9a, 0xef, 0xfb,
+    0xfa, 0x0, 0x2d, 0xfd, 0x40, 0x0, 0x1, 0x8f,
+    0xfd, 0x10, 0xa, 0xfd, 0x20, 0x0, 0x0, 0x3,
+    0xef, 0xf4, 0x2, 0xff, 0x50, 0x0, 0x0, 0x2,
+    0xed, 0xbf, 0xc0, 0x7f, 0xd1, 0x0, 0x0, 0x1,
+    0xde, 0x34, 0xff, 0x2a, 0xf9, 0x0, 0x0, 0x1,
+    0xce, 0x40, 0x1e, 0xf6, 0xcf, 0x70, 0x0, 0x1,
+    0xbf, 0x50, 0x0, 0xdf, 0x7d, 0xf7, 0x0, 0x0,
+    0x9f, 0x60, 0x0, 0xc, 0xf8, 0xdf, 0x80, 0x0,
+    0x8f, 0x80, 0x0, 0x0, 0xdf, 0x7b, 0xfa, 0x0,
+    0x6f, 0x90, 0x0, 0x0, 0x1e, 0xf5, 0x7f, 0xd1,
+    0x5f, 0xa1, 0x0, 0x0, 0x4, 0xff, 0x22, 0xef,
+    0x8e, 0xb1, 0x0, 0x0, 0x0, 0xaf, 0xb0, 0x8,
+    0xff, 0xd2, 0x0, 0x0, 0x0, 0x6f, 0xf4, 0x0,
+    0x3f, 0xfd, 0x50, 0x0, 0x1, 0x8f, 0xf9, 0x0,
+    0x1c, 0xec, 0xff, 0xda, 0x9b, 0xef, 0xf9, 0x0,
+    0xb, 0xe4, 0x6, 0xdf, 0xff, 0xff, 0xb4, 0x0,
+    0x0, 0x45, 0x0, 0x0, 0x24, 0x54, 0x10, 0x0,
+    0x0, 0x0,
+
+    /* U+00D9 "Ù" */
+    0x0, 0x0, 0x16, 0x74, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xd1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xbf, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xba, 0x0, 0x0, 0x0, 0x2, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x22, 0x12, 0xef, 0x20,
+    0x0, 0x0, 0x0, 0xd, 0xf6, 0x2f, 0xf2, 0x0,
+    0x0, 0x0, 0x0, 0xdf, 0x62, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0xd, 0xf6, 0x2f, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0x62, 0xff, 0x20, 0x0, 0x0,
+    0x0, 0xd, 0xf6, 0x2f, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0xdf, 0x62, 0xff, 0x20, 0x0, 0x0, 0x0,
+    0xd, 0xf6, 0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0x62, 0xff, 0x20, 0x0, 0x0, 0x0, 0xd,
+    0xf6, 0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xdf,
+    0x62, 0xff, 0x30, 0x0, 0x0, 0x0, 0xe, 0xf6,
+    0x1e, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xef, 0x50,
+    0xdf, 0x60, 0x0, 0x0, 0x0, 0x2f, 0xf3, 0xa,
+    0xfc, 0x10, 0x0, 0x0, 0x8, 0xfd, 0x10, 0x4f,
+    0xfa, 0x20, 0x0, 0x16, 0xff, 0x80, 0x0, 0x8f,
+    0xfe, 0xcb, 0xbe, 0xff, 0xb1, 0x0, 0x0, 0x5d,
+    0xff, 0xff, 0xfe, 0x70, 0x0, 0x0, 0x0, 0x2,
+    0x45, 0x53, 0x0, 0x0, 0x0,
+
+    /* U+00DA "Ú" */
+    0x0, 0x0, 0x0, 0x2, 0x77, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3f, 0xd2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xc4, 0x0, 0x0, 0x0, 0x2, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x22, 0x12, 0xef, 0x20,
+    0x0, 0x0, 0x0, 0xd, 0xf6, 0x2f, 0xf2, 0x0,
+    0x0, 0x0, 0x0, 0xdf, 0x62, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0xd, 0xf6, 0x2f, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0x62, 0xff, 0x20, 0x0, 0x0,
+    0x0, 0xd, 0xf6, 0x2f, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0xdf, 0x62, 0xff, 0x20, 0x0, 0x0, 0x0,
+    0xd, 0xf6, 0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0x62, 0xff, 0x20, 0x0, 0x0, 0x0, 0xd,
+    0xf6, 0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xdf,
+    0x62, 0xff, 0x30, 0x0, 0x0, 0x0, 0xe, 0xf6,
+    0x1e, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xef, 0x50,
+    0xdf, 0x60, 0x0, 0x0, 0x0, 0x2f, 0xf3, 0xa,
+    0xfc, 0x10, 0x0, 0x0, 0x8, 0xfd, 0x10, 0x4f,
+    0xfa, 0x20, 0x0, 0x16, 0xff, 0x80, 0x0, 0x8f,
+    0xfe, 0xcb, 0xbe, 0xff, 0xb1, 0x0, 0x0, 0x5d,
+    0xff, 0xff, 0xfe, 0x70, 0x0, 0x0, 0x0, 0x2,
+    0x45, 0x53, 0x0, 0x0, 0x0,
+
+    /* U+00DB "Û" */
+    0x0, 0x0, 0x0, 0x57, 0x60, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5f, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x3e, 0xe5, 0xdf, 0x40, 0x0, 0x0, 0x0,
+    0x9, 0xc7, 0x5, 0xcb, 0x10, 0x0, 0x2, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x22, 0x12, 0xff, 0x20,
+    0x0, 0x0, 0x0, 0xd, 0xf6, 0x2f, 0xf2, 0x0,
+    0x0, 0x0, 0x0, 0xdf, 0x62, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0xd, 0xf6, 0x2f, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0x62, 0xff, 0x20, 0x0, 0x0,
+    0x0, 0xd, 0xf6, 0x2f, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0xdf, 0x62, 0xff, 0x20, 0x0, 0x0, 0x0,
+    0xd, 0xf6, 0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0x62, 0xff, 0x20, 0x0, 0x0, 0x0, 0xd,
+    0xf6, 0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xdf,
+    0x62, 0xff, 0x30, 0x0, 0x0, 0x0, 0xe, 0xf6,
+    0x1e, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xef, 0x50,
+    0xdf, 0x60, 0x0, 0x0, 0x0, 0x2f, 0xf3, 0xa,
+    0xfc, 0x10, 0x0, 0x0, 0x8, 0xfd, 0x10, 0x4f,
+    0xfa, 0x20, 0x0, 0x16, 0xff, 0x80, 0x0, 0x8f,
+    0xfe, 0xcb, 0xbe, 0xff, 0xb1, 0x0, 0x0, 0x5d,
+    0xff, 0xff, 0xfe, 0x70, 0x0, 0x0, 0x0, 0x2,
+    0x45, 0x53, 0x0, 0x0, 0x0,
+
+    /* U+00DC "Ü" */
+    0x0, 0x0, 0x69, 0x50, 0x39, 0x80, 0x0, 0x0,
+    0x0, 0xa, 0xf8, 0x5, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0x8c, 0x70, 0x4c, 0xb0, 0x0, 0x0, 0x22,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0x21, 0x2e, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0xdf, 0x62, 0xff, 0x20,
+    0x0, 0x0, 0x0, 0xd, 0xf6, 0x2f, 0xf2, 0x0,
+    0x0, 0x0, 0x0, 0xdf, 0x62, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0xd, 0xf6, 0x2f, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0x62, 0xff, 0x20, 0x0, 0x0,
+    0x0, 0xd, 0xf6, 0x2f, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0xdf, 0x62, 0xff, 0x20, 0x0, 0x0, 0x0,
+    0xd, 0xf6, 0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0x62, 0xff, 0x20, 0x0, 0x0, 0x0, 0xd,
+    0xf6, 0x2f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xef,
+    0x61, 0xef, 0x40, 0x0, 0x0, 0x0, 0xe, 0xf5,
+    0xd, 0xf6, 0x0, 0x0, 0x0, 0x2, 0xff, 0x30,
+    0xaf, 0xc1, 0x0, 0x0, 0x0, 0x8f, 0xd1, 0x4,
+    0xff, 0xa2, 0x0, 0x1, 0x6f, 0xf8, 0x0, 0x8,
+    0xff, 0xec, 0xbb, 0xef, 0xfb, 0x10, 0x0, 0x5,
+    0xdf, 0xff, 0xff, 0xe7, 0x0, 0x0, 0x0, 0x0,
+    0x24, 0x55, 0x30, 0x0, 0x0,
+
+    /* U+00DD "Ý" */
+    0x0, 0x0, 0x0, 0x1, 0x67, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xfe, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1c, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4c, 0x70, 0x0, 0x0, 0x0,
+    0x22, 0x20, 0x0, 0x0, 0x0, 0x0, 0x2, 0x21,
+    0x8f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf6,
+    0x1c, 0xfd, 0x10, 0x0, 0x0, 0x1, 0xdf, 0xa0,
+    0x3, 0xef, 0x80, 0x0, 0x0, 0x8, 0xfd, 0x20,
+    0x0, 0x8f, 0xf4, 0x0, 0x0, 0x3f, 0xf5, 0x0,
+    0x0, 0x1c, 0xfc, 0x10, 0x1, 0xdf, 0x90, 0x0,
+    0x0, 0x3, 0xef, 0x80, 0x8, 0xfd, 0x10, 0x0,
+    0x0, 0x0, 0x7f, 0xe3, 0x3e, 0xf4, 0x0, 0x0,
+    0x0, 0x0, 0x1c, 0xfb, 0xbf, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xef, 0xfc, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xe1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xe1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xe1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xe1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xe1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xe1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xe1, 0x0, 0x0, 0x0,
+
+    /* U+00DE "Þ" */
+    0x2, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfb,
+    0xaa, 0xaa, 0xa9, 0x61, 0x0, 0x3, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xe5, 0x0, 0x3f, 0xf6, 0x55,
+    0x55, 0x57, 0xdf, 0xf3, 0x3, 0xff, 0x20, 0x0,
+    0x0, 0x1, 0xdf, 0xa0, 0x3f, 0xf2, 0x0, 0x0,
+    0x0, 0x8, 0xfd, 0x13, 0xff, 0x20, 0x0, 0x0,
+    0x0, 0x6f, 0xd1, 0x3f, 0xf2, 0x0, 0x0, 0x0,
+    0x9, 0xfc, 0x3, 0xff, 0x20, 0x0, 0x0, 0x4,
+    0xef, 0x80, 0x3f, 0xf8, 0x77, 0x77, 0x8b, 0xef,
+    0xd1, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3,
+    0x0, 0x3f, 0xf9, 0x88, 0x88, 0x86, 0x30, 0x0,
+    0x3, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+00DF "ß" */
+    0x0, 0x1, 0x57, 0x74, 0x0, 0x0, 0x0, 0x7,
+    0xef, 0xff, 0xfb, 0x20, 0x0, 0x6, 0xfe, 0x84,
+    0x5c, 0xfb, 0x0, 0x0, 0xdf, 0x60, 0x0, 0x2e,
+    0xf2, 0x0, 0x2e, 0xe2, 0x0, 0x1, 0xef, 0x10,
+    0x3, 0xfd, 0x10, 0x0, 0x5f, 0xc0, 0x0, 0x3f,
+    0xd1, 0x0, 0x1c, 0xf5, 0x0, 0x3, 0xfd, 0x10,
+    0x6, 0xfb, 0x0, 0x0, 0x3f, 0xd1, 0x0, 0xbf,
+    0x60, 0x0, 0x3, 0xfd, 0x10, 0xb, 0xfb, 0x10,
+    0x0, 0x3f, 0xd1, 0x0, 0x4e, 0xfc, 0x30, 0x3,
+    0xfd, 0x10, 0x0, 0x4d, 0xfe, 0x60, 0x3f, 0xd1,
+    0x0, 0x0, 0x2a, 0xff, 0x53, 0xfd, 0x10, 0x0,
+    0x0, 0x9, 0xfc, 0x3f, 0xd1, 0x1, 0x10, 0x0,
+    0x4f, 0xd3, 0xfd, 0x15, 0xeb, 0x0, 0x8, 0xfb,
+    0x3f, 0xd1, 0x2d, 0xfb, 0x69, 0xff, 0x43, 0xfd,
+    0x10, 0x3c, 0xff, 0xfe, 0x50, 0x1, 0x10, 0x0,
+    0x3, 0x54, 0x0, 0x0,
+
+    /* U+00E0 "à" */
+    0x0, 0x0, 0x22, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xe2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x12, 0x10, 0x0,
+    0x0, 0x0, 0x16, 0x9a, 0xa8, 0x40, 0x0, 0x0,
+    0x5e, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x3f, 0xf8,
+    0x21, 0x28, 0xff, 0x50, 0x9, 0xfa, 0x0, 0x0,
+    0xa, 0xf9, 0x0, 0x25, 0x20, 0x0, 0x0, 0x7f,
+    0xa0, 0x0, 0x0, 0x12, 0x36, 0x9d, 0xfa, 0x0,
+    0x3, 0xad, 0xef, 0xff, 0xef, 0xa0, 0x5, 0xef,
+    0xdb, 0x85, 0x27, 0xfa, 0x0, 0xdf, 0x91, 0x0,
+    0x0, 0x8f, 0xa0, 0x2f, 0xf2, 0x0, 0x0, 0xb,
+    0xfa, 0x1, 0xff, 0x50, 0x0, 0x6, 0xff, 0xa0,
+    0xa, 0xfe, 0x75, 0x6a, 0xfd, 0xfc, 0x0, 0x1b,
+    0xff, 0xff, 0xd6, 0x2f, 0xf2, 0x0, 0x2, 0x55,
+    0x30, 0x0, 0x11, 0x0,
+
+    /* U+00E1 "á" */
+    0x0, 0x0, 0x0, 0x2, 0x21, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0xcf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x21, 0x0, 0x0,
+    0x0, 0x0, 0x16, 0x9a, 0xa8, 0x40, 0x0, 0x0,
+    0x5e, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x3f, 0xf8,
+    0x21, 0x28, 0xff, 0x50, 0x9, 0xfa, 0x0, 0x0,
+    0xa, 0xf9, 0x0, 0x25, 0x20, 0x0, 0x0, 0x7f,
+    0xa0, 0x0, 0x0, 0x12, 0x36, 0x9d, 0xfa, 0x0,
+    0x3, 0xad, 0xef, 0xff, 0xef, 0xa0, 0x5, 0xef,
+    0xdb, 0x85, 0x27, 0xfa, 0x0, 0xdf, 0x91, 0x0,
+    0x0, 0x8f, 0xa0, 0x2f, 0xf2, 0x0, 0x0, 0xb,
+    0xfa, 0x1, 0xff, 0x50, 0x0, 0x6, 0xff, 0xa0,
+    0xa, 0xfe, 0x75, 0x6a, 0xfd, 0xfc, 0x0, 0x1b,
+    0xff, 0xff, 0xd6, 0x2f, 0xf2, 0x0, 0x2, 0x55,
+    0x30, 0x0, 0x11, 0x0,
+
+    /* U+00E2 "â" */
+    0x0, 0x0, 0x2, 0x22, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xef, 0xe4, 0x0, 0x0, 0x0, 0x1, 0xcf,
+    0x8e, 0xd2, 0x0, 0x0, 0x0, 0x9f, 0xa0, 0x7f,
+    0xb0, 0x0, 0x0, 0x2, 0x21, 0x0, 0x22, 0x0,
+    0x0, 0x0, 0x16, 0x9a, 0xa8, 0x40, 0x0, 0x0,
+    0x5e, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x3f, 0xf8,
+    0x21, 0x28, 0xff, 0x50, 0x9, 0xfa, 0x0, 0x0,
+    0xa, 0xf9, 0x0, 0x25, 0x20, 0x0, 0x0, 0x7f,
+    0xa0, 0x0, 0x0, 0x12, 0x36, 0x9d, 0xfa, 0x0,
+    0x3, 0xad, 0xef, 0xff, 0xef, 0xa0, 0x5, 0xef,
+    0xdb, 0x85, 0x27, 0xfa, 0x0, 0xdf, 0x91, 0x0,
+    0x0, 0x8f, 0xa0, 0x2f, 0xf2, 0x0, 0x0, 0xb,
+    0xfa, 0x1, 0xff, 0x50, 0x0, 0x6, 0xff, 0xa0,
+    0xa, 0xfe, 0x75, 0x6a, 0xfd, 0xfc, 0x0, 0x1b,
+    0xff, 0xff, 0xd6, 0x2f, 0xf2, 0x0, 0x2, 0x55,
+    0x30, 0x0, 0x11, 0x0,
+
+    /* U+00E3 "ã" */
+    0x0, 0x4, 0xbb, 0x61, 0x2c, 0x60, 0x0, 0x1,
+    0xee, 0xdf, 0xdd, 0xf4, 0x0, 0x0, 0x4d, 0x50,
+    0x5b, 0xd7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x69, 0xaa, 0x84, 0x0,
+    0x0, 0x5, 0xef, 0xff, 0xff, 0xfa, 0x0, 0x3,
+    0xff, 0x82, 0x12, 0x8f, 0xf5, 0x0, 0x9f, 0xa0,
+    0x0, 0x0, 0xaf, 0x90, 0x2, 0x52, 0x0, 0x0,
+    0x7, 0xfa, 0x0, 0x0, 0x1, 0x23, 0x69, 0xdf,
+    0xa0, 0x0, 0x3a, 0xde, 0xff, 0xfe, 0xfa, 0x0,
+    0x5e, 0xfd, 0xb8, 0x52, 0x7f, 0xa0, 0xd, 0xf9,
+    0x10, 0x0, 0x8, 0xfa, 0x2, 0xff, 0x20, 0x0,
+    0x0, 0xbf, 0xa0, 0x1f, 0xf5, 0x0, 0x0, 0x6f,
+    0xfa, 0x0, 0xaf, 0xe7, 0x56, 0xaf, 0xdf, 0xc0,
+    0x1, 0xbf, 0xff, 0xfd, 0x62, 0xff, 0x20, 0x0,
+    0x25, 0x53, 0x0, 0x1, 0x10,
+
+    /* U+00E4 "ä" */
+    0x0, 0x1, 0x21, 0x1, 0x22, 0x0, 0x0, 0x0,
+    0xaf, 0x80, 0x5f, 0xd0, 0x0, 0x0, 0xa, 0xf8,
+    0x5, 0xfd, 0x0, 0x0, 0x0, 0x34, 0x20, 0x14,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x16, 0x9a, 0xa8, 0x40, 0x0, 0x0,
+    0x5e, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x3f, 0xf8,
+    0x21, 0x28, 0xff, 0x50, 0x9, 0xfa, 0x0, 0x0,
+    0xa, 0xf9, 0x0, 0x25, 0x20, 0x0, 0x0, 0x7f,
+    0xa0, 0x0, 0x0, 0x12, 0x36, 0x9d, 0xfa, 0x0,
+    0x3, 0xad, 0xef, 0xff, 0xef, 0xa0, 0x5, 0xef,
+    0xdb, 0x85, 0x27, 0xfa, 0x0, 0xdf, 0x91, 0x0,
+    0x0, 0x8f, 0xa0, 0x2f, 0xf2, 0x0, 0x0, 0xb,
+    0xfa, 0x1, 0xff, 0x50, 0x0, 0x6, 0xff, 0xa0,
+    0xa, 0xfe, 0x75, 0x6a, 0xfd, 0xfc, 0x0, 0x1b,
+    0xff, 0xff, 0xd6, 0x2f, 0xf2, 0x0, 0x2, 0x55,
+    0x30, 0x0, 0x11, 0x0,
+
+    /* U+00E5 "å" */
+    0x0, 0x0, 0x5, 0x96, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xb4, 0x96, 0x0, 0x0, 0x0, 0x0, 0x76,
+    0x3, 0xa0, 0x0, 0x0, 0x0, 0x4, 0xc5, 0xa7,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0x96, 0x0, 0x0,
+    0x0, 0x0, 0x16, 0x9a, 0xa8, 0x40, 0x0, 0x0,
+    0x5e, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x3f, 0xf8,
+    0x21, 0x28, 0xff, 0x50, 0x9, 0xfa, 0x0, 0x0,
+    0xa, 0xf9, 0x0, 0x25, 0x20, 0x0, 0x0, 0x7f,
+    0xa0, 0x0, 0x0, 0x12, 0x36, 0x9d, 0xfa, 0x0,
+    0x3, 0xad, 0xef, 0xff, 0xef, 0xa0, 0x5, 0xef,
+    0xdb, 0x85, 0x27, 0xfa, 0x0, 0xdf, 0x91, 0x0,
+    0x0, 0x8f, 0xa0, 0x2f, 0xf2, 0x0, 0x0, 0xb,
+    0xfa, 0x1, 0xff, 0x50, 0x0, 0x6, 0xff, 0xa0,
+    0xa, 0xfe, 0x75, 0x6a, 0xfd, 0xfc, 0x0, 0x1b,
+    0xff, 0xff, 0xd6, 0x2f, 0xf2, 0x0, 0x2, 0x55,
+    0x30, 0x0, 0x11, 0x0,
+
+    /* U+00E6 "æ" */
+    0x0, 0x1, 0x69, 0xaa, 0x73, 0x0, 0x38, 0xaa,
+    0x71, 0x0, 0x0, 0x6, 0xef, 0xff, 0xff, 0xf7,
+    0x9f, 0xff, 0xff, 0xe5, 0x0, 0x3, 0xfe, 0x72,
+    0x12, 0x9f, 0xff, 0xd5, 0x12, 0x7f, 0xe3, 0x0,
+    0x9f, 0x80, 0x0, 0x1, 0xdf, 0xe2, 0x0, 0x0,
+    0x7f, 0xa0, 0x4, 0x72, 0x0, 0x0, 0xb, 0xf9,
+    0x0, 0x0, 0x2, 0xee, 0x10, 0x0, 0x0, 0x12,
+    0x47, 0xef, 0x83, 0x33, 0x33, 0x3d, 0xf4, 0x0,
+    0x28, 0xce, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x50, 0x4e, 0xfe, 0xc9, 0x63, 0xbf, 0xa8,
+    0x88, 0x88, 0x88, 0x83, 0xd, 0xf9, 0x10, 0x0,
+    0xb, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0x20, 0x0, 0x1, 0xdf, 0xa0, 0x0, 0x0, 0x2c,
+    0xb2, 0x2f, 0xf4, 0x0, 0x1, 0x9f, 0xff, 0x40,
+    0x0, 0x9, 0xfc, 0x0, 0xbf, 0xe8, 0x68, 0xdf,
+    0xa7, 0xff, 0xa6, 0x7b, 0xfe, 0x30, 0x1, 0xbf,
+    0xff, 0xfd, 0x60, 0x5, 0xdf, 0xff, 0xfb, 0x30,
+    0x0, 0x0, 0x25, 0x53, 0x0, 0x0, 0x0, 0x35,
+    0x42, 0x0, 0x0,
+
+    /* U+00E7 "ç" */
+    0x0, 0x0, 0x49, 0xa9, 0x61, 0x0, 0x0, 0x2c,
+    0xff, 0xff, 0xfd, 0x30, 0x1, 0xdf, 0xc4, 0x13,
+    0xaf, 0xd1, 0x7, 0xfd, 0x10, 0x0, 0x1d, 0xf5,
+    0xc, 0xf6, 0x0, 0x0, 0x5, 0x63, 0xe, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0x1f, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0xe, 0xf4, 0x0, 0x0, 0x2, 0x63, 0xb, 0xf8,
+    0x0, 0x0, 0x8, 0xf9, 0x5, 0xfe, 0x30, 0x0,
+    0x2e, 0xf4, 0x0, 0xaf, 0xe8, 0x68, 0xef, 0x90,
+    0x0, 0x8, 0xef, 0xff, 0xe8, 0x0, 0x0, 0x0,
+    0x1d, 0xd5, 0x10, 0x0, 0x0, 0x0, 0x1a, 0xed,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x90, 0x0,
+    0x0, 0x4, 0xab, 0xef, 0x50, 0x0, 0x0, 0x5,
+    0xcc, 0xa4, 0x0, 0x0,
+
+    /* U+00E8 "è" */
+    0x0, 0x1, 0x22, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x1c, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d,
+    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x22, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0x9a, 0x96, 0x10, 0x0, 0x0,
+    0x2b, 0xff, 0xff, 0xfe, 0x40, 0x0, 0x1c, 0xfc,
+    0x41, 0x29, 0xfe, 0x30, 0x7, 0xfd, 0x10, 0x0,
+    0x9, 0xfa, 0x0, 0xcf, 0x70, 0x0, 0x0, 0x2f,
+    0xf1, 0x1f, 0xf6, 0x33, 0x33, 0x33, 0xef, 0x42,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x2f, 0xf8,
+    0x88, 0x88, 0x88, 0x88, 0x30, 0xef, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xf8, 0x0, 0x0, 0x2,
+    0xcb, 0x20, 0x5f, 0xe4, 0x0, 0x0, 0xaf, 0xc0,
+    0x0, 0xaf, 0xfa, 0x67, 0xcf, 0xe4, 0x0, 0x0,
+    0x7e, 0xff, 0xff, 0xc3, 0x0, 0x0, 0x0, 0x3,
+    0x55, 0x20, 0x0, 0x0,
+
+    /* U+00E9 "é" */
+    0x0, 0x0, 0x0, 0x2, 0x21, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xfe, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x21, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0x9a, 0x96, 0x10, 0x0, 0x0,
+    0x2b, 0xff, 0xff, 0xfe, 0x40, 0x0, 0x1c, 0xfc,
+    0x41, 0x29, 0xfe, 0x30, 0x7, 0xfd, 0x10, 0x0,
+    0x9, 0xfa, 0x0, 0xcf, 0x70, 0x0, 0x0, 0x2f,
+    0xf1, 0x1f, 0xf6, 0x33, 0x33, 0x33, 0xef, 0x42,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x2f, 0xf8,
+    0x88, 0x88, 0x88, 0x88, 0x30, 0xef, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xf8, 0x0, 0x0, 0x2,
+    0xcb, 0x20, 0x5f, 0xe4, 0x0, 0x0, 0xaf, 0xc0,
+    0x0, 0xaf, 0xfa, 0x67, 0xcf, 0xe4, 0x0, 0x0,
+    0x7e, 0xff, 0xff, 0xc3, 0x0, 0x0, 0x0, 0x3,
+    0x55, 0x20, 0x0, 0x0,
+
+    /* U+00EA "ê" */
+    0x0, 0x0, 0x1, 0x22, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xef, 0xe4, 0x0, 0x0, 0x0, 0x1, 0xcf,
+    0x9e, 0xd2, 0x0, 0x0, 0x0, 0x9f, 0xb0, 0x7f,
+    0xb1, 0x0, 0x0, 0x2, 0x21, 0x0, 0x22, 0x10,
+    0x0, 0x0, 0x4, 0x9a, 0x96, 0x10, 0x0, 0x0,
+    0x2b, 0xff, 0xff, 0xfe, 0x40, 0x0, 0x1c, 0xfc,
+    0x41, 0x29, 0xfe, 0x30, 0x7, 0xfd, 0x10, 0x0,
+    0x9, 0xfa, 0x0, 0xcf, 0x70, 0x0, 0x0, 0x2f,
+    0xf1, 0x1f, 0xf6, 0x33, 0x33, 0x33, 0xef, 0x42,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x2f, 0xf8,
+    0x88, 0x88, 0x88, 0x88, 0x30, 0xef, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xf8, 0x0, 0x0, 0x2,
+    0xcb, 0x20, 0x5f, 0xe4, 0x0, 0x0, 0xaf, 0xc0,
+    0x0, 0xaf, 0xfa, 0x67, 0xcf, 0xe4, 0x0, 0x0,
+    0x7e, 0xff, 0xff, 0xc3, 0x0, 0x0, 0x0, 0x3,
+    0x55, 0x20, 0x0, 0x0,
+
+    /* U+00EB "ë" */
+    0x0, 0x1, 0x21, 0x1, 0x22, 0x0, 0x0, 0x0,
+    0xaf, 0x80, 0x4f, 0xe0, 0x0, 0x0, 0xa, 0xf8,
+    0x4, 0xfe, 0x0, 0x0, 0x0, 0x34, 0x20, 0x14,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0x9a, 0x96, 0x10, 0x0, 0x0,
+    0x2b, 0xff, 0xff, 0xfe, 0x40, 0x0, 0x1c, 0xfc,
+    0x41, 0x29, 0xfe, 0x30, 0x7, 0xfd, 0x10, 0x0,
+    0x9, 0xfa, 0x0, 0xcf, 0x70, 0x0, 0x0, 0x2f,
+    0xf1, 0x1f, 0xf6, 0x33, 0x33, 0x33, 0xef, 0x42,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x2f, 0xf8,
+    0x88, 0x88, 0x88, 0x88, 0x30, 0xef, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xf8, 0x0, 0x0, 0x2,
+    0xcb, 0x20, 0x5f, 0xe4, 0x0, 0x0, 0xaf, 0xc0,
+    0x0, 0xaf, 0xfa, 0x67, 0xcf, 0xe4, 0x0, 0x0,
+    0x7e, 0xff, 0xff, 0xc3, 0x0, 0x0, 0x0, 0x3,
+    0x55, 0x20, 0x0, 0x0,
+
+    /* U+00EC "ì" */
+    0x12, 0x21, 0x2, 0xef, 0x80, 0x4, 0xee, 0x20,
+    0x6, 0xe7, 0x0, 0x2, 0x20, 0x4, 0x63, 0x0,
+    0xaf, 0x70, 0xa, 0xf7, 0x0, 0xaf, 0x70, 0xa,
+    0xf7, 0x0, 0xaf, 0x70, 0xa, 0xf7, 0x0, 0xaf,
+    0x70, 0xa, 0xf7, 0x0, 0xaf, 0x70, 0xa, 0xf7,
+    0x0, 0xaf, 0x70, 0xa, 0xf7,
+
+    /* U+00ED "í" */
+    0x1, 0x22, 0x10, 0x8f, 0xd2, 0x1e, 0xe4, 0x7,
+    0xf7, 0x0, 0x22, 0x0, 0x4, 0x63, 0x0, 0xaf,
+    0x70, 0xa, 0xf7, 0x0, 0xaf, 0x70, 0xa, 0xf7,
+    0x0, 0xaf, 0x70, 0xa, 0xf7, 0x0, 0xaf, 0x70,
+    0xa, 0xf7, 0x0, 0xaf, 0x70, 0xa, 0xf7, 0x0,
+    0xaf, 0x70, 0xa, 0xf7, 0x0,
+
+    /* U+00EE "î" */
+    0x0, 0x22, 0x20, 0x0, 0x3e, 0xfe, 0x30, 0x1d,
+    0xf8, 0xfc, 0x1a, 0xf9, 0x9, 0xfa, 0x22, 0x10,
+    0x2, 0x20, 0x4, 0x63, 0x0, 0x0, 0xaf, 0x70,
+    0x0, 0xa, 0xf7, 0x0, 0x0, 0xaf, 0x70, 0x0,
+    0xa, 0xf7, 0x0, 0x0, 0xaf, 0x70, 0x0, 0xa,
+    0xf7, 0x0, 0x0, 0xaf, 0x70, 0x0, 0xa, 0xf7,
+    0x0, 0x0, 0xaf, 0x70, 0x0, 0xa, 0xf7, 0x0,
+    0x0, 0xaf, 0x70, 0x0, 0xa, 0xf7, 0x0,
+
+    /* U+00EF "ï" */
+    0x22, 0x10, 0x12, 0x1e, 0xf5, 0x8, 0xfa, 0xef,
+    0x50, 0x8f, 0xa3, 0x41, 0x2, 0x43, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0x63, 0x0, 0x0, 0xaf, 0x70,
+    0x0, 0xa, 0xf7, 0x0, 0x0, 0xaf, 0x70, 0x0,
+    0xa, 0xf7, 0x0, 0x0, 0xaf, 0x70, 0x0, 0xa,
+    0xf7, 0x0, 0x0, 0xaf, 0x70, 0x0, 0xa, 0xf7,
+    0x0, 0x0, 0xaf, 0x70, 0x0, 0xa, 0xf7, 0x0,
+    0x0, 0xaf, 0x70, 0x0, 0xa, 0xf7, 0x0,
+
+    /* U+00F0 "ð" */
+    0x0, 0x0, 0x22, 0x10, 0x1, 0x0, 0x0, 0x0,
+    0x18, 0xfc, 0x35, 0xc6, 0x0, 0x0, 0x0, 0x6,
+    0xff, 0xfa, 0x20, 0x0, 0x0, 0x17, 0xde, 0xfd,
+    0x20, 0x0, 0x0, 0x9, 0xe8, 0x27, 0xfb, 0x0,
+    0x0, 0x0, 0x12, 0x45, 0x3c, 0xf6, 0x0, 0x0,
+    0x19, 0xff, 0xff, 0xef, 0xe1, 0x0, 0xb, 0xfd,
+    0x75, 0x6d, 0xff, 0x70, 0x6, 0xfd, 0x20, 0x0,
+    0x1c, 0xfc, 0x0, 0xcf, 0x70, 0x0, 0x0, 0x4f,
+    0xf1, 0x1f, 0xf2, 0x0, 0x0, 0x1, 0xef, 0x42,
+    0xff, 0x10, 0x0, 0x0, 0xc, 0xf5, 0x2f, 0xf1,
+    0x0, 0x0, 0x0, 0xcf, 0x51, 0xff, 0x20, 0x0,
+    0x0, 0x1e, 0xf4, 0xc, 0xf7, 0x0, 0x0, 0x5,
+    0xfe, 0x10, 0x6f, 0xe3, 0x0, 0x2, 0xdf, 0x80,
+    0x0, 0xaf, 0xe9, 0x68, 0xef, 0xc1, 0x0, 0x0,
+    0x8e, 0xff, 0xff, 0x91, 0x0, 0x0, 0x0, 0x14,
+    0x54, 0x10, 0x0, 0x0,
+
+    /* U+00F1 "ñ" */
+    0x0, 0x0, 0x10, 0x0, 0x11, 0x0, 0x2, 0xbd,
+    0xb5, 0x2b, 0xc0, 0x0, 0xbe, 0x9d, 0xff, 0xf8,
+    0x0, 0x8, 0x60, 0x15, 0x96, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0x63, 0x5, 0x9a, 0x94,
+    0x0, 0x6f, 0x8b, 0xff, 0xff, 0xfa, 0x6, 0xfe,
+    0xe7, 0x33, 0x9f, 0xf4, 0x6f, 0xf4, 0x0, 0x0,
+    0xaf, 0x96, 0xfd, 0x10, 0x0, 0x7, 0xfa, 0x6f,
+    0xb0, 0x0, 0x0, 0x6f, 0xa6, 0xfb, 0x0, 0x0,
+    0x6, 0xfa, 0x6f, 0xb0, 0x0, 0x0, 0x6f, 0xa6,
+    0xfb, 0x0, 0x0, 0x6, 0xfa, 0x6f, 0xb0, 0x0,
+    0x0, 0x6f, 0xa6, 0xfb, 0x0, 0x0, 0x6, 0xfa,
+    0x6f, 0xb0, 0x0, 0x0, 0x6f, 0xa6, 0xfb, 0x0,
+    0x0, 0x6, 0xfa,
+
+    /* U+00F2 "ò" */
+    0x0, 0x1, 0x22, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x1c, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d,
+    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x22, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0x9a, 0x96, 0x10, 0x0, 0x0,
+    0x3c, 0xff, 0xff, 0xfe, 0x50, 0x0, 0x2d, 0xfc,
+    0x41, 0x39, 0xff, 0x40, 0x9, 0xfc, 0x10, 0x0,
+    0x9, 0xfc, 0x0, 0xef, 0x50, 0x0, 0x0, 0x2f,
+    0xf3, 0x2f, 0xf1, 0x0, 0x0, 0x0, 0xcf, 0x63,
+    0xfe, 0x10, 0x0, 0x0, 0xb, 0xf7, 0x3f, 0xe1,
+    0x0, 0x0, 0x0, 0xbf, 0x61, 0xff, 0x20, 0x0,
+    0x0, 0xd, 0xf5, 0xc, 0xf7, 0x0, 0x0, 0x3,
+    0xff, 0x10, 0x6f, 0xe3, 0x0, 0x1, 0xcf, 0xa0,
+    0x0, 0xbf, 0xe9, 0x68, 0xdf, 0xd2, 0x0, 0x1,
+    0x8e, 0xff, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x14,
+    0x54, 0x10, 0x0, 0x0,
+
+    /* U+00F3 "ó" */
+    0x0, 0x0, 0x0, 0x2, 0x21, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x21, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0x9a, 0x96, 0x10, 0x0, 0x0,
+    0x3c, 0xff, 0xff, 0xfe, 0x50, 0x0, 0x2d, 0xfc,
+    0x41, 0x39, 0xff, 0x40, 0x9, 0xfc, 0x10, 0x0,
+    0x9, 0xfc, 0x0, 0xef, 0x50, 0x0, 0x0, 0x2f,
+    0xf3, 0x2f, 0xf1, 0x0, 0x0, 0x0, 0xcf, 0x63,
+    0xfe, 0x10, 0x0, 0x0, 0xb, 0xf7, 0x3f, 0xe1,
+    0x0, 0x0, 0x0, 0xbf, 0x61, 0xff, 0x20, 0x0,
+    0x0, 0xd, 0xf5, 0xc, 0xf7, 0x0, 0x0, 0x3,
+    0xff, 0x10, 0x6f, 0xe3, 0x0, 0x1, 0xcf, 0xa0,
+    0x0, 0xbf, 0xe9, 0x68, 0xdf, 0xd2, 0x0, 0x1,
+    0x8e, 0xff, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x14,
+    0x54, 0x10, 0x0, 0x0,
+
+    /* U+00F4 "ô" */
+    0x0, 0x0, 0x1, 0x22, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xef, 0xe4, 0x0, 0x0, 0x0, 0x1, 0xcf,
+    0x8e, 0xd2, 0x0, 0x0, 0x0, 0x9f, 0xb0, 0x7f,
+    0xb1, 0x0, 0x0, 0x2, 0x21, 0x0, 0x22, 0x10,
+    0x0, 0x0, 0x5, 0x9a, 0x96, 0x10, 0x0, 0x0,
+    0x3c, 0xff, 0xff, 0xfe, 0x50, 0x0, 0x2d, 0xfc,
+    0x41, 0x39, 0xff, 0x40, 0x9, 0xfc, 0x10, 0x0,
+    0x9, 0xfc, 0x0, 0xef, 0x50, 0x0, 0x0, 0x2f,
+    0xf3, 0x2f, 0xf1, 0x0, 0x0, 0x0, 0xcf, 0x63,
+    0xfe, 0x10, 0x0, 0x0, 0xb, 0xf7, 0x3f, 0xe1,
+    0x0, 0x0, 0x0, 0xbf, 0x61, 0xff, 0x20, 0x0,
+    0x0, 0xd, 0xf5, 0xc, 0xf7, 0x0, 0x0, 0x3,
+    0xff, 0x10, 0x6f, 0xe3, 0x0, 0x1, 0xcf, 0xa0,
+    0x0, 0xbf, 0xe9, 0x68, 0xdf, 0xd2, 0x0, 0x1,
+    0x8e, 0xff, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x14,
+    0x54, 0x10, 0x0, 0x0,
+
+    /* U+00F5 "õ" */
+    0x0, 0x3, 0xbb, 0x61, 0x1c, 0x60, 0x0, 0x1,
+    0xde, 0xdf, 0xdd, 0xf4, 0x0, 0x0, 0x3d, 0x50,
+    0x5b, 0xd7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x59, 0xa9, 0x61, 0x0,
+    0x0, 0x3, 0xcf, 0xff, 0xff, 0xe5, 0x0, 0x2,
+    0xdf, 0xc4, 0x13, 0x9f, 0xf4, 0x0, 0x9f, 0xc1,
+    0x0, 0x0, 0x9f, 0xc0, 0xe, 0xf5, 0x0, 0x0,
+    0x2, 0xff, 0x32, 0xff, 0x10, 0x0, 0x0, 0xc,
+    0xf6, 0x3f, 0xe1, 0x0, 0x0, 0x0, 0xbf, 0x73,
+    0xfe, 0x10, 0x0, 0x0, 0xb, 0xf6, 0x1f, 0xf2,
+    0x0, 0x0, 0x0, 0xdf, 0x50, 0xcf, 0x70, 0x0,
+    0x0, 0x3f, 0xf1, 0x6, 0xfe, 0x30, 0x0, 0x1c,
+    0xfa, 0x0, 0xb, 0xfe, 0x96, 0x8d, 0xfd, 0x20,
+    0x0, 0x18, 0xef, 0xff, 0xfa, 0x10, 0x0, 0x0,
+    0x1, 0x45, 0x41, 0x0, 0x0,
+
+    /* U+00F6 "ö" */
+    0x0, 0x1, 0x21, 0x1, 0x22, 0x0, 0x0, 0x0,
+    0xaf, 0x80, 0x4f, 0xe0, 0x0, 0x0, 0xa, 0xf8,
+    0x4, 0xfe, 0x0, 0x0, 0x0, 0x34, 0x20, 0x14,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0x9a, 0x96, 0x10, 0x0, 0x0,
+    0x3c, 0xff, 0xff, 0xfe, 0x50, 0x0, 0x2d, 0xfc,
+    0x41, 0x39, 0xff, 0x40, 0x9, 0xfc, 0x10, 0x0,
+    0x9, 0xfc, 0x0, 0xef, 0x50, 0x0, 0x0, 0x2f,
+    0xf3, 0x2f, 0xf1, 0x0, 0x0, 0x0, 0xcf, 0x63,
+    0xfe, 0x10, 0x0, 0x0, 0xb, 0xf7, 0x3f, 0xe1,
+    0x0, 0x0, 0x0, 0xbf, 0x61, 0xff, 0x20, 0x0,
+    0x0, 0xd, 0xf5, 0xc, 0xf7, 0x0, 0x0, 0x3,
+    0xff, 0x10, 0x6f, 0xe3, 0x0, 0x1, 0xcf, 0xa0,
+    0x0, 0xbf, 0xe9, 0x68, 0xdf, 0xd2, 0x0, 0x1,
+    0x8e, 0xff, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x14,
+    0x54, 0x10, 0x0, 0x0,
+
+    /* U+00F7 "÷" */
+    0x0, 0x0, 0x3, 0x64, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x17, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x17,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x20, 0x0, 0x0,
+    0x23, 0x20, 0x0, 0x0, 0x0, 0x0, 0x9, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0x33, 0x0, 0x0, 0x0,
+
+    /* U+00F8 "ø" */
+    0x0, 0x1, 0x69, 0xa8, 0x40, 0x9a, 0x0, 0x5,
+    0xef, 0xff, 0xff, 0xdf, 0x60, 0x5, 0xff, 0x93,
+    0x14, 0xcf, 0xe1, 0x0, 0xdf, 0x90, 0x0, 0x1c,
+    0xff, 0x80, 0x3f, 0xe2, 0x0, 0xa, 0xe8, 0xfd,
+    0x6, 0xfc, 0x0, 0x6, 0xf6, 0x1f, 0xf1, 0x7f,
+    0xb0, 0x4, 0xe9, 0x0, 0xff, 0x27, 0xfb, 0x2,
+    0xdb, 0x10, 0xf, 0xf2, 0x5f, 0xc1, 0xbd, 0x20,
+    0x2, 0xff, 0x12, 0xff, 0xae, 0x50, 0x0, 0x7f,
+    0xc0, 0xb, 0xff, 0x80, 0x0, 0x3e, 0xf6, 0x0,
+    0x4f, 0xfd, 0x86, 0x9e, 0xfa, 0x0, 0xb, 0xda,
+    0xff, 0xff, 0xe7, 0x0, 0x1, 0xa3, 0x1, 0x45,
+    0x30, 0x0, 0x0,
+
+    /* U+00F9 "ù" */
+    0x0, 0x2, 0x22, 0x0, 0x0, 0x0, 0x0, 0x5f,
+    0xf4, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xb0, 0x0,
+    0x0, 0x0, 0x0, 0xae, 0x40, 0x0, 0x0, 0x0,
+    0x1, 0x21, 0x0, 0x2, 0x53, 0x0, 0x0, 0x3,
+    0x53, 0x7f, 0xa0, 0x0, 0x0, 0x7f, 0xa7, 0xfa,
+    0x0, 0x0, 0x7, 0xfa, 0x7f, 0xa0, 0x0, 0x0,
+    0x7f, 0xa7, 0xfa, 0x0, 0x0, 0x7, 0xfa, 0x7f,
+    0xa0, 0x0, 0x0, 0x7f, 0xa7, 0xfa, 0x0, 0x0,
+    0x7, 0xfa, 0x7f, 0xa0, 0x0, 0x0, 0x7f, 0xa7,
+    0xfa, 0x0, 0x0, 0x8, 0xfa, 0x6f, 0xb0, 0x0,
+    0x0, 0xbf, 0xa4, 0xfe, 0x30, 0x0, 0x6f, 0xfa,
+    0xd, 0xfe, 0x97, 0xbf, 0xcf, 0xa0, 0x3c, 0xff,
+    0xfe, 0x74, 0xfa, 0x0, 0x2, 0x54, 0x10, 0x1,
+    0x0,
+
+    /* U+00FA "ú" */
+    0x0, 0x0, 0x0, 0x22, 0x10, 0x0, 0x0, 0x0,
+    0x7f, 0xe3, 0x0, 0x0, 0x0, 0x1d, 0xf5, 0x0,
+    0x0, 0x0, 0x6, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x12, 0x0, 0x0, 0x2, 0x53, 0x0, 0x0, 0x3,
+    0x53, 0x7f, 0xa0, 0x0, 0x0, 0x7f, 0xa7, 0xfa,
+    0x0, 0x0, 0x7, 0xfa, 0x7f, 0xa0, 0x0, 0x0,
+    0x7f, 0xa7, 0xfa, 0x0, 0x0, 0x7, 0xfa, 0x7f,
+    0xa0, 0x0, 0x0, 0x7f, 0xa7, 0xfa, 0x0, 0x0,
+    0x7, 0xfa, 0x7f, 0xa0, 0x0, 0x0, 0x7f, 0xa7,
+    0xfa, 0x0, 0x0, 0x8, 0xfa, 0x6f, 0xb0, 0x0,
+    0x0, 0xbf, 0xa4, 0xfe, 0x30, 0x0, 0x6f, 0xfa,
+    0xd, 0xfe, 0x97, 0xbf, 0xcf, 0xa0, 0x3c, 0xff,
+    0xfe, 0x74, 0xfa, 0x0, 0x2, 0x54, 0x10, 0x1,
+    0x0,
+
+    /* U+00FB "û" */
+    0x0, 0x0, 0x22, 0x20, 0x0, 0x0, 0x0, 0x3e,
+    0xfe, 0x30, 0x0, 0x0, 0x1c, 0xf8, 0xed, 0x20,
+    0x0, 0x9, 0xfa, 0x7, 0xfb, 0x0, 0x0, 0x22,
+    0x10, 0x2, 0x20, 0x2, 0x53, 0x0, 0x0, 0x3,
+    0x53, 0x7f, 0xa0, 0x0, 0x0, 0x7f, 0xa7, 0xfa,
+    0x0, 0x0, 0x7, 0xfa, 0x7f, 0xa0, 0x0, 0x0,
+    0x7f, 0xa7, 0xfa, 0x0, 0x0, 0x7, 0xfa, 0x7f,
+    0xa0, 0x0, 0x0, 0x7f, 0xa7, 0xfa, 0x0, 0x0,
+    0x7, 0xfa, 0x7f, 0xa0, 0x0, 0x0, 0x7f, 0xa7,
+    0xfa, 0x0, 0x0, 0x8, 0xfa, 0x6f, 0xb0, 0x0,
+    0x0, 0xbf, 0xa4, 0xfe, 0x30, 0x0, 0x6f, 0xfa,
+    0xd, 0xfe, 0x97, 0xbf, 0xcf, 0xa0, 0x3c, 0xff,
+    0xfe, 0x74, 0xfa, 0x0, 0x2, 0x54, 0x10, 0x1,
+    0x0,
+
+    /* U+00FC "ü" */
+    0x0, 0x22, 0x10, 0x12, 0x20, 0x0, 0xb, 0xf7,
+    0x5, 0xfd, 0x0, 0x0, 0xbf, 0x70, 0x5f, 0xd0,
+    0x0, 0x3, 0x42, 0x1, 0x43, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0x53, 0x0, 0x0, 0x3,
+    0x53, 0x7f, 0xa0, 0x0, 0x0, 0x7f, 0xa7, 0xfa,
+    0x0, 0x0, 0x7, 0xfa, 0x7f, 0xa0, 0x0, 0x0,
+    0x7f, 0xa7, 0xfa, 0x0, 0x0, 0x7, 0xfa, 0x7f,
+    0xa0, 0x0, 0x0, 0x7f, 0xa7, 0xfa, 0x0, 0x0,
+    0x7, 0xfa, 0x7f, 0xa0, 0x0, 0x0, 0x7f, 0xa7,
+    0xfa, 0x0, 0x0, 0x8, 0xfa, 0x6f, 0xb0, 0x0,
+    0x0, 0xbf, 0xa4, 0xfe, 0x30, 0x0, 0x6f, 0xfa,
+    0xd, 0xfe, 0x97, 0xbf, 0xcf, 0xa0, 0x3c, 0xff,
+    0xfe, 0x74, 0xfa, 0x0, 0x2, 0x54, 0x10, 0x1,
+    0x0,
+
+    /* U+00FD "ý" */
+    0x0, 0x0, 0x0, 0x12, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0xcf, 0xb0, 0x0, 0x0, 0x0, 0x5, 0xfd,
+    0x10, 0x0, 0x0, 0x0, 0xb, 0xe3, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0x20, 0x0, 0x0, 0x35, 0x40,
+    0x0, 0x0, 0x2, 0x54, 0x5f, 0xe1, 0x0, 0x0,
+    0x9, 0xf7, 0xd, 0xf5, 0x0, 0x0, 0x1e, 0xf2,
+    0x8, 0xfa, 0x0, 0x0, 0x5f, 0xb0, 0x3, 0xfe,
+    0x20, 0x0, 0xbf, 0x50, 0x0, 0xcf, 0x60, 0x2,
+    0xee, 0x10, 0x0, 0x6f, 0xb0, 0x7, 0xf9, 0x0,
+    0x0, 0x1e, 0xe2, 0xc, 0xf4, 0x0, 0x0, 0xa,
+    0xf7, 0x3f, 0xd0, 0x0, 0x0, 0x4, 0xfc, 0x8f,
+    0x70, 0x0, 0x0, 0x0, 0xde, 0xde, 0x20, 0x0,
+    0x0, 0x0, 0x8f, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0x2e, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xe1,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0x90, 0x0, 0x0,
+    0x1, 0x3, 0xdf, 0x30, 0x0, 0x0, 0x9, 0xee,
+    0xf9, 0x0, 0x0, 0x0, 0x8, 0xfe, 0xa1, 0x0,
+    0x0, 0x0, 0x1, 0x22, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+00FE "þ" */
+    0x12, 0x20, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xb0,
+    0x59, 0x96, 0x10, 0x0, 0x6f, 0xcb, 0xff, 0xff,
+    0xe5, 0x0, 0x6f, 0xfe, 0x71, 0x28, 0xff, 0x30,
+    0x6f, 0xf6, 0x0, 0x0, 0x8f, 0xb0, 0x6f, 0xd1,
+    0x0, 0x0, 0x2f, 0xf1, 0x6f, 0x90, 0x0, 0x0,
+    0xd, 0xf4, 0x6f, 0x80, 0x0, 0x0, 0xc, 0xf5,
+    0x6f, 0x80, 0x0, 0x0, 0xc, 0xf5, 0x6f, 0xa0,
+    0x0, 0x0, 0x1e, 0xf3, 0x6f, 0xd1, 0x0, 0x0,
+    0x4f, 0xe0, 0x6f, 0xf8, 0x0, 0x1, 0xcf, 0x80,
+    0x6f, 0xff, 0xb6, 0x7d, 0xfc, 0x10, 0x6f, 0xb8,
+    0xff, 0xff, 0x91, 0x0, 0x6f, 0xb0, 0x15, 0x51,
+    0x0, 0x0, 0x6f, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0x5c, 0x80, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+00FF "ÿ" */
+    0x0, 0x2, 0x20, 0x2, 0x21, 0x0, 0x0, 0x3f,
+    0xe2, 0xc, 0xf6, 0x0, 0x0, 0x3f, 0xe2, 0xc,
+    0xf6, 0x0, 0x0, 0x14, 0x40, 0x3, 0x42, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x35, 0x30,
+    0x0, 0x0, 0x2, 0x54, 0x5f, 0xe1, 0x0, 0x0,
+    0x9, 0xf7, 0xe, 0xf5, 0x0, 0x0, 0x1e, 0xf2,
+    0x8, 0xfa, 0x0, 0x0, 0x5f, 0xb0, 0x3, 0xfe,
+    0x10, 0x0, 0xbf, 0x50, 0x0, 0xcf, 0x60, 0x2,
+    0xee, 0x10, 0x0, 0x6f, 0xb0, 0x7, 0xf9, 0x0,
+    0x0, 0x1e, 0xe2, 0xc, 0xf4, 0x0, 0x0, 0xa,
+    0xf7, 0x3f, 0xd0, 0x0, 0x0, 0x4, 0xfc, 0x8f,
+    0x70, 0x0, 0x0, 0x0, 0xde, 0xde, 0x20, 0x0,
+    0x0, 0x0, 0x8f, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0x3e, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xe1,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0x90, 0x0, 0x0,
+    0x1, 0x3, 0xdf, 0x30, 0x0, 0x0, 0x9, 0xee,
+    0xf9, 0x0, 0x0, 0x0, 0x8, 0xfe, 0xa1, 0x0,
+    0x0, 0x0, 0x1, 0x22, 0x0, 0x0, 0x0, 0x0,
+
+};
+
+static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
+    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
+    {.bitmap_index = 0, .adv_w = 107, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 0, .adv_w = 107, .box_w = 3, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 27, .adv_w = 136, .box_w = 7, .box_h = 7, .ofs_x = 1, .ofs_y = 11},
+    {.bitmap_index = 52, .adv_w = 214, .box_w = 13, .box_h = 19, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 176, .adv_w = 214, .box_w = 13, .box_h = 22, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 319, .adv_w = 341, .box_w = 19, .box_h = 19, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 500, .adv_w = 256, .box_w = 15, .box_h = 19, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 643, .adv_w = 73, .box_w = 3, .box_h = 7, .ofs_x = 1, .ofs_y = 11},
+    {.bitmap_index = 654, .adv_w = 128, .box_w = 6, .box_h = 24, .ofs_x = 1, .ofs_y = -6},
+    {.bitmap_index = 726, .adv_w = 128, .box_w = 7, .box_h = 24, .ofs_x = 1, .ofs_y = -6},
+    {.bitmap_index = 810, .adv_w = 149, .box_w = 9, .box_h = 8, .ofs_x = 0, .ofs_y = 10},
+    {.bitmap_index = 846, .adv_w = 224, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 2},
+    {.bitmap_index = 924, .adv_w = 107, .box_w = 3, .box_h = 7, .ofs_x = 2, .ofs_y = -4},
+    {.bitmap_index = 935, .adv_w = 128, .box_w = 8, .box_h = 3, .ofs_x = 0, .ofs_y = 5},
+    {.bitmap_index = 947, .adv_w = 107, .box_w = 3, .box_h = 3, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 952, .adv_w = 107, .box_w = 7, .box_h = 19, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 1019, .adv_w = 214, .box_w = 12, .box_h = 19, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 1133, .adv_w = 214, .box_w = 7, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 1196, .adv_w = 214, .box_w = 13, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1313, .adv_w = 214, .box_w = 12, .box_h = 19, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 1427, .adv_w = 214, .box_w = 13, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1544, .adv_w = 214, .box_w = 12, .box_h = 18, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 1652, .adv_w = 214, .box_w = 13, .box_h = 19, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 1776, .adv_w = 214, .box_w = 12, .box_h = 18, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 1884, .adv_w = 214, .box_w = 12, .box_h = 19, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 1998, .adv_w = 214, .box_w = 12, .box_h = 19, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 2112, .adv_w = 107, .box_w = 3, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2132, .adv_w = 107, .box_w = 3, .box_h = 17, .ofs_x = 2, .ofs_y = -4},
+    {.bitmap_index = 2158, .adv_w = 224, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 2},
+    {.bitmap_index = 2236, .adv_w = 224, .box_w = 12, .box_h = 8, .ofs_x = 1, .ofs_y = 4},
+    {.bitmap_index = 2284, .adv_w = 224, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 2},
+    {.bitmap_index = 2362, .adv_w = 214, .box_w = 12, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2470, .adv_w = 390, .box_w = 23, .box_h = 24, .ofs_x = 1, .ofs_y = -6},
+    {.bitmap_index = 2746, .adv_w = 256, .box_w = 16, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2890, .adv_w = 256, .box_w = 14, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3016, .adv_w = 277, .box_w = 16, .box_h = 19, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 3168, .adv_w = 277, .box_w = 16, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3312, .adv_w = 256, .box_w = 14, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3438, .adv_w = 235, .box_w = 13, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3555, .adv_w = 299, .box_w = 17, .box_h = 19, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 3717, .adv_w = 277, .box_w = 15, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3852, .adv_w = 107, .box_w = 3, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3879, .adv_w = 192, .box_w = 11, .box_h = 19, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 3984, .adv_w = 256, .box_w = 15, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4119, .adv_w = 214, .box_w = 12, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4227, .adv_w = 320, .box_w = 18, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4389, .adv_w = 277, .box_w = 15, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4524, .adv_w = 299, .box_w = 17, .box_h = 19, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 4686, .adv_w = 256, .box_w = 15, .box_h = 19, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 4829, .adv_w = 299, .box_w = 17, .box_h = 20, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 4999, .adv_w = 277, .box_w = 16, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5143, .adv_w = 256, .box_w = 14, .box_h = 19, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 5276, .adv_w = 235, .box_w = 15, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5411, .adv_w = 277, .box_w = 15, .box_h = 19, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 5554, .adv_w = 256, .box_w = 16, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5698, .adv_w = 362, .box_w = 23, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5905, .adv_w = 256, .box_w = 16, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6049, .adv_w = 256, .box_w = 16, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6193, .adv_w = 235, .box_w = 15, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6328, .adv_w = 107, .box_w = 6, .box_h = 23, .ofs_x = 1, .ofs_y = -5},
+    {.bitmap_index = 6397, .adv_w = 107, .box_w = 7, .box_h = 19, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 6464, .adv_w = 107, .box_w = 6, .box_h = 23, .ofs_x = 0, .ofs_y = -5},
+    {.bitmap_index = 6533, .adv_w = 180, .box_w = 11, .box_h = 10, .ofs_x = 0, .ofs_y = 8},
+    {.bitmap_index = 6588, .adv_w = 214, .box_w = 15, .box_h = 2, .ofs_x = -1, .ofs_y = -5},
+    {.bitmap_index = 6603, .adv_w = 128, .box_w = 5, .box_h = 4, .ofs_x = 1, .ofs_y = 14},
+    {.bitmap_index = 6613, .adv_w = 214, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 6704, .adv_w = 214, .box_w = 12, .box_h = 19, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 6818, .adv_w = 192, .box_w = 12, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 6902, .adv_w = 214, .box_w = 12, .box_h = 19, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 7016, .adv_w = 214, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 7107, .adv_w = 107, .box_w = 8, .box_h = 19, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 7183, .adv_w = 214, .box_w = 12, .box_h = 19, .ofs_x = 0, .ofs_y = -6},
+    {.bitmap_index = 7297, .adv_w = 214, .box_w = 11, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7396, .adv_w = 85, .box_w = 3, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7423, .adv_w = 85, .box_w = 5, .box_h = 24, .ofs_x = -1, .ofs_y = -6},
+    {.bitmap_index = 7483, .adv_w = 192, .box_w = 11, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7582, .adv_w = 85, .box_w = 3, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7609, .adv_w = 320, .box_w = 18, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7726, .adv_w = 214, .box_w = 11, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7798, .adv_w = 214, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 7889, .adv_w = 214, .box_w = 12, .box_h = 18, .ofs_x = 1, .ofs_y = -5},
+    {.bitmap_index = 7997, .adv_w = 214, .box_w = 12, .box_h = 18, .ofs_x = 0, .ofs_y = -5},
+    {.bitmap_index = 8105, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 8157, .adv_w = 192, .box_w = 12, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 8241, .adv_w = 107, .box_w = 7, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8301, .adv_w = 214, .box_w = 11, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 8378, .adv_w = 192, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8456, .adv_w = 277, .box_w = 18, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8573, .adv_w = 192, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8651, .adv_w = 192, .box_w = 12, .box_h = 19, .ofs_x = 0, .ofs_y = -6},
+    {.bitmap_index = 8765, .adv_w = 192, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8843, .adv_w = 128, .box_w = 8, .box_h = 24, .ofs_x = 0, .ofs_y = -6},
+    {.bitmap_index = 8939, .adv_w = 100, .box_w = 3, .box_h = 24, .ofs_x = 2, .ofs_y = -6},
+    {.bitmap_index = 8975, .adv_w = 128, .box_w = 8, .box_h = 24, .ofs_x = 0, .ofs_y = -6},
+    {.bitmap_index = 9071, .adv_w = 224, .box_w = 12, .box_h = 5, .ofs_x = 1, .ofs_y = 6},
+    {.bitmap_index = 9101, .adv_w = 107, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9101, .adv_w = 128, .box_w = 4, .box_h = 18, .ofs_x = 2, .ofs_y = -5},
+    {.bitmap_index = 9137, .adv_w = 214, .box_w = 11, .box_h = 23, .ofs_x = 1, .ofs_y = -5},
+    {.bitmap_index = 9264, .adv_w = 214, .box_w = 13, .box_h = 19, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 9388, .adv_w = 214, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 2},
+    {.bitmap_index = 9466, .adv_w = 214, .box_w = 14, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9592, .adv_w = 100, .box_w = 3, .box_h = 24, .ofs_x = 2, .ofs_y = -6},
+    {.bitmap_index = 9628, .adv_w = 214, .box_w = 13, .box_h = 24, .ofs_x = 0, .ofs_y = -6},
+    {.bitmap_index = 9784, .adv_w = 128, .box_w = 8, .box_h = 4, .ofs_x = 0, .ofs_y = 14},
+    {.bitmap_index = 9800, .adv_w = 283, .box_w = 18, .box_h = 19, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 9971, .adv_w = 142, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 8},
+    {.bitmap_index = 10016, .adv_w = 214, .box_w = 11, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 10082, .adv_w = 224, .box_w = 12, .box_h = 8, .ofs_x = 1, .ofs_y = 4},
+    {.bitmap_index = 10130, .adv_w = 128, .box_w = 8, .box_h = 3, .ofs_x = 0, .ofs_y = 5},
+    {.bitmap_index = 10142, .adv_w = 283, .box_w = 18, .box_h = 19, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 10313, .adv_w = 212, .box_w = 15, .box_h = 2, .ofs_x = -1, .ofs_y = 18},
+    {.bitmap_index = 10328, .adv_w = 154, .box_w = 8, .box_h = 7, .ofs_x = 1, .ofs_y = 11},
+    {.bitmap_index = 10356, .adv_w = 211, .box_w = 13, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10454, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 8},
+    {.bitmap_index = 10494, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 8},
+    {.bitmap_index = 10534, .adv_w = 128, .box_w = 5, .box_h = 4, .ofs_x = 2, .ofs_y = 14},
+    {.bitmap_index = 10544, .adv_w = 221, .box_w = 11, .box_h = 18, .ofs_x = 1, .ofs_y = -5},
+    {.bitmap_index = 10643, .adv_w = 206, .box_w = 13, .box_h = 23, .ofs_x = 0, .ofs_y = -5},
+    {.bitmap_index = 10793, .adv_w = 128, .box_w = 4, .box_h = 3, .ofs_x = 2, .ofs_y = 7},
+    {.bitmap_index = 10799, .adv_w = 128, .box_w = 6, .box_h = 6, .ofs_x = 1, .ofs_y = -5},
+    {.bitmap_index = 10817, .adv_w = 128, .box_w = 5, .box_h = 10, .ofs_x = 1, .ofs_y = 8},
+    {.bitmap_index = 10842, .adv_w = 140, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 8},
+    {.bitmap_index = 10887, .adv_w = 214, .box_w = 11, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 10953, .adv_w = 320, .box_w = 19, .box_h = 19, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 11134, .adv_w = 320, .box_w = 19, .box_h = 19, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 11315, .adv_w = 320, .box_w = 20, .box_h = 19, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 11505, .adv_w = 235, .box_w = 12, .box_h = 19, .ofs_x = 1, .ofs_y = -6},
+    {.bitmap_index = 11619, .adv_w = 256, .box_w = 16, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11795, .adv_w = 256, .box_w = 16, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11971, .adv_w = 256, .box_w = 16, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 12147, .adv_w = 256, .box_w = 16, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 12315, .adv_w = 256, .box_w = 16, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 12483, .adv_w = 256, .box_w = 16, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 12651, .adv_w = 384, .box_w = 23, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 12858, .adv_w = 277, .box_w = 16, .box_h = 23, .ofs_x = 1, .ofs_y = -5},
+    {.bitmap_index = 13042, .adv_w = 256, .box_w = 14, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 13196, .adv_w = 256, .box_w = 14, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 13350, .adv_w = 256, .box_w = 14, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 13504, .adv_w = 256, .box_w = 14, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 13651, .adv_w = 107, .box_w = 5, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 13706, .adv_w = 107, .box_w = 5, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 13761, .adv_w = 107, .box_w = 8, .box_h = 22, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 13849, .adv_w = 107, .box_w = 7, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 13923, .adv_w = 277, .box_w = 17, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 14076, .adv_w = 277, .box_w = 15, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 14234, .adv_w = 299, .box_w = 17, .box_h = 23, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 14430, .adv_w = 299, .box_w = 17, .box_h = 23, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 14626, .adv_w = 299, .box_w = 17, .box_h = 23, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 14822, .adv_w = 299, .box_w = 17, .box_h = 22, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 15009, .adv_w = 299, .box_w = 17, .box_h = 22, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 15196, .adv_w = 224, .box_w = 10, .box_h = 11, .ofs_x = 2, .ofs_y = 3},
+    {.bitmap_index = 15251, .adv_w = 299, .box_w = 17, .box_h = 19, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 15413, .adv_w = 277, .box_w = 15, .box_h = 23, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 15586, .adv_w = 277, .box_w = 15, .box_h = 23, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 15759, .adv_w = 277, .box_w = 15, .box_h = 23, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 15932, .adv_w = 277, .box_w = 15, .box_h = 22, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 16097, .adv_w = 256, .box_w = 16, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 16273, .adv_w = 256, .box_w = 15, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 16408, .adv_w = 235, .box_w = 13, .box_h = 19, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 16532, .adv_w = 214, .box_w = 13, .box_h = 19, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 16656, .adv_w = 214, .box_w = 13, .box_h = 19, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 16780, .adv_w = 214, .box_w = 13, .box_h = 19, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 16904, .adv_w = 214, .box_w = 13, .box_h = 18, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 17021, .adv_w = 214, .box_w = 13, .box_h = 19, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 17145, .adv_w = 214, .box_w = 13, .box_h = 19, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 17269, .adv_w = 341, .box_w = 21, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 17416, .adv_w = 192, .box_w = 12, .box_h = 18, .ofs_x = 0, .ofs_y = -5},
+    {.bitmap_index = 17524, .adv_w = 214, .box_w = 13, .box_h = 19, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 17648, .adv_w = 214, .box_w = 13, .box_h = 19, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 17772, .adv_w = 214, .box_w = 13, .box_h = 19, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 17896, .adv_w = 214, .box_w = 13, .box_h = 19, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 18020, .adv_w = 107, .box_w = 5, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18065, .adv_w = 107, .box_w = 5, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 18110, .adv_w = 107, .box_w = 7, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18173, .adv_w = 107, .box_w = 7, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18236, .adv_w = 214, .box_w = 13, .box_h = 19, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 18360, .adv_w = 214, .box_w = 11, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 18459, .adv_w = 214, .box_w = 13, .box_h = 19, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 18583, .adv_w = 214, .box_w = 13, .box_h = 19, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 18707, .adv_w = 214, .box_w = 13, .box_h = 19, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 18831, .adv_w = 214, .box_w = 13, .box_h = 18, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 18948, .adv_w = 214, .box_w = 13, .box_h = 19, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 19072, .adv_w = 211, .box_w = 13, .box_h = 11, .ofs_x = 0, .ofs_y = 3},
+    {.bitmap_index = 19144, .adv_w = 235, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 19235, .adv_w = 214, .box_w = 11, .box_h = 19, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 19340, .adv_w = 214, .box_w = 11, .box_h = 19, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 19445, .adv_w = 214, .box_w = 11, .box_h = 19, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 19550, .adv_w = 214, .box_w = 11, .box_h = 19, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 19655, .adv_w = 192, .box_w = 12, .box_h = 24, .ofs_x = 0, .ofs_y = -6},
+    {.bitmap_index = 19799, .adv_w = 214, .box_w = 12, .box_h = 23, .ofs_x = 1, .ofs_y = -5},
+    {.bitmap_index = 19937, .adv_w = 192, .box_w = 12, .box_h = 24, .ofs_x = 0, .ofs_y = -6}
+};
+
+static const lv_font_fmt_txt_cmap_t cmaps[] =
+{
+    {
+        .range_start = 32, .range_length = 95, .glyph_id_start = 1,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 160, .range_length = 96, .glyph_id_start = 96,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    }
+};
+
+static const lv_font_fmt_txt_dsc_t font_dsc = {
+    .glyph_bitmap = glyph_bitmap,
+    .glyph_dsc = glyph_dsc,
+    .cmaps = cmaps,
+    .kern_dsc = NULL,
+    .kern_scale = 0,
+    .cmap_num = 2,
+    .bpp = 4,
+    .kern_classes = 0,
+    .bitmap_format = 0,
+};
+
+extern const lv_font_t lv_font_montserrat_14;
+
+const lv_font_t Arial_24 = {
+    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
+    .line_height = 27,          /*The maximum line height required by the font*/
+    .base_line = 5,             /*Baseline measured from the bottom of the line*/
+    .subpx = LV_FONT_SUBPX_NONE,
+    .underline_position = -2,
+    .underline_thickness = 2,
+    .dsc = &font_dsc,          /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
+    .fallback = &lv_font_montserrat_14,
+    .user_data = NULL,
+};
+
+#endif /*#if ARIAL_24*/
@@ -0,0 +1,5005 @@
+/*******************************************************************************
+ * Size: 32 px
+ * Bpp: 4
+ * Opts: skaalattu Arial_70.c:stä (tools/font_build.py, ei TTF:ää)
+ ******************************************************************************/
+
+#include "lvgl.h"
+
+#ifndef ARIAL_32
+#define ARIAL_32 1
+#endif
+
+#if ARIAL_32
+
+/*Store the image of the glyphs*/
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
+    /* U+0020 " " */
+
+    /* U+0021 "!" */
+    0x3d, 0xdd, 0x34, 0xff, 0xf4, 0x4f, 0xff, 0x44,
+    0xff, 0xf4, 0x4f, 0xff, 0x44, 0xff, 0xf4, 0x3e,
+    0xff, 0x32, 0xef, 0xe2, 0x2d, 0xfe, 0x11, 0xdf,
+    0xe0, 0xc, 0xfd, 0x0, 0xcf, 0xc0, 0xb, 0xfb,
+    0x0, 0xaf, 0xa0, 0x9, 0xf9, 0x0, 0x8f, 0x80,
+    0x7, 0xf7, 0x0, 0x25, 0x20, 0x0, 0x0, 0x1,
+    0x33, 0x30, 0x3e, 0xfe, 0x23, 0xef, 0xe2, 0x3e,
+    0xfe, 0x20,
+
+    /* U+0022 "\"" */
+    0x6b, 0xb7, 0x4, 0xbb, 0x90, 0x8f, 0xfa, 0x5,
+    0xff, 0xd1, 0x8f, 0xfa, 0x5, 0xff, 0xd1, 0x8f,
+    0xfa, 0x5, 0xff, 0xd1, 0x7f, 0xf9, 0x4, 0xff,
+    0xb0, 0x4f, 0xf7, 0x2, 0xef, 0x90, 0x2e, 0xf4,
+    0x1, 0xdf, 0x70, 0x1c, 0xf2, 0x0, 0xbf, 0x40,
+    0x4, 0x51, 0x0, 0x36, 0x10,
+
+    /* U+0023 "#" */
+    0x0, 0x0, 0x0, 0x35, 0x30, 0x0, 0x2, 0x55,
+    0x0, 0x0, 0x0, 0x0, 0xbf, 0x90, 0x0, 0x7,
+    0xfd, 0x0, 0x0, 0x0, 0x1, 0xef, 0x60, 0x0,
+    0xa, 0xfa, 0x0, 0x0, 0x0, 0x2, 0xff, 0x30,
+    0x0, 0x1c, 0xf7, 0x0, 0x0, 0x0, 0x5, 0xfd,
+    0x20, 0x0, 0x2e, 0xf4, 0x0, 0x0, 0x0, 0x8,
+    0xfc, 0x0, 0x0, 0x4f, 0xf2, 0x0, 0x0, 0x0,
+    0xb, 0xf9, 0x0, 0x0, 0x7f, 0xd1, 0x0, 0x57,
+    0x77, 0x7e, 0xfb, 0x77, 0x77, 0xcf, 0xd7, 0x73,
+    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf6, 0x8c, 0xcc, 0xef, 0xfc, 0xcc, 0xcd, 0xff,
+    0xdc, 0xc5, 0x0, 0x0, 0x8f, 0xc0, 0x0, 0x4,
+    0xfe, 0x20, 0x0, 0x0, 0x0, 0xcf, 0x90, 0x0,
+    0x8, 0xfc, 0x10, 0x0, 0x0, 0x1, 0xef, 0x60,
+    0x0, 0xa, 0xfa, 0x0, 0x0, 0x0, 0x3, 0xef,
+    0x30, 0x0, 0xe, 0xf6, 0x0, 0x0, 0x0, 0x6,
+    0xfe, 0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0, 0x7b,
+    0xbd, 0xfe, 0xbb, 0xbb, 0xcf, 0xfb, 0xbb, 0xb4,
+    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf6, 0x69, 0xaf, 0xfb, 0x99, 0x99, 0xef, 0xc9,
+    0x99, 0x93, 0x0, 0x3f, 0xf2, 0x0, 0x0, 0xef,
+    0x60, 0x0, 0x0, 0x0, 0x6f, 0xe0, 0x0, 0x3,
+    0xfe, 0x30, 0x0, 0x0, 0x0, 0xaf, 0xa0, 0x0,
+    0x6, 0xfe, 0x10, 0x0, 0x0, 0x1, 0xcf, 0x80,
+    0x0, 0x8, 0xfc, 0x0, 0x0, 0x0, 0x2, 0xef,
+    0x50, 0x0, 0xc, 0xf9, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0x20, 0x0, 0x1d, 0xf6, 0x0, 0x0, 0x0,
+    0x1, 0x43, 0x0, 0x0, 0x13, 0x41, 0x0, 0x0,
+    0x0,
+
+    /* U+0024 "$" */
+    0x0, 0x0, 0x0, 0x1, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2c, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x25, 0x8e, 0xc7, 0x30, 0x0, 0x0,
+    0x0, 0x19, 0xef, 0xff, 0xff, 0xeb, 0x30, 0x0,
+    0x1, 0xbf, 0xff, 0xdf, 0xee, 0xff, 0xe4, 0x0,
+    0x8, 0xff, 0xc3, 0x2e, 0x91, 0xaf, 0xfc, 0x10,
+    0x2d, 0xfe, 0x20, 0x2e, 0x90, 0x1c, 0xff, 0x50,
+    0x4f, 0xf9, 0x0, 0x2e, 0x90, 0x6, 0xff, 0x80,
+    0x5f, 0xf7, 0x0, 0x2e, 0x90, 0x1, 0x53, 0x10,
+    0x5f, 0xf8, 0x0, 0x2e, 0x90, 0x0, 0x0, 0x0,
+    0x2e, 0xfe, 0x10, 0x2e, 0x90, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xc3, 0x2e, 0x90, 0x0, 0x0, 0x0,
+    0x3, 0xdf, 0xfe, 0xcf, 0xb2, 0x0, 0x0, 0x0,
+    0x0, 0x3b, 0xff, 0xff, 0xfd, 0xa5, 0x10, 0x0,
+    0x0, 0x1, 0x4b, 0xef, 0xff, 0xff, 0xc3, 0x0,
+    0x0, 0x0, 0x0, 0x2e, 0xdc, 0xff, 0xfd, 0x20,
+    0x0, 0x0, 0x0, 0x2e, 0x90, 0x5d, 0xff, 0x90,
+    0x0, 0x0, 0x0, 0x2e, 0x90, 0x3, 0xef, 0xe0,
+    0x0, 0x0, 0x0, 0x2e, 0x90, 0x0, 0xbf, 0xf3,
+    0x6b, 0xc1, 0x0, 0x2e, 0x90, 0x0, 0x9f, 0xf4,
+    0xbf, 0xf4, 0x0, 0x2e, 0x90, 0x0, 0xaf, 0xf3,
+    0x8f, 0xfa, 0x0, 0x2e, 0x90, 0x2, 0xdf, 0xe1,
+    0x3e, 0xff, 0x50, 0x2e, 0x90, 0x19, 0xff, 0xa0,
+    0x8, 0xff, 0xe8, 0x5e, 0xa4, 0xbf, 0xfe, 0x20,
+    0x1, 0x9f, 0xff, 0xef, 0xff, 0xff, 0xe4, 0x0,
+    0x0, 0x5, 0xcf, 0xff, 0xff, 0xea, 0x20, 0x0,
+    0x0, 0x0, 0x1, 0x5e, 0xb3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2e, 0x90, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2e, 0x90, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0x20, 0x0, 0x0, 0x0,
+
+    /* U+0025 "%" */
+    0x0, 0x0, 0x35, 0x41, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x45, 0x20, 0x0, 0x0, 0x0, 0x2b, 0xef,
+    0xfd, 0x60, 0x0, 0x0, 0x0, 0x3, 0xef, 0x30,
+    0x0, 0x0, 0x1, 0xcf, 0xea, 0xcf, 0xf6, 0x0,
+    0x0, 0x0, 0x9, 0xfa, 0x0, 0x0, 0x0, 0x7,
+    0xfe, 0x20, 0x8, 0xfe, 0x10, 0x0, 0x0, 0x3e,
+    0xe2, 0x0, 0x0, 0x0, 0x1c, 0xf9, 0x0, 0x2,
+    0xef, 0x60, 0x0, 0x0, 0xaf, 0x90, 0x0, 0x0,
+    0x0, 0x2e, 0xf6, 0x0, 0x0, 0xdf, 0x80, 0x0,
+    0x3, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x2f, 0xf5,
+    0x0, 0x0, 0xcf, 0x90, 0x0, 0xa, 0xf9, 0x0,
+    0x0, 0x0, 0x0, 0x2e, 0xf5, 0x0, 0x0, 0xdf,
+    0x90, 0x0, 0x3f, 0xe2, 0x0, 0x0, 0x0, 0x0,
+    0x2d, 0xf6, 0x0, 0x1, 0xdf, 0x70, 0x0, 0xbf,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfa, 0x0,
+    0x4, 0xef, 0x40, 0x4, 0xfe, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xff, 0x61, 0x2b, 0xfc, 0x0,
+    0xb, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xfd, 0xef, 0xe3, 0x0, 0x5f, 0xe1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x17, 0xdf, 0xea,
+    0x20, 0x1, 0xbf, 0x70, 0x0, 0x0, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfd,
+    0x10, 0x2, 0xae, 0xfe, 0xa2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1c, 0xf7, 0x0, 0x2d, 0xfe,
+    0xde, 0xfd, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xd1, 0x0, 0x9f, 0xd4, 0x3, 0xcf, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0x60, 0x1,
+    0xef, 0x70, 0x0, 0x5f, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xfd, 0x10, 0x3, 0xff, 0x30, 0x0,
+    0x2e, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xf6,
+    0x0, 0x5, 0xff, 0x30, 0x0, 0x2d, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xc1, 0x0, 0x4, 0xff,
+    0x30, 0x0, 0x2d, 0xf7, 0x0, 0x0, 0x0, 0x1,
+    0xdf, 0x60, 0x0, 0x2, 0xff, 0x40, 0x0, 0x2e,
+    0xf5, 0x0, 0x0, 0x0, 0x7, 0xfc, 0x0, 0x0,
+    0x1, 0xdf, 0x80, 0x0, 0x6f, 0xf2, 0x0, 0x0,
+    0x0, 0x2d, 0xf5, 0x0, 0x0, 0x0, 0x8f, 0xe6,
+    0x25, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x8f, 0xc1,
+    0x0, 0x0, 0x0, 0x1b, 0xff, 0xef, 0xfc, 0x10,
+    0x0, 0x0, 0x1, 0xce, 0x40, 0x0, 0x0, 0x0,
+    0x1, 0x7c, 0xec, 0x71, 0x0,
+
+    /* U+0026 "&" */
+    0x0, 0x0, 0x0, 0x3, 0x44, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xce, 0xff, 0xeb,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
+    0xff, 0xff, 0xd3, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xff, 0xd5, 0x12, 0x9f, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0x60, 0x0, 0x1c, 0xff, 0x20,
+    0x0, 0x0, 0x0, 0xb, 0xfe, 0x30, 0x0, 0xa,
+    0xff, 0x30, 0x0, 0x0, 0x0, 0xa, 0xff, 0x60,
+    0x0, 0xb, 0xff, 0x20, 0x0, 0x0, 0x0, 0x6,
+    0xff, 0xd2, 0x0, 0x4f, 0xfc, 0x10, 0x0, 0x0,
+    0x0, 0x1, 0xdf, 0xfb, 0x15, 0xef, 0xe4, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xdf, 0xfe,
+    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0xff, 0xc4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7d, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1b, 0xff, 0xfe, 0xff, 0xd1, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xcf, 0xfd, 0x43, 0xef, 0xfb,
+    0x10, 0xa, 0x73, 0x0, 0xa, 0xff, 0xc1, 0x0,
+    0x5e, 0xff, 0x80, 0x3f, 0xfc, 0x10, 0x3f, 0xfe,
+    0x20, 0x0, 0x7, 0xff, 0xe5, 0x8f, 0xf9, 0x0,
+    0x7f, 0xf9, 0x0, 0x0, 0x0, 0xaf, 0xfe, 0xef,
+    0xe4, 0x0, 0x9f, 0xf7, 0x0, 0x0, 0x0, 0x1c,
+    0xff, 0xff, 0xb0, 0x0, 0x9f, 0xf8, 0x0, 0x0,
+    0x0, 0x3, 0xef, 0xff, 0x40, 0x0, 0x5f, 0xfd,
+    0x10, 0x0, 0x0, 0x1, 0xcf, 0xff, 0x90, 0x0,
+    0x1d, 0xff, 0x80, 0x0, 0x0, 0x2a, 0xff, 0xff,
+    0xf7, 0x0, 0x6, 0xff, 0xf9, 0x32, 0x37, 0xdf,
+    0xfd, 0xbf, 0xff, 0x81, 0x0, 0x8f, 0xff, 0xee,
+    0xef, 0xff, 0xc3, 0x1b, 0xff, 0xf5, 0x0, 0x5,
+    0xdf, 0xff, 0xff, 0xe8, 0x10, 0x1, 0xaf, 0x91,
+    0x0, 0x0, 0x3, 0x67, 0x64, 0x0, 0x0, 0x0,
+    0x5, 0x10,
+
+    /* U+0027 "'" */
+    0x6b, 0xb6, 0x9f, 0xf9, 0x9f, 0xf9, 0x9f, 0xf9,
+    0x8f, 0xf8, 0x5f, 0xf6, 0x3f, 0xf3, 0x2e, 0xe1,
+    0x5, 0x50,
+
+    /* U+0028 "(" */
+    0x0, 0x0, 0x0, 0x13, 0x10, 0x0, 0x0, 0x1c,
+    0xd3, 0x0, 0x0, 0x9, 0xf9, 0x0, 0x0, 0x4,
+    0xfd, 0x20, 0x0, 0x1, 0xcf, 0x80, 0x0, 0x0,
+    0x6f, 0xe2, 0x0, 0x0, 0x1d, 0xf9, 0x0, 0x0,
+    0x5, 0xff, 0x40, 0x0, 0x0, 0xbf, 0xe0, 0x0,
+    0x0, 0x3e, 0xfa, 0x0, 0x0, 0x6, 0xff, 0x60,
+    0x0, 0x0, 0x9f, 0xf3, 0x0, 0x0, 0xb, 0xff,
+    0x10, 0x0, 0x1, 0xdf, 0xe0, 0x0, 0x0, 0x2d,
+    0xfd, 0x0, 0x0, 0x2, 0xef, 0xc0, 0x0, 0x0,
+    0x2e, 0xfd, 0x0, 0x0, 0x1, 0xdf, 0xd0, 0x0,
+    0x0, 0x1c, 0xff, 0x0, 0x0, 0x0, 0xbf, 0xf2,
+    0x0, 0x0, 0x8, 0xff, 0x40, 0x0, 0x0, 0x5f,
+    0xf7, 0x0, 0x0, 0x2, 0xdf, 0xb0, 0x0, 0x0,
+    0xa, 0xfe, 0x10, 0x0, 0x0, 0x4f, 0xf6, 0x0,
+    0x0, 0x0, 0xcf, 0xb0, 0x0, 0x0, 0x4, 0xfe,
+    0x30, 0x0, 0x0, 0xb, 0xf9, 0x0, 0x0, 0x0,
+    0x3e, 0xe3, 0x0, 0x0, 0x0, 0x8f, 0xa0, 0x0,
+    0x0, 0x1, 0xad, 0x30,
+
+    /* U+0029 ")" */
+    0x2, 0x20, 0x0, 0x0, 0x0, 0x9e, 0x50, 0x0,
+    0x0, 0x3, 0xee, 0x20, 0x0, 0x0, 0x9, 0xfa,
+    0x0, 0x0, 0x0, 0x2e, 0xf5, 0x0, 0x0, 0x0,
+    0x9f, 0xc1, 0x0, 0x0, 0x3, 0xff, 0x50, 0x0,
+    0x0, 0xc, 0xfb, 0x0, 0x0, 0x0, 0x7f, 0xe3,
+    0x0, 0x0, 0x3, 0xff, 0x80, 0x0, 0x0, 0x1e,
+    0xfc, 0x10, 0x0, 0x0, 0xbf, 0xe2, 0x0, 0x0,
+    0x9, 0xff, 0x30, 0x0, 0x0, 0x8f, 0xf5, 0x0,
+    0x0, 0x7, 0xff, 0x70, 0x0, 0x0, 0x6f, 0xf7,
+    0x0, 0x0, 0x6, 0xff, 0x70, 0x0, 0x0, 0x7f,
+    0xf6, 0x0, 0x0, 0x8, 0xff, 0x50, 0x0, 0x0,
+    0xaf, 0xf3, 0x0, 0x0, 0xc, 0xfd, 0x10, 0x0,
+    0x1, 0xff, 0xb0, 0x0, 0x0, 0x5f, 0xf6, 0x0,
+    0x0, 0x9, 0xfe, 0x20, 0x0, 0x0, 0xef, 0xa0,
+    0x0, 0x0, 0x5f, 0xe4, 0x0, 0x0, 0xb, 0xfa,
+    0x0, 0x0, 0x4, 0xef, 0x30, 0x0, 0x0, 0xaf,
+    0x90, 0x0, 0x0, 0x4f, 0xd1, 0x0, 0x0, 0x1a,
+    0xd4, 0x0, 0x0, 0x0,
+
+    /* U+002A "*" */
+    0x0, 0x0, 0x55, 0x10, 0x0, 0x0, 0x0, 0xe,
+    0xf4, 0x0, 0x0, 0x0, 0x0, 0xde, 0x30, 0x0,
+    0x6, 0xa4, 0x1c, 0xe2, 0x38, 0xa0, 0xbf, 0xfc,
+    0xde, 0xbf, 0xff, 0x25, 0xac, 0xef, 0xff, 0xdb,
+    0x71, 0x0, 0x1a, 0xff, 0xd3, 0x0, 0x0, 0x7,
+    0xfd, 0xaf, 0xb1, 0x0, 0x5, 0xef, 0x42, 0xdf,
+    0x90, 0x0, 0x4d, 0xa0, 0x6, 0xe8, 0x0, 0x0,
+    0x21, 0x0, 0x3, 0x0, 0x0,
+
+    /* U+002B "+" */
+    0x0, 0x0, 0x0, 0x1a, 0xb7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2d, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2d, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2d, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2d, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2d, 0xfa, 0x0, 0x0, 0x0,
+    0x2a, 0xaa, 0xaa, 0xbe, 0xfe, 0xaa, 0xaa, 0xa9,
+    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0x3e, 0xee, 0xee, 0xef, 0xff, 0xee, 0xee, 0xed,
+    0x0, 0x0, 0x0, 0x2d, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2d, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2d, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2d, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2d, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2d, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x15, 0x53, 0x0, 0x0, 0x0,
+
+    /* U+002C "," */
+    0x13, 0x33, 0x3, 0xef, 0xe1, 0x3e, 0xfe, 0x13,
+    0xef, 0xe1, 0x0, 0x9e, 0x10, 0xc, 0xd0, 0x5,
+    0xe9, 0x2, 0xdc, 0x10, 0x4, 0x10, 0x0,
+
+    /* U+002D "-" */
+    0x19, 0xaa, 0xaa, 0xaa, 0xa6, 0x1e, 0xff, 0xff,
+    0xff, 0xfa, 0x1e, 0xff, 0xff, 0xff, 0xfa, 0x2,
+    0x22, 0x22, 0x22, 0x21,
+
+    /* U+002E "." */
+    0x13, 0x33, 0x3, 0xef, 0xe2, 0x3e, 0xfe, 0x23,
+    0xef, 0xe2,
+
+    /* U+002F "/" */
+    0x0, 0x0, 0x0, 0x13, 0x20, 0x0, 0x0, 0x8,
+    0xea, 0x0, 0x0, 0x0, 0xcf, 0x70, 0x0, 0x0,
+    0x2f, 0xe3, 0x0, 0x0, 0x6, 0xfc, 0x10, 0x0,
+    0x0, 0xaf, 0x90, 0x0, 0x0, 0xe, 0xf5, 0x0,
+    0x0, 0x3, 0xfe, 0x20, 0x0, 0x0, 0x8f, 0xb0,
+    0x0, 0x0, 0xc, 0xf7, 0x0, 0x0, 0x2, 0xef,
+    0x30, 0x0, 0x0, 0x5f, 0xe0, 0x0, 0x0, 0x9,
+    0xfa, 0x0, 0x0, 0x1, 0xdf, 0x50, 0x0, 0x0,
+    0x3f, 0xf1, 0x0, 0x0, 0x7, 0xfc, 0x0, 0x0,
+    0x0, 0xbf, 0x80, 0x0, 0x0, 0x2e, 0xf3, 0x0,
+    0x0, 0x5, 0xfd, 0x10, 0x0, 0x0, 0x9f, 0xa0,
+    0x0, 0x0, 0x1d, 0xf6, 0x0, 0x0, 0x3, 0xfe,
+    0x20, 0x0, 0x0, 0x7f, 0xc1, 0x0, 0x0, 0xb,
+    0xf8, 0x0, 0x0, 0x0, 0x67, 0x20, 0x0, 0x0,
+    0x0,
+
+    /* U+0030 "0" */
+    0x0, 0x0, 0x27, 0xbd, 0xca, 0x51, 0x0, 0x0,
+    0x0, 0x5, 0xef, 0xff, 0xff, 0xfc, 0x20, 0x0,
+    0x0, 0x6f, 0xfe, 0xb7, 0x8d, 0xff, 0xd2, 0x0,
+    0x2, 0xdf, 0xe5, 0x0, 0x1, 0xaf, 0xf9, 0x0,
+    0x8, 0xff, 0x70, 0x0, 0x0, 0x1c, 0xfe, 0x20,
+    0x1c, 0xfe, 0x10, 0x0, 0x0, 0x6, 0xff, 0x70,
+    0x3f, 0xfb, 0x0, 0x0, 0x0, 0x2, 0xef, 0xb0,
+    0x5f, 0xf8, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xf0,
+    0x8f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf1,
+    0x9f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf3,
+    0x9f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf4,
+    0xaf, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf4,
+    0xaf, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf4,
+    0x9f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf3,
+    0x8f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf2,
+    0x7f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf1,
+    0x4f, 0xf8, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xd0,
+    0x2e, 0xfc, 0x0, 0x0, 0x0, 0x3, 0xff, 0xa0,
+    0xb, 0xff, 0x20, 0x0, 0x0, 0x8, 0xff, 0x50,
+    0x5, 0xff, 0xa1, 0x0, 0x0, 0x3e, 0xfd, 0x10,
+    0x1, 0xbf, 0xfa, 0x20, 0x15, 0xdf, 0xf6, 0x0,
+    0x0, 0x3d, 0xff, 0xed, 0xdf, 0xff, 0x80, 0x0,
+    0x0, 0x2, 0xaf, 0xff, 0xff, 0xe6, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0x57, 0x64, 0x0, 0x0, 0x0,
+
+    /* U+0031 "1" */
+    0x0, 0x0, 0x0, 0x1, 0x10, 0x0, 0x0, 0x3,
+    0xdc, 0x0, 0x0, 0x1, 0xcf, 0xd0, 0x0, 0x1,
+    0xaf, 0xfd, 0x0, 0x2, 0xbf, 0xff, 0xd0, 0x5,
+    0xdf, 0xff, 0xfd, 0x3b, 0xff, 0xfa, 0xef, 0xd8,
+    0xff, 0xe6, 0x1d, 0xfd, 0x8e, 0x91, 0x0, 0xdf,
+    0xd3, 0x20, 0x0, 0xd, 0xfd, 0x0, 0x0, 0x0,
+    0xdf, 0xd0, 0x0, 0x0, 0xd, 0xfd, 0x0, 0x0,
+    0x0, 0xdf, 0xd0, 0x0, 0x0, 0xd, 0xfd, 0x0,
+    0x0, 0x0, 0xdf, 0xd0, 0x0, 0x0, 0xd, 0xfd,
+    0x0, 0x0, 0x0, 0xdf, 0xd0, 0x0, 0x0, 0xd,
+    0xfd, 0x0, 0x0, 0x0, 0xdf, 0xd0, 0x0, 0x0,
+    0xd, 0xfd, 0x0, 0x0, 0x0, 0xdf, 0xd0, 0x0,
+    0x0, 0xd, 0xfd, 0x0, 0x0, 0x0, 0xdf, 0xd0,
+    0x0, 0x0, 0xd, 0xfd,
+
+    /* U+0032 "2" */
+    0x0, 0x0, 0x4, 0x9c, 0xdd, 0xb8, 0x30, 0x0,
+    0x0, 0x0, 0x2b, 0xff, 0xff, 0xff, 0xfe, 0x91,
+    0x0, 0x0, 0x2c, 0xff, 0xe9, 0x77, 0xbe, 0xff,
+    0xa0, 0x0, 0x8, 0xff, 0xb2, 0x0, 0x0, 0x4d,
+    0xff, 0x50, 0x2, 0xef, 0xe1, 0x0, 0x0, 0x0,
+    0x5f, 0xfc, 0x0, 0x4f, 0xf9, 0x0, 0x0, 0x0,
+    0x1, 0xdf, 0xf0, 0x5, 0xce, 0x70, 0x0, 0x0,
+    0x0, 0x1c, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xdf, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2d, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1b, 0xff, 0xb1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1a, 0xff, 0xd2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1b, 0xff, 0xd3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2b, 0xff, 0xd3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4d, 0xff, 0xc2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5e, 0xff, 0xb1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6e, 0xff, 0x91, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6e, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4e, 0xfe, 0x60, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1c, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0xfb, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xbb, 0x11, 0xcf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf1, 0x1e, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x10,
+
+    /* U+0033 "3" */
+    0x0, 0x0, 0x49, 0xcd, 0xc9, 0x40, 0x0, 0x0,
+    0x0, 0x1a, 0xff, 0xff, 0xff, 0xfb, 0x20, 0x0,
+    0x1, 0xbf, 0xfd, 0x97, 0x8d, 0xff, 0xd2, 0x0,
+    0x7, 0xff, 0xb2, 0x0, 0x1, 0xaf, 0xf9, 0x0,
+    0x1d, 0xfe, 0x20, 0x0, 0x0, 0x2d, 0xfe, 0x10,
+    0x3f, 0xfa, 0x0, 0x0, 0x0, 0xa, 0xff, 0x30,
+    0x2, 0x53, 0x0, 0x0, 0x0, 0xa, 0xff, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xfe, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xaf, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x35, 0x8d, 0xff, 0xa1, 0x0,
+    0x0, 0x0, 0x1, 0xdf, 0xff, 0xfa, 0x10, 0x0,
+    0x0, 0x0, 0x2, 0xed, 0xef, 0xff, 0xc4, 0x0,
+    0x0, 0x0, 0x0, 0x10, 0x2, 0xaf, 0xfe, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xdf, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf4,
+    0x13, 0x51, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf5,
+    0x8f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf3,
+    0x5f, 0xfb, 0x0, 0x0, 0x0, 0x3, 0xef, 0xe0,
+    0x1d, 0xff, 0x50, 0x0, 0x0, 0x1b, 0xff, 0x80,
+    0x6, 0xff, 0xe7, 0x21, 0x14, 0xcf, 0xfc, 0x10,
+    0x0, 0x8f, 0xff, 0xed, 0xdf, 0xff, 0xc3, 0x0,
+    0x0, 0x5, 0xcf, 0xff, 0xff, 0xe8, 0x10, 0x0,
+    0x0, 0x0, 0x3, 0x67, 0x64, 0x10, 0x0, 0x0,
+
+    /* U+0034 "4" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6d, 0xc3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xfe, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xe3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xfe,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x4, 0xef, 0xef,
+    0xe3, 0x0, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xbb,
+    0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xe2,
+    0xaf, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf6,
+    0xa, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x2e, 0xf9,
+    0x0, 0xaf, 0xe3, 0x0, 0x0, 0x0, 0x1b, 0xfd,
+    0x20, 0xa, 0xfe, 0x30, 0x0, 0x0, 0x7, 0xff,
+    0x40, 0x0, 0xaf, 0xe3, 0x0, 0x0, 0x3, 0xef,
+    0x90, 0x0, 0xa, 0xfe, 0x30, 0x0, 0x1, 0xcf,
+    0xc1, 0x0, 0x0, 0xaf, 0xe3, 0x0, 0x0, 0x9f,
+    0xe3, 0x0, 0x0, 0xa, 0xfe, 0x30, 0x0, 0x4f,
+    0xf9, 0x22, 0x22, 0x22, 0xbf, 0xe5, 0x22, 0x19,
+    0xff, 0xee, 0xee, 0xee, 0xef, 0xff, 0xee, 0xe3,
+    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x44, 0x88, 0x88, 0x88, 0x88, 0x8d, 0xff, 0x98,
+    0x82, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xe3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfe,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xe3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xe3, 0x0, 0x0,
+
+    /* U+0035 "5" */
+    0x0, 0x5, 0x66, 0x66, 0x66, 0x66, 0x66, 0x30,
+    0x0, 0x3e, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,
+    0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,
+    0x0, 0x8f, 0xf7, 0x44, 0x44, 0x44, 0x44, 0x20,
+    0x0, 0xbf, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xdf, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xef, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0x70, 0x1, 0x11, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0x57, 0xce, 0xfe, 0xb6, 0x10, 0x0,
+    0xa, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xb2, 0x0,
+    0x1c, 0xff, 0xfc, 0x86, 0x7b, 0xff, 0xfc, 0x10,
+    0x2e, 0xff, 0x71, 0x0, 0x0, 0x4e, 0xff, 0x80,
+    0x15, 0x76, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf7,
+    0x1, 0x21, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf6,
+    0x8e, 0xe6, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf3,
+    0x6f, 0xfb, 0x0, 0x0, 0x0, 0x3, 0xef, 0xe0,
+    0x2e, 0xff, 0x50, 0x0, 0x0, 0x1b, 0xff, 0x70,
+    0x7, 0xff, 0xe7, 0x20, 0x14, 0xcf, 0xfb, 0x10,
+    0x0, 0x9f, 0xff, 0xed, 0xdf, 0xff, 0xc2, 0x0,
+    0x0, 0x5, 0xdf, 0xff, 0xff, 0xe8, 0x10, 0x0,
+    0x0, 0x0, 0x3, 0x67, 0x64, 0x10, 0x0, 0x0,
+
+    /* U+0036 "6" */
+    0x0, 0x0, 0x5, 0x9c, 0xdc, 0x83, 0x0, 0x0,
+    0x0, 0x2, 0xcf, 0xff, 0xff, 0xff, 0x91, 0x0,
+    0x0, 0x3e, 0xff, 0xc8, 0x7a, 0xef, 0xf9, 0x0,
+    0x1, 0xcf, 0xf8, 0x10, 0x0, 0x4d, 0xff, 0x40,
+    0x6, 0xff, 0x90, 0x0, 0x0, 0x6, 0xff, 0x90,
+    0x1c, 0xfe, 0x10, 0x0, 0x0, 0x2, 0xcd, 0xa0,
+    0x2e, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x11, 0x0,
+    0x6f, 0xf5, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0,
+    0x8f, 0xf3, 0x2, 0x7a, 0xcb, 0x83, 0x0, 0x0,
+    0xaf, 0xf2, 0x7e, 0xff, 0xff, 0xfe, 0x70, 0x0,
+    0xbf, 0xe8, 0xff, 0xda, 0xad, 0xff, 0xf8, 0x0,
+    0xbf, 0xff, 0xf7, 0x10, 0x1, 0x7f, 0xff, 0x40,
+    0xbf, 0xff, 0x60, 0x0, 0x0, 0x7, 0xff, 0xb0,
+    0xbf, 0xfc, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xf1,
+    0xaf, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf4,
+    0x9f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf5,
+    0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf4,
+    0x3f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf2,
+    0x1c, 0xff, 0x20, 0x0, 0x0, 0x3, 0xef, 0xd0,
+    0x7, 0xff, 0xb1, 0x0, 0x0, 0x1a, 0xff, 0x70,
+    0x1, 0xcf, 0xfb, 0x41, 0x13, 0xaf, 0xfc, 0x10,
+    0x0, 0x2c, 0xff, 0xed, 0xde, 0xff, 0xd3, 0x0,
+    0x0, 0x1, 0x8e, 0xff, 0xff, 0xf9, 0x20, 0x0,
+    0x0, 0x0, 0x1, 0x46, 0x75, 0x10, 0x0, 0x0,
+
+    /* U+0037 "7" */
+    0x36, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x62,
+    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
+    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
+    0x35, 0x55, 0x55, 0x55, 0x55, 0x5b, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xfd, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xe4, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4f, 0xfc, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xcf, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1c, 0xff, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xbf, 0xf4, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0xff, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2f, 0xfc, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xaf, 0xf4, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xe2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x44, 0x20, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+0038 "8" */
+    0x0, 0x0, 0x38, 0xbd, 0xca, 0x61, 0x0, 0x0,
+    0x0, 0x8, 0xef, 0xff, 0xff, 0xfd, 0x40, 0x0,
+    0x0, 0x8f, 0xfe, 0xa7, 0x8c, 0xff, 0xe3, 0x0,
+    0x3, 0xef, 0xe4, 0x0, 0x0, 0x9f, 0xfb, 0x10,
+    0x8, 0xff, 0x70, 0x0, 0x0, 0x1c, 0xff, 0x30,
+    0xb, 0xff, 0x20, 0x0, 0x0, 0x8, 0xff, 0x60,
+    0xb, 0xff, 0x20, 0x0, 0x0, 0x7, 0xff, 0x70,
+    0x9, 0xff, 0x60, 0x0, 0x0, 0xb, 0xff, 0x40,
+    0x3, 0xef, 0xd2, 0x0, 0x0, 0x5f, 0xfc, 0x10,
+    0x0, 0x6e, 0xfd, 0x84, 0x59, 0xff, 0xd4, 0x0,
+    0x0, 0x3, 0xdf, 0xff, 0xff, 0xfb, 0x20, 0x0,
+    0x0, 0x5c, 0xff, 0xff, 0xff, 0xfe, 0x81, 0x0,
+    0x6, 0xef, 0xf9, 0x31, 0x15, 0xcf, 0xfb, 0x10,
+    0x2d, 0xff, 0x60, 0x0, 0x0, 0x1a, 0xff, 0x90,
+    0x6f, 0xfa, 0x0, 0x0, 0x0, 0x2, 0xdf, 0xe1,
+    0x9f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf4,
+    0xaf, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf6,
+    0x9f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf5,
+    0x6f, 0xf9, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xf2,
+    0x2e, 0xff, 0x40, 0x0, 0x0, 0x7, 0xff, 0xb0,
+    0x7, 0xff, 0xe7, 0x20, 0x13, 0x9f, 0xfe, 0x30,
+    0x0, 0x8f, 0xff, 0xed, 0xde, 0xff, 0xe5, 0x0,
+    0x0, 0x5, 0xcf, 0xff, 0xff, 0xfa, 0x30, 0x0,
+    0x0, 0x0, 0x2, 0x57, 0x75, 0x10, 0x0, 0x0,
+
+    /* U+0039 "9" */
+    0x0, 0x0, 0x49, 0xcd, 0xc9, 0x40, 0x0, 0x0,
+    0x0, 0x1a, 0xff, 0xff, 0xff, 0xfa, 0x10, 0x0,
+    0x1, 0xbf, 0xfe, 0xb7, 0x8c, 0xff, 0xd2, 0x0,
+    0x8, 0xff, 0xe4, 0x0, 0x0, 0x7f, 0xfb, 0x0,
+    0x2e, 0xff, 0x40, 0x0, 0x0, 0x9, 0xff, 0x40,
+    0x6f, 0xfa, 0x0, 0x0, 0x0, 0x3, 0xef, 0xa0,
+    0x9f, 0xf6, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xe0,
+    0xaf, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf2,
+    0xaf, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf4,
+    0x8f, 0xf6, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xf5,
+    0x5f, 0xfc, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf6,
+    0x1d, 0xff, 0x80, 0x0, 0x0, 0x2d, 0xff, 0xf6,
+    0x6, 0xff, 0xfa, 0x41, 0x26, 0xdf, 0xdf, 0xf5,
+    0x0, 0x8f, 0xff, 0xff, 0xff, 0xf9, 0x7f, 0xf5,
+    0x0, 0x6, 0xcf, 0xff, 0xfd, 0x61, 0x8f, 0xf3,
+    0x0, 0x0, 0x14, 0x66, 0x41, 0x0, 0xaf, 0xf1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xd0,
+    0x3, 0x53, 0x0, 0x0, 0x0, 0x3, 0xff, 0x90,
+    0x2f, 0xfa, 0x0, 0x0, 0x0, 0x9, 0xff, 0x40,
+    0x1c, 0xff, 0x30, 0x0, 0x0, 0x5f, 0xfc, 0x10,
+    0x6, 0xff, 0xd4, 0x10, 0x27, 0xef, 0xe4, 0x0,
+    0x1, 0x9f, 0xfe, 0xdd, 0xef, 0xfe, 0x50, 0x0,
+    0x0, 0x7, 0xef, 0xff, 0xff, 0xb3, 0x0, 0x0,
+    0x0, 0x0, 0x14, 0x67, 0x52, 0x0, 0x0, 0x0,
+
+    /* U+003A ":" */
+    0x16, 0x77, 0x13, 0xef, 0xe2, 0x3e, 0xfe, 0x22,
+    0xab, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x33, 0x30, 0x3e, 0xfe, 0x23, 0xef, 0xe2,
+    0x3e, 0xfe, 0x20,
+
+    /* U+003B ";" */
+    0x17, 0x77, 0x13, 0xef, 0xe1, 0x3e, 0xfe, 0x12,
+    0xbb, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x33, 0x30, 0x3e, 0xfe, 0x13, 0xef, 0xe1,
+    0x3e, 0xfe, 0x10, 0x9, 0xe1, 0x0, 0xcd, 0x0,
+    0x5e, 0x90, 0x2d, 0xc1, 0x0, 0x41, 0x0,
+
+    /* U+003C "<" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x6b,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x8d, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xbe, 0xff, 0xfd,
+    0x0, 0x0, 0x0, 0x27, 0xdf, 0xff, 0xfc, 0x61,
+    0x0, 0x0, 0x39, 0xef, 0xff, 0xd9, 0x40, 0x0,
+    0x1, 0x5b, 0xff, 0xff, 0xc6, 0x20, 0x0, 0x0,
+    0x2d, 0xff, 0xfe, 0xa4, 0x10, 0x0, 0x0, 0x0,
+    0x3f, 0xff, 0x82, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xff, 0xe9, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xbe, 0xff, 0xfc, 0x61, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0x9e, 0xff, 0xfd, 0x83, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0x7c, 0xff, 0xfe, 0xb5, 0x10,
+    0x0, 0x0, 0x0, 0x1, 0x5b, 0xff, 0xff, 0xd7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x39, 0xef, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x17, 0xcd,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+
+    /* U+003D "=" */
+    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0x29, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x21,
+    0x3e, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed,
+    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0x29, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x98,
+
+    /* U+003E ">" */
+    0x3a, 0x41, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xfc, 0x61, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xff, 0xfe, 0x82, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0x8d, 0xff, 0xff, 0xb5, 0x10, 0x0, 0x0,
+    0x0, 0x1, 0x5b, 0xef, 0xff, 0xd7, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x39, 0xdf, 0xff, 0xe9, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0x26, 0xcf, 0xff, 0xeb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x13, 0xbf, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x5b, 0xff, 0xfd,
+    0x0, 0x0, 0x0, 0x2, 0x7d, 0xff, 0xfe, 0x93,
+    0x0, 0x0, 0x14, 0xae, 0xff, 0xfc, 0x72, 0x0,
+    0x0, 0x27, 0xcf, 0xff, 0xfb, 0x51, 0x0, 0x0,
+    0x19, 0xef, 0xff, 0xe9, 0x30, 0x0, 0x0, 0x0,
+    0x3f, 0xff, 0xd7, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x3e, 0xb5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x13, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+003F "?" */
+    0x0, 0x0, 0x2, 0x45, 0x43, 0x10, 0x0, 0x0,
+    0x0, 0x3, 0xae, 0xff, 0xfe, 0xd8, 0x20, 0x0,
+    0x0, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x0,
+    0x4, 0xef, 0xfa, 0x31, 0x15, 0xcf, 0xfe, 0x20,
+    0x1b, 0xff, 0x80, 0x0, 0x0, 0x1b, 0xff, 0xa0,
+    0x3f, 0xfd, 0x10, 0x0, 0x0, 0x3, 0xef, 0xf0,
+    0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf2,
+    0x37, 0x83, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xdf, 0xe0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1a, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x9f, 0xfc, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x1a, 0xff, 0xd3, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xaf, 0xfd, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0xc2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3e, 0xfe, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9f, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x35, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x23, 0x31, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xbf, 0xf6, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xcf, 0xf6, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xcf, 0xf6, 0x0, 0x0, 0x0,
+
+    /* U+0040 "@" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x13, 0x44,
+    0x44, 0x31, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x16, 0xbd, 0xef, 0xff,
+    0xfe, 0xdb, 0x61, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x7e, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xe8, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xdf, 0xfe, 0xb7, 0x41, 0x0, 0x13,
+    0x6b, 0xef, 0xfd, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xef, 0xfa, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xae, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x4,
+    0xef, 0xd5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5e, 0xfd, 0x20, 0x0, 0x0, 0x1, 0xdf,
+    0xd3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4e, 0xfa, 0x0, 0x0, 0x0, 0xaf, 0xe3,
+    0x0, 0x0, 0x16, 0xbd, 0xd9, 0x20, 0x7, 0x75,
+    0x0, 0x6f, 0xf4, 0x0, 0x0, 0x4e, 0xf6, 0x0,
+    0x0, 0x4d, 0xff, 0xff, 0xfe, 0x63, 0xff, 0xa0,
+    0x0, 0xcf, 0xb0, 0x0, 0xb, 0xfc, 0x0, 0x0,
+    0x4e, 0xff, 0xb7, 0x7b, 0xfe, 0x9f, 0xf6, 0x0,
+    0x5, 0xfe, 0x20, 0x3, 0xef, 0x50, 0x0, 0x2e,
+    0xfe, 0x60, 0x0, 0x18, 0xff, 0xff, 0x40, 0x0,
+    0x2e, 0xf5, 0x0, 0x7f, 0xd0, 0x0, 0xa, 0xff,
+    0x70, 0x0, 0x0, 0x1c, 0xff, 0xd1, 0x0, 0x1,
+    0xcf, 0x70, 0xb, 0xf9, 0x0, 0x4, 0xef, 0xc1,
+    0x0, 0x0, 0x0, 0x8f, 0xfc, 0x0, 0x0, 0xb,
+    0xf8, 0x1, 0xdf, 0x60, 0x0, 0xaf, 0xf5, 0x0,
+    0x0, 0x0, 0x6, 0xff, 0x80, 0x0, 0x1, 0xbf,
+    0x80, 0x2f, 0xf3, 0x0, 0x1d, 0xfe, 0x10, 0x0,
+    0x0, 0x0, 0x6f, 0xf5, 0x0, 0x0, 0x1d, 0xf7,
+    0x3, 0xff, 0x20, 0x3, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0x8, 0xfe, 0x20, 0x0, 0x3, 0xff, 0x40,
+    0x3f, 0xf2, 0x0, 0x4f, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0xbf, 0xe0, 0x0, 0x0, 0x8f, 0xd1, 0x3,
+    0xff, 0x20, 0x4, 0xff, 0x90, 0x0, 0x0, 0x0,
+    0x3e, 0xfa, 0x0, 0x0, 0x1e, 0xf9, 0x0, 0x3f,
+    0xf3, 0x0, 0x3f, 0xfb, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0x70, 0x0, 0xa, 0xfe, 0x30, 0x2, 0xef,
+    0x50, 0x1, 0xdf, 0xe1, 0x0, 0x0, 0x5, 0xff,
+    0xf4, 0x0, 0x7, 0xff, 0x70, 0x0, 0x1c, 0xf9,
+    0x0, 0x9, 0xff, 0x90, 0x0, 0x5, 0xef, 0xff,
+    0x30, 0x29, 0xff, 0xa0, 0x0, 0x0, 0x8f, 0xe1,
+    0x0, 0x2d, 0xff, 0xa5, 0x5a, 0xfd, 0xef, 0xfc,
+    0x9d, 0xff, 0xa1, 0x0, 0x0, 0x4, 0xef, 0x60,
+    0x0, 0x4e, 0xff, 0xff, 0xfc, 0x3a, 0xff, 0xff,
+    0xfe, 0x81, 0x0, 0x0, 0x0, 0xb, 0xfd, 0x10,
+    0x0, 0x2a, 0xef, 0xd7, 0x10, 0x2a, 0xff, 0xd9,
+    0x30, 0x0, 0x35, 0x51, 0x0, 0x4e, 0xfa, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4e, 0xfc, 0x10, 0x0, 0x8f, 0xfa, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4e, 0xfe, 0x30, 0x0, 0x0, 0x9f, 0xfc, 0x51,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x8e,
+    0xfe, 0x40, 0x0, 0x0, 0x1, 0x8f, 0xff, 0xc6,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x38, 0xdf, 0xfd,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x4c, 0xff, 0xfe,
+    0xda, 0x87, 0x77, 0x8a, 0xde, 0xff, 0xf9, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xbe, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0x93, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x15, 0x7a,
+    0xcd, 0xdd, 0xca, 0x85, 0x10, 0x0, 0x0, 0x0,
+    0x0,
+
+    /* U+0041 "A" */
+    0x0, 0x0, 0x0, 0x0, 0x6d, 0xdc, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xef, 0xef, 0xd2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0x8f, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d,
+    0xfc, 0x2f, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5f, 0xf8, 0xb, 0xff, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf3, 0x6,
+    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xff, 0xc1, 0x1, 0xef, 0xe2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0x70, 0x0, 0x9f, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xfe, 0x30,
+    0x0, 0x4f, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xfb, 0x0, 0x0, 0x1c, 0xff, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x9f, 0xf6, 0x0, 0x0, 0x7,
+    0xff, 0xa0, 0x0, 0x0, 0x0, 0x2, 0xef, 0xd2,
+    0x0, 0x0, 0x3, 0xef, 0xe2, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0xc5, 0x55, 0x55, 0x55, 0xdf, 0xf7,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfd, 0x10, 0x0, 0x0, 0x3e, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0,
+    0x0, 0x8f, 0xf9, 0x22, 0x22, 0x22, 0x22, 0x29,
+    0xff, 0xb0, 0x0, 0x1, 0xdf, 0xf3, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xff, 0xe3, 0x0, 0x5, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf8,
+    0x0, 0xa, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xfd, 0x10, 0x2e, 0xfe, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0x50, 0x7f,
+    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0xff, 0xb0, 0xdf, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0xf3,
+
+    /* U+0042 "B" */
+    0x8c, 0xcc, 0xcc, 0xcc, 0xcc, 0xb9, 0x51, 0x0,
+    0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
+    0x40, 0x0, 0xaf, 0xfe, 0xdd, 0xdd, 0xdd, 0xef,
+    0xff, 0xf4, 0x0, 0xaf, 0xf6, 0x0, 0x0, 0x0,
+    0x24, 0xbf, 0xfc, 0x10, 0xaf, 0xf6, 0x0, 0x0,
+    0x0, 0x0, 0x1d, 0xff, 0x40, 0xaf, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0x70, 0xaf, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x70, 0xaf,
+    0xf6, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0x40,
+    0xaf, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xfc,
+    0x10, 0xaf, 0xf8, 0x44, 0x44, 0x44, 0x69, 0xef,
+    0xd3, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfd, 0x30, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0xa2, 0x0, 0xaf, 0xfa, 0x77, 0x77,
+    0x77, 0x8a, 0xef, 0xfd, 0x30, 0xaf, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x2a, 0xff, 0xc1, 0xaf, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xf5, 0xaf,
+    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf8,
+    0xaf, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xfa, 0xaf, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xf8, 0xaf, 0xf6, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xff, 0xf4, 0xaf, 0xf6, 0x0, 0x0, 0x0,
+    0x1, 0x4d, 0xff, 0xc1, 0xaf, 0xfc, 0xbb, 0xbb,
+    0xbb, 0xbc, 0xff, 0xfe, 0x40, 0xaf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xd5, 0x0, 0xaf, 0xff,
+    0xff, 0xff, 0xff, 0xfd, 0xa6, 0x10, 0x0,
+
+    /* U+0043 "C" */
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x23, 0x21, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x7c, 0xde,
+    0xee, 0xdb, 0x50, 0x0, 0x0, 0x0, 0x0, 0x18,
+    0xef, 0xff, 0xff, 0xff, 0xff, 0xc3, 0x0, 0x0,
+    0x0, 0x2c, 0xff, 0xfd, 0x97, 0x78, 0xbe, 0xff,
+    0xe4, 0x0, 0x0, 0x1c, 0xff, 0xd6, 0x10, 0x0,
+    0x0, 0x3c, 0xff, 0xd2, 0x0, 0x9, 0xff, 0xd3,
+    0x0, 0x0, 0x0, 0x0, 0x2c, 0xff, 0x90, 0x3,
+    0xef, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xff, 0x20, 0x8f, 0xfa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xbe, 0xb3, 0x1c, 0xff, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x2, 0xff,
+    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xfd, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1c, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xb8, 0x30, 0x9f, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9f, 0xf9, 0x4, 0xff, 0xe2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0x40,
+    0xb, 0xff, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x1a,
+    0xff, 0xc0, 0x0, 0x3e, 0xff, 0xb2, 0x0, 0x0,
+    0x0, 0x2a, 0xff, 0xe4, 0x0, 0x0, 0x5f, 0xff,
+    0xe9, 0x53, 0x34, 0x8d, 0xff, 0xe7, 0x0, 0x0,
+    0x0, 0x5e, 0xff, 0xff, 0xee, 0xff, 0xff, 0xe6,
+    0x0, 0x0, 0x0, 0x0, 0x28, 0xef, 0xff, 0xff,
+    0xff, 0xa2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x35, 0x67, 0x64, 0x10, 0x0, 0x0, 0x0,
+
+    /* U+0044 "D" */
+    0x7c, 0xcc, 0xcc, 0xcc, 0xcc, 0xba, 0x73, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xa2, 0x0, 0x0, 0x8f, 0xfe, 0xdd, 0xdd,
+    0xdd, 0xee, 0xff, 0xfe, 0x40, 0x0, 0x8f, 0xf7,
+    0x0, 0x0, 0x0, 0x13, 0x8e, 0xff, 0xd3, 0x0,
+    0x8f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x3, 0xdf,
+    0xfb, 0x10, 0x8f, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4e, 0xff, 0x40, 0x8f, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0xa0, 0x8f, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xe0,
+    0x8f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xdf, 0xf2, 0x8f, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xcf, 0xf5, 0x8f, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xbf, 0xf6, 0x8f, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf6,
+    0x8f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0xf6, 0x8f, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xcf, 0xf4, 0x8f, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xdf, 0xf2, 0x8f, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xe0,
+    0x8f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xa0, 0x8f, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2e, 0xff, 0x40, 0x8f, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xcf, 0xfb, 0x10, 0x8f, 0xf7,
+    0x0, 0x0, 0x0, 0x2, 0x5c, 0xff, 0xe3, 0x0,
+    0x8f, 0xfd, 0xbb, 0xbb, 0xbb, 0xcd, 0xff, 0xfe,
+    0x50, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xc4, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
+    0xff, 0xec, 0x94, 0x10, 0x0, 0x0,
+
+    /* U+0045 "E" */
+    0x6c, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xc2, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xe2, 0x7f, 0xfe, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xdd, 0xdd, 0xd2, 0x7f, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xfa, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x10, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0x40, 0x7f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x40, 0x7f, 0xfc, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x20, 0x7f, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xfd, 0xbb, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xb7, 0x7f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
+
+    /* U+0046 "F" */
+    0x5d, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdc,
+    0x26, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xe2, 0x6f, 0xfe, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xdc, 0x26, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xfa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xff, 0xa0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xfa, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xb4, 0x44,
+    0x44, 0x44, 0x44, 0x41, 0x0, 0x6f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x60, 0x6, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x6f, 0xfc,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x30, 0x6, 0xff,
+    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
+    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xfa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xff, 0xa0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4c, 0xc8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+0047 "G" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x23, 0x32, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x16, 0xad,
+    0xee, 0xee, 0xdb, 0x61, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x50,
+    0x0, 0x0, 0x0, 0x9f, 0xff, 0xec, 0x87, 0x78,
+    0xbe, 0xff, 0xf7, 0x0, 0x0, 0x9, 0xff, 0xf9,
+    0x30, 0x0, 0x0, 0x3, 0xaf, 0xff, 0x40, 0x0,
+    0x5f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xb0, 0x1, 0xcf, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xdf, 0xf3, 0x5, 0xff, 0xd1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xe5,
+    0xa, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x24, 0x0, 0x1d, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xfe,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3f, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4f, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0x56, 0x66, 0x66, 0x66, 0x66, 0x4f,
+    0xfd, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff,
+    0xff, 0xfd, 0x3f, 0xfe, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0xff, 0xff, 0xff, 0xfd, 0x2e, 0xff, 0x20,
+    0x0, 0x0, 0x0, 0x34, 0x44, 0x44, 0x6e, 0xfd,
+    0x1b, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2e, 0xfd, 0x7, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2e, 0xfd, 0x2, 0xdf,
+    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e,
+    0xfd, 0x0, 0x7f, 0xfe, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5f, 0xfd, 0x0, 0x1b, 0xff, 0xe8,
+    0x20, 0x0, 0x0, 0x1, 0x3a, 0xff, 0xfd, 0x0,
+    0x1, 0xbf, 0xff, 0xea, 0x74, 0x45, 0x8c, 0xff,
+    0xff, 0xc4, 0x0, 0x0, 0x18, 0xef, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xe8, 0x10, 0x0, 0x0, 0x0,
+    0x28, 0xdf, 0xff, 0xff, 0xff, 0xc7, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0x56, 0x76, 0x41,
+    0x0, 0x0, 0x0,
+
+    /* U+0048 "H" */
+    0x5d, 0xd7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0xdd, 0x77, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xf8, 0x7f, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0x87, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xf8, 0x7f, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0x87,
+    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xf8, 0x7f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0x87, 0xff, 0x90, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xf8, 0x7f, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0x87, 0xff, 0xa4,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0xaf, 0xf8, 0x7f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x87, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf8, 0x7f, 0xfc, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x7b, 0xff, 0x87, 0xff, 0x90, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xf8, 0x7f, 0xf9, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0x87, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf8,
+    0x7f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0x87, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xf8, 0x7f, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0x87, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xf8, 0x7f, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0x87,
+    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xf8, 0x7f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0x80,
+
+    /* U+0049 "I" */
+    0x2b, 0xdc, 0x12, 0xdf, 0xe1, 0x2d, 0xfe, 0x12,
+    0xdf, 0xe1, 0x2d, 0xfe, 0x12, 0xdf, 0xe1, 0x2d,
+    0xfe, 0x12, 0xdf, 0xe1, 0x2d, 0xfe, 0x12, 0xdf,
+    0xe1, 0x2d, 0xfe, 0x12, 0xdf, 0xe1, 0x2d, 0xfe,
+    0x12, 0xdf, 0xe1, 0x2d, 0xfe, 0x12, 0xdf, 0xe1,
+    0x2d, 0xfe, 0x12, 0xdf, 0xe1, 0x2d, 0xfe, 0x12,
+    0xdf, 0xe1, 0x2d, 0xfe, 0x12, 0xdf, 0xe1, 0x2d,
+    0xfe, 0x10,
+
+    /* U+004A "J" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7d, 0xd7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf8,
+    0x18, 0xa8, 0x0, 0x0, 0x0, 0x8f, 0xf7, 0x1e,
+    0xfb, 0x0, 0x0, 0x0, 0x9f, 0xf6, 0x1d, 0xfe,
+    0x10, 0x0, 0x0, 0xbf, 0xf4, 0xa, 0xff, 0x70,
+    0x0, 0x4, 0xff, 0xe2, 0x5, 0xff, 0xe9, 0x54,
+    0x8e, 0xff, 0xa0, 0x1, 0xaf, 0xff, 0xff, 0xff,
+    0xfd, 0x20, 0x0, 0x18, 0xef, 0xff, 0xff, 0xa2,
+    0x0, 0x0, 0x0, 0x15, 0x67, 0x51, 0x0, 0x0,
+
+    /* U+004B "K" */
+    0x9d, 0xd5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8d,
+    0xdd, 0x50, 0xaf, 0xf6, 0x0, 0x0, 0x0, 0x0,
+    0x9, 0xff, 0xf7, 0x0, 0xaf, 0xf6, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xfe, 0x70, 0x0, 0xaf, 0xf6,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0xe6, 0x0, 0x0,
+    0xaf, 0xf6, 0x0, 0x0, 0x0, 0x8f, 0xfe, 0x60,
+    0x0, 0x0, 0xaf, 0xf6, 0x0, 0x0, 0x9, 0xff,
+    0xe5, 0x0, 0x0, 0x0, 0xaf, 0xf6, 0x0, 0x0,
+    0x9f, 0xfe, 0x50, 0x0, 0x0, 0x0, 0xaf, 0xf6,
+    0x0, 0x19, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xf6, 0x1, 0x9f, 0xfe, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0xaf, 0xf6, 0x19, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xf6, 0x9f, 0xff,
+    0xfd, 0x20, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xfd,
+    0xff, 0xdd, 0xff, 0xb1, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xff, 0xfd, 0x33, 0xef, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0xaf, 0xff, 0xd2, 0x0, 0x6f, 0xfe,
+    0x50, 0x0, 0x0, 0x0, 0xaf, 0xfc, 0x20, 0x0,
+    0xb, 0xff, 0xd2, 0x0, 0x0, 0x0, 0xaf, 0xf6,
+    0x0, 0x0, 0x2, 0xdf, 0xfb, 0x0, 0x0, 0x0,
+    0xaf, 0xf6, 0x0, 0x0, 0x0, 0x5f, 0xff, 0x70,
+    0x0, 0x0, 0xaf, 0xf6, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xe4, 0x0, 0x0, 0xaf, 0xf6, 0x0, 0x0,
+    0x0, 0x1, 0xcf, 0xfd, 0x20, 0x0, 0xaf, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0x4e, 0xff, 0xa1, 0x0,
+    0xaf, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0xf7, 0x0, 0xaf, 0xf6, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xbf, 0xfe, 0x40, 0xaf, 0xf6, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2e, 0xff, 0xd1,
+
+    /* U+004C "L" */
+    0x9d, 0xd5, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
+    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0x60,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0x60, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xf6, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0xff, 0x60, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xf6, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xa, 0xff, 0x60, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xaf, 0xf6, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xa, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
+    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xfc,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x7a, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfa, 0xaf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xa0,
+
+    /* U+004D "M" */
+    0x8d, 0xdd, 0xc2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xcd, 0xdd, 0x39, 0xff, 0xff, 0x60, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf3, 0x9f,
+    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0xff, 0xff, 0x39, 0xff, 0xff, 0xe2, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xdf, 0xff, 0xf3, 0x9f, 0xfa,
+    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xfc,
+    0xff, 0x39, 0xff, 0x6e, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xfb, 0xbf, 0xf3, 0x9f, 0xf5, 0xaf,
+    0xe2, 0x0, 0x0, 0x0, 0x2, 0xef, 0x6a, 0xff,
+    0x39, 0xff, 0x55, 0xff, 0x60, 0x0, 0x0, 0x0,
+    0x6f, 0xe2, 0xaf, 0xf3, 0x9f, 0xf5, 0x2e, 0xfb,
+    0x0, 0x0, 0x0, 0xb, 0xfa, 0xa, 0xff, 0x39,
+    0xff, 0x50, 0xaf, 0xf1, 0x0, 0x0, 0x2, 0xef,
+    0x50, 0xaf, 0xf3, 0x9f, 0xf5, 0x5, 0xff, 0x60,
+    0x0, 0x0, 0x6f, 0xd2, 0xa, 0xff, 0x39, 0xff,
+    0x50, 0x2d, 0xfb, 0x0, 0x0, 0xb, 0xfa, 0x0,
+    0xaf, 0xf3, 0x9f, 0xf5, 0x0, 0xaf, 0xf1, 0x0,
+    0x2, 0xff, 0x50, 0xa, 0xff, 0x39, 0xff, 0x50,
+    0x5, 0xff, 0x60, 0x0, 0x7f, 0xd1, 0x0, 0xaf,
+    0xf3, 0x9f, 0xf5, 0x0, 0x1d, 0xfb, 0x0, 0xc,
+    0xf9, 0x0, 0xa, 0xff, 0x39, 0xff, 0x50, 0x0,
+    0xaf, 0xe2, 0x3, 0xef, 0x40, 0x0, 0xaf, 0xf3,
+    0x9f, 0xf5, 0x0, 0x5, 0xff, 0x60, 0x7f, 0xd1,
+    0x0, 0xa, 0xff, 0x39, 0xff, 0x50, 0x0, 0x1e,
+    0xfb, 0xc, 0xf9, 0x0, 0x0, 0xaf, 0xf3, 0x9f,
+    0xf5, 0x0, 0x0, 0x9f, 0xe5, 0xef, 0x30, 0x0,
+    0xa, 0xff, 0x39, 0xff, 0x50, 0x0, 0x4, 0xff,
+    0xcf, 0xd0, 0x0, 0x0, 0xaf, 0xf3, 0x9f, 0xf5,
+    0x0, 0x0, 0x1d, 0xff, 0xf8, 0x0, 0x0, 0xa,
+    0xff, 0x39, 0xff, 0x50, 0x0, 0x0, 0x9f, 0xff,
+    0x30, 0x0, 0x0, 0xaf, 0xf3, 0x9f, 0xf5, 0x0,
+    0x0, 0x4, 0xff, 0xc1, 0x0, 0x0, 0xa, 0xff,
+    0x30,
+
+    /* U+004E "N" */
+    0x7d, 0xda, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xdd, 0x68, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xf8, 0x8f, 0xff, 0xe3, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xff, 0x88, 0xff, 0xff, 0xb1,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xf8, 0x8f, 0xff,
+    0xff, 0x70, 0x0, 0x0, 0x0, 0x6, 0xff, 0x88,
+    0xff, 0xbf, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x6f,
+    0xf8, 0x8f, 0xf6, 0xaf, 0xfb, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0x88, 0xff, 0x52, 0xdf, 0xf7, 0x0,
+    0x0, 0x0, 0x6f, 0xf8, 0x8f, 0xf5, 0x6, 0xff,
+    0xe3, 0x0, 0x0, 0x6, 0xff, 0x88, 0xff, 0x50,
+    0xa, 0xff, 0xc1, 0x0, 0x0, 0x6f, 0xf8, 0x8f,
+    0xf5, 0x0, 0x2d, 0xff, 0x70, 0x0, 0x6, 0xff,
+    0x88, 0xff, 0x50, 0x0, 0x6f, 0xfe, 0x30, 0x0,
+    0x6f, 0xf8, 0x8f, 0xf5, 0x0, 0x0, 0xaf, 0xfb,
+    0x10, 0x6, 0xff, 0x88, 0xff, 0x50, 0x0, 0x1,
+    0xdf, 0xf7, 0x0, 0x6f, 0xf8, 0x8f, 0xf5, 0x0,
+    0x0, 0x5, 0xff, 0xe3, 0x6, 0xff, 0x88, 0xff,
+    0x50, 0x0, 0x0, 0xa, 0xff, 0xc1, 0x6f, 0xf8,
+    0x8f, 0xf5, 0x0, 0x0, 0x0, 0x2d, 0xff, 0x76,
+    0xff, 0x88, 0xff, 0x50, 0x0, 0x0, 0x0, 0x5f,
+    0xfe, 0xaf, 0xf8, 0x8f, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0xff, 0xff, 0x88, 0xff, 0x50, 0x0,
+    0x0, 0x0, 0x2, 0xdf, 0xff, 0xf8, 0x8f, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x88,
+    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xf8, 0x8f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1d, 0xff, 0x80,
+
+    /* U+004F "O" */
+    0x0, 0x0, 0x0, 0x0, 0x2, 0x33, 0x31, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x7c,
+    0xee, 0xee, 0xdc, 0x72, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xef, 0xff, 0xff, 0xff, 0xff, 0xe7,
+    0x10, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xfe, 0xa7,
+    0x77, 0xae, 0xff, 0xfa, 0x10, 0x0, 0x0, 0x1b,
+    0xff, 0xe8, 0x20, 0x0, 0x0, 0x28, 0xef, 0xfb,
+    0x10, 0x0, 0x8, 0xff, 0xd4, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xef, 0xf7, 0x0, 0x3, 0xef, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xe2,
+    0x0, 0x8f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1b, 0xff, 0x80, 0x1c, 0xff, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xfd, 0x2,
+    0xef, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xef, 0xe3, 0x4f, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0x56, 0xff,
+    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0xf6, 0x7f, 0xfa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0xff, 0x66, 0xff, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
+    0xf6, 0x5f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0xff, 0x53, 0xff, 0xe0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xe3,
+    0x1d, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xfd, 0x10, 0x9f, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0x90, 0x3,
+    0xef, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xef, 0xf4, 0x0, 0xa, 0xff, 0xc2, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xcf, 0xfa, 0x0, 0x0, 0x2d,
+    0xff, 0xc4, 0x0, 0x0, 0x0, 0x4, 0xdf, 0xfd,
+    0x20, 0x0, 0x0, 0x3d, 0xff, 0xea, 0x54, 0x34,
+    0x6a, 0xef, 0xfd, 0x30, 0x0, 0x0, 0x0, 0x2b,
+    0xff, 0xff, 0xfe, 0xff, 0xff, 0xfb, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x15, 0xbf, 0xff, 0xff, 0xff,
+    0xb5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x14, 0x67, 0x64, 0x10, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+0050 "P" */
+    0x7c, 0xcc, 0xcc, 0xcc, 0xcc, 0xcb, 0x96, 0x10,
+    0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0x60, 0x0, 0x8f, 0xfe, 0xdd, 0xdd, 0xdd,
+    0xde, 0xef, 0xff, 0x70, 0x8, 0xff, 0x70, 0x0,
+    0x0, 0x0, 0x14, 0xbf, 0xfe, 0x30, 0x8f, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xf8, 0x8,
+    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
+    0xc1, 0x8f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xfd, 0x18, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xd1, 0x8f, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xfb, 0x8, 0xff, 0x70,
+    0x0, 0x0, 0x0, 0x0, 0x1d, 0xff, 0x70, 0x8f,
+    0xf7, 0x0, 0x0, 0x0, 0x2, 0x5c, 0xff, 0xd2,
+    0x8, 0xff, 0xed, 0xdd, 0xdd, 0xdd, 0xef, 0xff,
+    0xf6, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xd5, 0x0, 0x8, 0xff, 0xed, 0xdd, 0xdd,
+    0xdc, 0xb9, 0x51, 0x0, 0x0, 0x8f, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0x44, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+0051 "Q" */
+    0x0, 0x0, 0x0, 0x0, 0x2, 0x33, 0x31, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x8c,
+    0xee, 0xee, 0xdb, 0x61, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x19, 0xef, 0xff, 0xff, 0xff, 0xff, 0xd5,
+    0x0, 0x0, 0x0, 0x0, 0x2d, 0xff, 0xfd, 0xa7,
+    0x78, 0xbe, 0xff, 0xf9, 0x10, 0x0, 0x0, 0x2c,
+    0xff, 0xd6, 0x10, 0x0, 0x0, 0x29, 0xff, 0xf9,
+    0x0, 0x0, 0xa, 0xff, 0xc3, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xf5, 0x0, 0x4, 0xef, 0xe3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xd1,
+    0x0, 0xaf, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1d, 0xff, 0x50, 0x2e, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xfa, 0x4,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0xd1, 0x7f, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1e, 0xfe, 0x39, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0xf4, 0x9f, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xd, 0xff, 0x49, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
+    0xf4, 0x8f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1e, 0xfe, 0x35, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xef, 0xe2,
+    0x2e, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xfc, 0x1, 0xbf, 0xf6, 0x0, 0x0,
+    0x0, 0x2, 0x0, 0x0, 0xb, 0xff, 0x70, 0x5,
+    0xff, 0xd1, 0x0, 0x0, 0x2, 0xeb, 0x50, 0x5,
+    0xff, 0xe2, 0x0, 0x1b, 0xff, 0xb1, 0x0, 0x0,
+    0x6f, 0xff, 0xb5, 0xef, 0xf8, 0x0, 0x0, 0x3e,
+    0xff, 0xb3, 0x0, 0x1, 0x5b, 0xff, 0xff, 0xfc,
+    0x10, 0x0, 0x0, 0x4e, 0xff, 0xe9, 0x53, 0x34,
+    0x7e, 0xff, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x3c,
+    0xff, 0xff, 0xee, 0xff, 0xff, 0xff, 0xfd, 0x50,
+    0x0, 0x0, 0x0, 0x16, 0xcf, 0xff, 0xff, 0xff,
+    0xa4, 0x7e, 0xff, 0xc4, 0x0, 0x0, 0x0, 0x0,
+    0x25, 0x67, 0x64, 0x10, 0x0, 0x3b, 0xff, 0x60,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0x91,
+
+    /* U+0052 "R" */
+    0x6d, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xca, 0x73,
+    0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xe8, 0x10, 0x0, 0x8f, 0xfd, 0xaa,
+    0xaa, 0xaa, 0xab, 0xce, 0xff, 0xf8, 0x0, 0x8,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x3b, 0xff,
+    0xe3, 0x0, 0x8f, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1c, 0xff, 0x80, 0x8, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xfb, 0x0, 0x8f,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0xc0, 0x8, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xfb, 0x0, 0x8f, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1d, 0xff, 0x70, 0x8, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x1, 0x4b, 0xff, 0xd2,
+    0x0, 0x8f, 0xfd, 0xaa, 0xaa, 0xaa, 0xab, 0xde,
+    0xff, 0xe5, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xb4, 0x0, 0x0, 0x8f, 0xff,
+    0xee, 0xee, 0xef, 0xff, 0xd7, 0x30, 0x0, 0x0,
+    0x8, 0xff, 0x80, 0x0, 0x1, 0x5d, 0xff, 0xa1,
+    0x0, 0x0, 0x0, 0x8f, 0xf8, 0x0, 0x0, 0x0,
+    0x2c, 0xff, 0xc2, 0x0, 0x0, 0x8, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x3d, 0xff, 0xa1, 0x0, 0x0,
+    0x8f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
+    0x70, 0x0, 0x8, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0xfe, 0x30, 0x0, 0x8f, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xef, 0xfb, 0x10, 0x8,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
+    0xf7, 0x0, 0x8f, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0xe2, 0x8, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xb0, 0x8f,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0x60,
+
+    /* U+0053 "S" */
+    0x0, 0x0, 0x0, 0x2, 0x34, 0x42, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0x8d, 0xee, 0xfe, 0xec,
+    0x82, 0x0, 0x0, 0x0, 0x7, 0xef, 0xff, 0xff,
+    0xff, 0xff, 0xe6, 0x0, 0x0, 0x7, 0xff, 0xfd,
+    0x97, 0x67, 0xad, 0xff, 0xf7, 0x0, 0x2, 0xef,
+    0xf7, 0x10, 0x0, 0x0, 0x19, 0xff, 0xe3, 0x0,
+    0x7f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
+    0x90, 0xa, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xfc, 0x10, 0xaf, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xcb, 0x81, 0x7, 0xff, 0xb1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0xff,
+    0xc6, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xfe, 0xb8, 0x42, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6e, 0xff, 0xff, 0xff, 0xeb, 0x72,
+    0x0, 0x0, 0x0, 0x0, 0x27, 0xcf, 0xff, 0xff,
+    0xff, 0xe9, 0x10, 0x0, 0x0, 0x0, 0x0, 0x26,
+    0x9d, 0xff, 0xff, 0xfc, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0x7c, 0xff, 0xfb, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf4,
+    0x36, 0x73, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0x87, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xfa, 0x4f, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0x92, 0xdf, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xbf, 0xf5, 0x7, 0xff,
+    0xf8, 0x20, 0x0, 0x0, 0x1, 0x8f, 0xfc, 0x10,
+    0x1b, 0xff, 0xfd, 0x96, 0x44, 0x59, 0xdf, 0xfe,
+    0x50, 0x0, 0x1a, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0x50, 0x0, 0x0, 0x5, 0xbf, 0xff, 0xff,
+    0xff, 0xe9, 0x20, 0x0, 0x0, 0x0, 0x0, 0x14,
+    0x67, 0x76, 0x30, 0x0, 0x0, 0x0,
+
+    /* U+0054 "T" */
+    0x3c, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xa1, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xc1, 0x3d, 0xdd, 0xdd, 0xdd,
+    0xff, 0xfe, 0xdd, 0xdd, 0xdd, 0xb1, 0x0, 0x0,
+    0x0, 0x0, 0xbf, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xbf, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xbf, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xbf, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xbf, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xbf, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xbf, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xbf, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xbf, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xbf, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0xf5, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+0055 "U" */
+    0x6d, 0xd7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xdd, 0x78, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xf8, 0x8f, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0x88, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xf8, 0x8f, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0x88,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xf8, 0x8f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0x88, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xf8, 0x8f, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0x88, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf8, 0x8f,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0x88, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xf8, 0x8f, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0x87, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xf8, 0x7f, 0xf9, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0x86, 0xff,
+    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf7,
+    0x4f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0x52, 0xef, 0xe1, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xef, 0xf2, 0xc, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xfc, 0x10, 0x6f, 0xfe, 0x61,
+    0x0, 0x0, 0x0, 0x5e, 0xff, 0x70, 0x1, 0xbf,
+    0xff, 0xc7, 0x54, 0x57, 0xbf, 0xff, 0xb1, 0x0,
+    0x2, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb2,
+    0x0, 0x0, 0x1, 0x7d, 0xff, 0xff, 0xff, 0xfd,
+    0x60, 0x0, 0x0, 0x0, 0x0, 0x2, 0x56, 0x76,
+    0x52, 0x0, 0x0, 0x0,
+
+    /* U+0056 "V" */
+    0x9d, 0xd7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xdd, 0xb5, 0xff, 0xd1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xf8, 0x1d, 0xff, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xff, 0x30,
+    0x8f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0xb1, 0x3, 0xff, 0xe1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xf6, 0x0, 0xb, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x1e, 0xfd, 0x20, 0x0,
+    0x6f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0x90, 0x0, 0x2, 0xdf, 0xe2, 0x0, 0x0, 0x0,
+    0x0, 0xbf, 0xe4, 0x0, 0x0, 0x9, 0xff, 0x60,
+    0x0, 0x0, 0x0, 0x3e, 0xfc, 0x0, 0x0, 0x0,
+    0x4e, 0xfc, 0x0, 0x0, 0x0, 0x7, 0xff, 0x60,
+    0x0, 0x0, 0x0, 0xcf, 0xe3, 0x0, 0x0, 0x1,
+    0xcf, 0xe2, 0x0, 0x0, 0x0, 0x7, 0xff, 0x70,
+    0x0, 0x0, 0x4f, 0xfa, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xfc, 0x10, 0x0, 0x9, 0xff, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xf4, 0x0, 0x1, 0xdf,
+    0xd0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x90,
+    0x0, 0x5f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1d, 0xfd, 0x10, 0xa, 0xfe, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xf4, 0x2, 0xef, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0x90,
+    0x7f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xa, 0xfe, 0x1c, 0xfc, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xf6, 0xff, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xef,
+    0xe3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3e, 0xff, 0x50, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+0057 "W" */
+    0x6d, 0xd8, 0x0, 0x0, 0x0, 0x0, 0xa, 0xdd,
+    0xc2, 0x0, 0x0, 0x0, 0x0, 0x4d, 0xd9, 0x4f,
+    0xfc, 0x10, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xf7, 0x1e, 0xfe,
+    0x20, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0xcf, 0xf3, 0xa, 0xff, 0x40,
+    0x0, 0x0, 0x0, 0x9f, 0xdc, 0xfd, 0x10, 0x0,
+    0x0, 0x1, 0xef, 0xd1, 0x7, 0xff, 0x80, 0x0,
+    0x0, 0x1, 0xcf, 0xa7, 0xff, 0x40, 0x0, 0x0,
+    0x4, 0xff, 0xa0, 0x3, 0xff, 0xb0, 0x0, 0x0,
+    0x3, 0xff, 0x73, 0xff, 0x80, 0x0, 0x0, 0x8,
+    0xff, 0x60, 0x1, 0xdf, 0xe0, 0x0, 0x0, 0x7,
+    0xff, 0x30, 0xef, 0xb0, 0x0, 0x0, 0xb, 0xfe,
+    0x20, 0x0, 0xaf, 0xf3, 0x0, 0x0, 0xb, 0xfc,
+    0x10, 0xaf, 0xe2, 0x0, 0x0, 0x1e, 0xfc, 0x0,
+    0x0, 0x6f, 0xf7, 0x0, 0x0, 0x1f, 0xf9, 0x0,
+    0x6f, 0xf5, 0x0, 0x0, 0x4f, 0xf8, 0x0, 0x0,
+    0x3e, 0xfa, 0x0, 0x0, 0x5f, 0xf5, 0x0, 0x2f,
+    0xfa, 0x0, 0x0, 0x7f, 0xf4, 0x0, 0x0, 0x1c,
+    0xfd, 0x0, 0x0, 0x9f, 0xe2, 0x0, 0x1c, 0xfd,
+    0x10, 0x0, 0xbf, 0xe1, 0x0, 0x0, 0x9, 0xff,
+    0x30, 0x0, 0xdf, 0xc0, 0x0, 0x8, 0xff, 0x30,
+    0x2, 0xdf, 0xb0, 0x0, 0x0, 0x5, 0xff, 0x60,
+    0x3, 0xff, 0x70, 0x0, 0x4, 0xff, 0x70, 0x4,
+    0xff, 0x70, 0x0, 0x0, 0x2, 0xef, 0x90, 0x6,
+    0xff, 0x40, 0x0, 0x2, 0xdf, 0xb0, 0x7, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0xcf, 0xc0, 0xb, 0xfd,
+    0x10, 0x0, 0x0, 0xbf, 0xe1, 0xb, 0xfd, 0x10,
+    0x0, 0x0, 0x0, 0x8f, 0xe2, 0x1d, 0xfa, 0x0,
+    0x0, 0x0, 0x7f, 0xf4, 0x1d, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xf5, 0x4f, 0xf6, 0x0, 0x0,
+    0x0, 0x3e, 0xf7, 0x3f, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x1e, 0xf8, 0x7f, 0xf2, 0x0, 0x0, 0x0,
+    0x1c, 0xfa, 0x7f, 0xe2, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xfb, 0xbf, 0xc0, 0x0, 0x0, 0x0, 0x9,
+    0xfd, 0xaf, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xfe, 0xef, 0x80, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0xdf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0xff, 0x40, 0x0, 0x0, 0x0, 0x2, 0xef, 0xff,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xfe,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xfd, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xfb, 0x0, 0x0,
+    0x0,
+
+    /* U+0058 "X" */
+    0x6, 0xdd, 0xc2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2c, 0xdc, 0x30, 0x1c, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0xff, 0x80, 0x0, 0x3e, 0xff,
+    0x70, 0x0, 0x0, 0x0, 0x8, 0xff, 0xb1, 0x0,
+    0x0, 0x7f, 0xfe, 0x30, 0x0, 0x0, 0x5, 0xff,
+    0xd2, 0x0, 0x0, 0x1, 0xaf, 0xfc, 0x10, 0x0,
+    0x3, 0xdf, 0xf5, 0x0, 0x0, 0x0, 0x2, 0xdf,
+    0xf8, 0x0, 0x1, 0xbf, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0xf4, 0x0, 0x8f, 0xfc, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xd1, 0x5f,
+    0xfd, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1c,
+    0xff, 0xae, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3e, 0xff, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xb1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0xfc, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xdf, 0xff, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xbf, 0xfb, 0xff, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xfc,
+    0x19, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xfe, 0x40, 0x1c, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0x2d, 0xff, 0x70, 0x0, 0x4e, 0xff,
+    0x70, 0x0, 0x0, 0x0, 0xb, 0xff, 0xb1, 0x0,
+    0x0, 0x8f, 0xfe, 0x40, 0x0, 0x0, 0x8, 0xff,
+    0xd2, 0x0, 0x0, 0x1, 0xbf, 0xfc, 0x10, 0x0,
+    0x5, 0xef, 0xf5, 0x0, 0x0, 0x0, 0x3, 0xef,
+    0xf9, 0x0, 0x2, 0xdf, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xff, 0xf5, 0x0, 0xbf, 0xfc, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xd2, 0x7f,
+    0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d,
+    0xff, 0xb0,
+
+    /* U+0059 "Y" */
+    0x8d, 0xdc, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9, 0xdd, 0xa2, 0xdf, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xe3, 0x5, 0xff, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xf7, 0x0,
+    0xa, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xfb, 0x10, 0x0, 0x2d, 0xff, 0x90, 0x0, 0x0,
+    0x0, 0x5f, 0xfd, 0x20, 0x0, 0x0, 0x5f, 0xfe,
+    0x50, 0x0, 0x0, 0x2d, 0xff, 0x60, 0x0, 0x0,
+    0x0, 0xaf, 0xfd, 0x10, 0x0, 0x9, 0xff, 0xa0,
+    0x0, 0x0, 0x0, 0x1, 0xdf, 0xf9, 0x0, 0x5,
+    0xff, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0xe4, 0x1, 0xdf, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9, 0xff, 0xc1, 0x8f, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2d, 0xff, 0x8e, 0xfc,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
+    0xff, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xef, 0xe1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e,
+    0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xef, 0xe1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2e, 0xfe, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef,
+    0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2e, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xef, 0xe1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xfe,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xef, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2e, 0xfe, 0x10, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+005A "Z" */
+    0x1, 0xbc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0x50, 0x2e, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf6, 0x2, 0xcd, 0xdd, 0xdd, 0xdd,
+    0xdd, 0xdd, 0xef, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1b, 0xff, 0xc1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1a, 0xff, 0xd3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xf4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xef, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xdf, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xbf, 0xfd, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xfe, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0x60, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xff,
+    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b,
+    0xff, 0xc2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xef, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xdf, 0xfa, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xbf, 0xfb, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
+    0xcb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x85,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfb, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xb0,
+
+    /* U+005B "[" */
+    0x1a, 0xdd, 0xdd, 0xd5, 0x1c, 0xff, 0xff, 0xf6,
+    0x1c, 0xff, 0x77, 0x73, 0x1c, 0xff, 0x0, 0x0,
+    0x1c, 0xff, 0x0, 0x0, 0x1c, 0xff, 0x0, 0x0,
+    0x1c, 0xff, 0x0, 0x0, 0x1c, 0xff, 0x0, 0x0,
+    0x1c, 0xff, 0x0, 0x0, 0x1c, 0xff, 0x0, 0x0,
+    0x1c, 0xff, 0x0, 0x0, 0x1c, 0xff, 0x0, 0x0,
+    0x1c, 0xff, 0x0, 0x0, 0x1c, 0xff, 0x0, 0x0,
+    0x1c, 0xff, 0x0, 0x0, 0x1c, 0xff, 0x0, 0x0,
+    0x1c, 0xff, 0x0, 0x0, 0x1c, 0xff, 0x0, 0x0,
+    0x1c, 0xff, 0x0, 0x0, 0x1c, 0xff, 0x0, 0x0,
+    0x1c, 0xff, 0x0, 0x0, 0x1c, 0xff, 0x0, 0x0,
+    0x1c, 0xff, 0x0, 0x0, 0x1c, 0xff, 0x0, 0x0,
+    0x1c, 0xff, 0x0, 0x0, 0x1c, 0xff, 0x0, 0x0,
+    0x1c, 0xff, 0x10, 0x0, 0x1c, 0xff, 0xdd, 0xd5,
+    0x1c, 0xff, 0xff, 0xf6, 0x5, 0x66, 0x66, 0x62,
+
+    /* U+005C "\\" */
+    0x22, 0x10, 0x0, 0x0, 0xc, 0xe6, 0x0, 0x0,
+    0x0, 0x8f, 0xa0, 0x0, 0x0, 0x4, 0xfd, 0x20,
+    0x0, 0x0, 0x1e, 0xf4, 0x0, 0x0, 0x0, 0xaf,
+    0x80, 0x0, 0x0, 0x6, 0xfc, 0x10, 0x0, 0x0,
+    0x3f, 0xf2, 0x0, 0x0, 0x1, 0xcf, 0x60, 0x0,
+    0x0, 0x9, 0xfa, 0x0, 0x0, 0x0, 0x5f, 0xe1,
+    0x0, 0x0, 0x2, 0xdf, 0x40, 0x0, 0x0, 0xb,
+    0xf8, 0x0, 0x0, 0x0, 0x7f, 0xc0, 0x0, 0x0,
+    0x3, 0xee, 0x20, 0x0, 0x0, 0xd, 0xf6, 0x0,
+    0x0, 0x0, 0x9f, 0xa0, 0x0, 0x0, 0x5, 0xfd,
+    0x10, 0x0, 0x0, 0x1f, 0xf4, 0x0, 0x0, 0x0,
+    0xbf, 0x70, 0x0, 0x0, 0x7, 0xfb, 0x0, 0x0,
+    0x0, 0x3f, 0xe2, 0x0, 0x0, 0x1, 0xdf, 0x50,
+    0x0, 0x0, 0x9, 0xf9, 0x0, 0x0, 0x0, 0x37,
+    0x50,
+
+    /* U+005D "]" */
+    0x5d, 0xdd, 0xdd, 0xb6, 0xff, 0xff, 0xfc, 0x37,
+    0x78, 0xef, 0xc0, 0x0, 0x1e, 0xfc, 0x0, 0x1,
+    0xef, 0xc0, 0x0, 0x1e, 0xfc, 0x0, 0x1, 0xef,
+    0xc0, 0x0, 0x1e, 0xfc, 0x0, 0x1, 0xef, 0xc0,
+    0x0, 0x1e, 0xfc, 0x0, 0x1, 0xef, 0xc0, 0x0,
+    0x1e, 0xfc, 0x0, 0x1, 0xef, 0xc0, 0x0, 0x1e,
+    0xfc, 0x0, 0x1, 0xef, 0xc0, 0x0, 0x1e, 0xfc,
+    0x0, 0x1, 0xef, 0xc0, 0x0, 0x1e, 0xfc, 0x0,
+    0x1, 0xef, 0xc0, 0x0, 0x1e, 0xfc, 0x0, 0x1,
+    0xef, 0xc0, 0x0, 0x1e, 0xfc, 0x0, 0x1, 0xef,
+    0xc0, 0x0, 0x1e, 0xfc, 0x0, 0x1, 0xef, 0xc0,
+    0x0, 0x1e, 0xfc, 0x0, 0x2, 0xef, 0xc5, 0xdd,
+    0xef, 0xfc, 0x6f, 0xff, 0xff, 0xc2, 0x66, 0x66,
+    0x65,
+
+    /* U+005E "^" */
+    0x0, 0x0, 0x0, 0x68, 0x60, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2e, 0xfe, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xef, 0xef, 0xe1, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xe6, 0xef, 0x60, 0x0, 0x0, 0x0, 0xc,
+    0xfb, 0x1b, 0xfc, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0x50, 0x5f, 0xf4, 0x0, 0x0, 0x0, 0xbf, 0xe1,
+    0x1, 0xdf, 0xb0, 0x0, 0x0, 0x3e, 0xf8, 0x0,
+    0x8, 0xfe, 0x30, 0x0, 0x9, 0xff, 0x20, 0x0,
+    0x2e, 0xf9, 0x0, 0x2, 0xef, 0xb0, 0x0, 0x0,
+    0xbf, 0xe2, 0x0, 0x7f, 0xf5, 0x0, 0x0, 0x4,
+    0xff, 0x80, 0x1d, 0xfd, 0x10, 0x0, 0x0, 0xd,
+    0xfd, 0x10,
+
+    /* U+005F "_" */
+    0x49, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x92, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xe3, 0x36, 0x66, 0x66, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x61,
+
+    /* U+0060 "`" */
+    0x13, 0x33, 0x10, 0x2, 0xde, 0xe7, 0x0, 0x5,
+    0xef, 0xd1, 0x0, 0x7, 0xff, 0x60, 0x0, 0x9,
+    0xfc, 0x10, 0x0, 0x14, 0x41,
+
+    /* U+0061 "a" */
+    0x0, 0x0, 0x5, 0xac, 0xee, 0xda, 0x61, 0x0,
+    0x0, 0x0, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xd4,
+    0x0, 0x0, 0x4e, 0xff, 0xb7, 0x67, 0xae, 0xff,
+    0xd1, 0x0, 0x1b, 0xff, 0x60, 0x0, 0x0, 0x3d,
+    0xff, 0x50, 0x3, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x7f, 0xf8, 0x0, 0x15, 0x74, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x12, 0x8f, 0xf8, 0x0, 0x0, 0x1, 0x25, 0x79,
+    0xbe, 0xff, 0xff, 0x80, 0x0, 0x5, 0xcf, 0xff,
+    0xff, 0xfe, 0xdf, 0xf8, 0x0, 0x8, 0xff, 0xfe,
+    0xdb, 0x96, 0x35, 0xff, 0x80, 0x5, 0xff, 0xe7,
+    0x21, 0x0, 0x0, 0x5f, 0xf8, 0x0, 0xaf, 0xf7,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0x80, 0x1c, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0xbf, 0xf8, 0x0, 0xbf,
+    0xf5, 0x0, 0x0, 0x0, 0x6f, 0xff, 0x90, 0x7,
+    0xff, 0xd4, 0x0, 0x2, 0x8e, 0xff, 0xfa, 0x0,
+    0x1c, 0xff, 0xec, 0xbc, 0xef, 0xe7, 0xdf, 0xd0,
+    0x0, 0x2b, 0xff, 0xff, 0xff, 0xa2, 0xb, 0xff,
+    0x30, 0x0, 0x2, 0x57, 0x64, 0x10, 0x0, 0x11,
+    0x10,
+
+    /* U+0062 "b" */
+    0x1b, 0xdb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1c, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1c, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1c, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1c, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1c, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1c, 0xfd, 0x2, 0x9c, 0xed, 0x93, 0x0, 0x0,
+    0x1c, 0xfd, 0x6e, 0xff, 0xff, 0xff, 0x91, 0x0,
+    0x1c, 0xff, 0xff, 0xc7, 0x6a, 0xef, 0xf9, 0x0,
+    0x1c, 0xff, 0xf8, 0x10, 0x0, 0x4e, 0xff, 0x40,
+    0x1c, 0xff, 0xa0, 0x0, 0x0, 0x5, 0xff, 0xb0,
+    0x1c, 0xff, 0x30, 0x0, 0x0, 0x1, 0xcf, 0xf1,
+    0x1c, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf5,
+    0x1c, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf7,
+    0x1c, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf7,
+    0x1c, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf7,
+    0x1c, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf5,
+    0x1c, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf2,
+    0x1c, 0xff, 0x40, 0x0, 0x0, 0x3, 0xef, 0xd0,
+    0x1c, 0xff, 0xc1, 0x0, 0x0, 0x1a, 0xff, 0x70,
+    0x1c, 0xff, 0xfb, 0x41, 0x3, 0xaf, 0xfc, 0x10,
+    0x1c, 0xfb, 0xdf, 0xed, 0xde, 0xff, 0xc2, 0x0,
+    0x1c, 0xfa, 0x2b, 0xff, 0xff, 0xf9, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x36, 0x75, 0x10, 0x0, 0x0,
+
+    /* U+0063 "c" */
+    0x0, 0x0, 0x38, 0xce, 0xdb, 0x71, 0x0, 0x0,
+    0x1, 0xaf, 0xff, 0xff, 0xff, 0xe5, 0x0, 0x1,
+    0xbf, 0xfe, 0x96, 0x7b, 0xff, 0xe4, 0x0, 0x8f,
+    0xfc, 0x20, 0x0, 0x7, 0xff, 0xc1, 0x2d, 0xfe,
+    0x20, 0x0, 0x0, 0x1b, 0xff, 0x35, 0xff, 0x90,
+    0x0, 0x0, 0x0, 0x4a, 0x72, 0x8f, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xbf, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xf4, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x3e, 0xc6, 0x3f, 0xfb, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0x61, 0xcf, 0xf6, 0x0, 0x0, 0x2, 0xdf,
+    0xe2, 0x4, 0xef, 0xe7, 0x20, 0x14, 0xcf, 0xf8,
+    0x0, 0x6, 0xff, 0xfe, 0xdd, 0xef, 0xfa, 0x10,
+    0x0, 0x4, 0xcf, 0xff, 0xff, 0xe7, 0x10, 0x0,
+    0x0, 0x0, 0x25, 0x76, 0x40, 0x0, 0x0,
+
+    /* U+0064 "d" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4d, 0xd6,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8,
+    0x0, 0x0, 0x6, 0xbd, 0xeb, 0x60, 0x5f, 0xf8,
+    0x0, 0x3, 0xdf, 0xff, 0xff, 0xfb, 0x6f, 0xf8,
+    0x0, 0x2d, 0xff, 0xc8, 0x69, 0xdf, 0xef, 0xf8,
+    0x0, 0xaf, 0xfa, 0x10, 0x0, 0x2c, 0xff, 0xf8,
+    0x3, 0xef, 0xd1, 0x0, 0x0, 0x3, 0xef, 0xf8,
+    0x7, 0xff, 0x70, 0x0, 0x0, 0x0, 0x9f, 0xf8,
+    0xa, 0xff, 0x30, 0x0, 0x0, 0x0, 0x5f, 0xf8,
+    0x1c, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x3f, 0xf8,
+    0x1d, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x2e, 0xf8,
+    0x1c, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x2e, 0xf8,
+    0xb, 0xff, 0x20, 0x0, 0x0, 0x0, 0x3f, 0xf8,
+    0x9, 0xff, 0x50, 0x0, 0x0, 0x0, 0x5f, 0xf8,
+    0x4, 0xff, 0xa0, 0x0, 0x0, 0x0, 0xaf, 0xf8,
+    0x1, 0xcf, 0xf5, 0x0, 0x0, 0x5, 0xff, 0xf8,
+    0x0, 0x5e, 0xfe, 0x72, 0x2, 0x6e, 0xff, 0xf8,
+    0x0, 0x7, 0xff, 0xfd, 0xdd, 0xff, 0xaf, 0xf8,
+    0x0, 0x0, 0x4d, 0xff, 0xff, 0xe7, 0x3e, 0xf8,
+    0x0, 0x0, 0x0, 0x36, 0x75, 0x10, 0x0, 0x0,
+
+    /* U+0065 "e" */
+    0x0, 0x0, 0x3, 0x8c, 0xee, 0xb7, 0x10, 0x0,
+    0x0, 0x0, 0x19, 0xff, 0xff, 0xff, 0xfe, 0x60,
+    0x0, 0x0, 0x1a, 0xff, 0xea, 0x77, 0xae, 0xff,
+    0x60, 0x0, 0x7, 0xff, 0xd3, 0x0, 0x0, 0x4e,
+    0xfe, 0x30, 0x2, 0xdf, 0xe3, 0x0, 0x0, 0x0,
+    0x5f, 0xfa, 0x0, 0x6f, 0xfa, 0x0, 0x0, 0x0,
+    0x1, 0xcf, 0xf1, 0x9, 0xff, 0x50, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0x40, 0xbf, 0xfb, 0x99, 0x99,
+    0x99, 0x99, 0xcf, 0xf6, 0x1c, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x70, 0xcf, 0xfb, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xa5, 0xb, 0xff, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0x11, 0x0, 0x4, 0xff,
+    0xb0, 0x0, 0x0, 0x0, 0x1c, 0xfd, 0x30, 0x1c,
+    0xff, 0x70, 0x0, 0x0, 0x7, 0xff, 0xd0, 0x0,
+    0x5e, 0xff, 0x93, 0x10, 0x28, 0xef, 0xf5, 0x0,
+    0x0, 0x6e, 0xff, 0xed, 0xde, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x3b, 0xff, 0xff, 0xff, 0xc5, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0x57, 0x75, 0x20, 0x0,
+    0x0,
+
+    /* U+0066 "f" */
+    0x0, 0x0, 0x1, 0x23, 0x21, 0x0, 0x0, 0x6,
+    0xde, 0xee, 0xc1, 0x0, 0x7, 0xff, 0xff, 0xfb,
+    0x0, 0x1, 0xdf, 0xfb, 0x77, 0x50, 0x0, 0x3e,
+    0xfc, 0x0, 0x0, 0x0, 0x4, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x4f, 0xf9, 0x0, 0x0, 0x4, 0x58,
+    0xff, 0xb5, 0x54, 0x0, 0xaf, 0xff, 0xff, 0xff,
+    0xc1, 0x9, 0xcd, 0xff, 0xec, 0xca, 0x0, 0x0,
+    0x4f, 0xf9, 0x0, 0x0, 0x0, 0x4, 0xff, 0x90,
+    0x0, 0x0, 0x0, 0x4f, 0xf9, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0x90, 0x0, 0x0, 0x0, 0x4f, 0xf9,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0x90, 0x0, 0x0,
+    0x0, 0x4f, 0xf9, 0x0, 0x0, 0x0, 0x4, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x4f, 0xf9, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0x90, 0x0, 0x0, 0x0, 0x4f,
+    0xf9, 0x0, 0x0, 0x0, 0x4, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x4f, 0xf9, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0x90, 0x0, 0x0, 0x0, 0x14, 0x42, 0x0,
+    0x0, 0x0,
+
+    /* U+0067 "g" */
+    0x0, 0x0, 0x6, 0xbd, 0xec, 0x71, 0x17, 0x85,
+    0x0, 0x3, 0xdf, 0xff, 0xff, 0xfd, 0x5d, 0xfa,
+    0x0, 0x2d, 0xff, 0xd8, 0x69, 0xdf, 0xee, 0xfa,
+    0x0, 0xaf, 0xfa, 0x10, 0x0, 0x2b, 0xff, 0xfa,
+    0x3, 0xff, 0xc1, 0x0, 0x0, 0x2, 0xdf, 0xfa,
+    0x8, 0xff, 0x60, 0x0, 0x0, 0x0, 0x7f, 0xfa,
+    0xb, 0xff, 0x20, 0x0, 0x0, 0x0, 0x3f, 0xfa,
+    0x1d, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x2e, 0xfa,
+    0x1e, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x2d, 0xfa,
+    0x1d, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x2d, 0xfa,
+    0x1c, 0xff, 0x20, 0x0, 0x0, 0x0, 0x3f, 0xfa,
+    0x9, 0xff, 0x50, 0x0, 0x0, 0x0, 0x6f, 0xfa,
+    0x4, 0xff, 0xb0, 0x0, 0x0, 0x1, 0xcf, 0xfa,
+    0x1, 0xbf, 0xf8, 0x10, 0x0, 0x19, 0xff, 0xfa,
+    0x0, 0x3e, 0xff, 0xb6, 0x56, 0xbf, 0xff, 0xfa,
+    0x0, 0x5, 0xef, 0xff, 0xff, 0xfd, 0x7f, 0xfa,
+    0x0, 0x0, 0x28, 0xdf, 0xfd, 0x92, 0x3f, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf8,
+    0x3, 0x64, 0x10, 0x0, 0x0, 0x0, 0x6f, 0xf6,
+    0x5, 0xff, 0x70, 0x0, 0x0, 0x1, 0xcf, 0xf3,
+    0x2, 0xef, 0xe3, 0x0, 0x0, 0x19, 0xff, 0xb0,
+    0x0, 0x9f, 0xfe, 0xa8, 0x79, 0xdf, 0xfe, 0x30,
+    0x0, 0x19, 0xef, 0xff, 0xff, 0xff, 0xc3, 0x0,
+    0x0, 0x0, 0x37, 0xbc, 0xdc, 0x95, 0x0, 0x0,
+
+    /* U+0068 "h" */
+    0x1b, 0xdc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xcf, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1c,
+    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xcf,
+    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xe0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xfe, 0x1,
+    0x7b, 0xed, 0xb7, 0x10, 0x1, 0xcf, 0xe4, 0xef,
+    0xff, 0xff, 0xfd, 0x30, 0x1c, 0xff, 0xef, 0xd9,
+    0x8a, 0xef, 0xfc, 0x11, 0xcf, 0xff, 0x71, 0x0,
+    0x4, 0xef, 0xf4, 0x1c, 0xff, 0x90, 0x0, 0x0,
+    0x8, 0xff, 0x71, 0xcf, 0xf3, 0x0, 0x0, 0x0,
+    0x4f, 0xf9, 0x1c, 0xff, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0x91, 0xcf, 0xe0, 0x0, 0x0, 0x0, 0x3f,
+    0xfa, 0x1c, 0xfe, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0xa1, 0xcf, 0xe0, 0x0, 0x0, 0x0, 0x3f, 0xfa,
+    0x1c, 0xfe, 0x0, 0x0, 0x0, 0x3, 0xff, 0xa1,
+    0xcf, 0xe0, 0x0, 0x0, 0x0, 0x3f, 0xfa, 0x1c,
+    0xfe, 0x0, 0x0, 0x0, 0x3, 0xff, 0xa1, 0xcf,
+    0xe0, 0x0, 0x0, 0x0, 0x3f, 0xfa, 0x1c, 0xfe,
+    0x0, 0x0, 0x0, 0x3, 0xff, 0xa1, 0xcf, 0xe0,
+    0x0, 0x0, 0x0, 0x3f, 0xfa, 0x1c, 0xfe, 0x0,
+    0x0, 0x0, 0x3, 0xff, 0xa0,
+
+    /* U+0069 "i" */
+    0x1a, 0xdc, 0x1c, 0xfe, 0x1c, 0xfe, 0x4, 0x55,
+    0x0, 0x0, 0x0, 0x0, 0x6, 0x87, 0x1c, 0xfe,
+    0x1c, 0xfe, 0x1c, 0xfe, 0x1c, 0xfe, 0x1c, 0xfe,
+    0x1c, 0xfe, 0x1c, 0xfe, 0x1c, 0xfe, 0x1c, 0xfe,
+    0x1c, 0xfe, 0x1c, 0xfe, 0x1c, 0xfe, 0x1c, 0xfe,
+    0x1c, 0xfe, 0x1c, 0xfe, 0x1c, 0xfe,
+
+    /* U+006A "j" */
+    0x0, 0x1, 0xbd, 0xb0, 0x0, 0x1c, 0xfd, 0x0,
+    0x1, 0xcf, 0xd0, 0x0, 0x5, 0x65, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x78,
+    0x70, 0x0, 0x1c, 0xfd, 0x0, 0x1, 0xcf, 0xd0,
+    0x0, 0x1c, 0xfd, 0x0, 0x1, 0xcf, 0xd0, 0x0,
+    0x1c, 0xfd, 0x0, 0x1, 0xcf, 0xd0, 0x0, 0x1c,
+    0xfd, 0x0, 0x1, 0xcf, 0xd0, 0x0, 0x1c, 0xfd,
+    0x0, 0x1, 0xcf, 0xd0, 0x0, 0x1c, 0xfd, 0x0,
+    0x1, 0xcf, 0xd0, 0x0, 0x1c, 0xfd, 0x0, 0x1,
+    0xcf, 0xd0, 0x0, 0x1c, 0xfd, 0x0, 0x1, 0xcf,
+    0xd0, 0x0, 0x1c, 0xfd, 0x0, 0x1, 0xdf, 0xd0,
+    0x0, 0x2d, 0xfc, 0x0, 0x4, 0xff, 0xb1, 0xaa,
+    0xdf, 0xf7, 0x4f, 0xff, 0xfc, 0x14, 0xbd, 0xc8,
+    0x20,
+
+    /* U+006B "k" */
+    0x1a, 0xdc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xcf, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1c,
+    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xcf,
+    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xe0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xfe, 0x0,
+    0x0, 0x0, 0x58, 0x87, 0x1, 0xcf, 0xe0, 0x0,
+    0x0, 0x7f, 0xfe, 0x40, 0x1c, 0xfe, 0x0, 0x0,
+    0x6f, 0xfd, 0x40, 0x1, 0xcf, 0xe0, 0x0, 0x7f,
+    0xfd, 0x30, 0x0, 0x1c, 0xfe, 0x0, 0x7e, 0xfd,
+    0x30, 0x0, 0x1, 0xcf, 0xe0, 0x6f, 0xfd, 0x30,
+    0x0, 0x0, 0x1c, 0xfe, 0x6f, 0xfe, 0x30, 0x0,
+    0x0, 0x1, 0xcf, 0xff, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0x1c, 0xff, 0xfd, 0xef, 0xe3, 0x0, 0x0,
+    0x1, 0xcf, 0xfc, 0x27, 0xff, 0xc1, 0x0, 0x0,
+    0x1c, 0xfe, 0x20, 0x1b, 0xff, 0x80, 0x0, 0x1,
+    0xcf, 0xe0, 0x0, 0x3e, 0xfe, 0x30, 0x0, 0x1c,
+    0xfe, 0x0, 0x0, 0x8f, 0xfc, 0x10, 0x1, 0xcf,
+    0xe0, 0x0, 0x1, 0xcf, 0xf8, 0x0, 0x1c, 0xfe,
+    0x0, 0x0, 0x4, 0xff, 0xe4, 0x1, 0xcf, 0xe0,
+    0x0, 0x0, 0x8, 0xff, 0xc1, 0x1c, 0xfe, 0x0,
+    0x0, 0x0, 0x1d, 0xff, 0x80,
+
+    /* U+006C "l" */
+    0x1b, 0xdb, 0x1d, 0xfd, 0x1d, 0xfd, 0x1d, 0xfd,
+    0x1d, 0xfd, 0x1d, 0xfd, 0x1d, 0xfd, 0x1d, 0xfd,
+    0x1d, 0xfd, 0x1d, 0xfd, 0x1d, 0xfd, 0x1d, 0xfd,
+    0x1d, 0xfd, 0x1d, 0xfd, 0x1d, 0xfd, 0x1d, 0xfd,
+    0x1d, 0xfd, 0x1d, 0xfd, 0x1d, 0xfd, 0x1d, 0xfd,
+    0x1d, 0xfd, 0x1d, 0xfd, 0x1d, 0xfd,
+
+    /* U+006D "m" */
+    0x16, 0x85, 0x2, 0x8c, 0xed, 0xa4, 0x0, 0x2,
+    0x9d, 0xdc, 0x92, 0x0, 0x1c, 0xf9, 0x5e, 0xff,
+    0xff, 0xff, 0x60, 0x6f, 0xff, 0xff, 0xfe, 0x50,
+    0x1c, 0xfc, 0xef, 0xc8, 0x8c, 0xff, 0xe7, 0xfe,
+    0xb8, 0x9d, 0xff, 0xd1, 0x1c, 0xff, 0xf6, 0x10,
+    0x1, 0xbf, 0xff, 0xe4, 0x0, 0x2, 0xdf, 0xf5,
+    0x1c, 0xff, 0x90, 0x0, 0x0, 0x4f, 0xff, 0x60,
+    0x0, 0x0, 0x6f, 0xf8, 0x1c, 0xff, 0x40, 0x0,
+    0x0, 0x2f, 0xfe, 0x10, 0x0, 0x0, 0x4f, 0xf9,
+    0x1c, 0xff, 0x10, 0x0, 0x0, 0x1e, 0xfc, 0x10,
+    0x0, 0x0, 0x3f, 0xf9, 0x1c, 0xfe, 0x0, 0x0,
+    0x0, 0x1e, 0xfb, 0x0, 0x0, 0x0, 0x3f, 0xf9,
+    0x1c, 0xfe, 0x0, 0x0, 0x0, 0x1e, 0xfb, 0x0,
+    0x0, 0x0, 0x3f, 0xf9, 0x1c, 0xfe, 0x0, 0x0,
+    0x0, 0x1e, 0xfb, 0x0, 0x0, 0x0, 0x3f, 0xf9,
+    0x1c, 0xfe, 0x0, 0x0, 0x0, 0x1e, 0xfb, 0x0,
+    0x0, 0x0, 0x3f, 0xf9, 0x1c, 0xfe, 0x0, 0x0,
+    0x0, 0x1e, 0xfb, 0x0, 0x0, 0x0, 0x3f, 0xf9,
+    0x1c, 0xfe, 0x0, 0x0, 0x0, 0x1e, 0xfb, 0x0,
+    0x0, 0x0, 0x3f, 0xf9, 0x1c, 0xfe, 0x0, 0x0,
+    0x0, 0x1e, 0xfb, 0x0, 0x0, 0x0, 0x3f, 0xf9,
+    0x1c, 0xfe, 0x0, 0x0, 0x0, 0x1e, 0xfb, 0x0,
+    0x0, 0x0, 0x3f, 0xf9, 0x1c, 0xfe, 0x0, 0x0,
+    0x0, 0x1e, 0xfb, 0x0, 0x0, 0x0, 0x3f, 0xf9,
+    0x1c, 0xfe, 0x0, 0x0, 0x0, 0x1e, 0xfb, 0x0,
+    0x0, 0x0, 0x3f, 0xf9,
+
+    /* U+006E "n" */
+    0x16, 0x85, 0x1, 0x7c, 0xdd, 0xb6, 0x10, 0x1,
+    0xcf, 0x94, 0xef, 0xff, 0xff, 0xfd, 0x30, 0x1c,
+    0xfc, 0xef, 0xd9, 0x8a, 0xef, 0xfc, 0x11, 0xcf,
+    0xff, 0x71, 0x0, 0x4, 0xef, 0xf4, 0x1c, 0xff,
+    0x90, 0x0, 0x0, 0x8, 0xff, 0x71, 0xcf, 0xf3,
+    0x0, 0x0, 0x0, 0x5f, 0xf8, 0x1c, 0xff, 0x0,
+    0x0, 0x0, 0x3, 0xff, 0x91, 0xcf, 0xe0, 0x0,
+    0x0, 0x0, 0x3f, 0xf9, 0x1c, 0xfe, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0x91, 0xcf, 0xe0, 0x0, 0x0,
+    0x0, 0x3f, 0xf9, 0x1c, 0xfe, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0x91, 0xcf, 0xe0, 0x0, 0x0, 0x0,
+    0x3f, 0xf9, 0x1c, 0xfe, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0x91, 0xcf, 0xe0, 0x0, 0x0, 0x0, 0x3f,
+    0xf9, 0x1c, 0xfe, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0x91, 0xcf, 0xe0, 0x0, 0x0, 0x0, 0x3f, 0xf9,
+    0x1c, 0xfe, 0x0, 0x0, 0x0, 0x3, 0xff, 0x90,
+
+    /* U+006F "o" */
+    0x0, 0x0, 0x3, 0x9c, 0xde, 0xb7, 0x20, 0x0,
+    0x0, 0x0, 0x2a, 0xff, 0xff, 0xff, 0xfe, 0x70,
+    0x0, 0x0, 0x2c, 0xff, 0xea, 0x77, 0xbe, 0xff,
+    0x80, 0x0, 0xa, 0xff, 0xc2, 0x0, 0x0, 0x5e,
+    0xff, 0x50, 0x3, 0xef, 0xd2, 0x0, 0x0, 0x0,
+    0x6f, 0xfd, 0x0, 0x8f, 0xf7, 0x0, 0x0, 0x0,
+    0x1, 0xcf, 0xf3, 0xb, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0x61, 0xcf, 0xe1, 0x0, 0x0,
+    0x0, 0x0, 0x5f, 0xf8, 0x1d, 0xfd, 0x10, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0x91, 0xdf, 0xe1, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xf8, 0x1c, 0xff, 0x20,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0x70, 0xaf, 0xf4,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xf5, 0x6, 0xff,
+    0xa0, 0x0, 0x0, 0x0, 0x2d, 0xff, 0x10, 0x1d,
+    0xff, 0x50, 0x0, 0x0, 0x1a, 0xff, 0xa0, 0x0,
+    0x6f, 0xfe, 0x72, 0x1, 0x3a, 0xff, 0xe2, 0x0,
+    0x0, 0x7f, 0xff, 0xed, 0xde, 0xff, 0xd4, 0x0,
+    0x0, 0x0, 0x4c, 0xff, 0xff, 0xfe, 0x92, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0x57, 0x64, 0x10, 0x0,
+    0x0,
+
+    /* U+0070 "p" */
+    0x6, 0x75, 0x2, 0x8b, 0xcb, 0x82, 0x0, 0x0,
+    0x1c, 0xfa, 0x4e, 0xff, 0xff, 0xff, 0x81, 0x0,
+    0x1c, 0xfd, 0xef, 0xc7, 0x69, 0xef, 0xf8, 0x0,
+    0x1c, 0xff, 0xf8, 0x10, 0x0, 0x4d, 0xff, 0x40,
+    0x1c, 0xff, 0xb0, 0x0, 0x0, 0x5, 0xff, 0xb0,
+    0x1c, 0xff, 0x40, 0x0, 0x0, 0x1, 0xcf, 0xf1,
+    0x1c, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf5,
+    0x1c, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf7,
+    0x1c, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf7,
+    0x1c, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf7,
+    0x1c, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf6,
+    0x1c, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf3,
+    0x1c, 0xff, 0x50, 0x0, 0x0, 0x2, 0xef, 0xd0,
+    0x1c, 0xff, 0xc1, 0x0, 0x0, 0x1a, 0xff, 0x70,
+    0x1c, 0xff, 0xfc, 0x41, 0x13, 0xaf, 0xfc, 0x10,
+    0x1c, 0xfe, 0xdf, 0xed, 0xde, 0xff, 0xd3, 0x0,
+    0x1c, 0xfe, 0x2a, 0xff, 0xff, 0xf9, 0x20, 0x0,
+    0x1c, 0xfe, 0x0, 0x36, 0x75, 0x10, 0x0, 0x0,
+    0x1c, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1c, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1c, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1c, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1c, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0x65, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+0071 "q" */
+    0x0, 0x0, 0x5, 0xac, 0xca, 0x50, 0x16, 0x74,
+    0x0, 0x2, 0xcf, 0xff, 0xff, 0xfb, 0x4e, 0xf8,
+    0x0, 0x2c, 0xff, 0xc7, 0x69, 0xef, 0xde, 0xf8,
+    0x0, 0x9f, 0xfa, 0x10, 0x0, 0x2c, 0xff, 0xf8,
+    0x3, 0xef, 0xd1, 0x0, 0x0, 0x3, 0xef, 0xf8,
+    0x7, 0xff, 0x70, 0x0, 0x0, 0x0, 0x9f, 0xf8,
+    0xa, 0xff, 0x30, 0x0, 0x0, 0x0, 0x5f, 0xf8,
+    0xc, 0xff, 0x20, 0x0, 0x0, 0x0, 0x3e, 0xf8,
+    0x1c, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x2e, 0xf8,
+    0x1c, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x2e, 0xf8,
+    0xb, 0xff, 0x20, 0x0, 0x0, 0x0, 0x3f, 0xf8,
+    0x9, 0xff, 0x50, 0x0, 0x0, 0x0, 0x5f, 0xf8,
+    0x4, 0xff, 0xb0, 0x0, 0x0, 0x0, 0xaf, 0xf8,
+    0x1, 0xcf, 0xf5, 0x0, 0x0, 0x5, 0xff, 0xf8,
+    0x0, 0x4e, 0xfe, 0x72, 0x1, 0x6e, 0xff, 0xf8,
+    0x0, 0x6, 0xef, 0xfd, 0xdd, 0xff, 0xcf, 0xf8,
+    0x0, 0x0, 0x3c, 0xff, 0xff, 0xe7, 0x5f, 0xf8,
+    0x0, 0x0, 0x0, 0x36, 0x75, 0x10, 0x5f, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x26, 0x63,
+
+    /* U+0072 "r" */
+    0x17, 0x85, 0x6, 0xcd, 0xb5, 0x1d, 0xf9, 0x7f,
+    0xff, 0xfd, 0x1d, 0xfb, 0xef, 0xee, 0xf8, 0x1d,
+    0xff, 0xf8, 0x22, 0x52, 0x1d, 0xff, 0xa0, 0x0,
+    0x0, 0x1d, 0xff, 0x40, 0x0, 0x0, 0x1d, 0xff,
+    0x10, 0x0, 0x0, 0x1d, 0xfe, 0x0, 0x0, 0x0,
+    0x1d, 0xfd, 0x0, 0x0, 0x0, 0x1d, 0xfd, 0x0,
+    0x0, 0x0, 0x1d, 0xfd, 0x0, 0x0, 0x0, 0x1d,
+    0xfd, 0x0, 0x0, 0x0, 0x1d, 0xfd, 0x0, 0x0,
+    0x0, 0x1d, 0xfd, 0x0, 0x0, 0x0, 0x1d, 0xfd,
+    0x0, 0x0, 0x0, 0x1d, 0xfd, 0x0, 0x0, 0x0,
+    0x1d, 0xfd, 0x0, 0x0, 0x0,
+
+    /* U+0073 "s" */
+    0x0, 0x0, 0x5a, 0xce, 0xdb, 0x82, 0x0, 0x0,
+    0x2, 0xcf, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x1,
+    0xbf, 0xfb, 0x76, 0x7a, 0xef, 0xf6, 0x0, 0x5f,
+    0xf9, 0x0, 0x0, 0x6, 0xff, 0xc1, 0x8, 0xff,
+    0x30, 0x0, 0x0, 0xb, 0xdb, 0x10, 0x8f, 0xf8,
+    0x0, 0x0, 0x0, 0x11, 0x10, 0x4, 0xff, 0xfc,
+    0x72, 0x10, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
+    0xfd, 0x95, 0x10, 0x0, 0x0, 0x17, 0xdf, 0xff,
+    0xff, 0xfd, 0x81, 0x0, 0x0, 0x1, 0x49, 0xcf,
+    0xff, 0xff, 0xb1, 0x0, 0x0, 0x0, 0x1, 0x26,
+    0xbf, 0xff, 0x70, 0x1, 0x30, 0x0, 0x0, 0x0,
+    0x7f, 0xfa, 0x1c, 0xfd, 0x10, 0x0, 0x0, 0x2,
+    0xff, 0xb0, 0x9f, 0xf7, 0x0, 0x0, 0x0, 0x6f,
+    0xf8, 0x3, 0xef, 0xe7, 0x20, 0x2, 0x6e, 0xfe,
+    0x30, 0x7, 0xff, 0xfe, 0xdd, 0xdf, 0xfe, 0x60,
+    0x0, 0x5, 0xdf, 0xff, 0xff, 0xfc, 0x40, 0x0,
+    0x0, 0x0, 0x35, 0x77, 0x52, 0x0, 0x0,
+
+    /* U+0074 "t" */
+    0x0, 0x0, 0x23, 0x0, 0x0, 0x1, 0x7e, 0x60,
+    0x0, 0x0, 0x5f, 0xf6, 0x0, 0x0, 0x6, 0xff,
+    0x60, 0x0, 0x0, 0x6f, 0xf6, 0x0, 0x0, 0x6,
+    0xff, 0x60, 0x0, 0x5c, 0xdf, 0xfe, 0xcc, 0x37,
+    0xff, 0xff, 0xff, 0xf3, 0x36, 0x9f, 0xfa, 0x66,
+    0x10, 0x6, 0xff, 0x60, 0x0, 0x0, 0x6f, 0xf6,
+    0x0, 0x0, 0x6, 0xff, 0x60, 0x0, 0x0, 0x6f,
+    0xf6, 0x0, 0x0, 0x6, 0xff, 0x60, 0x0, 0x0,
+    0x6f, 0xf6, 0x0, 0x0, 0x6, 0xff, 0x60, 0x0,
+    0x0, 0x6f, 0xf6, 0x0, 0x0, 0x6, 0xff, 0x60,
+    0x0, 0x0, 0x5f, 0xf7, 0x0, 0x0, 0x5, 0xff,
+    0x90, 0x0, 0x0, 0x3f, 0xfe, 0xaa, 0x30, 0x1,
+    0xcf, 0xff, 0xf7, 0x0, 0x2, 0xae, 0xfe, 0x70,
+
+    /* U+0075 "u" */
+    0x16, 0x76, 0x0, 0x0, 0x0, 0x2, 0x77, 0x41,
+    0xdf, 0xd0, 0x0, 0x0, 0x0, 0x5f, 0xf8, 0x1d,
+    0xfd, 0x0, 0x0, 0x0, 0x5, 0xff, 0x81, 0xdf,
+    0xd0, 0x0, 0x0, 0x0, 0x5f, 0xf8, 0x1d, 0xfd,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0x81, 0xdf, 0xd0,
+    0x0, 0x0, 0x0, 0x5f, 0xf8, 0x1d, 0xfd, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0x81, 0xdf, 0xd0, 0x0,
+    0x0, 0x0, 0x5f, 0xf8, 0x1d, 0xfd, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0x81, 0xdf, 0xd0, 0x0, 0x0,
+    0x0, 0x5f, 0xf8, 0x1d, 0xfd, 0x0, 0x0, 0x0,
+    0x5, 0xff, 0x81, 0xdf, 0xd0, 0x0, 0x0, 0x0,
+    0x7f, 0xf8, 0x1c, 0xff, 0x10, 0x0, 0x0, 0xb,
+    0xff, 0x80, 0xbf, 0xf6, 0x0, 0x0, 0x5, 0xff,
+    0xf8, 0x6, 0xff, 0xe6, 0x21, 0x38, 0xee, 0xff,
+    0x80, 0x1c, 0xff, 0xfe, 0xde, 0xfe, 0x7e, 0xf8,
+    0x0, 0x2a, 0xff, 0xff, 0xfc, 0x42, 0xdf, 0x80,
+    0x0, 0x1, 0x57, 0x63, 0x0, 0x1, 0x10,
+
+    /* U+0076 "v" */
+    0x47, 0x73, 0x0, 0x0, 0x0, 0x0, 0x27, 0x74,
+    0x3f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf4,
+    0x1c, 0xfe, 0x20, 0x0, 0x0, 0x1, 0xdf, 0xc1,
+    0x7, 0xff, 0x70, 0x0, 0x0, 0x5, 0xff, 0x80,
+    0x2, 0xef, 0xc0, 0x0, 0x0, 0xb, 0xfe, 0x30,
+    0x0, 0xaf, 0xf2, 0x0, 0x0, 0x1f, 0xfb, 0x0,
+    0x0, 0x5f, 0xf8, 0x0, 0x0, 0x7f, 0xf5, 0x0,
+    0x0, 0x1d, 0xfd, 0x0, 0x0, 0xcf, 0xd1, 0x0,
+    0x0, 0x8, 0xff, 0x40, 0x3, 0xff, 0x90, 0x0,
+    0x0, 0x3, 0xef, 0x90, 0x8, 0xfe, 0x40, 0x0,
+    0x0, 0x0, 0xbf, 0xd1, 0x1d, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xf5, 0x4f, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x1e, 0xfa, 0x9f, 0xe1, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xfe, 0xef, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0xff, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xcf, 0xfd, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0,
+
+    /* U+0077 "w" */
+    0x67, 0x61, 0x0, 0x0, 0x0, 0x67, 0x61, 0x0,
+    0x0, 0x0, 0x67, 0x59, 0xff, 0x40, 0x0, 0x0,
+    0x3f, 0xff, 0x40, 0x0, 0x0, 0x3e, 0xf8, 0x4f,
+    0xf8, 0x0, 0x0, 0x6, 0xff, 0xf8, 0x0, 0x0,
+    0x7, 0xff, 0x41, 0xef, 0xc1, 0x0, 0x0, 0xaf,
+    0xff, 0xb0, 0x0, 0x0, 0xbf, 0xd0, 0xa, 0xff,
+    0x20, 0x0, 0x1d, 0xfe, 0xfe, 0x20, 0x0, 0x2e,
+    0xf9, 0x0, 0x6f, 0xf6, 0x0, 0x4, 0xff, 0x7f,
+    0xf5, 0x0, 0x5, 0xff, 0x40, 0x2, 0xef, 0xa0,
+    0x0, 0x8f, 0xe2, 0xef, 0x90, 0x0, 0xaf, 0xe1,
+    0x0, 0xb, 0xfe, 0x0, 0xb, 0xf9, 0xb, 0xfc,
+    0x10, 0x1d, 0xfa, 0x0, 0x0, 0x7f, 0xf3, 0x2,
+    0xef, 0x60, 0x8f, 0xf2, 0x4, 0xff, 0x50, 0x0,
+    0x3, 0xef, 0x70, 0x5f, 0xf2, 0x4, 0xff, 0x50,
+    0x8f, 0xe2, 0x0, 0x0, 0xc, 0xfc, 0x9, 0xfc,
+    0x0, 0x2d, 0xf9, 0x1c, 0xfb, 0x0, 0x0, 0x0,
+    0x8f, 0xe2, 0xcf, 0x90, 0x0, 0xbf, 0xd2, 0xff,
+    0x60, 0x0, 0x0, 0x4, 0xff, 0x7f, 0xf5, 0x0,
+    0x7, 0xff, 0x9f, 0xe2, 0x0, 0x0, 0x0, 0x1d,
+    0xfe, 0xfe, 0x20, 0x0, 0x3e, 0xff, 0xfb, 0x0,
+    0x0, 0x0, 0x0, 0x9f, 0xff, 0xb0, 0x0, 0x1,
+    0xdf, 0xff, 0x70, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0xf8, 0x0, 0x0, 0xa, 0xff, 0xe3, 0x0, 0x0,
+    0x0, 0x0, 0x1e, 0xff, 0x40, 0x0, 0x0, 0x6f,
+    0xfc, 0x0, 0x0, 0x0,
+
+    /* U+0078 "x" */
+    0x18, 0x88, 0x30, 0x0, 0x0, 0x2, 0x88, 0x81,
+    0x8, 0xff, 0xd1, 0x0, 0x0, 0xb, 0xff, 0x80,
+    0x1, 0xcf, 0xf8, 0x0, 0x0, 0x8f, 0xfb, 0x10,
+    0x0, 0x4e, 0xfe, 0x40, 0x4, 0xef, 0xd3, 0x0,
+    0x0, 0x7, 0xff, 0xc1, 0x1c, 0xff, 0x60, 0x0,
+    0x0, 0x1, 0xbf, 0xf7, 0x9f, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x2e, 0xff, 0xff, 0xc1, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xfe, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xdf, 0xfc, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x3e, 0xfe, 0xef, 0xe3, 0x0, 0x0,
+    0x0, 0x1, 0xcf, 0xf5, 0x5f, 0xfc, 0x10, 0x0,
+    0x0, 0x9, 0xff, 0xa0, 0xa, 0xff, 0x90, 0x0,
+    0x0, 0x5e, 0xfd, 0x20, 0x2, 0xdf, 0xe5, 0x0,
+    0x2, 0xdf, 0xf5, 0x0, 0x0, 0x5f, 0xfd, 0x20,
+    0xa, 0xff, 0xa0, 0x0, 0x0, 0xa, 0xff, 0xa0,
+    0x6f, 0xfd, 0x20, 0x0, 0x0, 0x2, 0xef, 0xf6,
+
+    /* U+0079 "y" */
+    0x37, 0x74, 0x0, 0x0, 0x0, 0x0, 0x17, 0x74,
+    0x2f, 0xfc, 0x10, 0x0, 0x0, 0x0, 0x7f, 0xf6,
+    0xb, 0xff, 0x40, 0x0, 0x0, 0x1, 0xcf, 0xe1,
+    0x6, 0xff, 0x90, 0x0, 0x0, 0x3, 0xff, 0x90,
+    0x2, 0xdf, 0xe1, 0x0, 0x0, 0x8, 0xff, 0x40,
+    0x0, 0x9f, 0xf5, 0x0, 0x0, 0xd, 0xfc, 0x10,
+    0x0, 0x4f, 0xfa, 0x0, 0x0, 0x4f, 0xf7, 0x0,
+    0x0, 0x1c, 0xfe, 0x20, 0x0, 0xaf, 0xe3, 0x0,
+    0x0, 0x7, 0xff, 0x60, 0x1, 0xef, 0xb0, 0x0,
+    0x0, 0x2, 0xef, 0xb0, 0x6, 0xff, 0x60, 0x0,
+    0x0, 0x0, 0xbf, 0xe3, 0xb, 0xfe, 0x10, 0x0,
+    0x0, 0x0, 0x5f, 0xf7, 0x2e, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x1e, 0xfb, 0x6f, 0xf4, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xfe, 0xcf, 0xd0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xff, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xcf, 0xff, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xd1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xef, 0x90, 0x0, 0x0, 0x0,
+    0x1, 0x10, 0x2b, 0xfe, 0x30, 0x0, 0x0, 0x0,
+    0x3, 0xed, 0xef, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xff, 0xff, 0xc1, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x9c, 0xc8, 0x10, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+007A "z" */
+    0x5, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x50,
+    0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1,
+    0x8, 0xcc, 0xcc, 0xcc, 0xcc, 0xcf, 0xff, 0x90,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xfb, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xef, 0xd2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4e, 0xfe, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xef, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2d, 0xff, 0x60, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xcf, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1b, 0xff, 0xa1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xfb, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xef, 0xe4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3e, 0xff, 0x95, 0x66, 0x66, 0x66, 0x66, 0x62,
+    0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
+    0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
+
+    /* U+007B "{" */
+    0x0, 0x0, 0x0, 0x1, 0x11, 0x0, 0x0, 0x0,
+    0x29, 0xde, 0xc1, 0x0, 0x0, 0x1c, 0xff, 0xfd,
+    0x10, 0x0, 0x6, 0xff, 0xc7, 0x60, 0x0, 0x0,
+    0xaf, 0xe2, 0x0, 0x0, 0x0, 0xc, 0xfc, 0x0,
+    0x0, 0x0, 0x0, 0xdf, 0xc0, 0x0, 0x0, 0x0,
+    0xd, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xb0,
+    0x0, 0x0, 0x0, 0xd, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0xdf, 0xb0, 0x0, 0x0, 0x0, 0x1e, 0xf9,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0x60, 0x0, 0x0,
+    0x1, 0xaf, 0xe2, 0x0, 0x0, 0x18, 0xcf, 0xf6,
+    0x0, 0x0, 0x1, 0xff, 0xe5, 0x0, 0x0, 0x0,
+    0x1f, 0xfe, 0x91, 0x0, 0x0, 0x0, 0x38, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x8, 0xff, 0x30, 0x0,
+    0x0, 0x0, 0x3e, 0xf7, 0x0, 0x0, 0x0, 0x1,
+    0xef, 0xa0, 0x0, 0x0, 0x0, 0xd, 0xfb, 0x0,
+    0x0, 0x0, 0x0, 0xdf, 0xb0, 0x0, 0x0, 0x0,
+    0xd, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xc0,
+    0x0, 0x0, 0x0, 0xc, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0xbf, 0xd0, 0x0, 0x0, 0x0, 0x9, 0xfe,
+    0x30, 0x0, 0x0, 0x0, 0x5f, 0xfe, 0xa8, 0x0,
+    0x0, 0x0, 0xbf, 0xff, 0xd1, 0x0, 0x0, 0x0,
+    0x7b, 0xdb, 0x10,
+
+    /* U+007C "|" */
+    0x2, 0x31, 0x2d, 0xe5, 0x2e, 0xf6, 0x2e, 0xf6,
+    0x2e, 0xf6, 0x2e, 0xf6, 0x2e, 0xf6, 0x2e, 0xf6,
+    0x2e, 0xf6, 0x2e, 0xf6, 0x2e, 0xf6, 0x2e, 0xf6,
+    0x2e, 0xf6, 0x2e, 0xf6, 0x2e, 0xf6, 0x2e, 0xf6,
+    0x2e, 0xf6, 0x2e, 0xf6, 0x2e, 0xf6, 0x2e, 0xf6,
+    0x2e, 0xf6, 0x2e, 0xf6, 0x2e, 0xf6, 0x2e, 0xf6,
+    0x2e, 0xf6, 0x2e, 0xf6, 0x2e, 0xf6, 0x2e, 0xf6,
+    0x2e, 0xf6, 0x2e, 0xf6, 0x2c, 0xd5,
+
+    /* U+007D "}" */
+    0x2, 0x10, 0x0, 0x0, 0x0, 0x4e, 0xdc, 0x70,
+    0x0, 0x0, 0x4f, 0xff, 0xf8, 0x0, 0x0, 0x27,
+    0x8e, 0xfe, 0x20, 0x0, 0x0, 0x6, 0xff, 0x50,
+    0x0, 0x0, 0x3, 0xef, 0x60, 0x0, 0x0, 0x3,
+    0xef, 0x70, 0x0, 0x0, 0x2, 0xef, 0x80, 0x0,
+    0x0, 0x2, 0xef, 0x80, 0x0, 0x0, 0x2, 0xef,
+    0x80, 0x0, 0x0, 0x2, 0xef, 0x90, 0x0, 0x0,
+    0x1, 0xdf, 0xa0, 0x0, 0x0, 0x0, 0xbf, 0xd1,
+    0x0, 0x0, 0x0, 0x6f, 0xf6, 0x0, 0x0, 0x0,
+    0xa, 0xff, 0xa5, 0x0, 0x0, 0x1, 0x8f, 0xfb,
+    0x0, 0x0, 0x2, 0xbf, 0xfb, 0x0, 0x0, 0x1d,
+    0xfd, 0x62, 0x0, 0x0, 0x7f, 0xe4, 0x0, 0x0,
+    0x0, 0xcf, 0xc0, 0x0, 0x0, 0x1, 0xef, 0xa0,
+    0x0, 0x0, 0x2, 0xef, 0x90, 0x0, 0x0, 0x2,
+    0xef, 0x80, 0x0, 0x0, 0x2, 0xef, 0x80, 0x0,
+    0x0, 0x2, 0xef, 0x80, 0x0, 0x0, 0x2, 0xef,
+    0x70, 0x0, 0x0, 0x3, 0xef, 0x60, 0x0, 0x0,
+    0x7, 0xff, 0x50, 0x0, 0x29, 0xbf, 0xfe, 0x10,
+    0x0, 0x4f, 0xff, 0xf6, 0x0, 0x0, 0x3d, 0xda,
+    0x40, 0x0, 0x0,
+
+    /* U+007E "~" */
+    0x1, 0x59, 0xba, 0x73, 0x10, 0x0, 0x0, 0x2,
+    0x32, 0xbf, 0xff, 0xff, 0xec, 0x61, 0x0, 0x5,
+    0xd6, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xeb, 0xac,
+    0xff, 0x69, 0xfb, 0x64, 0x6a, 0xef, 0xff, 0xff,
+    0xff, 0xe4, 0x86, 0x0, 0x0, 0x2, 0x7c, 0xef,
+    0xfe, 0xc4, 0x1, 0x0, 0x0, 0x0, 0x0, 0x13,
+    0x44, 0x30, 0x0,
+
+    /* U+00A0 " " */
+
+    /* U+00A1 "¡" */
+    0x27, 0x76, 0x14, 0xff, 0xd1, 0x4f, 0xfd, 0x13,
+    0xbb, 0xa1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0xb3, 0x0, 0xaf, 0x50, 0xb, 0xf6, 0x0, 0xcf,
+    0x70, 0xd, 0xf8, 0x0, 0xdf, 0x90, 0x1e, 0xfa,
+    0x2, 0xef, 0xc0, 0x3e, 0xfd, 0x3, 0xef, 0xd0,
+    0x4f, 0xfd, 0x15, 0xff, 0xe2, 0x5f, 0xfe, 0x36,
+    0xff, 0xe3, 0x6f, 0xfe, 0x36, 0xff, 0xe3, 0x6f,
+    0xfe, 0x32, 0x66, 0x61,
+
+    /* U+00A2 "¢" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x71, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xc1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xdd, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xfa, 0x0, 0x0,
+    0x0, 0x0, 0x17, 0xbd, 0xed, 0xf7, 0x0, 0x0,
+    0x0, 0x5, 0xef, 0xff, 0xff, 0xff, 0x91, 0x0,
+    0x0, 0x6f, 0xfe, 0xa6, 0x7f, 0xff, 0xfa, 0x0,
+    0x3, 0xef, 0xe5, 0x0, 0x5f, 0xad, 0xff, 0x40,
+    0x9, 0xff, 0x70, 0x0, 0xaf, 0x45, 0xff, 0x90,
+    0x1d, 0xfe, 0x10, 0x1, 0xde, 0x1, 0x98, 0x50,
+    0x2f, 0xfb, 0x0, 0x4, 0xf9, 0x0, 0x0, 0x0,
+    0x4f, 0xf9, 0x0, 0x8, 0xf5, 0x0, 0x0, 0x0,
+    0x5f, 0xf9, 0x0, 0x1c, 0xf1, 0x0, 0x0, 0x0,
+    0x4f, 0xf9, 0x0, 0x3e, 0xb0, 0x0, 0x0, 0x0,
+    0x3f, 0xfa, 0x0, 0x6f, 0x70, 0x0, 0x0, 0x0,
+    0x2e, 0xfd, 0x0, 0xaf, 0x30, 0x0, 0xbe, 0xc1,
+    0xb, 0xff, 0x32, 0xdc, 0x10, 0x2, 0xef, 0xc0,
+    0x5, 0xff, 0xb5, 0xf9, 0x0, 0x9, 0xff, 0x70,
+    0x1, 0xaf, 0xfe, 0xf5, 0x2, 0x9f, 0xfc, 0x10,
+    0x0, 0x2c, 0xff, 0xfd, 0xde, 0xff, 0xc2, 0x0,
+    0x0, 0x1, 0x9f, 0xff, 0xff, 0xf9, 0x20, 0x0,
+    0x0, 0x0, 0x7f, 0x96, 0x75, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0xce, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xd, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+00A3 "£" */
+    0x0, 0x0, 0x0, 0x2, 0x45, 0x42, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5c, 0xef, 0xff, 0xea, 0x30,
+    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xfe,
+    0x50, 0x0, 0x0, 0x8f, 0xfe, 0x72, 0x13, 0xaf,
+    0xfe, 0x30, 0x0, 0x3e, 0xfe, 0x40, 0x0, 0x0,
+    0x8f, 0xfa, 0x0, 0x7, 0xff, 0x90, 0x0, 0x0,
+    0x1, 0xdf, 0xf1, 0x0, 0xaf, 0xf5, 0x0, 0x0,
+    0x0, 0xa, 0xec, 0x20, 0xa, 0xff, 0x50, 0x0,
+    0x0, 0x0, 0x11, 0x10, 0x0, 0xaf, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x90,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xfd,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x56, 0xef,
+    0xf6, 0x55, 0x55, 0x10, 0x0, 0x0, 0x5f, 0xff,
+    0xff, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x5, 0xee,
+    0xef, 0xff, 0xee, 0xee, 0x20, 0x0, 0x0, 0x0,
+    0x3, 0xef, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1e, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xef, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3e, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xfe, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xef, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xcf, 0xc3, 0x33, 0x20, 0x0,
+    0x0, 0x1, 0x3, 0xcf, 0xfe, 0xef, 0xfd, 0xc9,
+    0x64, 0x48, 0xc3, 0x4f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x81, 0xde, 0x95, 0x21, 0x36,
+    0xbe, 0xff, 0xff, 0xf8, 0x3, 0x10, 0x0, 0x0,
+    0x0, 0x4, 0x77, 0x51, 0x0,
+
+    /* U+00A4 "¤" */
+    0x6, 0x50, 0x0, 0x0, 0x0, 0x0, 0x18, 0x30,
+    0x6e, 0xe6, 0x16, 0xac, 0xc9, 0x41, 0x9f, 0xd2,
+    0x5e, 0xff, 0xdf, 0xff, 0xff, 0xfd, 0xff, 0xd2,
+    0x5, 0xef, 0xff, 0xeb, 0xce, 0xff, 0xfd, 0x20,
+    0x1, 0xdf, 0xe7, 0x10, 0x3, 0xbf, 0xf8, 0x0,
+    0x5, 0xff, 0x80, 0x0, 0x0, 0x1c, 0xfe, 0x10,
+    0x9, 0xfe, 0x10, 0x0, 0x0, 0x6, 0xff, 0x50,
+    0xb, 0xfc, 0x0, 0x0, 0x0, 0x3, 0xff, 0x60,
+    0xb, 0xfd, 0x0, 0x0, 0x0, 0x3, 0xff, 0x60,
+    0x8, 0xff, 0x30, 0x0, 0x0, 0x8, 0xff, 0x30,
+    0x3, 0xef, 0xb1, 0x0, 0x0, 0x4e, 0xfc, 0x10,
+    0x1, 0xdf, 0xfc, 0x63, 0x48, 0xef, 0xf8, 0x0,
+    0x1a, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0x60,
+    0x9f, 0xfd, 0x8e, 0xff, 0xff, 0xd8, 0xef, 0xf4,
+    0x2d, 0xc2, 0x1, 0x46, 0x63, 0x0, 0x5e, 0xa0,
+    0x2, 0x20, 0x0, 0x0, 0x0, 0x0, 0x3, 0x10,
+
+    /* U+00A5 "¥" */
+    0xad, 0xd4, 0x0, 0x0, 0x0, 0x0, 0x1, 0xbd,
+    0xd6, 0x4f, 0xfc, 0x10, 0x0, 0x0, 0x0, 0x6,
+    0xff, 0xd1, 0xa, 0xff, 0x60, 0x0, 0x0, 0x0,
+    0x1d, 0xff, 0x50, 0x3, 0xef, 0xd1, 0x0, 0x0,
+    0x0, 0x7f, 0xfb, 0x0, 0x0, 0x8f, 0xf8, 0x0,
+    0x0, 0x2, 0xdf, 0xe3, 0x0, 0x0, 0x2d, 0xfe,
+    0x30, 0x0, 0x8, 0xff, 0x90, 0x0, 0x0, 0x6,
+    0xff, 0xa0, 0x0, 0x2f, 0xfe, 0x20, 0x0, 0x0,
+    0x0, 0xcf, 0xf5, 0x0, 0xaf, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xfc, 0x14, 0xff, 0xc1, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0x6b, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0xef, 0xfb,
+    0x0, 0x0, 0x0, 0x1d, 0xdd, 0xdd, 0xff, 0xff,
+    0xfe, 0xdd, 0xdd, 0x90, 0x1f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xb0, 0x6, 0x66, 0x66,
+    0x6b, 0xff, 0x86, 0x66, 0x66, 0x40, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0x40, 0x0, 0x0, 0x0, 0x3,
+    0x33, 0x33, 0x3a, 0xff, 0x73, 0x33, 0x33, 0x20,
+    0x1e, 0xee, 0xee, 0xef, 0xff, 0xfe, 0xee, 0xee,
+    0xa0, 0x1e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xa0, 0x0, 0x0, 0x0, 0x8, 0xff, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0x40, 0x0, 0x0, 0x0,
+
+    /* U+00A6 "¦" */
+    0x14, 0x42, 0x2e, 0xf6, 0x2e, 0xf6, 0x2e, 0xf6,
+    0x2e, 0xf6, 0x2e, 0xf6, 0x2e, 0xf6, 0x2e, 0xf6,
+    0x2e, 0xf6, 0x2e, 0xf6, 0x2e, 0xf6, 0x2e, 0xf6,
+    0x2e, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x17, 0x73, 0x2e, 0xf6,
+    0x2e, 0xf6, 0x2e, 0xf6, 0x2e, 0xf6, 0x2e, 0xf6,
+    0x2e, 0xf6, 0x2e, 0xf6, 0x2e, 0xf6, 0x2e, 0xf6,
+    0x2e, 0xf6, 0x2e, 0xf6, 0x2c, 0xd5,
+
+    /* U+00A7 "§" */
+    0x0, 0x0, 0x49, 0xcd, 0xca, 0x51, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0xff, 0xff, 0xfc, 0x20, 0x0,
+    0x0, 0x7f, 0xfe, 0x97, 0x8c, 0xff, 0xc1, 0x0,
+    0x1, 0xdf, 0xe3, 0x0, 0x1, 0xbf, 0xf7, 0x0,
+    0x3, 0xff, 0x90, 0x0, 0x0, 0x4f, 0xfb, 0x0,
+    0x3, 0xef, 0xa0, 0x0, 0x0, 0x1a, 0xa8, 0x0,
+    0x1, 0xdf, 0xe4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0xfa, 0x20, 0x0, 0x0, 0x0,
+    0x1, 0x8e, 0xfe, 0xff, 0xe7, 0x10, 0x0, 0x0,
+    0x1a, 0xfe, 0x54, 0xcf, 0xff, 0xc4, 0x0, 0x0,
+    0x5f, 0xf5, 0x0, 0x18, 0xff, 0xfe, 0x81, 0x0,
+    0xaf, 0xc1, 0x0, 0x0, 0x3c, 0xff, 0xfb, 0x10,
+    0xaf, 0xd1, 0x0, 0x0, 0x0, 0x8e, 0xff, 0x90,
+    0x8f, 0xf5, 0x0, 0x0, 0x0, 0x6, 0xef, 0xf1,
+    0x3e, 0xfe, 0x50, 0x0, 0x0, 0x0, 0x9f, 0xf4,
+    0x7, 0xff, 0xf9, 0x10, 0x0, 0x0, 0x5f, 0xf4,
+    0x0, 0x7e, 0xff, 0xd6, 0x0, 0x0, 0x9f, 0xf1,
+    0x0, 0x4, 0xdf, 0xff, 0xb3, 0x5, 0xef, 0x80,
+    0x0, 0x0, 0x18, 0xef, 0xfe, 0xae, 0xe8, 0x10,
+    0x0, 0x0, 0x0, 0x3b, 0xff, 0xfe, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x7e, 0xff, 0xc2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xdf, 0xf9, 0x0,
+    0x0, 0x11, 0x0, 0x0, 0x0, 0x2d, 0xfe, 0x20,
+    0x8, 0xdf, 0x40, 0x0, 0x0, 0x9, 0xff, 0x30,
+    0x7, 0xff, 0x90, 0x0, 0x0, 0xa, 0xff, 0x30,
+    0x3, 0xef, 0xe5, 0x0, 0x0, 0x6f, 0xfd, 0x10,
+    0x0, 0x7f, 0xff, 0xb8, 0x8b, 0xff, 0xf6, 0x0,
+    0x0, 0x7, 0xef, 0xff, 0xff, 0xfe, 0x60, 0x0,
+    0x0, 0x0, 0x27, 0xbc, 0xdb, 0x72, 0x0, 0x0,
+
+    /* U+00A8 "¨" */
+    0x1d, 0xdb, 0x10, 0x3d, 0xd9, 0x1f, 0xfd, 0x10,
+    0x3f, 0xfb, 0x1f, 0xfd, 0x10, 0x3f, 0xfb, 0x5,
+    0x54, 0x0, 0x15, 0x54,
+
+    /* U+00A9 "©" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0x7b, 0xdd, 0xdd, 0xa6, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xae, 0xff, 0xff, 0xff, 0xff,
+    0xe7, 0x10, 0x0, 0x0, 0x0, 0x0, 0x6e, 0xfe,
+    0x94, 0x20, 0x2, 0x5b, 0xef, 0xd4, 0x0, 0x0,
+    0x0, 0x8, 0xfe, 0x82, 0x0, 0x0, 0x0, 0x0,
+    0x3b, 0xfe, 0x50, 0x0, 0x0, 0x7f, 0xe5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x8f, 0xe3, 0x0,
+    0x3, 0xee, 0x50, 0x0, 0x16, 0xac, 0xca, 0x50,
+    0x0, 0x9, 0xfb, 0x0, 0xa, 0xf8, 0x0, 0x4,
+    0xdf, 0xfe, 0xef, 0xfb, 0x10, 0x1, 0xcf, 0x50,
+    0x2f, 0xd2, 0x0, 0x3e, 0xfb, 0x30, 0x4, 0xcf,
+    0xa0, 0x0, 0x5f, 0xc0, 0x7f, 0x90, 0x0, 0xaf,
+    0xb1, 0x0, 0x0, 0x2d, 0xd2, 0x0, 0xd, 0xe3,
+    0xbf, 0x40, 0x1, 0xef, 0x40, 0x0, 0x0, 0x2,
+    0x20, 0x0, 0x9, 0xf6, 0xde, 0x30, 0x3, 0xfd,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf8,
+    0xed, 0x20, 0x5, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xf9, 0xee, 0x20, 0x4, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf9,
+    0xce, 0x30, 0x2, 0xfd, 0x20, 0x0, 0x0, 0x2,
+    0x20, 0x0, 0x8, 0xf7, 0x9f, 0x60, 0x1, 0xdf,
+    0x50, 0x0, 0x0, 0xb, 0xe5, 0x0, 0xb, 0xf4,
+    0x4f, 0xb0, 0x0, 0x7f, 0xd3, 0x0, 0x0, 0x7f,
+    0xe2, 0x0, 0x2f, 0xd1, 0x1d, 0xf4, 0x0, 0x1a,
+    0xfe, 0x96, 0x7b, 0xff, 0x50, 0x0, 0x9f, 0x90,
+    0x6, 0xfc, 0x10, 0x1, 0x8e, 0xff, 0xff, 0xd5,
+    0x0, 0x4, 0xee, 0x20, 0x1, 0xbf, 0xa1, 0x0,
+    0x1, 0x46, 0x63, 0x0, 0x0, 0x3d, 0xf7, 0x0,
+    0x0, 0x2d, 0xfb, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xdf, 0xa0, 0x0, 0x0, 0x3, 0xcf, 0xe8,
+    0x20, 0x0, 0x0, 0x14, 0xaf, 0xf9, 0x10, 0x0,
+    0x0, 0x0, 0x19, 0xff, 0xec, 0x98, 0x8a, 0xde,
+    0xfd, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x39,
+    0xef, 0xff, 0xff, 0xfd, 0x71, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0x67, 0x65, 0x20,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+00AA "ª" */
+    0x0, 0x0, 0x12, 0x21, 0x0, 0x0, 0x3, 0xad,
+    0xee, 0xda, 0x30, 0x3, 0xdf, 0xeb, 0xcf, 0xfe,
+    0x20, 0xaf, 0xc1, 0x0, 0x3d, 0xf7, 0x4, 0x74,
+    0x0, 0x0, 0xbf, 0x80, 0x0, 0x24, 0x58, 0xae,
+    0xf9, 0x2, 0xad, 0xff, 0xff, 0xff, 0x91, 0xcf,
+    0xfb, 0x85, 0x2b, 0xf9, 0x3f, 0xf5, 0x0, 0x0,
+    0xcf, 0x93, 0xff, 0x30, 0x0, 0x6e, 0xf9, 0x1d,
+    0xfc, 0x65, 0x9e, 0xff, 0xa0, 0x5e, 0xff, 0xff,
+    0xa7, 0xfd, 0x0, 0x27, 0x97, 0x30, 0x14, 0x40,
+
+    /* U+00AB "«" */
+    0x0, 0x0, 0x2, 0x20, 0x0, 0x2, 0x20, 0x0,
+    0x0, 0x5f, 0xe2, 0x0, 0x5f, 0xe2, 0x0, 0x2,
+    0xef, 0x70, 0x2, 0xdf, 0x80, 0x0, 0xb, 0xfc,
+    0x10, 0xa, 0xfd, 0x20, 0x0, 0x7f, 0xf5, 0x0,
+    0x6f, 0xf6, 0x0, 0x3, 0xef, 0xb0, 0x2, 0xef,
+    0xb1, 0x0, 0x1c, 0xfe, 0x30, 0x1b, 0xfe, 0x40,
+    0x0, 0x8f, 0xf9, 0x0, 0x7f, 0xfa, 0x0, 0x0,
+    0x8f, 0xf9, 0x0, 0x6f, 0xfa, 0x0, 0x0, 0x1c,
+    0xfe, 0x30, 0xb, 0xfe, 0x40, 0x0, 0x3, 0xef,
+    0xb0, 0x2, 0xef, 0xc1, 0x0, 0x0, 0x7f, 0xf5,
+    0x0, 0x5f, 0xf6, 0x0, 0x0, 0xb, 0xfc, 0x10,
+    0xa, 0xfd, 0x20, 0x0, 0x2, 0xef, 0x70, 0x2,
+    0xdf, 0x80, 0x0, 0x0, 0x5f, 0xd2, 0x0, 0x5f,
+    0xe3, 0x0, 0x0, 0x1, 0x10, 0x0, 0x1, 0x10,
+
+    /* U+00AC "¬" */
+    0x3d, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdc,
+    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0x2b, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbe, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0x98,
+
+    /* U+00AD "­" */
+    0x19, 0xaa, 0xaa, 0xaa, 0xa6, 0x1e, 0xff, 0xff,
+    0xff, 0xfa, 0x1e, 0xff, 0xff, 0xff, 0xfa, 0x2,
+    0x22, 0x22, 0x22, 0x21,
+
+    /* U+00AE "®" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0x7b, 0xdd, 0xdd, 0xa6, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xae, 0xff, 0xff, 0xff, 0xff,
+    0xe7, 0x10, 0x0, 0x0, 0x0, 0x0, 0x6e, 0xfe,
+    0x94, 0x20, 0x2, 0x5b, 0xef, 0xd4, 0x0, 0x0,
+    0x0, 0x8, 0xfe, 0x82, 0x0, 0x0, 0x0, 0x0,
+    0x3b, 0xfe, 0x50, 0x0, 0x0, 0x7f, 0xe5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x8f, 0xe3, 0x0,
+    0x3, 0xee, 0x50, 0x26, 0x66, 0x66, 0x53, 0x10,
+    0x0, 0x9, 0xfb, 0x0, 0xa, 0xf8, 0x0, 0x5f,
+    0xff, 0xff, 0xff, 0xd4, 0x0, 0x1, 0xcf, 0x50,
+    0x2f, 0xd2, 0x0, 0x5f, 0xc6, 0x56, 0x7c, 0xfe,
+    0x10, 0x0, 0x5f, 0xc0, 0x7f, 0x90, 0x0, 0x5f,
+    0xb0, 0x0, 0x1, 0xdf, 0x60, 0x0, 0xd, 0xe3,
+    0xbf, 0x40, 0x0, 0x5f, 0xb0, 0x0, 0x0, 0xcf,
+    0x60, 0x0, 0x9, 0xf6, 0xde, 0x30, 0x0, 0x5f,
+    0xb0, 0x0, 0x16, 0xef, 0x20, 0x0, 0x7, 0xf8,
+    0xed, 0x20, 0x0, 0x5f, 0xed, 0xdd, 0xef, 0xf6,
+    0x0, 0x0, 0x5, 0xf9, 0xee, 0x20, 0x0, 0x5f,
+    0xed, 0xef, 0xf9, 0x20, 0x0, 0x0, 0x6, 0xf9,
+    0xce, 0x30, 0x0, 0x5f, 0xb0, 0x5, 0xee, 0x30,
+    0x0, 0x0, 0x8, 0xf7, 0x9f, 0x60, 0x0, 0x5f,
+    0xb0, 0x0, 0x6f, 0xd1, 0x0, 0x0, 0xb, 0xf4,
+    0x4f, 0xb0, 0x0, 0x5f, 0xb0, 0x0, 0x1b, 0xf9,
+    0x0, 0x0, 0x2f, 0xd1, 0x1d, 0xf4, 0x0, 0x5f,
+    0xb0, 0x0, 0x3, 0xef, 0x40, 0x0, 0x9f, 0x90,
+    0x6, 0xfc, 0x10, 0x5f, 0xa0, 0x0, 0x0, 0x9f,
+    0xc1, 0x4, 0xee, 0x20, 0x1, 0xbf, 0xa1, 0x13,
+    0x20, 0x0, 0x0, 0x13, 0x31, 0x3d, 0xf7, 0x0,
+    0x0, 0x2d, 0xfb, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xdf, 0xa0, 0x0, 0x0, 0x3, 0xcf, 0xe8,
+    0x20, 0x0, 0x0, 0x14, 0xaf, 0xf9, 0x10, 0x0,
+    0x0, 0x0, 0x19, 0xff, 0xec, 0x98, 0x8a, 0xde,
+    0xfd, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x39,
+    0xef, 0xff, 0xff, 0xfd, 0x71, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0x67, 0x65, 0x20,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+00AF "¯" */
+    0x24, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x31, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xe3, 0x6c, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xb2,
+
+    /* U+00B0 "°" */
+    0x0, 0x1, 0x45, 0x30, 0x0, 0x0, 0x4c, 0xff,
+    0xea, 0x20, 0x3, 0xee, 0x86, 0xaf, 0xc1, 0xa,
+    0xf4, 0x0, 0x8, 0xf6, 0x1d, 0xb0, 0x0, 0x3,
+    0xe9, 0x1d, 0xb0, 0x0, 0x2, 0xe9, 0xb, 0xe3,
+    0x0, 0x8, 0xf6, 0x4, 0xee, 0x75, 0x9f, 0xc1,
+    0x0, 0x5d, 0xff, 0xeb, 0x20, 0x0, 0x1, 0x55,
+    0x30, 0x0,
+
+    /* U+00B1 "±" */
+    0x0, 0x0, 0x0, 0x23, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xf1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xf1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xf1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xf1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xf1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xf1, 0x0, 0x0, 0x0,
+    0x9c, 0xcc, 0xcc, 0xef, 0xfc, 0xcc, 0xcc, 0xc4,
+    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
+    0x9c, 0xcc, 0xcc, 0xef, 0xfc, 0xcc, 0xcc, 0xc4,
+    0x0, 0x0, 0x0, 0x8f, 0xf1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xf1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xf1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xf1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xf1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7d, 0xd1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x79, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x93,
+    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
+    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
+
+    /* U+00B2 "²" */
+    0x0, 0x0, 0x22, 0x20, 0x0, 0x0, 0x6, 0xce,
+    0xee, 0xc7, 0x0, 0x7, 0xff, 0xdb, 0xef, 0xf8,
+    0x1, 0xef, 0x90, 0x1, 0xbf, 0xe1, 0x15, 0x72,
+    0x0, 0x7, 0xfe, 0x10, 0x0, 0x0, 0x1, 0xbf,
+    0xb0, 0x0, 0x0, 0x2, 0xbf, 0xe3, 0x0, 0x0,
+    0x4, 0xdf, 0xe4, 0x0, 0x0, 0x7, 0xff, 0xb2,
+    0x0, 0x0, 0x19, 0xfe, 0x80, 0x0, 0x0, 0x9,
+    0xff, 0xa4, 0x44, 0x44, 0x4, 0xff, 0xff, 0xff,
+    0xff, 0xf2, 0x49, 0x99, 0x99, 0x99, 0x99, 0x10,
+
+    /* U+00B3 "³" */
+    0x0, 0x0, 0x22, 0x10, 0x0, 0x0, 0x7, 0xde,
+    0xed, 0xb4, 0x0, 0x7, 0xff, 0xca, 0xef, 0xe3,
+    0x1, 0xde, 0x60, 0x2, 0xef, 0x70, 0x1, 0x31,
+    0x0, 0x2e, 0xf7, 0x0, 0x0, 0x2, 0x6b, 0xfb,
+    0x10, 0x0, 0x0, 0x7f, 0xfd, 0x40, 0x0, 0x0,
+    0x4, 0x69, 0xee, 0x60, 0x0, 0x0, 0x0, 0x7,
+    0xfe, 0x13, 0x98, 0x10, 0x0, 0x7f, 0xf1, 0x3e,
+    0xf9, 0x32, 0x5d, 0xfc, 0x0, 0x7f, 0xfe, 0xef,
+    0xfd, 0x30, 0x0, 0x49, 0xbc, 0xa7, 0x20, 0x0,
+
+    /* U+00B4 "´" */
+    0x0, 0x13, 0x33, 0x0, 0xb, 0xee, 0xa1, 0x4,
+    0xff, 0xd2, 0x0, 0xaf, 0xe4, 0x0, 0x3e, 0xf6,
+    0x0, 0x2, 0x44, 0x0, 0x0,
+
+    /* U+00B5 "µ" */
+    0x37, 0x72, 0x0, 0x0, 0x0, 0x6, 0x76, 0x8f,
+    0xf4, 0x0, 0x0, 0x0, 0x1c, 0xfe, 0x8f, 0xf4,
+    0x0, 0x0, 0x0, 0x1c, 0xfe, 0x8f, 0xf4, 0x0,
+    0x0, 0x0, 0x1c, 0xfe, 0x8f, 0xf4, 0x0, 0x0,
+    0x0, 0x1c, 0xfe, 0x8f, 0xf4, 0x0, 0x0, 0x0,
+    0x1c, 0xfe, 0x8f, 0xf4, 0x0, 0x0, 0x0, 0x1c,
+    0xfe, 0x8f, 0xf4, 0x0, 0x0, 0x0, 0x1c, 0xfe,
+    0x8f, 0xf4, 0x0, 0x0, 0x0, 0x1c, 0xfe, 0x8f,
+    0xf5, 0x0, 0x0, 0x0, 0x1c, 0xfe, 0x8f, 0xf6,
+    0x0, 0x0, 0x0, 0x1d, 0xfe, 0x8f, 0xf7, 0x0,
+    0x0, 0x0, 0x2e, 0xfe, 0x8f, 0xfb, 0x0, 0x0,
+    0x0, 0x5f, 0xfe, 0x8f, 0xff, 0x50, 0x0, 0x2,
+    0xcf, 0xfe, 0x8f, 0xff, 0xe7, 0x33, 0x5c, 0xff,
+    0xfe, 0x8f, 0xfd, 0xff, 0xee, 0xff, 0xec, 0xfe,
+    0x8f, 0xf5, 0xaf, 0xff, 0xfd, 0x49, 0xfe, 0x8f,
+    0xf4, 0x3, 0x67, 0x51, 0x0, 0x11, 0x8f, 0xf4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf4, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xf4, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xf4, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xf4, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x36, 0x62, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+00B6 "¶" */
+    0x0, 0x2, 0x6a, 0xbc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xc4, 0x0, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf5, 0x8, 0xff, 0xff, 0xff, 0xfd, 0xdd,
+    0xef, 0xfd, 0xd4, 0x4f, 0xff, 0xff, 0xff, 0xc1,
+    0x0, 0x9f, 0xf1, 0x0, 0xaf, 0xff, 0xff, 0xff,
+    0xc1, 0x0, 0x9f, 0xf1, 0x0, 0xdf, 0xff, 0xff,
+    0xff, 0xc1, 0x0, 0x9f, 0xf1, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0xc1, 0x0, 0x9f, 0xf1, 0x0, 0xef,
+    0xff, 0xff, 0xff, 0xc1, 0x0, 0x9f, 0xf1, 0x0,
+    0xcf, 0xff, 0xff, 0xff, 0xc1, 0x0, 0x9f, 0xf1,
+    0x0, 0x6f, 0xff, 0xff, 0xff, 0xc1, 0x0, 0x9f,
+    0xf1, 0x0, 0x1c, 0xff, 0xff, 0xff, 0xc1, 0x0,
+    0x9f, 0xf1, 0x0, 0x3, 0xdf, 0xff, 0xff, 0xc1,
+    0x0, 0x9f, 0xf1, 0x0, 0x0, 0x17, 0xce, 0xff,
+    0xc1, 0x0, 0x9f, 0xf1, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xc1, 0x0, 0x9f, 0xf1, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0xc1, 0x0, 0x9f, 0xf1, 0x0, 0x0,
+    0x0, 0x0, 0xaf, 0xc1, 0x0, 0x9f, 0xf1, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xc1, 0x0, 0x9f, 0xf1,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xc1, 0x0, 0x9f,
+    0xf1, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xc1, 0x0,
+    0x9f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xc1,
+    0x0, 0x9f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xc1, 0x0, 0x9f, 0xf1, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xc1, 0x0, 0x9f, 0xf1, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0xc1, 0x0, 0x9f, 0xf1, 0x0, 0x0,
+    0x0, 0x0, 0xaf, 0xc1, 0x0, 0x9f, 0xf1, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xc1, 0x0, 0x9f, 0xf1,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xc1, 0x0, 0x9f,
+    0xf1, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xc1, 0x0,
+    0x9f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xc1,
+    0x0, 0x9f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xc1, 0x0, 0x9f, 0xf1, 0x0, 0x0, 0x0, 0x0,
+    0x46, 0x50, 0x0, 0x46, 0x60, 0x0,
+
+    /* U+00B7 "·" */
+    0x14, 0x43, 0x4, 0xff, 0xd1, 0x4f, 0xfd, 0x14,
+    0xee, 0xc1,
+
+    /* U+00B8 "¸" */
+    0x0, 0x6, 0x71, 0x0, 0x0, 0x2e, 0xe1, 0x0,
+    0x0, 0x6f, 0xea, 0x40, 0x0, 0x25, 0xbf, 0xe3,
+    0x0, 0x0, 0x5f, 0xf6, 0x19, 0x9a, 0xef, 0xe3,
+    0x4f, 0xff, 0xfd, 0x50, 0x15, 0x66, 0x41, 0x0,
+
+    /* U+00B9 "¹" */
+    0x0, 0x0, 0x12, 0x10, 0x0, 0x1b, 0xe6, 0x0,
+    0x2c, 0xff, 0x71, 0x8e, 0xff, 0xf7, 0x5f, 0xd7,
+    0xdf, 0x73, 0x72, 0xd, 0xf7, 0x0, 0x0, 0xdf,
+    0x70, 0x0, 0xd, 0xf7, 0x0, 0x0, 0xdf, 0x70,
+    0x0, 0xd, 0xf7, 0x0, 0x0, 0xdf, 0x70, 0x0,
+    0xd, 0xf7, 0x0, 0x0, 0x79, 0x40,
+
+    /* U+00BA "º" */
+    0x0, 0x0, 0x12, 0x20, 0x0, 0x0, 0x1, 0x8d,
+    0xee, 0xc5, 0x0, 0x1, 0xbf, 0xff, 0xff, 0xf8,
+    0x0, 0x9f, 0xe5, 0x2, 0x9f, 0xf3, 0x1e, 0xf6,
+    0x0, 0x1, 0xbf, 0x93, 0xfe, 0x30, 0x0, 0x7,
+    0xfd, 0x4f, 0xe2, 0x0, 0x0, 0x5f, 0xe4, 0xfe,
+    0x20, 0x0, 0x6, 0xfd, 0x2f, 0xf4, 0x0, 0x0,
+    0x9f, 0xb1, 0xcf, 0xb1, 0x0, 0x3e, 0xf7, 0x5,
+    0xef, 0xc8, 0x9d, 0xfc, 0x10, 0x6, 0xef, 0xff,
+    0xfb, 0x20, 0x0, 0x2, 0x68, 0x84, 0x10, 0x0,
+
+    /* U+00BB "»" */
+    0x12, 0x10, 0x0, 0x12, 0x10, 0x0, 0x0, 0x7f,
+    0xd1, 0x0, 0x6f, 0xe2, 0x0, 0x0, 0x1c, 0xfa,
+    0x0, 0x1b, 0xfa, 0x10, 0x0, 0x5, 0xff, 0x60,
+    0x4, 0xff, 0x70, 0x0, 0x0, 0xaf, 0xd2, 0x0,
+    0xaf, 0xe3, 0x0, 0x0, 0x2f, 0xfa, 0x0, 0x2e,
+    0xfc, 0x10, 0x0, 0x8, 0xff, 0x60, 0x7, 0xff,
+    0x80, 0x0, 0x1, 0xef, 0xe3, 0x1, 0xdf, 0xf4,
+    0x0, 0x1, 0xef, 0xe3, 0x1, 0xdf, 0xe4, 0x0,
+    0x8, 0xff, 0x60, 0x8, 0xff, 0x80, 0x0, 0x3f,
+    0xfa, 0x0, 0x2e, 0xfb, 0x10, 0x0, 0xbf, 0xd2,
+    0x0, 0xaf, 0xe3, 0x0, 0x5, 0xff, 0x50, 0x4,
+    0xff, 0x60, 0x0, 0x1c, 0xf9, 0x0, 0x1b, 0xfa,
+    0x0, 0x0, 0x7f, 0xd1, 0x0, 0x6f, 0xd2, 0x0,
+    0x0, 0x11, 0x10, 0x0, 0x11, 0x10, 0x0, 0x0,
+
+    /* U+00BC "¼" */
+    0x0, 0x0, 0x13, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x55, 0x20, 0x0, 0x0, 0x1, 0xbe,
+    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfd,
+    0x20, 0x0, 0x0, 0x3c, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3e, 0xf5, 0x0, 0x0, 0x18,
+    0xef, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xcf, 0x90, 0x0, 0x0, 0x5f, 0xd7, 0xdf, 0x70,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xfc, 0x10, 0x0,
+    0x0, 0x36, 0x20, 0xdf, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x5e, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0x70, 0x0, 0x0, 0x0, 0x2, 0xdf, 0x70,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x70, 0x0,
+    0x0, 0x0, 0xa, 0xfb, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0x70, 0x0, 0x0, 0x0, 0x6f,
+    0xd2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
+    0x70, 0x0, 0x0, 0x3, 0xef, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xdf, 0x70, 0x0, 0x0,
+    0x1b, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xdf, 0x70, 0x0, 0x0, 0x8f, 0xd1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x79, 0x40,
+    0x0, 0x4, 0xef, 0x40, 0x0, 0x0, 0x2, 0x42,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xf8,
+    0x0, 0x0, 0x0, 0x2d, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xb1, 0x0, 0x0, 0x1,
+    0xcf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0xfd, 0x30, 0x0, 0x0, 0x1a, 0xff, 0xf9, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2e, 0xf6, 0x0, 0x0,
+    0x0, 0x8f, 0xec, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xbf, 0xa0, 0x0, 0x0, 0x6, 0xfe, 0x4a,
+    0xf9, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfd, 0x10,
+    0x0, 0x0, 0x5e, 0xf6, 0xa, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x4e, 0xf4, 0x0, 0x0, 0x3, 0xef,
+    0x70, 0xa, 0xf9, 0x0, 0x0, 0x0, 0x2, 0xcf,
+    0x80, 0x0, 0x0, 0x9, 0xfe, 0xaa, 0xad, 0xfd,
+    0xa2, 0x0, 0x0, 0x9, 0xfb, 0x10, 0x0, 0x0,
+    0x9, 0xee, 0xee, 0xef, 0xff, 0xe3, 0x0, 0x0,
+    0x5f, 0xe3, 0x0, 0x0, 0x0, 0x1, 0x22, 0x22,
+    0x2a, 0xfa, 0x20, 0x0, 0x2, 0xef, 0x60, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf9, 0x0,
+    0x0, 0xa, 0xea, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0x74, 0x0,
+
+    /* U+00BD "½" */
+    0x0, 0x0, 0x13, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0x54, 0x10, 0x0, 0x0, 0x1, 0xbe,
+    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b, 0xf9,
+    0x0, 0x0, 0x0, 0x3c, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xd1, 0x0, 0x0, 0x18,
+    0xef, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xef, 0x40, 0x0, 0x0, 0x5f, 0xd7, 0xdf, 0x70,
+    0x0, 0x0, 0x0, 0x0, 0x2c, 0xf8, 0x0, 0x0,
+    0x0, 0x36, 0x20, 0xdf, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0x70, 0x0, 0x0, 0x0, 0x6, 0xfe, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x70, 0x0,
+    0x0, 0x0, 0x2e, 0xf6, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0x70, 0x0, 0x0, 0x1, 0xbf,
+    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
+    0x70, 0x0, 0x0, 0x8, 0xfd, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xdf, 0x70, 0x0, 0x0,
+    0x4e, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xdf, 0x70, 0x0, 0x1, 0xcf, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x79, 0x40,
+    0x0, 0x9, 0xfc, 0x10, 0x0, 0x26, 0x66, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xe3,
+    0x0, 0x1a, 0xff, 0xff, 0xfb, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xef, 0x60, 0x0, 0x9f, 0xe8,
+    0x79, 0xef, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xfa, 0x0, 0x1, 0xdf, 0x60, 0x0, 0x8f, 0xf1,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xd2, 0x0, 0x0,
+    0x23, 0x10, 0x0, 0x7f, 0xe1, 0x0, 0x0, 0x0,
+    0x3, 0xef, 0x50, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xdf, 0x90, 0x0, 0x0, 0x0, 0x1c, 0xf9, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4d, 0xfd, 0x20, 0x0,
+    0x0, 0x0, 0x9f, 0xc1, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xb2, 0x0, 0x0, 0x0, 0x5, 0xfe,
+    0x30, 0x0, 0x0, 0x0, 0x1, 0xaf, 0xf9, 0x10,
+    0x0, 0x0, 0x0, 0x2d, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x2b, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xa1, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xfa,
+    0x76, 0x66, 0x61, 0x0, 0x6, 0xfd, 0x20, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xff, 0xf2,
+    0x0, 0x2d, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0x77, 0x77, 0x77, 0x77, 0x71,
+
+    /* U+00BE "¾" */
+    0x0, 0x1, 0x34, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0x52, 0x0, 0x0, 0x18, 0xde,
+    0xee, 0xc5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xfd, 0x20, 0x0, 0x8, 0xfe, 0xa8, 0xdf, 0xe3,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xef, 0x50, 0x0,
+    0x1, 0xde, 0x60, 0x2, 0xef, 0x80, 0x0, 0x0,
+    0x0, 0x1, 0xcf, 0x90, 0x0, 0x0, 0x1, 0x21,
+    0x0, 0x2e, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x9f,
+    0xc1, 0x0, 0x0, 0x0, 0x0, 0x2, 0x6b, 0xfb,
+    0x10, 0x0, 0x0, 0x0, 0x5e, 0xe3, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xfd, 0x40, 0x0, 0x0,
+    0x0, 0x2d, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0x69, 0xee, 0x60, 0x0, 0x0, 0xa, 0xfb,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xfe, 0x10, 0x0, 0x6, 0xfd, 0x20, 0x0, 0x0,
+    0x0, 0x2, 0x77, 0x10, 0x0, 0x6f, 0xf1, 0x0,
+    0x3, 0xef, 0x50, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xf7, 0x10, 0x3c, 0xfc, 0x0, 0x1, 0xbf, 0x90,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xfd, 0xce,
+    0xfe, 0x50, 0x0, 0x8f, 0xd1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x6c, 0xef, 0xea, 0x30, 0x0,
+    0x4e, 0xf4, 0x0, 0x0, 0x0, 0x24, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xf8, 0x0,
+    0x0, 0x0, 0x2d, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xa, 0xfb, 0x10, 0x0, 0x0, 0x1c,
+    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0xfd, 0x30, 0x0, 0x0, 0x1a, 0xff, 0xf9, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xef, 0x60, 0x0,
+    0x0, 0x8, 0xfe, 0xdf, 0x90, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xbf, 0xa0, 0x0, 0x0, 0x6, 0xff,
+    0x5a, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xd1, 0x0, 0x0, 0x5, 0xef, 0x60, 0xaf, 0x90,
+    0x0, 0x0, 0x0, 0x0, 0x4e, 0xf4, 0x0, 0x0,
+    0x3, 0xef, 0x70, 0xa, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x2d, 0xf8, 0x0, 0x0, 0x0, 0x9f, 0xea,
+    0xaa, 0xdf, 0xda, 0x20, 0x0, 0x0, 0x9, 0xfb,
+    0x10, 0x0, 0x0, 0x9, 0xee, 0xee, 0xef, 0xff,
+    0xe3, 0x0, 0x0, 0x5, 0xfe, 0x30, 0x0, 0x0,
+    0x0, 0x12, 0x22, 0x22, 0xaf, 0xa2, 0x0, 0x0,
+    0x2, 0xef, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xf9, 0x0, 0x0, 0x0, 0xae, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x47,
+    0x40, 0x0,
+
+    /* U+00BF "¿" */
+    0x0, 0x0, 0x0, 0x57, 0x73, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xcf, 0xf6, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xcf, 0xf6, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9b, 0xb5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5c, 0xc3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xf4, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xdf, 0xe0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1b, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xbf, 0xfc, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x1c, 0xff, 0xc2, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xcf, 0xfc, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x9, 0xff, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3e, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xce, 0xc2,
+    0x7f, 0xf8, 0x0, 0x0, 0x0, 0x2, 0xef, 0xe1,
+    0x4f, 0xfd, 0x20, 0x0, 0x0, 0x8, 0xff, 0xa0,
+    0x1b, 0xff, 0xb2, 0x0, 0x0, 0x6e, 0xff, 0x30,
+    0x2, 0xdf, 0xfe, 0xa7, 0x8c, 0xff, 0xf8, 0x0,
+    0x0, 0x2b, 0xff, 0xff, 0xff, 0xfe, 0x70, 0x0,
+    0x0, 0x0, 0x49, 0xbd, 0xca, 0x72, 0x0, 0x0,
+
+    /* U+00C0 "À" */
+    0x0, 0x0, 0x0, 0x6, 0x99, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xef,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5e, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8c, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5c, 0xcc,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xbf, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xef, 0xef, 0xd1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0x8f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1d, 0xfc, 0x2f, 0xfb, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8, 0xb, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xf4, 0x6, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xef, 0xc1, 0x1, 0xef, 0xe2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x80, 0x0,
+    0x9f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0xfe, 0x30, 0x0, 0x4f, 0xfd, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xfb, 0x0, 0x0, 0x1c, 0xff,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf6, 0x0,
+    0x0, 0x7, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x1,
+    0xef, 0xd2, 0x0, 0x0, 0x3, 0xef, 0xe2, 0x0,
+    0x0, 0x0, 0x6, 0xff, 0xc5, 0x55, 0x55, 0x55,
+    0xdf, 0xf7, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfd, 0x10, 0x0, 0x0,
+    0x3e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x50, 0x0, 0x0, 0x8f, 0xf9, 0x22, 0x22, 0x22,
+    0x22, 0x29, 0xff, 0xa0, 0x0, 0x1, 0xdf, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xe3, 0x0,
+    0x5, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xcf, 0xf8, 0x0, 0xa, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xfd, 0x10, 0x2e, 0xfe,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff,
+    0x50, 0x7f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0xb0, 0xdf, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xf3,
+
+    /* U+00C1 "Á" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x59, 0x98, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xef, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xfb, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4b, 0xb2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5c, 0xcc,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xbf, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xef, 0xef, 0xd1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0x8f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1d, 0xfc, 0x2f, 0xfb, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8, 0xb, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xf4, 0x6, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xef, 0xc1, 0x1, 0xef, 0xe2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x80, 0x0,
+    0x9f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0xfe, 0x30, 0x0, 0x4f, 0xfd, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xfb, 0x0, 0x0, 0x1c, 0xff,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf6, 0x0,
+    0x0, 0x7, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x1,
+    0xef, 0xd2, 0x0, 0x0, 0x3, 0xef, 0xe2, 0x0,
+    0x0, 0x0, 0x6, 0xff, 0xc5, 0x55, 0x55, 0x55,
+    0xdf, 0xf7, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfd, 0x10, 0x0, 0x0,
+    0x3e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x50, 0x0, 0x0, 0x8f, 0xf9, 0x22, 0x22, 0x22,
+    0x22, 0x29, 0xff, 0xa0, 0x0, 0x1, 0xdf, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xe3, 0x0,
+    0x5, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xcf, 0xf8, 0x0, 0xa, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xfd, 0x10, 0x2e, 0xfe,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff,
+    0x50, 0x7f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0xb0, 0xdf, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xf3,
+
+    /* U+00C2 "Â" */
+    0x0, 0x0, 0x0, 0x0, 0x49, 0x98, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xdf,
+    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1c, 0xfe, 0x8f, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9f, 0xf7, 0xb, 0xfe,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xbc,
+    0x91, 0x2, 0xbc, 0xa1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6d, 0xdc,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xbf, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xef, 0xef, 0xd2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0x8f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1d, 0xfc, 0x2f, 0xfb, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8, 0xb, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xf3, 0x6, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xff, 0xc1, 0x1, 0xef, 0xe2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x70, 0x0,
+    0x9f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
+    0xfe, 0x30, 0x0, 0x4f, 0xfd, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xfb, 0x0, 0x0, 0x1c, 0xff,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf6, 0x0,
+    0x0, 0x7, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x2,
+    0xef, 0xd2, 0x0, 0x0, 0x3, 0xef, 0xe2, 0x0,
+    0x0, 0x0, 0x6, 0xff, 0xc5, 0x55, 0x55, 0x55,
+    0xdf, 0xf7, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfd, 0x10, 0x0, 0x0,
+    0x3e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x50, 0x0, 0x0, 0x8f, 0xf9, 0x22, 0x22, 0x22,
+    0x22, 0x29, 0xff, 0xb0, 0x0, 0x1, 0xdf, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xe3, 0x0,
+    0x5, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xcf, 0xf8, 0x0, 0xa, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xfd, 0x10, 0x2e, 0xfe,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff,
+    0x50, 0x7f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0xb0, 0xdf, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xf3,
+
+    /* U+00C3 "Ã" */
+    0x0, 0x0, 0x0, 0x17, 0xa8, 0x30, 0x2, 0xa9,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xff,
+    0xfc, 0x7b, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xfe, 0x79, 0xef, 0xff, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xc7, 0x0, 0x27, 0xba,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5c, 0xcb, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xef, 0xef, 0xd1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0x8f, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xfc,
+    0x2f, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xf8, 0xb, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xf4, 0x6, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef,
+    0xc1, 0x1, 0xef, 0xe1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0x80, 0x0, 0x9f, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xc, 0xfe, 0x30, 0x0,
+    0x4f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xfb, 0x0, 0x0, 0x1c, 0xff, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xf6, 0x0, 0x0, 0x7, 0xff,
+    0xa0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xd2, 0x0,
+    0x0, 0x3, 0xef, 0xe2, 0x0, 0x0, 0x0, 0x6,
+    0xff, 0xc5, 0x55, 0x55, 0x55, 0xdf, 0xf7, 0x0,
+    0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfd, 0x10, 0x0, 0x0, 0x3e, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0,
+    0x8f, 0xf9, 0x22, 0x22, 0x22, 0x22, 0x29, 0xff,
+    0xa0, 0x0, 0x1, 0xdf, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xe3, 0x0, 0x5, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf8, 0x0,
+    0xa, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xfd, 0x10, 0x2e, 0xfe, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2e, 0xff, 0x50, 0x7f, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
+    0xb0, 0xdf, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xf3,
+
+    /* U+00C4 "Ä" */
+    0x0, 0x0, 0x0, 0x66, 0x50, 0x2, 0x66, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xc1,
+    0x4, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xff, 0xc1, 0x4, 0xff, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xcc, 0x91, 0x3, 0xcc,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5c, 0xcc, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xef, 0xef, 0xd1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0x8f, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xfc,
+    0x2f, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5f, 0xf8, 0xb, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xf4, 0x6, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef,
+    0xc1, 0x1, 0xef, 0xe2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0x80, 0x0, 0x9f, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xc, 0xfe, 0x30, 0x0,
+    0x4f, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xfb, 0x0, 0x0, 0x1c, 0xff, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xf6, 0x0, 0x0, 0x7, 0xff,
+    0xa0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xd2, 0x0,
+    0x0, 0x3, 0xef, 0xe2, 0x0, 0x0, 0x0, 0x6,
+    0xff, 0xc5, 0x55, 0x55, 0x55, 0xdf, 0xf7, 0x0,
+    0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfd, 0x10, 0x0, 0x0, 0x3e, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0,
+    0x8f, 0xf9, 0x22, 0x22, 0x22, 0x22, 0x29, 0xff,
+    0xa0, 0x0, 0x1, 0xdf, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xe3, 0x0, 0x5, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf8, 0x0,
+    0xa, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xfd, 0x10, 0x2e, 0xfe, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2e, 0xff, 0x50, 0x7f, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
+    0xb0, 0xdf, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xf3,
+
+    /* U+00C5 "Å" */
+    0x0, 0x0, 0x0, 0x0, 0x17, 0x95, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xcb,
+    0x8d, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xc1, 0x3, 0xd2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6, 0xb0, 0x2, 0xd2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xe7, 0x39, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xef, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xef, 0xef, 0xd1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0x8f, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xfd,
+    0x2f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xf8, 0xb, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xf4, 0x6, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef,
+    0xc1, 0x1, 0xef, 0xe1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0x80, 0x0, 0x9f, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xc, 0xfe, 0x30, 0x0,
+    0x4f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xfb, 0x0, 0x0, 0x1c, 0xff, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xf6, 0x0, 0x0, 0x8, 0xff,
+    0xa0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xd2, 0x0,
+    0x0, 0x3, 0xef, 0xe2, 0x0, 0x0, 0x0, 0x6,
+    0xff, 0xc5, 0x55, 0x55, 0x55, 0xdf, 0xf7, 0x0,
+    0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfd, 0x10, 0x0, 0x0, 0x3e, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0,
+    0x8f, 0xf9, 0x22, 0x22, 0x22, 0x22, 0x29, 0xff,
+    0xa0, 0x0, 0x1, 0xdf, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xe3, 0x0, 0x5, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf8, 0x0,
+    0xa, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xfd, 0x10, 0x2e, 0xfe, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2e, 0xff, 0x50, 0x7f, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
+    0xb0, 0xdf, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xf3,
+
+    /* U+00C6 "Æ" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2c, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xca, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xef, 0xfd, 0xdf, 0xff,
+    0xed, 0xdd, 0xdd, 0xdd, 0xdd, 0xdb, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x9f, 0xfa, 0x0, 0xbf, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2e, 0xfe, 0x40, 0xb, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0xb0, 0x0, 0xbf, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xdf, 0xf4, 0x0, 0xb, 0xff, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xfb, 0x0, 0x0, 0xbf, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d,
+    0xff, 0x40, 0x0, 0xb, 0xff, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xc0, 0x0, 0x0, 0xbf, 0xf7, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xf5,
+    0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xd2, 0x0, 0x0, 0x0, 0x6f, 0xfc, 0x10,
+    0x0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfd, 0x20, 0x0, 0x0, 0xd, 0xff, 0x50, 0x0,
+    0x0, 0xb, 0xff, 0xa7, 0x77, 0x77, 0x77, 0x77,
+    0x71, 0x0, 0x0, 0x6, 0xff, 0xd3, 0x22, 0x22,
+    0x22, 0xcf, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xdf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1c, 0xff, 0xa8, 0x88, 0x88, 0x88, 0x8d,
+    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0xbf,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xcf, 0xf7, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
+    0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xcb,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x34, 0xff, 0xe2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf3, 0xbf, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x30,
+
+    /* U+00C7 "Ç" */
+    0x0, 0x0, 0x0, 0x0, 0x13, 0x45, 0x43, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xad, 0xef,
+    0xff, 0xed, 0x71, 0x0, 0x0, 0x0, 0x0, 0x2a,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0x0, 0x0,
+    0x0, 0x3d, 0xff, 0xeb, 0x75, 0x56, 0x9e, 0xff,
+    0xe5, 0x0, 0x0, 0x2d, 0xff, 0xc4, 0x0, 0x0,
+    0x0, 0x2b, 0xff, 0xe3, 0x0, 0xa, 0xff, 0xc2,
+    0x0, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xa0, 0x4,
+    0xef, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3e,
+    0xff, 0x20, 0x9f, 0xfa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xac, 0x82, 0x1d, 0xff, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xfd, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0xf1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x11, 0x0,
+    0x1c, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xda, 0x50, 0x8f, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xf9, 0x3, 0xef, 0xe3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0xff, 0x30,
+    0xa, 0xff, 0xc2, 0x0, 0x0, 0x0, 0x0, 0x1c,
+    0xff, 0xa0, 0x0, 0x2d, 0xff, 0xc4, 0x0, 0x0,
+    0x0, 0x3c, 0xff, 0xe3, 0x0, 0x0, 0x4e, 0xff,
+    0xeb, 0x75, 0x56, 0xae, 0xff, 0xe5, 0x0, 0x0,
+    0x0, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4,
+    0x0, 0x0, 0x0, 0x0, 0x16, 0xbf, 0xff, 0xff,
+    0xfd, 0x71, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xd, 0xf8, 0x41, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xef, 0xb6, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x15, 0x9f, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xdf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0x9a, 0xdf, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xdf, 0xff, 0xe8, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x66,
+    0x52, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+00C8 "È" */
+    0x0, 0x0, 0x3, 0x99, 0x93, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xaf, 0xfa, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xfe, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xdf,
+    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4c, 0xb2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6c, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xc2, 0x7f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe2,
+    0x7f, 0xfe, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xd2, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xfa, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x10,
+    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0x40, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x40, 0x7f, 0xfc, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x20, 0x7f, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xfd, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xbb, 0xb7, 0x7f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfa,
+
+    /* U+00C9 "É" */
+    0x0, 0x0, 0x0, 0x0, 0x39, 0x99, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xfa, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xef, 0xc1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xfe,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1a,
+    0xc5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6c, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xc2, 0x7f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe2,
+    0x7f, 0xfe, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xd2, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xfa, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x10,
+    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0x40, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x40, 0x7f, 0xfc, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x20, 0x7f, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xfd, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xbb, 0xb7, 0x7f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfa,
+
+    /* U+00CA "Ê" */
+    0x0, 0x0, 0x0, 0x7, 0x99, 0x60, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xe5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xef, 0xca, 0xfe,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xfe, 0x32,
+    0xef, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x7c, 0xc6,
+    0x0, 0x6c, 0xc7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6c, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xc2, 0x7f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe2,
+    0x7f, 0xfe, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xd2, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xfa, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x10,
+    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0x40, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x40, 0x7f, 0xfc, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x20, 0x7f, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xfd, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xbb, 0xb7, 0x7f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfa,
+
+    /* U+00CB "Ë" */
+    0x0, 0x0, 0x26, 0x64, 0x0, 0x36, 0x63, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xf9, 0x0, 0x8f, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xf9, 0x0, 0x8f,
+    0xf6, 0x0, 0x0, 0x0, 0x0, 0x4c, 0xc7, 0x0,
+    0x6c, 0xc5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6c, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xc2, 0x7f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe2, 0x7f,
+    0xfe, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xd2,
+    0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xfa,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x10, 0x7f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x40,
+    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x40, 0x7f, 0xfc, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x20, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xfd, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xb7, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfa, 0x7f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfa,
+
+    /* U+00CC "Ì" */
+    0x79, 0x97, 0x0, 0x5e, 0xff, 0x20, 0x7, 0xff,
+    0x90, 0x0, 0x9f, 0xe2, 0x0, 0x19, 0xc6, 0x0,
+    0x0, 0x0, 0x2, 0xbd, 0xc1, 0x2, 0xdf, 0xe1,
+    0x2, 0xdf, 0xe1, 0x2, 0xdf, 0xe1, 0x2, 0xdf,
+    0xe1, 0x2, 0xdf, 0xe1, 0x2, 0xdf, 0xe1, 0x2,
+    0xdf, 0xe1, 0x2, 0xdf, 0xe1, 0x2, 0xdf, 0xe1,
+    0x2, 0xdf, 0xe1, 0x2, 0xdf, 0xe1, 0x2, 0xdf,
+    0xe1, 0x2, 0xdf, 0xe1, 0x2, 0xdf, 0xe1, 0x2,
+    0xdf, 0xe1, 0x2, 0xdf, 0xe1, 0x2, 0xdf, 0xe1,
+    0x2, 0xdf, 0xe1, 0x2, 0xdf, 0xe1, 0x2, 0xdf,
+    0xe1, 0x2, 0xdf, 0xe1, 0x2, 0xdf, 0xe1,
+
+    /* U+00CD "Í" */
+    0x0, 0x79, 0x96, 0x4, 0xff, 0xe3, 0xb, 0xff,
+    0x50, 0x4e, 0xf8, 0x0, 0x7c, 0x90, 0x0, 0x0,
+    0x0, 0x0, 0x2b, 0xdc, 0x10, 0x2d, 0xfe, 0x10,
+    0x2d, 0xfe, 0x10, 0x2d, 0xfe, 0x10, 0x2d, 0xfe,
+    0x10, 0x2d, 0xfe, 0x10, 0x2d, 0xfe, 0x10, 0x2d,
+    0xfe, 0x10, 0x2d, 0xfe, 0x10, 0x2d, 0xfe, 0x10,
+    0x2d, 0xfe, 0x10, 0x2d, 0xfe, 0x10, 0x2d, 0xfe,
+    0x10, 0x2d, 0xfe, 0x10, 0x2d, 0xfe, 0x10, 0x2d,
+    0xfe, 0x10, 0x2d, 0xfe, 0x10, 0x2d, 0xfe, 0x10,
+    0x2d, 0xfe, 0x10, 0x2d, 0xfe, 0x10, 0x2d, 0xfe,
+    0x10, 0x2d, 0xfe, 0x10, 0x2d, 0xfe, 0x10,
+
+    /* U+00CE "Î" */
+    0x0, 0x3, 0x99, 0x81, 0x0, 0x0, 0x2, 0xdf,
+    0xff, 0xa1, 0x0, 0x1, 0xaf, 0xf8, 0xff, 0x80,
+    0x0, 0x8f, 0xf8, 0x9, 0xff, 0x60, 0x2b, 0xca,
+    0x10, 0x1b, 0xcb, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xbd, 0xc1, 0x0, 0x0, 0x0,
+    0x2d, 0xfe, 0x10, 0x0, 0x0, 0x2, 0xdf, 0xe1,
+    0x0, 0x0, 0x0, 0x2d, 0xfe, 0x10, 0x0, 0x0,
+    0x2, 0xdf, 0xe1, 0x0, 0x0, 0x0, 0x2d, 0xfe,
+    0x10, 0x0, 0x0, 0x2, 0xdf, 0xe1, 0x0, 0x0,
+    0x0, 0x2d, 0xfe, 0x10, 0x0, 0x0, 0x2, 0xdf,
+    0xe1, 0x0, 0x0, 0x0, 0x2d, 0xfe, 0x10, 0x0,
+    0x0, 0x2, 0xdf, 0xe1, 0x0, 0x0, 0x0, 0x2d,
+    0xfe, 0x10, 0x0, 0x0, 0x2, 0xdf, 0xe1, 0x0,
+    0x0, 0x0, 0x2d, 0xfe, 0x10, 0x0, 0x0, 0x2,
+    0xdf, 0xe1, 0x0, 0x0, 0x0, 0x2d, 0xfe, 0x10,
+    0x0, 0x0, 0x2, 0xdf, 0xe1, 0x0, 0x0, 0x0,
+    0x2d, 0xfe, 0x10, 0x0, 0x0, 0x2, 0xdf, 0xe1,
+    0x0, 0x0, 0x0, 0x2d, 0xfe, 0x10, 0x0, 0x0,
+    0x2, 0xdf, 0xe1, 0x0, 0x0, 0x0, 0x2d, 0xfe,
+    0x10, 0x0, 0x0, 0x2, 0xdf, 0xe1, 0x0, 0x0,
+
+    /* U+00CF "Ï" */
+    0x66, 0x61, 0x1, 0x66, 0x50, 0xef, 0xd2, 0x1,
+    0xff, 0xc1, 0xef, 0xd2, 0x1, 0xff, 0xc1, 0xbc,
+    0xa1, 0x1, 0xcc, 0x91, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2b, 0xdc, 0x10, 0x0, 0x0, 0x2d,
+    0xfe, 0x10, 0x0, 0x0, 0x2d, 0xfe, 0x10, 0x0,
+    0x0, 0x2d, 0xfe, 0x10, 0x0, 0x0, 0x2d, 0xfe,
+    0x10, 0x0, 0x0, 0x2d, 0xfe, 0x10, 0x0, 0x0,
+    0x2d, 0xfe, 0x10, 0x0, 0x0, 0x2d, 0xfe, 0x10,
+    0x0, 0x0, 0x2d, 0xfe, 0x10, 0x0, 0x0, 0x2d,
+    0xfe, 0x10, 0x0, 0x0, 0x2d, 0xfe, 0x10, 0x0,
+    0x0, 0x2d, 0xfe, 0x10, 0x0, 0x0, 0x2d, 0xfe,
+    0x10, 0x0, 0x0, 0x2d, 0xfe, 0x10, 0x0, 0x0,
+    0x2d, 0xfe, 0x10, 0x0, 0x0, 0x2d, 0xfe, 0x10,
+    0x0, 0x0, 0x2d, 0xfe, 0x10, 0x0, 0x0, 0x2d,
+    0xfe, 0x10, 0x0, 0x0, 0x2d, 0xfe, 0x10, 0x0,
+    0x0, 0x2d, 0xfe, 0x10, 0x0, 0x0, 0x2d, 0xfe,
+    0x10, 0x0, 0x0, 0x2d, 0xfe, 0x10, 0x0, 0x0,
+    0x2d, 0xfe, 0x10, 0x0,
+
+    /* U+00D0 "Ð" */
+    0x0, 0x7c, 0xcc, 0xcc, 0xcc, 0xcc, 0xba, 0x73,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xa2, 0x0, 0x0, 0x0, 0x8f,
+    0xfe, 0xdd, 0xdd, 0xdd, 0xee, 0xff, 0xfe, 0x40,
+    0x0, 0x0, 0x8f, 0xf7, 0x0, 0x0, 0x0, 0x13,
+    0x8e, 0xff, 0xd3, 0x0, 0x0, 0x8f, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xdf, 0xfb, 0x10, 0x0,
+    0x8f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3e,
+    0xff, 0x40, 0x0, 0x8f, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0xa0, 0x0, 0x8f, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xe0,
+    0x0, 0x8f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xdf, 0xf2, 0x0, 0x8f, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xcf, 0xf5, 0x55, 0xaf,
+    0xfa, 0x55, 0x55, 0x54, 0x0, 0x0, 0x0, 0xbf,
+    0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
+    0x0, 0x0, 0xbf, 0xf6, 0xbb, 0xdf, 0xfd, 0xbb,
+    0xbb, 0xb9, 0x0, 0x0, 0x0, 0xbf, 0xf6, 0x0,
+    0x8f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xcf, 0xf4, 0x0, 0x8f, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xdf, 0xf2, 0x0, 0x8f, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xe0,
+    0x0, 0x8f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9, 0xff, 0xa0, 0x0, 0x8f, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2e, 0xff, 0x40, 0x0, 0x8f,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xfb,
+    0x0, 0x0, 0x8f, 0xf7, 0x0, 0x0, 0x0, 0x2,
+    0x5c, 0xff, 0xe3, 0x0, 0x0, 0x8f, 0xfd, 0xbb,
+    0xbb, 0xbb, 0xcd, 0xff, 0xfe, 0x50, 0x0, 0x0,
+    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc4,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff,
+    0xed, 0x94, 0x10, 0x0, 0x0,
+
+    /* U+00D1 "Ñ" */
+    0x0, 0x0, 0x1, 0x8d, 0xc7, 0x10, 0xc, 0xd2,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xfe, 0x9a,
+    0xfd, 0x10, 0x0, 0x0, 0x0, 0x2f, 0xe6, 0x5b,
+    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x3, 0xa8,
+    0x0, 0x4, 0x99, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xdd, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5d,
+    0xd6, 0x8f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0x88, 0xff, 0xfe, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xf8, 0x8f, 0xff, 0xfb, 0x10,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0x88, 0xff, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf8, 0x8f,
+    0xfb, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x6, 0xff,
+    0x88, 0xff, 0x6a, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x6f, 0xf8, 0x8f, 0xf5, 0x2d, 0xff, 0x70, 0x0,
+    0x0, 0x6, 0xff, 0x88, 0xff, 0x50, 0x6f, 0xfe,
+    0x30, 0x0, 0x0, 0x6f, 0xf8, 0x8f, 0xf5, 0x0,
+    0xaf, 0xfc, 0x10, 0x0, 0x6, 0xff, 0x88, 0xff,
+    0x50, 0x2, 0xdf, 0xf7, 0x0, 0x0, 0x6f, 0xf8,
+    0x8f, 0xf5, 0x0, 0x6, 0xff, 0xe3, 0x0, 0x6,
+    0xff, 0x88, 0xff, 0x50, 0x0, 0xa, 0xff, 0xb1,
+    0x0, 0x6f, 0xf8, 0x8f, 0xf5, 0x0, 0x0, 0x1d,
+    0xff, 0x70, 0x6, 0xff, 0x88, 0xff, 0x50, 0x0,
+    0x0, 0x5f, 0xfe, 0x30, 0x6f, 0xf8, 0x8f, 0xf5,
+    0x0, 0x0, 0x0, 0xaf, 0xfc, 0x16, 0xff, 0x88,
+    0xff, 0x50, 0x0, 0x0, 0x2, 0xdf, 0xf7, 0x6f,
+    0xf8, 0x8f, 0xf5, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0xea, 0xff, 0x88, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x9, 0xff, 0xff, 0xf8, 0x8f, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x2d, 0xff, 0xff, 0x88, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf8, 0x8f,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
+    0x88, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xdf, 0xf8,
+
+    /* U+00D2 "Ò" */
+    0x0, 0x0, 0x0, 0x3, 0x99, 0x93, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1c, 0xfe, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d,
+    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4b, 0xb2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x23, 0x33,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x27, 0xce, 0xee, 0xed, 0xc7, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8e, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0x71, 0x0, 0x0, 0x0, 0x1, 0xbf, 0xff,
+    0xea, 0x77, 0x7a, 0xef, 0xff, 0xa1, 0x0, 0x0,
+    0x1, 0xbf, 0xfe, 0x82, 0x0, 0x0, 0x2, 0x8e,
+    0xff, 0xb1, 0x0, 0x0, 0x8f, 0xfd, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x5e, 0xff, 0x70, 0x0, 0x3e,
+    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
+    0xfe, 0x20, 0x8, 0xff, 0xa0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xbf, 0xf8, 0x1, 0xcf, 0xf4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0xd0, 0x2e, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2e, 0xfe, 0x34, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf5,
+    0x6f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0x67, 0xff, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf6, 0x6f,
+    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0x65, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xcf, 0xf5, 0x3f, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e,
+    0xfe, 0x31, 0xdf, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0xd1, 0x9, 0xff, 0x90,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf9,
+    0x0, 0x3e, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3e, 0xff, 0x40, 0x0, 0xaf, 0xfc, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x2c, 0xff, 0xa0, 0x0,
+    0x2, 0xdf, 0xfc, 0x40, 0x0, 0x0, 0x0, 0x4d,
+    0xff, 0xd2, 0x0, 0x0, 0x3, 0xdf, 0xfe, 0xa5,
+    0x43, 0x46, 0xae, 0xff, 0xd3, 0x0, 0x0, 0x0,
+    0x2, 0xbf, 0xff, 0xff, 0xef, 0xff, 0xff, 0xb3,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x5b, 0xff, 0xff,
+    0xff, 0xfb, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x46, 0x76, 0x41, 0x0, 0x0, 0x0,
+    0x0,
+
+    /* U+00D3 "Ó" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x99, 0x81,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xcf, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xfa, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0xfc, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xcb, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x23, 0x33,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x27, 0xce, 0xee, 0xed, 0xc7, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8e, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0x71, 0x0, 0x0, 0x0, 0x1, 0xbf, 0xff,
+    0xea, 0x77, 0x7a, 0xef, 0xff, 0xa1, 0x0, 0x0,
+    0x1, 0xbf, 0xfe, 0x82, 0x0, 0x0, 0x2, 0x8e,
+    0xff, 0xb1, 0x0, 0x0, 0x8f, 0xfd, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x5e, 0xff, 0x70, 0x0, 0x3e,
+    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
+    0xfe, 0x20, 0x8, 0xff, 0xa0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xbf, 0xf8, 0x1, 0xcf, 0xf4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0xd0, 0x2e, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2e, 0xfe, 0x34, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf5,
+    0x6f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0x67, 0xff, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf6, 0x6f,
+    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0x65, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xcf, 0xf5, 0x3f, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e,
+    0xfe, 0x31, 0xdf, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0xd1, 0x9, 0xff, 0x90,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf9,
+    0x0, 0x3e, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3e, 0xff, 0x40, 0x0, 0xaf, 0xfc, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x2c, 0xff, 0xa0, 0x0,
+    0x2, 0xdf, 0xfc, 0x40, 0x0, 0x0, 0x0, 0x4d,
+    0xff, 0xd2, 0x0, 0x0, 0x3, 0xdf, 0xfe, 0xa5,
+    0x43, 0x46, 0xae, 0xff, 0xd3, 0x0, 0x0, 0x0,
+    0x2, 0xbf, 0xff, 0xff, 0xef, 0xff, 0xff, 0xb3,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x5b, 0xff, 0xff,
+    0xff, 0xfb, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x46, 0x76, 0x41, 0x0, 0x0, 0x0,
+    0x0,
+
+    /* U+00D4 "Ô" */
+    0x0, 0x0, 0x0, 0x0, 0x3, 0x99, 0x82, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xdf, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xbf, 0xe8, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf8,
+    0x9, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3b, 0xca, 0x10, 0x2b, 0xcb, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x23, 0x33,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x27, 0xce, 0xee, 0xed, 0xc7, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8e, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0x71, 0x0, 0x0, 0x0, 0x1, 0xbf, 0xff,
+    0xea, 0x77, 0x7a, 0xef, 0xff, 0xa1, 0x0, 0x0,
+    0x1, 0xbf, 0xfe, 0x82, 0x0, 0x0, 0x2, 0x8e,
+    0xff, 0xb1, 0x0, 0x0, 0x8f, 0xfd, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x5e, 0xff, 0x70, 0x0, 0x3e,
+    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
+    0xfe, 0x20, 0x8, 0xff, 0xa0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xbf, 0xf8, 0x1, 0xcf, 0xf4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0xd0, 0x2e, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2e, 0xfe, 0x34, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf5,
+    0x6f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0x67, 0xff, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf6, 0x6f,
+    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0x65, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xcf, 0xf5, 0x3f, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e,
+    0xfe, 0x31, 0xdf, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0xd1, 0x9, 0xff, 0x90,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf9,
+    0x0, 0x3e, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3e, 0xff, 0x40, 0x0, 0xaf, 0xfc, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x2c, 0xff, 0xa0, 0x0,
+    0x2, 0xdf, 0xfc, 0x40, 0x0, 0x0, 0x0, 0x4d,
+    0xff, 0xd2, 0x0, 0x0, 0x3, 0xdf, 0xfe, 0xa5,
+    0x43, 0x46, 0xae, 0xff, 0xd3, 0x0, 0x0, 0x0,
+    0x2, 0xbf, 0xff, 0xff, 0xef, 0xff, 0xff, 0xb3,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x5b, 0xff, 0xff,
+    0xff, 0xfb, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x46, 0x76, 0x41, 0x0, 0x0, 0x0,
+    0x0,
+
+    /* U+00D5 "Õ" */
+    0x0, 0x0, 0x0, 0x2, 0x8a, 0x72, 0x0, 0x4a,
+    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xdf,
+    0xff, 0xfb, 0x7c, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xd6, 0xae, 0xff, 0xfe, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xc5, 0x0,
+    0x38, 0xba, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0x33, 0x31, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0x7c, 0xee, 0xee,
+    0xdc, 0x72, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xef, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x10, 0x0,
+    0x0, 0x0, 0x1b, 0xff, 0xfe, 0xa7, 0x77, 0xae,
+    0xff, 0xfa, 0x10, 0x0, 0x0, 0x1b, 0xff, 0xe8,
+    0x20, 0x0, 0x0, 0x28, 0xef, 0xfb, 0x10, 0x0,
+    0x8, 0xff, 0xd4, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xef, 0xf7, 0x0, 0x3, 0xef, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0xe2, 0x0, 0x8f,
+    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b,
+    0xff, 0x80, 0x1c, 0xff, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xfd, 0x2, 0xef, 0xf1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef,
+    0xe3, 0x4f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xd, 0xff, 0x56, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf6,
+    0x7f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0x66, 0xff, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf6, 0x5f,
+    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0xff, 0x53, 0xff, 0xe0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xef, 0xe3, 0x1d, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xfd, 0x10, 0x9f, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0x90, 0x3, 0xef, 0xe3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xef, 0xf4,
+    0x0, 0xa, 0xff, 0xc2, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xcf, 0xfa, 0x0, 0x0, 0x2d, 0xff, 0xc4,
+    0x0, 0x0, 0x0, 0x4, 0xdf, 0xfd, 0x20, 0x0,
+    0x0, 0x3d, 0xff, 0xea, 0x54, 0x34, 0x6a, 0xef,
+    0xfd, 0x30, 0x0, 0x0, 0x0, 0x2b, 0xff, 0xff,
+    0xfe, 0xff, 0xff, 0xfb, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x15, 0xbf, 0xff, 0xff, 0xff, 0xb5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x14, 0x67,
+    0x64, 0x10, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+00D6 "Ö" */
+    0x0, 0x0, 0x0, 0x5, 0x66, 0x0, 0x16, 0x65,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf,
+    0xf0, 0x3, 0xef, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1d, 0xff, 0x0, 0x3e, 0xfd, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xac, 0xb0,
+    0x2, 0xbc, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0x33, 0x31, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0x7c, 0xee, 0xee,
+    0xdc, 0x72, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xef, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x10, 0x0,
+    0x0, 0x0, 0x1b, 0xff, 0xfe, 0xa7, 0x77, 0xae,
+    0xff, 0xfa, 0x10, 0x0, 0x0, 0x1b, 0xff, 0xe8,
+    0x20, 0x0, 0x0, 0x28, 0xef, 0xfb, 0x10, 0x0,
+    0x8, 0xff, 0xd4, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xef, 0xf7, 0x0, 0x3, 0xef, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0xe2, 0x0, 0x8f,
+    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b,
+    0xff, 0x80, 0x1c, 0xff, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xfd, 0x2, 0xef, 0xf1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef,
+    0xe3, 0x4f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xd, 0xff, 0x56, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf6,
+    0x7f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0x66, 0xff, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf6, 0x5f,
+    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0xff, 0x53, 0xff, 0xe0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xef, 0xe3, 0x1d, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xfd, 0x10, 0x9f, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0x90, 0x3, 0xef, 0xe3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xef, 0xf4,
+    0x0, 0xa, 0xff, 0xc2, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xcf, 0xfa, 0x0, 0x0, 0x2d, 0xff, 0xc4,
+    0x0, 0x0, 0x0, 0x4, 0xdf, 0xfd, 0x20, 0x0,
+    0x0, 0x3d, 0xff, 0xea, 0x54, 0x34, 0x6a, 0xef,
+    0xfd, 0x30, 0x0, 0x0, 0x0, 0x2b, 0xff, 0xff,
+    0xfe, 0xff, 0xff, 0xfb, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x15, 0xbf, 0xff, 0xff, 0xff, 0xb5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x14, 0x67,
+    0x64, 0x10, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+00D7 "×" */
+    0x4, 0xb2, 0x0, 0x0, 0x0, 0x5, 0xa1, 0x3d,
+    0xfd, 0x20, 0x0, 0x0, 0x5e, 0xfb, 0x1b, 0xff,
+    0xd2, 0x0, 0x5, 0xff, 0xf7, 0x1, 0xbf, 0xfd,
+    0x30, 0x5f, 0xff, 0x70, 0x0, 0x1b, 0xff, 0xd7,
+    0xef, 0xf7, 0x0, 0x0, 0x1, 0xbf, 0xff, 0xff,
+    0x70, 0x0, 0x0, 0x0, 0x1c, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xff, 0xfd, 0x20, 0x0,
+    0x0, 0x6, 0xff, 0xfd, 0xff, 0xd3, 0x0, 0x0,
+    0x6f, 0xfe, 0x71, 0xbf, 0xfd, 0x30, 0x6, 0xef,
+    0xf7, 0x0, 0x1b, 0xff, 0xd3, 0x4e, 0xff, 0x70,
+    0x0, 0x1, 0xbf, 0xfd, 0x9, 0xf6, 0x0, 0x0,
+    0x0, 0x1b, 0xe4, 0x0, 0x40, 0x0, 0x0, 0x0,
+    0x1, 0x30,
+
+    /* U+00D8 "Ø" */
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x23, 0x31, 0x0,
+    0x0, 0x0, 0x25, 0x0, 0x0, 0x0, 0x2, 0x7c,
+    0xde, 0xee, 0xdc, 0x71, 0x0, 0x1c, 0xe6, 0x0,
+    0x0, 0x8, 0xef, 0xff, 0xff, 0xff, 0xff, 0xd6,
+    0x1b, 0xfd, 0x20, 0x0, 0x1c, 0xff, 0xfd, 0xa7,
+    0x77, 0xae, 0xff, 0xfd, 0xfe, 0x30, 0x0, 0x1c,
+    0xff, 0xe7, 0x10, 0x0, 0x0, 0x29, 0xef, 0xff,
+    0x40, 0x0, 0x8, 0xff, 0xd4, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0xf6, 0x0, 0x3, 0xef, 0xf4,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xef, 0xff, 0xd1,
+    0x0, 0x8f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xef, 0x8c, 0xff, 0x70, 0x1d, 0xff, 0x30, 0x0,
+    0x0, 0x0, 0x3, 0xef, 0x90, 0x7f, 0xfc, 0x3,
+    0xff, 0xe0, 0x0, 0x0, 0x0, 0x2, 0xdf, 0xa1,
+    0x3, 0xef, 0xe2, 0x5f, 0xfb, 0x0, 0x0, 0x0,
+    0x2, 0xcf, 0xb1, 0x0, 0x1d, 0xff, 0x47, 0xff,
+    0xa0, 0x0, 0x0, 0x1, 0xbf, 0xc2, 0x0, 0x0,
+    0xcf, 0xf5, 0x8f, 0xf9, 0x0, 0x0, 0x0, 0xaf,
+    0xd2, 0x0, 0x0, 0xb, 0xff, 0x67, 0xff, 0xa0,
+    0x0, 0x0, 0x9f, 0xe3, 0x0, 0x0, 0x0, 0xbf,
+    0xf5, 0x6f, 0xfb, 0x0, 0x0, 0x7f, 0xe4, 0x0,
+    0x0, 0x0, 0xd, 0xff, 0x44, 0xff, 0xd0, 0x0,
+    0x6f, 0xf6, 0x0, 0x0, 0x0, 0x1, 0xef, 0xe3,
+    0x2e, 0xff, 0x20, 0x5e, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xfd, 0x10, 0xaf, 0xf8, 0x3e, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0x80, 0x4,
+    0xef, 0xed, 0xf9, 0x10, 0x0, 0x0, 0x0, 0x4,
+    0xef, 0xe3, 0x0, 0xa, 0xff, 0xfb, 0x10, 0x0,
+    0x0, 0x0, 0x2, 0xdf, 0xf9, 0x0, 0x0, 0x3e,
+    0xff, 0xc4, 0x0, 0x0, 0x0, 0x4, 0xdf, 0xfc,
+    0x10, 0x0, 0x1a, 0xff, 0xff, 0xea, 0x53, 0x34,
+    0x6b, 0xff, 0xfd, 0x30, 0x0, 0x19, 0xfe, 0x4b,
+    0xff, 0xff, 0xee, 0xff, 0xff, 0xfa, 0x20, 0x0,
+    0x6, 0xfe, 0x40, 0x15, 0xcf, 0xff, 0xff, 0xff,
+    0xb4, 0x0, 0x0, 0x0, 0x19, 0x50, 0x0, 0x0,
+    0x25, 0x67, 0x64, 0x10, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+00D9 "Ù" */
+    0x0, 0x0, 0x2, 0x99, 0x94, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b, 0xff,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2d, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3c, 0xb2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6c, 0xc7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xcc, 0x78, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xf8, 0x8f, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0x88, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf8, 0x8f,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0x88, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xf8, 0x8f, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0x88, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xf8, 0x8f, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0x88, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf8,
+    0x8f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0x88, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xf8, 0x8f, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0x87, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xf8, 0x7f, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0x86,
+    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
+    0xf7, 0x4f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0x52, 0xef, 0xe1, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xef, 0xf2, 0xc, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xfc, 0x10, 0x7f, 0xfe,
+    0x61, 0x0, 0x0, 0x0, 0x5e, 0xff, 0x70, 0x1,
+    0xbf, 0xff, 0xc7, 0x54, 0x57, 0xbf, 0xff, 0xb1,
+    0x0, 0x2, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xb2, 0x0, 0x0, 0x1, 0x7d, 0xff, 0xff, 0xff,
+    0xfd, 0x60, 0x0, 0x0, 0x0, 0x0, 0x2, 0x56,
+    0x76, 0x52, 0x0, 0x0, 0x0,
+
+    /* U+00DA "Ú" */
+    0x0, 0x0, 0x0, 0x0, 0x4, 0x99, 0x81, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
+    0xfa, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0xfc, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xbb, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6c, 0xc7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xcc, 0x78, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xf8, 0x8f, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0x88, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf8, 0x8f,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0x88, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xf8, 0x8f, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0x88, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xf8, 0x8f, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0x88, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf8,
+    0x8f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0x88, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xf8, 0x8f, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0x87, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xf8, 0x7f, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0x86,
+    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
+    0xf7, 0x4f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0x52, 0xef, 0xe1, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xef, 0xf2, 0xc, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xfc, 0x10, 0x7f, 0xfe,
+    0x61, 0x0, 0x0, 0x0, 0x5e, 0xff, 0x70, 0x1,
+    0xbf, 0xff, 0xc7, 0x54, 0x57, 0xbf, 0xff, 0xb1,
+    0x0, 0x2, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xb2, 0x0, 0x0, 0x1, 0x7d, 0xff, 0xff, 0xff,
+    0xfd, 0x60, 0x0, 0x0, 0x0, 0x0, 0x2, 0x56,
+    0x76, 0x52, 0x0, 0x0, 0x0,
+
+    /* U+00DB "Û" */
+    0x0, 0x0, 0x0, 0x3, 0x99, 0x82, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xff, 0xb1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xaf, 0xf8,
+    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xf9, 0x9, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x2b, 0xcb, 0x10, 0x2b, 0xcb, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6d, 0xd7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xdd, 0x78, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xf8, 0x8f, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0x88, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf8, 0x8f,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0x88, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xf8, 0x8f, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0x88, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xf8, 0x8f, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0x88, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf8,
+    0x8f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0x88, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xf8, 0x8f, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0x87, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xf8, 0x7f, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0x86,
+    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
+    0xf7, 0x4f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0x52, 0xef, 0xe1, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xef, 0xf2, 0xc, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xfc, 0x10, 0x6f, 0xfe,
+    0x61, 0x0, 0x0, 0x0, 0x5e, 0xff, 0x70, 0x1,
+    0xbf, 0xff, 0xc7, 0x54, 0x57, 0xbf, 0xff, 0xb1,
+    0x0, 0x2, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xb2, 0x0, 0x0, 0x1, 0x7d, 0xff, 0xff, 0xff,
+    0xfd, 0x60, 0x0, 0x0, 0x0, 0x0, 0x2, 0x56,
+    0x76, 0x52, 0x0, 0x0, 0x0,
+
+    /* U+00DC "Ü" */
+    0x0, 0x0, 0x5, 0x66, 0x0, 0x16, 0x65, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xcf, 0xf1, 0x2, 0xef,
+    0xd0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xff, 0x10,
+    0x2e, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x1, 0xac,
+    0xc1, 0x2, 0xbc, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0xcc, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6c,
+    0xc7, 0x8f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0x88, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xf8, 0x8f, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0x88, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf8, 0x8f,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0x88, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xf8, 0x8f, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0x88, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xf8, 0x8f, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0x88, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf8,
+    0x8f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0x88, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xf8, 0x7f, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0x87, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xf8, 0x6f, 0xfa,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0x74,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
+    0xf5, 0x2e, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x1e, 0xff, 0x20, 0xcf, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xc1, 0x7, 0xff, 0xe6, 0x10,
+    0x0, 0x0, 0x5, 0xef, 0xf7, 0x0, 0x1b, 0xff,
+    0xfc, 0x75, 0x45, 0x7b, 0xff, 0xfb, 0x10, 0x0,
+    0x2b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x20,
+    0x0, 0x0, 0x17, 0xdf, 0xff, 0xff, 0xff, 0xd6,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x25, 0x67, 0x65,
+    0x20, 0x0, 0x0, 0x0,
+
+    /* U+00DD "Ý" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x39, 0x98, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xb1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xbf, 0xd2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2b, 0xb4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8d,
+    0xdc, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xdd, 0xa2, 0xdf, 0xfa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0xe3, 0x5, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xef, 0xf7, 0x0, 0xa,
+    0xff, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xfb,
+    0x10, 0x0, 0x2d, 0xff, 0x90, 0x0, 0x0, 0x0,
+    0x5f, 0xfe, 0x30, 0x0, 0x0, 0x5f, 0xfe, 0x50,
+    0x0, 0x0, 0x2d, 0xff, 0x60, 0x0, 0x0, 0x0,
+    0xaf, 0xfd, 0x10, 0x0, 0x9, 0xff, 0xa0, 0x0,
+    0x0, 0x0, 0x1, 0xef, 0xf9, 0x0, 0x5, 0xff,
+    0xe1, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xe4,
+    0x1, 0xcf, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xa, 0xff, 0xc1, 0x8f, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2d, 0xff, 0x8e, 0xfc, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
+    0xfe, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xef, 0xe1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xfe,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xef, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2e, 0xfe, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0xe1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2e, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xef, 0xe1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xfe, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xef, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2e, 0xfe, 0x10, 0x0, 0x0, 0x0,
+    0x0,
+
+    /* U+00DE "Þ" */
+    0x7d, 0xd6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf9,
+    0x44, 0x44, 0x44, 0x43, 0x20, 0x0, 0x0, 0x8,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xc6, 0x10,
+    0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfc, 0x20, 0x8, 0xff, 0xb7, 0x77, 0x77, 0x77,
+    0x8c, 0xff, 0xfb, 0x10, 0x8f, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xff, 0xf5, 0x8, 0xff, 0x70,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xa0, 0x8f,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xfc,
+    0x18, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0xd1, 0x8f, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xfc, 0x18, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0xa0, 0x8f, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x16, 0xff, 0xf5, 0x8, 0xff,
+    0xa5, 0x55, 0x55, 0x55, 0x8c, 0xff, 0xfb, 0x10,
+    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
+    0x20, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xd7, 0x10, 0x0, 0x8f, 0xfa, 0x66, 0x66, 0x66,
+    0x54, 0x20, 0x0, 0x0, 0x8, 0xff, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+00DF "ß" */
+    0x0, 0x0, 0x13, 0x45, 0x31, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x7d, 0xef, 0xfe, 0xd7, 0x10, 0x0,
+    0x0, 0x1, 0xbf, 0xff, 0xff, 0xff, 0xfa, 0x10,
+    0x0, 0x0, 0xaf, 0xfc, 0x41, 0x14, 0xdf, 0xf7,
+    0x0, 0x0, 0x3e, 0xfd, 0x10, 0x0, 0x3, 0xef,
+    0xb0, 0x0, 0x5, 0xff, 0x80, 0x0, 0x0, 0x1d,
+    0xfc, 0x10, 0x0, 0x8f, 0xf5, 0x0, 0x0, 0x2,
+    0xef, 0xa0, 0x0, 0x9, 0xff, 0x30, 0x0, 0x0,
+    0x7f, 0xf5, 0x0, 0x0, 0x9f, 0xf3, 0x0, 0x0,
+    0x1e, 0xfb, 0x10, 0x0, 0x9, 0xff, 0x30, 0x0,
+    0x9, 0xfe, 0x40, 0x0, 0x0, 0x9f, 0xf3, 0x0,
+    0x2, 0xef, 0xb0, 0x0, 0x0, 0x9, 0xff, 0x30,
+    0x0, 0x5f, 0xf8, 0x0, 0x0, 0x0, 0x9f, 0xf3,
+    0x0, 0x5, 0xff, 0xc1, 0x0, 0x0, 0x9, 0xff,
+    0x30, 0x0, 0x1d, 0xff, 0xb2, 0x0, 0x0, 0x9f,
+    0xf3, 0x0, 0x0, 0x4e, 0xff, 0xe6, 0x0, 0x9,
+    0xff, 0x30, 0x0, 0x0, 0x3c, 0xff, 0xf9, 0x10,
+    0x9f, 0xf3, 0x0, 0x0, 0x0, 0x18, 0xff, 0xf9,
+    0x9, 0xff, 0x30, 0x0, 0x0, 0x0, 0x5, 0xef,
+    0xe4, 0x9f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0x79, 0xff, 0x30, 0x1, 0x30, 0x0, 0x0,
+    0x6f, 0xf8, 0x9f, 0xf3, 0x6, 0xde, 0x30, 0x0,
+    0x9, 0xff, 0x59, 0xff, 0x30, 0x6f, 0xfd, 0x41,
+    0x17, 0xef, 0xd2, 0x9f, 0xf3, 0x0, 0x9f, 0xfe,
+    0xdd, 0xff, 0xe5, 0x9, 0xff, 0x30, 0x0, 0x7e,
+    0xff, 0xff, 0xd4, 0x0, 0x1, 0x10, 0x0, 0x0,
+    0x15, 0x76, 0x40, 0x0, 0x0,
+
+    /* U+00E0 "à" */
+    0x0, 0x0, 0x4, 0xdd, 0xd4, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1a, 0xff, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2c, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x37, 0x70,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xac, 0xee,
+    0xda, 0x61, 0x0, 0x0, 0x0, 0x5d, 0xff, 0xff,
+    0xff, 0xff, 0xd4, 0x0, 0x0, 0x4e, 0xff, 0xb7,
+    0x67, 0xae, 0xff, 0xd1, 0x0, 0x1b, 0xff, 0x60,
+    0x0, 0x0, 0x3d, 0xff, 0x50, 0x3, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x15, 0x74,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x12, 0x8f, 0xf8, 0x0, 0x0,
+    0x1, 0x25, 0x79, 0xbe, 0xff, 0xff, 0x80, 0x0,
+    0x5, 0xcf, 0xff, 0xff, 0xfe, 0xdf, 0xf8, 0x0,
+    0x8, 0xff, 0xfe, 0xdb, 0x96, 0x35, 0xff, 0x80,
+    0x5, 0xff, 0xe7, 0x21, 0x0, 0x0, 0x5f, 0xf8,
+    0x0, 0xaf, 0xf7, 0x0, 0x0, 0x0, 0x6, 0xff,
+    0x80, 0x1c, 0xff, 0x30, 0x0, 0x0, 0x0, 0xbf,
+    0xf8, 0x0, 0xbf, 0xf5, 0x0, 0x0, 0x0, 0x6f,
+    0xff, 0x90, 0x7, 0xff, 0xd4, 0x0, 0x2, 0x8e,
+    0xff, 0xfa, 0x0, 0x1c, 0xff, 0xec, 0xbc, 0xef,
+    0xe7, 0xdf, 0xd0, 0x0, 0x2b, 0xff, 0xff, 0xff,
+    0xa2, 0xb, 0xff, 0x30, 0x0, 0x2, 0x57, 0x64,
+    0x10, 0x0, 0x11, 0x10,
+
+    /* U+00E1 "á" */
+    0x0, 0x0, 0x0, 0x0, 0x1b, 0xdd, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xc1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xe3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0x86, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xac, 0xee,
+    0xda, 0x61, 0x0, 0x0, 0x0, 0x5d, 0xff, 0xff,
+    0xff, 0xff, 0xd4, 0x0, 0x0, 0x4e, 0xff, 0xb7,
+    0x67, 0xae, 0xff, 0xd1, 0x0, 0x1b, 0xff, 0x60,
+    0x0, 0x0, 0x3d, 0xff, 0x50, 0x3, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x15, 0x74,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x12, 0x8f, 0xf8, 0x0, 0x0,
+    0x1, 0x25, 0x79, 0xbe, 0xff, 0xff, 0x80, 0x0,
+    0x5, 0xcf, 0xff, 0xff, 0xfe, 0xdf, 0xf8, 0x0,
+    0x8, 0xff, 0xfe, 0xdb, 0x96, 0x35, 0xff, 0x80,
+    0x5, 0xff, 0xe7, 0x21, 0x0, 0x0, 0x5f, 0xf8,
+    0x0, 0xaf, 0xf7, 0x0, 0x0, 0x0, 0x6, 0xff,
+    0x80, 0x1c, 0xff, 0x30, 0x0, 0x0, 0x0, 0xbf,
+    0xf8, 0x0, 0xbf, 0xf5, 0x0, 0x0, 0x0, 0x6f,
+    0xff, 0x90, 0x7, 0xff, 0xd4, 0x0, 0x2, 0x8e,
+    0xff, 0xfa, 0x0, 0x1c, 0xff, 0xec, 0xbc, 0xef,
+    0xe7, 0xdf, 0xd0, 0x0, 0x2b, 0xff, 0xff, 0xff,
+    0xa2, 0xb, 0xff, 0x30, 0x0, 0x2, 0x57, 0x64,
+    0x10, 0x0, 0x11, 0x10,
+
+    /* U+00E2 "â" */
+    0x0, 0x0, 0x0, 0x2c, 0xdd, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1c, 0xff, 0xff, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0x6a, 0xfe, 0x30,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0xa1, 0x2e, 0xfc,
+    0x20, 0x0, 0x0, 0x0, 0x68, 0x72, 0x0, 0x48,
+    0x84, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xac, 0xee,
+    0xda, 0x61, 0x0, 0x0, 0x0, 0x5d, 0xff, 0xff,
+    0xff, 0xff, 0xd4, 0x0, 0x0, 0x4e, 0xff, 0xb7,
+    0x67, 0xae, 0xff, 0xd1, 0x0, 0x1b, 0xff, 0x60,
+    0x0, 0x0, 0x3d, 0xff, 0x50, 0x3, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x15, 0x74,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x12, 0x8f, 0xf8, 0x0, 0x0,
+    0x1, 0x25, 0x79, 0xbe, 0xff, 0xff, 0x80, 0x0,
+    0x5, 0xcf, 0xff, 0xff, 0xfe, 0xdf, 0xf8, 0x0,
+    0x8, 0xff, 0xfe, 0xdb, 0x96, 0x35, 0xff, 0x80,
+    0x5, 0xff, 0xe7, 0x21, 0x0, 0x0, 0x5f, 0xf8,
+    0x0, 0xaf, 0xf7, 0x0, 0x0, 0x0, 0x6, 0xff,
+    0x80, 0x1c, 0xff, 0x30, 0x0, 0x0, 0x0, 0xbf,
+    0xf8, 0x0, 0xbf, 0xf5, 0x0, 0x0, 0x0, 0x6f,
+    0xff, 0x90, 0x7, 0xff, 0xd4, 0x0, 0x2, 0x8e,
+    0xff, 0xfa, 0x0, 0x1c, 0xff, 0xec, 0xbc, 0xef,
+    0xe7, 0xdf, 0xd0, 0x0, 0x2b, 0xff, 0xff, 0xff,
+    0xa2, 0xb, 0xff, 0x30, 0x0, 0x2, 0x57, 0x64,
+    0x10, 0x0, 0x11, 0x10,
+
+    /* U+00E3 "ã" */
+    0x0, 0x0, 0x2, 0x64, 0x10, 0x1, 0x65, 0x10,
+    0x0, 0x0, 0x6, 0xef, 0xfd, 0x71, 0x5f, 0xd1,
+    0x0, 0x0, 0x2, 0xef, 0xcc, 0xff, 0xff, 0xf9,
+    0x0, 0x0, 0x0, 0x5f, 0xc0, 0x5, 0xce, 0xeb,
+    0x20, 0x0, 0x0, 0x1, 0x32, 0x0, 0x0, 0x33,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xac, 0xee,
+    0xda, 0x61, 0x0, 0x0, 0x0, 0x5d, 0xff, 0xff,
+    0xff, 0xff, 0xd4, 0x0, 0x0, 0x4e, 0xff, 0xb7,
+    0x67, 0xae, 0xff, 0xd1, 0x0, 0x1b, 0xff, 0x60,
+    0x0, 0x0, 0x3d, 0xff, 0x50, 0x3, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x15, 0x74,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x12, 0x8f, 0xf8, 0x0, 0x0,
+    0x1, 0x25, 0x79, 0xbe, 0xff, 0xff, 0x80, 0x0,
+    0x5, 0xcf, 0xff, 0xff, 0xfe, 0xdf, 0xf8, 0x0,
+    0x8, 0xff, 0xfe, 0xdb, 0x96, 0x35, 0xff, 0x80,
+    0x5, 0xff, 0xe7, 0x21, 0x0, 0x0, 0x5f, 0xf8,
+    0x0, 0xaf, 0xf7, 0x0, 0x0, 0x0, 0x6, 0xff,
+    0x80, 0x1c, 0xff, 0x30, 0x0, 0x0, 0x0, 0xbf,
+    0xf8, 0x0, 0xbf, 0xf5, 0x0, 0x0, 0x0, 0x6f,
+    0xff, 0x90, 0x7, 0xff, 0xd4, 0x0, 0x2, 0x8e,
+    0xff, 0xfa, 0x0, 0x1c, 0xff, 0xec, 0xbc, 0xef,
+    0xe7, 0xdf, 0xd0, 0x0, 0x2b, 0xff, 0xff, 0xff,
+    0xa2, 0xb, 0xff, 0x30, 0x0, 0x2, 0x57, 0x64,
+    0x10, 0x0, 0x11, 0x10,
+
+    /* U+00E4 "ä" */
+    0x0, 0x0, 0x7d, 0xd4, 0x0, 0xad, 0xd3, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0x50, 0xb, 0xff, 0x30,
+    0x0, 0x0, 0x0, 0x9f, 0xf5, 0x0, 0xbf, 0xf3,
+    0x0, 0x0, 0x0, 0x3, 0x55, 0x20, 0x4, 0x55,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xac, 0xee,
+    0xda, 0x61, 0x0, 0x0, 0x0, 0x5d, 0xff, 0xff,
+    0xff, 0xff, 0xd4, 0x0, 0x0, 0x4e, 0xff, 0xb7,
+    0x67, 0xae, 0xff, 0xd1, 0x0, 0x1b, 0xff, 0x60,
+    0x0, 0x0, 0x3d, 0xff, 0x50, 0x3, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x15, 0x74,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x12, 0x8f, 0xf8, 0x0, 0x0,
+    0x1, 0x25, 0x79, 0xbe, 0xff, 0xff, 0x80, 0x0,
+    0x5, 0xcf, 0xff, 0xff, 0xfe, 0xdf, 0xf8, 0x0,
+    0x8, 0xff, 0xfe, 0xdb, 0x96, 0x35, 0xff, 0x80,
+    0x5, 0xff, 0xe7, 0x21, 0x0, 0x0, 0x5f, 0xf8,
+    0x0, 0xaf, 0xf7, 0x0, 0x0, 0x0, 0x6, 0xff,
+    0x80, 0x1c, 0xff, 0x30, 0x0, 0x0, 0x0, 0xbf,
+    0xf8, 0x0, 0xbf, 0xf5, 0x0, 0x0, 0x0, 0x6f,
+    0xff, 0x90, 0x7, 0xff, 0xd4, 0x0, 0x2, 0x8e,
+    0xff, 0xfa, 0x0, 0x1c, 0xff, 0xec, 0xbc, 0xef,
+    0xe7, 0xdf, 0xd0, 0x0, 0x2b, 0xff, 0xff, 0xff,
+    0xa2, 0xb, 0xff, 0x30, 0x0, 0x2, 0x57, 0x64,
+    0x10, 0x0, 0x11, 0x10,
+
+    /* U+00E5 "å" */
+    0x0, 0x0, 0x0, 0x3, 0x76, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xea, 0xbc, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xd6, 0x0, 0xb7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1e, 0x40, 0x8, 0x90,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xba, 0x23, 0xd5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xbe, 0xd8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x22,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5a, 0xce,
+    0xed, 0xa6, 0x10, 0x0, 0x0, 0x5, 0xdf, 0xff,
+    0xff, 0xff, 0xfd, 0x40, 0x0, 0x4, 0xef, 0xfb,
+    0x76, 0x7a, 0xef, 0xfd, 0x10, 0x1, 0xbf, 0xf6,
+    0x0, 0x0, 0x3, 0xdf, 0xf5, 0x0, 0x3f, 0xfb,
+    0x0, 0x0, 0x0, 0x7, 0xff, 0x80, 0x1, 0x57,
+    0x40, 0x0, 0x0, 0x0, 0x4f, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x28, 0xff, 0x80, 0x0,
+    0x0, 0x12, 0x57, 0x9b, 0xef, 0xff, 0xf8, 0x0,
+    0x0, 0x5c, 0xff, 0xff, 0xff, 0xed, 0xff, 0x80,
+    0x0, 0x8f, 0xff, 0xed, 0xb9, 0x63, 0x5f, 0xf8,
+    0x0, 0x5f, 0xfe, 0x72, 0x10, 0x0, 0x5, 0xff,
+    0x80, 0xa, 0xff, 0x70, 0x0, 0x0, 0x0, 0x6f,
+    0xf8, 0x1, 0xcf, 0xf3, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0x80, 0xb, 0xff, 0x50, 0x0, 0x0, 0x6,
+    0xff, 0xf9, 0x0, 0x7f, 0xfd, 0x40, 0x0, 0x28,
+    0xef, 0xff, 0xa0, 0x1, 0xcf, 0xfe, 0xcb, 0xce,
+    0xfe, 0x7d, 0xfd, 0x0, 0x2, 0xbf, 0xff, 0xff,
+    0xfa, 0x20, 0xbf, 0xf3, 0x0, 0x0, 0x25, 0x76,
+    0x41, 0x0, 0x1, 0x11, 0x0,
+
+    /* U+00E6 "æ" */
+    0x0, 0x0, 0x16, 0xad, 0xee, 0xc9, 0x40, 0x0,
+    0x49, 0xce, 0xdb, 0x61, 0x0, 0x0, 0x0, 0x5,
+    0xef, 0xff, 0xff, 0xff, 0xfa, 0x29, 0xff, 0xff,
+    0xff, 0xfd, 0x40, 0x0, 0x0, 0x5e, 0xfe, 0xb8,
+    0x67, 0xae, 0xff, 0xef, 0xfd, 0x96, 0x7b, 0xff,
+    0xe3, 0x0, 0x1, 0xcf, 0xe4, 0x0, 0x0, 0x5,
+    0xff, 0xff, 0xb2, 0x0, 0x0, 0x6e, 0xfc, 0x10,
+    0x4, 0xff, 0x90, 0x0, 0x0, 0x1, 0xcf, 0xfe,
+    0x10, 0x0, 0x0, 0x8, 0xff, 0x50, 0x3, 0x8a,
+    0x40, 0x0, 0x0, 0x0, 0xaf, 0xf8, 0x0, 0x0,
+    0x0, 0x3, 0xef, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xbf, 0xf4, 0x0, 0x0, 0x0, 0x1,
+    0xcf, 0xe0, 0x0, 0x0, 0x1, 0x25, 0x79, 0xce,
+    0xff, 0xfa, 0x99, 0x99, 0x99, 0x99, 0xef, 0xf1,
+    0x0, 0x4, 0x9d, 0xff, 0xff, 0xff, 0xef, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x0, 0x7e,
+    0xff, 0xfe, 0xca, 0x74, 0xaf, 0xfb, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xa2, 0x4, 0xff, 0xe8, 0x31,
+    0x10, 0x0, 0xaf, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xa, 0xff, 0x60, 0x0, 0x0, 0x0,
+    0xbf, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x21, 0x0,
+    0x1d, 0xff, 0x20, 0x0, 0x0, 0x2, 0xef, 0xf9,
+    0x0, 0x0, 0x0, 0x3, 0xef, 0xd0, 0x1c, 0xff,
+    0x40, 0x0, 0x0, 0x1a, 0xff, 0xfe, 0x40, 0x0,
+    0x0, 0x1a, 0xff, 0x80, 0x8, 0xff, 0xd4, 0x10,
+    0x14, 0xbf, 0xfa, 0xef, 0xe7, 0x20, 0x3, 0xaf,
+    0xfd, 0x10, 0x2, 0xdf, 0xfe, 0xdd, 0xdf, 0xfe,
+    0x61, 0x6e, 0xff, 0xed, 0xde, 0xff, 0xd3, 0x0,
+    0x0, 0x2b, 0xff, 0xff, 0xfe, 0x92, 0x0, 0x4,
+    0xcf, 0xff, 0xff, 0xf9, 0x20, 0x0, 0x0, 0x0,
+    0x25, 0x76, 0x41, 0x0, 0x0, 0x0, 0x2, 0x57,
+    0x64, 0x10, 0x0, 0x0,
+
+    /* U+00E7 "ç" */
+    0x0, 0x0, 0x38, 0xce, 0xdb, 0x71, 0x0, 0x0,
+    0x1, 0xaf, 0xff, 0xff, 0xff, 0xe5, 0x0, 0x1,
+    0xbf, 0xfe, 0x96, 0x7b, 0xff, 0xe4, 0x0, 0x8f,
+    0xfc, 0x20, 0x0, 0x7, 0xff, 0xc1, 0x2d, 0xfe,
+    0x20, 0x0, 0x0, 0x1b, 0xff, 0x35, 0xff, 0x90,
+    0x0, 0x0, 0x0, 0x4a, 0x72, 0x8f, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xbf, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xf4, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x3d, 0xc6, 0x3f, 0xfb, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0x61, 0xcf, 0xf6, 0x0, 0x0, 0x2, 0xdf,
+    0xe2, 0x4, 0xef, 0xe7, 0x20, 0x14, 0xcf, 0xf8,
+    0x0, 0x6, 0xff, 0xfd, 0xdd, 0xef, 0xfa, 0x10,
+    0x0, 0x4, 0xcf, 0xff, 0xff, 0xe7, 0x10, 0x0,
+    0x0, 0x0, 0x4f, 0xe7, 0x41, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xfe, 0xb5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x25, 0xaf, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0x70, 0x0, 0x0, 0x0, 0x19,
+    0x9a, 0xef, 0xf3, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x15, 0x66,
+    0x41, 0x0, 0x0, 0x0,
+
+    /* U+00E8 "è" */
+    0x0, 0x0, 0xa, 0xdd, 0xa1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2d, 0xff, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4e, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf4, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x68, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x8c, 0xee,
+    0xb7, 0x10, 0x0, 0x0, 0x0, 0x19, 0xff, 0xff,
+    0xff, 0xfe, 0x60, 0x0, 0x0, 0x1a, 0xff, 0xea,
+    0x77, 0xae, 0xff, 0x60, 0x0, 0x7, 0xff, 0xd3,
+    0x0, 0x0, 0x4e, 0xfe, 0x30, 0x2, 0xdf, 0xe3,
+    0x0, 0x0, 0x0, 0x5f, 0xfa, 0x0, 0x6f, 0xfa,
+    0x0, 0x0, 0x0, 0x1, 0xcf, 0xf1, 0x9, 0xff,
+    0x50, 0x0, 0x0, 0x0, 0xa, 0xff, 0x40, 0xbf,
+    0xfb, 0x99, 0x99, 0x99, 0x99, 0xcf, 0xf6, 0x1c,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,
+    0xcf, 0xfb, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa5,
+    0xb, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x11,
+    0x0, 0x4, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x1c,
+    0xfd, 0x30, 0x1c, 0xff, 0x70, 0x0, 0x0, 0x7,
+    0xff, 0xd0, 0x0, 0x5e, 0xff, 0x93, 0x10, 0x28,
+    0xef, 0xf5, 0x0, 0x0, 0x6e, 0xff, 0xed, 0xde,
+    0xff, 0xf7, 0x0, 0x0, 0x0, 0x3b, 0xff, 0xff,
+    0xff, 0xc5, 0x0, 0x0, 0x0, 0x0, 0x2, 0x57,
+    0x75, 0x20, 0x0, 0x0,
+
+    /* U+00E9 "é" */
+    0x0, 0x0, 0x0, 0x0, 0x1b, 0xdd, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xd2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xe3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x86, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x8c, 0xee,
+    0xb7, 0x10, 0x0, 0x0, 0x0, 0x19, 0xff, 0xff,
+    0xff, 0xfe, 0x60, 0x0, 0x0, 0x1a, 0xff, 0xea,
+    0x77, 0xae, 0xff, 0x60, 0x0, 0x7, 0xff, 0xd3,
+    0x0, 0x0, 0x4e, 0xfe, 0x30, 0x2, 0xdf, 0xe3,
+    0x0, 0x0, 0x0, 0x5f, 0xfa, 0x0, 0x6f, 0xfa,
+    0x0, 0x0, 0x0, 0x1, 0xcf, 0xf1, 0x9, 0xff,
+    0x50, 0x0, 0x0, 0x0, 0xa, 0xff, 0x40, 0xbf,
+    0xfb, 0x99, 0x99, 0x99, 0x99, 0xcf, 0xf6, 0x1c,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,
+    0xcf, 0xfb, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa5,
+    0xb, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x11,
+    0x0, 0x4, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x1c,
+    0xfd, 0x30, 0x1c, 0xff, 0x70, 0x0, 0x0, 0x7,
+    0xff, 0xd0, 0x0, 0x5e, 0xff, 0x93, 0x10, 0x28,
+    0xef, 0xf5, 0x0, 0x0, 0x6e, 0xff, 0xed, 0xde,
+    0xff, 0xf7, 0x0, 0x0, 0x0, 0x3b, 0xff, 0xff,
+    0xff, 0xc5, 0x0, 0x0, 0x0, 0x0, 0x2, 0x57,
+    0x75, 0x20, 0x0, 0x0,
+
+    /* U+00EA "ê" */
+    0x0, 0x0, 0x0, 0x2c, 0xdd, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1c, 0xff, 0xff, 0x60, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0x7a, 0xfe, 0x30,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0xb1, 0x2e, 0xfc,
+    0x20, 0x0, 0x0, 0x0, 0x68, 0x72, 0x0, 0x48,
+    0x84, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x8c, 0xee,
+    0xb7, 0x10, 0x0, 0x0, 0x0, 0x19, 0xff, 0xff,
+    0xff, 0xfe, 0x60, 0x0, 0x0, 0x1a, 0xff, 0xea,
+    0x77, 0xae, 0xff, 0x60, 0x0, 0x7, 0xff, 0xd3,
+    0x0, 0x0, 0x4e, 0xfe, 0x30, 0x2, 0xdf, 0xe3,
+    0x0, 0x0, 0x0, 0x5f, 0xfa, 0x0, 0x6f, 0xfa,
+    0x0, 0x0, 0x0, 0x1, 0xcf, 0xf1, 0x9, 0xff,
+    0x50, 0x0, 0x0, 0x0, 0xa, 0xff, 0x40, 0xbf,
+    0xfb, 0x99, 0x99, 0x99, 0x99, 0xcf, 0xf6, 0x1c,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,
+    0xcf, 0xfb, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa5,
+    0xb, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x11,
+    0x0, 0x4, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x1c,
+    0xfd, 0x30, 0x1c, 0xff, 0x70, 0x0, 0x0, 0x7,
+    0xff, 0xd0, 0x0, 0x5e, 0xff, 0x93, 0x10, 0x28,
+    0xef, 0xf5, 0x0, 0x0, 0x6e, 0xff, 0xed, 0xde,
+    0xff, 0xf7, 0x0, 0x0, 0x0, 0x3b, 0xff, 0xff,
+    0xff, 0xc5, 0x0, 0x0, 0x0, 0x0, 0x2, 0x57,
+    0x75, 0x20, 0x0, 0x0,
+
+    /* U+00EB "ë" */
+    0x0, 0x0, 0x7d, 0xd5, 0x0, 0x9d, 0xd3, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0x60, 0xb, 0xff, 0x40,
+    0x0, 0x0, 0x0, 0x8f, 0xf6, 0x0, 0xbf, 0xf4,
+    0x0, 0x0, 0x0, 0x3, 0x55, 0x20, 0x4, 0x55,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x8c, 0xee,
+    0xb7, 0x10, 0x0, 0x0, 0x0, 0x19, 0xff, 0xff,
+    0xff, 0xfe, 0x60, 0x0, 0x0, 0x1a, 0xff, 0xea,
+    0x77, 0xae, 0xff, 0x60, 0x0, 0x7, 0xff, 0xd3,
+    0x0, 0x0, 0x4e, 0xfe, 0x30, 0x2, 0xdf, 0xe3,
+    0x0, 0x0, 0x0, 0x5f, 0xfa, 0x0, 0x6f, 0xfa,
+    0x0, 0x0, 0x0, 0x1, 0xcf, 0xf1, 0x9, 0xff,
+    0x50, 0x0, 0x0, 0x0, 0xa, 0xff, 0x40, 0xbf,
+    0xfb, 0x99, 0x99, 0x99, 0x99, 0xcf, 0xf6, 0x1c,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,
+    0xcf, 0xfb, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa5,
+    0xb, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x11,
+    0x0, 0x4, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x1c,
+    0xfd, 0x30, 0x1c, 0xff, 0x70, 0x0, 0x0, 0x7,
+    0xff, 0xd0, 0x0, 0x5e, 0xff, 0x93, 0x10, 0x28,
+    0xef, 0xf5, 0x0, 0x0, 0x6e, 0xff, 0xed, 0xde,
+    0xff, 0xf7, 0x0, 0x0, 0x0, 0x3b, 0xff, 0xff,
+    0xff, 0xc5, 0x0, 0x0, 0x0, 0x0, 0x2, 0x57,
+    0x75, 0x20, 0x0, 0x0,
+
+    /* U+00EC "ì" */
+    0x2c, 0xdd, 0x70, 0x0, 0x5f, 0xfe, 0x10, 0x0,
+    0x7f, 0xf7, 0x0, 0x1, 0xaf, 0xd1, 0x0, 0x1,
+    0x77, 0x20, 0x0, 0x0, 0x0, 0x0, 0x6, 0x87,
+    0x0, 0x1, 0xdf, 0xe0, 0x0, 0x1d, 0xfe, 0x0,
+    0x1, 0xdf, 0xe0, 0x0, 0x1d, 0xfe, 0x0, 0x1,
+    0xdf, 0xe0, 0x0, 0x1d, 0xfe, 0x0, 0x1, 0xdf,
+    0xe0, 0x0, 0x1d, 0xfe, 0x0, 0x1, 0xdf, 0xe0,
+    0x0, 0x1d, 0xfe, 0x0, 0x1, 0xdf, 0xe0, 0x0,
+    0x1d, 0xfe, 0x0, 0x1, 0xdf, 0xe0, 0x0, 0x1d,
+    0xfe, 0x0, 0x1, 0xdf, 0xe0, 0x0, 0x1d, 0xfe,
+    0x0,
+
+    /* U+00ED "í" */
+    0x0, 0x2d, 0xdd, 0x50, 0x9, 0xff, 0xa0, 0x2,
+    0xef, 0xc1, 0x0, 0x9f, 0xe2, 0x0, 0x6, 0x84,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x87, 0x0,
+    0x1, 0xdf, 0xe0, 0x0, 0x1d, 0xfe, 0x0, 0x1,
+    0xdf, 0xe0, 0x0, 0x1d, 0xfe, 0x0, 0x1, 0xdf,
+    0xe0, 0x0, 0x1d, 0xfe, 0x0, 0x1, 0xdf, 0xe0,
+    0x0, 0x1d, 0xfe, 0x0, 0x1, 0xdf, 0xe0, 0x0,
+    0x1d, 0xfe, 0x0, 0x1, 0xdf, 0xe0, 0x0, 0x1d,
+    0xfe, 0x0, 0x1, 0xdf, 0xe0, 0x0, 0x1d, 0xfe,
+    0x0, 0x1, 0xdf, 0xe0, 0x0, 0x1d, 0xfe, 0x0,
+    0x0,
+
+    /* U+00EE "î" */
+    0x0, 0x4, 0xcd, 0xd6, 0x0, 0x0, 0x1, 0xdf,
+    0xff, 0xe4, 0x0, 0x1, 0xaf, 0xf5, 0xcf, 0xd2,
+    0x0, 0x8f, 0xf9, 0x3, 0xff, 0xb1, 0x17, 0x87,
+    0x10, 0x5, 0x88, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x68, 0x70, 0x0, 0x0, 0x0,
+    0x1d, 0xfe, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xe0,
+    0x0, 0x0, 0x0, 0x1d, 0xfe, 0x0, 0x0, 0x0,
+    0x1, 0xdf, 0xe0, 0x0, 0x0, 0x0, 0x1d, 0xfe,
+    0x0, 0x0, 0x0, 0x1, 0xdf, 0xe0, 0x0, 0x0,
+    0x0, 0x1d, 0xfe, 0x0, 0x0, 0x0, 0x1, 0xdf,
+    0xe0, 0x0, 0x0, 0x0, 0x1d, 0xfe, 0x0, 0x0,
+    0x0, 0x1, 0xdf, 0xe0, 0x0, 0x0, 0x0, 0x1d,
+    0xfe, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xe0, 0x0,
+    0x0, 0x0, 0x1d, 0xfe, 0x0, 0x0, 0x0, 0x1,
+    0xdf, 0xe0, 0x0, 0x0, 0x0, 0x1d, 0xfe, 0x0,
+    0x0, 0x0, 0x1, 0xdf, 0xe0, 0x0, 0x0,
+
+    /* U+00EF "ï" */
+    0xbd, 0xc2, 0x1, 0xdd, 0xb1, 0xdf, 0xe2, 0x1,
+    0xff, 0xc1, 0xdf, 0xe2, 0x1, 0xff, 0xc1, 0x45,
+    0x51, 0x0, 0x55, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0x87, 0x0, 0x0, 0x0, 0x1d, 0xfe, 0x0, 0x0,
+    0x0, 0x1d, 0xfe, 0x0, 0x0, 0x0, 0x1d, 0xfe,
+    0x0, 0x0, 0x0, 0x1d, 0xfe, 0x0, 0x0, 0x0,
+    0x1d, 0xfe, 0x0, 0x0, 0x0, 0x1d, 0xfe, 0x0,
+    0x0, 0x0, 0x1d, 0xfe, 0x0, 0x0, 0x0, 0x1d,
+    0xfe, 0x0, 0x0, 0x0, 0x1d, 0xfe, 0x0, 0x0,
+    0x0, 0x1d, 0xfe, 0x0, 0x0, 0x0, 0x1d, 0xfe,
+    0x0, 0x0, 0x0, 0x1d, 0xfe, 0x0, 0x0, 0x0,
+    0x1d, 0xfe, 0x0, 0x0, 0x0, 0x1d, 0xfe, 0x0,
+    0x0, 0x0, 0x1d, 0xfe, 0x0, 0x0, 0x0, 0x1d,
+    0xfe, 0x0, 0x0,
+
+    /* U+00F0 "ð" */
+    0x0, 0x0, 0x7, 0xdd, 0x91, 0x1, 0x68, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0xb7, 0xdf, 0xd2,
+    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xfe, 0x92,
+    0x0, 0x0, 0x0, 0x0, 0x28, 0xdf, 0xff, 0xc1,
+    0x0, 0x0, 0x0, 0x0, 0x6e, 0xfd, 0x77, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x4, 0xc6, 0x10, 0x9,
+    0xff, 0x60, 0x0, 0x0, 0x0, 0x1, 0x46, 0x75,
+    0x2e, 0xfd, 0x20, 0x0, 0x0, 0x6, 0xef, 0xff,
+    0xfe, 0xdf, 0xf9, 0x0, 0x0, 0x8, 0xff, 0xfd,
+    0xbc, 0xef, 0xff, 0xe2, 0x0, 0x6, 0xff, 0xd5,
+    0x10, 0x2, 0xaf, 0xff, 0x70, 0x1, 0xdf, 0xf4,
+    0x0, 0x0, 0x1, 0xaf, 0xfc, 0x0, 0x6f, 0xfa,
+    0x0, 0x0, 0x0, 0x2, 0xef, 0xf1, 0x9, 0xff,
+    0x50, 0x0, 0x0, 0x0, 0xa, 0xff, 0x40, 0xbf,
+    0xf2, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf6, 0x1c,
+    0xfe, 0x10, 0x0, 0x0, 0x0, 0x6, 0xff, 0x71,
+    0xcf, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf7,
+    0xb, 0xff, 0x20, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0x60, 0x9f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xbf,
+    0xf3, 0x5, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x3e,
+    0xfe, 0x0, 0x1d, 0xff, 0x50, 0x0, 0x0, 0x1b,
+    0xff, 0x80, 0x0, 0x5e, 0xfe, 0x72, 0x1, 0x4b,
+    0xff, 0xc1, 0x0, 0x0, 0x7f, 0xff, 0xed, 0xde,
+    0xff, 0xc3, 0x0, 0x0, 0x0, 0x4c, 0xff, 0xff,
+    0xfe, 0x91, 0x0, 0x0, 0x0, 0x0, 0x2, 0x57,
+    0x64, 0x10, 0x0, 0x0,
+
+    /* U+00F1 "ñ" */
+    0x0, 0x0, 0x28, 0x96, 0x10, 0x5, 0xa5, 0x0,
+    0x0, 0x3e, 0xff, 0xfe, 0x97, 0xdf, 0x60, 0x0,
+    0xa, 0xfc, 0x7c, 0xff, 0xff, 0xd1, 0x0, 0x0,
+    0xac, 0x30, 0x4, 0x9c, 0x92, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x16, 0x85, 0x1,
+    0x7c, 0xdd, 0xb6, 0x10, 0x1, 0xcf, 0x94, 0xef,
+    0xff, 0xff, 0xfd, 0x30, 0x1c, 0xfc, 0xef, 0xd9,
+    0x8a, 0xef, 0xfc, 0x11, 0xcf, 0xff, 0x71, 0x0,
+    0x4, 0xef, 0xf4, 0x1c, 0xff, 0x90, 0x0, 0x0,
+    0x8, 0xff, 0x71, 0xcf, 0xf3, 0x0, 0x0, 0x0,
+    0x5f, 0xf8, 0x1c, 0xff, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0x91, 0xcf, 0xe0, 0x0, 0x0, 0x0, 0x3f,
+    0xf9, 0x1c, 0xfe, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0x91, 0xcf, 0xe0, 0x0, 0x0, 0x0, 0x3f, 0xf9,
+    0x1c, 0xfe, 0x0, 0x0, 0x0, 0x3, 0xff, 0x91,
+    0xcf, 0xe0, 0x0, 0x0, 0x0, 0x3f, 0xf9, 0x1c,
+    0xfe, 0x0, 0x0, 0x0, 0x3, 0xff, 0x91, 0xcf,
+    0xe0, 0x0, 0x0, 0x0, 0x3f, 0xf9, 0x1c, 0xfe,
+    0x0, 0x0, 0x0, 0x3, 0xff, 0x91, 0xcf, 0xe0,
+    0x0, 0x0, 0x0, 0x3f, 0xf9, 0x1c, 0xfe, 0x0,
+    0x0, 0x0, 0x3, 0xff, 0x90,
+
+    /* U+00F2 "ò" */
+    0x0, 0x0, 0xa, 0xdd, 0xa1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2d, 0xff, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4e, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf4, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x68, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x9c, 0xde,
+    0xb7, 0x20, 0x0, 0x0, 0x0, 0x2a, 0xff, 0xff,
+    0xff, 0xfe, 0x70, 0x0, 0x0, 0x2c, 0xff, 0xea,
+    0x77, 0xbe, 0xff, 0x80, 0x0, 0xa, 0xff, 0xc2,
+    0x0, 0x0, 0x5e, 0xff, 0x50, 0x3, 0xef, 0xd2,
+    0x0, 0x0, 0x0, 0x6f, 0xfd, 0x0, 0x8f, 0xf7,
+    0x0, 0x0, 0x0, 0x1, 0xcf, 0xf3, 0xb, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0x8, 0xff, 0x61, 0xcf,
+    0xe1, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8, 0x1d,
+    0xfd, 0x10, 0x0, 0x0, 0x0, 0x4, 0xff, 0x91,
+    0xdf, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8,
+    0x1c, 0xff, 0x20, 0x0, 0x0, 0x0, 0x6, 0xff,
+    0x70, 0xaf, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xf5, 0x6, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x2d,
+    0xff, 0x10, 0x1d, 0xff, 0x50, 0x0, 0x0, 0x1a,
+    0xff, 0xa0, 0x0, 0x6f, 0xfe, 0x72, 0x1, 0x3a,
+    0xff, 0xe2, 0x0, 0x0, 0x7f, 0xff, 0xed, 0xde,
+    0xff, 0xd4, 0x0, 0x0, 0x0, 0x4c, 0xff, 0xff,
+    0xfe, 0x92, 0x0, 0x0, 0x0, 0x0, 0x2, 0x57,
+    0x64, 0x10, 0x0, 0x0,
+
+    /* U+00F3 "ó" */
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xdd, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xd2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xe3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x86, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x9c, 0xde,
+    0xb7, 0x20, 0x0, 0x0, 0x0, 0x2a, 0xff, 0xff,
+    0xff, 0xfe, 0x70, 0x0, 0x0, 0x2c, 0xff, 0xea,
+    0x77, 0xbe, 0xff, 0x80, 0x0, 0xa, 0xff, 0xc2,
+    0x0, 0x0, 0x5e, 0xff, 0x50, 0x3, 0xef, 0xd2,
+    0x0, 0x0, 0x0, 0x6f, 0xfd, 0x0, 0x8f, 0xf7,
+    0x0, 0x0, 0x0, 0x1, 0xcf, 0xf3, 0xb, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0x8, 0xff, 0x61, 0xcf,
+    0xe1, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8, 0x1d,
+    0xfd, 0x10, 0x0, 0x0, 0x0, 0x4, 0xff, 0x91,
+    0xdf, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8,
+    0x1c, 0xff, 0x20, 0x0, 0x0, 0x0, 0x6, 0xff,
+    0x70, 0xaf, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xf5, 0x6, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x2d,
+    0xff, 0x10, 0x1d, 0xff, 0x50, 0x0, 0x0, 0x1a,
+    0xff, 0xa0, 0x0, 0x6f, 0xfe, 0x72, 0x1, 0x3a,
+    0xff, 0xe2, 0x0, 0x0, 0x7f, 0xff, 0xed, 0xde,
+    0xff, 0xd4, 0x0, 0x0, 0x0, 0x4c, 0xff, 0xff,
+    0xfe, 0x92, 0x0, 0x0, 0x0, 0x0, 0x2, 0x57,
+    0x64, 0x10, 0x0, 0x0,
+
+    /* U+00F4 "ô" */
+    0x0, 0x0, 0x0, 0x2c, 0xdd, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0x60, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0x7a, 0xfe, 0x30,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0xb1, 0x2e, 0xfd,
+    0x20, 0x0, 0x0, 0x0, 0x68, 0x72, 0x0, 0x48,
+    0x84, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x9c, 0xde,
+    0xb7, 0x20, 0x0, 0x0, 0x0, 0x2a, 0xff, 0xff,
+    0xff, 0xfe, 0x70, 0x0, 0x0, 0x2c, 0xff, 0xea,
+    0x77, 0xbe, 0xff, 0x80, 0x0, 0xa, 0xff, 0xc2,
+    0x0, 0x0, 0x5e, 0xff, 0x50, 0x3, 0xef, 0xd2,
+    0x0, 0x0, 0x0, 0x6f, 0xfd, 0x0, 0x8f, 0xf7,
+    0x0, 0x0, 0x0, 0x1, 0xcf, 0xf3, 0xb, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0x8, 0xff, 0x61, 0xcf,
+    0xe1, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8, 0x1d,
+    0xfd, 0x10, 0x0, 0x0, 0x0, 0x4, 0xff, 0x91,
+    0xdf, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8,
+    0x1c, 0xff, 0x20, 0x0, 0x0, 0x0, 0x6, 0xff,
+    0x70, 0xaf, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xf5, 0x6, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x2d,
+    0xff, 0x10, 0x1d, 0xff, 0x50, 0x0, 0x0, 0x1a,
+    0xff, 0xa0, 0x0, 0x6f, 0xfe, 0x72, 0x1, 0x3a,
+    0xff, 0xe2, 0x0, 0x0, 0x7f, 0xff, 0xed, 0xde,
+    0xff, 0xd4, 0x0, 0x0, 0x0, 0x4c, 0xff, 0xff,
+    0xfe, 0x92, 0x0, 0x0, 0x0, 0x0, 0x2, 0x57,
+    0x64, 0x10, 0x0, 0x0,
+
+    /* U+00F5 "õ" */
+    0x0, 0x0, 0x2, 0x64, 0x10, 0x1, 0x66, 0x10,
+    0x0, 0x0, 0x6, 0xef, 0xfd, 0x72, 0x4f, 0xd1,
+    0x0, 0x0, 0x2, 0xef, 0xcc, 0xff, 0xff, 0xf9,
+    0x0, 0x0, 0x0, 0x5f, 0xc0, 0x5, 0xbe, 0xeb,
+    0x20, 0x0, 0x0, 0x1, 0x32, 0x0, 0x0, 0x33,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x9c, 0xde,
+    0xb7, 0x20, 0x0, 0x0, 0x0, 0x2a, 0xff, 0xff,
+    0xff, 0xfe, 0x70, 0x0, 0x0, 0x2c, 0xff, 0xea,
+    0x77, 0xbe, 0xff, 0x80, 0x0, 0xa, 0xff, 0xc2,
+    0x0, 0x0, 0x5e, 0xff, 0x50, 0x3, 0xef, 0xd2,
+    0x0, 0x0, 0x0, 0x6f, 0xfd, 0x0, 0x8f, 0xf7,
+    0x0, 0x0, 0x0, 0x1, 0xcf, 0xf3, 0xb, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0x8, 0xff, 0x61, 0xcf,
+    0xe1, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8, 0x1d,
+    0xfd, 0x10, 0x0, 0x0, 0x0, 0x4, 0xff, 0x91,
+    0xdf, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8,
+    0x1c, 0xff, 0x20, 0x0, 0x0, 0x0, 0x6, 0xff,
+    0x70, 0xaf, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xf5, 0x6, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x2d,
+    0xff, 0x10, 0x1d, 0xff, 0x50, 0x0, 0x0, 0x1a,
+    0xff, 0xa0, 0x0, 0x6f, 0xfe, 0x72, 0x1, 0x3a,
+    0xff, 0xe2, 0x0, 0x0, 0x7f, 0xff, 0xed, 0xde,
+    0xff, 0xd4, 0x0, 0x0, 0x0, 0x4c, 0xff, 0xff,
+    0xfe, 0x92, 0x0, 0x0, 0x0, 0x0, 0x2, 0x57,
+    0x64, 0x10, 0x0, 0x0,
+
+    /* U+00F6 "ö" */
+    0x0, 0x0, 0x7d, 0xd5, 0x0, 0x9d, 0xd3, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0x60, 0xb, 0xff, 0x40,
+    0x0, 0x0, 0x0, 0x8f, 0xf6, 0x0, 0xbf, 0xf4,
+    0x0, 0x0, 0x0, 0x3, 0x55, 0x20, 0x4, 0x55,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x9c, 0xde,
+    0xb7, 0x20, 0x0, 0x0, 0x0, 0x2a, 0xff, 0xff,
+    0xff, 0xfe, 0x70, 0x0, 0x0, 0x2c, 0xff, 0xea,
+    0x77, 0xbe, 0xff, 0x80, 0x0, 0xa, 0xff, 0xc2,
+    0x0, 0x0, 0x5e, 0xff, 0x50, 0x3, 0xef, 0xd2,
+    0x0, 0x0, 0x0, 0x6f, 0xfd, 0x0, 0x8f, 0xf7,
+    0x0, 0x0, 0x0, 0x1, 0xcf, 0xf3, 0xb, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0x8, 0xff, 0x61, 0xcf,
+    0xe1, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8, 0x1d,
+    0xfd, 0x10, 0x0, 0x0, 0x0, 0x4, 0xff, 0x91,
+    0xdf, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8,
+    0x1c, 0xff, 0x20, 0x0, 0x0, 0x0, 0x6, 0xff,
+    0x70, 0xaf, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xf5, 0x6, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x2d,
+    0xff, 0x10, 0x1d, 0xff, 0x50, 0x0, 0x0, 0x1a,
+    0xff, 0xa0, 0x0, 0x6f, 0xfe, 0x72, 0x1, 0x3a,
+    0xff, 0xe2, 0x0, 0x0, 0x7f, 0xff, 0xed, 0xde,
+    0xff, 0xd4, 0x0, 0x0, 0x0, 0x4c, 0xff, 0xff,
+    0xfe, 0x92, 0x0, 0x0, 0x0, 0x0, 0x2, 0x57,
+    0x64, 0x10, 0x0, 0x0,
+
+    /* U+00F7 "÷" */
+    0x0, 0x0, 0x1, 0xac, 0xc5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xcf, 0xf6, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xcf, 0xf6, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x46, 0x62, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa4,
+    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
+    0xbe, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x33, 0x31, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xcf, 0xf6, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xcf, 0xf6, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xcf, 0xf6, 0x0, 0x0, 0x0,
+
+    /* U+00F8 "ø" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x23,
+    0x0, 0x0, 0x0, 0x49, 0xce, 0xdb, 0x61, 0x1c,
+    0xe3, 0x0, 0x2, 0xaf, 0xff, 0xff, 0xff, 0xec,
+    0xfa, 0x0, 0x2, 0xdf, 0xfd, 0x96, 0x7b, 0xff,
+    0xfe, 0x10, 0x0, 0xaf, 0xfb, 0x20, 0x0, 0x8,
+    0xff, 0xf4, 0x0, 0x4f, 0xfd, 0x20, 0x0, 0x2,
+    0xdf, 0xff, 0xc0, 0x8, 0xff, 0x70, 0x0, 0x0,
+    0xbf, 0xad, 0xfe, 0x30, 0xbf, 0xf2, 0x0, 0x0,
+    0x8f, 0xc1, 0x8f, 0xf6, 0x1d, 0xff, 0x0, 0x0,
+    0x5f, 0xe3, 0x6, 0xff, 0x71, 0xdf, 0xe0, 0x0,
+    0x3d, 0xf5, 0x0, 0x5f, 0xf8, 0x1d, 0xfe, 0x0,
+    0x1b, 0xf8, 0x0, 0x5, 0xff, 0x81, 0xcf, 0xf1,
+    0x9, 0xfb, 0x10, 0x0, 0x7f, 0xf7, 0xb, 0xff,
+    0x46, 0xfd, 0x20, 0x0, 0xa, 0xff, 0x50, 0x7f,
+    0xfc, 0xee, 0x40, 0x0, 0x2, 0xef, 0xe1, 0x2,
+    0xef, 0xff, 0x70, 0x0, 0x1, 0xaf, 0xf9, 0x0,
+    0x7, 0xff, 0xf8, 0x20, 0x14, 0xbf, 0xfd, 0x20,
+    0x0, 0x7f, 0xff, 0xfe, 0xdd, 0xef, 0xfd, 0x30,
+    0x0, 0x4e, 0xe6, 0xcf, 0xff, 0xff, 0xe9, 0x20,
+    0x0, 0x5, 0xe6, 0x0, 0x25, 0x76, 0x41, 0x0,
+    0x0, 0x0, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+00F9 "ù" */
+    0x0, 0x0, 0x2c, 0xdd, 0x60, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xfd, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xf6, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xaf, 0xd1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x77, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x16, 0x76, 0x0,
+    0x0, 0x0, 0x2, 0x77, 0x41, 0xdf, 0xd0, 0x0,
+    0x0, 0x0, 0x5f, 0xf8, 0x1d, 0xfd, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0x81, 0xdf, 0xd0, 0x0, 0x0,
+    0x0, 0x5f, 0xf8, 0x1d, 0xfd, 0x0, 0x0, 0x0,
+    0x5, 0xff, 0x81, 0xdf, 0xd0, 0x0, 0x0, 0x0,
+    0x5f, 0xf8, 0x1d, 0xfd, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0x81, 0xdf, 0xd0, 0x0, 0x0, 0x0, 0x5f,
+    0xf8, 0x1d, 0xfd, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0x81, 0xdf, 0xd0, 0x0, 0x0, 0x0, 0x5f, 0xf8,
+    0x1d, 0xfd, 0x0, 0x0, 0x0, 0x5, 0xff, 0x81,
+    0xdf, 0xd0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x1c,
+    0xff, 0x10, 0x0, 0x0, 0xb, 0xff, 0x80, 0xbf,
+    0xf6, 0x0, 0x0, 0x5, 0xff, 0xf8, 0x6, 0xff,
+    0xe6, 0x21, 0x38, 0xee, 0xff, 0x80, 0x1c, 0xff,
+    0xfe, 0xde, 0xfe, 0x7e, 0xf8, 0x0, 0x2a, 0xff,
+    0xff, 0xfc, 0x42, 0xdf, 0x80, 0x0, 0x1, 0x57,
+    0x63, 0x0, 0x1, 0x10,
+
+    /* U+00FA "ú" */
+    0x0, 0x0, 0x0, 0x2, 0xcd, 0xd6, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xfb, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x2d, 0xfd, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x68, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x16, 0x76, 0x0,
+    0x0, 0x0, 0x2, 0x77, 0x41, 0xdf, 0xd0, 0x0,
+    0x0, 0x0, 0x5f, 0xf8, 0x1d, 0xfd, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0x81, 0xdf, 0xd0, 0x0, 0x0,
+    0x0, 0x5f, 0xf8, 0x1d, 0xfd, 0x0, 0x0, 0x0,
+    0x5, 0xff, 0x81, 0xdf, 0xd0, 0x0, 0x0, 0x0,
+    0x5f, 0xf8, 0x1d, 0xfd, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0x81, 0xdf, 0xd0, 0x0, 0x0, 0x0, 0x5f,
+    0xf8, 0x1d, 0xfd, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0x81, 0xdf, 0xd0, 0x0, 0x0, 0x0, 0x5f, 0xf8,
+    0x1d, 0xfd, 0x0, 0x0, 0x0, 0x5, 0xff, 0x81,
+    0xdf, 0xd0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x1c,
+    0xff, 0x10, 0x0, 0x0, 0xb, 0xff, 0x80, 0xbf,
+    0xf6, 0x0, 0x0, 0x5, 0xff, 0xf8, 0x6, 0xff,
+    0xe6, 0x21, 0x38, 0xee, 0xff, 0x80, 0x1c, 0xff,
+    0xfe, 0xde, 0xfe, 0x7e, 0xf8, 0x0, 0x2a, 0xff,
+    0xff, 0xfc, 0x42, 0xdf, 0x80, 0x0, 0x1, 0x57,
+    0x63, 0x0, 0x1, 0x10,
+
+    /* U+00FB "û" */
+    0x0, 0x0, 0x3, 0xcd, 0xd7, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xcf, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0xf6, 0xbf, 0xe3, 0x0, 0x0, 0x0,
+    0x6f, 0xfa, 0x3, 0xef, 0xc2, 0x0, 0x0, 0x7,
+    0x87, 0x20, 0x5, 0x88, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x16, 0x76, 0x0,
+    0x0, 0x0, 0x2, 0x77, 0x41, 0xdf, 0xd0, 0x0,
+    0x0, 0x0, 0x5f, 0xf8, 0x1d, 0xfd, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0x81, 0xdf, 0xd0, 0x0, 0x0,
+    0x0, 0x5f, 0xf8, 0x1d, 0xfd, 0x0, 0x0, 0x0,
+    0x5, 0xff, 0x81, 0xdf, 0xd0, 0x0, 0x0, 0x0,
+    0x5f, 0xf8, 0x1d, 0xfd, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0x81, 0xdf, 0xd0, 0x0, 0x0, 0x0, 0x5f,
+    0xf8, 0x1d, 0xfd, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0x81, 0xdf, 0xd0, 0x0, 0x0, 0x0, 0x5f, 0xf8,
+    0x1d, 0xfd, 0x0, 0x0, 0x0, 0x5, 0xff, 0x81,
+    0xdf, 0xd0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x1c,
+    0xff, 0x10, 0x0, 0x0, 0xb, 0xff, 0x80, 0xbf,
+    0xf6, 0x0, 0x0, 0x5, 0xff, 0xf8, 0x6, 0xff,
+    0xe6, 0x21, 0x38, 0xee, 0xff, 0x80, 0x1c, 0xff,
+    0xfe, 0xde, 0xfe, 0x7e, 0xf8, 0x0, 0x2a, 0xff,
+    0xff, 0xfc, 0x42, 0xdf, 0x80, 0x0, 0x1, 0x57,
+    0x63, 0x0, 0x1, 0x10,
+
+    /* U+00FC "ü" */
+    0x0, 0x8, 0xdd, 0x40, 0xa, 0xdc, 0x30, 0x0,
+    0x0, 0x9f, 0xf5, 0x0, 0xcf, 0xe3, 0x0, 0x0,
+    0x9, 0xff, 0x50, 0xc, 0xfe, 0x30, 0x0, 0x0,
+    0x35, 0x52, 0x0, 0x45, 0x51, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x16, 0x76, 0x0,
+    0x0, 0x0, 0x2, 0x77, 0x41, 0xdf, 0xd0, 0x0,
+    0x0, 0x0, 0x5f, 0xf8, 0x1d, 0xfd, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0x81, 0xdf, 0xd0, 0x0, 0x0,
+    0x0, 0x5f, 0xf8, 0x1d, 0xfd, 0x0, 0x0, 0x0,
+    0x5, 0xff, 0x81, 0xdf, 0xd0, 0x0, 0x0, 0x0,
+    0x5f, 0xf8, 0x1d, 0xfd, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0x81, 0xdf, 0xd0, 0x0, 0x0, 0x0, 0x5f,
+    0xf8, 0x1d, 0xfd, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0x81, 0xdf, 0xd0, 0x0, 0x0, 0x0, 0x5f, 0xf8,
+    0x1d, 0xfd, 0x0, 0x0, 0x0, 0x5, 0xff, 0x81,
+    0xdf, 0xd0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x1c,
+    0xff, 0x10, 0x0, 0x0, 0xb, 0xff, 0x80, 0xbf,
+    0xf6, 0x0, 0x0, 0x5, 0xff, 0xf8, 0x6, 0xff,
+    0xe6, 0x21, 0x38, 0xee, 0xff, 0x80, 0x1c, 0xff,
+    0xfe, 0xde, 0xfe, 0x7e, 0xf8, 0x0, 0x2a, 0xff,
+    0xff, 0xfc, 0x42, 0xdf, 0x80, 0x0, 0x1, 0x57,
+    0x63, 0x0, 0x1, 0x10,
+
+    /* U+00FD "ý" */
+    0x0, 0x0, 0x0, 0x0, 0x7d, 0xdb, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xdf, 0xf4, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1d, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x28, 0x71, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x37, 0x74, 0x0, 0x0, 0x0, 0x0, 0x17, 0x74,
+    0x2f, 0xfc, 0x10, 0x0, 0x0, 0x0, 0x7f, 0xf6,
+    0xb, 0xff, 0x40, 0x0, 0x0, 0x1, 0xcf, 0xe1,
+    0x6, 0xff, 0x90, 0x0, 0x0, 0x3, 0xff, 0x90,
+    0x2, 0xdf, 0xe1, 0x0, 0x0, 0x8, 0xff, 0x40,
+    0x0, 0x9f, 0xf5, 0x0, 0x0, 0xd, 0xfc, 0x10,
+    0x0, 0x4f, 0xfa, 0x0, 0x0, 0x4f, 0xf7, 0x0,
+    0x0, 0x1c, 0xfe, 0x10, 0x0, 0xaf, 0xe3, 0x0,
+    0x0, 0x7, 0xff, 0x60, 0x1, 0xef, 0xb0, 0x0,
+    0x0, 0x2, 0xef, 0xb0, 0x6, 0xff, 0x60, 0x0,
+    0x0, 0x0, 0xbf, 0xe3, 0xb, 0xfe, 0x10, 0x0,
+    0x0, 0x0, 0x5f, 0xf7, 0x2e, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x1e, 0xfb, 0x6f, 0xf4, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xfe, 0xcf, 0xd0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xff, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xcf, 0xff, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xd1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xef, 0x90, 0x0, 0x0, 0x0,
+    0x1, 0x10, 0x2b, 0xfe, 0x30, 0x0, 0x0, 0x0,
+    0x3, 0xed, 0xef, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xff, 0xff, 0xc1, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x9c, 0xc8, 0x10, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+00FE "þ" */
+    0x1b, 0xdc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1c, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1c, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1c, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1c, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1c, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1c, 0xfe, 0x2, 0x8b, 0xcb, 0x82, 0x0, 0x0,
+    0x1c, 0xfe, 0x5e, 0xff, 0xff, 0xff, 0x81, 0x0,
+    0x1c, 0xff, 0xff, 0xc7, 0x69, 0xef, 0xf8, 0x0,
+    0x1c, 0xff, 0xf8, 0x10, 0x0, 0x4d, 0xff, 0x40,
+    0x1c, 0xff, 0xb0, 0x0, 0x0, 0x5, 0xff, 0xb0,
+    0x1c, 0xff, 0x40, 0x0, 0x0, 0x1, 0xcf, 0xf1,
+    0x1c, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf5,
+    0x1c, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf7,
+    0x1c, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf7,
+    0x1c, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf7,
+    0x1c, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf6,
+    0x1c, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf3,
+    0x1c, 0xff, 0x50, 0x0, 0x0, 0x2, 0xef, 0xd0,
+    0x1c, 0xff, 0xc1, 0x0, 0x0, 0x1a, 0xff, 0x70,
+    0x1c, 0xff, 0xfc, 0x41, 0x13, 0xaf, 0xfc, 0x10,
+    0x1c, 0xfe, 0xdf, 0xed, 0xde, 0xff, 0xd3, 0x0,
+    0x1c, 0xfe, 0x2a, 0xff, 0xff, 0xf9, 0x20, 0x0,
+    0x1c, 0xfe, 0x0, 0x26, 0x75, 0x10, 0x0, 0x0,
+    0x1c, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1c, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1c, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1c, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1c, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0x65, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+00FF "ÿ" */
+    0x0, 0x3, 0xcd, 0x90, 0x5, 0xdd, 0x70, 0x0,
+    0x0, 0x4, 0xff, 0xb0, 0x6, 0xff, 0x80, 0x0,
+    0x0, 0x4, 0xff, 0xb0, 0x6, 0xff, 0x80, 0x0,
+    0x0, 0x1, 0x55, 0x40, 0x2, 0x55, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x36, 0x64, 0x0, 0x0, 0x0, 0x0, 0x16, 0x64,
+    0x2f, 0xfc, 0x10, 0x0, 0x0, 0x0, 0x7f, 0xf6,
+    0xb, 0xff, 0x40, 0x0, 0x0, 0x1, 0xcf, 0xe1,
+    0x6, 0xff, 0x90, 0x0, 0x0, 0x3, 0xff, 0x90,
+    0x2, 0xdf, 0xe1, 0x0, 0x0, 0x8, 0xff, 0x40,
+    0x0, 0x9f, 0xf5, 0x0, 0x0, 0xd, 0xfc, 0x10,
+    0x0, 0x4f, 0xfa, 0x0, 0x0, 0x4f, 0xf7, 0x0,
+    0x0, 0x1c, 0xfe, 0x10, 0x0, 0xaf, 0xe3, 0x0,
+    0x0, 0x7, 0xff, 0x60, 0x1, 0xef, 0xb0, 0x0,
+    0x0, 0x3, 0xef, 0xb0, 0x6, 0xff, 0x60, 0x0,
+    0x0, 0x0, 0xbf, 0xe3, 0xb, 0xfe, 0x10, 0x0,
+    0x0, 0x0, 0x5f, 0xf7, 0x2e, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x1e, 0xfb, 0x6f, 0xf4, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xfe, 0xcf, 0xd0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xff, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xcf, 0xff, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xd1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xef, 0x90, 0x0, 0x0, 0x0,
+    0x1, 0x10, 0x2b, 0xfe, 0x30, 0x0, 0x0, 0x0,
+    0x3, 0xed, 0xef, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xff, 0xff, 0xc1, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x9c, 0xc8, 0x10, 0x0, 0x0, 0x0, 0x0,
+
+};
+
+static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
+    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
+    {.bitmap_index = 0, .adv_w = 142, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 0, .adv_w = 142, .box_w = 5, .box_h = 23, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 58, .adv_w = 182, .box_w = 10, .box_h = 9, .ofs_x = 1, .ofs_y = 14},
+    {.bitmap_index = 103, .adv_w = 285, .box_w = 18, .box_h = 25, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 328, .adv_w = 285, .box_w = 16, .box_h = 30, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 568, .adv_w = 455, .box_w = 26, .box_h = 25, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 893, .adv_w = 341, .box_w = 20, .box_h = 25, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 1143, .adv_w = 98, .box_w = 4, .box_h = 9, .ofs_x = 1, .ofs_y = 14},
+    {.bitmap_index = 1161, .adv_w = 171, .box_w = 9, .box_h = 31, .ofs_x = 1, .ofs_y = -7},
+    {.bitmap_index = 1301, .adv_w = 171, .box_w = 9, .box_h = 31, .ofs_x = 1, .ofs_y = -7},
+    {.bitmap_index = 1441, .adv_w = 199, .box_w = 11, .box_h = 11, .ofs_x = 1, .ofs_y = 13},
+    {.bitmap_index = 1502, .adv_w = 299, .box_w = 16, .box_h = 16, .ofs_x = 1, .ofs_y = 3},
+    {.bitmap_index = 1630, .adv_w = 142, .box_w = 5, .box_h = 9, .ofs_x = 2, .ofs_y = -5},
+    {.bitmap_index = 1653, .adv_w = 171, .box_w = 10, .box_h = 4, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 1673, .adv_w = 142, .box_w = 5, .box_h = 4, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 1683, .adv_w = 142, .box_w = 9, .box_h = 25, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 1796, .adv_w = 285, .box_w = 16, .box_h = 24, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 1988, .adv_w = 285, .box_w = 9, .box_h = 24, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 2096, .adv_w = 285, .box_w = 17, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2292, .adv_w = 285, .box_w = 16, .box_h = 24, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 2484, .adv_w = 285, .box_w = 17, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2680, .adv_w = 285, .box_w = 16, .box_h = 24, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 2872, .adv_w = 285, .box_w = 16, .box_h = 24, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 3064, .adv_w = 285, .box_w = 16, .box_h = 24, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 3256, .adv_w = 285, .box_w = 16, .box_h = 24, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 3448, .adv_w = 285, .box_w = 16, .box_h = 24, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 3640, .adv_w = 142, .box_w = 5, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3683, .adv_w = 142, .box_w = 5, .box_h = 22, .ofs_x = 2, .ofs_y = -5},
+    {.bitmap_index = 3738, .adv_w = 299, .box_w = 16, .box_h = 16, .ofs_x = 1, .ofs_y = 3},
+    {.bitmap_index = 3866, .adv_w = 299, .box_w = 16, .box_h = 10, .ofs_x = 1, .ofs_y = 6},
+    {.bitmap_index = 3946, .adv_w = 299, .box_w = 16, .box_h = 16, .ofs_x = 1, .ofs_y = 3},
+    {.bitmap_index = 4074, .adv_w = 285, .box_w = 16, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4266, .adv_w = 520, .box_w = 31, .box_h = 31, .ofs_x = 1, .ofs_y = -7},
+    {.bitmap_index = 4747, .adv_w = 341, .box_w = 22, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5000, .adv_w = 341, .box_w = 18, .box_h = 23, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 5207, .adv_w = 370, .box_w = 21, .box_h = 25, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 5470, .adv_w = 370, .box_w = 20, .box_h = 23, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 5700, .adv_w = 341, .box_w = 18, .box_h = 23, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 5907, .adv_w = 313, .box_w = 17, .box_h = 23, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 6103, .adv_w = 398, .box_w = 22, .box_h = 25, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 6378, .adv_w = 370, .box_w = 19, .box_h = 23, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 6597, .adv_w = 142, .box_w = 5, .box_h = 23, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 6655, .adv_w = 256, .box_w = 14, .box_h = 24, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 6823, .adv_w = 341, .box_w = 20, .box_h = 23, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 7053, .adv_w = 285, .box_w = 15, .box_h = 23, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 7226, .adv_w = 427, .box_w = 23, .box_h = 23, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 7491, .adv_w = 370, .box_w = 19, .box_h = 23, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 7710, .adv_w = 398, .box_w = 23, .box_h = 25, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 7998, .adv_w = 341, .box_w = 19, .box_h = 24, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 8226, .adv_w = 398, .box_w = 23, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 8525, .adv_w = 370, .box_w = 21, .box_h = 23, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 8767, .adv_w = 341, .box_w = 19, .box_h = 25, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 9005, .adv_w = 313, .box_w = 20, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9235, .adv_w = 370, .box_w = 19, .box_h = 24, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 9463, .adv_w = 341, .box_w = 21, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9705, .adv_w = 483, .box_w = 30, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10050, .adv_w = 341, .box_w = 21, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10292, .adv_w = 341, .box_w = 21, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10534, .adv_w = 313, .box_w = 19, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10753, .adv_w = 142, .box_w = 8, .box_h = 30, .ofs_x = 1, .ofs_y = -7},
+    {.bitmap_index = 10873, .adv_w = 142, .box_w = 9, .box_h = 25, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 10986, .adv_w = 142, .box_w = 7, .box_h = 30, .ofs_x = 0, .ofs_y = -7},
+    {.bitmap_index = 11091, .adv_w = 240, .box_w = 15, .box_h = 13, .ofs_x = 0, .ofs_y = 11},
+    {.bitmap_index = 11189, .adv_w = 285, .box_w = 20, .box_h = 3, .ofs_x = -1, .ofs_y = -7},
+    {.bitmap_index = 11219, .adv_w = 171, .box_w = 7, .box_h = 6, .ofs_x = 1, .ofs_y = 18},
+    {.bitmap_index = 11240, .adv_w = 285, .box_w = 17, .box_h = 18, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 11393, .adv_w = 285, .box_w = 16, .box_h = 24, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 11585, .adv_w = 256, .box_w = 15, .box_h = 18, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 11720, .adv_w = 285, .box_w = 16, .box_h = 24, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 11912, .adv_w = 285, .box_w = 17, .box_h = 18, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 12065, .adv_w = 142, .box_w = 11, .box_h = 25, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 12203, .adv_w = 285, .box_w = 16, .box_h = 24, .ofs_x = 0, .ofs_y = -7},
+    {.bitmap_index = 12395, .adv_w = 285, .box_w = 15, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 12568, .adv_w = 114, .box_w = 4, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 12614, .adv_w = 114, .box_w = 7, .box_h = 30, .ofs_x = -2, .ofs_y = -7},
+    {.bitmap_index = 12719, .adv_w = 256, .box_w = 15, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 12892, .adv_w = 114, .box_w = 4, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 12938, .adv_w = 427, .box_w = 24, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 13142, .adv_w = 285, .box_w = 15, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 13270, .adv_w = 285, .box_w = 17, .box_h = 18, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 13423, .adv_w = 285, .box_w = 16, .box_h = 24, .ofs_x = 1, .ofs_y = -7},
+    {.bitmap_index = 13615, .adv_w = 285, .box_w = 16, .box_h = 24, .ofs_x = 0, .ofs_y = -7},
+    {.bitmap_index = 13807, .adv_w = 171, .box_w = 10, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 13892, .adv_w = 256, .box_w = 15, .box_h = 18, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 14027, .adv_w = 142, .box_w = 9, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 14131, .adv_w = 285, .box_w = 15, .box_h = 18, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 14266, .adv_w = 256, .box_w = 16, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 14402, .adv_w = 370, .box_w = 23, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 14598, .adv_w = 256, .box_w = 16, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 14734, .adv_w = 256, .box_w = 16, .box_h = 24, .ofs_x = 0, .ofs_y = -7},
+    {.bitmap_index = 14926, .adv_w = 256, .box_w = 16, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 15062, .adv_w = 171, .box_w = 11, .box_h = 31, .ofs_x = 0, .ofs_y = -7},
+    {.bitmap_index = 15233, .adv_w = 133, .box_w = 4, .box_h = 31, .ofs_x = 2, .ofs_y = -7},
+    {.bitmap_index = 15295, .adv_w = 171, .box_w = 10, .box_h = 31, .ofs_x = 0, .ofs_y = -7},
+    {.bitmap_index = 15450, .adv_w = 299, .box_w = 17, .box_h = 6, .ofs_x = 1, .ofs_y = 8},
+    {.bitmap_index = 15501, .adv_w = 142, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 15501, .adv_w = 171, .box_w = 5, .box_h = 24, .ofs_x = 3, .ofs_y = -7},
+    {.bitmap_index = 15561, .adv_w = 285, .box_w = 16, .box_h = 30, .ofs_x = 1, .ofs_y = -7},
+    {.bitmap_index = 15801, .adv_w = 285, .box_w = 17, .box_h = 25, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 16014, .adv_w = 285, .box_w = 16, .box_h = 16, .ofs_x = 1, .ofs_y = 3},
+    {.bitmap_index = 16142, .adv_w = 285, .box_w = 18, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 16349, .adv_w = 133, .box_w = 4, .box_h = 31, .ofs_x = 2, .ofs_y = -7},
+    {.bitmap_index = 16411, .adv_w = 285, .box_w = 16, .box_h = 30, .ofs_x = 1, .ofs_y = -7},
+    {.bitmap_index = 16651, .adv_w = 171, .box_w = 10, .box_h = 4, .ofs_x = 0, .ofs_y = 19},
+    {.bitmap_index = 16671, .adv_w = 377, .box_w = 24, .box_h = 25, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 16971, .adv_w = 190, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = 11},
+    {.bitmap_index = 17043, .adv_w = 285, .box_w = 14, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 17155, .adv_w = 299, .box_w = 16, .box_h = 10, .ofs_x = 1, .ofs_y = 6},
+    {.bitmap_index = 17235, .adv_w = 171, .box_w = 10, .box_h = 4, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 17255, .adv_w = 377, .box_w = 24, .box_h = 25, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 17555, .adv_w = 283, .box_w = 20, .box_h = 3, .ofs_x = -1, .ofs_y = 24},
+    {.bitmap_index = 17585, .adv_w = 205, .box_w = 10, .box_h = 10, .ofs_x = 1, .ofs_y = 14},
+    {.bitmap_index = 17635, .adv_w = 281, .box_w = 16, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 17795, .adv_w = 171, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = 11},
+    {.bitmap_index = 17867, .adv_w = 171, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = 11},
+    {.bitmap_index = 17939, .adv_w = 171, .box_w = 7, .box_h = 6, .ofs_x = 3, .ofs_y = 18},
+    {.bitmap_index = 17960, .adv_w = 295, .box_w = 14, .box_h = 24, .ofs_x = 2, .ofs_y = -7},
+    {.bitmap_index = 18128, .adv_w = 275, .box_w = 18, .box_h = 30, .ofs_x = 0, .ofs_y = -7},
+    {.bitmap_index = 18398, .adv_w = 171, .box_w = 5, .box_h = 4, .ofs_x = 3, .ofs_y = 10},
+    {.bitmap_index = 18408, .adv_w = 171, .box_w = 8, .box_h = 8, .ofs_x = 1, .ofs_y = -7},
+    {.bitmap_index = 18440, .adv_w = 171, .box_w = 7, .box_h = 13, .ofs_x = 1, .ofs_y = 11},
+    {.bitmap_index = 18486, .adv_w = 187, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = 11},
+    {.bitmap_index = 18558, .adv_w = 285, .box_w = 14, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 18670, .adv_w = 427, .box_w = 26, .box_h = 25, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 18995, .adv_w = 427, .box_w = 26, .box_h = 25, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 19320, .adv_w = 427, .box_w = 27, .box_h = 25, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 19658, .adv_w = 313, .box_w = 16, .box_h = 24, .ofs_x = 2, .ofs_y = -7},
+    {.bitmap_index = 19850, .adv_w = 341, .box_w = 22, .box_h = 29, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20169, .adv_w = 341, .box_w = 22, .box_h = 29, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20488, .adv_w = 341, .box_w = 22, .box_h = 29, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20807, .adv_w = 341, .box_w = 22, .box_h = 28, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21115, .adv_w = 341, .box_w = 22, .box_h = 28, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21423, .adv_w = 341, .box_w = 22, .box_h = 28, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21731, .adv_w = 512, .box_w = 31, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 22088, .adv_w = 370, .box_w = 21, .box_h = 31, .ofs_x = 1, .ofs_y = -7},
+    {.bitmap_index = 22414, .adv_w = 341, .box_w = 18, .box_h = 29, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 22675, .adv_w = 341, .box_w = 18, .box_h = 29, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 22936, .adv_w = 341, .box_w = 18, .box_h = 29, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 23197, .adv_w = 341, .box_w = 18, .box_h = 28, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 23449, .adv_w = 142, .box_w = 6, .box_h = 29, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 23536, .adv_w = 142, .box_w = 6, .box_h = 29, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 23623, .adv_w = 142, .box_w = 11, .box_h = 29, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 23783, .adv_w = 142, .box_w = 10, .box_h = 28, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 23923, .adv_w = 370, .box_w = 22, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 24176, .adv_w = 370, .box_w = 19, .box_h = 28, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 24442, .adv_w = 398, .box_w = 23, .box_h = 30, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 24787, .adv_w = 398, .box_w = 23, .box_h = 30, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 25132, .adv_w = 398, .box_w = 23, .box_h = 30, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 25477, .adv_w = 398, .box_w = 23, .box_h = 29, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 25811, .adv_w = 398, .box_w = 23, .box_h = 29, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 26145, .adv_w = 299, .box_w = 14, .box_h = 14, .ofs_x = 2, .ofs_y = 4},
+    {.bitmap_index = 26243, .adv_w = 398, .box_w = 23, .box_h = 25, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 26531, .adv_w = 370, .box_w = 19, .box_h = 30, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 26816, .adv_w = 370, .box_w = 19, .box_h = 30, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 27101, .adv_w = 370, .box_w = 19, .box_h = 30, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 27386, .adv_w = 370, .box_w = 19, .box_h = 29, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 27662, .adv_w = 341, .box_w = 21, .box_h = 29, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 27967, .adv_w = 341, .box_w = 19, .box_h = 23, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 28186, .adv_w = 313, .box_w = 17, .box_h = 25, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 28399, .adv_w = 285, .box_w = 17, .box_h = 24, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 28603, .adv_w = 285, .box_w = 17, .box_h = 24, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 28807, .adv_w = 285, .box_w = 17, .box_h = 24, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 29011, .adv_w = 285, .box_w = 17, .box_h = 24, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 29215, .adv_w = 285, .box_w = 17, .box_h = 24, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 29419, .adv_w = 285, .box_w = 17, .box_h = 25, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 29632, .adv_w = 455, .box_w = 28, .box_h = 18, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 29884, .adv_w = 256, .box_w = 15, .box_h = 24, .ofs_x = 1, .ofs_y = -7},
+    {.bitmap_index = 30064, .adv_w = 285, .box_w = 17, .box_h = 24, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 30268, .adv_w = 285, .box_w = 17, .box_h = 24, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 30472, .adv_w = 285, .box_w = 17, .box_h = 24, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 30676, .adv_w = 285, .box_w = 17, .box_h = 24, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 30880, .adv_w = 142, .box_w = 7, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 30961, .adv_w = 142, .box_w = 7, .box_h = 23, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 31042, .adv_w = 142, .box_w = 11, .box_h = 23, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 31169, .adv_w = 142, .box_w = 10, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 31284, .adv_w = 285, .box_w = 17, .box_h = 24, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 31488, .adv_w = 285, .box_w = 15, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 31661, .adv_w = 285, .box_w = 17, .box_h = 24, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 31865, .adv_w = 285, .box_w = 17, .box_h = 24, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 32069, .adv_w = 285, .box_w = 17, .box_h = 24, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 32273, .adv_w = 285, .box_w = 17, .box_h = 24, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 32477, .adv_w = 285, .box_w = 17, .box_h = 24, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 32681, .adv_w = 281, .box_w = 16, .box_h = 13, .ofs_x = 1, .ofs_y = 5},
+    {.bitmap_index = 32785, .adv_w = 313, .box_w = 17, .box_h = 20, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 32955, .adv_w = 285, .box_w = 15, .box_h = 24, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 33135, .adv_w = 285, .box_w = 15, .box_h = 24, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 33315, .adv_w = 285, .box_w = 15, .box_h = 24, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 33495, .adv_w = 285, .box_w = 15, .box_h = 24, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 33675, .adv_w = 256, .box_w = 16, .box_h = 30, .ofs_x = 0, .ofs_y = -7},
+    {.bitmap_index = 33915, .adv_w = 285, .box_w = 16, .box_h = 30, .ofs_x = 1, .ofs_y = -7},
+    {.bitmap_index = 34155, .adv_w = 256, .box_w = 16, .box_h = 30, .ofs_x = 0, .ofs_y = -7}
+};
+
+static const lv_font_fmt_txt_cmap_t cmaps[] =
+{
+    {
+        .range_start = 32, .range_length = 95, .glyph_id_start = 1,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 160, .range_length = 96, .glyph_id_start = 96,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    }
+};
+
+static const lv_font_fmt_txt_dsc_t font_dsc = {
+    .glyph_bitmap = glyph_bitmap,
+    .glyph_dsc = glyph_dsc,
+    .cmaps = cmaps,
+    .kern_dsc = NULL,
+    .kern_scale = 0,
+    .cmap_num = 2,
+    .bpp = 4,
+    .kern_classes = 0,
+    .bitmap_format = 0,
+};
+
+extern const lv_font_t lv_font_montserrat_14;
+
+const lv_font_t Arial_32 = {
+    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
+    .line_height = 36,          /*The maximum line height required by the font*/
+    .base_line = 7,             /*Baseline measured from the bottom of the line*/
+    .subpx = LV_FONT_SUBPX_NONE,
+    .underline_position = -3,
+    .underline_thickness = 2,
+    .dsc = &font_dsc,          /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
+    .fallback = &lv_font_montserrat_14,
+    .user_data = NULL,
+};
+
+#endif /*#if ARIAL_32*/
@@ -0,0 +1,10159 @@
+/*******************************************************************************
+ * Size: 48 px
+ * Bpp: 4
+ * Opts: skaalattu Arial_70.c:stä (tools/font_build.py, ei TTF:ää)
+ ******************************************************************************/
+
+#include "lvgl.h"
+
+#ifndef ARIAL_48
+#define ARIAL_48 1
+#endif
+
+#if ARIAL_48
+
+/*Store the image of the glyphs*/
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
+    /* U+0020 " " */
+
+    /* U+0021 "!" */
+    0x44, 0x44, 0x42, 0xdf, 0xff, 0xf6, 0xdf, 0xff,
+    0xf6, 0xdf, 0xff, 0xf6, 0xdf, 0xff, 0xf6, 0xdf,
+    0xff, 0xf6, 0xdf, 0xff, 0xf6, 0xdf, 0xff, 0xf6,
+    0xdf, 0xff, 0xf6, 0xcf, 0xff, 0xe5, 0xbf, 0xff,
+    0xe4, 0xaf, 0xff, 0xe3, 0x9f, 0xff, 0xe2, 0x8f,
+    0xff, 0xe1, 0x7f, 0xff, 0xe0, 0x5f, 0xff, 0xd0,
+    0x4f, 0xff, 0xc0, 0x3f, 0xff, 0xb0, 0x3f, 0xff,
+    0xa0, 0x3e, 0xff, 0x90, 0x2d, 0xff, 0x80, 0x2c,
+    0xff, 0x70, 0x2b, 0xff, 0x60, 0x1b, 0xff, 0x50,
+    0x1a, 0xff, 0x30, 0x19, 0xff, 0x30, 0x4, 0x76,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8c, 0xcc, 0xb2, 0xbf, 0xff, 0xe3,
+    0xbf, 0xff, 0xe3, 0xbf, 0xff, 0xe3, 0xbf, 0xff,
+    0xe3,
+
+    /* U+0022 "\"" */
+    0x23, 0x33, 0x30, 0x0, 0x23, 0x33, 0x20, 0xad,
+    0xdd, 0xc1, 0x2, 0xbd, 0xdd, 0xa1, 0xcf, 0xff,
+    0xd2, 0x3, 0xdf, 0xff, 0xb1, 0xcf, 0xff, 0xd2,
+    0x3, 0xdf, 0xff, 0xb1, 0xcf, 0xff, 0xd2, 0x3,
+    0xdf, 0xff, 0xb1, 0xcf, 0xff, 0xd2, 0x3, 0xdf,
+    0xff, 0xb1, 0xcf, 0xff, 0xd1, 0x2, 0xcf, 0xff,
+    0xb1, 0x9f, 0xff, 0xd0, 0x1, 0xbf, 0xff, 0x90,
+    0x6f, 0xff, 0xb0, 0x0, 0xaf, 0xff, 0x60, 0x4f,
+    0xff, 0x80, 0x0, 0x7f, 0xfe, 0x50, 0x3e, 0xff,
+    0x60, 0x0, 0x5f, 0xfd, 0x40, 0x2c, 0xff, 0x30,
+    0x0, 0x2f, 0xfc, 0x20, 0x1a, 0xfe, 0x20, 0x0,
+    0xe, 0xfb, 0x0, 0x1, 0x11, 0x0, 0x0, 0x1,
+    0x11, 0x0,
+
+    /* U+0023 "#" */
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xe1, 0x0,
+    0x0, 0x0, 0x8f, 0xfe, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xfd, 0x0, 0x0, 0x0, 0x1a,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1c,
+    0xff, 0x90, 0x0, 0x0, 0x1, 0xdf, 0xf9, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xf7, 0x0,
+    0x0, 0x0, 0x2f, 0xff, 0x60, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xfe, 0x50, 0x0, 0x0, 0x5,
+    0xff, 0xe4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xd3, 0x0, 0x0, 0x0, 0x9f, 0xfc, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xfb, 0x10,
+    0x0, 0x0, 0xc, 0xff, 0xb1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1c, 0xff, 0xa0, 0x0, 0x0, 0x2,
+    0xdf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xdf, 0xf7, 0x0, 0x0, 0x0, 0x4d, 0xff, 0x60,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5e, 0xff, 0x40,
+    0x0, 0x0, 0x7, 0xff, 0xe3, 0x0, 0x0, 0x5b,
+    0xbb, 0xbb, 0xbc, 0xff, 0xfb, 0xbb, 0xbb, 0xbb,
+    0xdf, 0xff, 0xbb, 0xbb, 0x17, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf1, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16,
+    0xbb, 0xbb, 0xbc, 0xff, 0xfc, 0xbb, 0xbb, 0xbb,
+    0xcf, 0xff, 0xcb, 0xbb, 0xb1, 0x0, 0x0, 0x0,
+    0x4f, 0xff, 0x40, 0x0, 0x0, 0x6, 0xff, 0xe3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xd3,
+    0x0, 0x0, 0x0, 0x9f, 0xfc, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xbf, 0xfb, 0x10, 0x0, 0x0,
+    0xc, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1d, 0xff, 0x90, 0x0, 0x0, 0x2, 0xdf, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xef, 0xf6,
+    0x0, 0x0, 0x0, 0x5e, 0xfe, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6e, 0xfe, 0x30, 0x0, 0x0,
+    0x7, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xe1, 0x0, 0x0, 0x1, 0x9f, 0xfd,
+    0x0, 0x0, 0x0, 0x0, 0x11, 0x12, 0xaf, 0xfc,
+    0x11, 0x11, 0x11, 0x3c, 0xff, 0xb1, 0x11, 0x11,
+    0x10, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x17, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf1, 0x7f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x13, 0x66, 0x6c, 0xff, 0xd7, 0x66, 0x66,
+    0x66, 0xdf, 0xfc, 0x76, 0x66, 0x66, 0x60, 0x0,
+    0x0, 0xcf, 0xfa, 0x10, 0x0, 0x0, 0xe, 0xff,
+    0x91, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xff,
+    0x80, 0x0, 0x0, 0x2, 0xef, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xef, 0xe6, 0x0, 0x0,
+    0x0, 0x5e, 0xfe, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xfe, 0x30, 0x0, 0x0, 0x8, 0xff,
+    0xd2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xd1, 0x0, 0x0, 0x1, 0xaf, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xbf, 0xfb, 0x0, 0x0,
+    0x0, 0x2c, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2d, 0xff, 0x80, 0x0, 0x0, 0x3, 0xef,
+    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xef,
+    0xf4, 0x0, 0x0, 0x0, 0x5f, 0xff, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xfe, 0x20, 0x0,
+    0x0, 0x8, 0xff, 0xe2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0x55, 0x41, 0x0, 0x0, 0x0, 0x35,
+    0x54, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+0024 "$" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x15, 0x62, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3d, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x12, 0x7e, 0xf9, 0x31,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x5a,
+    0xef, 0xff, 0xff, 0xfe, 0xb5, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x2a, 0xef, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0xa2, 0x0, 0x0, 0x0, 0x3, 0xcf, 0xff,
+    0xff, 0xef, 0xfe, 0xff, 0xff, 0xfc, 0x30, 0x0,
+    0x0, 0x1b, 0xff, 0xff, 0xd7, 0x7d, 0xf9, 0x7c,
+    0xff, 0xff, 0xc1, 0x0, 0x0, 0x7f, 0xff, 0xfa,
+    0x10, 0x3d, 0xf7, 0x2, 0xaf, 0xff, 0xf7, 0x0,
+    0x2, 0xcf, 0xff, 0xa1, 0x0, 0x3d, 0xf7, 0x0,
+    0x1b, 0xff, 0xfc, 0x20, 0x4, 0xff, 0xfe, 0x40,
+    0x0, 0x3d, 0xf7, 0x0, 0x6, 0xef, 0xfe, 0x40,
+    0x7, 0xff, 0xfc, 0x0, 0x0, 0x3d, 0xf7, 0x0,
+    0x2, 0xdf, 0xfe, 0x60, 0x8, 0xff, 0xfb, 0x0,
+    0x0, 0x3d, 0xf7, 0x0, 0x0, 0x77, 0x43, 0x10,
+    0x8, 0xff, 0xfb, 0x0, 0x0, 0x3d, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xfd, 0x10,
+    0x0, 0x3d, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0xfe, 0x60, 0x0, 0x3d, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xff, 0xc3,
+    0x0, 0x3d, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xfd, 0x62, 0x3d, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xff, 0xff,
+    0xfc, 0xae, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xbf, 0xff, 0xff, 0xff, 0xfd, 0x84,
+    0x21, 0x0, 0x0, 0x0, 0x0, 0x0, 0x28, 0xef,
+    0xff, 0xff, 0xff, 0xff, 0xd9, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x38, 0xde, 0xff, 0xff, 0xff,
+    0xff, 0xe8, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x25, 0xae, 0xff, 0xff, 0xff, 0xff, 0xb1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3d, 0xfa, 0xae,
+    0xff, 0xff, 0xf9, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3d, 0xf7, 0x2, 0x8e, 0xff, 0xfe, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3d, 0xf7, 0x0,
+    0x6, 0xef, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3d, 0xf7, 0x0, 0x0, 0x8f, 0xff, 0xf1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3d, 0xf7, 0x0,
+    0x0, 0x3f, 0xff, 0xf4, 0x1, 0x24, 0x51, 0x0,
+    0x0, 0x3d, 0xf7, 0x0, 0x0, 0x1d, 0xff, 0xf6,
+    0x3b, 0xce, 0xf2, 0x0, 0x0, 0x3d, 0xf7, 0x0,
+    0x0, 0x1d, 0xff, 0xf6, 0x2e, 0xff, 0xf5, 0x0,
+    0x0, 0x3d, 0xf7, 0x0, 0x0, 0x1e, 0xff, 0xf5,
+    0x1e, 0xff, 0xfa, 0x0, 0x0, 0x3d, 0xf7, 0x0,
+    0x0, 0x3f, 0xff, 0xf3, 0xa, 0xff, 0xfe, 0x30,
+    0x0, 0x3d, 0xf7, 0x0, 0x0, 0x9f, 0xff, 0xe0,
+    0x5, 0xff, 0xff, 0xa1, 0x0, 0x3d, 0xf7, 0x0,
+    0x5, 0xef, 0xff, 0x90, 0x1, 0xbf, 0xff, 0xfa,
+    0x20, 0x3d, 0xf7, 0x1, 0x5d, 0xff, 0xfd, 0x30,
+    0x0, 0x3d, 0xff, 0xff, 0xc7, 0x6d, 0xf8, 0x59,
+    0xef, 0xff, 0xf6, 0x0, 0x0, 0x5, 0xef, 0xff,
+    0xff, 0xef, 0xfe, 0xef, 0xff, 0xff, 0x91, 0x0,
+    0x0, 0x0, 0x4b, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xd6, 0x10, 0x0, 0x0, 0x0, 0x2, 0x6b,
+    0xff, 0xff, 0xff, 0xff, 0xe9, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x14, 0x8e, 0xf9, 0x42,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3d, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3d, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3d, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2a, 0xc5, 0x0,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+0025 "%" */
+    0x0, 0x0, 0x38, 0xce, 0xec, 0x83, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xfd, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xdf, 0xff, 0xff,
+    0xfd, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0xf9, 0x10, 0x0, 0x0, 0x0, 0x0, 0x4e,
+    0xff, 0xfd, 0xde, 0xff, 0xf6, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xef, 0xd3, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xcf, 0xfe, 0x73, 0x26, 0xcf, 0xfd,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x2b, 0xff, 0x90,
+    0x0, 0x0, 0x0, 0x0, 0x6, 0xef, 0xf7, 0x0,
+    0x0, 0x3e, 0xff, 0x91, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xfd, 0x30, 0x0, 0x0, 0x0, 0x0, 0x1a,
+    0xff, 0xd1, 0x0, 0x0, 0xa, 0xff, 0xd2, 0x0,
+    0x0, 0x0, 0x1, 0xcf, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2c, 0xff, 0xb0, 0x0, 0x0, 0x7,
+    0xff, 0xf3, 0x0, 0x0, 0x0, 0x6, 0xff, 0xd3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0xff, 0x90,
+    0x0, 0x0, 0x4, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x2c, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4e, 0xff, 0x80, 0x0, 0x0, 0x4, 0xff, 0xf6,
+    0x0, 0x0, 0x0, 0x6f, 0xfd, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4e, 0xff, 0x70, 0x0, 0x0,
+    0x4, 0xff, 0xf7, 0x0, 0x0, 0x1, 0xef, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0xff,
+    0x80, 0x0, 0x0, 0x4, 0xff, 0xf6, 0x0, 0x0,
+    0x7, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3d, 0xff, 0x90, 0x0, 0x0, 0x5, 0xff,
+    0xf4, 0x0, 0x0, 0x3d, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2b, 0xff, 0xc0, 0x0,
+    0x0, 0x8, 0xff, 0xf2, 0x0, 0x0, 0x7f, 0xfd,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0xe3, 0x0, 0x0, 0x1d, 0xff, 0xb1, 0x0,
+    0x2, 0xef, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xef, 0xfa, 0x10, 0x0, 0x7f,
+    0xfe, 0x70, 0x0, 0x8, 0xff, 0xc2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
+    0xc7, 0x6b, 0xef, 0xfb, 0x10, 0x0, 0x3d, 0xff,
+    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1a, 0xff, 0xff, 0xff, 0xff, 0xc3, 0x0,
+    0x0, 0x8f, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x8d, 0xef, 0xff,
+    0xe9, 0x20, 0x0, 0x2, 0xef, 0xf6, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0x68, 0x86, 0x30, 0x0, 0x0, 0x9, 0xff,
+    0xb2, 0x0, 0x0, 0x3, 0x68, 0x87, 0x51, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3d, 0xff, 0x60, 0x0, 0x1, 0x8d, 0xff,
+    0xff, 0xeb, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x9f, 0xfc, 0x0, 0x0,
+    0x1a, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xef,
+    0xf5, 0x0, 0x0, 0x7f, 0xff, 0xd6, 0x58, 0xef,
+    0xfd, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0xa1, 0x0, 0x2, 0xef, 0xfc,
+    0x10, 0x0, 0x3e, 0xff, 0xb1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4e, 0xfe, 0x50, 0x0,
+    0x6, 0xff, 0xe6, 0x0, 0x0, 0x8, 0xff, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xaf,
+    0xfb, 0x0, 0x0, 0xa, 0xff, 0xd2, 0x0, 0x0,
+    0x4, 0xef, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xef, 0xe4, 0x0, 0x0, 0x2b, 0xff,
+    0xc0, 0x0, 0x0, 0x3, 0xdf, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xa1, 0x0,
+    0x0, 0x2c, 0xff, 0xb0, 0x0, 0x0, 0x2, 0xcf,
+    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e,
+    0xfe, 0x40, 0x0, 0x0, 0x2c, 0xff, 0xb0, 0x0,
+    0x0, 0x2, 0xcf, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xbf, 0xfa, 0x0, 0x0, 0x0, 0x2c,
+    0xff, 0xb0, 0x0, 0x0, 0x3, 0xdf, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xef, 0xe3, 0x0,
+    0x0, 0x0, 0x1b, 0xff, 0xc0, 0x0, 0x0, 0x3,
+    0xdf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0xff, 0x91, 0x0, 0x0, 0x0, 0x9, 0xff, 0xd2,
+    0x0, 0x0, 0x5, 0xef, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xfd, 0x40, 0x0, 0x0, 0x0,
+    0x5, 0xff, 0xe7, 0x0, 0x0, 0xa, 0xff, 0xe2,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xbf, 0xf9, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xdf, 0xfd, 0x40, 0x1,
+    0x5e, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0xff, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5e,
+    0xff, 0xea, 0x8b, 0xff, 0xfc, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0xd, 0xff, 0x90, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x17, 0xff, 0xff, 0xff, 0xff, 0xe4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xfd, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4b, 0xdf,
+    0xfe, 0xd9, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x46, 0x64, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x45, 0x65, 0x30, 0x0, 0x0,
+
+    /* U+0026 "&" */
+    0x0, 0x0, 0x0, 0x0, 0x15, 0xad, 0xee, 0xc9,
+    0x41, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4b, 0xff, 0xff, 0xff, 0xfe, 0xa2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xff,
+    0xfe, 0x98, 0x8c, 0xff, 0xff, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xfc, 0x41,
+    0x0, 0x19, 0xff, 0xfe, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0xff, 0x30, 0x0, 0x0,
+    0x2c, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x8f,
+    0xff, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xfb, 0x0, 0x0, 0x0, 0x7, 0xff, 0xfb,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
+    0xe1, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xb1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x70,
+    0x0, 0x0, 0x2c, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2e, 0xff, 0xfd, 0x30, 0x0,
+    0x7, 0xff, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0xfd, 0x20, 0x29, 0xff,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xcf, 0xff, 0xfa, 0x5b, 0xff, 0xff, 0xb2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xef, 0xff, 0xff, 0xff, 0xff, 0xa1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xef,
+    0xff, 0xff, 0xfe, 0x71, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x6d, 0xff, 0xff,
+    0xfc, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xaf, 0xff, 0xff, 0xff, 0xc2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x17, 0xef, 0xff, 0xfe, 0xff, 0xff, 0xa1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x19, 0xff,
+    0xff, 0xf9, 0x6e, 0xff, 0xff, 0x81, 0x0, 0x0,
+    0x21, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xd6,
+    0x10, 0x7f, 0xff, 0xfe, 0x50, 0x0, 0xd, 0xca,
+    0x62, 0x0, 0x6, 0xef, 0xff, 0xc3, 0x0, 0x1,
+    0x9f, 0xff, 0xfd, 0x30, 0x3, 0xff, 0xff, 0x60,
+    0x2, 0xcf, 0xff, 0xd4, 0x0, 0x0, 0x1, 0xcf,
+    0xff, 0xfb, 0x20, 0x8f, 0xff, 0xf2, 0x0, 0x6f,
+    0xff, 0xf7, 0x0, 0x0, 0x0, 0x3, 0xcf, 0xff,
+    0xfa, 0x2c, 0xff, 0xfb, 0x10, 0xa, 0xff, 0xfd,
+    0x20, 0x0, 0x0, 0x0, 0x5, 0xef, 0xff, 0xfb,
+    0xef, 0xff, 0x70, 0x0, 0xdf, 0xff, 0xa0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xef, 0xff, 0xff, 0xff,
+    0xd2, 0x0, 0xe, 0xff, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x19, 0xff, 0xff, 0xff, 0xf8, 0x0,
+    0x0, 0xdf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1b, 0xff, 0xff, 0xfd, 0x10, 0x0, 0xb,
+    0xff, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3e, 0xff, 0xff, 0xc1, 0x0, 0x0, 0x7f, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xff, 0xff, 0x81, 0x0, 0x3, 0xdf, 0xff, 0xd4,
+    0x0, 0x0, 0x0, 0x0, 0x17, 0xef, 0xff, 0xff,
+    0xfe, 0x70, 0x0, 0x8, 0xff, 0xff, 0xd3, 0x0,
+    0x0, 0x0, 0x29, 0xef, 0xff, 0xff, 0xff, 0xfe,
+    0x70, 0x0, 0x1b, 0xff, 0xff, 0xe8, 0x43, 0x35,
+    0x8d, 0xff, 0xff, 0xe7, 0xaf, 0xff, 0xfe, 0x81,
+    0x0, 0x4d, 0xff, 0xff, 0xfe, 0xdd, 0xef, 0xff,
+    0xff, 0xe6, 0x2, 0xcf, 0xff, 0xff, 0x90, 0x0,
+    0x3b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3,
+    0x0, 0x2, 0xbf, 0xff, 0xd3, 0x0, 0x0, 0x27,
+    0xdf, 0xff, 0xff, 0xff, 0xfc, 0x62, 0x0, 0x0,
+    0x2, 0xbf, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x37,
+    0x9a, 0xa9, 0x63, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0x76, 0x0,
+
+    /* U+0027 "'" */
+    0x23, 0x33, 0x20, 0xcd, 0xdd, 0xb0, 0xdf, 0xff,
+    0xd1, 0xdf, 0xff, 0xd1, 0xdf, 0xff, 0xd1, 0xdf,
+    0xff, 0xd1, 0xdf, 0xff, 0xd0, 0xbf, 0xff, 0xc0,
+    0x9f, 0xff, 0x90, 0x6f, 0xff, 0x60, 0x4f, 0xff,
+    0x30, 0x3d, 0xfe, 0x20, 0x2c, 0xfc, 0x20, 0x1,
+    0x11, 0x0,
+
+    /* U+0028 "(" */
+    0x0, 0x0, 0x0, 0x0, 0x19, 0xa8, 0x20, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0x90, 0x0, 0x0, 0x0,
+    0x5, 0xef, 0xe1, 0x0, 0x0, 0x0, 0x1, 0xdf,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xfc, 0x20,
+    0x0, 0x0, 0x0, 0x4d, 0xff, 0x60, 0x0, 0x0,
+    0x0, 0x1a, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xfd,
+    0x30, 0x0, 0x0, 0x0, 0x4e, 0xff, 0x91, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xe5, 0x0, 0x0, 0x0,
+    0x3, 0xdf, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x6f,
+    0xff, 0xb0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xf6,
+    0x0, 0x0, 0x0, 0x1, 0xef, 0xfe, 0x30, 0x0,
+    0x0, 0x0, 0x5e, 0xff, 0xc2, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xfa, 0x10, 0x0, 0x0, 0x0, 0x9f,
+    0xff, 0x90, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0x2, 0xcf, 0xff, 0x70, 0x0,
+    0x0, 0x0, 0x2d, 0xff, 0xe6, 0x0, 0x0, 0x0,
+    0x3, 0xdf, 0xfe, 0x50, 0x0, 0x0, 0x0, 0x3d,
+    0xff, 0xe5, 0x0, 0x0, 0x0, 0x3, 0xdf, 0xfe,
+    0x50, 0x0, 0x0, 0x0, 0x3d, 0xff, 0xe5, 0x0,
+    0x0, 0x0, 0x2, 0xcf, 0xfe, 0x60, 0x0, 0x0,
+    0x0, 0x2b, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x1,
+    0xaf, 0xff, 0x80, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0xfa, 0x10, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xc2,
+    0x0, 0x0, 0x0, 0x3, 0xef, 0xfe, 0x30, 0x0,
+    0x0, 0x0, 0xd, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x4,
+    0xef, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x2c, 0xff,
+    0xe3, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x2, 0xdf, 0xfb, 0x10, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xe4, 0x0, 0x0, 0x0,
+    0x0, 0x3d, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x2, 0xdf,
+    0xf9, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xd3,
+    0x0, 0x0, 0x0, 0x0, 0x1b, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x4d, 0xfe, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x5f, 0xfb, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x44, 0x41,
+
+    /* U+0029 ")" */
+    0x17, 0xa9, 0x20, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xfa, 0x0, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xe7,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xd3, 0x0,
+    0x0, 0x0, 0x0, 0x1b, 0xff, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0x5e, 0xfe, 0x50, 0x0, 0x0, 0x0,
+    0x1, 0xbf, 0xfb, 0x20, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xff,
+    0xd0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x60,
+    0x0, 0x0, 0x0, 0x4, 0xdf, 0xfa, 0x10, 0x0,
+    0x0, 0x0, 0x1b, 0xff, 0xe4, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xff,
+    0xf2, 0x0, 0x0, 0x0, 0x1, 0xbf, 0xff, 0x60,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xb1, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0xfc, 0x20, 0x0, 0x0, 0x0, 0x5e,
+    0xff, 0xd3, 0x0, 0x0, 0x0, 0x4, 0xef, 0xfe,
+    0x40, 0x0, 0x0, 0x0, 0x4d, 0xff, 0xe4, 0x0,
+    0x0, 0x0, 0x3, 0xdf, 0xfe, 0x50, 0x0, 0x0,
+    0x0, 0x3d, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x4,
+    0xef, 0xfd, 0x40, 0x0, 0x0, 0x0, 0x4e, 0xff,
+    0xd4, 0x0, 0x0, 0x0, 0x5, 0xff, 0xfd, 0x30,
+    0x0, 0x0, 0x0, 0x6f, 0xff, 0xc1, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x1,
+    0xaf, 0xff, 0x80, 0x0, 0x0, 0x0, 0x1d, 0xff,
+    0xf4, 0x0, 0x0, 0x0, 0x2, 0xff, 0xfe, 0x10,
+    0x0, 0x0, 0x0, 0x6f, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x2,
+    0xdf, 0xfd, 0x30, 0x0, 0x0, 0x0, 0x6f, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x19, 0xff, 0xf3, 0x0,
+    0x0, 0x0, 0x3, 0xef, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x2d,
+    0xff, 0x91, 0x0, 0x0, 0x0, 0x7, 0xff, 0xe3,
+    0x0, 0x0, 0x0, 0x2, 0xcf, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xfc, 0x20, 0x0, 0x0, 0x0,
+    0x2d, 0xfe, 0x50, 0x0, 0x0, 0x0, 0x19, 0xff,
+    0x70, 0x0, 0x0, 0x0, 0x1, 0x34, 0x41, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+002A "*" */
+    0x0, 0x0, 0x0, 0x7f, 0xfd, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7, 0xff, 0xd0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6e, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0x32, 0x0, 0x5, 0xef, 0xa0, 0x0,
+    0x14, 0x10, 0xa, 0xea, 0x52, 0x4d, 0xf8, 0x13,
+    0x8d, 0xd4, 0x2, 0xef, 0xff, 0xc9, 0xef, 0xaa,
+    0xef, 0xff, 0x80, 0x5e, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xea, 0x10, 0x36, 0x9b, 0xdf, 0xff,
+    0xfe, 0xcb, 0x95, 0x20, 0x0, 0x0, 0x16, 0xef,
+    0xff, 0xa3, 0x10, 0x0, 0x0, 0x0, 0x3, 0xcf,
+    0xfd, 0xff, 0x80, 0x0, 0x0, 0x0, 0x2, 0xbf,
+    0xfb, 0x6e, 0xfe, 0x60, 0x0, 0x0, 0x1, 0xbf,
+    0xfd, 0x31, 0x9f, 0xfe, 0x50, 0x0, 0x0, 0x6e,
+    0xff, 0x80, 0x2, 0xef, 0xfc, 0x10, 0x0, 0x0,
+    0x7d, 0xc1, 0x0, 0x6, 0xeb, 0x30, 0x0, 0x0,
+    0x0, 0x43, 0x0, 0x0, 0x15, 0x10, 0x0, 0x0,
+
+    /* U+002B "+" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x12, 0x21, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xcf, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xfd, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xcf, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xfd, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xcf, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xfd, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xcf, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xfd, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x12, 0x22, 0x22, 0x22,
+    0x24, 0xdf, 0xfd, 0x42, 0x22, 0x22, 0x22, 0x21,
+    0x4d, 0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0xff, 0xed,
+    0xdd, 0xdd, 0xdd, 0xd5, 0x5f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
+    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf6, 0x4e, 0xee, 0xee, 0xee,
+    0xee, 0xff, 0xff, 0xee, 0xee, 0xee, 0xee, 0xe5,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xfd, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xcf, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xfd, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xcf, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xfd, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xcf, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xfd, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xcf, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xfd, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x68, 0x87, 0x10, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+002C "," */
+    0x9c, 0xcc, 0xb1, 0xbf, 0xff, 0xe2, 0xbf, 0xff,
+    0xe2, 0xbf, 0xff, 0xe2, 0xbf, 0xff, 0xe2, 0x0,
+    0x6f, 0xe2, 0x0, 0x8f, 0xe0, 0x0, 0xbf, 0xc0,
+    0x4, 0xef, 0x70, 0x5d, 0xfc, 0x20, 0xaf, 0xc4,
+    0x0, 0x27, 0x20, 0x0,
+
+    /* U+002D "-" */
+    0x47, 0x77, 0x77, 0x77, 0x77, 0x77, 0x73, 0x8f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x8f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf7, 0x8f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf7, 0x5b, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xbb, 0xb5,
+
+    /* U+002E "." */
+    0x8c, 0xcc, 0xb2, 0xaf, 0xff, 0xe3, 0xaf, 0xff,
+    0xe3, 0xaf, 0xff, 0xe3, 0xaf, 0xff, 0xe3,
+
+    /* U+002F "/" */
+    0x0, 0x0, 0x0, 0x0, 0x2, 0x9a, 0xa2, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0xf1, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0x1d, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xfc, 0x20, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xdf, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xef, 0xf1, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0x1c, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xfc, 0x20, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xdf, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xef, 0xe2, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x2b, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x3e, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x6f,
+    0xfc, 0x20, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf9,
+    0x10, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xef, 0xe3, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xd0, 0x0, 0x0, 0x0,
+    0x0, 0x2b, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x3e, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x6f,
+    0xfd, 0x20, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xfa,
+    0x10, 0x0, 0x0, 0x0, 0x1, 0xef, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0xe4, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xc1, 0x0, 0x0, 0x0,
+    0x0, 0x1b, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0x3d, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x6f,
+    0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xfb,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x9a, 0xa5, 0x0,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+0030 "0" */
+    0x0, 0x0, 0x0, 0x0, 0x12, 0x44, 0x44, 0x31,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0x9c, 0xef, 0xfe, 0xdb, 0x61, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0x9e, 0xff, 0xff, 0xff, 0xff,
+    0xfc, 0x40, 0x0, 0x0, 0x0, 0x0, 0x2a, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xe5, 0x0, 0x0,
+    0x0, 0x1, 0xaf, 0xff, 0xfc, 0x74, 0x35, 0xbe,
+    0xff, 0xfd, 0x40, 0x0, 0x0, 0x6, 0xff, 0xff,
+    0x81, 0x0, 0x0, 0x16, 0xef, 0xff, 0xb0, 0x0,
+    0x0, 0x1d, 0xff, 0xf9, 0x10, 0x0, 0x0, 0x0,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x6e, 0xff, 0xd2,
+    0x0, 0x0, 0x0, 0x0, 0x19, 0xff, 0xfb, 0x10,
+    0x1, 0xaf, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xef, 0xfd, 0x30, 0x3, 0xdf, 0xfe, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0x70,
+    0x4, 0xff, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0xff, 0xa0, 0x7, 0xff, 0xfc, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xe0,
+    0xa, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xff, 0xf0, 0xc, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xf3,
+    0xd, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2f, 0xff, 0xf4, 0xe, 0xff, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xf5,
+    0xe, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1d, 0xff, 0xf5, 0x1e, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xff, 0xf6,
+    0x1e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1d, 0xff, 0xf6, 0xe, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xff, 0xf5,
+    0xe, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1e, 0xff, 0xf5, 0xe, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xf4,
+    0xc, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2f, 0xff, 0xf3, 0xa, 0xff, 0xf9, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf1,
+    0x8, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5f, 0xff, 0xe0, 0x5, 0xff, 0xfd, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xc0,
+    0x3, 0xef, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xbf, 0xff, 0x80, 0x2, 0xbf, 0xff, 0x60,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xdf, 0xff, 0x50,
+    0x0, 0x8f, 0xff, 0xb1, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xef, 0xfc, 0x20, 0x0, 0x3e, 0xff, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0x2d, 0xff, 0xf8, 0x0,
+    0x0, 0xa, 0xff, 0xfd, 0x40, 0x0, 0x0, 0x2,
+    0xbf, 0xff, 0xe2, 0x0, 0x0, 0x3, 0xdf, 0xff,
+    0xe8, 0x31, 0x12, 0x6c, 0xff, 0xfe, 0x60, 0x0,
+    0x0, 0x0, 0x5e, 0xff, 0xff, 0xdc, 0xbc, 0xef,
+    0xff, 0xf9, 0x10, 0x0, 0x0, 0x0, 0x5, 0xdf,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x39, 0xff, 0xff, 0xff, 0xff,
+    0xc5, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x15, 0x9a, 0xa9, 0x73, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+0031 "1" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x15, 0x65, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xd1, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xdf, 0xfd, 0x10, 0x0,
+    0x0, 0x0, 0x1, 0xcf, 0xff, 0xd1, 0x0, 0x0,
+    0x0, 0x2, 0xbf, 0xff, 0xfd, 0x10, 0x0, 0x0,
+    0x3, 0xcf, 0xff, 0xff, 0xd1, 0x0, 0x0, 0x15,
+    0xcf, 0xff, 0xff, 0xfd, 0x10, 0x0, 0x39, 0xff,
+    0xff, 0xff, 0xff, 0xd1, 0x1, 0x7d, 0xff, 0xff,
+    0xfa, 0xff, 0xfd, 0x11, 0xaf, 0xff, 0xff, 0xc4,
+    0x5f, 0xff, 0xd1, 0x1b, 0xff, 0xff, 0x92, 0x5,
+    0xff, 0xfd, 0x11, 0xbf, 0xeb, 0x30, 0x0, 0x5f,
+    0xff, 0xd1, 0x1b, 0xb5, 0x10, 0x0, 0x5, 0xff,
+    0xfd, 0x10, 0x10, 0x0, 0x0, 0x0, 0x5f, 0xff,
+    0xd1, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xfd,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xd1,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xfd, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xd1, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0xfd, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xff, 0xd1, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xfd, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x5f, 0xff, 0xd1, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0xfd, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x5f, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xff, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x5f, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x5f,
+    0xff, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
+    0xd1, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xfd,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xd1,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xfd, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xd1, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0xfd, 0x10,
+
+    /* U+0032 "2" */
+    0x0, 0x0, 0x0, 0x0, 0x13, 0x44, 0x44, 0x43,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x27,
+    0xbd, 0xef, 0xff, 0xed, 0xa6, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x16, 0xef, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xc4, 0x0, 0x0, 0x0, 0x1, 0x9f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x60, 0x0,
+    0x0, 0x8, 0xff, 0xff, 0xea, 0x53, 0x24, 0x7c,
+    0xef, 0xff, 0xe4, 0x0, 0x0, 0x4e, 0xff, 0xfc,
+    0x40, 0x0, 0x0, 0x1, 0x8e, 0xff, 0xfc, 0x20,
+    0x1, 0xaf, 0xff, 0xc3, 0x0, 0x0, 0x0, 0x0,
+    0x18, 0xef, 0xff, 0x60, 0x3, 0xef, 0xfe, 0x60,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xbf, 0xff, 0xb0,
+    0x6, 0xff, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xe0, 0x9, 0xff, 0xfb, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf1,
+    0x6, 0xac, 0xea, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xbf, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xef, 0xff, 0x70,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1b, 0xff, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf8, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0xef, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6e, 0xff, 0xfe, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x16, 0xef,
+    0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7e, 0xff, 0xfe, 0x60, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0xff, 0xff,
+    0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xae, 0xff, 0xfe, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3c, 0xff, 0xff, 0xc4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xdf, 0xff, 0xfc, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6d, 0xff, 0xff, 0xa2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xef,
+    0xff, 0xf9, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6e, 0xff, 0xfe, 0x71, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xdf, 0xff,
+    0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2d, 0xff, 0xfe, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xaf, 0xff, 0xe7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xef, 0xff, 0xb2, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x20, 0xc, 0xff, 0xff, 0xfe,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe2,
+    0x3e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf2, 0x7f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
+    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf2,
+
+    /* U+0033 "3" */
+    0x0, 0x0, 0x0, 0x2, 0x34, 0x44, 0x42, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x28, 0xbd,
+    0xff, 0xfe, 0xca, 0x51, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xb4,
+    0x0, 0x0, 0x0, 0x1, 0x8e, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xd5, 0x0, 0x0, 0x0, 0x7e,
+    0xff, 0xfe, 0x94, 0x23, 0x5b, 0xef, 0xff, 0xd4,
+    0x0, 0x0, 0x3d, 0xff, 0xfc, 0x30, 0x0, 0x0,
+    0x16, 0xef, 0xff, 0xb0, 0x0, 0x9, 0xff, 0xfd,
+    0x40, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0x40,
+    0x3, 0xdf, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x1c, 0xff, 0xf8, 0x0, 0x4f, 0xff, 0xe3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xa1, 0x4,
+    0xab, 0xdb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xfb, 0x10, 0x0, 0x23, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9f, 0xff, 0xa1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2c, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xff, 0xfe, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x17, 0xef, 0xff, 0x90,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x7b,
+    0xff, 0xff, 0xb2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xdd, 0xef, 0xff, 0xfe, 0x91, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff,
+    0xb4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xfe, 0xef, 0xff, 0xff, 0xd9, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x68, 0x66, 0x79, 0xdf, 0xff,
+    0xfd, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0x9f, 0xff, 0xfb, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x8f, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xdf, 0xff, 0xe0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2f, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xff, 0x82,
+    0x46, 0x83, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2e, 0xff, 0xf8, 0xde, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0x6b, 0xff,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
+    0xff, 0xf3, 0x7f, 0xff, 0xe5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1c, 0xff, 0xfd, 0x3, 0xdf, 0xff,
+    0xb1, 0x0, 0x0, 0x0, 0x0, 0x18, 0xef, 0xff,
+    0x70, 0x8, 0xff, 0xff, 0x91, 0x0, 0x0, 0x0,
+    0x17, 0xef, 0xff, 0xc2, 0x0, 0x1b, 0xff, 0xff,
+    0xb5, 0x21, 0x12, 0x5a, 0xff, 0xff, 0xe4, 0x0,
+    0x0, 0x3c, 0xff, 0xff, 0xec, 0xcc, 0xce, 0xff,
+    0xff, 0xe6, 0x0, 0x0, 0x0, 0x3a, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xb4, 0x0, 0x0, 0x0,
+    0x0, 0x16, 0xdf, 0xff, 0xff, 0xff, 0xfd, 0x72,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x37, 0x9a,
+    0xa9, 0x73, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+0034 "4" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0x34, 0x43, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4e, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2d, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x19, 0xff, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xef, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xef, 0xff, 0xff,
+    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xaf, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xdf,
+    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3e, 0xff, 0xc9, 0xff, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2c, 0xff, 0xd3,
+    0x8f, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0xf7, 0x8, 0xff, 0xfb, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xfa,
+    0x0, 0x8f, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xcf, 0xfd, 0x30, 0x8, 0xff, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xaf, 0xfe,
+    0x50, 0x0, 0x8f, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0x90, 0x0, 0x8, 0xff,
+    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4d, 0xff,
+    0xc2, 0x0, 0x0, 0x8f, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0x1b, 0xff, 0xe4, 0x0, 0x0, 0x8,
+    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0x5, 0xef, 0xfb, 0x10, 0x0, 0x0,
+    0x8, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x2, 0xcf,
+    0xfe, 0x40, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xb0,
+    0x0, 0x0, 0x1, 0xaf, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x6f,
+    0xff, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
+    0xb0, 0x0, 0x0, 0x3d, 0xff, 0xe6, 0x33, 0x33,
+    0x33, 0x33, 0x39, 0xff, 0xfc, 0x33, 0x33, 0x15,
+    0xff, 0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xef,
+    0xff, 0xfd, 0xdd, 0xd5, 0x5f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x55, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf5, 0x4c, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcd, 0xff, 0xfe, 0xcc,
+    0xcc, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xfb, 0x0, 0x0, 0x0,
+
+    /* U+0035 "5" */
+    0x0, 0x1, 0x89, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x82, 0x0, 0x0, 0x3e, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x40, 0x0,
+    0x5, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xe4, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0x40, 0x0, 0x1a,
+    0xff, 0xfa, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x62, 0x0, 0x2, 0xcf, 0xfe, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0xff,
+    0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x90,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xa, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e,
+    0xff, 0xd2, 0x1, 0x58, 0x99, 0x86, 0x20, 0x0,
+    0x0, 0x0, 0x4, 0xef, 0xfb, 0x49, 0xdf, 0xff,
+    0xff, 0xfe, 0xb4, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x10,
+    0x0, 0x9, 0xff, 0xff, 0xff, 0xfe, 0xdd, 0xef,
+    0xff, 0xff, 0xfa, 0x10, 0x1, 0xbf, 0xff, 0xff,
+    0xc8, 0x54, 0x45, 0x8c, 0xff, 0xff, 0xf8, 0x0,
+    0x2c, 0xff, 0xfe, 0x82, 0x0, 0x0, 0x0, 0x28,
+    0xef, 0xff, 0xe4, 0x3, 0xce, 0xfe, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0x17, 0xef, 0xff, 0xb0, 0x2,
+    0x34, 0x51, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b,
+    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xff, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef,
+    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1b, 0xff, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xaf, 0xff,
+    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1b, 0xff, 0xfa, 0x1, 0x23, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xff, 0x9d,
+    0xee, 0xe9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2e, 0xff, 0xf6, 0xcf, 0xff, 0xc1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x28, 0xff,
+    0xfe, 0x50, 0x0, 0x0, 0x0, 0x0, 0x1, 0xcf,
+    0xff, 0xc0, 0x3e, 0xff, 0xfb, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x8e, 0xff, 0xe6, 0x1, 0x9f, 0xff,
+    0xf9, 0x10, 0x0, 0x0, 0x1, 0x7e, 0xff, 0xfa,
+    0x10, 0x2, 0xdf, 0xff, 0xfb, 0x52, 0x11, 0x25,
+    0xaf, 0xff, 0xfd, 0x30, 0x0, 0x4, 0xdf, 0xff,
+    0xfe, 0xcb, 0xcc, 0xef, 0xff, 0xfd, 0x50, 0x0,
+    0x0, 0x3, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfb, 0x30, 0x0, 0x0, 0x0, 0x2, 0x7d, 0xff,
+    0xff, 0xff, 0xff, 0xd7, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0x79, 0xaa, 0x97, 0x30, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+0036 "6" */
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x34, 0x44, 0x43,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0x6a, 0xde, 0xff, 0xed, 0xa7, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5d, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xd4, 0x0, 0x0, 0x0, 0x0, 0x6, 0xef,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x60, 0x0,
+    0x0, 0x0, 0x6e, 0xff, 0xfe, 0xa5, 0x33, 0x6b,
+    0xef, 0xff, 0xe3, 0x0, 0x0, 0x4, 0xdf, 0xff,
+    0xc5, 0x0, 0x0, 0x1, 0x7e, 0xff, 0xfa, 0x10,
+    0x0, 0xa, 0xff, 0xfd, 0x30, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xfe, 0x40, 0x0, 0x5e, 0xff, 0xe5,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xdf, 0xff, 0x80,
+    0x0, 0x9f, 0xff, 0x91, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0xff, 0xb0, 0x2, 0xdf, 0xfe, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x37, 0x65, 0x30,
+    0x4, 0xff, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf9, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xf6, 0x0, 0x0, 0x1, 0x34, 0x21,
+    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xf3, 0x0,
+    0x26, 0xce, 0xee, 0xee, 0xa5, 0x10, 0x0, 0x0,
+    0xe, 0xff, 0xf2, 0x5, 0xcf, 0xff, 0xff, 0xff,
+    0xff, 0xa3, 0x0, 0x0, 0x1e, 0xff, 0xe3, 0x7e,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x40, 0x0,
+    0x2e, 0xff, 0xe8, 0xef, 0xff, 0xb8, 0x78, 0xbe,
+    0xff, 0xff, 0xd3, 0x0, 0x3e, 0xff, 0xfe, 0xff,
+    0xb4, 0x10, 0x0, 0x14, 0xcf, 0xff, 0xfa, 0x10,
+    0x3e, 0xff, 0xff, 0xfa, 0x10, 0x0, 0x0, 0x0,
+    0x2b, 0xff, 0xfe, 0x50, 0x3e, 0xff, 0xff, 0xc2,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xdf, 0xff, 0xb0,
+    0x3e, 0xff, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xff, 0xf1, 0x2e, 0xff, 0xfd, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf4,
+    0x1e, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1d, 0xff, 0xf6, 0xe, 0xff, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xff, 0xf7,
+    0xc, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1c, 0xff, 0xf7, 0x9, 0xff, 0xfc, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xff, 0xf6,
+    0x6, 0xff, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2e, 0xff, 0xf3, 0x3, 0xef, 0xfe, 0x60,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf1,
+    0x1, 0xaf, 0xff, 0xb1, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xbf, 0xff, 0xb0, 0x0, 0x6e, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x6, 0xef, 0xfe, 0x50,
+    0x0, 0x1c, 0xff, 0xfe, 0x51, 0x0, 0x0, 0x0,
+    0x5d, 0xff, 0xfb, 0x10, 0x0, 0x3, 0xdf, 0xff,
+    0xea, 0x41, 0x1, 0x38, 0xef, 0xff, 0xe3, 0x0,
+    0x0, 0x0, 0x5d, 0xff, 0xff, 0xec, 0xbc, 0xdf,
+    0xff, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x4, 0xcf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xc5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x27, 0xef, 0xff, 0xff, 0xff,
+    0xe9, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x13, 0x89, 0xaa, 0x85, 0x10, 0x0, 0x0, 0x0,
+
+    /* U+0037 "7" */
+    0x68, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x4b, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xbf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x8b, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x68, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xae, 0xff,
+    0xfc, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x19, 0xff, 0xfc, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xfe, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xef, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xcf, 0xff, 0xa1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
+    0xe4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5e, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xfc, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0xff, 0xfe, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xdf, 0xff, 0xb1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xe4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2c, 0xff, 0xfa, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xfe, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0xff, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xff, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
+    0xfc, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xdf, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xd4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1a, 0xff, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xef, 0xff, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0xfd, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3d, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xef, 0xfe, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xc3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0xfb, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xaf,
+    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1b, 0xff, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0x55, 0x52, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+0038 "8" */
+    0x0, 0x0, 0x0, 0x0, 0x12, 0x44, 0x44, 0x31,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x15,
+    0xac, 0xef, 0xfe, 0xdb, 0x72, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xce, 0xff, 0xff, 0xff, 0xff,
+    0xfd, 0x61, 0x0, 0x0, 0x0, 0x0, 0x4d, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x10, 0x0,
+    0x0, 0x3, 0xdf, 0xff, 0xfc, 0x63, 0x35, 0xae,
+    0xff, 0xfe, 0x60, 0x0, 0x0, 0xa, 0xff, 0xff,
+    0x81, 0x0, 0x0, 0x4, 0xdf, 0xff, 0xe2, 0x0,
+    0x0, 0x3e, 0xff, 0xf9, 0x10, 0x0, 0x0, 0x0,
+    0x4e, 0xff, 0xf8, 0x0, 0x0, 0x7f, 0xff, 0xd3,
+    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xfb, 0x20,
+    0x0, 0x8f, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xef, 0xfd, 0x30, 0x0, 0x9f, 0xff, 0x91,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xef, 0xfe, 0x40,
+    0x0, 0x9f, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xef, 0xfe, 0x40, 0x0, 0x7f, 0xff, 0xd2,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xfc, 0x20,
+    0x0, 0x3e, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
+    0x2c, 0xff, 0xfa, 0x10, 0x0, 0x8, 0xff, 0xfe,
+    0x51, 0x0, 0x0, 0x2, 0xaf, 0xff, 0xe4, 0x0,
+    0x0, 0x2, 0xaf, 0xff, 0xe9, 0x31, 0x2, 0x6b,
+    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x18, 0xdf,
+    0xff, 0xed, 0xde, 0xef, 0xff, 0xd6, 0x10, 0x0,
+    0x0, 0x0, 0x1, 0x7e, 0xff, 0xff, 0xff, 0xff,
+    0xfb, 0x30, 0x0, 0x0, 0x0, 0x0, 0x3a, 0xef,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0xb3, 0x0, 0x0,
+    0x0, 0x6, 0xdf, 0xff, 0xfd, 0xa9, 0x89, 0xcf,
+    0xff, 0xfe, 0x70, 0x0, 0x0, 0x4e, 0xff, 0xfe,
+    0x83, 0x10, 0x1, 0x25, 0xcf, 0xff, 0xe7, 0x0,
+    0x2, 0xcf, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0,
+    0x2a, 0xff, 0xfe, 0x50, 0x6, 0xff, 0xfe, 0x70,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xdf, 0xff, 0xb0,
+    0xb, 0xff, 0xfc, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5f, 0xff, 0xf2, 0xe, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xf6,
+    0x1e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1b, 0xff, 0xf8, 0x1e, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1a, 0xff, 0xf9,
+    0xe, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1c, 0xff, 0xf8, 0xc, 0xff, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xf6,
+    0x8, 0xff, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0xf2, 0x4, 0xef, 0xff, 0x91,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xdf, 0xff, 0xb0,
+    0x1, 0x9f, 0xff, 0xe8, 0x10, 0x0, 0x0, 0x0,
+    0x3b, 0xff, 0xfe, 0x50, 0x0, 0x2c, 0xff, 0xff,
+    0xb6, 0x21, 0x11, 0x37, 0xdf, 0xff, 0xf8, 0x10,
+    0x0, 0x4, 0xdf, 0xff, 0xfe, 0xdc, 0xbc, 0xdf,
+    0xff, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x3b, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x10, 0x0,
+    0x0, 0x0, 0x1, 0x6d, 0xff, 0xff, 0xff, 0xff,
+    0xfa, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x36, 0x9a, 0xaa, 0x85, 0x10, 0x0, 0x0, 0x0,
+
+    /* U+0039 "9" */
+    0x0, 0x0, 0x0, 0x0, 0x13, 0x44, 0x43, 0x21,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x17,
+    0xbd, 0xef, 0xfe, 0xc9, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x15, 0xdf, 0xff, 0xff, 0xff, 0xff,
+    0xea, 0x30, 0x0, 0x0, 0x0, 0x1, 0x7e, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x0, 0x0,
+    0x0, 0x7, 0xef, 0xff, 0xfc, 0x74, 0x35, 0xae,
+    0xff, 0xfd, 0x40, 0x0, 0x0, 0x4e, 0xff, 0xff,
+    0x81, 0x0, 0x0, 0x4, 0xcf, 0xff, 0xd2, 0x0,
+    0x1, 0xaf, 0xff, 0xf7, 0x10, 0x0, 0x0, 0x0,
+    0x3c, 0xff, 0xf8, 0x0, 0x4, 0xef, 0xff, 0xa1,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xef, 0xfd, 0x30,
+    0x7, 0xff, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xbf, 0xff, 0x70, 0xb, 0xff, 0xfb, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xc0,
+    0xe, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xff, 0xf0, 0xe, 0xff, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xf3,
+    0x1e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2f, 0xff, 0xf5, 0xe, 0xff, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf6,
+    0xd, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5f, 0xff, 0xf8, 0xa, 0xff, 0xfc, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf8,
+    0x6, 0xff, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xdf, 0xff, 0xf9, 0x3, 0xdf, 0xff, 0xd3,
+    0x0, 0x0, 0x0, 0x0, 0x1a, 0xff, 0xff, 0xf9,
+    0x0, 0x8f, 0xff, 0xfc, 0x40, 0x0, 0x0, 0x2,
+    0xaf, 0xff, 0xff, 0xf9, 0x0, 0x2c, 0xff, 0xff,
+    0xda, 0x42, 0x23, 0x7c, 0xff, 0xec, 0xff, 0xf8,
+    0x0, 0x3, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfd, 0x59, 0xff, 0xf7, 0x0, 0x0, 0x3c, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xd5, 0x1a, 0xff, 0xf6,
+    0x0, 0x0, 0x1, 0x8c, 0xef, 0xff, 0xff, 0xc8,
+    0x10, 0x1b, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x2,
+    0x57, 0x99, 0x75, 0x20, 0x0, 0x1d, 0xff, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xc0,
+    0x0, 0x12, 0x22, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0xff, 0x80, 0x3, 0xbc, 0xdb, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xdf, 0xfe, 0x40,
+    0x3, 0xef, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xfb, 0x10, 0x2, 0xbf, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x5e, 0xff, 0xf6, 0x0,
+    0x0, 0x7f, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x4,
+    0xdf, 0xff, 0xb1, 0x0, 0x0, 0x1c, 0xff, 0xfe,
+    0x73, 0x10, 0x13, 0x8e, 0xff, 0xfd, 0x30, 0x0,
+    0x0, 0x5, 0xef, 0xff, 0xfd, 0xcb, 0xcd, 0xff,
+    0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x5d, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfb, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xae, 0xff, 0xff, 0xff, 0xfe,
+    0x72, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0x58, 0xaa, 0x97, 0x40, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+003A ":" */
+    0x7a, 0xaa, 0xa2, 0xaf, 0xff, 0xe3, 0xaf, 0xff,
+    0xe3, 0xaf, 0xff, 0xe3, 0xaf, 0xff, 0xe3, 0x12,
+    0x22, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8c, 0xcc, 0xb2, 0xaf,
+    0xff, 0xe3, 0xaf, 0xff, 0xe3, 0xaf, 0xff, 0xe3,
+    0xaf, 0xff, 0xe3,
+
+    /* U+003B ";" */
+    0x8a, 0xaa, 0xa1, 0xbf, 0xff, 0xe2, 0xbf, 0xff,
+    0xe2, 0xbf, 0xff, 0xe2, 0xbf, 0xff, 0xe2, 0x12,
+    0x22, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9c, 0xcc, 0xb1, 0xbf,
+    0xff, 0xe2, 0xbf, 0xff, 0xe2, 0xbf, 0xff, 0xe2,
+    0xbf, 0xff, 0xe2, 0x0, 0x6f, 0xe2, 0x0, 0x8f,
+    0xe0, 0x0, 0xbf, 0xc0, 0x4, 0xef, 0x70, 0x5d,
+    0xfc, 0x20, 0xaf, 0xc4, 0x0, 0x27, 0x20, 0x0,
+
+    /* U+003C "<" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x32, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x59, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x6b, 0xef, 0xf6, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x14, 0x8e, 0xff, 0xff, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xad,
+    0xff, 0xff, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x37, 0xdf, 0xff, 0xff, 0xfe, 0xb7, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x3a, 0xdf, 0xff, 0xff,
+    0xff, 0xa5, 0x10, 0x0, 0x0, 0x0, 0x2, 0x6c,
+    0xef, 0xff, 0xff, 0xec, 0x82, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0x8c, 0xff, 0xff, 0xff, 0xfa, 0x62,
+    0x0, 0x0, 0x0, 0x0, 0x14, 0xae, 0xff, 0xff,
+    0xfe, 0xd8, 0x31, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5f, 0xff, 0xff, 0xfe, 0xb6, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xfe, 0xa4,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5f, 0xff, 0xfd, 0x72, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xfd,
+    0x93, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x16, 0xbe, 0xff, 0xff, 0xff, 0xb6, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x14, 0xaf, 0xff,
+    0xff, 0xff, 0xc8, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0x8c, 0xff, 0xff, 0xff, 0xfa,
+    0x52, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0x6c, 0xff, 0xff, 0xff, 0xeb, 0x72, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3a, 0xdf, 0xff,
+    0xff, 0xfe, 0x95, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x38, 0xdf, 0xff, 0xff, 0xfe, 0xb3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x16,
+    0xbe, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x14, 0x9e, 0xff, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x12, 0x8c, 0xe6, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x63,
+
+    /* U+003D "=" */
+    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf6, 0x5f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
+    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf6, 0x4d, 0xdd, 0xdd, 0xdd,
+    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xd5,
+    0x1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x38, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x83, 0x5f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
+    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf6, 0x5f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
+    0x26, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x66, 0x66, 0x62,
+
+    /* U+003E ">" */
+    0x22, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5e, 0xa5, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5f, 0xfe, 0xc6, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xe8,
+    0x41, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4e, 0xff, 0xff, 0xff, 0xea, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0x7c, 0xef, 0xff,
+    0xff, 0xfd, 0x73, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0x5a, 0xef, 0xff, 0xff, 0xfd, 0x94,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x28,
+    0xce, 0xff, 0xff, 0xfe, 0xc6, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x26, 0xaf, 0xff, 0xff,
+    0xff, 0xc8, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x13, 0x9d, 0xff, 0xff, 0xff, 0xeb, 0x41,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x6b,
+    0xef, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x49, 0xef, 0xff, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x27, 0xdf, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x39, 0xdf, 0xff, 0xff, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x6b, 0xff,
+    0xff, 0xff, 0xeb, 0x61, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0x8c, 0xef, 0xff, 0xff, 0xeb, 0x41, 0x0,
+    0x0, 0x0, 0x0, 0x25, 0xaf, 0xff, 0xff, 0xff,
+    0xc8, 0x20, 0x0, 0x0, 0x0, 0x0, 0x27, 0xbe,
+    0xff, 0xff, 0xff, 0xc6, 0x20, 0x0, 0x0, 0x0,
+    0x1, 0x5a, 0xef, 0xff, 0xff, 0xfd, 0xa3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3b, 0xef, 0xff, 0xff,
+    0xfd, 0x83, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5f, 0xff, 0xff, 0xeb, 0x61, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xe9, 0x51,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5e, 0xc7, 0x21, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x36, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+003F "?" */
+    0x0, 0x0, 0x1, 0x37, 0xad, 0xee, 0xdc, 0x95,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x2, 0xae, 0xff,
+    0xff, 0xff, 0xff, 0xfc, 0x71, 0x0, 0x0, 0x0,
+    0x5, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xb3, 0x0, 0x0, 0x5, 0xdf, 0xff, 0xfe, 0xa8,
+    0x89, 0xcf, 0xff, 0xff, 0xc2, 0x0, 0x2, 0xdf,
+    0xff, 0xf9, 0x31, 0x0, 0x1, 0x4c, 0xff, 0xff,
+    0xa1, 0x0, 0x9f, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x2b, 0xff, 0xfe, 0x60, 0x2d, 0xff, 0xfb,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x3d, 0xff, 0xfc,
+    0x6, 0xff, 0xfe, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xf1, 0x9f, 0xff, 0xd1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x3a,
+    0xef, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2f, 0xff, 0xf4, 0x24, 0x45, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2c, 0xff, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2a, 0xff, 0xfe,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1a, 0xff, 0xff, 0x81, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2a, 0xff, 0xff, 0xb1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2b, 0xff,
+    0xff, 0xb2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3b, 0xff, 0xff, 0xb2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xff, 0xa2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xdf, 0xff, 0xa1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
+    0xd3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xe, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0x88, 0x81, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2c, 0xcc, 0xc8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0xff, 0xfa, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+0040 "@" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x24, 0x79, 0xcd, 0xee, 0xed, 0xca, 0x75, 0x31,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x59, 0xcf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0x60,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x6d, 0xef, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x71,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4b, 0xff, 0xff, 0xff, 0xec, 0xa8,
+    0x77, 0x78, 0x9b, 0xef, 0xff, 0xff, 0xfb, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x17, 0xef, 0xff, 0xfd, 0xb6, 0x21, 0x10, 0x0,
+    0x0, 0x11, 0x25, 0xae, 0xff, 0xff, 0xe6, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x8f,
+    0xff, 0xfe, 0x93, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0x8e, 0xff, 0xfe, 0x71, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x19, 0xef, 0xff,
+    0xb3, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xbf, 0xff, 0xe7, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xe7, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x19, 0xef, 0xfe, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xef, 0xfe, 0x60, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x8f, 0xff, 0xb2, 0x0, 0x0, 0x0,
+    0x0, 0x3d, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0,
+    0x13, 0x55, 0x54, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x4, 0xad,
+    0xef, 0xed, 0xb5, 0x0, 0x5, 0xaa, 0xa7, 0x0,
+    0x2, 0xcf, 0xfd, 0x20, 0x0, 0x0, 0x4, 0xef,
+    0xfa, 0x10, 0x0, 0x0, 0x3, 0xaf, 0xff, 0xff,
+    0xff, 0xff, 0xa2, 0x1a, 0xff, 0xf8, 0x0, 0x0,
+    0x6e, 0xff, 0x80, 0x0, 0x0, 0x1a, 0xff, 0xe3,
+    0x0, 0x0, 0x0, 0x3c, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf9, 0x2c, 0xff, 0xf5, 0x0, 0x0, 0x1c,
+    0xff, 0xb2, 0x0, 0x0, 0x3e, 0xff, 0x80, 0x0,
+    0x0, 0x4, 0xdf, 0xff, 0xea, 0x52, 0x25, 0xbe,
+    0xff, 0xaf, 0xff, 0xf1, 0x0, 0x0, 0x7, 0xff,
+    0xf4, 0x0, 0x0, 0x8f, 0xfe, 0x30, 0x0, 0x0,
+    0x1c, 0xff, 0xfe, 0x61, 0x0, 0x0, 0x18, 0xff,
+    0xff, 0xff, 0xd0, 0x0, 0x0, 0x3, 0xef, 0xf6,
+    0x0, 0x1, 0xdf, 0xf9, 0x10, 0x0, 0x1, 0x9f,
+    0xff, 0xe5, 0x0, 0x0, 0x0, 0x1, 0xaf, 0xff,
+    0xff, 0xa0, 0x0, 0x0, 0x2, 0xcf, 0xf9, 0x0,
+    0x5, 0xef, 0xe5, 0x0, 0x0, 0x5, 0xef, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x3e, 0xff, 0xff,
+    0x60, 0x0, 0x0, 0x1, 0xaf, 0xfb, 0x0, 0x8,
+    0xff, 0xd1, 0x0, 0x0, 0xb, 0xff, 0xfc, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xfe, 0x40,
+    0x0, 0x0, 0x1, 0x9f, 0xfc, 0x0, 0x1a, 0xff,
+    0xb0, 0x0, 0x0, 0x3f, 0xff, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x19, 0xff, 0xfc, 0x20, 0x0,
+    0x0, 0x1, 0x9f, 0xfd, 0x0, 0x2c, 0xff, 0x80,
+    0x0, 0x0, 0x9f, 0xff, 0xd2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xfa, 0x10, 0x0, 0x0,
+    0x1, 0xaf, 0xfc, 0x0, 0x3e, 0xff, 0x40, 0x0,
+    0x2, 0xcf, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x1,
+    0xcf, 0xfb, 0x0, 0x4f, 0xff, 0x30, 0x0, 0x4,
+    0xdf, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x19, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x2, 0xef,
+    0xf8, 0x0, 0x5f, 0xff, 0x30, 0x0, 0x5, 0xff,
+    0xfd, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b,
+    0xff, 0xe3, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf5,
+    0x0, 0x5f, 0xfe, 0x20, 0x0, 0x6, 0xff, 0xfc,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0xff,
+    0xe0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xd3, 0x0,
+    0x5f, 0xff, 0x20, 0x0, 0x6, 0xff, 0xfc, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xa0,
+    0x0, 0x0, 0x0, 0x3e, 0xff, 0xa1, 0x0, 0x5f,
+    0xff, 0x30, 0x0, 0x6, 0xff, 0xfc, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0x70, 0x0,
+    0x0, 0x1, 0x9f, 0xfe, 0x50, 0x0, 0x4f, 0xff,
+    0x40, 0x0, 0x5, 0xff, 0xfd, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xef, 0xff, 0x40, 0x0, 0x0,
+    0x5, 0xef, 0xfb, 0x0, 0x0, 0x3e, 0xff, 0x60,
+    0x0, 0x4, 0xef, 0xfe, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x2b, 0xff, 0xfe, 0x30, 0x0, 0x0, 0x3d,
+    0xff, 0xe4, 0x0, 0x0, 0x2c, 0xff, 0x90, 0x0,
+    0x1, 0xbf, 0xff, 0x80, 0x0, 0x0, 0x0, 0x1,
+    0x9f, 0xff, 0xfb, 0x20, 0x0, 0x3, 0xbf, 0xff,
+    0x70, 0x0, 0x0, 0x1b, 0xff, 0xc0, 0x0, 0x0,
+    0x7f, 0xff, 0xe4, 0x0, 0x0, 0x0, 0x18, 0xff,
+    0xff, 0xfa, 0x10, 0x0, 0x4d, 0xff, 0xfa, 0x10,
+    0x0, 0x0, 0x8, 0xff, 0xe3, 0x0, 0x0, 0x2d,
+    0xff, 0xfc, 0x41, 0x0, 0x12, 0xbe, 0xff, 0xff,
+    0xfd, 0x31, 0x29, 0xef, 0xff, 0xb2, 0x0, 0x0,
+    0x0, 0x4, 0xef, 0xf8, 0x0, 0x0, 0x6, 0xef,
+    0xff, 0xea, 0x77, 0xae, 0xff, 0xbc, 0xff, 0xff,
+    0xec, 0xef, 0xff, 0xfa, 0x20, 0x0, 0x0, 0x0,
+    0x1, 0xdf, 0xfc, 0x20, 0x0, 0x1, 0x9f, 0xff,
+    0xff, 0xff, 0xff, 0xfb, 0x29, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0xa2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0x80, 0x0, 0x0, 0x7, 0xdf, 0xff,
+    0xff, 0xfd, 0x71, 0x3, 0xdf, 0xff, 0xff, 0xfe,
+    0xc5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3d,
+    0xff, 0xe3, 0x0, 0x0, 0x0, 0x38, 0xdf, 0xfd,
+    0x84, 0x0, 0x0, 0x4a, 0xef, 0xfd, 0xa5, 0x20,
+    0x0, 0x0, 0x37, 0x88, 0x61, 0x0, 0x7, 0xff,
+    0xfc, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xdf, 0xff, 0x60, 0x0, 0x1, 0xcf, 0xff,
+    0xb1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2b,
+    0xff, 0xfb, 0x10, 0x0, 0x0, 0x3d, 0xff, 0xfb,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xcf, 0xff,
+    0xc2, 0x0, 0x0, 0x0, 0x5, 0xef, 0xff, 0xd6,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x7e, 0xff, 0xfd, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x4d, 0xff, 0xfe, 0xc5,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0x5c, 0xff, 0xff, 0xc3, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xbf, 0xff, 0xff, 0xc8,
+    0x52, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x14,
+    0x7c, 0xff, 0xff, 0xfa, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x29, 0xef, 0xff, 0xff, 0xed,
+    0xb9, 0x65, 0x33, 0x23, 0x45, 0x8a, 0xce, 0xff,
+    0xff, 0xfd, 0x71, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x39, 0xef, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0x93, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x38, 0xde, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0x93, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0x79, 0xbc, 0xde, 0xff,
+    0xff, 0xfe, 0xdc, 0xa8, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x12, 0x34, 0x44, 0x44,
+    0x43, 0x32, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+0041 "A" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x44,
+    0x44, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0xff, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
+    0xff, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2c,
+    0xff, 0xff, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0xfd, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xff, 0x6e, 0xff, 0xd1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2e, 0xff, 0xd3, 0xbf, 0xff, 0x60, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xfa, 0x18, 0xff, 0xfb, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xbf, 0xff, 0x60, 0x4e, 0xff, 0xe4, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5e, 0xff, 0xd3, 0x0, 0xcf, 0xff, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9, 0xff, 0xfb, 0x10, 0x7, 0xff, 0xfe,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xef, 0xff, 0x60, 0x0, 0x2e, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xff, 0xe1, 0x0, 0x1, 0xaf,
+    0xff, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1c, 0xff, 0xfa, 0x0, 0x0, 0x6,
+    0xef, 0xfe, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xef, 0xfe, 0x50, 0x0, 0x0,
+    0x2d, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0xc2, 0x0, 0x0,
+    0x0, 0x9f, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2d, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x30, 0x0,
+    0x0, 0x0, 0x1c, 0xff, 0xfc, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0xe5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3d, 0xff, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xdf, 0xff, 0xa0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xfd, 0x52,
+    0x22, 0x22, 0x22, 0x22, 0x3b, 0xff, 0xff, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xbf, 0xff, 0xed,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xef, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xc2, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0x60, 0x0, 0x0, 0x0, 0x2, 0xef, 0xff,
+    0xcb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbe,
+    0xff, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xbf, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x1b, 0xff,
+    0xfb, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0xff, 0x90, 0x0, 0x0, 0x4, 0xef,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1e, 0xff, 0xfd, 0x20, 0x0, 0x0, 0x9f,
+    0xff, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xff, 0xf7, 0x0, 0x0, 0x1e,
+    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xef, 0xff, 0xb1, 0x0, 0x5,
+    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2b, 0xff, 0xff, 0x40, 0x1,
+    0xaf, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xfa, 0x0,
+    0x3d, 0xff, 0xf9, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0xff, 0xd2,
+    0x8, 0xff, 0xfe, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
+    0x70, 0xdf, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
+    0xfb, 0x20,
+
+    /* U+0042 "B" */
+    0x24, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x43,
+    0x31, 0x0, 0x0, 0x0, 0x0, 0x8, 0xef, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xee, 0xed, 0xb9, 0x41,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0xb3, 0x0, 0x0,
+    0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xd5, 0x0, 0x0, 0x8f, 0xff,
+    0xfd, 0xcc, 0xcc, 0xcc, 0xcc, 0xdd, 0xef, 0xff,
+    0xff, 0xd2, 0x0, 0x8, 0xff, 0xfe, 0x30, 0x0,
+    0x0, 0x0, 0x1, 0x24, 0x7c, 0xff, 0xff, 0xa1,
+    0x0, 0x8f, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2d, 0xff, 0xfe, 0x40, 0x8, 0xff,
+    0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5e, 0xff, 0xf7, 0x0, 0x8f, 0xff, 0xe3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xff,
+    0xa1, 0x8, 0xff, 0xfe, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0xff, 0xfb, 0x10, 0x8f,
+    0xff, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0xff, 0xa1, 0x8, 0xff, 0xfe, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2c, 0xff,
+    0xf7, 0x0, 0x8f, 0xff, 0xe3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xef, 0xfe, 0x40, 0x8,
+    0xff, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xdf, 0xff, 0x90, 0x0, 0x8f, 0xff, 0xe3,
+    0x0, 0x0, 0x0, 0x0, 0x12, 0x48, 0xdf, 0xff,
+    0xc2, 0x0, 0x8, 0xff, 0xff, 0xed, 0xdd, 0xdd,
+    0xdd, 0xdd, 0xee, 0xff, 0xff, 0xb3, 0x0, 0x0,
+    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xa1, 0x0, 0x0, 0x8, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0x93, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x10,
+    0x8, 0xff, 0xfe, 0x53, 0x33, 0x33, 0x33, 0x33,
+    0x46, 0x9d, 0xff, 0xff, 0xe6, 0x0, 0x8f, 0xff,
+    0xe3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x17,
+    0xef, 0xff, 0xe3, 0x8, 0xff, 0xfe, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x17, 0xff, 0xff,
+    0xa0, 0x8f, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xc, 0xff, 0xfd, 0x38, 0xff,
+    0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xe5, 0x8f, 0xff, 0xe3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0xff, 0x78, 0xff, 0xfe, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf7, 0x8f,
+    0xff, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xfe, 0x68, 0xff, 0xfe, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
+    0xff, 0xe4, 0x8f, 0xff, 0xe3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xfc, 0x18,
+    0xff, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6d, 0xff, 0xff, 0x70, 0x8f, 0xff, 0xe4,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x36, 0xbe, 0xff,
+    0xff, 0xc2, 0x8, 0xff, 0xff, 0xfe, 0xee, 0xee,
+    0xee, 0xee, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x0,
+    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xd4, 0x0, 0x8, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
+    0x82, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xdb, 0x95, 0x30, 0x0, 0x0,
+    0x0,
+
+    /* U+0043 "C" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x47, 0x9a,
+    0xba, 0x97, 0x43, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x49, 0xcf, 0xff, 0xff,
+    0xff, 0xff, 0xd9, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xbe, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0x82, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x17, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xc3, 0x0, 0x0, 0x0, 0x0,
+    0x19, 0xff, 0xff, 0xfe, 0xb7, 0x43, 0x23, 0x58,
+    0xde, 0xff, 0xff, 0xc3, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0xff, 0xea, 0x30, 0x0, 0x0, 0x0, 0x1,
+    0x6d, 0xff, 0xff, 0xb1, 0x0, 0x0, 0x6, 0xef,
+    0xff, 0xe6, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4c, 0xff, 0xff, 0x70, 0x0, 0x3, 0xdf, 0xff,
+    0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4e, 0xff, 0xfe, 0x30, 0x0, 0x9f, 0xff, 0xf8,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xff, 0xf8, 0x0, 0x2e, 0xff, 0xfc, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xdf, 0xff, 0xc2, 0x7, 0xff, 0xff, 0x60, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xfd, 0xa5, 0x11, 0xaf, 0xff, 0xd2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x11,
+    0x0, 0x0, 0x3d, 0xff, 0xfa, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0xe6, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
+    0xff, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
+    0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
+    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x10, 0x0, 0x2, 0xcf, 0xff, 0xa1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0x95, 0x10, 0x9, 0xff, 0xfe, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xef, 0xff, 0x80, 0x5e, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xff, 0xf5, 0x1, 0xdf, 0xff, 0xd1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2c,
+    0xff, 0xfd, 0x20, 0x8, 0xff, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0xff, 0x91, 0x0, 0x2d, 0xff, 0xfe, 0x60, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xef, 0xff,
+    0xd3, 0x0, 0x0, 0x6e, 0xff, 0xfe, 0x61, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6, 0xdf, 0xff, 0xf7,
+    0x0, 0x0, 0x1, 0xaf, 0xff, 0xfe, 0xb3, 0x10,
+    0x0, 0x0, 0x1, 0x39, 0xef, 0xff, 0xfb, 0x10,
+    0x0, 0x0, 0x1, 0xaf, 0xff, 0xff, 0xfc, 0x86,
+    0x54, 0x57, 0x9e, 0xff, 0xff, 0xfb, 0x20, 0x0,
+    0x0, 0x0, 0x2, 0x9f, 0xff, 0xff, 0xff, 0xfe,
+    0xee, 0xff, 0xff, 0xff, 0xfb, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7c, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xd7, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x27, 0xcf, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0x84, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x15, 0x79, 0xaa, 0xa9,
+    0x73, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+0044 "D" */
+    0x14, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x43,
+    0x32, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5e,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xee, 0xdc,
+    0xa7, 0x30, 0x0, 0x0, 0x0, 0x0, 0x5e, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xea, 0x40, 0x0, 0x0, 0x0, 0x5e, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xe6, 0x0, 0x0, 0x0, 0x5e, 0xff, 0xfd, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xdd, 0xde, 0xff, 0xff, 0xfe,
+    0x71, 0x0, 0x0, 0x5e, 0xff, 0xf3, 0x0, 0x0,
+    0x0, 0x0, 0x11, 0x36, 0x9e, 0xff, 0xff, 0xf6,
+    0x0, 0x0, 0x5e, 0xff, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x14, 0xbf, 0xff, 0xfd, 0x40,
+    0x0, 0x5e, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1b, 0xff, 0xff, 0xb1, 0x0,
+    0x5e, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xcf, 0xff, 0xf4, 0x0, 0x5e,
+    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5f, 0xff, 0xfb, 0x0, 0x5e, 0xff,
+    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1c, 0xff, 0xfd, 0x20, 0x5e, 0xff, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0xfe, 0x60, 0x5e, 0xff, 0xf3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xef, 0xff, 0x80, 0x5e, 0xff, 0xf3, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xcf,
+    0xff, 0xb1, 0x5e, 0xff, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xbf, 0xff,
+    0xc2, 0x5e, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x9f, 0xff, 0xd2,
+    0x5e, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xd3, 0x5e,
+    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9f, 0xff, 0xe3, 0x5e, 0xff,
+    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xff, 0xe3, 0x5e, 0xff, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0xff, 0xd3, 0x5e, 0xff, 0xf3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xaf, 0xff, 0xc2, 0x5e, 0xff, 0xf3, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xbf,
+    0xff, 0xb1, 0x5e, 0xff, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xdf, 0xff,
+    0xa1, 0x5e, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0x80,
+    0x5e, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0xfe, 0x40, 0x5e,
+    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1d, 0xff, 0xfd, 0x10, 0x5e, 0xff,
+    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xf7, 0x0, 0x5e, 0xff, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xdf, 0xff, 0xe3, 0x0, 0x5e, 0xff, 0xf3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xff,
+    0xff, 0x80, 0x0, 0x5e, 0xff, 0xf3, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x16, 0xdf, 0xff, 0xfc,
+    0x20, 0x0, 0x5e, 0xff, 0xf5, 0x22, 0x22, 0x22,
+    0x22, 0x23, 0x59, 0xce, 0xff, 0xff, 0xe4, 0x0,
+    0x0, 0x5e, 0xff, 0xff, 0xee, 0xee, 0xee, 0xee,
+    0xff, 0xff, 0xff, 0xff, 0xfd, 0x40, 0x0, 0x0,
+    0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xc3, 0x0, 0x0, 0x0, 0x5e,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0xb6, 0x10, 0x0, 0x0, 0x0, 0x5e, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xc9, 0x74,
+    0x20, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+0045 "E" */
+    0x14, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x42, 0x4, 0xef, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x90, 0x4e, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
+    0x4, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x4e, 0xff,
+    0xfd, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xc8, 0x4, 0xef, 0xff, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xef,
+    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4e, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xef, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e,
+    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xef, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4e, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xef, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xff, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xef, 0xff, 0xdc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xc5, 0x0,
+    0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x60, 0x4, 0xef, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf6, 0x0, 0x4e, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
+    0x4, 0xef, 0xff, 0x73, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x31, 0x0, 0x4e, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xef, 0xff, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xef,
+    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4e, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xef, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e,
+    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xef, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4e, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xef, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xff, 0xf6,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x14, 0xef, 0xff, 0xfe, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe7,
+    0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x74, 0xef, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf7, 0x4e, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x70,
+
+    /* U+0046 "F" */
+    0x14, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x12, 0xef, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xd3, 0x2e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfd, 0x32, 0xef, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xd3, 0x2e, 0xff, 0xfd, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xca, 0x32, 0xef,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2e, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xef, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xef, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xef, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xef, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xef, 0xff, 0xed, 0xdd,
+    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0x80, 0x0,
+    0x2e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfa, 0x0, 0x2, 0xef, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0,
+    0x0, 0x2e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfa, 0x0, 0x2, 0xef, 0xff,
+    0x93, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x20, 0x0, 0x2e, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2e, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xef, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xef, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xef, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xef, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xef, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2e, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x29, 0xaa, 0xa5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+0047 "G" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x35, 0x79,
+    0xab, 0xba, 0x86, 0x32, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x17, 0xbd, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0xb7, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0x7e, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x71, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xbf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb2,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xdf, 0xff, 0xff,
+    0xdb, 0x74, 0x22, 0x24, 0x7b, 0xdf, 0xff, 0xff,
+    0xb1, 0x0, 0x0, 0x0, 0x4, 0xef, 0xff, 0xfd,
+    0x73, 0x0, 0x0, 0x0, 0x0, 0x3, 0x8e, 0xff,
+    0xff, 0x91, 0x0, 0x0, 0x2, 0xcf, 0xff, 0xfb,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x5d,
+    0xff, 0xfe, 0x40, 0x0, 0x1, 0x9f, 0xff, 0xfb,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4e, 0xff, 0xfb, 0x0, 0x0, 0x3e, 0xff, 0xfd,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0xff, 0xe3, 0x0, 0xa, 0xff, 0xfe,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xdf, 0xff, 0x80, 0x2, 0xdf, 0xff,
+    0xc1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1a, 0xff, 0xe7, 0x0, 0x7f, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x46, 0x20, 0x0, 0x1a, 0xff,
+    0xfd, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xcf,
+    0xff, 0xa1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3e,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5f, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0xfe, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x21, 0x6f, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x55, 0xff, 0xfe, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf5, 0x4f, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x53, 0xef, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3d, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xef, 0xff, 0xf5, 0x2c, 0xff, 0xfa, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xdf, 0xff, 0x51, 0xaf, 0xff, 0xd2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3d, 0xff, 0xf5, 0x7, 0xff, 0xff, 0x60,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xdf, 0xff, 0x50, 0x3e, 0xff, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3d, 0xff, 0xf5, 0x0, 0xaf, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xdf, 0xff, 0x50, 0x4, 0xef,
+    0xff, 0xd4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3d, 0xff, 0xf5, 0x0, 0x18,
+    0xff, 0xff, 0xd3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x29, 0xff, 0xff, 0x50, 0x0,
+    0x2b, 0xff, 0xff, 0xd7, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x6c, 0xff, 0xff, 0xf5, 0x0,
+    0x0, 0x3d, 0xff, 0xff, 0xfc, 0x72, 0x10, 0x0,
+    0x0, 0x11, 0x27, 0xce, 0xff, 0xff, 0xfc, 0x30,
+    0x0, 0x0, 0x3b, 0xff, 0xff, 0xff, 0xeb, 0x97,
+    0x66, 0x79, 0xcf, 0xff, 0xff, 0xff, 0xea, 0x20,
+    0x0, 0x0, 0x0, 0x2a, 0xef, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xbe, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x71, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x49, 0xef,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0xa5, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x25, 0x89, 0xaa, 0xa8, 0x63, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+0048 "H" */
+    0x14, 0x44, 0x42, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0x44, 0x43, 0x3e, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xfc, 0x3e, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xfc, 0x3e, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfc,
+    0x3e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xfc, 0x3e, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xfc, 0x3e, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xfc, 0x3e, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfc,
+    0x3e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xfc, 0x3e, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xfc, 0x3e, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xfc, 0x3e, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfc,
+    0x3e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xfc, 0x3e, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xfc, 0x3e, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xfc, 0x3e, 0xff, 0xfe, 0xdd, 0xdd, 0xdd,
+    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xff, 0xfc,
+    0x3e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3e, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfc, 0x3e, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfc, 0x3e, 0xff, 0xf7, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x3c, 0xff, 0xfc,
+    0x3e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xfc, 0x3e, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xfc, 0x3e, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xfc, 0x3e, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfc,
+    0x3e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xfc, 0x3e, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xfc, 0x3e, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xfc, 0x3e, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfc,
+    0x3e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xfc, 0x3e, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xfc, 0x3e, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xfc, 0x3e, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfc,
+    0x3e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xfc, 0x3e, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xfc, 0x3e, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xfc,
+
+    /* U+0049 "I" */
+    0x24, 0x44, 0x40, 0x8f, 0xff, 0xe1, 0x8f, 0xff,
+    0xe1, 0x8f, 0xff, 0xe1, 0x8f, 0xff, 0xe1, 0x8f,
+    0xff, 0xe1, 0x8f, 0xff, 0xe1, 0x8f, 0xff, 0xe1,
+    0x8f, 0xff, 0xe1, 0x8f, 0xff, 0xe1, 0x8f, 0xff,
+    0xe1, 0x8f, 0xff, 0xe1, 0x8f, 0xff, 0xe1, 0x8f,
+    0xff, 0xe1, 0x8f, 0xff, 0xe1, 0x8f, 0xff, 0xe1,
+    0x8f, 0xff, 0xe1, 0x8f, 0xff, 0xe1, 0x8f, 0xff,
+    0xe1, 0x8f, 0xff, 0xe1, 0x8f, 0xff, 0xe1, 0x8f,
+    0xff, 0xe1, 0x8f, 0xff, 0xe1, 0x8f, 0xff, 0xe1,
+    0x8f, 0xff, 0xe1, 0x8f, 0xff, 0xe1, 0x8f, 0xff,
+    0xe1, 0x8f, 0xff, 0xe1, 0x8f, 0xff, 0xe1, 0x8f,
+    0xff, 0xe1, 0x8f, 0xff, 0xe1, 0x8f, 0xff, 0xe1,
+    0x8f, 0xff, 0xe1, 0x8f, 0xff, 0xe1, 0x8f, 0xff,
+    0xe1,
+
+    /* U+004A "J" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x14,
+    0x44, 0x41, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xff, 0xe5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xe5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xff, 0xe5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xe5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xff, 0xe5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xe5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xff, 0xe5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xe5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xff, 0xe5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xe5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xff, 0xe5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xe5,
+    0x1, 0x23, 0x20, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xff, 0xe5, 0x6b, 0xcd, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xff, 0xe4, 0x9f, 0xff, 0x91, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xff, 0xe3, 0x8f, 0xff,
+    0xb1, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xe2,
+    0x6f, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xff, 0xd0, 0x3e, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x3, 0xef, 0xff, 0xa0, 0xc, 0xff, 0xfe, 0x51,
+    0x0, 0x1, 0x4c, 0xff, 0xff, 0x50, 0x6, 0xff,
+    0xff, 0xfb, 0x76, 0x79, 0xef, 0xff, 0xfb, 0x20,
+    0x1, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xd4, 0x0, 0x0, 0x1a, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfd, 0x50, 0x0, 0x0, 0x2, 0x7e, 0xff,
+    0xff, 0xff, 0xff, 0x93, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x48, 0x9a, 0xa8, 0x51, 0x0, 0x0, 0x0,
+
+    /* U+004B "K" */
+    0x24, 0x44, 0x41, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x44, 0x44, 0x44, 0x8, 0xff,
+    0xfd, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9e, 0xff, 0xff, 0x81, 0x8f, 0xff, 0xe3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x9f,
+    0xff, 0xfe, 0x71, 0x8, 0xff, 0xfe, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
+    0x70, 0x0, 0x8f, 0xff, 0xe3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x9f, 0xff, 0xfe, 0x61, 0x0,
+    0x8, 0xff, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x9f, 0xff, 0xfe, 0x60, 0x0, 0x0, 0x8f,
+    0xff, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x1, 0x9f,
+    0xff, 0xfe, 0x60, 0x0, 0x0, 0x8, 0xff, 0xfe,
+    0x30, 0x0, 0x0, 0x0, 0x1, 0x9f, 0xff, 0xfe,
+    0x50, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xe3, 0x0,
+    0x0, 0x0, 0x0, 0x9f, 0xff, 0xfd, 0x60, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xfe, 0x30, 0x0, 0x0,
+    0x1, 0x9f, 0xff, 0xfd, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x9f,
+    0xff, 0xfd, 0x50, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0xfe, 0x30, 0x0, 0x1, 0xaf, 0xff, 0xfc,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
+    0xe3, 0x0, 0x0, 0x9f, 0xff, 0xfd, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xfe, 0x30,
+    0x1, 0x9f, 0xff, 0xfc, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0xe3, 0x1, 0x9f,
+    0xff, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0xfe, 0x31, 0xaf, 0xff, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xff, 0xe4, 0xaf, 0xff, 0xff, 0xff, 0xe5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0xfe, 0xcf, 0xff, 0xfd, 0xff, 0xff, 0xc3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
+    0xff, 0xfb, 0x2a, 0xff, 0xff, 0xa1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xfa,
+    0x20, 0x2d, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0xff, 0xfb, 0x10, 0x0,
+    0x5e, 0xff, 0xfe, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xff, 0xfb, 0x20, 0x0, 0x1, 0x9f,
+    0xff, 0xfc, 0x10, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xff, 0xfa, 0x10, 0x0, 0x0, 0x1, 0xcf, 0xff,
+    0xfa, 0x10, 0x0, 0x0, 0x0, 0x8, 0xff, 0xfe,
+    0x30, 0x0, 0x0, 0x0, 0x4, 0xef, 0xff, 0xe6,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xe3, 0x0,
+    0x0, 0x0, 0x0, 0x7, 0xef, 0xff, 0xf3, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xfe, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x1b, 0xff, 0xff, 0xb2, 0x0, 0x0,
+    0x0, 0x8f, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2d, 0xff, 0xff, 0xa1, 0x0, 0x0, 0x8,
+    0xff, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6e, 0xff, 0xff, 0x60, 0x0, 0x0, 0x8f, 0xff,
+    0xe3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x9f,
+    0xff, 0xfd, 0x40, 0x0, 0x8, 0xff, 0xfe, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xdf, 0xff,
+    0xfb, 0x10, 0x0, 0x8f, 0xff, 0xe3, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xef, 0xff, 0xf8,
+    0x0, 0x8, 0xff, 0xfe, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xe6, 0x0,
+    0x8f, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1c, 0xff, 0xff, 0xd3, 0x8, 0xff,
+    0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4d, 0xff, 0xff, 0xb1, 0x8f, 0xff, 0xe3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xff, 0x80,
+
+    /* U+004C "L" */
+    0x24, 0x44, 0x41, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0xfe, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xff, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xfe, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
+    0xe3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0xfe, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xe3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xe3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0xe3, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0xe3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xfe,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xfe, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0xfe, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xff, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xfe, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
+    0xe3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0xfe, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xe3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xe3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0xe3, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0xe3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xfe,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xff, 0xe4, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x21, 0x8, 0xff, 0xff, 0xfe,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xc2,
+    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfc, 0x38, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0x8f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfc, 0x30,
+
+    /* U+004D "M" */
+    0x24, 0x44, 0x44, 0x42, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x44, 0x44,
+    0x41, 0x7f, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xff,
+    0xff, 0xf5, 0x7f, 0xff, 0xff, 0xfe, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
+    0xff, 0xff, 0xf5, 0x7f, 0xff, 0xff, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xaf, 0xff, 0xff, 0xf5, 0x7f, 0xff, 0xff, 0xff,
+    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xdf, 0xff, 0xff, 0xf5, 0x7f, 0xff, 0xff,
+    0xff, 0xc3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xff, 0xff, 0xff, 0xf5, 0x7f, 0xff,
+    0xde, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xb, 0xff, 0xef, 0xff, 0xf5, 0x7f,
+    0xff, 0xc9, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3e, 0xff, 0xbd, 0xff, 0xf5,
+    0x7f, 0xff, 0xc5, 0xff, 0xfe, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xfe, 0x7d, 0xff,
+    0xf5, 0x7f, 0xff, 0xc3, 0xbf, 0xff, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xbf, 0xfc, 0x3d,
+    0xff, 0xf5, 0x7f, 0xff, 0xc2, 0x7f, 0xff, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xef, 0xf8,
+    0x3d, 0xff, 0xf5, 0x7f, 0xff, 0xc2, 0x3d, 0xff,
+    0xd3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xe3, 0x3d, 0xff, 0xf5, 0x7f, 0xff, 0xc2, 0x1b,
+    0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0xff, 0xb1, 0x3d, 0xff, 0xf5, 0x7f, 0xff, 0xc2,
+    0x7, 0xff, 0xfa, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x3e, 0xff, 0x70, 0x3d, 0xff, 0xf5, 0x7f, 0xff,
+    0xc2, 0x2, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xfd, 0x30, 0x3d, 0xff, 0xf5, 0x7f,
+    0xff, 0xc2, 0x0, 0xbf, 0xff, 0x50, 0x0, 0x0,
+    0x0, 0x1, 0xbf, 0xfb, 0x0, 0x3d, 0xff, 0xf5,
+    0x7f, 0xff, 0xc2, 0x0, 0x6f, 0xff, 0xa0, 0x0,
+    0x0, 0x0, 0x4, 0xef, 0xf6, 0x0, 0x3d, 0xff,
+    0xf5, 0x7f, 0xff, 0xc2, 0x0, 0x3d, 0xff, 0xd2,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0xe2, 0x0, 0x3d,
+    0xff, 0xf5, 0x7f, 0xff, 0xc2, 0x0, 0x1a, 0xff,
+    0xf6, 0x0, 0x0, 0x0, 0xe, 0xff, 0xa1, 0x0,
+    0x3d, 0xff, 0xf5, 0x7f, 0xff, 0xc2, 0x0, 0x6,
+    0xff, 0xf9, 0x10, 0x0, 0x0, 0x4f, 0xff, 0x60,
+    0x0, 0x3d, 0xff, 0xf5, 0x7f, 0xff, 0xc2, 0x0,
+    0x1, 0xef, 0xfe, 0x20, 0x0, 0x0, 0x9f, 0xfd,
+    0x30, 0x0, 0x3d, 0xff, 0xf5, 0x7f, 0xff, 0xc2,
+    0x0, 0x0, 0xbf, 0xff, 0x50, 0x0, 0x2, 0xcf,
+    0xfa, 0x0, 0x0, 0x3d, 0xff, 0xf5, 0x7f, 0xff,
+    0xc2, 0x0, 0x0, 0x6f, 0xff, 0xb0, 0x0, 0x5,
+    0xef, 0xf5, 0x0, 0x0, 0x3d, 0xff, 0xf5, 0x7f,
+    0xff, 0xc2, 0x0, 0x0, 0x3d, 0xff, 0xd2, 0x0,
+    0x9, 0xff, 0xe1, 0x0, 0x0, 0x3d, 0xff, 0xf5,
+    0x7f, 0xff, 0xc2, 0x0, 0x0, 0x1a, 0xff, 0xe6,
+    0x0, 0x1e, 0xff, 0x90, 0x0, 0x0, 0x3d, 0xff,
+    0xf5, 0x7f, 0xff, 0xc2, 0x0, 0x0, 0x6, 0xff,
+    0xfa, 0x10, 0x4f, 0xfe, 0x50, 0x0, 0x0, 0x3d,
+    0xff, 0xf5, 0x7f, 0xff, 0xc2, 0x0, 0x0, 0x1,
+    0xef, 0xfd, 0x20, 0xaf, 0xfc, 0x20, 0x0, 0x0,
+    0x3d, 0xff, 0xf5, 0x7f, 0xff, 0xc2, 0x0, 0x0,
+    0x0, 0xaf, 0xff, 0x52, 0xcf, 0xf9, 0x0, 0x0,
+    0x0, 0x3d, 0xff, 0xf5, 0x7f, 0xff, 0xc2, 0x0,
+    0x0, 0x0, 0x5f, 0xff, 0xa6, 0xef, 0xf3, 0x0,
+    0x0, 0x0, 0x3d, 0xff, 0xf5, 0x7f, 0xff, 0xc2,
+    0x0, 0x0, 0x0, 0x2d, 0xff, 0xeb, 0xff, 0xd0,
+    0x0, 0x0, 0x0, 0x3d, 0xff, 0xf5, 0x7f, 0xff,
+    0xc2, 0x0, 0x0, 0x0, 0x19, 0xff, 0xff, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x3d, 0xff, 0xf5, 0x7f,
+    0xff, 0xc2, 0x0, 0x0, 0x0, 0x5, 0xef, 0xff,
+    0xfe, 0x40, 0x0, 0x0, 0x0, 0x3d, 0xff, 0xf5,
+    0x7f, 0xff, 0xc2, 0x0, 0x0, 0x0, 0x1, 0xdf,
+    0xff, 0xfb, 0x20, 0x0, 0x0, 0x0, 0x3d, 0xff,
+    0xf5, 0x7f, 0xff, 0xc2, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x3d,
+    0xff, 0xf5, 0x7f, 0xff, 0xc2, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x0,
+    0x3d, 0xff, 0xf5,
+
+    /* U+004E "N" */
+    0x24, 0x44, 0x42, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0x44, 0x43, 0x6e, 0xff,
+    0xfb, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9, 0xff, 0xfb, 0x6e, 0xff, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xfb, 0x6e, 0xff, 0xff, 0xe4, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xfb,
+    0x6e, 0xff, 0xff, 0xfc, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0xfb, 0x6e, 0xff,
+    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9, 0xff, 0xfb, 0x6e, 0xff, 0xff, 0xff,
+    0xd4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xfb, 0x6e, 0xff, 0xff, 0xff, 0xfc, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xfb,
+    0x6e, 0xff, 0xec, 0xff, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0xfb, 0x6e, 0xff,
+    0xd4, 0xdf, 0xff, 0xe4, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9, 0xff, 0xfb, 0x6e, 0xff, 0xd3, 0x6e,
+    0xff, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xfb, 0x6e, 0xff, 0xd3, 0x19, 0xff, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xfb,
+    0x6e, 0xff, 0xd3, 0x2, 0xef, 0xff, 0xe4, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0xfb, 0x6e, 0xff,
+    0xd3, 0x0, 0x6e, 0xff, 0xfc, 0x20, 0x0, 0x0,
+    0x0, 0x9, 0xff, 0xfb, 0x6e, 0xff, 0xd3, 0x0,
+    0x1a, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xfb, 0x6e, 0xff, 0xd3, 0x0, 0x2, 0xef,
+    0xff, 0xe5, 0x0, 0x0, 0x0, 0x9, 0xff, 0xfb,
+    0x6e, 0xff, 0xd3, 0x0, 0x0, 0x6e, 0xff, 0xfc,
+    0x20, 0x0, 0x0, 0x9, 0xff, 0xfb, 0x6e, 0xff,
+    0xd3, 0x0, 0x0, 0x1a, 0xff, 0xff, 0x80, 0x0,
+    0x0, 0x9, 0xff, 0xfb, 0x6e, 0xff, 0xd3, 0x0,
+    0x0, 0x2, 0xdf, 0xff, 0xe4, 0x0, 0x0, 0x9,
+    0xff, 0xfb, 0x6e, 0xff, 0xd3, 0x0, 0x0, 0x0,
+    0x6f, 0xff, 0xfb, 0x20, 0x0, 0x9, 0xff, 0xfb,
+    0x6e, 0xff, 0xd3, 0x0, 0x0, 0x0, 0x19, 0xff,
+    0xff, 0x90, 0x0, 0x9, 0xff, 0xfb, 0x6e, 0xff,
+    0xd3, 0x0, 0x0, 0x0, 0x2, 0xdf, 0xff, 0xe4,
+    0x0, 0x9, 0xff, 0xfb, 0x6e, 0xff, 0xd3, 0x0,
+    0x0, 0x0, 0x0, 0x5e, 0xff, 0xfc, 0x20, 0x9,
+    0xff, 0xfb, 0x6e, 0xff, 0xd3, 0x0, 0x0, 0x0,
+    0x0, 0x1a, 0xff, 0xff, 0x90, 0x9, 0xff, 0xfb,
+    0x6e, 0xff, 0xd3, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xcf, 0xff, 0xf4, 0x9, 0xff, 0xfb, 0x6e, 0xff,
+    0xd3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
+    0xfb, 0x29, 0xff, 0xfb, 0x6e, 0xff, 0xd3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x19, 0xff, 0xff, 0x9a,
+    0xff, 0xfb, 0x6e, 0xff, 0xd3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xcf, 0xff, 0xfd, 0xff, 0xfb,
+    0x6e, 0xff, 0xd3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5f, 0xff, 0xff, 0xff, 0xfb, 0x6e, 0xff,
+    0xd3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xff, 0xff, 0xfb, 0x6e, 0xff, 0xd3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xff,
+    0xff, 0xfb, 0x6e, 0xff, 0xd3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xfb,
+    0x6e, 0xff, 0xd3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0xff, 0xfb, 0x6e, 0xff,
+    0xd3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xcf, 0xff, 0xfb, 0x6e, 0xff, 0xd3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
+    0xff, 0xfb,
+
+    /* U+004F "O" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x47, 0x9a,
+    0xbb, 0x98, 0x53, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x9d, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0xa7, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xae, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6d, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0xef,
+    0xff, 0xfe, 0xd9, 0x53, 0x23, 0x47, 0xbd, 0xff,
+    0xff, 0xfb, 0x30, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0xff, 0xc6, 0x10, 0x0, 0x0, 0x0, 0x3,
+    0xae, 0xff, 0xff, 0xc2, 0x0, 0x0, 0x0, 0x5,
+    0xef, 0xff, 0xf9, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x15, 0xef, 0xff, 0xfa, 0x10, 0x0, 0x0,
+    0x2c, 0xff, 0xfe, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4d, 0xff, 0xff, 0x60, 0x0,
+    0x0, 0x7f, 0xff, 0xf9, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xef, 0xff, 0xd1,
+    0x0, 0x2, 0xef, 0xff, 0xd1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
+    0xf7, 0x0, 0x6, 0xff, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3d,
+    0xff, 0xfb, 0x10, 0x1a, 0xff, 0xfd, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x19, 0xff, 0xfe, 0x40, 0x2d, 0xff, 0xfa, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xef, 0xff, 0x70, 0x4f, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xdf, 0xff, 0xb0, 0x6f, 0xff,
+    0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xe0, 0x7f,
+    0xff, 0xe4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf1,
+    0x9f, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
+    0xf2, 0xaf, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xff, 0xf3, 0xaf, 0xff, 0xd2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xff, 0xf2, 0x9f, 0xff, 0xd2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xff, 0xf1, 0x8f, 0xff, 0xe3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xaf, 0xff, 0xf0, 0x6f, 0xff, 0xe5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xcf, 0xff, 0xe0, 0x4f, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xdf, 0xff, 0xa0, 0x2d,
+    0xff, 0xf9, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xef, 0xff, 0x70,
+    0x19, 0xff, 0xfd, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xfe,
+    0x40, 0x6, 0xef, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xff,
+    0xfb, 0x20, 0x1, 0xdf, 0xff, 0xe2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
+    0xff, 0xf6, 0x0, 0x0, 0x6f, 0xff, 0xfa, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xef, 0xff, 0xd1, 0x0, 0x0, 0x1b, 0xff, 0xff,
+    0x91, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4d, 0xff, 0xff, 0x60, 0x0, 0x0, 0x3, 0xdf,
+    0xff, 0xf9, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x15, 0xef, 0xff, 0xf9, 0x10, 0x0, 0x0, 0x0,
+    0x6e, 0xff, 0xff, 0xd5, 0x10, 0x0, 0x0, 0x0,
+    0x13, 0xae, 0xff, 0xff, 0xc2, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xef, 0xff, 0xff, 0xd8, 0x65, 0x55,
+    0x67, 0xbe, 0xff, 0xff, 0xfb, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4d, 0xff, 0xff, 0xff, 0xfe,
+    0xee, 0xef, 0xff, 0xff, 0xff, 0xa2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0x8d, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x8d,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xa5, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x26, 0x8a, 0xaa, 0x97, 0x41, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+0050 "P" */
+    0x14, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x33, 0x21, 0x0, 0x0, 0x0, 0x0, 0x5e, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xed, 0xca,
+    0x82, 0x0, 0x0, 0x0, 0x5e, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xa2,
+    0x0, 0x0, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x30, 0x0,
+    0x5e, 0xff, 0xfd, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xdd, 0xef, 0xff, 0xff, 0xc2, 0x0, 0x5e, 0xff,
+    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x12, 0x4a,
+    0xef, 0xff, 0xf8, 0x0, 0x5e, 0xff, 0xf3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x7f, 0xff,
+    0xfd, 0x30, 0x5e, 0xff, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0x70,
+    0x5e, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xef, 0xff, 0x91, 0x5e, 0xff,
+    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xcf, 0xff, 0xb1, 0x5e, 0xff, 0xf3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xbf,
+    0xff, 0xc2, 0x5e, 0xff, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xbf, 0xff, 0xc1,
+    0x5e, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xcf, 0xff, 0xb1, 0x5e, 0xff,
+    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xef, 0xff, 0x90, 0x5e, 0xff, 0xf3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
+    0xfe, 0x60, 0x5e, 0xff, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x8f, 0xff, 0xfc, 0x20,
+    0x5e, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x13, 0x7b, 0xff, 0xff, 0xf6, 0x0, 0x5e, 0xff,
+    0xfc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xde, 0xff,
+    0xff, 0xff, 0xa1, 0x0, 0x5e, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
+    0x20, 0x0, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfd, 0x82, 0x0, 0x0,
+    0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xed, 0xca, 0x72, 0x0, 0x0, 0x0, 0x5e, 0xff,
+    0xf7, 0x44, 0x44, 0x44, 0x44, 0x44, 0x43, 0x21,
+    0x0, 0x0, 0x0, 0x0, 0x5e, 0xff, 0xf3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5e, 0xff, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5e, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5e, 0xff,
+    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5e, 0xff, 0xf3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5e, 0xff, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5e, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5e, 0xff,
+    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5e, 0xff, 0xf3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5e, 0xff, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5e, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5e, 0xff,
+    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5e, 0xff, 0xf3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x25, 0x55, 0x51, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+0051 "Q" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x13, 0x57, 0x9a,
+    0xbb, 0x97, 0x53, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xad, 0xff,
+    0xff, 0xff, 0xff, 0xfd, 0x95, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x15, 0xcf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xb4, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x8e, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0x71, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2a, 0xff,
+    0xff, 0xfe, 0xc7, 0x43, 0x23, 0x58, 0xce, 0xff,
+    0xff, 0xf9, 0x10, 0x0, 0x0, 0x0, 0x1, 0xaf,
+    0xff, 0xff, 0xa4, 0x0, 0x0, 0x0, 0x0, 0x15,
+    0xbf, 0xff, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x7,
+    0xef, 0xff, 0xe6, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x17, 0xef, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x4e, 0xff, 0xfd, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6e, 0xff, 0xfe, 0x40, 0x0,
+    0x0, 0xaf, 0xff, 0xe6, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x18, 0xff, 0xff, 0xa0,
+    0x0, 0x4, 0xef, 0xff, 0xa0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xff,
+    0xe4, 0x0, 0x8, 0xff, 0xfe, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
+    0xff, 0xf9, 0x0, 0x2c, 0xff, 0xfa, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1b, 0xff, 0xfc, 0x20, 0x4f, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0xfe, 0x40, 0x7f, 0xff, 0xe4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xef, 0xff, 0x70, 0xaf, 0xff,
+    0xd2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xdf, 0xff, 0xa0, 0xcf,
+    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xff, 0xc0,
+    0xdf, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
+    0xd0, 0xef, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
+    0xff, 0xe0, 0xef, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xcf, 0xff, 0xe0, 0xdf, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xcf, 0xff, 0xd0, 0xcf, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xdf, 0xff, 0xc0, 0xaf, 0xff, 0xd2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xdf, 0xff, 0xa0, 0x7f, 0xff,
+    0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xef, 0xff, 0x70, 0x4e,
+    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0x50,
+    0x2c, 0xff, 0xfb, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2b, 0xff, 0xfc,
+    0x20, 0x9, 0xff, 0xfe, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0x20, 0x0, 0x0, 0x0, 0x4e, 0xff,
+    0xf9, 0x0, 0x3, 0xef, 0xff, 0xb1, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xeb, 0x52, 0x0, 0x1, 0xcf,
+    0xff, 0xe4, 0x0, 0x0, 0xaf, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x1c, 0xff, 0xfc, 0x51, 0x7,
+    0xff, 0xff, 0xb0, 0x0, 0x0, 0x3d, 0xff, 0xfe,
+    0x60, 0x0, 0x0, 0x0, 0x4d, 0xff, 0xff, 0xe9,
+    0x7e, 0xff, 0xfd, 0x30, 0x0, 0x0, 0x6, 0xef,
+    0xff, 0xe7, 0x10, 0x0, 0x0, 0x14, 0x8d, 0xff,
+    0xff, 0xff, 0xff, 0xe7, 0x0, 0x0, 0x0, 0x1,
+    0x9f, 0xff, 0xfe, 0xb4, 0x10, 0x0, 0x0, 0x2,
+    0x9f, 0xff, 0xff, 0xff, 0x91, 0x0, 0x0, 0x0,
+    0x0, 0x18, 0xef, 0xff, 0xff, 0xc8, 0x65, 0x45,
+    0x68, 0xcf, 0xff, 0xff, 0xfe, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x7e, 0xff, 0xff, 0xff, 0xfe,
+    0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xae, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0xbd, 0xff, 0xff,
+    0xc5, 0x10, 0x0, 0x0, 0x0, 0x0, 0x15, 0x9e,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0x94, 0x13, 0xbf,
+    0xff, 0xfe, 0xb4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x36, 0x9a, 0xaa, 0x86, 0x30, 0x0, 0x0,
+    0x16, 0xcf, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x38, 0xef, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x27, 0x40,
+
+    /* U+0052 "R" */
+    0x14, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x43, 0x21, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xee, 0xca, 0x82, 0x0, 0x0, 0x0, 0x0,
+    0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0x81, 0x0, 0x0, 0x0,
+    0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf9, 0x10, 0x0, 0x0,
+    0x5e, 0xff, 0xfa, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x89, 0xbd, 0xef, 0xff, 0xff, 0x70, 0x0, 0x0,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x5c, 0xff, 0xff, 0xe3, 0x0, 0x0,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xbf, 0xff, 0xf8, 0x0, 0x0,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3e, 0xff, 0xfd, 0x0, 0x0,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xfe, 0x30, 0x0,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7, 0xff, 0xfe, 0x40, 0x0,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7, 0xff, 0xfe, 0x40, 0x0,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0xff, 0xfe, 0x30, 0x0,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1d, 0xff, 0xfd, 0x10, 0x0,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x9f, 0xff, 0xf9, 0x0, 0x0,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x18, 0xef, 0xff, 0xe3, 0x0, 0x0,
+    0x5e, 0xff, 0xf6, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x23, 0x48, 0xdf, 0xff, 0xff, 0x80, 0x0, 0x0,
+    0x5e, 0xff, 0xfe, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xef, 0xff, 0xff, 0xff, 0xf9, 0x10, 0x0, 0x0,
+    0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfd, 0x71, 0x0, 0x0, 0x0,
+    0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xeb, 0x82, 0x0, 0x0, 0x0, 0x0,
+    0x5e, 0xff, 0xfe, 0xee, 0xee, 0xee, 0xee, 0xff,
+    0xff, 0xe7, 0x31, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x14, 0x9e,
+    0xff, 0xfd, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x15,
+    0xdf, 0xff, 0xe8, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3d, 0xff, 0xff, 0x91, 0x0, 0x0, 0x0, 0x0,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xef, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xff, 0xfe, 0x50, 0x0, 0x0, 0x0,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1c, 0xff, 0xff, 0xc1, 0x0, 0x0, 0x0,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xdf, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0xfe, 0x40, 0x0, 0x0,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1c, 0xff, 0xff, 0xb2, 0x0, 0x0,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xef, 0xff, 0xf7, 0x0, 0x0,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x8f, 0xff, 0xfd, 0x40, 0x0,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1c, 0xff, 0xff, 0xb1, 0x0,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xef, 0xff, 0xf7, 0x0,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x9f, 0xff, 0xfe, 0x30,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2d, 0xff, 0xff, 0x91,
+
+    /* U+0053 "S" */
+    0x0, 0x0, 0x0, 0x1, 0x36, 0x8b, 0xcd, 0xdc,
+    0x97, 0x42, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x5a, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xec,
+    0x82, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3b, 0xef,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x51,
+    0x0, 0x0, 0x0, 0x3, 0xcf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x0, 0x0,
+    0x0, 0x2b, 0xff, 0xff, 0xeb, 0x75, 0x32, 0x34,
+    0x7a, 0xdf, 0xff, 0xff, 0x60, 0x0, 0x0, 0x7f,
+    0xff, 0xfb, 0x40, 0x0, 0x0, 0x0, 0x0, 0x39,
+    0xff, 0xff, 0xd3, 0x0, 0x1, 0xdf, 0xff, 0xc2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x9f, 0xff,
+    0xf8, 0x0, 0x5, 0xef, 0xff, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2b, 0xff, 0xfd, 0x10,
+    0x7, 0xff, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0xff, 0x30, 0x8, 0xff,
+    0xfc, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xff, 0xff, 0x60, 0x8, 0xff, 0xfd, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaa,
+    0x87, 0x30, 0x5, 0xef, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xef, 0xff, 0xe7, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xff, 0xff, 0xd7, 0x31, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2b, 0xff, 0xff,
+    0xff, 0xeb, 0x95, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xbf, 0xff, 0xff, 0xff,
+    0xfe, 0xed, 0x95, 0x21, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x29, 0xef, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xeb, 0x73, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x3a, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfd, 0x82, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x26, 0x9c, 0xef, 0xff, 0xff, 0xff, 0xff, 0xfd,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0x36, 0x9d, 0xef, 0xff, 0xff, 0xff, 0xd5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x36, 0xad, 0xff, 0xff, 0xfd, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x13,
+    0x9e, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xef,
+    0xff, 0xd2, 0x1, 0x24, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xe5,
+    0xcf, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3d, 0xff, 0xf7, 0xbf, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2c, 0xff, 0xf7, 0x8f, 0xff, 0xe3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2c,
+    0xff, 0xf7, 0x4f, 0xff, 0xf9, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xff, 0xe5,
+    0x2b, 0xff, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xbf, 0xff, 0xc2, 0x6, 0xef,
+    0xff, 0xe7, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x18, 0xff, 0xff, 0x80, 0x1, 0xbf, 0xff, 0xfe,
+    0xc5, 0x21, 0x0, 0x0, 0x1, 0x15, 0xce, 0xff,
+    0xfc, 0x20, 0x0, 0x2c, 0xff, 0xff, 0xff, 0xda,
+    0x86, 0x66, 0x7a, 0xdf, 0xff, 0xff, 0xe4, 0x0,
+    0x0, 0x3, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0x50, 0x0, 0x0, 0x0,
+    0x18, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0xa3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x38,
+    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa5, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x57,
+    0x9a, 0xaa, 0x97, 0x41, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+0054 "T" */
+    0x3, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x12, 0xbf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf5, 0x2b, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x52, 0xbf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf5, 0x19, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xef, 0xff, 0xfd, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xfd, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xd2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0xfd, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xff, 0xd2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9, 0xff, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
+    0xff, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xfd,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xd2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0xfd, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
+    0xd2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xfd, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9f, 0xff, 0xd2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9, 0xff, 0xfd, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xfd, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xd2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0xfd, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xff, 0xd2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9, 0xff, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
+    0xff, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xfd,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xd2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0xfd, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
+    0xd2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xfd, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9f, 0xff, 0xd2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+0055 "U" */
+    0x14, 0x44, 0x41, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0x44, 0x43, 0x5e, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xfc, 0x5e, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xfc, 0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfc,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xfc, 0x5e, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xfc, 0x5e, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xfc, 0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfc,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xfc, 0x5e, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xfc, 0x5e, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xfc, 0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfc,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xfc, 0x5e, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xfc, 0x5e, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xfc, 0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfc,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xfc, 0x5e, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xfc, 0x5e, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xfc, 0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfc,
+    0x4e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xfc, 0x4e, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0xff, 0xfc, 0x3e, 0xff, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0xff, 0xfb, 0x3e, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xfa,
+    0x1e, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1e, 0xff, 0xf8, 0xd, 0xff,
+    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3e, 0xff, 0xf7, 0xa, 0xff, 0xfe, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0xf4, 0x7, 0xff, 0xfe, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xbf, 0xff, 0xd2,
+    0x3, 0xef, 0xff, 0xb2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xef, 0xff, 0xa1, 0x1, 0xaf,
+    0xff, 0xfa, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3d, 0xff, 0xfe, 0x50, 0x0, 0x5e, 0xff, 0xff,
+    0xb5, 0x11, 0x0, 0x0, 0x1, 0x28, 0xdf, 0xff,
+    0xfa, 0x10, 0x0, 0x8, 0xff, 0xff, 0xff, 0xd9,
+    0x76, 0x67, 0x8b, 0xef, 0xff, 0xff, 0xd2, 0x0,
+    0x0, 0x1, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfd, 0x40, 0x0, 0x0, 0x0,
+    0x6, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0xa1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x37,
+    0xdf, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xb4, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x58,
+    0x9a, 0xaa, 0x97, 0x40, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+0056 "V" */
+    0x34, 0x44, 0x41, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x14, 0x44, 0x42,
+    0x7f, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xe6,
+    0x3d, 0xff, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xd1,
+    0x1a, 0xff, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xff, 0x80,
+    0x5, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xfe, 0x30,
+    0x1, 0xdf, 0xff, 0xc1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xfa, 0x10,
+    0x0, 0x8f, 0xff, 0xe4, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4e, 0xff, 0xe6, 0x0,
+    0x0, 0x3e, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xd2, 0x0,
+    0x0, 0x1a, 0xff, 0xfc, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0x90, 0x0,
+    0x0, 0x6, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0x30, 0x0,
+    0x0, 0x2, 0xef, 0xff, 0x90, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0xfc, 0x10, 0x0,
+    0x0, 0x0, 0x9f, 0xff, 0xe2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3d, 0xff, 0xf6, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xff, 0xf6, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xff, 0xd3, 0x0, 0x0,
+    0x0, 0x0, 0x1b, 0xff, 0xfa, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xbf, 0xff, 0x90, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0xfd, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xff, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xdf, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xfc, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0x1c, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xff, 0xf3, 0x0, 0x0,
+    0x0, 0x0, 0x5e, 0xff, 0xd3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1c, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xff, 0x90, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7, 0xff, 0xfb, 0x10, 0x0,
+    0x0, 0x2, 0xdf, 0xff, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xdf, 0xfe, 0x50, 0x0,
+    0x0, 0x5, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0x80, 0x0,
+    0x0, 0xb, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xe1, 0x0,
+    0x0, 0x3d, 0xff, 0xd3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1d, 0xff, 0xf5, 0x0,
+    0x0, 0x7f, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xfa, 0x0,
+    0x1, 0xcf, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xef, 0xfd, 0x30,
+    0x4, 0xff, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xbf, 0xff, 0x60,
+    0x9, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xa1,
+    0x1d, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xe2,
+    0x5e, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xf5,
+    0x9f, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xef, 0xfb,
+    0xcf, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xbf, 0xff,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xff, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff,
+    0xff, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
+    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+0057 "W" */
+    0x14, 0x44, 0x42, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x44, 0x44, 0x42, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x34, 0x44, 0x34, 0xef,
+    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2d, 0xff, 0xf8, 0x2c, 0xff, 0xf9,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0xff, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0xfe, 0x50, 0xaf, 0xff, 0xc2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff,
+    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0xe1, 0x6, 0xff, 0xfe, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3d, 0xff, 0xff, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfb,
+    0x0, 0x3e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xef, 0xfc, 0xef, 0xfc, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xef, 0xff, 0x60, 0x0,
+    0xdf, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xff, 0x6c, 0xff, 0xd4, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4e, 0xff, 0xe3, 0x0, 0x9, 0xff,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2c, 0xff,
+    0xe1, 0xaf, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xfc, 0x20, 0x0, 0x5f, 0xff, 0xd2,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xfb, 0x6,
+    0xff, 0xfa, 0x10, 0x0, 0x0, 0x0, 0x1, 0xaf,
+    0xff, 0x90, 0x0, 0x3, 0xdf, 0xfe, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0x70, 0x1f, 0xff,
+    0xe1, 0x0, 0x0, 0x0, 0x0, 0x2c, 0xff, 0xe6,
+    0x0, 0x0, 0x1b, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xe4, 0x0, 0xdf, 0xff, 0x40,
+    0x0, 0x0, 0x0, 0x4, 0xef, 0xfd, 0x30, 0x0,
+    0x0, 0x8f, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x2,
+    0xdf, 0xfb, 0x20, 0x8, 0xff, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xc0, 0x0, 0x0, 0x5,
+    0xef, 0xfc, 0x20, 0x0, 0x0, 0x0, 0x6e, 0xff,
+    0x90, 0x0, 0x5f, 0xff, 0xc1, 0x0, 0x0, 0x0,
+    0xa, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x1e, 0xff,
+    0xf4, 0x0, 0x0, 0x0, 0x9, 0xff, 0xe6, 0x0,
+    0x2, 0xcf, 0xfd, 0x30, 0x0, 0x0, 0x0, 0xef,
+    0xff, 0x40, 0x0, 0x0, 0x0, 0xcf, 0xff, 0x70,
+    0x0, 0x0, 0x2, 0xbf, 0xfe, 0x20, 0x0, 0x1a,
+    0xff, 0xf6, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xd2,
+    0x0, 0x0, 0x0, 0x7, 0xff, 0xfb, 0x0, 0x0,
+    0x0, 0x3e, 0xff, 0xc0, 0x0, 0x0, 0x7f, 0xff,
+    0xa1, 0x0, 0x0, 0x7, 0xff, 0xf9, 0x10, 0x0,
+    0x0, 0x0, 0x4f, 0xff, 0xd0, 0x0, 0x0, 0x7,
+    0xff, 0xf7, 0x0, 0x0, 0x3, 0xef, 0xfd, 0x20,
+    0x0, 0x0, 0xaf, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x2, 0xdf, 0xfe, 0x30, 0x0, 0x0, 0xbf, 0xff,
+    0x30, 0x0, 0x0, 0xd, 0xff, 0xf4, 0x0, 0x0,
+    0x2c, 0xff, 0xd4, 0x0, 0x0, 0x0, 0x0, 0x19,
+    0xff, 0xf6, 0x0, 0x0, 0x1e, 0xff, 0xc2, 0x0,
+    0x0, 0x0, 0x9f, 0xff, 0x80, 0x0, 0x4, 0xef,
+    0xfc, 0x10, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0x90, 0x0, 0x5, 0xef, 0xf9, 0x10, 0x0, 0x0,
+    0x5, 0xff, 0xfc, 0x0, 0x0, 0x6f, 0xff, 0x90,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xef, 0xfb, 0x20,
+    0x0, 0x9f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x3d,
+    0xff, 0xe2, 0x0, 0x9, 0xff, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1d, 0xff, 0xd3, 0x0, 0x1b,
+    0xff, 0xe3, 0x0, 0x0, 0x0, 0x1, 0xbf, 0xfe,
+    0x50, 0x0, 0xdf, 0xff, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xff, 0x50, 0x4, 0xef, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xf9, 0x0,
+    0x2f, 0xff, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xff, 0xf8, 0x0, 0x6f, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x4e, 0xff, 0xb1, 0x6, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e,
+    0xff, 0xc0, 0xa, 0xff, 0xf4, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xdf, 0xfe, 0x30, 0xaf, 0xfe, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xfe,
+    0x0, 0xef, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0xa, 0xff, 0xf4, 0x1c, 0xff, 0xc2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xf4, 0x3f,
+    0xff, 0xa1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
+    0xff, 0x73, 0xdf, 0xfa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5e, 0xff, 0x67, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xef, 0xfa,
+    0x5f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xdf, 0xf9, 0xaf, 0xfe, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xd8, 0xff,
+    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xdd, 0xff, 0xc1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0xcf, 0xfd, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xef, 0xff, 0xff, 0x90, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
+    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2d, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xff, 0xe2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
+    0xff, 0xfd, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xaf, 0xff, 0xfb, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
+    0xb1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+0058 "X" */
+    0x0, 0x44, 0x44, 0x42, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0x44, 0x44, 0x20,
+    0x0, 0xaf, 0xff, 0xfa, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1a, 0xff, 0xfe, 0x40,
+    0x0, 0x3c, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xe7, 0x0,
+    0x0, 0x5, 0xef, 0xff, 0xe3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xa1, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0xfb, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3c, 0xff, 0xfc, 0x20, 0x0,
+    0x0, 0x0, 0x1b, 0xff, 0xff, 0x90, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xbf, 0xff, 0xe5, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xdf, 0xff, 0xe4, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xff, 0xfc, 0x20, 0x0,
+    0x0, 0x0, 0x6e, 0xff, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1a, 0xff, 0xff, 0xa0, 0x0,
+    0x0, 0x2, 0xdf, 0xff, 0xc3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xcf, 0xff, 0xf6, 0x0,
+    0x0, 0x1b, 0xff, 0xfe, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xfd, 0x30,
+    0x0, 0x8f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xb1,
+    0x5, 0xff, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xbf, 0xff, 0xf6,
+    0x2c, 0xff, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xfd,
+    0xcf, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xef, 0xff,
+    0xff, 0xff, 0x81, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x9f, 0xff,
+    0xff, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xff,
+    0xff, 0xd3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xff,
+    0xff, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xff, 0xfc, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xef, 0xff,
+    0xff, 0xff, 0x81, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xff, 0xfe,
+    0xdf, 0xff, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xaf, 0xff, 0xf6,
+    0x7f, 0xff, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0x91,
+    0xa, 0xff, 0xff, 0xb1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4e, 0xff, 0xfd, 0x30,
+    0x3, 0xdf, 0xff, 0xe7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xdf, 0xff, 0xe4, 0x0,
+    0x0, 0x5e, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1a, 0xff, 0xff, 0x80, 0x0,
+    0x0, 0x19, 0xff, 0xff, 0xb2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0xfa, 0x10, 0x0,
+    0x0, 0x2, 0xcf, 0xff, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xef, 0xff, 0xe3, 0x0, 0x0,
+    0x0, 0x0, 0x5e, 0xff, 0xff, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x2c, 0xff, 0xfe, 0x60, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0xff, 0xc3, 0x0, 0x0,
+    0x0, 0x1, 0xaf, 0xff, 0xf9, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xbf, 0xff, 0xfb, 0x10, 0x0,
+    0x0, 0x7, 0xff, 0xff, 0xd2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4d, 0xff, 0xff, 0x70, 0x0,
+    0x0, 0x4e, 0xff, 0xfe, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xe4, 0x0,
+    0x1, 0xcf, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xfc, 0x20,
+    0x19, 0xff, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2c, 0xff, 0xff, 0xa1,
+    0x6e, 0xff, 0xfd, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xe5,
+
+    /* U+0059 "Y" */
+    0x34, 0x44, 0x43, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x44, 0x44, 0x42,
+    0x6e, 0xff, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xef, 0xff, 0xe3,
+    0x19, 0xff, 0xff, 0xc1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2b, 0xff, 0xff, 0x60,
+    0x2, 0xdf, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xfa, 0x10,
+    0x0, 0x6e, 0xff, 0xfe, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xef, 0xff, 0xc3, 0x0,
+    0x0, 0x19, 0xff, 0xff, 0xb1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1b, 0xff, 0xff, 0x50, 0x0,
+    0x0, 0x2, 0xdf, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0xf9, 0x10, 0x0,
+    0x0, 0x0, 0x5e, 0xff, 0xfd, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xef, 0xff, 0xc2, 0x0, 0x0,
+    0x0, 0x0, 0x1a, 0xff, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0x1b, 0xff, 0xff, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xcf, 0xff, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xff, 0xfd, 0x30, 0x0,
+    0x0, 0x2, 0xef, 0xff, 0xc2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x19, 0xff, 0xff, 0xb0, 0x0,
+    0x0, 0x1b, 0xff, 0xfe, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xdf, 0xff, 0xf5, 0x0,
+    0x0, 0x6e, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5e, 0xff, 0xfc, 0x20,
+    0x3, 0xdf, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0x80,
+    0xa, 0xff, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xff, 0xe3,
+    0x5e, 0xff, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xfc,
+    0xcf, 0xff, 0x91, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
+    0xff, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xff,
+    0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
+    0xff, 0x81, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
+    0xfd, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+005A "Z" */
+    0x0, 0x13, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x42, 0x0, 0x3,
+    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x3d, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf8, 0x0, 0x3, 0xdf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x80, 0x0, 0x2b, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcd, 0xff, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0xfd, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7e, 0xff, 0xfe, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5e,
+    0xff, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4d, 0xff, 0xff,
+    0x91, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2c, 0xff, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0xff, 0xc3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x18,
+    0xff, 0xff, 0xd3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xef, 0xff,
+    0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xef, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xcf, 0xff, 0xfa, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xbf, 0xff, 0xfb, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x8f, 0xff,
+    0xfd, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6e, 0xff, 0xfe, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4e, 0xff, 0xfe, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3c, 0xff, 0xff, 0x91, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b, 0xff,
+    0xff, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xc3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xef, 0xff, 0xe4, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xef, 0xff, 0xe7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xdf,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xaf, 0xff, 0xfb,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x9f, 0xff, 0xfb, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6e, 0xff, 0xfd, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e,
+    0xff, 0xfe, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xff, 0xfe,
+    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1a, 0xff, 0xff, 0xa2, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x3, 0xdf, 0xff, 0xff, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe2,
+    0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x23, 0xdf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf2, 0x3d, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x20,
+
+    /* U+005B "[" */
+    0x3, 0x44, 0x44, 0x44, 0x44, 0x21, 0xaf, 0xff,
+    0xff, 0xff, 0xf8, 0x1a, 0xff, 0xff, 0xff, 0xff,
+    0x81, 0xaf, 0xff, 0xff, 0xff, 0xf8, 0x1a, 0xff,
+    0xf9, 0x33, 0x33, 0x11, 0xaf, 0xff, 0x80, 0x0,
+    0x0, 0x1a, 0xff, 0xf8, 0x0, 0x0, 0x1, 0xaf,
+    0xff, 0x80, 0x0, 0x0, 0x1a, 0xff, 0xf8, 0x0,
+    0x0, 0x1, 0xaf, 0xff, 0x80, 0x0, 0x0, 0x1a,
+    0xff, 0xf8, 0x0, 0x0, 0x1, 0xaf, 0xff, 0x80,
+    0x0, 0x0, 0x1a, 0xff, 0xf8, 0x0, 0x0, 0x1,
+    0xaf, 0xff, 0x80, 0x0, 0x0, 0x1a, 0xff, 0xf8,
+    0x0, 0x0, 0x1, 0xaf, 0xff, 0x80, 0x0, 0x0,
+    0x1a, 0xff, 0xf8, 0x0, 0x0, 0x1, 0xaf, 0xff,
+    0x80, 0x0, 0x0, 0x1a, 0xff, 0xf8, 0x0, 0x0,
+    0x1, 0xaf, 0xff, 0x80, 0x0, 0x0, 0x1a, 0xff,
+    0xf8, 0x0, 0x0, 0x1, 0xaf, 0xff, 0x80, 0x0,
+    0x0, 0x1a, 0xff, 0xf8, 0x0, 0x0, 0x1, 0xaf,
+    0xff, 0x80, 0x0, 0x0, 0x1a, 0xff, 0xf8, 0x0,
+    0x0, 0x1, 0xaf, 0xff, 0x80, 0x0, 0x0, 0x1a,
+    0xff, 0xf8, 0x0, 0x0, 0x1, 0xaf, 0xff, 0x80,
+    0x0, 0x0, 0x1a, 0xff, 0xf8, 0x0, 0x0, 0x1,
+    0xaf, 0xff, 0x80, 0x0, 0x0, 0x1a, 0xff, 0xf8,
+    0x0, 0x0, 0x1, 0xaf, 0xff, 0x80, 0x0, 0x0,
+    0x1a, 0xff, 0xf8, 0x0, 0x0, 0x1, 0xaf, 0xff,
+    0x80, 0x0, 0x0, 0x1a, 0xff, 0xf8, 0x0, 0x0,
+    0x1, 0xaf, 0xff, 0x80, 0x0, 0x0, 0x1a, 0xff,
+    0xf8, 0x0, 0x0, 0x1, 0xaf, 0xff, 0x80, 0x0,
+    0x0, 0x1a, 0xff, 0xf8, 0x0, 0x0, 0x1, 0xaf,
+    0xff, 0x80, 0x0, 0x0, 0x1a, 0xff, 0xf8, 0x11,
+    0x11, 0x1, 0xaf, 0xff, 0xed, 0xdd, 0xd7, 0x1a,
+    0xff, 0xff, 0xff, 0xff, 0x81, 0xaf, 0xff, 0xff,
+    0xff, 0xf8, 0x16, 0x99, 0x99, 0x99, 0x99, 0x50,
+
+    /* U+005C "\\" */
+    0x9a, 0xa4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
+    0xfa, 0x10, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xfd,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x3d, 0xff, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0x1b, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0xc1, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xd3, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xef, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xbf, 0xf9, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0, 0x4e,
+    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x1b, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xef, 0xe3, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xef, 0xe6, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xbf, 0xf9, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xfc, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x3e, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x2c, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xef,
+    0xe2, 0x0, 0x0, 0x0, 0x0, 0x3, 0xdf, 0xe5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf9, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xfc, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0xfe, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x2d, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x19, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xdf, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
+    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xfb,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfe, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0x1d, 0xff, 0x60, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xff, 0xe0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0x9a, 0xa2,
+
+    /* U+005D "]" */
+    0x14, 0x44, 0x44, 0x44, 0x44, 0x13, 0xdf, 0xff,
+    0xff, 0xff, 0xf4, 0x3d, 0xff, 0xff, 0xff, 0xff,
+    0x43, 0xdf, 0xff, 0xff, 0xff, 0xf4, 0x2, 0x33,
+    0x34, 0xdf, 0xff, 0x40, 0x0, 0x0, 0x2d, 0xff,
+    0xf4, 0x0, 0x0, 0x2, 0xdf, 0xff, 0x40, 0x0,
+    0x0, 0x2d, 0xff, 0xf4, 0x0, 0x0, 0x2, 0xdf,
+    0xff, 0x40, 0x0, 0x0, 0x2d, 0xff, 0xf4, 0x0,
+    0x0, 0x2, 0xdf, 0xff, 0x40, 0x0, 0x0, 0x2d,
+    0xff, 0xf4, 0x0, 0x0, 0x2, 0xdf, 0xff, 0x40,
+    0x0, 0x0, 0x2d, 0xff, 0xf4, 0x0, 0x0, 0x2,
+    0xdf, 0xff, 0x40, 0x0, 0x0, 0x2d, 0xff, 0xf4,
+    0x0, 0x0, 0x2, 0xdf, 0xff, 0x40, 0x0, 0x0,
+    0x2d, 0xff, 0xf4, 0x0, 0x0, 0x2, 0xdf, 0xff,
+    0x40, 0x0, 0x0, 0x2d, 0xff, 0xf4, 0x0, 0x0,
+    0x2, 0xdf, 0xff, 0x40, 0x0, 0x0, 0x2d, 0xff,
+    0xf4, 0x0, 0x0, 0x2, 0xdf, 0xff, 0x40, 0x0,
+    0x0, 0x2d, 0xff, 0xf4, 0x0, 0x0, 0x2, 0xdf,
+    0xff, 0x40, 0x0, 0x0, 0x2d, 0xff, 0xf4, 0x0,
+    0x0, 0x2, 0xdf, 0xff, 0x40, 0x0, 0x0, 0x2d,
+    0xff, 0xf4, 0x0, 0x0, 0x2, 0xdf, 0xff, 0x40,
+    0x0, 0x0, 0x2d, 0xff, 0xf4, 0x0, 0x0, 0x2,
+    0xdf, 0xff, 0x40, 0x0, 0x0, 0x2d, 0xff, 0xf4,
+    0x0, 0x0, 0x2, 0xdf, 0xff, 0x40, 0x0, 0x0,
+    0x2d, 0xff, 0xf4, 0x0, 0x0, 0x2, 0xdf, 0xff,
+    0x40, 0x0, 0x0, 0x2d, 0xff, 0xf4, 0x0, 0x0,
+    0x2, 0xdf, 0xff, 0x40, 0x0, 0x0, 0x2d, 0xff,
+    0xf4, 0x0, 0x0, 0x2, 0xdf, 0xff, 0x40, 0x0,
+    0x0, 0x2d, 0xff, 0xf4, 0x0, 0x11, 0x12, 0xdf,
+    0xff, 0x43, 0xbd, 0xdd, 0xdf, 0xff, 0xf4, 0x3d,
+    0xff, 0xff, 0xff, 0xff, 0x43, 0xdf, 0xff, 0xff,
+    0xff, 0xf4, 0x28, 0x99, 0x99, 0x99, 0x99, 0x20,
+
+    /* U+005E "^" */
+    0x0, 0x0, 0x0, 0x0, 0x25, 0x55, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xff, 0xfe, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4d, 0xff, 0xff,
+    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0xfd, 0xff, 0xe2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xdf, 0xfc, 0x6f, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x62, 0xcf,
+    0xfc, 0x20, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xff,
+    0xd3, 0x8, 0xff, 0xe6, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xef, 0xf9, 0x0, 0x2f, 0xff, 0xb1, 0x0,
+    0x0, 0x0, 0x1, 0xaf, 0xfe, 0x40, 0x0, 0xaf,
+    0xff, 0x40, 0x0, 0x0, 0x0, 0x4e, 0xff, 0xc0,
+    0x0, 0x5, 0xff, 0xfa, 0x0, 0x0, 0x0, 0xa,
+    0xff, 0xf6, 0x0, 0x0, 0x2b, 0xff, 0xe4, 0x0,
+    0x0, 0x2, 0xef, 0xfd, 0x20, 0x0, 0x0, 0x8f,
+    0xff, 0x81, 0x0, 0x0, 0x8f, 0xff, 0x90, 0x0,
+    0x0, 0x2, 0xef, 0xfd, 0x30, 0x0, 0x2c, 0xff,
+    0xe4, 0x0, 0x0, 0x0, 0xa, 0xff, 0xf7, 0x0,
+    0x6, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xff, 0xd1, 0x0, 0xcf, 0xff, 0x60, 0x0, 0x0,
+    0x0, 0x1, 0xbf, 0xfe, 0x60, 0x5f, 0xff, 0xd2,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xfb, 0x15,
+    0x88, 0x85, 0x0, 0x0, 0x0, 0x0, 0x0, 0x27,
+    0x88, 0x72,
+
+    /* U+005F "_" */
+    0x46, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x2b, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xe5, 0xbf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0x56, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x83,
+
+    /* U+0060 "`" */
+    0x6a, 0xaa, 0xa8, 0x10, 0x3, 0xcf, 0xff, 0xe5,
+    0x0, 0x4, 0xdf, 0xff, 0xc0, 0x0, 0x5, 0xef,
+    0xfe, 0x40, 0x0, 0x7, 0xef, 0xfa, 0x10, 0x0,
+    0x19, 0xff, 0xe4, 0x0, 0x0, 0x2a, 0xdd, 0x90,
+
+    /* U+0061 "a" */
+    0x0, 0x0, 0x0, 0x0, 0x23, 0x55, 0x66, 0x54,
+    0x31, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49,
+    0xcd, 0xef, 0xff, 0xfe, 0xca, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x4b, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfb, 0x30, 0x0, 0x0, 0x4, 0xdf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0x0,
+    0x0, 0x2d, 0xff, 0xfe, 0xa6, 0x32, 0x23, 0x6a,
+    0xef, 0xff, 0xf8, 0x0, 0x0, 0x8f, 0xff, 0xe7,
+    0x10, 0x0, 0x0, 0x0, 0x6e, 0xff, 0xfc, 0x20,
+    0x3, 0xdf, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xfe, 0x40, 0x5, 0xff, 0xfd, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xdf, 0xff, 0x50,
+    0x2, 0x79, 0xb9, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xdf, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x11,
+    0x49, 0xef, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x23, 0x56, 0x89, 0xce, 0xff, 0xff, 0xff, 0x50,
+    0x0, 0x0, 0x3, 0x8b, 0xcd, 0xef, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x50, 0x0, 0x3, 0x9f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xec, 0xef, 0xff, 0x50,
+    0x0, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x96,
+    0x43, 0xdf, 0xff, 0x50, 0x3, 0xcf, 0xff, 0xfd,
+    0xa8, 0x52, 0x0, 0x0, 0x2, 0xdf, 0xff, 0x50,
+    0x9, 0xff, 0xff, 0xa3, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xdf, 0xff, 0x50, 0x1e, 0xff, 0xfb, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xdf, 0xff, 0x50,
+    0x3e, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xef, 0xff, 0x50, 0x4f, 0xff, 0xf4, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1a, 0xff, 0xff, 0x50,
+    0x3e, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5e, 0xff, 0xff, 0x60, 0x1e, 0xff, 0xfc, 0x10,
+    0x0, 0x0, 0x0, 0x15, 0xdf, 0xff, 0xff, 0x60,
+    0x9, 0xff, 0xff, 0xb4, 0x10, 0x0, 0x14, 0x9e,
+    0xff, 0xff, 0xff, 0x80, 0x3, 0xdf, 0xff, 0xfd,
+    0xba, 0x9b, 0xce, 0xff, 0xfb, 0xaf, 0xff, 0xa0,
+    0x0, 0x4d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
+    0x71, 0x4f, 0xff, 0xe1, 0x0, 0x4, 0xbf, 0xff,
+    0xff, 0xff, 0xff, 0x94, 0x0, 0x2d, 0xff, 0xf5,
+    0x0, 0x0, 0x2, 0x69, 0xaa, 0x98, 0x41, 0x0,
+    0x0, 0x1, 0x22, 0x21,
+
+    /* U+0062 "b" */
+    0x3, 0x44, 0x42, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xbf, 0xfe, 0x60, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2b,
+    0xff, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xbf, 0xfe, 0x60, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2b, 0xff,
+    0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xbf, 0xfe, 0x60, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2b, 0xff, 0xe6,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xbf, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2b, 0xff, 0xe6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xbf, 0xfe, 0x60, 0x0, 0x24, 0x56, 0x53, 0x10,
+    0x0, 0x0, 0x0, 0x2b, 0xff, 0xe6, 0x2, 0x8c,
+    0xef, 0xfe, 0xdb, 0x71, 0x0, 0x0, 0x2, 0xbf,
+    0xfe, 0x65, 0xef, 0xff, 0xff, 0xff, 0xff, 0xd5,
+    0x0, 0x0, 0x2b, 0xff, 0xfa, 0xdf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xd5, 0x0, 0x2, 0xbf, 0xff,
+    0xff, 0xfd, 0x94, 0x22, 0x6b, 0xef, 0xff, 0xe3,
+    0x0, 0x2b, 0xff, 0xff, 0xfc, 0x50, 0x0, 0x0,
+    0x18, 0xff, 0xff, 0xa1, 0x2, 0xbf, 0xff, 0xfd,
+    0x30, 0x0, 0x0, 0x0, 0x18, 0xff, 0xfe, 0x50,
+    0x2b, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x1c, 0xff, 0xfb, 0x2, 0xbf, 0xff, 0xb2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf1, 0x2b,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xef, 0xff, 0x52, 0xbf, 0xfe, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1c, 0xff, 0xf8, 0x2b, 0xff,
+    0xe3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xaf,
+    0xff, 0xa2, 0xbf, 0xfd, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x19, 0xff, 0xfa, 0x2b, 0xff, 0xd2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
+    0xa2, 0xbf, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x19, 0xff, 0xfa, 0x2b, 0xff, 0xe3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xaf, 0xff, 0x92,
+    0xbf, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1b, 0xff, 0xf7, 0x2b, 0xff, 0xf6, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xef, 0xff, 0x42, 0xbf,
+    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
+    0xff, 0xf1, 0x2b, 0xff, 0xfd, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x1b, 0xff, 0xfb, 0x2, 0xbf, 0xff,
+    0xf9, 0x0, 0x0, 0x0, 0x0, 0x7, 0xef, 0xfe,
+    0x50, 0x2b, 0xff, 0xff, 0xe7, 0x10, 0x0, 0x0,
+    0x5, 0xef, 0xff, 0xb1, 0x2, 0xbf, 0xff, 0xff,
+    0xfa, 0x41, 0x1, 0x48, 0xef, 0xff, 0xd3, 0x0,
+    0x2b, 0xff, 0xeb, 0xff, 0xfd, 0xcb, 0xcd, 0xff,
+    0xff, 0xe5, 0x0, 0x2, 0xbf, 0xfd, 0x39, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xc4, 0x0, 0x0, 0x2b,
+    0xff, 0xd2, 0x17, 0xef, 0xff, 0xff, 0xfe, 0x93,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x58,
+    0xaa, 0x95, 0x10, 0x0, 0x0, 0x0,
+
+    /* U+0063 "c" */
+    0x0, 0x0, 0x0, 0x0, 0x13, 0x55, 0x55, 0x42,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x6b,
+    0xde, 0xff, 0xee, 0xc9, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x16, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x81, 0x0, 0x0, 0x0, 0x17, 0xef, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x91, 0x0, 0x0, 0x7,
+    0xff, 0xff, 0xea, 0x52, 0x23, 0x8d, 0xff, 0xff,
+    0x80, 0x0, 0x3, 0xef, 0xff, 0xd5, 0x10, 0x0,
+    0x0, 0x3c, 0xff, 0xfe, 0x20, 0x1, 0xaf, 0xff,
+    0xd4, 0x0, 0x0, 0x0, 0x0, 0x3d, 0xff, 0xf8,
+    0x0, 0x3e, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xff, 0xb2, 0x6, 0xff, 0xfd, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xcd, 0xc8, 0x20,
+    0xaf, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0x10, 0x0, 0xd, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef,
+    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2e, 0xff, 0xf4, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2e, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xe, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0xdb, 0x93, 0x9,
+    0xff, 0xfc, 0x10, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xcf, 0xff, 0x50, 0x4f, 0xff, 0xe5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5e, 0xff, 0xd3, 0x2, 0xbf,
+    0xff, 0xb2, 0x0, 0x0, 0x0, 0x0, 0x1b, 0xff,
+    0xfa, 0x10, 0x6, 0xef, 0xff, 0xa1, 0x0, 0x0,
+    0x0, 0x18, 0xff, 0xfe, 0x40, 0x0, 0xa, 0xff,
+    0xff, 0xb6, 0x21, 0x2, 0x4a, 0xff, 0xff, 0x90,
+    0x0, 0x0, 0x2b, 0xff, 0xff, 0xec, 0xcb, 0xce,
+    0xff, 0xff, 0xb2, 0x0, 0x0, 0x0, 0x19, 0xef,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0x91, 0x0, 0x0,
+    0x0, 0x0, 0x15, 0xcf, 0xff, 0xff, 0xff, 0xfc,
+    0x61, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x26,
+    0x9a, 0xa9, 0x63, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+0064 "d" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x44, 0x44, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2d, 0xff, 0xe4, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xdf, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2d, 0xff, 0xf4, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xdf,
+    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2d, 0xff, 0xf4, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xdf, 0xff,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2d, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xdf, 0xff, 0x40,
+    0x0, 0x0, 0x0, 0x3, 0x55, 0x65, 0x30, 0x0,
+    0x2d, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x4a, 0xde,
+    0xff, 0xed, 0xa4, 0x2, 0xdf, 0xff, 0x40, 0x0,
+    0x2, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x3d,
+    0xff, 0xf4, 0x0, 0x2, 0xbf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xe9, 0xdf, 0xff, 0x40, 0x1, 0xbf,
+    0xff, 0xfc, 0x83, 0x23, 0x7c, 0xff, 0xff, 0xff,
+    0xf4, 0x0, 0x6e, 0xff, 0xfb, 0x20, 0x0, 0x0,
+    0x29, 0xff, 0xff, 0xff, 0x40, 0x2c, 0xff, 0xfb,
+    0x20, 0x0, 0x0, 0x0, 0x19, 0xff, 0xff, 0xf4,
+    0x5, 0xff, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x2c, 0xff, 0xff, 0x40, 0xaf, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf4, 0xd,
+    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xef, 0xff, 0x42, 0xef, 0xff, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2d, 0xff, 0xf4, 0x4f, 0xff,
+    0xe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
+    0xff, 0x45, 0xff, 0xfe, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xb, 0xff, 0xf4, 0x6f, 0xff, 0xd2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
+    0x45, 0xff, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0xf4, 0x4f, 0xff, 0xe2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0x43,
+    0xef, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0xff, 0xf4, 0x1e, 0xff, 0xf6, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xdf, 0xff, 0x40, 0xbf,
+    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5e,
+    0xff, 0xf4, 0x5, 0xff, 0xfe, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x19, 0xff, 0xff, 0x40, 0x2c, 0xff,
+    0xfa, 0x10, 0x0, 0x0, 0x0, 0x5, 0xef, 0xff,
+    0xf4, 0x0, 0x6f, 0xff, 0xf9, 0x10, 0x0, 0x0,
+    0x4, 0xdf, 0xff, 0xff, 0x40, 0x1, 0xaf, 0xff,
+    0xfb, 0x52, 0x1, 0x37, 0xdf, 0xff, 0xff, 0xf4,
+    0x0, 0x3, 0xcf, 0xff, 0xfe, 0xcb, 0xcd, 0xff,
+    0xfc, 0xdf, 0xff, 0x40, 0x0, 0x2, 0xaf, 0xff,
+    0xff, 0xff, 0xff, 0xfc, 0x3b, 0xff, 0xf4, 0x0,
+    0x0, 0x1, 0x6d, 0xff, 0xff, 0xff, 0xfa, 0x30,
+    0xbf, 0xff, 0x40, 0x0, 0x0, 0x0, 0x4, 0x7a,
+    0xa9, 0x72, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+0065 "e" */
+    0x0, 0x0, 0x0, 0x0, 0x13, 0x55, 0x65, 0x42,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x16,
+    0xbd, 0xef, 0xff, 0xec, 0x93, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xdf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x92, 0x0, 0x0, 0x0, 0x0, 0x6e, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x20, 0x0,
+    0x0, 0x6, 0xef, 0xff, 0xeb, 0x53, 0x23, 0x7b,
+    0xff, 0xff, 0xc1, 0x0, 0x0, 0x3d, 0xff, 0xfe,
+    0x61, 0x0, 0x0, 0x1, 0x8f, 0xff, 0xf8, 0x10,
+    0x1, 0x9f, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0,
+    0x18, 0xef, 0xfd, 0x40, 0x3, 0xef, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xbf, 0xff, 0x90,
+    0x7, 0xff, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0xe0, 0xc, 0xff, 0xfb, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xf3,
+    0xe, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1c, 0xff, 0xf7, 0x2e, 0xff, 0xfa, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x7d, 0xff, 0xf9,
+    0x3e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfa, 0x4e, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
+    0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfa, 0x3e, 0xff, 0xf3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2e, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xa, 0xff, 0xfc, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x18, 0x87, 0x62, 0x5, 0xff, 0xfe, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xe4,
+    0x2, 0xcf, 0xff, 0xc2, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xcf, 0xff, 0xd0, 0x0, 0x6f, 0xff, 0xfb,
+    0x20, 0x0, 0x0, 0x0, 0x2a, 0xff, 0xff, 0x70,
+    0x0, 0x1a, 0xff, 0xff, 0xd7, 0x31, 0x1, 0x36,
+    0xcf, 0xff, 0xfa, 0x10, 0x0, 0x2, 0xbf, 0xff,
+    0xff, 0xdc, 0xbc, 0xde, 0xff, 0xff, 0xd2, 0x0,
+    0x0, 0x0, 0x19, 0xef, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfa, 0x20, 0x0, 0x0, 0x0, 0x1, 0x5b,
+    0xff, 0xff, 0xff, 0xff, 0xfc, 0x61, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x15, 0x8a, 0xaa, 0x96,
+    0x30, 0x0, 0x0, 0x0,
+
+    /* U+0066 "f" */
+    0x0, 0x0, 0x0, 0x3, 0x69, 0xaa, 0x98, 0x50,
+    0x0, 0x0, 0x0, 0x7d, 0xff, 0xff, 0xff, 0xc1,
+    0x0, 0x0, 0x18, 0xef, 0xff, 0xff, 0xff, 0xa1,
+    0x0, 0x0, 0x3e, 0xff, 0xff, 0xff, 0xff, 0x70,
+    0x0, 0x0, 0x8f, 0xff, 0xfb, 0x52, 0x24, 0x20,
+    0x0, 0x0, 0xbf, 0xff, 0xc1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xcf, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0x60, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x48, 0x88, 0xef, 0xff, 0xb8, 0x88, 0x82, 0x0,
+    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x0,
+    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x0,
+    0x6b, 0xbb, 0xef, 0xff, 0xdb, 0xbb, 0xb2, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x45, 0x55, 0x20, 0x0, 0x0, 0x0,
+
+    /* U+0067 "g" */
+    0x0, 0x0, 0x0, 0x0, 0x34, 0x56, 0x54, 0x10,
+    0x0, 0x1, 0x11, 0x0, 0x0, 0x0, 0x4, 0xad,
+    0xef, 0xff, 0xdb, 0x60, 0x4, 0xbb, 0xb5, 0x0,
+    0x0, 0x2a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3,
+    0x6f, 0xff, 0x70, 0x0, 0x2b, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xc8, 0xff, 0xf7, 0x0, 0x1b,
+    0xff, 0xff, 0xd8, 0x32, 0x36, 0xce, 0xff, 0xff,
+    0xff, 0x70, 0x7, 0xff, 0xff, 0xb2, 0x0, 0x0,
+    0x1, 0x8e, 0xff, 0xff, 0xf7, 0x2, 0xcf, 0xff,
+    0xa2, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
+    0x70, 0x6f, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xbf, 0xff, 0xf7, 0xb, 0xff, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xef, 0xff, 0x71,
+    0xef, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2d, 0xff, 0xf7, 0x3e, 0xff, 0xe3, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0x76, 0xff,
+    0xfd, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xf7, 0x7f, 0xff, 0xc2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0x77, 0xff, 0xfc,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xf7, 0x7f, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0x75, 0xff, 0xfe, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xf7,
+    0x3e, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xbf, 0xff, 0x71, 0xef, 0xff, 0x60, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2d, 0xff, 0xf7, 0xa,
+    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0xef, 0xff, 0x70, 0x5f, 0xff, 0xe5, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xbf, 0xff, 0xf7, 0x1, 0xbf,
+    0xff, 0xc3, 0x0, 0x0, 0x0, 0x1, 0x9f, 0xff,
+    0xff, 0x70, 0x5, 0xef, 0xff, 0xd5, 0x10, 0x0,
+    0x13, 0xaf, 0xff, 0xff, 0xf7, 0x0, 0x8, 0xff,
+    0xff, 0xfc, 0x87, 0x7a, 0xef, 0xfe, 0xff, 0xff,
+    0x70, 0x0, 0x19, 0xef, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0x8d, 0xff, 0xf7, 0x0, 0x0, 0x6, 0xcf,
+    0xff, 0xff, 0xff, 0xfd, 0x60, 0xcf, 0xff, 0x70,
+    0x0, 0x0, 0x2, 0x6b, 0xef, 0xff, 0xc7, 0x30,
+    0xc, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xcf, 0xff, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d,
+    0xff, 0xf4, 0x7, 0xa8, 0x52, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xef, 0xfd, 0x30, 0x8f, 0xff,
+    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
+    0xb1, 0x6, 0xff, 0xfd, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x4e, 0xff, 0xf8, 0x0, 0x3d, 0xff, 0xfb,
+    0x30, 0x0, 0x0, 0x0, 0x5d, 0xff, 0xfe, 0x20,
+    0x1, 0x8f, 0xff, 0xfd, 0x95, 0x33, 0x47, 0xbe,
+    0xff, 0xfe, 0x60, 0x0, 0x1, 0xaf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0x61, 0x0, 0x0,
+    0x2, 0x8e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x38, 0xbd, 0xef,
+    0xfe, 0xec, 0xa6, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x34, 0x44, 0x43, 0x21, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+0068 "h" */
+    0x3, 0x44, 0x42, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1b, 0xff, 0xf6, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2b, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2b, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2b, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2b,
+    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2b, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2b, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2b, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2b, 0xff, 0xf7, 0x0, 0x1,
+    0x35, 0x65, 0x53, 0x10, 0x0, 0x0, 0x2b, 0xff,
+    0xf7, 0x1, 0x5b, 0xdf, 0xff, 0xed, 0xb5, 0x0,
+    0x0, 0x2b, 0xff, 0xf7, 0x3c, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xa2, 0x0, 0x2b, 0xff, 0xfa, 0xcf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x2b,
+    0xff, 0xff, 0xff, 0xea, 0x74, 0x47, 0xbe, 0xff,
+    0xff, 0x60, 0x2b, 0xff, 0xff, 0xfc, 0x50, 0x0,
+    0x0, 0x17, 0xef, 0xff, 0xb1, 0x2b, 0xff, 0xff,
+    0xc2, 0x0, 0x0, 0x0, 0x1, 0x9f, 0xff, 0xd3,
+    0x2b, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x4e, 0xff, 0xf4, 0x2b, 0xff, 0xfc, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x1d, 0xff, 0xf5, 0x2b, 0xff,
+    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
+    0xf6, 0x2b, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0xff, 0xf6, 0x2b, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf7, 0x2b,
+    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0xff, 0xf7, 0x2b, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0xff, 0xf7, 0x2b, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf7,
+    0x2b, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0xff, 0xf7, 0x2b, 0xff, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xc, 0xff, 0xf7, 0x2b, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
+    0xf7, 0x2b, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0xff, 0xf7, 0x2b, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf7, 0x2b,
+    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0xff, 0xf7, 0x2b, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0xff, 0xf7, 0x2b, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf7,
+    0x2b, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0xff, 0xf7, 0x2b, 0xff, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xc, 0xff, 0xf7, 0x2b, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
+    0xf7,
+
+    /* U+0069 "i" */
+    0x3, 0x44, 0x42, 0x1b, 0xff, 0xf7, 0x1b, 0xff,
+    0xf7, 0x1b, 0xff, 0xf7, 0x1b, 0xff, 0xf7, 0x16,
+    0x88, 0x73, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x11, 0x10, 0x18, 0xbb,
+    0xb5, 0x1b, 0xff, 0xf7, 0x1b, 0xff, 0xf7, 0x1b,
+    0xff, 0xf7, 0x1b, 0xff, 0xf7, 0x1b, 0xff, 0xf7,
+    0x1b, 0xff, 0xf7, 0x1b, 0xff, 0xf7, 0x1b, 0xff,
+    0xf7, 0x1b, 0xff, 0xf7, 0x1b, 0xff, 0xf7, 0x1b,
+    0xff, 0xf7, 0x1b, 0xff, 0xf7, 0x1b, 0xff, 0xf7,
+    0x1b, 0xff, 0xf7, 0x1b, 0xff, 0xf7, 0x1b, 0xff,
+    0xf7, 0x1b, 0xff, 0xf7, 0x1b, 0xff, 0xf7, 0x1b,
+    0xff, 0xf7, 0x1b, 0xff, 0xf7, 0x1b, 0xff, 0xf7,
+    0x1b, 0xff, 0xf7, 0x1b, 0xff, 0xf7, 0x1b, 0xff,
+    0xf7,
+
+    /* U+006A "j" */
+    0x0, 0x0, 0x0, 0x34, 0x44, 0x20, 0x0, 0x0,
+    0x2b, 0xff, 0xe6, 0x0, 0x0, 0x2, 0xbf, 0xfe,
+    0x60, 0x0, 0x0, 0x2b, 0xff, 0xe6, 0x0, 0x0,
+    0x2, 0xbf, 0xfe, 0x60, 0x0, 0x0, 0x16, 0x99,
+    0x83, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x11, 0x10, 0x0,
+    0x0, 0x1, 0x8b, 0xbb, 0x40, 0x0, 0x0, 0x2b,
+    0xff, 0xe6, 0x0, 0x0, 0x2, 0xbf, 0xfe, 0x60,
+    0x0, 0x0, 0x2b, 0xff, 0xe6, 0x0, 0x0, 0x2,
+    0xbf, 0xfe, 0x60, 0x0, 0x0, 0x2b, 0xff, 0xe6,
+    0x0, 0x0, 0x2, 0xbf, 0xfe, 0x60, 0x0, 0x0,
+    0x2b, 0xff, 0xe6, 0x0, 0x0, 0x2, 0xbf, 0xfe,
+    0x60, 0x0, 0x0, 0x2b, 0xff, 0xe6, 0x0, 0x0,
+    0x2, 0xbf, 0xfe, 0x60, 0x0, 0x0, 0x2b, 0xff,
+    0xe6, 0x0, 0x0, 0x2, 0xbf, 0xfe, 0x60, 0x0,
+    0x0, 0x2b, 0xff, 0xe6, 0x0, 0x0, 0x2, 0xbf,
+    0xfe, 0x60, 0x0, 0x0, 0x2b, 0xff, 0xe6, 0x0,
+    0x0, 0x2, 0xbf, 0xfe, 0x60, 0x0, 0x0, 0x2b,
+    0xff, 0xe6, 0x0, 0x0, 0x2, 0xbf, 0xfe, 0x60,
+    0x0, 0x0, 0x2b, 0xff, 0xe6, 0x0, 0x0, 0x2,
+    0xbf, 0xfe, 0x60, 0x0, 0x0, 0x2b, 0xff, 0xe6,
+    0x0, 0x0, 0x2, 0xbf, 0xfe, 0x60, 0x0, 0x0,
+    0x2b, 0xff, 0xe6, 0x0, 0x0, 0x2, 0xbf, 0xfe,
+    0x60, 0x0, 0x0, 0x2b, 0xff, 0xe6, 0x0, 0x0,
+    0x2, 0xbf, 0xfe, 0x60, 0x0, 0x0, 0x2c, 0xff,
+    0xe6, 0x0, 0x0, 0x2, 0xcf, 0xfe, 0x50, 0x0,
+    0x0, 0x3e, 0xff, 0xe4, 0x0, 0x0, 0x7, 0xff,
+    0xfd, 0x20, 0x58, 0x69, 0xef, 0xff, 0xc0, 0xa,
+    0xff, 0xff, 0xff, 0xf6, 0x1, 0xdf, 0xff, 0xff,
+    0xf9, 0x10, 0x1c, 0xef, 0xfe, 0xc7, 0x10, 0x0,
+    0x24, 0x44, 0x42, 0x0, 0x0,
+
+    /* U+006B "k" */
+    0x3, 0x44, 0x42, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1b, 0xff, 0xf6, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1b, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b,
+    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1b, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1b, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1b, 0xff, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x11, 0x11, 0x0, 0x1b, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x2a, 0xbb, 0xbb,
+    0x40, 0x1b, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x3,
+    0xcf, 0xff, 0xe8, 0x0, 0x1b, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x2b, 0xff, 0xfe, 0x71, 0x0, 0x1b,
+    0xff, 0xf7, 0x0, 0x0, 0x3, 0xbf, 0xff, 0xe7,
+    0x0, 0x0, 0x1b, 0xff, 0xf7, 0x0, 0x0, 0x2b,
+    0xff, 0xfe, 0x71, 0x0, 0x0, 0x1b, 0xff, 0xf7,
+    0x0, 0x2, 0xbf, 0xff, 0xe6, 0x0, 0x0, 0x0,
+    0x1b, 0xff, 0xf7, 0x0, 0x2b, 0xff, 0xfe, 0x60,
+    0x0, 0x0, 0x0, 0x1b, 0xff, 0xf7, 0x2, 0xbf,
+    0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x1b, 0xff,
+    0xf7, 0x2b, 0xff, 0xfe, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x1b, 0xff, 0xf8, 0xaf, 0xff, 0xf9, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xff, 0xff,
+    0xff, 0xfd, 0x30, 0x0, 0x0, 0x0, 0x0, 0x1b,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xa1, 0x0, 0x0,
+    0x0, 0x0, 0x1b, 0xff, 0xff, 0xfd, 0xaf, 0xff,
+    0xf6, 0x0, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xff,
+    0xe4, 0x1c, 0xff, 0xfd, 0x30, 0x0, 0x0, 0x0,
+    0x1b, 0xff, 0xfc, 0x30, 0x4, 0xdf, 0xff, 0xb1,
+    0x0, 0x0, 0x0, 0x1b, 0xff, 0xf7, 0x0, 0x1,
+    0x8f, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x1b, 0xff,
+    0xf7, 0x0, 0x0, 0x1d, 0xff, 0xfd, 0x40, 0x0,
+    0x0, 0x1b, 0xff, 0xf7, 0x0, 0x0, 0x5, 0xef,
+    0xff, 0xa1, 0x0, 0x0, 0x1b, 0xff, 0xf7, 0x0,
+    0x0, 0x1, 0x9f, 0xff, 0xf7, 0x0, 0x0, 0x1b,
+    0xff, 0xf7, 0x0, 0x0, 0x0, 0x2d, 0xff, 0xfe,
+    0x30, 0x0, 0x1b, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x5, 0xff, 0xff, 0xa1, 0x0, 0x1b, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x1, 0x9f, 0xff, 0xf7, 0x0,
+    0x1b, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x2d,
+    0xff, 0xfe, 0x30, 0x1b, 0xff, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xff, 0xb1, 0x1b, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x1, 0xaf, 0xff,
+    0xf7,
+
+    /* U+006C "l" */
+    0x13, 0x44, 0x41, 0x2c, 0xff, 0xe5, 0x2c, 0xff,
+    0xe5, 0x2c, 0xff, 0xe5, 0x2c, 0xff, 0xe5, 0x2c,
+    0xff, 0xe5, 0x2c, 0xff, 0xe5, 0x2c, 0xff, 0xe5,
+    0x2c, 0xff, 0xe5, 0x2c, 0xff, 0xe5, 0x2c, 0xff,
+    0xe5, 0x2c, 0xff, 0xe5, 0x2c, 0xff, 0xe5, 0x2c,
+    0xff, 0xe5, 0x2c, 0xff, 0xe5, 0x2c, 0xff, 0xe5,
+    0x2c, 0xff, 0xe5, 0x2c, 0xff, 0xe5, 0x2c, 0xff,
+    0xe5, 0x2c, 0xff, 0xe5, 0x2c, 0xff, 0xe5, 0x2c,
+    0xff, 0xe5, 0x2c, 0xff, 0xe5, 0x2c, 0xff, 0xe5,
+    0x2c, 0xff, 0xe5, 0x2c, 0xff, 0xe5, 0x2c, 0xff,
+    0xe5, 0x2c, 0xff, 0xe5, 0x2c, 0xff, 0xe5, 0x2c,
+    0xff, 0xe5, 0x2c, 0xff, 0xe5, 0x2c, 0xff, 0xe5,
+    0x2c, 0xff, 0xe5, 0x2c, 0xff, 0xe5, 0x2c, 0xff,
+    0xe5,
+
+    /* U+006D "m" */
+    0x1, 0x11, 0x10, 0x0, 0x2, 0x45, 0x65, 0x42,
+    0x0, 0x0, 0x0, 0x0, 0x24, 0x55, 0x53, 0x10,
+    0x0, 0x1, 0x8b, 0xba, 0x10, 0x17, 0xcd, 0xff,
+    0xfe, 0xc7, 0x10, 0x0, 0x2, 0x8c, 0xef, 0xfe,
+    0xdb, 0x50, 0x0, 0x2b, 0xff, 0xd1, 0x4d, 0xff,
+    0xff, 0xff, 0xff, 0xfc, 0x20, 0x5, 0xef, 0xff,
+    0xff, 0xff, 0xff, 0xa1, 0x2, 0xbf, 0xfd, 0x5d,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x15, 0xef,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x2b, 0xff,
+    0xfd, 0xff, 0xd9, 0x65, 0x59, 0xef, 0xff, 0xf8,
+    0xef, 0xfc, 0x85, 0x57, 0xbf, 0xff, 0xfd, 0x32,
+    0xbf, 0xff, 0xff, 0xb4, 0x0, 0x0, 0x6, 0xef,
+    0xff, 0xff, 0xf8, 0x20, 0x0, 0x1, 0x9f, 0xff,
+    0xf6, 0x2b, 0xff, 0xff, 0xc1, 0x0, 0x0, 0x0,
+    0xa, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x1,
+    0xcf, 0xff, 0xa2, 0xbf, 0xff, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x5f, 0xff, 0xfc, 0x20, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0xfc, 0x2b, 0xff, 0xfc, 0x20,
+    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xff, 0xd2, 0xbf, 0xff,
+    0x91, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xfd, 0x2b,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef,
+    0xfe, 0x40, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
+    0xd2, 0xbf, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0x2e, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0xfd, 0x2b, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xef, 0xfe, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x5f, 0xff, 0xd2, 0xbf, 0xff, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0x2e, 0xff, 0xe3, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xfd, 0x2b, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0xfe, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xd2, 0xbf,
+    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff,
+    0xe3, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xfd,
+    0x2b, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xef, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x5f,
+    0xff, 0xd2, 0xbf, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x2e, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xff, 0xfd, 0x2b, 0xff, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xef, 0xfe, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x5f, 0xff, 0xd2, 0xbf, 0xff, 0x70,
+    0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xe3, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0xfd, 0x2b, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0xfe,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xd2,
+    0xbf, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x2e,
+    0xff, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0xfd, 0x2b, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xef, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x5f, 0xff, 0xd2, 0xbf, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x2e, 0xff, 0xe3, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0xfd, 0x2b, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xef, 0xfe, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xff, 0xd2, 0xbf, 0xff,
+    0x70, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xe3,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xfd,
+
+    /* U+006E "n" */
+    0x1, 0x11, 0x10, 0x0, 0x1, 0x35, 0x55, 0x53,
+    0x10, 0x0, 0x0, 0x18, 0xbb, 0xa1, 0x1, 0x6b,
+    0xde, 0xff, 0xed, 0xb5, 0x0, 0x0, 0x2b, 0xff,
+    0xd1, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb2,
+    0x0, 0x2b, 0xff, 0xd4, 0xcf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfb, 0x0, 0x2b, 0xff, 0xed, 0xff,
+    0xea, 0x75, 0x57, 0xbe, 0xff, 0xff, 0x60, 0x2b,
+    0xff, 0xff, 0xfc, 0x50, 0x0, 0x0, 0x17, 0xef,
+    0xff, 0xb1, 0x2b, 0xff, 0xff, 0xc1, 0x0, 0x0,
+    0x0, 0x1, 0x9f, 0xff, 0xd3, 0x2b, 0xff, 0xfe,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xff, 0xf4,
+    0x2b, 0xff, 0xfb, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x2d, 0xff, 0xf5, 0x2b, 0xff, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1c, 0xff, 0xf5, 0x2b, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
+    0xf5, 0x2b, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0xff, 0xf5, 0x2b, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf5, 0x2b,
+    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0xff, 0xf5, 0x2b, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0xff, 0xf5, 0x2b, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf5,
+    0x2b, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0xff, 0xf5, 0x2b, 0xff, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xc, 0xff, 0xf5, 0x2b, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
+    0xf5, 0x2b, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0xff, 0xf5, 0x2b, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf5, 0x2b,
+    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0xff, 0xf5, 0x2b, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0xff, 0xf5, 0x2b, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf5,
+    0x2b, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0xff, 0xf5, 0x2b, 0xff, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xc, 0xff, 0xf5,
+
+    /* U+006F "o" */
+    0x0, 0x0, 0x0, 0x0, 0x13, 0x55, 0x65, 0x42,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0x7b, 0xde, 0xff, 0xfe, 0xca, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x16, 0xef, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xa3, 0x0, 0x0, 0x0, 0x0, 0x18,
+    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc4,
+    0x0, 0x0, 0x0, 0x19, 0xff, 0xff, 0xea, 0x53,
+    0x24, 0x8c, 0xff, 0xff, 0xd3, 0x0, 0x0, 0x6,
+    0xef, 0xff, 0xd4, 0x10, 0x0, 0x0, 0x29, 0xff,
+    0xff, 0xb2, 0x0, 0x2, 0xcf, 0xff, 0xc3, 0x0,
+    0x0, 0x0, 0x0, 0x18, 0xff, 0xff, 0x70, 0x0,
+    0x5f, 0xff, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1b, 0xff, 0xfd, 0x0, 0xb, 0xff, 0xfc, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf3,
+    0x1, 0xef, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xdf, 0xff, 0x80, 0x3e, 0xff, 0xf4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1a, 0xff,
+    0xfa, 0x5, 0xff, 0xfe, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0xb1, 0x6f, 0xff,
+    0xd2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xfc, 0x16, 0xff, 0xfc, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xc2, 0x6f,
+    0xff, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xfb, 0x15, 0xff, 0xfe, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xb1,
+    0x4e, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1a, 0xff, 0xfa, 0x1, 0xef, 0xff, 0x60,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xff,
+    0x80, 0xc, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xff, 0xf5, 0x0, 0x7f, 0xff,
+    0xe3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xfe, 0x10, 0x3, 0xdf, 0xff, 0xb1, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xef, 0xff, 0x90, 0x0, 0x8,
+    0xff, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x5, 0xdf,
+    0xff, 0xd4, 0x0, 0x0, 0x1b, 0xff, 0xff, 0xc6,
+    0x21, 0x1, 0x48, 0xef, 0xff, 0xf6, 0x0, 0x0,
+    0x0, 0x3c, 0xff, 0xff, 0xed, 0xcb, 0xce, 0xff,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x2a, 0xef,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xc5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x16, 0xcf, 0xff, 0xff, 0xff,
+    0xfe, 0x83, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x26, 0x9a, 0xa9, 0x74, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+0070 "p" */
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x34, 0x44, 0x21,
+    0x0, 0x0, 0x0, 0x1, 0x8a, 0xa9, 0x10, 0x17,
+    0xbd, 0xee, 0xec, 0xa5, 0x0, 0x0, 0x0, 0x2b,
+    0xff, 0xd2, 0x4d, 0xff, 0xff, 0xff, 0xff, 0xfc,
+    0x30, 0x0, 0x2, 0xbf, 0xfd, 0x5d, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfd, 0x40, 0x0, 0x2b, 0xff,
+    0xfd, 0xff, 0xe9, 0x41, 0x25, 0xae, 0xff, 0xfd,
+    0x30, 0x2, 0xbf, 0xff, 0xff, 0xd5, 0x0, 0x0,
+    0x1, 0x7e, 0xff, 0xfa, 0x10, 0x2b, 0xff, 0xff,
+    0xe4, 0x0, 0x0, 0x0, 0x0, 0x7e, 0xff, 0xe5,
+    0x2, 0xbf, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xbf, 0xff, 0xa0, 0x2b, 0xff, 0xfc, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x12,
+    0xbf, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2e, 0xff, 0xf5, 0x2b, 0xff, 0xe6, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xbf, 0xff, 0x82, 0xbf,
+    0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x19,
+    0xff, 0xfa, 0x2b, 0xff, 0xd2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0xb2, 0xbf, 0xfd,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0xfb, 0x2b, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xff, 0xa2, 0xbf, 0xfd, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x19, 0xff, 0xfa,
+    0x2b, 0xff, 0xe4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xbf, 0xff, 0x82, 0xbf, 0xfe, 0x60, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xf5, 0x2b,
+    0xff, 0xf9, 0x10, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0xff, 0x12, 0xbf, 0xff, 0xd3, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xff, 0xb0, 0x2b, 0xff,
+    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x6e, 0xff,
+    0xe5, 0x2, 0xbf, 0xff, 0xff, 0x71, 0x0, 0x0,
+    0x0, 0x4d, 0xff, 0xfb, 0x10, 0x2b, 0xff, 0xff,
+    0xff, 0xa4, 0x10, 0x13, 0x8e, 0xff, 0xfe, 0x30,
+    0x2, 0xbf, 0xff, 0xef, 0xff, 0xec, 0xbc, 0xdf,
+    0xff, 0xfe, 0x60, 0x0, 0x2b, 0xff, 0xf7, 0x9f,
+    0xff, 0xff, 0xff, 0xff, 0xfc, 0x50, 0x0, 0x2,
+    0xbf, 0xff, 0x71, 0x7e, 0xff, 0xff, 0xff, 0xe8,
+    0x30, 0x0, 0x0, 0x2b, 0xff, 0xf7, 0x0, 0x15,
+    0x8a, 0xa8, 0x50, 0x0, 0x0, 0x0, 0x2, 0xbf,
+    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2b, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xbf, 0xff,
+    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2b, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xbf, 0xff, 0x70,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2b, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xbf, 0xff, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2b,
+    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x79, 0x99, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+0071 "q" */
+    0x0, 0x0, 0x0, 0x0, 0x23, 0x55, 0x42, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x8c,
+    0xde, 0xee, 0xc9, 0x30, 0x6, 0xaa, 0xa3, 0x0,
+    0x0, 0x18, 0xff, 0xff, 0xff, 0xff, 0xff, 0x71,
+    0x9f, 0xff, 0x40, 0x0, 0x1a, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0x89, 0xff, 0xf4, 0x0, 0x1a,
+    0xff, 0xff, 0xc7, 0x21, 0x36, 0xcf, 0xff, 0xdf,
+    0xff, 0x40, 0x5, 0xef, 0xff, 0xb2, 0x0, 0x0,
+    0x2, 0x9f, 0xff, 0xff, 0xf4, 0x2, 0xbf, 0xff,
+    0xb2, 0x0, 0x0, 0x0, 0x1, 0xaf, 0xff, 0xff,
+    0x40, 0x5f, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xdf, 0xff, 0xf4, 0x9, 0xff, 0xfc, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0x40,
+    0xdf, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4e, 0xff, 0xf4, 0x2e, 0xff, 0xf4, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xcf, 0xff, 0x43, 0xef,
+    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xf4, 0x4f, 0xff, 0xe2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9f, 0xff, 0x45, 0xff, 0xfd,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xf4, 0x5f, 0xff, 0xe2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xff, 0x43, 0xef, 0xff, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xf4,
+    0x2e, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xbf, 0xff, 0x40, 0xef, 0xff, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1d, 0xff, 0xf4, 0xa,
+    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xef, 0xff, 0x40, 0x5f, 0xff, 0xe4, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x9f, 0xff, 0xf4, 0x2, 0xbf,
+    0xff, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xff,
+    0xff, 0x40, 0x6, 0xef, 0xff, 0xa1, 0x0, 0x0,
+    0x0, 0x3c, 0xff, 0xff, 0xf4, 0x0, 0x9, 0xff,
+    0xff, 0xc6, 0x21, 0x13, 0x7d, 0xff, 0xff, 0xff,
+    0x40, 0x0, 0x2b, 0xff, 0xff, 0xec, 0xbc, 0xdf,
+    0xff, 0xef, 0xff, 0xf4, 0x0, 0x0, 0x19, 0xef,
+    0xff, 0xff, 0xff, 0xff, 0xc5, 0xdf, 0xff, 0x40,
+    0x0, 0x0, 0x16, 0xcf, 0xff, 0xff, 0xff, 0xa3,
+    0x2d, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x37,
+    0xaa, 0x97, 0x20, 0x2, 0xdf, 0xff, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d,
+    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xdf, 0xff, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xff,
+    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xdf, 0xff, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xff, 0xf4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xdf, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2d, 0xff, 0xf4, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xdf, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x18, 0x99, 0x93,
+
+    /* U+0072 "r" */
+    0x1, 0x11, 0x10, 0x0, 0x25, 0x65, 0x30, 0x1,
+    0x8b, 0xb9, 0x0, 0x6c, 0xff, 0xec, 0x92, 0x2c,
+    0xff, 0xd1, 0x7f, 0xff, 0xff, 0xff, 0x72, 0xcf,
+    0xfd, 0x5e, 0xff, 0xff, 0xff, 0xd3, 0x2c, 0xff,
+    0xec, 0xff, 0xed, 0xde, 0xfa, 0x2, 0xcf, 0xff,
+    0xff, 0xc6, 0x32, 0x48, 0x40, 0x2c, 0xff, 0xff,
+    0xc2, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xff, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x2c, 0xff, 0xfc, 0x20,
+    0x0, 0x0, 0x0, 0x2, 0xcf, 0xff, 0x91, 0x0,
+    0x0, 0x0, 0x0, 0x2c, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xcf, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x2c, 0xff, 0xe6, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xcf, 0xfe, 0x60, 0x0, 0x0, 0x0,
+    0x0, 0x2c, 0xff, 0xe6, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xcf, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x2c, 0xff, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xcf, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x0, 0x2c,
+    0xff, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x2, 0xcf,
+    0xfe, 0x60, 0x0, 0x0, 0x0, 0x0, 0x2c, 0xff,
+    0xe6, 0x0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xfe,
+    0x60, 0x0, 0x0, 0x0, 0x0, 0x2c, 0xff, 0xe6,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xfe, 0x60,
+    0x0, 0x0, 0x0, 0x0, 0x2c, 0xff, 0xe6, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xcf, 0xfe, 0x60, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+0073 "s" */
+    0x0, 0x0, 0x0, 0x13, 0x45, 0x65, 0x53, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x16, 0xbd, 0xef,
+    0xff, 0xed, 0xb8, 0x20, 0x0, 0x0, 0x0, 0x4,
+    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x10,
+    0x0, 0x0, 0x4d, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0x80, 0x0, 0x2, 0xcf, 0xff, 0xd8,
+    0x42, 0x22, 0x59, 0xef, 0xff, 0xe4, 0x0, 0x6,
+    0xff, 0xfd, 0x30, 0x0, 0x0, 0x0, 0x6e, 0xff,
+    0xf9, 0x10, 0xa, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xfc, 0x20, 0xc, 0xff, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xdd, 0xb9, 0x20,
+    0xc, 0xff, 0xf9, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x22, 0x11, 0x0, 0x9, 0xff, 0xfe, 0x93, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xef,
+    0xff, 0xfd, 0xb7, 0x31, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x9f, 0xff, 0xff, 0xff, 0xfd, 0x86,
+    0x31, 0x0, 0x0, 0x0, 0x0, 0x1a, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0xda, 0x61, 0x0, 0x0, 0x0,
+    0x1, 0x6b, 0xef, 0xff, 0xff, 0xff, 0xff, 0xfd,
+    0x61, 0x0, 0x0, 0x0, 0x1, 0x47, 0xcf, 0xff,
+    0xff, 0xff, 0xff, 0xf8, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x6a, 0xce, 0xff, 0xff, 0xff, 0x60,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x8d,
+    0xff, 0xff, 0xc0, 0x0, 0x1, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xcf, 0xff, 0xe1, 0x37, 0x9a,
+    0x81, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
+    0xe2, 0x5e, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3f, 0xff, 0xe2, 0x1e, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xe0, 0xa,
+    0xff, 0xfe, 0x50, 0x0, 0x0, 0x0, 0x3, 0xdf,
+    0xff, 0x90, 0x3, 0xdf, 0xff, 0xe8, 0x42, 0x0,
+    0x13, 0x7d, 0xff, 0xfd, 0x30, 0x0, 0x7e, 0xff,
+    0xff, 0xdc, 0xbb, 0xcd, 0xff, 0xff, 0xe6, 0x0,
+    0x0, 0x7, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfd, 0x60, 0x0, 0x0, 0x0, 0x4a, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0x93, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x15, 0x89, 0xaa, 0x97, 0x41, 0x0, 0x0,
+    0x0,
+
+    /* U+0074 "t" */
+    0x0, 0x0, 0x0, 0x17, 0x20, 0x0, 0x0, 0x0,
+    0x1, 0x5c, 0xe3, 0x0, 0x0, 0x0, 0x1, 0x9e,
+    0xfe, 0x30, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xe3,
+    0x0, 0x0, 0x0, 0x2, 0xef, 0xfe, 0x30, 0x0,
+    0x0, 0x0, 0x2e, 0xff, 0xe3, 0x0, 0x0, 0x0,
+    0x2, 0xef, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x2e,
+    0xff, 0xe3, 0x0, 0x0, 0x14, 0x46, 0xef, 0xfe,
+    0x74, 0x44, 0x23, 0xde, 0xef, 0xff, 0xfe, 0xee,
+    0xe5, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0x54,
+    0xef, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x1, 0x13,
+    0xef, 0xfe, 0x41, 0x11, 0x0, 0x0, 0x2e, 0xff,
+    0xe3, 0x0, 0x0, 0x0, 0x2, 0xef, 0xfe, 0x30,
+    0x0, 0x0, 0x0, 0x2e, 0xff, 0xe3, 0x0, 0x0,
+    0x0, 0x2, 0xef, 0xfe, 0x30, 0x0, 0x0, 0x0,
+    0x2e, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x2, 0xef,
+    0xfe, 0x30, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xe3,
+    0x0, 0x0, 0x0, 0x2, 0xef, 0xfe, 0x30, 0x0,
+    0x0, 0x0, 0x2e, 0xff, 0xe3, 0x0, 0x0, 0x0,
+    0x2, 0xef, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x2e,
+    0xff, 0xe3, 0x0, 0x0, 0x0, 0x2, 0xef, 0xfe,
+    0x30, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xe3, 0x0,
+    0x0, 0x0, 0x2, 0xef, 0xfe, 0x30, 0x0, 0x0,
+    0x0, 0x2e, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x1,
+    0xef, 0xff, 0x40, 0x0, 0x0, 0x0, 0xd, 0xff,
+    0xfb, 0x21, 0x11, 0x0, 0x0, 0xcf, 0xff, 0xfe,
+    0xde, 0x60, 0x0, 0x7, 0xff, 0xff, 0xff, 0xf9,
+    0x0, 0x0, 0x19, 0xff, 0xff, 0xff, 0xc0, 0x0,
+    0x0, 0x16, 0xbe, 0xfe, 0xda,
+
+    /* U+0075 "u" */
+    0x18, 0xaa, 0xa4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x19, 0xaa, 0xa3, 0x2c, 0xff, 0xe5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2d, 0xff, 0xf4, 0x2c, 0xff,
+    0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xff,
+    0xf4, 0x2c, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2d, 0xff, 0xf4, 0x2c, 0xff, 0xe5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2d, 0xff, 0xf4, 0x2c,
+    0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d,
+    0xff, 0xf4, 0x2c, 0xff, 0xe5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2d, 0xff, 0xf4, 0x2c, 0xff, 0xe5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xff, 0xf4,
+    0x2c, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2d, 0xff, 0xf4, 0x2c, 0xff, 0xe5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2d, 0xff, 0xf4, 0x2c, 0xff,
+    0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xff,
+    0xf4, 0x2c, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2d, 0xff, 0xf4, 0x2c, 0xff, 0xe5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2d, 0xff, 0xf4, 0x2c,
+    0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d,
+    0xff, 0xf4, 0x2c, 0xff, 0xe5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2d, 0xff, 0xf4, 0x2c, 0xff, 0xe5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3d, 0xff, 0xf4,
+    0x2c, 0xff, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4e, 0xff, 0xf4, 0x2b, 0xff, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xff, 0xf4, 0x1b, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x1, 0xaf, 0xff,
+    0xf4, 0x9, 0xff, 0xfc, 0x20, 0x0, 0x0, 0x0,
+    0x5, 0xef, 0xff, 0xf4, 0x6, 0xff, 0xff, 0x81,
+    0x0, 0x0, 0x1, 0x5d, 0xff, 0xff, 0xf4, 0x2,
+    0xdf, 0xff, 0xfa, 0x52, 0x23, 0x59, 0xef, 0xfd,
+    0xff, 0xf4, 0x0, 0x8f, 0xff, 0xff, 0xed, 0xcd,
+    0xef, 0xff, 0x99, 0xff, 0xf4, 0x0, 0x18, 0xef,
+    0xff, 0xff, 0xff, 0xff, 0xe9, 0x18, 0xff, 0xf4,
+    0x0, 0x1, 0x6d, 0xff, 0xff, 0xff, 0xfd, 0x61,
+    0x8, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x37, 0x9a,
+    0xa8, 0x40, 0x0, 0x1, 0x11, 0x10,
+
+    /* U+0076 "v" */
+    0x3a, 0xaa, 0x93, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x29, 0xaa, 0xa3, 0x2c, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6e, 0xff, 0xc2,
+    0x9, 0xff, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x9f, 0xff, 0x90, 0x3, 0xef, 0xff, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0xfe, 0x40,
+    0x0, 0xcf, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0xfd, 0x0, 0x0, 0x6f, 0xff, 0xd1,
+    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf7, 0x0,
+    0x0, 0x3d, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0,
+    0x4e, 0xff, 0xd3, 0x0, 0x0, 0x9, 0xff, 0xf9,
+    0x10, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xa1, 0x0,
+    0x0, 0x5, 0xef, 0xfd, 0x20, 0x0, 0x0, 0x2,
+    0xcf, 0xfe, 0x50, 0x0, 0x0, 0x1, 0xdf, 0xff,
+    0x60, 0x0, 0x0, 0x4, 0xff, 0xfd, 0x10, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xc0, 0x0, 0x0, 0xa,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x3e, 0xff,
+    0xe2, 0x0, 0x0, 0x1e, 0xff, 0xf4, 0x0, 0x0,
+    0x0, 0x0, 0x1a, 0xff, 0xf8, 0x0, 0x0, 0x6f,
+    0xff, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x6, 0xef,
+    0xfb, 0x10, 0x1, 0xaf, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xcf, 0xfe, 0x40, 0x3, 0xef,
+    0xfd, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
+    0xff, 0x80, 0x7, 0xff, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0xff, 0xd0, 0xd, 0xff,
+    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b,
+    0xff, 0xf3, 0x3f, 0xff, 0xc1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0xf8, 0x8f, 0xff,
+    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xdf, 0xfc, 0xcf, 0xfd, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1d, 0xff, 0xff, 0xd1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xdf, 0xfe, 0x50,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+0077 "w" */
+    0x8a, 0xaa, 0x60, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xaa, 0xa6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9a,
+    0xaa, 0x37, 0xff, 0xfc, 0x10, 0x0, 0x0, 0x0,
+    0x3, 0xef, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x4e, 0xff, 0xc2, 0x4e, 0xff, 0xd3, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xff, 0xfe, 0x20, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xf9, 0x2, 0xbf, 0xff, 0x70,
+    0x0, 0x0, 0x0, 0x1a, 0xff, 0xff, 0xf6, 0x0,
+    0x0, 0x0, 0x1, 0xbf, 0xfe, 0x50, 0x9, 0xff,
+    0xf9, 0x10, 0x0, 0x0, 0x2, 0xcf, 0xff, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x2d, 0xff, 0xd1, 0x0,
+    0x4f, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x4e, 0xff,
+    0xff, 0xfb, 0x20, 0x0, 0x0, 0x5, 0xff, 0xfa,
+    0x0, 0x1, 0xdf, 0xff, 0x40, 0x0, 0x0, 0x7,
+    0xff, 0xed, 0xff, 0xe3, 0x0, 0x0, 0x0, 0xaf,
+    0xff, 0x50, 0x0, 0xa, 0xff, 0xf7, 0x0, 0x0,
+    0x0, 0xcf, 0xfb, 0x8f, 0xff, 0x60, 0x0, 0x0,
+    0x1d, 0xff, 0xd2, 0x0, 0x0, 0x5f, 0xff, 0xc0,
+    0x0, 0x0, 0x1f, 0xff, 0x84, 0xff, 0xfa, 0x0,
+    0x0, 0x5, 0xef, 0xfa, 0x10, 0x0, 0x3, 0xdf,
+    0xfd, 0x20, 0x0, 0x5, 0xff, 0xe5, 0x2d, 0xff,
+    0xe0, 0x0, 0x0, 0x8f, 0xfe, 0x60, 0x0, 0x0,
+    0x1a, 0xff, 0xe6, 0x0, 0x0, 0x9f, 0xfd, 0x21,
+    0xaf, 0xfe, 0x30, 0x0, 0x2b, 0xff, 0xd2, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0x90, 0x0, 0x1b, 0xff,
+    0xb0, 0x8, 0xff, 0xf7, 0x0, 0x3, 0xef, 0xfb,
+    0x0, 0x0, 0x0, 0x2, 0xef, 0xfc, 0x20, 0x4,
+    0xef, 0xf7, 0x0, 0x5e, 0xff, 0xa0, 0x0, 0x7f,
+    0xff, 0x60, 0x0, 0x0, 0x0, 0xc, 0xff, 0xe3,
+    0x0, 0x6f, 0xff, 0x30, 0x2, 0xdf, 0xfc, 0x20,
+    0xc, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0x70, 0xa, 0xff, 0xd1, 0x0, 0xa, 0xff,
+    0xe4, 0x2, 0xef, 0xfb, 0x10, 0x0, 0x0, 0x0,
+    0x3, 0xef, 0xfb, 0x0, 0xef, 0xfa, 0x10, 0x0,
+    0x6f, 0xff, 0x70, 0x6f, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x1b, 0xff, 0xe1, 0x3f, 0xff, 0x60,
+    0x0, 0x2, 0xff, 0xfb, 0xa, 0xff, 0xe4, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xfe, 0x57, 0xff,
+    0xe4, 0x0, 0x0, 0x1c, 0xff, 0xe2, 0xcf, 0xfc,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x5, 0xef, 0xf9,
+    0xbf, 0xfc, 0x20, 0x0, 0x0, 0x9f, 0xff, 0x9e,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d,
+    0xff, 0xde, 0xff, 0x90, 0x0, 0x0, 0x6, 0xff,
+    0xfe, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x3d, 0xff, 0xff, 0xfd, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0x20, 0x0,
+    0x0, 0x1, 0xbf, 0xff, 0xff, 0x90, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xe5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xaf, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xfc,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x1, 0xef,
+    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+0078 "x" */
+    0x1, 0x11, 0x11, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x11, 0x11, 0x10, 0x7, 0xbb, 0xbb, 0x70,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xbb, 0xbb, 0x70,
+    0x2, 0xdf, 0xff, 0xe4, 0x0, 0x0, 0x0, 0x0,
+    0x2d, 0xff, 0xfd, 0x20, 0x0, 0x6e, 0xff, 0xfb,
+    0x10, 0x0, 0x0, 0x1, 0x9f, 0xff, 0xe5, 0x0,
+    0x0, 0x19, 0xff, 0xff, 0x80, 0x0, 0x0, 0x7,
+    0xff, 0xff, 0x81, 0x0, 0x0, 0x2, 0xcf, 0xff,
+    0xe3, 0x0, 0x0, 0x3e, 0xff, 0xfb, 0x10, 0x0,
+    0x0, 0x0, 0x4e, 0xff, 0xfa, 0x10, 0x2, 0xbf,
+    0xff, 0xd3, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0xff, 0x70, 0x8, 0xff, 0xfe, 0x60, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xbf, 0xff, 0xe2, 0x5e, 0xff,
+    0xf9, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3d,
+    0xff, 0xfb, 0xcf, 0xff, 0xb1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xef, 0xff, 0xff, 0xfd,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0x9f, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2d, 0xff, 0xff, 0xa1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1c, 0xff, 0xff, 0xb1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xef, 0xff, 0xff, 0xfe, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2c, 0xff, 0xfc, 0xcf, 0xff,
+    0xc2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x9f,
+    0xff, 0xe3, 0x3e, 0xff, 0xf9, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xef, 0xff, 0x80, 0x8, 0xff,
+    0xfe, 0x60, 0x0, 0x0, 0x0, 0x0, 0x3d, 0xff,
+    0xfb, 0x20, 0x2, 0xbf, 0xff, 0xd3, 0x0, 0x0,
+    0x0, 0x1, 0xbf, 0xff, 0xe3, 0x0, 0x0, 0x4e,
+    0xff, 0xfb, 0x10, 0x0, 0x0, 0x7, 0xff, 0xff,
+    0x70, 0x0, 0x0, 0x8, 0xff, 0xff, 0x70, 0x0,
+    0x0, 0x4e, 0xff, 0xfb, 0x10, 0x0, 0x0, 0x2,
+    0xbf, 0xff, 0xe4, 0x0, 0x1, 0xcf, 0xff, 0xe4,
+    0x0, 0x0, 0x0, 0x0, 0x4e, 0xff, 0xfc, 0x10,
+    0x19, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xff, 0x91, 0x5e, 0xff, 0xfb, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xff, 0xe5,
+
+    /* U+0079 "y" */
+    0x29, 0xaa, 0xa5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xaa, 0xa5, 0x1a, 0xff, 0xfa, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3d, 0xff, 0xe3,
+    0x6, 0xff, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xb1, 0x1, 0xef, 0xff, 0x70,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xbf, 0xff, 0x60,
+    0x0, 0xaf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xef, 0xfe, 0x10, 0x0, 0x5f, 0xff, 0xe4,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xfa, 0x0,
+    0x0, 0x2c, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x1d, 0xff, 0xf5, 0x0, 0x0, 0x8, 0xff, 0xfc,
+    0x20, 0x0, 0x0, 0x0, 0x5e, 0xff, 0xc2, 0x0,
+    0x0, 0x3, 0xef, 0xff, 0x50, 0x0, 0x0, 0x1,
+    0x9f, 0xff, 0x80, 0x0, 0x0, 0x0, 0xbf, 0xff,
+    0x90, 0x0, 0x0, 0x2, 0xdf, 0xfe, 0x30, 0x0,
+    0x0, 0x0, 0x5f, 0xff, 0xe1, 0x0, 0x0, 0x6,
+    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xff,
+    0xf6, 0x0, 0x0, 0xb, 0xff, 0xf6, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xfa, 0x10, 0x0, 0x3e,
+    0xff, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x5, 0xef,
+    0xfd, 0x30, 0x0, 0x7f, 0xff, 0x91, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xcf, 0xff, 0x70, 0x2, 0xbf,
+    0xfe, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0xc0, 0x4, 0xef, 0xfc, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2e, 0xff, 0xf2, 0x8, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1a,
+    0xff, 0xf7, 0xd, 0xff, 0xe3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xef, 0xfa, 0x3f, 0xff,
+    0xb1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xdf, 0xfd, 0x9f, 0xff, 0x60, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xef, 0xfd,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1c, 0xff, 0xff, 0xf4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0xff, 0xc1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xdf, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xcf, 0xfd, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xef, 0xfb, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xe1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0x8f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x12, 0x0, 0x28, 0xef, 0xfd, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5d, 0xcd, 0xdf,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xff, 0xff, 0xff, 0xc1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0xff, 0xff,
+    0xfd, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2b, 0xef, 0xfd, 0xa3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x34, 0x43,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+007A "z" */
+    0x2, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0x30, 0x3, 0xef, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x40,
+    0x3, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0x40, 0x1, 0x9a, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xdf, 0xff, 0xfc, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xcf, 0xff, 0xc3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1b, 0xff, 0xfd, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xaf,
+    0xff, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x19, 0xff, 0xfe, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x7f, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xef, 0xff, 0xa1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xfa,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xdf, 0xff, 0xd3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3d, 0xff, 0xfd, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xbf, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2b, 0xff, 0xfe, 0x60, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x9f,
+    0xff, 0xf8, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x18, 0xff, 0xff, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7e, 0xff,
+    0xfb, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xef, 0xff, 0xc2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5d, 0xff, 0xfd,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xdf, 0xff, 0xd4, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2b, 0xff, 0xff, 0xb7,
+    0x78, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x71,
+    0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xc3, 0x3d, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3,
+    0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xc3,
+
+    /* U+007B "{" */
+    0x0, 0x0, 0x0, 0x0, 0x14, 0x67, 0x87, 0x10,
+    0x0, 0x0, 0x0, 0x4b, 0xef, 0xff, 0xd1, 0x0,
+    0x0, 0x0, 0x4d, 0xff, 0xff, 0xfd, 0x10, 0x0,
+    0x0, 0x1a, 0xff, 0xff, 0xff, 0xd1, 0x0, 0x0,
+    0x3, 0xff, 0xff, 0x94, 0x22, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
+    0xfe, 0x40, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
+    0xe4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xfe,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xe3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xfe, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xe3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xcf, 0xfd, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x1d, 0xff, 0xd3, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xdf, 0xfc, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x3d, 0xff, 0xb2, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xef, 0xfa, 0x10, 0x0, 0x0, 0x0,
+    0x1, 0x9f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x5e, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x35, 0x8e,
+    0xff, 0xe6, 0x0, 0x0, 0x0, 0x9, 0xef, 0xff,
+    0xe6, 0x10, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xc3,
+    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xfd, 0x81,
+    0x0, 0x0, 0x0, 0x0, 0x7c, 0xef, 0xff, 0xb2,
+    0x0, 0x0, 0x0, 0x0, 0x14, 0xcf, 0xff, 0x90,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xfe, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4e, 0xff, 0xa1, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xdf, 0xfc, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x1d, 0xff, 0xd3, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xdf, 0xfe, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0xff, 0xe3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xcf, 0xfe, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xcf, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0xff, 0xe4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
+    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
+    0xfc, 0x10, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff,
+    0xfc, 0x86, 0x50, 0x0, 0x0, 0x1, 0x9f, 0xff,
+    0xff, 0xfd, 0x10, 0x0, 0x0, 0x2, 0xbf, 0xff,
+    0xff, 0xd1, 0x0, 0x0, 0x0, 0x1, 0x8c, 0xef,
+    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x24, 0x44,
+    0x40,
+
+    /* U+007C "|" */
+    0x6a, 0xa9, 0x29, 0xff, 0xe3, 0x9f, 0xfe, 0x39,
+    0xff, 0xe3, 0x9f, 0xfe, 0x39, 0xff, 0xe3, 0x9f,
+    0xfe, 0x39, 0xff, 0xe3, 0x9f, 0xfe, 0x39, 0xff,
+    0xe3, 0x9f, 0xfe, 0x39, 0xff, 0xe3, 0x9f, 0xfe,
+    0x39, 0xff, 0xe3, 0x9f, 0xfe, 0x39, 0xff, 0xe3,
+    0x9f, 0xfe, 0x39, 0xff, 0xe3, 0x9f, 0xfe, 0x39,
+    0xff, 0xe3, 0x9f, 0xfe, 0x39, 0xff, 0xe3, 0x9f,
+    0xfe, 0x39, 0xff, 0xe3, 0x9f, 0xfe, 0x39, 0xff,
+    0xe3, 0x9f, 0xfe, 0x39, 0xff, 0xe3, 0x9f, 0xfe,
+    0x39, 0xff, 0xe3, 0x9f, 0xfe, 0x39, 0xff, 0xe3,
+    0x9f, 0xfe, 0x39, 0xff, 0xe3, 0x9f, 0xfe, 0x39,
+    0xff, 0xe3, 0x9f, 0xfe, 0x39, 0xff, 0xe3, 0x9f,
+    0xfe, 0x39, 0xff, 0xe3, 0x9f, 0xfe, 0x39, 0xff,
+    0xe3, 0x9f, 0xfe, 0x39, 0xff, 0xe3, 0x9f, 0xfe,
+    0x33, 0x44, 0x41,
+
+    /* U+007D "}" */
+    0x16, 0x87, 0x64, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x2c, 0xff, 0xfe, 0xb4, 0x0, 0x0, 0x0, 0x0,
+    0x2c, 0xff, 0xff, 0xfd, 0x40, 0x0, 0x0, 0x0,
+    0x2c, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x2, 0x24, 0x9e, 0xff, 0xe4, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x19, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xef, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xef, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xef, 0xfa, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xef, 0xfa, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xef, 0xfb, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xef, 0xfb, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xef, 0xfb, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xdf, 0xfb, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xdf, 0xfc, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xdf, 0xfc, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xdf, 0xfd, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xff, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xff, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2d, 0xff, 0xe5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xef, 0xfe, 0x95, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x6e, 0xff, 0xfe, 0x90,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xcf, 0xff, 0xa1,
+    0x0, 0x0, 0x0, 0x0, 0x18, 0xdf, 0xff, 0xa1,
+    0x0, 0x0, 0x0, 0x1, 0xbf, 0xff, 0xeb, 0x70,
+    0x0, 0x0, 0x0, 0x18, 0xff, 0xfc, 0x51, 0x0,
+    0x0, 0x0, 0x0, 0x3e, 0xff, 0xd2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xbf, 0xfe, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xdf, 0xfd, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xdf, 0xfc, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xdf, 0xfb, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xdf, 0xfb, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xdf, 0xfb, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xef, 0xfb, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xef, 0xfb, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xef, 0xfb, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xef, 0xfa, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xef, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2b, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x14, 0x68, 0xdf, 0xff, 0xe3, 0x0, 0x0, 0x0,
+    0x2c, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
+    0x2c, 0xff, 0xff, 0xfb, 0x20, 0x0, 0x0, 0x0,
+    0x2c, 0xff, 0xec, 0x81, 0x0, 0x0, 0x0, 0x0,
+    0x13, 0x44, 0x42, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+007E "~" */
+    0x0, 0x2, 0x68, 0x98, 0x63, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0x0, 0x3a, 0xee, 0xff,
+    0xff, 0xed, 0x73, 0x10, 0x0, 0x0, 0x0, 0x16,
+    0xd1, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea,
+    0x61, 0x0, 0x0, 0x38, 0xff, 0x1d, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0xd9, 0x78, 0xad,
+    0xff, 0xf1, 0xef, 0xff, 0xec, 0xbd, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1e, 0xfd,
+    0x63, 0x22, 0x24, 0x9d, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xa0, 0xea, 0x20, 0x0, 0x0, 0x0,
+    0x16, 0xbe, 0xff, 0xff, 0xff, 0xfd, 0x71, 0x8,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x1, 0x48, 0xce,
+    0xee, 0xc7, 0x30, 0x0,
+
+    /* U+00A0 " " */
+
+    /* U+00A1 "¡" */
+    0x4a, 0xaa, 0xa5, 0x6e, 0xff, 0xf7, 0x6e, 0xff,
+    0xf7, 0x6e, 0xff, 0xf7, 0x6e, 0xff, 0xf7, 0x12,
+    0x22, 0x21, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x44, 0x10, 0x5, 0xdd, 0x60, 0x7, 0xff,
+    0x80, 0x8, 0xff, 0x90, 0x9, 0xff, 0x90, 0xa,
+    0xff, 0xa0, 0xb, 0xff, 0xa1, 0xc, 0xff, 0xb1,
+    0xc, 0xff, 0xc2, 0x1d, 0xff, 0xc2, 0x2d, 0xff,
+    0xd3, 0x2d, 0xff, 0xe3, 0x3d, 0xff, 0xe4, 0x4e,
+    0xff, 0xf4, 0x5e, 0xff, 0xf5, 0x6e, 0xff, 0xf6,
+    0x7f, 0xff, 0xf7, 0x7f, 0xff, 0xf8, 0x8f, 0xff,
+    0xfa, 0x8f, 0xff, 0xfa, 0x8f, 0xff, 0xfa, 0x8f,
+    0xff, 0xfa, 0x8f, 0xff, 0xfa, 0x8f, 0xff, 0xfa,
+    0x8f, 0xff, 0xfa, 0x8f, 0xff, 0xfa, 0x59, 0x99,
+    0x96,
+
+    /* U+00A2 "¢" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x22, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x19, 0xc8, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xdf,
+    0xb1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfe, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xcf, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3e, 0xfa, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xaf, 0xe3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0x45, 0x65, 0x6d, 0xfb,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x29, 0xce,
+    0xff, 0xfe, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5,
+    0x10, 0x0, 0x0, 0x2, 0xbf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xe6, 0x0, 0x0, 0x2, 0xbf,
+    0xff, 0xfc, 0x62, 0x14, 0xef, 0xff, 0xff, 0xe4,
+    0x0, 0x0, 0x8f, 0xff, 0xf9, 0x20, 0x0, 0x7f,
+    0xf9, 0xef, 0xff, 0xa1, 0x0, 0x2d, 0xff, 0xfa,
+    0x10, 0x0, 0x1a, 0xfe, 0x26, 0xef, 0xfe, 0x40,
+    0x7, 0xff, 0xfd, 0x30, 0x0, 0x3, 0xdf, 0xa1,
+    0x1c, 0xff, 0xf8, 0x1, 0xbf, 0xff, 0x90, 0x0,
+    0x0, 0x5f, 0xf7, 0x0, 0x7d, 0xdb, 0x60, 0x3d,
+    0xff, 0xe6, 0x0, 0x0, 0xa, 0xfe, 0x40, 0x1,
+    0x20, 0x0, 0x4, 0xff, 0xfe, 0x30, 0x0, 0x0,
+    0xef, 0xc1, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
+    0xd1, 0x0, 0x0, 0x4f, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xff, 0xfd, 0x0, 0x0, 0x8, 0xff,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xd0,
+    0x0, 0x1, 0xbf, 0xe1, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xfd, 0x0, 0x0, 0x3d, 0xfa, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xd1, 0x0,
+    0x6, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0xfd, 0x20, 0x0, 0xaf, 0xd4, 0x0, 0x0,
+    0x1, 0x0, 0x0, 0x3e, 0xff, 0xe5, 0x0, 0x1e,
+    0xfb, 0x10, 0x0, 0x2, 0xde, 0xca, 0x12, 0xbf,
+    0xff, 0x80, 0x4, 0xff, 0x90, 0x0, 0x0, 0x5f,
+    0xff, 0xe0, 0x8, 0xff, 0xfc, 0x20, 0x9f, 0xf4,
+    0x0, 0x0, 0xa, 0xff, 0xfa, 0x0, 0x3e, 0xff,
+    0xf7, 0x1c, 0xfe, 0x10, 0x0, 0x5, 0xef, 0xfe,
+    0x50, 0x0, 0x9f, 0xff, 0xe9, 0xdf, 0xa0, 0x0,
+    0x3, 0xdf, 0xff, 0xb1, 0x0, 0x2, 0xcf, 0xff,
+    0xff, 0xf7, 0x1, 0x37, 0xef, 0xff, 0xe3, 0x0,
+    0x0, 0x4, 0xdf, 0xff, 0xff, 0xdb, 0xbd, 0xff,
+    0xff, 0xe5, 0x0, 0x0, 0x0, 0x3, 0xbf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xc4, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xaf, 0xff, 0xff, 0xff, 0xfe, 0x83,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0x99,
+    0xaa, 0x85, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xcf, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5e, 0xfa, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xbf, 0xd3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xfa,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xe3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1c, 0xed, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x15, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+00A3 "£" */
+    0x0, 0x0, 0x0, 0x0, 0x13, 0x6a, 0xde, 0xed,
+    0xb7, 0x31, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xe9, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5d, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xd5, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xef, 0xff, 0xfd, 0x98, 0x8a, 0xef,
+    0xff, 0xfd, 0x30, 0x0, 0x0, 0x0, 0x3d, 0xff,
+    0xfe, 0x92, 0x10, 0x1, 0x29, 0xef, 0xff, 0xb2,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0xf7, 0x10, 0x0,
+    0x0, 0x1, 0x8f, 0xff, 0xf6, 0x0, 0x0, 0x1,
+    0xdf, 0xff, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x1b,
+    0xff, 0xfc, 0x0, 0x0, 0x5, 0xef, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x20,
+    0x0, 0x7, 0xff, 0xfd, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xef, 0xff, 0x50, 0x0, 0x8, 0xff,
+    0xfc, 0x20, 0x0, 0x0, 0x0, 0x0, 0x1, 0x79,
+    0x64, 0x10, 0x0, 0x8, 0xff, 0xfd, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xef, 0xff,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xef, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xe1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x16, 0x88, 0xbf, 0xff, 0xf9, 0x88, 0x88, 0x88,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x3c, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x91, 0x0, 0x0,
+    0x0, 0x0, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x91, 0x0, 0x0, 0x0, 0x0, 0x2b,
+    0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xee, 0x81,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xef,
+    0xfe, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xdf, 0xff, 0x60, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xdf, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xdf, 0xff,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xef, 0xfd, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0xef, 0xfa, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x19, 0xff, 0xe5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3e, 0xff, 0xb1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xbf, 0xfd,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x18, 0xff, 0xe5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x9e,
+    0xff, 0xc9, 0xbc, 0xba, 0x95, 0x31, 0x10, 0x0,
+    0x1, 0x25, 0x10, 0x2b, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfd, 0xa8, 0x66, 0x79, 0xef, 0x60,
+    0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xa1, 0x9, 0xff, 0xfe,
+    0xdb, 0xa9, 0xab, 0xdf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xd3, 0x5, 0xff, 0xa5, 0x31, 0x0, 0x1,
+    0x35, 0xae, 0xff, 0xff, 0xff, 0xfe, 0x82, 0x0,
+    0x72, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x37,
+    0xaa, 0xa8, 0x41, 0x0,
+
+    /* U+00A4 "¤" */
+    0x0, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x11, 0x0, 0x0, 0x6d, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xab, 0x20,
+    0x6, 0xef, 0xe5, 0x0, 0x15, 0x9b, 0xba, 0x73,
+    0x10, 0x1a, 0xff, 0xb1, 0x1d, 0xff, 0xfe, 0x68,
+    0xef, 0xff, 0xff, 0xff, 0xb5, 0xbf, 0xff, 0xf7,
+    0x6, 0xef, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xb1, 0x0, 0x4d, 0xff, 0xff,
+    0xff, 0xfe, 0xde, 0xff, 0xff, 0xff, 0xf9, 0x10,
+    0x0, 0x5, 0xff, 0xff, 0xfb, 0x64, 0x45, 0x8e,
+    0xff, 0xff, 0xb1, 0x0, 0x0, 0x7, 0xff, 0xfe,
+    0x61, 0x0, 0x0, 0x3, 0xbf, 0xff, 0xe1, 0x0,
+    0x0, 0x1d, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x3c, 0xff, 0xf7, 0x0, 0x0, 0x5e, 0xff, 0xb1,
+    0x0, 0x0, 0x0, 0x0, 0x6, 0xef, 0xfb, 0x10,
+    0x0, 0x8f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xdf, 0xfd, 0x30, 0x0, 0x9f, 0xfe, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xfe, 0x30,
+    0x0, 0x9f, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xcf, 0xfe, 0x40, 0x0, 0x9f, 0xfe, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xfd, 0x30,
+    0x0, 0x6f, 0xff, 0x91, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xef, 0xfb, 0x20, 0x0, 0x3e, 0xff, 0xe3,
+    0x0, 0x0, 0x0, 0x0, 0x19, 0xff, 0xf9, 0x0,
+    0x0, 0xa, 0xff, 0xfc, 0x30, 0x0, 0x0, 0x1,
+    0x8f, 0xff, 0xe3, 0x0, 0x0, 0x4, 0xff, 0xff,
+    0xc6, 0x0, 0x0, 0x3a, 0xff, 0xff, 0xb0, 0x0,
+    0x0, 0x2b, 0xff, 0xff, 0xff, 0xec, 0xbd, 0xff,
+    0xff, 0xff, 0xe5, 0x0, 0x2, 0xaf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x60,
+    0xb, 0xff, 0xff, 0xbc, 0xff, 0xff, 0xff, 0xff,
+    0xea, 0xdf, 0xff, 0xe5, 0x1a, 0xff, 0xf9, 0x12,
+    0x6a, 0xdf, 0xfe, 0xc8, 0x40, 0x4d, 0xff, 0xe4,
+    0x2, 0xae, 0x91, 0x0, 0x1, 0x22, 0x22, 0x10,
+    0x0, 0x4, 0xdd, 0x50, 0x0, 0x16, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x45, 0x0,
+
+    /* U+00A5 "¥" */
+    0x44, 0x44, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0x44, 0x44, 0x19, 0xff, 0xfd,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xcf, 0xff, 0xe2, 0x3d, 0xff, 0xf9, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf8,
+    0x0, 0x7f, 0xff, 0xe4, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2d, 0xff, 0xfc, 0x20, 0x1, 0xdf,
+    0xff, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0xff, 0x50, 0x0, 0x5, 0xef, 0xfe, 0x60,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xdf, 0xff, 0xc0,
+    0x0, 0x0, 0x1a, 0xff, 0xfc, 0x20, 0x0, 0x0,
+    0x0, 0x1, 0x9f, 0xff, 0xe4, 0x0, 0x0, 0x0,
+    0x3e, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x4e,
+    0xff, 0xf9, 0x10, 0x0, 0x0, 0x0, 0x9f, 0xff,
+    0xd2, 0x0, 0x0, 0x0, 0xa, 0xff, 0xfe, 0x20,
+    0x0, 0x0, 0x0, 0x2, 0xcf, 0xff, 0x91, 0x0,
+    0x0, 0x5, 0xef, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xfe, 0x40, 0x0, 0x1, 0xaf,
+    0xff, 0xc2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b,
+    0xff, 0xfb, 0x0, 0x0, 0x6f, 0xff, 0xe5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf5,
+    0x0, 0x1d, 0xff, 0xfb, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x9f, 0xff, 0xb2, 0x7, 0xff,
+    0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xdf, 0xff, 0x62, 0xcf, 0xff, 0x91, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xfc, 0x8f, 0xff, 0xd3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1d, 0xff, 0xfe, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7c, 0xcc,
+    0xcc, 0xcd, 0xef, 0xff, 0xff, 0xff, 0xdc, 0xcc,
+    0xcc, 0xcb, 0x20, 0x9, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3,
+    0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfd, 0x30, 0x5, 0x99,
+    0x99, 0x99, 0x99, 0x9e, 0xff, 0xfb, 0x99, 0x99,
+    0x99, 0x99, 0x82, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xcf, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
+    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0x60, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xce, 0xff, 0xfd, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xa2, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x30, 0x9,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xd3, 0x0, 0x47, 0x77, 0x77,
+    0x77, 0x77, 0xef, 0xff, 0xa7, 0x77, 0x77, 0x77,
+    0x76, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0x60,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0xff, 0xf6, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xcf, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xcf, 0xff, 0x60, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0,
+
+    /* U+00A6 "¦" */
+    0x8e, 0xed, 0x39, 0xff, 0xe3, 0x9f, 0xfe, 0x39,
+    0xff, 0xe3, 0x9f, 0xfe, 0x39, 0xff, 0xe3, 0x9f,
+    0xfe, 0x39, 0xff, 0xe3, 0x9f, 0xfe, 0x39, 0xff,
+    0xe3, 0x9f, 0xfe, 0x39, 0xff, 0xe3, 0x9f, 0xfe,
+    0x39, 0xff, 0xe3, 0x9f, 0xfe, 0x39, 0xff, 0xe3,
+    0x9f, 0xfe, 0x39, 0xff, 0xe3, 0x58, 0x87, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x23, 0x33, 0x19, 0xff, 0xe3, 0x9f, 0xfe,
+    0x39, 0xff, 0xe3, 0x9f, 0xfe, 0x39, 0xff, 0xe3,
+    0x9f, 0xfe, 0x39, 0xff, 0xe3, 0x9f, 0xfe, 0x39,
+    0xff, 0xe3, 0x9f, 0xfe, 0x39, 0xff, 0xe3, 0x9f,
+    0xfe, 0x39, 0xff, 0xe3, 0x9f, 0xfe, 0x39, 0xff,
+    0xe3, 0x9f, 0xfe, 0x39, 0xff, 0xe3, 0x9f, 0xfe,
+    0x33, 0x44, 0x41,
+
+    /* U+00A7 "§" */
+    0x0, 0x0, 0x0, 0x0, 0x13, 0x44, 0x44, 0x31,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x16,
+    0xbd, 0xff, 0xfe, 0xdb, 0x72, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xcf, 0xff, 0xff, 0xff, 0xff,
+    0xfd, 0x50, 0x0, 0x0, 0x0, 0x0, 0x3d, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xe5, 0x0, 0x0,
+    0x0, 0x2, 0xbf, 0xff, 0xeb, 0x53, 0x24, 0xae,
+    0xff, 0xfd, 0x30, 0x0, 0x0, 0x5, 0xff, 0xff,
+    0x71, 0x0, 0x0, 0x17, 0xef, 0xff, 0x90, 0x0,
+    0x0, 0xa, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x1,
+    0xbf, 0xff, 0xe1, 0x0, 0x0, 0xc, 0xff, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf4, 0x0,
+    0x0, 0xc, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x2d, 0xee, 0xd5, 0x0, 0x0, 0xa, 0xff, 0xfb,
+    0x10, 0x0, 0x0, 0x0, 0x2, 0x10, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0xff, 0x71, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xaf, 0xff,
+    0xfa, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3d, 0xff, 0xff, 0xc5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xef,
+    0xff, 0xff, 0x82, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x7c, 0xff, 0xff, 0xff, 0xfc, 0x51,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2b, 0xff, 0xfc,
+    0xae, 0xff, 0xff, 0xea, 0x30, 0x0, 0x0, 0x0,
+    0x1, 0xaf, 0xfe, 0x81, 0x15, 0xdf, 0xff, 0xff,
+    0xd7, 0x10, 0x0, 0x0, 0x6, 0xff, 0xf9, 0x10,
+    0x0, 0x39, 0xef, 0xff, 0xff, 0xc3, 0x0, 0x0,
+    0xc, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x6c, 0xff,
+    0xff, 0xfd, 0x60, 0x0, 0x1e, 0xff, 0xb1, 0x0,
+    0x0, 0x0, 0x2, 0x9e, 0xff, 0xff, 0xe6, 0x0,
+    0x2e, 0xff, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xcf, 0xff, 0xfe, 0x50, 0xe, 0xff, 0xe2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3b, 0xff, 0xff, 0xb0,
+    0xb, 0xff, 0xf9, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xaf, 0xff, 0xf3, 0x5, 0xff, 0xff, 0x81,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0xff, 0xf6,
+    0x1, 0xaf, 0xff, 0xfb, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x9, 0xff, 0xf7, 0x0, 0x3d, 0xff, 0xff,
+    0xd7, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xf6,
+    0x0, 0x3, 0xcf, 0xff, 0xff, 0xc4, 0x10, 0x0,
+    0x0, 0x1b, 0xff, 0xf2, 0x0, 0x0, 0x29, 0xff,
+    0xff, 0xfe, 0x82, 0x0, 0x0, 0x5e, 0xff, 0xc0,
+    0x0, 0x0, 0x1, 0x6d, 0xff, 0xff, 0xfd, 0x51,
+    0x4, 0xdf, 0xfd, 0x40, 0x0, 0x0, 0x0, 0x2,
+    0x9e, 0xff, 0xff, 0xea, 0x9e, 0xff, 0xd4, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x14, 0xcf, 0xff, 0xff,
+    0xff, 0xe8, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x17, 0xef, 0xff, 0xff, 0xa1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4c, 0xff,
+    0xff, 0xf9, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8e, 0xff, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x16,
+    0xef, 0xff, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4e, 0xff, 0xf8, 0x0,
+    0x0, 0x25, 0x79, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x19, 0xff, 0xfb, 0x10, 0x0, 0x8e, 0xff, 0xc2,
+    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xfb, 0x20,
+    0x0, 0x6e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xfb, 0x10, 0x0, 0x1d, 0xff, 0xfc,
+    0x10, 0x0, 0x0, 0x0, 0x2c, 0xff, 0xf9, 0x0,
+    0x0, 0x8, 0xff, 0xff, 0xa2, 0x0, 0x0, 0x2,
+    0xaf, 0xff, 0xf4, 0x0, 0x0, 0x2, 0xcf, 0xff,
+    0xfd, 0x85, 0x45, 0x8c, 0xff, 0xff, 0xa0, 0x0,
+    0x0, 0x0, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfb, 0x20, 0x0, 0x0, 0x0, 0x3, 0xbe,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0xa2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x15, 0xac, 0xee, 0xff, 0xec,
+    0x94, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0x34, 0x44, 0x32, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+00A8 "¨" */
+    0x34, 0x44, 0x30, 0x0, 0x3, 0x44, 0x42, 0x9f,
+    0xff, 0xb1, 0x0, 0x1b, 0xff, 0xf8, 0x9f, 0xff,
+    0xb1, 0x0, 0x1b, 0xff, 0xf8, 0x9f, 0xff, 0xb1,
+    0x0, 0x1b, 0xff, 0xf8, 0x9f, 0xff, 0xb1, 0x0,
+    0x1b, 0xff, 0xf8, 0x58, 0x88, 0x61, 0x0, 0x6,
+    0x88, 0x84,
+
+    /* U+00A9 "©" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x34,
+    0x56, 0x65, 0x43, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0x9c, 0xef, 0xff, 0xff, 0xed, 0xa7, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x16, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xea, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xbf, 0xff, 0xfe, 0xc9, 0x87, 0x78,
+    0xad, 0xff, 0xff, 0xe8, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x7e, 0xff, 0xec, 0x72, 0x11,
+    0x0, 0x0, 0x12, 0x4a, 0xef, 0xff, 0xc3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x18, 0xef, 0xfd, 0x71,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0xff,
+    0xfd, 0x40, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
+    0xa2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x5d, 0xff, 0xc3, 0x0, 0x0, 0x0, 0x6,
+    0xef, 0xe8, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xcf, 0xfb, 0x20, 0x0,
+    0x0, 0x3c, 0xff, 0x91, 0x0, 0x0, 0x1, 0x37,
+    0xab, 0xba, 0x72, 0x0, 0x0, 0x0, 0x4d, 0xff,
+    0x80, 0x0, 0x0, 0xaf, 0xfb, 0x10, 0x0, 0x1,
+    0x4c, 0xff, 0xff, 0xff, 0xff, 0x93, 0x0, 0x0,
+    0x5, 0xef, 0xe4, 0x0, 0x3, 0xef, 0xe4, 0x0,
+    0x0, 0x7, 0xef, 0xff, 0xfe, 0xef, 0xff, 0xfc,
+    0x20, 0x0, 0x1, 0xaf, 0xf9, 0x0, 0x9, 0xff,
+    0x90, 0x0, 0x0, 0x7f, 0xff, 0xc5, 0x10, 0x1,
+    0x7d, 0xff, 0xc2, 0x0, 0x0, 0x2e, 0xfe, 0x30,
+    0x2c, 0xff, 0x30, 0x0, 0x3, 0xdf, 0xfa, 0x20,
+    0x0, 0x0, 0x4, 0xdf, 0xf7, 0x0, 0x0, 0x19,
+    0xff, 0x60, 0x5f, 0xfb, 0x10, 0x0, 0x9, 0xff,
+    0xd1, 0x0, 0x0, 0x0, 0x0, 0x5e, 0xd9, 0x0,
+    0x0, 0x5, 0xef, 0xc0, 0x7f, 0xf7, 0x0, 0x0,
+    0x1d, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x15,
+    0x31, 0x0, 0x0, 0x2, 0xdf, 0xf1, 0xbf, 0xe5,
+    0x0, 0x0, 0x3f, 0xfd, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf3,
+    0xdf, 0xd3, 0x0, 0x0, 0x5f, 0xfb, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xf5, 0xef, 0xd3, 0x0, 0x0, 0x7f, 0xfb,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xf6, 0xef, 0xd3, 0x0, 0x0,
+    0x7f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xf6, 0xdf, 0xd3,
+    0x0, 0x0, 0x6f, 0xfb, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf5,
+    0xbf, 0xe5, 0x0, 0x0, 0x4f, 0xfc, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0x10, 0x0, 0x0, 0x0,
+    0xbf, 0xf4, 0x9f, 0xf6, 0x0, 0x0, 0x2f, 0xfe,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x19, 0xb7, 0x10,
+    0x0, 0x1, 0xcf, 0xf1, 0x5f, 0xfa, 0x10, 0x0,
+    0x1b, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x5e,
+    0xfe, 0x20, 0x0, 0x5, 0xef, 0xd0, 0x3d, 0xfe,
+    0x20, 0x0, 0x6, 0xef, 0xf5, 0x0, 0x0, 0x0,
+    0x1, 0xcf, 0xfa, 0x0, 0x0, 0x8, 0xff, 0x80,
+    0x9, 0xff, 0x80, 0x0, 0x1, 0x9f, 0xfe, 0x82,
+    0x10, 0x2, 0x5d, 0xff, 0xd3, 0x0, 0x0, 0x2d,
+    0xfe, 0x40, 0x5, 0xff, 0xd2, 0x0, 0x0, 0x2b,
+    0xff, 0xfc, 0xa9, 0x9b, 0xef, 0xff, 0x50, 0x0,
+    0x0, 0x8f, 0xfb, 0x10, 0x0, 0xbf, 0xfa, 0x10,
+    0x0, 0x2, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xc5,
+    0x0, 0x0, 0x4, 0xef, 0xe5, 0x0, 0x0, 0x4e,
+    0xff, 0x70, 0x0, 0x0, 0x4, 0x8c, 0xef, 0xfd,
+    0xa7, 0x20, 0x0, 0x0, 0x2c, 0xff, 0xa0, 0x0,
+    0x0, 0x8, 0xff, 0xe6, 0x0, 0x0, 0x0, 0x1,
+    0x22, 0x22, 0x10, 0x0, 0x0, 0x2, 0xbf, 0xfd,
+    0x30, 0x0, 0x0, 0x1, 0xaf, 0xfe, 0x71, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3b,
+    0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x2b, 0xff,
+    0xfa, 0x31, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x16, 0xdf, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x9f, 0xff, 0xe9, 0x51, 0x0, 0x0, 0x0,
+    0x0, 0x36, 0xcf, 0xff, 0xd5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x17, 0xdf, 0xff, 0xec, 0x96,
+    0x54, 0x45, 0x8b, 0xdf, 0xff, 0xfb, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x29, 0xdf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x61,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x38, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xeb,
+    0x52, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0x58, 0x9a, 0xa9,
+    0x74, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+00AA "ª" */
+    0x0, 0x0, 0x13, 0x68, 0x99, 0x86, 0x41, 0x0,
+    0x0, 0x0, 0x29, 0xdf, 0xff, 0xff, 0xfe, 0x92,
+    0x0, 0x0, 0x3c, 0xff, 0xfe, 0xdd, 0xef, 0xff,
+    0xc2, 0x0, 0xa, 0xff, 0xe9, 0x53, 0x46, 0xbf,
+    0xff, 0x60, 0x2, 0xef, 0xf8, 0x10, 0x0, 0x2,
+    0xbf, 0xfb, 0x0, 0x17, 0x9b, 0x30, 0x0, 0x0,
+    0x9, 0xff, 0xc1, 0x0, 0x1, 0x10, 0x0, 0x1,
+    0x12, 0x9f, 0xfc, 0x10, 0x0, 0x1, 0x35, 0x68,
+    0xac, 0xff, 0xff, 0xc1, 0x0, 0x15, 0xbd, 0xef,
+    0xff, 0xff, 0xff, 0xfc, 0x10, 0x19, 0xff, 0xff,
+    0xfe, 0xdc, 0xac, 0xff, 0xc1, 0x6, 0xff, 0xfe,
+    0xa6, 0x43, 0x20, 0x8f, 0xfc, 0x11, 0xaf, 0xfd,
+    0x30, 0x0, 0x0, 0xa, 0xff, 0xc1, 0x1b, 0xff,
+    0xa0, 0x0, 0x0, 0x2, 0xcf, 0xfc, 0x11, 0xbf,
+    0xfc, 0x10, 0x0, 0x1, 0xaf, 0xff, 0xc1, 0x9,
+    0xff, 0xe9, 0x31, 0x25, 0xaf, 0xff, 0xfc, 0x20,
+    0x3d, 0xff, 0xfe, 0xde, 0xef, 0xeb, 0xff, 0xd3,
+    0x0, 0x5d, 0xff, 0xff, 0xff, 0xc5, 0x1e, 0xfe,
+    0x60, 0x0, 0x27, 0xbd, 0xca, 0x52, 0x0, 0x57,
+    0x74,
+
+    /* U+00AB "«" */
+    0x0, 0x0, 0x0, 0x6, 0xaa, 0x81, 0x0, 0x0,
+    0x6a, 0xa8, 0x20, 0x0, 0x0, 0x5, 0xef, 0xf6,
+    0x0, 0x0, 0x4d, 0xff, 0x80, 0x0, 0x0, 0x1,
+    0xcf, 0xfc, 0x10, 0x0, 0x1b, 0xff, 0xd2, 0x0,
+    0x0, 0x1, 0x9f, 0xfe, 0x50, 0x0, 0x8, 0xff,
+    0xf6, 0x0, 0x0, 0x0, 0x5e, 0xff, 0xa1, 0x0,
+    0x4, 0xef, 0xfb, 0x10, 0x0, 0x0, 0x2d, 0xff,
+    0xe3, 0x0, 0x2, 0xbf, 0xfe, 0x40, 0x0, 0x0,
+    0x1a, 0xff, 0xf8, 0x0, 0x0, 0x9f, 0xff, 0x90,
+    0x0, 0x0, 0x6, 0xef, 0xfc, 0x30, 0x0, 0x5e,
+    0xff, 0xd3, 0x0, 0x0, 0x4, 0xef, 0xff, 0x60,
+    0x0, 0x3c, 0xff, 0xf7, 0x0, 0x0, 0x1, 0xbf,
+    0xff, 0xc1, 0x0, 0x9, 0xff, 0xfc, 0x20, 0x0,
+    0x0, 0x8f, 0xff, 0xf5, 0x0, 0x5, 0xff, 0xff,
+    0x50, 0x0, 0x0, 0x8, 0xff, 0xff, 0x50, 0x0,
+    0x5f, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x1b, 0xff,
+    0xfc, 0x10, 0x0, 0x9f, 0xff, 0xd2, 0x0, 0x0,
+    0x0, 0x3d, 0xff, 0xf6, 0x0, 0x2, 0xcf, 0xff,
+    0x70, 0x0, 0x0, 0x0, 0x6e, 0xff, 0xc3, 0x0,
+    0x4, 0xef, 0xfe, 0x30, 0x0, 0x0, 0x1, 0xaf,
+    0xff, 0x80, 0x0, 0x9, 0xff, 0xfa, 0x0, 0x0,
+    0x0, 0x2, 0xdf, 0xfe, 0x30, 0x0, 0x2b, 0xff,
+    0xe5, 0x0, 0x0, 0x0, 0x5, 0xef, 0xfa, 0x10,
+    0x0, 0x4e, 0xff, 0xb2, 0x0, 0x0, 0x0, 0x18,
+    0xff, 0xe5, 0x0, 0x0, 0x7f, 0xff, 0x60, 0x0,
+    0x0, 0x0, 0x1c, 0xff, 0xc1, 0x0, 0x1, 0xbf,
+    0xfe, 0x20, 0x0, 0x0, 0x0, 0x5e, 0xff, 0x50,
+    0x0, 0x4, 0xdf, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x69, 0x97, 0x10, 0x0, 0x5, 0x99, 0x82,
+
+    /* U+00AC "¬" */
+    0x4c, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xc5, 0x5f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
+    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf6, 0x5f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
+    0x12, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x2a, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0x66, 0x62,
+
+    /* U+00AD "­" */
+    0x47, 0x77, 0x77, 0x77, 0x77, 0x77, 0x73, 0x8f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x8f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf7, 0x8f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf7, 0x5b, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xbb, 0xb5,
+
+    /* U+00AE "®" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x34,
+    0x56, 0x65, 0x43, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0x9c, 0xef, 0xff, 0xff, 0xed, 0xa7, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x16, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xea, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xbf, 0xff, 0xfe, 0xc9, 0x87, 0x78,
+    0xad, 0xff, 0xff, 0xe8, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x7e, 0xff, 0xec, 0x72, 0x11,
+    0x0, 0x0, 0x12, 0x4a, 0xef, 0xff, 0xc3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x18, 0xef, 0xfd, 0x71,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0xff,
+    0xfd, 0x40, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
+    0xa2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x5d, 0xff, 0xc3, 0x0, 0x0, 0x0, 0x6,
+    0xef, 0xe8, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xcf, 0xfb, 0x20, 0x0,
+    0x0, 0x3c, 0xff, 0x91, 0x0, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x0, 0x0, 0x0, 0x0, 0x4d, 0xff,
+    0x80, 0x0, 0x0, 0xaf, 0xfb, 0x10, 0x2, 0xcf,
+    0xff, 0xff, 0xff, 0xed, 0xb7, 0x20, 0x0, 0x0,
+    0x5, 0xef, 0xe4, 0x0, 0x3, 0xef, 0xe4, 0x0,
+    0x2, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3,
+    0x0, 0x0, 0x1, 0xaf, 0xf9, 0x0, 0x9, 0xff,
+    0x90, 0x0, 0x2, 0xcf, 0xf9, 0x88, 0x88, 0xab,
+    0xef, 0xfd, 0x10, 0x0, 0x0, 0x2e, 0xfe, 0x30,
+    0x2c, 0xff, 0x30, 0x0, 0x2, 0xcf, 0xf1, 0x0,
+    0x0, 0x1, 0x7e, 0xff, 0x50, 0x0, 0x0, 0x19,
+    0xff, 0x60, 0x5f, 0xfb, 0x10, 0x0, 0x2, 0xcf,
+    0xf1, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xa0, 0x0,
+    0x0, 0x5, 0xef, 0xc0, 0x7f, 0xf7, 0x0, 0x0,
+    0x2, 0xcf, 0xf1, 0x0, 0x0, 0x0, 0xa, 0xff,
+    0xa0, 0x0, 0x0, 0x2, 0xdf, 0xf1, 0xbf, 0xe5,
+    0x0, 0x0, 0x2, 0xcf, 0xf1, 0x0, 0x0, 0x0,
+    0x2c, 0xff, 0x60, 0x0, 0x0, 0x0, 0xbf, 0xf3,
+    0xdf, 0xd3, 0x0, 0x0, 0x2, 0xcf, 0xf1, 0x0,
+    0x0, 0x14, 0xaf, 0xfe, 0x10, 0x0, 0x0, 0x0,
+    0x9f, 0xf5, 0xef, 0xd3, 0x0, 0x0, 0x2, 0xcf,
+    0xfd, 0xcc, 0xcc, 0xde, 0xff, 0xd6, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xf6, 0xef, 0xd3, 0x0, 0x0,
+    0x2, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xeb, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xf6, 0xdf, 0xd3,
+    0x0, 0x0, 0x2, 0xcf, 0xfc, 0xcd, 0xef, 0xfc,
+    0x42, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf5,
+    0xbf, 0xe5, 0x0, 0x0, 0x2, 0xcf, 0xf1, 0x0,
+    0x29, 0xff, 0xc3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0xf4, 0x9f, 0xf6, 0x0, 0x0, 0x2, 0xcf,
+    0xf1, 0x0, 0x1, 0x9f, 0xfb, 0x10, 0x0, 0x0,
+    0x0, 0x1, 0xcf, 0xf1, 0x5f, 0xfa, 0x10, 0x0,
+    0x2, 0xcf, 0xf1, 0x0, 0x0, 0x2b, 0xff, 0x91,
+    0x0, 0x0, 0x0, 0x5, 0xef, 0xd0, 0x3d, 0xfe,
+    0x20, 0x0, 0x2, 0xcf, 0xf1, 0x0, 0x0, 0x5,
+    0xff, 0xe5, 0x0, 0x0, 0x0, 0x8, 0xff, 0x80,
+    0x9, 0xff, 0x80, 0x0, 0x2, 0xcf, 0xf1, 0x0,
+    0x0, 0x1, 0x9f, 0xfd, 0x10, 0x0, 0x0, 0x2d,
+    0xfe, 0x40, 0x5, 0xff, 0xd2, 0x0, 0x2, 0xcf,
+    0xf1, 0x0, 0x0, 0x0, 0x3d, 0xff, 0x70, 0x0,
+    0x0, 0x8f, 0xfb, 0x10, 0x0, 0xbf, 0xfa, 0x10,
+    0x2, 0xcf, 0xf1, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xd4, 0x0, 0x4, 0xef, 0xe5, 0x0, 0x0, 0x4e,
+    0xff, 0x70, 0x2, 0x9b, 0xb1, 0x0, 0x0, 0x0,
+    0x1, 0xbb, 0xb7, 0x0, 0x2c, 0xff, 0xa0, 0x0,
+    0x0, 0x8, 0xff, 0xe6, 0x0, 0x11, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x11, 0x11, 0x2, 0xbf, 0xfd,
+    0x30, 0x0, 0x0, 0x1, 0xaf, 0xfe, 0x71, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3b,
+    0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x2b, 0xff,
+    0xfa, 0x31, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x16, 0xdf, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x9f, 0xff, 0xe9, 0x51, 0x0, 0x0, 0x0,
+    0x0, 0x36, 0xcf, 0xff, 0xd5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x17, 0xdf, 0xff, 0xec, 0x96,
+    0x54, 0x45, 0x8b, 0xdf, 0xff, 0xfb, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x29, 0xdf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x61,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x38, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xeb,
+    0x52, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0x58, 0x9a, 0xa9,
+    0x74, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+00AF "¯" */
+    0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x2b, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xe5, 0xbf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0x57, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0x93,
+
+    /* U+00B0 "°" */
+    0x0, 0x1, 0x4a, 0xdf, 0xe9, 0x50, 0x0, 0x0,
+    0x1, 0x8e, 0xff, 0xff, 0xfe, 0x81, 0x0, 0x0,
+    0x9f, 0xfd, 0xb9, 0xbd, 0xff, 0x90, 0x0, 0x4e,
+    0xfc, 0x40, 0x0, 0x4c, 0xff, 0x40, 0x19, 0xfe,
+    0x30, 0x0, 0x0, 0x3e, 0xfa, 0x2, 0xcf, 0xa1,
+    0x0, 0x0, 0x0, 0xaf, 0xc1, 0x2c, 0xf8, 0x0,
+    0x0, 0x0, 0x9, 0xfd, 0x22, 0xcf, 0xa1, 0x0,
+    0x0, 0x0, 0xaf, 0xc1, 0x1a, 0xfe, 0x30, 0x0,
+    0x0, 0x2e, 0xfa, 0x0, 0x5e, 0xfc, 0x30, 0x0,
+    0x3c, 0xff, 0x40, 0x1, 0xaf, 0xfd, 0xa8, 0xad,
+    0xff, 0xa1, 0x0, 0x1, 0x9e, 0xff, 0xff, 0xfe,
+    0x91, 0x0, 0x0, 0x1, 0x5b, 0xef, 0xea, 0x61,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x11, 0x0, 0x0,
+    0x0,
+
+    /* U+00B1 "±" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xac, 0xcc, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xcf, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xcf, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xcf, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xcf, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x13, 0x33, 0x33, 0x33,
+    0x33, 0xdf, 0xff, 0x53, 0x33, 0x33, 0x33, 0x32,
+    0x3e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf8, 0x3e, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0x3e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf8, 0x2b, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xef, 0xff, 0xbb, 0xbb, 0xbb, 0xbb, 0xb6,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xcf, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xcf, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xcf, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xcf, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xac, 0xcc, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x2c, 0xdd, 0xdd, 0xdd,
+    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xd7,
+    0x3e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf8, 0x3e, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0x3e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf8,
+
+    /* U+00B2 "²" */
+    0x0, 0x0, 0x25, 0x79, 0x98, 0x64, 0x20, 0x0,
+    0x0, 0x16, 0xcf, 0xff, 0xff, 0xfe, 0xb4, 0x0,
+    0x0, 0x8f, 0xff, 0xee, 0xde, 0xff, 0xfd, 0x40,
+    0x3, 0xef, 0xfc, 0x64, 0x45, 0xbf, 0xff, 0xa1,
+    0x9, 0xff, 0xe4, 0x0, 0x0, 0x1d, 0xff, 0xe1,
+    0x5, 0x89, 0x80, 0x0, 0x0, 0x9, 0xff, 0xf1,
+    0x0, 0x1, 0x10, 0x0, 0x0, 0x1c, 0xff, 0xd1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0x70,
+    0x0, 0x0, 0x0, 0x0, 0x17, 0xef, 0xfc, 0x20,
+    0x0, 0x0, 0x0, 0x2, 0xaf, 0xff, 0xc2, 0x0,
+    0x0, 0x0, 0x0, 0x3c, 0xff, 0xfc, 0x30, 0x0,
+    0x0, 0x0, 0x17, 0xef, 0xfe, 0x90, 0x0, 0x0,
+    0x0, 0x1, 0x9e, 0xff, 0xe6, 0x10, 0x0, 0x0,
+    0x0, 0x2a, 0xff, 0xfb, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0xff, 0xa2, 0x11, 0x11, 0x11, 0x10,
+    0x8, 0xff, 0xff, 0xed, 0xdd, 0xdd, 0xdd, 0xd2,
+    0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
+    0x4d, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xd2,
+
+    /* U+00B3 "³" */
+    0x0, 0x0, 0x35, 0x89, 0x98, 0x63, 0x0, 0x0,
+    0x0, 0x17, 0xdf, 0xff, 0xff, 0xfd, 0x80, 0x0,
+    0x0, 0x8f, 0xff, 0xed, 0xde, 0xff, 0xf8, 0x0,
+    0x3, 0xef, 0xfb, 0x42, 0x36, 0xdf, 0xfd, 0x30,
+    0x8, 0xde, 0xc2, 0x0, 0x0, 0x8f, 0xfe, 0x50,
+    0x1, 0x34, 0x40, 0x0, 0x0, 0x7f, 0xfe, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xcf, 0xfb, 0x20,
+    0x0, 0x0, 0x0, 0x16, 0x9d, 0xff, 0xc3, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0xff, 0xfb, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x5d, 0xdf, 0xff, 0xd5, 0x10,
+    0x0, 0x0, 0x0, 0x23, 0x35, 0xaf, 0xfe, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xc1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xf1,
+    0x2a, 0xde, 0x70, 0x0, 0x0, 0xb, 0xff, 0xf1,
+    0x1b, 0xff, 0xd4, 0x0, 0x1, 0x6f, 0xff, 0xc1,
+    0x5, 0xef, 0xfe, 0xb9, 0x9c, 0xef, 0xfe, 0x50,
+    0x0, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x0,
+    0x0, 0x4, 0xad, 0xee, 0xee, 0xd9, 0x30, 0x0,
+    0x0, 0x0, 0x1, 0x34, 0x43, 0x10, 0x0, 0x0,
+
+    /* U+00B4 "´" */
+    0x0, 0x18, 0xaa, 0xaa, 0x50, 0x4, 0xef, 0xff,
+    0xd2, 0x1, 0xaf, 0xff, 0xd4, 0x0, 0x3e, 0xff,
+    0xf5, 0x0, 0xa, 0xff, 0xf9, 0x0, 0x4, 0xef,
+    0xfa, 0x10, 0x0, 0x7d, 0xdc, 0x20, 0x0, 0x0,
+
+    /* U+00B5 "µ" */
+    0x3a, 0xaa, 0x81, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3a, 0xaa, 0x95, 0xef, 0xfc, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0xfd, 0x5e, 0xff, 0xc2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xd5,
+    0xef, 0xfc, 0x20, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0xfd, 0x5e, 0xff, 0xc2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xff, 0xd5, 0xef, 0xfc, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xfd, 0x5e,
+    0xff, 0xc2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xff, 0xd5, 0xef, 0xfc, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xfd, 0x5e, 0xff, 0xc2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xd5, 0xef,
+    0xfc, 0x20, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
+    0xfd, 0x5e, 0xff, 0xc2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xff, 0xd5, 0xef, 0xfc, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0xfd, 0x5e, 0xff,
+    0xc2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
+    0xd5, 0xef, 0xfc, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xff, 0xfd, 0x5e, 0xff, 0xd2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xff, 0xd5, 0xef, 0xfd,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xfd,
+    0x5e, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xff, 0xd5, 0xef, 0xff, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0xb, 0xff, 0xfd, 0x5e, 0xff, 0xfa,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xdf, 0xff, 0xd5,
+    0xef, 0xff, 0xe4, 0x0, 0x0, 0x0, 0x1, 0x9f,
+    0xff, 0xfd, 0x5e, 0xff, 0xff, 0xc3, 0x0, 0x0,
+    0x1, 0x8e, 0xff, 0xff, 0xd5, 0xef, 0xff, 0xff,
+    0xe8, 0x54, 0x47, 0xcf, 0xff, 0xff, 0xfd, 0x5e,
+    0xff, 0xff, 0xff, 0xfe, 0xde, 0xff, 0xff, 0xdd,
+    0xff, 0xd5, 0xef, 0xfc, 0x7e, 0xff, 0xff, 0xff,
+    0xff, 0xc4, 0xdf, 0xfd, 0x5e, 0xff, 0xc2, 0x6d,
+    0xff, 0xff, 0xff, 0xc3, 0x1d, 0xff, 0xd5, 0xef,
+    0xfc, 0x20, 0x15, 0x9a, 0xa8, 0x40, 0x0, 0x11,
+    0x11, 0x5e, 0xff, 0xc2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xef, 0xfc, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5e, 0xff,
+    0xc2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xef, 0xfc, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5e, 0xff, 0xc2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xef, 0xfc,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5e, 0xff, 0xc2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xef, 0xfc, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x39, 0x99, 0x71,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+00B6 "¶" */
+    0x0, 0x0, 0x0, 0x1, 0x33, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x0, 0x0, 0x0,
+    0x39, 0xbd, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xd1, 0x0, 0x3, 0xae, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0x10, 0x4, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xe1, 0x2, 0xdf,
+    0xff, 0xff, 0xff, 0xff, 0xfd, 0xcc, 0xcc, 0xef,
+    0xff, 0xec, 0xcb, 0x11, 0xaf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x50, 0x0, 0x7, 0xff, 0xf9, 0x0,
+    0x0, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
+    0x0, 0x0, 0x7f, 0xff, 0x90, 0x0, 0x8, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0x7,
+    0xff, 0xf9, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf5, 0x0, 0x0, 0x7f, 0xff, 0x90,
+    0x0, 0xe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x50, 0x0, 0x7, 0xff, 0xf9, 0x0, 0x0, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0,
+    0x7f, 0xff, 0x90, 0x0, 0xe, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x50, 0x0, 0x7, 0xff, 0xf9,
+    0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf5, 0x0, 0x0, 0x7f, 0xff, 0x90, 0x0, 0x9,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0,
+    0x7, 0xff, 0xf9, 0x0, 0x0, 0x5e, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x7f, 0xff,
+    0x90, 0x0, 0x1, 0xaf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x50, 0x0, 0x7, 0xff, 0xf9, 0x0, 0x0,
+    0x4, 0xef, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x0,
+    0x0, 0x7f, 0xff, 0x90, 0x0, 0x0, 0x6, 0xef,
+    0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0x7, 0xff,
+    0xf9, 0x0, 0x0, 0x0, 0x4, 0xbf, 0xff, 0xff,
+    0xff, 0xf5, 0x0, 0x0, 0x7f, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x2, 0x5a, 0xde, 0xef, 0xff, 0x50,
+    0x0, 0x7, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x18, 0xff, 0xf5, 0x0, 0x0, 0x7f,
+    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0x50, 0x0, 0x7, 0xff, 0xf9, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf5,
+    0x0, 0x0, 0x7f, 0xff, 0x90, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0x50, 0x0, 0x7,
+    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xf5, 0x0, 0x0, 0x7f, 0xff, 0x90,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0x50, 0x0, 0x7, 0xff, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7, 0xff, 0xf5, 0x0, 0x0,
+    0x7f, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0x50, 0x0, 0x7, 0xff, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xf5, 0x0, 0x0, 0x7f, 0xff, 0x90, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x50, 0x0,
+    0x7, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xf5, 0x0, 0x0, 0x7f, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0x50, 0x0, 0x7, 0xff, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf5, 0x0,
+    0x0, 0x7f, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0x50, 0x0, 0x7, 0xff,
+    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xf5, 0x0, 0x0, 0x7f, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x50,
+    0x0, 0x7, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0xf5, 0x0, 0x0, 0x7f,
+    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0x50, 0x0, 0x7, 0xff, 0xf9, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf5,
+    0x0, 0x0, 0x7f, 0xff, 0x90, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0x50, 0x0, 0x7,
+    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xf5, 0x0, 0x0, 0x7f, 0xff, 0x90,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0x50, 0x0, 0x7, 0xff, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7, 0xff, 0xf5, 0x0, 0x0,
+    0x7f, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0x50, 0x0, 0x7, 0xff, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x99,
+    0x93, 0x0, 0x0, 0x49, 0x99, 0x50, 0x0, 0x0,
+
+    /* U+00B7 "·" */
+    0x6d, 0xdd, 0xd5, 0x7f, 0xff, 0xf6, 0x7f, 0xff,
+    0xf6, 0x7f, 0xff, 0xf6, 0x6d, 0xee, 0xe5,
+
+    /* U+00B8 "¸" */
+    0x0, 0x0, 0x9b, 0xa3, 0x0, 0x0, 0x0, 0x3d,
+    0xfe, 0x10, 0x0, 0x0, 0x6, 0xff, 0xc2, 0x0,
+    0x0, 0x1, 0x9f, 0xff, 0xec, 0x30, 0x0, 0x15,
+    0x7a, 0xef, 0xfc, 0x30, 0x0, 0x0, 0x17, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0x8f, 0xff, 0x91, 0x66,
+    0x67, 0xbe, 0xff, 0xf5, 0x4f, 0xff, 0xff, 0xff,
+    0xf9, 0x16, 0xff, 0xff, 0xff, 0xe8, 0x10, 0x37,
+    0x89, 0x98, 0x61, 0x0, 0x0,
+
+    /* U+00B9 "¹" */
+    0x0, 0x0, 0x1, 0x69, 0x92, 0x0, 0x0, 0x7,
+    0xef, 0xf3, 0x0, 0x1, 0x9f, 0xff, 0xf3, 0x0,
+    0x4b, 0xff, 0xff, 0xf3, 0x3a, 0xef, 0xfe, 0xff,
+    0xf3, 0x7f, 0xff, 0xb9, 0xef, 0xf3, 0x7e, 0xd6,
+    0x25, 0xef, 0xf3, 0x45, 0x10, 0x5, 0xef, 0xf3,
+    0x0, 0x0, 0x5, 0xef, 0xf3, 0x0, 0x0, 0x5,
+    0xef, 0xf3, 0x0, 0x0, 0x5, 0xef, 0xf3, 0x0,
+    0x0, 0x5, 0xef, 0xf3, 0x0, 0x0, 0x5, 0xef,
+    0xf3, 0x0, 0x0, 0x5, 0xef, 0xf3, 0x0, 0x0,
+    0x5, 0xef, 0xf3, 0x0, 0x0, 0x5, 0xef, 0xf3,
+    0x0, 0x0, 0x5, 0xef, 0xf3, 0x0, 0x0, 0x4,
+    0xcd, 0xd2,
+
+    /* U+00BA "º" */
+    0x0, 0x0, 0x2, 0x48, 0x98, 0x63, 0x10, 0x0,
+    0x0, 0x0, 0x6, 0xcf, 0xff, 0xff, 0xea, 0x20,
+    0x0, 0x0, 0x18, 0xef, 0xff, 0xff, 0xff, 0xfc,
+    0x40, 0x0, 0x6, 0xef, 0xfe, 0x97, 0x8c, 0xff,
+    0xfc, 0x10, 0x1, 0xef, 0xfc, 0x31, 0x0, 0x18,
+    0xff, 0xf7, 0x0, 0x6f, 0xfe, 0x50, 0x0, 0x0,
+    0x1b, 0xff, 0xc1, 0x9, 0xff, 0xc1, 0x0, 0x0,
+    0x0, 0x6f, 0xfd, 0x31, 0xbf, 0xfa, 0x0, 0x0,
+    0x0, 0x2, 0xff, 0xe5, 0x2c, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x1f, 0xff, 0x62, 0xcf, 0xf8, 0x0,
+    0x0, 0x0, 0x1, 0xff, 0xf6, 0x2b, 0xff, 0x90,
+    0x0, 0x0, 0x0, 0x2f, 0xfe, 0x61, 0xaf, 0xfc,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0xe4, 0x8, 0xff,
+    0xd4, 0x0, 0x0, 0x0, 0x9f, 0xfc, 0x20, 0x3e,
+    0xff, 0xb2, 0x0, 0x0, 0x6e, 0xff, 0x80, 0x0,
+    0x9f, 0xff, 0xc7, 0x55, 0x9e, 0xff, 0xd2, 0x0,
+    0x2, 0xaf, 0xff, 0xfe, 0xef, 0xff, 0xd5, 0x0,
+    0x0, 0x2, 0x9e, 0xff, 0xff, 0xff, 0xc4, 0x0,
+    0x0, 0x0, 0x1, 0x38, 0xbd, 0xca, 0x52, 0x0,
+    0x0,
+
+    /* U+00BB "»" */
+    0x5a, 0xa9, 0x20, 0x0, 0x4, 0xaa, 0x93, 0x0,
+    0x0, 0x0, 0x2, 0xdf, 0xf9, 0x10, 0x0, 0x1d,
+    0xff, 0xa1, 0x0, 0x0, 0x0, 0x7, 0xff, 0xe5,
+    0x0, 0x0, 0x6f, 0xff, 0x60, 0x0, 0x0, 0x0,
+    0x2c, 0xff, 0xd2, 0x0, 0x1, 0xaf, 0xfd, 0x40,
+    0x0, 0x0, 0x0, 0x5e, 0xff, 0xa1, 0x0, 0x4,
+    0xef, 0xfb, 0x10, 0x0, 0x0, 0x1, 0xaf, 0xfe,
+    0x70, 0x0, 0x9, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x3, 0xef, 0xfe, 0x20, 0x0, 0x2d, 0xff, 0xe4,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0xfa, 0x10, 0x0,
+    0x8f, 0xff, 0xc2, 0x0, 0x0, 0x0, 0x2c, 0xff,
+    0xf7, 0x0, 0x1, 0xcf, 0xff, 0x90, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0xe3, 0x0, 0x5, 0xff, 0xfe,
+    0x50, 0x0, 0x0, 0x1, 0xcf, 0xff, 0xb1, 0x0,
+    0x1a, 0xff, 0xfd, 0x30, 0x0, 0x0, 0x1c, 0xff,
+    0xfb, 0x10, 0x1, 0xaf, 0xff, 0xc3, 0x0, 0x0,
+    0x6, 0xff, 0xfe, 0x30, 0x0, 0x6f, 0xff, 0xe5,
+    0x0, 0x0, 0x2, 0xcf, 0xff, 0x70, 0x0, 0x1c,
+    0xff, 0xf9, 0x0, 0x0, 0x1, 0x9f, 0xff, 0xa1,
+    0x0, 0x8, 0xff, 0xfb, 0x20, 0x0, 0x0, 0x3e,
+    0xff, 0xe2, 0x0, 0x3, 0xdf, 0xfe, 0x40, 0x0,
+    0x0, 0x1b, 0xff, 0xe6, 0x0, 0x0, 0x9f, 0xff,
+    0x80, 0x0, 0x0, 0x6, 0xef, 0xf9, 0x10, 0x0,
+    0x4e, 0xff, 0xa1, 0x0, 0x0, 0x2, 0xcf, 0xfd,
+    0x20, 0x0, 0x1a, 0xff, 0xd3, 0x0, 0x0, 0x0,
+    0x8f, 0xfe, 0x50, 0x0, 0x6, 0xff, 0xf6, 0x0,
+    0x0, 0x0, 0x2d, 0xff, 0x91, 0x0, 0x1, 0xdf,
+    0xfa, 0x10, 0x0, 0x0, 0x5, 0x99, 0x81, 0x0,
+    0x0, 0x39, 0x98, 0x20, 0x0, 0x0, 0x0,
+
+    /* U+00BC "¼" */
+    0x0, 0x0, 0x1, 0x7a, 0xa2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x19, 0xff,
+    0xd2, 0x0, 0x0, 0x0, 0x0, 0x17, 0xef, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5e, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x2,
+    0x9f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xdf, 0xf9, 0x10, 0x0,
+    0x0, 0x0, 0x5b, 0xff, 0xff, 0xf3, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1a, 0xff,
+    0xc2, 0x0, 0x0, 0x0, 0x3a, 0xef, 0xfe, 0xff,
+    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0xb8, 0xef, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xef, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x7e, 0xc6, 0x15, 0xef, 0xf3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2b, 0xff,
+    0xb1, 0x0, 0x0, 0x0, 0x0, 0x45, 0x0, 0x5,
+    0xef, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0xfd, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xef, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xef, 0xe6, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xef, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3d, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xef, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xef, 0xf3, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7, 0xff, 0xe4, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xef,
+    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3d, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xef, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xcf, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xef, 0xf3, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0xd4, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xef, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x5e, 0xff,
+    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xef, 0xf3, 0x0, 0x0, 0x0,
+    0x2, 0xdf, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xcd, 0xd2,
+    0x0, 0x0, 0x0, 0x1a, 0xff, 0xc3, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x11, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6e, 0xff,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x5, 0xbc, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xdf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3e, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1b, 0xff, 0xb2, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xdf, 0xff, 0xd0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xfe,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xff,
+    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xef, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xaf, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1c, 0xff, 0xa1, 0x0, 0x0,
+    0x0, 0x0, 0x18, 0xff, 0xfd, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xaf, 0xfc,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xfe, 0x87,
+    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xef, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xef, 0xf9, 0x17, 0xff, 0xd0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3e, 0xff, 0x81, 0x0, 0x0,
+    0x0, 0x0, 0x5e, 0xff, 0xb1, 0x7, 0xff, 0xd0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xaf, 0xfc,
+    0x20, 0x0, 0x0, 0x0, 0x3, 0xdf, 0xfb, 0x20,
+    0x7, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x2b,
+    0xff, 0xc3, 0x0, 0x7, 0xff, 0xd0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4e, 0xfe, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xff, 0xb7, 0x77, 0x7b, 0xff,
+    0xe7, 0x72, 0x0, 0x0, 0x0, 0x2, 0xbf, 0xfa,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x9, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6d, 0xdd, 0xdd, 0xdd, 0xde, 0xff, 0xfd, 0xd4,
+    0x0, 0x0, 0x0, 0x5f, 0xfe, 0x60, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x13, 0x33, 0x33, 0x33, 0x39,
+    0xff, 0xd3, 0x31, 0x0, 0x0, 0x3, 0xdf, 0xf9,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0xd0, 0x0, 0x0, 0x0,
+    0x1a, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xd0,
+    0x0, 0x0, 0x0, 0x8f, 0xfd, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xaa, 0x90, 0x0, 0x0, 0x0, 0x46, 0x64,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+00BD "½" */
+    0x0, 0x0, 0x1, 0x7a, 0xa2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xfe,
+    0x70, 0x0, 0x0, 0x0, 0x0, 0x17, 0xef, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xcf, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x2,
+    0x9f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x19, 0xff, 0xd3, 0x0, 0x0,
+    0x0, 0x0, 0x5b, 0xff, 0xff, 0xf3, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5e, 0xff,
+    0x60, 0x0, 0x0, 0x0, 0x3a, 0xef, 0xfe, 0xff,
+    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xdf, 0xf9, 0x10, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0xb8, 0xef, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1a, 0xff, 0xc2, 0x0, 0x0,
+    0x0, 0x0, 0x7e, 0xc6, 0x15, 0xef, 0xf3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7e, 0xfe,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x45, 0x0, 0x5,
+    0xef, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xef, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xef, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2b, 0xff, 0xb1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xef, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xfd,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xef, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0xe7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xef, 0xf3, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3d, 0xff, 0x91, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xef,
+    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xfd,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xef, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xef, 0xf3, 0x0,
+    0x0, 0x0, 0x0, 0x4d, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xef, 0xf3, 0x0, 0x0, 0x0, 0x2, 0xbf, 0xfc,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xef, 0xf3, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xd4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xcd, 0xd2,
+    0x0, 0x0, 0x0, 0x5e, 0xff, 0x60, 0x0, 0x0,
+    0x1, 0x22, 0x22, 0x21, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xfa,
+    0x0, 0x0, 0x2, 0x7b, 0xef, 0xfe, 0xda, 0x60,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xa, 0xff, 0xc3, 0x0, 0x0, 0x3b, 0xff, 0xff,
+    0xff, 0xff, 0xe9, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6e, 0xfe, 0x50, 0x0, 0x1,
+    0xcf, 0xff, 0xca, 0x9b, 0xef, 0xff, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xdf, 0xf9,
+    0x0, 0x0, 0x6, 0xff, 0xf9, 0x20, 0x1, 0x5f,
+    0xff, 0xc1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1c, 0xff, 0xb2, 0x0, 0x0, 0x9, 0xde, 0xc2,
+    0x0, 0x0, 0xa, 0xff, 0xf1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xfe, 0x40, 0x0, 0x0,
+    0x2, 0x45, 0x40, 0x0, 0x0, 0xa, 0xff, 0xe1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xef, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2d, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1c, 0xff, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x9f, 0xfe, 0x60, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x9f, 0xfc, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3b, 0xff, 0xf9,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x6, 0xef, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xcf, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2e, 0xff, 0x91, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x8e, 0xff, 0xe8, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xaf, 0xfb, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2a, 0xff, 0xfd, 0x70,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xe4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xcf,
+    0xff, 0xc4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4e, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3c, 0xff, 0xf9, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xbf, 0xfb, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xcf, 0xff, 0xa3, 0x22,
+    0x22, 0x22, 0x20, 0x0, 0x0, 0x19, 0xff, 0xd2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x19, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0,
+    0x5e, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf3, 0x0, 0x3, 0xdf, 0xf9, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3a, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xa2, 0x0, 0x2, 0x56, 0x52,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+00BE "¾" */
+    0x0, 0x1, 0x48, 0xbc, 0xcb, 0x84, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x19,
+    0xff, 0xd2, 0x0, 0x0, 0x0, 0x29, 0xef, 0xff,
+    0xff, 0xfe, 0xa1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5e, 0xfe, 0x60, 0x0, 0x0,
+    0x0, 0xaf, 0xff, 0xdc, 0xce, 0xff, 0xf9, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xdf,
+    0xf9, 0x10, 0x0, 0x0, 0x4, 0xff, 0xf9, 0x30,
+    0x15, 0xdf, 0xfd, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1a, 0xff, 0xc2, 0x0, 0x0, 0x0,
+    0x8, 0xde, 0xc1, 0x0, 0x0, 0x7f, 0xfe, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xfe,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x23, 0x30, 0x0,
+    0x0, 0x7f, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xef, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xcf, 0xfb, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2b, 0xff, 0xb1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x16,
+    0x9d, 0xff, 0xc3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0xfd, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0xff, 0xfb, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xef, 0xe6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5e,
+    0xef, 0xff, 0xd5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3d, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x23, 0x45, 0xbf, 0xfe, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xfd, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0xff, 0xc1, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xe4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xf1,
+    0x0, 0x0, 0x0, 0x3d, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x28, 0xac, 0x50, 0x0,
+    0x0, 0xa, 0xff, 0xf1, 0x0, 0x0, 0x1, 0xcf,
+    0xfb, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2c, 0xff, 0xc2, 0x0, 0x0, 0x4e, 0xff, 0xd1,
+    0x0, 0x0, 0x8, 0xff, 0xd4, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xfc, 0x63,
+    0x48, 0xdf, 0xfe, 0x70, 0x0, 0x0, 0x5e, 0xff,
+    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x10,
+    0x0, 0x2, 0xdf, 0xfa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0xde, 0xff,
+    0xff, 0xed, 0x71, 0x0, 0x0, 0x1a, 0xff, 0xc3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x11, 0x10, 0x0,
+    0x0, 0x0, 0x25, 0x78, 0x87, 0x51, 0x0, 0x0,
+    0x0, 0x7e, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xbc, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xdf, 0xf9, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3e, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1c, 0xff, 0xb2, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xdf, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xfe, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x1b, 0xff, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xef, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x1, 0xbf,
+    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2c, 0xff, 0xa1, 0x0, 0x0,
+    0x0, 0x0, 0x18, 0xff, 0xfe, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xaf,
+    0xfc, 0x20, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0x97, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xef, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xef, 0xfa, 0x17, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0xff,
+    0x81, 0x0, 0x0, 0x0, 0x0, 0x5e, 0xff, 0xb1,
+    0x7, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xaf, 0xfc, 0x20, 0x0, 0x0, 0x0,
+    0x3, 0xdf, 0xfc, 0x20, 0x7, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xe3,
+    0x0, 0x0, 0x0, 0x0, 0x2b, 0xff, 0xc3, 0x0,
+    0x7, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xfe, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xff, 0xb7, 0x77, 0x7b, 0xff, 0xe7, 0x72,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xbf, 0xfa, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x9, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6d, 0xdd, 0xdd, 0xdd, 0xde, 0xff, 0xfd, 0xd4,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xfe, 0x60, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x13, 0x33, 0x33, 0x33,
+    0x39, 0xff, 0xd3, 0x31, 0x0, 0x0, 0x0, 0x3,
+    0xdf, 0xf9, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x1a, 0xff, 0xd1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xfd, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xaa, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x46, 0x64, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+00BF "¿" */
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xaa, 0xaa, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xa, 0xff, 0xff, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x12, 0x22,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x45, 0x54, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2e, 0xee, 0xb1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0xfc, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xff, 0xb1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0xfa, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xcf, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xd4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6e, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x7e, 0xff, 0xfd, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x7e, 0xff,
+    0xfd, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x9f, 0xff, 0xfe, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xfd, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6e,
+    0xff, 0xfd, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3d, 0xff, 0xfc, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xfe,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xdf, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3e, 0xff, 0xf4, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xef, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9, 0xfe, 0xc8, 0x5e, 0xff, 0xe3, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xcf, 0xff, 0x93, 0xef,
+    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e,
+    0xff, 0xf6, 0x1d, 0xff, 0xfc, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x19, 0xff, 0xfd, 0x30, 0x8f, 0xff,
+    0xf8, 0x10, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
+    0xa1, 0x2, 0xdf, 0xff, 0xe9, 0x10, 0x0, 0x0,
+    0x16, 0xdf, 0xff, 0xf3, 0x0, 0x5, 0xef, 0xff,
+    0xfc, 0x84, 0x23, 0x6b, 0xef, 0xff, 0xe7, 0x0,
+    0x0, 0x6, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf8, 0x10, 0x0, 0x0, 0x4, 0xce, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xd6, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x59, 0xce, 0xef, 0xfe, 0xca, 0x71,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x34,
+    0x44, 0x42, 0x10, 0x0, 0x0, 0x0,
+
+    /* U+00C0 "À" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x12, 0x22, 0x21,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xbc, 0xcc,
+    0xb5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xef,
+    0xff, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x17,
+    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1a, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2b, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3d, 0xff, 0xa1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4a, 0xaa, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x44, 0x44, 0x41, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2e, 0xff, 0xfe, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xfa, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xcf, 0xff, 0xff, 0xe3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5e, 0xff, 0xdf, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xf6, 0xef,
+    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xfd, 0x3c,
+    0xff, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xa1,
+    0x8f, 0xff, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xf7,
+    0x4, 0xef, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xef, 0xfd,
+    0x30, 0xc, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
+    0xb1, 0x0, 0x7f, 0xff, 0xe1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff,
+    0xf6, 0x0, 0x2, 0xef, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
+    0xff, 0x10, 0x0, 0x1a, 0xff, 0xfb, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xbf,
+    0xff, 0xa0, 0x0, 0x0, 0x6e, 0xff, 0xe5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4d,
+    0xff, 0xe5, 0x0, 0x0, 0x2, 0xdf, 0xff, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0xfc, 0x20, 0x0, 0x0, 0x9, 0xff, 0xff,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xdf, 0xff, 0x80, 0x0, 0x0, 0x0, 0x3f, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x1, 0xcf,
+    0xff, 0xc2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xfe, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xdf, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x3d, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xff, 0xd5, 0x22, 0x22, 0x22, 0x22,
+    0x23, 0xbf, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1b, 0xff, 0xfe, 0xdc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xce, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfc, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x0, 0x0,
+    0x0, 0x0, 0x2e, 0xff, 0xfc, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xef, 0xff, 0xb1, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0xff, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xff, 0x30,
+    0x0, 0x0, 0x1, 0xbf, 0xff, 0xb2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf9,
+    0x0, 0x0, 0x0, 0x4e, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xff,
+    0xd2, 0x0, 0x0, 0x9, 0xff, 0xfe, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xff, 0x70, 0x0, 0x1, 0xef, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e,
+    0xff, 0xfb, 0x10, 0x0, 0x5f, 0xff, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xbf, 0xff, 0xf4, 0x0, 0x1a, 0xff, 0xfd, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xff, 0xa0, 0x3, 0xdf, 0xff, 0x91,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2e, 0xff, 0xfd, 0x20, 0x8f, 0xff, 0xe5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xaf, 0xff, 0xf7, 0xd, 0xff, 0xfd,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xff, 0xb2,
+
+    /* U+00C1 "Á" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x22, 0x22, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5c, 0xcc, 0xc9, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1c, 0xff, 0xfe, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xbf, 0xff, 0x91, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5f, 0xff, 0xb2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xd3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xaa, 0xa5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x44, 0x44, 0x41, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2e, 0xff, 0xfe, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xfa, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xcf, 0xff, 0xff, 0xe3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5e, 0xff, 0xdf, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xf6, 0xef,
+    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xfd, 0x3c,
+    0xff, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xa1,
+    0x8f, 0xff, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xf7,
+    0x4, 0xef, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xef, 0xfd,
+    0x30, 0xc, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
+    0xb1, 0x0, 0x7f, 0xff, 0xe1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff,
+    0xf6, 0x0, 0x2, 0xef, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
+    0xff, 0x10, 0x0, 0x1a, 0xff, 0xfb, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xbf,
+    0xff, 0xa0, 0x0, 0x0, 0x6e, 0xff, 0xe5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4d,
+    0xff, 0xe5, 0x0, 0x0, 0x2, 0xdf, 0xff, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0xfc, 0x20, 0x0, 0x0, 0x9, 0xff, 0xff,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xdf, 0xff, 0x80, 0x0, 0x0, 0x0, 0x3f, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x1, 0xcf,
+    0xff, 0xc2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xfe, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xdf, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x3d, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xff, 0xd5, 0x22, 0x22, 0x22, 0x22,
+    0x23, 0xbf, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1b, 0xff, 0xfe, 0xdc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xce, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfc, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x0, 0x0,
+    0x0, 0x0, 0x2e, 0xff, 0xfc, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xef, 0xff, 0xb1, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0xff, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xff, 0x30,
+    0x0, 0x0, 0x1, 0xbf, 0xff, 0xb2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf9,
+    0x0, 0x0, 0x0, 0x4e, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xff,
+    0xd2, 0x0, 0x0, 0x9, 0xff, 0xfe, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xff, 0x70, 0x0, 0x1, 0xef, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e,
+    0xff, 0xfb, 0x10, 0x0, 0x5f, 0xff, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xbf, 0xff, 0xf4, 0x0, 0x1a, 0xff, 0xfd, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xff, 0xa0, 0x3, 0xdf, 0xff, 0x91,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2e, 0xff, 0xfd, 0x20, 0x8f, 0xff, 0xe5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xaf, 0xff, 0xf7, 0xd, 0xff, 0xfd,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xff, 0xb2,
+
+    /* U+00C2 "Â" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x22,
+    0x21, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xbc,
+    0xcc, 0xa2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xbf,
+    0xff, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xaf,
+    0xff, 0xdf, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0xe4, 0xcf, 0xfe, 0x60, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5e,
+    0xff, 0xe6, 0x4, 0xef, 0xfd, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d,
+    0xff, 0xfa, 0x10, 0x9, 0xff, 0xfd, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0xaa, 0xaa, 0x10, 0x0, 0x19, 0xaa, 0xa6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x44, 0x44, 0x41, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0xff, 0xfe, 0x60, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xfa, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xcf, 0xff, 0xff, 0xe3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xdf, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xf6, 0xef,
+    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0xfd, 0x3b,
+    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xa1,
+    0x8f, 0xff, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xf6,
+    0x4, 0xef, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xef, 0xfd,
+    0x30, 0xc, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
+    0xb1, 0x0, 0x7f, 0xff, 0xe1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff,
+    0xf6, 0x0, 0x2, 0xef, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
+    0xfe, 0x10, 0x0, 0x1a, 0xff, 0xfb, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xcf,
+    0xff, 0xa0, 0x0, 0x0, 0x6e, 0xff, 0xe5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e,
+    0xff, 0xe5, 0x0, 0x0, 0x2, 0xdf, 0xff, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0xfc, 0x20, 0x0, 0x0, 0x9, 0xff, 0xff,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xdf, 0xff, 0x80, 0x0, 0x0, 0x0, 0x3f, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x1, 0xcf,
+    0xff, 0xc2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xfe, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xdf, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x3d, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xff, 0xd5, 0x22, 0x22, 0x22, 0x22,
+    0x23, 0xbf, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1b, 0xff, 0xfe, 0xdc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xce, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfc, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x0, 0x0,
+    0x0, 0x0, 0x2e, 0xff, 0xfc, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xef, 0xff, 0xb1, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0xff, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xff, 0x30,
+    0x0, 0x0, 0x1, 0xbf, 0xff, 0xb2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf9,
+    0x0, 0x0, 0x0, 0x4e, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xff,
+    0xd2, 0x0, 0x0, 0x9, 0xff, 0xfe, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xff, 0x70, 0x0, 0x1, 0xef, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e,
+    0xff, 0xfb, 0x10, 0x0, 0x5f, 0xff, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xbf, 0xff, 0xf4, 0x0, 0x1a, 0xff, 0xfd, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xff, 0xa0, 0x3, 0xdf, 0xff, 0x91,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2e, 0xff, 0xfd, 0x20, 0x8f, 0xff, 0xe5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xaf, 0xff, 0xf7, 0xd, 0xff, 0xfd,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xff, 0xb2,
+
+    /* U+00C3 "Ã" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x14, 0x76, 0x41,
+    0x0, 0x0, 0x27, 0x86, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3b, 0xff, 0xff,
+    0xc7, 0x30, 0x8, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xff, 0xff,
+    0xff, 0xfd, 0xbb, 0xef, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xea,
+    0xac, 0xff, 0xff, 0xff, 0xfd, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf9,
+    0x10, 0x27, 0xdf, 0xff, 0xfe, 0x60, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xaa,
+    0x30, 0x0, 0x1, 0x59, 0xa7, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x34, 0x44, 0x31, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2e, 0xee, 0xed, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xff, 0xfa, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xcf, 0xff, 0xff, 0xe3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5e, 0xff, 0xdf, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0xff, 0xf7, 0xef, 0xfd,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xef, 0xfe, 0x3c, 0xff,
+    0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xa1, 0x8f,
+    0xff, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xf7, 0x4,
+    0xef, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xef, 0xfd, 0x30,
+    0xc, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xb1,
+    0x0, 0x7f, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xf6,
+    0x0, 0x2, 0xef, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
+    0x10, 0x0, 0x1a, 0xff, 0xfb, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xbf, 0xff,
+    0xa0, 0x0, 0x0, 0x6e, 0xff, 0xe5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4d, 0xff,
+    0xe5, 0x0, 0x0, 0x2, 0xdf, 0xff, 0xa0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0xfc, 0x20, 0x0, 0x0, 0x9, 0xff, 0xff, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xcf,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
+    0xff, 0xf3, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xff,
+    0xc2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xfe, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xdf, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x3d,
+    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xd5, 0x22, 0x22, 0x22, 0x22, 0x23,
+    0xbf, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1b, 0xff, 0xfe, 0xdc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xce, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfc, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xe6, 0x0, 0x0, 0x0,
+    0x0, 0x2e, 0xff, 0xfc, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xef, 0xff, 0xb1, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1b, 0xff, 0xff, 0x30, 0x0,
+    0x0, 0x1, 0xbf, 0xff, 0xb2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf9, 0x0,
+    0x0, 0x0, 0x4e, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xff, 0xd2,
+    0x0, 0x0, 0x9, 0xff, 0xfe, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xfe,
+    0x60, 0x0, 0x1, 0xef, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xff,
+    0xfb, 0x10, 0x0, 0x5f, 0xff, 0xf6, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xbf,
+    0xff, 0xf4, 0x0, 0x1a, 0xff, 0xfd, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xff, 0xa0, 0x3, 0xdf, 0xff, 0x91, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2e, 0xff, 0xfd, 0x20, 0x8f, 0xff, 0xe5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0xff, 0xf7, 0xd, 0xff, 0xfd, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0xff, 0xb2,
+
+    /* U+00C4 "Ä" */
+    0x0, 0x0, 0x0, 0x0, 0x2, 0x22, 0x21, 0x0,
+    0x1, 0x22, 0x22, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0x40,
+    0x0, 0x5f, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf5,
+    0x0, 0x5, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
+    0x50, 0x0, 0x5f, 0xff, 0xe1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
+    0xf5, 0x0, 0x5, 0xff, 0xfe, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xaa,
+    0xaa, 0x30, 0x0, 0x3a, 0xaa, 0x91, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x44, 0x44, 0x41, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2e, 0xff, 0xfe, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xff, 0xfa, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xcf, 0xff, 0xff, 0xe3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5e, 0xff, 0xdf, 0xff, 0x90,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0xff, 0xf6, 0xef, 0xfd,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xef, 0xfd, 0x3c, 0xff,
+    0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xa1, 0x8f,
+    0xff, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xf7, 0x4,
+    0xef, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xef, 0xfd, 0x30,
+    0xc, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xb1,
+    0x0, 0x7f, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xf6,
+    0x0, 0x2, 0xef, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
+    0x10, 0x0, 0x1a, 0xff, 0xfb, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xbf, 0xff,
+    0xa0, 0x0, 0x0, 0x6e, 0xff, 0xe5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4d, 0xff,
+    0xe5, 0x0, 0x0, 0x2, 0xdf, 0xff, 0xa0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0xfc, 0x20, 0x0, 0x0, 0x9, 0xff, 0xff, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xdf,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
+    0xff, 0xf3, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xff,
+    0xc2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xfe, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xdf, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x3d,
+    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xff, 0xd5, 0x22, 0x22, 0x22, 0x22, 0x23,
+    0xbf, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1b, 0xff, 0xfe, 0xdc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xce, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfc, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xe6, 0x0, 0x0, 0x0,
+    0x0, 0x2e, 0xff, 0xfc, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xef, 0xff, 0xb1, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1b, 0xff, 0xff, 0x30, 0x0,
+    0x0, 0x1, 0xbf, 0xff, 0xb2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf9, 0x0,
+    0x0, 0x0, 0x4e, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xff, 0xd2,
+    0x0, 0x0, 0x9, 0xff, 0xfe, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
+    0x70, 0x0, 0x1, 0xef, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xff,
+    0xfb, 0x10, 0x0, 0x5f, 0xff, 0xf6, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xbf,
+    0xff, 0xf4, 0x0, 0x1a, 0xff, 0xfd, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xff, 0xa0, 0x3, 0xdf, 0xff, 0x91, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2e, 0xff, 0xfd, 0x20, 0x8f, 0xff, 0xe5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0xff, 0xf7, 0xd, 0xff, 0xfd, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0xff, 0xb2,
+
+    /* U+00C5 "Å" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x57,
+    0x52, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xdf,
+    0xff, 0xc4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xce,
+    0x84, 0x7e, 0xc2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0x60, 0x0, 0x5f, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0xf1, 0x0, 0x2, 0xda, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0x30, 0x0, 0x3e, 0x90, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xfa, 0x10, 0x19, 0xf6, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x19, 0xfd, 0xbd, 0xfa, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xff, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xff, 0xfa, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xcf, 0xff, 0xff, 0xe3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5e, 0xff, 0xef, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0xff, 0xf7, 0xff, 0xfd,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xef, 0xfe, 0x3c, 0xff,
+    0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xa1, 0x8f,
+    0xff, 0xa1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xf7, 0x4,
+    0xef, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xef, 0xfd, 0x30,
+    0xc, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xb1,
+    0x0, 0x8f, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xf6,
+    0x0, 0x2, 0xef, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
+    0x10, 0x0, 0x1a, 0xff, 0xfb, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xbf, 0xff,
+    0xa0, 0x0, 0x0, 0x6e, 0xff, 0xe4, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4d, 0xff,
+    0xe5, 0x0, 0x0, 0x2, 0xdf, 0xff, 0xa0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0xfc, 0x20, 0x0, 0x0, 0x9, 0xff, 0xff, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xcf,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xff, 0xf3, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xff,
+    0xb2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xfe, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xdf, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x3d,
+    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xd5, 0x22, 0x22, 0x22, 0x22, 0x23,
+    0xbf, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1b, 0xff, 0xfe, 0xdc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xce, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfc, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xe6, 0x0, 0x0, 0x0,
+    0x0, 0x2e, 0xff, 0xfc, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xef, 0xff, 0xb1, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1b, 0xff, 0xff, 0x30, 0x0,
+    0x0, 0x1, 0xbf, 0xff, 0xb2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf9, 0x0,
+    0x0, 0x0, 0x4e, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xff, 0xd2,
+    0x0, 0x0, 0x8, 0xff, 0xfe, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xfe,
+    0x60, 0x0, 0x1, 0xef, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xff,
+    0xfb, 0x10, 0x0, 0x5f, 0xff, 0xf6, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xbf,
+    0xff, 0xf4, 0x0, 0x1a, 0xff, 0xfd, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xff, 0xa0, 0x3, 0xdf, 0xff, 0x91, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2e, 0xff, 0xfd, 0x20, 0x8f, 0xff, 0xe5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0xff, 0xf7, 0xd, 0xff, 0xfd, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0xff, 0xb2,
+
+    /* U+00C6 "Æ" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x24, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xaf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xa1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xa1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4e, 0xff, 0xfd, 0xcc, 0xdf,
+    0xff, 0xfe, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0x91, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xaf, 0xff, 0xe4, 0x0, 0x3d, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xef, 0xff, 0xa1, 0x0, 0x3d, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0xff, 0xfe, 0x40, 0x0, 0x3d, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0xff,
+    0xfb, 0x10, 0x0, 0x3d, 0xff, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xaf, 0xff, 0xe4,
+    0x0, 0x0, 0x3d, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xdf, 0xff, 0xb1, 0x0,
+    0x0, 0x3d, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0xfe, 0x50, 0x0, 0x0,
+    0x3d, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2e, 0xff, 0xfb, 0x10, 0x0, 0x0, 0x3d,
+    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x3d, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xdf,
+    0xff, 0xc1, 0x0, 0x0, 0x0, 0x3d, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xfe,
+    0x50, 0x0, 0x0, 0x0, 0x3d, 0xff, 0xfd, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xc6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xfb, 0x10,
+    0x0, 0x0, 0x0, 0x3d, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xdf, 0xff, 0xd1, 0x0, 0x0, 0x0,
+    0x0, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0x3d, 0xff, 0xf9, 0x43, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x32, 0x0, 0x0, 0x0, 0x0, 0x2d,
+    0xff, 0xfc, 0x20, 0x0, 0x0, 0x0, 0x0, 0x3d,
+    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
+    0xfe, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xce, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xdf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2c, 0xff, 0xff, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xff, 0xff, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0xfa, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x8e, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xdf, 0xff, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3d, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xef,
+    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3d, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2b, 0xff, 0xfd,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3d,
+    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf9, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3d, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xcf, 0xff, 0xe3, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3d, 0xff, 0xf8,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x21, 0x5, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3d, 0xff, 0xff, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe5,
+    0x1a, 0xff, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3d, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x5e,
+    0xff, 0xf9, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xbf, 0xff,
+    0xe4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf5,
+
+    /* U+00C7 "Ç" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x7a, 0xde,
+    0xfe, 0xdb, 0x74, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x7b, 0xef, 0xff, 0xff,
+    0xff, 0xff, 0xeb, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x16, 0xdf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xc4, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x29, 0xff, 0xff, 0xff, 0xfe, 0xdd, 0xde,
+    0xff, 0xff, 0xff, 0xd5, 0x0, 0x0, 0x0, 0x0,
+    0x2b, 0xff, 0xff, 0xfc, 0x83, 0x22, 0x22, 0x24,
+    0xae, 0xff, 0xff, 0xd5, 0x0, 0x0, 0x0, 0x1a,
+    0xff, 0xff, 0xd7, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x4c, 0xff, 0xff, 0xd2, 0x0, 0x0, 0x18, 0xff,
+    0xff, 0xd3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2b, 0xff, 0xff, 0x90, 0x0, 0x4, 0xef, 0xff,
+    0xd3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2d, 0xff, 0xfe, 0x40, 0x0, 0xbf, 0xff, 0xe6,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xff, 0xf9, 0x0, 0x3e, 0xff, 0xfb, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xbf, 0xff, 0xc2, 0x8, 0xff, 0xff, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xd9, 0x64, 0x11, 0xbf, 0xff, 0xc2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3e, 0xff, 0xfa, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xff, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xfe, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
+    0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
+    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0xff, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x31, 0x0, 0x2, 0xbf, 0xff, 0xb1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1b, 0xb9, 0x51, 0x8, 0xff, 0xfe, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xef, 0xff, 0x80, 0x4e, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0x9f, 0xff, 0xf4, 0x0, 0xcf, 0xff, 0xe2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4d,
+    0xff, 0xfc, 0x20, 0x6, 0xff, 0xff, 0x91, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
+    0xff, 0x70, 0x0, 0x2b, 0xff, 0xff, 0x81, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0xff, 0xff,
+    0xd2, 0x0, 0x0, 0x4e, 0xff, 0xff, 0x82, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x18, 0xef, 0xff, 0xf6,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xd6, 0x21,
+    0x0, 0x0, 0x11, 0x5b, 0xff, 0xff, 0xf9, 0x10,
+    0x0, 0x0, 0x1, 0x8e, 0xff, 0xff, 0xfe, 0xa8,
+    0x77, 0x8a, 0xdf, 0xff, 0xff, 0xf9, 0x10, 0x0,
+    0x0, 0x0, 0x1, 0x7e, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xe9, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4a, 0xef, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xc4, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x14, 0x8d, 0xff, 0xff, 0xff,
+    0xff, 0xeb, 0x52, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xfb, 0x65,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xd, 0xfe, 0x60, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xef, 0xfe, 0xd6, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x37, 0x9d, 0xff, 0xe7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3d, 0xff, 0xe1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xdf, 0xfe, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0x66, 0x79, 0xdf, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xbf, 0xff, 0xff, 0xff, 0xd4, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2c,
+    0xff, 0xff, 0xfe, 0xc4, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x58,
+    0x99, 0x97, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+00C8 "È" */
+    0x0, 0x0, 0x0, 0x0, 0x12, 0x22, 0x21, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xbc, 0xcc, 0xa1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1a,
+    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xff, 0xfd,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4d, 0xff, 0xe6, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5e, 0xff, 0xc2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x7a, 0xa7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x20, 0x4e,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf9, 0x4, 0xef, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xa0, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x4,
+    0xef, 0xff, 0xdc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xcc, 0x80, 0x4e, 0xff, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xef, 0xff, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xef, 0xff,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4e, 0xff, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xef, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xef, 0xff, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xef,
+    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4e, 0xff, 0xfd, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0x50, 0x4, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x4e,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x60, 0x4, 0xef, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf6, 0x0, 0x4e, 0xff, 0xf7, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x10, 0x4,
+    0xef, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xff, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xef, 0xff, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xef, 0xff,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4e, 0xff, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xef, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xef, 0xff, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xef,
+    0xff, 0x62, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x21, 0x4e, 0xff, 0xff, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0x74, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x4e,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x74, 0xef, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf7,
+
+    /* U+00C9 "É" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x22,
+    0x22, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xac, 0xcc, 0xb5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0xfa, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xff,
+    0xfc, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xef, 0xfd, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xbf, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xff,
+    0x91, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xaa, 0x81, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x20, 0x4e,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf9, 0x4, 0xef, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xa0, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x4,
+    0xef, 0xff, 0xdc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xcc, 0x80, 0x4e, 0xff, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xef, 0xff, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xef, 0xff,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4e, 0xff, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xef, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xef, 0xff, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xef,
+    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4e, 0xff, 0xfd, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0x50, 0x4, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x4e,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x60, 0x4, 0xef, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf6, 0x0, 0x4e, 0xff, 0xf7, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x10, 0x4,
+    0xef, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xff, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xef, 0xff, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xef, 0xff,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4e, 0xff, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xef, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xef, 0xff, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xef,
+    0xff, 0x62, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x21, 0x4e, 0xff, 0xff, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0x74, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x4e,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x74, 0xef, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf7,
+
+    /* U+00CA "Ê" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x22, 0x21,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xbc, 0xcc, 0xa2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xcf, 0xff, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x9f, 0xff, 0xef,
+    0xff, 0x81, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7e, 0xff, 0xd4, 0xcf, 0xfe, 0x60,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xff, 0xf6, 0x4, 0xef, 0xfe, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3c, 0xff, 0xfa, 0x10,
+    0x19, 0xff, 0xfc, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xaa, 0xa9, 0x30, 0x0, 0x29, 0xaa,
+    0xa6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x20, 0x4e,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf9, 0x4, 0xef, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xa0, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x4,
+    0xef, 0xff, 0xdc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xcc, 0x80, 0x4e, 0xff, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xef, 0xff, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xef, 0xff,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4e, 0xff, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xef, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xef, 0xff, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xef,
+    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4e, 0xff, 0xfd, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0x50, 0x4, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x4e,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x60, 0x4, 0xef, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf6, 0x0, 0x4e, 0xff, 0xf7, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x10, 0x4,
+    0xef, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xff, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xef, 0xff, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xef, 0xff,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4e, 0xff, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xef, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xef, 0xff, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xef,
+    0xff, 0x62, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x21, 0x4e, 0xff, 0xff, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0x74, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x4e,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x74, 0xef, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf7,
+
+    /* U+00CB "Ë" */
+    0x0, 0x0, 0x0, 0x2, 0x22, 0x21, 0x0, 0x1,
+    0x22, 0x22, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xdf, 0xff, 0x60, 0x0, 0x5e, 0xff, 0xe3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3d, 0xff,
+    0xf6, 0x0, 0x5, 0xef, 0xfe, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xdf, 0xff, 0x60, 0x0,
+    0x5e, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3d, 0xff, 0xf6, 0x0, 0x5, 0xef, 0xfe,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x8a,
+    0xaa, 0x40, 0x0, 0x49, 0xaa, 0x92, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x20, 0x4e, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf9, 0x4, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x4e,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfa, 0x4, 0xef, 0xff, 0xdc,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0x80, 0x4e, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xef, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xff, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xef, 0xff, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xef, 0xff,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4e, 0xff, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xef, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xef, 0xff, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4e, 0xff, 0xfd, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x50, 0x4, 0xef,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf6, 0x0, 0x4e, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x60, 0x4, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x4e,
+    0xff, 0xf7, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x10, 0x4, 0xef, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4e, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xef, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xff, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xef, 0xff, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xef, 0xff,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4e, 0xff, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xef, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xef, 0xff, 0x62, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x21, 0x4e, 0xff, 0xff, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0x74, 0xef,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf7, 0x4e, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x74, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
+
+    /* U+00CC "Ì" */
+    0x12, 0x22, 0x21, 0x0, 0x0, 0x3b, 0xcc, 0xcb,
+    0x30, 0x0, 0x9, 0xff, 0xff, 0x80, 0x0, 0x1,
+    0xaf, 0xff, 0xd3, 0x0, 0x0, 0x2d, 0xff, 0xf8,
+    0x0, 0x0, 0x3, 0xdf, 0xfe, 0x20, 0x0, 0x0,
+    0x6e, 0xff, 0x70, 0x0, 0x0, 0x6, 0xaa, 0x81,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x44,
+    0x44, 0x0, 0x0, 0x8, 0xff, 0xfe, 0x10, 0x0,
+    0x8, 0xff, 0xfe, 0x10, 0x0, 0x8, 0xff, 0xfe,
+    0x10, 0x0, 0x8, 0xff, 0xfe, 0x10, 0x0, 0x8,
+    0xff, 0xfe, 0x10, 0x0, 0x8, 0xff, 0xfe, 0x10,
+    0x0, 0x8, 0xff, 0xfe, 0x10, 0x0, 0x8, 0xff,
+    0xfe, 0x10, 0x0, 0x8, 0xff, 0xfe, 0x10, 0x0,
+    0x8, 0xff, 0xfe, 0x10, 0x0, 0x8, 0xff, 0xfe,
+    0x10, 0x0, 0x8, 0xff, 0xfe, 0x10, 0x0, 0x8,
+    0xff, 0xfe, 0x10, 0x0, 0x8, 0xff, 0xfe, 0x10,
+    0x0, 0x8, 0xff, 0xfe, 0x10, 0x0, 0x8, 0xff,
+    0xfe, 0x10, 0x0, 0x8, 0xff, 0xfe, 0x10, 0x0,
+    0x8, 0xff, 0xfe, 0x10, 0x0, 0x8, 0xff, 0xfe,
+    0x10, 0x0, 0x8, 0xff, 0xfe, 0x10, 0x0, 0x8,
+    0xff, 0xfe, 0x10, 0x0, 0x8, 0xff, 0xfe, 0x10,
+    0x0, 0x8, 0xff, 0xfe, 0x10, 0x0, 0x8, 0xff,
+    0xfe, 0x10, 0x0, 0x8, 0xff, 0xfe, 0x10, 0x0,
+    0x8, 0xff, 0xfe, 0x10, 0x0, 0x8, 0xff, 0xfe,
+    0x10, 0x0, 0x8, 0xff, 0xfe, 0x10, 0x0, 0x8,
+    0xff, 0xfe, 0x10, 0x0, 0x8, 0xff, 0xfe, 0x10,
+    0x0, 0x8, 0xff, 0xfe, 0x10, 0x0, 0x8, 0xff,
+    0xfe, 0x10, 0x0, 0x8, 0xff, 0xfe, 0x10, 0x0,
+    0x8, 0xff, 0xfe, 0x10,
+
+    /* U+00CD "Í" */
+    0x0, 0x1, 0x22, 0x22, 0x10, 0x1, 0x9c, 0xcc,
+    0xc6, 0x0, 0x5e, 0xff, 0xfc, 0x10, 0x1a, 0xff,
+    0xfd, 0x30, 0x4, 0xef, 0xfe, 0x50, 0x0, 0xaf,
+    0xff, 0x70, 0x0, 0x3e, 0xff, 0xa1, 0x0, 0x5,
+    0xaa, 0x91, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x24, 0x44, 0x40, 0x0, 0x8, 0xff, 0xfe,
+    0x10, 0x0, 0x8f, 0xff, 0xe1, 0x0, 0x8, 0xff,
+    0xfe, 0x10, 0x0, 0x8f, 0xff, 0xe1, 0x0, 0x8,
+    0xff, 0xfe, 0x10, 0x0, 0x8f, 0xff, 0xe1, 0x0,
+    0x8, 0xff, 0xfe, 0x10, 0x0, 0x8f, 0xff, 0xe1,
+    0x0, 0x8, 0xff, 0xfe, 0x10, 0x0, 0x8f, 0xff,
+    0xe1, 0x0, 0x8, 0xff, 0xfe, 0x10, 0x0, 0x8f,
+    0xff, 0xe1, 0x0, 0x8, 0xff, 0xfe, 0x10, 0x0,
+    0x8f, 0xff, 0xe1, 0x0, 0x8, 0xff, 0xfe, 0x10,
+    0x0, 0x8f, 0xff, 0xe1, 0x0, 0x8, 0xff, 0xfe,
+    0x10, 0x0, 0x8f, 0xff, 0xe1, 0x0, 0x8, 0xff,
+    0xfe, 0x10, 0x0, 0x8f, 0xff, 0xe1, 0x0, 0x8,
+    0xff, 0xfe, 0x10, 0x0, 0x8f, 0xff, 0xe1, 0x0,
+    0x8, 0xff, 0xfe, 0x10, 0x0, 0x8f, 0xff, 0xe1,
+    0x0, 0x8, 0xff, 0xfe, 0x10, 0x0, 0x8f, 0xff,
+    0xe1, 0x0, 0x8, 0xff, 0xfe, 0x10, 0x0, 0x8f,
+    0xff, 0xe1, 0x0, 0x8, 0xff, 0xfe, 0x10, 0x0,
+    0x8f, 0xff, 0xe1, 0x0, 0x8, 0xff, 0xfe, 0x10,
+    0x0, 0x8f, 0xff, 0xe1, 0x0, 0x8, 0xff, 0xfe,
+    0x10, 0x0, 0x8f, 0xff, 0xe1, 0x0,
+
+    /* U+00CE "Î" */
+    0x0, 0x0, 0x1, 0x22, 0x21, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2a, 0xcc, 0xcb, 0x30, 0x0, 0x0,
+    0x0, 0x1, 0xaf, 0xff, 0xff, 0xb2, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0xfd, 0xff, 0xfb, 0x10, 0x0,
+    0x0, 0x5e, 0xff, 0xe5, 0xaf, 0xff, 0x70, 0x0,
+    0x3, 0xdf, 0xff, 0x70, 0x3d, 0xff, 0xe6, 0x0,
+    0x1c, 0xff, 0xfc, 0x10, 0x7, 0xff, 0xfe, 0x30,
+    0x5a, 0xaa, 0xa3, 0x0, 0x1, 0x9a, 0xaa, 0x71,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0x44, 0x44, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xfe, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xfe, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xfe, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xfe, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xfe, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xfe, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xfe, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xfe, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xfe, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xfe, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xfe, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xfe, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xfe, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xfe, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xfe, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xfe, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xfe, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xfe, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xfe, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xfe, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xfe, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xfe, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xfe, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xfe, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xfe, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xfe, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xfe, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xfe, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xfe, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xfe, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xfe, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xfe, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xfe, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xfe, 0x10, 0x0, 0x0,
+
+    /* U+00CF "Ï" */
+    0x22, 0x22, 0x10, 0x0, 0x2, 0x22, 0x20, 0xef,
+    0xff, 0x80, 0x0, 0x2f, 0xff, 0xf3, 0xef, 0xff,
+    0x80, 0x0, 0x2f, 0xff, 0xf4, 0xef, 0xff, 0x80,
+    0x0, 0x2f, 0xff, 0xf4, 0xef, 0xff, 0x80, 0x0,
+    0x2f, 0xff, 0xf4, 0x9a, 0xaa, 0x50, 0x0, 0x1a,
+    0xaa, 0xa3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x24, 0x44, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0xe1, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
+    0xe1, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xe1,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xe1, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0xe1, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0xe1, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
+    0xe1, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xe1,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xe1, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0xe1, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0xe1, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
+    0xe1, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xe1,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xe1, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0xe1, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0xe1, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
+    0xe1, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xe1,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xe1, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0xe1, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0xe1, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xff, 0xe1, 0x0, 0x0,
+
+    /* U+00D0 "Ð" */
+    0x0, 0x0, 0x14, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x43, 0x32, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5e, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0xee, 0xdc, 0xa7, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5e, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5e, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5e, 0xff,
+    0xfd, 0xcc, 0xcc, 0xcc, 0xcc, 0xdd, 0xde, 0xff,
+    0xff, 0xfe, 0x71, 0x0, 0x0, 0x0, 0x0, 0x5e,
+    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x11, 0x36,
+    0x9e, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
+    0x5e, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x14, 0xbf, 0xff, 0xfd, 0x40, 0x0, 0x0,
+    0x0, 0x5e, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1b, 0xff, 0xff, 0xb1, 0x0,
+    0x0, 0x0, 0x5e, 0xff, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xcf, 0xff, 0xf4,
+    0x0, 0x0, 0x0, 0x5e, 0xff, 0xf3, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
+    0xfb, 0x0, 0x0, 0x0, 0x5e, 0xff, 0xf3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0xff, 0xfd, 0x20, 0x0, 0x0, 0x5e, 0xff, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0xfe, 0x60, 0x0, 0x0, 0x5e, 0xff,
+    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xef, 0xff, 0x80, 0x0, 0x0, 0x5e,
+    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xcf, 0xff, 0xb1, 0x0, 0x0,
+    0x5e, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xaf, 0xff, 0xc2, 0x0,
+    0x0, 0x5e, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xd2,
+    0x8, 0x88, 0xaf, 0xff, 0xf9, 0x88, 0x88, 0x88,
+    0x88, 0x60, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
+    0xd3, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x9f,
+    0xff, 0xe3, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xff, 0xe3, 0x9, 0x99, 0xbf, 0xff, 0xfa,
+    0x99, 0x99, 0x99, 0x99, 0x60, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0xff, 0xd3, 0x0, 0x0, 0x5e, 0xff,
+    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xaf, 0xff, 0xc2, 0x0, 0x0, 0x5e,
+    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xbf, 0xff, 0xb1, 0x0, 0x0,
+    0x5e, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xdf, 0xff, 0xa1, 0x0,
+    0x0, 0x5e, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0x80,
+    0x0, 0x0, 0x5e, 0xff, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xfe,
+    0x40, 0x0, 0x0, 0x5e, 0xff, 0xf3, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xff,
+    0xfd, 0x10, 0x0, 0x0, 0x5e, 0xff, 0xf3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0xf7, 0x0, 0x0, 0x0, 0x5e, 0xff, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xdf, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x5e, 0xff,
+    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2d, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x5e,
+    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x16, 0xdf, 0xff, 0xfc, 0x20, 0x0, 0x0, 0x0,
+    0x5e, 0xff, 0xf5, 0x22, 0x22, 0x22, 0x22, 0x23,
+    0x59, 0xce, 0xff, 0xff, 0xe4, 0x0, 0x0, 0x0,
+    0x0, 0x5e, 0xff, 0xff, 0xee, 0xee, 0xee, 0xee,
+    0xff, 0xff, 0xff, 0xff, 0xfd, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5e, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0xb5, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5e, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0xdb, 0x74, 0x10, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+00D1 "Ñ" */
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xac, 0xb8, 0x31,
+    0x0, 0x5, 0xcc, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7e, 0xff, 0xff, 0xe9, 0x41, 0x1a,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xef, 0xff, 0xff, 0xff, 0xec, 0xcf, 0xff, 0x60,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xd7,
+    0x6a, 0xef, 0xff, 0xff, 0xfb, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1b, 0xff, 0x60, 0x1, 0x5b,
+    0xff, 0xff, 0xd3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x16, 0x88, 0x20, 0x0, 0x0, 0x37, 0x75,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x24, 0x44, 0x42, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x44, 0x43,
+    0x6e, 0xff, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0xfb, 0x6e, 0xff,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9, 0xff, 0xfb, 0x6e, 0xff, 0xff, 0xe4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xfb, 0x6e, 0xff, 0xff, 0xfc, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xfb,
+    0x6e, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0xfb, 0x6e, 0xff,
+    0xff, 0xff, 0xd4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9, 0xff, 0xfb, 0x6e, 0xff, 0xff, 0xff,
+    0xfc, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xfb, 0x6e, 0xff, 0xec, 0xff, 0xff, 0x70,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xfb,
+    0x6e, 0xff, 0xd4, 0xdf, 0xff, 0xe4, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0xfb, 0x6e, 0xff,
+    0xd3, 0x6e, 0xff, 0xfb, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x9, 0xff, 0xfb, 0x6e, 0xff, 0xd3, 0x19,
+    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xfb, 0x6e, 0xff, 0xd3, 0x2, 0xef, 0xff,
+    0xe4, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xfb,
+    0x6e, 0xff, 0xd3, 0x0, 0x6e, 0xff, 0xfc, 0x20,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0xfb, 0x6e, 0xff,
+    0xd3, 0x0, 0x1a, 0xff, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x9, 0xff, 0xfb, 0x6e, 0xff, 0xd3, 0x0,
+    0x2, 0xef, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xfb, 0x6e, 0xff, 0xd3, 0x0, 0x0, 0x6e,
+    0xff, 0xfc, 0x20, 0x0, 0x0, 0x9, 0xff, 0xfb,
+    0x6e, 0xff, 0xd3, 0x0, 0x0, 0x1a, 0xff, 0xff,
+    0x80, 0x0, 0x0, 0x9, 0xff, 0xfb, 0x6e, 0xff,
+    0xd3, 0x0, 0x0, 0x2, 0xdf, 0xff, 0xe4, 0x0,
+    0x0, 0x9, 0xff, 0xfb, 0x6e, 0xff, 0xd3, 0x0,
+    0x0, 0x0, 0x6f, 0xff, 0xfb, 0x20, 0x0, 0x9,
+    0xff, 0xfb, 0x6e, 0xff, 0xd3, 0x0, 0x0, 0x0,
+    0x19, 0xff, 0xff, 0x90, 0x0, 0x9, 0xff, 0xfb,
+    0x6e, 0xff, 0xd3, 0x0, 0x0, 0x0, 0x2, 0xdf,
+    0xff, 0xe4, 0x0, 0x9, 0xff, 0xfb, 0x6e, 0xff,
+    0xd3, 0x0, 0x0, 0x0, 0x0, 0x5e, 0xff, 0xfc,
+    0x20, 0x9, 0xff, 0xfb, 0x6e, 0xff, 0xd3, 0x0,
+    0x0, 0x0, 0x0, 0x1a, 0xff, 0xff, 0x90, 0x9,
+    0xff, 0xfb, 0x6e, 0xff, 0xd3, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xcf, 0xff, 0xf4, 0x9, 0xff, 0xfb,
+    0x6e, 0xff, 0xd3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5f, 0xff, 0xfb, 0x29, 0xff, 0xfb, 0x6e, 0xff,
+    0xd3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x19, 0xff,
+    0xff, 0x9a, 0xff, 0xfb, 0x6e, 0xff, 0xd3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xff, 0xfd,
+    0xff, 0xfb, 0x6e, 0xff, 0xd3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xfb,
+    0x6e, 0xff, 0xd3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9, 0xff, 0xff, 0xff, 0xfb, 0x6e, 0xff,
+    0xd3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xcf, 0xff, 0xff, 0xfb, 0x6e, 0xff, 0xd3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
+    0xff, 0xfb, 0x6e, 0xff, 0xd3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xfb,
+    0x6e, 0xff, 0xd3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xcf, 0xff, 0xfb, 0x6e, 0xff,
+    0xd3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5f, 0xff, 0xfb,
+
+    /* U+00D2 "Ò" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x22, 0x22,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1a, 0xcc,
+    0xcc, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xdf, 0xff, 0xc2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6e, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xfd, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x9f, 0xff, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2c, 0xff, 0xc2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xaa,
+    0xa3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x47,
+    0x9a, 0xbb, 0x98, 0x53, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x9d,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0xa7, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xae,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6d,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x18,
+    0xef, 0xff, 0xfe, 0xd9, 0x53, 0x23, 0x47, 0xbd,
+    0xff, 0xff, 0xfb, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xff, 0xc6, 0x10, 0x0, 0x0, 0x0,
+    0x3, 0xae, 0xff, 0xff, 0xc2, 0x0, 0x0, 0x0,
+    0x5, 0xef, 0xff, 0xf9, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x15, 0xef, 0xff, 0xfa, 0x10, 0x0,
+    0x0, 0x2c, 0xff, 0xfe, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4d, 0xff, 0xff, 0x60,
+    0x0, 0x0, 0x7f, 0xff, 0xf9, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xef, 0xff,
+    0xd1, 0x0, 0x2, 0xef, 0xff, 0xd1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
+    0xff, 0xf7, 0x0, 0x6, 0xff, 0xff, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3d, 0xff, 0xfb, 0x10, 0x1a, 0xff, 0xfd, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x19, 0xff, 0xfe, 0x40, 0x2d, 0xff, 0xfa,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xef, 0xff, 0x70, 0x4f, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xdf, 0xff, 0xb0, 0x6f,
+    0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xe0,
+    0x7f, 0xff, 0xe4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
+    0xf1, 0x9f, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
+    0xff, 0xf2, 0xaf, 0xff, 0xd2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xff, 0xf3, 0xaf, 0xff, 0xd2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xff, 0xf2, 0x9f, 0xff, 0xd2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0xf1, 0x8f, 0xff, 0xe3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xff, 0xf0, 0x6f, 0xff,
+    0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xe0, 0x4f,
+    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xdf, 0xff, 0xa0,
+    0x2d, 0xff, 0xf9, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xef, 0xff,
+    0x70, 0x19, 0xff, 0xfd, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xfe, 0x40, 0x6, 0xef, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d,
+    0xff, 0xfb, 0x20, 0x1, 0xdf, 0xff, 0xe2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xff, 0xf6, 0x0, 0x0, 0x6f, 0xff, 0xfa,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xef, 0xff, 0xd1, 0x0, 0x0, 0x1b, 0xff,
+    0xff, 0x91, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4d, 0xff, 0xff, 0x60, 0x0, 0x0, 0x3,
+    0xdf, 0xff, 0xf9, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x15, 0xef, 0xff, 0xf9, 0x10, 0x0, 0x0,
+    0x0, 0x6e, 0xff, 0xff, 0xd5, 0x10, 0x0, 0x0,
+    0x0, 0x13, 0xae, 0xff, 0xff, 0xc2, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xef, 0xff, 0xff, 0xd8, 0x65,
+    0x55, 0x67, 0xbe, 0xff, 0xff, 0xfb, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4d, 0xff, 0xff, 0xff,
+    0xfe, 0xee, 0xef, 0xff, 0xff, 0xff, 0xa2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x8d, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0x8d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa5, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x26, 0x8a, 0xaa, 0x97, 0x41, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+00D3 "Ó" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x22, 0x22, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4b, 0xcc, 0xcb, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x9f, 0xff, 0xe7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xef, 0xff, 0x91, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0xfc, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3e, 0xff, 0xd3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xfe, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x8a, 0xa6,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x47,
+    0x9a, 0xbb, 0x98, 0x53, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x9d,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0xa7, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xae,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6d,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x18,
+    0xef, 0xff, 0xfe, 0xd9, 0x53, 0x23, 0x47, 0xbd,
+    0xff, 0xff, 0xfb, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xff, 0xc6, 0x10, 0x0, 0x0, 0x0,
+    0x3, 0xae, 0xff, 0xff, 0xc2, 0x0, 0x0, 0x0,
+    0x5, 0xef, 0xff, 0xf9, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x15, 0xef, 0xff, 0xfa, 0x10, 0x0,
+    0x0, 0x2c, 0xff, 0xfe, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4d, 0xff, 0xff, 0x60,
+    0x0, 0x0, 0x7f, 0xff, 0xf9, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xef, 0xff,
+    0xd1, 0x0, 0x2, 0xef, 0xff, 0xd1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
+    0xff, 0xf7, 0x0, 0x6, 0xff, 0xff, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3d, 0xff, 0xfb, 0x10, 0x1a, 0xff, 0xfd, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x19, 0xff, 0xfe, 0x40, 0x2d, 0xff, 0xfa,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xef, 0xff, 0x70, 0x4f, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xdf, 0xff, 0xb0, 0x6f,
+    0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xe0,
+    0x7f, 0xff, 0xe4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
+    0xf1, 0x9f, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
+    0xff, 0xf2, 0xaf, 0xff, 0xd2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xff, 0xf3, 0xaf, 0xff, 0xd2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xff, 0xf2, 0x9f, 0xff, 0xd2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0xf1, 0x8f, 0xff, 0xe3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xff, 0xf0, 0x6f, 0xff,
+    0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xe0, 0x4f,
+    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xdf, 0xff, 0xa0,
+    0x2d, 0xff, 0xf9, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xef, 0xff,
+    0x70, 0x19, 0xff, 0xfd, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xfe, 0x40, 0x6, 0xef, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d,
+    0xff, 0xfb, 0x20, 0x1, 0xdf, 0xff, 0xe2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xff, 0xf6, 0x0, 0x0, 0x6f, 0xff, 0xfa,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xef, 0xff, 0xd1, 0x0, 0x0, 0x1b, 0xff,
+    0xff, 0x91, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4d, 0xff, 0xff, 0x60, 0x0, 0x0, 0x3,
+    0xdf, 0xff, 0xf9, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x15, 0xef, 0xff, 0xf9, 0x10, 0x0, 0x0,
+    0x0, 0x6e, 0xff, 0xff, 0xd5, 0x10, 0x0, 0x0,
+    0x0, 0x13, 0xae, 0xff, 0xff, 0xc2, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xef, 0xff, 0xff, 0xd8, 0x65,
+    0x55, 0x67, 0xbe, 0xff, 0xff, 0xfb, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4d, 0xff, 0xff, 0xff,
+    0xfe, 0xee, 0xef, 0xff, 0xff, 0xff, 0xa2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x8d, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0x8d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa5, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x26, 0x8a, 0xaa, 0x97, 0x41, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+00D4 "Ô" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x12,
+    0x22, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xac, 0xcc, 0xb3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1b, 0xff, 0xff, 0xfc, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x8f, 0xff, 0xef, 0xff, 0x91, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xef, 0xfd, 0x5b, 0xff, 0xe7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3e, 0xff, 0xf7, 0x3, 0xef, 0xff,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xbf, 0xff, 0xb2, 0x0, 0x7f,
+    0xff, 0xd3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xaa, 0xa9, 0x30, 0x0,
+    0x18, 0xaa, 0xa7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x47,
+    0x9a, 0xbb, 0x98, 0x53, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x9d,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0xa7, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xae,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6d,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x18,
+    0xef, 0xff, 0xfe, 0xd9, 0x53, 0x23, 0x47, 0xbd,
+    0xff, 0xff, 0xfb, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xff, 0xc6, 0x10, 0x0, 0x0, 0x0,
+    0x3, 0xae, 0xff, 0xff, 0xc2, 0x0, 0x0, 0x0,
+    0x5, 0xef, 0xff, 0xf9, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x15, 0xef, 0xff, 0xfa, 0x10, 0x0,
+    0x0, 0x2c, 0xff, 0xfe, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4d, 0xff, 0xff, 0x60,
+    0x0, 0x0, 0x7f, 0xff, 0xf9, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xef, 0xff,
+    0xd1, 0x0, 0x2, 0xef, 0xff, 0xd1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
+    0xff, 0xf7, 0x0, 0x6, 0xff, 0xff, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3d, 0xff, 0xfb, 0x10, 0x1a, 0xff, 0xfd, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x19, 0xff, 0xfe, 0x40, 0x2d, 0xff, 0xfa,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xef, 0xff, 0x70, 0x4f, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xdf, 0xff, 0xb0, 0x6f,
+    0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xe0,
+    0x7f, 0xff, 0xe4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
+    0xf1, 0x9f, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
+    0xff, 0xf2, 0xaf, 0xff, 0xd2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xff, 0xf3, 0xaf, 0xff, 0xd2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xff, 0xf2, 0x9f, 0xff, 0xd2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0xf1, 0x8f, 0xff, 0xe3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xff, 0xf0, 0x6f, 0xff,
+    0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xe0, 0x4f,
+    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xdf, 0xff, 0xa0,
+    0x2d, 0xff, 0xf9, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xef, 0xff,
+    0x70, 0x19, 0xff, 0xfd, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xfe, 0x40, 0x6, 0xef, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d,
+    0xff, 0xfb, 0x20, 0x1, 0xdf, 0xff, 0xe2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xff, 0xf6, 0x0, 0x0, 0x6f, 0xff, 0xfa,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xef, 0xff, 0xd1, 0x0, 0x0, 0x1b, 0xff,
+    0xff, 0x91, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4d, 0xff, 0xff, 0x60, 0x0, 0x0, 0x3,
+    0xdf, 0xff, 0xf9, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x15, 0xef, 0xff, 0xf9, 0x10, 0x0, 0x0,
+    0x0, 0x6e, 0xff, 0xff, 0xd5, 0x10, 0x0, 0x0,
+    0x0, 0x13, 0xae, 0xff, 0xff, 0xc2, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xef, 0xff, 0xff, 0xd8, 0x65,
+    0x55, 0x67, 0xbe, 0xff, 0xff, 0xfb, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4d, 0xff, 0xff, 0xff,
+    0xfe, 0xee, 0xef, 0xff, 0xff, 0xff, 0xa2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x8d, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0x8d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa5, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x26, 0x8a, 0xaa, 0x97, 0x41, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+00D5 "Õ" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x57, 0x62,
+    0x10, 0x0, 0x4, 0x88, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5d, 0xff,
+    0xff, 0xb6, 0x20, 0x1b, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xdf,
+    0xff, 0xff, 0xfe, 0xcb, 0xce, 0xff, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xda, 0xad, 0xff, 0xff, 0xff, 0xfc, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xe, 0xfe, 0x60, 0x13, 0x9e, 0xff, 0xff, 0xd4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xa9, 0x20, 0x0, 0x1, 0x69, 0x97,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0x47, 0x9a, 0xbb,
+    0x98, 0x53, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0x9d, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0xa7, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xae, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6d, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0xef, 0xff,
+    0xfe, 0xd9, 0x53, 0x23, 0x47, 0xbd, 0xff, 0xff,
+    0xfb, 0x30, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xff, 0xc6, 0x10, 0x0, 0x0, 0x0, 0x3, 0xae,
+    0xff, 0xff, 0xc2, 0x0, 0x0, 0x0, 0x5, 0xef,
+    0xff, 0xf9, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x15, 0xef, 0xff, 0xfa, 0x10, 0x0, 0x0, 0x2c,
+    0xff, 0xfe, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4d, 0xff, 0xff, 0x60, 0x0, 0x0,
+    0x7f, 0xff, 0xf9, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xef, 0xff, 0xd1, 0x0,
+    0x2, 0xef, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf7,
+    0x0, 0x6, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3d, 0xff,
+    0xfb, 0x10, 0x1a, 0xff, 0xfd, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x19,
+    0xff, 0xfe, 0x40, 0x2d, 0xff, 0xfa, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xef, 0xff, 0x70, 0x4f, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xdf, 0xff, 0xb0, 0x6f, 0xff, 0xe5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xcf, 0xff, 0xe0, 0x7f, 0xff,
+    0xe4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf1, 0x9f,
+    0xff, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf2,
+    0xaf, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
+    0xf3, 0xaf, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xff, 0xf2, 0x9f, 0xff, 0xd2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xff, 0xf1, 0x8f, 0xff, 0xe3, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0xff, 0xf0, 0x6f, 0xff, 0xe5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xcf, 0xff, 0xe0, 0x4f, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xdf, 0xff, 0xa0, 0x2d, 0xff,
+    0xf9, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xef, 0xff, 0x70, 0x19,
+    0xff, 0xfd, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xfe, 0x40,
+    0x6, 0xef, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xff, 0xfb,
+    0x20, 0x1, 0xdf, 0xff, 0xe2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
+    0xf6, 0x0, 0x0, 0x6f, 0xff, 0xfa, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xef,
+    0xff, 0xd1, 0x0, 0x0, 0x1b, 0xff, 0xff, 0x91,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4d,
+    0xff, 0xff, 0x60, 0x0, 0x0, 0x3, 0xdf, 0xff,
+    0xf9, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x15,
+    0xef, 0xff, 0xf9, 0x10, 0x0, 0x0, 0x0, 0x6e,
+    0xff, 0xff, 0xd5, 0x10, 0x0, 0x0, 0x0, 0x13,
+    0xae, 0xff, 0xff, 0xc2, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xef, 0xff, 0xff, 0xd8, 0x65, 0x55, 0x67,
+    0xbe, 0xff, 0xff, 0xfb, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4d, 0xff, 0xff, 0xff, 0xfe, 0xee,
+    0xef, 0xff, 0xff, 0xff, 0xa2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0x8d, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xb5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x8d, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xa5, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x26, 0x8a, 0xaa, 0x97, 0x41, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+00D6 "Ö" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x22, 0x22, 0x10,
+    0x0, 0x12, 0x22, 0x21, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xff,
+    0x70, 0x0, 0x4d, 0xff, 0xe5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xcf,
+    0xff, 0x70, 0x0, 0x4d, 0xff, 0xe5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xcf, 0xff, 0x70, 0x0, 0x4d, 0xff, 0xe5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xcf, 0xff, 0x70, 0x0, 0x4d, 0xff, 0xe5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x8a, 0xaa, 0x50, 0x0, 0x39, 0xaa,
+    0x93, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0x47, 0x9a, 0xbb,
+    0x98, 0x53, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0x9d, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0xa7, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xae, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6d, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0xef, 0xff,
+    0xfe, 0xd9, 0x53, 0x23, 0x47, 0xbd, 0xff, 0xff,
+    0xfb, 0x30, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xff, 0xc6, 0x10, 0x0, 0x0, 0x0, 0x3, 0xae,
+    0xff, 0xff, 0xc2, 0x0, 0x0, 0x0, 0x5, 0xef,
+    0xff, 0xf9, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x15, 0xef, 0xff, 0xfa, 0x10, 0x0, 0x0, 0x2c,
+    0xff, 0xfe, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4d, 0xff, 0xff, 0x60, 0x0, 0x0,
+    0x7f, 0xff, 0xf9, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xef, 0xff, 0xd1, 0x0,
+    0x2, 0xef, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf7,
+    0x0, 0x6, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3d, 0xff,
+    0xfb, 0x10, 0x1a, 0xff, 0xfd, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x19,
+    0xff, 0xfe, 0x40, 0x2d, 0xff, 0xfa, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xef, 0xff, 0x70, 0x4f, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xdf, 0xff, 0xb0, 0x6f, 0xff, 0xe5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xcf, 0xff, 0xe0, 0x7f, 0xff,
+    0xe4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf1, 0x9f,
+    0xff, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf2,
+    0xaf, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
+    0xf3, 0xaf, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xff, 0xf2, 0x9f, 0xff, 0xd2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xff, 0xf1, 0x8f, 0xff, 0xe3, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0xff, 0xf0, 0x6f, 0xff, 0xe5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xcf, 0xff, 0xe0, 0x4f, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xdf, 0xff, 0xa0, 0x2d, 0xff,
+    0xf9, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xef, 0xff, 0x70, 0x19,
+    0xff, 0xfd, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xfe, 0x40,
+    0x6, 0xef, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xff, 0xfb,
+    0x20, 0x1, 0xdf, 0xff, 0xe2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
+    0xf6, 0x0, 0x0, 0x6f, 0xff, 0xfa, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xef,
+    0xff, 0xd1, 0x0, 0x0, 0x1b, 0xff, 0xff, 0x91,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4d,
+    0xff, 0xff, 0x60, 0x0, 0x0, 0x3, 0xdf, 0xff,
+    0xf9, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x15,
+    0xef, 0xff, 0xf9, 0x10, 0x0, 0x0, 0x0, 0x6e,
+    0xff, 0xff, 0xd5, 0x10, 0x0, 0x0, 0x0, 0x13,
+    0xae, 0xff, 0xff, 0xc2, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xef, 0xff, 0xff, 0xd8, 0x65, 0x55, 0x67,
+    0xbe, 0xff, 0xff, 0xfb, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4d, 0xff, 0xff, 0xff, 0xfe, 0xee,
+    0xef, 0xff, 0xff, 0xff, 0xa2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0x8d, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xb5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x8d, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xa5, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x26, 0x8a, 0xaa, 0x97, 0x41, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+00D7 "×" */
+    0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x10, 0x0, 0x2, 0xa5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4a, 0x20, 0x3, 0xcf, 0xe6,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5e, 0xfb, 0x31,
+    0xbf, 0xff, 0xd5, 0x0, 0x0, 0x0, 0x0, 0x4d,
+    0xff, 0xfc, 0x7, 0xef, 0xff, 0xe6, 0x0, 0x0,
+    0x0, 0x5e, 0xff, 0xfe, 0x70, 0x17, 0xef, 0xff,
+    0xe5, 0x0, 0x0, 0x5d, 0xff, 0xff, 0x71, 0x0,
+    0x7, 0xef, 0xff, 0xe6, 0x0, 0x5e, 0xff, 0xfe,
+    0x70, 0x0, 0x0, 0x17, 0xef, 0xff, 0xe5, 0x5d,
+    0xff, 0xfe, 0x71, 0x0, 0x0, 0x0, 0x7, 0xef,
+    0xff, 0xee, 0xff, 0xfe, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xef, 0xff, 0xff, 0xfe, 0x71, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x17, 0xff, 0xff, 0xff,
+    0x71, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
+    0xff, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5d, 0xff, 0xff, 0xff, 0xd5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5e, 0xff, 0xff, 0xef, 0xff,
+    0xe6, 0x0, 0x0, 0x0, 0x0, 0x5d, 0xff, 0xff,
+    0x77, 0xef, 0xff, 0xd5, 0x0, 0x0, 0x0, 0x6e,
+    0xff, 0xfe, 0x60, 0x6, 0xef, 0xff, 0xe6, 0x0,
+    0x0, 0x5d, 0xff, 0xff, 0x61, 0x0, 0x17, 0xef,
+    0xff, 0xe5, 0x0, 0x6e, 0xff, 0xfe, 0x60, 0x0,
+    0x0, 0x6, 0xef, 0xff, 0xe6, 0x1d, 0xff, 0xfe,
+    0x61, 0x0, 0x0, 0x0, 0x17, 0xef, 0xff, 0xd0,
+    0x4d, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0xef, 0xd4, 0x0, 0x4d, 0x61, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xc3, 0x0, 0x0, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0,
+
+    /* U+00D8 "Ø" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x46,
+    0x8a, 0xbb, 0xa8, 0x53, 0x10, 0x0, 0x0, 0x1,
+    0x8e, 0x60, 0x0, 0x0, 0x0, 0x0, 0x4, 0x9c,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0xa6, 0x0, 0x0,
+    0x7, 0xef, 0xe4, 0x0, 0x0, 0x0, 0x4, 0xae,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc5,
+    0x10, 0x6f, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x6d,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0x96, 0xef, 0xfb, 0x20, 0x0, 0x0, 0x18,
+    0xef, 0xff, 0xfe, 0xc8, 0x53, 0x23, 0x47, 0xbe,
+    0xff, 0xff, 0xfe, 0xff, 0xc2, 0x0, 0x0, 0x0,
+    0x8f, 0xff, 0xff, 0xb5, 0x10, 0x0, 0x0, 0x0,
+    0x4, 0xbe, 0xff, 0xff, 0xfd, 0x30, 0x0, 0x0,
+    0x6, 0xef, 0xff, 0xe7, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x16, 0xef, 0xff, 0xfa, 0x10, 0x0,
+    0x0, 0x2d, 0xff, 0xfe, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xcf, 0xff, 0xfe, 0x50,
+    0x0, 0x0, 0x8f, 0xff, 0xf8, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x19, 0xff, 0xff, 0xff,
+    0xc0, 0x0, 0x2, 0xef, 0xff, 0xc1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xaf, 0xfe, 0xcf,
+    0xff, 0xf6, 0x0, 0x7, 0xff, 0xff, 0x60, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf8,
+    0x4e, 0xff, 0xfa, 0x10, 0x1b, 0xff, 0xfc, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0x81, 0x1a, 0xff, 0xfe, 0x40, 0x3d, 0xff, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xef,
+    0xfb, 0x10, 0x7, 0xff, 0xff, 0x60, 0x5f, 0xff,
+    0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5e,
+    0xff, 0xa2, 0x0, 0x3, 0xef, 0xff, 0xa0, 0x7f,
+    0xff, 0xe4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xdf, 0xfd, 0x20, 0x0, 0x1, 0xdf, 0xff, 0xd0,
+    0x9f, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3c, 0xff, 0xc3, 0x0, 0x0, 0x0, 0xcf, 0xff,
+    0xe0, 0xaf, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xcf, 0xfe, 0x40, 0x0, 0x0, 0x0, 0xbf,
+    0xff, 0xf1, 0xbf, 0xff, 0xd1, 0x0, 0x0, 0x0,
+    0x0, 0x1b, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xff, 0xf1, 0xbf, 0xff, 0xd1, 0x0, 0x0,
+    0x0, 0x1, 0xaf, 0xfe, 0x60, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0xff, 0xf1, 0xbf, 0xff, 0xd2, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xaf, 0xff, 0xf0, 0xaf, 0xff, 0xd2,
+    0x0, 0x0, 0x1, 0x7f, 0xff, 0x81, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xcf, 0xff, 0xe0, 0x8f, 0xff,
+    0xe4, 0x0, 0x0, 0x6, 0xef, 0xfa, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xc0, 0x5f,
+    0xff, 0xf7, 0x0, 0x0, 0x5f, 0xff, 0xa1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xdf, 0xff, 0x90,
+    0x3e, 0xff, 0xf9, 0x0, 0x4, 0xdf, 0xfc, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xef, 0xff,
+    0x60, 0x1b, 0xff, 0xfd, 0x20, 0x3e, 0xff, 0xd2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x19, 0xff,
+    0xfd, 0x30, 0x7, 0xff, 0xff, 0x62, 0xcf, 0xfd,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3e,
+    0xff, 0xfa, 0x10, 0x1, 0xdf, 0xff, 0xec, 0xff,
+    0xe4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xaf, 0xff, 0xe5, 0x0, 0x0, 0x6f, 0xff, 0xff,
+    0xfe, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xef, 0xff, 0xc1, 0x0, 0x0, 0x1b, 0xff,
+    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5d, 0xff, 0xfe, 0x50, 0x0, 0x0, 0x4,
+    0xef, 0xff, 0xf9, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x16, 0xef, 0xff, 0xf8, 0x10, 0x0, 0x0,
+    0x7, 0xef, 0xff, 0xff, 0xc5, 0x10, 0x0, 0x0,
+    0x0, 0x13, 0xae, 0xff, 0xff, 0xb1, 0x0, 0x0,
+    0x0, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xd8, 0x65,
+    0x45, 0x67, 0xbe, 0xff, 0xff, 0xfa, 0x20, 0x0,
+    0x0, 0x5, 0xdf, 0xfb, 0x6d, 0xff, 0xff, 0xff,
+    0xfe, 0xee, 0xff, 0xff, 0xff, 0xff, 0x91, 0x0,
+    0x0, 0x0, 0x5d, 0xff, 0xc2, 0x2, 0x8e, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xa4, 0x0,
+    0x0, 0x0, 0x0, 0xbf, 0xfd, 0x40, 0x0, 0x4,
+    0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa5, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x2b, 0xd4, 0x0, 0x0,
+    0x0, 0x0, 0x36, 0x8a, 0xaa, 0x97, 0x31, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+00D9 "Ù" */
+    0x0, 0x0, 0x0, 0x0, 0x12, 0x22, 0x21, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4b, 0xcc, 0xcb, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x19, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xbf,
+    0xff, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3c, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xdf, 0xfc, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xaa, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x14, 0x44,
+    0x41, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0x44, 0x43, 0x4e, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xfc, 0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfc,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xfc, 0x5e, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xfc, 0x5e, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xfc, 0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfc,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xfc, 0x5e, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xfc, 0x5e, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xfc, 0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfc,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xfc, 0x5e, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xfc, 0x5e, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xfc, 0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfc,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xfc, 0x5e, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xfc, 0x5e, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xfc, 0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfc,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xfc, 0x4e, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xfc, 0x4e, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0xff, 0xfc, 0x3e, 0xff, 0xf6, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xfb,
+    0x3e, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xe, 0xff, 0xfa, 0x1e, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1e, 0xff, 0xf9, 0xd, 0xff, 0xfb, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3e,
+    0xff, 0xf7, 0xa, 0xff, 0xfe, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf4,
+    0x7, 0xff, 0xfe, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xbf, 0xff, 0xe2, 0x3, 0xef,
+    0xff, 0xb2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xef, 0xff, 0xa1, 0x1, 0xaf, 0xff, 0xfa,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3d, 0xff,
+    0xfe, 0x50, 0x0, 0x5e, 0xff, 0xff, 0xb5, 0x11,
+    0x0, 0x0, 0x1, 0x28, 0xdf, 0xff, 0xfa, 0x10,
+    0x0, 0x8, 0xff, 0xff, 0xff, 0xd9, 0x76, 0x67,
+    0x8b, 0xef, 0xff, 0xff, 0xd2, 0x0, 0x0, 0x1,
+    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfd, 0x40, 0x0, 0x0, 0x0, 0x6, 0xdf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xa1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x37, 0xdf, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0xb4, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0x58, 0x9a, 0xaa,
+    0x97, 0x40, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+00DA "Ú" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x12,
+    0x22, 0x21, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9c, 0xcc, 0xc7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xef, 0xff, 0xd2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x19, 0xff, 0xfd, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3d, 0xff,
+    0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xef, 0xfb, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xaa, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x14, 0x44,
+    0x41, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0x44, 0x43, 0x4e, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xfc, 0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfc,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xfc, 0x5e, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xfc, 0x5e, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xfc, 0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfc,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xfc, 0x5e, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xfc, 0x5e, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xfc, 0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfc,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xfc, 0x5e, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xfc, 0x5e, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xfc, 0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfc,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xfc, 0x5e, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xfc, 0x5e, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xfc, 0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfc,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xfc, 0x4e, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xfc, 0x4e, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0xff, 0xfc, 0x3e, 0xff, 0xf6, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xfb,
+    0x3e, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xe, 0xff, 0xfa, 0x1e, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1e, 0xff, 0xf9, 0xd, 0xff, 0xfb, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3e,
+    0xff, 0xf7, 0xa, 0xff, 0xfe, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf4,
+    0x7, 0xff, 0xfe, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xbf, 0xff, 0xe2, 0x3, 0xef,
+    0xff, 0xb2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xef, 0xff, 0xa1, 0x1, 0xaf, 0xff, 0xfa,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3d, 0xff,
+    0xfe, 0x50, 0x0, 0x5e, 0xff, 0xff, 0xb5, 0x11,
+    0x0, 0x0, 0x1, 0x28, 0xdf, 0xff, 0xfa, 0x10,
+    0x0, 0x8, 0xff, 0xff, 0xff, 0xd9, 0x76, 0x67,
+    0x8b, 0xef, 0xff, 0xff, 0xd2, 0x0, 0x0, 0x1,
+    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfd, 0x40, 0x0, 0x0, 0x0, 0x6, 0xdf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xa1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x37, 0xdf, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0xb4, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0x58, 0x9a, 0xaa,
+    0x97, 0x40, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+00DB "Û" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x22, 0x22,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xbc, 0xcc, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4e, 0xff, 0xff, 0xe7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xdf,
+    0xff, 0xef, 0xfe, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1a, 0xff, 0xfa, 0x5e,
+    0xff, 0xd3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0xd3, 0x18, 0xff, 0xfb,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xef, 0xff, 0x60, 0x2, 0xdf, 0xff, 0xa0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0xaa, 0xa8,
+    0x10, 0x0, 0x4a, 0xaa, 0xa3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x14, 0x44,
+    0x41, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0x44, 0x43, 0x5e, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xfc, 0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfc,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xfc, 0x5e, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xfc, 0x5e, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xfc, 0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfc,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xfc, 0x5e, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xfc, 0x5e, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xfc, 0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfc,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xfc, 0x5e, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xfc, 0x5e, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xfc, 0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfc,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xfc, 0x5e, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xfc, 0x5e, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xfc, 0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfc,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xfc, 0x4e, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xfc, 0x4e, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0xff, 0xfc, 0x3e, 0xff, 0xf6, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xfb,
+    0x3e, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xe, 0xff, 0xfa, 0x1e, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1e, 0xff, 0xf8, 0xd, 0xff, 0xfb, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3e,
+    0xff, 0xf7, 0xa, 0xff, 0xfe, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf4,
+    0x7, 0xff, 0xfe, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xbf, 0xff, 0xd2, 0x3, 0xef,
+    0xff, 0xb2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xef, 0xff, 0xa1, 0x1, 0xaf, 0xff, 0xfa,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3d, 0xff,
+    0xfe, 0x50, 0x0, 0x5e, 0xff, 0xff, 0xb5, 0x11,
+    0x0, 0x0, 0x1, 0x28, 0xdf, 0xff, 0xfa, 0x10,
+    0x0, 0x8, 0xff, 0xff, 0xff, 0xd9, 0x76, 0x67,
+    0x8b, 0xef, 0xff, 0xff, 0xd2, 0x0, 0x0, 0x1,
+    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfd, 0x40, 0x0, 0x0, 0x0, 0x6, 0xdf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xa1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x37, 0xdf, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0xb4, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0x58, 0x9a, 0xaa,
+    0x97, 0x40, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+00DC "Ü" */
+    0x0, 0x0, 0x0, 0x1, 0x22, 0x22, 0x0, 0x0,
+    0x12, 0x22, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0xff, 0x10, 0x0, 0x9f, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0xff, 0x10, 0x0, 0x9f, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
+    0x10, 0x0, 0x9f, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x10, 0x0,
+    0x9f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xaa, 0xaa, 0x10, 0x0, 0x6a, 0xaa,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x14, 0x44, 0x41, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x44, 0x43,
+    0x4e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xfc, 0x5e, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xfc, 0x5e, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xfc, 0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfc,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xfc, 0x5e, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xfc, 0x5e, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xfc, 0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfc,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xfc, 0x5e, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xfc, 0x5e, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xfc, 0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfc,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xfc, 0x5e, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xfc, 0x5e, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xfc, 0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfc,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xfc, 0x5e, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xfc, 0x5e, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xfc, 0x4e, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfc,
+    0x4e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xc, 0xff, 0xfc, 0x3e, 0xff,
+    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0xff, 0xfb, 0x3e, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
+    0xff, 0xfa, 0x1e, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xf9,
+    0xd, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3e, 0xff, 0xf7, 0xa, 0xff,
+    0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xf4, 0x7, 0xff, 0xfe, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xbf,
+    0xff, 0xe2, 0x3, 0xef, 0xff, 0xb2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xef, 0xff, 0xa1,
+    0x1, 0xaf, 0xff, 0xfa, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3d, 0xff, 0xfe, 0x50, 0x0, 0x5e,
+    0xff, 0xff, 0xb5, 0x11, 0x0, 0x0, 0x1, 0x28,
+    0xdf, 0xff, 0xfa, 0x10, 0x0, 0x8, 0xff, 0xff,
+    0xff, 0xd9, 0x76, 0x67, 0x8b, 0xef, 0xff, 0xff,
+    0xd2, 0x0, 0x0, 0x1, 0x9f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x40, 0x0,
+    0x0, 0x0, 0x6, 0xdf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0xa1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x37, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0xb4, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0x58, 0x9a, 0xaa, 0x97, 0x40, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+00DD "Ý" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x12, 0x22, 0x21, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xbc, 0xcc, 0xb3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0xff, 0x81, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e,
+    0xff, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0xc3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xcf,
+    0xfd, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xaa,
+    0x71, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x34, 0x44, 0x43, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x34, 0x44, 0x42,
+    0x6f, 0xff, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xef, 0xff, 0xe3,
+    0x19, 0xff, 0xff, 0xb1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2b, 0xff, 0xff, 0x70,
+    0x2, 0xdf, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xfa, 0x10,
+    0x0, 0x6e, 0xff, 0xfe, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xef, 0xff, 0xd3, 0x0,
+    0x0, 0x19, 0xff, 0xff, 0xb1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1a, 0xff, 0xff, 0x60, 0x0,
+    0x0, 0x2, 0xdf, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7e, 0xff, 0xf9, 0x10, 0x0,
+    0x0, 0x0, 0x5e, 0xff, 0xfd, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xef, 0xff, 0xc2, 0x0, 0x0,
+    0x0, 0x0, 0x1a, 0xff, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0x1a, 0xff, 0xff, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xcf, 0xff, 0xf6, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xff, 0xfd, 0x30, 0x0,
+    0x0, 0x2, 0xef, 0xff, 0xc2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x19, 0xff, 0xff, 0xb0, 0x0,
+    0x0, 0x1b, 0xff, 0xfe, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xdf, 0xff, 0xf5, 0x0,
+    0x0, 0x6e, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xfc, 0x20,
+    0x3, 0xdf, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1a, 0xff, 0xff, 0x80,
+    0x9, 0xff, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xff, 0xe3,
+    0x5e, 0xff, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xfc,
+    0xcf, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
+    0xff, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xff,
+    0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
+    0xff, 0x91, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
+    0xfd, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+00DE "Þ" */
+    0x14, 0x44, 0x41, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5e, 0xff,
+    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5e, 0xff, 0xf3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5e, 0xff, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5e, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5e, 0xff,
+    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5e, 0xff, 0xf3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5e, 0xff, 0xf8, 0x66, 0x66, 0x66,
+    0x66, 0x66, 0x54, 0x31, 0x0, 0x0, 0x0, 0x0,
+    0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0xee, 0xdc, 0xa4, 0x10, 0x0, 0x0, 0x5e, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xb3, 0x0, 0x0, 0x5e, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
+    0x40, 0x0, 0x5e, 0xff, 0xfb, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xbb, 0xdf, 0xff, 0xff, 0xd3, 0x0,
+    0x5e, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x38, 0xef, 0xff, 0xf9, 0x0, 0x5e, 0xff,
+    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5e, 0xff, 0xfd, 0x30, 0x5e, 0xff, 0xf3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xff, 0x70, 0x5e, 0xff, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xef, 0xff, 0xa1,
+    0x5e, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xbf, 0xff, 0xb1, 0x5e, 0xff,
+    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xbf, 0xff, 0xc2, 0x5e, 0xff, 0xf3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xbf,
+    0xff, 0xc1, 0x5e, 0xff, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xff, 0xa1,
+    0x5e, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xff, 0x80, 0x5e, 0xff,
+    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1c, 0xff, 0xfe, 0x50, 0x5e, 0xff, 0xf3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xbf, 0xff,
+    0xfb, 0x10, 0x5e, 0xff, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x25, 0x9d, 0xff, 0xff, 0xf5, 0x0,
+    0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0x81, 0x0, 0x5e, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf9, 0x10, 0x0, 0x5e, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0x51,
+    0x0, 0x0, 0x5e, 0xff, 0xff, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xdc, 0xa7, 0x51, 0x0, 0x0, 0x0,
+    0x5e, 0xff, 0xf5, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x21, 0x10, 0x0, 0x0, 0x0, 0x0, 0x5e, 0xff,
+    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5e, 0xff, 0xf3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5e, 0xff, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5e, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5e, 0xff,
+    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5e, 0xff, 0xf3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+00DF "ß" */
+    0x0, 0x0, 0x1, 0x48, 0xce, 0xfe, 0xc9, 0x52,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5b,
+    0xff, 0xff, 0xff, 0xff, 0xfb, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x17, 0xef, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7e, 0xff, 0xff, 0xb8, 0x78, 0xbf, 0xff, 0xfe,
+    0x40, 0x0, 0x0, 0x0, 0x3, 0xef, 0xff, 0xc5,
+    0x10, 0x0, 0x15, 0xdf, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0xfd, 0x30, 0x0, 0x0, 0x0,
+    0x6f, 0xff, 0xe2, 0x0, 0x0, 0x0, 0xd, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x2c, 0xff, 0xf4,
+    0x0, 0x0, 0x0, 0x2e, 0xff, 0xf4, 0x0, 0x0,
+    0x0, 0x0, 0x1b, 0xff, 0xe4, 0x0, 0x0, 0x0,
+    0x4e, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x2e,
+    0xff, 0xe2, 0x0, 0x0, 0x0, 0x6e, 0xff, 0xc2,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0x6f, 0xff, 0xb1, 0x0, 0x0, 0x0,
+    0x1, 0xcf, 0xff, 0x60, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0xb1, 0x0, 0x0, 0x0, 0x7, 0xff, 0xfb,
+    0x10, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xb1, 0x0,
+    0x0, 0x0, 0x2c, 0xff, 0xe6, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xb1, 0x0, 0x0, 0x0, 0x8f,
+    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xb1, 0x0, 0x0, 0x2, 0xdf, 0xff, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0xb1, 0x0, 0x0,
+    0x6, 0xff, 0xfc, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xb1, 0x0, 0x0, 0x9, 0xff, 0xfa,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xb1,
+    0x0, 0x0, 0x9, 0xff, 0xfd, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xb1, 0x0, 0x0, 0x5,
+    0xef, 0xff, 0xb3, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0xb1, 0x0, 0x0, 0x1, 0xcf, 0xff, 0xfc,
+    0x50, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xb1, 0x0,
+    0x0, 0x0, 0x3c, 0xff, 0xff, 0xf9, 0x20, 0x0,
+    0x0, 0x7f, 0xff, 0xb1, 0x0, 0x0, 0x0, 0x3,
+    0xcf, 0xff, 0xff, 0xc3, 0x0, 0x0, 0x7f, 0xff,
+    0xb1, 0x0, 0x0, 0x0, 0x0, 0x19, 0xef, 0xff,
+    0xfe, 0x60, 0x0, 0x7f, 0xff, 0xb1, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x5d, 0xff, 0xff, 0xe5, 0x0,
+    0x7f, 0xff, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xaf, 0xff, 0xfd, 0x30, 0x7f, 0xff, 0xb1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x19, 0xff,
+    0xff, 0x70, 0x7f, 0xff, 0xb1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xbf, 0xff, 0xa1, 0x7f,
+    0xff, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0xff, 0xb1, 0x7f, 0xff, 0xb1, 0x0,
+    0x1, 0x45, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
+    0xa1, 0x7f, 0xff, 0xb1, 0x0, 0x6a, 0xfe, 0x30,
+    0x0, 0x0, 0x1, 0xbf, 0xff, 0x80, 0x7f, 0xff,
+    0xb1, 0x0, 0xdf, 0xff, 0xb2, 0x0, 0x0, 0x6,
+    0xef, 0xfe, 0x50, 0x7f, 0xff, 0xb1, 0x0, 0x7e,
+    0xff, 0xfb, 0x41, 0x12, 0x7e, 0xff, 0xfb, 0x10,
+    0x7f, 0xff, 0xb1, 0x0, 0x19, 0xff, 0xff, 0xec,
+    0xbc, 0xff, 0xff, 0xe3, 0x0, 0x7f, 0xff, 0xb1,
+    0x0, 0x0, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xfd,
+    0x50, 0x0, 0x7f, 0xff, 0xb1, 0x0, 0x0, 0x16,
+    0xdf, 0xff, 0xff, 0xff, 0xb3, 0x0, 0x0, 0x1,
+    0x11, 0x10, 0x0, 0x0, 0x0, 0x4, 0x8a, 0xa9,
+    0x72, 0x0, 0x0, 0x0,
+
+    /* U+00E0 "à" */
+    0x0, 0x0, 0x0, 0x3, 0x44, 0x44, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0xff, 0xff, 0xc2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x8f, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1a, 0xff, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xff, 0x60,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3d, 0xff, 0xc2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xee, 0xe6,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x45, 0x53, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x23, 0x55, 0x66, 0x54, 0x31, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x49, 0xcd, 0xef, 0xff, 0xfe,
+    0xca, 0x50, 0x0, 0x0, 0x0, 0x0, 0x4b, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x30, 0x0,
+    0x0, 0x4, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xc1, 0x0, 0x0, 0x2d, 0xff, 0xfe,
+    0xa6, 0x32, 0x23, 0x6a, 0xef, 0xff, 0xf8, 0x0,
+    0x0, 0x8f, 0xff, 0xe7, 0x10, 0x0, 0x0, 0x0,
+    0x6e, 0xff, 0xfc, 0x20, 0x3, 0xdf, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xfe, 0x40,
+    0x5, 0xff, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xdf, 0xff, 0x50, 0x2, 0x79, 0xb9, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xdf, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xcf, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x11, 0x49, 0xef, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x23, 0x56, 0x89, 0xce,
+    0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x3, 0x8b,
+    0xcd, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50,
+    0x0, 0x3, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xec, 0xef, 0xff, 0x50, 0x0, 0x3c, 0xff, 0xff,
+    0xff, 0xff, 0xfd, 0x96, 0x43, 0xdf, 0xff, 0x50,
+    0x3, 0xcf, 0xff, 0xfd, 0xa8, 0x52, 0x0, 0x0,
+    0x2, 0xdf, 0xff, 0x50, 0x9, 0xff, 0xff, 0xa3,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xdf, 0xff, 0x50,
+    0x1e, 0xff, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xdf, 0xff, 0x50, 0x3e, 0xff, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6, 0xef, 0xff, 0x50,
+    0x4f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1a, 0xff, 0xff, 0x50, 0x3e, 0xff, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5e, 0xff, 0xff, 0x60,
+    0x1e, 0xff, 0xfc, 0x10, 0x0, 0x0, 0x0, 0x15,
+    0xdf, 0xff, 0xff, 0x60, 0x9, 0xff, 0xff, 0xb4,
+    0x10, 0x0, 0x14, 0x9e, 0xff, 0xff, 0xff, 0x80,
+    0x3, 0xdf, 0xff, 0xfd, 0xba, 0x9b, 0xce, 0xff,
+    0xfb, 0xaf, 0xff, 0xa0, 0x0, 0x4d, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfd, 0x71, 0x4f, 0xff, 0xe1,
+    0x0, 0x4, 0xbf, 0xff, 0xff, 0xff, 0xff, 0x94,
+    0x0, 0x2d, 0xff, 0xf5, 0x0, 0x0, 0x2, 0x69,
+    0xaa, 0x98, 0x41, 0x0, 0x0, 0x1, 0x22, 0x21,
+
+    /* U+00E1 "á" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x14, 0x44,
+    0x44, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xff, 0xfc, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xff,
+    0xd3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0xfe, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5e, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xae, 0xec, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x55, 0x52, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x23, 0x55, 0x66, 0x54, 0x31, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x49, 0xcd, 0xef, 0xff, 0xfe,
+    0xca, 0x50, 0x0, 0x0, 0x0, 0x0, 0x4b, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x30, 0x0,
+    0x0, 0x4, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xc1, 0x0, 0x0, 0x2d, 0xff, 0xfe,
+    0xa6, 0x32, 0x23, 0x6a, 0xef, 0xff, 0xf8, 0x0,
+    0x0, 0x8f, 0xff, 0xe7, 0x10, 0x0, 0x0, 0x0,
+    0x6e, 0xff, 0xfc, 0x20, 0x3, 0xdf, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xfe, 0x40,
+    0x5, 0xff, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xdf, 0xff, 0x50, 0x2, 0x79, 0xb9, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xdf, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xcf, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x11, 0x49, 0xef, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x23, 0x56, 0x89, 0xce,
+    0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x3, 0x8b,
+    0xcd, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50,
+    0x0, 0x3, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xec, 0xef, 0xff, 0x50, 0x0, 0x3c, 0xff, 0xff,
+    0xff, 0xff, 0xfd, 0x96, 0x43, 0xdf, 0xff, 0x50,
+    0x3, 0xcf, 0xff, 0xfd, 0xa8, 0x52, 0x0, 0x0,
+    0x2, 0xdf, 0xff, 0x50, 0x9, 0xff, 0xff, 0xa3,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xdf, 0xff, 0x50,
+    0x1e, 0xff, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xdf, 0xff, 0x50, 0x3e, 0xff, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6, 0xef, 0xff, 0x50,
+    0x4f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1a, 0xff, 0xff, 0x50, 0x3e, 0xff, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5e, 0xff, 0xff, 0x60,
+    0x1e, 0xff, 0xfc, 0x10, 0x0, 0x0, 0x0, 0x15,
+    0xdf, 0xff, 0xff, 0x60, 0x9, 0xff, 0xff, 0xb4,
+    0x10, 0x0, 0x14, 0x9e, 0xff, 0xff, 0xff, 0x80,
+    0x3, 0xdf, 0xff, 0xfd, 0xba, 0x9b, 0xce, 0xff,
+    0xfb, 0xaf, 0xff, 0xa0, 0x0, 0x4d, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfd, 0x71, 0x4f, 0xff, 0xe1,
+    0x0, 0x4, 0xbf, 0xff, 0xff, 0xff, 0xff, 0x94,
+    0x0, 0x2d, 0xff, 0xf5, 0x0, 0x0, 0x2, 0x69,
+    0xaa, 0x98, 0x41, 0x0, 0x0, 0x1, 0x22, 0x21,
+
+    /* U+00E2 "â" */
+    0x0, 0x0, 0x0, 0x0, 0x2, 0x44, 0x44, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1a, 0xff, 0xff, 0xc2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xfb,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xef, 0xfe, 0xaf, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4d, 0xff, 0xf7, 0x2c, 0xff,
+    0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xbf,
+    0xff, 0xa1, 0x5, 0xef, 0xfe, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xee, 0xee, 0x20, 0x0, 0x9e,
+    0xee, 0xc2, 0x0, 0x0, 0x0, 0x0, 0x14, 0x55,
+    0x53, 0x0, 0x0, 0x14, 0x55, 0x42, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x23, 0x55, 0x66, 0x54, 0x31, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x49, 0xcd, 0xef, 0xff, 0xfe,
+    0xca, 0x50, 0x0, 0x0, 0x0, 0x0, 0x4b, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x30, 0x0,
+    0x0, 0x4, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xc1, 0x0, 0x0, 0x2d, 0xff, 0xfe,
+    0xa6, 0x32, 0x23, 0x6a, 0xef, 0xff, 0xf8, 0x0,
+    0x0, 0x8f, 0xff, 0xe7, 0x10, 0x0, 0x0, 0x0,
+    0x6e, 0xff, 0xfc, 0x20, 0x3, 0xdf, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xfe, 0x40,
+    0x5, 0xff, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xdf, 0xff, 0x50, 0x2, 0x79, 0xb9, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xdf, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xcf, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x11, 0x49, 0xef, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x23, 0x56, 0x89, 0xce,
+    0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x3, 0x8b,
+    0xcd, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50,
+    0x0, 0x3, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xec, 0xef, 0xff, 0x50, 0x0, 0x3c, 0xff, 0xff,
+    0xff, 0xff, 0xfd, 0x96, 0x43, 0xdf, 0xff, 0x50,
+    0x3, 0xcf, 0xff, 0xfd, 0xa8, 0x52, 0x0, 0x0,
+    0x2, 0xdf, 0xff, 0x50, 0x9, 0xff, 0xff, 0xa3,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xdf, 0xff, 0x50,
+    0x1e, 0xff, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xdf, 0xff, 0x50, 0x3e, 0xff, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6, 0xef, 0xff, 0x50,
+    0x4f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1a, 0xff, 0xff, 0x50, 0x3e, 0xff, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5e, 0xff, 0xff, 0x60,
+    0x1e, 0xff, 0xfc, 0x10, 0x0, 0x0, 0x0, 0x15,
+    0xdf, 0xff, 0xff, 0x60, 0x9, 0xff, 0xff, 0xb4,
+    0x10, 0x0, 0x14, 0x9e, 0xff, 0xff, 0xff, 0x80,
+    0x3, 0xdf, 0xff, 0xfd, 0xba, 0x9b, 0xce, 0xff,
+    0xfb, 0xaf, 0xff, 0xa0, 0x0, 0x4d, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfd, 0x71, 0x4f, 0xff, 0xe1,
+    0x0, 0x4, 0xbf, 0xff, 0xff, 0xff, 0xff, 0x94,
+    0x0, 0x2d, 0xff, 0xf5, 0x0, 0x0, 0x2, 0x69,
+    0xaa, 0x98, 0x41, 0x0, 0x0, 0x1, 0x22, 0x21,
+
+    /* U+00E3 "ã" */
+    0x0, 0x0, 0x0, 0x15, 0x89, 0x62, 0x0, 0x0,
+    0x18, 0x98, 0x20, 0x0, 0x0, 0x0, 0x2, 0xbe,
+    0xff, 0xfe, 0x83, 0x10, 0x5f, 0xfc, 0x20, 0x0,
+    0x0, 0x0, 0x1a, 0xff, 0xff, 0xff, 0xfd, 0x99,
+    0xdf, 0xfa, 0x10, 0x0, 0x0, 0x0, 0x5e, 0xff,
+    0xb9, 0xce, 0xff, 0xff, 0xff, 0xe5, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xfb, 0x10, 0x16, 0xcf, 0xff,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7c, 0xc6,
+    0x0, 0x0, 0x25, 0x9b, 0x95, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x23, 0x55, 0x66, 0x54,
+    0x31, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49,
+    0xcd, 0xef, 0xff, 0xfe, 0xca, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x4b, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfb, 0x30, 0x0, 0x0, 0x4, 0xdf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0x0,
+    0x0, 0x2d, 0xff, 0xfe, 0xa6, 0x32, 0x23, 0x6a,
+    0xef, 0xff, 0xf8, 0x0, 0x0, 0x8f, 0xff, 0xe7,
+    0x10, 0x0, 0x0, 0x0, 0x6e, 0xff, 0xfc, 0x20,
+    0x3, 0xdf, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xfe, 0x40, 0x5, 0xff, 0xfd, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xdf, 0xff, 0x50,
+    0x2, 0x79, 0xb9, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xdf, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x11,
+    0x49, 0xef, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x23, 0x56, 0x89, 0xce, 0xff, 0xff, 0xff, 0x50,
+    0x0, 0x0, 0x3, 0x8b, 0xcd, 0xef, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x50, 0x0, 0x3, 0x9f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xec, 0xef, 0xff, 0x50,
+    0x0, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x96,
+    0x43, 0xdf, 0xff, 0x50, 0x3, 0xcf, 0xff, 0xfd,
+    0xa8, 0x52, 0x0, 0x0, 0x2, 0xdf, 0xff, 0x50,
+    0x9, 0xff, 0xff, 0xa3, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xdf, 0xff, 0x50, 0x1e, 0xff, 0xfb, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xdf, 0xff, 0x50,
+    0x3e, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xef, 0xff, 0x50, 0x4f, 0xff, 0xf4, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1a, 0xff, 0xff, 0x50,
+    0x3e, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5e, 0xff, 0xff, 0x60, 0x1e, 0xff, 0xfc, 0x10,
+    0x0, 0x0, 0x0, 0x15, 0xdf, 0xff, 0xff, 0x60,
+    0x9, 0xff, 0xff, 0xb4, 0x10, 0x0, 0x14, 0x9e,
+    0xff, 0xff, 0xff, 0x80, 0x3, 0xdf, 0xff, 0xfd,
+    0xba, 0x9b, 0xce, 0xff, 0xfb, 0xaf, 0xff, 0xa0,
+    0x0, 0x4d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
+    0x71, 0x4f, 0xff, 0xe1, 0x0, 0x4, 0xbf, 0xff,
+    0xff, 0xff, 0xff, 0x94, 0x0, 0x2d, 0xff, 0xf5,
+    0x0, 0x0, 0x2, 0x69, 0xaa, 0x98, 0x41, 0x0,
+    0x0, 0x1, 0x22, 0x21,
+
+    /* U+00E4 "ä" */
+    0x0, 0x0, 0x2, 0x44, 0x44, 0x0, 0x0, 0x34,
+    0x44, 0x30, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
+    0xff, 0x10, 0x0, 0xaf, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xff, 0xff, 0x10, 0x0, 0xaf,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
+    0xff, 0x10, 0x0, 0xaf, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xff, 0xff, 0x10, 0x0, 0xaf,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x88,
+    0x88, 0x0, 0x0, 0x58, 0x88, 0x60, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x23, 0x55, 0x66, 0x54, 0x31, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x49, 0xcd, 0xef, 0xff, 0xfe,
+    0xca, 0x50, 0x0, 0x0, 0x0, 0x0, 0x4b, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x30, 0x0,
+    0x0, 0x4, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xc1, 0x0, 0x0, 0x2d, 0xff, 0xfe,
+    0xa6, 0x32, 0x23, 0x6a, 0xef, 0xff, 0xf8, 0x0,
+    0x0, 0x8f, 0xff, 0xe7, 0x10, 0x0, 0x0, 0x0,
+    0x6e, 0xff, 0xfc, 0x20, 0x3, 0xdf, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xfe, 0x40,
+    0x5, 0xff, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xdf, 0xff, 0x50, 0x2, 0x79, 0xb9, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xdf, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xcf, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x11, 0x49, 0xef, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x23, 0x56, 0x89, 0xce,
+    0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x3, 0x8b,
+    0xcd, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50,
+    0x0, 0x3, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xec, 0xef, 0xff, 0x50, 0x0, 0x3c, 0xff, 0xff,
+    0xff, 0xff, 0xfd, 0x96, 0x43, 0xdf, 0xff, 0x50,
+    0x3, 0xcf, 0xff, 0xfd, 0xa8, 0x52, 0x0, 0x0,
+    0x2, 0xdf, 0xff, 0x50, 0x9, 0xff, 0xff, 0xa3,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xdf, 0xff, 0x50,
+    0x1e, 0xff, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xdf, 0xff, 0x50, 0x3e, 0xff, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6, 0xef, 0xff, 0x50,
+    0x4f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1a, 0xff, 0xff, 0x50, 0x3e, 0xff, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5e, 0xff, 0xff, 0x60,
+    0x1e, 0xff, 0xfc, 0x10, 0x0, 0x0, 0x0, 0x15,
+    0xdf, 0xff, 0xff, 0x60, 0x9, 0xff, 0xff, 0xb4,
+    0x10, 0x0, 0x14, 0x9e, 0xff, 0xff, 0xff, 0x80,
+    0x3, 0xdf, 0xff, 0xfd, 0xba, 0x9b, 0xce, 0xff,
+    0xfb, 0xaf, 0xff, 0xa0, 0x0, 0x4d, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfd, 0x71, 0x4f, 0xff, 0xe1,
+    0x0, 0x4, 0xbf, 0xff, 0xff, 0xff, 0xff, 0x94,
+    0x0, 0x2d, 0xff, 0xf5, 0x0, 0x0, 0x2, 0x69,
+    0xaa, 0x98, 0x41, 0x0, 0x0, 0x1, 0x22, 0x21,
+
+    /* U+00E5 "å" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x13, 0x42, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xdf, 0xff, 0x91, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4d, 0xe8, 0x7b, 0xe8,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xbf, 0x40, 0x1, 0xbe, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xed, 0x0, 0x0, 0x5f,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xed, 0x0, 0x0, 0x5f, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xaf, 0x50, 0x1, 0xbe,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4d, 0xea, 0x8c, 0xf9, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xce, 0xfd, 0x81,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x23, 0x43, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x23, 0x55, 0x66, 0x54,
+    0x31, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49,
+    0xcd, 0xef, 0xff, 0xfe, 0xca, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x4b, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfb, 0x30, 0x0, 0x0, 0x4, 0xdf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0x0,
+    0x0, 0x2d, 0xff, 0xfe, 0xa6, 0x32, 0x23, 0x6a,
+    0xef, 0xff, 0xf8, 0x0, 0x0, 0x8f, 0xff, 0xe7,
+    0x10, 0x0, 0x0, 0x0, 0x6e, 0xff, 0xfc, 0x20,
+    0x3, 0xdf, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xfe, 0x40, 0x5, 0xff, 0xfd, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xdf, 0xff, 0x50,
+    0x2, 0x79, 0xb9, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xdf, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x11,
+    0x49, 0xef, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x23, 0x56, 0x89, 0xce, 0xff, 0xff, 0xff, 0x50,
+    0x0, 0x0, 0x3, 0x8b, 0xcd, 0xef, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x50, 0x0, 0x3, 0x9f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xec, 0xef, 0xff, 0x50,
+    0x0, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x96,
+    0x43, 0xdf, 0xff, 0x50, 0x3, 0xcf, 0xff, 0xfd,
+    0xa8, 0x52, 0x0, 0x0, 0x2, 0xdf, 0xff, 0x50,
+    0x9, 0xff, 0xff, 0xa3, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xdf, 0xff, 0x50, 0x1e, 0xff, 0xfb, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xdf, 0xff, 0x50,
+    0x3e, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xef, 0xff, 0x50, 0x4f, 0xff, 0xf4, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1a, 0xff, 0xff, 0x50,
+    0x3e, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5e, 0xff, 0xff, 0x60, 0x1e, 0xff, 0xfc, 0x10,
+    0x0, 0x0, 0x0, 0x15, 0xdf, 0xff, 0xff, 0x60,
+    0x9, 0xff, 0xff, 0xb4, 0x10, 0x0, 0x14, 0x9e,
+    0xff, 0xff, 0xff, 0x80, 0x3, 0xdf, 0xff, 0xfd,
+    0xba, 0x9b, 0xce, 0xff, 0xfb, 0xaf, 0xff, 0xa0,
+    0x0, 0x4d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
+    0x71, 0x4f, 0xff, 0xe1, 0x0, 0x4, 0xbf, 0xff,
+    0xff, 0xff, 0xff, 0x94, 0x0, 0x2d, 0xff, 0xf5,
+    0x0, 0x0, 0x2, 0x69, 0xaa, 0x98, 0x41, 0x0,
+    0x0, 0x1, 0x22, 0x21,
+
+    /* U+00E6 "æ" */
+    0x0, 0x0, 0x0, 0x0, 0x24, 0x56, 0x65, 0x43,
+    0x10, 0x0, 0x0, 0x0, 0x3, 0x45, 0x65, 0x43,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xac, 0xef, 0xff, 0xfe, 0xdb, 0x82, 0x0, 0x0,
+    0x49, 0xce, 0xff, 0xfe, 0xda, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4c, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xe7, 0x12, 0x9f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xb3, 0x0, 0x0, 0x0, 0x0, 0x5d,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7,
+    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2,
+    0x0, 0x0, 0x0, 0x3e, 0xff, 0xfd, 0xa6, 0x32,
+    0x23, 0x6b, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x73,
+    0x22, 0x6a, 0xef, 0xff, 0xc2, 0x0, 0x0, 0x19,
+    0xff, 0xfc, 0x50, 0x0, 0x0, 0x0, 0x19, 0xff,
+    0xff, 0xff, 0xe8, 0x10, 0x0, 0x0, 0x6, 0xdf,
+    0xff, 0x90, 0x0, 0x3, 0xdf, 0xfe, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x2d, 0xff, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xef, 0xff, 0x30, 0x0,
+    0x6f, 0xff, 0xc1, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xaf, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xa, 0xff, 0xf9, 0x0, 0x6, 0xcd, 0xd8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xff, 0xc1,
+    0x0, 0x0, 0x2, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xd3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xcf, 0xfe, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x29, 0xff, 0xfb,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x13, 0x45,
+    0x79, 0xce, 0xff, 0xff, 0xc7, 0x66, 0x66, 0x66,
+    0x66, 0x66, 0x66, 0xcf, 0xff, 0x80, 0x0, 0x0,
+    0x1, 0x37, 0xab, 0xdd, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf9, 0x10, 0x0, 0x27, 0xdf, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0xef, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa1, 0x0,
+    0x2b, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xb8, 0x58,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfa, 0x10, 0x2c, 0xff, 0xff, 0xeb,
+    0xa7, 0x52, 0x0, 0x0, 0x7f, 0xff, 0xa1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xff, 0xa4, 0x10, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xff, 0xa1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xc2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x11, 0x0,
+    0x0, 0x5f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1a, 0xff, 0xfd, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x19, 0xa9, 0x73, 0x6, 0xff, 0xff,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x3, 0xef, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xef,
+    0xfe, 0x50, 0x5f, 0xff, 0xf4, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xaf, 0xff, 0xff, 0xe2, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xcf, 0xff, 0xc1, 0x3, 0xef,
+    0xff, 0xb1, 0x0, 0x0, 0x0, 0x2, 0xaf, 0xff,
+    0xff, 0xff, 0xb4, 0x0, 0x0, 0x0, 0x2, 0x9f,
+    0xff, 0xf6, 0x0, 0xb, 0xff, 0xff, 0xa4, 0x10,
+    0x11, 0x47, 0xdf, 0xff, 0xc7, 0xef, 0xff, 0xe8,
+    0x41, 0x0, 0x25, 0xbf, 0xff, 0xfa, 0x10, 0x0,
+    0x4e, 0xff, 0xff, 0xec, 0xbb, 0xcd, 0xff, 0xff,
+    0xa3, 0x6, 0xff, 0xff, 0xfd, 0xcb, 0xbc, 0xef,
+    0xff, 0xfb, 0x20, 0x0, 0x0, 0x5d, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfd, 0x71, 0x0, 0x5, 0xcf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0x10, 0x0,
+    0x0, 0x0, 0x4b, 0xff, 0xff, 0xff, 0xff, 0xe8,
+    0x30, 0x0, 0x0, 0x2, 0x9e, 0xff, 0xff, 0xff,
+    0xff, 0xc5, 0x10, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0x69, 0xaa, 0x97, 0x31, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0x8a, 0xaa, 0x86, 0x20, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+00E7 "ç" */
+    0x0, 0x0, 0x0, 0x0, 0x13, 0x55, 0x55, 0x42,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x6b,
+    0xde, 0xff, 0xee, 0xc9, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x15, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x81, 0x0, 0x0, 0x0, 0x17, 0xef, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x91, 0x0, 0x0, 0x7,
+    0xff, 0xff, 0xea, 0x52, 0x23, 0x8d, 0xff, 0xff,
+    0x80, 0x0, 0x3, 0xef, 0xff, 0xd5, 0x10, 0x0,
+    0x0, 0x3c, 0xff, 0xfe, 0x20, 0x1, 0xaf, 0xff,
+    0xd4, 0x0, 0x0, 0x0, 0x0, 0x3d, 0xff, 0xf8,
+    0x0, 0x3e, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xff, 0xb2, 0x6, 0xff, 0xfd, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xcd, 0xc8, 0x20,
+    0xaf, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0x10, 0x0, 0xd, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef,
+    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2e, 0xff, 0xf4, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2e, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xff, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xe, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0xcb, 0x83, 0x9,
+    0xff, 0xfc, 0x10, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xcf, 0xff, 0x50, 0x4f, 0xff, 0xe5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5e, 0xff, 0xd3, 0x2, 0xbf,
+    0xff, 0xb2, 0x0, 0x0, 0x0, 0x0, 0x1b, 0xff,
+    0xfa, 0x10, 0x6, 0xef, 0xff, 0x91, 0x0, 0x0,
+    0x0, 0x18, 0xff, 0xfe, 0x40, 0x0, 0xa, 0xff,
+    0xff, 0xb6, 0x21, 0x1, 0x4a, 0xff, 0xff, 0x90,
+    0x0, 0x0, 0x2b, 0xff, 0xff, 0xec, 0xbb, 0xce,
+    0xff, 0xff, 0xb2, 0x0, 0x0, 0x0, 0x29, 0xef,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0x91, 0x0, 0x0,
+    0x0, 0x0, 0x16, 0xcf, 0xff, 0xff, 0xff, 0xfc,
+    0x61, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3c,
+    0xff, 0xc9, 0x73, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xbf, 0xf8, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3d, 0xff,
+    0xfe, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0x67, 0xbf, 0xff, 0x91, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf,
+    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2d, 0xff, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x36, 0x66, 0x9c, 0xff, 0xfc,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1a, 0xff,
+    0xff, 0xff, 0xfe, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xbf, 0xff, 0xff, 0xec, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x15, 0x89, 0x98,
+    0x74, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+00E8 "è" */
+    0x0, 0x0, 0x0, 0x24, 0x44, 0x44, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4d,
+    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xef, 0xff, 0xb1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7e, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x19, 0xff, 0xfa, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xbf, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3c, 0xee, 0x90,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0x55, 0x41, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x13, 0x55, 0x65, 0x42, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x16, 0xbd, 0xef, 0xff, 0xec,
+    0x93, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xdf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x0, 0x0,
+    0x0, 0x0, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfb, 0x20, 0x0, 0x0, 0x6, 0xef, 0xff,
+    0xeb, 0x53, 0x23, 0x7b, 0xff, 0xff, 0xc1, 0x0,
+    0x0, 0x3d, 0xff, 0xfe, 0x61, 0x0, 0x0, 0x1,
+    0x8f, 0xff, 0xf8, 0x10, 0x1, 0x9f, 0xff, 0xe5,
+    0x0, 0x0, 0x0, 0x0, 0x18, 0xef, 0xfd, 0x40,
+    0x3, 0xef, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xbf, 0xff, 0x90, 0x7, 0xff, 0xfd, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xe0,
+    0xc, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2e, 0xff, 0xf3, 0xe, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xff, 0xf7,
+    0x2e, 0xff, 0xfa, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x7d, 0xff, 0xf9, 0x3e, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
+    0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfa, 0x4e, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
+    0x3e, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xf4, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xe, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xfc, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0x87, 0x62,
+    0x5, 0xff, 0xfe, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0xe4, 0x2, 0xcf, 0xff, 0xc2,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xff, 0xd0,
+    0x0, 0x6f, 0xff, 0xfb, 0x20, 0x0, 0x0, 0x0,
+    0x2a, 0xff, 0xff, 0x70, 0x0, 0x1a, 0xff, 0xff,
+    0xd7, 0x31, 0x1, 0x36, 0xcf, 0xff, 0xfa, 0x10,
+    0x0, 0x2, 0xbf, 0xff, 0xff, 0xdc, 0xbc, 0xde,
+    0xff, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x19, 0xef,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x20, 0x0,
+    0x0, 0x0, 0x1, 0x5b, 0xff, 0xff, 0xff, 0xff,
+    0xfc, 0x61, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x15, 0x8a, 0xaa, 0x96, 0x30, 0x0, 0x0, 0x0,
+
+    /* U+00E9 "é" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x14, 0x44,
+    0x44, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xff, 0xfc, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
+    0xd4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xf8,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5e, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xae, 0xec, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x55, 0x52, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x13, 0x55, 0x65, 0x42, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x16, 0xbd, 0xef, 0xff, 0xec,
+    0x93, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xdf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x0, 0x0,
+    0x0, 0x0, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfb, 0x20, 0x0, 0x0, 0x6, 0xef, 0xff,
+    0xeb, 0x53, 0x23, 0x7b, 0xff, 0xff, 0xc1, 0x0,
+    0x0, 0x3d, 0xff, 0xfe, 0x61, 0x0, 0x0, 0x1,
+    0x8f, 0xff, 0xf8, 0x10, 0x1, 0x9f, 0xff, 0xe5,
+    0x0, 0x0, 0x0, 0x0, 0x18, 0xef, 0xfd, 0x40,
+    0x3, 0xef, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xbf, 0xff, 0x90, 0x7, 0xff, 0xfd, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xe0,
+    0xc, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2e, 0xff, 0xf3, 0xe, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xff, 0xf7,
+    0x2e, 0xff, 0xfa, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x7d, 0xff, 0xf9, 0x3e, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
+    0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfa, 0x4e, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
+    0x3e, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xf4, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xe, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xfc, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0x87, 0x62,
+    0x5, 0xff, 0xfe, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0xe4, 0x2, 0xcf, 0xff, 0xc2,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xff, 0xd0,
+    0x0, 0x6f, 0xff, 0xfb, 0x20, 0x0, 0x0, 0x0,
+    0x2a, 0xff, 0xff, 0x70, 0x0, 0x1a, 0xff, 0xff,
+    0xd7, 0x31, 0x1, 0x36, 0xcf, 0xff, 0xfa, 0x10,
+    0x0, 0x2, 0xbf, 0xff, 0xff, 0xdc, 0xbc, 0xde,
+    0xff, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x19, 0xef,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x20, 0x0,
+    0x0, 0x0, 0x1, 0x5b, 0xff, 0xff, 0xff, 0xff,
+    0xfc, 0x61, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x15, 0x8a, 0xaa, 0x96, 0x30, 0x0, 0x0, 0x0,
+
+    /* U+00EA "ê" */
+    0x0, 0x0, 0x0, 0x0, 0x2, 0x44, 0x44, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x19, 0xff, 0xff, 0xc3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xfb,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xef, 0xfe, 0xaf, 0xff, 0x91, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3d, 0xff, 0xf7, 0x2b, 0xff,
+    0xe7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xbf,
+    0xff, 0xb1, 0x4, 0xef, 0xfe, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xee, 0xee, 0x30, 0x0, 0x9e,
+    0xee, 0xc2, 0x0, 0x0, 0x0, 0x0, 0x14, 0x55,
+    0x53, 0x0, 0x0, 0x14, 0x55, 0x52, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x13, 0x55, 0x65, 0x42, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x16, 0xbd, 0xef, 0xff, 0xec,
+    0x93, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xdf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x0, 0x0,
+    0x0, 0x0, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfb, 0x20, 0x0, 0x0, 0x6, 0xef, 0xff,
+    0xeb, 0x53, 0x23, 0x7b, 0xff, 0xff, 0xc1, 0x0,
+    0x0, 0x3d, 0xff, 0xfe, 0x61, 0x0, 0x0, 0x1,
+    0x8f, 0xff, 0xf8, 0x10, 0x1, 0x9f, 0xff, 0xe5,
+    0x0, 0x0, 0x0, 0x0, 0x18, 0xef, 0xfd, 0x40,
+    0x3, 0xef, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xbf, 0xff, 0x90, 0x7, 0xff, 0xfd, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xe0,
+    0xc, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2e, 0xff, 0xf3, 0xe, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xff, 0xf7,
+    0x2e, 0xff, 0xfa, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x7d, 0xff, 0xf9, 0x3e, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
+    0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfa, 0x4e, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
+    0x3e, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xf4, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xe, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xfc, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0x87, 0x62,
+    0x5, 0xff, 0xfe, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0xe4, 0x2, 0xcf, 0xff, 0xc2,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xff, 0xd0,
+    0x0, 0x6f, 0xff, 0xfb, 0x20, 0x0, 0x0, 0x0,
+    0x2a, 0xff, 0xff, 0x70, 0x0, 0x1a, 0xff, 0xff,
+    0xd7, 0x31, 0x1, 0x36, 0xcf, 0xff, 0xfa, 0x10,
+    0x0, 0x2, 0xbf, 0xff, 0xff, 0xdc, 0xbc, 0xde,
+    0xff, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x19, 0xef,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x20, 0x0,
+    0x0, 0x0, 0x1, 0x5b, 0xff, 0xff, 0xff, 0xff,
+    0xfc, 0x61, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x15, 0x8a, 0xaa, 0x96, 0x30, 0x0, 0x0, 0x0,
+
+    /* U+00EB "ë" */
+    0x0, 0x0, 0x1, 0x44, 0x44, 0x0, 0x0, 0x34,
+    0x44, 0x40, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0xff, 0x10, 0x0, 0x9f, 0xff, 0xd0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xff, 0x10, 0x0, 0x9f,
+    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0xff, 0x10, 0x0, 0x9f, 0xff, 0xd0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xff, 0x10, 0x0, 0x9f,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x88,
+    0x88, 0x10, 0x0, 0x58, 0x88, 0x60, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x13, 0x55, 0x65, 0x42, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x16, 0xbd, 0xef, 0xff, 0xec,
+    0x93, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xdf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x0, 0x0,
+    0x0, 0x0, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfb, 0x20, 0x0, 0x0, 0x6, 0xef, 0xff,
+    0xeb, 0x53, 0x23, 0x7b, 0xff, 0xff, 0xc1, 0x0,
+    0x0, 0x3d, 0xff, 0xfe, 0x61, 0x0, 0x0, 0x1,
+    0x8f, 0xff, 0xf8, 0x10, 0x1, 0x9f, 0xff, 0xe5,
+    0x0, 0x0, 0x0, 0x0, 0x18, 0xef, 0xfd, 0x40,
+    0x3, 0xef, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xbf, 0xff, 0x90, 0x7, 0xff, 0xfd, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xe0,
+    0xc, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2e, 0xff, 0xf3, 0xe, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xff, 0xf7,
+    0x2e, 0xff, 0xfa, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x7d, 0xff, 0xf9, 0x3e, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
+    0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfa, 0x4e, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
+    0x3e, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xf4, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xe, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xfc, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0x87, 0x62,
+    0x5, 0xff, 0xfe, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0xe4, 0x2, 0xcf, 0xff, 0xc2,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xff, 0xd0,
+    0x0, 0x6f, 0xff, 0xfb, 0x20, 0x0, 0x0, 0x0,
+    0x2a, 0xff, 0xff, 0x70, 0x0, 0x1a, 0xff, 0xff,
+    0xd7, 0x31, 0x1, 0x36, 0xcf, 0xff, 0xfa, 0x10,
+    0x0, 0x2, 0xbf, 0xff, 0xff, 0xdc, 0xbc, 0xde,
+    0xff, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x19, 0xef,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x20, 0x0,
+    0x0, 0x0, 0x1, 0x5b, 0xff, 0xff, 0xff, 0xff,
+    0xfc, 0x61, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x15, 0x8a, 0xaa, 0x96, 0x30, 0x0, 0x0, 0x0,
+
+    /* U+00EC "ì" */
+    0x13, 0x44, 0x44, 0x30, 0x0, 0x18, 0xff, 0xff,
+    0xc1, 0x0, 0x0, 0xaf, 0xff, 0xe6, 0x0, 0x0,
+    0x2b, 0xff, 0xfb, 0x10, 0x0, 0x3, 0xdf, 0xff,
+    0x50, 0x0, 0x0, 0x5e, 0xff, 0xc0, 0x0, 0x0,
+    0x7, 0xee, 0xe4, 0x0, 0x0, 0x0, 0x45, 0x52,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0x11, 0x10, 0x0, 0x0, 0x4b, 0xbb, 0xa0, 0x0,
+    0x0, 0x5f, 0xff, 0xd0, 0x0, 0x0, 0x5f, 0xff,
+    0xd0, 0x0, 0x0, 0x5f, 0xff, 0xd0, 0x0, 0x0,
+    0x5f, 0xff, 0xd0, 0x0, 0x0, 0x5f, 0xff, 0xd0,
+    0x0, 0x0, 0x5f, 0xff, 0xd0, 0x0, 0x0, 0x5f,
+    0xff, 0xd0, 0x0, 0x0, 0x5f, 0xff, 0xd0, 0x0,
+    0x0, 0x5f, 0xff, 0xd0, 0x0, 0x0, 0x5f, 0xff,
+    0xd0, 0x0, 0x0, 0x5f, 0xff, 0xd0, 0x0, 0x0,
+    0x5f, 0xff, 0xd0, 0x0, 0x0, 0x5f, 0xff, 0xd0,
+    0x0, 0x0, 0x5f, 0xff, 0xd0, 0x0, 0x0, 0x5f,
+    0xff, 0xd0, 0x0, 0x0, 0x5f, 0xff, 0xd0, 0x0,
+    0x0, 0x5f, 0xff, 0xd0, 0x0, 0x0, 0x5f, 0xff,
+    0xd0, 0x0, 0x0, 0x5f, 0xff, 0xd0, 0x0, 0x0,
+    0x5f, 0xff, 0xd0, 0x0, 0x0, 0x5f, 0xff, 0xd0,
+    0x0, 0x0, 0x5f, 0xff, 0xd0, 0x0, 0x0, 0x5f,
+    0xff, 0xd0, 0x0, 0x0, 0x5f, 0xff, 0xd0,
+
+    /* U+00ED "í" */
+    0x0, 0x2, 0x44, 0x44, 0x30, 0x1, 0xbf, 0xff,
+    0xf7, 0x0, 0x5f, 0xff, 0xf9, 0x10, 0x1b, 0xff,
+    0xfc, 0x20, 0x5, 0xef, 0xfd, 0x40, 0x1, 0xaf,
+    0xfe, 0x50, 0x0, 0x3e, 0xee, 0x80, 0x0, 0x2,
+    0x55, 0x41, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x11, 0x11, 0x0, 0x0, 0x4b, 0xbb, 0xa0,
+    0x0, 0x5, 0xff, 0xfd, 0x0, 0x0, 0x5f, 0xff,
+    0xd0, 0x0, 0x5, 0xff, 0xfd, 0x0, 0x0, 0x5f,
+    0xff, 0xd0, 0x0, 0x5, 0xff, 0xfd, 0x0, 0x0,
+    0x5f, 0xff, 0xd0, 0x0, 0x5, 0xff, 0xfd, 0x0,
+    0x0, 0x5f, 0xff, 0xd0, 0x0, 0x5, 0xff, 0xfd,
+    0x0, 0x0, 0x5f, 0xff, 0xd0, 0x0, 0x5, 0xff,
+    0xfd, 0x0, 0x0, 0x5f, 0xff, 0xd0, 0x0, 0x5,
+    0xff, 0xfd, 0x0, 0x0, 0x5f, 0xff, 0xd0, 0x0,
+    0x5, 0xff, 0xfd, 0x0, 0x0, 0x5f, 0xff, 0xd0,
+    0x0, 0x5, 0xff, 0xfd, 0x0, 0x0, 0x5f, 0xff,
+    0xd0, 0x0, 0x5, 0xff, 0xfd, 0x0, 0x0, 0x5f,
+    0xff, 0xd0, 0x0, 0x5, 0xff, 0xfd, 0x0, 0x0,
+    0x5f, 0xff, 0xd0, 0x0, 0x5, 0xff, 0xfd, 0x0,
+    0x0, 0x5f, 0xff, 0xd0, 0x0, 0x0,
+
+    /* U+00EE "î" */
+    0x0, 0x0, 0x3, 0x44, 0x44, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x2c, 0xff, 0xff, 0xa2, 0x0, 0x0,
+    0x0, 0x1, 0xaf, 0xff, 0xff, 0xf9, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0xfd, 0xbf, 0xff, 0x60, 0x0,
+    0x0, 0x5e, 0xff, 0xe5, 0x4d, 0xff, 0xe5, 0x0,
+    0x3, 0xdf, 0xff, 0x81, 0x7, 0xff, 0xfd, 0x30,
+    0xb, 0xee, 0xec, 0x20, 0x1, 0xbe, 0xee, 0xa1,
+    0x15, 0x55, 0x52, 0x0, 0x0, 0x24, 0x55, 0x41,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x11, 0x11, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xbb, 0xba, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xfd, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xfd, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xfd, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xfd, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xfd, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xfd, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xfd, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xfd, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xfd, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xfd, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xfd, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xfd, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xfd, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xfd, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xfd, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xfd, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xfd, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xfd, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xfd, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xfd, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xfd, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xfd, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xfd, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xfd, 0x0, 0x0, 0x0,
+
+    /* U+00EF "ï" */
+    0x44, 0x44, 0x30, 0x0, 0x4, 0x44, 0x41, 0xcf,
+    0xff, 0x90, 0x0, 0x1f, 0xff, 0xf5, 0xcf, 0xff,
+    0x90, 0x0, 0x1f, 0xff, 0xf5, 0xcf, 0xff, 0x90,
+    0x0, 0x1f, 0xff, 0xf5, 0xcf, 0xff, 0x90, 0x0,
+    0x1f, 0xff, 0xf5, 0x68, 0x88, 0x50, 0x0, 0x17,
+    0x88, 0x83, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x11, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x4b, 0xbb, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x5f,
+    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
+    0xd0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xd0,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xff, 0xd0, 0x0, 0x0,
+    0x0, 0x0, 0x5f, 0xff, 0xd0, 0x0, 0x0, 0x0,
+    0x0, 0x5f, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0x5f, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x5f,
+    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
+    0xd0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xd0,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xff, 0xd0, 0x0, 0x0,
+    0x0, 0x0, 0x5f, 0xff, 0xd0, 0x0, 0x0, 0x0,
+    0x0, 0x5f, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0x5f, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x5f,
+    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
+    0xd0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xd0,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xff, 0xd0, 0x0, 0x0,
+    0x0, 0x0, 0x5f, 0xff, 0xd0, 0x0, 0x0, 0x0,
+    0x0, 0x5f, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0x5f, 0xff, 0xd0, 0x0, 0x0,
+
+    /* U+00F0 "ð" */
+    0x0, 0x0, 0x0, 0x24, 0x44, 0x43, 0x0, 0x0,
+    0x0, 0x22, 0x0, 0x0, 0x0, 0x0, 0x0, 0x29,
+    0xff, 0xfd, 0x50, 0x0, 0x17, 0xc8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x6e, 0xff, 0xe8, 0x37,
+    0xdf, 0xfc, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xef, 0xff, 0xdf, 0xff, 0xd8, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x7e, 0xff, 0xff,
+    0xd8, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x49, 0xef, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x4a, 0xef, 0xfe, 0xde, 0xff,
+    0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
+    0xff, 0xa6, 0x16, 0xef, 0xfe, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xde, 0xb5, 0x10, 0x0, 0x9f,
+    0xff, 0xc1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x54,
+    0x0, 0x0, 0x0, 0x2c, 0xff, 0xf8, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x58, 0xaa, 0x97, 0x26,
+    0xef, 0xfd, 0x30, 0x0, 0x0, 0x0, 0x2, 0x8e,
+    0xff, 0xff, 0xff, 0xfb, 0xef, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0x3b, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf4, 0x0, 0x0, 0x4, 0xdf, 0xff,
+    0xfd, 0xb9, 0x9b, 0xdf, 0xff, 0xff, 0xfa, 0x10,
+    0x0, 0x2c, 0xff, 0xff, 0x83, 0x0, 0x0, 0x37,
+    0xef, 0xff, 0xfd, 0x30, 0x1, 0x9f, 0xff, 0xe7,
+    0x0, 0x0, 0x0, 0x0, 0x4d, 0xff, 0xff, 0x70,
+    0x3, 0xdf, 0xff, 0x91, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xef, 0xff, 0xc0, 0x7, 0xff, 0xfd, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf1,
+    0xc, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xff, 0xf5, 0x1e, 0xff, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xf7,
+    0x2e, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1b, 0xff, 0xf9, 0x4e, 0xff, 0xf2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x19, 0xff, 0xfa,
+    0x4f, 0xff, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9, 0xff, 0xfb, 0x4f, 0xff, 0xe2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x19, 0xff, 0xfb,
+    0x4e, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1a, 0xff, 0xfa, 0x2e, 0xff, 0xf3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xff, 0xf9,
+    0xe, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2e, 0xff, 0xf6, 0xb, 0xff, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf2,
+    0x7, 0xff, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xcf, 0xff, 0xc0, 0x3, 0xdf, 0xff, 0xa1,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xef, 0xff, 0x60,
+    0x0, 0x8f, 0xff, 0xf9, 0x10, 0x0, 0x0, 0x1,
+    0x6e, 0xff, 0xfb, 0x20, 0x0, 0x1b, 0xff, 0xff,
+    0xb6, 0x21, 0x1, 0x4a, 0xff, 0xff, 0xe3, 0x0,
+    0x0, 0x3, 0xcf, 0xff, 0xfe, 0xcb, 0xbc, 0xef,
+    0xff, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x2a, 0xef,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xc4, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x6c, 0xff, 0xff, 0xff, 0xff,
+    0xe8, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x26, 0x9a, 0xa9, 0x74, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+00F1 "ñ" */
+    0x0, 0x0, 0x0, 0x1, 0x22, 0x10, 0x0, 0x0,
+    0x12, 0x22, 0x0, 0x0, 0x0, 0x0, 0x5a, 0xcb,
+    0xa5, 0x10, 0x0, 0x5c, 0xc9, 0x0, 0x0, 0x0,
+    0x18, 0xef, 0xff, 0xfe, 0xd8, 0x44, 0xbf, 0xfa,
+    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x9f, 0xfc,
+    0x43, 0x8d, 0xff, 0xff, 0xff, 0xa1, 0x0, 0x0,
+    0x0, 0xcf, 0xf6, 0x0, 0x3, 0x7b, 0xef, 0xd9,
+    0x20, 0x0, 0x0, 0x0, 0x23, 0x31, 0x0, 0x0,
+    0x2, 0x33, 0x21, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x11, 0x10, 0x0, 0x1,
+    0x35, 0x55, 0x53, 0x10, 0x0, 0x0, 0x18, 0xbb,
+    0xa1, 0x1, 0x6b, 0xde, 0xff, 0xed, 0xb5, 0x0,
+    0x0, 0x2b, 0xff, 0xd1, 0x3c, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xb2, 0x0, 0x2b, 0xff, 0xd4, 0xcf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x2b,
+    0xff, 0xed, 0xff, 0xea, 0x75, 0x57, 0xbe, 0xff,
+    0xff, 0x60, 0x2b, 0xff, 0xff, 0xfc, 0x50, 0x0,
+    0x0, 0x17, 0xef, 0xff, 0xb1, 0x2b, 0xff, 0xff,
+    0xc1, 0x0, 0x0, 0x0, 0x1, 0x9f, 0xff, 0xd3,
+    0x2b, 0xff, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x4e, 0xff, 0xf4, 0x2b, 0xff, 0xfb, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x2d, 0xff, 0xf5, 0x2b, 0xff,
+    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xff,
+    0xf5, 0x2b, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0xff, 0xf5, 0x2b, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf5, 0x2b,
+    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0xff, 0xf5, 0x2b, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0xff, 0xf5, 0x2b, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf5,
+    0x2b, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0xff, 0xf5, 0x2b, 0xff, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xc, 0xff, 0xf5, 0x2b, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
+    0xf5, 0x2b, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0xff, 0xf5, 0x2b, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf5, 0x2b,
+    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0xff, 0xf5, 0x2b, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0xff, 0xf5, 0x2b, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf5,
+    0x2b, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0xff, 0xf5, 0x2b, 0xff, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xc, 0xff, 0xf5, 0x2b, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
+    0xf5,
+
+    /* U+00F2 "ò" */
+    0x0, 0x0, 0x0, 0x24, 0x44, 0x44, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xdf, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xef, 0xff, 0xb1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xef, 0xfe, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0xff,
+    0xfb, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1b, 0xff, 0xf4, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3b, 0xee, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x25, 0x54, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x35, 0x56, 0x54,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x17, 0xbd, 0xef, 0xff, 0xec, 0xa4, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x6e, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfa, 0x30, 0x0, 0x0, 0x0, 0x1,
+    0x8e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
+    0x40, 0x0, 0x0, 0x1, 0x9f, 0xff, 0xfe, 0xa5,
+    0x32, 0x48, 0xcf, 0xff, 0xfd, 0x30, 0x0, 0x0,
+    0x6e, 0xff, 0xfd, 0x41, 0x0, 0x0, 0x2, 0x9f,
+    0xff, 0xfb, 0x20, 0x0, 0x2c, 0xff, 0xfc, 0x30,
+    0x0, 0x0, 0x0, 0x1, 0x8f, 0xff, 0xf7, 0x0,
+    0x5, 0xff, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xbf, 0xff, 0xd0, 0x0, 0xbf, 0xff, 0xc1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
+    0x30, 0x1e, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1d, 0xff, 0xf8, 0x3, 0xef, 0xff,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xaf,
+    0xff, 0xa0, 0x5f, 0xff, 0xe2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0xfb, 0x16, 0xff,
+    0xfd, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xc1, 0x6f, 0xff, 0xc2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xfc, 0x26,
+    0xff, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xb1, 0x5f, 0xff, 0xe2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xfb,
+    0x14, 0xef, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xaf, 0xff, 0xa0, 0x1e, 0xff, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xff,
+    0xf8, 0x0, 0xcf, 0xff, 0xa0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0xff, 0x50, 0x7, 0xff,
+    0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
+    0xff, 0xe1, 0x0, 0x3d, 0xff, 0xfb, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x6e, 0xff, 0xf9, 0x0, 0x0,
+    0x8f, 0xff, 0xfa, 0x10, 0x0, 0x0, 0x0, 0x5d,
+    0xff, 0xfd, 0x40, 0x0, 0x1, 0xbf, 0xff, 0xfc,
+    0x62, 0x10, 0x14, 0x8e, 0xff, 0xff, 0x60, 0x0,
+    0x0, 0x3, 0xcf, 0xff, 0xfe, 0xdc, 0xbc, 0xef,
+    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x2, 0xae,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x6c, 0xff, 0xff, 0xff,
+    0xff, 0xe8, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0x69, 0xaa, 0x97, 0x40, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+00F3 "ó" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x14, 0x44,
+    0x44, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xff, 0xc3, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
+    0xff, 0xd4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xff, 0xf6, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1a,
+    0xff, 0xf8, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xef, 0xfb, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xae, 0xed, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0x55, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x35, 0x56, 0x54,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x17, 0xbd, 0xef, 0xff, 0xec, 0xa4, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x6e, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfa, 0x30, 0x0, 0x0, 0x0, 0x1,
+    0x8e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
+    0x40, 0x0, 0x0, 0x1, 0x9f, 0xff, 0xfe, 0xa5,
+    0x32, 0x48, 0xcf, 0xff, 0xfd, 0x30, 0x0, 0x0,
+    0x6e, 0xff, 0xfd, 0x41, 0x0, 0x0, 0x2, 0x9f,
+    0xff, 0xfb, 0x20, 0x0, 0x2c, 0xff, 0xfc, 0x30,
+    0x0, 0x0, 0x0, 0x1, 0x8f, 0xff, 0xf7, 0x0,
+    0x5, 0xff, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xbf, 0xff, 0xd0, 0x0, 0xbf, 0xff, 0xc1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
+    0x30, 0x1e, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1d, 0xff, 0xf8, 0x3, 0xef, 0xff,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xaf,
+    0xff, 0xa0, 0x5f, 0xff, 0xe2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0xfb, 0x16, 0xff,
+    0xfd, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xc1, 0x6f, 0xff, 0xc2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xfc, 0x26,
+    0xff, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xb1, 0x5f, 0xff, 0xe2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xfb,
+    0x14, 0xef, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xaf, 0xff, 0xa0, 0x1e, 0xff, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xff,
+    0xf8, 0x0, 0xcf, 0xff, 0xa0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0xff, 0x50, 0x7, 0xff,
+    0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
+    0xff, 0xe1, 0x0, 0x3d, 0xff, 0xfb, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x6e, 0xff, 0xf9, 0x0, 0x0,
+    0x8f, 0xff, 0xfa, 0x10, 0x0, 0x0, 0x0, 0x5d,
+    0xff, 0xfd, 0x40, 0x0, 0x1, 0xbf, 0xff, 0xfc,
+    0x62, 0x10, 0x14, 0x8e, 0xff, 0xff, 0x60, 0x0,
+    0x0, 0x3, 0xcf, 0xff, 0xfe, 0xdc, 0xbc, 0xef,
+    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x2, 0xae,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x6c, 0xff, 0xff, 0xff,
+    0xff, 0xe8, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0x69, 0xaa, 0x97, 0x40, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+00F4 "ô" */
+    0x0, 0x0, 0x0, 0x0, 0x2, 0x44, 0x44, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x9f, 0xff, 0xfc, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
+    0xfb, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5e, 0xff, 0xea, 0xff, 0xf9, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3d, 0xff, 0xf7,
+    0x2b, 0xff, 0xe7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1b, 0xff, 0xfb, 0x10, 0x4e, 0xff, 0xe5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xee, 0xee,
+    0x30, 0x0, 0x9e, 0xee, 0xc2, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x45, 0x55, 0x30, 0x0, 0x1, 0x45,
+    0x55, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x35, 0x56, 0x54,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x17, 0xbd, 0xef, 0xff, 0xec, 0xa4, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x6e, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfa, 0x30, 0x0, 0x0, 0x0, 0x1,
+    0x8e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
+    0x40, 0x0, 0x0, 0x1, 0x9f, 0xff, 0xfe, 0xa5,
+    0x32, 0x48, 0xcf, 0xff, 0xfd, 0x30, 0x0, 0x0,
+    0x6e, 0xff, 0xfd, 0x41, 0x0, 0x0, 0x2, 0x9f,
+    0xff, 0xfb, 0x20, 0x0, 0x2c, 0xff, 0xfc, 0x30,
+    0x0, 0x0, 0x0, 0x1, 0x8f, 0xff, 0xf7, 0x0,
+    0x5, 0xff, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xbf, 0xff, 0xd0, 0x0, 0xbf, 0xff, 0xc1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
+    0x30, 0x1e, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1d, 0xff, 0xf8, 0x3, 0xef, 0xff,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xaf,
+    0xff, 0xa0, 0x5f, 0xff, 0xe2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0xfb, 0x16, 0xff,
+    0xfd, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xc1, 0x6f, 0xff, 0xc2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xfc, 0x26,
+    0xff, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xb1, 0x5f, 0xff, 0xe2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xfb,
+    0x14, 0xef, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xaf, 0xff, 0xa0, 0x1e, 0xff, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xff,
+    0xf8, 0x0, 0xcf, 0xff, 0xa0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0xff, 0x50, 0x7, 0xff,
+    0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
+    0xff, 0xe1, 0x0, 0x3d, 0xff, 0xfb, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x6e, 0xff, 0xf9, 0x0, 0x0,
+    0x8f, 0xff, 0xfa, 0x10, 0x0, 0x0, 0x0, 0x5d,
+    0xff, 0xfd, 0x40, 0x0, 0x1, 0xbf, 0xff, 0xfc,
+    0x62, 0x10, 0x14, 0x8e, 0xff, 0xff, 0x60, 0x0,
+    0x0, 0x3, 0xcf, 0xff, 0xfe, 0xdc, 0xbc, 0xef,
+    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x2, 0xae,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x6c, 0xff, 0xff, 0xff,
+    0xff, 0xe8, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0x69, 0xaa, 0x97, 0x40, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+00F5 "õ" */
+    0x0, 0x0, 0x0, 0x15, 0x89, 0x62, 0x0, 0x0,
+    0x18, 0x98, 0x20, 0x0, 0x0, 0x0, 0x0, 0x2b,
+    0xef, 0xff, 0xe8, 0x31, 0x4, 0xff, 0xd2, 0x0,
+    0x0, 0x0, 0x0, 0x1a, 0xff, 0xff, 0xff, 0xfe,
+    0xa8, 0xdf, 0xfa, 0x10, 0x0, 0x0, 0x0, 0x4,
+    0xef, 0xfb, 0x9c, 0xef, 0xff, 0xff, 0xfe, 0x60,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xfc, 0x10, 0x15,
+    0xbf, 0xff, 0xff, 0x91, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xcc, 0x70, 0x0, 0x2, 0x49, 0xb9, 0x51,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x13, 0x55, 0x65, 0x42, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x7b, 0xde, 0xff, 0xfe,
+    0xca, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x16,
+    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa3, 0x0,
+    0x0, 0x0, 0x0, 0x18, 0xef, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xc4, 0x0, 0x0, 0x0, 0x19,
+    0xff, 0xff, 0xea, 0x53, 0x24, 0x8c, 0xff, 0xff,
+    0xd3, 0x0, 0x0, 0x6, 0xef, 0xff, 0xd4, 0x10,
+    0x0, 0x0, 0x29, 0xff, 0xff, 0xb2, 0x0, 0x2,
+    0xcf, 0xff, 0xc3, 0x0, 0x0, 0x0, 0x0, 0x18,
+    0xff, 0xff, 0x70, 0x0, 0x5f, 0xff, 0xe6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xfd, 0x0,
+    0xb, 0xff, 0xfc, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5f, 0xff, 0xf3, 0x1, 0xef, 0xff, 0x70,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xff,
+    0x80, 0x3e, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1a, 0xff, 0xfa, 0x5, 0xff, 0xfe,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xff, 0xb1, 0x6f, 0xff, 0xd2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7, 0xff, 0xfc, 0x16, 0xff,
+    0xfc, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xff, 0xc2, 0x6f, 0xff, 0xd2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xfb, 0x15,
+    0xff, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xff, 0xb1, 0x4e, 0xff, 0xf3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1a, 0xff, 0xfa,
+    0x1, 0xef, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xdf, 0xff, 0x80, 0xc, 0xff, 0xfa,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
+    0xf5, 0x0, 0x7f, 0xff, 0xe3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0xfe, 0x10, 0x3, 0xdf,
+    0xff, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x6, 0xef,
+    0xff, 0x90, 0x0, 0x8, 0xff, 0xff, 0xa1, 0x0,
+    0x0, 0x0, 0x5, 0xdf, 0xff, 0xd4, 0x0, 0x0,
+    0x1b, 0xff, 0xff, 0xc6, 0x21, 0x1, 0x48, 0xef,
+    0xff, 0xf6, 0x0, 0x0, 0x0, 0x3c, 0xff, 0xff,
+    0xed, 0xcb, 0xce, 0xff, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x2a, 0xef, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xc5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x16,
+    0xcf, 0xff, 0xff, 0xff, 0xfe, 0x83, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x26, 0x9a, 0xa9,
+    0x74, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+00F6 "ö" */
+    0x0, 0x0, 0x1, 0x44, 0x44, 0x0, 0x0, 0x34,
+    0x44, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
+    0xff, 0xf1, 0x0, 0x9, 0xff, 0xfd, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x10, 0x0,
+    0x9f, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5f, 0xff, 0xf1, 0x0, 0x9, 0xff, 0xfd, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x10,
+    0x0, 0x9f, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x38, 0x88, 0x81, 0x0, 0x5, 0x88, 0x86,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x35, 0x56, 0x54,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x17, 0xbd, 0xef, 0xff, 0xec, 0xa4, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x6e, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfa, 0x30, 0x0, 0x0, 0x0, 0x1,
+    0x8e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
+    0x40, 0x0, 0x0, 0x1, 0x9f, 0xff, 0xfe, 0xa5,
+    0x32, 0x48, 0xcf, 0xff, 0xfd, 0x30, 0x0, 0x0,
+    0x6e, 0xff, 0xfd, 0x41, 0x0, 0x0, 0x2, 0x9f,
+    0xff, 0xfb, 0x20, 0x0, 0x2c, 0xff, 0xfc, 0x30,
+    0x0, 0x0, 0x0, 0x1, 0x8f, 0xff, 0xf7, 0x0,
+    0x5, 0xff, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xbf, 0xff, 0xd0, 0x0, 0xbf, 0xff, 0xc1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
+    0x30, 0x1e, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1d, 0xff, 0xf8, 0x3, 0xef, 0xff,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xaf,
+    0xff, 0xa0, 0x5f, 0xff, 0xe2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0xfb, 0x16, 0xff,
+    0xfd, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xc1, 0x6f, 0xff, 0xc2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xfc, 0x26,
+    0xff, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xb1, 0x5f, 0xff, 0xe2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xfb,
+    0x14, 0xef, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xaf, 0xff, 0xa0, 0x1e, 0xff, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xff,
+    0xf8, 0x0, 0xcf, 0xff, 0xa0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0xff, 0x50, 0x7, 0xff,
+    0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
+    0xff, 0xe1, 0x0, 0x3d, 0xff, 0xfb, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x6e, 0xff, 0xf9, 0x0, 0x0,
+    0x8f, 0xff, 0xfa, 0x10, 0x0, 0x0, 0x0, 0x5d,
+    0xff, 0xfd, 0x40, 0x0, 0x1, 0xbf, 0xff, 0xfc,
+    0x62, 0x10, 0x14, 0x8e, 0xff, 0xff, 0x60, 0x0,
+    0x0, 0x3, 0xcf, 0xff, 0xfe, 0xdc, 0xbc, 0xef,
+    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x2, 0xae,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x6c, 0xff, 0xff, 0xff,
+    0xff, 0xe8, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0x69, 0xaa, 0x97, 0x40, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+00F7 "÷" */
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xbb, 0xbb, 0x70,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0x90,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0x90,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x11, 0x11, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x21,
+    0x3d, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xdd, 0xdd, 0xdd, 0xd7, 0x3e, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0x3e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf8, 0x3d, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x55, 0x55, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0x90,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0x90,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0x77, 0x77, 0x40, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+00F8 "ø" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x24, 0x56, 0x54, 0x31, 0x0, 0x1, 0xbc,
+    0x40, 0x0, 0x0, 0x0, 0x4, 0xac, 0xef, 0xff,
+    0xec, 0xa5, 0x0, 0x8f, 0xfb, 0x0, 0x0, 0x0,
+    0x3a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x8f,
+    0xfd, 0x40, 0x0, 0x0, 0x5d, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0,
+    0x4d, 0xff, 0xff, 0xc8, 0x32, 0x36, 0xbe, 0xff,
+    0xff, 0xc0, 0x0, 0x0, 0x2c, 0xff, 0xff, 0x92,
+    0x0, 0x0, 0x1, 0x6e, 0xff, 0xff, 0x40, 0x0,
+    0x8, 0xff, 0xff, 0x81, 0x0, 0x0, 0x0, 0x7,
+    0xef, 0xff, 0xfb, 0x20, 0x1, 0xdf, 0xff, 0xb1,
+    0x0, 0x0, 0x0, 0x4, 0xef, 0xff, 0xff, 0xe5,
+    0x0, 0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x2,
+    0xcf, 0xfb, 0xdf, 0xff, 0xa0, 0x8, 0xff, 0xfc,
+    0x20, 0x0, 0x0, 0x1, 0xaf, 0xfb, 0x28, 0xff,
+    0xfd, 0x11, 0xaf, 0xff, 0x91, 0x0, 0x0, 0x0,
+    0x7e, 0xfd, 0x40, 0x4f, 0xff, 0xf1, 0x1b, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0x5e, 0xfe, 0x50, 0x2,
+    0xff, 0xff, 0x32, 0xcf, 0xff, 0x70, 0x0, 0x0,
+    0x2c, 0xff, 0x80, 0x0, 0x1f, 0xff, 0xf4, 0x2c,
+    0xff, 0xf7, 0x0, 0x0, 0x1b, 0xff, 0xa1, 0x0,
+    0x1, 0xef, 0xff, 0x52, 0xcf, 0xff, 0x70, 0x0,
+    0x7, 0xff, 0xd3, 0x0, 0x0, 0x1f, 0xff, 0xf5,
+    0x2c, 0xff, 0xf7, 0x0, 0x6, 0xef, 0xe4, 0x0,
+    0x0, 0x1, 0xff, 0xff, 0x41, 0xbf, 0xff, 0x90,
+    0x2, 0xdf, 0xe7, 0x0, 0x0, 0x0, 0x3f, 0xff,
+    0xf2, 0x9, 0xff, 0xfb, 0x22, 0xbf, 0xf9, 0x10,
+    0x0, 0x0, 0x7, 0xff, 0xfe, 0x10, 0x7f, 0xff,
+    0xe4, 0x9f, 0xfd, 0x20, 0x0, 0x0, 0x1, 0xbf,
+    0xff, 0xb1, 0x3, 0xef, 0xff, 0xcf, 0xfd, 0x40,
+    0x0, 0x0, 0x0, 0x5e, 0xff, 0xf6, 0x0, 0xb,
+    0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x1b,
+    0xff, 0xfd, 0x30, 0x0, 0x4e, 0xff, 0xff, 0xb1,
+    0x0, 0x0, 0x0, 0x2a, 0xff, 0xff, 0x80, 0x0,
+    0x0, 0x8f, 0xff, 0xfe, 0x74, 0x10, 0x13, 0x6d,
+    0xff, 0xff, 0xb1, 0x0, 0x0, 0x7, 0xff, 0xff,
+    0xff, 0xdc, 0xbc, 0xdf, 0xff, 0xff, 0xc3, 0x0,
+    0x0, 0x5, 0xef, 0xee, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0x91, 0x0, 0x0, 0x2, 0xcf, 0xf8,
+    0x49, 0xef, 0xff, 0xff, 0xff, 0xfb, 0x51, 0x0,
+    0x0, 0x0, 0x5d, 0xfa, 0x0, 0x1, 0x48, 0xaa,
+    0xa8, 0x51, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+00F9 "ù" */
+    0x0, 0x0, 0x0, 0x24, 0x44, 0x44, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0xff,
+    0xfe, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xef, 0xff, 0xb1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x19, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xaf, 0xfe, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2c,
+    0xee, 0x91, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0x55, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0xaa,
+    0xa4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x19, 0xaa,
+    0xa3, 0x2c, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2d, 0xff, 0xf4, 0x2c, 0xff, 0xe5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2d, 0xff, 0xf4, 0x2c,
+    0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d,
+    0xff, 0xf4, 0x2c, 0xff, 0xe5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2d, 0xff, 0xf4, 0x2c, 0xff, 0xe5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xff, 0xf4,
+    0x2c, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2d, 0xff, 0xf4, 0x2c, 0xff, 0xe5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2d, 0xff, 0xf4, 0x2c, 0xff,
+    0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xff,
+    0xf4, 0x2c, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2d, 0xff, 0xf4, 0x2c, 0xff, 0xe5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2d, 0xff, 0xf4, 0x2c,
+    0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d,
+    0xff, 0xf4, 0x2c, 0xff, 0xe5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2d, 0xff, 0xf4, 0x2c, 0xff, 0xe5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xff, 0xf4,
+    0x2c, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2d, 0xff, 0xf4, 0x2c, 0xff, 0xe5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3d, 0xff, 0xf4, 0x2c, 0xff,
+    0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xff,
+    0xf4, 0x2b, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0xf4, 0x1b, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xaf, 0xff, 0xf4, 0x9,
+    0xff, 0xfc, 0x20, 0x0, 0x0, 0x0, 0x5, 0xef,
+    0xff, 0xf4, 0x6, 0xff, 0xff, 0x81, 0x0, 0x0,
+    0x1, 0x5d, 0xff, 0xff, 0xf4, 0x2, 0xdf, 0xff,
+    0xfa, 0x52, 0x23, 0x59, 0xef, 0xfd, 0xff, 0xf4,
+    0x0, 0x8f, 0xff, 0xff, 0xed, 0xcd, 0xef, 0xff,
+    0x99, 0xff, 0xf4, 0x0, 0x18, 0xef, 0xff, 0xff,
+    0xff, 0xff, 0xe9, 0x18, 0xff, 0xf4, 0x0, 0x1,
+    0x6d, 0xff, 0xff, 0xff, 0xfd, 0x61, 0x8, 0xff,
+    0xf4, 0x0, 0x0, 0x0, 0x37, 0x9a, 0xa8, 0x40,
+    0x0, 0x1, 0x11, 0x10,
+
+    /* U+00FA "ú" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x44, 0x44,
+    0x41, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9, 0xff, 0xff, 0x91, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2e, 0xff, 0xfb, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
+    0xd3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xdf, 0xfe, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xee,
+    0xa1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x15, 0x54, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0xaa,
+    0xa4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x19, 0xaa,
+    0xa3, 0x2c, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2d, 0xff, 0xf4, 0x2c, 0xff, 0xe5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2d, 0xff, 0xf4, 0x2c,
+    0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d,
+    0xff, 0xf4, 0x2c, 0xff, 0xe5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2d, 0xff, 0xf4, 0x2c, 0xff, 0xe5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xff, 0xf4,
+    0x2c, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2d, 0xff, 0xf4, 0x2c, 0xff, 0xe5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2d, 0xff, 0xf4, 0x2c, 0xff,
+    0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xff,
+    0xf4, 0x2c, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2d, 0xff, 0xf4, 0x2c, 0xff, 0xe5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2d, 0xff, 0xf4, 0x2c,
+    0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d,
+    0xff, 0xf4, 0x2c, 0xff, 0xe5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2d, 0xff, 0xf4, 0x2c, 0xff, 0xe5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xff, 0xf4,
+    0x2c, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2d, 0xff, 0xf4, 0x2c, 0xff, 0xe5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3d, 0xff, 0xf4, 0x2c, 0xff,
+    0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xff,
+    0xf4, 0x2b, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0xf4, 0x1b, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xaf, 0xff, 0xf4, 0x9,
+    0xff, 0xfc, 0x20, 0x0, 0x0, 0x0, 0x5, 0xef,
+    0xff, 0xf4, 0x6, 0xff, 0xff, 0x81, 0x0, 0x0,
+    0x1, 0x5d, 0xff, 0xff, 0xf4, 0x2, 0xdf, 0xff,
+    0xfa, 0x52, 0x23, 0x59, 0xef, 0xfd, 0xff, 0xf4,
+    0x0, 0x8f, 0xff, 0xff, 0xed, 0xcd, 0xef, 0xff,
+    0x99, 0xff, 0xf4, 0x0, 0x18, 0xef, 0xff, 0xff,
+    0xff, 0xff, 0xe9, 0x18, 0xff, 0xf4, 0x0, 0x1,
+    0x6d, 0xff, 0xff, 0xff, 0xfd, 0x61, 0x8, 0xff,
+    0xf4, 0x0, 0x0, 0x0, 0x37, 0x9a, 0xa8, 0x40,
+    0x0, 0x1, 0x11, 0x10,
+
+    /* U+00FB "û" */
+    0x0, 0x0, 0x0, 0x0, 0x24, 0x44, 0x43, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xaf,
+    0xff, 0xfc, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x19, 0xff, 0xff, 0xff, 0xa1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xea, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xdf,
+    0xfe, 0x73, 0xcf, 0xfe, 0x60, 0x0, 0x0, 0x0,
+    0x0, 0x2c, 0xff, 0xfa, 0x10, 0x5e, 0xff, 0xe4,
+    0x0, 0x0, 0x0, 0x0, 0x9e, 0xee, 0xe2, 0x0,
+    0xa, 0xee, 0xec, 0x20, 0x0, 0x0, 0x1, 0x45,
+    0x55, 0x30, 0x0, 0x1, 0x45, 0x54, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0xaa,
+    0xa4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x19, 0xaa,
+    0xa3, 0x2c, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2d, 0xff, 0xf4, 0x2c, 0xff, 0xe5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2d, 0xff, 0xf4, 0x2c,
+    0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d,
+    0xff, 0xf4, 0x2c, 0xff, 0xe5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2d, 0xff, 0xf4, 0x2c, 0xff, 0xe5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xff, 0xf4,
+    0x2c, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2d, 0xff, 0xf4, 0x2c, 0xff, 0xe5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2d, 0xff, 0xf4, 0x2c, 0xff,
+    0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xff,
+    0xf4, 0x2c, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2d, 0xff, 0xf4, 0x2c, 0xff, 0xe5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2d, 0xff, 0xf4, 0x2c,
+    0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d,
+    0xff, 0xf4, 0x2c, 0xff, 0xe5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2d, 0xff, 0xf4, 0x2c, 0xff, 0xe5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xff, 0xf4,
+    0x2c, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2d, 0xff, 0xf4, 0x2c, 0xff, 0xe5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3d, 0xff, 0xf4, 0x2c, 0xff,
+    0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xff,
+    0xf4, 0x2b, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0xf4, 0x1b, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xaf, 0xff, 0xf4, 0x9,
+    0xff, 0xfc, 0x20, 0x0, 0x0, 0x0, 0x5, 0xef,
+    0xff, 0xf4, 0x6, 0xff, 0xff, 0x81, 0x0, 0x0,
+    0x1, 0x5d, 0xff, 0xff, 0xf4, 0x2, 0xdf, 0xff,
+    0xfa, 0x52, 0x23, 0x59, 0xef, 0xfd, 0xff, 0xf4,
+    0x0, 0x8f, 0xff, 0xff, 0xed, 0xcd, 0xef, 0xff,
+    0x99, 0xff, 0xf4, 0x0, 0x18, 0xef, 0xff, 0xff,
+    0xff, 0xff, 0xe9, 0x18, 0xff, 0xf4, 0x0, 0x1,
+    0x6d, 0xff, 0xff, 0xff, 0xfd, 0x61, 0x8, 0xff,
+    0xf4, 0x0, 0x0, 0x0, 0x37, 0x9a, 0xa8, 0x40,
+    0x0, 0x1, 0x11, 0x10,
+
+    /* U+00FC "ü" */
+    0x0, 0x0, 0x24, 0x44, 0x40, 0x0, 0x3, 0x44,
+    0x43, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf0,
+    0x0, 0xa, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xff, 0xf0, 0x0, 0xa, 0xff, 0xfb, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xff, 0xf0, 0x0, 0xa,
+    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
+    0xf0, 0x0, 0xa, 0xff, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x38, 0x88, 0x70, 0x0, 0x5, 0x88, 0x86,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0xaa,
+    0xa4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x19, 0xaa,
+    0xa3, 0x2c, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2d, 0xff, 0xf4, 0x2c, 0xff, 0xe5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2d, 0xff, 0xf4, 0x2c,
+    0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d,
+    0xff, 0xf4, 0x2c, 0xff, 0xe5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2d, 0xff, 0xf4, 0x2c, 0xff, 0xe5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xff, 0xf4,
+    0x2c, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2d, 0xff, 0xf4, 0x2c, 0xff, 0xe5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2d, 0xff, 0xf4, 0x2c, 0xff,
+    0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xff,
+    0xf4, 0x2c, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2d, 0xff, 0xf4, 0x2c, 0xff, 0xe5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2d, 0xff, 0xf4, 0x2c,
+    0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d,
+    0xff, 0xf4, 0x2c, 0xff, 0xe5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2d, 0xff, 0xf4, 0x2c, 0xff, 0xe5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xff, 0xf4,
+    0x2c, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2d, 0xff, 0xf4, 0x2c, 0xff, 0xe5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3d, 0xff, 0xf4, 0x2c, 0xff,
+    0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xff,
+    0xf4, 0x2b, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0xf4, 0x1b, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xaf, 0xff, 0xf4, 0x9,
+    0xff, 0xfc, 0x20, 0x0, 0x0, 0x0, 0x5, 0xef,
+    0xff, 0xf4, 0x6, 0xff, 0xff, 0x81, 0x0, 0x0,
+    0x1, 0x5d, 0xff, 0xff, 0xf4, 0x2, 0xdf, 0xff,
+    0xfa, 0x52, 0x23, 0x59, 0xef, 0xfd, 0xff, 0xf4,
+    0x0, 0x8f, 0xff, 0xff, 0xed, 0xcd, 0xef, 0xff,
+    0x99, 0xff, 0xf4, 0x0, 0x18, 0xef, 0xff, 0xff,
+    0xff, 0xff, 0xe9, 0x18, 0xff, 0xf4, 0x0, 0x1,
+    0x6d, 0xff, 0xff, 0xff, 0xfd, 0x61, 0x8, 0xff,
+    0xf4, 0x0, 0x0, 0x0, 0x37, 0x9a, 0xa8, 0x40,
+    0x0, 0x1, 0x11, 0x10,
+
+    /* U+00FD "ý" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x14, 0x44,
+    0x44, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xff, 0xfc, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xff,
+    0xd3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xff, 0xfe, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5f, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xae, 0xeb, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x45, 0x52, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x29, 0xaa, 0xa4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xaa, 0xa5, 0x1b, 0xff, 0xfa, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3d, 0xff, 0xe3,
+    0x7, 0xff, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xb1, 0x2, 0xef, 0xff, 0x70,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xbf, 0xff, 0x60,
+    0x0, 0xaf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xef, 0xfe, 0x10, 0x0, 0x5f, 0xff, 0xe4,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xfa, 0x0,
+    0x0, 0x2c, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x1c, 0xff, 0xf5, 0x0, 0x0, 0x8, 0xff, 0xfc,
+    0x20, 0x0, 0x0, 0x0, 0x5e, 0xff, 0xc2, 0x0,
+    0x0, 0x3, 0xef, 0xff, 0x40, 0x0, 0x0, 0x1,
+    0x9f, 0xff, 0x80, 0x0, 0x0, 0x0, 0xbf, 0xff,
+    0x90, 0x0, 0x0, 0x2, 0xdf, 0xfe, 0x30, 0x0,
+    0x0, 0x0, 0x5f, 0xff, 0xd1, 0x0, 0x0, 0x6,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xff,
+    0xe5, 0x0, 0x0, 0xb, 0xff, 0xf6, 0x0, 0x0,
+    0x0, 0x0, 0x19, 0xff, 0xfa, 0x10, 0x0, 0x2e,
+    0xff, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x5, 0xef,
+    0xfd, 0x30, 0x0, 0x7f, 0xff, 0x91, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xcf, 0xff, 0x70, 0x2, 0xbf,
+    0xfe, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0xb0, 0x4, 0xef, 0xfd, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2e, 0xff, 0xe2, 0x8, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1a,
+    0xff, 0xf6, 0xd, 0xff, 0xe3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xef, 0xfa, 0x3f, 0xff,
+    0xb1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xdf, 0xfd, 0x9f, 0xff, 0x60, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xef, 0xfd,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1c, 0xff, 0xff, 0xf4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0xff, 0xc1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xdf, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xcf, 0xfd, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xef, 0xfb, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xe1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0x8f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x12, 0x0, 0x28, 0xef, 0xfd, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5d, 0xcd, 0xdf,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xff, 0xff, 0xff, 0xc1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0xff, 0xff,
+    0xfd, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2b, 0xef, 0xfd, 0xa3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x34, 0x43,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+00FE "þ" */
+    0x3, 0x44, 0x42, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xbf, 0xff, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2b,
+    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xbf, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2b, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xbf, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2b, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xbf, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2b, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xbf, 0xff, 0x70, 0x0, 0x13, 0x44, 0x42, 0x10,
+    0x0, 0x0, 0x0, 0x2b, 0xff, 0xf7, 0x1, 0x7b,
+    0xde, 0xee, 0xca, 0x50, 0x0, 0x0, 0x2, 0xbf,
+    0xff, 0x74, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xc3,
+    0x0, 0x0, 0x2b, 0xff, 0xfb, 0xdf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xd4, 0x0, 0x2, 0xbf, 0xff,
+    0xff, 0xfe, 0x94, 0x12, 0x5a, 0xef, 0xff, 0xd3,
+    0x0, 0x2b, 0xff, 0xff, 0xfd, 0x50, 0x0, 0x0,
+    0x17, 0xef, 0xff, 0xa1, 0x2, 0xbf, 0xff, 0xfe,
+    0x40, 0x0, 0x0, 0x0, 0x7, 0xef, 0xfe, 0x50,
+    0x2b, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0x1b, 0xff, 0xfa, 0x2, 0xbf, 0xff, 0xc2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf1, 0x2b,
+    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xef, 0xff, 0x52, 0xbf, 0xfe, 0x60, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1b, 0xff, 0xf8, 0x2b, 0xff,
+    0xe3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x9f,
+    0xff, 0xa2, 0xbf, 0xfd, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xfb, 0x2b, 0xff, 0xd2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
+    0xb2, 0xbf, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9, 0xff, 0xfa, 0x2b, 0xff, 0xd2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x9f, 0xff, 0xa2,
+    0xbf, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1b, 0xff, 0xf8, 0x2b, 0xff, 0xe6, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xef, 0xff, 0x52, 0xbf,
+    0xff, 0x91, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xff, 0xf1, 0x2b, 0xff, 0xfd, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0xa, 0xff, 0xfb, 0x2, 0xbf, 0xff,
+    0xfa, 0x0, 0x0, 0x0, 0x0, 0x6, 0xef, 0xfe,
+    0x60, 0x2b, 0xff, 0xff, 0xf7, 0x10, 0x0, 0x0,
+    0x4, 0xdf, 0xff, 0xb1, 0x2, 0xbf, 0xff, 0xff,
+    0xfa, 0x41, 0x1, 0x38, 0xef, 0xff, 0xe3, 0x0,
+    0x2b, 0xff, 0xfe, 0xff, 0xfe, 0xcb, 0xcd, 0xff,
+    0xff, 0xe6, 0x0, 0x2, 0xbf, 0xff, 0x78, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xc5, 0x0, 0x0, 0x2b,
+    0xff, 0xf7, 0x17, 0xef, 0xff, 0xff, 0xfe, 0x83,
+    0x0, 0x0, 0x2, 0xbf, 0xff, 0x70, 0x1, 0x58,
+    0xaa, 0x85, 0x0, 0x0, 0x0, 0x0, 0x2b, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xbf, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2b, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xbf, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2b, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xbf, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2b, 0xff, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xbf,
+    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x17, 0x99, 0x94, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+00FF "ÿ" */
+    0x0, 0x0, 0x1, 0x44, 0x44, 0x10, 0x0, 0x24,
+    0x44, 0x30, 0x0, 0x0, 0x0, 0x0, 0x5, 0xef,
+    0xfd, 0x30, 0x0, 0x9f, 0xff, 0xb1, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xef, 0xfd, 0x30, 0x0, 0x9f,
+    0xff, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x6, 0xef,
+    0xfd, 0x30, 0x0, 0x9f, 0xff, 0xb1, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xef, 0xfd, 0x30, 0x0, 0x9f,
+    0xff, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x3, 0x78,
+    0x87, 0x20, 0x0, 0x58, 0x88, 0x61, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x29, 0xaa, 0x94, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xaa, 0xa4, 0x1b, 0xff, 0xfa, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3d, 0xff, 0xe3,
+    0x7, 0xff, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0xb1, 0x2, 0xef, 0xff, 0x70,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xbf, 0xff, 0x60,
+    0x0, 0xaf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xef, 0xfe, 0x10, 0x0, 0x5f, 0xff, 0xe4,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xfa, 0x0,
+    0x0, 0x2c, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x1c, 0xff, 0xf5, 0x0, 0x0, 0x8, 0xff, 0xfc,
+    0x20, 0x0, 0x0, 0x0, 0x5e, 0xff, 0xc2, 0x0,
+    0x0, 0x3, 0xef, 0xff, 0x40, 0x0, 0x0, 0x1,
+    0x9f, 0xff, 0x80, 0x0, 0x0, 0x0, 0xbf, 0xff,
+    0x90, 0x0, 0x0, 0x2, 0xdf, 0xfe, 0x30, 0x0,
+    0x0, 0x0, 0x5f, 0xff, 0xd1, 0x0, 0x0, 0x6,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xff,
+    0xe5, 0x0, 0x0, 0xb, 0xff, 0xf6, 0x0, 0x0,
+    0x0, 0x0, 0x19, 0xff, 0xfa, 0x10, 0x0, 0x2e,
+    0xff, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x5, 0xef,
+    0xfd, 0x30, 0x0, 0x7f, 0xff, 0x91, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xcf, 0xff, 0x60, 0x2, 0xbf,
+    0xfe, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0xb0, 0x4, 0xef, 0xfd, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2e, 0xff, 0xe2, 0x8, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1a,
+    0xff, 0xf6, 0xd, 0xff, 0xe3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xef, 0xfa, 0x3f, 0xff,
+    0xb1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xdf, 0xfd, 0x9f, 0xff, 0x60, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xef, 0xfd,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1c, 0xff, 0xff, 0xf4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xff, 0xc1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xdf, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xcf, 0xfd, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xef, 0xfb, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xe1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0x8f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x12, 0x0, 0x28, 0xef, 0xfd, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5d, 0xcd, 0xdf,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xff, 0xff, 0xff, 0xc1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0xff, 0xff,
+    0xfd, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2b, 0xef, 0xfd, 0xa3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x34, 0x43,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+};
+
+static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
+    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
+    {.bitmap_index = 0, .adv_w = 213, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 0, .adv_w = 213, .box_w = 6, .box_h = 35, .ofs_x = 4, .ofs_y = 0},
+    {.bitmap_index = 105, .adv_w = 273, .box_w = 14, .box_h = 14, .ofs_x = 2, .ofs_y = 21},
+    {.bitmap_index = 203, .adv_w = 427, .box_w = 27, .box_h = 36, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 689, .adv_w = 427, .box_w = 24, .box_h = 43, .ofs_x = 1, .ofs_y = -5},
+    {.bitmap_index = 1205, .adv_w = 683, .box_w = 38, .box_h = 37, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 1908, .adv_w = 512, .box_w = 29, .box_h = 36, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 2430, .adv_w = 147, .box_w = 6, .box_h = 14, .ofs_x = 2, .ofs_y = 21},
+    {.bitmap_index = 2472, .adv_w = 256, .box_w = 13, .box_h = 46, .ofs_x = 2, .ofs_y = -11},
+    {.bitmap_index = 2771, .adv_w = 256, .box_w = 13, .box_h = 46, .ofs_x = 2, .ofs_y = -11},
+    {.bitmap_index = 3070, .adv_w = 299, .box_w = 17, .box_h = 15, .ofs_x = 1, .ofs_y = 20},
+    {.bitmap_index = 3198, .adv_w = 448, .box_w = 24, .box_h = 24, .ofs_x = 2, .ofs_y = 5},
+    {.bitmap_index = 3486, .adv_w = 213, .box_w = 6, .box_h = 12, .ofs_x = 4, .ofs_y = -7},
+    {.bitmap_index = 3522, .adv_w = 256, .box_w = 14, .box_h = 5, .ofs_x = 1, .ofs_y = 10},
+    {.bitmap_index = 3557, .adv_w = 213, .box_w = 6, .box_h = 5, .ofs_x = 4, .ofs_y = 0},
+    {.bitmap_index = 3572, .adv_w = 213, .box_w = 14, .box_h = 36, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 3824, .adv_w = 427, .box_w = 24, .box_h = 36, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 4256, .adv_w = 427, .box_w = 15, .box_h = 35, .ofs_x = 4, .ofs_y = 0},
+    {.bitmap_index = 4519, .adv_w = 427, .box_w = 24, .box_h = 35, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4939, .adv_w = 427, .box_w = 23, .box_h = 36, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 5353, .adv_w = 427, .box_w = 25, .box_h = 35, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5791, .adv_w = 427, .box_w = 23, .box_h = 35, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 6194, .adv_w = 427, .box_w = 24, .box_h = 36, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 6626, .adv_w = 427, .box_w = 23, .box_h = 35, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 7029, .adv_w = 427, .box_w = 24, .box_h = 36, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 7461, .adv_w = 427, .box_w = 24, .box_h = 36, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 7893, .adv_w = 213, .box_w = 6, .box_h = 25, .ofs_x = 4, .ofs_y = 0},
+    {.bitmap_index = 7968, .adv_w = 213, .box_w = 6, .box_h = 32, .ofs_x = 4, .ofs_y = -7},
+    {.bitmap_index = 8064, .adv_w = 448, .box_w = 24, .box_h = 24, .ofs_x = 2, .ofs_y = 5},
+    {.bitmap_index = 8352, .adv_w = 448, .box_w = 24, .box_h = 15, .ofs_x = 2, .ofs_y = 9},
+    {.bitmap_index = 8532, .adv_w = 448, .box_w = 24, .box_h = 24, .ofs_x = 2, .ofs_y = 5},
+    {.bitmap_index = 8820, .adv_w = 427, .box_w = 23, .box_h = 35, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 9223, .adv_w = 780, .box_w = 46, .box_h = 46, .ofs_x = 2, .ofs_y = -11},
+    {.bitmap_index = 10281, .adv_w = 512, .box_w = 33, .box_h = 35, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10859, .adv_w = 512, .box_w = 27, .box_h = 35, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 11332, .adv_w = 555, .box_w = 31, .box_h = 36, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 11890, .adv_w = 555, .box_w = 30, .box_h = 35, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 12415, .adv_w = 512, .box_w = 27, .box_h = 35, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 12888, .adv_w = 469, .box_w = 25, .box_h = 35, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 13326, .adv_w = 597, .box_w = 33, .box_h = 36, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 13920, .adv_w = 555, .box_w = 28, .box_h = 35, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 14410, .adv_w = 213, .box_w = 6, .box_h = 35, .ofs_x = 4, .ofs_y = 0},
+    {.bitmap_index = 14515, .adv_w = 384, .box_w = 20, .box_h = 36, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 14875, .adv_w = 512, .box_w = 29, .box_h = 35, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 15383, .adv_w = 427, .box_w = 23, .box_h = 35, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 15786, .adv_w = 640, .box_w = 34, .box_h = 35, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 16381, .adv_w = 555, .box_w = 28, .box_h = 35, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 16871, .adv_w = 597, .box_w = 34, .box_h = 36, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 17483, .adv_w = 512, .box_w = 28, .box_h = 36, .ofs_x = 3, .ofs_y = -1},
+    {.bitmap_index = 17987, .adv_w = 597, .box_w = 34, .box_h = 38, .ofs_x = 2, .ofs_y = -3},
+    {.bitmap_index = 18633, .adv_w = 555, .box_w = 32, .box_h = 35, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 19193, .adv_w = 512, .box_w = 28, .box_h = 36, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 19697, .adv_w = 469, .box_w = 29, .box_h = 35, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20205, .adv_w = 555, .box_w = 28, .box_h = 36, .ofs_x = 3, .ofs_y = -1},
+    {.bitmap_index = 20709, .adv_w = 512, .box_w = 32, .box_h = 35, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21269, .adv_w = 725, .box_w = 45, .box_h = 35, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 22057, .adv_w = 512, .box_w = 32, .box_h = 35, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 22617, .adv_w = 512, .box_w = 32, .box_h = 35, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 23177, .adv_w = 469, .box_w = 29, .box_h = 35, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 23685, .adv_w = 213, .box_w = 11, .box_h = 45, .ofs_x = 2, .ofs_y = -10},
+    {.bitmap_index = 23933, .adv_w = 213, .box_w = 14, .box_h = 36, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 24185, .adv_w = 213, .box_w = 11, .box_h = 45, .ofs_x = 0, .ofs_y = -10},
+    {.bitmap_index = 24433, .adv_w = 361, .box_w = 21, .box_h = 20, .ofs_x = 1, .ofs_y = 16},
+    {.bitmap_index = 24643, .adv_w = 427, .box_w = 29, .box_h = 4, .ofs_x = -1, .ofs_y = -10},
+    {.bitmap_index = 24701, .adv_w = 256, .box_w = 9, .box_h = 7, .ofs_x = 2, .ofs_y = 28},
+    {.bitmap_index = 24733, .adv_w = 427, .box_w = 24, .box_h = 27, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 25057, .adv_w = 427, .box_w = 23, .box_h = 36, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 25471, .adv_w = 384, .box_w = 23, .box_h = 27, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 25782, .adv_w = 427, .box_w = 23, .box_h = 36, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 26196, .adv_w = 427, .box_w = 24, .box_h = 27, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 26520, .adv_w = 213, .box_w = 16, .box_h = 36, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 26808, .adv_w = 427, .box_w = 23, .box_h = 37, .ofs_x = 1, .ofs_y = -11},
+    {.bitmap_index = 27234, .adv_w = 427, .box_w = 22, .box_h = 35, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 27619, .adv_w = 171, .box_w = 6, .box_h = 35, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 27724, .adv_w = 171, .box_w = 11, .box_h = 46, .ofs_x = -3, .ofs_y = -11},
+    {.bitmap_index = 27977, .adv_w = 384, .box_w = 22, .box_h = 35, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 28362, .adv_w = 171, .box_w = 6, .box_h = 35, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 28467, .adv_w = 640, .box_w = 35, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 28922, .adv_w = 427, .box_w = 22, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 29208, .adv_w = 427, .box_w = 25, .box_h = 27, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 29546, .adv_w = 427, .box_w = 23, .box_h = 36, .ofs_x = 2, .ofs_y = -10},
+    {.bitmap_index = 29960, .adv_w = 427, .box_w = 23, .box_h = 36, .ofs_x = 1, .ofs_y = -10},
+    {.bitmap_index = 30374, .adv_w = 256, .box_w = 15, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 30569, .adv_w = 384, .box_w = 22, .box_h = 27, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 30866, .adv_w = 213, .box_w = 13, .box_h = 34, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 31087, .adv_w = 427, .box_w = 22, .box_h = 26, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 31373, .adv_w = 384, .box_w = 24, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 31673, .adv_w = 555, .box_w = 35, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 32111, .adv_w = 384, .box_w = 24, .box_h = 26, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 32423, .adv_w = 384, .box_w = 24, .box_h = 36, .ofs_x = 0, .ofs_y = -11},
+    {.bitmap_index = 32855, .adv_w = 384, .box_w = 24, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 33155, .adv_w = 256, .box_w = 15, .box_h = 46, .ofs_x = 1, .ofs_y = -11},
+    {.bitmap_index = 33500, .adv_w = 200, .box_w = 5, .box_h = 46, .ofs_x = 4, .ofs_y = -11},
+    {.bitmap_index = 33615, .adv_w = 256, .box_w = 16, .box_h = 46, .ofs_x = 0, .ofs_y = -11},
+    {.bitmap_index = 33983, .adv_w = 448, .box_w = 25, .box_h = 8, .ofs_x = 2, .ofs_y = 13},
+    {.bitmap_index = 34083, .adv_w = 213, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 34083, .adv_w = 256, .box_w = 6, .box_h = 35, .ofs_x = 5, .ofs_y = -10},
+    {.bitmap_index = 34188, .adv_w = 427, .box_w = 23, .box_h = 45, .ofs_x = 2, .ofs_y = -10},
+    {.bitmap_index = 34706, .adv_w = 427, .box_w = 26, .box_h = 36, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 35174, .adv_w = 427, .box_w = 24, .box_h = 24, .ofs_x = 1, .ofs_y = 5},
+    {.bitmap_index = 35462, .adv_w = 427, .box_w = 27, .box_h = 35, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 35935, .adv_w = 200, .box_w = 5, .box_h = 46, .ofs_x = 4, .ofs_y = -11},
+    {.bitmap_index = 36050, .adv_w = 427, .box_w = 24, .box_h = 46, .ofs_x = 1, .ofs_y = -11},
+    {.bitmap_index = 36602, .adv_w = 256, .box_w = 14, .box_h = 6, .ofs_x = 1, .ofs_y = 29},
+    {.bitmap_index = 36644, .adv_w = 566, .box_w = 36, .box_h = 36, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 37292, .adv_w = 285, .box_w = 17, .box_h = 18, .ofs_x = 0, .ofs_y = 17},
+    {.bitmap_index = 37445, .adv_w = 427, .box_w = 21, .box_h = 22, .ofs_x = 3, .ofs_y = 1},
+    {.bitmap_index = 37676, .adv_w = 448, .box_w = 24, .box_h = 15, .ofs_x = 2, .ofs_y = 9},
+    {.bitmap_index = 37856, .adv_w = 256, .box_w = 14, .box_h = 5, .ofs_x = 1, .ofs_y = 10},
+    {.bitmap_index = 37891, .adv_w = 566, .box_w = 36, .box_h = 36, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 38539, .adv_w = 424, .box_w = 29, .box_h = 4, .ofs_x = -1, .ofs_y = 36},
+    {.bitmap_index = 38597, .adv_w = 307, .box_w = 15, .box_h = 14, .ofs_x = 2, .ofs_y = 21},
+    {.bitmap_index = 38702, .adv_w = 422, .box_w = 24, .box_h = 29, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 39050, .adv_w = 256, .box_w = 16, .box_h = 18, .ofs_x = 0, .ofs_y = 17},
+    {.bitmap_index = 39194, .adv_w = 256, .box_w = 16, .box_h = 19, .ofs_x = 0, .ofs_y = 16},
+    {.bitmap_index = 39346, .adv_w = 256, .box_w = 9, .box_h = 7, .ofs_x = 5, .ofs_y = 28},
+    {.bitmap_index = 39378, .adv_w = 442, .box_w = 21, .box_h = 35, .ofs_x = 3, .ofs_y = -10},
+    {.bitmap_index = 39746, .adv_w = 413, .box_w = 27, .box_h = 45, .ofs_x = 0, .ofs_y = -10},
+    {.bitmap_index = 40354, .adv_w = 256, .box_w = 6, .box_h = 5, .ofs_x = 5, .ofs_y = 15},
+    {.bitmap_index = 40369, .adv_w = 256, .box_w = 11, .box_h = 11, .ofs_x = 2, .ofs_y = -10},
+    {.bitmap_index = 40430, .adv_w = 256, .box_w = 10, .box_h = 18, .ofs_x = 2, .ofs_y = 17},
+    {.bitmap_index = 40520, .adv_w = 280, .box_w = 17, .box_h = 18, .ofs_x = 0, .ofs_y = 17},
+    {.bitmap_index = 40673, .adv_w = 427, .box_w = 21, .box_h = 22, .ofs_x = 3, .ofs_y = 1},
+    {.bitmap_index = 40904, .adv_w = 640, .box_w = 38, .box_h = 37, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 41607, .adv_w = 640, .box_w = 38, .box_h = 37, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 42310, .adv_w = 640, .box_w = 40, .box_h = 37, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 43050, .adv_w = 469, .box_w = 23, .box_h = 36, .ofs_x = 3, .ofs_y = -11},
+    {.bitmap_index = 43464, .adv_w = 512, .box_w = 33, .box_h = 44, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 44190, .adv_w = 512, .box_w = 33, .box_h = 44, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 44916, .adv_w = 512, .box_w = 33, .box_h = 44, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 45642, .adv_w = 512, .box_w = 33, .box_h = 42, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 46335, .adv_w = 512, .box_w = 33, .box_h = 42, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 47028, .adv_w = 512, .box_w = 33, .box_h = 42, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 47721, .adv_w = 768, .box_w = 46, .box_h = 35, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 48526, .adv_w = 555, .box_w = 31, .box_h = 45, .ofs_x = 2, .ofs_y = -10},
+    {.bitmap_index = 49224, .adv_w = 512, .box_w = 27, .box_h = 44, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 49818, .adv_w = 512, .box_w = 27, .box_h = 44, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 50412, .adv_w = 512, .box_w = 27, .box_h = 44, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 51006, .adv_w = 512, .box_w = 27, .box_h = 42, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 51573, .adv_w = 213, .box_w = 10, .box_h = 44, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 51793, .adv_w = 213, .box_w = 9, .box_h = 44, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 51991, .adv_w = 213, .box_w = 16, .box_h = 44, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 52343, .adv_w = 213, .box_w = 14, .box_h = 42, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 52637, .adv_w = 555, .box_w = 34, .box_h = 35, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 53232, .adv_w = 555, .box_w = 28, .box_h = 42, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 53820, .adv_w = 597, .box_w = 34, .box_h = 45, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 54585, .adv_w = 597, .box_w = 34, .box_h = 45, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 55350, .adv_w = 597, .box_w = 34, .box_h = 45, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 56115, .adv_w = 597, .box_w = 34, .box_h = 43, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 56846, .adv_w = 597, .box_w = 34, .box_h = 43, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 57577, .adv_w = 448, .box_w = 21, .box_h = 22, .ofs_x = 3, .ofs_y = 6},
+    {.bitmap_index = 57808, .adv_w = 597, .box_w = 34, .box_h = 38, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 58454, .adv_w = 555, .box_w = 28, .box_h = 45, .ofs_x = 3, .ofs_y = -1},
+    {.bitmap_index = 59084, .adv_w = 555, .box_w = 28, .box_h = 45, .ofs_x = 3, .ofs_y = -1},
+    {.bitmap_index = 59714, .adv_w = 555, .box_w = 28, .box_h = 45, .ofs_x = 3, .ofs_y = -1},
+    {.bitmap_index = 60344, .adv_w = 555, .box_w = 28, .box_h = 43, .ofs_x = 3, .ofs_y = -1},
+    {.bitmap_index = 60946, .adv_w = 512, .box_w = 32, .box_h = 44, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 61650, .adv_w = 512, .box_w = 28, .box_h = 35, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 62140, .adv_w = 469, .box_w = 26, .box_h = 36, .ofs_x = 3, .ofs_y = -1},
+    {.bitmap_index = 62608, .adv_w = 427, .box_w = 24, .box_h = 36, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 63040, .adv_w = 427, .box_w = 24, .box_h = 36, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 63472, .adv_w = 427, .box_w = 24, .box_h = 36, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 63904, .adv_w = 427, .box_w = 24, .box_h = 35, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 64324, .adv_w = 427, .box_w = 24, .box_h = 36, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 64756, .adv_w = 427, .box_w = 24, .box_h = 37, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 65200, .adv_w = 683, .box_w = 41, .box_h = 27, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 65754, .adv_w = 384, .box_w = 23, .box_h = 36, .ofs_x = 1, .ofs_y = -10},
+    {.bitmap_index = 66168, .adv_w = 427, .box_w = 24, .box_h = 36, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 66600, .adv_w = 427, .box_w = 24, .box_h = 36, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 67032, .adv_w = 427, .box_w = 24, .box_h = 36, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 67464, .adv_w = 427, .box_w = 24, .box_h = 36, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 67896, .adv_w = 213, .box_w = 10, .box_h = 35, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 68071, .adv_w = 213, .box_w = 9, .box_h = 35, .ofs_x = 4, .ofs_y = 0},
+    {.bitmap_index = 68229, .adv_w = 213, .box_w = 16, .box_h = 35, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 68509, .adv_w = 213, .box_w = 14, .box_h = 35, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 68754, .adv_w = 427, .box_w = 24, .box_h = 36, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 69186, .adv_w = 427, .box_w = 22, .box_h = 35, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 69571, .adv_w = 427, .box_w = 25, .box_h = 36, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 70021, .adv_w = 427, .box_w = 25, .box_h = 36, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 70471, .adv_w = 427, .box_w = 25, .box_h = 36, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 70921, .adv_w = 427, .box_w = 25, .box_h = 35, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 71359, .adv_w = 427, .box_w = 25, .box_h = 36, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 71809, .adv_w = 422, .box_w = 24, .box_h = 20, .ofs_x = 1, .ofs_y = 7},
+    {.bitmap_index = 72049, .adv_w = 469, .box_w = 25, .box_h = 29, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 72412, .adv_w = 427, .box_w = 22, .box_h = 36, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 72808, .adv_w = 427, .box_w = 22, .box_h = 36, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 73204, .adv_w = 427, .box_w = 22, .box_h = 36, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 73600, .adv_w = 427, .box_w = 22, .box_h = 36, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 73996, .adv_w = 384, .box_w = 24, .box_h = 46, .ofs_x = 0, .ofs_y = -11},
+    {.bitmap_index = 74548, .adv_w = 427, .box_w = 23, .box_h = 45, .ofs_x = 2, .ofs_y = -10},
+    {.bitmap_index = 75066, .adv_w = 384, .box_w = 24, .box_h = 46, .ofs_x = 0, .ofs_y = -11}
+};
+
+static const lv_font_fmt_txt_cmap_t cmaps[] =
+{
+    {
+        .range_start = 32, .range_length = 95, .glyph_id_start = 1,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 160, .range_length = 96, .glyph_id_start = 96,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    }
+};
+
+static const lv_font_fmt_txt_dsc_t font_dsc = {
+    .glyph_bitmap = glyph_bitmap,
+    .glyph_dsc = glyph_dsc,
+    .cmaps = cmaps,
+    .kern_dsc = NULL,
+    .kern_scale = 0,
+    .cmap_num = 2,
+    .bpp = 4,
+    .kern_classes = 0,
+    .bitmap_format = 0,
+};
+
+extern const lv_font_t lv_font_montserrat_14;
+
+const lv_font_t Arial_48 = {
+    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
+    .line_height = 54,          /*The maximum line height required by the font*/
+    .base_line = 10,             /*Baseline measured from the bottom of the line*/
+    .subpx = LV_FONT_SUBPX_NONE,
+    .underline_position = -5,
+    .underline_thickness = 3,
+    .dsc = &font_dsc,          /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
+    .fallback = &lv_font_montserrat_14,
+    .user_data = NULL,
+};
+
+#endif /*#if ARIAL_48*/
@@ -0,0 +1,66 @@
+#pragma once
+
+// Tuoteluettelo flashilla: tuotenumeron mukaan järjestetty taulukko kiinteän
+// kokoisia tietueita. Muutokset tuodaan erotustiedostoina (lisäys/poisto/päivitys),
+// jotka yhdistetään taustalla uuteen tiedostoon ja vaihdetaan voimaan rename-kutsulla.
+// Tietueiden CRC tarkistetaan avattaessa; edellinen luettelo säilyy tiedostona
+// catalog.idx.prev, ja siihen palataan, jos nykyinen on rikki.
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define CATALOG_NAME_LEN 24
+
+struct catalog_item_t {
+    uint32_t id;
+    int32_t price_cents;
+    char name[CATALOG_NAME_LEN]; // UTF-8, ei välttämättä nollapäätteinen
+};
+
+// catalog.idx: otsake + count kpl catalog_item_t (id nousevassa järjestyksessä)
+struct catalog_header_t {
+    char magic[4];       // "KCI1"
+    uint32_t version;
+    uint32_t count;
+    uint32_t crc;        // Tietueiden CRC32
+};
+
+enum catalog_op_t : uint32_t {
+    CATALOG_OP_REMOVE = 0,
+    CATALOG_OP_UPSERT = 1, // Lisäys tai päivitys
+};
+
+// Erotustiedosto: otsake + op_count kpl catalog_delta_op_t (id nousevassa järjestyksessä)
+struct catalog_delta_header_t {
+    char magic[4];       // "KCD1"
+    uint32_t base_version; // Versio, johon erotus sovelletaan (0 = tyhjä luettelo)
+    uint32_t new_version;
+    uint32_t op_count;
+    uint32_t crc;        // Operaatioiden CRC32
+};
+
+struct catalog_delta_op_t {
+    uint32_t op;         // catalog_op_t
+    catalog_item_t item; // Poistossa vain id on merkitsevä
+};
+
+struct catalog_apply_stats_t {
+    uint32_t ops;
+    uint32_t items;          // Tuotteita uudessa luettelossa
+    uint32_t bytes_read;
+    uint32_t bytes_written;  // Flashille kirjoitettu määrä
+    uint32_t duration_us;
+};
+
+// file_name kiosk_fs-hakemistossa; toisto (sim_main --replay) avaa tallennuksen luettelon omalla nimellään
+bool catalog_begin(const char *file_name = "catalog.idx");
+uint32_t catalog_version();
+uint32_t catalog_count();
+uint32_t catalog_crc();  // Otsakkeen tietueiden CRC32, 0 ilman luetteloa
+bool catalog_lookup(uint32_t id, catalog_item_t *out);
+
+// Soveltaa erotuksen ja vaihtaa uuden luettelon voimaan. Vanha pysyy käytössä virhetilanteessa.
+bool catalog_apply_delta(const char *delta_path, catalog_apply_stats_t *stats = NULL);
+
+// Kysyy taustajärjestelmältä erotusta nykyisestä versiosta ja soveltaa sen (sync-tehtävästä)
+bool catalog_update_check();
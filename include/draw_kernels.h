@@ -0,0 +1,81 @@
+#pragma once
+
+// RGB565-täyttö ja -sekoitus LVGL:n ohjelmistopiirtoon (LV_USE_DRAW_SW_ASM_CUSTOM,
+// ks. lv_conf.h). LVGL sisällyttää tämän tiedoston lv_draw_sw_blend_to_rgb565.c:hen,
+// ja alla olevat makrot korvaavat sen värin täyttösilmukat:
+//
+//   täyttö          peittävä väri (taustat, reunat)
+//   täyttö + opa    läpikuultava väri
+//   täyttö + maski  A8-maski: kirjainten kuvat ja pyöristetyt kulmat
+//   maski + opa     edellinen läpikuultavana
+//
+// A4-kirjasimet LVGL purkaa A8-maskiksi ennen sekoitusta, joten kirjaimet kulkevat
+// maskiversioiden kautta. Tulos on bitilleen sama kuin LVGL:n lv_color_16_16_mix():llä
+// (draw_kernels_check(): native --kernel-check ja laitteella KIOSK_KERNEL_CHECK=1).
+// ESP32-S3:lla kaikki neljä riviä käyttävät PIE-vektorikäskyjä (src/draw_kernels_pie.S),
+// native-ympäristössä SSE4.1 tai NEON. Kuvien sekoitus ja kirjainten A4-purku jäävät
+// LVGL:n omiksi silmukoiksi. Jos ydin palauttaa false, LVGL käyttää omaa silmukkaansa.
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// dest_stride ja mask_stride tavuina kuten LVGL:ssä
+bool draw_fill_rgb565(uint16_t *dest, int32_t w, int32_t h, int32_t dest_stride, uint16_t color);
+bool draw_fill_rgb565_opa(uint16_t *dest, int32_t w, int32_t h, int32_t dest_stride, uint16_t color,
+                          uint8_t opa);
+bool draw_fill_rgb565_mask(uint16_t *dest, int32_t w, int32_t h, int32_t dest_stride, uint16_t color,
+                           const uint8_t *mask, int32_t mask_stride);
+bool draw_fill_rgb565_mask_opa(uint16_t *dest, int32_t w, int32_t h, int32_t dest_stride, uint16_t color,
+                               const uint8_t *mask, int32_t mask_stride, uint8_t opa);
+
+// Rivikohtaiset toteutukset. Oletus on ESP32-S3:lla PIE, muuten C; native-ympäristö
+// valitsee suorittimen mukaan SSE4.1- tai NEON-version (src/native/draw_kernels_simd.h).
+typedef struct {
+    const char *name;
+    void (*fill)(uint16_t *dest, int32_t w, uint16_t color);
+    void (*opa)(uint16_t *dest, int32_t w, uint16_t color, uint8_t opa);
+    void (*mask)(uint16_t *dest, int32_t w, uint16_t color, const uint8_t *mask);
+    void (*mask_opa)(uint16_t *dest, int32_t w, uint16_t color, const uint8_t *mask, uint8_t opa);
+} draw_row_kernels_t;
+
+const draw_row_kernels_t *draw_kernels_default(void);
+const draw_row_kernels_t *draw_kernels_c(void);
+// NULL palauttaa oletuksen
+void draw_kernels_use(const draw_row_kernels_t *k);
+// Käytössä oleva toteutus tulosteisiin ("pie", "c", "sse4.1", "neon")
+const char *draw_kernels_name(void);
+
+// Satunnaiset alueet, rivivälit, maskit ja peittävyydet kullakin toteutuksella bitilleen
+// lv_color_16_16_mix():tä vastaan, sitten nopeus bench_w x bench_h -alueella viitesilmukkaan
+// verrattuna (src/draw_kernels_check.cpp). Palauttaa erojen määrän; jättää oletuksen käyttöön.
+uint32_t draw_kernels_check(const draw_row_kernels_t *const *impls, int count, uint32_t cases, int32_t bench_w,
+                            int32_t bench_h);
+
+#ifdef __cplusplus
+}
+#endif
+
+// LVGL:n koukut (lv_draw_sw_blend_fill_dsc_t tunnetaan sisällyttävässä tiedostossa)
+#define DRAW_KERNEL_RESULT(ok) ((ok) ? LV_RESULT_OK : LV_RESULT_INVALID)
+
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB565(dsc) \
+    DRAW_KERNEL_RESULT(draw_fill_rgb565((uint16_t *)(dsc)->dest_buf, (dsc)->dest_w, (dsc)->dest_h, \
+                                       (dsc)->dest_stride, lv_color_to_u16((dsc)->color)))
+
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB565_WITH_OPA(dsc) \
+    DRAW_KERNEL_RESULT(draw_fill_rgb565_opa((uint16_t *)(dsc)->dest_buf, (dsc)->dest_w, (dsc)->dest_h, \
+                                           (dsc)->dest_stride, lv_color_to_u16((dsc)->color), (dsc)->opa))
+
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB565_WITH_MASK(dsc) \
+    DRAW_KERNEL_RESULT(draw_fill_rgb565_mask((uint16_t *)(dsc)->dest_buf, (dsc)->dest_w, (dsc)->dest_h, \
+                                            (dsc)->dest_stride, lv_color_to_u16((dsc)->color), \
+                                            (dsc)->mask_buf, (dsc)->mask_stride))
+
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB565_MIX_MASK_OPA(dsc) \
+    DRAW_KERNEL_RESULT(draw_fill_rgb565_mask_opa((uint16_t *)(dsc)->dest_buf, (dsc)->dest_w, (dsc)->dest_h, \
+                                                (dsc)->dest_stride, lv_color_to_u16((dsc)->color), \
+                                                (dsc)->mask_buf, (dsc)->mask_stride, (dsc)->opa))
@@ -0,0 +1,34 @@
+#pragma once
+
+// Ohjelmistopiirron laskurit. lv_draw_sw_mask_radius_init() kääritään linkittäessä
+// (-Wl,--wrap, ks. platformio.ini): jokainen kutsu lasketaan, ja jos säde ei ole
+// LVGL:n ympyrävälimuistissa (LV_DRAW_SW_CIRCLE_CACHE_SIZE), ympyrä lasketaan
+// uudelleen ja kutsu lasketaan hudiksi.
+
+#include <stdint.h>
+#include <lvgl.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    uint32_t frames;              // Ruutuja, joissa piirrettiin jotain
+    uint32_t mask_inits;          // Pyöreän kulman maskeja yhteensä
+    uint32_t mask_misses;         // Joista ympyrä laskettiin uudelleen
+    uint32_t last_frame_inits;
+    uint32_t last_frame_misses;
+    uint32_t max_frame_misses;
+    uint32_t cache_entries;       // Välimuistin paikkoja käytössä / LV_DRAW_SW_CIRCLE_CACHE_SIZE
+    uint32_t cache_bytes;         // Arvio välimuistin puskureista (r * 6 + 6 tavua / säde)
+} draw_stats_t;
+
+// Ruutukohtaiset laskurit näytön RENDER_START/RENDER_READY-tapahtumista
+void draw_stats_attach(lv_display_t *disp);
+void draw_stats_get(draw_stats_t *out);
+void draw_stats_reset(void);
+void draw_stats_print(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,21 @@
+#pragma once
+
+// HTTP-kuljetus synkronoinnille ja luettelopäivityksille. Laitteella HTTPClient, nativessa POSIX-socketit.
+
+#include <stdint.h>
+#include <stddef.h>
+
+bool net_is_up();
+// Lepotila (kiosk_idle.h): radio pois ennen kevyttä unta ja takaisin herätessä; yhteys
+// muodostuu taustalla. net_resume() palauttaa false, jos WiFiä ei ole määritetty.
+void net_suspend();
+bool net_resume();
+
+// Palauttaa HTTP-tilakoodin tai negatiivisen arvon, jos yhteys epäonnistui.
+// content_encoding (esim. "deflate") tai NULL, jos runko on pakkaamaton.
+int http_post(const char *url, const char *content_type, const char *content_encoding,
+              const char *idempotency_key, const uint8_t *body, size_t len, uint32_t timeout_ms);
+
+// Hakee rungon tiedostoon (vain tilalla 200). Palauttaa HTTP-tilan tai <0; -5 = kirjoitus
+// epäonnistui (esim. tiedostojärjestelmä täynnä), jolloin osittainen tiedosto poistetaan.
+int http_get_file(const char *url, const char *path, uint32_t timeout_ms);
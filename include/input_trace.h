@@ -0,0 +1,49 @@
+#pragma once
+
+// Syötteiden tallennus ja toisto. Laitteella kosketuksen tilamuutokset ja luetut
+// viivakoodit kirjoitetaan aikaleimoineen tiedostoon; native-build toistaa
+// tiedoston simuloidulla kellolla (sim_main --replay), jolloin käyttäjän istunnon
+// voi ajaa uudelleen ja profiloida Linuxissa.
+//
+// Tiedosto: input_trace_header_t + input_event_t-tietueita. Koordinaatit ovat
+// loogisia (kierron jälkeen, kuten LVGL ne näkee), joten toisto ei riipu paneelista.
+// Viivakoodien tulos riippuu tuoteluettelosta, joten otsake tunnistaa tallennushetken
+// luettelon (versio, määrä, CRC); toisto kieltäytyy, jos sen luettelo on eri.
+
+#include <stdint.h>
+
+#define INPUT_TRACE_FILE "input.trc"
+#define INPUT_TRACE_MAGIC "KIT2"
+
+enum input_event_type_t : uint8_t {
+    INPUT_EV_TOUCH = 1,
+    INPUT_EV_SCAN = 2,
+};
+
+struct input_trace_header_t {
+    char magic[4];
+    uint16_t hor_res;      // Looginen resoluutio tallennushetkellä
+    uint16_t ver_res;
+    uint32_t catalog_version; // catalog.h; 0 = ei luetteloa
+    uint32_t catalog_count;
+    uint32_t catalog_crc;
+};
+
+struct input_event_t {
+    uint32_t t_ms;         // Millisekunteja tallennuksen alusta (lv_tick_get)
+    uint8_t type;          // input_event_type_t
+    uint8_t pressed;       // INPUT_EV_TOUCH: 1 = painettu
+    int16_t x;
+    int16_t y;
+    uint16_t reserved;
+    uint32_t code;         // INPUT_EV_SCAN: tuotekoodi
+};
+
+// Kääritään kaikkien osoitinlaitteiden read_cb; kutsu kun näyttö ja tiedostojärjestelmä ovat valmiina
+bool input_trace_start(const char *file_name = INPUT_TRACE_FILE);
+void input_trace_stop();
+bool input_trace_active();
+// Viivakoodi luettu (kutsutaan ui_scan():sta)
+void input_trace_scan(uint32_t code);
+// Kirjoittaa puskurin flashille INPUT_TRACE_FLUSH_MS välein; kutsutaan loop():sta
+void input_trace_poll();
@@ -0,0 +1,124 @@
+#pragma once
+
+// Kioskin asetukset. Kaikki arvot voi ohittaa build_flags-riveillä (-D ...)
+
+// WLAN-yhteys (tyhjä SSID = ei yhteyttä, tapahtumat jäävät jonoon)
+#ifndef KIOSK_WIFI_SSID
+#define KIOSK_WIFI_SSID ""
+#endif
+#ifndef KIOSK_WIFI_PASSWORD
+#define KIOSK_WIFI_PASSWORD ""
+#endif
+
+// Taustajärjestelmä, jolle tapahtumat synkronoidaan
+#ifndef KIOSK_BACKEND_URL
+#define KIOSK_BACKEND_URL "http://192.168.1.10:8080"
+#endif
+#ifndef KIOSK_DEVICE_ID
+#define KIOSK_DEVICE_ID "kiosk-01"
+#endif
+
+// Sarjaportti: lokit, klog-vedos (tools/klog_decode.py). Profiloijaympäristöt käyttävät
+// suurempaa nopeutta jälkien takia (platformio.ini, include/profiler_export.h).
+#ifndef KIOSK_SERIAL_BAUD
+#define KIOSK_SERIAL_BAUD 115200
+#endif
+
+// Tapahtumajono
+#define TXQ_MAX_RECORDS      50000   // Enimmäismäärä kuittaamattomia tapahtumia flashilla
+#define TXQ_COMPACT_BYTES    (16 * 1024) // Tyhjennetään loki, kun kaikki on kuitattu ja koko ylittää tämän
+
+// Synkronointi
+#define SYNC_BATCH_MAX       256     // Tapahtumia yhdessä lähetyksessä
+#define SYNC_POLL_MS         2000    // Kuinka usein jonoa tarkistetaan
+#define SYNC_BACKOFF_MIN_MS  1000    // Ensimmäinen uusintayritys
+#define SYNC_BACKOFF_MAX_MS  60000   // Pisin odotus uusintayritysten välillä
+#define SYNC_HTTP_TIMEOUT_MS 5000
+#define SYNC_TASK_STACK      8192
+#define SYNC_TASK_PRIO       1
+#define SYNC_TASK_CORE       0       // Arduino loop() ja LVGL pyörivät ytimellä 1
+// Erä deflatella (Content-Encoding: deflate), kun se on vähintään näin suuri ja pakattuna
+// pienempi (ks. sync.cpp); yksittäinen tapahtuma kasvaisi zlib-otsakkeen verran
+#ifndef SYNC_DEFLATE_MIN_BYTES
+#define SYNC_DEFLATE_MIN_BYTES 128   // 0 = ei pakkausta
+#endif
+
+// Tuoteluettelon erotuspäivitykset (haetaan sync-tehtävässä)
+#define CATALOG_POLL_MS      (15 * 60 * 1000)
+
+// Syötteiden tallennus (kosketus + viivakoodit) tiedostoon toistoa varten (src/native: --replay)
+#ifndef INPUT_TRACE_RECORD
+#define INPUT_TRACE_RECORD   0       // 1 = tallennus käynnistyy bootissa
+#endif
+#define INPUT_TRACE_MAX_BYTES (512 * 1024) // Tallennus pysähtyy tähän kokoon
+#define INPUT_TRACE_FLUSH_MS 1000    // Puskurin kirjoitus flashille
+
+// Ylläpitonäkymä avataan napauttamalla päänäkymän kehotetta ADMIN_TAPS kertaa
+// ADMIN_TAP_WINDOW_MS:n sisällä (pitkä painallus on suorituskykyruutu)
+#define ADMIN_TAPS           5
+#define ADMIN_TAP_WINDOW_MS  3000
+
+// Nopea tila: painikkeiden teemasiirtymät ja kasvuanimaatio pois (vaihdettavissa ylläpitonäkymästä,
+// valinta säilyy tiedostossa kiosk_fs/snappy)
+#ifndef KIOSK_SNAPPY_DEFAULT
+#define KIOSK_SNAPPY_DEFAULT 0
+#endif
+
+// Piirtoytimien tarkistus laitteella (draw_kernels.h): C ja PIE bitilleen lv_color_16_16_mix():tä
+// vastaan ja nopeus sarjaporttiin bootissa, ks. platformio.ini env:esp32-8048S043C-kernel-check
+#ifndef KIOSK_KERNEL_CHECK
+#define KIOSK_KERNEL_CHECK 0
+#endif
+#define KIOSK_KERNEL_CHECK_CASES 20000
+#define KIOSK_KERNEL_BENCH_ROWS  80      // Nopeus 480 x 80 -alueella (SRAM, kuten piirtopuskuri)
+
+// Päänäkymän tilapainikkeet esipiirrettyinä kuvina (PSRAM), ks. ui_prerender.h
+#ifndef KIOSK_PRERENDER_BUTTONS
+#define KIOSK_PRERENDER_BUTTONS 0
+#endif
+
+// Arial ajonaikaisesti TTF:stä (ui_font_ttf.h, vain -D KIOSK_TINY_TTF=1)
+#ifndef KIOSK_TTF_UI
+#define KIOSK_TTF_UI 0               // 1 = käyttöliittymän fontit TTF:stä, ui_fonts.c pois käännöksestä
+#endif
+#ifndef KIOSK_TTF_POOL_KB
+#define KIOSK_TTF_POOL_KB 1024       // Glyfivälimuistin pooli PSRAMista: 70 px glyfi A8:na ~3,5 kt
+#endif
+#ifndef KIOSK_TTF_PATH
+#define KIOSK_TTF_PATH "fonts/arial.ttf" // Native: luetaan työhakemistosta
+#endif
+
+// Assets-osio (ui_assets.h): fontit ja kuvat omalla LittleFS-osiollaan, partitions_assets.csv
+#ifndef KIOSK_ASSET_FONTS
+#define KIOSK_ASSET_FONTS 0          // 1 = käyttöliittymän fontit osiolta, ui_fonts.c pois käännöksestä
+#endif
+#define KIOSK_ASSETS_PARTITION "assets"
+#define KIOSK_ASSET_POOL_KB  256     // LVGL:n kekoon PSRAMista ladatuille fonteille (4 kokoa ~155 kt)
+
+// Käyttöliittymän fontit välittäjinä (ui_font_proxy.h), kun fontti tulee ajonaikaisesti
+#define KIOSK_FONT_PROXY (KIOSK_TTF_UI || KIOSK_ASSET_FONTS)
+
+// Lepotila (kiosk_idle.h): himmennys ja kevyt uni, kun kosketusta tai viivakoodia ei tule
+#define IDLE_DIM_MS          30000   // Jouto, jonka jälkeen taustavalo himmennetään
+#define IDLE_DIM_LEVEL       0.15f   // Himmennetty taustavalo (0..1)
+#define IDLE_SLEEP_MS        120000  // Jouto, jonka jälkeen piirto pysäytetään ja nukutaan
+#define IDLE_WAKE_PERIOD_MS  60000   // Ajastinherätys unen aikana synkronointia varten
+#define IDLE_HOUSEKEEPING_MS 3000    // Valveilla ajastinherätyksen jälkeen ennen uutta unta, kun verkko on ylhäällä
+#define IDLE_NET_WAIT_MS     10000   // Enintään näin kauan odotetaan WiFi-yhteyttä herätyksen jälkeen
+#ifndef KIOSK_TOUCH_WAKE_GPIO
+#define KIOSK_TOUCH_WAKE_GPIO   18   // GT911:n INT (esp32-8048S043C), -1 = ei kosketusherätystä
+#endif
+#ifndef KIOSK_SCANNER_WAKE_GPIO
+#define KIOSK_SCANNER_WAKE_GPIO -1   // Lukijan UART RX tai herätyslinja, -1 = ei käytössä
+#endif
+// Virrankulutus tiloittain penkiltä mitattuna (mA). Arvio tilojen osuuksilla painotettuna
+// tulostetaan vasta, kun kaikki kolme on asetettu (build_flags)
+#ifndef IDLE_MA_ACTIVE
+#define IDLE_MA_ACTIVE       0
+#endif
+#ifndef IDLE_MA_DIM
+#define IDLE_MA_DIM          0
+#endif
+#ifndef IDLE_MA_SLEEP
+#define IDLE_MA_SLEEP        0
+#endif
@@ -0,0 +1,53 @@
+#pragma once
+
+// Lepotila. loop() kysyy joka kierroksella kiosk_idle_poll():lta, piirretäänkö:
+//
+//   ACTIVE --jouto IDLE_DIM_MS--> DIM --jouto IDLE_SLEEP_MS, jono tyhjä--> SLEEP
+//   DIM/SLEEP --kosketus tai viivakoodi--> ACTIVE
+//
+// Jouto on LVGL:n lv_display_get_inactive_time(), eli osoitinlaitteen tai
+// lv_display_trigger_activity():n edellinen aktiivisuus. SLEEP-tilassa LVGL:ää ei
+// ajeta, taustavalo on pois ja prosessori on kevyessä unessa (esp_light_sleep_start),
+// josta herättää kosketusohjaimen INT, lukijan linja tai IDLE_WAKE_PERIOD_MS-
+// ajastin. WiFi katkaistaan unen ajaksi (net_suspend) ja yhdistetään herätessä;
+// ajastinherätyksen jälkeen odotetaan yhteyttä enintään IDLE_NET_WAIT_MS, minkä
+// jälkeen sync-tehtävä saa IDLE_HOUSEKEEPING_MS aikaa ennen uutta unta. Uneen ei
+// mennä kesken sync-tehtävän pyynnön (sync_sleep_begin, sync.h).
+//
+// Kuvapuskuri säilyy PSRAM:ssa unen yli, joten herätessä piirretään vain unen
+// aikana likaantuneet alueet ja taustavalo sytytetään vasta sen jälkeen. Aika
+// herätyksen havaitsemisesta taustavaloon tallentuu tilastoihin.
+
+#include <lvgl.h>
+#include <stdint.h>
+
+enum kiosk_idle_state_t {
+    KIOSK_IDLE_ACTIVE,
+    KIOSK_IDLE_DIM,
+    KIOSK_IDLE_SLEEP,
+    KIOSK_IDLE_STATE_COUNT
+};
+
+enum kiosk_idle_wake_t {
+    KIOSK_WAKE_TOUCH = 1,
+    KIOSK_WAKE_SCANNER = 2,
+    KIOSK_WAKE_SOFTWARE = 3,   // kiosk_idle_wake()
+};
+
+struct kiosk_idle_stats_t {
+    uint32_t state_ms[KIOSK_IDLE_STATE_COUNT]; // Aika tiloittain käynnistyksestä
+    uint32_t sleeps;           // Kevyitä unia (myös ajastinherätysten jälkeiset)
+    uint32_t wakes;            // Herätyksiä takaisin ACTIVE-tilaan
+    uint32_t wake_us_last;     // Herätys -> ensimmäinen ruutu valmis ja taustavalo päällä
+    uint32_t wake_us_max;
+};
+
+void kiosk_idle_begin(lv_display_t *disp);
+// false = SLEEP-tilassa, loop() ei aja LVGL:ää eikä tyhjennä ui_queue-jonoa
+bool kiosk_idle_poll();
+// Herättää mistä tehtävästä tahansa (esim. lukijan ajuri ennen ui_queue-viestiä)
+void kiosk_idle_wake();
+kiosk_idle_state_t kiosk_idle_state();
+
+void kiosk_idle_get_stats(kiosk_idle_stats_t *out);
+void kiosk_idle_print_stats();
@@ -0,0 +1,31 @@
+#pragma once
+
+// Kioskin tila (Otto/Palautus) LVGL:n observer-subjektina. Painikkeet ja label
+// sidotaan subjektiin, joten tilan muutos päivittää vain ne oliot, joiden ulkoasu
+// oikeasti muuttuu. Uusi tila = uusi rivi taulukkoon, ei uusia tapahtumakäsittelijöitä.
+
+#include <lvgl.h>
+#include "ui_gen.h"
+
+enum kiosk_mode_t {
+    KIOSK_MODE_OTTO = 0,
+    KIOSK_MODE_PALAUTUS = 1,
+    KIOSK_MODE_COUNT
+};
+
+struct kiosk_mode_info_t {
+    ui_str_t button_text;
+    ui_str_t prompt;         // Yläreunan label tässä tilassa
+};
+
+extern const kiosk_mode_info_t kiosk_modes[KIOSK_MODE_COUNT];
+extern lv_subject_t kiosk_mode_subject;
+
+void kiosk_mode_init(kiosk_mode_t initial);
+kiosk_mode_t kiosk_mode_get();
+void kiosk_mode_set(kiosk_mode_t mode);
+
+// Painike on LV_STATE_CHECKED, kun tila == mode; painallus asettaa tilan
+void kiosk_mode_bind_button(lv_obj_t *btn, kiosk_mode_t mode);
+// Labelin teksti seuraa tilan kehotetta nykyisellä kielellä (ui_lang.h)
+void kiosk_mode_bind_prompt(lv_obj_t *label);
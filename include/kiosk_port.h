@@ -0,0 +1,40 @@
+#pragma once
+
+// Pieni alustakerros, jotta samat moduulit kääntyvät sekä laitteelle (ARDUINO)
+// että Linuxin native-ympäristöön.
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef ARDUINO
+#include <esp_attr.h>
+#define KIOSK_FS_ROOT "/littlefs"  // LittleFS on liitetty VFS:ään, joten stdio toimii
+#define KIOSK_RETAINED RTC_NOINIT_ATTR // Säilyy uudelleenkäynnistyksen yli, ei nollata
+#else
+#define KIOSK_FS_ROOT "kiosk_fs"   // Native: hakemisto työhakemiston alla
+#define KIOSK_RETAINED
+#endif
+
+// Tiedostopolku tiedostojärjestelmän juuren alle
+void kiosk_fs_path(char *out, size_t out_size, const char *name);
+bool kiosk_fs_begin();
+
+// true, jos edellinen ajo päättyi ohjelmalliseen käynnistykseen, paniikkiin tai
+// vahtikoiraan, jolloin KIOSK_RETAINED-muuttujissa on sen tila. Nativessa aina false.
+bool kiosk_warm_reset();
+
+uint32_t kiosk_crc32(const void *data, size_t len, uint32_t crc = 0);
+
+// Iso puskuri: laitteella PSRAM (board_build.psram), nativessa malloc
+void *kiosk_psram_alloc(size_t size);
+void kiosk_psram_free(void *p);
+// PSRAM:n käyttö tavuina; nativessa 0 / 0
+void kiosk_psram_usage(size_t *used, size_t *total);
+
+uint64_t kiosk_time_us();
+uint32_t kiosk_time_ms();
+void kiosk_delay_ms(uint32_t ms);
+
+// Taustatehtävä. Laitteella FreeRTOS-tehtävä kiinnitettynä ytimeen, nativessa säie.
+typedef void (*kiosk_task_fn_t)(void *arg);
+bool kiosk_task_start(kiosk_task_fn_t fn, const char *name, uint32_t stack, int prio, int core, void *arg);
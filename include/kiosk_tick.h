@@ -0,0 +1,18 @@
+#pragma once
+
+// LVGL:n aikalähde (lv_tick_set_cb). Laitteella reaaliaikainen kello, native-
+// testeissä ja mittauksissa simuloitu kello, joka etenee vain kiosk_tick_advance():
+// animaatiot ja siirtymät etenevät samoin joka ajolla ja niin nopeasti kuin CPU ehtii.
+
+#include <stdint.h>
+
+typedef uint32_t (*kiosk_tick_source_t)();
+
+void kiosk_tick_use(kiosk_tick_source_t source);
+void kiosk_tick_use_real();                 // kiosk_time_ms()
+void kiosk_tick_use_sim(uint32_t start_ms = 0);
+bool kiosk_tick_is_sim();
+
+// Simuloitu kello: siirtää aikaa eteenpäin (ei vaikutusta reaaliaikaiseen lähteeseen)
+void kiosk_tick_advance(uint32_t ms);
+uint32_t kiosk_tick_sim_now();
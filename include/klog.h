@@ -0,0 +1,62 @@
+#pragma once
+
+// Binääriloki: rengaspuskuri kiinteän kokoisia merkintöjä (aika, tapahtuma,
+// 3 x 32-bittinen argumentti). Kirjoitus on muutama muistiin tallennus ilman
+// muotoilua, joten loki voi olla päällä tuotannossa. Tapahtumat ja niiden
+// tekstit ovat tiedostossa klog_events.h; tools/klog_decode.py muotoilee
+// puretun lokin. Sama tapahtuma kirjataan enintään KLOG_RATE_PER_S kertaa
+// sekunnissa, ylimenevät lasketaan seuraavaan merkintään.
+//
+// Purku: klog_dump_console() tulostaa base64-rivejä ("@KLOG ...") sarjaporttiin,
+// klog_dump_file() kirjoittaa saman binäärinä. Konsolipurun pyytää sarjaportista
+// tavu KLOG_DUMP_REQUEST (tools/klog_decode.py --port lähettää sen) tai pitkä
+// painallus ylläpitonäkymän tietoihin. Kaatumisen yli säilyvät viimeiset
+// merkinnät post-mortem-alueella (postmortem.h).
+
+#include <stdint.h>
+#include "klog_events.h"
+
+#define KLOG_ENTRIES    1024          // Kahden potenssi; 20 tavua / merkintä
+#define KLOG_RATE_PER_S 20
+#define KLOG_MAGIC      "KLG1"
+#define KLOG_DUMP_REQUEST 'K'         // Sarjaportista: purku konsoliin (main.cpp loop)
+
+enum klog_event_t : uint16_t {
+#define KLOG_ENUM(name, fmt) KLOG_##name,
+    KLOG_EVENTS(KLOG_ENUM)
+#undef KLOG_ENUM
+    KLOG_EVENT_COUNT
+};
+
+struct klog_entry_t {
+    uint32_t t_ms;         // kiosk_time_ms()
+    uint16_t event;        // klog_event_t
+    uint16_t suppressed;   // Saman tapahtuman pudotetut edellisen merkinnän jälkeen
+    uint32_t args[3];
+};
+
+// Purun alku; perässä min(head, entries) merkintää vanhimmasta alkaen
+struct klog_header_t {
+    char magic[4];
+    uint16_t event_count;  // Tarkistus: klog_events.h sama kuin purkajalla
+    uint16_t entry_size;
+    uint32_t head;         // Merkintöjä kirjoitettu yhteensä
+    uint32_t entries;      // KLOG_ENTRIES
+    uint32_t dropped;      // Rajoittimen pudottamat yhteensä
+};
+
+void klog(klog_event_t ev, uint32_t a = 0, uint32_t b = 0, uint32_t c = 0);
+// 0 = ei rajoitusta (mittaukset)
+void klog_set_rate(uint32_t per_s);
+
+// Kopioi enintään max viimeisintä merkintää vanhimmasta alkaen, palauttaa määrän
+uint32_t klog_tail(klog_entry_t *out, uint32_t max);
+// Kopioi tästä eteenpäin jokaisen merkinnän myös renkaaseen buf (entries kahden potenssi,
+// *head = kirjoitettuja yhteensä). Post-mortem-alue (RTC-muisti) saa näin viimeiset
+// merkinnät ilman erillistä tallennusta, myös paniikissa ja vahtikoiran laukeaessa.
+void klog_mirror(klog_entry_t *buf, uint32_t entries, uint32_t *head);
+// Tapahtuman nimi klog_events.h:sta ("SCAN"); tekstit vain purkajalla
+const char *klog_event_name(uint16_t ev);
+
+void klog_dump_console();
+bool klog_dump_file(const char *path);
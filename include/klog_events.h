@@ -0,0 +1,29 @@
+#pragma once
+
+// Binäärilokin (klog.h) tapahtumat: X(nimi, "muoto"). Laitteelle päätyy vain
+// tapahtuman numero ja argumentit; tools/klog_decode.py lukee muodot tästä
+// tiedostosta ja muotoilee lokin Linuxissa. Enintään 3 argumenttia, %u / %d / %x.
+// Numero on järjestys listassa, joten uudet tapahtumat lisätään loppuun.
+
+#define KLOG_EVENTS(X) \
+    X(BOOT,           "käynnistys, LVGL-heap vapaana %u tavua") \
+    X(MODE,           "tila %u") \
+    X(SCREEN_SHOW,    "näkymä %u") \
+    X(SCREEN_BUILD,   "näkymä %u rakennettu, %u us, %u tavua") \
+    X(SCREEN_EVICT,   "näkymä %u poistettu, LVGL-heap vapaana %u tavua") \
+    X(SCAN,           "viivakoodi %u") \
+    X(SCAN_UNKNOWN,   "tuntematon tuote %u") \
+    X(TX_PUSH,        "tapahtuma %u jonoon, tuote %u, %d senttiä") \
+    X(TX_PUSH_FAIL,   "tapahtuman tallennus epäonnistui, tuote %u") \
+    X(SYNC_BATCH,     "erä %u-%u lähetetty, %u tavua") \
+    X(SYNC_FAIL,      "erä %u-%u epäonnistui: %d") \
+    X(CATALOG_UPDATE, "luettelo v%u: %u muutosta, %u ms") \
+    X(CATALOG_FAIL,   "luettelon päivitys epäonnistui (http %d)") \
+    X(DUMP,           "loki purettu, %u merkintää") \
+    X(POSTMORTEM,     "edellinen käynnistys päättyi: syy %u, käynnistys %u") \
+    X(POSTMORTEM_SENT, "post-mortem lähetetty, %u tavua") \
+    X(BOOT_READY,     "ensimmäinen ruutu %u ms käynnistyksestä, palautusyritys %u, näkymä %u") \
+    X(IDLE_SLEEP,     "lepotilaan, jouto %u ms") \
+    X(IDLE_WAKE,      "herätys (syy %u), ruutu %u us, nukuttu %u ms") \
+    X(CATALOG_RESTORED, "luettelo rikki, palattu edelliseen v%u") \
+    X(CATALOG_APPLY_FAIL, "luettelon erotuksen soveltaminen epäonnistui, v%u, %u tavua luettu")
@@ -170,13 +170,21 @@
         * The circumference of 1/4 circle are saved for anti-aliasing
         * radius * 4 bytes are used per circle (the most often used radiuses are saved)
         * 0: to disable caching */
-        #define LV_DRAW_SW_CIRCLE_CACHE_SIZE 4
+        /* Kiosk: sized from a memory budget instead of a fixed count. A cached circle takes
+         * about radius * 6 + 6 bytes of LVGL heap plus its descriptor. The buttons need
+         * r = 80 (160 px high, LV_RADIUS_CIRCLE) and r = 78 (inner edge of the 2 px border),
+         * and the press grow animation adds a few larger radii per press. With only 4 entries
+         * those evicted the steady-state radii; see src/draw_stats.c for the miss counters. */
+        #define KIOSK_CIRCLE_CACHE_BUDGET      (8 * 1024)
+        #define KIOSK_CIRCLE_CACHE_MAX_RADIUS  100
+        #define LV_DRAW_SW_CIRCLE_CACHE_SIZE   (KIOSK_CIRCLE_CACHE_BUDGET / (KIOSK_CIRCLE_CACHE_MAX_RADIUS * 6 + 6 + 32))
     #endif
 
-    #define  LV_USE_DRAW_SW_ASM     LV_DRAW_SW_ASM_NONE
+    /* Kiosk: RGB565 fill/blend kernels, PIE on the ESP32-S3 (include/draw_kernels.h) */
+    #define  LV_USE_DRAW_SW_ASM     LV_DRAW_SW_ASM_CUSTOM
 
     #if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_CUSTOM
-        #define  LV_DRAW_SW_ASM_CUSTOM_INCLUDE ""
+        #define  LV_DRAW_SW_ASM_CUSTOM_INCLUDE "draw_kernels.h"
     #endif
 
     /* Enable drawing complex gradients in software: linear at an angle, radial or conical */
@@ -317,8 +325,9 @@
 #define LV_USE_ASSERT_OBJ           0   /*Check the object's type and existence (e.g. not deleted). (Slow)*/
 
 /*Add a custom handler when assert happens e.g. to restart the MCU*/
-#define LV_ASSERT_HANDLER_INCLUDE <stdint.h>
-#define LV_ASSERT_HANDLER while(1);   /*Halt by default*/
+/* Kiosk: record the location in the post-mortem region and restart (include/postmortem.h) */
+#define LV_ASSERT_HANDLER_INCLUDE "postmortem_assert.h"
+#define LV_ASSERT_HANDLER postmortem_assert(__FILE__, __LINE__);
 
 /*-------------
  * Debug
@@ -710,11 +719,18 @@
 #endif
 
 /*API for open, read, etc*/
-#define LV_USE_FS_POSIX 0
+/* Kiosk: 'A' is the asset partition (include/ui_assets.h), mounted into VFS at /assets on the device.
+ * The Arduino LittleFS driver below only sees the global LittleFS, which is the data partition (kiosk_fs).
+ * The cache matters for lv_binfont_create(), which reads glyph headers one byte at a time. */
+#define LV_USE_FS_POSIX 1
 #if LV_USE_FS_POSIX
-    #define LV_FS_POSIX_LETTER '\0'     /*Set an upper cased letter on which the drive will accessible (e.g. 'A')*/
-    #define LV_FS_POSIX_PATH ""         /*Set the working directory. File/directory paths will be appended to it.*/
-    #define LV_FS_POSIX_CACHE_SIZE 0    /*>0 to cache this number of bytes in lv_fs_read()*/
+    #define LV_FS_POSIX_LETTER 'A'     /*Set an upper cased letter on which the drive will accessible (e.g. 'A')*/
+    #ifdef ARDUINO
+        #define LV_FS_POSIX_PATH "/assets/"
+    #else
+        #define LV_FS_POSIX_PATH "assets/"  /*Native: project directory*/
+    #endif
+    #define LV_FS_POSIX_CACHE_SIZE 512    /*>0 to cache this number of bytes in lv_fs_read()*/
 #endif
 
 /*API for CreateFile, ReadFile, etc*/
@@ -805,7 +821,12 @@
 #endif
 
 /* Built-in TTF decoder */
-#define LV_USE_TINY_TTF 0
+/* Kiosk: off by default, the TTF envs in platformio.ini build with -D KIOSK_TINY_TTF=1.
+ * include/ui_font_ttf.h creates the fonts from embedded TTF data and sizes the glyph cache. */
+#ifndef KIOSK_TINY_TTF
+    #define KIOSK_TINY_TTF 0
+#endif
+#define LV_USE_TINY_TTF KIOSK_TINY_TTF
 #if LV_USE_TINY_TTF
     /* Enable loading TTF data from files */
     #define LV_TINY_TTF_FILE_SUPPORT 0
@@ -844,7 +865,7 @@
  *==================*/
 
 /*1: Enable API to take snapshot for object*/
-#define LV_USE_SNAPSHOT 0
+#define LV_USE_SNAPSHOT 1
 
 /*1: Enable system monitor component*/
 #define LV_USE_SYSMON   0
@@ -873,29 +894,37 @@
 #endif /*LV_USE_SYSMON*/
 
 /*1: Enable the runtime performance profiler*/
-#define LV_USE_PROFILER 0
+/* Kiosk: off by default, the profile envs in platformio.ini build with -D KIOSK_PROFILER=1.
+ * The built-in profiler formats text lines in an LVGL timer, which stalled the UI on the
+ * 115200 UART. include/profiler_export.h records binary events into a ring buffer instead and
+ * a low-priority task sends them; tools/profiler_trace.py converts the output. */
+#ifndef KIOSK_PROFILER
+    #define KIOSK_PROFILER 0
+#endif
+#define LV_USE_PROFILER KIOSK_PROFILER
 #if LV_USE_PROFILER
     /*1: Enable the built-in profiler*/
-    #define LV_USE_PROFILER_BUILTIN 1
+    #define LV_USE_PROFILER_BUILTIN 0
     #if LV_USE_PROFILER_BUILTIN
         /*Default profiler trace buffer size*/
         #define LV_PROFILER_BUILTIN_BUF_SIZE (16 * 1024)     /*[bytes]*/
     #endif
 
     /*Header to include for the profiler*/
-    #define LV_PROFILER_INCLUDE "lvgl/src/misc/lv_profiler_builtin.h"
+    /* Kiosk: found through -I include, like LV_DRAW_SW_ASM_CUSTOM_INCLUDE */
+    #define LV_PROFILER_INCLUDE "profiler_export.h"
 
     /*Profiler start point function*/
-    #define LV_PROFILER_BEGIN    LV_PROFILER_BUILTIN_BEGIN
+    #define LV_PROFILER_BEGIN    PROFILER_EXPORT_BEGIN
 
     /*Profiler end point function*/
-    #define LV_PROFILER_END      LV_PROFILER_BUILTIN_END
+    #define LV_PROFILER_END      PROFILER_EXPORT_END
 
     /*Profiler start point function with custom tag*/
-    #define LV_PROFILER_BEGIN_TAG LV_PROFILER_BUILTIN_BEGIN_TAG
+    #define LV_PROFILER_BEGIN_TAG PROFILER_EXPORT_BEGIN_TAG
 
     /*Profiler end point function with custom tag*/
-    #define LV_PROFILER_END_TAG   LV_PROFILER_BUILTIN_END_TAG
+    #define LV_PROFILER_END_TAG   PROFILER_EXPORT_END_TAG
 #endif
 
 /*1: Enable Monkey test*/
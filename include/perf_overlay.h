@@ -0,0 +1,16 @@
+#pragma once
+
+// Suorituskykyruutu ylimmällä tasolla (lv_layer_top): FPS, piirto- ja siirtoaika
+// ruutua kohden, LVGL:n joutoaika (lv_timer_get_idle), LVGL-heap, PSRAM sekä jakson
+// kulmamaskit ruutua kohden, ympyröiden uudelleenlaskut ja välimuistin paikat (draw_stats.h).
+// Päivittyy kerran sekunnissa; kiinteän kokoinen tausta, joten päivitys piirtää
+// vain ruudun oman alueen. Päivitys näkyy itse yhtenä ruutuna sekunnissa.
+
+#include <lvgl.h>
+
+// Piirto- ja siirtoajan mittaus näytön tapahtumista (kutsu kerran)
+void perf_overlay_attach(lv_display_t *disp);
+void perf_overlay_show(bool on);
+bool perf_overlay_visible();
+// Piilotettu kytkin: pitkä painallus olioon näyttää/piilottaa ruudun
+void perf_overlay_bind_toggle(lv_obj_t *obj);
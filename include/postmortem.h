@@ -0,0 +1,30 @@
+#pragma once
+
+// Post-mortem-alue RTC-muistissa (RTC_NOINIT_ATTR), joka säilyy ohjelmallisen
+// uudelleenkäynnistyksen, paniikin ja vahtikoiran yli. Alueelle kirjataan koko
+// ajan viimeiset ruudut (piirtoaika, näkymä, jäikö kesken), kosketukset,
+// viivakoodit ja binäärilokin (klog.h) merkinnät, jotka klog() kopioi alueelle
+// kirjoittaessaan, sekä sekunnin välein muistitilanne. LVGL:n assert kirjaa
+// lisäksi kohdan ja käynnistää heti uudelleen.
+//
+// Seuraavassa käynnistyksessä raportti tulostetaan sarjaporttiin, tallennetaan
+// tiedostoon POSTMORTEM_FILE ja sync-tehtävä lähettää sen taustajärjestelmään
+// (POST /api/postmortem), minkä jälkeen tiedosto poistetaan.
+
+#include <lvgl.h>
+#include <stdint.h>
+#include "kiosk_config.h"
+#include "postmortem_assert.h"
+
+#define POSTMORTEM_FRAMES  32
+#define POSTMORTEM_INPUTS  16
+#define POSTMORTEM_KLOG    32
+#define POSTMORTEM_FILE    "postmortem.txt"
+#define POSTMORTEM_URL     KIOSK_BACKEND_URL "/api/postmortem"
+
+// Kutsu kiosk_fs_begin():n jälkeen: raportoi edellisen käynnistyksen, nollaa
+// alueen ja alkaa kirjata näytön ruutuja ja osoitinlaitteiden painalluksia
+void postmortem_begin(lv_display_t *disp);
+void postmortem_scan(uint32_t code);
+// sync-tehtävästä verkon ollessa ylhäällä; palauttaa false, jos lähetys jäi kesken
+bool postmortem_upload();
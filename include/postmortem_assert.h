@@ -0,0 +1,15 @@
+#pragma once
+
+// LVGL:n LV_ASSERT_HANDLER (lv_conf.h). C-otsake, koska LVGL sisällyttää tämän
+// omiin käännösyksiköihinsä; muu rajapinta on tiedostossa postmortem.h.
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Kirjaa kohdan post-mortem-alueelle ja käynnistää laitteen uudelleen (native: abort)
+void postmortem_assert(const char *file, int line) __attribute__((noreturn));
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,55 @@
+#pragma once
+
+// LVGL:n profiloijan jäljet ulos: laitteella sarjaporttiin (stdout), nativessa
+// tiedostoon. lv_conf.h ohjaa LV_PROFILER_BEGIN/END-makrot tänne: tapahtuma on
+// 8 tavun tietue PSRAM-rengaspuskuriin (yksi kirjoittaja eli LVGL:n tehtävä, ei
+// lukkoa). Matalan prioriteetin tehtävä tyhjentää puskurin PROFILER_EXPORT_FLUSH_MS
+// välein tiiviinä riveinä, joten hidas sarjaportti jarruttaa vain sitä eikä
+// LVGL:n ajastimia. Täysi puskuri pudottaa tapahtumia ja laskee ne.
+//
+// Rivit (muut rivit, kuten lokit, saavat olla välissä):
+//   @lvp N <id> <nimi>       jakson nimi, lähetetään ensimmäisellä käytöllä ja
+//                            uudelleen PROFILER_EXPORT_NAMES_MS välein
+//   @lvp E <base64>          u32 aikaleima (us, LE), sitten tapahtumittain tavu
+//                            (bitti 7 = loppu, bitit 0..6 = id) ja varint-erotus
+//                            edelliseen tapahtumaan mikrosekunteina
+//   @lvp D <määrä>           pudotettuja tapahtumia edellisen rivin jälkeen
+// Tapahtuma vie 2-4 tavua (base64:nä 3-6 merkkiä), LVGL:n systrace-tekstirivi ~60.
+// tools/profiler_trace.py muuntaa rivit Chrome/Perfetto-aikajanaksi.
+//
+// Käytössä vain profiloijaympäristöissä (-D KIOSK_PROFILER=1, ks. platformio.ini);
+// muuten funktiot eivät tee mitään.
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define PROFILER_EXPORT_FLUSH_MS   50
+#define PROFILER_EXPORT_NAMES_MS   2000
+#define PROFILER_EXPORT_EVENTS     32768   // Rengaspuskuri, 8 tavua / tapahtuma (PSRAM)
+#define PROFILER_EXPORT_MAX_NAMES  128     // Eri jaksojen nimiä; id mahtuu 7 bittiin
+#define PROFILER_EXPORT_TASK_PRIO  0       // Tyhjennys vain, kun muuta ajettavaa ei ole
+#define PROFILER_EXPORT_TASK_CORE  0       // LVGL pyörii ytimellä 1
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Kutsu lv_init():n jälkeen. path NULL = stdout. Aikaleimat mikrosekunteina
+// todellisesta kellosta (kiosk_time_us), myös simuloidulla kellolla ajettaessa.
+bool profiler_export_start(const char *path);
+// Tyhjentää loput ja lopettaa keräämisen
+void profiler_export_stop(void);
+
+// LV_PROFILER_BEGIN_TAG / END_TAG (lv_conf.h). tag on pysyvä merkkijono (__func__ tai literaali).
+void profiler_export_begin(const char *tag);
+void profiler_export_end(const char *tag);
+
+#ifdef __cplusplus
+}
+#endif
+
+// LVGL sisällyttää tämän LV_PROFILER_INCLUDE-otsakkeena
+#define PROFILER_EXPORT_BEGIN      profiler_export_begin(__func__)
+#define PROFILER_EXPORT_END        profiler_export_end(__func__)
+#define PROFILER_EXPORT_BEGIN_TAG(tag) profiler_export_begin(tag)
+#define PROFILER_EXPORT_END_TAG(tag)   profiler_export_end(tag)
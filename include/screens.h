@@ -0,0 +1,52 @@
+#pragma once
+
+// Näkymien hallinta. Jokainen näkymä rakennetaan ensimmäisellä käyttökerralla ja
+// pidetään muistissa, joten vaihto on pelkkä lv_screen_load() ilman oliopuun
+// uudelleenrakentamista. Kiinnittämättömät näkymät ovat LRU-välimuistissa, josta
+// vanhin poistetaan, kun niitä on liikaa tai LVGL:n muisti käy vähiin.
+
+#include <lvgl.h>
+#include <stdint.h>
+
+#define SCREEN_CACHE_MAX       3             // Kiinnittämättömiä näkymiä muistissa yhtä aikaa
+#define SCREEN_MIN_FREE_HEAP   (48 * 1024)   // Tätä vähemmän vapaata -> poistetaan vanhimpia
+
+enum screen_id_t {
+    SCREEN_MAIN,
+    SCREEN_SCAN_RESULT,
+    SCREEN_CONFIRM,
+    SCREEN_ERROR,
+    SCREEN_ADMIN,
+    SCREEN_COUNT
+};
+
+typedef lv_obj_t *(*screen_build_fn_t)(void);
+typedef void (*screen_hook_fn_t)(lv_obj_t *screen);
+typedef void (*screen_show_fn_t)(screen_id_t id);
+
+struct screen_metrics_t {
+    uint32_t builds;          // Montako kertaa rakennettu (>1 = poistettu välillä)
+    uint32_t build_us;        // Viimeisimmän rakennuksen kesto
+    uint32_t heap_bytes;      // LVGL-muistia näkymää kohden
+    uint32_t switches;
+    uint32_t switch_us;       // lv_screen_load() -> ensimmäinen valmis päivitys
+    bool resident;
+};
+
+void screens_init();
+void screens_register(screen_id_t id, screen_build_fn_t build, bool pinned);
+void screens_show(screen_id_t id);
+screen_id_t screens_current();
+
+// Palauttaa näkymän olion (rakentaa tarvittaessa, ei näytä sitä)
+lv_obj_t *screens_get(screen_id_t id);
+// Näkymän olio, jos se on muistissa, muuten NULL (ei rakenna)
+lv_obj_t *screens_peek(screen_id_t id);
+// Kutsutaan jokaiselle uudelle näkymälle rakennuksen jälkeen (esim. ajonaikaiset tyylit)
+void screens_set_build_hook(screen_hook_fn_t hook);
+// Kutsutaan jokaisella näkymän vaihdolla ennen lataamista
+void screens_set_show_hook(screen_show_fn_t hook);
+
+const screen_metrics_t *screens_metrics(screen_id_t id);
+const char *screens_name(screen_id_t id);
+void screens_print_metrics();
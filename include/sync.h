@@ -0,0 +1,37 @@
+#pragma once
+
+// Tapahtumajonon synkronointi taustajärjestelmään erissä. Ajetaan omana
+// tehtävänään ytimellä 0, joten hidas verkko ei pysäytä lv_timer_handler()-kutsuja.
+
+#include <stdint.h>
+#include <stddef.h>
+#include "tx_queue.h"
+
+struct sync_stats_t {
+    uint32_t batches;     // Onnistuneet lähetykset
+    uint32_t records;     // Kuitatut tapahtumat
+    uint32_t failures;    // Epäonnistuneet yritykset
+    uint32_t bytes_raw;   // Tapahtumien koko pakkaamattomana
+    uint32_t bytes_sent;  // Lähetettyjen erien koko (pakattuna, jos deflate pienensi)
+    int last_status;      // Viimeisin HTTP-tila (tai <0 yhteysvirhe)
+};
+
+void sync_start();
+
+// Lähettää yhden erän. Palauttaa kuitattujen määrän, 0 jos jono on tyhjä, <0 jos epäonnistui.
+// Ei säieturvallinen: kutsutaan vain synkronointitehtävästä (tai nativen mittauksesta).
+int sync_run_once();
+
+// Koodaa tapahtumat erämuotoon, palauttaa tavumäärän (0 = puskuri liian pieni)
+size_t sync_encode_batch(const tx_record_t *recs, size_t count, uint8_t *out, size_t out_size);
+// Erä zlib-muotoon (Content-Encoding: deflate); 0, jos ei pienene tai ei mahdu out_sizeen.
+// Ei säieturvallinen (laitteella yksi jaettu pakkaaja), kuten sync_run_once().
+size_t sync_deflate(const uint8_t *in, size_t len, uint8_t *out, size_t out_size);
+
+void sync_get_stats(sync_stats_t *out);
+
+// Lepotila (kiosk_idle.h) varaa verkon unen ajaksi. false, jos sync-tehtävä on kesken
+// verkkoliikenteen (HTTP-pyyntö tai luettelon lataus); uni yritetään myöhemmin.
+// Varauksen ajan tehtävä ei aloita uusia pyyntöjä.
+bool sync_sleep_begin();
+void sync_sleep_end();
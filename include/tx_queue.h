@@ -0,0 +1,36 @@
+#pragma once
+
+// Pysyvä tapahtumajono. Tapahtumat kirjoitetaan flashille kiinteän kokoisina
+// tietueina (CRC:n kanssa) ja poistetaan vasta, kun taustajärjestelmä on kuitannut ne.
+
+#include <stdint.h>
+#include <stddef.h>
+
+enum tx_mode_t : uint8_t {
+    TX_MODE_OTTO = 0,
+    TX_MODE_PALAUTUS = 1,
+};
+
+struct tx_record_t {
+    uint32_t seq;          // Juokseva numero, jonka jono antaa (idempotenssin perusta)
+    uint32_t timestamp;    // Sekunteja (unix-aika, jos kello on asetettu)
+    uint32_t product_id;
+    int32_t amount_cents;
+    uint16_t qty;
+    uint8_t mode;          // tx_mode_t
+    uint8_t reserved;
+};
+
+bool txq_begin(const char *file_name = "txq.log");
+void txq_end();
+
+// Lisää tapahtuman jonoon ja palauttaa sille annetun numeron (0 = epäonnistui)
+uint32_t txq_push(const tx_record_t *rec);
+
+// Kopioi enintään max kuittaamatonta tapahtumaa vanhimmasta alkaen
+size_t txq_peek(tx_record_t *out, size_t max);
+
+// Kuittaa kaikki tapahtumat numeroon last_seq asti
+bool txq_ack(uint32_t last_seq);
+
+uint32_t txq_pending();
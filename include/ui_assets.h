@@ -0,0 +1,40 @@
+#pragma once
+
+// Assets-osio: fontit LVGL:n binäärimuodossa (tools/font_build.py, "assets") ja kuvat
+// LVGL:n .bin-kuvina omalla LittleFS-osiollaan, jotta ne voi päivittää flashaamatta
+// koko ohjelmaa (partitions_assets.csv, env:esp32-8048S043C-assets). LVGL lukee
+// osiota asemalla 'A' (LV_USE_FS_POSIX, lv_conf.h): laitteella osio on liitetty
+// VFS:ään polkuun /assets, nativessa se on projektin hakemisto assets/.
+//
+// Fontti ladataan kokonaan muistiin (lv_binfont_create) ensimmäisellä pyynnöllä.
+// Kuvat (tools/image_build.py: ui/images/*.png -> assets/images/*.bin, RGB565) luetaan
+// osiolta joka piirrossa riveittäin, koska kuvavälimuisti on pois (LV_CACHE_DEF_SIZE 0,
+// LV_BIN_DECODER_RAM_LOAD 0): lv_image_set_src(img, ui_assets_image("logo")).
+// KIOSK_ASSET_FONTS=1: käyttöliittymän fontit (ui_fonts.h) ladataan osiolta bootissa (ui_font_proxy.h).
+
+#include <stdint.h>
+#include <lvgl.h>
+
+#define UI_ASSETS_MAX_FONTS  6
+#define UI_ASSETS_MAX_IMAGES 8
+
+typedef struct {
+    uint32_t fonts;       // Ladattuja fontteja
+    uint32_t file_bytes;  // Tiedostojen koko osiolla
+    uint32_t heap_bytes;  // LVGL:n keosta ladatuille fonteille
+    uint32_t load_us;     // Latausaika yhteensä
+    uint32_t images;      // Käytössä olevia kuvia
+    uint32_t image_bytes; // Kuvatiedostojen koko osiolla
+    uint32_t image_us;    // Kuvien otsakkeiden luku ja tarkistus yhteensä
+} ui_assets_stats_t;
+
+// Liittää osion (vain luku) ja lisää LVGL:n kekoon KIOSK_ASSET_POOL_KB:n PSRAM-poolin.
+// Kutsu lv_init():n jälkeen ennen näkymiä.
+bool ui_assets_begin();
+// Fontti nimellä ilman päätettä ("Arial_70" -> A:fonts/Arial_70.bin); NULL, jos puuttuu tai on virheellinen
+const lv_font_t *ui_assets_font(const char *name);
+// Kuvan lähde nimellä ilman päätettä ("logo" -> "A:images/logo.bin") lv_image_set_src():lle.
+// Otsake tarkistetaan ensimmäisellä pyynnöllä; NULL, jos kuva puuttuu tai on virheellinen.
+const char *ui_assets_image(const char *name);
+void ui_assets_get_stats(ui_assets_stats_t *out);
+void ui_assets_print_stats();
@@ -0,0 +1,27 @@
+#pragma once
+
+// Käyttöliittymän fontit, kun ne tulevat ajonaikaisesti (TTF, ui_font_ttf.h, tai
+// assets-osio, ui_assets.h). ui_gen.c:n vakiotyylit viittaavat Arial_NN-fontteihin
+// käännösaikana, joten ui_fonts.c jätetään käännöksestä pois ja jokainen ui_fonts.h:n
+// fontti on välittäjä, joka ohjaa glyfien haun asetettuun fonttiin. Ennen asetusta
+// merkit näkyvät varafontilla. Käytössä, kun KIOSK_FONT_PROXY (kiosk_config.h).
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <lvgl.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Metriikat (rivikorkeus, perusviiva) ovat esirasteroidun koon size; false, jos kokoa
+// ei ole ui_fonts.h:ssa tai font on NULL
+bool ui_font_proxy_set(int32_t size, const lv_font_t *font);
+// Välittäjät ui_fonts.h:n järjestyksessä: koko ja nimi ("Arial_70"); 0 kpl ilman välittäjiä
+int ui_font_proxy_count(void);
+int32_t ui_font_proxy_size(int i);
+const char *ui_font_proxy_name(int i);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,38 @@
+#pragma once
+
+// Arial ajonaikaisesti TTF:stä (LVGL:n Tiny TTF) esirasteroitujen bittikarttafonttien
+// (ui_fonts.c, tools/font_build.py) vaihtoehtona: flashissa on yksi arial.ttf, ja
+// mikä tahansa koko luodaan käynnistyksessä. Glyfi rasteroidaan ensimmäisellä
+// piirrolla ja pidetään LVGL:n välimuistissa (LV_TINY_TTF_CACHE_GLYPH_CNT glyfiä
+// kokoa kohden). Välimuistia varten LVGL:n kekoon lisätään KIOSK_TTF_POOL_KB:n
+// pooli PSRAMista; sisäinen LV_MEM_SIZE ei riitä 70 px glyfeille.
+//
+// Käytössä vain TTF-ympäristöissä (-D KIOSK_TINY_TTF=1, ks. platformio.ini), muuten
+// ui_font_ttf() palauttaa NULL. Laitteella fonts/arial.ttf upotetaan ohjelmaan
+// (board_build.embed_files), nativessa se luetaan tiedostosta KIOSK_TTF_PATH.
+// Fonttia ei jaeta versionhallinnassa, joten se kopioidaan fonts/-hakemistoon ensin.
+//
+// KIOSK_TTF_UI=1: käyttöliittymän fontit (ui_fonts.h) piirretään TTF:llä samoissa
+// koissa (ui_font_proxy.h).
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <lvgl.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define UI_FONT_TTF_MAX 6   // Eri kokoja yhtä aikaa (käyttöliittymän 4 + mittaukset)
+
+// Lataa TTF:n ja lisää välimuistipoolin; kutsu lv_init():n jälkeen ennen näkymiä
+bool ui_font_ttf_begin(void);
+// Koon fontti, luodaan ensimmäisellä kutsulla. NULL, jos TTF puuttuu tai kokoja on liikaa.
+const lv_font_t *ui_font_ttf(int32_t size);
+// TTF-datan koko flashissa (tavua), 0 ennen ui_font_ttf_begin():iä
+size_t ui_font_ttf_data_size(void);
+
+#ifdef __cplusplus
+}
+#endif
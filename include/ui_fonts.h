@@ -0,0 +1,15 @@
+// Generoitu tiedostosta ui/strings.json: python3 tools/font_build.py. Älä muokkaa käsin.
+#pragma once
+
+#include <lvgl.h>
+
+// Käyttöliittymän fontit (src/ui_fonts.c), pienimmästä suurimpaan:
+// X(nimi, koko, rivikorkeus, perusviiva, alleviivauksen kohta, alleviivauksen paksuus)
+#define UI_FONTS(X) \
+    X(Arial_24, 24, 27, 5, -2, 2) \
+    X(Arial_32, 32, 36, 7, -3, 2) \
+    X(Arial_48, 48, 54, 10, -5, 3) \
+    X(Arial_70, 70, 78, 15, -7, 5)
+
+#define UI_FONT_DECLARE(name, size, line_height, base_line, ul_pos, ul_thickness) LV_FONT_DECLARE(name)
+UI_FONTS(UI_FONT_DECLARE)
@@ -0,0 +1,104 @@
+// Generoitu tiedostoista ui/layout.json ja ui/strings.json: python3 tools/gen_ui.py. Älä muokkaa käsin.
+#pragma once
+
+#include <lvgl.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Vakiotyylit (flashissa). lv_obj_add_style() ei muokkaa tyyliä, cast on turvallinen.
+#define UI_STYLE(s) ((lv_style_t *)&(s))
+
+extern const lv_style_t ui_style_screen;
+extern const lv_style_t ui_style_text;
+extern const lv_style_t ui_style_text_small;
+extern const lv_style_t ui_style_text_dim;
+extern const lv_style_t ui_style_text_center;
+extern const lv_style_t ui_style_btn;
+extern const lv_style_t ui_style_btn_checked;
+extern const lv_style_t ui_style_snappy;
+extern const lv_style_t ui_style_prerendered;
+
+// Kielet ja käännettävät tekstit (ui/strings.json), ks. ui_lang.h
+typedef enum {
+    UI_LANG_FI,
+    UI_LANG_SV,
+    UI_LANG_EN,
+    UI_LANG_COUNT
+} ui_lang_t;
+
+typedef enum {
+    UI_STR_LANG_NAME,
+    UI_STR_OTTO,
+    UI_STR_PALAUTUS,
+    UI_STR_PROMPT_OTTO,
+    UI_STR_PROMPT_PALAUTUS,
+    UI_STR_PRODUCT,
+    UI_STR_OK,
+    UI_STR_CANCEL,
+    UI_STR_CONFIRM,
+    UI_STR_YES,
+    UI_STR_NO,
+    UI_STR_ERROR,
+    UI_STR_UNKNOWN_PRODUCT,
+    UI_STR_SAVE_FAILED,
+    UI_STR_ADMIN,
+    UI_STR_ADMIN_INFO,
+    UI_STR_STATUS_QUEUED,
+    UI_STR_STATUS_OFFLINE,
+    UI_STR_STATUS_FAILED,
+    UI_STR_SNAPPY,
+    UI_STR_BACK,
+    UI_STR_COUNT
+} ui_str_t;
+
+extern const char *const ui_strings[UI_LANG_COUNT][UI_STR_COUNT];
+// Labelin teksti seuraa valittua kieltä (toteutus ui_lang.cpp)
+void ui_text_bind(lv_obj_t *label, ui_str_t id);
+
+typedef struct {
+    lv_obj_t *screen;
+    lv_obj_t *prompt;
+    lv_obj_t *btn_otto;
+    lv_obj_t *btn_palautus;
+    lv_obj_t *status;
+} ui_main_t;
+
+typedef struct {
+    lv_obj_t *screen;
+    lv_obj_t *name;
+    lv_obj_t *price;
+    lv_obj_t *btn_ok;
+    lv_obj_t *btn_cancel;
+} ui_scan_t;
+
+typedef struct {
+    lv_obj_t *screen;
+    lv_obj_t *btn_yes;
+    lv_obj_t *btn_no;
+} ui_confirm_t;
+
+typedef struct {
+    lv_obj_t *screen;
+    lv_obj_t *message;
+    lv_obj_t *btn_ok;
+} ui_error_t;
+
+typedef struct {
+    lv_obj_t *screen;
+    lv_obj_t *info;
+    lv_obj_t *btn_lang;
+    lv_obj_t *btn_snappy;
+    lv_obj_t *btn_back;
+} ui_admin_t;
+
+lv_obj_t *ui_main_create(ui_main_t *ui);
+lv_obj_t *ui_scan_create(ui_scan_t *ui);
+lv_obj_t *ui_confirm_create(ui_confirm_t *ui);
+lv_obj_t *ui_error_create(ui_error_t *ui);
+lv_obj_t *ui_admin_create(ui_admin_t *ui);
+
+#ifdef __cplusplus
+}
+#endif
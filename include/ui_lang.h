@@ -0,0 +1,30 @@
+#pragma once
+
+// Käyttöliittymän kieli LVGL:n observer-subjektina (kuten kiosk_mode.h). Tekstit
+// ovat tiedostossa ui/strings.json, josta tools/gen_ui.py generoi taulukon
+// ui_strings (ui_gen.h). Sidotut labelit vaihtavat tekstinsä, kun kieli vaihtuu;
+// näkymiä ei rakenneta uudelleen.
+//
+// Käyttöliittymän fontit (ui_fonts.h) sisältävät vain ASCII:n, kaikkien kielten
+// tekstien merkit ja luettelon tuotenimien merkit (ui/catalog_chars.txt,
+// tools/font_build.py --catalog), joten uusi kieli lisää flashiin vain merkit, joita
+// aiemmissa kielissä ei ollut. Tuotenimen merkki, jota fontissa ei ole, piirretään
+// varafontilla (Montserrat 14), kunnes se lisätään --catalogilla.
+
+#include <lvgl.h>
+#include "ui_gen.h"
+
+#ifndef KIOSK_LANG_DEFAULT
+#define KIOSK_LANG_DEFAULT UI_LANG_FI
+#endif
+
+extern lv_subject_t ui_lang_subject;
+
+void ui_lang_init(ui_lang_t initial);
+ui_lang_t ui_lang_get();
+void ui_lang_set(ui_lang_t lang);
+// Seuraava kieli (ylläpitonäkymän painike)
+void ui_lang_next();
+
+// Teksti nykyisellä kielellä
+const char *ui_tr(ui_str_t id);
@@ -0,0 +1,19 @@
+#pragma once
+
+// Painikkeen esipiirto. Painikkeen molemmat tilat (valittu / ei valittu) piirretään
+// kerran lv_snapshot-kuviksi PSRAMiin, ja painike näyttää ne taustakuvana: tilan
+// vaihto on kuvan kopiointi eikä pyöreän reunan, reunaviivan ja 70 px tekstin
+// rasterointi. Sopii painikkeille, joiden teksti ja tyyli muuttuvat harvoin: muutosta
+// varten painike vapautetaan ja kuvataan uudelleen (kielen vaihto, ui_screens.cpp).
+// Kuva on RGB565 ilman alfaa, joten kulmat ovat mustia kuten kioskin tausta.
+
+#include <lvgl.h>
+
+#define UI_PRERENDER_MAX 4   // Esipiirrettyjä painikkeita yhtä aikaa
+
+// Ottaa kuvat ja vaihtaa painikkeen kuvatilaan. Painikkeen näkymän asettelu lasketaan tarvittaessa.
+bool ui_prerender_button(lv_obj_t *btn);
+// Palauttaa painikkeen tavalliseen piirtoon ja vapauttaa kuvat (esim. ennen tekstin vaihtoa)
+void ui_prerender_release(lv_obj_t *btn);
+// Kuvien viemä muisti yhteensä
+size_t ui_prerender_bytes();
@@ -0,0 +1,48 @@
+#pragma once
+
+// Viestijono, jolla taustatehtävät (lukija, synkronointi, tallennus) päivittävät
+// käyttöliittymää koskematta LVGL:ään. Komennot ovat kiinteän kokoisia ja jono on
+// lukitukseton (monta kirjoittajaa, yksi lukija). loop() tyhjentää jonon kerran
+// ennen lv_timer_handler()-kutsua ja yhdistää saman kohteen päivitykset, joten
+// purske päivityksiä piirtyy kerran per ruutu.
+
+#include <lvgl.h>
+#include <stdint.h>
+#include "kiosk_mode.h"
+
+#define UI_QUEUE_LEN  32  // Kahden potenssi
+#define UI_TEXT_MAX   48
+
+// Kohteet, joita taustatehtävät voivat päivittää (oliot omistaa main.cpp)
+enum ui_target_t : uint8_t {
+    UI_TARGET_LABEL,
+    UI_TARGET_BTN1,
+    UI_TARGET_BTN2,
+    UI_TARGET_STATUS,   // Päänäkymän tilarivi (sync-tehtävä: jono, verkko, virheet)
+    UI_TARGET_COUNT
+};
+
+enum ui_cmd_type_t : uint8_t {
+    UI_CMD_SET_TEXT,
+    UI_CMD_ADD_STATE,
+    UI_CMD_CLEAR_STATE,
+    UI_CMD_SET_MODE,    // Asettaa kiosk_mode-subjektin (kohde ei merkitse)
+};
+
+struct ui_cmd_t {
+    uint8_t type;       // ui_cmd_type_t
+    uint8_t target;     // ui_target_t
+    uint16_t state;     // lv_state_t tai kiosk_mode_t
+    char text[UI_TEXT_MAX];
+};
+
+// Kutsutaan mistä tahansa tehtävästä. Palauttaa false, jos jono on täynnä.
+// Painikkeen teksti asetetaan sen label-lapseen; muille kuin labeleille teksti ohitetaan.
+bool ui_post_text(ui_target_t target, const char *text);
+bool ui_post_state(ui_target_t target, lv_state_t state, bool on);
+bool ui_post_mode(kiosk_mode_t mode);
+
+// Vain UI-tehtävästä
+void ui_queue_register(ui_target_t target, lv_obj_t *obj);
+void ui_queue_drain();
+uint32_t ui_queue_dropped();
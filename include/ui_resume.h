@@ -0,0 +1,39 @@
+#pragma once
+
+// Käyttöliittymän tila uudelleenkäynnistyksen yli. Tila (Otto/Palautus), näkymä ja
+// vahvistusta odottava tuote pidetään RTC-muistissa (KIOSK_RETAINED) ja päivitetään
+// jokaisella muutoksella. Tarkistussumma kirjoitetaan viimeisenä, joten kesken
+// päivityksen tullut paniikki ei palauta puolikasta tilaa. Vahtikoiran tai
+// paniikin jälkeen setup() palauttaa käyttäjän samaan kohtaan; virran
+// kytkennän jälkeen aloitetaan päänäkymästä.
+//
+// Jos palautettu tila kaatuu heti uudelleen, UI_RESUME_MAX_TRIES peräkkäisen
+// yrityksen jälkeen aloitetaan puhtaalta pöydältä. Laskuri nollautuu, kun
+// laite on pysynyt pystyssä UI_RESUME_STABLE_MS.
+//
+// Lisäksi mitataan aika käynnistyksestä ensimmäiseen valmiiseen ruutuun
+// (esp_timer alkaa sovelluksen käynnistyksestä, ROM ja bootloader eivät sisälly).
+
+#include <lvgl.h>
+#include <stdint.h>
+#include "screens.h"
+
+#define UI_RESUME_MAX_TRIES  2
+#define UI_RESUME_STABLE_MS  30000
+
+struct ui_resume_state_t {
+    uint8_t mode;          // kiosk_mode_t
+    uint8_t screen;        // screen_id_t
+    uint32_t product_id;   // 0 = ei kesken olevaa tapahtumaa
+};
+
+// true, jos edellisen ajon tila on voimassa ja se kannattaa palauttaa
+bool ui_resume_load(ui_resume_state_t *out);
+// Aloittaa tilan seurannan (tilasubjekti, näkymän vaihdot) ja käynnistysajan mittauksen.
+// Kutsu palautuksen jälkeen, kun näkymät on rekisteröity.
+void ui_resume_attach(lv_display_t *disp);
+// Vahvistusta odottava tuote; 0 ennen tallennusta, ettei kaatuminen toista tapahtumaa
+void ui_resume_set_product(uint32_t product_id);
+
+// Käynnistyksestä ensimmäiseen valmiiseen ruutuun, 0 = ei vielä
+uint32_t ui_resume_boot_ms();
@@ -0,0 +1,20 @@
+#pragma once
+
+// Kioskin näkymät (pää, tuote, vahvistus, virhe, ylläpito) ja niiden väliset siirtymät
+
+#include <stdint.h>
+#include "catalog.h"
+#include "ui_gen.h"
+#include "ui_resume.h"
+
+// Päänäkymän oliot; päänäkymä on kiinnitetty, joten osoittimet pysyvät voimassa
+extern ui_main_t ui_main;
+
+// Rekisteröi kaikki näkymät screens-moduuliin (kutsu screens_init()-kutsun jälkeen)
+void ui_screens_register();
+
+// Viivakoodi luettu: näyttää tuotteen tai virheen. Kutsutaan UI-tehtävästä.
+void ui_scan(uint32_t product_id);
+void ui_show_error(ui_str_t message);
+// Palauttaa tilan ja näkymän uudelleenkäynnistyksen jälkeen (luettelon oltava ladattu)
+void ui_screens_restore(const ui_resume_state_t *state);
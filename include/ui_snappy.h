@@ -0,0 +1,17 @@
+#pragma once
+
+// Nopea tila. Oletusteema (LV_THEME_DEFAULT_TRANSITION_TIME, LV_THEME_DEFAULT_GROW)
+// animoi painikkeen jokaisen tilamuutoksen usean ruudun ajan. Nopeassa tilassa
+// painikkeisiin lisätään vakiotyyli ui_style_snappy (ei siirtymää, ei kasvua),
+// jolloin tilamuutos piirtyy yhdellä ruudulla. Vaihdettavissa ajon aikana
+// ylläpitonäkymästä; valinta tallennetaan tiedostoon kiosk_fs/snappy ja säilyy
+// uudelleenkäynnistyksen yli.
+
+#include <lvgl.h>
+
+// Tallennettu valinta (tai KIOSK_SNAPPY_DEFAULT); kutsu kiosk_fs_begin():n jälkeen
+void ui_snappy_load();
+void ui_snappy_set(bool on);   // Päivittää kaikki muistissa olevat näkymät ja tallentaa valinnan
+bool ui_snappy_get();
+// Lisää/poistaa tyylin puun painikkeista nykyisen tilan mukaan (screens-moduulin rakennuskoukku)
+void ui_snappy_apply(lv_obj_t *root);
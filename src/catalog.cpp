@@ -0,0 +1,243 @@
+#include "catalog.h"
+#include "http_client.h"
+#include "kiosk_config.h"
+#include "kiosk_port.h"
+#include "klog.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <mutex>
+
+static std::mutex catalog_mutex;  // Suojaa hakuja tiedoston vaihdon ajan
+static FILE *index_file = NULL;
+static catalog_header_t header;
+static char index_path[64], new_path[72], prev_path[72], delta_path[64];
+
+// Otsake ja tietueiden CRC: katkennut tai rikkinäinen tiedosto hylätään
+static bool index_valid(FILE *f, catalog_header_t *h) {
+    if (fread(h, sizeof(*h), 1, f) != 1 || memcmp(h->magic, "KCI1", 4)) return false;
+    catalog_item_t buf[32];
+    uint32_t left = h->count, crc = 0;
+    while (left > 0) {
+        uint32_t n = left < 32 ? left : 32;
+        if (fread(buf, sizeof(catalog_item_t), n, f) != n) return false;
+        crc = kiosk_crc32(buf, n * sizeof(catalog_item_t), crc);
+        left -= n;
+    }
+    return crc == h->crc;
+}
+
+static bool file_valid(const char *path) {
+    FILE *f = fopen(path, "rb");
+    if (!f) return false;
+    catalog_header_t h;
+    bool ok = index_valid(f, &h);
+    fclose(f);
+    return ok;
+}
+
+// verify = false, kun tiedosto on juuri tarkistettu (vaihto lukon alla ei lue koko luetteloa)
+static bool open_index(bool verify) {
+    if (index_file) fclose(index_file);
+    index_file = fopen(index_path, "rb");
+    bool ok = index_file && (verify ? index_valid(index_file, &header)
+                                    : fread(&header, sizeof(header), 1, index_file) == 1);
+    if (ok) return true;
+    if (index_file) fclose(index_file);
+    index_file = NULL;
+    memset(&header, 0, sizeof(header)); // Ei luetteloa = versio 0
+    return false;
+}
+
+bool catalog_begin(const char *file_name) {
+    std::lock_guard<std::mutex> lock(catalog_mutex);
+    kiosk_fs_path(index_path, sizeof(index_path), file_name);
+    kiosk_fs_path(delta_path, sizeof(delta_path), "catalog.delta");
+    snprintf(new_path, sizeof(new_path), "%s.new", index_path);
+    snprintf(prev_path, sizeof(prev_path), "%s.prev", index_path);
+    if (open_index(true)) return true;
+    // Rikkinäisen tilalle edellinen luettelo; seuraava erotus haetaan sen versiosta
+    if (!file_valid(prev_path)) return false;
+    remove(index_path);
+    if (rename(prev_path, index_path) != 0 || !open_index(false)) return false;
+    klog(KLOG_CATALOG_RESTORED, header.version);
+    return true;
+}
+
+uint32_t catalog_version() {
+    std::lock_guard<std::mutex> lock(catalog_mutex);
+    return header.version;
+}
+
+uint32_t catalog_count() {
+    std::lock_guard<std::mutex> lock(catalog_mutex);
+    return header.count;
+}
+
+uint32_t catalog_crc() {
+    std::lock_guard<std::mutex> lock(catalog_mutex);
+    return header.crc;
+}
+
+bool catalog_lookup(uint32_t id, catalog_item_t *out) {
+    std::lock_guard<std::mutex> lock(catalog_mutex);
+    if (!index_file) return false;
+
+    // Binäärihaku suoraan tiedostosta, ~15 lukua 20 000 tuotteella
+    uint32_t lo = 0, hi = header.count;
+    while (lo < hi) {
+        uint32_t mid = lo + (hi - lo) / 2;
+        if (fseek(index_file, (long)(sizeof(header) + mid * sizeof(catalog_item_t)), SEEK_SET) != 0) return false;
+        if (fread(out, sizeof(*out), 1, index_file) != 1) return false;
+        if (out->id == id) return true;
+        if (out->id < id) lo = mid + 1;
+        else hi = mid;
+    }
+    return false;
+}
+
+// Puskuroitu lukija vanhalle luettelolle
+struct item_reader_t {
+    FILE *f;
+    uint32_t left;
+    catalog_item_t item;
+    bool valid;
+
+    void next(catalog_apply_stats_t *st) {
+        valid = left > 0 && fread(&item, sizeof(item), 1, f) == 1;
+        if (valid) {
+            left--;
+            st->bytes_read += sizeof(item);
+        }
+    }
+};
+
+static bool write_item(FILE *f, const catalog_item_t *item, uint32_t *crc, catalog_header_t *out_hdr, catalog_apply_stats_t *st) {
+    if (fwrite(item, sizeof(*item), 1, f) != 1) return false;
+    *crc = kiosk_crc32(item, sizeof(*item), *crc);
+    out_hdr->count++;
+    st->bytes_written += sizeof(*item);
+    return true;
+}
+
+static bool merge_delta(FILE *old_file, uint32_t old_count, FILE *delta, const catalog_delta_header_t *dh, FILE *out,
+                        catalog_apply_stats_t *st) {
+    catalog_header_t out_hdr = {};
+    memcpy(out_hdr.magic, "KCI1", 4);
+    out_hdr.version = dh->new_version;
+    if (fwrite(&out_hdr, sizeof(out_hdr), 1, out) != 1) return false; // Täytetään lopuksi
+
+    item_reader_t old = { old_file, old_file ? old_count : 0, {}, false };
+    old.next(st);
+
+    uint32_t crc = 0, delta_crc = 0, prev_id = 0;
+    catalog_delta_op_t op;
+    for (uint32_t i = 0; i < dh->op_count; i++) {
+        if (fread(&op, sizeof(op), 1, delta) != 1) return false;
+        st->bytes_read += sizeof(op);
+        delta_crc = kiosk_crc32(&op, sizeof(op), delta_crc);
+        if (i > 0 && op.item.id <= prev_id) return false; // Erotuksen pitää olla järjestyksessä
+        prev_id = op.item.id;
+
+        while (old.valid && old.item.id < op.item.id) {
+            if (!write_item(out, &old.item, &crc, &out_hdr, st)) return false;
+            old.next(st);
+        }
+        if (old.valid && old.item.id == op.item.id) old.next(st); // Korvataan tai poistetaan
+        if (op.op == CATALOG_OP_UPSERT && !write_item(out, &op.item, &crc, &out_hdr, st)) return false;
+    }
+    if (delta_crc != dh->crc) return false;
+
+    while (old.valid) {
+        if (!write_item(out, &old.item, &crc, &out_hdr, st)) return false;
+        old.next(st);
+    }
+
+    out_hdr.crc = crc;
+    if (fseek(out, 0, SEEK_SET) != 0 || fwrite(&out_hdr, sizeof(out_hdr), 1, out) != 1) return false;
+    st->bytes_written += 2 * sizeof(out_hdr);
+    st->items = out_hdr.count;
+    return true;
+}
+
+bool catalog_apply_delta(const char *path, catalog_apply_stats_t *stats) {
+    catalog_apply_stats_t st = {};
+    uint64_t t0 = kiosk_time_us();
+
+    FILE *delta = fopen(path, "rb");
+    if (!delta) return false;
+    catalog_delta_header_t dh;
+    bool ok = fread(&dh, sizeof(dh), 1, delta) == 1 && !memcmp(dh.magic, "KCD1", 4);
+    st.ops = ok ? dh.op_count : 0;
+
+    // Vanhaa luetteloa luetaan omalla kahvalla, joten haut toimivat koko yhdistämisen ajan
+    uint32_t base_version, old_count;
+    {
+        std::lock_guard<std::mutex> lock(catalog_mutex);
+        base_version = header.version;
+        old_count = header.count;
+    }
+    ok = ok && dh.base_version == base_version;
+
+    FILE *old_file = NULL;
+    if (ok && old_count > 0) {
+        old_file = fopen(index_path, "rb");
+        ok = old_file && fseek(old_file, sizeof(catalog_header_t), SEEK_SET) == 0;
+    }
+
+    FILE *out = ok ? fopen(new_path, "w+b") : NULL;
+    if (out) {
+        setvbuf(out, NULL, _IOFBF, 4096);
+        ok = merge_delta(old_file, old_count, delta, &dh, out, &st);
+        ok = fflush(out) == 0 && ok;
+        fsync(fileno(out));
+        fclose(out);
+    } else {
+        ok = false;
+    }
+    if (old_file) fclose(old_file);
+    fclose(delta);
+
+    ok = ok && file_valid(new_path); // Luetaan takaisin: flashille kirjoitettu on sama kuin laskettu
+
+    if (ok) {
+        // Atominen vaihto: haut odottavat hetken, kunnes uusi tiedosto on auki.
+        // Edellinen jää .prev-tiedostoksi, johon catalog_begin() palaa, jos uusi rikkoutuu.
+        std::lock_guard<std::mutex> lock(catalog_mutex);
+        if (index_file) fclose(index_file);
+        index_file = NULL;
+        remove(prev_path);
+        rename(index_path, prev_path); // Ei edellistä, jos luettelo oli tyhjä
+        ok = rename(new_path, index_path) == 0 && open_index(false);
+        if (!ok) {
+            rename(prev_path, index_path);
+            open_index(false);
+        }
+    } else {
+        remove(new_path);
+    }
+
+    st.duration_us = (uint32_t)(kiosk_time_us() - t0);
+    if (stats) *stats = st;
+    return ok;
+}
+
+bool catalog_update_check() {
+    char url[160];
+    snprintf(url, sizeof(url), "%s/api/catalog/delta?from=%lu", KIOSK_BACKEND_URL, (unsigned long)catalog_version());
+
+    int code = http_get_file(url, delta_path, SYNC_HTTP_TIMEOUT_MS);
+    if (code == 204) return true; // Luettelo on ajan tasalla
+    if (code != 200) {
+        klog(KLOG_CATALOG_FAIL, (uint32_t)code);
+        return false;
+    }
+
+    catalog_apply_stats_t st = {};
+    bool ok = catalog_apply_delta(delta_path, &st);
+    remove(delta_path);
+    if (ok) klog(KLOG_CATALOG_UPDATE, catalog_version(), st.ops, st.duration_us / 1000);
+    else klog(KLOG_CATALOG_APPLY_FAIL, catalog_version(), st.bytes_read);
+    return ok;
+}
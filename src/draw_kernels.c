@@ -0,0 +1,241 @@
+#include "draw_kernels.h"
+
+#include <string.h>
+
+#ifdef ESP_PLATFORM
+#include <sdkconfig.h> // CONFIG_IDF_TARGET_*
+#endif
+
+#if defined(CONFIG_IDF_TARGET_ESP32S3)
+#define DRAW_KERNELS_PIE 1
+#else
+#define DRAW_KERNELS_PIE 0
+#endif
+
+#define DRAW_RB_G_MASK 0x7E0F81Fu // Vihreä ylempään puolisanaan, punainen ja sininen alempaan
+
+static inline uint16_t *next_row(uint16_t *row, int32_t stride) {
+    return (uint16_t *)((uint8_t *)row + stride);
+}
+
+static inline uint32_t spread(uint16_t c) {
+    return ((uint32_t)c | ((uint32_t)c << 16)) & DRAW_RB_G_MASK;
+}
+
+// Sama laskenta kuin lv_color_16_16_mix(), kun fg = spread(väri) on laskettu valmiiksi
+static inline uint16_t mix_spread(uint16_t color, uint32_t fg, uint16_t bg16, uint8_t mix) {
+    if (mix == 255) return color;
+    if (mix == 0 || color == bg16) return bg16;
+    uint32_t m = ((uint32_t)mix + 4) >> 3;
+    uint32_t bg = spread(bg16);
+    uint32_t r = ((((fg - bg) * m) >> 5) + bg) & DRAW_RB_G_MASK;
+    return (uint16_t)((r >> 16) | r);
+}
+
+static void fill_row(uint16_t *dest, int32_t w, uint16_t color) {
+    int32_t x = 0;
+    if (x < w && ((uintptr_t)dest & 2)) dest[x++] = color;
+    uint32_t pair = (uint32_t)color | ((uint32_t)color << 16);
+    for (; x + 2 <= w; x += 2) memcpy(&dest[x], &pair, 4);
+    for (; x < w; x++) dest[x] = color;
+}
+
+static void opa_row(uint16_t *dest, int32_t w, uint16_t color, uint8_t opa) {
+    uint32_t fg = spread(color);
+    // Taustat ovat yleensä tasaisia: edellinen tulos kelpaa, kun pikseli ei vaihdu
+    uint16_t last_bg = dest[0];
+    uint16_t last_res = mix_spread(color, fg, last_bg, opa);
+    for (int32_t x = 0; x < w; x++) {
+        if (dest[x] != last_bg) {
+            last_bg = dest[x];
+            last_res = mix_spread(color, fg, last_bg, opa);
+        }
+        dest[x] = last_res;
+    }
+}
+
+// Maski neljä tavua kerrallaan: kirjaimissa ja kulmissa suurin osa on 0x00 tai 0xFF
+static void mask_row(uint16_t *dest, int32_t w, uint16_t color, const uint8_t *mask) {
+    uint32_t fg = spread(color);
+    int32_t x = 0;
+    for (; x + 4 <= w; x += 4) {
+        uint32_t m4;
+        memcpy(&m4, &mask[x], 4);
+        if (m4 == 0) continue;
+        if (m4 == 0xFFFFFFFFu) {
+            dest[x] = dest[x + 1] = dest[x + 2] = dest[x + 3] = color;
+            continue;
+        }
+        for (int i = 0; i < 4; i++) dest[x + i] = mix_spread(color, fg, dest[x + i], mask[x + i]);
+    }
+    for (; x < w; x++) dest[x] = mix_spread(color, fg, dest[x], mask[x]);
+}
+
+static void mask_opa_row(uint16_t *dest, int32_t w, uint16_t color, const uint8_t *mask, uint8_t opa) {
+    uint32_t fg = spread(color);
+    for (int32_t x = 0; x < w; x++) {
+        if (mask[x] == 0) continue;
+        uint8_t mix = (uint8_t)(((uint32_t)mask[x] * opa) >> 8); // LV_OPA_MIX2
+        dest[x] = mix_spread(color, fg, dest[x], mix);
+    }
+}
+
+static const draw_row_kernels_t c_kernels = {
+    "c", fill_row, opa_row, mask_row, mask_opa_row,
+};
+
+#if DRAW_KERNELS_PIE
+// src/draw_kernels_pie.S; dest (ja m) 16 tavun rajalla, blocks kahdeksan pikselin lohkoja
+void draw_pie_fill(uint16_t *dest, uint32_t blocks, const uint16_t *color);
+void draw_pie_blend(uint16_t *dest, const uint16_t *m, int32_t m_step, uint32_t blocks, const uint16_t *consts);
+
+#define PIE_CHUNK 32 // Maskirivin pala pikseleinä: kertoimet pinoon ennen vektoriydintä
+
+// draw_pie_blend():n vakiot: värin kanavat erikseen ja kanavamaskit
+typedef struct {
+    uint16_t v[5][8];
+} __attribute__((aligned(16))) pie_consts_t;
+
+static void pie_consts(pie_consts_t *k, uint16_t color) {
+    for (int i = 0; i < 8; i++) {
+        k->v[0][i] = color & 0x1F;
+        k->v[1][i] = (color >> 5) & 0x3F;
+        k->v[2][i] = color >> 11;
+        k->v[3][i] = 0x1F;
+        k->v[4][i] = 0x3F;
+    }
+}
+
+// Pikseleitä 16 tavun rajalle; nämä ja rivin loppu tehdään C-versiolla
+static inline int32_t pie_head(const uint16_t *dest, int32_t w) {
+    int32_t n = (int32_t)((16 - ((uintptr_t)dest & 15)) & 15) / 2;
+    return n < w ? n : w;
+}
+
+static void fill_row_pie(uint16_t *dest, int32_t w, uint16_t color) {
+    int32_t x = pie_head(dest, w);
+    fill_row(dest, x, color);
+    uint32_t blocks = (uint32_t)(w - x) / 8;
+    if (blocks) {
+        draw_pie_fill(&dest[x], blocks, &color);
+        x += (int32_t)blocks * 8;
+    }
+    fill_row(&dest[x], w - x, color);
+}
+
+static void opa_row_pie(uint16_t *dest, int32_t w, uint16_t color, uint8_t opa) {
+    int32_t x = pie_head(dest, w);
+    if (x) opa_row(dest, x, color, opa);
+    uint32_t blocks = (uint32_t)(w - x) / 8;
+    if (blocks) {
+        pie_consts_t k;
+        uint16_t m[8] __attribute__((aligned(16)));
+        pie_consts(&k, color);
+        for (int i = 0; i < 8; i++) m[i] = (uint16_t)(((uint32_t)opa + 4) >> 3);
+        draw_pie_blend(&dest[x], m, 0, blocks, k.v[0]);
+        x += (int32_t)blocks * 8;
+    }
+    if (x < w) opa_row(&dest[x], w - x, color, opa);
+}
+
+// with_opa: maski kerrotaan peittävyydellä kuten LV_OPA_MIX2. Kokonaan läpinäkyvä pala
+// ohitetaan ja kokonaan peittävä täytetään, kuten C-versio tekee neljän tavun paloille.
+static void mask_rows_pie(uint16_t *dest, int32_t w, uint16_t color, const uint8_t *mask, bool with_opa,
+                          uint8_t opa) {
+    int32_t x = pie_head(dest, w);
+    if (x && with_opa) mask_opa_row(dest, x, color, mask, opa);
+    else if (x) mask_row(dest, x, color, mask);
+    pie_consts_t k;
+    uint16_t m[PIE_CHUNK] __attribute__((aligned(16)));
+    pie_consts(&k, color);
+    while (w - x >= 8) {
+        int32_t n = w - x < PIE_CHUNK ? (w - x) & ~7 : PIE_CHUNK;
+        uint32_t any = 0, all = 32;
+        for (int32_t i = 0; i < n; i++) {
+            uint32_t mix = with_opa ? ((uint32_t)mask[x + i] * opa) >> 8 : mask[x + i];
+            m[i] = (uint16_t)((mix + 4) >> 3);
+            any |= m[i];
+            all &= m[i]; // Jää 32:ksi vain, jos jokainen kerroin on 32
+        }
+        if (all == 32) {
+            draw_pie_fill(&dest[x], (uint32_t)n / 8, &color);
+        } else if (any) {
+            draw_pie_blend(&dest[x], m, 16, (uint32_t)n / 8, k.v[0]);
+        }
+        x += n;
+    }
+    if (x < w && with_opa) mask_opa_row(&dest[x], w - x, color, &mask[x], opa);
+    else if (x < w) mask_row(&dest[x], w - x, color, &mask[x]);
+}
+
+static void mask_row_pie(uint16_t *dest, int32_t w, uint16_t color, const uint8_t *mask) {
+    mask_rows_pie(dest, w, color, mask, false, 0);
+}
+
+static void mask_opa_row_pie(uint16_t *dest, int32_t w, uint16_t color, const uint8_t *mask, uint8_t opa) {
+    mask_rows_pie(dest, w, color, mask, true, opa);
+}
+
+static const draw_row_kernels_t pie_kernels = {
+    "pie", fill_row_pie, opa_row_pie, mask_row_pie, mask_opa_row_pie,
+};
+#define DEFAULT_KERNELS pie_kernels
+#else
+#define DEFAULT_KERNELS c_kernels
+#endif
+
+static const draw_row_kernels_t *active = &DEFAULT_KERNELS;
+
+const draw_row_kernels_t *draw_kernels_default(void) {
+    return &DEFAULT_KERNELS;
+}
+
+const draw_row_kernels_t *draw_kernels_c(void) {
+    return &c_kernels;
+}
+
+void draw_kernels_use(const draw_row_kernels_t *k) {
+    active = k ? k : &DEFAULT_KERNELS;
+}
+
+bool draw_fill_rgb565(uint16_t *dest, int32_t w, int32_t h, int32_t dest_stride, uint16_t color) {
+    for (int32_t y = 0; y < h; y++) {
+        active->fill(dest, w, color);
+        dest = next_row(dest, dest_stride);
+    }
+    return true;
+}
+
+bool draw_fill_rgb565_opa(uint16_t *dest, int32_t w, int32_t h, int32_t dest_stride, uint16_t color,
+                          uint8_t opa) {
+    if (w <= 0) return true;
+    for (int32_t y = 0; y < h; y++) {
+        active->opa(dest, w, color, opa);
+        dest = next_row(dest, dest_stride);
+    }
+    return true;
+}
+
+bool draw_fill_rgb565_mask(uint16_t *dest, int32_t w, int32_t h, int32_t dest_stride, uint16_t color,
+                           const uint8_t *mask, int32_t mask_stride) {
+    for (int32_t y = 0; y < h; y++) {
+        active->mask(dest, w, color, mask);
+        dest = next_row(dest, dest_stride);
+        mask += mask_stride;
+    }
+    return true;
+}
+
+bool draw_fill_rgb565_mask_opa(uint16_t *dest, int32_t w, int32_t h, int32_t dest_stride, uint16_t color,
+                               const uint8_t *mask, int32_t mask_stride, uint8_t opa) {
+    for (int32_t y = 0; y < h; y++) {
+        active->mask_opa(dest, w, color, mask, opa);
+        dest = next_row(dest, dest_stride);
+        mask += mask_stride;
+    }
+    return true;
+}
+
+const char *draw_kernels_name(void) {
+    return active->name;
+}
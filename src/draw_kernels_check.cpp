@@ -0,0 +1,141 @@
+// Piirtoytimien (draw_kernels.h) tarkistus: satunnaiset alueet, rivivälit, maskit ja
+// peittävyydet verrataan bitilleen LVGL:n omaan sekoitukseen (lv_color_16_16_mix),
+// jota LVGL käyttäisi ilman ytimiä. Sama tarkistus ajetaan native-ympäristössä
+// (--kernel-check: C ja SSE4.1/NEON) ja laitteella (KIOSK_KERNEL_CHECK=1: C ja PIE).
+
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+#include <lvgl.h>
+
+#include "draw_kernels.h"
+#include "kiosk_port.h"
+
+enum { K_FILL, K_OPA, K_MASK, K_MASK_OPA, K_COUNT };
+static const char *kernel_names[K_COUNT] = { "täyttö", "täyttö+opa", "maski", "maski+opa" };
+
+static uint32_t rnd(uint32_t *state) {
+    *state = *state * 1664525u + 1013904223u;
+    return *state >> 8;
+}
+
+// LVGL:n lv_draw_sw_blend_color_to_rgb565():n silmukat sellaisinaan, yksi pikseli kerrallaan
+static void reference(int kind, uint16_t *dest, int32_t w, int32_t h, int32_t stride, uint16_t color,
+                      const uint8_t *mask, int32_t mask_stride, uint8_t opa) {
+    for (int32_t y = 0; y < h; y++) {
+        uint16_t *row = (uint16_t *)((uint8_t *)dest + y * stride);
+        const uint8_t *m = mask ? mask + y * mask_stride : NULL;
+        for (int32_t x = 0; x < w; x++) {
+            switch (kind) {
+            case K_FILL: row[x] = color; break;
+            case K_OPA: row[x] = lv_color_16_16_mix(color, row[x], opa); break;
+            case K_MASK: row[x] = lv_color_16_16_mix(color, row[x], m[x]); break;
+            default: row[x] = lv_color_16_16_mix(color, row[x], LV_OPA_MIX2(m[x], opa)); break;
+            }
+        }
+    }
+}
+
+static void kernel(int kind, uint16_t *dest, int32_t w, int32_t h, int32_t stride, uint16_t color,
+                   const uint8_t *mask, int32_t mask_stride, uint8_t opa) {
+    switch (kind) {
+    case K_FILL: draw_fill_rgb565(dest, w, h, stride, color); break;
+    case K_OPA: draw_fill_rgb565_opa(dest, w, h, stride, color, opa); break;
+    case K_MASK: draw_fill_rgb565_mask(dest, w, h, stride, color, mask, mask_stride); break;
+    default: draw_fill_rgb565_mask_opa(dest, w, h, stride, color, mask, mask_stride, opa); break;
+    }
+}
+
+// Kirjainmaskin kaltainen: enimmäkseen 0x00- ja 0xFF-jaksoja, reunoilla välisävyjä
+static void make_mask(std::vector<uint8_t> &mask, uint32_t *seed) {
+    size_t i = 0;
+    while (i < mask.size()) {
+        uint32_t kind = rnd(seed) % 4;
+        size_t run = 1 + rnd(seed) % 12;
+        for (; run && i < mask.size(); run--, i++) {
+            mask[i] = kind == 0 ? 0 : kind == 1 ? 0xFF : (uint8_t)rnd(seed);
+        }
+    }
+}
+
+static uint32_t check_random(uint32_t cases) {
+    uint32_t seed = 2024;
+    uint32_t failures = 0;
+    std::vector<uint16_t> a, b;
+    std::vector<uint8_t> mask;
+    for (uint32_t c = 0; c < cases; c++) {
+        int kind = (int)(c % K_COUNT);
+        int32_t w = 1 + (int32_t)(rnd(&seed) % 70);
+        int32_t h = 1 + (int32_t)(rnd(&seed) % 12);
+        int32_t offset = (int32_t)(rnd(&seed) % 8);  // Kohdistus 2 tavun välein
+        int32_t stride = (offset + w + (int32_t)(rnd(&seed) % 9)) * 2;
+        int32_t mask_stride = w + (int32_t)(rnd(&seed) % 5);
+        uint16_t color = (uint16_t)rnd(&seed);
+        uint8_t opa = (uint8_t)rnd(&seed);
+        if (c % 16 == 0) opa = c % 32 ? 0 : 255;  // Ääriarvot erikseen
+
+        a.assign(stride / 2 * h + 8, 0);
+        for (uint16_t &px : a) px = (rnd(&seed) % 3) ? 0x0000 : (uint16_t)rnd(&seed); // Tasaista taustaa ja kohinaa
+        b = a;
+        mask.assign(mask_stride * h + 4, 0);
+        make_mask(mask, &seed);
+
+        reference(kind, a.data() + offset, w, h, stride, color, mask.data(), mask_stride, opa);
+        kernel(kind, b.data() + offset, w, h, stride, color, mask.data(), mask_stride, opa);
+        if (a != b) {
+            size_t i = 0;
+            while (a[i] == b[i]) i++;
+            if (failures++ < 10) {
+                printf("ERO: %s %ldx%ld rivi %ld tavua, väri %04x, opa %u: kohta %lu %04x != %04x\n",
+                       kernel_names[kind], (long)w, (long)h, (long)stride, color, opa, (unsigned long)i, a[i], b[i]);
+            }
+        }
+    }
+    printf("%-7s %lu satunnaista tapausta, %lu eroa\n", draw_kernels_name(), (unsigned long)cases,
+           (unsigned long)failures);
+    return failures;
+}
+
+// Mpx/s w x h -alueella: viitesilmukka ja kukin toteutus
+static void bench(const draw_row_kernels_t *const *impls, int count, int32_t w, int32_t h) {
+    const int32_t rounds = 20;
+    std::vector<uint16_t> fb(w * h, 0x1234);
+    std::vector<uint8_t> mask(w * h);
+    uint32_t seed = 7;
+    make_mask(mask, &seed);
+    double mpx = (double)w * h * rounds;
+    for (int kind = 0; kind < K_COUNT; kind++) {
+        printf("%-10s", kernel_names[kind]);
+        double ref_us = 0;
+        for (int impl = -1; impl < count; impl++) {
+            if (impl >= 0) draw_kernels_use(impls[impl]);
+            uint64_t t0 = kiosk_time_us();
+            for (int r = 0; r < rounds; r++) {
+                uint16_t color = (uint16_t)(0xF800 + r * 37);
+                if (impl >= 0) kernel(kind, fb.data(), w, h, w * 2, color, mask.data(), w, 128);
+                else reference(kind, fb.data(), w, h, w * 2, color, mask.data(), w, 128);
+            }
+            double us = (double)(kiosk_time_us() - t0);
+            if (impl < 0) {
+                ref_us = us;
+                printf("  viite %7.1f Mpx/s", mpx / us);
+            } else {
+                printf("  %s %7.1f Mpx/s (%.2fx)", impls[impl]->name, mpx / us, ref_us / us);
+            }
+        }
+        printf("\n");
+    }
+}
+
+uint32_t draw_kernels_check(const draw_row_kernels_t *const *impls, int count, uint32_t cases, int32_t bench_w,
+                            int32_t bench_h) {
+    uint32_t failures = 0;
+    for (int i = 0; i < count; i++) {
+        draw_kernels_use(impls[i]);
+        failures += check_random(cases);
+    }
+    bench(impls, count, bench_w, bench_h);
+    draw_kernels_use(NULL);
+    return failures;
+}
@@ -0,0 +1,78 @@
+#include "draw_stats.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "src/core/lv_global.h"  // Ympyrävälimuisti (LV_GLOBAL_DEFAULT()->sw_circle_cache)
+
+void __real_lv_draw_sw_mask_radius_init(lv_draw_sw_mask_radius_param_t *param, const lv_area_t *rect,
+                                        int32_t radius, bool inv);
+
+static draw_stats_t stats;
+static uint32_t frame_inits, frame_misses;
+
+static bool circle_cached(int32_t radius) {
+    for (int i = 0; i < LV_DRAW_SW_CIRCLE_CACHE_SIZE; i++) {
+        if (LV_GLOBAL_DEFAULT()->sw_circle_cache[i].radius == radius) return true;
+    }
+    return false;
+}
+
+void __wrap_lv_draw_sw_mask_radius_init(lv_draw_sw_mask_radius_param_t *param, const lv_area_t *rect,
+                                        int32_t radius, bool inv) {
+    // Sama rajaus kuin LVGL:ssä ennen välimuistihakua
+    int32_t short_side = LV_MIN(lv_area_get_width(rect), lv_area_get_height(rect));
+    int32_t r = LV_MIN(radius, short_side >> 1);
+    if (r > 0) {
+        frame_inits++;
+        if (!circle_cached(r)) frame_misses++;
+    }
+    __real_lv_draw_sw_mask_radius_init(param, rect, radius, inv);
+}
+
+static void render_start_cb(lv_event_t *e) {
+    (void)e;
+    frame_inits = frame_misses = 0;
+}
+
+static void render_ready_cb(lv_event_t *e) {
+    (void)e;
+    stats.frames++;
+    stats.mask_inits += frame_inits;
+    stats.mask_misses += frame_misses;
+    stats.last_frame_inits = frame_inits;
+    stats.last_frame_misses = frame_misses;
+    if (frame_misses > stats.max_frame_misses) stats.max_frame_misses = frame_misses;
+}
+
+void draw_stats_attach(lv_display_t *disp) {
+    lv_display_add_event_cb(disp, render_start_cb, LV_EVENT_RENDER_START, NULL);
+    lv_display_add_event_cb(disp, render_ready_cb, LV_EVENT_RENDER_READY, NULL);
+}
+
+void draw_stats_get(draw_stats_t *out) {
+    *out = stats;
+    out->cache_entries = 0;
+    out->cache_bytes = 0;
+    for (int i = 0; i < LV_DRAW_SW_CIRCLE_CACHE_SIZE; i++) {
+        int32_t r = LV_GLOBAL_DEFAULT()->sw_circle_cache[i].radius;
+        if (r <= 0) continue;
+        out->cache_entries++;
+        out->cache_bytes += r * 6 + 6;
+    }
+}
+
+void draw_stats_reset(void) {
+    memset(&stats, 0, sizeof(stats));
+}
+
+void draw_stats_print(void) {
+    draw_stats_t s;
+    draw_stats_get(&s);
+    printf("[draw] %lu ruutua, kulmamaskeja %lu (%.1f / ruutu), uudelleenlaskuja %lu (%.2f / ruutu, max %lu), "
+           "välimuisti %lu/%d paikkaa, ~%lu tavua\n",
+           (unsigned long)s.frames, (unsigned long)s.mask_inits, s.frames ? (double)s.mask_inits / s.frames : 0.0,
+           (unsigned long)s.mask_misses, s.frames ? (double)s.mask_misses / s.frames : 0.0,
+           (unsigned long)s.max_frame_misses, (unsigned long)s.cache_entries, LV_DRAW_SW_CIRCLE_CACHE_SIZE,
+           (unsigned long)s.cache_bytes);
+}
@@ -0,0 +1,240 @@
+#include "http_client.h"
+#include "kiosk_config.h"
+
+#ifdef ARDUINO
+
+#include <WiFi.h>
+#include <HTTPClient.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+bool net_is_up() {
+    return WiFi.status() == WL_CONNECTED;
+}
+
+// Kevyt uni katkaisee radion joka tapauksessa, ja tukiasema pudottaa aseman minuutin
+// unen aikana; hallittu katkaisu ja uusi yhteys herätessä ovat nopeampia kuin
+// automaattisen uudelleenyhdistyksen odottaminen
+void net_suspend() {
+    if (strlen(KIOSK_WIFI_SSID) > 0) WiFi.disconnect(true);
+}
+
+bool net_resume() {
+    if (strlen(KIOSK_WIFI_SSID) == 0) return false;
+    WiFi.mode(WIFI_STA);
+    WiFi.begin(KIOSK_WIFI_SSID, KIOSK_WIFI_PASSWORD);
+    return true;
+}
+
+int http_post(const char *url, const char *content_type, const char *content_encoding,
+              const char *idempotency_key, const uint8_t *body, size_t len, uint32_t timeout_ms) {
+    HTTPClient http;
+    http.setTimeout(timeout_ms);
+    http.setConnectTimeout(timeout_ms);
+    if (!http.begin(url)) return -1;
+    http.addHeader("Content-Type", content_type);
+    if (content_encoding) http.addHeader("Content-Encoding", content_encoding);
+    if (idempotency_key) http.addHeader("Idempotency-Key", idempotency_key);
+    int code = http.POST((uint8_t *)body, len);
+    http.end();
+    return code;
+}
+
+int http_get_file(const char *url, const char *path, uint32_t timeout_ms) {
+    HTTPClient http;
+    http.setTimeout(timeout_ms);
+    http.setConnectTimeout(timeout_ms);
+    if (!http.begin(url)) return -1;
+    int code = http.GET();
+    if (code == 200) {
+        FILE *f = fopen(path, "wb");
+        if (!f) {
+            http.end();
+            return -4;
+        }
+        WiFiClient *stream = http.getStreamPtr();
+        int remaining = http.getSize(); // -1 = pituus ei tiedossa
+        uint8_t buf[1024];
+        uint32_t last = millis();
+        while (http.connected() && (remaining > 0 || remaining == -1)) {
+            size_t avail = stream->available();
+            if (avail == 0) {
+                if (millis() - last > timeout_ms) {
+                    code = -2;
+                    break;
+                }
+                delay(1);
+                continue;
+            }
+            int n = stream->readBytes(buf, avail < sizeof(buf) ? avail : sizeof(buf));
+            if (fwrite(buf, 1, n, f) != (size_t)n) {
+                code = -5; // Tiedostojärjestelmä täynnä
+                break;
+            }
+            if (remaining > 0) remaining -= n;
+            last = millis();
+        }
+        if (code == 200 && remaining > 0) code = -2;
+        if (fflush(f) != 0 && code == 200) code = -5;
+        fsync(fileno(f));
+        fclose(f);
+        if (code != 200) remove(path); // Ei katkennutta tiedostoa
+    }
+    http.end();
+    return code;
+}
+
+#else
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <netdb.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+
+bool net_is_up() {
+    return true;
+}
+
+void net_suspend() {}
+
+bool net_resume() {
+    return false;
+}
+
+// Pelkistetty HTTP/1.1-asiakas paikallista testipalvelinta varten (ei TLS:ää)
+static int http_connect(const char *url, char *path, size_t path_size, char *host, size_t host_size, uint32_t timeout_ms) {
+    if (strncmp(url, "http://", 7) != 0) return -1;
+    const char *p = url + 7;
+    const char *slash = strchr(p, '/');
+    size_t host_len = slash ? (size_t)(slash - p) : strlen(p);
+    if (host_len >= host_size) return -1;
+    memcpy(host, p, host_len);
+    host[host_len] = '\0';
+    snprintf(path, path_size, "%s", slash ? slash : "/");
+
+    char name[128];
+    snprintf(name, sizeof(name), "%s", host);
+    const char *port = "80";
+    char *colon = strchr(name, ':');
+    if (colon) {
+        *colon = '\0';
+        port = colon + 1;
+    }
+
+    struct addrinfo hints = {}, *res = NULL;
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    if (getaddrinfo(name, port, &hints, &res) != 0) return -1;
+
+    int fd = -1;
+    for (struct addrinfo *ai = res; ai; ai = ai->ai_next) {
+        fd = socket(ai->ai_family, ai->ai_socktype, ai->ai_protocol);
+        if (fd < 0) continue;
+        struct timeval tv = { (time_t)(timeout_ms / 1000), (suseconds_t)((timeout_ms % 1000) * 1000) };
+        setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+        setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof(tv));
+        if (connect(fd, ai->ai_addr, ai->ai_addrlen) == 0) break;
+        close(fd);
+        fd = -1;
+    }
+    freeaddrinfo(res);
+    return fd;
+}
+
+static bool send_all(int fd, const void *data, size_t len) {
+    const char *p = (const char *)data;
+    while (len) {
+        ssize_t n = send(fd, p, len, 0);
+        if (n <= 0) return false;
+        p += n;
+        len -= (size_t)n;
+    }
+    return true;
+}
+
+int http_post(const char *url, const char *content_type, const char *content_encoding,
+              const char *idempotency_key, const uint8_t *body, size_t len, uint32_t timeout_ms) {
+    char path[256], host[128];
+    int fd = http_connect(url, path, sizeof(path), host, sizeof(host), timeout_ms);
+    if (fd < 0) return -1;
+
+    char head[512];
+    int head_len = snprintf(head, sizeof(head),
+                            "POST %s HTTP/1.1\r\nHost: %s\r\nContent-Type: %s\r\nContent-Length: %zu\r\n"
+                            "%s%s%s%s%s%sConnection: close\r\n\r\n",
+                            path, host, content_type, len,
+                            content_encoding ? "Content-Encoding: " : "", content_encoding ? content_encoding : "",
+                            content_encoding ? "\r\n" : "",
+                            idempotency_key ? "Idempotency-Key: " : "", idempotency_key ? idempotency_key : "",
+                            idempotency_key ? "\r\n" : "");
+
+    int code = -2;
+    if (send_all(fd, head, (size_t)head_len) && send_all(fd, body, len)) {
+        char buf[512];
+        ssize_t n = recv(fd, buf, sizeof(buf) - 1, 0);
+        if (n > 0) {
+            buf[n] = '\0';
+            if (sscanf(buf, "HTTP/%*s %d", &code) != 1) code = -3;
+        }
+        while (n > 0) n = recv(fd, buf, sizeof(buf), 0); // Luetaan vastaus loppuun ennen sulkemista
+    }
+    close(fd);
+    return code;
+}
+
+int http_get_file(const char *url, const char *path, uint32_t timeout_ms) {
+    char file_path[256], host[128];
+    int fd = http_connect(url, file_path, sizeof(file_path), host, sizeof(host), timeout_ms);
+    if (fd < 0) return -1;
+
+    char head[512];
+    int head_len = snprintf(head, sizeof(head), "GET %s HTTP/1.1\r\nHost: %s\r\nConnection: close\r\n\r\n",
+                            file_path, host);
+    if (!send_all(fd, head, (size_t)head_len)) {
+        close(fd);
+        return -2;
+    }
+
+    // Otsakkeet luetaan tyhjään riviin asti, loput on runkoa
+    char buf[4096];
+    size_t used = 0;
+    char *body = NULL;
+    while (!body && used < sizeof(buf) - 1) {
+        ssize_t n = recv(fd, buf + used, sizeof(buf) - 1 - used, 0);
+        if (n <= 0) break;
+        used += (size_t)n;
+        buf[used] = '\0';
+        body = strstr(buf, "\r\n\r\n");
+    }
+    int code = -3;
+    if (!body || sscanf(buf, "HTTP/%*s %d", &code) != 1) {
+        close(fd);
+        return -3;
+    }
+    body += 4;
+
+    if (code == 200) {
+        FILE *f = fopen(path, "wb");
+        if (!f) {
+            close(fd);
+            return -4;
+        }
+        size_t first = used - (size_t)(body - buf);
+        bool ok = fwrite(body, 1, first, f) == first;
+        ssize_t n;
+        while (ok && (n = recv(fd, buf, sizeof(buf), 0)) > 0) ok = fwrite(buf, 1, (size_t)n, f) == (size_t)n;
+        ok = fclose(f) == 0 && ok;
+        if (!ok) {
+            remove(path); // Ei katkennutta tiedostoa
+            code = -5;
+        }
+    }
+    close(fd);
+    return code;
+}
+
+#endif
@@ -0,0 +1,138 @@
+#include "input_trace.h"
+#include "catalog.h"
+#include "kiosk_config.h"
+#include "kiosk_port.h"
+
+#include <lvgl.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#define MAX_POINTERS 2
+
+struct wrapped_indev_t {
+    lv_indev_t *indev;
+    lv_indev_read_cb_t read_cb;   // Alkuperäinen (ajurin) read_cb
+    lv_indev_state_t last_state;
+    lv_point_t last_point;
+};
+
+static wrapped_indev_t wrapped[MAX_POINTERS];
+static int wrapped_count = 0;
+static FILE *trace_file = NULL;
+static uint32_t start_tick;
+static uint32_t bytes_written;
+static uint32_t last_flush;
+
+static void write_event(input_event_t *ev) {
+    if (!trace_file) return;
+    ev->t_ms = lv_tick_elaps(start_tick);
+    if (fwrite(ev, sizeof(*ev), 1, trace_file) != 1 || (bytes_written += sizeof(*ev)) >= INPUT_TRACE_MAX_BYTES) {
+        printf("[trace] pysäytetty, %lu tavua\n", (unsigned long)bytes_written);
+        input_trace_stop();
+    }
+}
+
+// Sama kierto kuin LVGL:n indev-käsittelyssä: raaka (fyysinen) piste -> looginen
+static lv_point_t to_logical(lv_display_t *disp, lv_point_t p) {
+    lv_display_rotation_t rot = lv_display_get_rotation(disp);
+    int32_t hor = lv_display_get_physical_horizontal_resolution(disp);
+    int32_t ver = lv_display_get_physical_vertical_resolution(disp);
+    if (rot == LV_DISPLAY_ROTATION_180 || rot == LV_DISPLAY_ROTATION_270) {
+        p.x = hor - p.x - 1;
+        p.y = ver - p.y - 1;
+    }
+    if (rot == LV_DISPLAY_ROTATION_90 || rot == LV_DISPLAY_ROTATION_270) {
+        int32_t tmp = p.y;
+        p.y = p.x;
+        p.x = ver - tmp - 1;
+    }
+    return p;
+}
+
+static void traced_read_cb(lv_indev_t *indev, lv_indev_data_t *data) {
+    wrapped_indev_t *w = NULL;
+    for (int i = 0; i < wrapped_count; i++) {
+        if (wrapped[i].indev == indev) w = &wrapped[i];
+    }
+    if (!w) return;
+    w->read_cb(indev, data);
+
+    // Vain tilan muutokset ja liike painettuna; lepotilan toistuvat luvut ohitetaan
+    bool moved = data->point.x != w->last_point.x || data->point.y != w->last_point.y;
+    if (data->state == w->last_state && !(moved && data->state == LV_INDEV_STATE_PRESSED)) return;
+    w->last_state = data->state;
+    w->last_point = data->point;
+
+    lv_point_t p = to_logical(lv_indev_get_display(indev), data->point);
+    input_event_t ev = {};
+    ev.type = INPUT_EV_TOUCH;
+    ev.pressed = data->state == LV_INDEV_STATE_PRESSED;
+    ev.x = (int16_t)p.x;
+    ev.y = (int16_t)p.y;
+    write_event(&ev);
+}
+
+bool input_trace_start(const char *file_name) {
+    if (trace_file) return true;
+    char path[64];
+    kiosk_fs_path(path, sizeof(path), file_name);
+    trace_file = fopen(path, "wb");
+    if (!trace_file) {
+        printf("[trace] %s: avaus epäonnistui\n", path);
+        return false;
+    }
+    lv_display_t *disp = lv_display_get_default();
+    input_trace_header_t h = {};
+    memcpy(h.magic, INPUT_TRACE_MAGIC, 4);
+    h.hor_res = (uint16_t)lv_display_get_horizontal_resolution(disp);
+    h.ver_res = (uint16_t)lv_display_get_vertical_resolution(disp);
+    h.catalog_version = catalog_version();
+    h.catalog_count = catalog_count();
+    h.catalog_crc = catalog_crc();
+    fwrite(&h, sizeof(h), 1, trace_file);
+    bytes_written = sizeof(h);
+    start_tick = last_flush = lv_tick_get();
+
+    for (lv_indev_t *indev = lv_indev_get_next(NULL); indev && wrapped_count < MAX_POINTERS;
+         indev = lv_indev_get_next(indev)) {
+        if (lv_indev_get_type(indev) != LV_INDEV_TYPE_POINTER) continue;
+        wrapped_indev_t &w = wrapped[wrapped_count++];
+        w.indev = indev;
+        w.read_cb = lv_indev_get_read_cb(indev);
+        w.last_state = LV_INDEV_STATE_RELEASED;
+        w.last_point = { 0, 0 };
+        lv_indev_set_read_cb(indev, traced_read_cb);
+    }
+    printf("[trace] tallennus %s, %d osoitinlaitetta\n", path, wrapped_count);
+    return true;
+}
+
+void input_trace_stop() {
+    for (int i = 0; i < wrapped_count; i++) lv_indev_set_read_cb(wrapped[i].indev, wrapped[i].read_cb);
+    wrapped_count = 0;
+    if (trace_file) {
+        fclose(trace_file);
+        trace_file = NULL;
+    }
+}
+
+bool input_trace_active() {
+    return trace_file != NULL;
+}
+
+void input_trace_scan(uint32_t code) {
+    input_event_t ev = {};
+    ev.type = INPUT_EV_SCAN;
+    ev.code = code;
+    write_event(&ev);
+}
+
+void input_trace_poll() {
+    if (!trace_file || lv_tick_elaps(last_flush) < INPUT_TRACE_FLUSH_MS) return;
+    last_flush = lv_tick_get();
+    fflush(trace_file);
+#ifdef ARDUINO
+    fsync(fileno(trace_file));
+#endif
+}
@@ -0,0 +1,198 @@
+#include "kiosk_idle.h"
+#include "http_client.h"
+#include "kiosk_config.h"
+#include "kiosk_port.h"
+#include "klog.h"
+#include "sync.h"
+#include "tx_queue.h"
+
+#include <stdio.h>
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#include <esp32_smartdisplay.h>
+#include <driver/gpio.h>
+#include <esp_sleep.h>
+#endif
+
+#define IDLE_POLL_MS 20 // Valveillaoloikkunassa ei pyöritetä silmukkaa tyhjänä
+
+static lv_display_t *display;
+static kiosk_idle_state_t state = KIOSK_IDLE_ACTIVE;
+static kiosk_idle_stats_t stats;
+static uint32_t accounted_ms;
+static uint32_t awake_since;    // SLEEP: edellisen unen päättyminen
+static uint32_t sleep_started;  // SLEEP: tilaan siirtyminen
+static bool net_wait;           // SLEEP: WiFi yhdistää herätyksen jälkeen
+static uint32_t wake_request;   // kiosk_idle_wake(); atominen, muut tehtävät kirjoittavat
+static bool woke_by_gpio;       // Viimeisin uni päättyi GPIO-herätykseen
+
+static void backlight(float level) {
+#ifdef ARDUINO
+    smartdisplay_lcd_set_backlight(level);
+#else
+    (void)level;
+#endif
+}
+
+static void account(uint32_t now) {
+    stats.state_ms[state] += now - accounted_ms;
+    accounted_ms = now;
+}
+
+static void enter(kiosk_idle_state_t next) {
+    account(kiosk_time_ms());
+    state = next;
+}
+
+// Nukkuu, jos sync-tehtävä ei ole kesken pyynnön; false = yritetään seuraavalla kierroksella
+static bool sleep_once() {
+    if (!sync_sleep_begin()) return false;
+    stats.sleeps++;
+    net_suspend();
+#ifdef ARDUINO
+    esp_sleep_enable_timer_wakeup((uint64_t)IDLE_WAKE_PERIOD_MS * 1000);
+    if (KIOSK_TOUCH_WAKE_GPIO >= 0) gpio_wakeup_enable((gpio_num_t)KIOSK_TOUCH_WAKE_GPIO, GPIO_INTR_LOW_LEVEL);
+    if (KIOSK_SCANNER_WAKE_GPIO >= 0) gpio_wakeup_enable((gpio_num_t)KIOSK_SCANNER_WAKE_GPIO, GPIO_INTR_LOW_LEVEL);
+    esp_sleep_enable_gpio_wakeup();
+    Serial.flush(); // UART pysähtyy unen ajaksi
+    disableLoopWDT(); // Uni on pidempi kuin vahtikoiran aikaraja
+    esp_light_sleep_start();
+    // Syy heti: GT911:n INT-pulssi on ohi ennen kuin wake_cause() ehtii lukea tason
+    woke_by_gpio = esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_GPIO;
+    enableLoopWDT();
+#endif
+    net_wait = net_resume();
+    sync_sleep_end();
+    awake_since = kiosk_time_ms();
+    return true;
+}
+
+// Ajastinherätyksen jälkeen WiFille aikaa yhdistää (enintään IDLE_NET_WAIT_MS) ja
+// sync-tehtävälle IDLE_HOUSEKEEPING_MS yhteyden muodostumisesta
+static bool housekeeping_done(uint32_t now) {
+    if (net_wait) {
+        if (!net_is_up()) return now - awake_since >= IDLE_NET_WAIT_MS;
+        net_wait = false;
+        awake_since = now;
+    }
+    return now - awake_since >= IDLE_HOUSEKEEPING_MS;
+}
+
+// Herätyksen syy SLEEP-tilassa, 0 = jatketaan unta
+static int wake_cause() {
+    if (__atomic_exchange_n(&wake_request, 0, __ATOMIC_RELAXED)) return KIOSK_WAKE_SOFTWARE;
+#ifdef ARDUINO
+    bool gpio = woke_by_gpio;
+    woke_by_gpio = false;
+    if (KIOSK_TOUCH_WAKE_GPIO >= 0 && gpio_get_level((gpio_num_t)KIOSK_TOUCH_WAKE_GPIO) == 0) return KIOSK_WAKE_TOUCH;
+    if (KIOSK_SCANNER_WAKE_GPIO >= 0 && gpio_get_level((gpio_num_t)KIOSK_SCANNER_WAKE_GPIO) == 0)
+        return KIOSK_WAKE_SCANNER;
+    // Taso jo palannut: lyhyt pulssi on kosketus, viivakoodinlukija pitää linjan alhaalla
+    if (gpio) return KIOSK_TOUCH_WAKE_GPIO >= 0 ? KIOSK_WAKE_TOUCH : KIOSK_WAKE_SCANNER;
+#endif
+    return 0;
+}
+
+static void wake(int cause) {
+    uint64_t t0 = kiosk_time_us();
+    lv_display_trigger_activity(display);
+    if (cause == KIOSK_WAKE_TOUCH) {
+        // Herättävä kosketus ei paina painiketta, joka sattuu sormen alle
+        for (lv_indev_t *i = lv_indev_get_next(NULL); i; i = lv_indev_get_next(i)) {
+            if (lv_indev_get_type(i) == LV_INDEV_TYPE_POINTER) lv_indev_wait_release(i);
+        }
+    }
+    lv_refr_now(display); // Vain unen aikana likaantuneet alueet, muu kuva on yhä puskurissa
+    backlight(1.0f);
+    uint32_t us = (uint32_t)(kiosk_time_us() - t0);
+    stats.wakes++;
+    stats.wake_us_last = us;
+    if (us > stats.wake_us_max) stats.wake_us_max = us;
+    klog(KLOG_IDLE_WAKE, (uint32_t)cause, us, kiosk_time_ms() - sleep_started);
+    enter(KIOSK_IDLE_ACTIVE);
+}
+
+void kiosk_idle_begin(lv_display_t *disp) {
+    display = disp;
+    accounted_ms = kiosk_time_ms();
+#ifdef ARDUINO
+    // Kosketusohjaimen ajuri ei välttämättä käytä INT-linjaa, joten se asetetaan tuloksi tässä
+    if (KIOSK_TOUCH_WAKE_GPIO >= 0) {
+        gpio_set_direction((gpio_num_t)KIOSK_TOUCH_WAKE_GPIO, GPIO_MODE_INPUT);
+        gpio_pullup_en((gpio_num_t)KIOSK_TOUCH_WAKE_GPIO);
+    }
+    if (KIOSK_SCANNER_WAKE_GPIO >= 0) gpio_set_direction((gpio_num_t)KIOSK_SCANNER_WAKE_GPIO, GPIO_MODE_INPUT);
+#endif
+}
+
+bool kiosk_idle_poll() {
+    account(kiosk_time_ms());
+    if (state == KIOSK_IDLE_SLEEP) {
+        int cause = wake_cause();
+        if (cause) {
+            wake(cause);
+            return true;
+        }
+        if (!housekeeping_done(kiosk_time_ms()) || !sleep_once()) kiosk_delay_ms(IDLE_POLL_MS);
+        return false;
+    }
+
+    uint32_t inactive = lv_display_get_inactive_time(display);
+    if (__atomic_exchange_n(&wake_request, 0, __ATOMIC_RELAXED)) {
+        lv_display_trigger_activity(display);
+        inactive = 0;
+    }
+    if (state == KIOSK_IDLE_ACTIVE && inactive >= IDLE_DIM_MS) {
+        enter(KIOSK_IDLE_DIM);
+        backlight(IDLE_DIM_LEVEL);
+    } else if (state == KIOSK_IDLE_DIM && inactive < IDLE_DIM_MS) {
+        enter(KIOSK_IDLE_ACTIVE);
+        backlight(1.0f);
+    } else if (state == KIOSK_IDLE_DIM && inactive >= IDLE_SLEEP_MS && txq_pending() == 0) {
+        // Jonossa olevat tapahtumat lähetetään ennen unta; himmennettynä sync-tehtävä ehtii
+        enter(KIOSK_IDLE_SLEEP);
+        sleep_started = kiosk_time_ms();
+        awake_since = sleep_started - IDLE_HOUSEKEEPING_MS; // Uneen heti, kun sync-tehtävä ei ole kesken pyynnön
+        net_wait = false;
+        backlight(0.0f);
+        klog(KLOG_IDLE_SLEEP, inactive);
+        if (!sleep_once()) kiosk_delay_ms(IDLE_POLL_MS);
+        return false;
+    }
+    return true;
+}
+
+void kiosk_idle_wake() {
+    __atomic_store_n(&wake_request, 1, __ATOMIC_RELAXED);
+}
+
+kiosk_idle_state_t kiosk_idle_state() {
+    return state;
+}
+
+void kiosk_idle_get_stats(kiosk_idle_stats_t *out) {
+    account(kiosk_time_ms());
+    *out = stats;
+}
+
+void kiosk_idle_print_stats() {
+    kiosk_idle_stats_t s;
+    kiosk_idle_get_stats(&s);
+    uint32_t total = s.state_ms[KIOSK_IDLE_ACTIVE] + s.state_ms[KIOSK_IDLE_DIM] + s.state_ms[KIOSK_IDLE_SLEEP];
+    if (total == 0) total = 1;
+    printf("[idle] aktiivinen %lu %%, himmennetty %lu %%, lepo %lu %%; unia %lu, herätyksiä %lu, "
+           "herätys -> ruutu %lu us (suurin %lu us)\n",
+           (unsigned long)(100ull * s.state_ms[KIOSK_IDLE_ACTIVE] / total),
+           (unsigned long)(100ull * s.state_ms[KIOSK_IDLE_DIM] / total),
+           (unsigned long)(100ull * s.state_ms[KIOSK_IDLE_SLEEP] / total), (unsigned long)s.sleeps,
+           (unsigned long)s.wakes, (unsigned long)s.wake_us_last, (unsigned long)s.wake_us_max);
+    if (IDLE_MA_ACTIVE > 0 && IDLE_MA_DIM > 0 && IDLE_MA_SLEEP > 0) {
+        // Ei mittaus: kiosk_config.h:n tilakohtaiset virrat aikaosuuksilla painotettuna
+        uint64_t ma_ms = (uint64_t)IDLE_MA_ACTIVE * s.state_ms[KIOSK_IDLE_ACTIVE] +
+                         (uint64_t)IDLE_MA_DIM * s.state_ms[KIOSK_IDLE_DIM] +
+                         (uint64_t)IDLE_MA_SLEEP * s.state_ms[KIOSK_IDLE_SLEEP];
+        printf("[idle] ARVIO IDLE_MA_*-arvoista: keskivirta ~%lu mA (aina aktiivisena ~%d mA)\n",
+               (unsigned long)(ma_ms / total), IDLE_MA_ACTIVE);
+    }
+}
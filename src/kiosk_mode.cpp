@@ -0,0 +1,53 @@
+#include "kiosk_mode.h"
+#include "klog.h"
+#include "ui_lang.h"
+
+#include <string.h>
+
+const kiosk_mode_info_t kiosk_modes[KIOSK_MODE_COUNT] = {
+    { UI_STR_OTTO, UI_STR_PROMPT_OTTO },
+    { UI_STR_PALAUTUS, UI_STR_PROMPT_PALAUTUS },
+};
+
+lv_subject_t kiosk_mode_subject;
+
+void kiosk_mode_init(kiosk_mode_t initial) {
+    lv_subject_init_int(&kiosk_mode_subject, initial);
+}
+
+kiosk_mode_t kiosk_mode_get() {
+    return (kiosk_mode_t)lv_subject_get_int(&kiosk_mode_subject);
+}
+
+void kiosk_mode_set(kiosk_mode_t mode) {
+    // lv_subject_set_int ilmoittaa tarkkailijoille myös samasta arvosta
+    if (mode >= KIOSK_MODE_COUNT || mode == kiosk_mode_get()) return;
+    lv_subject_set_int(&kiosk_mode_subject, mode);
+    klog(KLOG_MODE, mode);
+}
+
+static void mode_button_clicked(lv_event_t *e) {
+    kiosk_mode_set((kiosk_mode_t)(intptr_t)lv_event_get_user_data(e));
+}
+
+void kiosk_mode_bind_button(lv_obj_t *btn, kiosk_mode_t mode) {
+    // Ei LV_OBJ_FLAG_CHECKABLE-lippua: LVGL vaihtaisi tilan itse ja sidonta kääntäisi sen takaisin
+    lv_obj_remove_flag(btn, LV_OBJ_FLAG_CHECKABLE);
+    lv_obj_bind_state_if_eq(btn, &kiosk_mode_subject, LV_STATE_CHECKED, mode);
+    lv_obj_add_event_cb(btn, mode_button_clicked, LV_EVENT_CLICKED, (void *)(intptr_t)mode);
+}
+
+// Sekä tilan että kielen tarkkailija: teksti luetaan aina molemmista subjekteista
+static void prompt_observer(lv_observer_t *observer, lv_subject_t *subject) {
+    (void)subject;
+    lv_obj_t *label = lv_observer_get_target_obj(observer);
+    int32_t mode = lv_subject_get_int(&kiosk_mode_subject);
+    if (mode < 0 || mode >= KIOSK_MODE_COUNT) return;
+    const char *text = ui_tr(kiosk_modes[mode].prompt);
+    if (strcmp(lv_label_get_text(label), text) != 0) lv_label_set_text_static(label, text);
+}
+
+void kiosk_mode_bind_prompt(lv_obj_t *label) {
+    lv_subject_add_observer_obj(&kiosk_mode_subject, prompt_observer, label, NULL);
+    lv_subject_add_observer_obj(&ui_lang_subject, prompt_observer, label, NULL);
+}
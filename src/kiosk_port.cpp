@@ -0,0 +1,123 @@
+#include "kiosk_port.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#include <LittleFS.h>
+#include <esp_timer.h>
+#include <esp_heap_caps.h>
+#include <esp_system.h>
+#else
+#include <chrono>
+#include <thread>
+#include <sys/stat.h>
+#endif
+
+void kiosk_fs_path(char *out, size_t out_size, const char *name) {
+    snprintf(out, out_size, "%s/%s", KIOSK_FS_ROOT, name);
+}
+
+uint32_t kiosk_crc32(const void *data, size_t len, uint32_t crc) {
+    const uint8_t *p = (const uint8_t *)data;
+    crc = ~crc;
+    while (len--) {
+        crc ^= *p++;
+        for (int i = 0; i < 8; i++) crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1)));
+    }
+    return ~crc;
+}
+
+#ifdef ARDUINO
+
+bool kiosk_fs_begin() {
+    return LittleFS.begin(true); // Alustetaan osio, jos se ei ole vielä LittleFS
+}
+
+bool kiosk_warm_reset() {
+    switch (esp_reset_reason()) {
+    case ESP_RST_SW:
+    case ESP_RST_PANIC:
+    case ESP_RST_INT_WDT:
+    case ESP_RST_TASK_WDT:
+    case ESP_RST_WDT:
+    case ESP_RST_DEEPSLEEP:
+        return true;
+    default:
+        return false; // Virran kytkentä, jännitekatko: RTC-muisti on roskaa
+    }
+}
+
+void *kiosk_psram_alloc(size_t size) {
+    return heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+}
+
+void kiosk_psram_free(void *p) {
+    heap_caps_free(p);
+}
+
+void kiosk_psram_usage(size_t *used, size_t *total) {
+    *total = heap_caps_get_total_size(MALLOC_CAP_SPIRAM);
+    *used = *total - heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
+}
+
+uint64_t kiosk_time_us() {
+    return (uint64_t)esp_timer_get_time();
+}
+
+uint32_t kiosk_time_ms() {
+    return millis();
+}
+
+void kiosk_delay_ms(uint32_t ms) {
+    vTaskDelay(pdMS_TO_TICKS(ms));
+}
+
+bool kiosk_task_start(kiosk_task_fn_t fn, const char *name, uint32_t stack, int prio, int core, void *arg) {
+    return xTaskCreatePinnedToCore(fn, name, stack, arg, prio, NULL, core) == pdPASS;
+}
+
+#else
+
+bool kiosk_fs_begin() {
+    mkdir(KIOSK_FS_ROOT, 0755);
+    return true;
+}
+
+bool kiosk_warm_reset() {
+    return false;
+}
+
+void *kiosk_psram_alloc(size_t size) {
+    return malloc(size);
+}
+
+void kiosk_psram_free(void *p) {
+    free(p);
+}
+
+void kiosk_psram_usage(size_t *used, size_t *total) {
+    *used = *total = 0;
+}
+
+uint64_t kiosk_time_us() {
+    using namespace std::chrono;
+    return duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+uint32_t kiosk_time_ms() {
+    return (uint32_t)(kiosk_time_us() / 1000);
+}
+
+void kiosk_delay_ms(uint32_t ms) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+bool kiosk_task_start(kiosk_task_fn_t fn, const char *name, uint32_t stack, int prio, int core, void *arg) {
+    (void)name; (void)stack; (void)prio; (void)core;
+    std::thread(fn, arg).detach();
+    return true;
+}
+
+#endif
@@ -0,0 +1,37 @@
+#include "kiosk_tick.h"
+#include "kiosk_port.h"
+
+#include <lvgl.h>
+
+static uint32_t sim_now;
+static bool sim_active;
+
+static uint32_t sim_tick() {
+    return sim_now;
+}
+
+void kiosk_tick_use(kiosk_tick_source_t source) {
+    sim_active = source == sim_tick;
+    lv_tick_set_cb(source);
+}
+
+void kiosk_tick_use_real() {
+    kiosk_tick_use(kiosk_time_ms);
+}
+
+void kiosk_tick_use_sim(uint32_t start_ms) {
+    sim_now = start_ms;
+    kiosk_tick_use(sim_tick);
+}
+
+bool kiosk_tick_is_sim() {
+    return sim_active;
+}
+
+void kiosk_tick_advance(uint32_t ms) {
+    sim_now += ms;
+}
+
+uint32_t kiosk_tick_sim_now() {
+    return sim_now;
+}
@@ -0,0 +1,149 @@
+#include "klog.h"
+#include "kiosk_port.h"
+
+#include <stdio.h>
+#include <string.h>
+
+struct klog_limit_t {
+    uint32_t window;       // Sekunti, jota count koskee
+    uint16_t count;
+    uint16_t suppressed;
+};
+
+static klog_entry_t ring[KLOG_ENTRIES];
+static uint32_t head;      // Atominen: UI-silmukka ja sync-tehtävä kirjoittavat eri ytimiltä
+static uint32_t dropped;
+static uint32_t rate = KLOG_RATE_PER_S;
+// Kilpailu rajoittimen laskureista ytimien välillä vain heiluttaa rajaa, ei riko merkintöjä
+static klog_limit_t limits[KLOG_EVENT_COUNT];
+// klog_mirror(): toinen rengas, johon jokainen merkintä kopioidaan kirjoitettaessa
+static klog_entry_t *mirror;
+static uint32_t mirror_mask;
+static uint32_t *mirror_head;
+
+void klog(klog_event_t ev, uint32_t a, uint32_t b, uint32_t c) {
+    uint32_t now = kiosk_time_ms();
+    klog_limit_t &l = limits[ev];
+    if (rate) {
+        uint32_t window = now / 1000;
+        if (l.window != window) {
+            l.window = window;
+            l.count = 0;
+        }
+        if (l.count >= rate) {
+            if (l.suppressed < 0xFFFF) l.suppressed++;
+            dropped++;
+            return;
+        }
+        l.count++;
+    }
+    klog_entry_t e;
+    e.t_ms = now;
+    e.event = ev;
+    e.suppressed = l.suppressed;
+    e.args[0] = a;
+    e.args[1] = b;
+    e.args[2] = c;
+    l.suppressed = 0;
+    ring[__atomic_fetch_add(&head, 1, __ATOMIC_RELAXED) & (KLOG_ENTRIES - 1)] = e;
+    uint32_t *mh = __atomic_load_n(&mirror_head, __ATOMIC_ACQUIRE);
+    if (mh) mirror[__atomic_fetch_add(mh, 1, __ATOMIC_RELAXED) & mirror_mask] = e;
+}
+
+void klog_mirror(klog_entry_t *buf, uint32_t entries, uint32_t *mhead) {
+    __atomic_store_n(&mirror_head, (uint32_t *)NULL, __ATOMIC_RELEASE);
+    if (!buf || !entries) return;
+    mirror = buf;
+    mirror_mask = entries - 1;
+    __atomic_store_n(&mirror_head, mhead, __ATOMIC_RELEASE);
+}
+
+uint32_t klog_tail(klog_entry_t *out, uint32_t max) {
+    uint32_t h = __atomic_load_n(&head, __ATOMIC_RELAXED);
+    uint32_t n = h < max ? h : max;
+    if (n > KLOG_ENTRIES) n = KLOG_ENTRIES;
+    for (uint32_t i = 0; i < n; i++) out[i] = ring[(h - n + i) & (KLOG_ENTRIES - 1)];
+    return n;
+}
+
+static const char *const event_names[KLOG_EVENT_COUNT] = {
+#define KLOG_NAME(name, fmt) #name,
+    KLOG_EVENTS(KLOG_NAME)
+#undef KLOG_NAME
+};
+
+const char *klog_event_name(uint16_t ev) {
+    return ev < KLOG_EVENT_COUNT ? event_names[ev] : "?";
+}
+
+void klog_set_rate(uint32_t per_s) {
+    rate = per_s;
+}
+
+// Otsake ja merkinnät vanhimmasta alkaen; write palauttaa false virheestä
+template <typename W>
+static bool dump(W write, uint32_t *count) {
+    klog_header_t h;
+    memcpy(h.magic, KLOG_MAGIC, 4);
+    h.event_count = KLOG_EVENT_COUNT;
+    h.entry_size = sizeof(klog_entry_t);
+    h.head = __atomic_load_n(&head, __ATOMIC_RELAXED);
+    h.entries = KLOG_ENTRIES;
+    h.dropped = dropped;
+    *count = h.head < KLOG_ENTRIES ? h.head : KLOG_ENTRIES;
+    if (!write(&h, sizeof(h))) return false;
+    for (uint32_t i = h.head - *count; i != h.head; i++) {
+        if (!write(&ring[i & (KLOG_ENTRIES - 1)], sizeof(klog_entry_t))) return false;
+    }
+    return true;
+}
+
+static const char b64[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+// 48 tavua riville (64 merkkiä base64:nä)
+static uint8_t line_buf[48];
+static size_t line_len;
+
+static void line_flush() {
+    char out[70];
+    char *p = out;
+    for (size_t i = 0; i < line_len; i += 3) {
+        uint32_t v = (uint32_t)line_buf[i] << 16;
+        if (i + 1 < line_len) v |= (uint32_t)line_buf[i + 1] << 8;
+        if (i + 2 < line_len) v |= line_buf[i + 2];
+        *p++ = b64[(v >> 18) & 63];
+        *p++ = b64[(v >> 12) & 63];
+        *p++ = i + 1 < line_len ? b64[(v >> 6) & 63] : '=';
+        *p++ = i + 2 < line_len ? b64[v & 63] : '=';
+    }
+    *p = 0;
+    printf("@KLOG %s\n", out);
+    line_len = 0;
+}
+
+void klog_dump_console() {
+    line_len = 0;
+    uint32_t n;
+    dump([](const void *data, size_t len) {
+        const uint8_t *p = (const uint8_t *)data;
+        while (len--) {
+            line_buf[line_len++] = *p++;
+            if (line_len == sizeof(line_buf)) line_flush();
+        }
+        return true;
+    }, &n);
+    if (line_len) line_flush();
+    printf("@KLOG end\n");
+    fflush(stdout);
+    klog(KLOG_DUMP, n);
+}
+
+bool klog_dump_file(const char *path) {
+    FILE *f = fopen(path, "wb");
+    if (!f) return false;
+    uint32_t n;
+    bool ok = dump([f](const void *data, size_t len) { return fwrite(data, len, 1, f) == 1; }, &n);
+    ok = fclose(f) == 0 && ok;
+    klog(KLOG_DUMP, n);
+    return ok;
+}
@@ -1,121 +1,100 @@
 #include <Arduino.h>
 #include <lvgl.h>
 #include <esp32_smartdisplay.h>
-#include "Arial_70.c" // Varmista, että Arial 40 fontti on muunnettu ja tiedosto on oikeassa kansiossa
-
-lv_obj_t *label; // Määritellään muuttuja tekstilabelille
-lv_obj_t *btn1, *btn2; // Painikkeet
-
-// Tapahtumakäsittelijä painikkeille
-void button_event_handler(lv_event_t *e) {
-    lv_obj_t *btn = (lv_obj_t *)lv_event_get_target(e); // Haetaan painike
-    
-    // Jos btn1 painetaan, deaktivoi btn2 ja aktivoi btn1
-    if (btn == btn1) {
-        lv_obj_add_state(btn1, LV_STATE_CHECKED); // Aktivoi btn1
-        lv_obj_clear_state(btn2, LV_STATE_CHECKED); // Deaktivoi btn2
-        // lv_label_set_text(label, "Otto painettu"); // Päivitä label
-    }
-    // Jos btn2 painetaan, deaktivoi btn1 ja aktivoi btn2
-    else if (btn == btn2) {
-        lv_obj_add_state(btn2, LV_STATE_CHECKED); // Aktivoi btn2
-        lv_obj_clear_state(btn1, LV_STATE_CHECKED); // Deaktivoi btn1
-        // lv_label_set_text(label, "Palautus painettu"); // Päivitä label
-    }
-}
+#include <WiFi.h>
+#include "kiosk_config.h"
+#include "kiosk_idle.h"
+#include "kiosk_port.h"
+#include "kiosk_tick.h"
+#include "klog.h"
+#include "tx_queue.h"
+#include "catalog.h"
+#include "sync.h"
+#include "ui_queue.h"
+#include "kiosk_mode.h"
+#include "screens.h"
+#include "ui_lang.h"
+#include "ui_font_ttf.h"
+#include "ui_assets.h"
+#include "ui_screens.h"
+#include "ui_resume.h"
+#include "ui_snappy.h"
+#include "input_trace.h"
+#include "draw_kernels.h"
+#include "draw_stats.h"
+#include "perf_overlay.h"
+#include "profiler_export.h"
+#include "postmortem.h"
 
 void setup() {
+    Serial.begin(KIOSK_SERIAL_BAUD);
     smartdisplay_init();
+    kiosk_tick_use_real(); // LVGL lukee ajan itse, loop() ei kasvata tickiä
 
     auto display = lv_display_get_default();
     lv_display_set_rotation(display, LV_DISPLAY_ROTATION_270);
+    draw_stats_attach(display); // Kulmamaskien laskurit: suorituskykyruutu ja ylläpitonäkymä
+    perf_overlay_attach(display); // Suorituskykyruutu, pitkä painallus päänäkymän tekstiin
+    kiosk_idle_begin(display); // Himmennys ja kevyt uni joutoaikana
+    if (LV_USE_PROFILER) profiler_export_start(NULL); // Profiloijaympäristössä jäljet sarjaporttiin taustatehtävästä
+    if (KIOSK_KERNEL_CHECK) {
+        // Piirtoytimet laitteella: C ja PIE bitilleen LVGL:n sekoitusta vastaan
+        const draw_row_kernels_t *impls[2] = { draw_kernels_c(), draw_kernels_default() };
+        int count = impls[1] != impls[0] ? 2 : 1;
+        draw_kernels_check(impls, count, KIOSK_KERNEL_CHECK_CASES, lv_display_get_horizontal_resolution(display),
+                           KIOSK_KERNEL_BENCH_ROWS);
+    }
 
-    // Luo taustakappale
-    lv_obj_t *background = lv_obj_create(lv_scr_act());
-    lv_obj_set_size(background, LV_HOR_RES, LV_VER_RES);
-    lv_obj_set_style_bg_color(background, lv_color_black(), 0);
-    lv_obj_set_style_border_width(background, 0, 0);  // Poista reunat
-    lv_obj_set_style_pad_all(background, 0, 0);       // Poista kaikki paddingit
-    lv_obj_set_style_radius(background, 0, 0); // Aseta kulmaradius nollaksi
-
-    // Luo globaali tyyli Arial 40 fontilla
-    static lv_style_t style;
-    lv_style_init(&style);
-    lv_style_set_text_font(&style, &Arial_70);  // Asetetaan Arial 40 fontti tyyliin
-    lv_style_set_text_color(&style, lv_color_white());  // Asetetaan tekstin väri valkoiseksi
-
-    // Aseta tyyli globaalisti taustakappaleeseen
-    lv_obj_add_style(background, &style, 0);
-
-    // Luo tyyli painikkeille (ei-aktiivinen tila)
-    static lv_style_t btn_style;
-    lv_style_init(&btn_style);
-    lv_style_set_radius(&btn_style, LV_RADIUS_CIRCLE);  // Aseta painikkeiden pyöristys
-    lv_style_set_bg_color(&btn_style, lv_color_make(0, 0, 0)); // Musta tausta ei-aktiiviselle painikkeelle
-    lv_style_set_text_font(&btn_style, &Arial_70);  // Arial 40 fontti painikkeissa
-    lv_style_set_text_color(&btn_style, lv_color_white());  // Tekstin väri valkoiseksi
-    lv_style_set_border_color(&btn_style, lv_color_white()); // Reunan väri valkoiseksi
-    lv_style_set_border_width(&btn_style, 2);  // Reunan leveys
-    lv_style_set_pad_all(&btn_style, 0); // Poista ylimääräiset marginaalit painikkeilta
-
-    // Luo tyyli aktiiviselle (valitulle) painikkeelle
-    static lv_style_t btn_checked_style;
-    lv_style_init(&btn_checked_style);
-    lv_style_set_radius(&btn_checked_style, LV_RADIUS_CIRCLE);  // Pyöristys säilyy
-    lv_style_set_bg_color(&btn_checked_style, lv_color_make(255, 200, 0));  // Keltainen väri (RGB: 255, 255, 0)
-    lv_style_set_text_font(&btn_checked_style, &Arial_70);  // Arial 40 fontti aktiivisessa painikkeessa
-    lv_style_set_text_color(&btn_checked_style, lv_color_black());  // Tekstin väri mustaksi aktiivisessa tilassa
-    lv_style_set_border_color(&btn_checked_style, lv_color_white()); // Reunan väri valkoiseksi
-    lv_style_set_border_width(&btn_checked_style, 2);  // Reunan leveys
-    lv_style_set_pad_all(&btn_checked_style, 0); // Poista ylimääräiset marginaalit aktiivisilta painikkeilta
-
-    // Luo label
-    label = lv_label_create(background);
-    lv_label_set_text(label, "Lue tuote");
-    lv_obj_align(label, LV_ALIGN_TOP_MID, 0, 10); // Asetetaan label yläreunaan keskelle
-    lv_obj_add_style(label, &style, 0);  // Asetetaan Arial 40 -fontin tyyli labeliin
-
-    // Luo ensimmäinen painike (Otto)
-    btn1 = lv_btn_create(background);
-    lv_obj_set_size(btn1, 400, 160);  // Painikkeen koko
-    lv_obj_align(btn1, LV_ALIGN_CENTER, 0, -100); // Keskelle ylös
-    lv_obj_add_event_cb(btn1, button_event_handler, LV_EVENT_CLICKED, NULL); // Lisää tapahtumakäsittelijä
-    lv_obj_add_flag(btn1, LV_OBJ_FLAG_CHECKABLE); // Aseta painike "toggle"-tilaan
-    lv_obj_add_style(btn1, &btn_style, 0); // Lisää ei-aktiivinen tyyli painikkeeseen
-    lv_obj_add_style(btn1, &btn_checked_style, LV_STATE_CHECKED); // Lisää aktiivinen (kelta) tyyli
-
-    // Luo painikkeen label ja aseta Arial 40 -fontti
-    lv_obj_t *label_btn1 = lv_label_create(btn1);
-    lv_label_set_text(label_btn1, "Otto"); // Asetetaan painikkeen teksti
-    lv_obj_center(label_btn1); // Keskitetään label painikkeeseen
-    lv_obj_add_style(label_btn1, &style, 0);  // Asetetaan Arial 40 -fontin tyyli
-
-    // Luo toinen painike (Palautus)
-    btn2 = lv_btn_create(background);
-    lv_obj_set_size(btn2, 400, 160);  // Painikkeen koko
-    lv_obj_align(btn2, LV_ALIGN_CENTER, 0, 100); // Keskelle alas
-    lv_obj_add_event_cb(btn2, button_event_handler, LV_EVENT_CLICKED, NULL); // Lisää tapahtumakäsittelijä
-    lv_obj_add_flag(btn2, LV_OBJ_FLAG_CHECKABLE); // Aseta painike "toggle"-tilaan
-    lv_obj_add_style(btn2, &btn_style, 0); // Lisää ei-aktiivinen tyyli painikkeeseen
-    lv_obj_add_style(btn2, &btn_checked_style, LV_STATE_CHECKED); // Lisää aktiivinen (kelta) tyyli
-
-    // Luo toisen painikkeen label ja aseta Arial 40 -fontti
-    lv_obj_t *label_btn2 = lv_label_create(btn2);
-    lv_label_set_text(label_btn2, "Palautus"); // Asetetaan painikkeen teksti
-    lv_obj_center(label_btn2); // Keskitetään label painikkeeseen
-    lv_obj_add_style(label_btn2, &style, 0);  // Asetetaan Arial 40 -fontin tyyli
-
-    // Oletuksena painike 1 (Otto) on aktiivinen
-    lv_obj_add_state(btn1, LV_STATE_CHECKED); // Painike 1 on aktiivinen alussa
+    // Tila (Otto/Palautus) on observer-subjekti, johon painikkeet ja label sidotaan
+    kiosk_mode_init(KIOSK_MODE_OTTO); // Oletuksena Otto
+    ui_lang_init(KIOSK_LANG_DEFAULT); // Tekstit ui/strings.json:sta, vaihto ylläpitonäkymästä
+    if (KIOSK_TTF_UI) ui_font_ttf_begin(); // Käyttöliittymän fontit TTF:stä, ks. platformio.ini env:esp32-8048S043C-ttf
+    if (KIOSK_ASSET_FONTS) ui_assets_begin(); // Käyttöliittymän fontit assets-osiolta, ks. env:esp32-8048S043C-assets
+
+    // Näkymät rakennetaan ensimmäisellä käytöllä ja pidetään muistissa, päänäkymä aina
+    screens_init();
+    ui_screens_register();
+    screens_show(SCREEN_MAIN);
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    klog(KLOG_BOOT, (uint32_t)mon.free_size);
+
+    // Taustatehtävät päivittävät näitä vain ui_queue-jonon kautta
+    ui_queue_register(UI_TARGET_LABEL, ui_main.prompt);
+    ui_queue_register(UI_TARGET_BTN1, ui_main.btn_otto);
+    ui_queue_register(UI_TARGET_BTN2, ui_main.btn_palautus);
+    ui_queue_register(UI_TARGET_STATUS, ui_main.status);
+
+    // Tapahtumajono flashille ja synkronointi taustalla (ydin 0)
+    kiosk_fs_begin();
+    postmortem_begin(display); // Edellisen kaatumisen raportti tiedostoon, kirjaus tästä eteenpäin
+    txq_begin();
+    catalog_begin();
+    ui_snappy_load(); // Ylläpitonäkymässä valittu nopea tila
+    // Vahtikoiran tai paniikin jälkeen takaisin samaan tilaan ja näkymään (RTC-muisti)
+    ui_resume_state_t resume;
+    if (ui_resume_load(&resume)) ui_screens_restore(&resume);
+    ui_resume_attach(display); // Tallentaa muutokset ja mittaa ajan ensimmäiseen ruutuun
+    if (INPUT_TRACE_RECORD) input_trace_start(); // Kosketukset ja viivakoodit tiedostoon
+    if (strlen(KIOSK_WIFI_SSID) > 0) {
+        WiFi.mode(WIFI_STA);
+        WiFi.setAutoReconnect(true);
+        WiFi.begin(KIOSK_WIFI_SSID, KIOSK_WIFI_PASSWORD); // Ei odoteta yhteyttä, sync-tehtävä odottaa sen
+    }
+    sync_start();
+    // Jumittunut UI-silmukka (esim. ikuinen piirto) käynnistää laitteen uudelleen
+    // vahtikoiralla; post-mortem kertoo, mihin ruutuun se jäi
+    enableLoopWDT();
 }
 
-auto lv_last_tick = millis();
-
 void loop() {
-    unsigned long now = millis(); // Saadaan nykyinen aikaleima
-    // Update the ticker
-    lv_tick_inc(now - lv_last_tick);
-    lv_last_tick = now;
+    if (!kiosk_idle_poll()) return; // Lepotila: ei piirtoa, jono tyhjennetään herätessä
+    // Taustatehtävien päivitykset kerran per kierros, sitten piirto
+    ui_queue_drain();
+    input_trace_poll();
+    bool dump = false;
+    while (Serial.available() > 0) dump |= Serial.read() == KLOG_DUMP_REQUEST;
+    if (dump) klog_dump_console(); // tools/klog_decode.py --port
     // Päivitä käyttöliittymä
     lv_timer_handler();
 }
@@ -0,0 +1,197 @@
+// Assets-osion fontit (ui_assets.h): binäärifontin lataus kokonaan muistiin vs. glyfin
+// lukeminen tiedostosta piirrettäessä. Nativessa osio on hakemisto assets/, joten
+// ajat ovat tiedostojärjestelmän välimuistista; laitteella LittleFS-osion luku on
+// hitaampi, mutta lukukertojen ja tavujen suhde on sama.
+//
+//   lataus: lv_binfont_create() + lv_binfont_destroy(), keskiarvo rounds kierrokselta
+//   suoratoisto: jokaisen glyfin otsake ja bittikartta erikseen lv_fs_seek/lv_fs_read
+//   (glyfien paikat, loca, luetaan kerran), kuten fontti, joka ei pidä bittikarttoja muistissa
+//
+// Ladatun fontin glyfit verrataan ohjelmaan linkitettyyn Arial_70:een.
+//
+// Kuvat (assets/images/*.bin, tools/image_build.py): otsakkeen tarkistus
+// ui_assets_image():lla ja kuvan piirto lv_snapshotilla, jolloin LVGL lukee koko
+// kuvan osiolta (ei kuvavälimuistia), keskiarvo rounds kierrokselta.
+
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+#include <lvgl.h>
+
+#include "kiosk_port.h"
+#include "sim_display.h"
+#include "sim_modes.h"
+#include "ui_assets.h"
+
+LV_FONT_DECLARE(Arial_70);
+
+#define FONT_PATH "A:fonts/Arial_70.bin"
+
+static size_t heap_used() {
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    return mon.total_size - mon.free_size;
+}
+
+// Taulukon pituus (otsake mukaan lukien) kohdasta at, 0 = eri taulukko
+static uint32_t read_label(lv_fs_file_t *f, uint32_t at, const char *label) {
+    uint32_t len;
+    char buf[4];
+    if (lv_fs_seek(f, at, LV_FS_SEEK_SET) != LV_FS_RES_OK || lv_fs_read(f, &len, 4, NULL) != LV_FS_RES_OK ||
+        lv_fs_read(f, buf, 4, NULL) != LV_FS_RES_OK || memcmp(buf, label, 4) != 0)
+        return 0;
+    return len;
+}
+
+static uint32_t bitmap_size(const lv_font_fmt_txt_dsc_t *dsc, uint32_t gid) {
+    const lv_font_fmt_txt_glyph_dsc_t *g = &dsc->glyph_dsc[gid];
+    return (g->box_w * g->box_h * dsc->bpp + 7) / 8;
+}
+
+// Glyfit samat kuin linkitetyssä fontissa (molemmissa sama merkistö ja glyfien järjestys)
+static bool same_glyphs(const lv_font_t *loaded, uint32_t *glyphs) {
+    const lv_font_fmt_txt_dsc_t *a = (const lv_font_fmt_txt_dsc_t *)Arial_70.dsc;
+    const lv_font_fmt_txt_dsc_t *b = (const lv_font_fmt_txt_dsc_t *)loaded->dsc;
+    if (a->cmap_num != b->cmap_num || a->bpp != b->bpp || Arial_70.line_height != loaded->line_height ||
+        Arial_70.base_line != loaded->base_line)
+        return false;
+    *glyphs = 0;
+    for (uint16_t i = 0; i < a->cmap_num; i++) *glyphs += a->cmaps[i].range_length;
+    for (uint32_t gid = 1; gid <= *glyphs; gid++) {
+        const lv_font_fmt_txt_glyph_dsc_t *ga = &a->glyph_dsc[gid], *gb = &b->glyph_dsc[gid];
+        if (ga->adv_w != gb->adv_w || ga->box_w != gb->box_w || ga->box_h != gb->box_h || ga->ofs_x != gb->ofs_x ||
+            ga->ofs_y != gb->ofs_y ||
+            memcmp(a->glyph_bitmap + ga->bitmap_index, b->glyph_bitmap + gb->bitmap_index, bitmap_size(a, gid)))
+            return false;
+    }
+    return true;
+}
+
+static bool stream_glyphs(uint32_t rounds, double *us_per_glyph, double *bytes_per_glyph) {
+    lv_fs_file_t f;
+    if (lv_fs_open(&f, FONT_PATH, LV_FS_MODE_RD) != LV_FS_RES_OK) return false;
+    uint32_t head = read_label(&f, 0, "head");
+    uint32_t cmap = head ? read_label(&f, head, "cmap") : 0;
+    uint32_t loca = cmap ? read_label(&f, head + cmap, "loca") : 0;
+    uint32_t glyf_start = head + cmap + loca;
+    uint32_t glyf = loca ? read_label(&f, glyf_start, "glyf") : 0;
+    uint32_t count = 0;
+    std::vector<uint32_t> offsets;
+    if (glyf && lv_fs_seek(&f, head + cmap + 8, LV_FS_SEEK_SET) == LV_FS_RES_OK &&
+        lv_fs_read(&f, &count, 4, NULL) == LV_FS_RES_OK) {
+        offsets.resize(count + 1);
+        lv_fs_read(&f, offsets.data(), count * 4, NULL); // font_build.py: 32-bittiset siirrot
+        offsets[count] = glyf;
+    }
+    if (offsets.empty()) {
+        lv_fs_close(&f);
+        return false;
+    }
+
+    std::vector<uint8_t> buf;
+    uint64_t bytes = 0;
+    uint64_t t0 = kiosk_time_us();
+    for (uint32_t r = 0; r < rounds; r++) {
+        for (uint32_t gid = 1; gid < count; gid++) {
+            uint32_t len = offsets[gid + 1] - offsets[gid];
+            buf.resize(len);
+            lv_fs_seek(&f, glyf_start + offsets[gid], LV_FS_SEEK_SET);
+            lv_fs_read(&f, buf.data(), len, NULL);
+            bytes += len;
+        }
+    }
+    uint64_t n = (uint64_t)rounds * (count - 1);
+    *us_per_glyph = (kiosk_time_us() - t0) / (double)n;
+    *bytes_per_glyph = bytes / (double)n;
+    lv_fs_close(&f);
+    return true;
+}
+
+static double draw_image_us(lv_obj_t *img, uint32_t rounds) {
+    lv_obj_update_layout(img);
+    int32_t w = lv_obj_get_width(img), h = lv_obj_get_height(img);
+    uint32_t stride = lv_draw_buf_width_to_stride(w, LV_COLOR_FORMAT_RGB565);
+    std::vector<uint8_t> data((size_t)stride * h);
+    lv_draw_buf_t buf;
+    lv_draw_buf_init(&buf, w, h, LV_COLOR_FORMAT_RGB565, stride, data.data(), data.size());
+    uint64_t t0 = kiosk_time_us();
+    for (uint32_t r = 0; r < rounds; r++) lv_snapshot_take_to_draw_buf(img, LV_COLOR_FORMAT_RGB565, &buf);
+    return (kiosk_time_us() - t0) / (double)rounds;
+}
+
+// Kaikki assets/images/*.bin; false, jos jokin kuva on virheellinen
+static bool bench_images(uint32_t rounds) {
+    lv_fs_dir_t dir;
+    if (lv_fs_dir_open(&dir, "A:images") != LV_FS_RES_OK) {
+        printf("A:images puuttuu (kuvat: ui/images/*.png, aja python3 tools/image_build.py)\n");
+        return true;
+    }
+    bool ok = true;
+    char fn[64];
+    lv_obj_t *img = lv_image_create(lv_screen_active());
+    while (lv_fs_dir_read(&dir, fn, sizeof(fn)) == LV_FS_RES_OK && fn[0]) {
+        size_t len = strlen(fn);
+        if (fn[0] == '/' || len < 5 || strcmp(fn + len - 4, ".bin") != 0) continue;
+        fn[len - 4] = '\0';
+        const char *src = ui_assets_image(fn);
+        if (!src) {
+            ok = false;
+            continue;
+        }
+        lv_image_header_t header;
+        lv_image_decoder_get_info(src, &header);
+        lv_image_set_src(img, src);
+        double us = draw_image_us(img, rounds);
+        double bytes = (double)header.stride * header.h;
+        printf("%s: %ux%u, piirto osiolta %.0f us (%.1f Mt/s)\n", src, (unsigned)header.w, (unsigned)header.h, us,
+               us > 0 ? bytes / us : 0.0);
+    }
+    lv_obj_delete(img);
+    lv_fs_dir_close(&dir);
+    ui_assets_stats_t st;
+    ui_assets_get_stats(&st);
+    printf("kuvia %lu, %lu tavua, otsakkeiden tarkistus %.0f us\n", (unsigned long)st.images,
+           (unsigned long)st.image_bytes, (double)st.image_us);
+    return ok;
+}
+
+int asset_bench(uint32_t rounds) {
+    sim_display_init();
+    if (!ui_assets_begin()) return 1;
+    if (rounds == 0) rounds = 1;
+
+    // Ensimmäinen lataus ui_assets_font():lla: tiedoston ja muistin koko
+    const lv_font_t *font = ui_assets_font("Arial_70");
+    if (!font) {
+        printf("%s puuttuu, aja python3 tools/font_build.py\n", FONT_PATH);
+        return 1;
+    }
+    ui_assets_stats_t st;
+    ui_assets_get_stats(&st);
+    uint32_t glyphs = 0;
+    bool same = same_glyphs(font, &glyphs);
+
+    uint64_t t0 = kiosk_time_us();
+    size_t heap0 = heap_used();
+    for (uint32_t r = 0; r < rounds; r++) {
+        lv_font_t *f = lv_binfont_create(FONT_PATH);
+        if (!f) return 1;
+        lv_binfont_destroy(f);
+    }
+    double load_us = (kiosk_time_us() - t0) / (double)rounds;
+
+    double glyph_us, glyph_bytes;
+    if (!stream_glyphs(rounds, &glyph_us, &glyph_bytes)) {
+        printf("%s: taulukot eivät täsmää\n", FONT_PATH);
+        return 1;
+    }
+    printf("%s: %lu tavua, %lu glyfiä, sama kuin linkitetty Arial_70: %s\n", FONT_PATH,
+           (unsigned long)st.file_bytes, (unsigned long)glyphs, same ? "kyllä" : "EI");
+    printf("lataus kokonaan: %.0f us, muistissa %lu tavua (vuoto %ld tavua)\n", load_us,
+           (unsigned long)st.heap_bytes, (long)(heap_used() - heap0));
+    printf("suoratoisto: %.2f us / glyfi, %.0f tavua / glyfi; koko merkistö kerran %.0f us\n", glyph_us,
+           glyph_bytes, glyph_us * glyphs);
+    bool images_ok = bench_images(rounds);
+    return same && images_ok ? 0 : 1;
+}
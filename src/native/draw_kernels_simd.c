@@ -0,0 +1,199 @@
+#include "draw_kernels_simd.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+// Rivin loppu (alle 8 tai 16 pikseliä) tehdään C-versiolla, joka laskee saman tuloksen
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <smmintrin.h>
+
+#define SSE41 __attribute__((target("sse4.1")))
+
+// 8 pikseliä kerrallaan kuten mix_spread(): 32-bittiset kaistat, joissa vihreä on
+// ylemmässä puolisanassa. mix on 0..255 16-bittisinä; 255 antaa suoraan värin.
+SSE41 static inline __m128i blend8(__m128i bg16, __m128i mix16, __m128i fg, __m128i color16) {
+    const __m128i rb_g = _mm_set1_epi32(0x7E0F81F);
+    const __m128i low16 = _mm_set1_epi32(0xFFFF);
+    const __m128i zero = _mm_setzero_si128();
+    __m128i m = _mm_srli_epi16(_mm_add_epi16(mix16, _mm_set1_epi16(4)), 3);
+    __m128i bg[2] = { _mm_unpacklo_epi16(bg16, zero), _mm_unpackhi_epi16(bg16, zero) };
+    __m128i ms[2] = { _mm_unpacklo_epi16(m, zero), _mm_unpackhi_epi16(m, zero) };
+    __m128i r[2];
+    for (int i = 0; i < 2; i++) {
+        __m128i b = _mm_and_si128(_mm_or_si128(bg[i], _mm_slli_epi32(bg[i], 16)), rb_g);
+        __m128i t = _mm_srli_epi32(_mm_mullo_epi32(_mm_sub_epi32(fg, b), ms[i]), 5);
+        t = _mm_and_si128(_mm_add_epi32(t, b), rb_g);
+        r[i] = _mm_and_si128(_mm_or_si128(t, _mm_srli_epi32(t, 16)), low16);
+    }
+    __m128i out = _mm_packus_epi32(r[0], r[1]);
+    return _mm_blendv_epi8(out, color16, _mm_cmpeq_epi16(mix16, _mm_set1_epi16(255)));
+}
+
+SSE41 static __m128i spread_sse(uint16_t color) {
+    uint32_t c = ((uint32_t)color | ((uint32_t)color << 16)) & 0x7E0F81Fu;
+    return _mm_set1_epi32((int)c);
+}
+
+SSE41 static void fill_row_sse(uint16_t *dest, int32_t w, uint16_t color) {
+    __m128i c = _mm_set1_epi16((short)color);
+    int32_t x = 0;
+    for (; x + 8 <= w; x += 8) _mm_storeu_si128((__m128i *)&dest[x], c);
+    for (; x < w; x++) dest[x] = color;
+}
+
+SSE41 static void opa_row_sse(uint16_t *dest, int32_t w, uint16_t color, uint8_t opa) {
+    __m128i fg = spread_sse(color), c = _mm_set1_epi16((short)color), mix = _mm_set1_epi16(opa);
+    // Tasaisella taustalla edellisen lohkon tulos kelpaa sellaisenaan
+    __m128i last_bg = _mm_set1_epi16((short)~dest[0]), last_res = c;
+    int32_t x = 0;
+    for (; x + 8 <= w; x += 8) {
+        __m128i bg = _mm_loadu_si128((const __m128i *)&dest[x]);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi16(bg, last_bg)) != 0xFFFF) {
+            last_bg = bg;
+            last_res = blend8(bg, mix, fg, c);
+        }
+        _mm_storeu_si128((__m128i *)&dest[x], last_res);
+    }
+    if (x < w) draw_kernels_default()->opa(&dest[x], w - x, color, opa);
+}
+
+SSE41 static void mask_row_sse(uint16_t *dest, int32_t w, uint16_t color, const uint8_t *mask) {
+    __m128i fg = spread_sse(color), c = _mm_set1_epi16((short)color), zero = _mm_setzero_si128();
+    int32_t x = 0;
+    for (; x + 16 <= w; x += 16) {
+        __m128i m = _mm_loadu_si128((const __m128i *)&mask[x]);
+        if (_mm_testz_si128(m, m)) continue; // Kokonaan läpinäkyvä
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(m, _mm_set1_epi8(-1))) == 0xFFFF) {
+            _mm_storeu_si128((__m128i *)&dest[x], c);
+            _mm_storeu_si128((__m128i *)&dest[x + 8], c);
+            continue;
+        }
+        for (int i = 0; i < 2; i++) {
+            __m128i bg = _mm_loadu_si128((const __m128i *)&dest[x + i * 8]);
+            __m128i mix = i ? _mm_unpackhi_epi8(m, zero) : _mm_unpacklo_epi8(m, zero);
+            _mm_storeu_si128((__m128i *)&dest[x + i * 8], blend8(bg, mix, fg, c));
+        }
+    }
+    if (x < w) draw_kernels_default()->mask(&dest[x], w - x, color, &mask[x]);
+}
+
+SSE41 static void mask_opa_row_sse(uint16_t *dest, int32_t w, uint16_t color, const uint8_t *mask, uint8_t opa) {
+    __m128i fg = spread_sse(color), c = _mm_set1_epi16((short)color), o = _mm_set1_epi16(opa);
+    int32_t x = 0;
+    for (; x + 8 <= w; x += 8) {
+        __m128i m = _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i *)&mask[x]));
+        __m128i mix = _mm_srli_epi16(_mm_mullo_epi16(m, o), 8); // LV_OPA_MIX2
+        __m128i bg = _mm_loadu_si128((const __m128i *)&dest[x]);
+        _mm_storeu_si128((__m128i *)&dest[x], blend8(bg, mix, fg, c));
+    }
+    if (x < w) draw_kernels_default()->mask_opa(&dest[x], w - x, color, &mask[x], opa);
+}
+
+static const draw_row_kernels_t sse41_kernels = {
+    "sse4.1", fill_row_sse, opa_row_sse, mask_row_sse, mask_opa_row_sse,
+};
+
+const draw_row_kernels_t *draw_kernels_simd(void) {
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("sse4.1") ? &sse41_kernels : NULL;
+}
+
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+
+// Kuten SSE4.1-versio; AArch64:llä NEON on aina käytettävissä
+static inline uint16x8_t blend8(uint16x8_t bg16, uint16x8_t mix16, uint32x4_t fg, uint16x8_t color16) {
+    const uint32x4_t rb_g = vdupq_n_u32(0x7E0F81F);
+    uint16x8_t m = vshrq_n_u16(vaddq_u16(mix16, vdupq_n_u16(4)), 3);
+    uint32x4_t bg[2] = { vmovl_u16(vget_low_u16(bg16)), vmovl_u16(vget_high_u16(bg16)) };
+    uint32x4_t ms[2] = { vmovl_u16(vget_low_u16(m)), vmovl_u16(vget_high_u16(m)) };
+    uint16x4_t r[2];
+    for (int i = 0; i < 2; i++) {
+        uint32x4_t b = vandq_u32(vorrq_u32(bg[i], vshlq_n_u32(bg[i], 16)), rb_g);
+        uint32x4_t t = vshrq_n_u32(vmulq_u32(vsubq_u32(fg, b), ms[i]), 5);
+        t = vandq_u32(vaddq_u32(t, b), rb_g);
+        r[i] = vmovn_u32(vorrq_u32(t, vshrq_n_u32(t, 16)));
+    }
+    uint16x8_t out = vcombine_u16(r[0], r[1]);
+    return vbslq_u16(vceqq_u16(mix16, vdupq_n_u16(255)), color16, out);
+}
+
+static uint32x4_t spread_neon(uint16_t color) {
+    return vdupq_n_u32(((uint32_t)color | ((uint32_t)color << 16)) & 0x7E0F81Fu);
+}
+
+static void fill_row_neon(uint16_t *dest, int32_t w, uint16_t color) {
+    uint16x8_t c = vdupq_n_u16(color);
+    int32_t x = 0;
+    for (; x + 8 <= w; x += 8) vst1q_u16(&dest[x], c);
+    for (; x < w; x++) dest[x] = color;
+}
+
+static void opa_row_neon(uint16_t *dest, int32_t w, uint16_t color, uint8_t opa) {
+    uint32x4_t fg = spread_neon(color);
+    uint16x8_t c = vdupq_n_u16(color), mix = vdupq_n_u16(opa);
+    // Tasaisella taustalla edellisen lohkon tulos kelpaa sellaisenaan
+    uint16x8_t last_bg = vdupq_n_u16((uint16_t)~dest[0]), last_res = c;
+    int32_t x = 0;
+    for (; x + 8 <= w; x += 8) {
+        uint16x8_t bg = vld1q_u16(&dest[x]);
+        if (vminvq_u16(vceqq_u16(bg, last_bg)) == 0) {
+            last_bg = bg;
+            last_res = blend8(bg, mix, fg, c);
+        }
+        vst1q_u16(&dest[x], last_res);
+    }
+    if (x < w) draw_kernels_default()->opa(&dest[x], w - x, color, opa);
+}
+
+static void mask_row_neon(uint16_t *dest, int32_t w, uint16_t color, const uint8_t *mask) {
+    uint32x4_t fg = spread_neon(color);
+    uint16x8_t c = vdupq_n_u16(color);
+    int32_t x = 0;
+    for (; x + 16 <= w; x += 16) {
+        uint8x16_t m = vld1q_u8(&mask[x]);
+        if (vmaxvq_u8(m) == 0) continue; // Kokonaan läpinäkyvä
+        if (vminvq_u8(m) == 255) {
+            vst1q_u16(&dest[x], c);
+            vst1q_u16(&dest[x + 8], c);
+            continue;
+        }
+        vst1q_u16(&dest[x], blend8(vld1q_u16(&dest[x]), vmovl_u8(vget_low_u8(m)), fg, c));
+        vst1q_u16(&dest[x + 8], blend8(vld1q_u16(&dest[x + 8]), vmovl_u8(vget_high_u8(m)), fg, c));
+    }
+    if (x < w) draw_kernels_default()->mask(&dest[x], w - x, color, &mask[x]);
+}
+
+static void mask_opa_row_neon(uint16_t *dest, int32_t w, uint16_t color, const uint8_t *mask, uint8_t opa) {
+    uint32x4_t fg = spread_neon(color);
+    uint16x8_t c = vdupq_n_u16(color), o = vdupq_n_u16(opa);
+    int32_t x = 0;
+    for (; x + 8 <= w; x += 8) {
+        uint16x8_t mix = vshrq_n_u16(vmulq_u16(vmovl_u8(vld1_u8(&mask[x])), o), 8); // LV_OPA_MIX2
+        vst1q_u16(&dest[x], blend8(vld1q_u16(&dest[x]), mix, fg, c));
+    }
+    if (x < w) draw_kernels_default()->mask_opa(&dest[x], w - x, color, &mask[x], opa);
+}
+
+static const draw_row_kernels_t neon_kernels = {
+    "neon", fill_row_neon, opa_row_neon, mask_row_neon, mask_opa_row_neon,
+};
+
+const draw_row_kernels_t *draw_kernels_simd(void) {
+    return &neon_kernels;
+}
+
+#else
+
+const draw_row_kernels_t *draw_kernels_simd(void) {
+    return NULL;
+}
+
+#endif
+
+void draw_kernels_select(void) {
+    const char *force = getenv("KIOSK_DRAW_KERNELS");
+    if (force && !strcmp(force, "c")) draw_kernels_use(NULL);
+    else draw_kernels_use(draw_kernels_simd());
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+// Piirtoytimien (draw_kernels.h) vektoriversiot native-ympäristöön: SSE4.1 x86-64:llä
+// (valitaan ajon aikana suorittimen tukemana) ja NEON AArch64:llä. Tulos on bitilleen
+// sama kuin C-versiolla, --kernel-check vertaa molempia LVGL:ään.
+
+#include "draw_kernels.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Paras suorittimelle sopiva toteutus tai NULL, jos vektoriversiota ei ole
+const draw_row_kernels_t *draw_kernels_simd(void);
+// Ottaa sen käyttöön; ympäristömuuttuja KIOSK_DRAW_KERNELS=c pakottaa C-version
+void draw_kernels_select(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,14 @@
+// --kernel-check: piirtoytimien C- ja vektoriversio (draw_kernels_simd.h) bitilleen
+// LVGL:n sekoitusta vastaan ja nopeus koko näytön kokoisella alueella. Itse tarkistus
+// on src/draw_kernels_check.cpp:ssä, jota laite käyttää PIE-version tarkistukseen.
+
+#include "draw_kernels_simd.h"
+#include "sim_display.h"
+#include "sim_modes.h"
+
+int kernel_check(uint32_t cases) {
+    const draw_row_kernels_t *impls[2] = { draw_kernels_c(), draw_kernels_simd() };
+    uint32_t failures = draw_kernels_check(impls, impls[1] ? 2 : 1, cases, SIM_HOR_RES, SIM_VER_RES);
+    draw_kernels_select();
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,70 @@
+#include "png_write.h"
+#include "kiosk_port.h"
+
+#include <stdio.h>
+#include <vector>
+
+static void put_be32(std::vector<uint8_t> &v, uint32_t x) {
+    v.push_back(x >> 24);
+    v.push_back(x >> 16);
+    v.push_back(x >> 8);
+    v.push_back(x);
+}
+
+static bool write_chunk(FILE *f, const char *type, const std::vector<uint8_t> &data) {
+    std::vector<uint8_t> buf;
+    put_be32(buf, (uint32_t)data.size());
+    buf.insert(buf.end(), type, type + 4);
+    buf.insert(buf.end(), data.begin(), data.end());
+    put_be32(buf, kiosk_crc32(buf.data() + 4, buf.size() - 4));
+    return fwrite(buf.data(), 1, buf.size(), f) == buf.size();
+}
+
+bool png_write_rgb565(const char *path, const uint16_t *px, int w, int h) {
+    // Rivit: suodatintavu 0 + RGB888
+    std::vector<uint8_t> raw;
+    raw.reserve((size_t)h * (1 + w * 3));
+    for (int y = 0; y < h; y++) {
+        raw.push_back(0);
+        for (int x = 0; x < w; x++) {
+            uint16_t c = px[y * w + x];
+            uint8_t r = (c >> 11) & 0x1f, g = (c >> 5) & 0x3f, b = c & 0x1f;
+            raw.push_back((r << 3) | (r >> 2));
+            raw.push_back((g << 2) | (g >> 4));
+            raw.push_back((b << 3) | (b >> 2));
+        }
+    }
+
+    // zlib-virta pakkaamattomina lohkoina (max 65535 tavua)
+    std::vector<uint8_t> z = { 0x78, 0x01 };
+    size_t pos = 0;
+    do {
+        size_t n = raw.size() - pos;
+        if (n > 65535) n = 65535;
+        z.push_back(pos + n == raw.size());
+        z.push_back(n & 0xff);
+        z.push_back(n >> 8);
+        z.push_back(~n & 0xff);
+        z.push_back((~n >> 8) & 0xff);
+        z.insert(z.end(), raw.begin() + pos, raw.begin() + pos + n);
+        pos += n;
+    } while (pos < raw.size());
+    uint32_t a = 1, b = 0;
+    for (uint8_t c : raw) {
+        a = (a + c) % 65521;
+        b = (b + a) % 65521;
+    }
+    put_be32(z, (b << 16) | a);
+
+    std::vector<uint8_t> ihdr;
+    put_be32(ihdr, w);
+    put_be32(ihdr, h);
+    ihdr.insert(ihdr.end(), { 8, 2, 0, 0, 0 }); // 8 bit, RGB, deflate, suodatin 0, ei lomitusta
+
+    FILE *f = fopen(path, "wb");
+    if (!f) return false;
+    static const uint8_t sig[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n' };
+    bool ok = fwrite(sig, 1, 8, f) == 8 && write_chunk(f, "IHDR", ihdr) && write_chunk(f, "IDAT", z) &&
+              write_chunk(f, "IEND", {});
+    return fclose(f) == 0 && ok;
+}
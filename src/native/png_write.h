@@ -0,0 +1,8 @@
+#pragma once
+
+// Pakkaamaton PNG (8-bit RGB, deflate "stored"-lohkot) ilman zlib-riippuvuutta.
+// Tiedostot ovat isoja, mutta kuvankatselimet ja tools/golden.py lukevat ne.
+
+#include <stdint.h>
+
+bool png_write_rgb565(const char *path, const uint16_t *px, int w, int h);
@@ -0,0 +1,131 @@
+// Laitteella tallennetun syötetiedoston (input_trace.h) toisto simuloidulla
+// kellolla. Aika etenee vain tapahtumien välillä, joten tunnin istunto toistuu
+// sekunneissa ja samalla tavalla joka kerta:
+//
+//   .pio/build/native/program --replay input.trc catalog.idx
+//   perf record -g .pio/build/native/program --replay input.trc catalog.idx
+//
+// Luettelo on laitteen catalog.idx tallennushetkeltä. Se kopioidaan nimelle
+// kiosk_fs/replay_catalog.idx, jotta simulaattorin oma luettelo (--catalog-bench
+// kirjoittaa sen yli) ei vaikuta toistoon. Ilman luetteloa käytetään
+// kiosk_fs/catalog.idx:ää. Kummassakin tapauksessa versio, määrä ja CRC
+// verrataan syötetiedoston otsakkeeseen, ja eri luettelolla toisto keskeytyy.
+
+#include <stdio.h>
+#include <string.h>
+
+#include "catalog.h"
+#include "input_trace.h"
+#include "kiosk_mode.h"
+#include "kiosk_port.h"
+#include "screens.h"
+#include "sim_display.h"
+#include "sim_modes.h"
+#include "tx_queue.h"
+#include "ui_lang.h"
+#include "ui_screens.h"
+
+static uint32_t frames;
+
+static bool copy_file(const char *from, const char *to) {
+    FILE *in = fopen(from, "rb");
+    if (!in) return false;
+    FILE *out = fopen(to, "wb");
+    bool ok = out != NULL;
+    char buf[4096];
+    size_t n;
+    while (ok && (n = fread(buf, 1, sizeof(buf), in)) > 0) ok = fwrite(buf, 1, n, out) == n;
+    fclose(in);
+    if (out && fclose(out) != 0) ok = false;
+    return ok;
+}
+
+static void render_ready_cb(lv_event_t *e) {
+    (void)e;
+    frames++;
+}
+
+int replay(const char *path, const char *catalog_path) {
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        printf("%s: avaus epäonnistui\n", path);
+        return 1;
+    }
+    input_trace_header_t h;
+    if (fread(&h, sizeof(h), 1, f) != 1 || memcmp(h.magic, INPUT_TRACE_MAGIC, 4) != 0) {
+        printf("%s: ei syötetiedosto\n", path);
+        fclose(f);
+        return 1;
+    }
+    if (h.hor_res != SIM_HOR_RES || h.ver_res != SIM_VER_RES) {
+        printf("varoitus: tallennettu %ux%u, simulaattori %ux%u\n", h.hor_res, h.ver_res, SIM_HOR_RES, SIM_VER_RES);
+    }
+
+    // Sama käynnistys kuin laitteella, tapahtumat omaan jonotiedostoonsa
+    kiosk_fs_begin();
+    const char *catalog_name = "catalog.idx";
+    if (catalog_path) {
+        char fs_path[64];
+        catalog_name = "replay_catalog.idx";
+        kiosk_fs_path(fs_path, sizeof(fs_path), catalog_name);
+        if (!copy_file(catalog_path, fs_path)) {
+            printf("%s: luettelon kopiointi epäonnistui\n", catalog_path);
+            fclose(f);
+            return 1;
+        }
+    }
+    catalog_begin(catalog_name);
+    if (catalog_version() != h.catalog_version || catalog_count() != h.catalog_count ||
+        catalog_crc() != h.catalog_crc) {
+        printf("%s: luettelo v%lu (%lu tuotetta, crc %08lx), tallennettu v%lu (%lu tuotetta, crc %08lx);\n"
+               "anna laitteen catalog.idx toisena argumenttina\n",
+               catalog_path ? catalog_path : catalog_name, (unsigned long)catalog_version(),
+               (unsigned long)catalog_count(), (unsigned long)catalog_crc(), (unsigned long)h.catalog_version,
+               (unsigned long)h.catalog_count, (unsigned long)h.catalog_crc);
+        fclose(f);
+        return 1;
+    }
+
+    lv_display_t *disp = sim_display_init();
+    lv_display_add_event_cb(disp, render_ready_cb, LV_EVENT_RENDER_READY, NULL); // Vain ruudut, joissa piirrettiin jotain
+    char txq_path[64];
+    kiosk_fs_path(txq_path, sizeof(txq_path), "replay_txq.log");
+    remove(txq_path);
+    txq_begin("replay_txq.log");
+    kiosk_mode_init(KIOSK_MODE_OTTO);
+    ui_lang_init(KIOSK_LANG_DEFAULT);
+    screens_init();
+    ui_screens_register();
+    screens_show(SCREEN_MAIN);
+
+    uint64_t t0 = kiosk_time_us();
+    uint32_t now = 0, touches = 0, scans = 0;
+    input_event_t ev;
+    while (fread(&ev, sizeof(ev), 1, f) == 1) {
+        if (ev.t_ms > now) {
+            sim_run_ms(ev.t_ms - now);
+            now = ev.t_ms;
+        }
+        if (ev.type == INPUT_EV_TOUCH) {
+            sim_pointer_set(ev.x, ev.y, ev.pressed);
+            touches++;
+        } else if (ev.type == INPUT_EV_SCAN) {
+            ui_scan(ev.code);
+            scans++;
+        }
+    }
+    fclose(f);
+    sim_pointer_set(0, 0, false);
+    sim_run_ms(1000); // Viimeiset animaatiot loppuun
+    double wall_ms = (kiosk_time_us() - t0) / 1e3;
+
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    printf("toistettu %lu kosketusta ja %lu viivakoodia, %.1f s simuloitua aikaa %.1f ms:ssa (%.0fx)\n",
+           (unsigned long)touches, (unsigned long)scans, (now + 1000) / 1e3, wall_ms, (now + 1000) / wall_ms);
+    printf("ruutuja %lu, LVGL-heap käytössä %lu / max %lu tavua, pirstoutuma %u %%\n", (unsigned long)frames,
+           (unsigned long)(mon.total_size - mon.free_size), (unsigned long)mon.max_used, mon.frag_pct);
+    screens_print_metrics();
+    txq_end();
+    return 0;
+}
@@ -0,0 +1,41 @@
+// Kuvakaappaukset kultaisia kuvia varten (tools/golden.py): päänäkymä
+// käynnistyksen jälkeen ja kummassakin tilassa painikkeiden painallusten jälkeen.
+// Näkymät rakennetaan samoin kuin laitteella (screens + ui_screens).
+
+#include <stdio.h>
+
+#include "kiosk_mode.h"
+#include "png_write.h"
+#include "screens.h"
+#include "sim_display.h"
+#include "sim_modes.h"
+#include "ui_lang.h"
+#include "ui_screens.h"
+
+static bool shot(const char *dir, const char *name) {
+    char path[256];
+    snprintf(path, sizeof(path), "%s/%s.png", dir, name);
+    sim_run_ms(500); // Tilasiirtymät ja painalluspalaute loppuun
+    if (!png_write_rgb565(path, sim_display_fb(), SIM_HOR_RES, SIM_VER_RES)) {
+        printf("%s: kirjoitus epäonnistui\n", path);
+        return false;
+    }
+    printf("%s\n", path);
+    return true;
+}
+
+int screenshots(const char *dir) {
+    sim_display_init();
+    kiosk_mode_init(KIOSK_MODE_OTTO);
+    ui_lang_init(KIOSK_LANG_DEFAULT);
+    screens_init();
+    ui_screens_register();
+    screens_show(SCREEN_MAIN);
+
+    bool ok = shot(dir, "main_start");
+    sim_click(ui_main.btn_palautus);
+    ok = ok && shot(dir, "main_palautus");
+    sim_click(ui_main.btn_otto);
+    ok = ok && shot(dir, "main_otto");
+    return ok ? 0 : 1;
+}
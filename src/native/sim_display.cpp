@@ -0,0 +1,79 @@
+#include "sim_display.h"
+#include "draw_kernels_simd.h"
+#include "kiosk_tick.h"
+#include "profiler_export.h"
+
+#include <stdlib.h>
+
+const char *sim_trace_path;
+
+static lv_display_t *display;
+static uint16_t framebuffer[SIM_HOR_RES * SIM_VER_RES];
+static lv_point_t pointer;
+static bool pointer_pressed;
+
+// DIRECT-tilassa LVGL piirtää suoraan kuvapuskuriin, joten kuittaus riittää
+static void flush_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map) {
+    (void)area;
+    (void)px_map;
+    lv_display_flush_ready(disp);
+}
+
+static void pointer_read_cb(lv_indev_t *indev, lv_indev_data_t *data) {
+    (void)indev;
+    data->point = pointer;
+    data->state = pointer_pressed ? LV_INDEV_STATE_PRESSED : LV_INDEV_STATE_RELEASED;
+}
+
+lv_display_t *sim_display_init() {
+    if (display) return display;
+    lv_init();
+    kiosk_tick_use_sim(); // Aika etenee vain sim_run_ms():ssä
+    draw_kernels_select(); // SSE4.1 / NEON, jos suoritin tukee
+    if (sim_trace_path && profiler_export_start(sim_trace_path)) atexit(profiler_export_stop);
+    display = lv_display_create(SIM_HOR_RES, SIM_VER_RES);
+    lv_display_set_color_format(display, LV_COLOR_FORMAT_RGB565);
+    lv_display_set_buffers(display, framebuffer, NULL, sizeof(framebuffer), LV_DISPLAY_RENDER_MODE_DIRECT);
+    lv_display_set_flush_cb(display, flush_cb);
+
+    lv_indev_t *indev = lv_indev_create();
+    lv_indev_set_type(indev, LV_INDEV_TYPE_POINTER);
+    lv_indev_set_read_cb(indev, pointer_read_cb);
+    return display;
+}
+
+void sim_display_refresh() {
+    lv_refr_now(display);
+}
+
+void sim_run_ms(uint32_t ms) {
+    // Hypätään suoraan seuraavan ajastimen kohdalle; tulos ei riipu koneen nopeudesta
+    while (ms > 0) {
+        uint32_t next = lv_timer_handler();
+        uint32_t step = next < ms ? next : ms;
+        if (step == 0) step = 1;
+        kiosk_tick_advance(step);
+        ms -= step;
+    }
+    lv_timer_handler();
+}
+
+const uint16_t *sim_display_fb() {
+    return framebuffer;
+}
+
+void sim_pointer_set(int32_t x, int32_t y, bool pressed) {
+    pointer.x = x;
+    pointer.y = y;
+    pointer_pressed = pressed;
+}
+
+void sim_click(lv_obj_t *obj) {
+    lv_area_t a;
+    lv_obj_get_coords(obj, &a);
+    int32_t x = (a.x1 + a.x2) / 2, y = (a.y1 + a.y2) / 2;
+    sim_pointer_set(x, y, true);
+    sim_run_ms(100);
+    sim_pointer_set(x, y, false);
+    sim_run_ms(100);
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+// Näytötön LVGL-näyttö native-ympäristöön: kuva piirretään muistiin (RGB565),
+// josta testit voivat lukea ja vertailla pikseleitä.
+
+#include <stdint.h>
+#include <lvgl.h>
+
+// Laitteen looginen koko (800x480-paneeli kierrettynä 270°)
+#define SIM_HOR_RES 480
+#define SIM_VER_RES 800
+
+// Jos asetettu ennen sim_display_init():iä, LVGL:n profiloijan jäljet kirjoitetaan
+// tähän tiedostoon ohjelman loppuun asti (--trace, profiler_export.h)
+extern const char *sim_trace_path;
+
+// lv_init(), simuloitu kello (kiosk_tick.h) ja näyttö; turvallinen kutsua useasti
+lv_display_t *sim_display_init();
+// Piirtää likaiset alueet heti, ajastimia ajamatta
+void sim_display_refresh();
+// Ajaa LVGL:ää ms millisekuntia simuloitua aikaa (animaatiot, siirtymät)
+void sim_run_ms(uint32_t ms);
+// Kuvapuskuri, SIM_HOR_RES * SIM_VER_RES pikseliä
+const uint16_t *sim_display_fb();
+
+// Virtuaalinen kosketus: painallus olion keskelle ja vapautus, kummankin jälkeen
+// ajetaan simuloitua aikaa (indev lukee tilan vain LVGL:n ajastimesta)
+void sim_pointer_set(int32_t x, int32_t y, bool pressed);
+void sim_click(lv_obj_t *obj);
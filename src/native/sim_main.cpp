@@ -0,0 +1,274 @@
+// Native-ympäristön (Linux) ajettava ohjelma mittauksia ja testiajoja varten.
+//
+//   pio run -e native && .pio/build/native/program --sync-bench 10000
+//   .pio/build/native/program --catalog-bench 20000
+//   .pio/build/native/program --style-check
+//   .pio/build/native/program --screenshots DIR      (ks. tools/golden.py)
+//   .pio/build/native/program --replay input.trc catalog.idx   (ks. input_trace.h)
+//   .pio/build/native/program --tick-bench 3600
+//   .pio/build/native/program --toggle-bench 100
+//   .pio/build/native/program --prerender-bench 100
+//   .pio/build/native/program --kernel-check 100000
+//   .pio/build/native/program --ui-queue-check 100000
+//   .pio/build/native/program --klog-bench 1000000   (python3 tools/klog_decode.py kiosk_fs/klog.bin)
+//   pio run -e native-ttf && .pio/build/native-ttf/program --ttf-bench 20   (fonts/arial.ttf)
+//   .pio/build/native/program --asset-bench 20          (assets/fonts, tools/font_build.py)
+//
+//   pio run -e native-profile && .pio/build/native-profile/program --trace out.trace --toggle-bench 20
+//   python3 tools/profiler_trace.py out.trace -o out.json   (chrome://tracing, ui.perfetto.dev)
+//
+// Synkronointimittaus olettaa, että tools/mock_backend.py on käynnissä.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <vector>
+
+#include "catalog.h"
+#include "kiosk_port.h"
+#include "klog.h"
+#include "sync.h"
+#include "tx_queue.h"
+#include "sim_display.h"
+#include "sim_modes.h"
+
+static int sync_bench(uint32_t count) {
+    kiosk_fs_begin();
+    char path[64];
+    const char *files[] = { "bench_txq.log", "bench_txq.log.ack" };
+    for (const char *f : files) {
+        kiosk_fs_path(path, sizeof(path), f);
+        remove(path);
+    }
+    if (!txq_begin("bench_txq.log")) {
+        printf("txq_begin epäonnistui\n");
+        return 1;
+    }
+
+    uint64_t t0 = kiosk_time_us();
+    for (uint32_t i = 0; i < count; i++) {
+        tx_record_t r = {};
+        r.timestamp = 1700000000 + i * 7;
+        r.product_id = 6400000 + (i * 37) % 500;
+        r.amount_cents = (i % 11 == 0) ? -250 : 199 + (int32_t)(i % 5) * 100;
+        r.qty = 1 + i % 3;
+        r.mode = (i % 11 == 0) ? TX_MODE_PALAUTUS : TX_MODE_OTTO;
+        if (!txq_push(&r)) {
+            printf("txq_push epäonnistui kohdassa %lu\n", (unsigned long)i);
+            return 1;
+        }
+    }
+    uint64_t t1 = kiosk_time_us();
+
+    int failures = 0;
+    while (txq_pending() > 0) {
+        if (sync_run_once() < 0 && ++failures > 100) {
+            printf("liian monta virhettä, onko mock_backend.py käynnissä?\n");
+            return 1;
+        }
+    }
+    uint64_t t2 = kiosk_time_us();
+
+    sync_stats_t s;
+    sync_get_stats(&s);
+    double sync_s = (t2 - t1) / 1e6;
+    printf("jonoon:      %lu tapahtumaa, %.1f ms\n", (unsigned long)count, (t1 - t0) / 1e3);
+    printf("synkronointi: %.1f ms, %.0f tapahtumaa/s, %lu erää, %lu uusintaa\n",
+           sync_s * 1e3, s.records / sync_s, (unsigned long)s.batches, (unsigned long)s.failures);
+    printf("koko:        %lu -> %lu tavua (%.1f %%)\n",
+           (unsigned long)s.bytes_raw, (unsigned long)s.bytes_sent, 100.0 * s.bytes_sent / s.bytes_raw);
+    txq_end();
+    return 0;
+}
+
+static uint32_t bench_rand(uint32_t *state) {
+    *state = *state * 1664525u + 1013904223u;
+    return *state >> 8;
+}
+
+static void make_item(catalog_item_t *it, uint32_t id, uint32_t salt) {
+    memset(it, 0, sizeof(*it));
+    it->id = id;
+    it->price_cents = 99 + (int32_t)((id * 31 + salt) % 5000);
+    snprintf(it->name, sizeof(it->name), "Tuote %lu/%lu", (unsigned long)id, (unsigned long)salt);
+}
+
+static bool write_catalog(const char *path, const std::vector<catalog_item_t> &items, uint32_t version) {
+    catalog_header_t h = {};
+    memcpy(h.magic, "KCI1", 4);
+    h.version = version;
+    h.count = (uint32_t)items.size();
+    h.crc = kiosk_crc32(items.data(), items.size() * sizeof(catalog_item_t));
+    FILE *f = fopen(path, "wb");
+    if (!f) return false;
+    fwrite(&h, sizeof(h), 1, f);
+    fwrite(items.data(), sizeof(catalog_item_t), items.size(), f);
+    fclose(f);
+    return true;
+}
+
+// Muutosta churn-osuudelle: kolmannes poistoja, kolmannes hinnanmuutoksia, kolmannes uusia
+static size_t write_delta(const char *path, const std::vector<catalog_item_t> &items, double churn, uint32_t *seed,
+                          uint32_t *removed) {
+    size_t n = items.size();
+    size_t changes = (size_t)(n * churn);
+    std::vector<uint8_t> touched(n, 0);
+    std::vector<catalog_delta_op_t> ops;
+    *removed = 0;
+    for (size_t c = 0; c < changes; c++) {
+        uint32_t kind = c % 3;
+        catalog_delta_op_t op = {};
+        if (kind == 2) {
+            op.op = CATALOG_OP_UPSERT;
+            make_item(&op.item, items.back().id + 1 + (uint32_t)c * 2, 1); // Uudet tuotteet loppuun
+        } else {
+            size_t idx;
+            do idx = bench_rand(seed) % n; while (touched[idx]);
+            touched[idx] = 1;
+            op.op = kind == 0 ? CATALOG_OP_REMOVE : CATALOG_OP_UPSERT;
+            *removed += kind == 0;
+            make_item(&op.item, items[idx].id, 2);
+        }
+        ops.push_back(op);
+    }
+    std::sort(ops.begin(), ops.end(), [](const catalog_delta_op_t &a, const catalog_delta_op_t &b) {
+        return a.item.id < b.item.id;
+    });
+
+    catalog_delta_header_t h = {};
+    memcpy(h.magic, "KCD1", 4);
+    h.base_version = 1;
+    h.new_version = 2;
+    h.op_count = (uint32_t)ops.size();
+    h.crc = kiosk_crc32(ops.data(), ops.size() * sizeof(catalog_delta_op_t));
+    FILE *f = fopen(path, "wb");
+    if (!f) return 0;
+    fwrite(&h, sizeof(h), 1, f);
+    fwrite(ops.data(), sizeof(catalog_delta_op_t), ops.size(), f);
+    fclose(f);
+    return sizeof(h) + ops.size() * sizeof(catalog_delta_op_t);
+}
+
+static int catalog_bench(uint32_t count) {
+    kiosk_fs_begin();
+    char idx_path[64], delta_path[64];
+    kiosk_fs_path(idx_path, sizeof(idx_path), "catalog.idx");
+    kiosk_fs_path(delta_path, sizeof(delta_path), "bench.delta");
+
+    std::vector<catalog_item_t> items(count);
+    for (uint32_t i = 0; i < count; i++) make_item(&items[i], 6400000 + i * 3, 0);
+    size_t full = sizeof(catalog_header_t) + count * sizeof(catalog_item_t);
+    printf("luettelo: %lu tuotetta, %lu tavua\n", (unsigned long)count, (unsigned long)full);
+
+    const double churns[] = { 0.01, 0.10 };
+    uint32_t seed = 12345;
+    for (double churn : churns) {
+        if (!write_catalog(idx_path, items, 1) || !catalog_begin()) return 1;
+        uint32_t removed;
+        size_t delta_size = write_delta(delta_path, items, churn, &seed, &removed);
+
+        catalog_apply_stats_t st;
+        if (!catalog_apply_delta(delta_path, &st) || catalog_version() != 2) {
+            printf("erotuksen soveltaminen epäonnistui\n");
+            return 1;
+        }
+        // Haut osuvat vaihdon jälkeen uuteen luetteloon
+        uint32_t found = 0;
+        catalog_item_t it;
+        for (const catalog_item_t &item : items) found += catalog_lookup(item.id, &it);
+        printf("muutos %4.1f %%: erotus %7lu tavua (%.1f %% latauksesta), %lu muutosta, sovellus %.1f ms, "
+               "luettu %lu, kirjoitettu %lu tavua, %lu tuotetta%s\n",
+               churn * 100, (unsigned long)delta_size, 100.0 * delta_size / full, (unsigned long)st.ops,
+               st.duration_us / 1e3, (unsigned long)st.bytes_read, (unsigned long)st.bytes_written,
+               (unsigned long)st.items, found == count - removed ? "" : " (HAKU EI TÄSMÄÄ)");
+    }
+    remove(delta_path);
+    return 0;
+}
+
+// Lokimerkinnän hinta ilman rajoitinta ja rajoittimen pudottamana, lopuksi purku tiedostoon.
+// Mitattu (x86-64 Xeon, -O2, 3 x 1 000 000): merkintä 47-52 ns, pudotettu 37-39 ns; suurin
+// osa on kiosk_time_ms():n kellonluku. Laitteella ei ole mitattu.
+static int klog_bench(uint32_t count) {
+    kiosk_fs_begin();
+    klog_set_rate(0);
+    uint64_t t0 = kiosk_time_us();
+    for (uint32_t i = 0; i < count; i++) klog((klog_event_t)(i % KLOG_EVENT_COUNT), i, i * 3, i * 7);
+    uint64_t t1 = kiosk_time_us();
+    klog_set_rate(KLOG_RATE_PER_S);
+    for (uint32_t i = 0; i < count; i++) klog(KLOG_SCAN, i);
+    uint64_t t2 = kiosk_time_us();
+    printf("merkintä %.1f ns, rajoittimen pudottama %.1f ns (%lu kertaa)\n", (t1 - t0) * 1e3 / count,
+           (t2 - t1) * 1e3 / count, (unsigned long)count);
+
+    char path[64];
+    kiosk_fs_path(path, sizeof(path), "klog.bin");
+    if (!klog_dump_file(path)) {
+        printf("%s: kirjoitus epäonnistui\n", path);
+        return 1;
+    }
+    printf("purettu: %s\n", path);
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--trace") && i + 1 < argc) {
+            sim_trace_path = argv[++i]; // Koskee seuraavaa tilaa
+            continue;
+        }
+        if (!strcmp(argv[i], "--sync-bench")) {
+            uint32_t n = (i + 1 < argc) ? (uint32_t)strtoul(argv[++i], NULL, 10) : 10000;
+            return sync_bench(n);
+        }
+        if (!strcmp(argv[i], "--catalog-bench")) {
+            uint32_t n = (i + 1 < argc) ? (uint32_t)strtoul(argv[++i], NULL, 10) : 20000;
+            return catalog_bench(n);
+        }
+        if (!strcmp(argv[i], "--style-check")) return style_check();
+        if (!strcmp(argv[i], "--screenshots") && i + 1 < argc) return screenshots(argv[i + 1]);
+        if (!strcmp(argv[i], "--replay") && i + 1 < argc) {
+            const char *catalog_path = (i + 2 < argc && strncmp(argv[i + 2], "--", 2)) ? argv[i + 2] : NULL;
+            return replay(argv[i + 1], catalog_path);
+        }
+        if (!strcmp(argv[i], "--tick-bench")) {
+            uint32_t n = (i + 1 < argc) ? (uint32_t)strtoul(argv[++i], NULL, 10) : 3600;
+            return tick_bench(n);
+        }
+        if (!strcmp(argv[i], "--toggle-bench")) {
+            uint32_t n = (i + 1 < argc) ? (uint32_t)strtoul(argv[++i], NULL, 10) : 100;
+            return toggle_bench(n);
+        }
+        if (!strcmp(argv[i], "--prerender-bench")) {
+            uint32_t n = (i + 1 < argc) ? (uint32_t)strtoul(argv[++i], NULL, 10) : 100;
+            return prerender_bench(n);
+        }
+        if (!strcmp(argv[i], "--klog-bench")) {
+            uint32_t n = (i + 1 < argc) ? (uint32_t)strtoul(argv[++i], NULL, 10) : 1000000;
+            return klog_bench(n);
+        }
+        if (!strcmp(argv[i], "--ttf-bench")) {
+            uint32_t n = (i + 1 < argc) ? (uint32_t)strtoul(argv[++i], NULL, 10) : 20;
+            return ttf_bench(n);
+        }
+        if (!strcmp(argv[i], "--asset-bench")) {
+            uint32_t n = (i + 1 < argc) ? (uint32_t)strtoul(argv[++i], NULL, 10) : 20;
+            return asset_bench(n);
+        }
+        if (!strcmp(argv[i], "--kernel-check")) {
+            uint32_t n = (i + 1 < argc) ? (uint32_t)strtoul(argv[++i], NULL, 10) : 100000;
+            return kernel_check(n);
+        }
+        if (!strcmp(argv[i], "--ui-queue-check")) {
+            uint32_t n = (i + 1 < argc) ? (uint32_t)strtoul(argv[++i], NULL, 10) : 100000;
+            return ui_queue_check(n);
+        }
+    }
+    printf("käyttö: %s [--trace FILE] --sync-bench [tapahtumia] | --catalog-bench [tuotteita] | --style-check\n"
+           "        | --screenshots DIR | --replay FILE [LUETTELO] | --tick-bench [sekunteja]\n"
+           "        | --toggle-bench [vaihtoja] | --prerender-bench [vaihtoja]\n"
+           "        | --kernel-check [tapauksia] | --klog-bench [merkintöjä] | --ttf-bench [kierroksia]\n"
+           "        | --asset-bench [kierroksia] | --ui-queue-check [päivityksiä]\n", argv[0]);
+    return 2;
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+// sim_main.cpp:n komentorivitilat, jotka on jaettu omiin tiedostoihinsa.
+// Paluuarvo on ohjelman paluukoodi (0 = ok).
+
+#include <stdint.h>
+
+// Vakiotyylit vs. alkuperäiset ajonaikaiset tyylit pikseleittäin
+int style_check();
+
+// Kirjoittaa näkymien PNG-kuvat hakemistoon dir (tools/golden.py vertaa)
+int screenshots(const char *dir);
+
+// Toistaa laitteella tallennetun syötetiedoston (input_trace.h) simuloidulla kellolla.
+// catalog_path: laitteen catalog.idx tallennushetkeltä, NULL = kiosk_fs/catalog.idx
+int replay(const char *path, const char *catalog_path);
+
+// Simuloidun kellon läpäisy: tilanvaihtoja seconds simuloidun sekunnin ajan.
+// toggle_bench: ruutuja per tilanvaihto teeman animaatioilla ja nopeassa tilassa.
+int tick_bench(uint32_t seconds);
+int toggle_bench(uint32_t toggles);
+// Painikkeiden piirtoaika suoraan ja esipiirrettyinä kuvina (ui_prerender.h)
+int prerender_bench(uint32_t toggles);
+
+// ui_queue.h: yhdistäminen, pudotus ja count päivitystä per kirjoittajasäie yhtä aikaa tyhjennyksen kanssa
+int ui_queue_check(uint32_t count);
+
+// Piirtoytimet (draw_kernels.h) C- ja vektoriversiona bitilleen LVGL:n sekoitusta vastaan ja nopeus
+int kernel_check(uint32_t cases);
+
+// Tiny TTF (ui_font_ttf.h, native-ttf) vs. Arial_70: ensimmäinen ja välimuistista piirto, muisti, flash
+int ttf_bench(uint32_t rounds);
+
+// Assets-osion fontti (ui_assets.h): lataus kokonaan vs. glyfi kerrallaan tiedostosta
+int asset_bench(uint32_t rounds);
@@ -0,0 +1,138 @@
+// Vakiotyylien (ui_gen.c, LV_STYLE_CONST_INIT) vertailu alkuperäisiin ajonaikaisiin
+// tyyleihin: sama päänäkymä rakennetaan molemmilla, piirretään muistiin ja
+// verrataan pikseleittäin molemmissa tiloissa (Otto / Palautus valittuna).
+
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+#include "kiosk_port.h"
+#include "sim_display.h"
+#include "sim_modes.h"
+#include "ui_gen.h"
+
+LV_FONT_DECLARE(Arial_70);
+
+// Alkuperäiset setup()-funktion tyylit sellaisenaan
+static lv_style_t style, btn_style, btn_checked_style;
+
+static void ref_styles_init() {
+    lv_style_init(&style);
+    lv_style_set_text_font(&style, &Arial_70);
+    lv_style_set_text_color(&style, lv_color_white());
+
+    lv_style_init(&btn_style);
+    lv_style_set_radius(&btn_style, LV_RADIUS_CIRCLE);
+    lv_style_set_bg_color(&btn_style, lv_color_make(0, 0, 0));
+    lv_style_set_text_font(&btn_style, &Arial_70);
+    lv_style_set_text_color(&btn_style, lv_color_white());
+    lv_style_set_border_color(&btn_style, lv_color_white());
+    lv_style_set_border_width(&btn_style, 2);
+    lv_style_set_pad_all(&btn_style, 0);
+
+    lv_style_init(&btn_checked_style);
+    lv_style_set_radius(&btn_checked_style, LV_RADIUS_CIRCLE);
+    lv_style_set_bg_color(&btn_checked_style, lv_color_make(255, 200, 0));
+    lv_style_set_text_font(&btn_checked_style, &Arial_70);
+    lv_style_set_text_color(&btn_checked_style, lv_color_black());
+    lv_style_set_border_color(&btn_checked_style, lv_color_white());
+    lv_style_set_border_width(&btn_checked_style, 2);
+    lv_style_set_pad_all(&btn_checked_style, 0);
+}
+
+static lv_obj_t *ref_button(lv_obj_t *parent, const char *text, int32_t y) {
+    lv_obj_t *btn = lv_button_create(parent);
+    lv_obj_set_size(btn, 400, 160);
+    lv_obj_align(btn, LV_ALIGN_CENTER, 0, y);
+    lv_obj_add_style(btn, &btn_style, 0);
+    lv_obj_add_style(btn, &btn_checked_style, LV_STATE_CHECKED);
+    lv_obj_t *l = lv_label_create(btn);
+    lv_label_set_text(l, text);
+    lv_obj_center(l);
+    lv_obj_add_style(l, &style, 0);
+    return btn;
+}
+
+static lv_obj_t *ref_main_create(ui_main_t *ui) {
+    lv_obj_t *scr = lv_obj_create(NULL);
+    lv_obj_set_style_bg_color(scr, lv_color_black(), 0);
+    lv_obj_set_style_border_width(scr, 0, 0);
+    lv_obj_set_style_pad_all(scr, 0, 0);
+    lv_obj_set_style_radius(scr, 0, 0);
+    lv_obj_add_style(scr, &style, 0);
+
+    ui->prompt = lv_label_create(scr);
+    lv_obj_align(ui->prompt, LV_ALIGN_TOP_MID, 0, 10);
+    lv_obj_add_style(ui->prompt, &style, 0);
+    ui->btn_otto = ref_button(scr, "Otto", -100);
+    ui->btn_palautus = ref_button(scr, "Palautus", 100);
+    ui->screen = scr;
+    return scr;
+}
+
+static uint32_t heap_used() {
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    return (uint32_t)(mon.total_size - mon.free_size);
+}
+
+struct build_result_t {
+    uint32_t heap_bytes;
+    uint32_t build_us;
+    std::vector<uint16_t> frames[2];   // Otto, Palautus valittuna
+};
+
+static void render(ui_main_t *ui, build_result_t *out) {
+    lv_label_set_text_static(ui->prompt, "Lue tuote");
+    lv_screen_load(ui->screen);
+    for (int mode = 0; mode < 2; mode++) {
+        lv_obj_set_state(ui->btn_otto, LV_STATE_CHECKED, mode == 0);
+        lv_obj_set_state(ui->btn_palautus, LV_STATE_CHECKED, mode == 1);
+        sim_run_ms(500); // Teeman tilasiirtymät loppuun
+        const uint16_t *fb = sim_display_fb();
+        out->frames[mode].assign(fb, fb + SIM_HOR_RES * SIM_VER_RES);
+    }
+}
+
+static void build(bool reference, build_result_t *out) {
+    ui_main_t ui;
+    lv_obj_t *old = lv_screen_active();
+    uint32_t heap0 = heap_used();
+    uint64_t t0 = kiosk_time_us();
+    if (reference) {
+        ref_styles_init();
+        ref_main_create(&ui);
+    } else {
+        ui_main_create(&ui);
+    }
+    out->build_us = (uint32_t)(kiosk_time_us() - t0);
+    out->heap_bytes = heap_used() - heap0;
+    render(&ui, out);
+    lv_screen_load(old);
+    lv_obj_delete(ui.screen);
+    if (reference) {
+        lv_style_reset(&style);
+        lv_style_reset(&btn_style);
+        lv_style_reset(&btn_checked_style);
+    }
+}
+
+int style_check() {
+    sim_display_init();
+    build_result_t ref, gen;
+    build(true, &ref);
+    build(false, &gen);
+
+    static const char *const modes[2] = { "Otto", "Palautus" };
+    int failed = 0;
+    for (int mode = 0; mode < 2; mode++) {
+        uint32_t diff = 0;
+        for (size_t i = 0; i < ref.frames[mode].size(); i++) diff += ref.frames[mode][i] != gen.frames[mode][i];
+        printf("%-8s: %lu eroavaa pikseliä\n", modes[mode], (unsigned long)diff);
+        failed |= diff != 0;
+    }
+    printf("ajonaikaiset tyylit: %5lu tavua LVGL-heapia, %lu us\n", (unsigned long)ref.heap_bytes, (unsigned long)ref.build_us);
+    printf("vakiotyylit:         %5lu tavua LVGL-heapia, %lu us\n", (unsigned long)gen.heap_bytes, (unsigned long)gen.build_us);
+    printf("%s\n", failed ? "EROJA" : "OK");
+    return failed;
+}
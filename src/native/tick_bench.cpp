@@ -0,0 +1,139 @@
+// Simuloidun kellon läpäisymittaus: päänäkymän tilaa vaihdetaan painikkeilla
+// kahden simuloidun sekunnin välein. Tulostaa simuloitua aikaa reaaliajan
+// sekunnissa ja ruutujen tarkisteen, jonka pitää olla sama joka ajolla.
+//
+// toggle_bench: ruutuja ja piirtoaikaa tilanvaihtoa kohden teeman animaatioilla
+// ja nopeassa tilassa (ui_snappy.h) sekä kulmamaskien uudelleenlaskut (draw_stats.h).
+// Piirtoaika on RENDER_START..RENDER_READY; kokonaisaikaan sisältyy lisäksi
+// ajastimet, syötteiden käsittely ja simuloidun kellon kierrokset.
+//
+// prerender_bench: piirtoaika tilanvaihtoa kohden, kun painikkeet piirretään
+// joka kerta ja kun ne ovat esipiirrettyjä kuvia (ui_prerender.h).
+
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+#include "draw_stats.h"
+#include "kiosk_mode.h"
+#include "kiosk_port.h"
+#include "kiosk_tick.h"
+#include "screens.h"
+#include "sim_display.h"
+#include "sim_modes.h"
+#include "ui_lang.h"
+#include "ui_screens.h"
+#include "ui_prerender.h"
+#include "ui_snappy.h"
+
+#define TOGGLE_INTERVAL_MS 2000
+
+static uint32_t frames;
+static uint64_t render_started, render_us;
+
+static void render_start_cb(lv_event_t *e) {
+    (void)e;
+    render_started = kiosk_time_us();
+}
+
+static void render_ready_cb(lv_event_t *e) {
+    (void)e;
+    frames++;
+    render_us += kiosk_time_us() - render_started;
+}
+
+// FNV-1a 32-bittisinä sanoina: nopea, riittää ajojen vertailuun
+static uint64_t frame_hash(uint64_t h) {
+    const uint32_t *p = (const uint32_t *)sim_display_fb();
+    for (size_t i = 0; i < SIM_HOR_RES * SIM_VER_RES / 2; i++) h = (h ^ p[i]) * 0x100000001b3ull;
+    return h;
+}
+
+static void boot() {
+    lv_display_t *disp = sim_display_init();
+    lv_display_add_event_cb(disp, render_start_cb, LV_EVENT_RENDER_START, NULL);
+    lv_display_add_event_cb(disp, render_ready_cb, LV_EVENT_RENDER_READY, NULL); // Vain ruudut, joissa piirrettiin jotain
+    draw_stats_attach(disp);
+    kiosk_mode_init(KIOSK_MODE_OTTO);
+    ui_lang_init(KIOSK_LANG_DEFAULT);
+    screens_init();
+    ui_screens_register();
+    screens_show(SCREEN_MAIN);
+    sim_run_ms(1000);
+}
+
+int tick_bench(uint32_t seconds) {
+    boot();
+
+    uint64_t hash = 0xcbf29ce484222325ull;
+    uint32_t toggles = 0;
+    uint32_t start = kiosk_tick_sim_now(), end = start + seconds * 1000;
+    uint64_t t0 = kiosk_time_us();
+    while (kiosk_tick_sim_now() < end) {
+        uint32_t before = kiosk_tick_sim_now();
+        sim_click(toggles % 2 ? ui_main.btn_otto : ui_main.btn_palautus);
+        sim_run_ms(TOGGLE_INTERVAL_MS - (kiosk_tick_sim_now() - before));
+        hash = frame_hash(hash);
+        toggles++;
+    }
+    double wall_s = (kiosk_time_us() - t0) / 1e6;
+    double sim_s = (kiosk_tick_sim_now() - start) / 1e3;
+    printf("%.0f s simuloitua aikaa %.2f s:ssa: %.0f simuloitua s / s\n", sim_s, wall_s, sim_s / wall_s);
+    printf("%lu vaihtoa, %lu ruutua (%.1f / vaihto), tarkiste %016llx\n", (unsigned long)toggles,
+           (unsigned long)frames, (double)frames / toggles, (unsigned long long)hash);
+    return 0;
+}
+
+int toggle_bench(uint32_t toggles) {
+    boot();
+    for (int snappy = 0; snappy < 2; snappy++) {
+        ui_snappy_set(snappy);
+        sim_run_ms(1000);
+        uint32_t frames0 = frames;
+        uint64_t render0 = render_us;
+        draw_stats_reset();
+        uint64_t t0 = kiosk_time_us();
+        for (uint32_t i = 0; i < toggles; i++) {
+            sim_click(i % 2 ? ui_main.btn_otto : ui_main.btn_palautus);
+            sim_run_ms(1000); // Kaikki animaatiot loppuun ennen seuraavaa
+        }
+        uint64_t wall_us = kiosk_time_us() - t0;
+        uint32_t n = frames - frames0;
+        printf("%-10s %.1f ruutua / vaihto, %.2f ms piirtoa / vaihto (kaikkiaan %.2f ms)\n",
+               snappy ? "nopea:" : "animaatiot:", (double)n / toggles, (render_us - render0) / 1e3 / toggles,
+               wall_us / 1e3 / toggles);
+        draw_stats_print();
+    }
+    return 0;
+}
+
+int prerender_bench(uint32_t toggles) {
+    boot();
+    ui_snappy_set(true); // Yksi ruutu per vaihto, mitataan vain piirto
+    std::vector<uint16_t> live[2];
+    for (int pre = 0; pre < 2; pre++) {
+        if (pre && (!ui_prerender_button(ui_main.btn_otto) || !ui_prerender_button(ui_main.btn_palautus))) {
+            printf("esipiirto epäonnistui\n");
+            return 1;
+        }
+        sim_run_ms(1000);
+        uint32_t frames0 = frames;
+        uint64_t render0 = render_us;
+        bool same = true;
+        for (uint32_t i = 0; i < toggles; i++) {
+            sim_click(i % 2 ? ui_main.btn_otto : ui_main.btn_palautus);
+            sim_run_ms(500);
+            // Ensimmäisten vaihtojen lopputulos talteen ja vertailuun
+            std::vector<uint16_t> &ref = live[i % 2];
+            const uint16_t *fb = sim_display_fb();
+            if (!pre && i < 2) ref.assign(fb, fb + SIM_HOR_RES * SIM_VER_RES);
+            if (pre && i < 2) same = same && memcmp(ref.data(), fb, ref.size() * 2) == 0;
+        }
+        printf("%-16s %.1f ruutua, %.0f us piirtoa / vaihto", pre ? "esipiirretty:" : "piirto joka kerta:",
+               (double)(frames - frames0) / toggles, (double)(render_us - render0) / toggles);
+        if (pre) printf(", kuvat %lu tavua PSRAM, lopputulos %s", (unsigned long)ui_prerender_bytes(),
+                        same ? "sama" : "EROAA");
+        printf("\n");
+    }
+    return 0;
+}
@@ -0,0 +1,126 @@
+// Tiny TTF (ui_font_ttf.h) vs. esirasteroitu Arial_70 (ui_fonts.c). Label sisältää
+// kerran jokaisen käyttöliittymän merkin (Arial_70:n merkistö), ja se piirretään
+// lv_snapshotilla kokonaan, vaikka se olisi näyttöä korkeampi.
+//
+//   ensimmäinen: fontin vaihto, asettelu ja piirto; TTF:llä glyfien rasterointi
+//   välimuistista: piirto uudelleen, kun glyfit ovat välimuistissa
+//   muisti: LVGL:n keon kasvu ensimmäisestä piirrosta (välimuisti)
+//
+// Lopuksi flash: bittikarttafontin taulukot vs. TTF-data. Rasteroijan koodi
+// (stb_truetype) näkyy vain laitekäännöksen koossa (pio run -e esp32-8048S043C-ttf).
+
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+#include <lvgl.h>
+
+#include "kiosk_port.h"
+#include "sim_display.h"
+#include "sim_modes.h"
+#include "ui_font_ttf.h"
+
+LV_FONT_DECLARE(Arial_70);
+
+static lv_obj_t *label;
+
+static void utf8_append(std::vector<char> &out, uint32_t cp) {
+    if (cp < 0x80) {
+        out.push_back((char)cp);
+    } else if (cp < 0x800) {
+        out.push_back((char)(0xC0 | cp >> 6));
+        out.push_back((char)(0x80 | (cp & 0x3F)));
+    } else {
+        out.push_back((char)(0xE0 | cp >> 12));
+        out.push_back((char)(0x80 | ((cp >> 6) & 0x3F)));
+        out.push_back((char)(0x80 | (cp & 0x3F)));
+    }
+}
+
+// Esirasteroidun fontin merkit tekstinä ja taulukoiden koko flashissa
+static size_t fmt_txt_chars(const lv_font_t *font, std::vector<char> *text) {
+    const lv_font_fmt_txt_dsc_t *dsc = (const lv_font_fmt_txt_dsc_t *)font->dsc;
+    uint32_t glyphs = 0;
+    for (uint16_t i = 0; i < dsc->cmap_num; i++) {
+        const lv_font_fmt_txt_cmap_t *cmap = &dsc->cmaps[i];
+        for (uint32_t c = 0; c < cmap->range_length; c++) {
+            if (cmap->range_start + c != ' ') utf8_append(*text, cmap->range_start + c);
+        }
+        glyphs += cmap->range_length;
+    }
+    text->push_back('\0');
+    size_t bitmap = 0;
+    for (uint32_t g = 1; g <= glyphs; g++) {
+        const lv_font_fmt_txt_glyph_dsc_t *gd = &dsc->glyph_dsc[g];
+        size_t end = gd->bitmap_index + (gd->box_w * gd->box_h * dsc->bpp + 7) / 8;
+        if (end > bitmap) bitmap = end;
+    }
+    return bitmap + (glyphs + 1) * sizeof(lv_font_fmt_txt_glyph_dsc_t) +
+           dsc->cmap_num * sizeof(lv_font_fmt_txt_cmap_t) + sizeof(*dsc) + sizeof(*font);
+}
+
+static size_t heap_used() {
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    return mon.total_size - mon.free_size;
+}
+
+static double draw_us() {
+    int32_t w = lv_obj_get_width(label), h = lv_obj_get_height(label);
+    uint32_t stride = lv_draw_buf_width_to_stride(w, LV_COLOR_FORMAT_RGB565);
+    static std::vector<uint8_t> data;
+    data.resize((size_t)stride * h);
+    lv_draw_buf_t buf;
+    lv_draw_buf_init(&buf, w, h, LV_COLOR_FORMAT_RGB565, stride, data.data(), data.size());
+    uint64_t t0 = kiosk_time_us();
+    lv_snapshot_take_to_draw_buf(label, LV_COLOR_FORMAT_RGB565, &buf);
+    return (double)(kiosk_time_us() - t0);
+}
+
+static void bench_font(const char *name, const lv_font_t *font, double create_us, uint32_t rounds) {
+    size_t mem0 = heap_used();
+    uint64_t t0 = kiosk_time_us();
+    lv_obj_set_style_text_font(label, font, 0);
+    lv_obj_update_layout(label);
+    double first = (kiosk_time_us() - t0) + draw_us();
+    size_t mem1 = heap_used();
+    double cached = 0;
+    for (uint32_t i = 0; i < rounds; i++) cached += draw_us();
+    printf("%-10s luonti %6.0f us, ensimmäinen %8.0f us, välimuistista %7.0f us, muisti +%lu tavua\n", name,
+           create_us, first, cached / rounds, (unsigned long)(mem1 > mem0 ? mem1 - mem0 : 0));
+}
+
+int ttf_bench(uint32_t rounds) {
+    sim_display_init();
+    if (!ui_font_ttf_begin()) return 1;
+    if (rounds == 0) rounds = 1;
+
+    std::vector<char> text;
+    size_t bitmap_flash = fmt_txt_chars(&Arial_70, &text);
+    label = lv_label_create(lv_screen_active());
+    lv_obj_set_width(label, SIM_HOR_RES);
+    lv_label_set_long_mode(label, LV_LABEL_LONG_WRAP);
+    lv_label_set_text(label, text.data());
+    printf("%lu merkkiä, %lu kierrosta\n", (unsigned long)lv_text_get_encoded_length(text.data()),
+           (unsigned long)rounds);
+
+    bench_font("Arial_70", &Arial_70, 0, rounds);
+    const int32_t sizes[] = { 24, 32, 48, 70 };
+    for (int32_t size : sizes) {
+        uint64_t t0 = kiosk_time_us();
+        const lv_font_t *font = ui_font_ttf(size);
+        double create_us = (double)(kiosk_time_us() - t0);
+        if (!font) {
+            printf("ttf %ld px: luonti epäonnistui\n", (long)size);
+            return 1;
+        }
+        char name[16];
+        snprintf(name, sizeof(name), "ttf %ld px", (long)size);
+        bench_font(name, font, create_us, rounds);
+    }
+
+    lv_obj_set_style_text_font(label, &Arial_70, 0); // Ennen kuin TTF-fontit jäävät käyttämättä
+    printf("flash: Arial_70 %lu tavua (vain 70 px), arial.ttf %lu tavua (kaikki koot ja merkit)\n",
+           (unsigned long)bitmap_flash, (unsigned long)ui_font_ttf_data_size());
+    return 0;
+}
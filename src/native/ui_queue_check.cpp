@@ -0,0 +1,145 @@
+// ui_queue.h: monta kirjoittajaa, yksi lukija. Kolme osaa:
+//   1. Yhdistäminen: purske samaan kohteeseen ilman tyhjennystä näkyy yhtenä
+//      lopputilana (viimeinen teksti, tilojen lisäys ja poisto järjestyksessä).
+//   2. Pudotus: täysi jono hylkää kirjoituksen, ui_queue_dropped() laskee sen.
+//   3. Kilpailu: kirjoittajasäikeet (yksi kohde kullakin) ja lukija yhtä aikaa.
+//      Jokaisen tyhjennyksen jälkeen kohteen numeron pitää kasvaa (kirjoittajan
+//      järjestys säilyy), ja lopuksi näkyä kirjoittajan viimeinen numero.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "kiosk_mode.h"
+#include "sim_display.h"
+#include "sim_modes.h"
+#include "ui_queue.h"
+
+static lv_obj_t *objs[UI_TARGET_COUNT];
+
+static const char *text_of(ui_target_t t) {
+    lv_obj_t *obj = objs[t];
+    if (!lv_obj_check_type(obj, &lv_label_class)) obj = lv_obj_get_child(obj, 0);
+    return lv_label_get_text(obj);
+}
+
+static bool expect(bool ok, const char *what) {
+    if (!ok) printf("VIRHE: %s\n", what);
+    return ok;
+}
+
+static void create_targets() {
+    lv_obj_t *scr = lv_obj_create(NULL);
+    for (int t = 0; t < UI_TARGET_COUNT; t++) {
+        // Painikekohteet kuten päänäkymässä: teksti menee label-lapseen
+        bool button = t == UI_TARGET_BTN1 || t == UI_TARGET_BTN2;
+        objs[t] = button ? lv_button_create(scr) : lv_label_create(scr);
+        if (button) lv_label_create(objs[t]);
+        ui_queue_register((ui_target_t)t, objs[t]);
+    }
+    lv_screen_load(scr);
+}
+
+static bool check_coalesce() {
+    bool ok = true;
+    char text[UI_TEXT_MAX];
+    for (int i = 0; i < 10; i++) {
+        snprintf(text, sizeof(text), "%d", i);
+        ok &= expect(ui_post_text(UI_TARGET_LABEL, text), "kirjoitus hylättiin tyhjään jonoon");
+    }
+    ui_post_state(UI_TARGET_BTN1, LV_STATE_CHECKED, true);
+    ui_post_state(UI_TARGET_BTN1, LV_STATE_CHECKED, false);
+    ui_post_state(UI_TARGET_BTN1, LV_STATE_CHECKED, true);
+    ui_post_state(UI_TARGET_BTN2, LV_STATE_CHECKED, true);
+    ui_post_state(UI_TARGET_BTN2, LV_STATE_CHECKED, false);
+    ui_post_mode(KIOSK_MODE_PALAUTUS);
+    ui_post_mode(KIOSK_MODE_OTTO);
+    ui_queue_drain();
+    ok &= expect(!strcmp(text_of(UI_TARGET_LABEL), "9"), "label ei ole viimeinen teksti");
+    ok &= expect(lv_obj_has_state(objs[UI_TARGET_BTN1], LV_STATE_CHECKED), "lisäys-poisto-lisäys ei jättänyt tilaa");
+    ok &= expect(!lv_obj_has_state(objs[UI_TARGET_BTN2], LV_STATE_CHECKED), "lisäys-poisto jätti tilan");
+    ok &= expect(kiosk_mode_get() == KIOSK_MODE_OTTO, "tila ei ole viimeinen");
+    printf("yhdistäminen: %s\n", ok ? "ok" : "VIRHE");
+    return ok;
+}
+
+static bool check_drop() {
+    uint32_t dropped0 = ui_queue_dropped();
+    uint32_t accepted = 0;
+    for (int i = 0; i < UI_QUEUE_LEN + 10; i++) accepted += ui_post_text(UI_TARGET_STATUS, "x");
+    uint32_t dropped = ui_queue_dropped() - dropped0;
+    ui_queue_drain();
+    bool ok = expect(accepted == UI_QUEUE_LEN, "täysi jono otti vastaan väärän määrän");
+    ok &= expect(dropped == 10, "pudotuslaskuri ei täsmää");
+    ok &= expect(ui_post_text(UI_TARGET_STATUS, "y"), "tyhjennetty jono ei ota vastaan");
+    ui_queue_drain();
+    ok &= expect(!strcmp(text_of(UI_TARGET_STATUS), "y"), "tyhjennyksen jälkeinen teksti puuttuu");
+    printf("pudotus: %lu / %d hyväksytty, %lu pudotettu: %s\n", (unsigned long)accepted, UI_QUEUE_LEN + 10,
+           (unsigned long)dropped, ok ? "ok" : "VIRHE");
+    return ok;
+}
+
+static bool check_producers(uint32_t count) {
+    std::atomic<int> running(UI_TARGET_COUNT);
+    std::atomic<uint32_t> retries(0);
+    uint32_t dropped0 = ui_queue_dropped();
+    std::vector<std::thread> producers;
+    for (int t = 0; t < UI_TARGET_COUNT; t++) {
+        producers.emplace_back([t, count, &running, &retries]() {
+            char text[UI_TEXT_MAX];
+            for (uint32_t i = 1; i <= count; i++) {
+                snprintf(text, sizeof(text), "%lu", (unsigned long)i);
+                // Täysi jono: kirjoittaja yrittää uudelleen, jotta jokainen numero menee läpi järjestyksessä
+                while (!ui_post_text((ui_target_t)t, text)) {
+                    retries.fetch_add(1, std::memory_order_relaxed);
+                    std::this_thread::yield();
+                }
+            }
+            running.fetch_sub(1, std::memory_order_release);
+        });
+    }
+
+    bool ok = true;
+    unsigned long last[UI_TARGET_COUNT] = {};
+    uint64_t drains = 0;
+    for (bool done = false; !done;) {
+        done = running.load(std::memory_order_acquire) == 0; // Viimeinen kierros kaikkien lopetettua
+        ui_queue_drain();
+        drains++;
+        for (int t = 0; t < UI_TARGET_COUNT; t++) {
+            unsigned long v = strtoul(text_of((ui_target_t)t), NULL, 10);
+            if (v < last[t]) {
+                printf("VIRHE: kohde %d: %lu ennen %lu\n", t, last[t], v);
+                ok = false;
+            }
+            last[t] = v;
+        }
+    }
+    for (std::thread &p : producers) p.join();
+    ui_queue_drain();
+    for (int t = 0; t < UI_TARGET_COUNT; t++) {
+        unsigned long v = strtoul(text_of((ui_target_t)t), NULL, 10);
+        if (v != count) {
+            printf("VIRHE: kohde %d: lopussa %lu, odotettiin %lu\n", t, v, (unsigned long)count);
+            ok = false;
+        }
+    }
+    uint32_t dropped = ui_queue_dropped() - dropped0;
+    ok &= expect(dropped == retries.load(), "pudotuslaskuri ei täsmää uusintoihin");
+    printf("kilpailu: %d kirjoittajaa x %lu, %llu tyhjennystä, %lu täyttä jonoa: %s\n", UI_TARGET_COUNT,
+           (unsigned long)count, (unsigned long long)drains, (unsigned long)dropped, ok ? "ok" : "VIRHE");
+    return ok;
+}
+
+int ui_queue_check(uint32_t count) {
+    sim_display_init();
+    kiosk_mode_init(KIOSK_MODE_OTTO);
+    create_targets();
+    bool ok = check_coalesce();
+    ok &= check_drop();
+    ok &= check_producers(count);
+    return ok ? 0 : 1;
+}
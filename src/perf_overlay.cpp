@@ -0,0 +1,131 @@
+#include "perf_overlay.h"
+#include "draw_stats.h"
+#include "kiosk_port.h"
+
+#define PERF_OVERLAY_PERIOD_MS 1000
+
+static lv_obj_t *overlay;
+static lv_timer_t *timer;
+
+// Kuluvan jakson summat; RENDER_START..RENDER_READY sisältää siirrot (flush)
+static uint32_t frames;
+static uint64_t render_started, flush_started, render_us, flush_us;
+static uint32_t period_started;
+static draw_stats_t draw_prev; // Kulmamaskien laskurit jakson alussa
+
+static void render_start_cb(lv_event_t *e) {
+    (void)e;
+    render_started = kiosk_time_us();
+}
+
+static void render_ready_cb(lv_event_t *e) {
+    (void)e;
+    frames++;
+    render_us += kiosk_time_us() - render_started;
+}
+
+// Siirtoon lasketaan sekä flush_cb itse että odotus edellisen siirron valmistumiseen
+static void flush_start_cb(lv_event_t *e) {
+    (void)e;
+    flush_started = kiosk_time_us();
+}
+
+static void flush_finish_cb(lv_event_t *e) {
+    (void)e;
+    flush_us += kiosk_time_us() - flush_started;
+}
+
+static void update_cb(lv_timer_t *t) {
+    (void)t;
+    uint32_t now = kiosk_time_ms();
+    uint32_t elapsed = now - period_started;
+    if (elapsed == 0) return;
+
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    size_t psram_used, psram_total;
+    kiosk_psram_usage(&psram_used, &psram_total);
+
+    draw_stats_t draw;
+    draw_stats_get(&draw);
+    uint32_t draw_frames = draw.frames - draw_prev.frames;
+    uint32_t masks = draw.mask_inits - draw_prev.mask_inits;
+    uint32_t misses = draw.mask_misses - draw_prev.mask_misses;
+
+    uint32_t n = frames ? frames : 1;
+    uint32_t flush_avg = (uint32_t)(flush_us / n);
+    uint32_t draw_avg = (uint32_t)((render_us > flush_us ? render_us - flush_us : 0) / n);
+    lv_label_set_text_fmt(overlay,
+                          "FPS %lu  jouto %u %%\n"
+                          "piirto %lu.%lu ms  siirto %lu.%lu ms\n"
+                          "LVGL %lu / %lu kt  pirst. %u %%\n"
+                          "PSRAM %lu / %lu kt\n"
+                          "maskit %lu/ruutu  uudelleen %lu  cache %lu/%d",
+                          (unsigned long)((frames * 1000 + elapsed / 2) / elapsed), (unsigned)lv_timer_get_idle(),
+                          (unsigned long)(draw_avg / 1000), (unsigned long)(draw_avg / 100 % 10),
+                          (unsigned long)(flush_avg / 1000), (unsigned long)(flush_avg / 100 % 10),
+                          (unsigned long)((mon.total_size - mon.free_size) / 1024),
+                          (unsigned long)(mon.total_size / 1024), (unsigned)mon.frag_pct,
+                          (unsigned long)(psram_used / 1024), (unsigned long)(psram_total / 1024),
+                          (unsigned long)(draw_frames ? masks / draw_frames : 0), (unsigned long)misses,
+                          (unsigned long)draw.cache_entries, LV_DRAW_SW_CIRCLE_CACHE_SIZE);
+
+    draw_prev = draw;
+    frames = 0;
+    render_us = flush_us = 0;
+    period_started = now;
+}
+
+void perf_overlay_attach(lv_display_t *disp) {
+    lv_display_add_event_cb(disp, render_start_cb, LV_EVENT_RENDER_START, NULL);
+    lv_display_add_event_cb(disp, render_ready_cb, LV_EVENT_RENDER_READY, NULL);
+    lv_display_add_event_cb(disp, flush_start_cb, LV_EVENT_FLUSH_START, NULL);
+    lv_display_add_event_cb(disp, flush_finish_cb, LV_EVENT_FLUSH_FINISH, NULL);
+    lv_display_add_event_cb(disp, flush_start_cb, LV_EVENT_FLUSH_WAIT_START, NULL);
+    lv_display_add_event_cb(disp, flush_finish_cb, LV_EVENT_FLUSH_WAIT_FINISH, NULL);
+}
+
+static void create() {
+    overlay = lv_label_create(lv_layer_top());
+    // Kiinteä koko ja peittävä tausta: tekstin vaihto ei muuta asettelua eikä vaadi alla olevan piirtoa
+    lv_obj_set_size(overlay, 300, 104);
+    lv_obj_align(overlay, LV_ALIGN_TOP_LEFT, 0, 0);
+    lv_label_set_long_mode(overlay, LV_LABEL_LONG_CLIP);
+    lv_obj_set_style_text_font(overlay, &lv_font_montserrat_14, 0);
+    lv_obj_set_style_text_color(overlay, lv_color_white(), 0);
+    lv_obj_set_style_bg_color(overlay, lv_color_black(), 0);
+    lv_obj_set_style_bg_opa(overlay, LV_OPA_COVER, 0);
+    lv_obj_set_style_pad_all(overlay, 2, 0);
+    lv_label_set_text(overlay, "");
+    timer = lv_timer_create(update_cb, PERF_OVERLAY_PERIOD_MS, NULL);
+}
+
+void perf_overlay_show(bool on) {
+    if (on == perf_overlay_visible()) return;
+    if (!overlay) create();
+    if (on) {
+        frames = 0;
+        render_us = flush_us = 0;
+        period_started = kiosk_time_ms();
+        draw_stats_get(&draw_prev);
+        lv_obj_remove_flag(overlay, LV_OBJ_FLAG_HIDDEN);
+        lv_timer_resume(timer);
+    } else {
+        lv_obj_add_flag(overlay, LV_OBJ_FLAG_HIDDEN);
+        lv_timer_pause(timer);
+    }
+}
+
+bool perf_overlay_visible() {
+    return overlay && !lv_obj_has_flag(overlay, LV_OBJ_FLAG_HIDDEN);
+}
+
+static void toggle_cb(lv_event_t *e) {
+    (void)e;
+    perf_overlay_show(!perf_overlay_visible());
+}
+
+void perf_overlay_bind_toggle(lv_obj_t *obj) {
+    lv_obj_add_flag(obj, LV_OBJ_FLAG_CLICKABLE); // Label ei oletuksena ota painalluksia
+    lv_obj_add_event_cb(obj, toggle_cb, LV_EVENT_LONG_PRESSED, NULL);
+}
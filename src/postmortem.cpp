@@ -0,0 +1,256 @@
+#include "postmortem.h"
+#include "http_client.h"
+#include "kiosk_config.h"
+#include "kiosk_port.h"
+#include "klog.h"
+#include "screens.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef ARDUINO
+#include <esp_system.h>
+#include <esp_heap_caps.h>
+#endif
+
+#define PM_MAGIC 0x504D3031u // "PM01"; muu arvo = alue on roskaa (virran kytkentä)
+
+struct pm_frame_t {
+    uint32_t t_ms;
+    uint32_t render_us;
+    uint8_t screen;
+    uint8_t reserved[3];
+};
+
+struct pm_input_t {
+    uint32_t t_ms;
+    uint8_t type;          // 1 = kosketus, 2 = viivakoodi (kuten input_trace.h)
+    uint8_t pressed;
+    int16_t x, y;
+    uint16_t reserved;
+    uint32_t code;
+};
+
+struct pm_region_t {
+    uint32_t magic;
+    uint32_t boot_count;   // Käynnistyksiä virran kytkennän jälkeen
+    uint32_t uptime_ms;    // Viimeisin kirjaus
+    uint32_t assert_line;  // 0 = ei assertia
+    char assert_file[48];
+    uint32_t lv_used, lv_total, lv_frag;
+    uint32_t internal_free, internal_min, psram_free;
+    uint32_t frame_head, input_head;
+    uint32_t klog_head;    // klog_mirror(): merkintöjä kirjoitettu klog-taulukkoon
+    uint32_t frame_open;   // 1 = frames[frame_head] piirrossa (kaatui/jumittui siihen)
+    pm_frame_t frames[POSTMORTEM_FRAMES];
+    pm_input_t inputs[POSTMORTEM_INPUTS];
+    klog_entry_t klog[POSTMORTEM_KLOG];
+};
+
+static_assert((POSTMORTEM_KLOG & (POSTMORTEM_KLOG - 1)) == 0, "klog_mirror: kahden potenssi");
+
+static KIOSK_RETAINED pm_region_t region;
+static bool in_assert;
+
+static void snapshot() {
+    region.uptime_ms = kiosk_time_ms();
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    region.lv_used = (uint32_t)(mon.total_size - mon.free_size);
+    region.lv_total = (uint32_t)mon.total_size;
+    region.lv_frag = mon.frag_pct;
+#ifdef ARDUINO
+    region.internal_free = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+    region.internal_min = heap_caps_get_minimum_free_size(MALLOC_CAP_INTERNAL);
+    region.psram_free = heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
+#endif
+}
+
+static void snapshot_timer_cb(lv_timer_t *t) {
+    (void)t;
+    snapshot();
+}
+
+static void render_start_cb(lv_event_t *e) {
+    (void)e;
+    pm_frame_t &f = region.frames[region.frame_head % POSTMORTEM_FRAMES];
+    f.t_ms = kiosk_time_ms();
+    f.render_us = (uint32_t)kiosk_time_us(); // Alkuhetki, kesto täytetään valmiina
+    f.screen = (uint8_t)screens_current();
+    region.frame_open = 1;
+}
+
+static void render_ready_cb(lv_event_t *e) {
+    (void)e;
+    pm_frame_t &f = region.frames[region.frame_head % POSTMORTEM_FRAMES];
+    f.render_us = (uint32_t)kiosk_time_us() - f.render_us;
+    region.frame_open = 0;
+    region.frame_head++;
+}
+
+static void input(uint8_t type, uint8_t pressed, int32_t x, int32_t y, uint32_t code) {
+    pm_input_t &in = region.inputs[region.input_head++ % POSTMORTEM_INPUTS];
+    in.t_ms = kiosk_time_ms();
+    in.type = type;
+    in.pressed = pressed;
+    in.x = (int16_t)x;
+    in.y = (int16_t)y;
+    in.code = code;
+}
+
+static void pointer_cb(lv_event_t *e) {
+    lv_indev_t *indev = (lv_indev_t *)lv_event_get_user_data(e);
+    lv_point_t p;
+    lv_indev_get_point(indev, &p);
+    input(1, lv_event_get_code(e) == LV_EVENT_PRESSED, p.x, p.y, 0);
+}
+
+void postmortem_scan(uint32_t code) {
+    input(2, 0, 0, 0, code);
+}
+
+static const char *reset_reason() {
+#ifdef ARDUINO
+    switch (esp_reset_reason()) {
+    case ESP_RST_POWERON: return "virta";
+    case ESP_RST_EXT: return "ulkoinen";
+    case ESP_RST_SW: return "ohjelma";
+    case ESP_RST_PANIC: return "paniikki";
+    case ESP_RST_INT_WDT: return "keskeytysvahti";
+    case ESP_RST_TASK_WDT: return "tehtävävahti";
+    case ESP_RST_WDT: return "vahtikoira";
+    case ESP_RST_DEEPSLEEP: return "syvä uni";
+    case ESP_RST_BROWNOUT: return "jännitekatko";
+    default: return "tuntematon";
+    }
+#else
+    return "native";
+#endif
+}
+
+// Vanhimmasta uusimpaan; keskeneräinen ruutu (piirrossa kaatumishetkellä) viimeisenä
+static void report(FILE *f, const char *reason) {
+    const pm_region_t &r = region;
+    fprintf(f, "[postmortem] %s: syy %s, käynnistys %lu, käynnissä %lu ms\n", KIOSK_DEVICE_ID, reason,
+            (unsigned long)r.boot_count, (unsigned long)r.uptime_ms);
+    if (r.assert_line) fprintf(f, "assert: %.*s:%lu\n", (int)sizeof(r.assert_file), r.assert_file,
+                               (unsigned long)r.assert_line);
+    fprintf(f, "muisti: LVGL %lu / %lu tavua, pirstoutuma %lu %%, sisäinen vapaa %lu (pienin %lu), PSRAM vapaa %lu\n",
+            (unsigned long)r.lv_used, (unsigned long)r.lv_total, (unsigned long)r.lv_frag,
+            (unsigned long)r.internal_free, (unsigned long)r.internal_min, (unsigned long)r.psram_free);
+
+    fprintf(f, "ruudut:\n");
+    uint32_t n = r.frame_head < POSTMORTEM_FRAMES ? r.frame_head : POSTMORTEM_FRAMES - 1;
+    for (uint32_t i = r.frame_head - n; i != r.frame_head; i++) {
+        const pm_frame_t &fr = r.frames[i % POSTMORTEM_FRAMES];
+        fprintf(f, "  %10lu ms %-8s %lu us\n", (unsigned long)fr.t_ms, screens_name((screen_id_t)fr.screen),
+                (unsigned long)fr.render_us);
+    }
+    if (r.frame_open) {
+        const pm_frame_t &fr = r.frames[r.frame_head % POSTMORTEM_FRAMES];
+        fprintf(f, "  %10lu ms %-8s KESKEN\n", (unsigned long)fr.t_ms, screens_name((screen_id_t)fr.screen));
+    }
+
+    fprintf(f, "syötteet:\n");
+    n = r.input_head < POSTMORTEM_INPUTS ? r.input_head : POSTMORTEM_INPUTS;
+    for (uint32_t i = r.input_head - n; i != r.input_head; i++) {
+        const pm_input_t &in = r.inputs[i % POSTMORTEM_INPUTS];
+        if (in.type == 2) fprintf(f, "  %10lu ms viivakoodi %lu\n", (unsigned long)in.t_ms, (unsigned long)in.code);
+        else fprintf(f, "  %10lu ms %s %d,%d\n", (unsigned long)in.t_ms, in.pressed ? "painallus" : "vapautus",
+                     in.x, in.y);
+    }
+
+    fprintf(f, "loki (tools/klog_decode.py:n tekstit klog_events.h:ssa):\n");
+    n = r.klog_head < POSTMORTEM_KLOG ? r.klog_head : POSTMORTEM_KLOG;
+    for (uint32_t i = r.klog_head - n; i != r.klog_head; i++) {
+        const klog_entry_t &k = r.klog[i % POSTMORTEM_KLOG];
+        fprintf(f, "  %10lu ms %-14s %lu %lu %lu%s\n", (unsigned long)k.t_ms, klog_event_name(k.event),
+                (unsigned long)k.args[0], (unsigned long)k.args[1], (unsigned long)k.args[2],
+                k.suppressed ? " (+pudotettuja)" : "");
+    }
+}
+
+void postmortem_begin(lv_display_t *disp) {
+    const char *reason = reset_reason();
+    bool valid = kiosk_warm_reset() && region.magic == PM_MAGIC;
+    if (valid) {
+        report(stdout, reason);
+        char path[64];
+        kiosk_fs_path(path, sizeof(path), POSTMORTEM_FILE);
+        FILE *f = fopen(path, "w");
+        if (f) {
+            report(f, reason);
+            fclose(f);
+        }
+#ifdef ARDUINO
+        klog(KLOG_POSTMORTEM, (uint32_t)esp_reset_reason(), region.boot_count);
+#else
+        klog(KLOG_POSTMORTEM, 0, region.boot_count);
+#endif
+    }
+
+    uint32_t boots = valid ? region.boot_count + 1 : 1;
+    memset(&region, 0, sizeof(region));
+    region.magic = PM_MAGIC;
+    region.boot_count = boots;
+    // Käynnistyksen merkinnät alkuun, sen jälkeen klog() kopioi jokaisen merkinnän itse
+    region.klog_head = klog_tail(region.klog, POSTMORTEM_KLOG);
+    klog_mirror(region.klog, POSTMORTEM_KLOG, &region.klog_head);
+
+    lv_display_add_event_cb(disp, render_start_cb, LV_EVENT_RENDER_START, NULL);
+    lv_display_add_event_cb(disp, render_ready_cb, LV_EVENT_RENDER_READY, NULL);
+    for (lv_indev_t *i = lv_indev_get_next(NULL); i; i = lv_indev_get_next(i)) {
+        if (lv_indev_get_type(i) != LV_INDEV_TYPE_POINTER) continue;
+        lv_indev_add_event_cb(i, pointer_cb, LV_EVENT_PRESSED, i);
+        lv_indev_add_event_cb(i, pointer_cb, LV_EVENT_RELEASED, i);
+    }
+    lv_timer_create(snapshot_timer_cb, 1000, NULL);
+    snapshot();
+}
+
+bool postmortem_upload() {
+    char path[64];
+    kiosk_fs_path(path, sizeof(path), POSTMORTEM_FILE);
+    FILE *f = fopen(path, "rb");
+    if (!f) return true; // Ei raporttia
+    fseek(f, 0, SEEK_END);
+    long len = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    uint8_t *body = (uint8_t *)malloc(len > 0 ? (size_t)len : 1);
+    bool read_ok = body && fread(body, 1, (size_t)len, f) == (size_t)len;
+    fclose(f);
+    if (!read_ok) {
+        free(body);
+        return false;
+    }
+    // Avain raportin sisällöstä: sama raportti uudelleen (kuittaus hukkui) saa 409:n, mutta
+    // boot_count alkaa virran katkettua alusta, joten se toistuisi eri raporteilla
+    char key[48];
+    snprintf(key, sizeof(key), "%s-pm-%08lx-%ld", KIOSK_DEVICE_ID,
+             (unsigned long)kiosk_crc32(body, (size_t)len), len);
+    int code = http_post(POSTMORTEM_URL, "text/plain; charset=utf-8", NULL, key, body, (size_t)len, SYNC_HTTP_TIMEOUT_MS);
+    free(body);
+    if ((code >= 200 && code < 300) || code == 409) {
+        remove(path);
+        klog(KLOG_POSTMORTEM_SENT, (uint32_t)len);
+        return true;
+    }
+    return false;
+}
+
+extern "C" void postmortem_assert(const char *file, int line) {
+    if (!in_assert) {
+        in_assert = true; // Kirjaus voi itse osua assertiin (esim. muisti lopussa)
+        const char *base = strrchr(file, '/');
+        snprintf(region.assert_file, sizeof(region.assert_file), "%s", base ? base + 1 : file);
+        region.assert_line = (uint32_t)line;
+        snapshot();
+    }
+#ifdef ARDUINO
+    esp_restart();
+#else
+    report(stdout, "assert");
+    abort();
+#endif
+}
@@ -0,0 +1,203 @@
+#include "profiler_export.h"
+#include "kiosk_port.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <atomic>
+#include <mutex>
+#include <lvgl.h>
+
+#if LV_USE_PROFILER
+
+#define END_BIT 0x80
+#define LINE_EVENTS 96 // Tapahtumia per E-rivi: enintään ~400 tavua base64:nä
+
+struct prof_event_t {
+    uint32_t ts;
+    uint8_t id;      // Nimen indeksi | END_BIT
+    uint8_t reserved[3];
+};
+
+// Rengaspuskuri: LVGL:n tehtävä kirjoittaa head-kohtaan, tyhjennystehtävä lukee tail-kohdasta
+static prof_event_t *ring;
+static std::atomic<uint32_t> head(0), tail(0);
+static std::atomic<uint32_t> dropped(0);
+static std::atomic<bool> enabled(false);
+// Nimet osoittimen mukaan; kirjoittaja lisää, lukija lukee tapahtuman jälkeen
+static std::atomic<const char *> names[PROFILER_EXPORT_MAX_NAMES];
+
+static std::mutex sink_mutex; // Tyhjennys tehtävästä ja profiler_export_stop():sta
+static FILE *sink;
+static bool task_started;
+static bool name_sent[PROFILER_EXPORT_MAX_NAMES];
+static uint32_t names_sent_ms;
+static uint32_t flushed_bytes;
+
+static int name_id(const char *tag) {
+    uint32_t i = (uint32_t)(((uintptr_t)tag >> 2) * 2654435761u) % PROFILER_EXPORT_MAX_NAMES;
+    for (int n = 0; n < PROFILER_EXPORT_MAX_NAMES; n++, i = (i + 1) % PROFILER_EXPORT_MAX_NAMES) {
+        const char *cur = names[i].load(std::memory_order_relaxed);
+        if (cur == tag) return (int)i;
+        if (!cur) {
+            names[i].store(tag, std::memory_order_relaxed); // Julkaistaan head-kirjoituksella
+            return (int)i;
+        }
+    }
+    return -1;
+}
+
+static void record(const char *tag, uint8_t end_bit) {
+    if (!enabled.load(std::memory_order_relaxed)) return;
+    uint32_t h = head.load(std::memory_order_relaxed);
+    int id = name_id(tag);
+    if (id < 0 || h - tail.load(std::memory_order_acquire) >= PROFILER_EXPORT_EVENTS) {
+        dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    prof_event_t &ev = ring[h % PROFILER_EXPORT_EVENTS];
+    ev.ts = (uint32_t)kiosk_time_us();
+    ev.id = (uint8_t)id | end_bit;
+    head.store(h + 1, std::memory_order_release);
+}
+
+void profiler_export_begin(const char *tag) {
+    record(tag, 0);
+}
+
+void profiler_export_end(const char *tag) {
+    record(tag, END_BIT);
+}
+
+static void put_line(const char *line) {
+    if (fputs(line, sink) >= 0) flushed_bytes += (uint32_t)strlen(line);
+}
+
+static size_t base64(const uint8_t *in, size_t len, char *out) {
+    static const char abc[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    size_t o = 0;
+    for (size_t i = 0; i < len; i += 3) {
+        uint32_t v = (uint32_t)in[i] << 16 | (i + 1 < len ? (uint32_t)in[i + 1] << 8 : 0) |
+                     (i + 2 < len ? in[i + 2] : 0);
+        out[o++] = abc[v >> 18];
+        out[o++] = abc[(v >> 12) & 63];
+        out[o++] = i + 1 < len ? abc[(v >> 6) & 63] : '=';
+        out[o++] = i + 2 < len ? abc[v & 63] : '=';
+    }
+    return o;
+}
+
+static size_t put_varint(uint8_t *p, uint32_t v) {
+    size_t n = 0;
+    for (; v >= 0x80; v >>= 7) p[n++] = (uint8_t)(v | 0x80);
+    p[n++] = (uint8_t)v;
+    return n;
+}
+
+static void send_name(int id) {
+    char line[96];
+    snprintf(line, sizeof(line), "@lvp N %d %s\n", id, names[id].load(std::memory_order_relaxed));
+    put_line(line);
+    name_sent[id] = true;
+}
+
+// Kutsutaan sink_mutex lukittuna
+static void drain() {
+    if (kiosk_time_ms() - names_sent_ms >= PROFILER_EXPORT_NAMES_MS) {
+        memset(name_sent, 0, sizeof(name_sent)); // Myöhemmin avattu sarjaporttiyhteys saa nimet
+        names_sent_ms = kiosk_time_ms();
+    }
+    uint32_t lost = dropped.exchange(0, std::memory_order_relaxed);
+    if (lost) {
+        char line[32];
+        snprintf(line, sizeof(line), "@lvp D %lu\n", (unsigned long)lost);
+        put_line(line);
+    }
+    uint32_t t = tail.load(std::memory_order_relaxed);
+    uint32_t h = head.load(std::memory_order_acquire);
+    while (t != h) {
+        uint32_t n = h - t < LINE_EVENTS ? h - t : LINE_EVENTS;
+        uint8_t bin[4 + LINE_EVENTS * 6];
+        const prof_event_t *first = &ring[t % PROFILER_EXPORT_EVENTS];
+        memcpy(bin, &first->ts, 4);
+        size_t len = 4;
+        uint32_t prev = first->ts;
+        for (uint32_t i = 0; i < n; i++) {
+            const prof_event_t &ev = ring[(t + i) % PROFILER_EXPORT_EVENTS];
+            int id = ev.id & ~END_BIT;
+            if (!name_sent[id]) send_name(id);
+            bin[len++] = ev.id;
+            len += put_varint(&bin[len], ev.ts - prev);
+            prev = ev.ts;
+        }
+        tail.store(t + n, std::memory_order_release); // Tietueet kopioitu, paikat vapaiksi
+        t += n;
+        char line[8 + (sizeof(bin) + 2) / 3 * 4 + 2];
+        size_t o = 7;
+        memcpy(line, "@lvp E ", o);
+        o += base64(bin, len, &line[o]);
+        line[o++] = '\n';
+        line[o] = '\0';
+        put_line(line);
+    }
+    fflush(sink);
+}
+
+static void flush_task(void *arg) {
+    (void)arg;
+    for (;;) {
+        kiosk_delay_ms(PROFILER_EXPORT_FLUSH_MS);
+        std::lock_guard<std::mutex> lock(sink_mutex);
+        if (sink) drain();
+    }
+}
+
+bool profiler_export_start(const char *path) {
+    std::lock_guard<std::mutex> lock(sink_mutex);
+    if (sink) return true;
+    if (!ring) ring = (prof_event_t *)kiosk_psram_alloc(PROFILER_EXPORT_EVENTS * sizeof(prof_event_t));
+    sink = !ring ? NULL : path ? fopen(path, "w") : stdout;
+    if (!sink) {
+        printf("[profiler] %s: avaus epäonnistui\n", ring ? path : "puskuri");
+        return false;
+    }
+    memset(name_sent, 0, sizeof(name_sent));
+    names_sent_ms = kiosk_time_ms();
+    flushed_bytes = 0;
+    if (!task_started) {
+        task_started = kiosk_task_start(flush_task, "profiler", 4096, PROFILER_EXPORT_TASK_PRIO,
+                                        PROFILER_EXPORT_TASK_CORE, NULL);
+    }
+    enabled.store(true, std::memory_order_relaxed);
+    printf("[profiler] jäljet: %s\n", path ? path : "stdout");
+    return true;
+}
+
+void profiler_export_stop() {
+    enabled.store(false, std::memory_order_relaxed);
+    std::lock_guard<std::mutex> lock(sink_mutex);
+    if (!sink) return;
+    drain();
+    if (sink != stdout) fclose(sink);
+    sink = NULL;
+    printf("[profiler] %lu tavua\n", (unsigned long)flushed_bytes);
+}
+
+#else
+
+bool profiler_export_start(const char *path) {
+    (void)path;
+    printf("[profiler] ei käännetty mukaan (-D KIOSK_PROFILER=1)\n");
+    return false;
+}
+
+void profiler_export_stop() {}
+
+void profiler_export_begin(const char *tag) {
+    (void)tag;
+}
+
+void profiler_export_end(const char *tag) {
+    (void)tag;
+}
+
+#endif
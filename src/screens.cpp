@@ -0,0 +1,136 @@
+#include "screens.h"
+#include "kiosk_port.h"
+#include "klog.h"
+
+#include <stdio.h>
+
+struct screen_entry_t {
+    screen_build_fn_t build;
+    lv_obj_t *obj;
+    bool pinned;
+    uint32_t last_used;   // LRU-laskuri
+};
+
+static screen_entry_t entries[SCREEN_COUNT];
+static screen_metrics_t metrics[SCREEN_COUNT];
+static screen_id_t current = SCREEN_MAIN;
+static uint32_t use_counter = 0;
+static uint64_t switch_started = 0;   // 0 = ei vaihtoa käynnissä
+static screen_hook_fn_t build_hook = NULL;
+static screen_show_fn_t show_hook = NULL;
+
+static const char *const screen_names[SCREEN_COUNT] = { "main", "scan", "confirm", "error", "admin" };
+
+static uint32_t lv_heap_used() {
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    return (uint32_t)(mon.total_size - mon.free_size);
+}
+
+static uint32_t lv_heap_free() {
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    return (uint32_t)mon.free_size;
+}
+
+static void refr_ready_cb(lv_event_t *e) {
+    (void)e;
+    if (!switch_started) return;
+    metrics[current].switch_us = (uint32_t)(kiosk_time_us() - switch_started);
+    switch_started = 0;
+}
+
+void screens_init() {
+    lv_display_add_event_cb(lv_display_get_default(), refr_ready_cb, LV_EVENT_REFR_READY, NULL);
+}
+
+void screens_register(screen_id_t id, screen_build_fn_t build, bool pinned) {
+    entries[id].build = build;
+    entries[id].pinned = pinned;
+}
+
+// Poistaa vanhimman kiinnittämättömän näkymän, joka ei ole näkyvissä
+static bool evict_one(screen_id_t keep) {
+    int victim = -1;
+    for (int i = 0; i < SCREEN_COUNT; i++) {
+        const screen_entry_t &s = entries[i];
+        if (!s.obj || s.pinned || i == (int)current || i == (int)keep) continue;
+        if (victim < 0 || s.last_used < entries[victim].last_used) victim = i;
+    }
+    if (victim < 0) return false;
+    lv_obj_delete(entries[victim].obj);
+    entries[victim].obj = NULL;
+    metrics[victim].resident = false;
+    klog(KLOG_SCREEN_EVICT, (uint32_t)victim, lv_heap_free());
+    return true;
+}
+
+static void trim_cache(screen_id_t keep) {
+    int cached = 0;
+    for (int i = 0; i < SCREEN_COUNT; i++) cached += entries[i].obj && !entries[i].pinned;
+    while (cached > SCREEN_CACHE_MAX && evict_one(keep)) cached--;
+    while (lv_heap_free() < SCREEN_MIN_FREE_HEAP && evict_one(keep)) {}
+}
+
+lv_obj_t *screens_get(screen_id_t id) {
+    screen_entry_t &s = entries[id];
+    if (!s.obj && s.build) {
+        uint32_t heap0 = lv_heap_used();
+        uint64_t t0 = kiosk_time_us();
+        s.obj = s.build();
+        metrics[id].build_us = (uint32_t)(kiosk_time_us() - t0);
+        metrics[id].heap_bytes = lv_heap_used() - heap0;
+        metrics[id].builds++;
+        metrics[id].resident = true;
+        klog(KLOG_SCREEN_BUILD, id, metrics[id].build_us, metrics[id].heap_bytes);
+        if (build_hook) build_hook(s.obj);
+        trim_cache(id);
+    }
+    s.last_used = ++use_counter;
+    return s.obj;
+}
+
+lv_obj_t *screens_peek(screen_id_t id) {
+    return entries[id].obj;
+}
+
+void screens_set_build_hook(screen_hook_fn_t hook) {
+    build_hook = hook;
+}
+
+void screens_set_show_hook(screen_show_fn_t hook) {
+    show_hook = hook;
+}
+
+void screens_show(screen_id_t id) {
+    lv_obj_t *scr = screens_get(id);
+    if (!scr) return;
+    if (scr == lv_screen_active()) return;
+    current = id;
+    metrics[id].switches++;
+    switch_started = kiosk_time_us();
+    klog(KLOG_SCREEN_SHOW, id);
+    if (show_hook) show_hook(id);
+    lv_screen_load(scr);
+}
+
+screen_id_t screens_current() {
+    return current;
+}
+
+const screen_metrics_t *screens_metrics(screen_id_t id) {
+    return &metrics[id];
+}
+
+const char *screens_name(screen_id_t id) {
+    return id < SCREEN_COUNT ? screen_names[id] : "?";
+}
+
+void screens_print_metrics() {
+    for (int i = 0; i < SCREEN_COUNT; i++) {
+        const screen_metrics_t &m = metrics[i];
+        printf("[screens] %-8s %s rakennettu %lux %lu us, %lu tavua, vaihtoja %lu, viimeisin %lu us\n", screen_names[i],
+               m.resident ? "muistissa" : "         ", (unsigned long)m.builds, (unsigned long)m.build_us,
+               (unsigned long)m.heap_bytes, (unsigned long)m.switches, (unsigned long)m.switch_us);
+    }
+}
@@ -0,0 +1,157 @@
+#include "tx_queue.h"
+#include "kiosk_config.h"
+#include "kiosk_port.h"
+
+#include <stdio.h>
+#include <unistd.h>
+#include <mutex>
+
+// Lokitiedosto on taulukko kiinteän kokoisia tietueita. Kuitattu raja tallennetaan
+// erilliseen tiedostoon (kirjoitus väliaikaiseen + rename = atominen vaihto).
+// Kun kaikki on kuitattu, loki tyhjennetään, joten se ei kasva loputtomasti.
+
+struct tx_entry_t {
+    tx_record_t rec;
+    uint32_t crc;
+};
+
+struct tx_ack_t {
+    uint32_t seq;
+    uint32_t crc;
+};
+
+static std::mutex txq_mutex;
+static FILE *log_file = NULL;
+static char log_path[64], ack_path[72], tmp_path[72];
+static uint32_t first_seq = 1;  // Lokin ensimmäisen tietueen numero
+static uint32_t next_seq = 1;   // Seuraavalle tapahtumalle annettava numero
+static uint32_t acked_seq = 0;  // Viimeisin kuitattu numero
+static long write_pos = 0;      // Lokin ehjän osan loppu
+
+static uint32_t entry_crc(const tx_entry_t *e) {
+    return kiosk_crc32(&e->rec, sizeof(e->rec));
+}
+
+static uint32_t read_ack() {
+    tx_ack_t ack;
+    FILE *f = fopen(ack_path, "rb");
+    if (!f) return 0;
+    size_t n = fread(&ack, sizeof(ack), 1, f);
+    fclose(f);
+    if (n != 1 || ack.crc != kiosk_crc32(&ack.seq, sizeof(ack.seq))) return 0;
+    return ack.seq;
+}
+
+static bool write_ack(uint32_t seq) {
+    tx_ack_t ack = { seq, kiosk_crc32(&seq, sizeof(seq)) };
+    FILE *f = fopen(tmp_path, "wb");
+    if (!f) return false;
+    bool ok = fwrite(&ack, sizeof(ack), 1, f) == 1;
+    ok = fflush(f) == 0 && ok;
+    fsync(fileno(f));
+    fclose(f);
+    return ok && rename(tmp_path, ack_path) == 0;
+}
+
+bool txq_begin(const char *file_name) {
+    std::lock_guard<std::mutex> lock(txq_mutex);
+
+    kiosk_fs_path(log_path, sizeof(log_path), file_name);
+    snprintf(ack_path, sizeof(ack_path), "%s.ack", log_path);
+    snprintf(tmp_path, sizeof(tmp_path), "%s.tmp", log_path);
+
+    acked_seq = read_ack();
+    log_file = fopen(log_path, "r+b");
+    if (!log_file) log_file = fopen(log_path, "w+b");
+    if (!log_file) return false;
+
+    // Palautus: luetaan ehjät tietueet, katkennut kirjoitus lopussa jätetään pois
+    tx_entry_t e;
+    uint32_t count = 0, expect = 0;
+    while (fread(&e, sizeof(e), 1, log_file) == 1) {
+        if (e.crc != entry_crc(&e)) break;
+        if (count == 0) first_seq = e.rec.seq;
+        else if (e.rec.seq != expect) break;
+        expect = e.rec.seq + 1;
+        count++;
+    }
+    write_pos = (long)(count * sizeof(tx_entry_t));
+
+    if (count == 0) {
+        first_seq = next_seq = acked_seq + 1;
+    } else {
+        next_seq = expect;
+        if (acked_seq + 1 < first_seq) acked_seq = first_seq - 1;
+        if (acked_seq >= next_seq) acked_seq = next_seq - 1;
+    }
+    return true;
+}
+
+void txq_end() {
+    std::lock_guard<std::mutex> lock(txq_mutex);
+    if (log_file) fclose(log_file);
+    log_file = NULL;
+}
+
+uint32_t txq_push(const tx_record_t *rec) {
+    std::lock_guard<std::mutex> lock(txq_mutex);
+    if (!log_file || next_seq - acked_seq - 1 >= TXQ_MAX_RECORDS) return 0;
+
+    tx_entry_t e;
+    e.rec = *rec;
+    e.rec.seq = next_seq;
+    e.crc = entry_crc(&e);
+
+    if (fseek(log_file, write_pos, SEEK_SET) != 0) return 0;
+    if (fwrite(&e, sizeof(e), 1, log_file) != 1) return 0;
+    if (fflush(log_file) != 0) return 0;
+#ifdef ARDUINO
+    fsync(fileno(log_file)); // Tapahtuma on flashilla ennen kuin kuittaamme sen käyttäjälle
+#endif
+    write_pos += sizeof(e);
+    return next_seq++;
+}
+
+size_t txq_peek(tx_record_t *out, size_t max) {
+    std::lock_guard<std::mutex> lock(txq_mutex);
+    uint32_t pending = next_seq - acked_seq - 1;
+    if (!log_file || pending == 0) return 0;
+    if (max > pending) max = pending;
+
+    long offset = (long)((acked_seq + 1 - first_seq) * sizeof(tx_entry_t));
+    if (fseek(log_file, offset, SEEK_SET) != 0) return 0;
+
+    size_t n = 0;
+    tx_entry_t e;
+    while (n < max && fread(&e, sizeof(e), 1, log_file) == 1) {
+        if (e.crc != entry_crc(&e)) break;
+        out[n++] = e.rec;
+    }
+    return n;
+}
+
+bool txq_ack(uint32_t last_seq) {
+    std::lock_guard<std::mutex> lock(txq_mutex);
+    if (last_seq >= next_seq) last_seq = next_seq - 1;
+    if (last_seq <= acked_seq) return true;
+    if (!write_ack(last_seq)) return false;
+    acked_seq = last_seq;
+
+    // Kaikki kuitattu: aloitetaan loki alusta
+    if (acked_seq + 1 == next_seq && write_pos >= TXQ_COMPACT_BYTES) {
+        FILE *f = freopen(log_path, "w+b", log_file);
+        if (!f) {
+            log_file = NULL;
+            return false;
+        }
+        log_file = f;
+        first_seq = next_seq;
+        write_pos = 0;
+    }
+    return true;
+}
+
+uint32_t txq_pending() {
+    std::lock_guard<std::mutex> lock(txq_mutex);
+    return next_seq - acked_seq - 1;
+}
@@ -0,0 +1,137 @@
+#include "ui_assets.h"
+#include "kiosk_config.h"
+#include "kiosk_port.h"
+#include "ui_font_proxy.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#ifdef ARDUINO
+#include <LittleFS.h>
+
+static fs::LittleFSFS assets_fs; // Eri osio kuin LittleFS (kiosk_fs): tapahtumajono ei ole assets-kuvassa
+#endif
+
+typedef struct {
+    char name[24];
+    lv_font_t *font;
+} asset_font_t;
+
+typedef struct {
+    char path[40];        // "A:images/<nimi>.bin"
+} asset_image_t;
+
+static asset_font_t fonts[UI_ASSETS_MAX_FONTS];
+static asset_image_t images[UI_ASSETS_MAX_IMAGES];
+static ui_assets_stats_t stats;
+static bool mounted;
+
+static size_t heap_used() {
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    return mon.total_size - mon.free_size;
+}
+
+static uint32_t file_size(const char *path) {
+    lv_fs_file_t f;
+    if (lv_fs_open(&f, path, LV_FS_MODE_RD) != LV_FS_RES_OK) return 0;
+    uint32_t size = 0;
+    lv_fs_seek(&f, 0, LV_FS_SEEK_END);
+    lv_fs_tell(&f, &size);
+    lv_fs_close(&f);
+    return size;
+}
+
+bool ui_assets_begin() {
+    if (mounted) return true;
+#ifdef ARDUINO
+    // Ei alusteta virheen sattuessa: tyhjä osio on päivittämättä, ei rikki
+    if (!assets_fs.begin(false, "/assets", 4, KIOSK_ASSETS_PARTITION)) {
+        printf("[assets] osiota %s ei voi liittää (pio run -e esp32-8048S043C-assets -t uploadfs)\n",
+               KIOSK_ASSETS_PARTITION);
+        return false;
+    }
+#endif
+    mounted = true;
+    // Ladatut fontit ovat LVGL:n keossa; sisäinen LV_MEM_SIZE on varattu näkymille
+    size_t bytes = (size_t)KIOSK_ASSET_POOL_KB * 1024;
+    void *pool = bytes ? kiosk_psram_alloc(bytes) : NULL;
+    if (pool) lv_mem_add_pool(pool, bytes);
+
+    if (!KIOSK_ASSET_FONTS) return true;
+    bool ok = true;
+    for (int i = 0; i < ui_font_proxy_count(); i++) {
+        const lv_font_t *font = ui_assets_font(ui_font_proxy_name(i));
+        if (!ui_font_proxy_set(ui_font_proxy_size(i), font)) ok = false;
+    }
+    return ok;
+}
+
+const lv_font_t *ui_assets_font(const char *name) {
+    if (!mounted) return NULL;
+    asset_font_t *slot = NULL;
+    for (asset_font_t &f : fonts) {
+        if (f.font && !strcmp(f.name, name)) return f.font;
+        if (!f.font && !slot) slot = &f;
+    }
+    if (!slot) return NULL;
+
+    char path[48];
+    snprintf(path, sizeof(path), "A:fonts/%s.bin", name);
+    size_t heap0 = heap_used();
+    uint64_t t0 = kiosk_time_us();
+    lv_font_t *font = lv_binfont_create(path);
+    uint32_t us = (uint32_t)(kiosk_time_us() - t0);
+    if (!font) {
+        printf("[assets] %s puuttuu tai on virheellinen\n", path);
+        return NULL;
+    }
+    font->fallback = &lv_font_montserrat_14; // Kuten ui_fonts.c: puuttuva merkki näkyy
+    snprintf(slot->name, sizeof(slot->name), "%s", name);
+    slot->font = font;
+    stats.fonts++;
+    stats.file_bytes += file_size(path);
+    stats.heap_bytes += heap_used() - heap0;
+    stats.load_us += us;
+    return font;
+}
+
+const char *ui_assets_image(const char *name) {
+    if (!mounted) return NULL;
+    char path[sizeof(images[0].path)];
+    if (snprintf(path, sizeof(path), "A:images/%s.bin", name) >= (int)sizeof(path)) return NULL;
+    asset_image_t *slot = NULL;
+    for (asset_image_t &img : images) {
+        if (img.path[0] && !strcmp(img.path, path)) return img.path;
+        if (!img.path[0] && !slot) slot = &img;
+    }
+    if (!slot) return NULL;
+
+    lv_image_header_t header;
+    uint64_t t0 = kiosk_time_us();
+    lv_result_t res = lv_image_decoder_get_info(path, &header);
+    uint32_t us = (uint32_t)(kiosk_time_us() - t0);
+    if (res != LV_RESULT_OK) {
+        printf("[assets] %s puuttuu tai on virheellinen\n", path);
+        return NULL;
+    }
+    memcpy(slot->path, path, sizeof(path));
+    stats.images++;
+    stats.image_bytes += file_size(path);
+    stats.image_us += us;
+    return slot->path;
+}
+
+void ui_assets_get_stats(ui_assets_stats_t *out) {
+    *out = stats;
+}
+
+void ui_assets_print_stats() {
+    if (stats.fonts)
+        printf("[assets] %lu fonttia, %lu tavua osiolta %.1f ms:ssa, muistissa %lu tavua\n",
+               (unsigned long)stats.fonts, (unsigned long)stats.file_bytes, stats.load_us / 1e3,
+               (unsigned long)stats.heap_bytes);
+    if (stats.images)
+        printf("[assets] %lu kuvaa, %lu tavua osiolla (luetaan piirrettäessä), otsakkeet %.1f ms\n",
+               (unsigned long)stats.images, (unsigned long)stats.image_bytes, stats.image_us / 1e3);
+}
@@ -0,0 +1,105 @@
+#include "ui_font_proxy.h"
+#include "kiosk_config.h"
+
+#if KIOSK_FONT_PROXY
+
+#include "ui_fonts.h"
+
+enum {
+#define UI_FONT_INDEX(name, size, line_height, base_line, ul_pos, ul_thickness) UI_FONT_INDEX_##name,
+    UI_FONTS(UI_FONT_INDEX)
+    UI_FONT_PROXY_COUNT
+};
+
+// Välittäjän user_data osoittaa sen kohdepaikkaan
+static const lv_font_t *targets[UI_FONT_PROXY_COUNT];
+
+static const lv_font_t *target_of(const lv_font_t *proxy) {
+    return *(const lv_font_t *const *)proxy->user_data;
+}
+
+// lv_font_get_glyph_dsc() asettaa resolved_font-kentäksi välittäjän, joten bittikartan
+// haku ja vapautus ohjataan takaisin fonttiin, jonka välimuistissa glyfi on
+static bool proxy_glyph_dsc(const lv_font_t *font, lv_font_glyph_dsc_t *dsc, uint32_t letter, uint32_t next) {
+    const lv_font_t *target = target_of(font);
+    return target && target->get_glyph_dsc(target, dsc, letter, next);
+}
+
+static const void *proxy_glyph_bitmap(lv_font_glyph_dsc_t *dsc, lv_draw_buf_t *buf) {
+    const lv_font_t *target = target_of(dsc->resolved_font);
+    dsc->resolved_font = target;
+    return target->get_glyph_bitmap(dsc, buf);
+}
+
+static void proxy_release_glyph(const lv_font_t *font, lv_font_glyph_dsc_t *dsc) {
+    const lv_font_t *target = target_of(font);
+    dsc->resolved_font = target;
+    if (target->release_glyph) target->release_glyph(target, dsc);
+}
+
+// Metriikat samat kuin esirasteroiduissa fonteissa (ui_fonts.c)
+#define UI_FONT_PROXY(name, size, lh, bl, ul_pos, ul_thickness) \
+    const lv_font_t name = {                                     \
+        .get_glyph_dsc = proxy_glyph_dsc,                        \
+        .get_glyph_bitmap = proxy_glyph_bitmap,                  \
+        .release_glyph = proxy_release_glyph,                    \
+        .line_height = lh,                                       \
+        .base_line = bl,                                         \
+        .subpx = LV_FONT_SUBPX_NONE,                             \
+        .underline_position = ul_pos,                            \
+        .underline_thickness = ul_thickness,                     \
+        .dsc = NULL,                                             \
+        .fallback = &lv_font_montserrat_14,                      \
+        .user_data = (void *)&targets[UI_FONT_INDEX_##name],     \
+    };
+UI_FONTS(UI_FONT_PROXY)
+
+#define UI_FONT_SIZE(name, size, line_height, base_line, ul_pos, ul_thickness) size,
+static const int32_t proxy_sizes[UI_FONT_PROXY_COUNT] = { UI_FONTS(UI_FONT_SIZE) };
+#define UI_FONT_NAME(name, size, line_height, base_line, ul_pos, ul_thickness) #name,
+static const char *const proxy_names[UI_FONT_PROXY_COUNT] = { UI_FONTS(UI_FONT_NAME) };
+
+bool ui_font_proxy_set(int32_t size, const lv_font_t *font) {
+    for (int i = 0; i < UI_FONT_PROXY_COUNT; i++) {
+        if (proxy_sizes[i] != size) continue;
+        targets[i] = font;
+        return font != NULL;
+    }
+    return false;
+}
+
+int ui_font_proxy_count(void) {
+    return UI_FONT_PROXY_COUNT;
+}
+
+int32_t ui_font_proxy_size(int i) {
+    return proxy_sizes[i];
+}
+
+const char *ui_font_proxy_name(int i) {
+    return proxy_names[i];
+}
+
+#else
+
+bool ui_font_proxy_set(int32_t size, const lv_font_t *font) {
+    (void)size;
+    (void)font;
+    return false;
+}
+
+int ui_font_proxy_count(void) {
+    return 0;
+}
+
+int32_t ui_font_proxy_size(int i) {
+    (void)i;
+    return 0;
+}
+
+const char *ui_font_proxy_name(int i) {
+    (void)i;
+    return NULL;
+}
+
+#endif
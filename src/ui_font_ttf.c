@@ -0,0 +1,116 @@
+#include "ui_font_ttf.h"
+#include "kiosk_config.h"
+#include "ui_font_proxy.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#if LV_USE_TINY_TTF
+
+#ifdef ARDUINO
+#include <esp_heap_caps.h>
+// board_build.embed_files = fonts/arial.ttf
+extern const uint8_t ttf_start[] asm("_binary_fonts_arial_ttf_start");
+extern const uint8_t ttf_end[] asm("_binary_fonts_arial_ttf_end");
+#endif
+
+typedef struct {
+    int32_t size;
+    lv_font_t *font;
+} ttf_size_t;
+
+static const uint8_t *ttf_data;
+static size_t ttf_size;
+static ttf_size_t sizes[UI_FONT_TTF_MAX];
+
+static bool load_data(void) {
+#ifdef ARDUINO
+    ttf_data = ttf_start;
+    ttf_size = ttf_end - ttf_start;
+    return true;
+#else
+    FILE *f = fopen(KIOSK_TTF_PATH, "rb");
+    if (!f) {
+        printf("[ttf] %s puuttuu (fontti ei ole versionhallinnassa)\n", KIOSK_TTF_PATH);
+        return false;
+    }
+    fseek(f, 0, SEEK_END);
+    long n = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    uint8_t *data = (uint8_t *)malloc(n);
+    bool ok = data && fread(data, 1, n, f) == (size_t)n;
+    fclose(f);
+    if (!ok) {
+        free(data);
+        return false;
+    }
+    ttf_data = data;
+    ttf_size = (size_t)n;
+    return true;
+#endif
+}
+
+static void add_cache_pool(void) {
+    // LVGL:n TLSF ei valitse poolia varaukselle, joten pooli kasvattaa koko kekoa;
+    // glyfien puskurit päätyvät siihen, kun sisäinen LV_MEM_SIZE on käytössä
+    size_t bytes = (size_t)KIOSK_TTF_POOL_KB * 1024;
+#ifdef ARDUINO
+    void *pool = heap_caps_malloc(bytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+#else
+    void *pool = malloc(bytes);
+#endif
+    if (!pool || !lv_mem_add_pool(pool, bytes)) printf("[ttf] välimuistipooli %lu kt epäonnistui\n",
+                                                       (unsigned long)KIOSK_TTF_POOL_KB);
+}
+
+bool ui_font_ttf_begin(void) {
+    if (ttf_data) return true;
+    if (!load_data()) return false;
+    add_cache_pool();
+    if (!KIOSK_TTF_UI) return true;
+    bool ok = true;
+    for (int i = 0; i < ui_font_proxy_count(); i++) {
+        int32_t size = ui_font_proxy_size(i);
+        if (!ui_font_proxy_set(size, ui_font_ttf(size))) ok = false;
+    }
+    return ok;
+}
+
+const lv_font_t *ui_font_ttf(int32_t size) {
+    if (!ttf_data) return NULL;
+    ttf_size_t *free_slot = NULL;
+    for (int i = 0; i < UI_FONT_TTF_MAX; i++) {
+        if (sizes[i].font && sizes[i].size == size) return sizes[i].font;
+        if (!sizes[i].font && !free_slot) free_slot = &sizes[i];
+    }
+    if (!free_slot) return NULL;
+    // Ilman kerningiä kuten lv_font_conv-fontit, jotta asettelu on sama kummallakin
+    free_slot->font = lv_tiny_ttf_create_data_ex(ttf_data, ttf_size, size, LV_FONT_KERNING_NONE,
+                                                 LV_TINY_TTF_CACHE_GLYPH_CNT);
+    if (!free_slot->font) return NULL;
+    free_slot->size = size;
+    free_slot->font->fallback = &lv_font_montserrat_14; // Kuten ui_fonts.c: puuttuva merkki näkyy
+    return free_slot->font;
+}
+
+size_t ui_font_ttf_data_size(void) {
+    return ttf_size;
+}
+
+#else
+
+bool ui_font_ttf_begin(void) {
+    printf("[ttf] ei käännetty mukaan (-D KIOSK_TINY_TTF=1)\n");
+    return false;
+}
+
+const lv_font_t *ui_font_ttf(int32_t size) {
+    (void)size;
+    return NULL;
+}
+
+size_t ui_font_ttf_data_size(void) {
+    return 0;
+}
+
+#endif
@@ -0,0 +1,19764 @@
+/*******************************************************************************
+ * Käyttöliittymän fontit Arial_24, Arial_32, Arial_48, Arial_70, 105 merkkiä (ui/strings.json)
+ * Generoitu: python3 tools/font_build.py. Älä muokkaa käsin.
+ * 24 px: skaalattu Arial_70.c:stä (tools/font_build.py, ei TTF:ää)
+ * 32 px: skaalattu Arial_70.c:stä (tools/font_build.py, ei TTF:ää)
+ * 48 px: skaalattu Arial_70.c:stä (tools/font_build.py, ei TTF:ää)
+ * 70 px: --bpp 4 --size 70 --no-compress --font arial.ttf --range 32-255 --format lvgl -o Arial_70.c
+ ******************************************************************************/
+
+#include "lvgl.h"
+
+extern const lv_font_t lv_font_montserrat_14;
+
+/*Kaikilla koilla sama merkistö ja glyfien järjestys; yhtenäiset välit suoraan, ei hakua*/
+#define UI_FONT_CMAP_NUM 9
+static const lv_font_fmt_txt_cmap_t ui_font_cmaps[UI_FONT_CMAP_NUM] = {
+    {
+        .range_start = 32, .range_length = 95, .glyph_id_start = 1,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 196, .range_length = 2, .glyph_id_start = 96,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 201, .range_length = 1, .glyph_id_start = 98,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 214, .range_length = 1, .glyph_id_start = 99,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 220, .range_length = 1, .glyph_id_start = 100,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 228, .range_length = 2, .glyph_id_start = 101,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 233, .range_length = 1, .glyph_id_start = 103,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 246, .range_length = 1, .glyph_id_start = 104,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 252, .range_length = 1, .glyph_id_start = 105,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    }
+};
+
+/*-----------------
+ *  Arial_24
+ *----------------*/
+
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t arial_24_bitmap[] = {
+    /* U+0020 " " */
+    /* U+0021 "!" */
+    0x22, 0x1e, 0xfa, 0xef, 0xae, 0xfa, 0xef, 0xad,
+    0xf9, 0xcf, 0x8b, 0xf7, 0xaf, 0x69, 0xf5, 0x8f,
+    0x47, 0xf3, 0x6f, 0x23, 0xb1, 0x0, 0x5, 0x63,
+    0xdf, 0x9d, 0xf9,
+    /* U+0022 "\"" */
+    0x11, 0x10, 0x11, 0x1d, 0xe7, 0x1d, 0xe6, 0xef,
+    0x71, 0xef, 0x6d, 0xf7, 0x1e, 0xf6, 0xbf, 0x60,
+    0xdf, 0x49, 0xf3, 0xb, 0xe2, 0x6f, 0x10, 0x8d,
+    0x0,
+    /* U+0023 "#" */
+    0x0, 0x0, 0x27, 0x40, 0x0, 0x67, 0x0, 0x0,
+    0x6, 0xf6, 0x0, 0x1d, 0xd0, 0x0, 0x0, 0x9f,
+    0x30, 0x2, 0xfa, 0x0, 0x0, 0xc, 0xe1, 0x0,
+    0x5f, 0x70, 0x0, 0x1, 0xec, 0x0, 0x8, 0xf4,
+    0x4, 0x55, 0x7f, 0xb5, 0x55, 0xcf, 0x65, 0xbf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x66, 0xbf,
+    0x76, 0x67, 0xfb, 0x66, 0x0, 0xc, 0xd1, 0x0,
+    0x5f, 0x60, 0x0, 0x1, 0xeb, 0x0, 0x8, 0xf3,
+    0x0, 0x0, 0x4f, 0x80, 0x0, 0xce, 0x10, 0x6,
+    0x8b, 0xfb, 0x88, 0x8e, 0xe8, 0x88, 0xbf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf2, 0x3d, 0xd4, 0x33,
+    0x8f, 0x73, 0x33, 0x1, 0xeb, 0x0, 0x9, 0xf3,
+    0x0, 0x0, 0x4f, 0x80, 0x0, 0xce, 0x10, 0x0,
+    0x7, 0xf5, 0x0, 0x1e, 0xb0, 0x0, 0x0, 0xaf,
+    0x20, 0x3, 0xf8, 0x0, 0x0, 0x2, 0x20, 0x0,
+    0x13, 0x10, 0x0, 0x0,
+    /* U+0024 "$" */
+    0x0, 0x0, 0x1, 0xa2, 0x0, 0x0, 0x0, 0x0,
+    0x16, 0xaf, 0xb6, 0x20, 0x0, 0x0, 0x4d, 0xff,
+    0xff, 0xfe, 0x40, 0x0, 0x2e, 0xfa, 0x4e, 0x6a,
+    0xfe, 0x20, 0x8, 0xfb, 0x2, 0xe3, 0xc, 0xf8,
+    0x0, 0xbf, 0x60, 0x2e, 0x30, 0x6a, 0x60, 0xb,
+    0xf6, 0x2, 0xe3, 0x0, 0x0, 0x0, 0x8f, 0xc1,
+    0x2e, 0x30, 0x0, 0x0, 0x2, 0xef, 0xc7, 0xe3,
+    0x0, 0x0, 0x0, 0x4, 0xdf, 0xff, 0xd8, 0x30,
+    0x0, 0x0, 0x1, 0x6b, 0xff, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x2e, 0x7a, 0xff, 0x70, 0x0, 0x0,
+    0x2, 0xe3, 0x7, 0xfe, 0x0, 0x12, 0x0, 0x2e,
+    0x30, 0x1f, 0xf2, 0x1d, 0xf2, 0x2, 0xe3, 0x1,
+    0xef, 0x30, 0xef, 0x70, 0x2e, 0x30, 0x3f, 0xf1,
+    0x8, 0xfe, 0x32, 0xe3, 0x1c, 0xfa, 0x0, 0x1c,
+    0xfe, 0xaf, 0xad, 0xfd, 0x20, 0x0, 0x19, 0xef,
+    0xff, 0xfa, 0x20, 0x0, 0x0, 0x0, 0x4e, 0x51,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xe3, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x16, 0x10, 0x0, 0x0,
+    /* U+0025 "%" */
+    0x0, 0x37, 0x73, 0x0, 0x0, 0x0, 0x5, 0x71,
+    0x0, 0x0, 0x6e, 0xee, 0xe7, 0x0, 0x0, 0x2,
+    0xea, 0x0, 0x0, 0x2e, 0xd3, 0x2b, 0xf3, 0x0,
+    0x0, 0x8f, 0x30, 0x0, 0x6, 0xf6, 0x0, 0x4f,
+    0x80, 0x0, 0x2e, 0xa0, 0x0, 0x0, 0x9f, 0x40,
+    0x2, 0xfa, 0x0, 0x9, 0xf2, 0x0, 0x0, 0x9,
+    0xf4, 0x0, 0x2f, 0xb0, 0x2, 0xf9, 0x0, 0x0,
+    0x0, 0x7f, 0x50, 0x3, 0xf9, 0x0, 0x9f, 0x20,
+    0x0, 0x0, 0x3, 0xfa, 0x0, 0x9f, 0x50, 0x2f,
+    0x90, 0x0, 0x0, 0x0, 0x9, 0xfc, 0xcf, 0xa0,
+    0xa, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x6, 0xbb,
+    0x61, 0x3, 0xf8, 0x0, 0x14, 0x42, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xae, 0x20, 0x3d, 0xff, 0xe6,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0x80, 0xd, 0xe5,
+    0x3b, 0xf4, 0x0, 0x0, 0x0, 0xb, 0xe1, 0x4,
+    0xf9, 0x0, 0x3f, 0xa0, 0x0, 0x0, 0x4, 0xf7,
+    0x0, 0x7f, 0x60, 0x1, 0xec, 0x0, 0x0, 0x0,
+    0xbd, 0x10, 0x7, 0xf5, 0x0, 0x1e, 0xd0, 0x0,
+    0x0, 0x4f, 0x70, 0x0, 0x5f, 0x70, 0x2, 0xeb,
+    0x0, 0x0, 0xc, 0xd1, 0x0, 0x2, 0xec, 0x10,
+    0x8f, 0x60, 0x0, 0x5, 0xf6, 0x0, 0x0, 0x7,
+    0xfe, 0xcf, 0xb1, 0x0, 0x0, 0x89, 0x10, 0x0,
+    0x0, 0x4, 0x9a, 0x60, 0x0,
+    /* U+0026 "&" */
+    0x0, 0x0, 0x26, 0x75, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x6e, 0xff, 0xfd, 0x40, 0x0, 0x0, 0x0,
+    0x4f, 0xe7, 0x49, 0xfe, 0x10, 0x0, 0x0, 0xa,
+    0xf8, 0x0, 0xc, 0xf5, 0x0, 0x0, 0x0, 0xcf,
+    0x70, 0x0, 0xbf, 0x60, 0x0, 0x0, 0x9, 0xfd,
+    0x10, 0x2e, 0xf3, 0x0, 0x0, 0x0, 0x3e, 0xfa,
+    0x4d, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x18, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x3d, 0xfd, 0xcf, 0xe2,
+    0x0, 0x10, 0x0, 0x2d, 0xfb, 0x22, 0xdf, 0xc1,
+    0x1e, 0xb2, 0x9, 0xfc, 0x10, 0x4, 0xef, 0x96,
+    0xfe, 0x10, 0xdf, 0x60, 0x0, 0x6, 0xff, 0xef,
+    0x90, 0xe, 0xf5, 0x0, 0x0, 0x9, 0xff, 0xf2,
+    0x0, 0xcf, 0xa0, 0x0, 0x0, 0x3f, 0xfe, 0x20,
+    0x6, 0xff, 0x50, 0x0, 0x3c, 0xff, 0xfd, 0x20,
+    0xb, 0xff, 0xa8, 0xaf, 0xfc, 0x5e, 0xfd, 0x30,
+    0x18, 0xff, 0xff, 0xe8, 0x10, 0x4e, 0xc1, 0x0,
+    0x1, 0x45, 0x41, 0x0, 0x0, 0x21, 0x0,
+    /* U+0027 "'" */
+    0x11, 0x1d, 0xe6, 0xef, 0x7e, 0xf7, 0xdf, 0x5a,
+    0xf2, 0x7e, 0x10,
+    /* U+0028 "(" */
+    0x0, 0x0, 0x34, 0x0, 0x1, 0xda, 0x0, 0x9,
+    0xe2, 0x0, 0x4f, 0x90, 0x0, 0xbe, 0x20, 0x3,
+    0xfb, 0x0, 0x9, 0xf6, 0x0, 0xe, 0xf2, 0x0,
+    0x3f, 0xd1, 0x0, 0x5f, 0xc0, 0x0, 0x7f, 0xa0,
+    0x0, 0x8f, 0xa0, 0x0, 0x8f, 0xa0, 0x0, 0x7f,
+    0xb0, 0x0, 0x5f, 0xc0, 0x0, 0x2f, 0xe1, 0x0,
+    0xd, 0xf3, 0x0, 0x8, 0xf7, 0x0, 0x2, 0xec,
+    0x0, 0x0, 0xaf, 0x40, 0x0, 0x3e, 0xa0, 0x0,
+    0x8, 0xf3, 0x0, 0x1, 0xcb, 0x0, 0x0, 0x12,
+    /* U+0029 ")" */
+    0x25, 0x10, 0x0, 0x2, 0xe8, 0x0, 0x0, 0x8,
+    0xf3, 0x0, 0x0, 0x1e, 0xb0, 0x0, 0x0, 0x8f,
+    0x50, 0x0, 0x3, 0xfc, 0x0, 0x0, 0xc, 0xf3,
+    0x0, 0x0, 0x9f, 0x80, 0x0, 0x5, 0xfb, 0x0,
+    0x0, 0x3f, 0xd1, 0x0, 0x2, 0xee, 0x20, 0x0,
+    0x2e, 0xe2, 0x0, 0x2, 0xee, 0x20, 0x0, 0x2f,
+    0xe2, 0x0, 0x4, 0xfd, 0x0, 0x0, 0x6f, 0xb0,
+    0x0, 0xa, 0xf7, 0x0, 0x1, 0xde, 0x20, 0x0,
+    0x4f, 0xa0, 0x0, 0xa, 0xf4, 0x0, 0x2, 0xea,
+    0x0, 0x0, 0x9e, 0x20, 0x0, 0x3e, 0x60, 0x0,
+    0x1, 0x20, 0x0, 0x0,
+    /* U+002A "*" */
+    0x0, 0x2, 0x73, 0x0, 0x0, 0x0, 0x3f, 0x60,
+    0x0, 0x7, 0x43, 0xe5, 0x38, 0x12, 0xef, 0xdf,
+    0xcf, 0xf5, 0x2, 0x5c, 0xfd, 0x74, 0x0, 0x4,
+    0xeb, 0xf7, 0x0, 0x2, 0xed, 0x1a, 0xf5, 0x0,
+    0x6, 0x40, 0x28, 0x10,
+    /* U+002B "+" */
+    0x0, 0x0, 0x1, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x1e, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xe1,
+    0x0, 0x0, 0x0, 0x0, 0x1e, 0xe1, 0x0, 0x0,
+    0x0, 0x0, 0x1e, 0xe1, 0x0, 0x0, 0x58, 0x88,
+    0x8e, 0xe8, 0x88, 0x85, 0xaf, 0xff, 0xff, 0xff,
+    0xff, 0xfa, 0x47, 0x77, 0x8e, 0xe7, 0x77, 0x75,
+    0x0, 0x0, 0x1e, 0xe1, 0x0, 0x0, 0x0, 0x0,
+    0x1e, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xe1,
+    0x0, 0x0, 0x0, 0x0, 0x1e, 0xe1, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0x40, 0x0, 0x0,
+    /* U+002C "," */
+    0x56, 0x3d, 0xf8, 0xdf, 0x80, 0xb7, 0x1e, 0x5b,
+    0xb1, 0x21, 0x0,
+    /* U+002D "-" */
+    0x14, 0x44, 0x44, 0x41, 0x4f, 0xff, 0xff, 0xf4,
+    0x3d, 0xdd, 0xdd, 0xd3,
+    /* U+002E "." */
+    0x56, 0x3c, 0xf9, 0xcf, 0x90,
+    /* U+002F "/" */
+    0x0, 0x0, 0x15, 0x30, 0x0, 0x4, 0xf7, 0x0,
+    0x0, 0x8f, 0x30, 0x0, 0xc, 0xd0, 0x0, 0x2,
+    0xe9, 0x0, 0x0, 0x6f, 0x50, 0x0, 0xa, 0xe1,
+    0x0, 0x1, 0xeb, 0x0, 0x0, 0x4f, 0x70, 0x0,
+    0x8, 0xf3, 0x0, 0x0, 0xcd, 0x10, 0x0, 0x2e,
+    0x90, 0x0, 0x5, 0xf5, 0x0, 0x0, 0xaf, 0x10,
+    0x0, 0xe, 0xc0, 0x0, 0x3, 0xf8, 0x0, 0x0,
+    0x7f, 0x30, 0x0, 0xb, 0xe1, 0x0, 0x0, 0x54,
+    0x0, 0x0, 0x0,
+    /* U+0030 "0" */
+    0x0, 0x0, 0x12, 0x20, 0x0, 0x0, 0x0, 0x3b,
+    0xef, 0xec, 0x40, 0x0, 0x3, 0xef, 0xc9, 0xcf,
+    0xf5, 0x0, 0xc, 0xf8, 0x0, 0x6, 0xfe, 0x10,
+    0x4f, 0xd1, 0x0, 0x0, 0xaf, 0x70, 0x9f, 0x80,
+    0x0, 0x0, 0x5f, 0xc0, 0xcf, 0x60, 0x0, 0x0,
+    0x2f, 0xf0, 0xef, 0x40, 0x0, 0x0, 0x1f, 0xf2,
+    0xff, 0x30, 0x0, 0x0, 0x1e, 0xf3, 0xff, 0x20,
+    0x0, 0x0, 0x1e, 0xf3, 0xff, 0x30, 0x0, 0x0,
+    0x1e, 0xf3, 0xef, 0x40, 0x0, 0x0, 0x1f, 0xf2,
+    0xcf, 0x50, 0x0, 0x0, 0x2f, 0xf0, 0x9f, 0x70,
+    0x0, 0x0, 0x4f, 0xc0, 0x5f, 0xc0, 0x0, 0x0,
+    0x9f, 0x80, 0x1d, 0xf6, 0x0, 0x4, 0xef, 0x20,
+    0x5, 0xff, 0x96, 0x9e, 0xf8, 0x0, 0x0, 0x5e,
+    0xff, 0xfe, 0x70, 0x0, 0x0, 0x0, 0x45, 0x41,
+    0x0, 0x0,
+    /* U+0031 "1" */
+    0x0, 0x0, 0x1, 0x30, 0x0, 0x1, 0xce, 0x0,
+    0x1, 0xaf, 0xe0, 0x1, 0xaf, 0xfe, 0x6, 0xdf,
+    0xef, 0xe6, 0xff, 0xa4, 0xfe, 0x6b, 0x40, 0x2f,
+    0xe0, 0x0, 0x2, 0xfe, 0x0, 0x0, 0x2f, 0xe0,
+    0x0, 0x2, 0xfe, 0x0, 0x0, 0x2f, 0xe0, 0x0,
+    0x2, 0xfe, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x2,
+    0xfe, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x2, 0xfe,
+    0x0, 0x0, 0x2f, 0xe0, 0x0, 0x2, 0xfe,
+    /* U+0032 "2" */
+    0x0, 0x0, 0x2, 0x22, 0x10, 0x0, 0x0, 0x0,
+    0x5c, 0xef, 0xfd, 0x81, 0x0, 0x0, 0x8f, 0xfb,
+    0x9a, 0xef, 0xc1, 0x0, 0x4f, 0xe5, 0x0, 0x2,
+    0xdf, 0x90, 0x9, 0xf9, 0x0, 0x0, 0x5, 0xfe,
+    0x0, 0xae, 0x50, 0x0, 0x0, 0x2f, 0xf1, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xbf, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf7, 0x0, 0x0,
+    0x0, 0x1, 0x9f, 0xe6, 0x0, 0x0, 0x0, 0x1,
+    0xbf, 0xe4, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xd3,
+    0x0, 0x0, 0x0, 0x1, 0xbf, 0xc2, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xe3, 0x11, 0x11, 0x11, 0x10,
+    0x1e, 0xff, 0xff, 0xff, 0xff, 0xff, 0x14, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf1,
+    /* U+0033 "3" */
+    0x0, 0x0, 0x22, 0x20, 0x0, 0x0, 0x0, 0x5c,
+    0xff, 0xeb, 0x40, 0x0, 0x7, 0xff, 0xb9, 0xbf,
+    0xf5, 0x0, 0x3f, 0xf5, 0x0, 0x6, 0xfe, 0x10,
+    0x9f, 0xa0, 0x0, 0x0, 0xdf, 0x50, 0x47, 0x40,
+    0x0, 0x0, 0xbf, 0x60, 0x0, 0x0, 0x0, 0x2,
+    0xef, 0x30, 0x0, 0x0, 0x1, 0x5d, 0xf9, 0x0,
+    0x0, 0x0, 0x9e, 0xff, 0x90, 0x0, 0x0, 0x0,
+    0x9a, 0xbe, 0xfa, 0x10, 0x0, 0x0, 0x0, 0x3,
+    0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf1,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf3, 0x8b, 0x30,
+    0x0, 0x0, 0x1f, 0xf3, 0xcf, 0x80, 0x0, 0x0,
+    0x5f, 0xf1, 0x6f, 0xe3, 0x0, 0x2, 0xdf, 0x90,
+    0xb, 0xfe, 0x96, 0x8e, 0xfc, 0x10, 0x1, 0x8e,
+    0xff, 0xff, 0x91, 0x0, 0x0, 0x1, 0x45, 0x41,
+    0x0, 0x0,
+    /* U+0034 "4" */
+    0x0, 0x0, 0x0, 0x0, 0x22, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5f, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0x2d, 0xfd, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
+    0xd0, 0x0, 0x0, 0x0, 0x6, 0xfc, 0xfd, 0x0,
+    0x0, 0x0, 0x3, 0xec, 0x5f, 0xd0, 0x0, 0x0,
+    0x1, 0xce, 0x34, 0xfd, 0x0, 0x0, 0x0, 0x8f,
+    0x70, 0x4f, 0xd0, 0x0, 0x0, 0x4f, 0xb1, 0x4,
+    0xfd, 0x0, 0x0, 0x1d, 0xe2, 0x0, 0x4f, 0xd0,
+    0x0, 0xa, 0xf6, 0x0, 0x4, 0xfd, 0x0, 0x6,
+    0xfb, 0x22, 0x22, 0x5f, 0xd2, 0x20, 0xaf, 0xee,
+    0xee, 0xee, 0xff, 0xee, 0x39, 0xdd, 0xdd, 0xdd,
+    0xef, 0xfd, 0xd2, 0x0, 0x0, 0x0, 0x4, 0xfd,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xfd, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xd0, 0x0,
+    /* U+0035 "5" */
+    0x1, 0xbc, 0xcc, 0xcc, 0xcc, 0x70, 0x3, 0xff,
+    0xff, 0xff, 0xff, 0x90, 0x6, 0xfb, 0x33, 0x33,
+    0x33, 0x20, 0x9, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xe, 0xe1,
+    0x14, 0x42, 0x0, 0x0, 0x3f, 0xda, 0xff, 0xff,
+    0xb2, 0x0, 0x5f, 0xfe, 0xa9, 0xae, 0xfd, 0x20,
+    0x7f, 0xd3, 0x0, 0x3, 0xdf, 0xb0, 0x12, 0x10,
+    0x0, 0x0, 0x4f, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x1e, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf5,
+    0x78, 0x30, 0x0, 0x0, 0x1e, 0xf4, 0xcf, 0x80,
+    0x0, 0x0, 0x5f, 0xe1, 0x7f, 0xe3, 0x0, 0x2,
+    0xdf, 0x80, 0x1b, 0xfe, 0x96, 0x8e, 0xfb, 0x10,
+    0x1, 0x9f, 0xff, 0xff, 0x91, 0x0, 0x0, 0x1,
+    0x45, 0x41, 0x0, 0x0,
+    /* U+0036 "6" */
+    0x0, 0x0, 0x1, 0x22, 0x10, 0x0, 0x0, 0x0,
+    0x19, 0xdf, 0xfd, 0x91, 0x0, 0x0, 0x2c, 0xfd,
+    0xaa, 0xef, 0xc1, 0x0, 0xb, 0xfb, 0x10, 0x2,
+    0xdf, 0x70, 0x3, 0xfd, 0x10, 0x0, 0x6, 0xfc,
+    0x0, 0x8f, 0x80, 0x0, 0x0, 0x13, 0x20, 0xc,
+    0xf4, 0x0, 0x12, 0x0, 0x0, 0x0, 0xef, 0x15,
+    0xcf, 0xfe, 0x81, 0x0, 0x1f, 0xe8, 0xfe, 0xbc,
+    0xff, 0xb1, 0x2, 0xff, 0xf9, 0x10, 0x4, 0xef,
+    0x80, 0x2f, 0xfc, 0x10, 0x0, 0x6, 0xfe, 0x1,
+    0xff, 0x70, 0x0, 0x0, 0x1f, 0xf3, 0xe, 0xf5,
+    0x0, 0x0, 0x1, 0xef, 0x40, 0xbf, 0x70, 0x0,
+    0x0, 0x1e, 0xf2, 0x7, 0xfb, 0x0, 0x0, 0x4,
+    0xfe, 0x0, 0x2e, 0xf6, 0x0, 0x1, 0xcf, 0x80,
+    0x0, 0x5f, 0xfa, 0x67, 0xdf, 0xc1, 0x0, 0x0,
+    0x4d, 0xff, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x3,
+    0x54, 0x20, 0x0, 0x0,
+    /* U+0037 "7" */
+    0xac, 0xcc, 0xcc, 0xcc, 0xcc, 0xc3, 0xdf, 0xff,
+    0xff, 0xff, 0xff, 0xf4, 0x34, 0x44, 0x44, 0x44,
+    0xcf, 0xa0, 0x0, 0x0, 0x0, 0x7, 0xfd, 0x10,
+    0x0, 0x0, 0x0, 0x3e, 0xf4, 0x0, 0x0, 0x0,
+    0x0, 0xbf, 0x90, 0x0, 0x0, 0x0, 0x5, 0xfe,
+    0x10, 0x0, 0x0, 0x0, 0x1c, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x5f, 0xe1, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0x80, 0x0, 0x0, 0x0, 0x2, 0xef, 0x30,
+    0x0, 0x0, 0x0, 0x6, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x1e,
+    0xf4, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xe2, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xd0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x13,
+    0x20, 0x0, 0x0, 0x0,
+    /* U+0038 "8" */
+    0x0, 0x0, 0x12, 0x20, 0x0, 0x0, 0x0, 0x4b,
+    0xef, 0xec, 0x50, 0x0, 0x5, 0xef, 0xc9, 0xbf,
+    0xf7, 0x0, 0x1d, 0xf8, 0x0, 0x5, 0xff, 0x30,
+    0x4f, 0xd1, 0x0, 0x0, 0xbf, 0x70, 0x5f, 0xc0,
+    0x0, 0x0, 0x9f, 0x90, 0x2f, 0xe2, 0x0, 0x0,
+    0xcf, 0x60, 0x9, 0xfc, 0x30, 0x29, 0xfd, 0x10,
+    0x0, 0x7f, 0xfe, 0xff, 0xa2, 0x0, 0x6, 0xdf,
+    0xdc, 0xdf, 0xe6, 0x0, 0x5f, 0xf7, 0x10, 0x15,
+    0xef, 0x60, 0xcf, 0x90, 0x0, 0x0, 0x5f, 0xe1,
+    0xef, 0x30, 0x0, 0x0, 0x1e, 0xf4, 0xff, 0x30,
+    0x0, 0x0, 0xd, 0xf4, 0xdf, 0x60, 0x0, 0x0,
+    0x2f, 0xf2, 0x7f, 0xd3, 0x0, 0x1, 0xaf, 0xb0,
+    0x1b, 0xfe, 0x96, 0x7d, 0xfe, 0x20, 0x1, 0x8e,
+    0xff, 0xff, 0xb2, 0x0, 0x0, 0x1, 0x45, 0x42,
+    0x0, 0x0,
+    /* U+0039 "9" */
+    0x0, 0x0, 0x22, 0x10, 0x0, 0x0, 0x0, 0x5c,
+    0xef, 0xeb, 0x30, 0x0, 0x7, 0xff, 0xc9, 0xbf,
+    0xe5, 0x0, 0x4f, 0xf8, 0x0, 0x5, 0xee, 0x20,
+    0xaf, 0xa0, 0x0, 0x0, 0x8f, 0x90, 0xef, 0x50,
+    0x0, 0x0, 0x3f, 0xe0, 0xff, 0x30, 0x0, 0x0,
+    0x1f, 0xf2, 0xef, 0x40, 0x0, 0x0, 0x2f, 0xf4,
+    0xbf, 0x80, 0x0, 0x0, 0x6f, 0xf4, 0x6f, 0xe5,
+    0x0, 0x3, 0xef, 0xf4, 0xb, 0xff, 0xb8, 0xae,
+    0xcd, 0xf4, 0x1, 0x9e, 0xff, 0xe9, 0x2d, 0xf3,
+    0x0, 0x2, 0x44, 0x20, 0x1f, 0xf1, 0x1, 0x0,
+    0x0, 0x0, 0x4f, 0xc0, 0x8e, 0x70, 0x0, 0x0,
+    0xaf, 0x80, 0x5f, 0xd1, 0x0, 0x5, 0xfe, 0x20,
+    0xc, 0xfd, 0x76, 0xaf, 0xf5, 0x0, 0x1, 0xaf,
+    0xff, 0xfd, 0x40, 0x0, 0x0, 0x2, 0x55, 0x30,
+    0x0, 0x0,
+    /* U+003A ":" */
+    0x45, 0x3c, 0xf9, 0xcf, 0x91, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x56,
+    0x3c, 0xf9, 0xcf, 0x90,
+    /* U+003B ";" */
+    0x45, 0x3d, 0xf8, 0xdf, 0x81, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x56,
+    0x3d, 0xf8, 0xdf, 0x80, 0xb7, 0x1e, 0x5b, 0xb1,
+    0x21, 0x0,
+    /* U+003C "<" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xba, 0x0, 0x0, 0x0, 0x17,
+    0xdf, 0xfa, 0x0, 0x0, 0x39, 0xff, 0xfb, 0x50,
+    0x1, 0x6c, 0xff, 0xe9, 0x30, 0x0, 0x6d, 0xff,
+    0xc6, 0x10, 0x0, 0x0, 0xaf, 0xe6, 0x0, 0x0,
+    0x0, 0x0, 0x7e, 0xfe, 0xa5, 0x10, 0x0, 0x0,
+    0x1, 0x7c, 0xff, 0xd7, 0x20, 0x0, 0x0, 0x1,
+    0x5b, 0xef, 0xea, 0x30, 0x0, 0x0, 0x0, 0x39,
+    0xef, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x16, 0xca,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    /* U+003D "=" */
+    0xaf, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x9e, 0xee,
+    0xee, 0xee, 0xee, 0xea, 0x1, 0x11, 0x11, 0x11,
+    0x11, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8b, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xb8, 0xaf, 0xff, 0xff, 0xff,
+    0xff, 0xfa, 0x23, 0x33, 0x33, 0x33, 0x33, 0x32,
+    /* U+003E ">" */
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xab, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xfd, 0x71, 0x0,
+    0x0, 0x0, 0x5, 0xbf, 0xff, 0xa3, 0x0, 0x0,
+    0x0, 0x3, 0x9e, 0xff, 0xc6, 0x10, 0x0, 0x0,
+    0x1, 0x6c, 0xff, 0xe6, 0x0, 0x0, 0x0, 0x0,
+    0x6e, 0xfa, 0x0, 0x0, 0x1, 0x4b, 0xef, 0xe7,
+    0x0, 0x2, 0x7d, 0xff, 0xc7, 0x10, 0x4, 0x9e,
+    0xff, 0xb5, 0x10, 0x0, 0x9f, 0xfe, 0x93, 0x0,
+    0x0, 0x0, 0xac, 0x61, 0x0, 0x0, 0x0, 0x0,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    /* U+003F "?" */
+    0x0, 0x3, 0x67, 0x64, 0x10, 0x0, 0x1, 0xaf,
+    0xff, 0xff, 0xc4, 0x0, 0xc, 0xfd, 0x74, 0x6c,
+    0xfe, 0x30, 0x6f, 0xe3, 0x0, 0x1, 0xbf, 0xc0,
+    0xbf, 0x80, 0x0, 0x0, 0x3f, 0xf1, 0x7a, 0x30,
+    0x0, 0x0, 0x1f, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x5f, 0xe0, 0x0, 0x0, 0x0, 0x3, 0xef, 0x70,
+    0x0, 0x0, 0x0, 0x4e, 0xfa, 0x0, 0x0, 0x0,
+    0x4, 0xef, 0x90, 0x0, 0x0, 0x0, 0x1c, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x4f, 0xd1, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x6c, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x46, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xc0, 0x0, 0x0,
+    /* U+0040 "@" */
+    0x0, 0x0, 0x0, 0x0, 0x24, 0x67, 0x76, 0x31,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xbe,
+    0xff, 0xff, 0xff, 0xd8, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x2b, 0xff, 0xc7, 0x54, 0x46, 0x9d, 0xfe,
+    0x60, 0x0, 0x0, 0x0, 0x3d, 0xfb, 0x30, 0x0,
+    0x0, 0x0, 0x16, 0xef, 0x70, 0x0, 0x0, 0x1d,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xdf,
+    0x50, 0x0, 0xa, 0xf7, 0x0, 0x1, 0x6a, 0x94,
+    0x1, 0x54, 0x3, 0xed, 0x0, 0x4, 0xfa, 0x0,
+    0x4, 0xef, 0xff, 0xf9, 0x6f, 0xb0, 0x8, 0xf5,
+    0x0, 0xaf, 0x30, 0x4, 0xef, 0x82, 0x29, 0xfe,
+    0xf7, 0x0, 0x2f, 0xa0, 0x1e, 0xb0, 0x1, 0xdf,
+    0x70, 0x0, 0xa, 0xff, 0x40, 0x1, 0xdd, 0x5,
+    0xf6, 0x0, 0x7f, 0xc0, 0x0, 0x0, 0x6f, 0xe2,
+    0x0, 0xc, 0xe0, 0x8f, 0x30, 0xd, 0xf6, 0x0,
+    0x0, 0x4, 0xfc, 0x0, 0x1, 0xdd, 0xa, 0xf1,
+    0x2, 0xfe, 0x20, 0x0, 0x0, 0x6f, 0x90, 0x0,
+    0x2f, 0xb0, 0xaf, 0x10, 0x3f, 0xe1, 0x0, 0x0,
+    0x9, 0xf6, 0x0, 0x7, 0xf7, 0xa, 0xf2, 0x3,
+    0xfe, 0x10, 0x0, 0x1, 0xef, 0x30, 0x1, 0xde,
+    0x10, 0x8f, 0x40, 0x1e, 0xf3, 0x0, 0x0, 0x9f,
+    0xe1, 0x1, 0xaf, 0x70, 0x5, 0xf7, 0x0, 0x9f,
+    0xb1, 0x1, 0x9f, 0xfd, 0x13, 0xbf, 0xa0, 0x0,
+    0x1e, 0xc1, 0x2, 0xdf, 0xdb, 0xee, 0x8f, 0xfe,
+    0xff, 0x91, 0x0, 0x0, 0x9f, 0x60, 0x2, 0xae,
+    0xfa, 0x21, 0xaf, 0xeb, 0x50, 0x3, 0x42, 0x2,
+    0xee, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xee, 0x20, 0x5, 0xfe, 0x60, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xee, 0x40, 0x0, 0x5,
+    0xef, 0xc6, 0x20, 0x0, 0x0, 0x1, 0x5c, 0xfe,
+    0x40, 0x0, 0x0, 0x3, 0xaf, 0xfe, 0xca, 0x99,
+    0xac, 0xef, 0xfa, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x38, 0xbd, 0xef, 0xff, 0xec, 0x83, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x12, 0x22, 0x21,
+    0x0, 0x0, 0x0, 0x0,
+    /* U+0041 "A" */
+    0x0, 0x0, 0x0, 0x12, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xf4, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xee, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xf9, 0xee, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0xf4, 0xaf, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xe1, 0x5f, 0xd0, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0x90, 0x1d, 0xf5, 0x0, 0x0,
+    0x0, 0x1, 0xef, 0x40, 0x9, 0xfb, 0x0, 0x0,
+    0x0, 0x6, 0xfc, 0x0, 0x3, 0xff, 0x20, 0x0,
+    0x0, 0xb, 0xf7, 0x0, 0x0, 0xcf, 0x80, 0x0,
+    0x0, 0x3f, 0xf3, 0x11, 0x11, 0x8f, 0xe1, 0x0,
+    0x0, 0x8f, 0xfe, 0xee, 0xee, 0xef, 0xf6, 0x0,
+    0x1, 0xdf, 0xdd, 0xdd, 0xdd, 0xde, 0xfc, 0x0,
+    0x5, 0xfe, 0x20, 0x0, 0x0, 0x5, 0xff, 0x30,
+    0xa, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x90,
+    0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xe1,
+    0x7f, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf6,
+    0xdf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfc,
+    /* U+0042 "B" */
+    0x2, 0x22, 0x22, 0x22, 0x10, 0x0, 0x0, 0x4f,
+    0xff, 0xff, 0xff, 0xec, 0x81, 0x0, 0x4f, 0xfe,
+    0xee, 0xee, 0xef, 0xfc, 0x10, 0x4f, 0xe1, 0x0,
+    0x0, 0x15, 0xef, 0x70, 0x4f, 0xe1, 0x0, 0x0,
+    0x0, 0x8f, 0xc0, 0x4f, 0xe1, 0x0, 0x0, 0x0,
+    0x5f, 0xd0, 0x4f, 0xe1, 0x0, 0x0, 0x0, 0x8f,
+    0xa0, 0x4f, 0xe1, 0x0, 0x0, 0x16, 0xee, 0x30,
+    0x4f, 0xfe, 0xee, 0xee, 0xef, 0xe4, 0x0, 0x4f,
+    0xff, 0xff, 0xff, 0xff, 0xfa, 0x20, 0x4f, 0xe3,
+    0x22, 0x22, 0x26, 0xdf, 0xc1, 0x4f, 0xe1, 0x0,
+    0x0, 0x0, 0x2e, 0xf7, 0x4f, 0xe1, 0x0, 0x0,
+    0x0, 0xa, 0xfa, 0x4f, 0xe1, 0x0, 0x0, 0x0,
+    0xa, 0xfb, 0x4f, 0xe1, 0x0, 0x0, 0x0, 0x1e,
+    0xf7, 0x4f, 0xe2, 0x11, 0x11, 0x14, 0xcf, 0xe2,
+    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x4f,
+    0xff, 0xff, 0xff, 0xec, 0x93, 0x0,
+    /* U+0043 "C" */
+    0x0, 0x0, 0x1, 0x35, 0x54, 0x20, 0x0, 0x0,
+    0x0, 0x1, 0x7d, 0xff, 0xff, 0xea, 0x30, 0x0,
+    0x0, 0x3d, 0xff, 0xc9, 0x9b, 0xef, 0xe5, 0x0,
+    0x2, 0xdf, 0xc4, 0x0, 0x0, 0x2b, 0xfe, 0x20,
+    0xa, 0xfd, 0x10, 0x0, 0x0, 0x1, 0xdf, 0xa0,
+    0x2f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xa1,
+    0x7f, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x1c, 0x92,
+    0x2e, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xe2,
+    0x9, 0xfd, 0x20, 0x0, 0x0, 0x1, 0xdf, 0xa0,
+    0x2, 0xdf, 0xc4, 0x0, 0x0, 0x3c, 0xfe, 0x20,
+    0x0, 0x3d, 0xff, 0xca, 0x9c, 0xff, 0xe4, 0x0,
+    0x0, 0x2, 0x9e, 0xff, 0xff, 0xfa, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x35, 0x54, 0x10, 0x0, 0x0,
+    /* U+0044 "D" */
+    0x2, 0x22, 0x22, 0x22, 0x21, 0x0, 0x0, 0x0,
+    0x3e, 0xff, 0xff, 0xff, 0xed, 0xa3, 0x0, 0x0,
+    0x3f, 0xfe, 0xee, 0xee, 0xef, 0xff, 0x70, 0x0,
+    0x3f, 0xf2, 0x0, 0x0, 0x14, 0xbf, 0xf6, 0x0,
+    0x3f, 0xf2, 0x0, 0x0, 0x0, 0xa, 0xfe, 0x10,
+    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x1, 0xef, 0x70,
+    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xb0,
+    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xd1,
+    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xe1,
+    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xe1,
+    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xe1,
+    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xd1,
+    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xa0,
+    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x2, 0xff, 0x50,
+    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x1b, 0xfd, 0x10,
+    0x3f, 0xf2, 0x11, 0x11, 0x26, 0xcf, 0xf4, 0x0,
+    0x3f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x50, 0x0,
+    0x3f, 0xff, 0xff, 0xff, 0xeb, 0x82, 0x0, 0x0,
+    /* U+0045 "E" */
+    0x2, 0x22, 0x22, 0x22, 0x22, 0x22, 0x21, 0x2e,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x2f, 0xfe,
+    0xee, 0xee, 0xee, 0xee, 0xe5, 0x2f, 0xf2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2f, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2f, 0xfe, 0xdd, 0xdd, 0xdd, 0xdd, 0x90, 0x2f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x2f, 0xf4,
+    0x22, 0x22, 0x22, 0x22, 0x10, 0x2f, 0xf2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2f, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2f, 0xf3, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x2f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
+    /* U+0046 "F" */
+    0x2, 0x22, 0x22, 0x22, 0x22, 0x22, 0x11, 0xef,
+    0xff, 0xff, 0xff, 0xff, 0xf8, 0x1e, 0xfe, 0xdd,
+    0xdd, 0xdd, 0xdd, 0x71, 0xef, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x1e, 0xf4, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xef, 0x40, 0x0, 0x0, 0x0, 0x0, 0x1e,
+    0xf4, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0x1e, 0xfe, 0xee, 0xee,
+    0xee, 0xe4, 0x1, 0xef, 0xff, 0xff, 0xff, 0xff,
+    0x50, 0x1e, 0xf5, 0x22, 0x22, 0x22, 0x21, 0x1,
+    0xef, 0x40, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xf4,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x1e, 0xf4, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xef, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x1e, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x1, 0xcd,
+    0x30, 0x0, 0x0, 0x0, 0x0,
+    /* U+0047 "G" */
+    0x0, 0x0, 0x0, 0x24, 0x55, 0x31, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xcf, 0xff, 0xff, 0xe9, 0x20,
+    0x0, 0x0, 0x1b, 0xff, 0xda, 0x99, 0xcf, 0xfe,
+    0x40, 0x0, 0x1b, 0xfe, 0x61, 0x0, 0x0, 0x3c,
+    0xfd, 0x10, 0x7, 0xfe, 0x40, 0x0, 0x0, 0x0,
+    0x1d, 0xf7, 0x0, 0xdf, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xb0, 0x4f, 0xe2, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x20, 0x8, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xfa, 0x0, 0x0,
+    0x1, 0x99, 0x99, 0x99, 0x91, 0xaf, 0xa0, 0x0,
+    0x0, 0x2f, 0xff, 0xff, 0xff, 0x28, 0xfc, 0x0,
+    0x0, 0x1, 0x77, 0x77, 0x7f, 0xf2, 0x5f, 0xe2,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0x21, 0xdf,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xf2, 0x7,
+    0xff, 0x50, 0x0, 0x0, 0x0, 0x4, 0xff, 0x20,
+    0xb, 0xff, 0x92, 0x0, 0x0, 0x29, 0xef, 0xe2,
+    0x0, 0x1a, 0xff, 0xfd, 0xbb, 0xdf, 0xff, 0xc3,
+    0x0, 0x0, 0x4, 0xbf, 0xff, 0xff, 0xfb, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x13, 0x55, 0x41, 0x0,
+    0x0, 0x0,
+    /* U+0048 "H" */
+    0x2, 0x20, 0x0, 0x0, 0x0, 0x0, 0x22, 0x12,
+    0xef, 0x30, 0x0, 0x0, 0x0, 0xd, 0xf6, 0x2e,
+    0xf3, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x62, 0xef,
+    0x30, 0x0, 0x0, 0x0, 0xd, 0xf6, 0x2e, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0xdf, 0x62, 0xef, 0x30,
+    0x0, 0x0, 0x0, 0xd, 0xf6, 0x2e, 0xf3, 0x0,
+    0x0, 0x0, 0x0, 0xdf, 0x62, 0xef, 0x30, 0x0,
+    0x0, 0x0, 0xd, 0xf6, 0x2e, 0xfe, 0xee, 0xee,
+    0xee, 0xee, 0xff, 0x62, 0xef, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf6, 0x2e, 0xf4, 0x22, 0x22, 0x22,
+    0x22, 0xdf, 0x62, 0xef, 0x30, 0x0, 0x0, 0x0,
+    0xd, 0xf6, 0x2e, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0x62, 0xef, 0x30, 0x0, 0x0, 0x0, 0xd,
+    0xf6, 0x2e, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xdf,
+    0x62, 0xef, 0x30, 0x0, 0x0, 0x0, 0xd, 0xf6,
+    0x2e, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x62,
+    0xef, 0x30, 0x0, 0x0, 0x0, 0xd, 0xf6,
+    /* U+0049 "I" */
+    0x22, 0x1b, 0xf8, 0xbf, 0x8b, 0xf8, 0xbf, 0x8b,
+    0xf8, 0xbf, 0x8b, 0xf8, 0xbf, 0x8b, 0xf8, 0xbf,
+    0x8b, 0xf8, 0xbf, 0x8b, 0xf8, 0xbf, 0x8b, 0xf8,
+    0xbf, 0x8b, 0xf8,
+    /* U+004A "J" */
+    0x0, 0x0, 0x0, 0x0, 0x22, 0x0, 0x0, 0x0,
+    0x0, 0x2f, 0xf3, 0x0, 0x0, 0x0, 0x2, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0x2f, 0xf3, 0x0, 0x0,
+    0x0, 0x2, 0xff, 0x30, 0x0, 0x0, 0x0, 0x2f,
+    0xf3, 0x0, 0x0, 0x0, 0x2, 0xff, 0x30, 0x0,
+    0x0, 0x0, 0x2f, 0xf3, 0x0, 0x0, 0x0, 0x2,
+    0xff, 0x30, 0x0, 0x0, 0x0, 0x2f, 0xf3, 0x0,
+    0x0, 0x0, 0x2, 0xff, 0x30, 0x0, 0x0, 0x0,
+    0x2f, 0xf3, 0x1, 0x10, 0x0, 0x2, 0xff, 0x24,
+    0xdb, 0x0, 0x0, 0x2f, 0xf2, 0x3f, 0xe1, 0x0,
+    0x4, 0xfe, 0x11, 0xef, 0x70, 0x1, 0xbf, 0xb0,
+    0x8, 0xff, 0xcb, 0xdf, 0xf4, 0x0, 0x8, 0xff,
+    0xff, 0xd5, 0x0, 0x0, 0x1, 0x45, 0x30, 0x0,
+    0x0,
+    /* U+004B "K" */
+    0x12, 0x20, 0x0, 0x0, 0x0, 0x1, 0x22, 0x14,
+    0xfe, 0x10, 0x0, 0x0, 0x2, 0xdf, 0xd2, 0x4f,
+    0xe1, 0x0, 0x0, 0x3, 0xdf, 0xc2, 0x4, 0xfe,
+    0x10, 0x0, 0x3, 0xdf, 0xc2, 0x0, 0x4f, 0xe1,
+    0x0, 0x3, 0xdf, 0xc1, 0x0, 0x4, 0xfe, 0x10,
+    0x3, 0xdf, 0xc1, 0x0, 0x0, 0x4f, 0xe1, 0x3,
+    0xdf, 0xb1, 0x0, 0x0, 0x4, 0xfe, 0x13, 0xdf,
+    0xb1, 0x0, 0x0, 0x0, 0x4f, 0xe4, 0xef, 0xfd,
+    0x10, 0x0, 0x0, 0x4, 0xff, 0xef, 0xbe, 0xfa,
+    0x0, 0x0, 0x0, 0x4f, 0xff, 0x91, 0x5f, 0xf6,
+    0x0, 0x0, 0x4, 0xff, 0x90, 0x0, 0x9f, 0xe3,
+    0x0, 0x0, 0x4f, 0xe1, 0x0, 0x1, 0xdf, 0xd1,
+    0x0, 0x4, 0xfe, 0x10, 0x0, 0x4, 0xff, 0x90,
+    0x0, 0x4f, 0xe1, 0x0, 0x0, 0x8, 0xff, 0x60,
+    0x4, 0xfe, 0x10, 0x0, 0x0, 0xc, 0xfe, 0x30,
+    0x4f, 0xe1, 0x0, 0x0, 0x0, 0x2e, 0xfc, 0x14,
+    0xfe, 0x10, 0x0, 0x0, 0x0, 0x6f, 0xf9,
+    /* U+004C "L" */
+    0x12, 0x20, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xe1,
+    0x0, 0x0, 0x0, 0x0, 0x4f, 0xe1, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xe1, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xe1,
+    0x0, 0x0, 0x0, 0x0, 0x4f, 0xe1, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xe1, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xe1,
+    0x0, 0x0, 0x0, 0x0, 0x4f, 0xe1, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xe1, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xe1,
+    0x0, 0x0, 0x0, 0x0, 0x4f, 0xe1, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xe2, 0x11, 0x11, 0x11, 0x10,
+    0x4f, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x4f, 0xff,
+    0xff, 0xff, 0xff, 0xf8,
+    /* U+004D "M" */
+    0x2, 0x22, 0x10, 0x0, 0x0, 0x0, 0x0, 0x22,
+    0x20, 0x3f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x2,
+    0xef, 0xf3, 0x3f, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xf3, 0x3f, 0xff, 0xe2, 0x0, 0x0,
+    0x0, 0xc, 0xff, 0xf3, 0x3f, 0xeb, 0xf6, 0x0,
+    0x0, 0x0, 0x2f, 0xce, 0xf3, 0x3f, 0xe6, 0xfb,
+    0x0, 0x0, 0x0, 0x7f, 0x7e, 0xf3, 0x3f, 0xe2,
+    0xee, 0x20, 0x0, 0x0, 0xce, 0x2e, 0xf3, 0x3f,
+    0xe1, 0xaf, 0x60, 0x0, 0x3, 0xfa, 0x1e, 0xf3,
+    0x3f, 0xe1, 0x4f, 0xb0, 0x0, 0x8, 0xf5, 0x1e,
+    0xf3, 0x3f, 0xe1, 0x1d, 0xe2, 0x0, 0xd, 0xe1,
+    0x1e, 0xf3, 0x3f, 0xe1, 0x9, 0xf6, 0x0, 0x3f,
+    0x90, 0x1e, 0xf3, 0x3f, 0xe1, 0x4, 0xfc, 0x0,
+    0x8f, 0x40, 0x1e, 0xf3, 0x3f, 0xe1, 0x1, 0xde,
+    0x20, 0xdd, 0x0, 0x1e, 0xf3, 0x3f, 0xe1, 0x0,
+    0x9f, 0x74, 0xf8, 0x0, 0x1e, 0xf3, 0x3f, 0xe1,
+    0x0, 0x4f, 0xb9, 0xf3, 0x0, 0x1e, 0xf3, 0x3f,
+    0xe1, 0x0, 0x1d, 0xfe, 0xd0, 0x0, 0x1e, 0xf3,
+    0x3f, 0xe1, 0x0, 0x9, 0xff, 0x80, 0x0, 0x1e,
+    0xf3, 0x3f, 0xe1, 0x0, 0x3, 0xff, 0x30, 0x0,
+    0x1e, 0xf3,
+    /* U+004E "N" */
+    0x2, 0x21, 0x0, 0x0, 0x0, 0x0, 0x22, 0x13,
+    0xff, 0x90, 0x0, 0x0, 0x0, 0xc, 0xf6, 0x3f,
+    0xff, 0x40, 0x0, 0x0, 0x0, 0xcf, 0x63, 0xff,
+    0xfd, 0x10, 0x0, 0x0, 0xc, 0xf6, 0x3f, 0xfe,
+    0xf9, 0x0, 0x0, 0x0, 0xcf, 0x63, 0xfe, 0x7f,
+    0xf4, 0x0, 0x0, 0xc, 0xf6, 0x3f, 0xe1, 0xaf,
+    0xd1, 0x0, 0x0, 0xcf, 0x63, 0xfe, 0x12, 0xef,
+    0x90, 0x0, 0xc, 0xf6, 0x3f, 0xe1, 0x5, 0xff,
+    0x50, 0x0, 0xcf, 0x63, 0xfe, 0x10, 0xa, 0xfd,
+    0x10, 0xc, 0xf6, 0x3f, 0xe1, 0x0, 0x2d, 0xf9,
+    0x0, 0xcf, 0x63, 0xfe, 0x10, 0x0, 0x5f, 0xf5,
+    0xc, 0xf6, 0x3f, 0xe1, 0x0, 0x0, 0xaf, 0xd1,
+    0xcf, 0x63, 0xfe, 0x10, 0x0, 0x1, 0xdf, 0x9c,
+    0xf6, 0x3f, 0xe1, 0x0, 0x0, 0x5, 0xff, 0xff,
+    0x63, 0xfe, 0x10, 0x0, 0x0, 0xa, 0xff, 0xf6,
+    0x3f, 0xe1, 0x0, 0x0, 0x0, 0x1e, 0xff, 0x63,
+    0xfe, 0x10, 0x0, 0x0, 0x0, 0x5f, 0xf6,
+    /* U+004F "O" */
+    0x0, 0x0, 0x1, 0x35, 0x54, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x17, 0xdf, 0xff, 0xff, 0xc5, 0x0,
+    0x0, 0x0, 0x2c, 0xff, 0xda, 0x9a, 0xef, 0xf9,
+    0x10, 0x0, 0x1d, 0xfd, 0x50, 0x0, 0x1, 0x7f,
+    0xfa, 0x0, 0x9, 0xfd, 0x20, 0x0, 0x0, 0x0,
+    0x5f, 0xf5, 0x2, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0xc0, 0x7f, 0xd1, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0x3a, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xe, 0xf6, 0xcf, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xcf, 0x8c, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xc, 0xf9, 0xcf, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xcf, 0x8a, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xe, 0xf6, 0x6f, 0xd1,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x32, 0xef,
+    0x60, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xc0, 0x8,
+    0xfe, 0x30, 0x0, 0x0, 0x0, 0x5f, 0xf5, 0x0,
+    0x1c, 0xfd, 0x50, 0x0, 0x1, 0x7f, 0xf9, 0x0,
+    0x0, 0x2b, 0xff, 0xda, 0x9b, 0xef, 0xf9, 0x10,
+    0x0, 0x0, 0x6, 0xdf, 0xff, 0xff, 0xb4, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x24, 0x54, 0x10, 0x0,
+    0x0, 0x0,
+    /* U+0050 "P" */
+    0x2, 0x22, 0x22, 0x22, 0x21, 0x0, 0x0, 0x3,
+    0xef, 0xff, 0xff, 0xff, 0xec, 0x61, 0x0, 0x3f,
+    0xfe, 0xee, 0xee, 0xee, 0xff, 0xa0, 0x3, 0xff,
+    0x20, 0x0, 0x0, 0x28, 0xff, 0x60, 0x3f, 0xf2,
+    0x0, 0x0, 0x0, 0xb, 0xfb, 0x3, 0xff, 0x20,
+    0x0, 0x0, 0x0, 0x6f, 0xd1, 0x3f, 0xf2, 0x0,
+    0x0, 0x0, 0x7, 0xfd, 0x13, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0xbf, 0xb0, 0x3f, 0xf2, 0x0, 0x0,
+    0x2, 0x9f, 0xf5, 0x3, 0xff, 0xed, 0xdd, 0xde,
+    0xff, 0xf9, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xfe,
+    0xc6, 0x0, 0x3, 0xff, 0x42, 0x22, 0x22, 0x10,
+    0x0, 0x0, 0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    /* U+0051 "Q" */
+    0x0, 0x0, 0x1, 0x35, 0x54, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x18, 0xdf, 0xff, 0xfe, 0xb4, 0x0,
+    0x0, 0x0, 0x3d, 0xff, 0xc9, 0x9b, 0xef, 0xf8,
+    0x0, 0x0, 0x2d, 0xfc, 0x40, 0x0, 0x1, 0x9f,
+    0xf8, 0x0, 0xb, 0xfc, 0x10, 0x0, 0x0, 0x0,
+    0x7f, 0xf4, 0x3, 0xff, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0xcf, 0xa0, 0x8f, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xfe, 0x2c, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2e, 0xf4, 0xef, 0x60, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xef, 0x6e, 0xf6, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xe, 0xf7, 0xef, 0x60, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xef, 0x6c, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2e, 0xf4, 0x8f, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xfe, 0x23, 0xff,
+    0x40, 0x0, 0x2, 0x72, 0x0, 0xbf, 0xb0, 0xa,
+    0xfd, 0x20, 0x0, 0x7f, 0xe7, 0x7f, 0xf4, 0x0,
+    0x2d, 0xfd, 0x40, 0x1, 0x6d, 0xff, 0xf8, 0x0,
+    0x0, 0x2c, 0xff, 0xca, 0x9b, 0xef, 0xff, 0x60,
+    0x0, 0x0, 0x17, 0xdf, 0xff, 0xff, 0xb7, 0xef,
+    0xc4, 0x0, 0x0, 0x0, 0x25, 0x54, 0x10, 0x2,
+    0xaf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x21,
+    /* U+0052 "R" */
+    0x2, 0x22, 0x22, 0x22, 0x22, 0x10, 0x0, 0x0,
+    0x2f, 0xff, 0xff, 0xff, 0xff, 0xec, 0x60, 0x0,
+    0x2f, 0xfc, 0xbb, 0xbb, 0xbc, 0xef, 0xf8, 0x0,
+    0x2f, 0xf2, 0x0, 0x0, 0x0, 0x1a, 0xff, 0x30,
+    0x2f, 0xf2, 0x0, 0x0, 0x0, 0x1, 0xef, 0x70,
+    0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x90,
+    0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x80,
+    0x2f, 0xf2, 0x0, 0x0, 0x0, 0x8, 0xff, 0x30,
+    0x2f, 0xf9, 0x88, 0x88, 0x89, 0xdf, 0xf8, 0x0,
+    0x2f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x60, 0x0,
+    0x2f, 0xf8, 0x77, 0x7b, 0xff, 0x70, 0x0, 0x0,
+    0x2f, 0xf2, 0x0, 0x0, 0x5f, 0xf8, 0x0, 0x0,
+    0x2f, 0xf2, 0x0, 0x0, 0x7, 0xff, 0x60, 0x0,
+    0x2f, 0xf2, 0x0, 0x0, 0x0, 0xbf, 0xe2, 0x0,
+    0x2f, 0xf2, 0x0, 0x0, 0x0, 0x2e, 0xfb, 0x0,
+    0x2f, 0xf2, 0x0, 0x0, 0x0, 0x7, 0xff, 0x60,
+    0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xe2,
+    0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfa,
+    /* U+0053 "S" */
+    0x0, 0x0, 0x25, 0x66, 0x41, 0x0, 0x0, 0x0,
+    0x4b, 0xff, 0xff, 0xfe, 0x92, 0x0, 0x4, 0xef,
+    0xea, 0x99, 0xcf, 0xfd, 0x20, 0xc, 0xfa, 0x10,
+    0x0, 0x3, 0xdf, 0xa0, 0x3f, 0xe2, 0x0, 0x0,
+    0x0, 0x5f, 0xf1, 0x4f, 0xe1, 0x0, 0x0, 0x0,
+    0xc, 0xb2, 0x2e, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9, 0xff, 0xc7, 0x41, 0x0, 0x0, 0x0,
+    0x1, 0x9f, 0xff, 0xfe, 0xb7, 0x20, 0x0, 0x0,
+    0x3, 0x9d, 0xff, 0xff, 0xf9, 0x10, 0x0, 0x0,
+    0x1, 0x26, 0xad, 0xff, 0xb1, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x7f, 0xf6, 0x79, 0x30, 0x0, 0x0,
+    0x0, 0xa, 0xfa, 0xcf, 0x70, 0x0, 0x0, 0x0,
+    0x7, 0xfb, 0x8f, 0xd2, 0x0, 0x0, 0x0, 0xb,
+    0xf8, 0x2e, 0xfd, 0x51, 0x0, 0x1, 0x9f, 0xe2,
+    0x4, 0xef, 0xfd, 0xbb, 0xce, 0xff, 0x60, 0x0,
+    0x2a, 0xef, 0xff, 0xff, 0xb3, 0x0, 0x0, 0x0,
+    0x3, 0x55, 0x41, 0x0, 0x0,
+    /* U+0054 "T" */
+    0x12, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x6,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x6e,
+    0xee, 0xee, 0xff, 0xee, 0xee, 0xee, 0x20, 0x0,
+    0x0, 0xc, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xc, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xcf, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xc, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xcf, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0xf8, 0x0, 0x0, 0x0,
+    /* U+0055 "U" */
+    0x2, 0x20, 0x0, 0x0, 0x0, 0x0, 0x22, 0x12,
+    0xff, 0x20, 0x0, 0x0, 0x0, 0xd, 0xf6, 0x2f,
+    0xf2, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x62, 0xff,
+    0x20, 0x0, 0x0, 0x0, 0xd, 0xf6, 0x2f, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0xdf, 0x62, 0xff, 0x20,
+    0x0, 0x0, 0x0, 0xd, 0xf6, 0x2f, 0xf2, 0x0,
+    0x0, 0x0, 0x0, 0xdf, 0x62, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0xd, 0xf6, 0x2f, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0x62, 0xff, 0x20, 0x0, 0x0,
+    0x0, 0xd, 0xf6, 0x2f, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0xdf, 0x62, 0xff, 0x30, 0x0, 0x0, 0x0,
+    0xe, 0xf6, 0x1e, 0xf4, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0x50, 0xdf, 0x60, 0x0, 0x0, 0x0, 0x2f,
+    0xf3, 0xa, 0xfc, 0x10, 0x0, 0x0, 0x8, 0xfd,
+    0x10, 0x4f, 0xfa, 0x20, 0x0, 0x16, 0xff, 0x80,
+    0x0, 0x8f, 0xfe, 0xcb, 0xbe, 0xff, 0xb1, 0x0,
+    0x0, 0x5d, 0xff, 0xff, 0xfe, 0x70, 0x0, 0x0,
+    0x0, 0x2, 0x45, 0x53, 0x0, 0x0, 0x0,
+    /* U+0056 "V" */
+    0x22, 0x10, 0x0, 0x0, 0x0, 0x0, 0x1, 0x22,
+    0xaf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf8,
+    0x4f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf3,
+    0xd, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xb0,
+    0x7, 0xfd, 0x10, 0x0, 0x0, 0x0, 0xdf, 0x60,
+    0x2, 0xff, 0x30, 0x0, 0x0, 0x3, 0xfe, 0x10,
+    0x0, 0xbf, 0x90, 0x0, 0x0, 0x9, 0xf9, 0x0,
+    0x0, 0x5f, 0xd1, 0x0, 0x0, 0x1e, 0xf3, 0x0,
+    0x0, 0x1d, 0xf5, 0x0, 0x0, 0x5f, 0xc0, 0x0,
+    0x0, 0x8, 0xfa, 0x0, 0x0, 0xbf, 0x60, 0x0,
+    0x0, 0x3, 0xfe, 0x20, 0x2, 0xfe, 0x10, 0x0,
+    0x0, 0x0, 0xbf, 0x60, 0x7, 0xfa, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xb0, 0xc, 0xf4, 0x0, 0x0,
+    0x0, 0x0, 0x1e, 0xe2, 0x3f, 0xd0, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xf7, 0x8f, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xfc, 0xde, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xcf, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xf5, 0x0, 0x0, 0x0,
+    /* U+0057 "W" */
+    0x12, 0x10, 0x0, 0x0, 0x0, 0x22, 0x20, 0x0,
+    0x0, 0x0, 0x22, 0x18, 0xfb, 0x0, 0x0, 0x0,
+    0x3f, 0xfe, 0x0, 0x0, 0x0, 0x2e, 0xf3, 0x4f,
+    0xe1, 0x0, 0x0, 0x7, 0xff, 0xf3, 0x0, 0x0,
+    0x5, 0xfe, 0x1, 0xef, 0x40, 0x0, 0x0, 0xbf,
+    0xbf, 0x70, 0x0, 0x0, 0x8f, 0xa0, 0xb, 0xf7,
+    0x0, 0x0, 0x1e, 0xe4, 0xfc, 0x0, 0x0, 0xc,
+    0xf6, 0x0, 0x7f, 0xb0, 0x0, 0x5, 0xfa, 0xf,
+    0xf1, 0x0, 0x1, 0xee, 0x20, 0x3, 0xfd, 0x10,
+    0x0, 0x9f, 0x60, 0xbf, 0x50, 0x0, 0x4f, 0xc0,
+    0x0, 0xe, 0xf3, 0x0, 0xd, 0xf2, 0x6, 0xf9,
+    0x0, 0x8, 0xf8, 0x0, 0x0, 0xaf, 0x60, 0x2,
+    0xfc, 0x0, 0x2f, 0xd1, 0x0, 0xcf, 0x40, 0x0,
+    0x6, 0xfa, 0x0, 0x6f, 0x80, 0x0, 0xdf, 0x30,
+    0x1e, 0xe1, 0x0, 0x0, 0x3f, 0xd0, 0xb, 0xf4,
+    0x0, 0x9, 0xf7, 0x4, 0xfb, 0x0, 0x0, 0x0,
+    0xdf, 0x21, 0xee, 0x10, 0x0, 0x5f, 0xb0, 0x8f,
+    0x70, 0x0, 0x0, 0x9, 0xf5, 0x4f, 0xb0, 0x0,
+    0x1, 0xee, 0x1b, 0xf3, 0x0, 0x0, 0x0, 0x5f,
+    0x88, 0xf6, 0x0, 0x0, 0xb, 0xf4, 0xed, 0x10,
+    0x0, 0x0, 0x2, 0xeb, 0xcf, 0x30, 0x0, 0x0,
+    0x7f, 0x9f, 0x90, 0x0, 0x0, 0x0, 0xc, 0xee,
+    0xd0, 0x0, 0x0, 0x3, 0xfe, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xf9, 0x0, 0x0, 0x0, 0xe,
+    0xfe, 0x20, 0x0, 0x0, 0x0, 0x4, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0xaf, 0xc0, 0x0, 0x0,
+    /* U+0058 "X" */
+    0x2, 0x22, 0x0, 0x0, 0x0, 0x0, 0x2, 0x21,
+    0xa, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x8f, 0xd1,
+    0x1, 0xdf, 0xb0, 0x0, 0x0, 0x5, 0xfe, 0x30,
+    0x0, 0x4f, 0xf7, 0x0, 0x0, 0x2e, 0xf7, 0x0,
+    0x0, 0x8, 0xfe, 0x30, 0x1, 0xcf, 0xa0, 0x0,
+    0x0, 0x1, 0xcf, 0xc1, 0x9, 0xfd, 0x10, 0x0,
+    0x0, 0x0, 0x2e, 0xf8, 0x5f, 0xe3, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xff, 0xef, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9f, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x2e, 0xf8, 0x8f, 0xe3, 0x0, 0x0,
+    0x0, 0x1, 0xbf, 0xb1, 0x1c, 0xfd, 0x10, 0x0,
+    0x0, 0x8, 0xfe, 0x20, 0x3, 0xef, 0x90, 0x0,
+    0x0, 0x5f, 0xf6, 0x0, 0x0, 0x7f, 0xf5, 0x0,
+    0x2, 0xef, 0x90, 0x0, 0x0, 0xb, 0xfe, 0x20,
+    0xb, 0xfd, 0x10, 0x0, 0x0, 0x2, 0xef, 0xb0,
+    0x8f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf7,
+    /* U+0059 "Y" */
+    0x22, 0x20, 0x0, 0x0, 0x0, 0x0, 0x2, 0x22,
+    0x8f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf6,
+    0x1c, 0xfd, 0x10, 0x0, 0x0, 0x1, 0xdf, 0xa0,
+    0x3, 0xef, 0x80, 0x0, 0x0, 0x9, 0xfd, 0x10,
+    0x0, 0x7f, 0xf4, 0x0, 0x0, 0x4f, 0xf4, 0x0,
+    0x0, 0xc, 0xfc, 0x10, 0x1, 0xdf, 0x90, 0x0,
+    0x0, 0x3, 0xef, 0x80, 0x8, 0xfd, 0x10, 0x0,
+    0x0, 0x0, 0x7f, 0xe3, 0x3f, 0xf3, 0x0, 0x0,
+    0x0, 0x0, 0x1c, 0xfb, 0xbf, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xef, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xe3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xe1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xe1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xe1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xe1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xe1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xe1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xe1, 0x0, 0x0, 0x0,
+    /* U+005A "Z" */
+    0x1, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x0,
+    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x7,
+    0xee, 0xee, 0xee, 0xee, 0xef, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7, 0xff, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xef, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xdf, 0xc1, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xbf, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xf9, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2d, 0xfb, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x1b, 0xfd, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xfe, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xef, 0x81, 0x11, 0x11, 0x11, 0x11, 0x10,
+    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x18,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
+    /* U+005B "[" */
+    0x12, 0x22, 0x21, 0x6f, 0xff, 0xf4, 0x6f, 0xd9,
+    0x93, 0x6f, 0xb0, 0x0, 0x6f, 0xb0, 0x0, 0x6f,
+    0xb0, 0x0, 0x6f, 0xb0, 0x0, 0x6f, 0xb0, 0x0,
+    0x6f, 0xb0, 0x0, 0x6f, 0xb0, 0x0, 0x6f, 0xb0,
+    0x0, 0x6f, 0xb0, 0x0, 0x6f, 0xb0, 0x0, 0x6f,
+    0xb0, 0x0, 0x6f, 0xb0, 0x0, 0x6f, 0xb0, 0x0,
+    0x6f, 0xb0, 0x0, 0x6f, 0xb0, 0x0, 0x6f, 0xb0,
+    0x0, 0x6f, 0xb0, 0x0, 0x6f, 0xb0, 0x0, 0x6f,
+    0xfe, 0xe4, 0x5c, 0xcc, 0xc3,
+    /* U+005C "\\" */
+    0x53, 0x0, 0x0, 0xc, 0xd1, 0x0, 0x0, 0x7f,
+    0x30, 0x0, 0x3, 0xf7, 0x0, 0x0, 0xe, 0xb0,
+    0x0, 0x0, 0xae, 0x10, 0x0, 0x5, 0xf5, 0x0,
+    0x0, 0x2e, 0x90, 0x0, 0x0, 0xcd, 0x10, 0x0,
+    0x8, 0xf3, 0x0, 0x0, 0x4f, 0x70, 0x0, 0x1,
+    0xeb, 0x0, 0x0, 0xa, 0xe1, 0x0, 0x0, 0x6f,
+    0x50, 0x0, 0x2, 0xe9, 0x0, 0x0, 0xc, 0xd0,
+    0x0, 0x0, 0x8f, 0x30, 0x0, 0x4, 0xf6, 0x0,
+    0x0, 0x15, 0x30,
+    /* U+005D "]" */
+    0x12, 0x22, 0x20, 0x8f, 0xff, 0xf2, 0x59, 0x9f,
+    0xf2, 0x0, 0x1e, 0xf2, 0x0, 0x1e, 0xf2, 0x0,
+    0x1e, 0xf2, 0x0, 0x1e, 0xf2, 0x0, 0x1e, 0xf2,
+    0x0, 0x1e, 0xf2, 0x0, 0x1e, 0xf2, 0x0, 0x1e,
+    0xf2, 0x0, 0x1e, 0xf2, 0x0, 0x1e, 0xf2, 0x0,
+    0x1e, 0xf2, 0x0, 0x1e, 0xf2, 0x0, 0x1e, 0xf2,
+    0x0, 0x1e, 0xf2, 0x0, 0x1e, 0xf2, 0x0, 0x1e,
+    0xf2, 0x0, 0x1e, 0xf2, 0x0, 0x1e, 0xf2, 0x7e,
+    0xef, 0xf2, 0x7c, 0xcc, 0xc2,
+    /* U+005E "^" */
+    0x0, 0x0, 0x4a, 0x60, 0x0, 0x0, 0x0, 0xb,
+    0xfe, 0x10, 0x0, 0x0, 0x3, 0xff, 0xf6, 0x0,
+    0x0, 0x0, 0x9f, 0x7e, 0xc0, 0x0, 0x0, 0x2e,
+    0xd1, 0xaf, 0x50, 0x0, 0x7, 0xf8, 0x4, 0xfb,
+    0x0, 0x1, 0xde, 0x20, 0xc, 0xf3, 0x0, 0x6f,
+    0xa0, 0x0, 0x6f, 0xa0, 0xc, 0xf5, 0x0, 0x1,
+    0xee, 0x22, 0xba, 0x10, 0x0, 0x8, 0xc5,
+    /* U+005F "_" */
+    0x4b, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x74,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xc7,
+    /* U+0060 "`" */
+    0x45, 0x40, 0x5, 0xff, 0x40, 0x7, 0xfb, 0x0,
+    0x9, 0xe3,
+    /* U+0061 "a" */
+    0x0, 0x1, 0x69, 0xaa, 0x84, 0x0, 0x0, 0x5,
+    0xef, 0xff, 0xff, 0xfa, 0x0, 0x3, 0xff, 0x82,
+    0x12, 0x8f, 0xf5, 0x0, 0x9f, 0xa0, 0x0, 0x0,
+    0xaf, 0x90, 0x2, 0x52, 0x0, 0x0, 0x7, 0xfa,
+    0x0, 0x0, 0x1, 0x23, 0x69, 0xdf, 0xa0, 0x0,
+    0x3a, 0xde, 0xff, 0xfe, 0xfa, 0x0, 0x5e, 0xfd,
+    0xb8, 0x52, 0x7f, 0xa0, 0xd, 0xf9, 0x10, 0x0,
+    0x8, 0xfa, 0x2, 0xff, 0x20, 0x0, 0x0, 0xbf,
+    0xa0, 0x1f, 0xf5, 0x0, 0x0, 0x6f, 0xfa, 0x0,
+    0xaf, 0xe7, 0x56, 0xaf, 0xdf, 0xc0, 0x1, 0xbf,
+    0xff, 0xfd, 0x62, 0xff, 0x20, 0x0, 0x25, 0x53,
+    0x0, 0x1, 0x10,
+    /* U+0062 "b" */
+    0x12, 0x10, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xa0,
+    0x69, 0xa7, 0x20, 0x0, 0x6f, 0xbc, 0xff, 0xff,
+    0xf6, 0x0, 0x6f, 0xfe, 0x71, 0x29, 0xff, 0x40,
+    0x6f, 0xf5, 0x0, 0x0, 0x9f, 0xb0, 0x6f, 0xc0,
+    0x0, 0x0, 0x2f, 0xf1, 0x6f, 0x90, 0x0, 0x0,
+    0xd, 0xf4, 0x6f, 0x80, 0x0, 0x0, 0xc, 0xf5,
+    0x6f, 0x80, 0x0, 0x0, 0xc, 0xf5, 0x6f, 0xa0,
+    0x0, 0x0, 0x1e, 0xf3, 0x6f, 0xd1, 0x0, 0x0,
+    0x4f, 0xe0, 0x6f, 0xf8, 0x0, 0x2, 0xcf, 0x80,
+    0x6f, 0xef, 0xa6, 0x7d, 0xfc, 0x10, 0x6f, 0x88,
+    0xff, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x15, 0x52,
+    0x0, 0x0,
+    /* U+0063 "c" */
+    0x0, 0x0, 0x49, 0xa9, 0x61, 0x0, 0x0, 0x2c,
+    0xff, 0xff, 0xfd, 0x30, 0x1, 0xdf, 0xc4, 0x13,
+    0xaf, 0xd1, 0x7, 0xfd, 0x10, 0x0, 0x1d, 0xf5,
+    0xc, 0xf6, 0x0, 0x0, 0x5, 0x63, 0xe, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0x1f, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0xe, 0xf4, 0x0, 0x0, 0x3, 0x63, 0xb, 0xf8,
+    0x0, 0x0, 0x8, 0xf9, 0x5, 0xfe, 0x30, 0x0,
+    0x2e, 0xf4, 0x0, 0x9f, 0xe9, 0x68, 0xef, 0x90,
+    0x0, 0x7, 0xef, 0xff, 0xe7, 0x0, 0x0, 0x0,
+    0x14, 0x54, 0x10, 0x0,
+    /* U+0064 "d" */
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x21, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfa,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xfa, 0x0, 0x1,
+    0x6a, 0xa7, 0x17, 0xfa, 0x0, 0x4e, 0xff, 0xff,
+    0xda, 0xfa, 0x2, 0xef, 0xa3, 0x15, 0xdf, 0xfa,
+    0x8, 0xfb, 0x0, 0x0, 0x3e, 0xfa, 0xd, 0xf5,
+    0x0, 0x0, 0xa, 0xfa, 0x1f, 0xf1, 0x0, 0x0,
+    0x7, 0xfa, 0x3f, 0xe1, 0x0, 0x0, 0x5, 0xfa,
+    0x2f, 0xe1, 0x0, 0x0, 0x5, 0xfa, 0x1f, 0xf2,
+    0x0, 0x0, 0x7, 0xfa, 0xb, 0xf7, 0x0, 0x0,
+    0xb, 0xfa, 0x5, 0xfe, 0x30, 0x0, 0x5f, 0xfa,
+    0x0, 0xaf, 0xe8, 0x6a, 0xfe, 0xfa, 0x0, 0x8,
+    0xff, 0xff, 0xa6, 0xfa, 0x0, 0x0, 0x14, 0x52,
+    0x0, 0x0,
+    /* U+0065 "e" */
+    0x0, 0x0, 0x49, 0xa9, 0x61, 0x0, 0x0, 0x2,
+    0xbf, 0xff, 0xff, 0xe4, 0x0, 0x1, 0xcf, 0xc4,
+    0x12, 0x9f, 0xe3, 0x0, 0x7f, 0xd1, 0x0, 0x0,
+    0x9f, 0xa0, 0xc, 0xf7, 0x0, 0x0, 0x2, 0xff,
+    0x11, 0xff, 0x63, 0x33, 0x33, 0x3e, 0xf4, 0x2f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x52, 0xff, 0x88,
+    0x88, 0x88, 0x88, 0x83, 0xe, 0xf3, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xbf, 0x80, 0x0, 0x0, 0x2c,
+    0xb2, 0x5, 0xfe, 0x40, 0x0, 0xa, 0xfc, 0x0,
+    0xa, 0xff, 0xa6, 0x7c, 0xfe, 0x40, 0x0, 0x7,
+    0xef, 0xff, 0xfc, 0x30, 0x0, 0x0, 0x0, 0x35,
+    0x52, 0x0, 0x0,
+    /* U+0066 "f" */
+    0x0, 0x1, 0x45, 0x41, 0x0, 0x2c, 0xff, 0xf6,
+    0x0, 0xaf, 0xe9, 0x92, 0x0, 0xdf, 0x50, 0x0,
+    0x0, 0xef, 0x30, 0x0, 0x34, 0xef, 0x64, 0x20,
+    0xcf, 0xff, 0xff, 0x90, 0x46, 0xef, 0x76, 0x30,
+    0x0, 0xef, 0x30, 0x0, 0x0, 0xef, 0x30, 0x0,
+    0x0, 0xef, 0x30, 0x0, 0x0, 0xef, 0x30, 0x0,
+    0x0, 0xef, 0x30, 0x0, 0x0, 0xef, 0x30, 0x0,
+    0x0, 0xef, 0x30, 0x0, 0x0, 0xef, 0x30, 0x0,
+    0x0, 0xef, 0x30, 0x0, 0x0, 0xef, 0x30, 0x0,
+    0x0, 0x23, 0x0, 0x0,
+    /* U+0067 "g" */
+    0x0, 0x1, 0x6a, 0xa7, 0x21, 0x64, 0x0, 0x4e,
+    0xff, 0xff, 0xe7, 0xfb, 0x2, 0xef, 0xa3, 0x15,
+    0xdf, 0xfb, 0x9, 0xfb, 0x0, 0x0, 0x2e, 0xfb,
+    0xe, 0xf4, 0x0, 0x0, 0x8, 0xfb, 0x2f, 0xe1,
+    0x0, 0x0, 0x5, 0xfb, 0x3f, 0xe1, 0x0, 0x0,
+    0x4, 0xfb, 0x3f, 0xe1, 0x0, 0x0, 0x4, 0xfb,
+    0x1f, 0xf2, 0x0, 0x0, 0x7, 0xfb, 0xb, 0xf8,
+    0x0, 0x0, 0xc, 0xfb, 0x4, 0xfe, 0x50, 0x1,
+    0x9f, 0xfb, 0x0, 0x8f, 0xfc, 0xbd, 0xfc, 0xfb,
+    0x0, 0x5, 0xcf, 0xfc, 0x56, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xfa, 0xa, 0xb3, 0x0, 0x0,
+    0xa, 0xf7, 0x9, 0xfa, 0x10, 0x0, 0x6f, 0xf2,
+    0x2, 0xef, 0xda, 0x9c, 0xff, 0x70, 0x0, 0x2a,
+    0xdf, 0xfe, 0xb4, 0x0, 0x0, 0x0, 0x12, 0x21,
+    0x0, 0x0,
+    /* U+0068 "h" */
+    0x12, 0x10, 0x0, 0x0, 0x0, 0x6, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xb0, 0x0, 0x0, 0x0,
+    0x6, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xb0,
+    0x0, 0x0, 0x0, 0x6, 0xfb, 0x4, 0x9a, 0x94,
+    0x0, 0x6f, 0xbb, 0xff, 0xff, 0xfa, 0x6, 0xff,
+    0xe7, 0x33, 0x8f, 0xf5, 0x6f, 0xf5, 0x0, 0x0,
+    0xaf, 0x96, 0xfd, 0x10, 0x0, 0x7, 0xfa, 0x6f,
+    0xb0, 0x0, 0x0, 0x6f, 0xb6, 0xfb, 0x0, 0x0,
+    0x6, 0xfb, 0x6f, 0xb0, 0x0, 0x0, 0x6f, 0xb6,
+    0xfb, 0x0, 0x0, 0x6, 0xfb, 0x6f, 0xb0, 0x0,
+    0x0, 0x6f, 0xb6, 0xfb, 0x0, 0x0, 0x6, 0xfb,
+    0x6f, 0xb0, 0x0, 0x0, 0x6f, 0xb6, 0xfb, 0x0,
+    0x0, 0x6, 0xfb,
+    /* U+0069 "i" */
+    0x12, 0x26, 0xfb, 0x6f, 0xb2, 0x43, 0x0, 0x2,
+    0x64, 0x6f, 0xb6, 0xfb, 0x6f, 0xb6, 0xfb, 0x6f,
+    0xb6, 0xfb, 0x6f, 0xb6, 0xfb, 0x6f, 0xb6, 0xfb,
+    0x6f, 0xb6, 0xfb,
+    /* U+006A "j" */
+    0x0, 0x12, 0x10, 0x6, 0xfa, 0x0, 0x6f, 0xa0,
+    0x2, 0x53, 0x0, 0x0, 0x0, 0x3, 0x64, 0x0,
+    0x6f, 0xa0, 0x6, 0xfa, 0x0, 0x6f, 0xa0, 0x6,
+    0xfa, 0x0, 0x6f, 0xa0, 0x6, 0xfa, 0x0, 0x6f,
+    0xa0, 0x6, 0xfa, 0x0, 0x6f, 0xa0, 0x6, 0xfa,
+    0x0, 0x6f, 0xa0, 0x6, 0xfa, 0x0, 0x6f, 0xa0,
+    0x7, 0xfa, 0x0, 0xaf, 0x8a, 0xbf, 0xf4, 0xef,
+    0xe8, 0x1, 0x21, 0x0,
+    /* U+006B "k" */
+    0x12, 0x10, 0x0, 0x0, 0x0, 0x6, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xb0, 0x0, 0x0, 0x0,
+    0x6, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xb0,
+    0x0, 0x0, 0x0, 0x6, 0xfb, 0x0, 0x0, 0x36,
+    0x61, 0x6f, 0xb0, 0x0, 0x4e, 0xf8, 0x6, 0xfb,
+    0x0, 0x4e, 0xf7, 0x0, 0x6f, 0xb0, 0x4e, 0xf7,
+    0x0, 0x6, 0xfb, 0x4e, 0xf6, 0x0, 0x0, 0x6f,
+    0xde, 0xfd, 0x10, 0x0, 0x6, 0xff, 0xee, 0xf8,
+    0x0, 0x0, 0x6f, 0xe5, 0x4f, 0xe4, 0x0, 0x6,
+    0xfb, 0x0, 0x9f, 0xc1, 0x0, 0x6f, 0xb0, 0x1,
+    0xdf, 0x80, 0x6, 0xfb, 0x0, 0x5, 0xff, 0x40,
+    0x6f, 0xb0, 0x0, 0xa, 0xfd, 0x16, 0xfb, 0x0,
+    0x0, 0x2e, 0xf9,
+    /* U+006C "l" */
+    0x12, 0x17, 0xfa, 0x7f, 0xa7, 0xfa, 0x7f, 0xa7,
+    0xfa, 0x7f, 0xa7, 0xfa, 0x7f, 0xa7, 0xfa, 0x7f,
+    0xa7, 0xfa, 0x7f, 0xa7, 0xfa, 0x7f, 0xa7, 0xfa,
+    0x7f, 0xa7, 0xfa,
+    /* U+006D "m" */
+    0x26, 0x30, 0x59, 0xa8, 0x20, 0x2, 0x8a, 0x94,
+    0x0, 0x6f, 0x8b, 0xff, 0xff, 0xe3, 0x6f, 0xff,
+    0xff, 0x80, 0x6f, 0xee, 0x73, 0x4c, 0xfd, 0xf9,
+    0x33, 0x9f, 0xe2, 0x6f, 0xf5, 0x0, 0x4, 0xff,
+    0x90, 0x0, 0xc, 0xf5, 0x6f, 0xd1, 0x0, 0x1,
+    0xff, 0x40, 0x0, 0xa, 0xf7, 0x6f, 0xb0, 0x0,
+    0x1, 0xef, 0x20, 0x0, 0xa, 0xf7, 0x6f, 0xb0,
+    0x0, 0x1, 0xef, 0x20, 0x0, 0xa, 0xf7, 0x6f,
+    0xb0, 0x0, 0x1, 0xef, 0x20, 0x0, 0xa, 0xf7,
+    0x6f, 0xb0, 0x0, 0x1, 0xef, 0x20, 0x0, 0xa,
+    0xf7, 0x6f, 0xb0, 0x0, 0x1, 0xef, 0x20, 0x0,
+    0xa, 0xf7, 0x6f, 0xb0, 0x0, 0x1, 0xef, 0x20,
+    0x0, 0xa, 0xf7, 0x6f, 0xb0, 0x0, 0x1, 0xef,
+    0x20, 0x0, 0xa, 0xf7, 0x6f, 0xb0, 0x0, 0x1,
+    0xef, 0x20, 0x0, 0xa, 0xf7,
+    /* U+006E "n" */
+    0x26, 0x30, 0x59, 0xa9, 0x40, 0x6, 0xf8, 0xbf,
+    0xff, 0xff, 0xa0, 0x6f, 0xee, 0x73, 0x39, 0xff,
+    0x46, 0xff, 0x40, 0x0, 0xa, 0xf9, 0x6f, 0xd1,
+    0x0, 0x0, 0x7f, 0xa6, 0xfb, 0x0, 0x0, 0x6,
+    0xfa, 0x6f, 0xb0, 0x0, 0x0, 0x6f, 0xa6, 0xfb,
+    0x0, 0x0, 0x6, 0xfa, 0x6f, 0xb0, 0x0, 0x0,
+    0x6f, 0xa6, 0xfb, 0x0, 0x0, 0x6, 0xfa, 0x6f,
+    0xb0, 0x0, 0x0, 0x6f, 0xa6, 0xfb, 0x0, 0x0,
+    0x6, 0xfa, 0x6f, 0xb0, 0x0, 0x0, 0x6f, 0xa0,
+    /* U+006F "o" */
+    0x0, 0x0, 0x59, 0xa9, 0x61, 0x0, 0x0, 0x3,
+    0xcf, 0xff, 0xff, 0xe5, 0x0, 0x2, 0xdf, 0xc4,
+    0x13, 0x9f, 0xf4, 0x0, 0x9f, 0xc1, 0x0, 0x0,
+    0x9f, 0xc0, 0xe, 0xf5, 0x0, 0x0, 0x2, 0xff,
+    0x32, 0xff, 0x10, 0x0, 0x0, 0xc, 0xf6, 0x3f,
+    0xe1, 0x0, 0x0, 0x0, 0xbf, 0x73, 0xfe, 0x10,
+    0x0, 0x0, 0xb, 0xf6, 0x1f, 0xf2, 0x0, 0x0,
+    0x0, 0xdf, 0x50, 0xcf, 0x70, 0x0, 0x0, 0x3f,
+    0xf1, 0x6, 0xfe, 0x30, 0x0, 0x1c, 0xfa, 0x0,
+    0xb, 0xfe, 0x96, 0x8d, 0xfd, 0x20, 0x0, 0x18,
+    0xef, 0xff, 0xfa, 0x10, 0x0, 0x0, 0x1, 0x45,
+    0x41, 0x0, 0x0,
+    /* U+0070 "p" */
+    0x25, 0x30, 0x59, 0x96, 0x10, 0x0, 0x6f, 0x8b,
+    0xff, 0xff, 0xe5, 0x0, 0x6f, 0xfe, 0x71, 0x28,
+    0xff, 0x30, 0x6f, 0xf6, 0x0, 0x0, 0x8f, 0xb0,
+    0x6f, 0xd1, 0x0, 0x0, 0x2f, 0xf1, 0x6f, 0x90,
+    0x0, 0x0, 0xd, 0xf4, 0x6f, 0x80, 0x0, 0x0,
+    0xc, 0xf5, 0x6f, 0x80, 0x0, 0x0, 0xc, 0xf5,
+    0x6f, 0xa0, 0x0, 0x0, 0x1e, 0xf3, 0x6f, 0xd1,
+    0x0, 0x0, 0x4f, 0xe0, 0x6f, 0xf8, 0x0, 0x1,
+    0xcf, 0x80, 0x6f, 0xff, 0xb6, 0x7d, 0xfc, 0x10,
+    0x6f, 0xb8, 0xff, 0xff, 0x91, 0x0, 0x6f, 0xb0,
+    0x15, 0x51, 0x0, 0x0, 0x6f, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x5c, 0x80,
+    0x0, 0x0, 0x0, 0x0,
+    /* U+0071 "q" */
+    0x0, 0x1, 0x59, 0x96, 0x11, 0x53, 0x0, 0x3d,
+    0xff, 0xff, 0xd7, 0xfa, 0x1, 0xef, 0xa2, 0x15,
+    0xdf, 0xfa, 0x8, 0xfb, 0x10, 0x0, 0x3e, 0xfa,
+    0xd, 0xf5, 0x0, 0x0, 0xa, 0xfa, 0x1f, 0xf2,
+    0x0, 0x0, 0x6, 0xfa, 0x2f, 0xe1, 0x0, 0x0,
+    0x5, 0xfa, 0x2f, 0xf1, 0x0, 0x0, 0x5, 0xfa,
+    0xe, 0xf3, 0x0, 0x0, 0x6, 0xfa, 0xb, 0xf7,
+    0x0, 0x0, 0xa, 0xfa, 0x5, 0xfe, 0x30, 0x0,
+    0x5f, 0xfa, 0x0, 0x9f, 0xe8, 0x69, 0xff, 0xfa,
+    0x0, 0x7, 0xef, 0xff, 0xa8, 0xfa, 0x0, 0x0,
+    0x14, 0x52, 0x7, 0xfa, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfa,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xfa, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xc8,
+    /* U+0072 "r" */
+    0x36, 0x32, 0x9a, 0x60, 0x7f, 0x8d, 0xff, 0xe3,
+    0x7f, 0xee, 0x98, 0x90, 0x7f, 0xf5, 0x0, 0x0,
+    0x7f, 0xd1, 0x0, 0x0, 0x7f, 0xb0, 0x0, 0x0,
+    0x7f, 0xa0, 0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0,
+    0x7f, 0xa0, 0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0,
+    0x7f, 0xa0, 0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0,
+    0x7f, 0xa0, 0x0, 0x0,
+    /* U+0073 "s" */
+    0x0, 0x4, 0x8a, 0xa7, 0x20, 0x0, 0x1, 0xbf,
+    0xff, 0xff, 0xf7, 0x0, 0x9, 0xfb, 0x31, 0x27,
+    0xff, 0x30, 0xd, 0xf3, 0x0, 0x0, 0xae, 0x60,
+    0xd, 0xf8, 0x10, 0x0, 0x11, 0x0, 0x7, 0xff,
+    0xda, 0x62, 0x0, 0x0, 0x0, 0x8e, 0xff, 0xfe,
+    0xc5, 0x0, 0x0, 0x1, 0x59, 0xdf, 0xff, 0x70,
+    0x0, 0x10, 0x0, 0x3, 0xbf, 0xe0, 0x2b, 0xc1,
+    0x0, 0x0, 0x2f, 0xf1, 0xd, 0xf6, 0x0, 0x0,
+    0x6f, 0xd0, 0x6, 0xff, 0xa6, 0x69, 0xef, 0x50,
+    0x0, 0x6e, 0xff, 0xff, 0xd5, 0x0, 0x0, 0x0,
+    0x35, 0x53, 0x0, 0x0,
+    /* U+0074 "t" */
+    0x0, 0x29, 0x10, 0x0, 0x1d, 0xf1, 0x0, 0x1,
+    0xef, 0x10, 0x0, 0x1e, 0xf1, 0x0, 0x5a, 0xff,
+    0xa9, 0x29, 0xff, 0xff, 0xf3, 0x2, 0xef, 0x20,
+    0x0, 0x1e, 0xf1, 0x0, 0x1, 0xef, 0x10, 0x0,
+    0x1e, 0xf1, 0x0, 0x1, 0xef, 0x10, 0x0, 0x1e,
+    0xf1, 0x0, 0x1, 0xef, 0x10, 0x0, 0x1e, 0xf2,
+    0x0, 0x0, 0xef, 0x41, 0x0, 0xc, 0xff, 0xe4,
+    0x0, 0x3c, 0xfe, 0x60,
+    /* U+0075 "u" */
+    0x25, 0x30, 0x0, 0x0, 0x35, 0x37, 0xfa, 0x0,
+    0x0, 0x7, 0xfa, 0x7f, 0xa0, 0x0, 0x0, 0x7f,
+    0xa7, 0xfa, 0x0, 0x0, 0x7, 0xfa, 0x7f, 0xa0,
+    0x0, 0x0, 0x7f, 0xa7, 0xfa, 0x0, 0x0, 0x7,
+    0xfa, 0x7f, 0xa0, 0x0, 0x0, 0x7f, 0xa7, 0xfa,
+    0x0, 0x0, 0x7, 0xfa, 0x7f, 0xa0, 0x0, 0x0,
+    0x8f, 0xa6, 0xfb, 0x0, 0x0, 0xb, 0xfa, 0x4f,
+    0xe3, 0x0, 0x6, 0xff, 0xa0, 0xdf, 0xe9, 0x7b,
+    0xfc, 0xfa, 0x3, 0xcf, 0xff, 0xe7, 0x4f, 0xa0,
+    0x0, 0x25, 0x41, 0x0, 0x10,
+    /* U+0076 "v" */
+    0x35, 0x30, 0x0, 0x0, 0x3, 0x53, 0x6f, 0xc0,
+    0x0, 0x0, 0xb, 0xf6, 0x1e, 0xf3, 0x0, 0x0,
+    0x2f, 0xe1, 0x9, 0xf8, 0x0, 0x0, 0x8f, 0x90,
+    0x4, 0xfd, 0x10, 0x0, 0xcf, 0x40, 0x0, 0xcf,
+    0x40, 0x3, 0xfd, 0x0, 0x0, 0x7f, 0xa0, 0x9,
+    0xf7, 0x0, 0x0, 0x2e, 0xe1, 0x1d, 0xe2, 0x0,
+    0x0, 0xa, 0xf5, 0x5f, 0xb0, 0x0, 0x0, 0x5,
+    0xfa, 0xaf, 0x50, 0x0, 0x0, 0x1, 0xde, 0xed,
+    0x10, 0x0, 0x0, 0x0, 0x8f, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x3f, 0xf3, 0x0, 0x0,
+    /* U+0077 "w" */
+    0x55, 0x20, 0x0, 0x2, 0x54, 0x0, 0x0, 0x5,
+    0x51, 0xaf, 0x70, 0x0, 0xa, 0xfe, 0x10, 0x0,
+    0x3f, 0xd1, 0x5f, 0xb0, 0x0, 0x1d, 0xff, 0x40,
+    0x0, 0x7f, 0x80, 0x1f, 0xe1, 0x0, 0x3f, 0xef,
+    0x70, 0x0, 0xbf, 0x40, 0xb, 0xf5, 0x0, 0x7f,
+    0x8f, 0xb0, 0x1, 0xed, 0x10, 0x7, 0xf9, 0x0,
+    0xbe, 0x3d, 0xe1, 0x5, 0xf9, 0x0, 0x2, 0xfd,
+    0x11, 0xec, 0xa, 0xf4, 0xa, 0xf4, 0x0, 0x0,
+    0xcf, 0x24, 0xf8, 0x6, 0xf8, 0xe, 0xe1, 0x0,
+    0x0, 0x8f, 0x68, 0xf4, 0x2, 0xfc, 0x4f, 0xa0,
+    0x0, 0x0, 0x3f, 0xbc, 0xe1, 0x0, 0xdf, 0x9f,
+    0x50, 0x0, 0x0, 0xd, 0xff, 0xb0, 0x0, 0x9f,
+    0xfe, 0x10, 0x0, 0x0, 0x9, 0xff, 0x70, 0x0,
+    0x5f, 0xfb, 0x0, 0x0, 0x0, 0x4, 0xff, 0x30,
+    0x0, 0x1f, 0xf6, 0x0, 0x0,
+    /* U+0078 "x" */
+    0x26, 0x62, 0x0, 0x0, 0x16, 0x62, 0x1c, 0xfb,
+    0x0, 0x0, 0xaf, 0xc0, 0x3, 0xef, 0x60, 0x6,
+    0xfe, 0x20, 0x0, 0x7f, 0xe2, 0x3e, 0xf5, 0x0,
+    0x0, 0xb, 0xfb, 0xcf, 0x90, 0x0, 0x0, 0x2,
+    0xdf, 0xfc, 0x10, 0x0, 0x0, 0x0, 0x7f, 0xf6,
+    0x0, 0x0, 0x0, 0x1, 0xdf, 0xfd, 0x10, 0x0,
+    0x0, 0xa, 0xfb, 0xbf, 0xa0, 0x0, 0x0, 0x6f,
+    0xe2, 0x2e, 0xf6, 0x0, 0x2, 0xef, 0x60, 0x6,
+    0xfe, 0x20, 0xb, 0xfb, 0x0, 0x0, 0xbf, 0xb0,
+    0x7f, 0xe2, 0x0, 0x0, 0x2e, 0xf7,
+    /* U+0079 "y" */
+    0x35, 0x40, 0x0, 0x0, 0x2, 0x54, 0x4f, 0xe1,
+    0x0, 0x0, 0xa, 0xf7, 0xd, 0xf5, 0x0, 0x0,
+    0x1e, 0xf2, 0x8, 0xfa, 0x0, 0x0, 0x6f, 0xb0,
+    0x3, 0xfe, 0x20, 0x0, 0xbf, 0x50, 0x0, 0xcf,
+    0x60, 0x2, 0xee, 0x10, 0x0, 0x6f, 0xb0, 0x7,
+    0xf9, 0x0, 0x0, 0x1e, 0xe2, 0xc, 0xf4, 0x0,
+    0x0, 0xa, 0xf7, 0x3f, 0xd0, 0x0, 0x0, 0x4,
+    0xfc, 0x8f, 0x70, 0x0, 0x0, 0x0, 0xde, 0xde,
+    0x20, 0x0, 0x0, 0x0, 0x8f, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0x2e, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x2e, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x90,
+    0x0, 0x0, 0x1, 0x3, 0xdf, 0x30, 0x0, 0x0,
+    0x9, 0xee, 0xf9, 0x0, 0x0, 0x0, 0x8, 0xfe,
+    0xa1, 0x0, 0x0, 0x0, 0x1, 0x22, 0x0, 0x0,
+    0x0, 0x0,
+    /* U+007A "z" */
+    0x5, 0x55, 0x55, 0x55, 0x55, 0x51, 0x1f, 0xff,
+    0xff, 0xff, 0xff, 0xf2, 0x5, 0x55, 0x55, 0x56,
+    0xef, 0xb0, 0x0, 0x0, 0x0, 0x9, 0xfc, 0x10,
+    0x0, 0x0, 0x0, 0x8f, 0xd2, 0x0, 0x0, 0x0,
+    0x7, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x5e, 0xe5,
+    0x0, 0x0, 0x0, 0x4, 0xef, 0x60, 0x0, 0x0,
+    0x0, 0x2d, 0xf8, 0x0, 0x0, 0x0, 0x1, 0xdf,
+    0xa0, 0x0, 0x0, 0x0, 0x1c, 0xfb, 0x10, 0x0,
+    0x0, 0x0, 0x7f, 0xfc, 0xbc, 0xcc, 0xcc, 0xc6,
+    0x8f, 0xff, 0xff, 0xff, 0xff, 0xf7,
+    /* U+007B "{" */
+    0x0, 0x0, 0x2, 0x42, 0x0, 0x1, 0xbf, 0xf7,
+    0x0, 0x7, 0xfd, 0x94, 0x0, 0xc, 0xf4, 0x0,
+    0x0, 0xd, 0xf2, 0x0, 0x0, 0xe, 0xe2, 0x0,
+    0x0, 0xe, 0xe2, 0x0, 0x0, 0xe, 0xe2, 0x0,
+    0x0, 0x1e, 0xd1, 0x0, 0x0, 0x4f, 0xb0, 0x0,
+    0x13, 0xcf, 0x50, 0x0, 0x4f, 0xe6, 0x0, 0x0,
+    0x4e, 0xf9, 0x0, 0x0, 0x1, 0xaf, 0x70, 0x0,
+    0x0, 0x3f, 0xc0, 0x0, 0x0, 0x1e, 0xe1, 0x0,
+    0x0, 0xe, 0xe2, 0x0, 0x0, 0xe, 0xe2, 0x0,
+    0x0, 0xd, 0xe2, 0x0, 0x0, 0xd, 0xf2, 0x0,
+    0x0, 0xb, 0xf5, 0x0, 0x0, 0x7, 0xfe, 0xb5,
+    0x0, 0x1, 0x9e, 0xf7, 0x0, 0x0, 0x1, 0x21,
+    /* U+007C "|" */
+    0x45, 0xc, 0xe1, 0xce, 0x1c, 0xe1, 0xce, 0x1c,
+    0xe1, 0xce, 0x1c, 0xe1, 0xce, 0x1c, 0xe1, 0xce,
+    0x1c, 0xe1, 0xce, 0x1c, 0xe1, 0xce, 0x1c, 0xe1,
+    0xce, 0x1c, 0xe1, 0xce, 0x1c, 0xe1, 0xce, 0x1c,
+    0xe1, 0xce, 0x12, 0x20,
+    /* U+007D "}" */
+    0x24, 0x20, 0x0, 0x0, 0x7f, 0xfb, 0x10, 0x0,
+    0x49, 0xdf, 0x80, 0x0, 0x0, 0x4f, 0xc0, 0x0,
+    0x0, 0x2e, 0xc0, 0x0, 0x0, 0x2e, 0xd1, 0x0,
+    0x0, 0x2e, 0xd1, 0x0, 0x0, 0x1e, 0xd1, 0x0,
+    0x0, 0x1e, 0xe1, 0x0, 0x0, 0xc, 0xf4, 0x0,
+    0x0, 0x5, 0xfc, 0x41, 0x0, 0x0, 0x6e, 0xf5,
+    0x0, 0x0, 0x8f, 0xe4, 0x0, 0x6, 0xfa, 0x10,
+    0x0, 0xc, 0xf3, 0x0, 0x0, 0x1e, 0xe1, 0x0,
+    0x0, 0x1e, 0xd1, 0x0, 0x0, 0x2e, 0xd1, 0x0,
+    0x0, 0x2e, 0xd1, 0x0, 0x0, 0x2e, 0xc0, 0x0,
+    0x0, 0x5f, 0xb0, 0x0, 0x5b, 0xef, 0x60, 0x0,
+    0x7f, 0xe9, 0x10, 0x0, 0x12, 0x10, 0x0, 0x0,
+    /* U+007E "~" */
+    0x1, 0x44, 0x20, 0x0, 0x0, 0x1, 0x5d, 0xff,
+    0xfc, 0x72, 0x0, 0x3c, 0xef, 0xee, 0xff, 0xfe,
+    0xcc, 0xff, 0xd5, 0x11, 0x39, 0xef, 0xff, 0xf8,
+    0x20, 0x0, 0x0, 0x15, 0x76, 0x30,
+    /* U+00C4 "Ä" */
+    0x0, 0x0, 0x59, 0x50, 0x29, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xa0, 0x3f, 0xf1, 0x0, 0x0,
+    0x0, 0x0, 0x7c, 0x80, 0x2c, 0xc1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x12, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xf4, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xef, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xf9, 0xee, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0xf4, 0xaf, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xe1, 0x5f, 0xd0, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0x90, 0x1e, 0xf5, 0x0, 0x0,
+    0x0, 0x1, 0xef, 0x40, 0x9, 0xfb, 0x0, 0x0,
+    0x0, 0x6, 0xfc, 0x0, 0x3, 0xff, 0x20, 0x0,
+    0x0, 0xb, 0xf7, 0x0, 0x0, 0xcf, 0x80, 0x0,
+    0x0, 0x3f, 0xf3, 0x11, 0x11, 0x8f, 0xe1, 0x0,
+    0x0, 0x8f, 0xfe, 0xee, 0xee, 0xef, 0xf6, 0x0,
+    0x1, 0xdf, 0xdd, 0xdd, 0xdd, 0xde, 0xfb, 0x0,
+    0x5, 0xfe, 0x20, 0x0, 0x0, 0x5, 0xff, 0x30,
+    0xa, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x90,
+    0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xe1,
+    0x7f, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf6,
+    0xdf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfc,
+    /* U+00C5 "Å" */
+    0x0, 0x0, 0x0, 0x5a, 0x81, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xc3, 0x69, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0x90, 0x1c, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xc6, 0x98, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xf4, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xef, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xfa, 0xee, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0xf5, 0xaf, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x3f, 0xe1, 0x5f, 0xd0, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0x90, 0x1e, 0xf5, 0x0, 0x0,
+    0x0, 0x1, 0xef, 0x40, 0x9, 0xfb, 0x0, 0x0,
+    0x0, 0x5, 0xfd, 0x10, 0x3, 0xff, 0x20, 0x0,
+    0x0, 0xb, 0xf7, 0x0, 0x0, 0xcf, 0x80, 0x0,
+    0x0, 0x2f, 0xf3, 0x11, 0x11, 0x8f, 0xe1, 0x0,
+    0x0, 0x8f, 0xfe, 0xee, 0xee, 0xef, 0xf5, 0x0,
+    0x0, 0xdf, 0xdd, 0xdd, 0xdd, 0xde, 0xfb, 0x0,
+    0x5, 0xfe, 0x20, 0x0, 0x0, 0x5, 0xff, 0x30,
+    0xa, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x90,
+    0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xe1,
+    0x7f, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf6,
+    0xdf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfc,
+    /* U+00C9 "É" */
+    0x0, 0x0, 0x0, 0x6, 0x75, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5f, 0xe3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xbf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xc8, 0x0, 0x0, 0x0, 0x2, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x21, 0x2e, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf5, 0x2f, 0xfe, 0xee, 0xee, 0xee, 0xee,
+    0xe5, 0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
+    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2f, 0xfe, 0xdd, 0xdd,
+    0xdd, 0xdd, 0x90, 0x2f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xa0, 0x2f, 0xf4, 0x22, 0x22, 0x22, 0x22,
+    0x10, 0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
+    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf3, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x2f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfb, 0x2f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfb,
+    /* U+00D6 "Ö" */
+    0x0, 0x0, 0x8, 0x92, 0x5, 0x95, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xdf, 0x40, 0x9f, 0xa0, 0x0,
+    0x0, 0x0, 0x0, 0x1b, 0xc3, 0x7, 0xc8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x13, 0x55, 0x42, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x7d, 0xff, 0xff, 0xfc,
+    0x50, 0x0, 0x0, 0x2, 0xcf, 0xfd, 0xa9, 0xae,
+    0xff, 0x91, 0x0, 0x1, 0xdf, 0xd5, 0x0, 0x0,
+    0x17, 0xff, 0xa0, 0x0, 0x9f, 0xd2, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0x50, 0x2f, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0xa, 0xfc, 0x7, 0xfd, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xf3, 0xaf, 0xa0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xef, 0x6c, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xc, 0xf8, 0xcf, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x9c, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf8, 0xaf,
+    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x66,
+    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf3,
+    0x2e, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfc,
+    0x0, 0x8f, 0xe3, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0x50, 0x1, 0xcf, 0xd5, 0x0, 0x0, 0x17, 0xff,
+    0x90, 0x0, 0x2, 0xbf, 0xfd, 0xa9, 0xbe, 0xff,
+    0x91, 0x0, 0x0, 0x0, 0x6d, 0xff, 0xff, 0xfb,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x2, 0x45, 0x41,
+    0x0, 0x0, 0x0,
+    /* U+00DC "Ü" */
+    0x0, 0x0, 0x69, 0x50, 0x39, 0x80, 0x0, 0x0,
+    0x0, 0xa, 0xf8, 0x5, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0x8c, 0x70, 0x4c, 0xb0, 0x0, 0x0, 0x22,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0x21, 0x2e, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0xdf, 0x62, 0xff, 0x20,
+    0x0, 0x0, 0x0, 0xd, 0xf6, 0x2f, 0xf2, 0x0,
+    0x0, 0x0, 0x0, 0xdf, 0x62, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0xd, 0xf6, 0x2f, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0x62, 0xff, 0x20, 0x0, 0x0,
+    0x0, 0xd, 0xf6, 0x2f, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0xdf, 0x62, 0xff, 0x20, 0x0, 0x0, 0x0,
+    0xd, 0xf6, 0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0x62, 0xff, 0x20, 0x0, 0x0, 0x0, 0xd,
+    0xf6, 0x2f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xef,
+    0x61, 0xef, 0x40, 0x0, 0x0, 0x0, 0xe, 0xf5,
+    0xd, 0xf6, 0x0, 0x0, 0x0, 0x2, 0xff, 0x30,
+    0xaf, 0xc1, 0x0, 0x0, 0x0, 0x8f, 0xd1, 0x4,
+    0xff, 0xa2, 0x0, 0x1, 0x6f, 0xf8, 0x0, 0x8,
+    0xff, 0xec, 0xbb, 0xef, 0xfb, 0x10, 0x0, 0x5,
+    0xdf, 0xff, 0xff, 0xe7, 0x0, 0x0, 0x0, 0x0,
+    0x24, 0x55, 0x30, 0x0, 0x0,
+    /* U+00E4 "ä" */
+    0x0, 0x1, 0x21, 0x1, 0x22, 0x0, 0x0, 0x0,
+    0xaf, 0x80, 0x5f, 0xd0, 0x0, 0x0, 0xa, 0xf8,
+    0x5, 0xfd, 0x0, 0x0, 0x0, 0x34, 0x20, 0x14,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x16, 0x9a, 0xa8, 0x40, 0x0, 0x0,
+    0x5e, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x3f, 0xf8,
+    0x21, 0x28, 0xff, 0x50, 0x9, 0xfa, 0x0, 0x0,
+    0xa, 0xf9, 0x0, 0x25, 0x20, 0x0, 0x0, 0x7f,
+    0xa0, 0x0, 0x0, 0x12, 0x36, 0x9d, 0xfa, 0x0,
+    0x3, 0xad, 0xef, 0xff, 0xef, 0xa0, 0x5, 0xef,
+    0xdb, 0x85, 0x27, 0xfa, 0x0, 0xdf, 0x91, 0x0,
+    0x0, 0x8f, 0xa0, 0x2f, 0xf2, 0x0, 0x0, 0xb,
+    0xfa, 0x1, 0xff, 0x50, 0x0, 0x6, 0xff, 0xa0,
+    0xa, 0xfe, 0x75, 0x6a, 0xfd, 0xfc, 0x0, 0x1b,
+    0xff, 0xff, 0xd6, 0x2f, 0xf2, 0x0, 0x2, 0x55,
+    0x30, 0x0, 0x11, 0x0,
+    /* U+00E5 "å" */
+    0x0, 0x0, 0x5, 0x96, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xb4, 0x96, 0x0, 0x0, 0x0, 0x0, 0x76,
+    0x3, 0xa0, 0x0, 0x0, 0x0, 0x4, 0xc5, 0xa7,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0x96, 0x0, 0x0,
+    0x0, 0x0, 0x16, 0x9a, 0xa8, 0x40, 0x0, 0x0,
+    0x5e, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x3f, 0xf8,
+    0x21, 0x28, 0xff, 0x50, 0x9, 0xfa, 0x0, 0x0,
+    0xa, 0xf9, 0x0, 0x25, 0x20, 0x0, 0x0, 0x7f,
+    0xa0, 0x0, 0x0, 0x12, 0x36, 0x9d, 0xfa, 0x0,
+    0x3, 0xad, 0xef, 0xff, 0xef, 0xa0, 0x5, 0xef,
+    0xdb, 0x85, 0x27, 0xfa, 0x0, 0xdf, 0x91, 0x0,
+    0x0, 0x8f, 0xa0, 0x2f, 0xf2, 0x0, 0x0, 0xb,
+    0xfa, 0x1, 0xff, 0x50, 0x0, 0x6, 0xff, 0xa0,
+    0xa, 0xfe, 0x75, 0x6a, 0xfd, 0xfc, 0x0, 0x1b,
+    0xff, 0xff, 0xd6, 0x2f, 0xf2, 0x0, 0x2, 0x55,
+    0x30, 0x0, 0x11, 0x0,
+    /* U+00E9 "é" */
+    0x0, 0x0, 0x0, 0x2, 0x21, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xfe, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x21, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0x9a, 0x96, 0x10, 0x0, 0x0,
+    0x2b, 0xff, 0xff, 0xfe, 0x40, 0x0, 0x1c, 0xfc,
+    0x41, 0x29, 0xfe, 0x30, 0x7, 0xfd, 0x10, 0x0,
+    0x9, 0xfa, 0x0, 0xcf, 0x70, 0x0, 0x0, 0x2f,
+    0xf1, 0x1f, 0xf6, 0x33, 0x33, 0x33, 0xef, 0x42,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x2f, 0xf8,
+    0x88, 0x88, 0x88, 0x88, 0x30, 0xef, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xf8, 0x0, 0x0, 0x2,
+    0xcb, 0x20, 0x5f, 0xe4, 0x0, 0x0, 0xaf, 0xc0,
+    0x0, 0xaf, 0xfa, 0x67, 0xcf, 0xe4, 0x0, 0x0,
+    0x7e, 0xff, 0xff, 0xc3, 0x0, 0x0, 0x0, 0x3,
+    0x55, 0x20, 0x0, 0x0,
+    /* U+00F6 "ö" */
+    0x0, 0x1, 0x21, 0x1, 0x22, 0x0, 0x0, 0x0,
+    0xaf, 0x80, 0x4f, 0xe0, 0x0, 0x0, 0xa, 0xf8,
+    0x4, 0xfe, 0x0, 0x0, 0x0, 0x34, 0x20, 0x14,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0x9a, 0x96, 0x10, 0x0, 0x0,
+    0x3c, 0xff, 0xff, 0xfe, 0x50, 0x0, 0x2d, 0xfc,
+    0x41, 0x39, 0xff, 0x40, 0x9, 0xfc, 0x10, 0x0,
+    0x9, 0xfc, 0x0, 0xef, 0x50, 0x0, 0x0, 0x2f,
+    0xf3, 0x2f, 0xf1, 0x0, 0x0, 0x0, 0xcf, 0x63,
+    0xfe, 0x10, 0x0, 0x0, 0xb, 0xf7, 0x3f, 0xe1,
+    0x0, 0x0, 0x0, 0xbf, 0x61, 0xff, 0x20, 0x0,
+    0x0, 0xd, 0xf5, 0xc, 0xf7, 0x0, 0x0, 0x3,
+    0xff, 0x10, 0x6f, 0xe3, 0x0, 0x1, 0xcf, 0xa0,
+    0x0, 0xbf, 0xe9, 0x68, 0xdf, 0xd2, 0x0, 0x1,
+    0x8e, 0xff, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x14,
+    0x54, 0x10, 0x0, 0x0,
+    /* U+00FC "ü" */
+    0x0, 0x22, 0x10, 0x12, 0x20, 0x0, 0xb, 0xf7,
+    0x5, 0xfd, 0x0, 0x0, 0xbf, 0x70, 0x5f, 0xd0,
+    0x0, 0x3, 0x42, 0x1, 0x43, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0x53, 0x0, 0x0, 0x3,
+    0x53, 0x7f, 0xa0, 0x0, 0x0, 0x7f, 0xa7, 0xfa,
+    0x0, 0x0, 0x7, 0xfa, 0x7f, 0xa0, 0x0, 0x0,
+    0x7f, 0xa7, 0xfa, 0x0, 0x0, 0x7, 0xfa, 0x7f,
+    0xa0, 0x0, 0x0, 0x7f, 0xa7, 0xfa, 0x0, 0x0,
+    0x7, 0xfa, 0x7f, 0xa0, 0x0, 0x0, 0x7f, 0xa7,
+    0xfa, 0x0, 0x0, 0x8, 0xfa, 0x6f, 0xb0, 0x0,
+    0x0, 0xbf, 0xa4, 0xfe, 0x30, 0x0, 0x6f, 0xfa,
+    0xd, 0xfe, 0x97, 0xbf, 0xcf, 0xa0, 0x3c, 0xff,
+    0xfe, 0x74, 0xfa, 0x0, 0x2, 0x54, 0x10, 0x1,
+    0x0,
+};
+
+static const lv_font_fmt_txt_glyph_dsc_t arial_24_glyph_dsc[] = {
+    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
+    {.bitmap_index = 0, .adv_w = 107, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 0, .adv_w = 107, .box_w = 3, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 27, .adv_w = 136, .box_w = 7, .box_h = 7, .ofs_x = 1, .ofs_y = 11},
+    {.bitmap_index = 52, .adv_w = 214, .box_w = 13, .box_h = 19, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 176, .adv_w = 214, .box_w = 13, .box_h = 22, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 319, .adv_w = 341, .box_w = 19, .box_h = 19, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 500, .adv_w = 256, .box_w = 15, .box_h = 19, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 643, .adv_w = 73, .box_w = 3, .box_h = 7, .ofs_x = 1, .ofs_y = 11},
+    {.bitmap_index = 654, .adv_w = 128, .box_w = 6, .box_h = 24, .ofs_x = 1, .ofs_y = -6},
+    {.bitmap_index = 726, .adv_w = 128, .box_w = 7, .box_h = 24, .ofs_x = 1, .ofs_y = -6},
+    {.bitmap_index = 810, .adv_w = 149, .box_w = 9, .box_h = 8, .ofs_x = 0, .ofs_y = 10},
+    {.bitmap_index = 846, .adv_w = 224, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 2},
+    {.bitmap_index = 924, .adv_w = 107, .box_w = 3, .box_h = 7, .ofs_x = 2, .ofs_y = -4},
+    {.bitmap_index = 935, .adv_w = 128, .box_w = 8, .box_h = 3, .ofs_x = 0, .ofs_y = 5},
+    {.bitmap_index = 947, .adv_w = 107, .box_w = 3, .box_h = 3, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 952, .adv_w = 107, .box_w = 7, .box_h = 19, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 1019, .adv_w = 214, .box_w = 12, .box_h = 19, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 1133, .adv_w = 214, .box_w = 7, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 1196, .adv_w = 214, .box_w = 13, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1313, .adv_w = 214, .box_w = 12, .box_h = 19, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 1427, .adv_w = 214, .box_w = 13, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1544, .adv_w = 214, .box_w = 12, .box_h = 18, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 1652, .adv_w = 214, .box_w = 13, .box_h = 19, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 1776, .adv_w = 214, .box_w = 12, .box_h = 18, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 1884, .adv_w = 214, .box_w = 12, .box_h = 19, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 1998, .adv_w = 214, .box_w = 12, .box_h = 19, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 2112, .adv_w = 107, .box_w = 3, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2132, .adv_w = 107, .box_w = 3, .box_h = 17, .ofs_x = 2, .ofs_y = -4},
+    {.bitmap_index = 2158, .adv_w = 224, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 2},
+    {.bitmap_index = 2236, .adv_w = 224, .box_w = 12, .box_h = 8, .ofs_x = 1, .ofs_y = 4},
+    {.bitmap_index = 2284, .adv_w = 224, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 2},
+    {.bitmap_index = 2362, .adv_w = 214, .box_w = 12, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2470, .adv_w = 390, .box_w = 23, .box_h = 24, .ofs_x = 1, .ofs_y = -6},
+    {.bitmap_index = 2746, .adv_w = 256, .box_w = 16, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2890, .adv_w = 256, .box_w = 14, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3016, .adv_w = 277, .box_w = 16, .box_h = 19, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 3168, .adv_w = 277, .box_w = 16, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3312, .adv_w = 256, .box_w = 14, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3438, .adv_w = 235, .box_w = 13, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3555, .adv_w = 299, .box_w = 17, .box_h = 19, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 3717, .adv_w = 277, .box_w = 15, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3852, .adv_w = 107, .box_w = 3, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3879, .adv_w = 192, .box_w = 11, .box_h = 19, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 3984, .adv_w = 256, .box_w = 15, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4119, .adv_w = 214, .box_w = 12, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4227, .adv_w = 320, .box_w = 18, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4389, .adv_w = 277, .box_w = 15, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4524, .adv_w = 299, .box_w = 17, .box_h = 19, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 4686, .adv_w = 256, .box_w = 15, .box_h = 19, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 4829, .adv_w = 299, .box_w = 17, .box_h = 20, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 4999, .adv_w = 277, .box_w = 16, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5143, .adv_w = 256, .box_w = 14, .box_h = 19, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 5276, .adv_w = 235, .box_w = 15, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5411, .adv_w = 277, .box_w = 15, .box_h = 19, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 5554, .adv_w = 256, .box_w = 16, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5698, .adv_w = 362, .box_w = 23, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5905, .adv_w = 256, .box_w = 16, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6049, .adv_w = 256, .box_w = 16, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6193, .adv_w = 235, .box_w = 15, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6328, .adv_w = 107, .box_w = 6, .box_h = 23, .ofs_x = 1, .ofs_y = -5},
+    {.bitmap_index = 6397, .adv_w = 107, .box_w = 7, .box_h = 19, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 6464, .adv_w = 107, .box_w = 6, .box_h = 23, .ofs_x = 0, .ofs_y = -5},
+    {.bitmap_index = 6533, .adv_w = 180, .box_w = 11, .box_h = 10, .ofs_x = 0, .ofs_y = 8},
+    {.bitmap_index = 6588, .adv_w = 214, .box_w = 15, .box_h = 2, .ofs_x = -1, .ofs_y = -5},
+    {.bitmap_index = 6603, .adv_w = 128, .box_w = 5, .box_h = 4, .ofs_x = 1, .ofs_y = 14},
+    {.bitmap_index = 6613, .adv_w = 214, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 6704, .adv_w = 214, .box_w = 12, .box_h = 19, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 6818, .adv_w = 192, .box_w = 12, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 6902, .adv_w = 214, .box_w = 12, .box_h = 19, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 7016, .adv_w = 214, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 7107, .adv_w = 107, .box_w = 8, .box_h = 19, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 7183, .adv_w = 214, .box_w = 12, .box_h = 19, .ofs_x = 0, .ofs_y = -6},
+    {.bitmap_index = 7297, .adv_w = 214, .box_w = 11, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7396, .adv_w = 85, .box_w = 3, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7423, .adv_w = 85, .box_w = 5, .box_h = 24, .ofs_x = -1, .ofs_y = -6},
+    {.bitmap_index = 7483, .adv_w = 192, .box_w = 11, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7582, .adv_w = 85, .box_w = 3, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7609, .adv_w = 320, .box_w = 18, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7726, .adv_w = 214, .box_w = 11, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7798, .adv_w = 214, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 7889, .adv_w = 214, .box_w = 12, .box_h = 18, .ofs_x = 1, .ofs_y = -5},
+    {.bitmap_index = 7997, .adv_w = 214, .box_w = 12, .box_h = 18, .ofs_x = 0, .ofs_y = -5},
+    {.bitmap_index = 8105, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 8157, .adv_w = 192, .box_w = 12, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 8241, .adv_w = 107, .box_w = 7, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8301, .adv_w = 214, .box_w = 11, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 8378, .adv_w = 192, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8456, .adv_w = 277, .box_w = 18, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8573, .adv_w = 192, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8651, .adv_w = 192, .box_w = 12, .box_h = 19, .ofs_x = 0, .ofs_y = -6},
+    {.bitmap_index = 8765, .adv_w = 192, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8843, .adv_w = 128, .box_w = 8, .box_h = 24, .ofs_x = 0, .ofs_y = -6},
+    {.bitmap_index = 8939, .adv_w = 100, .box_w = 3, .box_h = 24, .ofs_x = 2, .ofs_y = -6},
+    {.bitmap_index = 8975, .adv_w = 128, .box_w = 8, .box_h = 24, .ofs_x = 0, .ofs_y = -6},
+    {.bitmap_index = 9071, .adv_w = 224, .box_w = 12, .box_h = 5, .ofs_x = 1, .ofs_y = 6},
+    {.bitmap_index = 9101, .adv_w = 256, .box_w = 16, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9269, .adv_w = 256, .box_w = 16, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9437, .adv_w = 256, .box_w = 14, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 9591, .adv_w = 299, .box_w = 17, .box_h = 22, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 9778, .adv_w = 277, .box_w = 15, .box_h = 22, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 9943, .adv_w = 214, .box_w = 13, .box_h = 19, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 10067, .adv_w = 214, .box_w = 13, .box_h = 19, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 10191, .adv_w = 214, .box_w = 13, .box_h = 19, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 10315, .adv_w = 214, .box_w = 13, .box_h = 19, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 10439, .adv_w = 214, .box_w = 11, .box_h = 19, .ofs_x = 1, .ofs_y = -1}
+};
+
+static const lv_font_fmt_txt_dsc_t arial_24_dsc = {
+    .glyph_bitmap = arial_24_bitmap,
+    .glyph_dsc = arial_24_glyph_dsc,
+    .cmaps = ui_font_cmaps,
+    .kern_dsc = NULL,
+    .kern_scale = 0,
+    .cmap_num = UI_FONT_CMAP_NUM,
+    .bpp = 4,
+    .kern_classes = 0,
+    .bitmap_format = 0,
+};
+
+const lv_font_t Arial_24 = {
+    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
+    .line_height = 27,          /*The maximum line height required by the font*/
+    .base_line = 5,             /*Baseline measured from the bottom of the line*/
+    .subpx = LV_FONT_SUBPX_NONE,
+    .underline_position = -2,
+    .underline_thickness = 2,
+    .dsc = &arial_24_dsc,          /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
+    .fallback = &lv_font_montserrat_14,
+    .user_data = NULL,
+};
+
+/*-----------------
+ *  Arial_32
+ *----------------*/
+
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t arial_32_bitmap[] = {
+    /* U+0020 " " */
+    /* U+0021 "!" */
+    0x3d, 0xdd, 0x34, 0xff, 0xf4, 0x4f, 0xff, 0x44,
+    0xff, 0xf4, 0x4f, 0xff, 0x44, 0xff, 0xf4, 0x3e,
+    0xff, 0x32, 0xef, 0xe2, 0x2d, 0xfe, 0x11, 0xdf,
+    0xe0, 0xc, 0xfd, 0x0, 0xcf, 0xc0, 0xb, 0xfb,
+    0x0, 0xaf, 0xa0, 0x9, 0xf9, 0x0, 0x8f, 0x80,
+    0x7, 0xf7, 0x0, 0x25, 0x20, 0x0, 0x0, 0x1,
+    0x33, 0x30, 0x3e, 0xfe, 0x23, 0xef, 0xe2, 0x3e,
+    0xfe, 0x20,
+    /* U+0022 "\"" */
+    0x6b, 0xb7, 0x4, 0xbb, 0x90, 0x8f, 0xfa, 0x5,
+    0xff, 0xd1, 0x8f, 0xfa, 0x5, 0xff, 0xd1, 0x8f,
+    0xfa, 0x5, 0xff, 0xd1, 0x7f, 0xf9, 0x4, 0xff,
+    0xb0, 0x4f, 0xf7, 0x2, 0xef, 0x90, 0x2e, 0xf4,
+    0x1, 0xdf, 0x70, 0x1c, 0xf2, 0x0, 0xbf, 0x40,
+    0x4, 0x51, 0x0, 0x36, 0x10,
+    /* U+0023 "#" */
+    0x0, 0x0, 0x0, 0x35, 0x30, 0x0, 0x2, 0x55,
+    0x0, 0x0, 0x0, 0x0, 0xbf, 0x90, 0x0, 0x7,
+    0xfd, 0x0, 0x0, 0x0, 0x1, 0xef, 0x60, 0x0,
+    0xa, 0xfa, 0x0, 0x0, 0x0, 0x2, 0xff, 0x30,
+    0x0, 0x1c, 0xf7, 0x0, 0x0, 0x0, 0x5, 0xfd,
+    0x20, 0x0, 0x2e, 0xf4, 0x0, 0x0, 0x0, 0x8,
+    0xfc, 0x0, 0x0, 0x4f, 0xf2, 0x0, 0x0, 0x0,
+    0xb, 0xf9, 0x0, 0x0, 0x7f, 0xd1, 0x0, 0x57,
+    0x77, 0x7e, 0xfb, 0x77, 0x77, 0xcf, 0xd7, 0x73,
+    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf6, 0x8c, 0xcc, 0xef, 0xfc, 0xcc, 0xcd, 0xff,
+    0xdc, 0xc5, 0x0, 0x0, 0x8f, 0xc0, 0x0, 0x4,
+    0xfe, 0x20, 0x0, 0x0, 0x0, 0xcf, 0x90, 0x0,
+    0x8, 0xfc, 0x10, 0x0, 0x0, 0x1, 0xef, 0x60,
+    0x0, 0xa, 0xfa, 0x0, 0x0, 0x0, 0x3, 0xef,
+    0x30, 0x0, 0xe, 0xf6, 0x0, 0x0, 0x0, 0x6,
+    0xfe, 0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0, 0x7b,
+    0xbd, 0xfe, 0xbb, 0xbb, 0xcf, 0xfb, 0xbb, 0xb4,
+    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf6, 0x69, 0xaf, 0xfb, 0x99, 0x99, 0xef, 0xc9,
+    0x99, 0x93, 0x0, 0x3f, 0xf2, 0x0, 0x0, 0xef,
+    0x60, 0x0, 0x0, 0x0, 0x6f, 0xe0, 0x0, 0x3,
+    0xfe, 0x30, 0x0, 0x0, 0x0, 0xaf, 0xa0, 0x0,
+    0x6, 0xfe, 0x10, 0x0, 0x0, 0x1, 0xcf, 0x80,
+    0x0, 0x8, 0xfc, 0x0, 0x0, 0x0, 0x2, 0xef,
+    0x50, 0x0, 0xc, 0xf9, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0x20, 0x0, 0x1d, 0xf6, 0x0, 0x0, 0x0,
+    0x1, 0x43, 0x0, 0x0, 0x13, 0x41, 0x0, 0x0,
+    0x0,
+    /* U+0024 "$" */
+    0x0, 0x0, 0x0, 0x1, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2c, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x25, 0x8e, 0xc7, 0x30, 0x0, 0x0,
+    0x0, 0x19, 0xef, 0xff, 0xff, 0xeb, 0x30, 0x0,
+    0x1, 0xbf, 0xff, 0xdf, 0xee, 0xff, 0xe4, 0x0,
+    0x8, 0xff, 0xc3, 0x2e, 0x91, 0xaf, 0xfc, 0x10,
+    0x2d, 0xfe, 0x20, 0x2e, 0x90, 0x1c, 0xff, 0x50,
+    0x4f, 0xf9, 0x0, 0x2e, 0x90, 0x6, 0xff, 0x80,
+    0x5f, 0xf7, 0x0, 0x2e, 0x90, 0x1, 0x53, 0x10,
+    0x5f, 0xf8, 0x0, 0x2e, 0x90, 0x0, 0x0, 0x0,
+    0x2e, 0xfe, 0x10, 0x2e, 0x90, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xc3, 0x2e, 0x90, 0x0, 0x0, 0x0,
+    0x3, 0xdf, 0xfe, 0xcf, 0xb2, 0x0, 0x0, 0x0,
+    0x0, 0x3b, 0xff, 0xff, 0xfd, 0xa5, 0x10, 0x0,
+    0x0, 0x1, 0x4b, 0xef, 0xff, 0xff, 0xc3, 0x0,
+    0x0, 0x0, 0x0, 0x2e, 0xdc, 0xff, 0xfd, 0x20,
+    0x0, 0x0, 0x0, 0x2e, 0x90, 0x5d, 0xff, 0x90,
+    0x0, 0x0, 0x0, 0x2e, 0x90, 0x3, 0xef, 0xe0,
+    0x0, 0x0, 0x0, 0x2e, 0x90, 0x0, 0xbf, 0xf3,
+    0x6b, 0xc1, 0x0, 0x2e, 0x90, 0x0, 0x9f, 0xf4,
+    0xbf, 0xf4, 0x0, 0x2e, 0x90, 0x0, 0xaf, 0xf3,
+    0x8f, 0xfa, 0x0, 0x2e, 0x90, 0x2, 0xdf, 0xe1,
+    0x3e, 0xff, 0x50, 0x2e, 0x90, 0x19, 0xff, 0xa0,
+    0x8, 0xff, 0xe8, 0x5e, 0xa4, 0xbf, 0xfe, 0x20,
+    0x1, 0x9f, 0xff, 0xef, 0xff, 0xff, 0xe4, 0x0,
+    0x0, 0x5, 0xcf, 0xff, 0xff, 0xea, 0x20, 0x0,
+    0x0, 0x0, 0x1, 0x5e, 0xb3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2e, 0x90, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2e, 0x90, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0x20, 0x0, 0x0, 0x0,
+    /* U+0025 "%" */
+    0x0, 0x0, 0x35, 0x41, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x45, 0x20, 0x0, 0x0, 0x0, 0x2b, 0xef,
+    0xfd, 0x60, 0x0, 0x0, 0x0, 0x3, 0xef, 0x30,
+    0x0, 0x0, 0x1, 0xcf, 0xea, 0xcf, 0xf6, 0x0,
+    0x0, 0x0, 0x9, 0xfa, 0x0, 0x0, 0x0, 0x7,
+    0xfe, 0x20, 0x8, 0xfe, 0x10, 0x0, 0x0, 0x3e,
+    0xe2, 0x0, 0x0, 0x0, 0x1c, 0xf9, 0x0, 0x2,
+    0xef, 0x60, 0x0, 0x0, 0xaf, 0x90, 0x0, 0x0,
+    0x0, 0x2e, 0xf6, 0x0, 0x0, 0xdf, 0x80, 0x0,
+    0x3, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x2f, 0xf5,
+    0x0, 0x0, 0xcf, 0x90, 0x0, 0xa, 0xf9, 0x0,
+    0x0, 0x0, 0x0, 0x2e, 0xf5, 0x0, 0x0, 0xdf,
+    0x90, 0x0, 0x3f, 0xe2, 0x0, 0x0, 0x0, 0x0,
+    0x2d, 0xf6, 0x0, 0x1, 0xdf, 0x70, 0x0, 0xbf,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfa, 0x0,
+    0x4, 0xef, 0x40, 0x4, 0xfe, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xff, 0x61, 0x2b, 0xfc, 0x0,
+    0xb, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xfd, 0xef, 0xe3, 0x0, 0x5f, 0xe1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x17, 0xdf, 0xea,
+    0x20, 0x1, 0xbf, 0x70, 0x0, 0x0, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfd,
+    0x10, 0x2, 0xae, 0xfe, 0xa2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1c, 0xf7, 0x0, 0x2d, 0xfe,
+    0xde, 0xfd, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xd1, 0x0, 0x9f, 0xd4, 0x3, 0xcf, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0x60, 0x1,
+    0xef, 0x70, 0x0, 0x5f, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xfd, 0x10, 0x3, 0xff, 0x30, 0x0,
+    0x2e, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xf6,
+    0x0, 0x5, 0xff, 0x30, 0x0, 0x2d, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xc1, 0x0, 0x4, 0xff,
+    0x30, 0x0, 0x2d, 0xf7, 0x0, 0x0, 0x0, 0x1,
+    0xdf, 0x60, 0x0, 0x2, 0xff, 0x40, 0x0, 0x2e,
+    0xf5, 0x0, 0x0, 0x0, 0x7, 0xfc, 0x0, 0x0,
+    0x1, 0xdf, 0x80, 0x0, 0x6f, 0xf2, 0x0, 0x0,
+    0x0, 0x2d, 0xf5, 0x0, 0x0, 0x0, 0x8f, 0xe6,
+    0x25, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x8f, 0xc1,
+    0x0, 0x0, 0x0, 0x1b, 0xff, 0xef, 0xfc, 0x10,
+    0x0, 0x0, 0x1, 0xce, 0x40, 0x0, 0x0, 0x0,
+    0x1, 0x7c, 0xec, 0x71, 0x0,
+    /* U+0026 "&" */
+    0x0, 0x0, 0x0, 0x3, 0x44, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xce, 0xff, 0xeb,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
+    0xff, 0xff, 0xd3, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xff, 0xd5, 0x12, 0x9f, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0x60, 0x0, 0x1c, 0xff, 0x20,
+    0x0, 0x0, 0x0, 0xb, 0xfe, 0x30, 0x0, 0xa,
+    0xff, 0x30, 0x0, 0x0, 0x0, 0xa, 0xff, 0x60,
+    0x0, 0xb, 0xff, 0x20, 0x0, 0x0, 0x0, 0x6,
+    0xff, 0xd2, 0x0, 0x4f, 0xfc, 0x10, 0x0, 0x0,
+    0x0, 0x1, 0xdf, 0xfb, 0x15, 0xef, 0xe4, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xdf, 0xfe,
+    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0xff, 0xc4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7d, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1b, 0xff, 0xfe, 0xff, 0xd1, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xcf, 0xfd, 0x43, 0xef, 0xfb,
+    0x10, 0xa, 0x73, 0x0, 0xa, 0xff, 0xc1, 0x0,
+    0x5e, 0xff, 0x80, 0x3f, 0xfc, 0x10, 0x3f, 0xfe,
+    0x20, 0x0, 0x7, 0xff, 0xe5, 0x8f, 0xf9, 0x0,
+    0x7f, 0xf9, 0x0, 0x0, 0x0, 0xaf, 0xfe, 0xef,
+    0xe4, 0x0, 0x9f, 0xf7, 0x0, 0x0, 0x0, 0x1c,
+    0xff, 0xff, 0xb0, 0x0, 0x9f, 0xf8, 0x0, 0x0,
+    0x0, 0x3, 0xef, 0xff, 0x40, 0x0, 0x5f, 0xfd,
+    0x10, 0x0, 0x0, 0x1, 0xcf, 0xff, 0x90, 0x0,
+    0x1d, 0xff, 0x80, 0x0, 0x0, 0x2a, 0xff, 0xff,
+    0xf7, 0x0, 0x6, 0xff, 0xf9, 0x32, 0x37, 0xdf,
+    0xfd, 0xbf, 0xff, 0x81, 0x0, 0x8f, 0xff, 0xee,
+    0xef, 0xff, 0xc3, 0x1b, 0xff, 0xf5, 0x0, 0x5,
+    0xdf, 0xff, 0xff, 0xe8, 0x10, 0x1, 0xaf, 0x91,
+    0x0, 0x0, 0x3, 0x67, 0x64, 0x0, 0x0, 0x0,
+    0x5, 0x10,
+    /* U+0027 "'" */
+    0x6b, 0xb6, 0x9f, 0xf9, 0x9f, 0xf9, 0x9f, 0xf9,
+    0x8f, 0xf8, 0x5f, 0xf6, 0x3f, 0xf3, 0x2e, 0xe1,
+    0x5, 0x50,
+    /* U+0028 "(" */
+    0x0, 0x0, 0x0, 0x13, 0x10, 0x0, 0x0, 0x1c,
+    0xd3, 0x0, 0x0, 0x9, 0xf9, 0x0, 0x0, 0x4,
+    0xfd, 0x20, 0x0, 0x1, 0xcf, 0x80, 0x0, 0x0,
+    0x6f, 0xe2, 0x0, 0x0, 0x1d, 0xf9, 0x0, 0x0,
+    0x5, 0xff, 0x40, 0x0, 0x0, 0xbf, 0xe0, 0x0,
+    0x0, 0x3e, 0xfa, 0x0, 0x0, 0x6, 0xff, 0x60,
+    0x0, 0x0, 0x9f, 0xf3, 0x0, 0x0, 0xb, 0xff,
+    0x10, 0x0, 0x1, 0xdf, 0xe0, 0x0, 0x0, 0x2d,
+    0xfd, 0x0, 0x0, 0x2, 0xef, 0xc0, 0x0, 0x0,
+    0x2e, 0xfd, 0x0, 0x0, 0x1, 0xdf, 0xd0, 0x0,
+    0x0, 0x1c, 0xff, 0x0, 0x0, 0x0, 0xbf, 0xf2,
+    0x0, 0x0, 0x8, 0xff, 0x40, 0x0, 0x0, 0x5f,
+    0xf7, 0x0, 0x0, 0x2, 0xdf, 0xb0, 0x0, 0x0,
+    0xa, 0xfe, 0x10, 0x0, 0x0, 0x4f, 0xf6, 0x0,
+    0x0, 0x0, 0xcf, 0xb0, 0x0, 0x0, 0x4, 0xfe,
+    0x30, 0x0, 0x0, 0xb, 0xf9, 0x0, 0x0, 0x0,
+    0x3e, 0xe3, 0x0, 0x0, 0x0, 0x8f, 0xa0, 0x0,
+    0x0, 0x1, 0xad, 0x30,
+    /* U+0029 ")" */
+    0x2, 0x20, 0x0, 0x0, 0x0, 0x9e, 0x50, 0x0,
+    0x0, 0x3, 0xee, 0x20, 0x0, 0x0, 0x9, 0xfa,
+    0x0, 0x0, 0x0, 0x2e, 0xf5, 0x0, 0x0, 0x0,
+    0x9f, 0xc1, 0x0, 0x0, 0x3, 0xff, 0x50, 0x0,
+    0x0, 0xc, 0xfb, 0x0, 0x0, 0x0, 0x7f, 0xe3,
+    0x0, 0x0, 0x3, 0xff, 0x80, 0x0, 0x0, 0x1e,
+    0xfc, 0x10, 0x0, 0x0, 0xbf, 0xe2, 0x0, 0x0,
+    0x9, 0xff, 0x30, 0x0, 0x0, 0x8f, 0xf5, 0x0,
+    0x0, 0x7, 0xff, 0x70, 0x0, 0x0, 0x6f, 0xf7,
+    0x0, 0x0, 0x6, 0xff, 0x70, 0x0, 0x0, 0x7f,
+    0xf6, 0x0, 0x0, 0x8, 0xff, 0x50, 0x0, 0x0,
+    0xaf, 0xf3, 0x0, 0x0, 0xc, 0xfd, 0x10, 0x0,
+    0x1, 0xff, 0xb0, 0x0, 0x0, 0x5f, 0xf6, 0x0,
+    0x0, 0x9, 0xfe, 0x20, 0x0, 0x0, 0xef, 0xa0,
+    0x0, 0x0, 0x5f, 0xe4, 0x0, 0x0, 0xb, 0xfa,
+    0x0, 0x0, 0x4, 0xef, 0x30, 0x0, 0x0, 0xaf,
+    0x90, 0x0, 0x0, 0x4f, 0xd1, 0x0, 0x0, 0x1a,
+    0xd4, 0x0, 0x0, 0x0,
+    /* U+002A "*" */
+    0x0, 0x0, 0x55, 0x10, 0x0, 0x0, 0x0, 0xe,
+    0xf4, 0x0, 0x0, 0x0, 0x0, 0xde, 0x30, 0x0,
+    0x6, 0xa4, 0x1c, 0xe2, 0x38, 0xa0, 0xbf, 0xfc,
+    0xde, 0xbf, 0xff, 0x25, 0xac, 0xef, 0xff, 0xdb,
+    0x71, 0x0, 0x1a, 0xff, 0xd3, 0x0, 0x0, 0x7,
+    0xfd, 0xaf, 0xb1, 0x0, 0x5, 0xef, 0x42, 0xdf,
+    0x90, 0x0, 0x4d, 0xa0, 0x6, 0xe8, 0x0, 0x0,
+    0x21, 0x0, 0x3, 0x0, 0x0,
+    /* U+002B "+" */
+    0x0, 0x0, 0x0, 0x1a, 0xb7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2d, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2d, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2d, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2d, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2d, 0xfa, 0x0, 0x0, 0x0,
+    0x2a, 0xaa, 0xaa, 0xbe, 0xfe, 0xaa, 0xaa, 0xa9,
+    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0x3e, 0xee, 0xee, 0xef, 0xff, 0xee, 0xee, 0xed,
+    0x0, 0x0, 0x0, 0x2d, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2d, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2d, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2d, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2d, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2d, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x15, 0x53, 0x0, 0x0, 0x0,
+    /* U+002C "," */
+    0x13, 0x33, 0x3, 0xef, 0xe1, 0x3e, 0xfe, 0x13,
+    0xef, 0xe1, 0x0, 0x9e, 0x10, 0xc, 0xd0, 0x5,
+    0xe9, 0x2, 0xdc, 0x10, 0x4, 0x10, 0x0,
+    /* U+002D "-" */
+    0x19, 0xaa, 0xaa, 0xaa, 0xa6, 0x1e, 0xff, 0xff,
+    0xff, 0xfa, 0x1e, 0xff, 0xff, 0xff, 0xfa, 0x2,
+    0x22, 0x22, 0x22, 0x21,
+    /* U+002E "." */
+    0x13, 0x33, 0x3, 0xef, 0xe2, 0x3e, 0xfe, 0x23,
+    0xef, 0xe2,
+    /* U+002F "/" */
+    0x0, 0x0, 0x0, 0x13, 0x20, 0x0, 0x0, 0x8,
+    0xea, 0x0, 0x0, 0x0, 0xcf, 0x70, 0x0, 0x0,
+    0x2f, 0xe3, 0x0, 0x0, 0x6, 0xfc, 0x10, 0x0,
+    0x0, 0xaf, 0x90, 0x0, 0x0, 0xe, 0xf5, 0x0,
+    0x0, 0x3, 0xfe, 0x20, 0x0, 0x0, 0x8f, 0xb0,
+    0x0, 0x0, 0xc, 0xf7, 0x0, 0x0, 0x2, 0xef,
+    0x30, 0x0, 0x0, 0x5f, 0xe0, 0x0, 0x0, 0x9,
+    0xfa, 0x0, 0x0, 0x1, 0xdf, 0x50, 0x0, 0x0,
+    0x3f, 0xf1, 0x0, 0x0, 0x7, 0xfc, 0x0, 0x0,
+    0x0, 0xbf, 0x80, 0x0, 0x0, 0x2e, 0xf3, 0x0,
+    0x0, 0x5, 0xfd, 0x10, 0x0, 0x0, 0x9f, 0xa0,
+    0x0, 0x0, 0x1d, 0xf6, 0x0, 0x0, 0x3, 0xfe,
+    0x20, 0x0, 0x0, 0x7f, 0xc1, 0x0, 0x0, 0xb,
+    0xf8, 0x0, 0x0, 0x0, 0x67, 0x20, 0x0, 0x0,
+    0x0,
+    /* U+0030 "0" */
+    0x0, 0x0, 0x27, 0xbd, 0xca, 0x51, 0x0, 0x0,
+    0x0, 0x5, 0xef, 0xff, 0xff, 0xfc, 0x20, 0x0,
+    0x0, 0x6f, 0xfe, 0xb7, 0x8d, 0xff, 0xd2, 0x0,
+    0x2, 0xdf, 0xe5, 0x0, 0x1, 0xaf, 0xf9, 0x0,
+    0x8, 0xff, 0x70, 0x0, 0x0, 0x1c, 0xfe, 0x20,
+    0x1c, 0xfe, 0x10, 0x0, 0x0, 0x6, 0xff, 0x70,
+    0x3f, 0xfb, 0x0, 0x0, 0x0, 0x2, 0xef, 0xb0,
+    0x5f, 0xf8, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xf0,
+    0x8f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf1,
+    0x9f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf3,
+    0x9f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf4,
+    0xaf, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf4,
+    0xaf, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf4,
+    0x9f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf3,
+    0x8f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf2,
+    0x7f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf1,
+    0x4f, 0xf8, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xd0,
+    0x2e, 0xfc, 0x0, 0x0, 0x0, 0x3, 0xff, 0xa0,
+    0xb, 0xff, 0x20, 0x0, 0x0, 0x8, 0xff, 0x50,
+    0x5, 0xff, 0xa1, 0x0, 0x0, 0x3e, 0xfd, 0x10,
+    0x1, 0xbf, 0xfa, 0x20, 0x15, 0xdf, 0xf6, 0x0,
+    0x0, 0x3d, 0xff, 0xed, 0xdf, 0xff, 0x80, 0x0,
+    0x0, 0x2, 0xaf, 0xff, 0xff, 0xe6, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0x57, 0x64, 0x0, 0x0, 0x0,
+    /* U+0031 "1" */
+    0x0, 0x0, 0x0, 0x1, 0x10, 0x0, 0x0, 0x3,
+    0xdc, 0x0, 0x0, 0x1, 0xcf, 0xd0, 0x0, 0x1,
+    0xaf, 0xfd, 0x0, 0x2, 0xbf, 0xff, 0xd0, 0x5,
+    0xdf, 0xff, 0xfd, 0x3b, 0xff, 0xfa, 0xef, 0xd8,
+    0xff, 0xe6, 0x1d, 0xfd, 0x8e, 0x91, 0x0, 0xdf,
+    0xd3, 0x20, 0x0, 0xd, 0xfd, 0x0, 0x0, 0x0,
+    0xdf, 0xd0, 0x0, 0x0, 0xd, 0xfd, 0x0, 0x0,
+    0x0, 0xdf, 0xd0, 0x0, 0x0, 0xd, 0xfd, 0x0,
+    0x0, 0x0, 0xdf, 0xd0, 0x0, 0x0, 0xd, 0xfd,
+    0x0, 0x0, 0x0, 0xdf, 0xd0, 0x0, 0x0, 0xd,
+    0xfd, 0x0, 0x0, 0x0, 0xdf, 0xd0, 0x0, 0x0,
+    0xd, 0xfd, 0x0, 0x0, 0x0, 0xdf, 0xd0, 0x0,
+    0x0, 0xd, 0xfd, 0x0, 0x0, 0x0, 0xdf, 0xd0,
+    0x0, 0x0, 0xd, 0xfd,
+    /* U+0032 "2" */
+    0x0, 0x0, 0x4, 0x9c, 0xdd, 0xb8, 0x30, 0x0,
+    0x0, 0x0, 0x2b, 0xff, 0xff, 0xff, 0xfe, 0x91,
+    0x0, 0x0, 0x2c, 0xff, 0xe9, 0x77, 0xbe, 0xff,
+    0xa0, 0x0, 0x8, 0xff, 0xb2, 0x0, 0x0, 0x4d,
+    0xff, 0x50, 0x2, 0xef, 0xe1, 0x0, 0x0, 0x0,
+    0x5f, 0xfc, 0x0, 0x4f, 0xf9, 0x0, 0x0, 0x0,
+    0x1, 0xdf, 0xf0, 0x5, 0xce, 0x70, 0x0, 0x0,
+    0x0, 0x1c, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xdf, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2d, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1b, 0xff, 0xb1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1a, 0xff, 0xd2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1b, 0xff, 0xd3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2b, 0xff, 0xd3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4d, 0xff, 0xc2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5e, 0xff, 0xb1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6e, 0xff, 0x91, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6e, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4e, 0xfe, 0x60, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1c, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0xfb, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xbb, 0x11, 0xcf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf1, 0x1e, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x10,
+    /* U+0033 "3" */
+    0x0, 0x0, 0x49, 0xcd, 0xc9, 0x40, 0x0, 0x0,
+    0x0, 0x1a, 0xff, 0xff, 0xff, 0xfb, 0x20, 0x0,
+    0x1, 0xbf, 0xfd, 0x97, 0x8d, 0xff, 0xd2, 0x0,
+    0x7, 0xff, 0xb2, 0x0, 0x1, 0xaf, 0xf9, 0x0,
+    0x1d, 0xfe, 0x20, 0x0, 0x0, 0x2d, 0xfe, 0x10,
+    0x3f, 0xfa, 0x0, 0x0, 0x0, 0xa, 0xff, 0x30,
+    0x2, 0x53, 0x0, 0x0, 0x0, 0xa, 0xff, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xfe, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xaf, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x35, 0x8d, 0xff, 0xa1, 0x0,
+    0x0, 0x0, 0x1, 0xdf, 0xff, 0xfa, 0x10, 0x0,
+    0x0, 0x0, 0x2, 0xed, 0xef, 0xff, 0xc4, 0x0,
+    0x0, 0x0, 0x0, 0x10, 0x2, 0xaf, 0xfe, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xdf, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf4,
+    0x13, 0x51, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf5,
+    0x8f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf3,
+    0x5f, 0xfb, 0x0, 0x0, 0x0, 0x3, 0xef, 0xe0,
+    0x1d, 0xff, 0x50, 0x0, 0x0, 0x1b, 0xff, 0x80,
+    0x6, 0xff, 0xe7, 0x21, 0x14, 0xcf, 0xfc, 0x10,
+    0x0, 0x8f, 0xff, 0xed, 0xdf, 0xff, 0xc3, 0x0,
+    0x0, 0x5, 0xcf, 0xff, 0xff, 0xe8, 0x10, 0x0,
+    0x0, 0x0, 0x3, 0x67, 0x64, 0x10, 0x0, 0x0,
+    /* U+0034 "4" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6d, 0xc3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xfe, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xe3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xfe,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x4, 0xef, 0xef,
+    0xe3, 0x0, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xbb,
+    0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xe2,
+    0xaf, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf6,
+    0xa, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x2e, 0xf9,
+    0x0, 0xaf, 0xe3, 0x0, 0x0, 0x0, 0x1b, 0xfd,
+    0x20, 0xa, 0xfe, 0x30, 0x0, 0x0, 0x7, 0xff,
+    0x40, 0x0, 0xaf, 0xe3, 0x0, 0x0, 0x3, 0xef,
+    0x90, 0x0, 0xa, 0xfe, 0x30, 0x0, 0x1, 0xcf,
+    0xc1, 0x0, 0x0, 0xaf, 0xe3, 0x0, 0x0, 0x9f,
+    0xe3, 0x0, 0x0, 0xa, 0xfe, 0x30, 0x0, 0x4f,
+    0xf9, 0x22, 0x22, 0x22, 0xbf, 0xe5, 0x22, 0x19,
+    0xff, 0xee, 0xee, 0xee, 0xef, 0xff, 0xee, 0xe3,
+    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x44, 0x88, 0x88, 0x88, 0x88, 0x8d, 0xff, 0x98,
+    0x82, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xe3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfe,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xe3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xe3, 0x0, 0x0,
+    /* U+0035 "5" */
+    0x0, 0x5, 0x66, 0x66, 0x66, 0x66, 0x66, 0x30,
+    0x0, 0x3e, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,
+    0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,
+    0x0, 0x8f, 0xf7, 0x44, 0x44, 0x44, 0x44, 0x20,
+    0x0, 0xbf, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xdf, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xef, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0x70, 0x1, 0x11, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0x57, 0xce, 0xfe, 0xb6, 0x10, 0x0,
+    0xa, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xb2, 0x0,
+    0x1c, 0xff, 0xfc, 0x86, 0x7b, 0xff, 0xfc, 0x10,
+    0x2e, 0xff, 0x71, 0x0, 0x0, 0x4e, 0xff, 0x80,
+    0x15, 0x76, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf7,
+    0x1, 0x21, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf6,
+    0x8e, 0xe6, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf3,
+    0x6f, 0xfb, 0x0, 0x0, 0x0, 0x3, 0xef, 0xe0,
+    0x2e, 0xff, 0x50, 0x0, 0x0, 0x1b, 0xff, 0x70,
+    0x7, 0xff, 0xe7, 0x20, 0x14, 0xcf, 0xfb, 0x10,
+    0x0, 0x9f, 0xff, 0xed, 0xdf, 0xff, 0xc2, 0x0,
+    0x0, 0x5, 0xdf, 0xff, 0xff, 0xe8, 0x10, 0x0,
+    0x0, 0x0, 0x3, 0x67, 0x64, 0x10, 0x0, 0x0,
+    /* U+0036 "6" */
+    0x0, 0x0, 0x5, 0x9c, 0xdc, 0x83, 0x0, 0x0,
+    0x0, 0x2, 0xcf, 0xff, 0xff, 0xff, 0x91, 0x0,
+    0x0, 0x3e, 0xff, 0xc8, 0x7a, 0xef, 0xf9, 0x0,
+    0x1, 0xcf, 0xf8, 0x10, 0x0, 0x4d, 0xff, 0x40,
+    0x6, 0xff, 0x90, 0x0, 0x0, 0x6, 0xff, 0x90,
+    0x1c, 0xfe, 0x10, 0x0, 0x0, 0x2, 0xcd, 0xa0,
+    0x2e, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x11, 0x0,
+    0x6f, 0xf5, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0,
+    0x8f, 0xf3, 0x2, 0x7a, 0xcb, 0x83, 0x0, 0x0,
+    0xaf, 0xf2, 0x7e, 0xff, 0xff, 0xfe, 0x70, 0x0,
+    0xbf, 0xe8, 0xff, 0xda, 0xad, 0xff, 0xf8, 0x0,
+    0xbf, 0xff, 0xf7, 0x10, 0x1, 0x7f, 0xff, 0x40,
+    0xbf, 0xff, 0x60, 0x0, 0x0, 0x7, 0xff, 0xb0,
+    0xbf, 0xfc, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xf1,
+    0xaf, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf4,
+    0x9f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf5,
+    0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf4,
+    0x3f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf2,
+    0x1c, 0xff, 0x20, 0x0, 0x0, 0x3, 0xef, 0xd0,
+    0x7, 0xff, 0xb1, 0x0, 0x0, 0x1a, 0xff, 0x70,
+    0x1, 0xcf, 0xfb, 0x41, 0x13, 0xaf, 0xfc, 0x10,
+    0x0, 0x2c, 0xff, 0xed, 0xde, 0xff, 0xd3, 0x0,
+    0x0, 0x1, 0x8e, 0xff, 0xff, 0xf9, 0x20, 0x0,
+    0x0, 0x0, 0x1, 0x46, 0x75, 0x10, 0x0, 0x0,
+    /* U+0037 "7" */
+    0x36, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x62,
+    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
+    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
+    0x35, 0x55, 0x55, 0x55, 0x55, 0x5b, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xfd, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xe4, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4f, 0xfc, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xcf, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1c, 0xff, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xbf, 0xf4, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0xff, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2f, 0xfc, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xaf, 0xf4, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xe2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x44, 0x20, 0x0, 0x0, 0x0, 0x0,
+    /* U+0038 "8" */
+    0x0, 0x0, 0x38, 0xbd, 0xca, 0x61, 0x0, 0x0,
+    0x0, 0x8, 0xef, 0xff, 0xff, 0xfd, 0x40, 0x0,
+    0x0, 0x8f, 0xfe, 0xa7, 0x8c, 0xff, 0xe3, 0x0,
+    0x3, 0xef, 0xe4, 0x0, 0x0, 0x9f, 0xfb, 0x10,
+    0x8, 0xff, 0x70, 0x0, 0x0, 0x1c, 0xff, 0x30,
+    0xb, 0xff, 0x20, 0x0, 0x0, 0x8, 0xff, 0x60,
+    0xb, 0xff, 0x20, 0x0, 0x0, 0x7, 0xff, 0x70,
+    0x9, 0xff, 0x60, 0x0, 0x0, 0xb, 0xff, 0x40,
+    0x3, 0xef, 0xd2, 0x0, 0x0, 0x5f, 0xfc, 0x10,
+    0x0, 0x6e, 0xfd, 0x84, 0x59, 0xff, 0xd4, 0x0,
+    0x0, 0x3, 0xdf, 0xff, 0xff, 0xfb, 0x20, 0x0,
+    0x0, 0x5c, 0xff, 0xff, 0xff, 0xfe, 0x81, 0x0,
+    0x6, 0xef, 0xf9, 0x31, 0x15, 0xcf, 0xfb, 0x10,
+    0x2d, 0xff, 0x60, 0x0, 0x0, 0x1a, 0xff, 0x90,
+    0x6f, 0xfa, 0x0, 0x0, 0x0, 0x2, 0xdf, 0xe1,
+    0x9f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf4,
+    0xaf, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf6,
+    0x9f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf5,
+    0x6f, 0xf9, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xf2,
+    0x2e, 0xff, 0x40, 0x0, 0x0, 0x7, 0xff, 0xb0,
+    0x7, 0xff, 0xe7, 0x20, 0x13, 0x9f, 0xfe, 0x30,
+    0x0, 0x8f, 0xff, 0xed, 0xde, 0xff, 0xe5, 0x0,
+    0x0, 0x5, 0xcf, 0xff, 0xff, 0xfa, 0x30, 0x0,
+    0x0, 0x0, 0x2, 0x57, 0x75, 0x10, 0x0, 0x0,
+    /* U+0039 "9" */
+    0x0, 0x0, 0x49, 0xcd, 0xc9, 0x40, 0x0, 0x0,
+    0x0, 0x1a, 0xff, 0xff, 0xff, 0xfa, 0x10, 0x0,
+    0x1, 0xbf, 0xfe, 0xb7, 0x8c, 0xff, 0xd2, 0x0,
+    0x8, 0xff, 0xe4, 0x0, 0x0, 0x7f, 0xfb, 0x0,
+    0x2e, 0xff, 0x40, 0x0, 0x0, 0x9, 0xff, 0x40,
+    0x6f, 0xfa, 0x0, 0x0, 0x0, 0x3, 0xef, 0xa0,
+    0x9f, 0xf6, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xe0,
+    0xaf, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf2,
+    0xaf, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf4,
+    0x8f, 0xf6, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xf5,
+    0x5f, 0xfc, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf6,
+    0x1d, 0xff, 0x80, 0x0, 0x0, 0x2d, 0xff, 0xf6,
+    0x6, 0xff, 0xfa, 0x41, 0x26, 0xdf, 0xdf, 0xf5,
+    0x0, 0x8f, 0xff, 0xff, 0xff, 0xf9, 0x7f, 0xf5,
+    0x0, 0x6, 0xcf, 0xff, 0xfd, 0x61, 0x8f, 0xf3,
+    0x0, 0x0, 0x14, 0x66, 0x41, 0x0, 0xaf, 0xf1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xd0,
+    0x3, 0x53, 0x0, 0x0, 0x0, 0x3, 0xff, 0x90,
+    0x2f, 0xfa, 0x0, 0x0, 0x0, 0x9, 0xff, 0x40,
+    0x1c, 0xff, 0x30, 0x0, 0x0, 0x5f, 0xfc, 0x10,
+    0x6, 0xff, 0xd4, 0x10, 0x27, 0xef, 0xe4, 0x0,
+    0x1, 0x9f, 0xfe, 0xdd, 0xef, 0xfe, 0x50, 0x0,
+    0x0, 0x7, 0xef, 0xff, 0xff, 0xb3, 0x0, 0x0,
+    0x0, 0x0, 0x14, 0x67, 0x52, 0x0, 0x0, 0x0,
+    /* U+003A ":" */
+    0x16, 0x77, 0x13, 0xef, 0xe2, 0x3e, 0xfe, 0x22,
+    0xab, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x33, 0x30, 0x3e, 0xfe, 0x23, 0xef, 0xe2,
+    0x3e, 0xfe, 0x20,
+    /* U+003B ";" */
+    0x17, 0x77, 0x13, 0xef, 0xe1, 0x3e, 0xfe, 0x12,
+    0xbb, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x33, 0x30, 0x3e, 0xfe, 0x13, 0xef, 0xe1,
+    0x3e, 0xfe, 0x10, 0x9, 0xe1, 0x0, 0xcd, 0x0,
+    0x5e, 0x90, 0x2d, 0xc1, 0x0, 0x41, 0x0,
+    /* U+003C "<" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x6b,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x8d, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xbe, 0xff, 0xfd,
+    0x0, 0x0, 0x0, 0x27, 0xdf, 0xff, 0xfc, 0x61,
+    0x0, 0x0, 0x39, 0xef, 0xff, 0xd9, 0x40, 0x0,
+    0x1, 0x5b, 0xff, 0xff, 0xc6, 0x20, 0x0, 0x0,
+    0x2d, 0xff, 0xfe, 0xa4, 0x10, 0x0, 0x0, 0x0,
+    0x3f, 0xff, 0x82, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xff, 0xe9, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xbe, 0xff, 0xfc, 0x61, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0x9e, 0xff, 0xfd, 0x83, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0x7c, 0xff, 0xfe, 0xb5, 0x10,
+    0x0, 0x0, 0x0, 0x1, 0x5b, 0xff, 0xff, 0xd7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x39, 0xef, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x17, 0xcd,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    /* U+003D "=" */
+    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0x29, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x21,
+    0x3e, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed,
+    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0x29, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x98,
+    /* U+003E ">" */
+    0x3a, 0x41, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xfc, 0x61, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xff, 0xfe, 0x82, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0x8d, 0xff, 0xff, 0xb5, 0x10, 0x0, 0x0,
+    0x0, 0x1, 0x5b, 0xef, 0xff, 0xd7, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x39, 0xdf, 0xff, 0xe9, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0x26, 0xcf, 0xff, 0xeb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x13, 0xbf, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x5b, 0xff, 0xfd,
+    0x0, 0x0, 0x0, 0x2, 0x7d, 0xff, 0xfe, 0x93,
+    0x0, 0x0, 0x14, 0xae, 0xff, 0xfc, 0x72, 0x0,
+    0x0, 0x27, 0xcf, 0xff, 0xfb, 0x51, 0x0, 0x0,
+    0x19, 0xef, 0xff, 0xe9, 0x30, 0x0, 0x0, 0x0,
+    0x3f, 0xff, 0xd7, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x3e, 0xb5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x13, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    /* U+003F "?" */
+    0x0, 0x0, 0x2, 0x45, 0x43, 0x10, 0x0, 0x0,
+    0x0, 0x3, 0xae, 0xff, 0xfe, 0xd8, 0x20, 0x0,
+    0x0, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x0,
+    0x4, 0xef, 0xfa, 0x31, 0x15, 0xcf, 0xfe, 0x20,
+    0x1b, 0xff, 0x80, 0x0, 0x0, 0x1b, 0xff, 0xa0,
+    0x3f, 0xfd, 0x10, 0x0, 0x0, 0x3, 0xef, 0xf0,
+    0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf2,
+    0x37, 0x83, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xdf, 0xe0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1a, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x9f, 0xfc, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x1a, 0xff, 0xd3, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xaf, 0xfd, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0xc2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3e, 0xfe, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9f, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x35, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x23, 0x31, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xbf, 0xf6, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xcf, 0xf6, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xcf, 0xf6, 0x0, 0x0, 0x0,
+    /* U+0040 "@" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x13, 0x44,
+    0x44, 0x31, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x16, 0xbd, 0xef, 0xff,
+    0xfe, 0xdb, 0x61, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x7e, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xe8, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xdf, 0xfe, 0xb7, 0x41, 0x0, 0x13,
+    0x6b, 0xef, 0xfd, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xef, 0xfa, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xae, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x4,
+    0xef, 0xd5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5e, 0xfd, 0x20, 0x0, 0x0, 0x1, 0xdf,
+    0xd3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4e, 0xfa, 0x0, 0x0, 0x0, 0xaf, 0xe3,
+    0x0, 0x0, 0x16, 0xbd, 0xd9, 0x20, 0x7, 0x75,
+    0x0, 0x6f, 0xf4, 0x0, 0x0, 0x4e, 0xf6, 0x0,
+    0x0, 0x4d, 0xff, 0xff, 0xfe, 0x63, 0xff, 0xa0,
+    0x0, 0xcf, 0xb0, 0x0, 0xb, 0xfc, 0x0, 0x0,
+    0x4e, 0xff, 0xb7, 0x7b, 0xfe, 0x9f, 0xf6, 0x0,
+    0x5, 0xfe, 0x20, 0x3, 0xef, 0x50, 0x0, 0x2e,
+    0xfe, 0x60, 0x0, 0x18, 0xff, 0xff, 0x40, 0x0,
+    0x2e, 0xf5, 0x0, 0x7f, 0xd0, 0x0, 0xa, 0xff,
+    0x70, 0x0, 0x0, 0x1c, 0xff, 0xd1, 0x0, 0x1,
+    0xcf, 0x70, 0xb, 0xf9, 0x0, 0x4, 0xef, 0xc1,
+    0x0, 0x0, 0x0, 0x8f, 0xfc, 0x0, 0x0, 0xb,
+    0xf8, 0x1, 0xdf, 0x60, 0x0, 0xaf, 0xf5, 0x0,
+    0x0, 0x0, 0x6, 0xff, 0x80, 0x0, 0x1, 0xbf,
+    0x80, 0x2f, 0xf3, 0x0, 0x1d, 0xfe, 0x10, 0x0,
+    0x0, 0x0, 0x6f, 0xf5, 0x0, 0x0, 0x1d, 0xf7,
+    0x3, 0xff, 0x20, 0x3, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0x8, 0xfe, 0x20, 0x0, 0x3, 0xff, 0x40,
+    0x3f, 0xf2, 0x0, 0x4f, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0xbf, 0xe0, 0x0, 0x0, 0x8f, 0xd1, 0x3,
+    0xff, 0x20, 0x4, 0xff, 0x90, 0x0, 0x0, 0x0,
+    0x3e, 0xfa, 0x0, 0x0, 0x1e, 0xf9, 0x0, 0x3f,
+    0xf3, 0x0, 0x3f, 0xfb, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0x70, 0x0, 0xa, 0xfe, 0x30, 0x2, 0xef,
+    0x50, 0x1, 0xdf, 0xe1, 0x0, 0x0, 0x5, 0xff,
+    0xf4, 0x0, 0x7, 0xff, 0x70, 0x0, 0x1c, 0xf9,
+    0x0, 0x9, 0xff, 0x90, 0x0, 0x5, 0xef, 0xff,
+    0x30, 0x29, 0xff, 0xa0, 0x0, 0x0, 0x8f, 0xe1,
+    0x0, 0x2d, 0xff, 0xa5, 0x5a, 0xfd, 0xef, 0xfc,
+    0x9d, 0xff, 0xa1, 0x0, 0x0, 0x4, 0xef, 0x60,
+    0x0, 0x4e, 0xff, 0xff, 0xfc, 0x3a, 0xff, 0xff,
+    0xfe, 0x81, 0x0, 0x0, 0x0, 0xb, 0xfd, 0x10,
+    0x0, 0x2a, 0xef, 0xd7, 0x10, 0x2a, 0xff, 0xd9,
+    0x30, 0x0, 0x35, 0x51, 0x0, 0x4e, 0xfa, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4e, 0xfc, 0x10, 0x0, 0x8f, 0xfa, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4e, 0xfe, 0x30, 0x0, 0x0, 0x9f, 0xfc, 0x51,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x8e,
+    0xfe, 0x40, 0x0, 0x0, 0x1, 0x8f, 0xff, 0xc6,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x38, 0xdf, 0xfd,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x4c, 0xff, 0xfe,
+    0xda, 0x87, 0x77, 0x8a, 0xde, 0xff, 0xf9, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xbe, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0x93, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x15, 0x7a,
+    0xcd, 0xdd, 0xca, 0x85, 0x10, 0x0, 0x0, 0x0,
+    0x0,
+    /* U+0041 "A" */
+    0x0, 0x0, 0x0, 0x0, 0x6d, 0xdc, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xef, 0xef, 0xd2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0x8f, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d,
+    0xfc, 0x2f, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5f, 0xf8, 0xb, 0xff, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf3, 0x6,
+    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xff, 0xc1, 0x1, 0xef, 0xe2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0x70, 0x0, 0x9f, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xfe, 0x30,
+    0x0, 0x4f, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xfb, 0x0, 0x0, 0x1c, 0xff, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x9f, 0xf6, 0x0, 0x0, 0x7,
+    0xff, 0xa0, 0x0, 0x0, 0x0, 0x2, 0xef, 0xd2,
+    0x0, 0x0, 0x3, 0xef, 0xe2, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0xc5, 0x55, 0x55, 0x55, 0xdf, 0xf7,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfd, 0x10, 0x0, 0x0, 0x3e, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0,
+    0x0, 0x8f, 0xf9, 0x22, 0x22, 0x22, 0x22, 0x29,
+    0xff, 0xb0, 0x0, 0x1, 0xdf, 0xf3, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xff, 0xe3, 0x0, 0x5, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf8,
+    0x0, 0xa, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xfd, 0x10, 0x2e, 0xfe, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0x50, 0x7f,
+    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0xff, 0xb0, 0xdf, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0xf3,
+    /* U+0042 "B" */
+    0x8c, 0xcc, 0xcc, 0xcc, 0xcc, 0xb9, 0x51, 0x0,
+    0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
+    0x40, 0x0, 0xaf, 0xfe, 0xdd, 0xdd, 0xdd, 0xef,
+    0xff, 0xf4, 0x0, 0xaf, 0xf6, 0x0, 0x0, 0x0,
+    0x24, 0xbf, 0xfc, 0x10, 0xaf, 0xf6, 0x0, 0x0,
+    0x0, 0x0, 0x1d, 0xff, 0x40, 0xaf, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0x70, 0xaf, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x70, 0xaf,
+    0xf6, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0x40,
+    0xaf, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xfc,
+    0x10, 0xaf, 0xf8, 0x44, 0x44, 0x44, 0x69, 0xef,
+    0xd3, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfd, 0x30, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0xa2, 0x0, 0xaf, 0xfa, 0x77, 0x77,
+    0x77, 0x8a, 0xef, 0xfd, 0x30, 0xaf, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x2a, 0xff, 0xc1, 0xaf, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xf5, 0xaf,
+    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf8,
+    0xaf, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xfa, 0xaf, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xf8, 0xaf, 0xf6, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xff, 0xf4, 0xaf, 0xf6, 0x0, 0x0, 0x0,
+    0x1, 0x4d, 0xff, 0xc1, 0xaf, 0xfc, 0xbb, 0xbb,
+    0xbb, 0xbc, 0xff, 0xfe, 0x40, 0xaf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xd5, 0x0, 0xaf, 0xff,
+    0xff, 0xff, 0xff, 0xfd, 0xa6, 0x10, 0x0,
+    /* U+0043 "C" */
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x23, 0x21, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x7c, 0xde,
+    0xee, 0xdb, 0x50, 0x0, 0x0, 0x0, 0x0, 0x18,
+    0xef, 0xff, 0xff, 0xff, 0xff, 0xc3, 0x0, 0x0,
+    0x0, 0x2c, 0xff, 0xfd, 0x97, 0x78, 0xbe, 0xff,
+    0xe4, 0x0, 0x0, 0x1c, 0xff, 0xd6, 0x10, 0x0,
+    0x0, 0x3c, 0xff, 0xd2, 0x0, 0x9, 0xff, 0xd3,
+    0x0, 0x0, 0x0, 0x0, 0x2c, 0xff, 0x90, 0x3,
+    0xef, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xff, 0x20, 0x8f, 0xfa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xbe, 0xb3, 0x1c, 0xff, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x2, 0xff,
+    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xfd, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1c, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xb8, 0x30, 0x9f, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9f, 0xf9, 0x4, 0xff, 0xe2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0x40,
+    0xb, 0xff, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x1a,
+    0xff, 0xc0, 0x0, 0x3e, 0xff, 0xb2, 0x0, 0x0,
+    0x0, 0x2a, 0xff, 0xe4, 0x0, 0x0, 0x5f, 0xff,
+    0xe9, 0x53, 0x34, 0x8d, 0xff, 0xe7, 0x0, 0x0,
+    0x0, 0x5e, 0xff, 0xff, 0xee, 0xff, 0xff, 0xe6,
+    0x0, 0x0, 0x0, 0x0, 0x28, 0xef, 0xff, 0xff,
+    0xff, 0xa2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x35, 0x67, 0x64, 0x10, 0x0, 0x0, 0x0,
+    /* U+0044 "D" */
+    0x7c, 0xcc, 0xcc, 0xcc, 0xcc, 0xba, 0x73, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xa2, 0x0, 0x0, 0x8f, 0xfe, 0xdd, 0xdd,
+    0xdd, 0xee, 0xff, 0xfe, 0x40, 0x0, 0x8f, 0xf7,
+    0x0, 0x0, 0x0, 0x13, 0x8e, 0xff, 0xd3, 0x0,
+    0x8f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x3, 0xdf,
+    0xfb, 0x10, 0x8f, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4e, 0xff, 0x40, 0x8f, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0xa0, 0x8f, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xe0,
+    0x8f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xdf, 0xf2, 0x8f, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xcf, 0xf5, 0x8f, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xbf, 0xf6, 0x8f, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf6,
+    0x8f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0xf6, 0x8f, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xcf, 0xf4, 0x8f, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xdf, 0xf2, 0x8f, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xe0,
+    0x8f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xa0, 0x8f, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2e, 0xff, 0x40, 0x8f, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xcf, 0xfb, 0x10, 0x8f, 0xf7,
+    0x0, 0x0, 0x0, 0x2, 0x5c, 0xff, 0xe3, 0x0,
+    0x8f, 0xfd, 0xbb, 0xbb, 0xbb, 0xcd, 0xff, 0xfe,
+    0x50, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xc4, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
+    0xff, 0xec, 0x94, 0x10, 0x0, 0x0,
+    /* U+0045 "E" */
+    0x6c, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xc2, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xe2, 0x7f, 0xfe, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xdd, 0xdd, 0xd2, 0x7f, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xfa, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x10, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0x40, 0x7f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x40, 0x7f, 0xfc, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x20, 0x7f, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xfd, 0xbb, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xb7, 0x7f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
+    /* U+0046 "F" */
+    0x5d, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdc,
+    0x26, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xe2, 0x6f, 0xfe, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xdc, 0x26, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xfa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xff, 0xa0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xfa, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xb4, 0x44,
+    0x44, 0x44, 0x44, 0x41, 0x0, 0x6f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x60, 0x6, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x6f, 0xfc,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x30, 0x6, 0xff,
+    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
+    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xfa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xff, 0xa0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4c, 0xc8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0,
+    /* U+0047 "G" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x23, 0x32, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x16, 0xad,
+    0xee, 0xee, 0xdb, 0x61, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x50,
+    0x0, 0x0, 0x0, 0x9f, 0xff, 0xec, 0x87, 0x78,
+    0xbe, 0xff, 0xf7, 0x0, 0x0, 0x9, 0xff, 0xf9,
+    0x30, 0x0, 0x0, 0x3, 0xaf, 0xff, 0x40, 0x0,
+    0x5f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xb0, 0x1, 0xcf, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xdf, 0xf3, 0x5, 0xff, 0xd1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xe5,
+    0xa, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x24, 0x0, 0x1d, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xfe,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3f, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4f, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0x56, 0x66, 0x66, 0x66, 0x66, 0x4f,
+    0xfd, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff,
+    0xff, 0xfd, 0x3f, 0xfe, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0xff, 0xff, 0xff, 0xfd, 0x2e, 0xff, 0x20,
+    0x0, 0x0, 0x0, 0x34, 0x44, 0x44, 0x6e, 0xfd,
+    0x1b, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2e, 0xfd, 0x7, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2e, 0xfd, 0x2, 0xdf,
+    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e,
+    0xfd, 0x0, 0x7f, 0xfe, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5f, 0xfd, 0x0, 0x1b, 0xff, 0xe8,
+    0x20, 0x0, 0x0, 0x1, 0x3a, 0xff, 0xfd, 0x0,
+    0x1, 0xbf, 0xff, 0xea, 0x74, 0x45, 0x8c, 0xff,
+    0xff, 0xc4, 0x0, 0x0, 0x18, 0xef, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xe8, 0x10, 0x0, 0x0, 0x0,
+    0x28, 0xdf, 0xff, 0xff, 0xff, 0xc7, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0x56, 0x76, 0x41,
+    0x0, 0x0, 0x0,
+    /* U+0048 "H" */
+    0x5d, 0xd7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0xdd, 0x77, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xf8, 0x7f, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0x87, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xf8, 0x7f, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0x87,
+    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xf8, 0x7f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0x87, 0xff, 0x90, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xf8, 0x7f, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0x87, 0xff, 0xa4,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0xaf, 0xf8, 0x7f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x87, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf8, 0x7f, 0xfc, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x7b, 0xff, 0x87, 0xff, 0x90, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xf8, 0x7f, 0xf9, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0x87, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf8,
+    0x7f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0x87, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xf8, 0x7f, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0x87, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xf8, 0x7f, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0x87,
+    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xf8, 0x7f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0x80,
+    /* U+0049 "I" */
+    0x2b, 0xdc, 0x12, 0xdf, 0xe1, 0x2d, 0xfe, 0x12,
+    0xdf, 0xe1, 0x2d, 0xfe, 0x12, 0xdf, 0xe1, 0x2d,
+    0xfe, 0x12, 0xdf, 0xe1, 0x2d, 0xfe, 0x12, 0xdf,
+    0xe1, 0x2d, 0xfe, 0x12, 0xdf, 0xe1, 0x2d, 0xfe,
+    0x12, 0xdf, 0xe1, 0x2d, 0xfe, 0x12, 0xdf, 0xe1,
+    0x2d, 0xfe, 0x12, 0xdf, 0xe1, 0x2d, 0xfe, 0x12,
+    0xdf, 0xe1, 0x2d, 0xfe, 0x12, 0xdf, 0xe1, 0x2d,
+    0xfe, 0x10,
+    /* U+004A "J" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7d, 0xd7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf8,
+    0x18, 0xa8, 0x0, 0x0, 0x0, 0x8f, 0xf7, 0x1e,
+    0xfb, 0x0, 0x0, 0x0, 0x9f, 0xf6, 0x1d, 0xfe,
+    0x10, 0x0, 0x0, 0xbf, 0xf4, 0xa, 0xff, 0x70,
+    0x0, 0x4, 0xff, 0xe2, 0x5, 0xff, 0xe9, 0x54,
+    0x8e, 0xff, 0xa0, 0x1, 0xaf, 0xff, 0xff, 0xff,
+    0xfd, 0x20, 0x0, 0x18, 0xef, 0xff, 0xff, 0xa2,
+    0x0, 0x0, 0x0, 0x15, 0x67, 0x51, 0x0, 0x0,
+    /* U+004B "K" */
+    0x9d, 0xd5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8d,
+    0xdd, 0x50, 0xaf, 0xf6, 0x0, 0x0, 0x0, 0x0,
+    0x9, 0xff, 0xf7, 0x0, 0xaf, 0xf6, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xfe, 0x70, 0x0, 0xaf, 0xf6,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0xe6, 0x0, 0x0,
+    0xaf, 0xf6, 0x0, 0x0, 0x0, 0x8f, 0xfe, 0x60,
+    0x0, 0x0, 0xaf, 0xf6, 0x0, 0x0, 0x9, 0xff,
+    0xe5, 0x0, 0x0, 0x0, 0xaf, 0xf6, 0x0, 0x0,
+    0x9f, 0xfe, 0x50, 0x0, 0x0, 0x0, 0xaf, 0xf6,
+    0x0, 0x19, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xf6, 0x1, 0x9f, 0xfe, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0xaf, 0xf6, 0x19, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xf6, 0x9f, 0xff,
+    0xfd, 0x20, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xfd,
+    0xff, 0xdd, 0xff, 0xb1, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xff, 0xfd, 0x33, 0xef, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0xaf, 0xff, 0xd2, 0x0, 0x6f, 0xfe,
+    0x50, 0x0, 0x0, 0x0, 0xaf, 0xfc, 0x20, 0x0,
+    0xb, 0xff, 0xd2, 0x0, 0x0, 0x0, 0xaf, 0xf6,
+    0x0, 0x0, 0x2, 0xdf, 0xfb, 0x0, 0x0, 0x0,
+    0xaf, 0xf6, 0x0, 0x0, 0x0, 0x5f, 0xff, 0x70,
+    0x0, 0x0, 0xaf, 0xf6, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xe4, 0x0, 0x0, 0xaf, 0xf6, 0x0, 0x0,
+    0x0, 0x1, 0xcf, 0xfd, 0x20, 0x0, 0xaf, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0x4e, 0xff, 0xa1, 0x0,
+    0xaf, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0xf7, 0x0, 0xaf, 0xf6, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xbf, 0xfe, 0x40, 0xaf, 0xf6, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2e, 0xff, 0xd1,
+    /* U+004C "L" */
+    0x9d, 0xd5, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
+    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0x60,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0x60, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xf6, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0xff, 0x60, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xf6, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xa, 0xff, 0x60, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xaf, 0xf6, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xa, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
+    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xfc,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x7a, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfa, 0xaf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xa0,
+    /* U+004D "M" */
+    0x8d, 0xdd, 0xc2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xcd, 0xdd, 0x39, 0xff, 0xff, 0x60, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf3, 0x9f,
+    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0xff, 0xff, 0x39, 0xff, 0xff, 0xe2, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xdf, 0xff, 0xf3, 0x9f, 0xfa,
+    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xfc,
+    0xff, 0x39, 0xff, 0x6e, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xfb, 0xbf, 0xf3, 0x9f, 0xf5, 0xaf,
+    0xe2, 0x0, 0x0, 0x0, 0x2, 0xef, 0x6a, 0xff,
+    0x39, 0xff, 0x55, 0xff, 0x60, 0x0, 0x0, 0x0,
+    0x6f, 0xe2, 0xaf, 0xf3, 0x9f, 0xf5, 0x2e, 0xfb,
+    0x0, 0x0, 0x0, 0xb, 0xfa, 0xa, 0xff, 0x39,
+    0xff, 0x50, 0xaf, 0xf1, 0x0, 0x0, 0x2, 0xef,
+    0x50, 0xaf, 0xf3, 0x9f, 0xf5, 0x5, 0xff, 0x60,
+    0x0, 0x0, 0x6f, 0xd2, 0xa, 0xff, 0x39, 0xff,
+    0x50, 0x2d, 0xfb, 0x0, 0x0, 0xb, 0xfa, 0x0,
+    0xaf, 0xf3, 0x9f, 0xf5, 0x0, 0xaf, 0xf1, 0x0,
+    0x2, 0xff, 0x50, 0xa, 0xff, 0x39, 0xff, 0x50,
+    0x5, 0xff, 0x60, 0x0, 0x7f, 0xd1, 0x0, 0xaf,
+    0xf3, 0x9f, 0xf5, 0x0, 0x1d, 0xfb, 0x0, 0xc,
+    0xf9, 0x0, 0xa, 0xff, 0x39, 0xff, 0x50, 0x0,
+    0xaf, 0xe2, 0x3, 0xef, 0x40, 0x0, 0xaf, 0xf3,
+    0x9f, 0xf5, 0x0, 0x5, 0xff, 0x60, 0x7f, 0xd1,
+    0x0, 0xa, 0xff, 0x39, 0xff, 0x50, 0x0, 0x1e,
+    0xfb, 0xc, 0xf9, 0x0, 0x0, 0xaf, 0xf3, 0x9f,
+    0xf5, 0x0, 0x0, 0x9f, 0xe5, 0xef, 0x30, 0x0,
+    0xa, 0xff, 0x39, 0xff, 0x50, 0x0, 0x4, 0xff,
+    0xcf, 0xd0, 0x0, 0x0, 0xaf, 0xf3, 0x9f, 0xf5,
+    0x0, 0x0, 0x1d, 0xff, 0xf8, 0x0, 0x0, 0xa,
+    0xff, 0x39, 0xff, 0x50, 0x0, 0x0, 0x9f, 0xff,
+    0x30, 0x0, 0x0, 0xaf, 0xf3, 0x9f, 0xf5, 0x0,
+    0x0, 0x4, 0xff, 0xc1, 0x0, 0x0, 0xa, 0xff,
+    0x30,
+    /* U+004E "N" */
+    0x7d, 0xda, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xdd, 0x68, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xf8, 0x8f, 0xff, 0xe3, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xff, 0x88, 0xff, 0xff, 0xb1,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xf8, 0x8f, 0xff,
+    0xff, 0x70, 0x0, 0x0, 0x0, 0x6, 0xff, 0x88,
+    0xff, 0xbf, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x6f,
+    0xf8, 0x8f, 0xf6, 0xaf, 0xfb, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0x88, 0xff, 0x52, 0xdf, 0xf7, 0x0,
+    0x0, 0x0, 0x6f, 0xf8, 0x8f, 0xf5, 0x6, 0xff,
+    0xe3, 0x0, 0x0, 0x6, 0xff, 0x88, 0xff, 0x50,
+    0xa, 0xff, 0xc1, 0x0, 0x0, 0x6f, 0xf8, 0x8f,
+    0xf5, 0x0, 0x2d, 0xff, 0x70, 0x0, 0x6, 0xff,
+    0x88, 0xff, 0x50, 0x0, 0x6f, 0xfe, 0x30, 0x0,
+    0x6f, 0xf8, 0x8f, 0xf5, 0x0, 0x0, 0xaf, 0xfb,
+    0x10, 0x6, 0xff, 0x88, 0xff, 0x50, 0x0, 0x1,
+    0xdf, 0xf7, 0x0, 0x6f, 0xf8, 0x8f, 0xf5, 0x0,
+    0x0, 0x5, 0xff, 0xe3, 0x6, 0xff, 0x88, 0xff,
+    0x50, 0x0, 0x0, 0xa, 0xff, 0xc1, 0x6f, 0xf8,
+    0x8f, 0xf5, 0x0, 0x0, 0x0, 0x2d, 0xff, 0x76,
+    0xff, 0x88, 0xff, 0x50, 0x0, 0x0, 0x0, 0x5f,
+    0xfe, 0xaf, 0xf8, 0x8f, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0xff, 0xff, 0x88, 0xff, 0x50, 0x0,
+    0x0, 0x0, 0x2, 0xdf, 0xff, 0xf8, 0x8f, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x88,
+    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xf8, 0x8f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1d, 0xff, 0x80,
+    /* U+004F "O" */
+    0x0, 0x0, 0x0, 0x0, 0x2, 0x33, 0x31, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x7c,
+    0xee, 0xee, 0xdc, 0x72, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xef, 0xff, 0xff, 0xff, 0xff, 0xe7,
+    0x10, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xfe, 0xa7,
+    0x77, 0xae, 0xff, 0xfa, 0x10, 0x0, 0x0, 0x1b,
+    0xff, 0xe8, 0x20, 0x0, 0x0, 0x28, 0xef, 0xfb,
+    0x10, 0x0, 0x8, 0xff, 0xd4, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xef, 0xf7, 0x0, 0x3, 0xef, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xe2,
+    0x0, 0x8f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1b, 0xff, 0x80, 0x1c, 0xff, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xfd, 0x2,
+    0xef, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xef, 0xe3, 0x4f, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0x56, 0xff,
+    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0xf6, 0x7f, 0xfa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0xff, 0x66, 0xff, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
+    0xf6, 0x5f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0xff, 0x53, 0xff, 0xe0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xe3,
+    0x1d, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xfd, 0x10, 0x9f, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0x90, 0x3,
+    0xef, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xef, 0xf4, 0x0, 0xa, 0xff, 0xc2, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xcf, 0xfa, 0x0, 0x0, 0x2d,
+    0xff, 0xc4, 0x0, 0x0, 0x0, 0x4, 0xdf, 0xfd,
+    0x20, 0x0, 0x0, 0x3d, 0xff, 0xea, 0x54, 0x34,
+    0x6a, 0xef, 0xfd, 0x30, 0x0, 0x0, 0x0, 0x2b,
+    0xff, 0xff, 0xfe, 0xff, 0xff, 0xfb, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x15, 0xbf, 0xff, 0xff, 0xff,
+    0xb5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x14, 0x67, 0x64, 0x10, 0x0, 0x0, 0x0, 0x0,
+    /* U+0050 "P" */
+    0x7c, 0xcc, 0xcc, 0xcc, 0xcc, 0xcb, 0x96, 0x10,
+    0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0x60, 0x0, 0x8f, 0xfe, 0xdd, 0xdd, 0xdd,
+    0xde, 0xef, 0xff, 0x70, 0x8, 0xff, 0x70, 0x0,
+    0x0, 0x0, 0x14, 0xbf, 0xfe, 0x30, 0x8f, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xf8, 0x8,
+    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
+    0xc1, 0x8f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xfd, 0x18, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xd1, 0x8f, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xfb, 0x8, 0xff, 0x70,
+    0x0, 0x0, 0x0, 0x0, 0x1d, 0xff, 0x70, 0x8f,
+    0xf7, 0x0, 0x0, 0x0, 0x2, 0x5c, 0xff, 0xd2,
+    0x8, 0xff, 0xed, 0xdd, 0xdd, 0xdd, 0xef, 0xff,
+    0xf6, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xd5, 0x0, 0x8, 0xff, 0xed, 0xdd, 0xdd,
+    0xdc, 0xb9, 0x51, 0x0, 0x0, 0x8f, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0x44, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0,
+    /* U+0051 "Q" */
+    0x0, 0x0, 0x0, 0x0, 0x2, 0x33, 0x31, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x8c,
+    0xee, 0xee, 0xdb, 0x61, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x19, 0xef, 0xff, 0xff, 0xff, 0xff, 0xd5,
+    0x0, 0x0, 0x0, 0x0, 0x2d, 0xff, 0xfd, 0xa7,
+    0x78, 0xbe, 0xff, 0xf9, 0x10, 0x0, 0x0, 0x2c,
+    0xff, 0xd6, 0x10, 0x0, 0x0, 0x29, 0xff, 0xf9,
+    0x0, 0x0, 0xa, 0xff, 0xc3, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xf5, 0x0, 0x4, 0xef, 0xe3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xd1,
+    0x0, 0xaf, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1d, 0xff, 0x50, 0x2e, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xfa, 0x4,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0xd1, 0x7f, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1e, 0xfe, 0x39, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0xf4, 0x9f, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xd, 0xff, 0x49, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
+    0xf4, 0x8f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1e, 0xfe, 0x35, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xef, 0xe2,
+    0x2e, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xfc, 0x1, 0xbf, 0xf6, 0x0, 0x0,
+    0x0, 0x2, 0x0, 0x0, 0xb, 0xff, 0x70, 0x5,
+    0xff, 0xd1, 0x0, 0x0, 0x2, 0xeb, 0x50, 0x5,
+    0xff, 0xe2, 0x0, 0x1b, 0xff, 0xb1, 0x0, 0x0,
+    0x6f, 0xff, 0xb5, 0xef, 0xf8, 0x0, 0x0, 0x3e,
+    0xff, 0xb3, 0x0, 0x1, 0x5b, 0xff, 0xff, 0xfc,
+    0x10, 0x0, 0x0, 0x4e, 0xff, 0xe9, 0x53, 0x34,
+    0x7e, 0xff, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x3c,
+    0xff, 0xff, 0xee, 0xff, 0xff, 0xff, 0xfd, 0x50,
+    0x0, 0x0, 0x0, 0x16, 0xcf, 0xff, 0xff, 0xff,
+    0xa4, 0x7e, 0xff, 0xc4, 0x0, 0x0, 0x0, 0x0,
+    0x25, 0x67, 0x64, 0x10, 0x0, 0x3b, 0xff, 0x60,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0x91,
+    /* U+0052 "R" */
+    0x6d, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xca, 0x73,
+    0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xe8, 0x10, 0x0, 0x8f, 0xfd, 0xaa,
+    0xaa, 0xaa, 0xab, 0xce, 0xff, 0xf8, 0x0, 0x8,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x3b, 0xff,
+    0xe3, 0x0, 0x8f, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1c, 0xff, 0x80, 0x8, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xfb, 0x0, 0x8f,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0xc0, 0x8, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xfb, 0x0, 0x8f, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1d, 0xff, 0x70, 0x8, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x1, 0x4b, 0xff, 0xd2,
+    0x0, 0x8f, 0xfd, 0xaa, 0xaa, 0xaa, 0xab, 0xde,
+    0xff, 0xe5, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xb4, 0x0, 0x0, 0x8f, 0xff,
+    0xee, 0xee, 0xef, 0xff, 0xd7, 0x30, 0x0, 0x0,
+    0x8, 0xff, 0x80, 0x0, 0x1, 0x5d, 0xff, 0xa1,
+    0x0, 0x0, 0x0, 0x8f, 0xf8, 0x0, 0x0, 0x0,
+    0x2c, 0xff, 0xc2, 0x0, 0x0, 0x8, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x3d, 0xff, 0xa1, 0x0, 0x0,
+    0x8f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
+    0x70, 0x0, 0x8, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0xfe, 0x30, 0x0, 0x8f, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xef, 0xfb, 0x10, 0x8,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
+    0xf7, 0x0, 0x8f, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0xe2, 0x8, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xb0, 0x8f,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0x60,
+    /* U+0053 "S" */
+    0x0, 0x0, 0x0, 0x2, 0x34, 0x42, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0x8d, 0xee, 0xfe, 0xec,
+    0x82, 0x0, 0x0, 0x0, 0x7, 0xef, 0xff, 0xff,
+    0xff, 0xff, 0xe6, 0x0, 0x0, 0x7, 0xff, 0xfd,
+    0x97, 0x67, 0xad, 0xff, 0xf7, 0x0, 0x2, 0xef,
+    0xf7, 0x10, 0x0, 0x0, 0x19, 0xff, 0xe3, 0x0,
+    0x7f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
+    0x90, 0xa, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xfc, 0x10, 0xaf, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xcb, 0x81, 0x7, 0xff, 0xb1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0xff,
+    0xc6, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xfe, 0xb8, 0x42, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6e, 0xff, 0xff, 0xff, 0xeb, 0x72,
+    0x0, 0x0, 0x0, 0x0, 0x27, 0xcf, 0xff, 0xff,
+    0xff, 0xe9, 0x10, 0x0, 0x0, 0x0, 0x0, 0x26,
+    0x9d, 0xff, 0xff, 0xfc, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0x7c, 0xff, 0xfb, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf4,
+    0x36, 0x73, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0x87, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xfa, 0x4f, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0x92, 0xdf, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xbf, 0xf5, 0x7, 0xff,
+    0xf8, 0x20, 0x0, 0x0, 0x1, 0x8f, 0xfc, 0x10,
+    0x1b, 0xff, 0xfd, 0x96, 0x44, 0x59, 0xdf, 0xfe,
+    0x50, 0x0, 0x1a, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0x50, 0x0, 0x0, 0x5, 0xbf, 0xff, 0xff,
+    0xff, 0xe9, 0x20, 0x0, 0x0, 0x0, 0x0, 0x14,
+    0x67, 0x76, 0x30, 0x0, 0x0, 0x0,
+    /* U+0054 "T" */
+    0x3c, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xa1, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xc1, 0x3d, 0xdd, 0xdd, 0xdd,
+    0xff, 0xfe, 0xdd, 0xdd, 0xdd, 0xb1, 0x0, 0x0,
+    0x0, 0x0, 0xbf, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xbf, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xbf, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xbf, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xbf, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xbf, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xbf, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xbf, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xbf, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xbf, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    /* U+0055 "U" */
+    0x6d, 0xd7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xdd, 0x78, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xf8, 0x8f, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0x88, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xf8, 0x8f, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0x88,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xf8, 0x8f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0x88, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xf8, 0x8f, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0x88, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf8, 0x8f,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0x88, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xf8, 0x8f, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0x87, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xf8, 0x7f, 0xf9, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0x86, 0xff,
+    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf7,
+    0x4f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0x52, 0xef, 0xe1, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xef, 0xf2, 0xc, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xfc, 0x10, 0x6f, 0xfe, 0x61,
+    0x0, 0x0, 0x0, 0x5e, 0xff, 0x70, 0x1, 0xbf,
+    0xff, 0xc7, 0x54, 0x57, 0xbf, 0xff, 0xb1, 0x0,
+    0x2, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb2,
+    0x0, 0x0, 0x1, 0x7d, 0xff, 0xff, 0xff, 0xfd,
+    0x60, 0x0, 0x0, 0x0, 0x0, 0x2, 0x56, 0x76,
+    0x52, 0x0, 0x0, 0x0,
+    /* U+0056 "V" */
+    0x9d, 0xd7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xdd, 0xb5, 0xff, 0xd1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xf8, 0x1d, 0xff, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xff, 0x30,
+    0x8f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0xb1, 0x3, 0xff, 0xe1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xf6, 0x0, 0xb, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x1e, 0xfd, 0x20, 0x0,
+    0x6f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0x90, 0x0, 0x2, 0xdf, 0xe2, 0x0, 0x0, 0x0,
+    0x0, 0xbf, 0xe4, 0x0, 0x0, 0x9, 0xff, 0x60,
+    0x0, 0x0, 0x0, 0x3e, 0xfc, 0x0, 0x0, 0x0,
+    0x4e, 0xfc, 0x0, 0x0, 0x0, 0x7, 0xff, 0x60,
+    0x0, 0x0, 0x0, 0xcf, 0xe3, 0x0, 0x0, 0x1,
+    0xcf, 0xe2, 0x0, 0x0, 0x0, 0x7, 0xff, 0x70,
+    0x0, 0x0, 0x4f, 0xfa, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xfc, 0x10, 0x0, 0x9, 0xff, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xf4, 0x0, 0x1, 0xdf,
+    0xd0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x90,
+    0x0, 0x5f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1d, 0xfd, 0x10, 0xa, 0xfe, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xf4, 0x2, 0xef, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0x90,
+    0x7f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xa, 0xfe, 0x1c, 0xfc, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xf6, 0xff, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xef,
+    0xe3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3e, 0xff, 0x50, 0x0, 0x0,
+    0x0, 0x0,
+    /* U+0057 "W" */
+    0x6d, 0xd8, 0x0, 0x0, 0x0, 0x0, 0xa, 0xdd,
+    0xc2, 0x0, 0x0, 0x0, 0x0, 0x4d, 0xd9, 0x4f,
+    0xfc, 0x10, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xf7, 0x1e, 0xfe,
+    0x20, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0xcf, 0xf3, 0xa, 0xff, 0x40,
+    0x0, 0x0, 0x0, 0x9f, 0xdc, 0xfd, 0x10, 0x0,
+    0x0, 0x1, 0xef, 0xd1, 0x7, 0xff, 0x80, 0x0,
+    0x0, 0x1, 0xcf, 0xa7, 0xff, 0x40, 0x0, 0x0,
+    0x4, 0xff, 0xa0, 0x3, 0xff, 0xb0, 0x0, 0x0,
+    0x3, 0xff, 0x73, 0xff, 0x80, 0x0, 0x0, 0x8,
+    0xff, 0x60, 0x1, 0xdf, 0xe0, 0x0, 0x0, 0x7,
+    0xff, 0x30, 0xef, 0xb0, 0x0, 0x0, 0xb, 0xfe,
+    0x20, 0x0, 0xaf, 0xf3, 0x0, 0x0, 0xb, 0xfc,
+    0x10, 0xaf, 0xe2, 0x0, 0x0, 0x1e, 0xfc, 0x0,
+    0x0, 0x6f, 0xf7, 0x0, 0x0, 0x1f, 0xf9, 0x0,
+    0x6f, 0xf5, 0x0, 0x0, 0x4f, 0xf8, 0x0, 0x0,
+    0x3e, 0xfa, 0x0, 0x0, 0x5f, 0xf5, 0x0, 0x2f,
+    0xfa, 0x0, 0x0, 0x7f, 0xf4, 0x0, 0x0, 0x1c,
+    0xfd, 0x0, 0x0, 0x9f, 0xe2, 0x0, 0x1c, 0xfd,
+    0x10, 0x0, 0xbf, 0xe1, 0x0, 0x0, 0x9, 0xff,
+    0x30, 0x0, 0xdf, 0xc0, 0x0, 0x8, 0xff, 0x30,
+    0x2, 0xdf, 0xb0, 0x0, 0x0, 0x5, 0xff, 0x60,
+    0x3, 0xff, 0x70, 0x0, 0x4, 0xff, 0x70, 0x4,
+    0xff, 0x70, 0x0, 0x0, 0x2, 0xef, 0x90, 0x6,
+    0xff, 0x40, 0x0, 0x2, 0xdf, 0xb0, 0x7, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0xcf, 0xc0, 0xb, 0xfd,
+    0x10, 0x0, 0x0, 0xbf, 0xe1, 0xb, 0xfd, 0x10,
+    0x0, 0x0, 0x0, 0x8f, 0xe2, 0x1d, 0xfa, 0x0,
+    0x0, 0x0, 0x7f, 0xf4, 0x1d, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xf5, 0x4f, 0xf6, 0x0, 0x0,
+    0x0, 0x3e, 0xf7, 0x3f, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x1e, 0xf8, 0x7f, 0xf2, 0x0, 0x0, 0x0,
+    0x1c, 0xfa, 0x7f, 0xe2, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xfb, 0xbf, 0xc0, 0x0, 0x0, 0x0, 0x9,
+    0xfd, 0xaf, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xfe, 0xef, 0x80, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0xdf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0xff, 0x40, 0x0, 0x0, 0x0, 0x2, 0xef, 0xff,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xfe,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xfd, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xfb, 0x0, 0x0,
+    0x0,
+    /* U+0058 "X" */
+    0x6, 0xdd, 0xc2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2c, 0xdc, 0x30, 0x1c, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0xff, 0x80, 0x0, 0x3e, 0xff,
+    0x70, 0x0, 0x0, 0x0, 0x8, 0xff, 0xb1, 0x0,
+    0x0, 0x7f, 0xfe, 0x30, 0x0, 0x0, 0x5, 0xff,
+    0xd2, 0x0, 0x0, 0x1, 0xaf, 0xfc, 0x10, 0x0,
+    0x3, 0xdf, 0xf5, 0x0, 0x0, 0x0, 0x2, 0xdf,
+    0xf8, 0x0, 0x1, 0xbf, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0xf4, 0x0, 0x8f, 0xfc, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xd1, 0x5f,
+    0xfd, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1c,
+    0xff, 0xae, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3e, 0xff, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xb1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0xfc, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xdf, 0xff, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xbf, 0xfb, 0xff, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xfc,
+    0x19, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xfe, 0x40, 0x1c, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0x2d, 0xff, 0x70, 0x0, 0x4e, 0xff,
+    0x70, 0x0, 0x0, 0x0, 0xb, 0xff, 0xb1, 0x0,
+    0x0, 0x8f, 0xfe, 0x40, 0x0, 0x0, 0x8, 0xff,
+    0xd2, 0x0, 0x0, 0x1, 0xbf, 0xfc, 0x10, 0x0,
+    0x5, 0xef, 0xf5, 0x0, 0x0, 0x0, 0x3, 0xef,
+    0xf9, 0x0, 0x2, 0xdf, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xff, 0xf5, 0x0, 0xbf, 0xfc, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xd2, 0x7f,
+    0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d,
+    0xff, 0xb0,
+    /* U+0059 "Y" */
+    0x8d, 0xdc, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9, 0xdd, 0xa2, 0xdf, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xe3, 0x5, 0xff, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xf7, 0x0,
+    0xa, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xfb, 0x10, 0x0, 0x2d, 0xff, 0x90, 0x0, 0x0,
+    0x0, 0x5f, 0xfd, 0x20, 0x0, 0x0, 0x5f, 0xfe,
+    0x50, 0x0, 0x0, 0x2d, 0xff, 0x60, 0x0, 0x0,
+    0x0, 0xaf, 0xfd, 0x10, 0x0, 0x9, 0xff, 0xa0,
+    0x0, 0x0, 0x0, 0x1, 0xdf, 0xf9, 0x0, 0x5,
+    0xff, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0xe4, 0x1, 0xdf, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9, 0xff, 0xc1, 0x8f, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2d, 0xff, 0x8e, 0xfc,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
+    0xff, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xef, 0xe1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e,
+    0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xef, 0xe1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2e, 0xfe, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef,
+    0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2e, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xef, 0xe1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xfe,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xef, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2e, 0xfe, 0x10, 0x0, 0x0,
+    0x0, 0x0,
+    /* U+005A "Z" */
+    0x1, 0xbc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0x50, 0x2e, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf6, 0x2, 0xcd, 0xdd, 0xdd, 0xdd,
+    0xdd, 0xdd, 0xef, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1b, 0xff, 0xc1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1a, 0xff, 0xd3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xf4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xef, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xdf, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xbf, 0xfd, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xfe, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0x60, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xff,
+    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b,
+    0xff, 0xc2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xef, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xdf, 0xfa, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xbf, 0xfb, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
+    0xcb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x85,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfb, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xb0,
+    /* U+005B "[" */
+    0x1a, 0xdd, 0xdd, 0xd5, 0x1c, 0xff, 0xff, 0xf6,
+    0x1c, 0xff, 0x77, 0x73, 0x1c, 0xff, 0x0, 0x0,
+    0x1c, 0xff, 0x0, 0x0, 0x1c, 0xff, 0x0, 0x0,
+    0x1c, 0xff, 0x0, 0x0, 0x1c, 0xff, 0x0, 0x0,
+    0x1c, 0xff, 0x0, 0x0, 0x1c, 0xff, 0x0, 0x0,
+    0x1c, 0xff, 0x0, 0x0, 0x1c, 0xff, 0x0, 0x0,
+    0x1c, 0xff, 0x0, 0x0, 0x1c, 0xff, 0x0, 0x0,
+    0x1c, 0xff, 0x0, 0x0, 0x1c, 0xff, 0x0, 0x0,
+    0x1c, 0xff, 0x0, 0x0, 0x1c, 0xff, 0x0, 0x0,
+    0x1c, 0xff, 0x0, 0x0, 0x1c, 0xff, 0x0, 0x0,
+    0x1c, 0xff, 0x0, 0x0, 0x1c, 0xff, 0x0, 0x0,
+    0x1c, 0xff, 0x0, 0x0, 0x1c, 0xff, 0x0, 0x0,
+    0x1c, 0xff, 0x0, 0x0, 0x1c, 0xff, 0x0, 0x0,
+    0x1c, 0xff, 0x10, 0x0, 0x1c, 0xff, 0xdd, 0xd5,
+    0x1c, 0xff, 0xff, 0xf6, 0x5, 0x66, 0x66, 0x62,
+    /* U+005C "\\" */
+    0x22, 0x10, 0x0, 0x0, 0xc, 0xe6, 0x0, 0x0,
+    0x0, 0x8f, 0xa0, 0x0, 0x0, 0x4, 0xfd, 0x20,
+    0x0, 0x0, 0x1e, 0xf4, 0x0, 0x0, 0x0, 0xaf,
+    0x80, 0x0, 0x0, 0x6, 0xfc, 0x10, 0x0, 0x0,
+    0x3f, 0xf2, 0x0, 0x0, 0x1, 0xcf, 0x60, 0x0,
+    0x0, 0x9, 0xfa, 0x0, 0x0, 0x0, 0x5f, 0xe1,
+    0x0, 0x0, 0x2, 0xdf, 0x40, 0x0, 0x0, 0xb,
+    0xf8, 0x0, 0x0, 0x0, 0x7f, 0xc0, 0x0, 0x0,
+    0x3, 0xee, 0x20, 0x0, 0x0, 0xd, 0xf6, 0x0,
+    0x0, 0x0, 0x9f, 0xa0, 0x0, 0x0, 0x5, 0xfd,
+    0x10, 0x0, 0x0, 0x1f, 0xf4, 0x0, 0x0, 0x0,
+    0xbf, 0x70, 0x0, 0x0, 0x7, 0xfb, 0x0, 0x0,
+    0x0, 0x3f, 0xe2, 0x0, 0x0, 0x1, 0xdf, 0x50,
+    0x0, 0x0, 0x9, 0xf9, 0x0, 0x0, 0x0, 0x37,
+    0x50,
+    /* U+005D "]" */
+    0x5d, 0xdd, 0xdd, 0xb6, 0xff, 0xff, 0xfc, 0x37,
+    0x78, 0xef, 0xc0, 0x0, 0x1e, 0xfc, 0x0, 0x1,
+    0xef, 0xc0, 0x0, 0x1e, 0xfc, 0x0, 0x1, 0xef,
+    0xc0, 0x0, 0x1e, 0xfc, 0x0, 0x1, 0xef, 0xc0,
+    0x0, 0x1e, 0xfc, 0x0, 0x1, 0xef, 0xc0, 0x0,
+    0x1e, 0xfc, 0x0, 0x1, 0xef, 0xc0, 0x0, 0x1e,
+    0xfc, 0x0, 0x1, 0xef, 0xc0, 0x0, 0x1e, 0xfc,
+    0x0, 0x1, 0xef, 0xc0, 0x0, 0x1e, 0xfc, 0x0,
+    0x1, 0xef, 0xc0, 0x0, 0x1e, 0xfc, 0x0, 0x1,
+    0xef, 0xc0, 0x0, 0x1e, 0xfc, 0x0, 0x1, 0xef,
+    0xc0, 0x0, 0x1e, 0xfc, 0x0, 0x1, 0xef, 0xc0,
+    0x0, 0x1e, 0xfc, 0x0, 0x2, 0xef, 0xc5, 0xdd,
+    0xef, 0xfc, 0x6f, 0xff, 0xff, 0xc2, 0x66, 0x66,
+    0x65,
+    /* U+005E "^" */
+    0x0, 0x0, 0x0, 0x68, 0x60, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2e, 0xfe, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xef, 0xef, 0xe1, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xe6, 0xef, 0x60, 0x0, 0x0, 0x0, 0xc,
+    0xfb, 0x1b, 0xfc, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0x50, 0x5f, 0xf4, 0x0, 0x0, 0x0, 0xbf, 0xe1,
+    0x1, 0xdf, 0xb0, 0x0, 0x0, 0x3e, 0xf8, 0x0,
+    0x8, 0xfe, 0x30, 0x0, 0x9, 0xff, 0x20, 0x0,
+    0x2e, 0xf9, 0x0, 0x2, 0xef, 0xb0, 0x0, 0x0,
+    0xbf, 0xe2, 0x0, 0x7f, 0xf5, 0x0, 0x0, 0x4,
+    0xff, 0x80, 0x1d, 0xfd, 0x10, 0x0, 0x0, 0xd,
+    0xfd, 0x10,
+    /* U+005F "_" */
+    0x49, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x92, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xe3, 0x36, 0x66, 0x66, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x61,
+    /* U+0060 "`" */
+    0x13, 0x33, 0x10, 0x2, 0xde, 0xe7, 0x0, 0x5,
+    0xef, 0xd1, 0x0, 0x7, 0xff, 0x60, 0x0, 0x9,
+    0xfc, 0x10, 0x0, 0x14, 0x41,
+    /* U+0061 "a" */
+    0x0, 0x0, 0x5, 0xac, 0xee, 0xda, 0x61, 0x0,
+    0x0, 0x0, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xd4,
+    0x0, 0x0, 0x4e, 0xff, 0xb7, 0x67, 0xae, 0xff,
+    0xd1, 0x0, 0x1b, 0xff, 0x60, 0x0, 0x0, 0x3d,
+    0xff, 0x50, 0x3, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x7f, 0xf8, 0x0, 0x15, 0x74, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x12, 0x8f, 0xf8, 0x0, 0x0, 0x1, 0x25, 0x79,
+    0xbe, 0xff, 0xff, 0x80, 0x0, 0x5, 0xcf, 0xff,
+    0xff, 0xfe, 0xdf, 0xf8, 0x0, 0x8, 0xff, 0xfe,
+    0xdb, 0x96, 0x35, 0xff, 0x80, 0x5, 0xff, 0xe7,
+    0x21, 0x0, 0x0, 0x5f, 0xf8, 0x0, 0xaf, 0xf7,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0x80, 0x1c, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0xbf, 0xf8, 0x0, 0xbf,
+    0xf5, 0x0, 0x0, 0x0, 0x6f, 0xff, 0x90, 0x7,
+    0xff, 0xd4, 0x0, 0x2, 0x8e, 0xff, 0xfa, 0x0,
+    0x1c, 0xff, 0xec, 0xbc, 0xef, 0xe7, 0xdf, 0xd0,
+    0x0, 0x2b, 0xff, 0xff, 0xff, 0xa2, 0xb, 0xff,
+    0x30, 0x0, 0x2, 0x57, 0x64, 0x10, 0x0, 0x11,
+    0x10,
+    /* U+0062 "b" */
+    0x1b, 0xdb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1c, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1c, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1c, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1c, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1c, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1c, 0xfd, 0x2, 0x9c, 0xed, 0x93, 0x0, 0x0,
+    0x1c, 0xfd, 0x6e, 0xff, 0xff, 0xff, 0x91, 0x0,
+    0x1c, 0xff, 0xff, 0xc7, 0x6a, 0xef, 0xf9, 0x0,
+    0x1c, 0xff, 0xf8, 0x10, 0x0, 0x4e, 0xff, 0x40,
+    0x1c, 0xff, 0xa0, 0x0, 0x0, 0x5, 0xff, 0xb0,
+    0x1c, 0xff, 0x30, 0x0, 0x0, 0x1, 0xcf, 0xf1,
+    0x1c, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf5,
+    0x1c, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf7,
+    0x1c, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf7,
+    0x1c, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf7,
+    0x1c, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf5,
+    0x1c, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf2,
+    0x1c, 0xff, 0x40, 0x0, 0x0, 0x3, 0xef, 0xd0,
+    0x1c, 0xff, 0xc1, 0x0, 0x0, 0x1a, 0xff, 0x70,
+    0x1c, 0xff, 0xfb, 0x41, 0x3, 0xaf, 0xfc, 0x10,
+    0x1c, 0xfb, 0xdf, 0xed, 0xde, 0xff, 0xc2, 0x0,
+    0x1c, 0xfa, 0x2b, 0xff, 0xff, 0xf9, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x36, 0x75, 0x10, 0x0, 0x0,
+    /* U+0063 "c" */
+    0x0, 0x0, 0x38, 0xce, 0xdb, 0x71, 0x0, 0x0,
+    0x1, 0xaf, 0xff, 0xff, 0xff, 0xe5, 0x0, 0x1,
+    0xbf, 0xfe, 0x96, 0x7b, 0xff, 0xe4, 0x0, 0x8f,
+    0xfc, 0x20, 0x0, 0x7, 0xff, 0xc1, 0x2d, 0xfe,
+    0x20, 0x0, 0x0, 0x1b, 0xff, 0x35, 0xff, 0x90,
+    0x0, 0x0, 0x0, 0x4a, 0x72, 0x8f, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xbf, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xf4, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x3e, 0xc6, 0x3f, 0xfb, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0x61, 0xcf, 0xf6, 0x0, 0x0, 0x2, 0xdf,
+    0xe2, 0x4, 0xef, 0xe7, 0x20, 0x14, 0xcf, 0xf8,
+    0x0, 0x6, 0xff, 0xfe, 0xdd, 0xef, 0xfa, 0x10,
+    0x0, 0x4, 0xcf, 0xff, 0xff, 0xe7, 0x10, 0x0,
+    0x0, 0x0, 0x25, 0x76, 0x40, 0x0, 0x0,
+    /* U+0064 "d" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4d, 0xd6,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8,
+    0x0, 0x0, 0x6, 0xbd, 0xeb, 0x60, 0x5f, 0xf8,
+    0x0, 0x3, 0xdf, 0xff, 0xff, 0xfb, 0x6f, 0xf8,
+    0x0, 0x2d, 0xff, 0xc8, 0x69, 0xdf, 0xef, 0xf8,
+    0x0, 0xaf, 0xfa, 0x10, 0x0, 0x2c, 0xff, 0xf8,
+    0x3, 0xef, 0xd1, 0x0, 0x0, 0x3, 0xef, 0xf8,
+    0x7, 0xff, 0x70, 0x0, 0x0, 0x0, 0x9f, 0xf8,
+    0xa, 0xff, 0x30, 0x0, 0x0, 0x0, 0x5f, 0xf8,
+    0x1c, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x3f, 0xf8,
+    0x1d, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x2e, 0xf8,
+    0x1c, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x2e, 0xf8,
+    0xb, 0xff, 0x20, 0x0, 0x0, 0x0, 0x3f, 0xf8,
+    0x9, 0xff, 0x50, 0x0, 0x0, 0x0, 0x5f, 0xf8,
+    0x4, 0xff, 0xa0, 0x0, 0x0, 0x0, 0xaf, 0xf8,
+    0x1, 0xcf, 0xf5, 0x0, 0x0, 0x5, 0xff, 0xf8,
+    0x0, 0x5e, 0xfe, 0x72, 0x2, 0x6e, 0xff, 0xf8,
+    0x0, 0x7, 0xff, 0xfd, 0xdd, 0xff, 0xaf, 0xf8,
+    0x0, 0x0, 0x4d, 0xff, 0xff, 0xe7, 0x3e, 0xf8,
+    0x0, 0x0, 0x0, 0x36, 0x75, 0x10, 0x0, 0x0,
+    /* U+0065 "e" */
+    0x0, 0x0, 0x3, 0x8c, 0xee, 0xb7, 0x10, 0x0,
+    0x0, 0x0, 0x19, 0xff, 0xff, 0xff, 0xfe, 0x60,
+    0x0, 0x0, 0x1a, 0xff, 0xea, 0x77, 0xae, 0xff,
+    0x60, 0x0, 0x7, 0xff, 0xd3, 0x0, 0x0, 0x4e,
+    0xfe, 0x30, 0x2, 0xdf, 0xe3, 0x0, 0x0, 0x0,
+    0x5f, 0xfa, 0x0, 0x6f, 0xfa, 0x0, 0x0, 0x0,
+    0x1, 0xcf, 0xf1, 0x9, 0xff, 0x50, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0x40, 0xbf, 0xfb, 0x99, 0x99,
+    0x99, 0x99, 0xcf, 0xf6, 0x1c, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x70, 0xcf, 0xfb, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xa5, 0xb, 0xff, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0x11, 0x0, 0x4, 0xff,
+    0xb0, 0x0, 0x0, 0x0, 0x1c, 0xfd, 0x30, 0x1c,
+    0xff, 0x70, 0x0, 0x0, 0x7, 0xff, 0xd0, 0x0,
+    0x5e, 0xff, 0x93, 0x10, 0x28, 0xef, 0xf5, 0x0,
+    0x0, 0x6e, 0xff, 0xed, 0xde, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x3b, 0xff, 0xff, 0xff, 0xc5, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0x57, 0x75, 0x20, 0x0,
+    0x0,
+    /* U+0066 "f" */
+    0x0, 0x0, 0x1, 0x23, 0x21, 0x0, 0x0, 0x6,
+    0xde, 0xee, 0xc1, 0x0, 0x7, 0xff, 0xff, 0xfb,
+    0x0, 0x1, 0xdf, 0xfb, 0x77, 0x50, 0x0, 0x3e,
+    0xfc, 0x0, 0x0, 0x0, 0x4, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x4f, 0xf9, 0x0, 0x0, 0x4, 0x58,
+    0xff, 0xb5, 0x54, 0x0, 0xaf, 0xff, 0xff, 0xff,
+    0xc1, 0x9, 0xcd, 0xff, 0xec, 0xca, 0x0, 0x0,
+    0x4f, 0xf9, 0x0, 0x0, 0x0, 0x4, 0xff, 0x90,
+    0x0, 0x0, 0x0, 0x4f, 0xf9, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0x90, 0x0, 0x0, 0x0, 0x4f, 0xf9,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0x90, 0x0, 0x0,
+    0x0, 0x4f, 0xf9, 0x0, 0x0, 0x0, 0x4, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x4f, 0xf9, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0x90, 0x0, 0x0, 0x0, 0x4f,
+    0xf9, 0x0, 0x0, 0x0, 0x4, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x4f, 0xf9, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0x90, 0x0, 0x0, 0x0, 0x14, 0x42, 0x0,
+    0x0, 0x0,
+    /* U+0067 "g" */
+    0x0, 0x0, 0x6, 0xbd, 0xec, 0x71, 0x17, 0x85,
+    0x0, 0x3, 0xdf, 0xff, 0xff, 0xfd, 0x5d, 0xfa,
+    0x0, 0x2d, 0xff, 0xd8, 0x69, 0xdf, 0xee, 0xfa,
+    0x0, 0xaf, 0xfa, 0x10, 0x0, 0x2b, 0xff, 0xfa,
+    0x3, 0xff, 0xc1, 0x0, 0x0, 0x2, 0xdf, 0xfa,
+    0x8, 0xff, 0x60, 0x0, 0x0, 0x0, 0x7f, 0xfa,
+    0xb, 0xff, 0x20, 0x0, 0x0, 0x0, 0x3f, 0xfa,
+    0x1d, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x2e, 0xfa,
+    0x1e, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x2d, 0xfa,
+    0x1d, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x2d, 0xfa,
+    0x1c, 0xff, 0x20, 0x0, 0x0, 0x0, 0x3f, 0xfa,
+    0x9, 0xff, 0x50, 0x0, 0x0, 0x0, 0x6f, 0xfa,
+    0x4, 0xff, 0xb0, 0x0, 0x0, 0x1, 0xcf, 0xfa,
+    0x1, 0xbf, 0xf8, 0x10, 0x0, 0x19, 0xff, 0xfa,
+    0x0, 0x3e, 0xff, 0xb6, 0x56, 0xbf, 0xff, 0xfa,
+    0x0, 0x5, 0xef, 0xff, 0xff, 0xfd, 0x7f, 0xfa,
+    0x0, 0x0, 0x28, 0xdf, 0xfd, 0x92, 0x3f, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf8,
+    0x3, 0x64, 0x10, 0x0, 0x0, 0x0, 0x6f, 0xf6,
+    0x5, 0xff, 0x70, 0x0, 0x0, 0x1, 0xcf, 0xf3,
+    0x2, 0xef, 0xe3, 0x0, 0x0, 0x19, 0xff, 0xb0,
+    0x0, 0x9f, 0xfe, 0xa8, 0x79, 0xdf, 0xfe, 0x30,
+    0x0, 0x19, 0xef, 0xff, 0xff, 0xff, 0xc3, 0x0,
+    0x0, 0x0, 0x37, 0xbc, 0xdc, 0x95, 0x0, 0x0,
+    /* U+0068 "h" */
+    0x1b, 0xdc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xcf, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1c,
+    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xcf,
+    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xe0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xfe, 0x1,
+    0x7b, 0xed, 0xb7, 0x10, 0x1, 0xcf, 0xe4, 0xef,
+    0xff, 0xff, 0xfd, 0x30, 0x1c, 0xff, 0xef, 0xd9,
+    0x8a, 0xef, 0xfc, 0x11, 0xcf, 0xff, 0x71, 0x0,
+    0x4, 0xef, 0xf4, 0x1c, 0xff, 0x90, 0x0, 0x0,
+    0x8, 0xff, 0x71, 0xcf, 0xf3, 0x0, 0x0, 0x0,
+    0x4f, 0xf9, 0x1c, 0xff, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0x91, 0xcf, 0xe0, 0x0, 0x0, 0x0, 0x3f,
+    0xfa, 0x1c, 0xfe, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0xa1, 0xcf, 0xe0, 0x0, 0x0, 0x0, 0x3f, 0xfa,
+    0x1c, 0xfe, 0x0, 0x0, 0x0, 0x3, 0xff, 0xa1,
+    0xcf, 0xe0, 0x0, 0x0, 0x0, 0x3f, 0xfa, 0x1c,
+    0xfe, 0x0, 0x0, 0x0, 0x3, 0xff, 0xa1, 0xcf,
+    0xe0, 0x0, 0x0, 0x0, 0x3f, 0xfa, 0x1c, 0xfe,
+    0x0, 0x0, 0x0, 0x3, 0xff, 0xa1, 0xcf, 0xe0,
+    0x0, 0x0, 0x0, 0x3f, 0xfa, 0x1c, 0xfe, 0x0,
+    0x0, 0x0, 0x3, 0xff, 0xa0,
+    /* U+0069 "i" */
+    0x1a, 0xdc, 0x1c, 0xfe, 0x1c, 0xfe, 0x4, 0x55,
+    0x0, 0x0, 0x0, 0x0, 0x6, 0x87, 0x1c, 0xfe,
+    0x1c, 0xfe, 0x1c, 0xfe, 0x1c, 0xfe, 0x1c, 0xfe,
+    0x1c, 0xfe, 0x1c, 0xfe, 0x1c, 0xfe, 0x1c, 0xfe,
+    0x1c, 0xfe, 0x1c, 0xfe, 0x1c, 0xfe, 0x1c, 0xfe,
+    0x1c, 0xfe, 0x1c, 0xfe, 0x1c, 0xfe,
+    /* U+006A "j" */
+    0x0, 0x1, 0xbd, 0xb0, 0x0, 0x1c, 0xfd, 0x0,
+    0x1, 0xcf, 0xd0, 0x0, 0x5, 0x65, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x78,
+    0x70, 0x0, 0x1c, 0xfd, 0x0, 0x1, 0xcf, 0xd0,
+    0x0, 0x1c, 0xfd, 0x0, 0x1, 0xcf, 0xd0, 0x0,
+    0x1c, 0xfd, 0x0, 0x1, 0xcf, 0xd0, 0x0, 0x1c,
+    0xfd, 0x0, 0x1, 0xcf, 0xd0, 0x0, 0x1c, 0xfd,
+    0x0, 0x1, 0xcf, 0xd0, 0x0, 0x1c, 0xfd, 0x0,
+    0x1, 0xcf, 0xd0, 0x0, 0x1c, 0xfd, 0x0, 0x1,
+    0xcf, 0xd0, 0x0, 0x1c, 0xfd, 0x0, 0x1, 0xcf,
+    0xd0, 0x0, 0x1c, 0xfd, 0x0, 0x1, 0xdf, 0xd0,
+    0x0, 0x2d, 0xfc, 0x0, 0x4, 0xff, 0xb1, 0xaa,
+    0xdf, 0xf7, 0x4f, 0xff, 0xfc, 0x14, 0xbd, 0xc8,
+    0x20,
+    /* U+006B "k" */
+    0x1a, 0xdc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xcf, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1c,
+    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xcf,
+    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xe0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xfe, 0x0,
+    0x0, 0x0, 0x58, 0x87, 0x1, 0xcf, 0xe0, 0x0,
+    0x0, 0x7f, 0xfe, 0x40, 0x1c, 0xfe, 0x0, 0x0,
+    0x6f, 0xfd, 0x40, 0x1, 0xcf, 0xe0, 0x0, 0x7f,
+    0xfd, 0x30, 0x0, 0x1c, 0xfe, 0x0, 0x7e, 0xfd,
+    0x30, 0x0, 0x1, 0xcf, 0xe0, 0x6f, 0xfd, 0x30,
+    0x0, 0x0, 0x1c, 0xfe, 0x6f, 0xfe, 0x30, 0x0,
+    0x0, 0x1, 0xcf, 0xff, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0x1c, 0xff, 0xfd, 0xef, 0xe3, 0x0, 0x0,
+    0x1, 0xcf, 0xfc, 0x27, 0xff, 0xc1, 0x0, 0x0,
+    0x1c, 0xfe, 0x20, 0x1b, 0xff, 0x80, 0x0, 0x1,
+    0xcf, 0xe0, 0x0, 0x3e, 0xfe, 0x30, 0x0, 0x1c,
+    0xfe, 0x0, 0x0, 0x8f, 0xfc, 0x10, 0x1, 0xcf,
+    0xe0, 0x0, 0x1, 0xcf, 0xf8, 0x0, 0x1c, 0xfe,
+    0x0, 0x0, 0x4, 0xff, 0xe4, 0x1, 0xcf, 0xe0,
+    0x0, 0x0, 0x8, 0xff, 0xc1, 0x1c, 0xfe, 0x0,
+    0x0, 0x0, 0x1d, 0xff, 0x80,
+    /* U+006C "l" */
+    0x1b, 0xdb, 0x1d, 0xfd, 0x1d, 0xfd, 0x1d, 0xfd,
+    0x1d, 0xfd, 0x1d, 0xfd, 0x1d, 0xfd, 0x1d, 0xfd,
+    0x1d, 0xfd, 0x1d, 0xfd, 0x1d, 0xfd, 0x1d, 0xfd,
+    0x1d, 0xfd, 0x1d, 0xfd, 0x1d, 0xfd, 0x1d, 0xfd,
+    0x1d, 0xfd, 0x1d, 0xfd, 0x1d, 0xfd, 0x1d, 0xfd,
+    0x1d, 0xfd, 0x1d, 0xfd, 0x1d, 0xfd,
+    /* U+006D "m" */
+    0x16, 0x85, 0x2, 0x8c, 0xed, 0xa4, 0x0, 0x2,
+    0x9d, 0xdc, 0x92, 0x0, 0x1c, 0xf9, 0x5e, 0xff,
+    0xff, 0xff, 0x60, 0x6f, 0xff, 0xff, 0xfe, 0x50,
+    0x1c, 0xfc, 0xef, 0xc8, 0x8c, 0xff, 0xe7, 0xfe,
+    0xb8, 0x9d, 0xff, 0xd1, 0x1c, 0xff, 0xf6, 0x10,
+    0x1, 0xbf, 0xff, 0xe4, 0x0, 0x2, 0xdf, 0xf5,
+    0x1c, 0xff, 0x90, 0x0, 0x0, 0x4f, 0xff, 0x60,
+    0x0, 0x0, 0x6f, 0xf8, 0x1c, 0xff, 0x40, 0x0,
+    0x0, 0x2f, 0xfe, 0x10, 0x0, 0x0, 0x4f, 0xf9,
+    0x1c, 0xff, 0x10, 0x0, 0x0, 0x1e, 0xfc, 0x10,
+    0x0, 0x0, 0x3f, 0xf9, 0x1c, 0xfe, 0x0, 0x0,
+    0x0, 0x1e, 0xfb, 0x0, 0x0, 0x0, 0x3f, 0xf9,
+    0x1c, 0xfe, 0x0, 0x0, 0x0, 0x1e, 0xfb, 0x0,
+    0x0, 0x0, 0x3f, 0xf9, 0x1c, 0xfe, 0x0, 0x0,
+    0x0, 0x1e, 0xfb, 0x0, 0x0, 0x0, 0x3f, 0xf9,
+    0x1c, 0xfe, 0x0, 0x0, 0x0, 0x1e, 0xfb, 0x0,
+    0x0, 0x0, 0x3f, 0xf9, 0x1c, 0xfe, 0x0, 0x0,
+    0x0, 0x1e, 0xfb, 0x0, 0x0, 0x0, 0x3f, 0xf9,
+    0x1c, 0xfe, 0x0, 0x0, 0x0, 0x1e, 0xfb, 0x0,
+    0x0, 0x0, 0x3f, 0xf9, 0x1c, 0xfe, 0x0, 0x0,
+    0x0, 0x1e, 0xfb, 0x0, 0x0, 0x0, 0x3f, 0xf9,
+    0x1c, 0xfe, 0x0, 0x0, 0x0, 0x1e, 0xfb, 0x0,
+    0x0, 0x0, 0x3f, 0xf9, 0x1c, 0xfe, 0x0, 0x0,
+    0x0, 0x1e, 0xfb, 0x0, 0x0, 0x0, 0x3f, 0xf9,
+    0x1c, 0xfe, 0x0, 0x0, 0x0, 0x1e, 0xfb, 0x0,
+    0x0, 0x0, 0x3f, 0xf9,
+    /* U+006E "n" */
+    0x16, 0x85, 0x1, 0x7c, 0xdd, 0xb6, 0x10, 0x1,
+    0xcf, 0x94, 0xef, 0xff, 0xff, 0xfd, 0x30, 0x1c,
+    0xfc, 0xef, 0xd9, 0x8a, 0xef, 0xfc, 0x11, 0xcf,
+    0xff, 0x71, 0x0, 0x4, 0xef, 0xf4, 0x1c, 0xff,
+    0x90, 0x0, 0x0, 0x8, 0xff, 0x71, 0xcf, 0xf3,
+    0x0, 0x0, 0x0, 0x5f, 0xf8, 0x1c, 0xff, 0x0,
+    0x0, 0x0, 0x3, 0xff, 0x91, 0xcf, 0xe0, 0x0,
+    0x0, 0x0, 0x3f, 0xf9, 0x1c, 0xfe, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0x91, 0xcf, 0xe0, 0x0, 0x0,
+    0x0, 0x3f, 0xf9, 0x1c, 0xfe, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0x91, 0xcf, 0xe0, 0x0, 0x0, 0x0,
+    0x3f, 0xf9, 0x1c, 0xfe, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0x91, 0xcf, 0xe0, 0x0, 0x0, 0x0, 0x3f,
+    0xf9, 0x1c, 0xfe, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0x91, 0xcf, 0xe0, 0x0, 0x0, 0x0, 0x3f, 0xf9,
+    0x1c, 0xfe, 0x0, 0x0, 0x0, 0x3, 0xff, 0x90,
+    /* U+006F "o" */
+    0x0, 0x0, 0x3, 0x9c, 0xde, 0xb7, 0x20, 0x0,
+    0x0, 0x0, 0x2a, 0xff, 0xff, 0xff, 0xfe, 0x70,
+    0x0, 0x0, 0x2c, 0xff, 0xea, 0x77, 0xbe, 0xff,
+    0x80, 0x0, 0xa, 0xff, 0xc2, 0x0, 0x0, 0x5e,
+    0xff, 0x50, 0x3, 0xef, 0xd2, 0x0, 0x0, 0x0,
+    0x6f, 0xfd, 0x0, 0x8f, 0xf7, 0x0, 0x0, 0x0,
+    0x1, 0xcf, 0xf3, 0xb, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0x61, 0xcf, 0xe1, 0x0, 0x0,
+    0x0, 0x0, 0x5f, 0xf8, 0x1d, 0xfd, 0x10, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0x91, 0xdf, 0xe1, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xf8, 0x1c, 0xff, 0x20,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0x70, 0xaf, 0xf4,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xf5, 0x6, 0xff,
+    0xa0, 0x0, 0x0, 0x0, 0x2d, 0xff, 0x10, 0x1d,
+    0xff, 0x50, 0x0, 0x0, 0x1a, 0xff, 0xa0, 0x0,
+    0x6f, 0xfe, 0x72, 0x1, 0x3a, 0xff, 0xe2, 0x0,
+    0x0, 0x7f, 0xff, 0xed, 0xde, 0xff, 0xd4, 0x0,
+    0x0, 0x0, 0x4c, 0xff, 0xff, 0xfe, 0x92, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0x57, 0x64, 0x10, 0x0,
+    0x0,
+    /* U+0070 "p" */
+    0x6, 0x75, 0x2, 0x8b, 0xcb, 0x82, 0x0, 0x0,
+    0x1c, 0xfa, 0x4e, 0xff, 0xff, 0xff, 0x81, 0x0,
+    0x1c, 0xfd, 0xef, 0xc7, 0x69, 0xef, 0xf8, 0x0,
+    0x1c, 0xff, 0xf8, 0x10, 0x0, 0x4d, 0xff, 0x40,
+    0x1c, 0xff, 0xb0, 0x0, 0x0, 0x5, 0xff, 0xb0,
+    0x1c, 0xff, 0x40, 0x0, 0x0, 0x1, 0xcf, 0xf1,
+    0x1c, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf5,
+    0x1c, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf7,
+    0x1c, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf7,
+    0x1c, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf7,
+    0x1c, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf6,
+    0x1c, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf3,
+    0x1c, 0xff, 0x50, 0x0, 0x0, 0x2, 0xef, 0xd0,
+    0x1c, 0xff, 0xc1, 0x0, 0x0, 0x1a, 0xff, 0x70,
+    0x1c, 0xff, 0xfc, 0x41, 0x13, 0xaf, 0xfc, 0x10,
+    0x1c, 0xfe, 0xdf, 0xed, 0xde, 0xff, 0xd3, 0x0,
+    0x1c, 0xfe, 0x2a, 0xff, 0xff, 0xf9, 0x20, 0x0,
+    0x1c, 0xfe, 0x0, 0x36, 0x75, 0x10, 0x0, 0x0,
+    0x1c, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1c, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1c, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1c, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1c, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0x65, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    /* U+0071 "q" */
+    0x0, 0x0, 0x5, 0xac, 0xca, 0x50, 0x16, 0x74,
+    0x0, 0x2, 0xcf, 0xff, 0xff, 0xfb, 0x4e, 0xf8,
+    0x0, 0x2c, 0xff, 0xc7, 0x69, 0xef, 0xde, 0xf8,
+    0x0, 0x9f, 0xfa, 0x10, 0x0, 0x2c, 0xff, 0xf8,
+    0x3, 0xef, 0xd1, 0x0, 0x0, 0x3, 0xef, 0xf8,
+    0x7, 0xff, 0x70, 0x0, 0x0, 0x0, 0x9f, 0xf8,
+    0xa, 0xff, 0x30, 0x0, 0x0, 0x0, 0x5f, 0xf8,
+    0xc, 0xff, 0x20, 0x0, 0x0, 0x0, 0x3e, 0xf8,
+    0x1c, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x2e, 0xf8,
+    0x1c, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x2e, 0xf8,
+    0xb, 0xff, 0x20, 0x0, 0x0, 0x0, 0x3f, 0xf8,
+    0x9, 0xff, 0x50, 0x0, 0x0, 0x0, 0x5f, 0xf8,
+    0x4, 0xff, 0xb0, 0x0, 0x0, 0x0, 0xaf, 0xf8,
+    0x1, 0xcf, 0xf5, 0x0, 0x0, 0x5, 0xff, 0xf8,
+    0x0, 0x4e, 0xfe, 0x72, 0x1, 0x6e, 0xff, 0xf8,
+    0x0, 0x6, 0xef, 0xfd, 0xdd, 0xff, 0xcf, 0xf8,
+    0x0, 0x0, 0x3c, 0xff, 0xff, 0xe7, 0x5f, 0xf8,
+    0x0, 0x0, 0x0, 0x36, 0x75, 0x10, 0x5f, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x26, 0x63,
+    /* U+0072 "r" */
+    0x17, 0x85, 0x6, 0xcd, 0xb5, 0x1d, 0xf9, 0x7f,
+    0xff, 0xfd, 0x1d, 0xfb, 0xef, 0xee, 0xf8, 0x1d,
+    0xff, 0xf8, 0x22, 0x52, 0x1d, 0xff, 0xa0, 0x0,
+    0x0, 0x1d, 0xff, 0x40, 0x0, 0x0, 0x1d, 0xff,
+    0x10, 0x0, 0x0, 0x1d, 0xfe, 0x0, 0x0, 0x0,
+    0x1d, 0xfd, 0x0, 0x0, 0x0, 0x1d, 0xfd, 0x0,
+    0x0, 0x0, 0x1d, 0xfd, 0x0, 0x0, 0x0, 0x1d,
+    0xfd, 0x0, 0x0, 0x0, 0x1d, 0xfd, 0x0, 0x0,
+    0x0, 0x1d, 0xfd, 0x0, 0x0, 0x0, 0x1d, 0xfd,
+    0x0, 0x0, 0x0, 0x1d, 0xfd, 0x0, 0x0, 0x0,
+    0x1d, 0xfd, 0x0, 0x0, 0x0,
+    /* U+0073 "s" */
+    0x0, 0x0, 0x5a, 0xce, 0xdb, 0x82, 0x0, 0x0,
+    0x2, 0xcf, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x1,
+    0xbf, 0xfb, 0x76, 0x7a, 0xef, 0xf6, 0x0, 0x5f,
+    0xf9, 0x0, 0x0, 0x6, 0xff, 0xc1, 0x8, 0xff,
+    0x30, 0x0, 0x0, 0xb, 0xdb, 0x10, 0x8f, 0xf8,
+    0x0, 0x0, 0x0, 0x11, 0x10, 0x4, 0xff, 0xfc,
+    0x72, 0x10, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
+    0xfd, 0x95, 0x10, 0x0, 0x0, 0x17, 0xdf, 0xff,
+    0xff, 0xfd, 0x81, 0x0, 0x0, 0x1, 0x49, 0xcf,
+    0xff, 0xff, 0xb1, 0x0, 0x0, 0x0, 0x1, 0x26,
+    0xbf, 0xff, 0x70, 0x1, 0x30, 0x0, 0x0, 0x0,
+    0x7f, 0xfa, 0x1c, 0xfd, 0x10, 0x0, 0x0, 0x2,
+    0xff, 0xb0, 0x9f, 0xf7, 0x0, 0x0, 0x0, 0x6f,
+    0xf8, 0x3, 0xef, 0xe7, 0x20, 0x2, 0x6e, 0xfe,
+    0x30, 0x7, 0xff, 0xfe, 0xdd, 0xdf, 0xfe, 0x60,
+    0x0, 0x5, 0xdf, 0xff, 0xff, 0xfc, 0x40, 0x0,
+    0x0, 0x0, 0x35, 0x77, 0x52, 0x0, 0x0,
+    /* U+0074 "t" */
+    0x0, 0x0, 0x23, 0x0, 0x0, 0x1, 0x7e, 0x60,
+    0x0, 0x0, 0x5f, 0xf6, 0x0, 0x0, 0x6, 0xff,
+    0x60, 0x0, 0x0, 0x6f, 0xf6, 0x0, 0x0, 0x6,
+    0xff, 0x60, 0x0, 0x5c, 0xdf, 0xfe, 0xcc, 0x37,
+    0xff, 0xff, 0xff, 0xf3, 0x36, 0x9f, 0xfa, 0x66,
+    0x10, 0x6, 0xff, 0x60, 0x0, 0x0, 0x6f, 0xf6,
+    0x0, 0x0, 0x6, 0xff, 0x60, 0x0, 0x0, 0x6f,
+    0xf6, 0x0, 0x0, 0x6, 0xff, 0x60, 0x0, 0x0,
+    0x6f, 0xf6, 0x0, 0x0, 0x6, 0xff, 0x60, 0x0,
+    0x0, 0x6f, 0xf6, 0x0, 0x0, 0x6, 0xff, 0x60,
+    0x0, 0x0, 0x5f, 0xf7, 0x0, 0x0, 0x5, 0xff,
+    0x90, 0x0, 0x0, 0x3f, 0xfe, 0xaa, 0x30, 0x1,
+    0xcf, 0xff, 0xf7, 0x0, 0x2, 0xae, 0xfe, 0x70,
+    /* U+0075 "u" */
+    0x16, 0x76, 0x0, 0x0, 0x0, 0x2, 0x77, 0x41,
+    0xdf, 0xd0, 0x0, 0x0, 0x0, 0x5f, 0xf8, 0x1d,
+    0xfd, 0x0, 0x0, 0x0, 0x5, 0xff, 0x81, 0xdf,
+    0xd0, 0x0, 0x0, 0x0, 0x5f, 0xf8, 0x1d, 0xfd,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0x81, 0xdf, 0xd0,
+    0x0, 0x0, 0x0, 0x5f, 0xf8, 0x1d, 0xfd, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0x81, 0xdf, 0xd0, 0x0,
+    0x0, 0x0, 0x5f, 0xf8, 0x1d, 0xfd, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0x81, 0xdf, 0xd0, 0x0, 0x0,
+    0x0, 0x5f, 0xf8, 0x1d, 0xfd, 0x0, 0x0, 0x0,
+    0x5, 0xff, 0x81, 0xdf, 0xd0, 0x0, 0x0, 0x0,
+    0x7f, 0xf8, 0x1c, 0xff, 0x10, 0x0, 0x0, 0xb,
+    0xff, 0x80, 0xbf, 0xf6, 0x0, 0x0, 0x5, 0xff,
+    0xf8, 0x6, 0xff, 0xe6, 0x21, 0x38, 0xee, 0xff,
+    0x80, 0x1c, 0xff, 0xfe, 0xde, 0xfe, 0x7e, 0xf8,
+    0x0, 0x2a, 0xff, 0xff, 0xfc, 0x42, 0xdf, 0x80,
+    0x0, 0x1, 0x57, 0x63, 0x0, 0x1, 0x10,
+    /* U+0076 "v" */
+    0x47, 0x73, 0x0, 0x0, 0x0, 0x0, 0x27, 0x74,
+    0x3f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf4,
+    0x1c, 0xfe, 0x20, 0x0, 0x0, 0x1, 0xdf, 0xc1,
+    0x7, 0xff, 0x70, 0x0, 0x0, 0x5, 0xff, 0x80,
+    0x2, 0xef, 0xc0, 0x0, 0x0, 0xb, 0xfe, 0x30,
+    0x0, 0xaf, 0xf2, 0x0, 0x0, 0x1f, 0xfb, 0x0,
+    0x0, 0x5f, 0xf8, 0x0, 0x0, 0x7f, 0xf5, 0x0,
+    0x0, 0x1d, 0xfd, 0x0, 0x0, 0xcf, 0xd1, 0x0,
+    0x0, 0x8, 0xff, 0x40, 0x3, 0xff, 0x90, 0x0,
+    0x0, 0x3, 0xef, 0x90, 0x8, 0xfe, 0x40, 0x0,
+    0x0, 0x0, 0xbf, 0xd1, 0x1d, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xf5, 0x4f, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x1e, 0xfa, 0x9f, 0xe1, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xfe, 0xef, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0xff, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xcf, 0xfd, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0,
+    /* U+0077 "w" */
+    0x67, 0x61, 0x0, 0x0, 0x0, 0x67, 0x61, 0x0,
+    0x0, 0x0, 0x67, 0x59, 0xff, 0x40, 0x0, 0x0,
+    0x3f, 0xff, 0x40, 0x0, 0x0, 0x3e, 0xf8, 0x4f,
+    0xf8, 0x0, 0x0, 0x6, 0xff, 0xf8, 0x0, 0x0,
+    0x7, 0xff, 0x41, 0xef, 0xc1, 0x0, 0x0, 0xaf,
+    0xff, 0xb0, 0x0, 0x0, 0xbf, 0xd0, 0xa, 0xff,
+    0x20, 0x0, 0x1d, 0xfe, 0xfe, 0x20, 0x0, 0x2e,
+    0xf9, 0x0, 0x6f, 0xf6, 0x0, 0x4, 0xff, 0x7f,
+    0xf5, 0x0, 0x5, 0xff, 0x40, 0x2, 0xef, 0xa0,
+    0x0, 0x8f, 0xe2, 0xef, 0x90, 0x0, 0xaf, 0xe1,
+    0x0, 0xb, 0xfe, 0x0, 0xb, 0xf9, 0xb, 0xfc,
+    0x10, 0x1d, 0xfa, 0x0, 0x0, 0x7f, 0xf3, 0x2,
+    0xef, 0x60, 0x8f, 0xf2, 0x4, 0xff, 0x50, 0x0,
+    0x3, 0xef, 0x70, 0x5f, 0xf2, 0x4, 0xff, 0x50,
+    0x8f, 0xe2, 0x0, 0x0, 0xc, 0xfc, 0x9, 0xfc,
+    0x0, 0x2d, 0xf9, 0x1c, 0xfb, 0x0, 0x0, 0x0,
+    0x8f, 0xe2, 0xcf, 0x90, 0x0, 0xbf, 0xd2, 0xff,
+    0x60, 0x0, 0x0, 0x4, 0xff, 0x7f, 0xf5, 0x0,
+    0x7, 0xff, 0x9f, 0xe2, 0x0, 0x0, 0x0, 0x1d,
+    0xfe, 0xfe, 0x20, 0x0, 0x3e, 0xff, 0xfb, 0x0,
+    0x0, 0x0, 0x0, 0x9f, 0xff, 0xb0, 0x0, 0x1,
+    0xdf, 0xff, 0x70, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0xf8, 0x0, 0x0, 0xa, 0xff, 0xe3, 0x0, 0x0,
+    0x0, 0x0, 0x1e, 0xff, 0x40, 0x0, 0x0, 0x6f,
+    0xfc, 0x0, 0x0, 0x0,
+    /* U+0078 "x" */
+    0x18, 0x88, 0x30, 0x0, 0x0, 0x2, 0x88, 0x81,
+    0x8, 0xff, 0xd1, 0x0, 0x0, 0xb, 0xff, 0x80,
+    0x1, 0xcf, 0xf8, 0x0, 0x0, 0x8f, 0xfb, 0x10,
+    0x0, 0x4e, 0xfe, 0x40, 0x4, 0xef, 0xd3, 0x0,
+    0x0, 0x7, 0xff, 0xc1, 0x1c, 0xff, 0x60, 0x0,
+    0x0, 0x1, 0xbf, 0xf7, 0x9f, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x2e, 0xff, 0xff, 0xc1, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xfe, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xdf, 0xfc, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x3e, 0xfe, 0xef, 0xe3, 0x0, 0x0,
+    0x0, 0x1, 0xcf, 0xf5, 0x5f, 0xfc, 0x10, 0x0,
+    0x0, 0x9, 0xff, 0xa0, 0xa, 0xff, 0x90, 0x0,
+    0x0, 0x5e, 0xfd, 0x20, 0x2, 0xdf, 0xe5, 0x0,
+    0x2, 0xdf, 0xf5, 0x0, 0x0, 0x5f, 0xfd, 0x20,
+    0xa, 0xff, 0xa0, 0x0, 0x0, 0xa, 0xff, 0xa0,
+    0x6f, 0xfd, 0x20, 0x0, 0x0, 0x2, 0xef, 0xf6,
+    /* U+0079 "y" */
+    0x37, 0x74, 0x0, 0x0, 0x0, 0x0, 0x17, 0x74,
+    0x2f, 0xfc, 0x10, 0x0, 0x0, 0x0, 0x7f, 0xf6,
+    0xb, 0xff, 0x40, 0x0, 0x0, 0x1, 0xcf, 0xe1,
+    0x6, 0xff, 0x90, 0x0, 0x0, 0x3, 0xff, 0x90,
+    0x2, 0xdf, 0xe1, 0x0, 0x0, 0x8, 0xff, 0x40,
+    0x0, 0x9f, 0xf5, 0x0, 0x0, 0xd, 0xfc, 0x10,
+    0x0, 0x4f, 0xfa, 0x0, 0x0, 0x4f, 0xf7, 0x0,
+    0x0, 0x1c, 0xfe, 0x20, 0x0, 0xaf, 0xe3, 0x0,
+    0x0, 0x7, 0xff, 0x60, 0x1, 0xef, 0xb0, 0x0,
+    0x0, 0x2, 0xef, 0xb0, 0x6, 0xff, 0x60, 0x0,
+    0x0, 0x0, 0xbf, 0xe3, 0xb, 0xfe, 0x10, 0x0,
+    0x0, 0x0, 0x5f, 0xf7, 0x2e, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x1e, 0xfb, 0x6f, 0xf4, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xfe, 0xcf, 0xd0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xff, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xcf, 0xff, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xd1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xef, 0x90, 0x0, 0x0, 0x0,
+    0x1, 0x10, 0x2b, 0xfe, 0x30, 0x0, 0x0, 0x0,
+    0x3, 0xed, 0xef, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xff, 0xff, 0xc1, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x9c, 0xc8, 0x10, 0x0, 0x0, 0x0, 0x0,
+    /* U+007A "z" */
+    0x5, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x50,
+    0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1,
+    0x8, 0xcc, 0xcc, 0xcc, 0xcc, 0xcf, 0xff, 0x90,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xfb, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xef, 0xd2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4e, 0xfe, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xef, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2d, 0xff, 0x60, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xcf, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1b, 0xff, 0xa1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xfb, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xef, 0xe4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3e, 0xff, 0x95, 0x66, 0x66, 0x66, 0x66, 0x62,
+    0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
+    0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
+    /* U+007B "{" */
+    0x0, 0x0, 0x0, 0x1, 0x11, 0x0, 0x0, 0x0,
+    0x29, 0xde, 0xc1, 0x0, 0x0, 0x1c, 0xff, 0xfd,
+    0x10, 0x0, 0x6, 0xff, 0xc7, 0x60, 0x0, 0x0,
+    0xaf, 0xe2, 0x0, 0x0, 0x0, 0xc, 0xfc, 0x0,
+    0x0, 0x0, 0x0, 0xdf, 0xc0, 0x0, 0x0, 0x0,
+    0xd, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xb0,
+    0x0, 0x0, 0x0, 0xd, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0xdf, 0xb0, 0x0, 0x0, 0x0, 0x1e, 0xf9,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0x60, 0x0, 0x0,
+    0x1, 0xaf, 0xe2, 0x0, 0x0, 0x18, 0xcf, 0xf6,
+    0x0, 0x0, 0x1, 0xff, 0xe5, 0x0, 0x0, 0x0,
+    0x1f, 0xfe, 0x91, 0x0, 0x0, 0x0, 0x38, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x8, 0xff, 0x30, 0x0,
+    0x0, 0x0, 0x3e, 0xf7, 0x0, 0x0, 0x0, 0x1,
+    0xef, 0xa0, 0x0, 0x0, 0x0, 0xd, 0xfb, 0x0,
+    0x0, 0x0, 0x0, 0xdf, 0xb0, 0x0, 0x0, 0x0,
+    0xd, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xc0,
+    0x0, 0x0, 0x0, 0xc, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0xbf, 0xd0, 0x0, 0x0, 0x0, 0x9, 0xfe,
+    0x30, 0x0, 0x0, 0x0, 0x5f, 0xfe, 0xa8, 0x0,
+    0x0, 0x0, 0xbf, 0xff, 0xd1, 0x0, 0x0, 0x0,
+    0x7b, 0xdb, 0x10,
+    /* U+007C "|" */
+    0x2, 0x31, 0x2d, 0xe5, 0x2e, 0xf6, 0x2e, 0xf6,
+    0x2e, 0xf6, 0x2e, 0xf6, 0x2e, 0xf6, 0x2e, 0xf6,
+    0x2e, 0xf6, 0x2e, 0xf6, 0x2e, 0xf6, 0x2e, 0xf6,
+    0x2e, 0xf6, 0x2e, 0xf6, 0x2e, 0xf6, 0x2e, 0xf6,
+    0x2e, 0xf6, 0x2e, 0xf6, 0x2e, 0xf6, 0x2e, 0xf6,
+    0x2e, 0xf6, 0x2e, 0xf6, 0x2e, 0xf6, 0x2e, 0xf6,
+    0x2e, 0xf6, 0x2e, 0xf6, 0x2e, 0xf6, 0x2e, 0xf6,
+    0x2e, 0xf6, 0x2e, 0xf6, 0x2c, 0xd5,
+    /* U+007D "}" */
+    0x2, 0x10, 0x0, 0x0, 0x0, 0x4e, 0xdc, 0x70,
+    0x0, 0x0, 0x4f, 0xff, 0xf8, 0x0, 0x0, 0x27,
+    0x8e, 0xfe, 0x20, 0x0, 0x0, 0x6, 0xff, 0x50,
+    0x0, 0x0, 0x3, 0xef, 0x60, 0x0, 0x0, 0x3,
+    0xef, 0x70, 0x0, 0x0, 0x2, 0xef, 0x80, 0x0,
+    0x0, 0x2, 0xef, 0x80, 0x0, 0x0, 0x2, 0xef,
+    0x80, 0x0, 0x0, 0x2, 0xef, 0x90, 0x0, 0x0,
+    0x1, 0xdf, 0xa0, 0x0, 0x0, 0x0, 0xbf, 0xd1,
+    0x0, 0x0, 0x0, 0x6f, 0xf6, 0x0, 0x0, 0x0,
+    0xa, 0xff, 0xa5, 0x0, 0x0, 0x1, 0x8f, 0xfb,
+    0x0, 0x0, 0x2, 0xbf, 0xfb, 0x0, 0x0, 0x1d,
+    0xfd, 0x62, 0x0, 0x0, 0x7f, 0xe4, 0x0, 0x0,
+    0x0, 0xcf, 0xc0, 0x0, 0x0, 0x1, 0xef, 0xa0,
+    0x0, 0x0, 0x2, 0xef, 0x90, 0x0, 0x0, 0x2,
+    0xef, 0x80, 0x0, 0x0, 0x2, 0xef, 0x80, 0x0,
+    0x0, 0x2, 0xef, 0x80, 0x0, 0x0, 0x2, 0xef,
+    0x70, 0x0, 0x0, 0x3, 0xef, 0x60, 0x0, 0x0,
+    0x7, 0xff, 0x50, 0x0, 0x29, 0xbf, 0xfe, 0x10,
+    0x0, 0x4f, 0xff, 0xf6, 0x0, 0x0, 0x3d, 0xda,
+    0x40, 0x0, 0x0,
+    /* U+007E "~" */
+    0x1, 0x59, 0xba, 0x73, 0x10, 0x0, 0x0, 0x2,
+    0x32, 0xbf, 0xff, 0xff, 0xec, 0x61, 0x0, 0x5,
+    0xd6, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xeb, 0xac,
+    0xff, 0x69, 0xfb, 0x64, 0x6a, 0xef, 0xff, 0xff,
+    0xff, 0xe4, 0x86, 0x0, 0x0, 0x2, 0x7c, 0xef,
+    0xfe, 0xc4, 0x1, 0x0, 0x0, 0x0, 0x0, 0x13,
+    0x44, 0x30, 0x0,
+    /* U+00C4 "Ä" */
+    0x0, 0x0, 0x0, 0x66, 0x50, 0x2, 0x66, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xc1,
+    0x4, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xff, 0xc1, 0x4, 0xff, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xcc, 0x91, 0x3, 0xcc,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5c, 0xcc, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xef, 0xef, 0xd1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0x8f, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xfc,
+    0x2f, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5f, 0xf8, 0xb, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xf4, 0x6, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef,
+    0xc1, 0x1, 0xef, 0xe2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0x80, 0x0, 0x9f, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xc, 0xfe, 0x30, 0x0,
+    0x4f, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xfb, 0x0, 0x0, 0x1c, 0xff, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xf6, 0x0, 0x0, 0x7, 0xff,
+    0xa0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xd2, 0x0,
+    0x0, 0x3, 0xef, 0xe2, 0x0, 0x0, 0x0, 0x6,
+    0xff, 0xc5, 0x55, 0x55, 0x55, 0xdf, 0xf7, 0x0,
+    0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfd, 0x10, 0x0, 0x0, 0x3e, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0,
+    0x8f, 0xf9, 0x22, 0x22, 0x22, 0x22, 0x29, 0xff,
+    0xa0, 0x0, 0x1, 0xdf, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xe3, 0x0, 0x5, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf8, 0x0,
+    0xa, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xfd, 0x10, 0x2e, 0xfe, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2e, 0xff, 0x50, 0x7f, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
+    0xb0, 0xdf, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xf3,
+    /* U+00C5 "Å" */
+    0x0, 0x0, 0x0, 0x0, 0x17, 0x95, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xcb,
+    0x8d, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xc1, 0x3, 0xd2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6, 0xb0, 0x2, 0xd2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xe7, 0x39, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xef, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xef, 0xef, 0xd1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0x8f, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xfd,
+    0x2f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xf8, 0xb, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xf4, 0x6, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef,
+    0xc1, 0x1, 0xef, 0xe1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0x80, 0x0, 0x9f, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xc, 0xfe, 0x30, 0x0,
+    0x4f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xfb, 0x0, 0x0, 0x1c, 0xff, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xf6, 0x0, 0x0, 0x8, 0xff,
+    0xa0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xd2, 0x0,
+    0x0, 0x3, 0xef, 0xe2, 0x0, 0x0, 0x0, 0x6,
+    0xff, 0xc5, 0x55, 0x55, 0x55, 0xdf, 0xf7, 0x0,
+    0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfd, 0x10, 0x0, 0x0, 0x3e, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0,
+    0x8f, 0xf9, 0x22, 0x22, 0x22, 0x22, 0x29, 0xff,
+    0xa0, 0x0, 0x1, 0xdf, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xe3, 0x0, 0x5, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf8, 0x0,
+    0xa, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xfd, 0x10, 0x2e, 0xfe, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2e, 0xff, 0x50, 0x7f, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
+    0xb0, 0xdf, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xf3,
+    /* U+00C9 "É" */
+    0x0, 0x0, 0x0, 0x0, 0x39, 0x99, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xfa, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xef, 0xc1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xfe,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1a,
+    0xc5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6c, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xc2, 0x7f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe2,
+    0x7f, 0xfe, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xd2, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xfa, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x10,
+    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0x40, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x40, 0x7f, 0xfc, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x20, 0x7f, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xfd, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xbb, 0xb7, 0x7f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfa,
+    /* U+00D6 "Ö" */
+    0x0, 0x0, 0x0, 0x5, 0x66, 0x0, 0x16, 0x65,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf,
+    0xf0, 0x3, 0xef, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1d, 0xff, 0x0, 0x3e, 0xfd, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xac, 0xb0,
+    0x2, 0xbc, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0x33, 0x31, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0x7c, 0xee, 0xee,
+    0xdc, 0x72, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xef, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x10, 0x0,
+    0x0, 0x0, 0x1b, 0xff, 0xfe, 0xa7, 0x77, 0xae,
+    0xff, 0xfa, 0x10, 0x0, 0x0, 0x1b, 0xff, 0xe8,
+    0x20, 0x0, 0x0, 0x28, 0xef, 0xfb, 0x10, 0x0,
+    0x8, 0xff, 0xd4, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xef, 0xf7, 0x0, 0x3, 0xef, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0xe2, 0x0, 0x8f,
+    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b,
+    0xff, 0x80, 0x1c, 0xff, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xfd, 0x2, 0xef, 0xf1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef,
+    0xe3, 0x4f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xd, 0xff, 0x56, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf6,
+    0x7f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0x66, 0xff, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf6, 0x5f,
+    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0xff, 0x53, 0xff, 0xe0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xef, 0xe3, 0x1d, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xfd, 0x10, 0x9f, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0x90, 0x3, 0xef, 0xe3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xef, 0xf4,
+    0x0, 0xa, 0xff, 0xc2, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xcf, 0xfa, 0x0, 0x0, 0x2d, 0xff, 0xc4,
+    0x0, 0x0, 0x0, 0x4, 0xdf, 0xfd, 0x20, 0x0,
+    0x0, 0x3d, 0xff, 0xea, 0x54, 0x34, 0x6a, 0xef,
+    0xfd, 0x30, 0x0, 0x0, 0x0, 0x2b, 0xff, 0xff,
+    0xfe, 0xff, 0xff, 0xfb, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x15, 0xbf, 0xff, 0xff, 0xff, 0xb5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x14, 0x67,
+    0x64, 0x10, 0x0, 0x0, 0x0, 0x0,
+    /* U+00DC "Ü" */
+    0x0, 0x0, 0x5, 0x66, 0x0, 0x16, 0x65, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xcf, 0xf1, 0x2, 0xef,
+    0xd0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xff, 0x10,
+    0x2e, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x1, 0xac,
+    0xc1, 0x2, 0xbc, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0xcc, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6c,
+    0xc7, 0x8f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0x88, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xf8, 0x8f, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0x88, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf8, 0x8f,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0x88, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xf8, 0x8f, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0x88, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xf8, 0x8f, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0x88, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf8,
+    0x8f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0x88, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xf8, 0x7f, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0x87, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xf8, 0x6f, 0xfa,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0x74,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
+    0xf5, 0x2e, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x1e, 0xff, 0x20, 0xcf, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xc1, 0x7, 0xff, 0xe6, 0x10,
+    0x0, 0x0, 0x5, 0xef, 0xf7, 0x0, 0x1b, 0xff,
+    0xfc, 0x75, 0x45, 0x7b, 0xff, 0xfb, 0x10, 0x0,
+    0x2b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x20,
+    0x0, 0x0, 0x17, 0xdf, 0xff, 0xff, 0xff, 0xd6,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x25, 0x67, 0x65,
+    0x20, 0x0, 0x0, 0x0,
+    /* U+00E4 "ä" */
+    0x0, 0x0, 0x7d, 0xd4, 0x0, 0xad, 0xd3, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0x50, 0xb, 0xff, 0x30,
+    0x0, 0x0, 0x0, 0x9f, 0xf5, 0x0, 0xbf, 0xf3,
+    0x0, 0x0, 0x0, 0x3, 0x55, 0x20, 0x4, 0x55,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xac, 0xee,
+    0xda, 0x61, 0x0, 0x0, 0x0, 0x5d, 0xff, 0xff,
+    0xff, 0xff, 0xd4, 0x0, 0x0, 0x4e, 0xff, 0xb7,
+    0x67, 0xae, 0xff, 0xd1, 0x0, 0x1b, 0xff, 0x60,
+    0x0, 0x0, 0x3d, 0xff, 0x50, 0x3, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x15, 0x74,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x12, 0x8f, 0xf8, 0x0, 0x0,
+    0x1, 0x25, 0x79, 0xbe, 0xff, 0xff, 0x80, 0x0,
+    0x5, 0xcf, 0xff, 0xff, 0xfe, 0xdf, 0xf8, 0x0,
+    0x8, 0xff, 0xfe, 0xdb, 0x96, 0x35, 0xff, 0x80,
+    0x5, 0xff, 0xe7, 0x21, 0x0, 0x0, 0x5f, 0xf8,
+    0x0, 0xaf, 0xf7, 0x0, 0x0, 0x0, 0x6, 0xff,
+    0x80, 0x1c, 0xff, 0x30, 0x0, 0x0, 0x0, 0xbf,
+    0xf8, 0x0, 0xbf, 0xf5, 0x0, 0x0, 0x0, 0x6f,
+    0xff, 0x90, 0x7, 0xff, 0xd4, 0x0, 0x2, 0x8e,
+    0xff, 0xfa, 0x0, 0x1c, 0xff, 0xec, 0xbc, 0xef,
+    0xe7, 0xdf, 0xd0, 0x0, 0x2b, 0xff, 0xff, 0xff,
+    0xa2, 0xb, 0xff, 0x30, 0x0, 0x2, 0x57, 0x64,
+    0x10, 0x0, 0x11, 0x10,
+    /* U+00E5 "å" */
+    0x0, 0x0, 0x0, 0x3, 0x76, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xea, 0xbc, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xd6, 0x0, 0xb7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1e, 0x40, 0x8, 0x90,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xba, 0x23, 0xd5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xbe, 0xd8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x22,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5a, 0xce,
+    0xed, 0xa6, 0x10, 0x0, 0x0, 0x5, 0xdf, 0xff,
+    0xff, 0xff, 0xfd, 0x40, 0x0, 0x4, 0xef, 0xfb,
+    0x76, 0x7a, 0xef, 0xfd, 0x10, 0x1, 0xbf, 0xf6,
+    0x0, 0x0, 0x3, 0xdf, 0xf5, 0x0, 0x3f, 0xfb,
+    0x0, 0x0, 0x0, 0x7, 0xff, 0x80, 0x1, 0x57,
+    0x40, 0x0, 0x0, 0x0, 0x4f, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x28, 0xff, 0x80, 0x0,
+    0x0, 0x12, 0x57, 0x9b, 0xef, 0xff, 0xf8, 0x0,
+    0x0, 0x5c, 0xff, 0xff, 0xff, 0xed, 0xff, 0x80,
+    0x0, 0x8f, 0xff, 0xed, 0xb9, 0x63, 0x5f, 0xf8,
+    0x0, 0x5f, 0xfe, 0x72, 0x10, 0x0, 0x5, 0xff,
+    0x80, 0xa, 0xff, 0x70, 0x0, 0x0, 0x0, 0x6f,
+    0xf8, 0x1, 0xcf, 0xf3, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0x80, 0xb, 0xff, 0x50, 0x0, 0x0, 0x6,
+    0xff, 0xf9, 0x0, 0x7f, 0xfd, 0x40, 0x0, 0x28,
+    0xef, 0xff, 0xa0, 0x1, 0xcf, 0xfe, 0xcb, 0xce,
+    0xfe, 0x7d, 0xfd, 0x0, 0x2, 0xbf, 0xff, 0xff,
+    0xfa, 0x20, 0xbf, 0xf3, 0x0, 0x0, 0x25, 0x76,
+    0x41, 0x0, 0x1, 0x11, 0x0,
+    /* U+00E9 "é" */
+    0x0, 0x0, 0x0, 0x0, 0x1b, 0xdd, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xd2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xe3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x86, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x8c, 0xee,
+    0xb7, 0x10, 0x0, 0x0, 0x0, 0x19, 0xff, 0xff,
+    0xff, 0xfe, 0x60, 0x0, 0x0, 0x1a, 0xff, 0xea,
+    0x77, 0xae, 0xff, 0x60, 0x0, 0x7, 0xff, 0xd3,
+    0x0, 0x0, 0x4e, 0xfe, 0x30, 0x2, 0xdf, 0xe3,
+    0x0, 0x0, 0x0, 0x5f, 0xfa, 0x0, 0x6f, 0xfa,
+    0x0, 0x0, 0x0, 0x1, 0xcf, 0xf1, 0x9, 0xff,
+    0x50, 0x0, 0x0, 0x0, 0xa, 0xff, 0x40, 0xbf,
+    0xfb, 0x99, 0x99, 0x99, 0x99, 0xcf, 0xf6, 0x1c,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,
+    0xcf, 0xfb, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa5,
+    0xb, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x11,
+    0x0, 0x4, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x1c,
+    0xfd, 0x30, 0x1c, 0xff, 0x70, 0x0, 0x0, 0x7,
+    0xff, 0xd0, 0x0, 0x5e, 0xff, 0x93, 0x10, 0x28,
+    0xef, 0xf5, 0x0, 0x0, 0x6e, 0xff, 0xed, 0xde,
+    0xff, 0xf7, 0x0, 0x0, 0x0, 0x3b, 0xff, 0xff,
+    0xff, 0xc5, 0x0, 0x0, 0x0, 0x0, 0x2, 0x57,
+    0x75, 0x20, 0x0, 0x0,
+    /* U+00F6 "ö" */
+    0x0, 0x0, 0x7d, 0xd5, 0x0, 0x9d, 0xd3, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0x60, 0xb, 0xff, 0x40,
+    0x0, 0x0, 0x0, 0x8f, 0xf6, 0x0, 0xbf, 0xf4,
+    0x0, 0x0, 0x0, 0x3, 0x55, 0x20, 0x4, 0x55,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x9c, 0xde,
+    0xb7, 0x20, 0x0, 0x0, 0x0, 0x2a, 0xff, 0xff,
+    0xff, 0xfe, 0x70, 0x0, 0x0, 0x2c, 0xff, 0xea,
+    0x77, 0xbe, 0xff, 0x80, 0x0, 0xa, 0xff, 0xc2,
+    0x0, 0x0, 0x5e, 0xff, 0x50, 0x3, 0xef, 0xd2,
+    0x0, 0x0, 0x0, 0x6f, 0xfd, 0x0, 0x8f, 0xf7,
+    0x0, 0x0, 0x0, 0x1, 0xcf, 0xf3, 0xb, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0x8, 0xff, 0x61, 0xcf,
+    0xe1, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8, 0x1d,
+    0xfd, 0x10, 0x0, 0x0, 0x0, 0x4, 0xff, 0x91,
+    0xdf, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8,
+    0x1c, 0xff, 0x20, 0x0, 0x0, 0x0, 0x6, 0xff,
+    0x70, 0xaf, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xf5, 0x6, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x2d,
+    0xff, 0x10, 0x1d, 0xff, 0x50, 0x0, 0x0, 0x1a,
+    0xff, 0xa0, 0x0, 0x6f, 0xfe, 0x72, 0x1, 0x3a,
+    0xff, 0xe2, 0x0, 0x0, 0x7f, 0xff, 0xed, 0xde,
+    0xff, 0xd4, 0x0, 0x0, 0x0, 0x4c, 0xff, 0xff,
+    0xfe, 0x92, 0x0, 0x0, 0x0, 0x0, 0x2, 0x57,
+    0x64, 0x10, 0x0, 0x0,
+    /* U+00FC "ü" */
+    0x0, 0x8, 0xdd, 0x40, 0xa, 0xdc, 0x30, 0x0,
+    0x0, 0x9f, 0xf5, 0x0, 0xcf, 0xe3, 0x0, 0x0,
+    0x9, 0xff, 0x50, 0xc, 0xfe, 0x30, 0x0, 0x0,
+    0x35, 0x52, 0x0, 0x45, 0x51, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x16, 0x76, 0x0,
+    0x0, 0x0, 0x2, 0x77, 0x41, 0xdf, 0xd0, 0x0,
+    0x0, 0x0, 0x5f, 0xf8, 0x1d, 0xfd, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0x81, 0xdf, 0xd0, 0x0, 0x0,
+    0x0, 0x5f, 0xf8, 0x1d, 0xfd, 0x0, 0x0, 0x0,
+    0x5, 0xff, 0x81, 0xdf, 0xd0, 0x0, 0x0, 0x0,
+    0x5f, 0xf8, 0x1d, 0xfd, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0x81, 0xdf, 0xd0, 0x0, 0x0, 0x0, 0x5f,
+    0xf8, 0x1d, 0xfd, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0x81, 0xdf, 0xd0, 0x0, 0x0, 0x0, 0x5f, 0xf8,
+    0x1d, 0xfd, 0x0, 0x0, 0x0, 0x5, 0xff, 0x81,
+    0xdf, 0xd0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x1c,
+    0xff, 0x10, 0x0, 0x0, 0xb, 0xff, 0x80, 0xbf,
+    0xf6, 0x0, 0x0, 0x5, 0xff, 0xf8, 0x6, 0xff,
+    0xe6, 0x21, 0x38, 0xee, 0xff, 0x80, 0x1c, 0xff,
+    0xfe, 0xde, 0xfe, 0x7e, 0xf8, 0x0, 0x2a, 0xff,
+    0xff, 0xfc, 0x42, 0xdf, 0x80, 0x0, 0x1, 0x57,
+    0x63, 0x0, 0x1, 0x10,
+};
+
+static const lv_font_fmt_txt_glyph_dsc_t arial_32_glyph_dsc[] = {
+    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
+    {.bitmap_index = 0, .adv_w = 142, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 0, .adv_w = 142, .box_w = 5, .box_h = 23, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 58, .adv_w = 182, .box_w = 10, .box_h = 9, .ofs_x = 1, .ofs_y = 14},
+    {.bitmap_index = 103, .adv_w = 285, .box_w = 18, .box_h = 25, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 328, .adv_w = 285, .box_w = 16, .box_h = 30, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 568, .adv_w = 455, .box_w = 26, .box_h = 25, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 893, .adv_w = 341, .box_w = 20, .box_h = 25, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 1143, .adv_w = 98, .box_w = 4, .box_h = 9, .ofs_x = 1, .ofs_y = 14},
+    {.bitmap_index = 1161, .adv_w = 171, .box_w = 9, .box_h = 31, .ofs_x = 1, .ofs_y = -7},
+    {.bitmap_index = 1301, .adv_w = 171, .box_w = 9, .box_h = 31, .ofs_x = 1, .ofs_y = -7},
+    {.bitmap_index = 1441, .adv_w = 199, .box_w = 11, .box_h = 11, .ofs_x = 1, .ofs_y = 13},
+    {.bitmap_index = 1502, .adv_w = 299, .box_w = 16, .box_h = 16, .ofs_x = 1, .ofs_y = 3},
+    {.bitmap_index = 1630, .adv_w = 142, .box_w = 5, .box_h = 9, .ofs_x = 2, .ofs_y = -5},
+    {.bitmap_index = 1653, .adv_w = 171, .box_w = 10, .box_h = 4, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 1673, .adv_w = 142, .box_w = 5, .box_h = 4, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 1683, .adv_w = 142, .box_w = 9, .box_h = 25, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 1796, .adv_w = 285, .box_w = 16, .box_h = 24, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 1988, .adv_w = 285, .box_w = 9, .box_h = 24, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 2096, .adv_w = 285, .box_w = 17, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2292, .adv_w = 285, .box_w = 16, .box_h = 24, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 2484, .adv_w = 285, .box_w = 17, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2680, .adv_w = 285, .box_w = 16, .box_h = 24, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 2872, .adv_w = 285, .box_w = 16, .box_h = 24, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 3064, .adv_w = 285, .box_w = 16, .box_h = 24, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 3256, .adv_w = 285, .box_w = 16, .box_h = 24, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 3448, .adv_w = 285, .box_w = 16, .box_h = 24, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 3640, .adv_w = 142, .box_w = 5, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3683, .adv_w = 142, .box_w = 5, .box_h = 22, .ofs_x = 2, .ofs_y = -5},
+    {.bitmap_index = 3738, .adv_w = 299, .box_w = 16, .box_h = 16, .ofs_x = 1, .ofs_y = 3},
+    {.bitmap_index = 3866, .adv_w = 299, .box_w = 16, .box_h = 10, .ofs_x = 1, .ofs_y = 6},
+    {.bitmap_index = 3946, .adv_w = 299, .box_w = 16, .box_h = 16, .ofs_x = 1, .ofs_y = 3},
+    {.bitmap_index = 4074, .adv_w = 285, .box_w = 16, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4266, .adv_w = 520, .box_w = 31, .box_h = 31, .ofs_x = 1, .ofs_y = -7},
+    {.bitmap_index = 4747, .adv_w = 341, .box_w = 22, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5000, .adv_w = 341, .box_w = 18, .box_h = 23, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 5207, .adv_w = 370, .box_w = 21, .box_h = 25, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 5470, .adv_w = 370, .box_w = 20, .box_h = 23, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 5700, .adv_w = 341, .box_w = 18, .box_h = 23, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 5907, .adv_w = 313, .box_w = 17, .box_h = 23, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 6103, .adv_w = 398, .box_w = 22, .box_h = 25, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 6378, .adv_w = 370, .box_w = 19, .box_h = 23, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 6597, .adv_w = 142, .box_w = 5, .box_h = 23, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 6655, .adv_w = 256, .box_w = 14, .box_h = 24, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 6823, .adv_w = 341, .box_w = 20, .box_h = 23, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 7053, .adv_w = 285, .box_w = 15, .box_h = 23, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 7226, .adv_w = 427, .box_w = 23, .box_h = 23, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 7491, .adv_w = 370, .box_w = 19, .box_h = 23, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 7710, .adv_w = 398, .box_w = 23, .box_h = 25, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 7998, .adv_w = 341, .box_w = 19, .box_h = 24, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 8226, .adv_w = 398, .box_w = 23, .box_h = 26, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 8525, .adv_w = 370, .box_w = 21, .box_h = 23, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 8767, .adv_w = 341, .box_w = 19, .box_h = 25, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 9005, .adv_w = 313, .box_w = 20, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9235, .adv_w = 370, .box_w = 19, .box_h = 24, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 9463, .adv_w = 341, .box_w = 21, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9705, .adv_w = 483, .box_w = 30, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10050, .adv_w = 341, .box_w = 21, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10292, .adv_w = 341, .box_w = 21, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10534, .adv_w = 313, .box_w = 19, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10753, .adv_w = 142, .box_w = 8, .box_h = 30, .ofs_x = 1, .ofs_y = -7},
+    {.bitmap_index = 10873, .adv_w = 142, .box_w = 9, .box_h = 25, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 10986, .adv_w = 142, .box_w = 7, .box_h = 30, .ofs_x = 0, .ofs_y = -7},
+    {.bitmap_index = 11091, .adv_w = 240, .box_w = 15, .box_h = 13, .ofs_x = 0, .ofs_y = 11},
+    {.bitmap_index = 11189, .adv_w = 285, .box_w = 20, .box_h = 3, .ofs_x = -1, .ofs_y = -7},
+    {.bitmap_index = 11219, .adv_w = 171, .box_w = 7, .box_h = 6, .ofs_x = 1, .ofs_y = 18},
+    {.bitmap_index = 11240, .adv_w = 285, .box_w = 17, .box_h = 18, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 11393, .adv_w = 285, .box_w = 16, .box_h = 24, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 11585, .adv_w = 256, .box_w = 15, .box_h = 18, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 11720, .adv_w = 285, .box_w = 16, .box_h = 24, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 11912, .adv_w = 285, .box_w = 17, .box_h = 18, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 12065, .adv_w = 142, .box_w = 11, .box_h = 25, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 12203, .adv_w = 285, .box_w = 16, .box_h = 24, .ofs_x = 0, .ofs_y = -7},
+    {.bitmap_index = 12395, .adv_w = 285, .box_w = 15, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 12568, .adv_w = 114, .box_w = 4, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 12614, .adv_w = 114, .box_w = 7, .box_h = 30, .ofs_x = -2, .ofs_y = -7},
+    {.bitmap_index = 12719, .adv_w = 256, .box_w = 15, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 12892, .adv_w = 114, .box_w = 4, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 12938, .adv_w = 427, .box_w = 24, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 13142, .adv_w = 285, .box_w = 15, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 13270, .adv_w = 285, .box_w = 17, .box_h = 18, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 13423, .adv_w = 285, .box_w = 16, .box_h = 24, .ofs_x = 1, .ofs_y = -7},
+    {.bitmap_index = 13615, .adv_w = 285, .box_w = 16, .box_h = 24, .ofs_x = 0, .ofs_y = -7},
+    {.bitmap_index = 13807, .adv_w = 171, .box_w = 10, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 13892, .adv_w = 256, .box_w = 15, .box_h = 18, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 14027, .adv_w = 142, .box_w = 9, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 14131, .adv_w = 285, .box_w = 15, .box_h = 18, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 14266, .adv_w = 256, .box_w = 16, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 14402, .adv_w = 370, .box_w = 23, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 14598, .adv_w = 256, .box_w = 16, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 14734, .adv_w = 256, .box_w = 16, .box_h = 24, .ofs_x = 0, .ofs_y = -7},
+    {.bitmap_index = 14926, .adv_w = 256, .box_w = 16, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 15062, .adv_w = 171, .box_w = 11, .box_h = 31, .ofs_x = 0, .ofs_y = -7},
+    {.bitmap_index = 15233, .adv_w = 133, .box_w = 4, .box_h = 31, .ofs_x = 2, .ofs_y = -7},
+    {.bitmap_index = 15295, .adv_w = 171, .box_w = 10, .box_h = 31, .ofs_x = 0, .ofs_y = -7},
+    {.bitmap_index = 15450, .adv_w = 299, .box_w = 17, .box_h = 6, .ofs_x = 1, .ofs_y = 8},
+    {.bitmap_index = 15501, .adv_w = 341, .box_w = 22, .box_h = 28, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 15809, .adv_w = 341, .box_w = 22, .box_h = 28, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 16117, .adv_w = 341, .box_w = 18, .box_h = 29, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 16378, .adv_w = 398, .box_w = 23, .box_h = 29, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 16712, .adv_w = 370, .box_w = 19, .box_h = 29, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 16988, .adv_w = 285, .box_w = 17, .box_h = 24, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 17192, .adv_w = 285, .box_w = 17, .box_h = 25, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 17405, .adv_w = 285, .box_w = 17, .box_h = 24, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 17609, .adv_w = 285, .box_w = 17, .box_h = 24, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 17813, .adv_w = 285, .box_w = 15, .box_h = 24, .ofs_x = 1, .ofs_y = -1}
+};
+
+static const lv_font_fmt_txt_dsc_t arial_32_dsc = {
+    .glyph_bitmap = arial_32_bitmap,
+    .glyph_dsc = arial_32_glyph_dsc,
+    .cmaps = ui_font_cmaps,
+    .kern_dsc = NULL,
+    .kern_scale = 0,
+    .cmap_num = UI_FONT_CMAP_NUM,
+    .bpp = 4,
+    .kern_classes = 0,
+    .bitmap_format = 0,
+};
+
+const lv_font_t Arial_32 = {
+    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
+    .line_height = 36,          /*The maximum line height required by the font*/
+    .base_line = 7,             /*Baseline measured from the bottom of the line*/
+    .subpx = LV_FONT_SUBPX_NONE,
+    .underline_position = -3,
+    .underline_thickness = 2,
+    .dsc = &arial_32_dsc,          /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
+    .fallback = &lv_font_montserrat_14,
+    .user_data = NULL,
+};
+
+/*-----------------
+ *  Arial_48
+ *----------------*/
+
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t arial_48_bitmap[] = {
+    /* U+0020 " " */
+    /* U+0021 "!" */
+    0x44, 0x44, 0x42, 0xdf, 0xff, 0xf6, 0xdf, 0xff,
+    0xf6, 0xdf, 0xff, 0xf6, 0xdf, 0xff, 0xf6, 0xdf,
+    0xff, 0xf6, 0xdf, 0xff, 0xf6, 0xdf, 0xff, 0xf6,
+    0xdf, 0xff, 0xf6, 0xcf, 0xff, 0xe5, 0xbf, 0xff,
+    0xe4, 0xaf, 0xff, 0xe3, 0x9f, 0xff, 0xe2, 0x8f,
+    0xff, 0xe1, 0x7f, 0xff, 0xe0, 0x5f, 0xff, 0xd0,
+    0x4f, 0xff, 0xc0, 0x3f, 0xff, 0xb0, 0x3f, 0xff,
+    0xa0, 0x3e, 0xff, 0x90, 0x2d, 0xff, 0x80, 0x2c,
+    0xff, 0x70, 0x2b, 0xff, 0x60, 0x1b, 0xff, 0x50,
+    0x1a, 0xff, 0x30, 0x19, 0xff, 0x30, 0x4, 0x76,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8c, 0xcc, 0xb2, 0xbf, 0xff, 0xe3,
+    0xbf, 0xff, 0xe3, 0xbf, 0xff, 0xe3, 0xbf, 0xff,
+    0xe3,
+    /* U+0022 "\"" */
+    0x23, 0x33, 0x30, 0x0, 0x23, 0x33, 0x20, 0xad,
+    0xdd, 0xc1, 0x2, 0xbd, 0xdd, 0xa1, 0xcf, 0xff,
+    0xd2, 0x3, 0xdf, 0xff, 0xb1, 0xcf, 0xff, 0xd2,
+    0x3, 0xdf, 0xff, 0xb1, 0xcf, 0xff, 0xd2, 0x3,
+    0xdf, 0xff, 0xb1, 0xcf, 0xff, 0xd2, 0x3, 0xdf,
+    0xff, 0xb1, 0xcf, 0xff, 0xd1, 0x2, 0xcf, 0xff,
+    0xb1, 0x9f, 0xff, 0xd0, 0x1, 0xbf, 0xff, 0x90,
+    0x6f, 0xff, 0xb0, 0x0, 0xaf, 0xff, 0x60, 0x4f,
+    0xff, 0x80, 0x0, 0x7f, 0xfe, 0x50, 0x3e, 0xff,
+    0x60, 0x0, 0x5f, 0xfd, 0x40, 0x2c, 0xff, 0x30,
+    0x0, 0x2f, 0xfc, 0x20, 0x1a, 0xfe, 0x20, 0x0,
+    0xe, 0xfb, 0x0, 0x1, 0x11, 0x0, 0x0, 0x1,
+    0x11, 0x0,
+    /* U+0023 "#" */
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xe1, 0x0,
+    0x0, 0x0, 0x8f, 0xfe, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xfd, 0x0, 0x0, 0x0, 0x1a,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1c,
+    0xff, 0x90, 0x0, 0x0, 0x1, 0xdf, 0xf9, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xf7, 0x0,
+    0x0, 0x0, 0x2f, 0xff, 0x60, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xfe, 0x50, 0x0, 0x0, 0x5,
+    0xff, 0xe4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xd3, 0x0, 0x0, 0x0, 0x9f, 0xfc, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xfb, 0x10,
+    0x0, 0x0, 0xc, 0xff, 0xb1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1c, 0xff, 0xa0, 0x0, 0x0, 0x2,
+    0xdf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xdf, 0xf7, 0x0, 0x0, 0x0, 0x4d, 0xff, 0x60,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5e, 0xff, 0x40,
+    0x0, 0x0, 0x7, 0xff, 0xe3, 0x0, 0x0, 0x5b,
+    0xbb, 0xbb, 0xbc, 0xff, 0xfb, 0xbb, 0xbb, 0xbb,
+    0xdf, 0xff, 0xbb, 0xbb, 0x17, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf1, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16,
+    0xbb, 0xbb, 0xbc, 0xff, 0xfc, 0xbb, 0xbb, 0xbb,
+    0xcf, 0xff, 0xcb, 0xbb, 0xb1, 0x0, 0x0, 0x0,
+    0x4f, 0xff, 0x40, 0x0, 0x0, 0x6, 0xff, 0xe3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xd3,
+    0x0, 0x0, 0x0, 0x9f, 0xfc, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xbf, 0xfb, 0x10, 0x0, 0x0,
+    0xc, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1d, 0xff, 0x90, 0x0, 0x0, 0x2, 0xdf, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xef, 0xf6,
+    0x0, 0x0, 0x0, 0x5e, 0xfe, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6e, 0xfe, 0x30, 0x0, 0x0,
+    0x7, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xe1, 0x0, 0x0, 0x1, 0x9f, 0xfd,
+    0x0, 0x0, 0x0, 0x0, 0x11, 0x12, 0xaf, 0xfc,
+    0x11, 0x11, 0x11, 0x3c, 0xff, 0xb1, 0x11, 0x11,
+    0x10, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x17, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf1, 0x7f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x13, 0x66, 0x6c, 0xff, 0xd7, 0x66, 0x66,
+    0x66, 0xdf, 0xfc, 0x76, 0x66, 0x66, 0x60, 0x0,
+    0x0, 0xcf, 0xfa, 0x10, 0x0, 0x0, 0xe, 0xff,
+    0x91, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xff,
+    0x80, 0x0, 0x0, 0x2, 0xef, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xef, 0xe6, 0x0, 0x0,
+    0x0, 0x5e, 0xfe, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xfe, 0x30, 0x0, 0x0, 0x8, 0xff,
+    0xd2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xd1, 0x0, 0x0, 0x1, 0xaf, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xbf, 0xfb, 0x0, 0x0,
+    0x0, 0x2c, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2d, 0xff, 0x80, 0x0, 0x0, 0x3, 0xef,
+    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xef,
+    0xf4, 0x0, 0x0, 0x0, 0x5f, 0xff, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xfe, 0x20, 0x0,
+    0x0, 0x8, 0xff, 0xe2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0x55, 0x41, 0x0, 0x0, 0x0, 0x35,
+    0x54, 0x0, 0x0, 0x0, 0x0, 0x0,
+    /* U+0024 "$" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x15, 0x62, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3d, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x12, 0x7e, 0xf9, 0x31,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x5a,
+    0xef, 0xff, 0xff, 0xfe, 0xb5, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x2a, 0xef, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0xa2, 0x0, 0x0, 0x0, 0x3, 0xcf, 0xff,
+    0xff, 0xef, 0xfe, 0xff, 0xff, 0xfc, 0x30, 0x0,
+    0x0, 0x1b, 0xff, 0xff, 0xd7, 0x7d, 0xf9, 0x7c,
+    0xff, 0xff, 0xc1, 0x0, 0x0, 0x7f, 0xff, 0xfa,
+    0x10, 0x3d, 0xf7, 0x2, 0xaf, 0xff, 0xf7, 0x0,
+    0x2, 0xcf, 0xff, 0xa1, 0x0, 0x3d, 0xf7, 0x0,
+    0x1b, 0xff, 0xfc, 0x20, 0x4, 0xff, 0xfe, 0x40,
+    0x0, 0x3d, 0xf7, 0x0, 0x6, 0xef, 0xfe, 0x40,
+    0x7, 0xff, 0xfc, 0x0, 0x0, 0x3d, 0xf7, 0x0,
+    0x2, 0xdf, 0xfe, 0x60, 0x8, 0xff, 0xfb, 0x0,
+    0x0, 0x3d, 0xf7, 0x0, 0x0, 0x77, 0x43, 0x10,
+    0x8, 0xff, 0xfb, 0x0, 0x0, 0x3d, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xfd, 0x10,
+    0x0, 0x3d, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0xfe, 0x60, 0x0, 0x3d, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xff, 0xc3,
+    0x0, 0x3d, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xfd, 0x62, 0x3d, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xff, 0xff,
+    0xfc, 0xae, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xbf, 0xff, 0xff, 0xff, 0xfd, 0x84,
+    0x21, 0x0, 0x0, 0x0, 0x0, 0x0, 0x28, 0xef,
+    0xff, 0xff, 0xff, 0xff, 0xd9, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x38, 0xde, 0xff, 0xff, 0xff,
+    0xff, 0xe8, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x25, 0xae, 0xff, 0xff, 0xff, 0xff, 0xb1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3d, 0xfa, 0xae,
+    0xff, 0xff, 0xf9, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3d, 0xf7, 0x2, 0x8e, 0xff, 0xfe, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3d, 0xf7, 0x0,
+    0x6, 0xef, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3d, 0xf7, 0x0, 0x0, 0x8f, 0xff, 0xf1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3d, 0xf7, 0x0,
+    0x0, 0x3f, 0xff, 0xf4, 0x1, 0x24, 0x51, 0x0,
+    0x0, 0x3d, 0xf7, 0x0, 0x0, 0x1d, 0xff, 0xf6,
+    0x3b, 0xce, 0xf2, 0x0, 0x0, 0x3d, 0xf7, 0x0,
+    0x0, 0x1d, 0xff, 0xf6, 0x2e, 0xff, 0xf5, 0x0,
+    0x0, 0x3d, 0xf7, 0x0, 0x0, 0x1e, 0xff, 0xf5,
+    0x1e, 0xff, 0xfa, 0x0, 0x0, 0x3d, 0xf7, 0x0,
+    0x0, 0x3f, 0xff, 0xf3, 0xa, 0xff, 0xfe, 0x30,
+    0x0, 0x3d, 0xf7, 0x0, 0x0, 0x9f, 0xff, 0xe0,
+    0x5, 0xff, 0xff, 0xa1, 0x0, 0x3d, 0xf7, 0x0,
+    0x5, 0xef, 0xff, 0x90, 0x1, 0xbf, 0xff, 0xfa,
+    0x20, 0x3d, 0xf7, 0x1, 0x5d, 0xff, 0xfd, 0x30,
+    0x0, 0x3d, 0xff, 0xff, 0xc7, 0x6d, 0xf8, 0x59,
+    0xef, 0xff, 0xf6, 0x0, 0x0, 0x5, 0xef, 0xff,
+    0xff, 0xef, 0xfe, 0xef, 0xff, 0xff, 0x91, 0x0,
+    0x0, 0x0, 0x4b, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xd6, 0x10, 0x0, 0x0, 0x0, 0x2, 0x6b,
+    0xff, 0xff, 0xff, 0xff, 0xe9, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x14, 0x8e, 0xf9, 0x42,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3d, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3d, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3d, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2a, 0xc5, 0x0,
+    0x0, 0x0, 0x0, 0x0,
+    /* U+0025 "%" */
+    0x0, 0x0, 0x38, 0xce, 0xec, 0x83, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xfd, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xdf, 0xff, 0xff,
+    0xfd, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0xf9, 0x10, 0x0, 0x0, 0x0, 0x0, 0x4e,
+    0xff, 0xfd, 0xde, 0xff, 0xf6, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xef, 0xd3, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xcf, 0xfe, 0x73, 0x26, 0xcf, 0xfd,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x2b, 0xff, 0x90,
+    0x0, 0x0, 0x0, 0x0, 0x6, 0xef, 0xf7, 0x0,
+    0x0, 0x3e, 0xff, 0x91, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xfd, 0x30, 0x0, 0x0, 0x0, 0x0, 0x1a,
+    0xff, 0xd1, 0x0, 0x0, 0xa, 0xff, 0xd2, 0x0,
+    0x0, 0x0, 0x1, 0xcf, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2c, 0xff, 0xb0, 0x0, 0x0, 0x7,
+    0xff, 0xf3, 0x0, 0x0, 0x0, 0x6, 0xff, 0xd3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0xff, 0x90,
+    0x0, 0x0, 0x4, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x2c, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4e, 0xff, 0x80, 0x0, 0x0, 0x4, 0xff, 0xf6,
+    0x0, 0x0, 0x0, 0x6f, 0xfd, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4e, 0xff, 0x70, 0x0, 0x0,
+    0x4, 0xff, 0xf7, 0x0, 0x0, 0x1, 0xef, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0xff,
+    0x80, 0x0, 0x0, 0x4, 0xff, 0xf6, 0x0, 0x0,
+    0x7, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3d, 0xff, 0x90, 0x0, 0x0, 0x5, 0xff,
+    0xf4, 0x0, 0x0, 0x3d, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2b, 0xff, 0xc0, 0x0,
+    0x0, 0x8, 0xff, 0xf2, 0x0, 0x0, 0x7f, 0xfd,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0xe3, 0x0, 0x0, 0x1d, 0xff, 0xb1, 0x0,
+    0x2, 0xef, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xef, 0xfa, 0x10, 0x0, 0x7f,
+    0xfe, 0x70, 0x0, 0x8, 0xff, 0xc2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
+    0xc7, 0x6b, 0xef, 0xfb, 0x10, 0x0, 0x3d, 0xff,
+    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1a, 0xff, 0xff, 0xff, 0xff, 0xc3, 0x0,
+    0x0, 0x8f, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x8d, 0xef, 0xff,
+    0xe9, 0x20, 0x0, 0x2, 0xef, 0xf6, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0x68, 0x86, 0x30, 0x0, 0x0, 0x9, 0xff,
+    0xb2, 0x0, 0x0, 0x3, 0x68, 0x87, 0x51, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3d, 0xff, 0x60, 0x0, 0x1, 0x8d, 0xff,
+    0xff, 0xeb, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x9f, 0xfc, 0x0, 0x0,
+    0x1a, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xef,
+    0xf5, 0x0, 0x0, 0x7f, 0xff, 0xd6, 0x58, 0xef,
+    0xfd, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0xa1, 0x0, 0x2, 0xef, 0xfc,
+    0x10, 0x0, 0x3e, 0xff, 0xb1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4e, 0xfe, 0x50, 0x0,
+    0x6, 0xff, 0xe6, 0x0, 0x0, 0x8, 0xff, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xaf,
+    0xfb, 0x0, 0x0, 0xa, 0xff, 0xd2, 0x0, 0x0,
+    0x4, 0xef, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xef, 0xe4, 0x0, 0x0, 0x2b, 0xff,
+    0xc0, 0x0, 0x0, 0x3, 0xdf, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xa1, 0x0,
+    0x0, 0x2c, 0xff, 0xb0, 0x0, 0x0, 0x2, 0xcf,
+    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e,
+    0xfe, 0x40, 0x0, 0x0, 0x2c, 0xff, 0xb0, 0x0,
+    0x0, 0x2, 0xcf, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xbf, 0xfa, 0x0, 0x0, 0x0, 0x2c,
+    0xff, 0xb0, 0x0, 0x0, 0x3, 0xdf, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xef, 0xe3, 0x0,
+    0x0, 0x0, 0x1b, 0xff, 0xc0, 0x0, 0x0, 0x3,
+    0xdf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0xff, 0x91, 0x0, 0x0, 0x0, 0x9, 0xff, 0xd2,
+    0x0, 0x0, 0x5, 0xef, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xfd, 0x40, 0x0, 0x0, 0x0,
+    0x5, 0xff, 0xe7, 0x0, 0x0, 0xa, 0xff, 0xe2,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xbf, 0xf9, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xdf, 0xfd, 0x40, 0x1,
+    0x5e, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0xff, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5e,
+    0xff, 0xea, 0x8b, 0xff, 0xfc, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0xd, 0xff, 0x90, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x17, 0xff, 0xff, 0xff, 0xff, 0xe4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xfd, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4b, 0xdf,
+    0xfe, 0xd9, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x46, 0x64, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x45, 0x65, 0x30, 0x0, 0x0,
+    /* U+0026 "&" */
+    0x0, 0x0, 0x0, 0x0, 0x15, 0xad, 0xee, 0xc9,
+    0x41, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4b, 0xff, 0xff, 0xff, 0xfe, 0xa2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xff,
+    0xfe, 0x98, 0x8c, 0xff, 0xff, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xfc, 0x41,
+    0x0, 0x19, 0xff, 0xfe, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0xff, 0x30, 0x0, 0x0,
+    0x2c, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x8f,
+    0xff, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xfb, 0x0, 0x0, 0x0, 0x7, 0xff, 0xfb,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
+    0xe1, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xb1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x70,
+    0x0, 0x0, 0x2c, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2e, 0xff, 0xfd, 0x30, 0x0,
+    0x7, 0xff, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0xfd, 0x20, 0x29, 0xff,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xcf, 0xff, 0xfa, 0x5b, 0xff, 0xff, 0xb2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xef, 0xff, 0xff, 0xff, 0xff, 0xa1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xef,
+    0xff, 0xff, 0xfe, 0x71, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x6d, 0xff, 0xff,
+    0xfc, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xaf, 0xff, 0xff, 0xff, 0xc2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x17, 0xef, 0xff, 0xfe, 0xff, 0xff, 0xa1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x19, 0xff,
+    0xff, 0xf9, 0x6e, 0xff, 0xff, 0x81, 0x0, 0x0,
+    0x21, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xd6,
+    0x10, 0x7f, 0xff, 0xfe, 0x50, 0x0, 0xd, 0xca,
+    0x62, 0x0, 0x6, 0xef, 0xff, 0xc3, 0x0, 0x1,
+    0x9f, 0xff, 0xfd, 0x30, 0x3, 0xff, 0xff, 0x60,
+    0x2, 0xcf, 0xff, 0xd4, 0x0, 0x0, 0x1, 0xcf,
+    0xff, 0xfb, 0x20, 0x8f, 0xff, 0xf2, 0x0, 0x6f,
+    0xff, 0xf7, 0x0, 0x0, 0x0, 0x3, 0xcf, 0xff,
+    0xfa, 0x2c, 0xff, 0xfb, 0x10, 0xa, 0xff, 0xfd,
+    0x20, 0x0, 0x0, 0x0, 0x5, 0xef, 0xff, 0xfb,
+    0xef, 0xff, 0x70, 0x0, 0xdf, 0xff, 0xa0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xef, 0xff, 0xff, 0xff,
+    0xd2, 0x0, 0xe, 0xff, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x19, 0xff, 0xff, 0xff, 0xf8, 0x0,
+    0x0, 0xdf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1b, 0xff, 0xff, 0xfd, 0x10, 0x0, 0xb,
+    0xff, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3e, 0xff, 0xff, 0xc1, 0x0, 0x0, 0x7f, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xff, 0xff, 0x81, 0x0, 0x3, 0xdf, 0xff, 0xd4,
+    0x0, 0x0, 0x0, 0x0, 0x17, 0xef, 0xff, 0xff,
+    0xfe, 0x70, 0x0, 0x8, 0xff, 0xff, 0xd3, 0x0,
+    0x0, 0x0, 0x29, 0xef, 0xff, 0xff, 0xff, 0xfe,
+    0x70, 0x0, 0x1b, 0xff, 0xff, 0xe8, 0x43, 0x35,
+    0x8d, 0xff, 0xff, 0xe7, 0xaf, 0xff, 0xfe, 0x81,
+    0x0, 0x4d, 0xff, 0xff, 0xfe, 0xdd, 0xef, 0xff,
+    0xff, 0xe6, 0x2, 0xcf, 0xff, 0xff, 0x90, 0x0,
+    0x3b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3,
+    0x0, 0x2, 0xbf, 0xff, 0xd3, 0x0, 0x0, 0x27,
+    0xdf, 0xff, 0xff, 0xff, 0xfc, 0x62, 0x0, 0x0,
+    0x2, 0xbf, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x37,
+    0x9a, 0xa9, 0x63, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0x76, 0x0,
+    /* U+0027 "'" */
+    0x23, 0x33, 0x20, 0xcd, 0xdd, 0xb0, 0xdf, 0xff,
+    0xd1, 0xdf, 0xff, 0xd1, 0xdf, 0xff, 0xd1, 0xdf,
+    0xff, 0xd1, 0xdf, 0xff, 0xd0, 0xbf, 0xff, 0xc0,
+    0x9f, 0xff, 0x90, 0x6f, 0xff, 0x60, 0x4f, 0xff,
+    0x30, 0x3d, 0xfe, 0x20, 0x2c, 0xfc, 0x20, 0x1,
+    0x11, 0x0,
+    /* U+0028 "(" */
+    0x0, 0x0, 0x0, 0x0, 0x19, 0xa8, 0x20, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0x90, 0x0, 0x0, 0x0,
+    0x5, 0xef, 0xe1, 0x0, 0x0, 0x0, 0x1, 0xdf,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xfc, 0x20,
+    0x0, 0x0, 0x0, 0x4d, 0xff, 0x60, 0x0, 0x0,
+    0x0, 0x1a, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xfd,
+    0x30, 0x0, 0x0, 0x0, 0x4e, 0xff, 0x91, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xe5, 0x0, 0x0, 0x0,
+    0x3, 0xdf, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x6f,
+    0xff, 0xb0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xf6,
+    0x0, 0x0, 0x0, 0x1, 0xef, 0xfe, 0x30, 0x0,
+    0x0, 0x0, 0x5e, 0xff, 0xc2, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xfa, 0x10, 0x0, 0x0, 0x0, 0x9f,
+    0xff, 0x90, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0x2, 0xcf, 0xff, 0x70, 0x0,
+    0x0, 0x0, 0x2d, 0xff, 0xe6, 0x0, 0x0, 0x0,
+    0x3, 0xdf, 0xfe, 0x50, 0x0, 0x0, 0x0, 0x3d,
+    0xff, 0xe5, 0x0, 0x0, 0x0, 0x3, 0xdf, 0xfe,
+    0x50, 0x0, 0x0, 0x0, 0x3d, 0xff, 0xe5, 0x0,
+    0x0, 0x0, 0x2, 0xcf, 0xfe, 0x60, 0x0, 0x0,
+    0x0, 0x2b, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x1,
+    0xaf, 0xff, 0x80, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0xfa, 0x10, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xc2,
+    0x0, 0x0, 0x0, 0x3, 0xef, 0xfe, 0x30, 0x0,
+    0x0, 0x0, 0xd, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x4,
+    0xef, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x2c, 0xff,
+    0xe3, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x2, 0xdf, 0xfb, 0x10, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xe4, 0x0, 0x0, 0x0,
+    0x0, 0x3d, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x2, 0xdf,
+    0xf9, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xd3,
+    0x0, 0x0, 0x0, 0x0, 0x1b, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x4d, 0xfe, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x5f, 0xfb, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x44, 0x41,
+    /* U+0029 ")" */
+    0x17, 0xa9, 0x20, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xfa, 0x0, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xe7,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xd3, 0x0,
+    0x0, 0x0, 0x0, 0x1b, 0xff, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0x5e, 0xfe, 0x50, 0x0, 0x0, 0x0,
+    0x1, 0xbf, 0xfb, 0x20, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xff,
+    0xd0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x60,
+    0x0, 0x0, 0x0, 0x4, 0xdf, 0xfa, 0x10, 0x0,
+    0x0, 0x0, 0x1b, 0xff, 0xe4, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xff,
+    0xf2, 0x0, 0x0, 0x0, 0x1, 0xbf, 0xff, 0x60,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xb1, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0xfc, 0x20, 0x0, 0x0, 0x0, 0x5e,
+    0xff, 0xd3, 0x0, 0x0, 0x0, 0x4, 0xef, 0xfe,
+    0x40, 0x0, 0x0, 0x0, 0x4d, 0xff, 0xe4, 0x0,
+    0x0, 0x0, 0x3, 0xdf, 0xfe, 0x50, 0x0, 0x0,
+    0x0, 0x3d, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x4,
+    0xef, 0xfd, 0x40, 0x0, 0x0, 0x0, 0x4e, 0xff,
+    0xd4, 0x0, 0x0, 0x0, 0x5, 0xff, 0xfd, 0x30,
+    0x0, 0x0, 0x0, 0x6f, 0xff, 0xc1, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x1,
+    0xaf, 0xff, 0x80, 0x0, 0x0, 0x0, 0x1d, 0xff,
+    0xf4, 0x0, 0x0, 0x0, 0x2, 0xff, 0xfe, 0x10,
+    0x0, 0x0, 0x0, 0x6f, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x2,
+    0xdf, 0xfd, 0x30, 0x0, 0x0, 0x0, 0x6f, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x19, 0xff, 0xf3, 0x0,
+    0x0, 0x0, 0x3, 0xef, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x2d,
+    0xff, 0x91, 0x0, 0x0, 0x0, 0x7, 0xff, 0xe3,
+    0x0, 0x0, 0x0, 0x2, 0xcf, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xfc, 0x20, 0x0, 0x0, 0x0,
+    0x2d, 0xfe, 0x50, 0x0, 0x0, 0x0, 0x19, 0xff,
+    0x70, 0x0, 0x0, 0x0, 0x1, 0x34, 0x41, 0x0,
+    0x0, 0x0, 0x0,
+    /* U+002A "*" */
+    0x0, 0x0, 0x0, 0x7f, 0xfd, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7, 0xff, 0xd0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6e, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0x32, 0x0, 0x5, 0xef, 0xa0, 0x0,
+    0x14, 0x10, 0xa, 0xea, 0x52, 0x4d, 0xf8, 0x13,
+    0x8d, 0xd4, 0x2, 0xef, 0xff, 0xc9, 0xef, 0xaa,
+    0xef, 0xff, 0x80, 0x5e, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xea, 0x10, 0x36, 0x9b, 0xdf, 0xff,
+    0xfe, 0xcb, 0x95, 0x20, 0x0, 0x0, 0x16, 0xef,
+    0xff, 0xa3, 0x10, 0x0, 0x0, 0x0, 0x3, 0xcf,
+    0xfd, 0xff, 0x80, 0x0, 0x0, 0x0, 0x2, 0xbf,
+    0xfb, 0x6e, 0xfe, 0x60, 0x0, 0x0, 0x1, 0xbf,
+    0xfd, 0x31, 0x9f, 0xfe, 0x50, 0x0, 0x0, 0x6e,
+    0xff, 0x80, 0x2, 0xef, 0xfc, 0x10, 0x0, 0x0,
+    0x7d, 0xc1, 0x0, 0x6, 0xeb, 0x30, 0x0, 0x0,
+    0x0, 0x43, 0x0, 0x0, 0x15, 0x10, 0x0, 0x0,
+    /* U+002B "+" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x12, 0x21, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xcf, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xfd, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xcf, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xfd, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xcf, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xfd, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xcf, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xfd, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x12, 0x22, 0x22, 0x22,
+    0x24, 0xdf, 0xfd, 0x42, 0x22, 0x22, 0x22, 0x21,
+    0x4d, 0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0xff, 0xed,
+    0xdd, 0xdd, 0xdd, 0xd5, 0x5f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
+    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf6, 0x4e, 0xee, 0xee, 0xee,
+    0xee, 0xff, 0xff, 0xee, 0xee, 0xee, 0xee, 0xe5,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xfd, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xcf, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xfd, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xcf, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xfd, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xcf, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xfd, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xcf, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xfd, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x68, 0x87, 0x10, 0x0, 0x0, 0x0, 0x0,
+    /* U+002C "," */
+    0x9c, 0xcc, 0xb1, 0xbf, 0xff, 0xe2, 0xbf, 0xff,
+    0xe2, 0xbf, 0xff, 0xe2, 0xbf, 0xff, 0xe2, 0x0,
+    0x6f, 0xe2, 0x0, 0x8f, 0xe0, 0x0, 0xbf, 0xc0,
+    0x4, 0xef, 0x70, 0x5d, 0xfc, 0x20, 0xaf, 0xc4,
+    0x0, 0x27, 0x20, 0x0,
+    /* U+002D "-" */
+    0x47, 0x77, 0x77, 0x77, 0x77, 0x77, 0x73, 0x8f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x8f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf7, 0x8f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf7, 0x5b, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xbb, 0xb5,
+    /* U+002E "." */
+    0x8c, 0xcc, 0xb2, 0xaf, 0xff, 0xe3, 0xaf, 0xff,
+    0xe3, 0xaf, 0xff, 0xe3, 0xaf, 0xff, 0xe3,
+    /* U+002F "/" */
+    0x0, 0x0, 0x0, 0x0, 0x2, 0x9a, 0xa2, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0xf1, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0x1d, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xfc, 0x20, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xdf, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xef, 0xf1, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0x1c, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xfc, 0x20, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xdf, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xef, 0xe2, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x2b, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x3e, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x6f,
+    0xfc, 0x20, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf9,
+    0x10, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xef, 0xe3, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xd0, 0x0, 0x0, 0x0,
+    0x0, 0x2b, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x3e, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x6f,
+    0xfd, 0x20, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xfa,
+    0x10, 0x0, 0x0, 0x0, 0x1, 0xef, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0xe4, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xc1, 0x0, 0x0, 0x0,
+    0x0, 0x1b, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0x3d, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x6f,
+    0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xfb,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x9a, 0xa5, 0x0,
+    0x0, 0x0, 0x0, 0x0,
+    /* U+0030 "0" */
+    0x0, 0x0, 0x0, 0x0, 0x12, 0x44, 0x44, 0x31,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0x9c, 0xef, 0xfe, 0xdb, 0x61, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0x9e, 0xff, 0xff, 0xff, 0xff,
+    0xfc, 0x40, 0x0, 0x0, 0x0, 0x0, 0x2a, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xe5, 0x0, 0x0,
+    0x0, 0x1, 0xaf, 0xff, 0xfc, 0x74, 0x35, 0xbe,
+    0xff, 0xfd, 0x40, 0x0, 0x0, 0x6, 0xff, 0xff,
+    0x81, 0x0, 0x0, 0x16, 0xef, 0xff, 0xb0, 0x0,
+    0x0, 0x1d, 0xff, 0xf9, 0x10, 0x0, 0x0, 0x0,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x6e, 0xff, 0xd2,
+    0x0, 0x0, 0x0, 0x0, 0x19, 0xff, 0xfb, 0x10,
+    0x1, 0xaf, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xef, 0xfd, 0x30, 0x3, 0xdf, 0xfe, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0x70,
+    0x4, 0xff, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0xff, 0xa0, 0x7, 0xff, 0xfc, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xe0,
+    0xa, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xff, 0xf0, 0xc, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xf3,
+    0xd, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2f, 0xff, 0xf4, 0xe, 0xff, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xf5,
+    0xe, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1d, 0xff, 0xf5, 0x1e, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xff, 0xf6,
+    0x1e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1d, 0xff, 0xf6, 0xe, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xff, 0xf5,
+    0xe, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1e, 0xff, 0xf5, 0xe, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xf4,
+    0xc, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2f, 0xff, 0xf3, 0xa, 0xff, 0xf9, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf1,
+    0x8, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5f, 0xff, 0xe0, 0x5, 0xff, 0xfd, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xc0,
+    0x3, 0xef, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xbf, 0xff, 0x80, 0x2, 0xbf, 0xff, 0x60,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xdf, 0xff, 0x50,
+    0x0, 0x8f, 0xff, 0xb1, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xef, 0xfc, 0x20, 0x0, 0x3e, 0xff, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0x2d, 0xff, 0xf8, 0x0,
+    0x0, 0xa, 0xff, 0xfd, 0x40, 0x0, 0x0, 0x2,
+    0xbf, 0xff, 0xe2, 0x0, 0x0, 0x3, 0xdf, 0xff,
+    0xe8, 0x31, 0x12, 0x6c, 0xff, 0xfe, 0x60, 0x0,
+    0x0, 0x0, 0x5e, 0xff, 0xff, 0xdc, 0xbc, 0xef,
+    0xff, 0xf9, 0x10, 0x0, 0x0, 0x0, 0x5, 0xdf,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x39, 0xff, 0xff, 0xff, 0xff,
+    0xc5, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x15, 0x9a, 0xa9, 0x73, 0x0, 0x0, 0x0, 0x0,
+    /* U+0031 "1" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x15, 0x65, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xd1, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xdf, 0xfd, 0x10, 0x0,
+    0x0, 0x0, 0x1, 0xcf, 0xff, 0xd1, 0x0, 0x0,
+    0x0, 0x2, 0xbf, 0xff, 0xfd, 0x10, 0x0, 0x0,
+    0x3, 0xcf, 0xff, 0xff, 0xd1, 0x0, 0x0, 0x15,
+    0xcf, 0xff, 0xff, 0xfd, 0x10, 0x0, 0x39, 0xff,
+    0xff, 0xff, 0xff, 0xd1, 0x1, 0x7d, 0xff, 0xff,
+    0xfa, 0xff, 0xfd, 0x11, 0xaf, 0xff, 0xff, 0xc4,
+    0x5f, 0xff, 0xd1, 0x1b, 0xff, 0xff, 0x92, 0x5,
+    0xff, 0xfd, 0x11, 0xbf, 0xeb, 0x30, 0x0, 0x5f,
+    0xff, 0xd1, 0x1b, 0xb5, 0x10, 0x0, 0x5, 0xff,
+    0xfd, 0x10, 0x10, 0x0, 0x0, 0x0, 0x5f, 0xff,
+    0xd1, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xfd,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xd1,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xfd, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xd1, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0xfd, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xff, 0xd1, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xfd, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x5f, 0xff, 0xd1, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0xfd, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x5f, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xff, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x5f, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x5f,
+    0xff, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
+    0xd1, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xfd,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xd1,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xfd, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xd1, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0xfd, 0x10,
+    /* U+0032 "2" */
+    0x0, 0x0, 0x0, 0x0, 0x13, 0x44, 0x44, 0x43,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x27,
+    0xbd, 0xef, 0xff, 0xed, 0xa6, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x16, 0xef, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xc4, 0x0, 0x0, 0x0, 0x1, 0x9f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x60, 0x0,
+    0x0, 0x8, 0xff, 0xff, 0xea, 0x53, 0x24, 0x7c,
+    0xef, 0xff, 0xe4, 0x0, 0x0, 0x4e, 0xff, 0xfc,
+    0x40, 0x0, 0x0, 0x1, 0x8e, 0xff, 0xfc, 0x20,
+    0x1, 0xaf, 0xff, 0xc3, 0x0, 0x0, 0x0, 0x0,
+    0x18, 0xef, 0xff, 0x60, 0x3, 0xef, 0xfe, 0x60,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xbf, 0xff, 0xb0,
+    0x6, 0xff, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xe0, 0x9, 0xff, 0xfb, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf1,
+    0x6, 0xac, 0xea, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xbf, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xef, 0xff, 0x70,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1b, 0xff, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf8, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0xef, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6e, 0xff, 0xfe, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x16, 0xef,
+    0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7e, 0xff, 0xfe, 0x60, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0xff, 0xff,
+    0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xae, 0xff, 0xfe, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3c, 0xff, 0xff, 0xc4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xdf, 0xff, 0xfc, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6d, 0xff, 0xff, 0xa2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xef,
+    0xff, 0xf9, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6e, 0xff, 0xfe, 0x71, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xdf, 0xff,
+    0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2d, 0xff, 0xfe, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xaf, 0xff, 0xe7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xef, 0xff, 0xb2, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x20, 0xc, 0xff, 0xff, 0xfe,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe2,
+    0x3e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf2, 0x7f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
+    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf2,
+    /* U+0033 "3" */
+    0x0, 0x0, 0x0, 0x2, 0x34, 0x44, 0x42, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x28, 0xbd,
+    0xff, 0xfe, 0xca, 0x51, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xb4,
+    0x0, 0x0, 0x0, 0x1, 0x8e, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xd5, 0x0, 0x0, 0x0, 0x7e,
+    0xff, 0xfe, 0x94, 0x23, 0x5b, 0xef, 0xff, 0xd4,
+    0x0, 0x0, 0x3d, 0xff, 0xfc, 0x30, 0x0, 0x0,
+    0x16, 0xef, 0xff, 0xb0, 0x0, 0x9, 0xff, 0xfd,
+    0x40, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0x40,
+    0x3, 0xdf, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x1c, 0xff, 0xf8, 0x0, 0x4f, 0xff, 0xe3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xa1, 0x4,
+    0xab, 0xdb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xfb, 0x10, 0x0, 0x23, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9f, 0xff, 0xa1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2c, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xff, 0xfe, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x17, 0xef, 0xff, 0x90,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x7b,
+    0xff, 0xff, 0xb2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xdd, 0xef, 0xff, 0xfe, 0x91, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff,
+    0xb4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xfe, 0xef, 0xff, 0xff, 0xd9, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x68, 0x66, 0x79, 0xdf, 0xff,
+    0xfd, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0x9f, 0xff, 0xfb, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x8f, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xdf, 0xff, 0xe0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2f, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xff, 0x82,
+    0x46, 0x83, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2e, 0xff, 0xf8, 0xde, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0x6b, 0xff,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
+    0xff, 0xf3, 0x7f, 0xff, 0xe5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1c, 0xff, 0xfd, 0x3, 0xdf, 0xff,
+    0xb1, 0x0, 0x0, 0x0, 0x0, 0x18, 0xef, 0xff,
+    0x70, 0x8, 0xff, 0xff, 0x91, 0x0, 0x0, 0x0,
+    0x17, 0xef, 0xff, 0xc2, 0x0, 0x1b, 0xff, 0xff,
+    0xb5, 0x21, 0x12, 0x5a, 0xff, 0xff, 0xe4, 0x0,
+    0x0, 0x3c, 0xff, 0xff, 0xec, 0xcc, 0xce, 0xff,
+    0xff, 0xe6, 0x0, 0x0, 0x0, 0x3a, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xb4, 0x0, 0x0, 0x0,
+    0x0, 0x16, 0xdf, 0xff, 0xff, 0xff, 0xfd, 0x72,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x37, 0x9a,
+    0xa9, 0x73, 0x0, 0x0, 0x0, 0x0,
+    /* U+0034 "4" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0x34, 0x43, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4e, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2d, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x19, 0xff, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xef, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xef, 0xff, 0xff,
+    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xaf, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xdf,
+    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3e, 0xff, 0xc9, 0xff, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2c, 0xff, 0xd3,
+    0x8f, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0xf7, 0x8, 0xff, 0xfb, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xfa,
+    0x0, 0x8f, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xcf, 0xfd, 0x30, 0x8, 0xff, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xaf, 0xfe,
+    0x50, 0x0, 0x8f, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0x90, 0x0, 0x8, 0xff,
+    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4d, 0xff,
+    0xc2, 0x0, 0x0, 0x8f, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0x1b, 0xff, 0xe4, 0x0, 0x0, 0x8,
+    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0x5, 0xef, 0xfb, 0x10, 0x0, 0x0,
+    0x8, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x2, 0xcf,
+    0xfe, 0x40, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xb0,
+    0x0, 0x0, 0x1, 0xaf, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x6f,
+    0xff, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
+    0xb0, 0x0, 0x0, 0x3d, 0xff, 0xe6, 0x33, 0x33,
+    0x33, 0x33, 0x39, 0xff, 0xfc, 0x33, 0x33, 0x15,
+    0xff, 0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xef,
+    0xff, 0xfd, 0xdd, 0xd5, 0x5f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x55, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf5, 0x4c, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcd, 0xff, 0xfe, 0xcc,
+    0xcc, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xfb, 0x0, 0x0, 0x0,
+    /* U+0035 "5" */
+    0x0, 0x1, 0x89, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x82, 0x0, 0x0, 0x3e, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x40, 0x0,
+    0x5, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xe4, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0x40, 0x0, 0x1a,
+    0xff, 0xfa, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x62, 0x0, 0x2, 0xcf, 0xfe, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0xff,
+    0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x90,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xa, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e,
+    0xff, 0xd2, 0x1, 0x58, 0x99, 0x86, 0x20, 0x0,
+    0x0, 0x0, 0x4, 0xef, 0xfb, 0x49, 0xdf, 0xff,
+    0xff, 0xfe, 0xb4, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x10,
+    0x0, 0x9, 0xff, 0xff, 0xff, 0xfe, 0xdd, 0xef,
+    0xff, 0xff, 0xfa, 0x10, 0x1, 0xbf, 0xff, 0xff,
+    0xc8, 0x54, 0x45, 0x8c, 0xff, 0xff, 0xf8, 0x0,
+    0x2c, 0xff, 0xfe, 0x82, 0x0, 0x0, 0x0, 0x28,
+    0xef, 0xff, 0xe4, 0x3, 0xce, 0xfe, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0x17, 0xef, 0xff, 0xb0, 0x2,
+    0x34, 0x51, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b,
+    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xff, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef,
+    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1b, 0xff, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xaf, 0xff,
+    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1b, 0xff, 0xfa, 0x1, 0x23, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xff, 0x9d,
+    0xee, 0xe9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2e, 0xff, 0xf6, 0xcf, 0xff, 0xc1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x28, 0xff,
+    0xfe, 0x50, 0x0, 0x0, 0x0, 0x0, 0x1, 0xcf,
+    0xff, 0xc0, 0x3e, 0xff, 0xfb, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x8e, 0xff, 0xe6, 0x1, 0x9f, 0xff,
+    0xf9, 0x10, 0x0, 0x0, 0x1, 0x7e, 0xff, 0xfa,
+    0x10, 0x2, 0xdf, 0xff, 0xfb, 0x52, 0x11, 0x25,
+    0xaf, 0xff, 0xfd, 0x30, 0x0, 0x4, 0xdf, 0xff,
+    0xfe, 0xcb, 0xcc, 0xef, 0xff, 0xfd, 0x50, 0x0,
+    0x0, 0x3, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfb, 0x30, 0x0, 0x0, 0x0, 0x2, 0x7d, 0xff,
+    0xff, 0xff, 0xff, 0xd7, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0x79, 0xaa, 0x97, 0x30, 0x0,
+    0x0, 0x0, 0x0,
+    /* U+0036 "6" */
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x34, 0x44, 0x43,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0x6a, 0xde, 0xff, 0xed, 0xa7, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5d, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xd4, 0x0, 0x0, 0x0, 0x0, 0x6, 0xef,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x60, 0x0,
+    0x0, 0x0, 0x6e, 0xff, 0xfe, 0xa5, 0x33, 0x6b,
+    0xef, 0xff, 0xe3, 0x0, 0x0, 0x4, 0xdf, 0xff,
+    0xc5, 0x0, 0x0, 0x1, 0x7e, 0xff, 0xfa, 0x10,
+    0x0, 0xa, 0xff, 0xfd, 0x30, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xfe, 0x40, 0x0, 0x5e, 0xff, 0xe5,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xdf, 0xff, 0x80,
+    0x0, 0x9f, 0xff, 0x91, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0xff, 0xb0, 0x2, 0xdf, 0xfe, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x37, 0x65, 0x30,
+    0x4, 0xff, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf9, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xf6, 0x0, 0x0, 0x1, 0x34, 0x21,
+    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xf3, 0x0,
+    0x26, 0xce, 0xee, 0xee, 0xa5, 0x10, 0x0, 0x0,
+    0xe, 0xff, 0xf2, 0x5, 0xcf, 0xff, 0xff, 0xff,
+    0xff, 0xa3, 0x0, 0x0, 0x1e, 0xff, 0xe3, 0x7e,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x40, 0x0,
+    0x2e, 0xff, 0xe8, 0xef, 0xff, 0xb8, 0x78, 0xbe,
+    0xff, 0xff, 0xd3, 0x0, 0x3e, 0xff, 0xfe, 0xff,
+    0xb4, 0x10, 0x0, 0x14, 0xcf, 0xff, 0xfa, 0x10,
+    0x3e, 0xff, 0xff, 0xfa, 0x10, 0x0, 0x0, 0x0,
+    0x2b, 0xff, 0xfe, 0x50, 0x3e, 0xff, 0xff, 0xc2,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xdf, 0xff, 0xb0,
+    0x3e, 0xff, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xff, 0xf1, 0x2e, 0xff, 0xfd, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf4,
+    0x1e, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1d, 0xff, 0xf6, 0xe, 0xff, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xff, 0xf7,
+    0xc, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1c, 0xff, 0xf7, 0x9, 0xff, 0xfc, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xff, 0xf6,
+    0x6, 0xff, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2e, 0xff, 0xf3, 0x3, 0xef, 0xfe, 0x60,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf1,
+    0x1, 0xaf, 0xff, 0xb1, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xbf, 0xff, 0xb0, 0x0, 0x6e, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x6, 0xef, 0xfe, 0x50,
+    0x0, 0x1c, 0xff, 0xfe, 0x51, 0x0, 0x0, 0x0,
+    0x5d, 0xff, 0xfb, 0x10, 0x0, 0x3, 0xdf, 0xff,
+    0xea, 0x41, 0x1, 0x38, 0xef, 0xff, 0xe3, 0x0,
+    0x0, 0x0, 0x5d, 0xff, 0xff, 0xec, 0xbc, 0xdf,
+    0xff, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x4, 0xcf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xc5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x27, 0xef, 0xff, 0xff, 0xff,
+    0xe9, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x13, 0x89, 0xaa, 0x85, 0x10, 0x0, 0x0, 0x0,
+    /* U+0037 "7" */
+    0x68, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x4b, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xbf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x8b, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x68, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xae, 0xff,
+    0xfc, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x19, 0xff, 0xfc, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xfe, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xef, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xcf, 0xff, 0xa1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
+    0xe4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5e, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xfc, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0xff, 0xfe, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xdf, 0xff, 0xb1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xe4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2c, 0xff, 0xfa, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xfe, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0xff, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xff, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
+    0xfc, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xdf, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xd4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1a, 0xff, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xef, 0xff, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0xfd, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3d, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xef, 0xfe, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xc3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0xfb, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xaf,
+    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1b, 0xff, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0x55, 0x52, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+    /* U+0038 "8" */
+    0x0, 0x0, 0x0, 0x0, 0x12, 0x44, 0x44, 0x31,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x15,
+    0xac, 0xef, 0xfe, 0xdb, 0x72, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xce, 0xff, 0xff, 0xff, 0xff,
+    0xfd, 0x61, 0x0, 0x0, 0x0, 0x0, 0x4d, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x10, 0x0,
+    0x0, 0x3, 0xdf, 0xff, 0xfc, 0x63, 0x35, 0xae,
+    0xff, 0xfe, 0x60, 0x0, 0x0, 0xa, 0xff, 0xff,
+    0x81, 0x0, 0x0, 0x4, 0xdf, 0xff, 0xe2, 0x0,
+    0x0, 0x3e, 0xff, 0xf9, 0x10, 0x0, 0x0, 0x0,
+    0x4e, 0xff, 0xf8, 0x0, 0x0, 0x7f, 0xff, 0xd3,
+    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xfb, 0x20,
+    0x0, 0x8f, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xef, 0xfd, 0x30, 0x0, 0x9f, 0xff, 0x91,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xef, 0xfe, 0x40,
+    0x0, 0x9f, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xef, 0xfe, 0x40, 0x0, 0x7f, 0xff, 0xd2,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xfc, 0x20,
+    0x0, 0x3e, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
+    0x2c, 0xff, 0xfa, 0x10, 0x0, 0x8, 0xff, 0xfe,
+    0x51, 0x0, 0x0, 0x2, 0xaf, 0xff, 0xe4, 0x0,
+    0x0, 0x2, 0xaf, 0xff, 0xe9, 0x31, 0x2, 0x6b,
+    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x18, 0xdf,
+    0xff, 0xed, 0xde, 0xef, 0xff, 0xd6, 0x10, 0x0,
+    0x0, 0x0, 0x1, 0x7e, 0xff, 0xff, 0xff, 0xff,
+    0xfb, 0x30, 0x0, 0x0, 0x0, 0x0, 0x3a, 0xef,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0xb3, 0x0, 0x0,
+    0x0, 0x6, 0xdf, 0xff, 0xfd, 0xa9, 0x89, 0xcf,
+    0xff, 0xfe, 0x70, 0x0, 0x0, 0x4e, 0xff, 0xfe,
+    0x83, 0x10, 0x1, 0x25, 0xcf, 0xff, 0xe7, 0x0,
+    0x2, 0xcf, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0,
+    0x2a, 0xff, 0xfe, 0x50, 0x6, 0xff, 0xfe, 0x70,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xdf, 0xff, 0xb0,
+    0xb, 0xff, 0xfc, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5f, 0xff, 0xf2, 0xe, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xf6,
+    0x1e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1b, 0xff, 0xf8, 0x1e, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1a, 0xff, 0xf9,
+    0xe, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1c, 0xff, 0xf8, 0xc, 0xff, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xf6,
+    0x8, 0xff, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0xf2, 0x4, 0xef, 0xff, 0x91,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xdf, 0xff, 0xb0,
+    0x1, 0x9f, 0xff, 0xe8, 0x10, 0x0, 0x0, 0x0,
+    0x3b, 0xff, 0xfe, 0x50, 0x0, 0x2c, 0xff, 0xff,
+    0xb6, 0x21, 0x11, 0x37, 0xdf, 0xff, 0xf8, 0x10,
+    0x0, 0x4, 0xdf, 0xff, 0xfe, 0xdc, 0xbc, 0xdf,
+    0xff, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x3b, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x10, 0x0,
+    0x0, 0x0, 0x1, 0x6d, 0xff, 0xff, 0xff, 0xff,
+    0xfa, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x36, 0x9a, 0xaa, 0x85, 0x10, 0x0, 0x0, 0x0,
+    /* U+0039 "9" */
+    0x0, 0x0, 0x0, 0x0, 0x13, 0x44, 0x43, 0x21,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x17,
+    0xbd, 0xef, 0xfe, 0xc9, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x15, 0xdf, 0xff, 0xff, 0xff, 0xff,
+    0xea, 0x30, 0x0, 0x0, 0x0, 0x1, 0x7e, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x0, 0x0,
+    0x0, 0x7, 0xef, 0xff, 0xfc, 0x74, 0x35, 0xae,
+    0xff, 0xfd, 0x40, 0x0, 0x0, 0x4e, 0xff, 0xff,
+    0x81, 0x0, 0x0, 0x4, 0xcf, 0xff, 0xd2, 0x0,
+    0x1, 0xaf, 0xff, 0xf7, 0x10, 0x0, 0x0, 0x0,
+    0x3c, 0xff, 0xf8, 0x0, 0x4, 0xef, 0xff, 0xa1,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xef, 0xfd, 0x30,
+    0x7, 0xff, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xbf, 0xff, 0x70, 0xb, 0xff, 0xfb, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xc0,
+    0xe, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xff, 0xf0, 0xe, 0xff, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xf3,
+    0x1e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2f, 0xff, 0xf5, 0xe, 0xff, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf6,
+    0xd, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5f, 0xff, 0xf8, 0xa, 0xff, 0xfc, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf8,
+    0x6, 0xff, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xdf, 0xff, 0xf9, 0x3, 0xdf, 0xff, 0xd3,
+    0x0, 0x0, 0x0, 0x0, 0x1a, 0xff, 0xff, 0xf9,
+    0x0, 0x8f, 0xff, 0xfc, 0x40, 0x0, 0x0, 0x2,
+    0xaf, 0xff, 0xff, 0xf9, 0x0, 0x2c, 0xff, 0xff,
+    0xda, 0x42, 0x23, 0x7c, 0xff, 0xec, 0xff, 0xf8,
+    0x0, 0x3, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfd, 0x59, 0xff, 0xf7, 0x0, 0x0, 0x3c, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xd5, 0x1a, 0xff, 0xf6,
+    0x0, 0x0, 0x1, 0x8c, 0xef, 0xff, 0xff, 0xc8,
+    0x10, 0x1b, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x2,
+    0x57, 0x99, 0x75, 0x20, 0x0, 0x1d, 0xff, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xc0,
+    0x0, 0x12, 0x22, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0xff, 0x80, 0x3, 0xbc, 0xdb, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xdf, 0xfe, 0x40,
+    0x3, 0xef, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xfb, 0x10, 0x2, 0xbf, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x5e, 0xff, 0xf6, 0x0,
+    0x0, 0x7f, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x4,
+    0xdf, 0xff, 0xb1, 0x0, 0x0, 0x1c, 0xff, 0xfe,
+    0x73, 0x10, 0x13, 0x8e, 0xff, 0xfd, 0x30, 0x0,
+    0x0, 0x5, 0xef, 0xff, 0xfd, 0xcb, 0xcd, 0xff,
+    0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x5d, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfb, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xae, 0xff, 0xff, 0xff, 0xfe,
+    0x72, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0x58, 0xaa, 0x97, 0x40, 0x0, 0x0, 0x0, 0x0,
+    /* U+003A ":" */
+    0x7a, 0xaa, 0xa2, 0xaf, 0xff, 0xe3, 0xaf, 0xff,
+    0xe3, 0xaf, 0xff, 0xe3, 0xaf, 0xff, 0xe3, 0x12,
+    0x22, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8c, 0xcc, 0xb2, 0xaf,
+    0xff, 0xe3, 0xaf, 0xff, 0xe3, 0xaf, 0xff, 0xe3,
+    0xaf, 0xff, 0xe3,
+    /* U+003B ";" */
+    0x8a, 0xaa, 0xa1, 0xbf, 0xff, 0xe2, 0xbf, 0xff,
+    0xe2, 0xbf, 0xff, 0xe2, 0xbf, 0xff, 0xe2, 0x12,
+    0x22, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9c, 0xcc, 0xb1, 0xbf,
+    0xff, 0xe2, 0xbf, 0xff, 0xe2, 0xbf, 0xff, 0xe2,
+    0xbf, 0xff, 0xe2, 0x0, 0x6f, 0xe2, 0x0, 0x8f,
+    0xe0, 0x0, 0xbf, 0xc0, 0x4, 0xef, 0x70, 0x5d,
+    0xfc, 0x20, 0xaf, 0xc4, 0x0, 0x27, 0x20, 0x0,
+    /* U+003C "<" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x32, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x59, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x6b, 0xef, 0xf6, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x14, 0x8e, 0xff, 0xff, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xad,
+    0xff, 0xff, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x37, 0xdf, 0xff, 0xff, 0xfe, 0xb7, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x3a, 0xdf, 0xff, 0xff,
+    0xff, 0xa5, 0x10, 0x0, 0x0, 0x0, 0x2, 0x6c,
+    0xef, 0xff, 0xff, 0xec, 0x82, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0x8c, 0xff, 0xff, 0xff, 0xfa, 0x62,
+    0x0, 0x0, 0x0, 0x0, 0x14, 0xae, 0xff, 0xff,
+    0xfe, 0xd8, 0x31, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5f, 0xff, 0xff, 0xfe, 0xb6, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xfe, 0xa4,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5f, 0xff, 0xfd, 0x72, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xfd,
+    0x93, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x16, 0xbe, 0xff, 0xff, 0xff, 0xb6, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x14, 0xaf, 0xff,
+    0xff, 0xff, 0xc8, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0x8c, 0xff, 0xff, 0xff, 0xfa,
+    0x52, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0x6c, 0xff, 0xff, 0xff, 0xeb, 0x72, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3a, 0xdf, 0xff,
+    0xff, 0xfe, 0x95, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x38, 0xdf, 0xff, 0xff, 0xfe, 0xb3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x16,
+    0xbe, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x14, 0x9e, 0xff, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x12, 0x8c, 0xe6, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x63,
+    /* U+003D "=" */
+    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf6, 0x5f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
+    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf6, 0x4d, 0xdd, 0xdd, 0xdd,
+    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xd5,
+    0x1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x38, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x83, 0x5f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
+    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf6, 0x5f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
+    0x26, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x66, 0x66, 0x62,
+    /* U+003E ">" */
+    0x22, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5e, 0xa5, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5f, 0xfe, 0xc6, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xe8,
+    0x41, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4e, 0xff, 0xff, 0xff, 0xea, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0x7c, 0xef, 0xff,
+    0xff, 0xfd, 0x73, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0x5a, 0xef, 0xff, 0xff, 0xfd, 0x94,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x28,
+    0xce, 0xff, 0xff, 0xfe, 0xc6, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x26, 0xaf, 0xff, 0xff,
+    0xff, 0xc8, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x13, 0x9d, 0xff, 0xff, 0xff, 0xeb, 0x41,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x6b,
+    0xef, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x49, 0xef, 0xff, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x27, 0xdf, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x39, 0xdf, 0xff, 0xff, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x6b, 0xff,
+    0xff, 0xff, 0xeb, 0x61, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0x8c, 0xef, 0xff, 0xff, 0xeb, 0x41, 0x0,
+    0x0, 0x0, 0x0, 0x25, 0xaf, 0xff, 0xff, 0xff,
+    0xc8, 0x20, 0x0, 0x0, 0x0, 0x0, 0x27, 0xbe,
+    0xff, 0xff, 0xff, 0xc6, 0x20, 0x0, 0x0, 0x0,
+    0x1, 0x5a, 0xef, 0xff, 0xff, 0xfd, 0xa3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3b, 0xef, 0xff, 0xff,
+    0xfd, 0x83, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5f, 0xff, 0xff, 0xeb, 0x61, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xe9, 0x51,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5e, 0xc7, 0x21, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x36, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    /* U+003F "?" */
+    0x0, 0x0, 0x1, 0x37, 0xad, 0xee, 0xdc, 0x95,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x2, 0xae, 0xff,
+    0xff, 0xff, 0xff, 0xfc, 0x71, 0x0, 0x0, 0x0,
+    0x5, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xb3, 0x0, 0x0, 0x5, 0xdf, 0xff, 0xfe, 0xa8,
+    0x89, 0xcf, 0xff, 0xff, 0xc2, 0x0, 0x2, 0xdf,
+    0xff, 0xf9, 0x31, 0x0, 0x1, 0x4c, 0xff, 0xff,
+    0xa1, 0x0, 0x9f, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x2b, 0xff, 0xfe, 0x60, 0x2d, 0xff, 0xfb,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x3d, 0xff, 0xfc,
+    0x6, 0xff, 0xfe, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xf1, 0x9f, 0xff, 0xd1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x3a,
+    0xef, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2f, 0xff, 0xf4, 0x24, 0x45, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2c, 0xff, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2a, 0xff, 0xfe,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1a, 0xff, 0xff, 0x81, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2a, 0xff, 0xff, 0xb1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2b, 0xff,
+    0xff, 0xb2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3b, 0xff, 0xff, 0xb2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xff, 0xa2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xdf, 0xff, 0xa1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
+    0xd3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xe, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0x88, 0x81, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2c, 0xcc, 0xc8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0xff, 0xfa, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+    /* U+0040 "@" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x24, 0x79, 0xcd, 0xee, 0xed, 0xca, 0x75, 0x31,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x59, 0xcf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0x60,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x6d, 0xef, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x71,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4b, 0xff, 0xff, 0xff, 0xec, 0xa8,
+    0x77, 0x78, 0x9b, 0xef, 0xff, 0xff, 0xfb, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x17, 0xef, 0xff, 0xfd, 0xb6, 0x21, 0x10, 0x0,
+    0x0, 0x11, 0x25, 0xae, 0xff, 0xff, 0xe6, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x8f,
+    0xff, 0xfe, 0x93, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0x8e, 0xff, 0xfe, 0x71, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x19, 0xef, 0xff,
+    0xb3, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xbf, 0xff, 0xe7, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xe7, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x19, 0xef, 0xfe, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xef, 0xfe, 0x60, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x8f, 0xff, 0xb2, 0x0, 0x0, 0x0,
+    0x0, 0x3d, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0,
+    0x13, 0x55, 0x54, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x4, 0xad,
+    0xef, 0xed, 0xb5, 0x0, 0x5, 0xaa, 0xa7, 0x0,
+    0x2, 0xcf, 0xfd, 0x20, 0x0, 0x0, 0x4, 0xef,
+    0xfa, 0x10, 0x0, 0x0, 0x3, 0xaf, 0xff, 0xff,
+    0xff, 0xff, 0xa2, 0x1a, 0xff, 0xf8, 0x0, 0x0,
+    0x6e, 0xff, 0x80, 0x0, 0x0, 0x1a, 0xff, 0xe3,
+    0x0, 0x0, 0x0, 0x3c, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf9, 0x2c, 0xff, 0xf5, 0x0, 0x0, 0x1c,
+    0xff, 0xb2, 0x0, 0x0, 0x3e, 0xff, 0x80, 0x0,
+    0x0, 0x4, 0xdf, 0xff, 0xea, 0x52, 0x25, 0xbe,
+    0xff, 0xaf, 0xff, 0xf1, 0x0, 0x0, 0x7, 0xff,
+    0xf4, 0x0, 0x0, 0x8f, 0xfe, 0x30, 0x0, 0x0,
+    0x1c, 0xff, 0xfe, 0x61, 0x0, 0x0, 0x18, 0xff,
+    0xff, 0xff, 0xd0, 0x0, 0x0, 0x3, 0xef, 0xf6,
+    0x0, 0x1, 0xdf, 0xf9, 0x10, 0x0, 0x1, 0x9f,
+    0xff, 0xe5, 0x0, 0x0, 0x0, 0x1, 0xaf, 0xff,
+    0xff, 0xa0, 0x0, 0x0, 0x2, 0xcf, 0xf9, 0x0,
+    0x5, 0xef, 0xe5, 0x0, 0x0, 0x5, 0xef, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x3e, 0xff, 0xff,
+    0x60, 0x0, 0x0, 0x1, 0xaf, 0xfb, 0x0, 0x8,
+    0xff, 0xd1, 0x0, 0x0, 0xb, 0xff, 0xfc, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xfe, 0x40,
+    0x0, 0x0, 0x1, 0x9f, 0xfc, 0x0, 0x1a, 0xff,
+    0xb0, 0x0, 0x0, 0x3f, 0xff, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x19, 0xff, 0xfc, 0x20, 0x0,
+    0x0, 0x1, 0x9f, 0xfd, 0x0, 0x2c, 0xff, 0x80,
+    0x0, 0x0, 0x9f, 0xff, 0xd2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xfa, 0x10, 0x0, 0x0,
+    0x1, 0xaf, 0xfc, 0x0, 0x3e, 0xff, 0x40, 0x0,
+    0x2, 0xcf, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x1,
+    0xcf, 0xfb, 0x0, 0x4f, 0xff, 0x30, 0x0, 0x4,
+    0xdf, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x19, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x2, 0xef,
+    0xf8, 0x0, 0x5f, 0xff, 0x30, 0x0, 0x5, 0xff,
+    0xfd, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b,
+    0xff, 0xe3, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf5,
+    0x0, 0x5f, 0xfe, 0x20, 0x0, 0x6, 0xff, 0xfc,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0xff,
+    0xe0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xd3, 0x0,
+    0x5f, 0xff, 0x20, 0x0, 0x6, 0xff, 0xfc, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xa0,
+    0x0, 0x0, 0x0, 0x3e, 0xff, 0xa1, 0x0, 0x5f,
+    0xff, 0x30, 0x0, 0x6, 0xff, 0xfc, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0x70, 0x0,
+    0x0, 0x1, 0x9f, 0xfe, 0x50, 0x0, 0x4f, 0xff,
+    0x40, 0x0, 0x5, 0xff, 0xfd, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xef, 0xff, 0x40, 0x0, 0x0,
+    0x5, 0xef, 0xfb, 0x0, 0x0, 0x3e, 0xff, 0x60,
+    0x0, 0x4, 0xef, 0xfe, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x2b, 0xff, 0xfe, 0x30, 0x0, 0x0, 0x3d,
+    0xff, 0xe4, 0x0, 0x0, 0x2c, 0xff, 0x90, 0x0,
+    0x1, 0xbf, 0xff, 0x80, 0x0, 0x0, 0x0, 0x1,
+    0x9f, 0xff, 0xfb, 0x20, 0x0, 0x3, 0xbf, 0xff,
+    0x70, 0x0, 0x0, 0x1b, 0xff, 0xc0, 0x0, 0x0,
+    0x7f, 0xff, 0xe4, 0x0, 0x0, 0x0, 0x18, 0xff,
+    0xff, 0xfa, 0x10, 0x0, 0x4d, 0xff, 0xfa, 0x10,
+    0x0, 0x0, 0x8, 0xff, 0xe3, 0x0, 0x0, 0x2d,
+    0xff, 0xfc, 0x41, 0x0, 0x12, 0xbe, 0xff, 0xff,
+    0xfd, 0x31, 0x29, 0xef, 0xff, 0xb2, 0x0, 0x0,
+    0x0, 0x4, 0xef, 0xf8, 0x0, 0x0, 0x6, 0xef,
+    0xff, 0xea, 0x77, 0xae, 0xff, 0xbc, 0xff, 0xff,
+    0xec, 0xef, 0xff, 0xfa, 0x20, 0x0, 0x0, 0x0,
+    0x1, 0xdf, 0xfc, 0x20, 0x0, 0x1, 0x9f, 0xff,
+    0xff, 0xff, 0xff, 0xfb, 0x29, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0xa2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0x80, 0x0, 0x0, 0x7, 0xdf, 0xff,
+    0xff, 0xfd, 0x71, 0x3, 0xdf, 0xff, 0xff, 0xfe,
+    0xc5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3d,
+    0xff, 0xe3, 0x0, 0x0, 0x0, 0x38, 0xdf, 0xfd,
+    0x84, 0x0, 0x0, 0x4a, 0xef, 0xfd, 0xa5, 0x20,
+    0x0, 0x0, 0x37, 0x88, 0x61, 0x0, 0x7, 0xff,
+    0xfc, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xdf, 0xff, 0x60, 0x0, 0x1, 0xcf, 0xff,
+    0xb1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2b,
+    0xff, 0xfb, 0x10, 0x0, 0x0, 0x3d, 0xff, 0xfb,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xcf, 0xff,
+    0xc2, 0x0, 0x0, 0x0, 0x5, 0xef, 0xff, 0xd6,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x7e, 0xff, 0xfd, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x4d, 0xff, 0xfe, 0xc5,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0x5c, 0xff, 0xff, 0xc3, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xbf, 0xff, 0xff, 0xc8,
+    0x52, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x14,
+    0x7c, 0xff, 0xff, 0xfa, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x29, 0xef, 0xff, 0xff, 0xed,
+    0xb9, 0x65, 0x33, 0x23, 0x45, 0x8a, 0xce, 0xff,
+    0xff, 0xfd, 0x71, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x39, 0xef, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0x93, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x38, 0xde, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0x93, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0x79, 0xbc, 0xde, 0xff,
+    0xff, 0xfe, 0xdc, 0xa8, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x12, 0x34, 0x44, 0x44,
+    0x43, 0x32, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+    /* U+0041 "A" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x44,
+    0x44, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0xff, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
+    0xff, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2c,
+    0xff, 0xff, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0xfd, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xff, 0x6e, 0xff, 0xd1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2e, 0xff, 0xd3, 0xbf, 0xff, 0x60, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xfa, 0x18, 0xff, 0xfb, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xbf, 0xff, 0x60, 0x4e, 0xff, 0xe4, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5e, 0xff, 0xd3, 0x0, 0xcf, 0xff, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9, 0xff, 0xfb, 0x10, 0x7, 0xff, 0xfe,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xef, 0xff, 0x60, 0x0, 0x2e, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xff, 0xe1, 0x0, 0x1, 0xaf,
+    0xff, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1c, 0xff, 0xfa, 0x0, 0x0, 0x6,
+    0xef, 0xfe, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xef, 0xfe, 0x50, 0x0, 0x0,
+    0x2d, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0xc2, 0x0, 0x0,
+    0x0, 0x9f, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2d, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x30, 0x0,
+    0x0, 0x0, 0x1c, 0xff, 0xfc, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0xe5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3d, 0xff, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xdf, 0xff, 0xa0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xfd, 0x52,
+    0x22, 0x22, 0x22, 0x22, 0x3b, 0xff, 0xff, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xbf, 0xff, 0xed,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xef, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xc2, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0x60, 0x0, 0x0, 0x0, 0x2, 0xef, 0xff,
+    0xcb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbe,
+    0xff, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xbf, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x1b, 0xff,
+    0xfb, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0xff, 0x90, 0x0, 0x0, 0x4, 0xef,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1e, 0xff, 0xfd, 0x20, 0x0, 0x0, 0x9f,
+    0xff, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xff, 0xf7, 0x0, 0x0, 0x1e,
+    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xef, 0xff, 0xb1, 0x0, 0x5,
+    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2b, 0xff, 0xff, 0x40, 0x1,
+    0xaf, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xfa, 0x0,
+    0x3d, 0xff, 0xf9, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0xff, 0xd2,
+    0x8, 0xff, 0xfe, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
+    0x70, 0xdf, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
+    0xfb, 0x20,
+    /* U+0042 "B" */
+    0x24, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x43,
+    0x31, 0x0, 0x0, 0x0, 0x0, 0x8, 0xef, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xee, 0xed, 0xb9, 0x41,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0xb3, 0x0, 0x0,
+    0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xd5, 0x0, 0x0, 0x8f, 0xff,
+    0xfd, 0xcc, 0xcc, 0xcc, 0xcc, 0xdd, 0xef, 0xff,
+    0xff, 0xd2, 0x0, 0x8, 0xff, 0xfe, 0x30, 0x0,
+    0x0, 0x0, 0x1, 0x24, 0x7c, 0xff, 0xff, 0xa1,
+    0x0, 0x8f, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2d, 0xff, 0xfe, 0x40, 0x8, 0xff,
+    0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5e, 0xff, 0xf7, 0x0, 0x8f, 0xff, 0xe3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xff,
+    0xa1, 0x8, 0xff, 0xfe, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0xff, 0xfb, 0x10, 0x8f,
+    0xff, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0xff, 0xa1, 0x8, 0xff, 0xfe, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2c, 0xff,
+    0xf7, 0x0, 0x8f, 0xff, 0xe3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xef, 0xfe, 0x40, 0x8,
+    0xff, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xdf, 0xff, 0x90, 0x0, 0x8f, 0xff, 0xe3,
+    0x0, 0x0, 0x0, 0x0, 0x12, 0x48, 0xdf, 0xff,
+    0xc2, 0x0, 0x8, 0xff, 0xff, 0xed, 0xdd, 0xdd,
+    0xdd, 0xdd, 0xee, 0xff, 0xff, 0xb3, 0x0, 0x0,
+    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xa1, 0x0, 0x0, 0x8, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0x93, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x10,
+    0x8, 0xff, 0xfe, 0x53, 0x33, 0x33, 0x33, 0x33,
+    0x46, 0x9d, 0xff, 0xff, 0xe6, 0x0, 0x8f, 0xff,
+    0xe3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x17,
+    0xef, 0xff, 0xe3, 0x8, 0xff, 0xfe, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x17, 0xff, 0xff,
+    0xa0, 0x8f, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xc, 0xff, 0xfd, 0x38, 0xff,
+    0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xe5, 0x8f, 0xff, 0xe3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0xff, 0x78, 0xff, 0xfe, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf7, 0x8f,
+    0xff, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xfe, 0x68, 0xff, 0xfe, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
+    0xff, 0xe4, 0x8f, 0xff, 0xe3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xfc, 0x18,
+    0xff, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6d, 0xff, 0xff, 0x70, 0x8f, 0xff, 0xe4,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x36, 0xbe, 0xff,
+    0xff, 0xc2, 0x8, 0xff, 0xff, 0xfe, 0xee, 0xee,
+    0xee, 0xee, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x0,
+    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xd4, 0x0, 0x8, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
+    0x82, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xdb, 0x95, 0x30, 0x0, 0x0,
+    0x0,
+    /* U+0043 "C" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x47, 0x9a,
+    0xba, 0x97, 0x43, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x49, 0xcf, 0xff, 0xff,
+    0xff, 0xff, 0xd9, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xbe, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0x82, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x17, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xc3, 0x0, 0x0, 0x0, 0x0,
+    0x19, 0xff, 0xff, 0xfe, 0xb7, 0x43, 0x23, 0x58,
+    0xde, 0xff, 0xff, 0xc3, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0xff, 0xea, 0x30, 0x0, 0x0, 0x0, 0x1,
+    0x6d, 0xff, 0xff, 0xb1, 0x0, 0x0, 0x6, 0xef,
+    0xff, 0xe6, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4c, 0xff, 0xff, 0x70, 0x0, 0x3, 0xdf, 0xff,
+    0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4e, 0xff, 0xfe, 0x30, 0x0, 0x9f, 0xff, 0xf8,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xff, 0xf8, 0x0, 0x2e, 0xff, 0xfc, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xdf, 0xff, 0xc2, 0x7, 0xff, 0xff, 0x60, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xfd, 0xa5, 0x11, 0xaf, 0xff, 0xd2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x11,
+    0x0, 0x0, 0x3d, 0xff, 0xfa, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0xe6, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
+    0xff, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
+    0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
+    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x10, 0x0, 0x2, 0xcf, 0xff, 0xa1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0x95, 0x10, 0x9, 0xff, 0xfe, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xef, 0xff, 0x80, 0x5e, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xff, 0xf5, 0x1, 0xdf, 0xff, 0xd1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2c,
+    0xff, 0xfd, 0x20, 0x8, 0xff, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0xff, 0x91, 0x0, 0x2d, 0xff, 0xfe, 0x60, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xef, 0xff,
+    0xd3, 0x0, 0x0, 0x6e, 0xff, 0xfe, 0x61, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6, 0xdf, 0xff, 0xf7,
+    0x0, 0x0, 0x1, 0xaf, 0xff, 0xfe, 0xb3, 0x10,
+    0x0, 0x0, 0x1, 0x39, 0xef, 0xff, 0xfb, 0x10,
+    0x0, 0x0, 0x1, 0xaf, 0xff, 0xff, 0xfc, 0x86,
+    0x54, 0x57, 0x9e, 0xff, 0xff, 0xfb, 0x20, 0x0,
+    0x0, 0x0, 0x2, 0x9f, 0xff, 0xff, 0xff, 0xfe,
+    0xee, 0xff, 0xff, 0xff, 0xfb, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7c, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xd7, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x27, 0xcf, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0x84, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x15, 0x79, 0xaa, 0xa9,
+    0x73, 0x0, 0x0, 0x0, 0x0, 0x0,
+    /* U+0044 "D" */
+    0x14, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x43,
+    0x32, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5e,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xee, 0xdc,
+    0xa7, 0x30, 0x0, 0x0, 0x0, 0x0, 0x5e, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xea, 0x40, 0x0, 0x0, 0x0, 0x5e, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xe6, 0x0, 0x0, 0x0, 0x5e, 0xff, 0xfd, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xdd, 0xde, 0xff, 0xff, 0xfe,
+    0x71, 0x0, 0x0, 0x5e, 0xff, 0xf3, 0x0, 0x0,
+    0x0, 0x0, 0x11, 0x36, 0x9e, 0xff, 0xff, 0xf6,
+    0x0, 0x0, 0x5e, 0xff, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x14, 0xbf, 0xff, 0xfd, 0x40,
+    0x0, 0x5e, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1b, 0xff, 0xff, 0xb1, 0x0,
+    0x5e, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xcf, 0xff, 0xf4, 0x0, 0x5e,
+    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5f, 0xff, 0xfb, 0x0, 0x5e, 0xff,
+    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1c, 0xff, 0xfd, 0x20, 0x5e, 0xff, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0xfe, 0x60, 0x5e, 0xff, 0xf3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xef, 0xff, 0x80, 0x5e, 0xff, 0xf3, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xcf,
+    0xff, 0xb1, 0x5e, 0xff, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xbf, 0xff,
+    0xc2, 0x5e, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x9f, 0xff, 0xd2,
+    0x5e, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xd3, 0x5e,
+    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9f, 0xff, 0xe3, 0x5e, 0xff,
+    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xff, 0xe3, 0x5e, 0xff, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0xff, 0xd3, 0x5e, 0xff, 0xf3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xaf, 0xff, 0xc2, 0x5e, 0xff, 0xf3, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xbf,
+    0xff, 0xb1, 0x5e, 0xff, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xdf, 0xff,
+    0xa1, 0x5e, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0x80,
+    0x5e, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0xfe, 0x40, 0x5e,
+    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1d, 0xff, 0xfd, 0x10, 0x5e, 0xff,
+    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xf7, 0x0, 0x5e, 0xff, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xdf, 0xff, 0xe3, 0x0, 0x5e, 0xff, 0xf3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xff,
+    0xff, 0x80, 0x0, 0x5e, 0xff, 0xf3, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x16, 0xdf, 0xff, 0xfc,
+    0x20, 0x0, 0x5e, 0xff, 0xf5, 0x22, 0x22, 0x22,
+    0x22, 0x23, 0x59, 0xce, 0xff, 0xff, 0xe4, 0x0,
+    0x0, 0x5e, 0xff, 0xff, 0xee, 0xee, 0xee, 0xee,
+    0xff, 0xff, 0xff, 0xff, 0xfd, 0x40, 0x0, 0x0,
+    0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xc3, 0x0, 0x0, 0x0, 0x5e,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0xb6, 0x10, 0x0, 0x0, 0x0, 0x5e, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xc9, 0x74,
+    0x20, 0x0, 0x0, 0x0, 0x0,
+    /* U+0045 "E" */
+    0x14, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x42, 0x4, 0xef, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x90, 0x4e, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
+    0x4, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x4e, 0xff,
+    0xfd, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xc8, 0x4, 0xef, 0xff, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xef,
+    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4e, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xef, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e,
+    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xef, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4e, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xef, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xff, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xef, 0xff, 0xdc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xc5, 0x0,
+    0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x60, 0x4, 0xef, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf6, 0x0, 0x4e, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
+    0x4, 0xef, 0xff, 0x73, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x31, 0x0, 0x4e, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xef, 0xff, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xef,
+    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4e, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xef, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e,
+    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xef, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4e, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xef, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xff, 0xf6,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x14, 0xef, 0xff, 0xfe, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe7,
+    0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x74, 0xef, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf7, 0x4e, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x70,
+    /* U+0046 "F" */
+    0x14, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x12, 0xef, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xd3, 0x2e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfd, 0x32, 0xef, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xd3, 0x2e, 0xff, 0xfd, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xca, 0x32, 0xef,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2e, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xef, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xef, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xef, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xef, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xef, 0xff, 0xed, 0xdd,
+    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0x80, 0x0,
+    0x2e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfa, 0x0, 0x2, 0xef, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0,
+    0x0, 0x2e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfa, 0x0, 0x2, 0xef, 0xff,
+    0x93, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x20, 0x0, 0x2e, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2e, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xef, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xef, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xef, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xef, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xef, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2e, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x29, 0xaa, 0xa5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    /* U+0047 "G" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x35, 0x79,
+    0xab, 0xba, 0x86, 0x32, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x17, 0xbd, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0xb7, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0x7e, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x71, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xbf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb2,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xdf, 0xff, 0xff,
+    0xdb, 0x74, 0x22, 0x24, 0x7b, 0xdf, 0xff, 0xff,
+    0xb1, 0x0, 0x0, 0x0, 0x4, 0xef, 0xff, 0xfd,
+    0x73, 0x0, 0x0, 0x0, 0x0, 0x3, 0x8e, 0xff,
+    0xff, 0x91, 0x0, 0x0, 0x2, 0xcf, 0xff, 0xfb,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x5d,
+    0xff, 0xfe, 0x40, 0x0, 0x1, 0x9f, 0xff, 0xfb,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4e, 0xff, 0xfb, 0x0, 0x0, 0x3e, 0xff, 0xfd,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0xff, 0xe3, 0x0, 0xa, 0xff, 0xfe,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xdf, 0xff, 0x80, 0x2, 0xdf, 0xff,
+    0xc1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1a, 0xff, 0xe7, 0x0, 0x7f, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x46, 0x20, 0x0, 0x1a, 0xff,
+    0xfd, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xcf,
+    0xff, 0xa1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3e,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5f, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0xfe, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x21, 0x6f, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x55, 0xff, 0xfe, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf5, 0x4f, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x53, 0xef, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3d, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xef, 0xff, 0xf5, 0x2c, 0xff, 0xfa, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xdf, 0xff, 0x51, 0xaf, 0xff, 0xd2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3d, 0xff, 0xf5, 0x7, 0xff, 0xff, 0x60,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xdf, 0xff, 0x50, 0x3e, 0xff, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3d, 0xff, 0xf5, 0x0, 0xaf, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xdf, 0xff, 0x50, 0x4, 0xef,
+    0xff, 0xd4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3d, 0xff, 0xf5, 0x0, 0x18,
+    0xff, 0xff, 0xd3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x29, 0xff, 0xff, 0x50, 0x0,
+    0x2b, 0xff, 0xff, 0xd7, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x6c, 0xff, 0xff, 0xf5, 0x0,
+    0x0, 0x3d, 0xff, 0xff, 0xfc, 0x72, 0x10, 0x0,
+    0x0, 0x11, 0x27, 0xce, 0xff, 0xff, 0xfc, 0x30,
+    0x0, 0x0, 0x3b, 0xff, 0xff, 0xff, 0xeb, 0x97,
+    0x66, 0x79, 0xcf, 0xff, 0xff, 0xff, 0xea, 0x20,
+    0x0, 0x0, 0x0, 0x2a, 0xef, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xbe, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x71, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x49, 0xef,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0xa5, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x25, 0x89, 0xaa, 0xa8, 0x63, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+    /* U+0048 "H" */
+    0x14, 0x44, 0x42, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0x44, 0x43, 0x3e, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xfc, 0x3e, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xfc, 0x3e, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfc,
+    0x3e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xfc, 0x3e, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xfc, 0x3e, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xfc, 0x3e, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfc,
+    0x3e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xfc, 0x3e, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xfc, 0x3e, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xfc, 0x3e, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfc,
+    0x3e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xfc, 0x3e, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xfc, 0x3e, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xfc, 0x3e, 0xff, 0xfe, 0xdd, 0xdd, 0xdd,
+    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xff, 0xfc,
+    0x3e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3e, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfc, 0x3e, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfc, 0x3e, 0xff, 0xf7, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x3c, 0xff, 0xfc,
+    0x3e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xfc, 0x3e, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xfc, 0x3e, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xfc, 0x3e, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfc,
+    0x3e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xfc, 0x3e, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xfc, 0x3e, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xfc, 0x3e, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfc,
+    0x3e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xfc, 0x3e, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xfc, 0x3e, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xfc, 0x3e, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfc,
+    0x3e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xfc, 0x3e, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xfc, 0x3e, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xfc,
+    /* U+0049 "I" */
+    0x24, 0x44, 0x40, 0x8f, 0xff, 0xe1, 0x8f, 0xff,
+    0xe1, 0x8f, 0xff, 0xe1, 0x8f, 0xff, 0xe1, 0x8f,
+    0xff, 0xe1, 0x8f, 0xff, 0xe1, 0x8f, 0xff, 0xe1,
+    0x8f, 0xff, 0xe1, 0x8f, 0xff, 0xe1, 0x8f, 0xff,
+    0xe1, 0x8f, 0xff, 0xe1, 0x8f, 0xff, 0xe1, 0x8f,
+    0xff, 0xe1, 0x8f, 0xff, 0xe1, 0x8f, 0xff, 0xe1,
+    0x8f, 0xff, 0xe1, 0x8f, 0xff, 0xe1, 0x8f, 0xff,
+    0xe1, 0x8f, 0xff, 0xe1, 0x8f, 0xff, 0xe1, 0x8f,
+    0xff, 0xe1, 0x8f, 0xff, 0xe1, 0x8f, 0xff, 0xe1,
+    0x8f, 0xff, 0xe1, 0x8f, 0xff, 0xe1, 0x8f, 0xff,
+    0xe1, 0x8f, 0xff, 0xe1, 0x8f, 0xff, 0xe1, 0x8f,
+    0xff, 0xe1, 0x8f, 0xff, 0xe1, 0x8f, 0xff, 0xe1,
+    0x8f, 0xff, 0xe1, 0x8f, 0xff, 0xe1, 0x8f, 0xff,
+    0xe1,
+    /* U+004A "J" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x14,
+    0x44, 0x41, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xff, 0xe5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xe5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xff, 0xe5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xe5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xff, 0xe5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xe5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xff, 0xe5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xe5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xff, 0xe5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xe5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xff, 0xe5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xe5,
+    0x1, 0x23, 0x20, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xff, 0xe5, 0x6b, 0xcd, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xff, 0xe4, 0x9f, 0xff, 0x91, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xff, 0xe3, 0x8f, 0xff,
+    0xb1, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xe2,
+    0x6f, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xff, 0xd0, 0x3e, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x3, 0xef, 0xff, 0xa0, 0xc, 0xff, 0xfe, 0x51,
+    0x0, 0x1, 0x4c, 0xff, 0xff, 0x50, 0x6, 0xff,
+    0xff, 0xfb, 0x76, 0x79, 0xef, 0xff, 0xfb, 0x20,
+    0x1, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xd4, 0x0, 0x0, 0x1a, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfd, 0x50, 0x0, 0x0, 0x2, 0x7e, 0xff,
+    0xff, 0xff, 0xff, 0x93, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x48, 0x9a, 0xa8, 0x51, 0x0, 0x0, 0x0,
+    /* U+004B "K" */
+    0x24, 0x44, 0x41, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x44, 0x44, 0x44, 0x8, 0xff,
+    0xfd, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9e, 0xff, 0xff, 0x81, 0x8f, 0xff, 0xe3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x9f,
+    0xff, 0xfe, 0x71, 0x8, 0xff, 0xfe, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
+    0x70, 0x0, 0x8f, 0xff, 0xe3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x9f, 0xff, 0xfe, 0x61, 0x0,
+    0x8, 0xff, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x9f, 0xff, 0xfe, 0x60, 0x0, 0x0, 0x8f,
+    0xff, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x1, 0x9f,
+    0xff, 0xfe, 0x60, 0x0, 0x0, 0x8, 0xff, 0xfe,
+    0x30, 0x0, 0x0, 0x0, 0x1, 0x9f, 0xff, 0xfe,
+    0x50, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xe3, 0x0,
+    0x0, 0x0, 0x0, 0x9f, 0xff, 0xfd, 0x60, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xfe, 0x30, 0x0, 0x0,
+    0x1, 0x9f, 0xff, 0xfd, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x9f,
+    0xff, 0xfd, 0x50, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0xfe, 0x30, 0x0, 0x1, 0xaf, 0xff, 0xfc,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
+    0xe3, 0x0, 0x0, 0x9f, 0xff, 0xfd, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xfe, 0x30,
+    0x1, 0x9f, 0xff, 0xfc, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0xe3, 0x1, 0x9f,
+    0xff, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0xfe, 0x31, 0xaf, 0xff, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xff, 0xe4, 0xaf, 0xff, 0xff, 0xff, 0xe5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0xfe, 0xcf, 0xff, 0xfd, 0xff, 0xff, 0xc3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
+    0xff, 0xfb, 0x2a, 0xff, 0xff, 0xa1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xfa,
+    0x20, 0x2d, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0xff, 0xfb, 0x10, 0x0,
+    0x5e, 0xff, 0xfe, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xff, 0xfb, 0x20, 0x0, 0x1, 0x9f,
+    0xff, 0xfc, 0x10, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xff, 0xfa, 0x10, 0x0, 0x0, 0x1, 0xcf, 0xff,
+    0xfa, 0x10, 0x0, 0x0, 0x0, 0x8, 0xff, 0xfe,
+    0x30, 0x0, 0x0, 0x0, 0x4, 0xef, 0xff, 0xe6,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xe3, 0x0,
+    0x0, 0x0, 0x0, 0x7, 0xef, 0xff, 0xf3, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xfe, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x1b, 0xff, 0xff, 0xb2, 0x0, 0x0,
+    0x0, 0x8f, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2d, 0xff, 0xff, 0xa1, 0x0, 0x0, 0x8,
+    0xff, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6e, 0xff, 0xff, 0x60, 0x0, 0x0, 0x8f, 0xff,
+    0xe3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x9f,
+    0xff, 0xfd, 0x40, 0x0, 0x8, 0xff, 0xfe, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xdf, 0xff,
+    0xfb, 0x10, 0x0, 0x8f, 0xff, 0xe3, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xef, 0xff, 0xf8,
+    0x0, 0x8, 0xff, 0xfe, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xe6, 0x0,
+    0x8f, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1c, 0xff, 0xff, 0xd3, 0x8, 0xff,
+    0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4d, 0xff, 0xff, 0xb1, 0x8f, 0xff, 0xe3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xff, 0x80,
+    /* U+004C "L" */
+    0x24, 0x44, 0x41, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0xfe, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xff, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xfe, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
+    0xe3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0xfe, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xe3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xe3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0xe3, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0xe3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xfe,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xfe, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0xfe, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xff, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xfe, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
+    0xe3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0xfe, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xe3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xe3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0xe3, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0xe3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xfe,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xff, 0xe4, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x21, 0x8, 0xff, 0xff, 0xfe,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xc2,
+    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfc, 0x38, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0x8f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfc, 0x30,
+    /* U+004D "M" */
+    0x24, 0x44, 0x44, 0x42, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x44, 0x44,
+    0x41, 0x7f, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xff,
+    0xff, 0xf5, 0x7f, 0xff, 0xff, 0xfe, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
+    0xff, 0xff, 0xf5, 0x7f, 0xff, 0xff, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xaf, 0xff, 0xff, 0xf5, 0x7f, 0xff, 0xff, 0xff,
+    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xdf, 0xff, 0xff, 0xf5, 0x7f, 0xff, 0xff,
+    0xff, 0xc3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xff, 0xff, 0xff, 0xf5, 0x7f, 0xff,
+    0xde, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xb, 0xff, 0xef, 0xff, 0xf5, 0x7f,
+    0xff, 0xc9, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3e, 0xff, 0xbd, 0xff, 0xf5,
+    0x7f, 0xff, 0xc5, 0xff, 0xfe, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xfe, 0x7d, 0xff,
+    0xf5, 0x7f, 0xff, 0xc3, 0xbf, 0xff, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xbf, 0xfc, 0x3d,
+    0xff, 0xf5, 0x7f, 0xff, 0xc2, 0x7f, 0xff, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xef, 0xf8,
+    0x3d, 0xff, 0xf5, 0x7f, 0xff, 0xc2, 0x3d, 0xff,
+    0xd3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xe3, 0x3d, 0xff, 0xf5, 0x7f, 0xff, 0xc2, 0x1b,
+    0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0xff, 0xb1, 0x3d, 0xff, 0xf5, 0x7f, 0xff, 0xc2,
+    0x7, 0xff, 0xfa, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x3e, 0xff, 0x70, 0x3d, 0xff, 0xf5, 0x7f, 0xff,
+    0xc2, 0x2, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xfd, 0x30, 0x3d, 0xff, 0xf5, 0x7f,
+    0xff, 0xc2, 0x0, 0xbf, 0xff, 0x50, 0x0, 0x0,
+    0x0, 0x1, 0xbf, 0xfb, 0x0, 0x3d, 0xff, 0xf5,
+    0x7f, 0xff, 0xc2, 0x0, 0x6f, 0xff, 0xa0, 0x0,
+    0x0, 0x0, 0x4, 0xef, 0xf6, 0x0, 0x3d, 0xff,
+    0xf5, 0x7f, 0xff, 0xc2, 0x0, 0x3d, 0xff, 0xd2,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0xe2, 0x0, 0x3d,
+    0xff, 0xf5, 0x7f, 0xff, 0xc2, 0x0, 0x1a, 0xff,
+    0xf6, 0x0, 0x0, 0x0, 0xe, 0xff, 0xa1, 0x0,
+    0x3d, 0xff, 0xf5, 0x7f, 0xff, 0xc2, 0x0, 0x6,
+    0xff, 0xf9, 0x10, 0x0, 0x0, 0x4f, 0xff, 0x60,
+    0x0, 0x3d, 0xff, 0xf5, 0x7f, 0xff, 0xc2, 0x0,
+    0x1, 0xef, 0xfe, 0x20, 0x0, 0x0, 0x9f, 0xfd,
+    0x30, 0x0, 0x3d, 0xff, 0xf5, 0x7f, 0xff, 0xc2,
+    0x0, 0x0, 0xbf, 0xff, 0x50, 0x0, 0x2, 0xcf,
+    0xfa, 0x0, 0x0, 0x3d, 0xff, 0xf5, 0x7f, 0xff,
+    0xc2, 0x0, 0x0, 0x6f, 0xff, 0xb0, 0x0, 0x5,
+    0xef, 0xf5, 0x0, 0x0, 0x3d, 0xff, 0xf5, 0x7f,
+    0xff, 0xc2, 0x0, 0x0, 0x3d, 0xff, 0xd2, 0x0,
+    0x9, 0xff, 0xe1, 0x0, 0x0, 0x3d, 0xff, 0xf5,
+    0x7f, 0xff, 0xc2, 0x0, 0x0, 0x1a, 0xff, 0xe6,
+    0x0, 0x1e, 0xff, 0x90, 0x0, 0x0, 0x3d, 0xff,
+    0xf5, 0x7f, 0xff, 0xc2, 0x0, 0x0, 0x6, 0xff,
+    0xfa, 0x10, 0x4f, 0xfe, 0x50, 0x0, 0x0, 0x3d,
+    0xff, 0xf5, 0x7f, 0xff, 0xc2, 0x0, 0x0, 0x1,
+    0xef, 0xfd, 0x20, 0xaf, 0xfc, 0x20, 0x0, 0x0,
+    0x3d, 0xff, 0xf5, 0x7f, 0xff, 0xc2, 0x0, 0x0,
+    0x0, 0xaf, 0xff, 0x52, 0xcf, 0xf9, 0x0, 0x0,
+    0x0, 0x3d, 0xff, 0xf5, 0x7f, 0xff, 0xc2, 0x0,
+    0x0, 0x0, 0x5f, 0xff, 0xa6, 0xef, 0xf3, 0x0,
+    0x0, 0x0, 0x3d, 0xff, 0xf5, 0x7f, 0xff, 0xc2,
+    0x0, 0x0, 0x0, 0x2d, 0xff, 0xeb, 0xff, 0xd0,
+    0x0, 0x0, 0x0, 0x3d, 0xff, 0xf5, 0x7f, 0xff,
+    0xc2, 0x0, 0x0, 0x0, 0x19, 0xff, 0xff, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x3d, 0xff, 0xf5, 0x7f,
+    0xff, 0xc2, 0x0, 0x0, 0x0, 0x5, 0xef, 0xff,
+    0xfe, 0x40, 0x0, 0x0, 0x0, 0x3d, 0xff, 0xf5,
+    0x7f, 0xff, 0xc2, 0x0, 0x0, 0x0, 0x1, 0xdf,
+    0xff, 0xfb, 0x20, 0x0, 0x0, 0x0, 0x3d, 0xff,
+    0xf5, 0x7f, 0xff, 0xc2, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x3d,
+    0xff, 0xf5, 0x7f, 0xff, 0xc2, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x0,
+    0x3d, 0xff, 0xf5,
+    /* U+004E "N" */
+    0x24, 0x44, 0x42, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0x44, 0x43, 0x6e, 0xff,
+    0xfb, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9, 0xff, 0xfb, 0x6e, 0xff, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xfb, 0x6e, 0xff, 0xff, 0xe4, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xfb,
+    0x6e, 0xff, 0xff, 0xfc, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0xfb, 0x6e, 0xff,
+    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9, 0xff, 0xfb, 0x6e, 0xff, 0xff, 0xff,
+    0xd4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xfb, 0x6e, 0xff, 0xff, 0xff, 0xfc, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xfb,
+    0x6e, 0xff, 0xec, 0xff, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0xfb, 0x6e, 0xff,
+    0xd4, 0xdf, 0xff, 0xe4, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9, 0xff, 0xfb, 0x6e, 0xff, 0xd3, 0x6e,
+    0xff, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xfb, 0x6e, 0xff, 0xd3, 0x19, 0xff, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xfb,
+    0x6e, 0xff, 0xd3, 0x2, 0xef, 0xff, 0xe4, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0xfb, 0x6e, 0xff,
+    0xd3, 0x0, 0x6e, 0xff, 0xfc, 0x20, 0x0, 0x0,
+    0x0, 0x9, 0xff, 0xfb, 0x6e, 0xff, 0xd3, 0x0,
+    0x1a, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xfb, 0x6e, 0xff, 0xd3, 0x0, 0x2, 0xef,
+    0xff, 0xe5, 0x0, 0x0, 0x0, 0x9, 0xff, 0xfb,
+    0x6e, 0xff, 0xd3, 0x0, 0x0, 0x6e, 0xff, 0xfc,
+    0x20, 0x0, 0x0, 0x9, 0xff, 0xfb, 0x6e, 0xff,
+    0xd3, 0x0, 0x0, 0x1a, 0xff, 0xff, 0x80, 0x0,
+    0x0, 0x9, 0xff, 0xfb, 0x6e, 0xff, 0xd3, 0x0,
+    0x0, 0x2, 0xdf, 0xff, 0xe4, 0x0, 0x0, 0x9,
+    0xff, 0xfb, 0x6e, 0xff, 0xd3, 0x0, 0x0, 0x0,
+    0x6f, 0xff, 0xfb, 0x20, 0x0, 0x9, 0xff, 0xfb,
+    0x6e, 0xff, 0xd3, 0x0, 0x0, 0x0, 0x19, 0xff,
+    0xff, 0x90, 0x0, 0x9, 0xff, 0xfb, 0x6e, 0xff,
+    0xd3, 0x0, 0x0, 0x0, 0x2, 0xdf, 0xff, 0xe4,
+    0x0, 0x9, 0xff, 0xfb, 0x6e, 0xff, 0xd3, 0x0,
+    0x0, 0x0, 0x0, 0x5e, 0xff, 0xfc, 0x20, 0x9,
+    0xff, 0xfb, 0x6e, 0xff, 0xd3, 0x0, 0x0, 0x0,
+    0x0, 0x1a, 0xff, 0xff, 0x90, 0x9, 0xff, 0xfb,
+    0x6e, 0xff, 0xd3, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xcf, 0xff, 0xf4, 0x9, 0xff, 0xfb, 0x6e, 0xff,
+    0xd3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
+    0xfb, 0x29, 0xff, 0xfb, 0x6e, 0xff, 0xd3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x19, 0xff, 0xff, 0x9a,
+    0xff, 0xfb, 0x6e, 0xff, 0xd3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xcf, 0xff, 0xfd, 0xff, 0xfb,
+    0x6e, 0xff, 0xd3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5f, 0xff, 0xff, 0xff, 0xfb, 0x6e, 0xff,
+    0xd3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xff, 0xff, 0xfb, 0x6e, 0xff, 0xd3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xff,
+    0xff, 0xfb, 0x6e, 0xff, 0xd3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xfb,
+    0x6e, 0xff, 0xd3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0xff, 0xfb, 0x6e, 0xff,
+    0xd3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xcf, 0xff, 0xfb, 0x6e, 0xff, 0xd3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
+    0xff, 0xfb,
+    /* U+004F "O" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x47, 0x9a,
+    0xbb, 0x98, 0x53, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x9d, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0xa7, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xae, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6d, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0xef,
+    0xff, 0xfe, 0xd9, 0x53, 0x23, 0x47, 0xbd, 0xff,
+    0xff, 0xfb, 0x30, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0xff, 0xc6, 0x10, 0x0, 0x0, 0x0, 0x3,
+    0xae, 0xff, 0xff, 0xc2, 0x0, 0x0, 0x0, 0x5,
+    0xef, 0xff, 0xf9, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x15, 0xef, 0xff, 0xfa, 0x10, 0x0, 0x0,
+    0x2c, 0xff, 0xfe, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4d, 0xff, 0xff, 0x60, 0x0,
+    0x0, 0x7f, 0xff, 0xf9, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xef, 0xff, 0xd1,
+    0x0, 0x2, 0xef, 0xff, 0xd1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
+    0xf7, 0x0, 0x6, 0xff, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3d,
+    0xff, 0xfb, 0x10, 0x1a, 0xff, 0xfd, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x19, 0xff, 0xfe, 0x40, 0x2d, 0xff, 0xfa, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xef, 0xff, 0x70, 0x4f, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xdf, 0xff, 0xb0, 0x6f, 0xff,
+    0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xe0, 0x7f,
+    0xff, 0xe4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf1,
+    0x9f, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
+    0xf2, 0xaf, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xff, 0xf3, 0xaf, 0xff, 0xd2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xff, 0xf2, 0x9f, 0xff, 0xd2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xff, 0xf1, 0x8f, 0xff, 0xe3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xaf, 0xff, 0xf0, 0x6f, 0xff, 0xe5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xcf, 0xff, 0xe0, 0x4f, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xdf, 0xff, 0xa0, 0x2d,
+    0xff, 0xf9, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xef, 0xff, 0x70,
+    0x19, 0xff, 0xfd, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xfe,
+    0x40, 0x6, 0xef, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xff,
+    0xfb, 0x20, 0x1, 0xdf, 0xff, 0xe2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
+    0xff, 0xf6, 0x0, 0x0, 0x6f, 0xff, 0xfa, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xef, 0xff, 0xd1, 0x0, 0x0, 0x1b, 0xff, 0xff,
+    0x91, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4d, 0xff, 0xff, 0x60, 0x0, 0x0, 0x3, 0xdf,
+    0xff, 0xf9, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x15, 0xef, 0xff, 0xf9, 0x10, 0x0, 0x0, 0x0,
+    0x6e, 0xff, 0xff, 0xd5, 0x10, 0x0, 0x0, 0x0,
+    0x13, 0xae, 0xff, 0xff, 0xc2, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xef, 0xff, 0xff, 0xd8, 0x65, 0x55,
+    0x67, 0xbe, 0xff, 0xff, 0xfb, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4d, 0xff, 0xff, 0xff, 0xfe,
+    0xee, 0xef, 0xff, 0xff, 0xff, 0xa2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0x8d, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x8d,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xa5, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x26, 0x8a, 0xaa, 0x97, 0x41, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0,
+    /* U+0050 "P" */
+    0x14, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x33, 0x21, 0x0, 0x0, 0x0, 0x0, 0x5e, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xed, 0xca,
+    0x82, 0x0, 0x0, 0x0, 0x5e, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xa2,
+    0x0, 0x0, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x30, 0x0,
+    0x5e, 0xff, 0xfd, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xdd, 0xef, 0xff, 0xff, 0xc2, 0x0, 0x5e, 0xff,
+    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x12, 0x4a,
+    0xef, 0xff, 0xf8, 0x0, 0x5e, 0xff, 0xf3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x7f, 0xff,
+    0xfd, 0x30, 0x5e, 0xff, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0x70,
+    0x5e, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xef, 0xff, 0x91, 0x5e, 0xff,
+    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xcf, 0xff, 0xb1, 0x5e, 0xff, 0xf3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xbf,
+    0xff, 0xc2, 0x5e, 0xff, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xbf, 0xff, 0xc1,
+    0x5e, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xcf, 0xff, 0xb1, 0x5e, 0xff,
+    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xef, 0xff, 0x90, 0x5e, 0xff, 0xf3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
+    0xfe, 0x60, 0x5e, 0xff, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x8f, 0xff, 0xfc, 0x20,
+    0x5e, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x13, 0x7b, 0xff, 0xff, 0xf6, 0x0, 0x5e, 0xff,
+    0xfc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xde, 0xff,
+    0xff, 0xff, 0xa1, 0x0, 0x5e, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
+    0x20, 0x0, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfd, 0x82, 0x0, 0x0,
+    0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xed, 0xca, 0x72, 0x0, 0x0, 0x0, 0x5e, 0xff,
+    0xf7, 0x44, 0x44, 0x44, 0x44, 0x44, 0x43, 0x21,
+    0x0, 0x0, 0x0, 0x0, 0x5e, 0xff, 0xf3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5e, 0xff, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5e, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5e, 0xff,
+    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5e, 0xff, 0xf3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5e, 0xff, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5e, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5e, 0xff,
+    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5e, 0xff, 0xf3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5e, 0xff, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5e, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5e, 0xff,
+    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5e, 0xff, 0xf3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x25, 0x55, 0x51, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    /* U+0051 "Q" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x13, 0x57, 0x9a,
+    0xbb, 0x97, 0x53, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xad, 0xff,
+    0xff, 0xff, 0xff, 0xfd, 0x95, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x15, 0xcf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xb4, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x8e, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0x71, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2a, 0xff,
+    0xff, 0xfe, 0xc7, 0x43, 0x23, 0x58, 0xce, 0xff,
+    0xff, 0xf9, 0x10, 0x0, 0x0, 0x0, 0x1, 0xaf,
+    0xff, 0xff, 0xa4, 0x0, 0x0, 0x0, 0x0, 0x15,
+    0xbf, 0xff, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x7,
+    0xef, 0xff, 0xe6, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x17, 0xef, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x4e, 0xff, 0xfd, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6e, 0xff, 0xfe, 0x40, 0x0,
+    0x0, 0xaf, 0xff, 0xe6, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x18, 0xff, 0xff, 0xa0,
+    0x0, 0x4, 0xef, 0xff, 0xa0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xff,
+    0xe4, 0x0, 0x8, 0xff, 0xfe, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
+    0xff, 0xf9, 0x0, 0x2c, 0xff, 0xfa, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1b, 0xff, 0xfc, 0x20, 0x4f, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0xfe, 0x40, 0x7f, 0xff, 0xe4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xef, 0xff, 0x70, 0xaf, 0xff,
+    0xd2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xdf, 0xff, 0xa0, 0xcf,
+    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xff, 0xc0,
+    0xdf, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
+    0xd0, 0xef, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
+    0xff, 0xe0, 0xef, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xcf, 0xff, 0xe0, 0xdf, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xcf, 0xff, 0xd0, 0xcf, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xdf, 0xff, 0xc0, 0xaf, 0xff, 0xd2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xdf, 0xff, 0xa0, 0x7f, 0xff,
+    0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xef, 0xff, 0x70, 0x4e,
+    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0x50,
+    0x2c, 0xff, 0xfb, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2b, 0xff, 0xfc,
+    0x20, 0x9, 0xff, 0xfe, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0x20, 0x0, 0x0, 0x0, 0x4e, 0xff,
+    0xf9, 0x0, 0x3, 0xef, 0xff, 0xb1, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xeb, 0x52, 0x0, 0x1, 0xcf,
+    0xff, 0xe4, 0x0, 0x0, 0xaf, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x1c, 0xff, 0xfc, 0x51, 0x7,
+    0xff, 0xff, 0xb0, 0x0, 0x0, 0x3d, 0xff, 0xfe,
+    0x60, 0x0, 0x0, 0x0, 0x4d, 0xff, 0xff, 0xe9,
+    0x7e, 0xff, 0xfd, 0x30, 0x0, 0x0, 0x6, 0xef,
+    0xff, 0xe7, 0x10, 0x0, 0x0, 0x14, 0x8d, 0xff,
+    0xff, 0xff, 0xff, 0xe7, 0x0, 0x0, 0x0, 0x1,
+    0x9f, 0xff, 0xfe, 0xb4, 0x10, 0x0, 0x0, 0x2,
+    0x9f, 0xff, 0xff, 0xff, 0x91, 0x0, 0x0, 0x0,
+    0x0, 0x18, 0xef, 0xff, 0xff, 0xc8, 0x65, 0x45,
+    0x68, 0xcf, 0xff, 0xff, 0xfe, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x7e, 0xff, 0xff, 0xff, 0xfe,
+    0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xae, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0xbd, 0xff, 0xff,
+    0xc5, 0x10, 0x0, 0x0, 0x0, 0x0, 0x15, 0x9e,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0x94, 0x13, 0xbf,
+    0xff, 0xfe, 0xb4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x36, 0x9a, 0xaa, 0x86, 0x30, 0x0, 0x0,
+    0x16, 0xcf, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x38, 0xef, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x27, 0x40,
+    /* U+0052 "R" */
+    0x14, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x43, 0x21, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xee, 0xca, 0x82, 0x0, 0x0, 0x0, 0x0,
+    0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0x81, 0x0, 0x0, 0x0,
+    0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf9, 0x10, 0x0, 0x0,
+    0x5e, 0xff, 0xfa, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x89, 0xbd, 0xef, 0xff, 0xff, 0x70, 0x0, 0x0,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x5c, 0xff, 0xff, 0xe3, 0x0, 0x0,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xbf, 0xff, 0xf8, 0x0, 0x0,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3e, 0xff, 0xfd, 0x0, 0x0,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xfe, 0x30, 0x0,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7, 0xff, 0xfe, 0x40, 0x0,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7, 0xff, 0xfe, 0x40, 0x0,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0xff, 0xfe, 0x30, 0x0,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1d, 0xff, 0xfd, 0x10, 0x0,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x9f, 0xff, 0xf9, 0x0, 0x0,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x18, 0xef, 0xff, 0xe3, 0x0, 0x0,
+    0x5e, 0xff, 0xf6, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x23, 0x48, 0xdf, 0xff, 0xff, 0x80, 0x0, 0x0,
+    0x5e, 0xff, 0xfe, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xef, 0xff, 0xff, 0xff, 0xf9, 0x10, 0x0, 0x0,
+    0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfd, 0x71, 0x0, 0x0, 0x0,
+    0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xeb, 0x82, 0x0, 0x0, 0x0, 0x0,
+    0x5e, 0xff, 0xfe, 0xee, 0xee, 0xee, 0xee, 0xff,
+    0xff, 0xe7, 0x31, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x14, 0x9e,
+    0xff, 0xfd, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x15,
+    0xdf, 0xff, 0xe8, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3d, 0xff, 0xff, 0x91, 0x0, 0x0, 0x0, 0x0,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xef, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xff, 0xfe, 0x50, 0x0, 0x0, 0x0,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1c, 0xff, 0xff, 0xc1, 0x0, 0x0, 0x0,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xdf, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0xfe, 0x40, 0x0, 0x0,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1c, 0xff, 0xff, 0xb2, 0x0, 0x0,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xef, 0xff, 0xf7, 0x0, 0x0,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x8f, 0xff, 0xfd, 0x40, 0x0,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1c, 0xff, 0xff, 0xb1, 0x0,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xef, 0xff, 0xf7, 0x0,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x9f, 0xff, 0xfe, 0x30,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2d, 0xff, 0xff, 0x91,
+    /* U+0053 "S" */
+    0x0, 0x0, 0x0, 0x1, 0x36, 0x8b, 0xcd, 0xdc,
+    0x97, 0x42, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x5a, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xec,
+    0x82, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3b, 0xef,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x51,
+    0x0, 0x0, 0x0, 0x3, 0xcf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x0, 0x0,
+    0x0, 0x2b, 0xff, 0xff, 0xeb, 0x75, 0x32, 0x34,
+    0x7a, 0xdf, 0xff, 0xff, 0x60, 0x0, 0x0, 0x7f,
+    0xff, 0xfb, 0x40, 0x0, 0x0, 0x0, 0x0, 0x39,
+    0xff, 0xff, 0xd3, 0x0, 0x1, 0xdf, 0xff, 0xc2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x9f, 0xff,
+    0xf8, 0x0, 0x5, 0xef, 0xff, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2b, 0xff, 0xfd, 0x10,
+    0x7, 0xff, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0xff, 0x30, 0x8, 0xff,
+    0xfc, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xff, 0xff, 0x60, 0x8, 0xff, 0xfd, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaa,
+    0x87, 0x30, 0x5, 0xef, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xef, 0xff, 0xe7, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xff, 0xff, 0xd7, 0x31, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2b, 0xff, 0xff,
+    0xff, 0xeb, 0x95, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xbf, 0xff, 0xff, 0xff,
+    0xfe, 0xed, 0x95, 0x21, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x29, 0xef, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xeb, 0x73, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x3a, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfd, 0x82, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x26, 0x9c, 0xef, 0xff, 0xff, 0xff, 0xff, 0xfd,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0x36, 0x9d, 0xef, 0xff, 0xff, 0xff, 0xd5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x36, 0xad, 0xff, 0xff, 0xfd, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x13,
+    0x9e, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xef,
+    0xff, 0xd2, 0x1, 0x24, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xe5,
+    0xcf, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3d, 0xff, 0xf7, 0xbf, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2c, 0xff, 0xf7, 0x8f, 0xff, 0xe3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2c,
+    0xff, 0xf7, 0x4f, 0xff, 0xf9, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xff, 0xe5,
+    0x2b, 0xff, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xbf, 0xff, 0xc2, 0x6, 0xef,
+    0xff, 0xe7, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x18, 0xff, 0xff, 0x80, 0x1, 0xbf, 0xff, 0xfe,
+    0xc5, 0x21, 0x0, 0x0, 0x1, 0x15, 0xce, 0xff,
+    0xfc, 0x20, 0x0, 0x2c, 0xff, 0xff, 0xff, 0xda,
+    0x86, 0x66, 0x7a, 0xdf, 0xff, 0xff, 0xe4, 0x0,
+    0x0, 0x3, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0x50, 0x0, 0x0, 0x0,
+    0x18, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0xa3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x38,
+    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa5, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x57,
+    0x9a, 0xaa, 0x97, 0x41, 0x0, 0x0, 0x0, 0x0,
+    /* U+0054 "T" */
+    0x3, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x12, 0xbf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf5, 0x2b, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x52, 0xbf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf5, 0x19, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xef, 0xff, 0xfd, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xfd, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xd2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0xfd, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xff, 0xd2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9, 0xff, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
+    0xff, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xfd,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xd2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0xfd, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
+    0xd2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xfd, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9f, 0xff, 0xd2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9, 0xff, 0xfd, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xfd, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xd2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0xfd, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xff, 0xd2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9, 0xff, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
+    0xff, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xfd,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xd2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0xfd, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
+    0xd2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xfd, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9f, 0xff, 0xd2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0,
+    /* U+0055 "U" */
+    0x14, 0x44, 0x41, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0x44, 0x43, 0x5e, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xfc, 0x5e, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xfc, 0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfc,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xfc, 0x5e, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xfc, 0x5e, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xfc, 0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfc,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xfc, 0x5e, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xfc, 0x5e, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xfc, 0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfc,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xfc, 0x5e, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xfc, 0x5e, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xfc, 0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfc,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xfc, 0x5e, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xfc, 0x5e, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xfc, 0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfc,
+    0x4e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xfc, 0x4e, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0xff, 0xfc, 0x3e, 0xff, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0xff, 0xfb, 0x3e, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xfa,
+    0x1e, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1e, 0xff, 0xf8, 0xd, 0xff,
+    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3e, 0xff, 0xf7, 0xa, 0xff, 0xfe, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0xf4, 0x7, 0xff, 0xfe, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xbf, 0xff, 0xd2,
+    0x3, 0xef, 0xff, 0xb2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xef, 0xff, 0xa1, 0x1, 0xaf,
+    0xff, 0xfa, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3d, 0xff, 0xfe, 0x50, 0x0, 0x5e, 0xff, 0xff,
+    0xb5, 0x11, 0x0, 0x0, 0x1, 0x28, 0xdf, 0xff,
+    0xfa, 0x10, 0x0, 0x8, 0xff, 0xff, 0xff, 0xd9,
+    0x76, 0x67, 0x8b, 0xef, 0xff, 0xff, 0xd2, 0x0,
+    0x0, 0x1, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfd, 0x40, 0x0, 0x0, 0x0,
+    0x6, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0xa1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x37,
+    0xdf, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xb4, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x58,
+    0x9a, 0xaa, 0x97, 0x40, 0x0, 0x0, 0x0, 0x0,
+    /* U+0056 "V" */
+    0x34, 0x44, 0x41, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x14, 0x44, 0x42,
+    0x7f, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xe6,
+    0x3d, 0xff, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xd1,
+    0x1a, 0xff, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xff, 0x80,
+    0x5, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xfe, 0x30,
+    0x1, 0xdf, 0xff, 0xc1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xfa, 0x10,
+    0x0, 0x8f, 0xff, 0xe4, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4e, 0xff, 0xe6, 0x0,
+    0x0, 0x3e, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xd2, 0x0,
+    0x0, 0x1a, 0xff, 0xfc, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0x90, 0x0,
+    0x0, 0x6, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0x30, 0x0,
+    0x0, 0x2, 0xef, 0xff, 0x90, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0xfc, 0x10, 0x0,
+    0x0, 0x0, 0x9f, 0xff, 0xe2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3d, 0xff, 0xf6, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xff, 0xf6, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xff, 0xd3, 0x0, 0x0,
+    0x0, 0x0, 0x1b, 0xff, 0xfa, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xbf, 0xff, 0x90, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0xfd, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xff, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xdf, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xfc, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0x1c, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xff, 0xf3, 0x0, 0x0,
+    0x0, 0x0, 0x5e, 0xff, 0xd3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1c, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xff, 0x90, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7, 0xff, 0xfb, 0x10, 0x0,
+    0x0, 0x2, 0xdf, 0xff, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xdf, 0xfe, 0x50, 0x0,
+    0x0, 0x5, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0x80, 0x0,
+    0x0, 0xb, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xe1, 0x0,
+    0x0, 0x3d, 0xff, 0xd3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1d, 0xff, 0xf5, 0x0,
+    0x0, 0x7f, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xfa, 0x0,
+    0x1, 0xcf, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xef, 0xfd, 0x30,
+    0x4, 0xff, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xbf, 0xff, 0x60,
+    0x9, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xa1,
+    0x1d, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xe2,
+    0x5e, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xf5,
+    0x9f, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xef, 0xfb,
+    0xcf, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xbf, 0xff,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xff, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff,
+    0xff, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
+    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    /* U+0057 "W" */
+    0x14, 0x44, 0x42, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x44, 0x44, 0x42, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x34, 0x44, 0x34, 0xef,
+    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2d, 0xff, 0xf8, 0x2c, 0xff, 0xf9,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0xff, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0xfe, 0x50, 0xaf, 0xff, 0xc2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff,
+    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0xe1, 0x6, 0xff, 0xfe, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3d, 0xff, 0xff, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfb,
+    0x0, 0x3e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xef, 0xfc, 0xef, 0xfc, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xef, 0xff, 0x60, 0x0,
+    0xdf, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xff, 0x6c, 0xff, 0xd4, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4e, 0xff, 0xe3, 0x0, 0x9, 0xff,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2c, 0xff,
+    0xe1, 0xaf, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xfc, 0x20, 0x0, 0x5f, 0xff, 0xd2,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xfb, 0x6,
+    0xff, 0xfa, 0x10, 0x0, 0x0, 0x0, 0x1, 0xaf,
+    0xff, 0x90, 0x0, 0x3, 0xdf, 0xfe, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0x70, 0x1f, 0xff,
+    0xe1, 0x0, 0x0, 0x0, 0x0, 0x2c, 0xff, 0xe6,
+    0x0, 0x0, 0x1b, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xe4, 0x0, 0xdf, 0xff, 0x40,
+    0x0, 0x0, 0x0, 0x4, 0xef, 0xfd, 0x30, 0x0,
+    0x0, 0x8f, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x2,
+    0xdf, 0xfb, 0x20, 0x8, 0xff, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xc0, 0x0, 0x0, 0x5,
+    0xef, 0xfc, 0x20, 0x0, 0x0, 0x0, 0x6e, 0xff,
+    0x90, 0x0, 0x5f, 0xff, 0xc1, 0x0, 0x0, 0x0,
+    0xa, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x1e, 0xff,
+    0xf4, 0x0, 0x0, 0x0, 0x9, 0xff, 0xe6, 0x0,
+    0x2, 0xcf, 0xfd, 0x30, 0x0, 0x0, 0x0, 0xef,
+    0xff, 0x40, 0x0, 0x0, 0x0, 0xcf, 0xff, 0x70,
+    0x0, 0x0, 0x2, 0xbf, 0xfe, 0x20, 0x0, 0x1a,
+    0xff, 0xf6, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xd2,
+    0x0, 0x0, 0x0, 0x7, 0xff, 0xfb, 0x0, 0x0,
+    0x0, 0x3e, 0xff, 0xc0, 0x0, 0x0, 0x7f, 0xff,
+    0xa1, 0x0, 0x0, 0x7, 0xff, 0xf9, 0x10, 0x0,
+    0x0, 0x0, 0x4f, 0xff, 0xd0, 0x0, 0x0, 0x7,
+    0xff, 0xf7, 0x0, 0x0, 0x3, 0xef, 0xfd, 0x20,
+    0x0, 0x0, 0xaf, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x2, 0xdf, 0xfe, 0x30, 0x0, 0x0, 0xbf, 0xff,
+    0x30, 0x0, 0x0, 0xd, 0xff, 0xf4, 0x0, 0x0,
+    0x2c, 0xff, 0xd4, 0x0, 0x0, 0x0, 0x0, 0x19,
+    0xff, 0xf6, 0x0, 0x0, 0x1e, 0xff, 0xc2, 0x0,
+    0x0, 0x0, 0x9f, 0xff, 0x80, 0x0, 0x4, 0xef,
+    0xfc, 0x10, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0x90, 0x0, 0x5, 0xef, 0xf9, 0x10, 0x0, 0x0,
+    0x5, 0xff, 0xfc, 0x0, 0x0, 0x6f, 0xff, 0x90,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xef, 0xfb, 0x20,
+    0x0, 0x9f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x3d,
+    0xff, 0xe2, 0x0, 0x9, 0xff, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1d, 0xff, 0xd3, 0x0, 0x1b,
+    0xff, 0xe3, 0x0, 0x0, 0x0, 0x1, 0xbf, 0xfe,
+    0x50, 0x0, 0xdf, 0xff, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xff, 0x50, 0x4, 0xef, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xf9, 0x0,
+    0x2f, 0xff, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xff, 0xf8, 0x0, 0x6f, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x4e, 0xff, 0xb1, 0x6, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e,
+    0xff, 0xc0, 0xa, 0xff, 0xf4, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xdf, 0xfe, 0x30, 0xaf, 0xfe, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xfe,
+    0x0, 0xef, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0xa, 0xff, 0xf4, 0x1c, 0xff, 0xc2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xf4, 0x3f,
+    0xff, 0xa1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
+    0xff, 0x73, 0xdf, 0xfa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5e, 0xff, 0x67, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xef, 0xfa,
+    0x5f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xdf, 0xf9, 0xaf, 0xfe, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xd8, 0xff,
+    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xdd, 0xff, 0xc1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0xcf, 0xfd, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xef, 0xff, 0xff, 0x90, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
+    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2d, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xff, 0xe2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
+    0xff, 0xfd, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xaf, 0xff, 0xfb, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
+    0xb1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0,
+    /* U+0058 "X" */
+    0x0, 0x44, 0x44, 0x42, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0x44, 0x44, 0x20,
+    0x0, 0xaf, 0xff, 0xfa, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1a, 0xff, 0xfe, 0x40,
+    0x0, 0x3c, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xe7, 0x0,
+    0x0, 0x5, 0xef, 0xff, 0xe3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xa1, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0xfb, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3c, 0xff, 0xfc, 0x20, 0x0,
+    0x0, 0x0, 0x1b, 0xff, 0xff, 0x90, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xbf, 0xff, 0xe5, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xdf, 0xff, 0xe4, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xff, 0xfc, 0x20, 0x0,
+    0x0, 0x0, 0x6e, 0xff, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1a, 0xff, 0xff, 0xa0, 0x0,
+    0x0, 0x2, 0xdf, 0xff, 0xc3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xcf, 0xff, 0xf6, 0x0,
+    0x0, 0x1b, 0xff, 0xfe, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xfd, 0x30,
+    0x0, 0x8f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xb1,
+    0x5, 0xff, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xbf, 0xff, 0xf6,
+    0x2c, 0xff, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xfd,
+    0xcf, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xef, 0xff,
+    0xff, 0xff, 0x81, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x9f, 0xff,
+    0xff, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xff,
+    0xff, 0xd3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xff,
+    0xff, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xff, 0xfc, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xef, 0xff,
+    0xff, 0xff, 0x81, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xff, 0xfe,
+    0xdf, 0xff, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xaf, 0xff, 0xf6,
+    0x7f, 0xff, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0x91,
+    0xa, 0xff, 0xff, 0xb1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4e, 0xff, 0xfd, 0x30,
+    0x3, 0xdf, 0xff, 0xe7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xdf, 0xff, 0xe4, 0x0,
+    0x0, 0x5e, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1a, 0xff, 0xff, 0x80, 0x0,
+    0x0, 0x19, 0xff, 0xff, 0xb2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0xfa, 0x10, 0x0,
+    0x0, 0x2, 0xcf, 0xff, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xef, 0xff, 0xe3, 0x0, 0x0,
+    0x0, 0x0, 0x5e, 0xff, 0xff, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x2c, 0xff, 0xfe, 0x60, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0xff, 0xc3, 0x0, 0x0,
+    0x0, 0x1, 0xaf, 0xff, 0xf9, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xbf, 0xff, 0xfb, 0x10, 0x0,
+    0x0, 0x7, 0xff, 0xff, 0xd2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4d, 0xff, 0xff, 0x70, 0x0,
+    0x0, 0x4e, 0xff, 0xfe, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xe4, 0x0,
+    0x1, 0xcf, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xfc, 0x20,
+    0x19, 0xff, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2c, 0xff, 0xff, 0xa1,
+    0x6e, 0xff, 0xfd, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xe5,
+    /* U+0059 "Y" */
+    0x34, 0x44, 0x43, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x44, 0x44, 0x42,
+    0x6e, 0xff, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xef, 0xff, 0xe3,
+    0x19, 0xff, 0xff, 0xc1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2b, 0xff, 0xff, 0x60,
+    0x2, 0xdf, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xfa, 0x10,
+    0x0, 0x6e, 0xff, 0xfe, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xef, 0xff, 0xc3, 0x0,
+    0x0, 0x19, 0xff, 0xff, 0xb1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1b, 0xff, 0xff, 0x50, 0x0,
+    0x0, 0x2, 0xdf, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0xf9, 0x10, 0x0,
+    0x0, 0x0, 0x5e, 0xff, 0xfd, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xef, 0xff, 0xc2, 0x0, 0x0,
+    0x0, 0x0, 0x1a, 0xff, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0x1b, 0xff, 0xff, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xcf, 0xff, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xff, 0xfd, 0x30, 0x0,
+    0x0, 0x2, 0xef, 0xff, 0xc2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x19, 0xff, 0xff, 0xb0, 0x0,
+    0x0, 0x1b, 0xff, 0xfe, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xdf, 0xff, 0xf5, 0x0,
+    0x0, 0x6e, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5e, 0xff, 0xfc, 0x20,
+    0x3, 0xdf, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0x80,
+    0xa, 0xff, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xff, 0xe3,
+    0x5e, 0xff, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xfc,
+    0xcf, 0xff, 0x91, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
+    0xff, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xff,
+    0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
+    0xff, 0x81, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
+    0xfd, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    /* U+005A "Z" */
+    0x0, 0x13, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x42, 0x0, 0x3,
+    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x3d, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf8, 0x0, 0x3, 0xdf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x80, 0x0, 0x2b, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcd, 0xff, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0xfd, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7e, 0xff, 0xfe, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5e,
+    0xff, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4d, 0xff, 0xff,
+    0x91, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2c, 0xff, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0xff, 0xc3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x18,
+    0xff, 0xff, 0xd3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xef, 0xff,
+    0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xef, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xcf, 0xff, 0xfa, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xbf, 0xff, 0xfb, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x8f, 0xff,
+    0xfd, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6e, 0xff, 0xfe, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4e, 0xff, 0xfe, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3c, 0xff, 0xff, 0x91, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b, 0xff,
+    0xff, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xc3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xef, 0xff, 0xe4, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xef, 0xff, 0xe7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xdf,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xaf, 0xff, 0xfb,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x9f, 0xff, 0xfb, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6e, 0xff, 0xfd, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e,
+    0xff, 0xfe, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xff, 0xfe,
+    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1a, 0xff, 0xff, 0xa2, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x3, 0xdf, 0xff, 0xff, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe2,
+    0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x23, 0xdf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf2, 0x3d, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x20,
+    /* U+005B "[" */
+    0x3, 0x44, 0x44, 0x44, 0x44, 0x21, 0xaf, 0xff,
+    0xff, 0xff, 0xf8, 0x1a, 0xff, 0xff, 0xff, 0xff,
+    0x81, 0xaf, 0xff, 0xff, 0xff, 0xf8, 0x1a, 0xff,
+    0xf9, 0x33, 0x33, 0x11, 0xaf, 0xff, 0x80, 0x0,
+    0x0, 0x1a, 0xff, 0xf8, 0x0, 0x0, 0x1, 0xaf,
+    0xff, 0x80, 0x0, 0x0, 0x1a, 0xff, 0xf8, 0x0,
+    0x0, 0x1, 0xaf, 0xff, 0x80, 0x0, 0x0, 0x1a,
+    0xff, 0xf8, 0x0, 0x0, 0x1, 0xaf, 0xff, 0x80,
+    0x0, 0x0, 0x1a, 0xff, 0xf8, 0x0, 0x0, 0x1,
+    0xaf, 0xff, 0x80, 0x0, 0x0, 0x1a, 0xff, 0xf8,
+    0x0, 0x0, 0x1, 0xaf, 0xff, 0x80, 0x0, 0x0,
+    0x1a, 0xff, 0xf8, 0x0, 0x0, 0x1, 0xaf, 0xff,
+    0x80, 0x0, 0x0, 0x1a, 0xff, 0xf8, 0x0, 0x0,
+    0x1, 0xaf, 0xff, 0x80, 0x0, 0x0, 0x1a, 0xff,
+    0xf8, 0x0, 0x0, 0x1, 0xaf, 0xff, 0x80, 0x0,
+    0x0, 0x1a, 0xff, 0xf8, 0x0, 0x0, 0x1, 0xaf,
+    0xff, 0x80, 0x0, 0x0, 0x1a, 0xff, 0xf8, 0x0,
+    0x0, 0x1, 0xaf, 0xff, 0x80, 0x0, 0x0, 0x1a,
+    0xff, 0xf8, 0x0, 0x0, 0x1, 0xaf, 0xff, 0x80,
+    0x0, 0x0, 0x1a, 0xff, 0xf8, 0x0, 0x0, 0x1,
+    0xaf, 0xff, 0x80, 0x0, 0x0, 0x1a, 0xff, 0xf8,
+    0x0, 0x0, 0x1, 0xaf, 0xff, 0x80, 0x0, 0x0,
+    0x1a, 0xff, 0xf8, 0x0, 0x0, 0x1, 0xaf, 0xff,
+    0x80, 0x0, 0x0, 0x1a, 0xff, 0xf8, 0x0, 0x0,
+    0x1, 0xaf, 0xff, 0x80, 0x0, 0x0, 0x1a, 0xff,
+    0xf8, 0x0, 0x0, 0x1, 0xaf, 0xff, 0x80, 0x0,
+    0x0, 0x1a, 0xff, 0xf8, 0x0, 0x0, 0x1, 0xaf,
+    0xff, 0x80, 0x0, 0x0, 0x1a, 0xff, 0xf8, 0x11,
+    0x11, 0x1, 0xaf, 0xff, 0xed, 0xdd, 0xd7, 0x1a,
+    0xff, 0xff, 0xff, 0xff, 0x81, 0xaf, 0xff, 0xff,
+    0xff, 0xf8, 0x16, 0x99, 0x99, 0x99, 0x99, 0x50,
+    /* U+005C "\\" */
+    0x9a, 0xa4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
+    0xfa, 0x10, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xfd,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x3d, 0xff, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0x1b, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0xc1, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xd3, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xef, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xbf, 0xf9, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0, 0x4e,
+    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x1b, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xef, 0xe3, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xef, 0xe6, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xbf, 0xf9, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xfc, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x3e, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x2c, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xef,
+    0xe2, 0x0, 0x0, 0x0, 0x0, 0x3, 0xdf, 0xe5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf9, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xfc, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0xfe, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x2d, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x19, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xdf, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
+    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xfb,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfe, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0x1d, 0xff, 0x60, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xff, 0xe0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0x9a, 0xa2,
+    /* U+005D "]" */
+    0x14, 0x44, 0x44, 0x44, 0x44, 0x13, 0xdf, 0xff,
+    0xff, 0xff, 0xf4, 0x3d, 0xff, 0xff, 0xff, 0xff,
+    0x43, 0xdf, 0xff, 0xff, 0xff, 0xf4, 0x2, 0x33,
+    0x34, 0xdf, 0xff, 0x40, 0x0, 0x0, 0x2d, 0xff,
+    0xf4, 0x0, 0x0, 0x2, 0xdf, 0xff, 0x40, 0x0,
+    0x0, 0x2d, 0xff, 0xf4, 0x0, 0x0, 0x2, 0xdf,
+    0xff, 0x40, 0x0, 0x0, 0x2d, 0xff, 0xf4, 0x0,
+    0x0, 0x2, 0xdf, 0xff, 0x40, 0x0, 0x0, 0x2d,
+    0xff, 0xf4, 0x0, 0x0, 0x2, 0xdf, 0xff, 0x40,
+    0x0, 0x0, 0x2d, 0xff, 0xf4, 0x0, 0x0, 0x2,
+    0xdf, 0xff, 0x40, 0x0, 0x0, 0x2d, 0xff, 0xf4,
+    0x0, 0x0, 0x2, 0xdf, 0xff, 0x40, 0x0, 0x0,
+    0x2d, 0xff, 0xf4, 0x0, 0x0, 0x2, 0xdf, 0xff,
+    0x40, 0x0, 0x0, 0x2d, 0xff, 0xf4, 0x0, 0x0,
+    0x2, 0xdf, 0xff, 0x40, 0x0, 0x0, 0x2d, 0xff,
+    0xf4, 0x0, 0x0, 0x2, 0xdf, 0xff, 0x40, 0x0,
+    0x0, 0x2d, 0xff, 0xf4, 0x0, 0x0, 0x2, 0xdf,
+    0xff, 0x40, 0x0, 0x0, 0x2d, 0xff, 0xf4, 0x0,
+    0x0, 0x2, 0xdf, 0xff, 0x40, 0x0, 0x0, 0x2d,
+    0xff, 0xf4, 0x0, 0x0, 0x2, 0xdf, 0xff, 0x40,
+    0x0, 0x0, 0x2d, 0xff, 0xf4, 0x0, 0x0, 0x2,
+    0xdf, 0xff, 0x40, 0x0, 0x0, 0x2d, 0xff, 0xf4,
+    0x0, 0x0, 0x2, 0xdf, 0xff, 0x40, 0x0, 0x0,
+    0x2d, 0xff, 0xf4, 0x0, 0x0, 0x2, 0xdf, 0xff,
+    0x40, 0x0, 0x0, 0x2d, 0xff, 0xf4, 0x0, 0x0,
+    0x2, 0xdf, 0xff, 0x40, 0x0, 0x0, 0x2d, 0xff,
+    0xf4, 0x0, 0x0, 0x2, 0xdf, 0xff, 0x40, 0x0,
+    0x0, 0x2d, 0xff, 0xf4, 0x0, 0x11, 0x12, 0xdf,
+    0xff, 0x43, 0xbd, 0xdd, 0xdf, 0xff, 0xf4, 0x3d,
+    0xff, 0xff, 0xff, 0xff, 0x43, 0xdf, 0xff, 0xff,
+    0xff, 0xf4, 0x28, 0x99, 0x99, 0x99, 0x99, 0x20,
+    /* U+005E "^" */
+    0x0, 0x0, 0x0, 0x0, 0x25, 0x55, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xff, 0xfe, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4d, 0xff, 0xff,
+    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0xfd, 0xff, 0xe2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xdf, 0xfc, 0x6f, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x62, 0xcf,
+    0xfc, 0x20, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xff,
+    0xd3, 0x8, 0xff, 0xe6, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xef, 0xf9, 0x0, 0x2f, 0xff, 0xb1, 0x0,
+    0x0, 0x0, 0x1, 0xaf, 0xfe, 0x40, 0x0, 0xaf,
+    0xff, 0x40, 0x0, 0x0, 0x0, 0x4e, 0xff, 0xc0,
+    0x0, 0x5, 0xff, 0xfa, 0x0, 0x0, 0x0, 0xa,
+    0xff, 0xf6, 0x0, 0x0, 0x2b, 0xff, 0xe4, 0x0,
+    0x0, 0x2, 0xef, 0xfd, 0x20, 0x0, 0x0, 0x8f,
+    0xff, 0x81, 0x0, 0x0, 0x8f, 0xff, 0x90, 0x0,
+    0x0, 0x2, 0xef, 0xfd, 0x30, 0x0, 0x2c, 0xff,
+    0xe4, 0x0, 0x0, 0x0, 0xa, 0xff, 0xf7, 0x0,
+    0x6, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xff, 0xd1, 0x0, 0xcf, 0xff, 0x60, 0x0, 0x0,
+    0x0, 0x1, 0xbf, 0xfe, 0x60, 0x5f, 0xff, 0xd2,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xfb, 0x15,
+    0x88, 0x85, 0x0, 0x0, 0x0, 0x0, 0x0, 0x27,
+    0x88, 0x72,
+    /* U+005F "_" */
+    0x46, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x2b, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xe5, 0xbf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0x56, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x83,
+    /* U+0060 "`" */
+    0x6a, 0xaa, 0xa8, 0x10, 0x3, 0xcf, 0xff, 0xe5,
+    0x0, 0x4, 0xdf, 0xff, 0xc0, 0x0, 0x5, 0xef,
+    0xfe, 0x40, 0x0, 0x7, 0xef, 0xfa, 0x10, 0x0,
+    0x19, 0xff, 0xe4, 0x0, 0x0, 0x2a, 0xdd, 0x90,
+    /* U+0061 "a" */
+    0x0, 0x0, 0x0, 0x0, 0x23, 0x55, 0x66, 0x54,
+    0x31, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49,
+    0xcd, 0xef, 0xff, 0xfe, 0xca, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x4b, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfb, 0x30, 0x0, 0x0, 0x4, 0xdf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0x0,
+    0x0, 0x2d, 0xff, 0xfe, 0xa6, 0x32, 0x23, 0x6a,
+    0xef, 0xff, 0xf8, 0x0, 0x0, 0x8f, 0xff, 0xe7,
+    0x10, 0x0, 0x0, 0x0, 0x6e, 0xff, 0xfc, 0x20,
+    0x3, 0xdf, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xfe, 0x40, 0x5, 0xff, 0xfd, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xdf, 0xff, 0x50,
+    0x2, 0x79, 0xb9, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xdf, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x11,
+    0x49, 0xef, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x23, 0x56, 0x89, 0xce, 0xff, 0xff, 0xff, 0x50,
+    0x0, 0x0, 0x3, 0x8b, 0xcd, 0xef, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x50, 0x0, 0x3, 0x9f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xec, 0xef, 0xff, 0x50,
+    0x0, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x96,
+    0x43, 0xdf, 0xff, 0x50, 0x3, 0xcf, 0xff, 0xfd,
+    0xa8, 0x52, 0x0, 0x0, 0x2, 0xdf, 0xff, 0x50,
+    0x9, 0xff, 0xff, 0xa3, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xdf, 0xff, 0x50, 0x1e, 0xff, 0xfb, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xdf, 0xff, 0x50,
+    0x3e, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xef, 0xff, 0x50, 0x4f, 0xff, 0xf4, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1a, 0xff, 0xff, 0x50,
+    0x3e, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5e, 0xff, 0xff, 0x60, 0x1e, 0xff, 0xfc, 0x10,
+    0x0, 0x0, 0x0, 0x15, 0xdf, 0xff, 0xff, 0x60,
+    0x9, 0xff, 0xff, 0xb4, 0x10, 0x0, 0x14, 0x9e,
+    0xff, 0xff, 0xff, 0x80, 0x3, 0xdf, 0xff, 0xfd,
+    0xba, 0x9b, 0xce, 0xff, 0xfb, 0xaf, 0xff, 0xa0,
+    0x0, 0x4d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
+    0x71, 0x4f, 0xff, 0xe1, 0x0, 0x4, 0xbf, 0xff,
+    0xff, 0xff, 0xff, 0x94, 0x0, 0x2d, 0xff, 0xf5,
+    0x0, 0x0, 0x2, 0x69, 0xaa, 0x98, 0x41, 0x0,
+    0x0, 0x1, 0x22, 0x21,
+    /* U+0062 "b" */
+    0x3, 0x44, 0x42, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xbf, 0xfe, 0x60, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2b,
+    0xff, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xbf, 0xfe, 0x60, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2b, 0xff,
+    0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xbf, 0xfe, 0x60, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2b, 0xff, 0xe6,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xbf, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2b, 0xff, 0xe6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xbf, 0xfe, 0x60, 0x0, 0x24, 0x56, 0x53, 0x10,
+    0x0, 0x0, 0x0, 0x2b, 0xff, 0xe6, 0x2, 0x8c,
+    0xef, 0xfe, 0xdb, 0x71, 0x0, 0x0, 0x2, 0xbf,
+    0xfe, 0x65, 0xef, 0xff, 0xff, 0xff, 0xff, 0xd5,
+    0x0, 0x0, 0x2b, 0xff, 0xfa, 0xdf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xd5, 0x0, 0x2, 0xbf, 0xff,
+    0xff, 0xfd, 0x94, 0x22, 0x6b, 0xef, 0xff, 0xe3,
+    0x0, 0x2b, 0xff, 0xff, 0xfc, 0x50, 0x0, 0x0,
+    0x18, 0xff, 0xff, 0xa1, 0x2, 0xbf, 0xff, 0xfd,
+    0x30, 0x0, 0x0, 0x0, 0x18, 0xff, 0xfe, 0x50,
+    0x2b, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x1c, 0xff, 0xfb, 0x2, 0xbf, 0xff, 0xb2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf1, 0x2b,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xef, 0xff, 0x52, 0xbf, 0xfe, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1c, 0xff, 0xf8, 0x2b, 0xff,
+    0xe3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xaf,
+    0xff, 0xa2, 0xbf, 0xfd, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x19, 0xff, 0xfa, 0x2b, 0xff, 0xd2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
+    0xa2, 0xbf, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x19, 0xff, 0xfa, 0x2b, 0xff, 0xe3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xaf, 0xff, 0x92,
+    0xbf, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1b, 0xff, 0xf7, 0x2b, 0xff, 0xf6, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xef, 0xff, 0x42, 0xbf,
+    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
+    0xff, 0xf1, 0x2b, 0xff, 0xfd, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x1b, 0xff, 0xfb, 0x2, 0xbf, 0xff,
+    0xf9, 0x0, 0x0, 0x0, 0x0, 0x7, 0xef, 0xfe,
+    0x50, 0x2b, 0xff, 0xff, 0xe7, 0x10, 0x0, 0x0,
+    0x5, 0xef, 0xff, 0xb1, 0x2, 0xbf, 0xff, 0xff,
+    0xfa, 0x41, 0x1, 0x48, 0xef, 0xff, 0xd3, 0x0,
+    0x2b, 0xff, 0xeb, 0xff, 0xfd, 0xcb, 0xcd, 0xff,
+    0xff, 0xe5, 0x0, 0x2, 0xbf, 0xfd, 0x39, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xc4, 0x0, 0x0, 0x2b,
+    0xff, 0xd2, 0x17, 0xef, 0xff, 0xff, 0xfe, 0x93,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x58,
+    0xaa, 0x95, 0x10, 0x0, 0x0, 0x0,
+    /* U+0063 "c" */
+    0x0, 0x0, 0x0, 0x0, 0x13, 0x55, 0x55, 0x42,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x6b,
+    0xde, 0xff, 0xee, 0xc9, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x16, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x81, 0x0, 0x0, 0x0, 0x17, 0xef, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x91, 0x0, 0x0, 0x7,
+    0xff, 0xff, 0xea, 0x52, 0x23, 0x8d, 0xff, 0xff,
+    0x80, 0x0, 0x3, 0xef, 0xff, 0xd5, 0x10, 0x0,
+    0x0, 0x3c, 0xff, 0xfe, 0x20, 0x1, 0xaf, 0xff,
+    0xd4, 0x0, 0x0, 0x0, 0x0, 0x3d, 0xff, 0xf8,
+    0x0, 0x3e, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xff, 0xb2, 0x6, 0xff, 0xfd, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xcd, 0xc8, 0x20,
+    0xaf, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0x10, 0x0, 0xd, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef,
+    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2e, 0xff, 0xf4, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2e, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xe, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0xdb, 0x93, 0x9,
+    0xff, 0xfc, 0x10, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xcf, 0xff, 0x50, 0x4f, 0xff, 0xe5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5e, 0xff, 0xd3, 0x2, 0xbf,
+    0xff, 0xb2, 0x0, 0x0, 0x0, 0x0, 0x1b, 0xff,
+    0xfa, 0x10, 0x6, 0xef, 0xff, 0xa1, 0x0, 0x0,
+    0x0, 0x18, 0xff, 0xfe, 0x40, 0x0, 0xa, 0xff,
+    0xff, 0xb6, 0x21, 0x2, 0x4a, 0xff, 0xff, 0x90,
+    0x0, 0x0, 0x2b, 0xff, 0xff, 0xec, 0xcb, 0xce,
+    0xff, 0xff, 0xb2, 0x0, 0x0, 0x0, 0x19, 0xef,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0x91, 0x0, 0x0,
+    0x0, 0x0, 0x15, 0xcf, 0xff, 0xff, 0xff, 0xfc,
+    0x61, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x26,
+    0x9a, 0xa9, 0x63, 0x0, 0x0, 0x0, 0x0,
+    /* U+0064 "d" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x44, 0x44, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2d, 0xff, 0xe4, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xdf, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2d, 0xff, 0xf4, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xdf,
+    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2d, 0xff, 0xf4, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xdf, 0xff,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2d, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xdf, 0xff, 0x40,
+    0x0, 0x0, 0x0, 0x3, 0x55, 0x65, 0x30, 0x0,
+    0x2d, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x4a, 0xde,
+    0xff, 0xed, 0xa4, 0x2, 0xdf, 0xff, 0x40, 0x0,
+    0x2, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x3d,
+    0xff, 0xf4, 0x0, 0x2, 0xbf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xe9, 0xdf, 0xff, 0x40, 0x1, 0xbf,
+    0xff, 0xfc, 0x83, 0x23, 0x7c, 0xff, 0xff, 0xff,
+    0xf4, 0x0, 0x6e, 0xff, 0xfb, 0x20, 0x0, 0x0,
+    0x29, 0xff, 0xff, 0xff, 0x40, 0x2c, 0xff, 0xfb,
+    0x20, 0x0, 0x0, 0x0, 0x19, 0xff, 0xff, 0xf4,
+    0x5, 0xff, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x2c, 0xff, 0xff, 0x40, 0xaf, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf4, 0xd,
+    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xef, 0xff, 0x42, 0xef, 0xff, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2d, 0xff, 0xf4, 0x4f, 0xff,
+    0xe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
+    0xff, 0x45, 0xff, 0xfe, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xb, 0xff, 0xf4, 0x6f, 0xff, 0xd2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
+    0x45, 0xff, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0xf4, 0x4f, 0xff, 0xe2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0x43,
+    0xef, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0xff, 0xf4, 0x1e, 0xff, 0xf6, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xdf, 0xff, 0x40, 0xbf,
+    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5e,
+    0xff, 0xf4, 0x5, 0xff, 0xfe, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x19, 0xff, 0xff, 0x40, 0x2c, 0xff,
+    0xfa, 0x10, 0x0, 0x0, 0x0, 0x5, 0xef, 0xff,
+    0xf4, 0x0, 0x6f, 0xff, 0xf9, 0x10, 0x0, 0x0,
+    0x4, 0xdf, 0xff, 0xff, 0x40, 0x1, 0xaf, 0xff,
+    0xfb, 0x52, 0x1, 0x37, 0xdf, 0xff, 0xff, 0xf4,
+    0x0, 0x3, 0xcf, 0xff, 0xfe, 0xcb, 0xcd, 0xff,
+    0xfc, 0xdf, 0xff, 0x40, 0x0, 0x2, 0xaf, 0xff,
+    0xff, 0xff, 0xff, 0xfc, 0x3b, 0xff, 0xf4, 0x0,
+    0x0, 0x1, 0x6d, 0xff, 0xff, 0xff, 0xfa, 0x30,
+    0xbf, 0xff, 0x40, 0x0, 0x0, 0x0, 0x4, 0x7a,
+    0xa9, 0x72, 0x0, 0x0, 0x0, 0x0,
+    /* U+0065 "e" */
+    0x0, 0x0, 0x0, 0x0, 0x13, 0x55, 0x65, 0x42,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x16,
+    0xbd, 0xef, 0xff, 0xec, 0x93, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xdf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x92, 0x0, 0x0, 0x0, 0x0, 0x6e, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x20, 0x0,
+    0x0, 0x6, 0xef, 0xff, 0xeb, 0x53, 0x23, 0x7b,
+    0xff, 0xff, 0xc1, 0x0, 0x0, 0x3d, 0xff, 0xfe,
+    0x61, 0x0, 0x0, 0x1, 0x8f, 0xff, 0xf8, 0x10,
+    0x1, 0x9f, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0,
+    0x18, 0xef, 0xfd, 0x40, 0x3, 0xef, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xbf, 0xff, 0x90,
+    0x7, 0xff, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0xe0, 0xc, 0xff, 0xfb, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xf3,
+    0xe, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1c, 0xff, 0xf7, 0x2e, 0xff, 0xfa, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x7d, 0xff, 0xf9,
+    0x3e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfa, 0x4e, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
+    0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfa, 0x3e, 0xff, 0xf3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2e, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xa, 0xff, 0xfc, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x18, 0x87, 0x62, 0x5, 0xff, 0xfe, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xe4,
+    0x2, 0xcf, 0xff, 0xc2, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xcf, 0xff, 0xd0, 0x0, 0x6f, 0xff, 0xfb,
+    0x20, 0x0, 0x0, 0x0, 0x2a, 0xff, 0xff, 0x70,
+    0x0, 0x1a, 0xff, 0xff, 0xd7, 0x31, 0x1, 0x36,
+    0xcf, 0xff, 0xfa, 0x10, 0x0, 0x2, 0xbf, 0xff,
+    0xff, 0xdc, 0xbc, 0xde, 0xff, 0xff, 0xd2, 0x0,
+    0x0, 0x0, 0x19, 0xef, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfa, 0x20, 0x0, 0x0, 0x0, 0x1, 0x5b,
+    0xff, 0xff, 0xff, 0xff, 0xfc, 0x61, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x15, 0x8a, 0xaa, 0x96,
+    0x30, 0x0, 0x0, 0x0,
+    /* U+0066 "f" */
+    0x0, 0x0, 0x0, 0x3, 0x69, 0xaa, 0x98, 0x50,
+    0x0, 0x0, 0x0, 0x7d, 0xff, 0xff, 0xff, 0xc1,
+    0x0, 0x0, 0x18, 0xef, 0xff, 0xff, 0xff, 0xa1,
+    0x0, 0x0, 0x3e, 0xff, 0xff, 0xff, 0xff, 0x70,
+    0x0, 0x0, 0x8f, 0xff, 0xfb, 0x52, 0x24, 0x20,
+    0x0, 0x0, 0xbf, 0xff, 0xc1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xcf, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0x60, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x48, 0x88, 0xef, 0xff, 0xb8, 0x88, 0x82, 0x0,
+    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x0,
+    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x0,
+    0x6b, 0xbb, 0xef, 0xff, 0xdb, 0xbb, 0xb2, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x45, 0x55, 0x20, 0x0, 0x0, 0x0,
+    /* U+0067 "g" */
+    0x0, 0x0, 0x0, 0x0, 0x34, 0x56, 0x54, 0x10,
+    0x0, 0x1, 0x11, 0x0, 0x0, 0x0, 0x4, 0xad,
+    0xef, 0xff, 0xdb, 0x60, 0x4, 0xbb, 0xb5, 0x0,
+    0x0, 0x2a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3,
+    0x6f, 0xff, 0x70, 0x0, 0x2b, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xc8, 0xff, 0xf7, 0x0, 0x1b,
+    0xff, 0xff, 0xd8, 0x32, 0x36, 0xce, 0xff, 0xff,
+    0xff, 0x70, 0x7, 0xff, 0xff, 0xb2, 0x0, 0x0,
+    0x1, 0x8e, 0xff, 0xff, 0xf7, 0x2, 0xcf, 0xff,
+    0xa2, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
+    0x70, 0x6f, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xbf, 0xff, 0xf7, 0xb, 0xff, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xef, 0xff, 0x71,
+    0xef, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2d, 0xff, 0xf7, 0x3e, 0xff, 0xe3, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0x76, 0xff,
+    0xfd, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xf7, 0x7f, 0xff, 0xc2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0x77, 0xff, 0xfc,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xf7, 0x7f, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0x75, 0xff, 0xfe, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xf7,
+    0x3e, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xbf, 0xff, 0x71, 0xef, 0xff, 0x60, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2d, 0xff, 0xf7, 0xa,
+    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0xef, 0xff, 0x70, 0x5f, 0xff, 0xe5, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xbf, 0xff, 0xf7, 0x1, 0xbf,
+    0xff, 0xc3, 0x0, 0x0, 0x0, 0x1, 0x9f, 0xff,
+    0xff, 0x70, 0x5, 0xef, 0xff, 0xd5, 0x10, 0x0,
+    0x13, 0xaf, 0xff, 0xff, 0xf7, 0x0, 0x8, 0xff,
+    0xff, 0xfc, 0x87, 0x7a, 0xef, 0xfe, 0xff, 0xff,
+    0x70, 0x0, 0x19, 0xef, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0x8d, 0xff, 0xf7, 0x0, 0x0, 0x6, 0xcf,
+    0xff, 0xff, 0xff, 0xfd, 0x60, 0xcf, 0xff, 0x70,
+    0x0, 0x0, 0x2, 0x6b, 0xef, 0xff, 0xc7, 0x30,
+    0xc, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xcf, 0xff, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d,
+    0xff, 0xf4, 0x7, 0xa8, 0x52, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xef, 0xfd, 0x30, 0x8f, 0xff,
+    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
+    0xb1, 0x6, 0xff, 0xfd, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x4e, 0xff, 0xf8, 0x0, 0x3d, 0xff, 0xfb,
+    0x30, 0x0, 0x0, 0x0, 0x5d, 0xff, 0xfe, 0x20,
+    0x1, 0x8f, 0xff, 0xfd, 0x95, 0x33, 0x47, 0xbe,
+    0xff, 0xfe, 0x60, 0x0, 0x1, 0xaf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0x61, 0x0, 0x0,
+    0x2, 0x8e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x38, 0xbd, 0xef,
+    0xfe, 0xec, 0xa6, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x34, 0x44, 0x43, 0x21, 0x0, 0x0,
+    0x0, 0x0,
+    /* U+0068 "h" */
+    0x3, 0x44, 0x42, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1b, 0xff, 0xf6, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2b, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2b, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2b, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2b,
+    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2b, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2b, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2b, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2b, 0xff, 0xf7, 0x0, 0x1,
+    0x35, 0x65, 0x53, 0x10, 0x0, 0x0, 0x2b, 0xff,
+    0xf7, 0x1, 0x5b, 0xdf, 0xff, 0xed, 0xb5, 0x0,
+    0x0, 0x2b, 0xff, 0xf7, 0x3c, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xa2, 0x0, 0x2b, 0xff, 0xfa, 0xcf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x2b,
+    0xff, 0xff, 0xff, 0xea, 0x74, 0x47, 0xbe, 0xff,
+    0xff, 0x60, 0x2b, 0xff, 0xff, 0xfc, 0x50, 0x0,
+    0x0, 0x17, 0xef, 0xff, 0xb1, 0x2b, 0xff, 0xff,
+    0xc2, 0x0, 0x0, 0x0, 0x1, 0x9f, 0xff, 0xd3,
+    0x2b, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x4e, 0xff, 0xf4, 0x2b, 0xff, 0xfc, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x1d, 0xff, 0xf5, 0x2b, 0xff,
+    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
+    0xf6, 0x2b, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0xff, 0xf6, 0x2b, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf7, 0x2b,
+    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0xff, 0xf7, 0x2b, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0xff, 0xf7, 0x2b, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf7,
+    0x2b, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0xff, 0xf7, 0x2b, 0xff, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xc, 0xff, 0xf7, 0x2b, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
+    0xf7, 0x2b, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0xff, 0xf7, 0x2b, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf7, 0x2b,
+    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0xff, 0xf7, 0x2b, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0xff, 0xf7, 0x2b, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf7,
+    0x2b, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0xff, 0xf7, 0x2b, 0xff, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xc, 0xff, 0xf7, 0x2b, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
+    0xf7,
+    /* U+0069 "i" */
+    0x3, 0x44, 0x42, 0x1b, 0xff, 0xf7, 0x1b, 0xff,
+    0xf7, 0x1b, 0xff, 0xf7, 0x1b, 0xff, 0xf7, 0x16,
+    0x88, 0x73, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x11, 0x10, 0x18, 0xbb,
+    0xb5, 0x1b, 0xff, 0xf7, 0x1b, 0xff, 0xf7, 0x1b,
+    0xff, 0xf7, 0x1b, 0xff, 0xf7, 0x1b, 0xff, 0xf7,
+    0x1b, 0xff, 0xf7, 0x1b, 0xff, 0xf7, 0x1b, 0xff,
+    0xf7, 0x1b, 0xff, 0xf7, 0x1b, 0xff, 0xf7, 0x1b,
+    0xff, 0xf7, 0x1b, 0xff, 0xf7, 0x1b, 0xff, 0xf7,
+    0x1b, 0xff, 0xf7, 0x1b, 0xff, 0xf7, 0x1b, 0xff,
+    0xf7, 0x1b, 0xff, 0xf7, 0x1b, 0xff, 0xf7, 0x1b,
+    0xff, 0xf7, 0x1b, 0xff, 0xf7, 0x1b, 0xff, 0xf7,
+    0x1b, 0xff, 0xf7, 0x1b, 0xff, 0xf7, 0x1b, 0xff,
+    0xf7,
+    /* U+006A "j" */
+    0x0, 0x0, 0x0, 0x34, 0x44, 0x20, 0x0, 0x0,
+    0x2b, 0xff, 0xe6, 0x0, 0x0, 0x2, 0xbf, 0xfe,
+    0x60, 0x0, 0x0, 0x2b, 0xff, 0xe6, 0x0, 0x0,
+    0x2, 0xbf, 0xfe, 0x60, 0x0, 0x0, 0x16, 0x99,
+    0x83, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x11, 0x10, 0x0,
+    0x0, 0x1, 0x8b, 0xbb, 0x40, 0x0, 0x0, 0x2b,
+    0xff, 0xe6, 0x0, 0x0, 0x2, 0xbf, 0xfe, 0x60,
+    0x0, 0x0, 0x2b, 0xff, 0xe6, 0x0, 0x0, 0x2,
+    0xbf, 0xfe, 0x60, 0x0, 0x0, 0x2b, 0xff, 0xe6,
+    0x0, 0x0, 0x2, 0xbf, 0xfe, 0x60, 0x0, 0x0,
+    0x2b, 0xff, 0xe6, 0x0, 0x0, 0x2, 0xbf, 0xfe,
+    0x60, 0x0, 0x0, 0x2b, 0xff, 0xe6, 0x0, 0x0,
+    0x2, 0xbf, 0xfe, 0x60, 0x0, 0x0, 0x2b, 0xff,
+    0xe6, 0x0, 0x0, 0x2, 0xbf, 0xfe, 0x60, 0x0,
+    0x0, 0x2b, 0xff, 0xe6, 0x0, 0x0, 0x2, 0xbf,
+    0xfe, 0x60, 0x0, 0x0, 0x2b, 0xff, 0xe6, 0x0,
+    0x0, 0x2, 0xbf, 0xfe, 0x60, 0x0, 0x0, 0x2b,
+    0xff, 0xe6, 0x0, 0x0, 0x2, 0xbf, 0xfe, 0x60,
+    0x0, 0x0, 0x2b, 0xff, 0xe6, 0x0, 0x0, 0x2,
+    0xbf, 0xfe, 0x60, 0x0, 0x0, 0x2b, 0xff, 0xe6,
+    0x0, 0x0, 0x2, 0xbf, 0xfe, 0x60, 0x0, 0x0,
+    0x2b, 0xff, 0xe6, 0x0, 0x0, 0x2, 0xbf, 0xfe,
+    0x60, 0x0, 0x0, 0x2b, 0xff, 0xe6, 0x0, 0x0,
+    0x2, 0xbf, 0xfe, 0x60, 0x0, 0x0, 0x2c, 0xff,
+    0xe6, 0x0, 0x0, 0x2, 0xcf, 0xfe, 0x50, 0x0,
+    0x0, 0x3e, 0xff, 0xe4, 0x0, 0x0, 0x7, 0xff,
+    0xfd, 0x20, 0x58, 0x69, 0xef, 0xff, 0xc0, 0xa,
+    0xff, 0xff, 0xff, 0xf6, 0x1, 0xdf, 0xff, 0xff,
+    0xf9, 0x10, 0x1c, 0xef, 0xfe, 0xc7, 0x10, 0x0,
+    0x24, 0x44, 0x42, 0x0, 0x0,
+    /* U+006B "k" */
+    0x3, 0x44, 0x42, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1b, 0xff, 0xf6, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1b, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b,
+    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1b, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1b, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1b, 0xff, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x11, 0x11, 0x0, 0x1b, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x2a, 0xbb, 0xbb,
+    0x40, 0x1b, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x3,
+    0xcf, 0xff, 0xe8, 0x0, 0x1b, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x2b, 0xff, 0xfe, 0x71, 0x0, 0x1b,
+    0xff, 0xf7, 0x0, 0x0, 0x3, 0xbf, 0xff, 0xe7,
+    0x0, 0x0, 0x1b, 0xff, 0xf7, 0x0, 0x0, 0x2b,
+    0xff, 0xfe, 0x71, 0x0, 0x0, 0x1b, 0xff, 0xf7,
+    0x0, 0x2, 0xbf, 0xff, 0xe6, 0x0, 0x0, 0x0,
+    0x1b, 0xff, 0xf7, 0x0, 0x2b, 0xff, 0xfe, 0x60,
+    0x0, 0x0, 0x0, 0x1b, 0xff, 0xf7, 0x2, 0xbf,
+    0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x1b, 0xff,
+    0xf7, 0x2b, 0xff, 0xfe, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x1b, 0xff, 0xf8, 0xaf, 0xff, 0xf9, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xff, 0xff,
+    0xff, 0xfd, 0x30, 0x0, 0x0, 0x0, 0x0, 0x1b,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xa1, 0x0, 0x0,
+    0x0, 0x0, 0x1b, 0xff, 0xff, 0xfd, 0xaf, 0xff,
+    0xf6, 0x0, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xff,
+    0xe4, 0x1c, 0xff, 0xfd, 0x30, 0x0, 0x0, 0x0,
+    0x1b, 0xff, 0xfc, 0x30, 0x4, 0xdf, 0xff, 0xb1,
+    0x0, 0x0, 0x0, 0x1b, 0xff, 0xf7, 0x0, 0x1,
+    0x8f, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x1b, 0xff,
+    0xf7, 0x0, 0x0, 0x1d, 0xff, 0xfd, 0x40, 0x0,
+    0x0, 0x1b, 0xff, 0xf7, 0x0, 0x0, 0x5, 0xef,
+    0xff, 0xa1, 0x0, 0x0, 0x1b, 0xff, 0xf7, 0x0,
+    0x0, 0x1, 0x9f, 0xff, 0xf7, 0x0, 0x0, 0x1b,
+    0xff, 0xf7, 0x0, 0x0, 0x0, 0x2d, 0xff, 0xfe,
+    0x30, 0x0, 0x1b, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x5, 0xff, 0xff, 0xa1, 0x0, 0x1b, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x1, 0x9f, 0xff, 0xf7, 0x0,
+    0x1b, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x2d,
+    0xff, 0xfe, 0x30, 0x1b, 0xff, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xff, 0xb1, 0x1b, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x1, 0xaf, 0xff,
+    0xf7,
+    /* U+006C "l" */
+    0x13, 0x44, 0x41, 0x2c, 0xff, 0xe5, 0x2c, 0xff,
+    0xe5, 0x2c, 0xff, 0xe5, 0x2c, 0xff, 0xe5, 0x2c,
+    0xff, 0xe5, 0x2c, 0xff, 0xe5, 0x2c, 0xff, 0xe5,
+    0x2c, 0xff, 0xe5, 0x2c, 0xff, 0xe5, 0x2c, 0xff,
+    0xe5, 0x2c, 0xff, 0xe5, 0x2c, 0xff, 0xe5, 0x2c,
+    0xff, 0xe5, 0x2c, 0xff, 0xe5, 0x2c, 0xff, 0xe5,
+    0x2c, 0xff, 0xe5, 0x2c, 0xff, 0xe5, 0x2c, 0xff,
+    0xe5, 0x2c, 0xff, 0xe5, 0x2c, 0xff, 0xe5, 0x2c,
+    0xff, 0xe5, 0x2c, 0xff, 0xe5, 0x2c, 0xff, 0xe5,
+    0x2c, 0xff, 0xe5, 0x2c, 0xff, 0xe5, 0x2c, 0xff,
+    0xe5, 0x2c, 0xff, 0xe5, 0x2c, 0xff, 0xe5, 0x2c,
+    0xff, 0xe5, 0x2c, 0xff, 0xe5, 0x2c, 0xff, 0xe5,
+    0x2c, 0xff, 0xe5, 0x2c, 0xff, 0xe5, 0x2c, 0xff,
+    0xe5,
+    /* U+006D "m" */
+    0x1, 0x11, 0x10, 0x0, 0x2, 0x45, 0x65, 0x42,
+    0x0, 0x0, 0x0, 0x0, 0x24, 0x55, 0x53, 0x10,
+    0x0, 0x1, 0x8b, 0xba, 0x10, 0x17, 0xcd, 0xff,
+    0xfe, 0xc7, 0x10, 0x0, 0x2, 0x8c, 0xef, 0xfe,
+    0xdb, 0x50, 0x0, 0x2b, 0xff, 0xd1, 0x4d, 0xff,
+    0xff, 0xff, 0xff, 0xfc, 0x20, 0x5, 0xef, 0xff,
+    0xff, 0xff, 0xff, 0xa1, 0x2, 0xbf, 0xfd, 0x5d,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x15, 0xef,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x2b, 0xff,
+    0xfd, 0xff, 0xd9, 0x65, 0x59, 0xef, 0xff, 0xf8,
+    0xef, 0xfc, 0x85, 0x57, 0xbf, 0xff, 0xfd, 0x32,
+    0xbf, 0xff, 0xff, 0xb4, 0x0, 0x0, 0x6, 0xef,
+    0xff, 0xff, 0xf8, 0x20, 0x0, 0x1, 0x9f, 0xff,
+    0xf6, 0x2b, 0xff, 0xff, 0xc1, 0x0, 0x0, 0x0,
+    0xa, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x1,
+    0xcf, 0xff, 0xa2, 0xbf, 0xff, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x5f, 0xff, 0xfc, 0x20, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0xfc, 0x2b, 0xff, 0xfc, 0x20,
+    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xff, 0xd2, 0xbf, 0xff,
+    0x91, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xfd, 0x2b,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef,
+    0xfe, 0x40, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
+    0xd2, 0xbf, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0x2e, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0xfd, 0x2b, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xef, 0xfe, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x5f, 0xff, 0xd2, 0xbf, 0xff, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0x2e, 0xff, 0xe3, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xfd, 0x2b, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0xfe, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xd2, 0xbf,
+    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff,
+    0xe3, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xfd,
+    0x2b, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xef, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x5f,
+    0xff, 0xd2, 0xbf, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x2e, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xff, 0xfd, 0x2b, 0xff, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xef, 0xfe, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x5f, 0xff, 0xd2, 0xbf, 0xff, 0x70,
+    0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xe3, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0xfd, 0x2b, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0xfe,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xd2,
+    0xbf, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x2e,
+    0xff, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0xfd, 0x2b, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xef, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x5f, 0xff, 0xd2, 0xbf, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x2e, 0xff, 0xe3, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0xfd, 0x2b, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xef, 0xfe, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xff, 0xd2, 0xbf, 0xff,
+    0x70, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xe3,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xfd,
+    /* U+006E "n" */
+    0x1, 0x11, 0x10, 0x0, 0x1, 0x35, 0x55, 0x53,
+    0x10, 0x0, 0x0, 0x18, 0xbb, 0xa1, 0x1, 0x6b,
+    0xde, 0xff, 0xed, 0xb5, 0x0, 0x0, 0x2b, 0xff,
+    0xd1, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb2,
+    0x0, 0x2b, 0xff, 0xd4, 0xcf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfb, 0x0, 0x2b, 0xff, 0xed, 0xff,
+    0xea, 0x75, 0x57, 0xbe, 0xff, 0xff, 0x60, 0x2b,
+    0xff, 0xff, 0xfc, 0x50, 0x0, 0x0, 0x17, 0xef,
+    0xff, 0xb1, 0x2b, 0xff, 0xff, 0xc1, 0x0, 0x0,
+    0x0, 0x1, 0x9f, 0xff, 0xd3, 0x2b, 0xff, 0xfe,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xff, 0xf4,
+    0x2b, 0xff, 0xfb, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x2d, 0xff, 0xf5, 0x2b, 0xff, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1c, 0xff, 0xf5, 0x2b, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
+    0xf5, 0x2b, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0xff, 0xf5, 0x2b, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf5, 0x2b,
+    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0xff, 0xf5, 0x2b, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0xff, 0xf5, 0x2b, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf5,
+    0x2b, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0xff, 0xf5, 0x2b, 0xff, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xc, 0xff, 0xf5, 0x2b, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
+    0xf5, 0x2b, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0xff, 0xf5, 0x2b, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf5, 0x2b,
+    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0xff, 0xf5, 0x2b, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0xff, 0xf5, 0x2b, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf5,
+    0x2b, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0xff, 0xf5, 0x2b, 0xff, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xc, 0xff, 0xf5,
+    /* U+006F "o" */
+    0x0, 0x0, 0x0, 0x0, 0x13, 0x55, 0x65, 0x42,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0x7b, 0xde, 0xff, 0xfe, 0xca, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x16, 0xef, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xa3, 0x0, 0x0, 0x0, 0x0, 0x18,
+    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc4,
+    0x0, 0x0, 0x0, 0x19, 0xff, 0xff, 0xea, 0x53,
+    0x24, 0x8c, 0xff, 0xff, 0xd3, 0x0, 0x0, 0x6,
+    0xef, 0xff, 0xd4, 0x10, 0x0, 0x0, 0x29, 0xff,
+    0xff, 0xb2, 0x0, 0x2, 0xcf, 0xff, 0xc3, 0x0,
+    0x0, 0x0, 0x0, 0x18, 0xff, 0xff, 0x70, 0x0,
+    0x5f, 0xff, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1b, 0xff, 0xfd, 0x0, 0xb, 0xff, 0xfc, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf3,
+    0x1, 0xef, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xdf, 0xff, 0x80, 0x3e, 0xff, 0xf4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1a, 0xff,
+    0xfa, 0x5, 0xff, 0xfe, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0xb1, 0x6f, 0xff,
+    0xd2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xfc, 0x16, 0xff, 0xfc, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xc2, 0x6f,
+    0xff, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xfb, 0x15, 0xff, 0xfe, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xb1,
+    0x4e, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1a, 0xff, 0xfa, 0x1, 0xef, 0xff, 0x60,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xff,
+    0x80, 0xc, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xff, 0xf5, 0x0, 0x7f, 0xff,
+    0xe3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xfe, 0x10, 0x3, 0xdf, 0xff, 0xb1, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xef, 0xff, 0x90, 0x0, 0x8,
+    0xff, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x5, 0xdf,
+    0xff, 0xd4, 0x0, 0x0, 0x1b, 0xff, 0xff, 0xc6,
+    0x21, 0x1, 0x48, 0xef, 0xff, 0xf6, 0x0, 0x0,
+    0x0, 0x3c, 0xff, 0xff, 0xed, 0xcb, 0xce, 0xff,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x2a, 0xef,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xc5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x16, 0xcf, 0xff, 0xff, 0xff,
+    0xfe, 0x83, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x26, 0x9a, 0xa9, 0x74, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+    /* U+0070 "p" */
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x34, 0x44, 0x21,
+    0x0, 0x0, 0x0, 0x1, 0x8a, 0xa9, 0x10, 0x17,
+    0xbd, 0xee, 0xec, 0xa5, 0x0, 0x0, 0x0, 0x2b,
+    0xff, 0xd2, 0x4d, 0xff, 0xff, 0xff, 0xff, 0xfc,
+    0x30, 0x0, 0x2, 0xbf, 0xfd, 0x5d, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfd, 0x40, 0x0, 0x2b, 0xff,
+    0xfd, 0xff, 0xe9, 0x41, 0x25, 0xae, 0xff, 0xfd,
+    0x30, 0x2, 0xbf, 0xff, 0xff, 0xd5, 0x0, 0x0,
+    0x1, 0x7e, 0xff, 0xfa, 0x10, 0x2b, 0xff, 0xff,
+    0xe4, 0x0, 0x0, 0x0, 0x0, 0x7e, 0xff, 0xe5,
+    0x2, 0xbf, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xbf, 0xff, 0xa0, 0x2b, 0xff, 0xfc, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x12,
+    0xbf, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2e, 0xff, 0xf5, 0x2b, 0xff, 0xe6, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xbf, 0xff, 0x82, 0xbf,
+    0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x19,
+    0xff, 0xfa, 0x2b, 0xff, 0xd2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0xb2, 0xbf, 0xfd,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0xfb, 0x2b, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xff, 0xa2, 0xbf, 0xfd, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x19, 0xff, 0xfa,
+    0x2b, 0xff, 0xe4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xbf, 0xff, 0x82, 0xbf, 0xfe, 0x60, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xf5, 0x2b,
+    0xff, 0xf9, 0x10, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0xff, 0x12, 0xbf, 0xff, 0xd3, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xff, 0xb0, 0x2b, 0xff,
+    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x6e, 0xff,
+    0xe5, 0x2, 0xbf, 0xff, 0xff, 0x71, 0x0, 0x0,
+    0x0, 0x4d, 0xff, 0xfb, 0x10, 0x2b, 0xff, 0xff,
+    0xff, 0xa4, 0x10, 0x13, 0x8e, 0xff, 0xfe, 0x30,
+    0x2, 0xbf, 0xff, 0xef, 0xff, 0xec, 0xbc, 0xdf,
+    0xff, 0xfe, 0x60, 0x0, 0x2b, 0xff, 0xf7, 0x9f,
+    0xff, 0xff, 0xff, 0xff, 0xfc, 0x50, 0x0, 0x2,
+    0xbf, 0xff, 0x71, 0x7e, 0xff, 0xff, 0xff, 0xe8,
+    0x30, 0x0, 0x0, 0x2b, 0xff, 0xf7, 0x0, 0x15,
+    0x8a, 0xa8, 0x50, 0x0, 0x0, 0x0, 0x2, 0xbf,
+    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2b, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xbf, 0xff,
+    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2b, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xbf, 0xff, 0x70,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2b, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xbf, 0xff, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2b,
+    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x79, 0x99, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    /* U+0071 "q" */
+    0x0, 0x0, 0x0, 0x0, 0x23, 0x55, 0x42, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x8c,
+    0xde, 0xee, 0xc9, 0x30, 0x6, 0xaa, 0xa3, 0x0,
+    0x0, 0x18, 0xff, 0xff, 0xff, 0xff, 0xff, 0x71,
+    0x9f, 0xff, 0x40, 0x0, 0x1a, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0x89, 0xff, 0xf4, 0x0, 0x1a,
+    0xff, 0xff, 0xc7, 0x21, 0x36, 0xcf, 0xff, 0xdf,
+    0xff, 0x40, 0x5, 0xef, 0xff, 0xb2, 0x0, 0x0,
+    0x2, 0x9f, 0xff, 0xff, 0xf4, 0x2, 0xbf, 0xff,
+    0xb2, 0x0, 0x0, 0x0, 0x1, 0xaf, 0xff, 0xff,
+    0x40, 0x5f, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xdf, 0xff, 0xf4, 0x9, 0xff, 0xfc, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0x40,
+    0xdf, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4e, 0xff, 0xf4, 0x2e, 0xff, 0xf4, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xcf, 0xff, 0x43, 0xef,
+    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xf4, 0x4f, 0xff, 0xe2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9f, 0xff, 0x45, 0xff, 0xfd,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xf4, 0x5f, 0xff, 0xe2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xff, 0x43, 0xef, 0xff, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xf4,
+    0x2e, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xbf, 0xff, 0x40, 0xef, 0xff, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1d, 0xff, 0xf4, 0xa,
+    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xef, 0xff, 0x40, 0x5f, 0xff, 0xe4, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x9f, 0xff, 0xf4, 0x2, 0xbf,
+    0xff, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xff,
+    0xff, 0x40, 0x6, 0xef, 0xff, 0xa1, 0x0, 0x0,
+    0x0, 0x3c, 0xff, 0xff, 0xf4, 0x0, 0x9, 0xff,
+    0xff, 0xc6, 0x21, 0x13, 0x7d, 0xff, 0xff, 0xff,
+    0x40, 0x0, 0x2b, 0xff, 0xff, 0xec, 0xbc, 0xdf,
+    0xff, 0xef, 0xff, 0xf4, 0x0, 0x0, 0x19, 0xef,
+    0xff, 0xff, 0xff, 0xff, 0xc5, 0xdf, 0xff, 0x40,
+    0x0, 0x0, 0x16, 0xcf, 0xff, 0xff, 0xff, 0xa3,
+    0x2d, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x37,
+    0xaa, 0x97, 0x20, 0x2, 0xdf, 0xff, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d,
+    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xdf, 0xff, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xff,
+    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xdf, 0xff, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xff, 0xf4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xdf, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2d, 0xff, 0xf4, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xdf, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x18, 0x99, 0x93,
+    /* U+0072 "r" */
+    0x1, 0x11, 0x10, 0x0, 0x25, 0x65, 0x30, 0x1,
+    0x8b, 0xb9, 0x0, 0x6c, 0xff, 0xec, 0x92, 0x2c,
+    0xff, 0xd1, 0x7f, 0xff, 0xff, 0xff, 0x72, 0xcf,
+    0xfd, 0x5e, 0xff, 0xff, 0xff, 0xd3, 0x2c, 0xff,
+    0xec, 0xff, 0xed, 0xde, 0xfa, 0x2, 0xcf, 0xff,
+    0xff, 0xc6, 0x32, 0x48, 0x40, 0x2c, 0xff, 0xff,
+    0xc2, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xff, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x2c, 0xff, 0xfc, 0x20,
+    0x0, 0x0, 0x0, 0x2, 0xcf, 0xff, 0x91, 0x0,
+    0x0, 0x0, 0x0, 0x2c, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xcf, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x2c, 0xff, 0xe6, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xcf, 0xfe, 0x60, 0x0, 0x0, 0x0,
+    0x0, 0x2c, 0xff, 0xe6, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xcf, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x2c, 0xff, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xcf, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x0, 0x2c,
+    0xff, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x2, 0xcf,
+    0xfe, 0x60, 0x0, 0x0, 0x0, 0x0, 0x2c, 0xff,
+    0xe6, 0x0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xfe,
+    0x60, 0x0, 0x0, 0x0, 0x0, 0x2c, 0xff, 0xe6,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xfe, 0x60,
+    0x0, 0x0, 0x0, 0x0, 0x2c, 0xff, 0xe6, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xcf, 0xfe, 0x60, 0x0,
+    0x0, 0x0, 0x0,
+    /* U+0073 "s" */
+    0x0, 0x0, 0x0, 0x13, 0x45, 0x65, 0x53, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x16, 0xbd, 0xef,
+    0xff, 0xed, 0xb8, 0x20, 0x0, 0x0, 0x0, 0x4,
+    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x10,
+    0x0, 0x0, 0x4d, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0x80, 0x0, 0x2, 0xcf, 0xff, 0xd8,
+    0x42, 0x22, 0x59, 0xef, 0xff, 0xe4, 0x0, 0x6,
+    0xff, 0xfd, 0x30, 0x0, 0x0, 0x0, 0x6e, 0xff,
+    0xf9, 0x10, 0xa, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xfc, 0x20, 0xc, 0xff, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xdd, 0xb9, 0x20,
+    0xc, 0xff, 0xf9, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x22, 0x11, 0x0, 0x9, 0xff, 0xfe, 0x93, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xef,
+    0xff, 0xfd, 0xb7, 0x31, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x9f, 0xff, 0xff, 0xff, 0xfd, 0x86,
+    0x31, 0x0, 0x0, 0x0, 0x0, 0x1a, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0xda, 0x61, 0x0, 0x0, 0x0,
+    0x1, 0x6b, 0xef, 0xff, 0xff, 0xff, 0xff, 0xfd,
+    0x61, 0x0, 0x0, 0x0, 0x1, 0x47, 0xcf, 0xff,
+    0xff, 0xff, 0xff, 0xf8, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x6a, 0xce, 0xff, 0xff, 0xff, 0x60,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x8d,
+    0xff, 0xff, 0xc0, 0x0, 0x1, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xcf, 0xff, 0xe1, 0x37, 0x9a,
+    0x81, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
+    0xe2, 0x5e, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3f, 0xff, 0xe2, 0x1e, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xe0, 0xa,
+    0xff, 0xfe, 0x50, 0x0, 0x0, 0x0, 0x3, 0xdf,
+    0xff, 0x90, 0x3, 0xdf, 0xff, 0xe8, 0x42, 0x0,
+    0x13, 0x7d, 0xff, 0xfd, 0x30, 0x0, 0x7e, 0xff,
+    0xff, 0xdc, 0xbb, 0xcd, 0xff, 0xff, 0xe6, 0x0,
+    0x0, 0x7, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfd, 0x60, 0x0, 0x0, 0x0, 0x4a, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0x93, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x15, 0x89, 0xaa, 0x97, 0x41, 0x0, 0x0,
+    0x0,
+    /* U+0074 "t" */
+    0x0, 0x0, 0x0, 0x17, 0x20, 0x0, 0x0, 0x0,
+    0x1, 0x5c, 0xe3, 0x0, 0x0, 0x0, 0x1, 0x9e,
+    0xfe, 0x30, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xe3,
+    0x0, 0x0, 0x0, 0x2, 0xef, 0xfe, 0x30, 0x0,
+    0x0, 0x0, 0x2e, 0xff, 0xe3, 0x0, 0x0, 0x0,
+    0x2, 0xef, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x2e,
+    0xff, 0xe3, 0x0, 0x0, 0x14, 0x46, 0xef, 0xfe,
+    0x74, 0x44, 0x23, 0xde, 0xef, 0xff, 0xfe, 0xee,
+    0xe5, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0x54,
+    0xef, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x1, 0x13,
+    0xef, 0xfe, 0x41, 0x11, 0x0, 0x0, 0x2e, 0xff,
+    0xe3, 0x0, 0x0, 0x0, 0x2, 0xef, 0xfe, 0x30,
+    0x0, 0x0, 0x0, 0x2e, 0xff, 0xe3, 0x0, 0x0,
+    0x0, 0x2, 0xef, 0xfe, 0x30, 0x0, 0x0, 0x0,
+    0x2e, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x2, 0xef,
+    0xfe, 0x30, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xe3,
+    0x0, 0x0, 0x0, 0x2, 0xef, 0xfe, 0x30, 0x0,
+    0x0, 0x0, 0x2e, 0xff, 0xe3, 0x0, 0x0, 0x0,
+    0x2, 0xef, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x2e,
+    0xff, 0xe3, 0x0, 0x0, 0x0, 0x2, 0xef, 0xfe,
+    0x30, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xe3, 0x0,
+    0x0, 0x0, 0x2, 0xef, 0xfe, 0x30, 0x0, 0x0,
+    0x0, 0x2e, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x1,
+    0xef, 0xff, 0x40, 0x0, 0x0, 0x0, 0xd, 0xff,
+    0xfb, 0x21, 0x11, 0x0, 0x0, 0xcf, 0xff, 0xfe,
+    0xde, 0x60, 0x0, 0x7, 0xff, 0xff, 0xff, 0xf9,
+    0x0, 0x0, 0x19, 0xff, 0xff, 0xff, 0xc0, 0x0,
+    0x0, 0x16, 0xbe, 0xfe, 0xda,
+    /* U+0075 "u" */
+    0x18, 0xaa, 0xa4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x19, 0xaa, 0xa3, 0x2c, 0xff, 0xe5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2d, 0xff, 0xf4, 0x2c, 0xff,
+    0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xff,
+    0xf4, 0x2c, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2d, 0xff, 0xf4, 0x2c, 0xff, 0xe5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2d, 0xff, 0xf4, 0x2c,
+    0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d,
+    0xff, 0xf4, 0x2c, 0xff, 0xe5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2d, 0xff, 0xf4, 0x2c, 0xff, 0xe5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xff, 0xf4,
+    0x2c, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2d, 0xff, 0xf4, 0x2c, 0xff, 0xe5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2d, 0xff, 0xf4, 0x2c, 0xff,
+    0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xff,
+    0xf4, 0x2c, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2d, 0xff, 0xf4, 0x2c, 0xff, 0xe5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2d, 0xff, 0xf4, 0x2c,
+    0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d,
+    0xff, 0xf4, 0x2c, 0xff, 0xe5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2d, 0xff, 0xf4, 0x2c, 0xff, 0xe5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3d, 0xff, 0xf4,
+    0x2c, 0xff, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4e, 0xff, 0xf4, 0x2b, 0xff, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xff, 0xf4, 0x1b, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x1, 0xaf, 0xff,
+    0xf4, 0x9, 0xff, 0xfc, 0x20, 0x0, 0x0, 0x0,
+    0x5, 0xef, 0xff, 0xf4, 0x6, 0xff, 0xff, 0x81,
+    0x0, 0x0, 0x1, 0x5d, 0xff, 0xff, 0xf4, 0x2,
+    0xdf, 0xff, 0xfa, 0x52, 0x23, 0x59, 0xef, 0xfd,
+    0xff, 0xf4, 0x0, 0x8f, 0xff, 0xff, 0xed, 0xcd,
+    0xef, 0xff, 0x99, 0xff, 0xf4, 0x0, 0x18, 0xef,
+    0xff, 0xff, 0xff, 0xff, 0xe9, 0x18, 0xff, 0xf4,
+    0x0, 0x1, 0x6d, 0xff, 0xff, 0xff, 0xfd, 0x61,
+    0x8, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x37, 0x9a,
+    0xa8, 0x40, 0x0, 0x1, 0x11, 0x10,
+    /* U+0076 "v" */
+    0x3a, 0xaa, 0x93, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x29, 0xaa, 0xa3, 0x2c, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6e, 0xff, 0xc2,
+    0x9, 0xff, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x9f, 0xff, 0x90, 0x3, 0xef, 0xff, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0xfe, 0x40,
+    0x0, 0xcf, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0xfd, 0x0, 0x0, 0x6f, 0xff, 0xd1,
+    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf7, 0x0,
+    0x0, 0x3d, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0,
+    0x4e, 0xff, 0xd3, 0x0, 0x0, 0x9, 0xff, 0xf9,
+    0x10, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xa1, 0x0,
+    0x0, 0x5, 0xef, 0xfd, 0x20, 0x0, 0x0, 0x2,
+    0xcf, 0xfe, 0x50, 0x0, 0x0, 0x1, 0xdf, 0xff,
+    0x60, 0x0, 0x0, 0x4, 0xff, 0xfd, 0x10, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xc0, 0x0, 0x0, 0xa,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x3e, 0xff,
+    0xe2, 0x0, 0x0, 0x1e, 0xff, 0xf4, 0x0, 0x0,
+    0x0, 0x0, 0x1a, 0xff, 0xf8, 0x0, 0x0, 0x6f,
+    0xff, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x6, 0xef,
+    0xfb, 0x10, 0x1, 0xaf, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xcf, 0xfe, 0x40, 0x3, 0xef,
+    0xfd, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
+    0xff, 0x80, 0x7, 0xff, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0xff, 0xd0, 0xd, 0xff,
+    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b,
+    0xff, 0xf3, 0x3f, 0xff, 0xc1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0xf8, 0x8f, 0xff,
+    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xdf, 0xfc, 0xcf, 0xfd, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1d, 0xff, 0xff, 0xd1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xdf, 0xfe, 0x50,
+    0x0, 0x0, 0x0, 0x0,
+    /* U+0077 "w" */
+    0x8a, 0xaa, 0x60, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xaa, 0xa6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9a,
+    0xaa, 0x37, 0xff, 0xfc, 0x10, 0x0, 0x0, 0x0,
+    0x3, 0xef, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x4e, 0xff, 0xc2, 0x4e, 0xff, 0xd3, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xff, 0xfe, 0x20, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xf9, 0x2, 0xbf, 0xff, 0x70,
+    0x0, 0x0, 0x0, 0x1a, 0xff, 0xff, 0xf6, 0x0,
+    0x0, 0x0, 0x1, 0xbf, 0xfe, 0x50, 0x9, 0xff,
+    0xf9, 0x10, 0x0, 0x0, 0x2, 0xcf, 0xff, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x2d, 0xff, 0xd1, 0x0,
+    0x4f, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x4e, 0xff,
+    0xff, 0xfb, 0x20, 0x0, 0x0, 0x5, 0xff, 0xfa,
+    0x0, 0x1, 0xdf, 0xff, 0x40, 0x0, 0x0, 0x7,
+    0xff, 0xed, 0xff, 0xe3, 0x0, 0x0, 0x0, 0xaf,
+    0xff, 0x50, 0x0, 0xa, 0xff, 0xf7, 0x0, 0x0,
+    0x0, 0xcf, 0xfb, 0x8f, 0xff, 0x60, 0x0, 0x0,
+    0x1d, 0xff, 0xd2, 0x0, 0x0, 0x5f, 0xff, 0xc0,
+    0x0, 0x0, 0x1f, 0xff, 0x84, 0xff, 0xfa, 0x0,
+    0x0, 0x5, 0xef, 0xfa, 0x10, 0x0, 0x3, 0xdf,
+    0xfd, 0x20, 0x0, 0x5, 0xff, 0xe5, 0x2d, 0xff,
+    0xe0, 0x0, 0x0, 0x8f, 0xfe, 0x60, 0x0, 0x0,
+    0x1a, 0xff, 0xe6, 0x0, 0x0, 0x9f, 0xfd, 0x21,
+    0xaf, 0xfe, 0x30, 0x0, 0x2b, 0xff, 0xd2, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0x90, 0x0, 0x1b, 0xff,
+    0xb0, 0x8, 0xff, 0xf7, 0x0, 0x3, 0xef, 0xfb,
+    0x0, 0x0, 0x0, 0x2, 0xef, 0xfc, 0x20, 0x4,
+    0xef, 0xf7, 0x0, 0x5e, 0xff, 0xa0, 0x0, 0x7f,
+    0xff, 0x60, 0x0, 0x0, 0x0, 0xc, 0xff, 0xe3,
+    0x0, 0x6f, 0xff, 0x30, 0x2, 0xdf, 0xfc, 0x20,
+    0xc, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0x70, 0xa, 0xff, 0xd1, 0x0, 0xa, 0xff,
+    0xe4, 0x2, 0xef, 0xfb, 0x10, 0x0, 0x0, 0x0,
+    0x3, 0xef, 0xfb, 0x0, 0xef, 0xfa, 0x10, 0x0,
+    0x6f, 0xff, 0x70, 0x6f, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x1b, 0xff, 0xe1, 0x3f, 0xff, 0x60,
+    0x0, 0x2, 0xff, 0xfb, 0xa, 0xff, 0xe4, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xfe, 0x57, 0xff,
+    0xe4, 0x0, 0x0, 0x1c, 0xff, 0xe2, 0xcf, 0xfc,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x5, 0xef, 0xf9,
+    0xbf, 0xfc, 0x20, 0x0, 0x0, 0x9f, 0xff, 0x9e,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d,
+    0xff, 0xde, 0xff, 0x90, 0x0, 0x0, 0x6, 0xff,
+    0xfe, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x3d, 0xff, 0xff, 0xfd, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0x20, 0x0,
+    0x0, 0x1, 0xbf, 0xff, 0xff, 0x90, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xe5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xaf, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xfc,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x1, 0xef,
+    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    /* U+0078 "x" */
+    0x1, 0x11, 0x11, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x11, 0x11, 0x10, 0x7, 0xbb, 0xbb, 0x70,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xbb, 0xbb, 0x70,
+    0x2, 0xdf, 0xff, 0xe4, 0x0, 0x0, 0x0, 0x0,
+    0x2d, 0xff, 0xfd, 0x20, 0x0, 0x6e, 0xff, 0xfb,
+    0x10, 0x0, 0x0, 0x1, 0x9f, 0xff, 0xe5, 0x0,
+    0x0, 0x19, 0xff, 0xff, 0x80, 0x0, 0x0, 0x7,
+    0xff, 0xff, 0x81, 0x0, 0x0, 0x2, 0xcf, 0xff,
+    0xe3, 0x0, 0x0, 0x3e, 0xff, 0xfb, 0x10, 0x0,
+    0x0, 0x0, 0x4e, 0xff, 0xfa, 0x10, 0x2, 0xbf,
+    0xff, 0xd3, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0xff, 0x70, 0x8, 0xff, 0xfe, 0x60, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xbf, 0xff, 0xe2, 0x5e, 0xff,
+    0xf9, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3d,
+    0xff, 0xfb, 0xcf, 0xff, 0xb1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xef, 0xff, 0xff, 0xfd,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0x9f, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2d, 0xff, 0xff, 0xa1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1c, 0xff, 0xff, 0xb1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xef, 0xff, 0xff, 0xfe, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2c, 0xff, 0xfc, 0xcf, 0xff,
+    0xc2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x9f,
+    0xff, 0xe3, 0x3e, 0xff, 0xf9, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xef, 0xff, 0x80, 0x8, 0xff,
+    0xfe, 0x60, 0x0, 0x0, 0x0, 0x0, 0x3d, 0xff,
+    0xfb, 0x20, 0x2, 0xbf, 0xff, 0xd3, 0x0, 0x0,
+    0x0, 0x1, 0xbf, 0xff, 0xe3, 0x0, 0x0, 0x4e,
+    0xff, 0xfb, 0x10, 0x0, 0x0, 0x7, 0xff, 0xff,
+    0x70, 0x0, 0x0, 0x8, 0xff, 0xff, 0x70, 0x0,
+    0x0, 0x4e, 0xff, 0xfb, 0x10, 0x0, 0x0, 0x2,
+    0xbf, 0xff, 0xe4, 0x0, 0x1, 0xcf, 0xff, 0xe4,
+    0x0, 0x0, 0x0, 0x0, 0x4e, 0xff, 0xfc, 0x10,
+    0x19, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xff, 0x91, 0x5e, 0xff, 0xfb, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xff, 0xe5,
+    /* U+0079 "y" */
+    0x29, 0xaa, 0xa5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xaa, 0xa5, 0x1a, 0xff, 0xfa, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3d, 0xff, 0xe3,
+    0x6, 0xff, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xb1, 0x1, 0xef, 0xff, 0x70,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xbf, 0xff, 0x60,
+    0x0, 0xaf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xef, 0xfe, 0x10, 0x0, 0x5f, 0xff, 0xe4,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xfa, 0x0,
+    0x0, 0x2c, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x1d, 0xff, 0xf5, 0x0, 0x0, 0x8, 0xff, 0xfc,
+    0x20, 0x0, 0x0, 0x0, 0x5e, 0xff, 0xc2, 0x0,
+    0x0, 0x3, 0xef, 0xff, 0x50, 0x0, 0x0, 0x1,
+    0x9f, 0xff, 0x80, 0x0, 0x0, 0x0, 0xbf, 0xff,
+    0x90, 0x0, 0x0, 0x2, 0xdf, 0xfe, 0x30, 0x0,
+    0x0, 0x0, 0x5f, 0xff, 0xe1, 0x0, 0x0, 0x6,
+    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xff,
+    0xf6, 0x0, 0x0, 0xb, 0xff, 0xf6, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xfa, 0x10, 0x0, 0x3e,
+    0xff, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x5, 0xef,
+    0xfd, 0x30, 0x0, 0x7f, 0xff, 0x91, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xcf, 0xff, 0x70, 0x2, 0xbf,
+    0xfe, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0xc0, 0x4, 0xef, 0xfc, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2e, 0xff, 0xf2, 0x8, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1a,
+    0xff, 0xf7, 0xd, 0xff, 0xe3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xef, 0xfa, 0x3f, 0xff,
+    0xb1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xdf, 0xfd, 0x9f, 0xff, 0x60, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xef, 0xfd,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1c, 0xff, 0xff, 0xf4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0xff, 0xc1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xdf, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xcf, 0xfd, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xef, 0xfb, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xe1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0x8f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x12, 0x0, 0x28, 0xef, 0xfd, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5d, 0xcd, 0xdf,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xff, 0xff, 0xff, 0xc1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0xff, 0xff,
+    0xfd, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2b, 0xef, 0xfd, 0xa3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x34, 0x43,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    /* U+007A "z" */
+    0x2, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0x30, 0x3, 0xef, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x40,
+    0x3, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0x40, 0x1, 0x9a, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xdf, 0xff, 0xfc, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xcf, 0xff, 0xc3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1b, 0xff, 0xfd, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xaf,
+    0xff, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x19, 0xff, 0xfe, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x7f, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xef, 0xff, 0xa1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xfa,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xdf, 0xff, 0xd3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3d, 0xff, 0xfd, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xbf, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2b, 0xff, 0xfe, 0x60, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x9f,
+    0xff, 0xf8, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x18, 0xff, 0xff, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7e, 0xff,
+    0xfb, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xef, 0xff, 0xc2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5d, 0xff, 0xfd,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xdf, 0xff, 0xd4, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2b, 0xff, 0xff, 0xb7,
+    0x78, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x71,
+    0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xc3, 0x3d, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3,
+    0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xc3,
+    /* U+007B "{" */
+    0x0, 0x0, 0x0, 0x0, 0x14, 0x67, 0x87, 0x10,
+    0x0, 0x0, 0x0, 0x4b, 0xef, 0xff, 0xd1, 0x0,
+    0x0, 0x0, 0x4d, 0xff, 0xff, 0xfd, 0x10, 0x0,
+    0x0, 0x1a, 0xff, 0xff, 0xff, 0xd1, 0x0, 0x0,
+    0x3, 0xff, 0xff, 0x94, 0x22, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
+    0xfe, 0x40, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
+    0xe4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xfe,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xe3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xfe, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xe3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xcf, 0xfd, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x1d, 0xff, 0xd3, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xdf, 0xfc, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x3d, 0xff, 0xb2, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xef, 0xfa, 0x10, 0x0, 0x0, 0x0,
+    0x1, 0x9f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x5e, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x35, 0x8e,
+    0xff, 0xe6, 0x0, 0x0, 0x0, 0x9, 0xef, 0xff,
+    0xe6, 0x10, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xc3,
+    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xfd, 0x81,
+    0x0, 0x0, 0x0, 0x0, 0x7c, 0xef, 0xff, 0xb2,
+    0x0, 0x0, 0x0, 0x0, 0x14, 0xcf, 0xff, 0x90,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xfe, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4e, 0xff, 0xa1, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xdf, 0xfc, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x1d, 0xff, 0xd3, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xdf, 0xfe, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0xff, 0xe3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xcf, 0xfe, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xcf, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0xff, 0xe4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
+    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
+    0xfc, 0x10, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff,
+    0xfc, 0x86, 0x50, 0x0, 0x0, 0x1, 0x9f, 0xff,
+    0xff, 0xfd, 0x10, 0x0, 0x0, 0x2, 0xbf, 0xff,
+    0xff, 0xd1, 0x0, 0x0, 0x0, 0x1, 0x8c, 0xef,
+    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x24, 0x44,
+    0x40,
+    /* U+007C "|" */
+    0x6a, 0xa9, 0x29, 0xff, 0xe3, 0x9f, 0xfe, 0x39,
+    0xff, 0xe3, 0x9f, 0xfe, 0x39, 0xff, 0xe3, 0x9f,
+    0xfe, 0x39, 0xff, 0xe3, 0x9f, 0xfe, 0x39, 0xff,
+    0xe3, 0x9f, 0xfe, 0x39, 0xff, 0xe3, 0x9f, 0xfe,
+    0x39, 0xff, 0xe3, 0x9f, 0xfe, 0x39, 0xff, 0xe3,
+    0x9f, 0xfe, 0x39, 0xff, 0xe3, 0x9f, 0xfe, 0x39,
+    0xff, 0xe3, 0x9f, 0xfe, 0x39, 0xff, 0xe3, 0x9f,
+    0xfe, 0x39, 0xff, 0xe3, 0x9f, 0xfe, 0x39, 0xff,
+    0xe3, 0x9f, 0xfe, 0x39, 0xff, 0xe3, 0x9f, 0xfe,
+    0x39, 0xff, 0xe3, 0x9f, 0xfe, 0x39, 0xff, 0xe3,
+    0x9f, 0xfe, 0x39, 0xff, 0xe3, 0x9f, 0xfe, 0x39,
+    0xff, 0xe3, 0x9f, 0xfe, 0x39, 0xff, 0xe3, 0x9f,
+    0xfe, 0x39, 0xff, 0xe3, 0x9f, 0xfe, 0x39, 0xff,
+    0xe3, 0x9f, 0xfe, 0x39, 0xff, 0xe3, 0x9f, 0xfe,
+    0x33, 0x44, 0x41,
+    /* U+007D "}" */
+    0x16, 0x87, 0x64, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x2c, 0xff, 0xfe, 0xb4, 0x0, 0x0, 0x0, 0x0,
+    0x2c, 0xff, 0xff, 0xfd, 0x40, 0x0, 0x0, 0x0,
+    0x2c, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x2, 0x24, 0x9e, 0xff, 0xe4, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x19, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xef, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xef, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xef, 0xfa, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xef, 0xfa, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xef, 0xfb, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xef, 0xfb, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xef, 0xfb, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xdf, 0xfb, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xdf, 0xfc, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xdf, 0xfc, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xdf, 0xfd, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xff, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xff, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2d, 0xff, 0xe5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xef, 0xfe, 0x95, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x6e, 0xff, 0xfe, 0x90,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xcf, 0xff, 0xa1,
+    0x0, 0x0, 0x0, 0x0, 0x18, 0xdf, 0xff, 0xa1,
+    0x0, 0x0, 0x0, 0x1, 0xbf, 0xff, 0xeb, 0x70,
+    0x0, 0x0, 0x0, 0x18, 0xff, 0xfc, 0x51, 0x0,
+    0x0, 0x0, 0x0, 0x3e, 0xff, 0xd2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xbf, 0xfe, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xdf, 0xfd, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xdf, 0xfc, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xdf, 0xfb, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xdf, 0xfb, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xdf, 0xfb, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xef, 0xfb, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xef, 0xfb, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xef, 0xfb, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xef, 0xfa, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xef, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2b, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x14, 0x68, 0xdf, 0xff, 0xe3, 0x0, 0x0, 0x0,
+    0x2c, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
+    0x2c, 0xff, 0xff, 0xfb, 0x20, 0x0, 0x0, 0x0,
+    0x2c, 0xff, 0xec, 0x81, 0x0, 0x0, 0x0, 0x0,
+    0x13, 0x44, 0x42, 0x0, 0x0, 0x0, 0x0, 0x0,
+    /* U+007E "~" */
+    0x0, 0x2, 0x68, 0x98, 0x63, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0x0, 0x3a, 0xee, 0xff,
+    0xff, 0xed, 0x73, 0x10, 0x0, 0x0, 0x0, 0x16,
+    0xd1, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea,
+    0x61, 0x0, 0x0, 0x38, 0xff, 0x1d, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0xd9, 0x78, 0xad,
+    0xff, 0xf1, 0xef, 0xff, 0xec, 0xbd, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1e, 0xfd,
+    0x63, 0x22, 0x24, 0x9d, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xa0, 0xea, 0x20, 0x0, 0x0, 0x0,
+    0x16, 0xbe, 0xff, 0xff, 0xff, 0xfd, 0x71, 0x8,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x1, 0x48, 0xce,
+    0xee, 0xc7, 0x30, 0x0,
+    /* U+00C4 "Ä" */
+    0x0, 0x0, 0x0, 0x0, 0x2, 0x22, 0x21, 0x0,
+    0x1, 0x22, 0x22, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0x40,
+    0x0, 0x5f, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf5,
+    0x0, 0x5, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
+    0x50, 0x0, 0x5f, 0xff, 0xe1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
+    0xf5, 0x0, 0x5, 0xff, 0xfe, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xaa,
+    0xaa, 0x30, 0x0, 0x3a, 0xaa, 0x91, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x44, 0x44, 0x41, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2e, 0xff, 0xfe, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xff, 0xfa, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xcf, 0xff, 0xff, 0xe3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5e, 0xff, 0xdf, 0xff, 0x90,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0xff, 0xf6, 0xef, 0xfd,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xef, 0xfd, 0x3c, 0xff,
+    0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xa1, 0x8f,
+    0xff, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xf7, 0x4,
+    0xef, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xef, 0xfd, 0x30,
+    0xc, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xb1,
+    0x0, 0x7f, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xf6,
+    0x0, 0x2, 0xef, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
+    0x10, 0x0, 0x1a, 0xff, 0xfb, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xbf, 0xff,
+    0xa0, 0x0, 0x0, 0x6e, 0xff, 0xe5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4d, 0xff,
+    0xe5, 0x0, 0x0, 0x2, 0xdf, 0xff, 0xa0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0xfc, 0x20, 0x0, 0x0, 0x9, 0xff, 0xff, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xdf,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
+    0xff, 0xf3, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xff,
+    0xc2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xfe, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xdf, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x3d,
+    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xff, 0xd5, 0x22, 0x22, 0x22, 0x22, 0x23,
+    0xbf, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1b, 0xff, 0xfe, 0xdc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xce, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfc, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xe6, 0x0, 0x0, 0x0,
+    0x0, 0x2e, 0xff, 0xfc, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xef, 0xff, 0xb1, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1b, 0xff, 0xff, 0x30, 0x0,
+    0x0, 0x1, 0xbf, 0xff, 0xb2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf9, 0x0,
+    0x0, 0x0, 0x4e, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xff, 0xd2,
+    0x0, 0x0, 0x9, 0xff, 0xfe, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
+    0x70, 0x0, 0x1, 0xef, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xff,
+    0xfb, 0x10, 0x0, 0x5f, 0xff, 0xf6, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xbf,
+    0xff, 0xf4, 0x0, 0x1a, 0xff, 0xfd, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xff, 0xa0, 0x3, 0xdf, 0xff, 0x91, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2e, 0xff, 0xfd, 0x20, 0x8f, 0xff, 0xe5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0xff, 0xf7, 0xd, 0xff, 0xfd, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0xff, 0xb2,
+    /* U+00C5 "Å" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x57,
+    0x52, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xdf,
+    0xff, 0xc4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xce,
+    0x84, 0x7e, 0xc2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0x60, 0x0, 0x5f, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0xf1, 0x0, 0x2, 0xda, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0x30, 0x0, 0x3e, 0x90, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xfa, 0x10, 0x19, 0xf6, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x19, 0xfd, 0xbd, 0xfa, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xff, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xff, 0xfa, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xcf, 0xff, 0xff, 0xe3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5e, 0xff, 0xef, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0xff, 0xf7, 0xff, 0xfd,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xef, 0xfe, 0x3c, 0xff,
+    0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xa1, 0x8f,
+    0xff, 0xa1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xf7, 0x4,
+    0xef, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xef, 0xfd, 0x30,
+    0xc, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xb1,
+    0x0, 0x8f, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xf6,
+    0x0, 0x2, 0xef, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
+    0x10, 0x0, 0x1a, 0xff, 0xfb, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xbf, 0xff,
+    0xa0, 0x0, 0x0, 0x6e, 0xff, 0xe4, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4d, 0xff,
+    0xe5, 0x0, 0x0, 0x2, 0xdf, 0xff, 0xa0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0xfc, 0x20, 0x0, 0x0, 0x9, 0xff, 0xff, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xcf,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xff, 0xf3, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xff,
+    0xb2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xfe, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xdf, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x3d,
+    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xd5, 0x22, 0x22, 0x22, 0x22, 0x23,
+    0xbf, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1b, 0xff, 0xfe, 0xdc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xce, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfc, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xe6, 0x0, 0x0, 0x0,
+    0x0, 0x2e, 0xff, 0xfc, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xef, 0xff, 0xb1, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1b, 0xff, 0xff, 0x30, 0x0,
+    0x0, 0x1, 0xbf, 0xff, 0xb2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf9, 0x0,
+    0x0, 0x0, 0x4e, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xff, 0xd2,
+    0x0, 0x0, 0x8, 0xff, 0xfe, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xfe,
+    0x60, 0x0, 0x1, 0xef, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xff,
+    0xfb, 0x10, 0x0, 0x5f, 0xff, 0xf6, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xbf,
+    0xff, 0xf4, 0x0, 0x1a, 0xff, 0xfd, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xff, 0xa0, 0x3, 0xdf, 0xff, 0x91, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2e, 0xff, 0xfd, 0x20, 0x8f, 0xff, 0xe5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0xff, 0xf7, 0xd, 0xff, 0xfd, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0xff, 0xb2,
+    /* U+00C9 "É" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x22,
+    0x22, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xac, 0xcc, 0xb5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0xfa, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xff,
+    0xfc, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xef, 0xfd, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xbf, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xff,
+    0x91, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xaa, 0x81, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x20, 0x4e,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf9, 0x4, 0xef, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xa0, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x4,
+    0xef, 0xff, 0xdc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xcc, 0x80, 0x4e, 0xff, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xef, 0xff, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xef, 0xff,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4e, 0xff, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xef, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xef, 0xff, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xef,
+    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4e, 0xff, 0xfd, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0x50, 0x4, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x4e,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x60, 0x4, 0xef, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf6, 0x0, 0x4e, 0xff, 0xf7, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x10, 0x4,
+    0xef, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xff, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xef, 0xff, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xef, 0xff,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4e, 0xff, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xef, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xef, 0xff, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xef,
+    0xff, 0x62, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x21, 0x4e, 0xff, 0xff, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0x74, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x4e,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x74, 0xef, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf7,
+    /* U+00D6 "Ö" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x22, 0x22, 0x10,
+    0x0, 0x12, 0x22, 0x21, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xff,
+    0x70, 0x0, 0x4d, 0xff, 0xe5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xcf,
+    0xff, 0x70, 0x0, 0x4d, 0xff, 0xe5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xcf, 0xff, 0x70, 0x0, 0x4d, 0xff, 0xe5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xcf, 0xff, 0x70, 0x0, 0x4d, 0xff, 0xe5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x8a, 0xaa, 0x50, 0x0, 0x39, 0xaa,
+    0x93, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0x47, 0x9a, 0xbb,
+    0x98, 0x53, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0x9d, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0xa7, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xae, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6d, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0xef, 0xff,
+    0xfe, 0xd9, 0x53, 0x23, 0x47, 0xbd, 0xff, 0xff,
+    0xfb, 0x30, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xff, 0xc6, 0x10, 0x0, 0x0, 0x0, 0x3, 0xae,
+    0xff, 0xff, 0xc2, 0x0, 0x0, 0x0, 0x5, 0xef,
+    0xff, 0xf9, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x15, 0xef, 0xff, 0xfa, 0x10, 0x0, 0x0, 0x2c,
+    0xff, 0xfe, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4d, 0xff, 0xff, 0x60, 0x0, 0x0,
+    0x7f, 0xff, 0xf9, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xef, 0xff, 0xd1, 0x0,
+    0x2, 0xef, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf7,
+    0x0, 0x6, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3d, 0xff,
+    0xfb, 0x10, 0x1a, 0xff, 0xfd, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x19,
+    0xff, 0xfe, 0x40, 0x2d, 0xff, 0xfa, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xef, 0xff, 0x70, 0x4f, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xdf, 0xff, 0xb0, 0x6f, 0xff, 0xe5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xcf, 0xff, 0xe0, 0x7f, 0xff,
+    0xe4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf1, 0x9f,
+    0xff, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf2,
+    0xaf, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
+    0xf3, 0xaf, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xff, 0xf2, 0x9f, 0xff, 0xd2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xff, 0xf1, 0x8f, 0xff, 0xe3, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0xff, 0xf0, 0x6f, 0xff, 0xe5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xcf, 0xff, 0xe0, 0x4f, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xdf, 0xff, 0xa0, 0x2d, 0xff,
+    0xf9, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xef, 0xff, 0x70, 0x19,
+    0xff, 0xfd, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xfe, 0x40,
+    0x6, 0xef, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xff, 0xfb,
+    0x20, 0x1, 0xdf, 0xff, 0xe2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
+    0xf6, 0x0, 0x0, 0x6f, 0xff, 0xfa, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xef,
+    0xff, 0xd1, 0x0, 0x0, 0x1b, 0xff, 0xff, 0x91,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4d,
+    0xff, 0xff, 0x60, 0x0, 0x0, 0x3, 0xdf, 0xff,
+    0xf9, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x15,
+    0xef, 0xff, 0xf9, 0x10, 0x0, 0x0, 0x0, 0x6e,
+    0xff, 0xff, 0xd5, 0x10, 0x0, 0x0, 0x0, 0x13,
+    0xae, 0xff, 0xff, 0xc2, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xef, 0xff, 0xff, 0xd8, 0x65, 0x55, 0x67,
+    0xbe, 0xff, 0xff, 0xfb, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4d, 0xff, 0xff, 0xff, 0xfe, 0xee,
+    0xef, 0xff, 0xff, 0xff, 0xa2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0x8d, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xb5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x8d, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xa5, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x26, 0x8a, 0xaa, 0x97, 0x41, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+    /* U+00DC "Ü" */
+    0x0, 0x0, 0x0, 0x1, 0x22, 0x22, 0x0, 0x0,
+    0x12, 0x22, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0xff, 0x10, 0x0, 0x9f, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0xff, 0x10, 0x0, 0x9f, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
+    0x10, 0x0, 0x9f, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x10, 0x0,
+    0x9f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xaa, 0xaa, 0x10, 0x0, 0x6a, 0xaa,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x14, 0x44, 0x41, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x44, 0x43,
+    0x4e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xfc, 0x5e, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xfc, 0x5e, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xfc, 0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfc,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xfc, 0x5e, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xfc, 0x5e, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xfc, 0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfc,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xfc, 0x5e, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xfc, 0x5e, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xfc, 0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfc,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xfc, 0x5e, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xfc, 0x5e, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xfc, 0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfc,
+    0x5e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xfc, 0x5e, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xfc, 0x5e, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xfc, 0x4e, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfc,
+    0x4e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xc, 0xff, 0xfc, 0x3e, 0xff,
+    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0xff, 0xfb, 0x3e, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
+    0xff, 0xfa, 0x1e, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xf9,
+    0xd, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3e, 0xff, 0xf7, 0xa, 0xff,
+    0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xf4, 0x7, 0xff, 0xfe, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xbf,
+    0xff, 0xe2, 0x3, 0xef, 0xff, 0xb2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xef, 0xff, 0xa1,
+    0x1, 0xaf, 0xff, 0xfa, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3d, 0xff, 0xfe, 0x50, 0x0, 0x5e,
+    0xff, 0xff, 0xb5, 0x11, 0x0, 0x0, 0x1, 0x28,
+    0xdf, 0xff, 0xfa, 0x10, 0x0, 0x8, 0xff, 0xff,
+    0xff, 0xd9, 0x76, 0x67, 0x8b, 0xef, 0xff, 0xff,
+    0xd2, 0x0, 0x0, 0x1, 0x9f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x40, 0x0,
+    0x0, 0x0, 0x6, 0xdf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0xa1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x37, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0xb4, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0x58, 0x9a, 0xaa, 0x97, 0x40, 0x0, 0x0,
+    0x0, 0x0,
+    /* U+00E4 "ä" */
+    0x0, 0x0, 0x2, 0x44, 0x44, 0x0, 0x0, 0x34,
+    0x44, 0x30, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
+    0xff, 0x10, 0x0, 0xaf, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xff, 0xff, 0x10, 0x0, 0xaf,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
+    0xff, 0x10, 0x0, 0xaf, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xff, 0xff, 0x10, 0x0, 0xaf,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x88,
+    0x88, 0x0, 0x0, 0x58, 0x88, 0x60, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x23, 0x55, 0x66, 0x54, 0x31, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x49, 0xcd, 0xef, 0xff, 0xfe,
+    0xca, 0x50, 0x0, 0x0, 0x0, 0x0, 0x4b, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x30, 0x0,
+    0x0, 0x4, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xc1, 0x0, 0x0, 0x2d, 0xff, 0xfe,
+    0xa6, 0x32, 0x23, 0x6a, 0xef, 0xff, 0xf8, 0x0,
+    0x0, 0x8f, 0xff, 0xe7, 0x10, 0x0, 0x0, 0x0,
+    0x6e, 0xff, 0xfc, 0x20, 0x3, 0xdf, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xfe, 0x40,
+    0x5, 0xff, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xdf, 0xff, 0x50, 0x2, 0x79, 0xb9, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xdf, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xcf, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x11, 0x49, 0xef, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x23, 0x56, 0x89, 0xce,
+    0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x3, 0x8b,
+    0xcd, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50,
+    0x0, 0x3, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xec, 0xef, 0xff, 0x50, 0x0, 0x3c, 0xff, 0xff,
+    0xff, 0xff, 0xfd, 0x96, 0x43, 0xdf, 0xff, 0x50,
+    0x3, 0xcf, 0xff, 0xfd, 0xa8, 0x52, 0x0, 0x0,
+    0x2, 0xdf, 0xff, 0x50, 0x9, 0xff, 0xff, 0xa3,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xdf, 0xff, 0x50,
+    0x1e, 0xff, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xdf, 0xff, 0x50, 0x3e, 0xff, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6, 0xef, 0xff, 0x50,
+    0x4f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1a, 0xff, 0xff, 0x50, 0x3e, 0xff, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5e, 0xff, 0xff, 0x60,
+    0x1e, 0xff, 0xfc, 0x10, 0x0, 0x0, 0x0, 0x15,
+    0xdf, 0xff, 0xff, 0x60, 0x9, 0xff, 0xff, 0xb4,
+    0x10, 0x0, 0x14, 0x9e, 0xff, 0xff, 0xff, 0x80,
+    0x3, 0xdf, 0xff, 0xfd, 0xba, 0x9b, 0xce, 0xff,
+    0xfb, 0xaf, 0xff, 0xa0, 0x0, 0x4d, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfd, 0x71, 0x4f, 0xff, 0xe1,
+    0x0, 0x4, 0xbf, 0xff, 0xff, 0xff, 0xff, 0x94,
+    0x0, 0x2d, 0xff, 0xf5, 0x0, 0x0, 0x2, 0x69,
+    0xaa, 0x98, 0x41, 0x0, 0x0, 0x1, 0x22, 0x21,
+    /* U+00E5 "å" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x13, 0x42, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xdf, 0xff, 0x91, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4d, 0xe8, 0x7b, 0xe8,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xbf, 0x40, 0x1, 0xbe, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xed, 0x0, 0x0, 0x5f,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xed, 0x0, 0x0, 0x5f, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xaf, 0x50, 0x1, 0xbe,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4d, 0xea, 0x8c, 0xf9, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xce, 0xfd, 0x81,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x23, 0x43, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x23, 0x55, 0x66, 0x54,
+    0x31, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49,
+    0xcd, 0xef, 0xff, 0xfe, 0xca, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x4b, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfb, 0x30, 0x0, 0x0, 0x4, 0xdf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0x0,
+    0x0, 0x2d, 0xff, 0xfe, 0xa6, 0x32, 0x23, 0x6a,
+    0xef, 0xff, 0xf8, 0x0, 0x0, 0x8f, 0xff, 0xe7,
+    0x10, 0x0, 0x0, 0x0, 0x6e, 0xff, 0xfc, 0x20,
+    0x3, 0xdf, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xfe, 0x40, 0x5, 0xff, 0xfd, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xdf, 0xff, 0x50,
+    0x2, 0x79, 0xb9, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xdf, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x11,
+    0x49, 0xef, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x23, 0x56, 0x89, 0xce, 0xff, 0xff, 0xff, 0x50,
+    0x0, 0x0, 0x3, 0x8b, 0xcd, 0xef, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x50, 0x0, 0x3, 0x9f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xec, 0xef, 0xff, 0x50,
+    0x0, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x96,
+    0x43, 0xdf, 0xff, 0x50, 0x3, 0xcf, 0xff, 0xfd,
+    0xa8, 0x52, 0x0, 0x0, 0x2, 0xdf, 0xff, 0x50,
+    0x9, 0xff, 0xff, 0xa3, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xdf, 0xff, 0x50, 0x1e, 0xff, 0xfb, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xdf, 0xff, 0x50,
+    0x3e, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xef, 0xff, 0x50, 0x4f, 0xff, 0xf4, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1a, 0xff, 0xff, 0x50,
+    0x3e, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5e, 0xff, 0xff, 0x60, 0x1e, 0xff, 0xfc, 0x10,
+    0x0, 0x0, 0x0, 0x15, 0xdf, 0xff, 0xff, 0x60,
+    0x9, 0xff, 0xff, 0xb4, 0x10, 0x0, 0x14, 0x9e,
+    0xff, 0xff, 0xff, 0x80, 0x3, 0xdf, 0xff, 0xfd,
+    0xba, 0x9b, 0xce, 0xff, 0xfb, 0xaf, 0xff, 0xa0,
+    0x0, 0x4d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
+    0x71, 0x4f, 0xff, 0xe1, 0x0, 0x4, 0xbf, 0xff,
+    0xff, 0xff, 0xff, 0x94, 0x0, 0x2d, 0xff, 0xf5,
+    0x0, 0x0, 0x2, 0x69, 0xaa, 0x98, 0x41, 0x0,
+    0x0, 0x1, 0x22, 0x21,
+    /* U+00E9 "é" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x14, 0x44,
+    0x44, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xff, 0xfc, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
+    0xd4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xf8,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5e, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xae, 0xec, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x55, 0x52, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x13, 0x55, 0x65, 0x42, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x16, 0xbd, 0xef, 0xff, 0xec,
+    0x93, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xdf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x0, 0x0,
+    0x0, 0x0, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfb, 0x20, 0x0, 0x0, 0x6, 0xef, 0xff,
+    0xeb, 0x53, 0x23, 0x7b, 0xff, 0xff, 0xc1, 0x0,
+    0x0, 0x3d, 0xff, 0xfe, 0x61, 0x0, 0x0, 0x1,
+    0x8f, 0xff, 0xf8, 0x10, 0x1, 0x9f, 0xff, 0xe5,
+    0x0, 0x0, 0x0, 0x0, 0x18, 0xef, 0xfd, 0x40,
+    0x3, 0xef, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xbf, 0xff, 0x90, 0x7, 0xff, 0xfd, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xe0,
+    0xc, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2e, 0xff, 0xf3, 0xe, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xff, 0xf7,
+    0x2e, 0xff, 0xfa, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x7d, 0xff, 0xf9, 0x3e, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
+    0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfa, 0x4e, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
+    0x3e, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xf4, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xe, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xfc, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0x87, 0x62,
+    0x5, 0xff, 0xfe, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0xe4, 0x2, 0xcf, 0xff, 0xc2,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xff, 0xd0,
+    0x0, 0x6f, 0xff, 0xfb, 0x20, 0x0, 0x0, 0x0,
+    0x2a, 0xff, 0xff, 0x70, 0x0, 0x1a, 0xff, 0xff,
+    0xd7, 0x31, 0x1, 0x36, 0xcf, 0xff, 0xfa, 0x10,
+    0x0, 0x2, 0xbf, 0xff, 0xff, 0xdc, 0xbc, 0xde,
+    0xff, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x19, 0xef,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x20, 0x0,
+    0x0, 0x0, 0x1, 0x5b, 0xff, 0xff, 0xff, 0xff,
+    0xfc, 0x61, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x15, 0x8a, 0xaa, 0x96, 0x30, 0x0, 0x0, 0x0,
+    /* U+00F6 "ö" */
+    0x0, 0x0, 0x1, 0x44, 0x44, 0x0, 0x0, 0x34,
+    0x44, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
+    0xff, 0xf1, 0x0, 0x9, 0xff, 0xfd, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x10, 0x0,
+    0x9f, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5f, 0xff, 0xf1, 0x0, 0x9, 0xff, 0xfd, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x10,
+    0x0, 0x9f, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x38, 0x88, 0x81, 0x0, 0x5, 0x88, 0x86,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x35, 0x56, 0x54,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x17, 0xbd, 0xef, 0xff, 0xec, 0xa4, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x6e, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfa, 0x30, 0x0, 0x0, 0x0, 0x1,
+    0x8e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
+    0x40, 0x0, 0x0, 0x1, 0x9f, 0xff, 0xfe, 0xa5,
+    0x32, 0x48, 0xcf, 0xff, 0xfd, 0x30, 0x0, 0x0,
+    0x6e, 0xff, 0xfd, 0x41, 0x0, 0x0, 0x2, 0x9f,
+    0xff, 0xfb, 0x20, 0x0, 0x2c, 0xff, 0xfc, 0x30,
+    0x0, 0x0, 0x0, 0x1, 0x8f, 0xff, 0xf7, 0x0,
+    0x5, 0xff, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xbf, 0xff, 0xd0, 0x0, 0xbf, 0xff, 0xc1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
+    0x30, 0x1e, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1d, 0xff, 0xf8, 0x3, 0xef, 0xff,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xaf,
+    0xff, 0xa0, 0x5f, 0xff, 0xe2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0xfb, 0x16, 0xff,
+    0xfd, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xc1, 0x6f, 0xff, 0xc2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xfc, 0x26,
+    0xff, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xb1, 0x5f, 0xff, 0xe2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xfb,
+    0x14, 0xef, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xaf, 0xff, 0xa0, 0x1e, 0xff, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xff,
+    0xf8, 0x0, 0xcf, 0xff, 0xa0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0xff, 0x50, 0x7, 0xff,
+    0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
+    0xff, 0xe1, 0x0, 0x3d, 0xff, 0xfb, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x6e, 0xff, 0xf9, 0x0, 0x0,
+    0x8f, 0xff, 0xfa, 0x10, 0x0, 0x0, 0x0, 0x5d,
+    0xff, 0xfd, 0x40, 0x0, 0x1, 0xbf, 0xff, 0xfc,
+    0x62, 0x10, 0x14, 0x8e, 0xff, 0xff, 0x60, 0x0,
+    0x0, 0x3, 0xcf, 0xff, 0xfe, 0xdc, 0xbc, 0xef,
+    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x2, 0xae,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x6c, 0xff, 0xff, 0xff,
+    0xff, 0xe8, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0x69, 0xaa, 0x97, 0x40, 0x0, 0x0,
+    0x0, 0x0,
+    /* U+00FC "ü" */
+    0x0, 0x0, 0x24, 0x44, 0x40, 0x0, 0x3, 0x44,
+    0x43, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf0,
+    0x0, 0xa, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xff, 0xf0, 0x0, 0xa, 0xff, 0xfb, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xff, 0xf0, 0x0, 0xa,
+    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
+    0xf0, 0x0, 0xa, 0xff, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x38, 0x88, 0x70, 0x0, 0x5, 0x88, 0x86,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0xaa,
+    0xa4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x19, 0xaa,
+    0xa3, 0x2c, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2d, 0xff, 0xf4, 0x2c, 0xff, 0xe5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2d, 0xff, 0xf4, 0x2c,
+    0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d,
+    0xff, 0xf4, 0x2c, 0xff, 0xe5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2d, 0xff, 0xf4, 0x2c, 0xff, 0xe5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xff, 0xf4,
+    0x2c, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2d, 0xff, 0xf4, 0x2c, 0xff, 0xe5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2d, 0xff, 0xf4, 0x2c, 0xff,
+    0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xff,
+    0xf4, 0x2c, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2d, 0xff, 0xf4, 0x2c, 0xff, 0xe5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2d, 0xff, 0xf4, 0x2c,
+    0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d,
+    0xff, 0xf4, 0x2c, 0xff, 0xe5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2d, 0xff, 0xf4, 0x2c, 0xff, 0xe5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xff, 0xf4,
+    0x2c, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2d, 0xff, 0xf4, 0x2c, 0xff, 0xe5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3d, 0xff, 0xf4, 0x2c, 0xff,
+    0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xff,
+    0xf4, 0x2b, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0xf4, 0x1b, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xaf, 0xff, 0xf4, 0x9,
+    0xff, 0xfc, 0x20, 0x0, 0x0, 0x0, 0x5, 0xef,
+    0xff, 0xf4, 0x6, 0xff, 0xff, 0x81, 0x0, 0x0,
+    0x1, 0x5d, 0xff, 0xff, 0xf4, 0x2, 0xdf, 0xff,
+    0xfa, 0x52, 0x23, 0x59, 0xef, 0xfd, 0xff, 0xf4,
+    0x0, 0x8f, 0xff, 0xff, 0xed, 0xcd, 0xef, 0xff,
+    0x99, 0xff, 0xf4, 0x0, 0x18, 0xef, 0xff, 0xff,
+    0xff, 0xff, 0xe9, 0x18, 0xff, 0xf4, 0x0, 0x1,
+    0x6d, 0xff, 0xff, 0xff, 0xfd, 0x61, 0x8, 0xff,
+    0xf4, 0x0, 0x0, 0x0, 0x37, 0x9a, 0xa8, 0x40,
+    0x0, 0x1, 0x11, 0x10,
+};
+
+static const lv_font_fmt_txt_glyph_dsc_t arial_48_glyph_dsc[] = {
+    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
+    {.bitmap_index = 0, .adv_w = 213, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 0, .adv_w = 213, .box_w = 6, .box_h = 35, .ofs_x = 4, .ofs_y = 0},
+    {.bitmap_index = 105, .adv_w = 273, .box_w = 14, .box_h = 14, .ofs_x = 2, .ofs_y = 21},
+    {.bitmap_index = 203, .adv_w = 427, .box_w = 27, .box_h = 36, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 689, .adv_w = 427, .box_w = 24, .box_h = 43, .ofs_x = 1, .ofs_y = -5},
+    {.bitmap_index = 1205, .adv_w = 683, .box_w = 38, .box_h = 37, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 1908, .adv_w = 512, .box_w = 29, .box_h = 36, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 2430, .adv_w = 147, .box_w = 6, .box_h = 14, .ofs_x = 2, .ofs_y = 21},
+    {.bitmap_index = 2472, .adv_w = 256, .box_w = 13, .box_h = 46, .ofs_x = 2, .ofs_y = -11},
+    {.bitmap_index = 2771, .adv_w = 256, .box_w = 13, .box_h = 46, .ofs_x = 2, .ofs_y = -11},
+    {.bitmap_index = 3070, .adv_w = 299, .box_w = 17, .box_h = 15, .ofs_x = 1, .ofs_y = 20},
+    {.bitmap_index = 3198, .adv_w = 448, .box_w = 24, .box_h = 24, .ofs_x = 2, .ofs_y = 5},
+    {.bitmap_index = 3486, .adv_w = 213, .box_w = 6, .box_h = 12, .ofs_x = 4, .ofs_y = -7},
+    {.bitmap_index = 3522, .adv_w = 256, .box_w = 14, .box_h = 5, .ofs_x = 1, .ofs_y = 10},
+    {.bitmap_index = 3557, .adv_w = 213, .box_w = 6, .box_h = 5, .ofs_x = 4, .ofs_y = 0},
+    {.bitmap_index = 3572, .adv_w = 213, .box_w = 14, .box_h = 36, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 3824, .adv_w = 427, .box_w = 24, .box_h = 36, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 4256, .adv_w = 427, .box_w = 15, .box_h = 35, .ofs_x = 4, .ofs_y = 0},
+    {.bitmap_index = 4519, .adv_w = 427, .box_w = 24, .box_h = 35, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4939, .adv_w = 427, .box_w = 23, .box_h = 36, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 5353, .adv_w = 427, .box_w = 25, .box_h = 35, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5791, .adv_w = 427, .box_w = 23, .box_h = 35, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 6194, .adv_w = 427, .box_w = 24, .box_h = 36, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 6626, .adv_w = 427, .box_w = 23, .box_h = 35, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 7029, .adv_w = 427, .box_w = 24, .box_h = 36, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 7461, .adv_w = 427, .box_w = 24, .box_h = 36, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 7893, .adv_w = 213, .box_w = 6, .box_h = 25, .ofs_x = 4, .ofs_y = 0},
+    {.bitmap_index = 7968, .adv_w = 213, .box_w = 6, .box_h = 32, .ofs_x = 4, .ofs_y = -7},
+    {.bitmap_index = 8064, .adv_w = 448, .box_w = 24, .box_h = 24, .ofs_x = 2, .ofs_y = 5},
+    {.bitmap_index = 8352, .adv_w = 448, .box_w = 24, .box_h = 15, .ofs_x = 2, .ofs_y = 9},
+    {.bitmap_index = 8532, .adv_w = 448, .box_w = 24, .box_h = 24, .ofs_x = 2, .ofs_y = 5},
+    {.bitmap_index = 8820, .adv_w = 427, .box_w = 23, .box_h = 35, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 9223, .adv_w = 780, .box_w = 46, .box_h = 46, .ofs_x = 2, .ofs_y = -11},
+    {.bitmap_index = 10281, .adv_w = 512, .box_w = 33, .box_h = 35, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10859, .adv_w = 512, .box_w = 27, .box_h = 35, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 11332, .adv_w = 555, .box_w = 31, .box_h = 36, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 11890, .adv_w = 555, .box_w = 30, .box_h = 35, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 12415, .adv_w = 512, .box_w = 27, .box_h = 35, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 12888, .adv_w = 469, .box_w = 25, .box_h = 35, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 13326, .adv_w = 597, .box_w = 33, .box_h = 36, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 13920, .adv_w = 555, .box_w = 28, .box_h = 35, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 14410, .adv_w = 213, .box_w = 6, .box_h = 35, .ofs_x = 4, .ofs_y = 0},
+    {.bitmap_index = 14515, .adv_w = 384, .box_w = 20, .box_h = 36, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 14875, .adv_w = 512, .box_w = 29, .box_h = 35, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 15383, .adv_w = 427, .box_w = 23, .box_h = 35, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 15786, .adv_w = 640, .box_w = 34, .box_h = 35, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 16381, .adv_w = 555, .box_w = 28, .box_h = 35, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 16871, .adv_w = 597, .box_w = 34, .box_h = 36, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 17483, .adv_w = 512, .box_w = 28, .box_h = 36, .ofs_x = 3, .ofs_y = -1},
+    {.bitmap_index = 17987, .adv_w = 597, .box_w = 34, .box_h = 38, .ofs_x = 2, .ofs_y = -3},
+    {.bitmap_index = 18633, .adv_w = 555, .box_w = 32, .box_h = 35, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 19193, .adv_w = 512, .box_w = 28, .box_h = 36, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 19697, .adv_w = 469, .box_w = 29, .box_h = 35, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20205, .adv_w = 555, .box_w = 28, .box_h = 36, .ofs_x = 3, .ofs_y = -1},
+    {.bitmap_index = 20709, .adv_w = 512, .box_w = 32, .box_h = 35, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21269, .adv_w = 725, .box_w = 45, .box_h = 35, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 22057, .adv_w = 512, .box_w = 32, .box_h = 35, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 22617, .adv_w = 512, .box_w = 32, .box_h = 35, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 23177, .adv_w = 469, .box_w = 29, .box_h = 35, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 23685, .adv_w = 213, .box_w = 11, .box_h = 45, .ofs_x = 2, .ofs_y = -10},
+    {.bitmap_index = 23933, .adv_w = 213, .box_w = 14, .box_h = 36, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 24185, .adv_w = 213, .box_w = 11, .box_h = 45, .ofs_x = 0, .ofs_y = -10},
+    {.bitmap_index = 24433, .adv_w = 361, .box_w = 21, .box_h = 20, .ofs_x = 1, .ofs_y = 16},
+    {.bitmap_index = 24643, .adv_w = 427, .box_w = 29, .box_h = 4, .ofs_x = -1, .ofs_y = -10},
+    {.bitmap_index = 24701, .adv_w = 256, .box_w = 9, .box_h = 7, .ofs_x = 2, .ofs_y = 28},
+    {.bitmap_index = 24733, .adv_w = 427, .box_w = 24, .box_h = 27, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 25057, .adv_w = 427, .box_w = 23, .box_h = 36, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 25471, .adv_w = 384, .box_w = 23, .box_h = 27, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 25782, .adv_w = 427, .box_w = 23, .box_h = 36, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 26196, .adv_w = 427, .box_w = 24, .box_h = 27, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 26520, .adv_w = 213, .box_w = 16, .box_h = 36, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 26808, .adv_w = 427, .box_w = 23, .box_h = 37, .ofs_x = 1, .ofs_y = -11},
+    {.bitmap_index = 27234, .adv_w = 427, .box_w = 22, .box_h = 35, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 27619, .adv_w = 171, .box_w = 6, .box_h = 35, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 27724, .adv_w = 171, .box_w = 11, .box_h = 46, .ofs_x = -3, .ofs_y = -11},
+    {.bitmap_index = 27977, .adv_w = 384, .box_w = 22, .box_h = 35, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 28362, .adv_w = 171, .box_w = 6, .box_h = 35, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 28467, .adv_w = 640, .box_w = 35, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 28922, .adv_w = 427, .box_w = 22, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 29208, .adv_w = 427, .box_w = 25, .box_h = 27, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 29546, .adv_w = 427, .box_w = 23, .box_h = 36, .ofs_x = 2, .ofs_y = -10},
+    {.bitmap_index = 29960, .adv_w = 427, .box_w = 23, .box_h = 36, .ofs_x = 1, .ofs_y = -10},
+    {.bitmap_index = 30374, .adv_w = 256, .box_w = 15, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 30569, .adv_w = 384, .box_w = 22, .box_h = 27, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 30866, .adv_w = 213, .box_w = 13, .box_h = 34, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 31087, .adv_w = 427, .box_w = 22, .box_h = 26, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 31373, .adv_w = 384, .box_w = 24, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 31673, .adv_w = 555, .box_w = 35, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 32111, .adv_w = 384, .box_w = 24, .box_h = 26, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 32423, .adv_w = 384, .box_w = 24, .box_h = 36, .ofs_x = 0, .ofs_y = -11},
+    {.bitmap_index = 32855, .adv_w = 384, .box_w = 24, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 33155, .adv_w = 256, .box_w = 15, .box_h = 46, .ofs_x = 1, .ofs_y = -11},
+    {.bitmap_index = 33500, .adv_w = 200, .box_w = 5, .box_h = 46, .ofs_x = 4, .ofs_y = -11},
+    {.bitmap_index = 33615, .adv_w = 256, .box_w = 16, .box_h = 46, .ofs_x = 0, .ofs_y = -11},
+    {.bitmap_index = 33983, .adv_w = 448, .box_w = 25, .box_h = 8, .ofs_x = 2, .ofs_y = 13},
+    {.bitmap_index = 34083, .adv_w = 512, .box_w = 33, .box_h = 42, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 34776, .adv_w = 512, .box_w = 33, .box_h = 42, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 35469, .adv_w = 512, .box_w = 27, .box_h = 44, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 36063, .adv_w = 597, .box_w = 34, .box_h = 43, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 36794, .adv_w = 555, .box_w = 28, .box_h = 43, .ofs_x = 3, .ofs_y = -1},
+    {.bitmap_index = 37396, .adv_w = 427, .box_w = 24, .box_h = 36, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 37828, .adv_w = 427, .box_w = 24, .box_h = 37, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 38272, .adv_w = 427, .box_w = 24, .box_h = 36, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 38704, .adv_w = 427, .box_w = 25, .box_h = 36, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 39154, .adv_w = 427, .box_w = 22, .box_h = 36, .ofs_x = 2, .ofs_y = -1}
+};
+
+static const lv_font_fmt_txt_dsc_t arial_48_dsc = {
+    .glyph_bitmap = arial_48_bitmap,
+    .glyph_dsc = arial_48_glyph_dsc,
+    .cmaps = ui_font_cmaps,
+    .kern_dsc = NULL,
+    .kern_scale = 0,
+    .cmap_num = UI_FONT_CMAP_NUM,
+    .bpp = 4,
+    .kern_classes = 0,
+    .bitmap_format = 0,
+};
+
+const lv_font_t Arial_48 = {
+    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
+    .line_height = 54,          /*The maximum line height required by the font*/
+    .base_line = 10,             /*Baseline measured from the bottom of the line*/
+    .subpx = LV_FONT_SUBPX_NONE,
+    .underline_position = -5,
+    .underline_thickness = 3,
+    .dsc = &arial_48_dsc,          /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
+    .fallback = &lv_font_montserrat_14,
+    .user_data = NULL,
+};
+
+/*-----------------
+ *  Arial_70
+ *----------------*/
+
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t arial_70_bitmap[] = {
+    /* U+0020 " " */
+    /* U+0021 "!" */
+    0xff, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xfa,
+    0xff, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xfa,
+    0xff, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xfa,
+    0xff, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xfa,
+    0xff, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xfa,
+    0xff, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xf9,
+    0xef, 0xff, 0xff, 0xf8, 0xdf, 0xff, 0xff, 0xf7,
+    0xbf, 0xff, 0xff, 0xf6, 0xaf, 0xff, 0xff, 0xf5,
+    0x9f, 0xff, 0xff, 0xf4, 0x8f, 0xff, 0xff, 0xf3,
+    0x7f, 0xff, 0xff, 0xf2, 0x6f, 0xff, 0xff, 0xf1,
+    0x5f, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0xe0,
+    0x2f, 0xff, 0xff, 0xd0, 0x1f, 0xff, 0xff, 0xc0,
+    0xf, 0xff, 0xff, 0xb0, 0xf, 0xff, 0xff, 0xa0,
+    0xe, 0xff, 0xff, 0x90, 0xd, 0xff, 0xff, 0x80,
+    0xc, 0xff, 0xff, 0x70, 0xa, 0xff, 0xff, 0x60,
+    0x9, 0xff, 0xff, 0x50, 0x8, 0xff, 0xff, 0x40,
+    0x7, 0xff, 0xff, 0x30, 0x6, 0xff, 0xff, 0x20,
+    0x5, 0xff, 0xff, 0x0, 0x4, 0xff, 0xff, 0x0,
+    0x2, 0xff, 0xfe, 0x0, 0x1, 0x88, 0x87, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xf5,
+    0xbf, 0xff, 0xff, 0xf5, 0xbf, 0xff, 0xff, 0xf5,
+    0xbf, 0xff, 0xff, 0xf5, 0xbf, 0xff, 0xff, 0xf5,
+    0xbf, 0xff, 0xff, 0xf5, 0xbf, 0xff, 0xff, 0xf5,
+    /* U+0022 "\"" */
+    0x8a, 0xaa, 0xaa, 0xa2, 0x0, 0x4, 0xaa, 0xaa,
+    0xaa, 0x6c, 0xff, 0xff, 0xff, 0x30, 0x0, 0x7f,
+    0xff, 0xff, 0xf9, 0xcf, 0xff, 0xff, 0xf3, 0x0,
+    0x7, 0xff, 0xff, 0xff, 0x9c, 0xff, 0xff, 0xff,
+    0x30, 0x0, 0x7f, 0xff, 0xff, 0xf9, 0xcf, 0xff,
+    0xff, 0xf3, 0x0, 0x7, 0xff, 0xff, 0xff, 0x9c,
+    0xff, 0xff, 0xff, 0x30, 0x0, 0x7f, 0xff, 0xff,
+    0xf9, 0xcf, 0xff, 0xff, 0xf3, 0x0, 0x7, 0xff,
+    0xff, 0xff, 0x9c, 0xff, 0xff, 0xff, 0x30, 0x0,
+    0x7f, 0xff, 0xff, 0xf9, 0xcf, 0xff, 0xff, 0xf3,
+    0x0, 0x6, 0xff, 0xff, 0xff, 0x89, 0xff, 0xff,
+    0xff, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xf6, 0x6f,
+    0xff, 0xff, 0xe0, 0x0, 0x1, 0xff, 0xff, 0xff,
+    0x33, 0xff, 0xff, 0xfb, 0x0, 0x0, 0xe, 0xff,
+    0xff, 0xf0, 0x1f, 0xff, 0xff, 0x90, 0x0, 0x0,
+    0xbf, 0xff, 0xfd, 0x0, 0xef, 0xff, 0xf6, 0x0,
+    0x0, 0x8, 0xff, 0xff, 0xb0, 0xb, 0xff, 0xff,
+    0x40, 0x0, 0x0, 0x6f, 0xff, 0xf8, 0x0, 0x8f,
+    0xff, 0xf1, 0x0, 0x0, 0x3, 0xff, 0xff, 0x50,
+    0x5, 0xff, 0xfe, 0x0, 0x0, 0x0, 0xf, 0xff,
+    0xf2, 0x0, 0x2f, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0xdf, 0xff, 0x0,
+    /* U+0023 "#" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
+    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xff, 0xfd, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5f, 0xff, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
+    0xa0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xcf, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0xff, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xff, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xaf, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xcf, 0xff, 0xf6, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xfe, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xfc, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xff, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xcf, 0xff, 0xf6, 0x0, 0x0,
+    0x0, 0x1, 0x11, 0x11, 0x11, 0x11, 0x1d, 0xff,
+    0xff, 0x51, 0x11, 0x11, 0x11, 0x11, 0x1f, 0xff,
+    0xff, 0x41, 0x11, 0x11, 0x4, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x4, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x4f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xff, 0xff, 0xf1, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xff, 0xff, 0xf0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
+    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
+    0x0, 0x9, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xe, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xe0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xff, 0x90, 0x0, 0x0,
+    0x0, 0x0, 0xa, 0xff, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
+    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xf, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x1f, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xe0,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xd0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x11, 0x11, 0x11,
+    0x6f, 0xff, 0xfc, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x9f, 0xff, 0xfa, 0x11, 0x11, 0x11, 0x11, 0x10,
+    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x4, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x4f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x4f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0x60,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xcf, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xff, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
+    0x70, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
+    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xdf, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0xfa, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9f, 0xff, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
+    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
+    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0xf4, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x38, 0x88, 0x85, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x48, 0x88, 0x84, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    /* U+0024 "$" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0x88, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x24, 0x7c, 0xff, 0xf8, 0x53, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0x9d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfc, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xfe, 0xbc,
+    0xff, 0xfb, 0xef, 0xff, 0xff, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xfe, 0x50,
+    0x9, 0xff, 0xf1, 0x6, 0xef, 0xff, 0xff, 0xff,
+    0x20, 0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0xa0,
+    0x0, 0x9, 0xff, 0xf1, 0x0, 0x1c, 0xff, 0xff,
+    0xff, 0xc0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xfa,
+    0x0, 0x0, 0x9, 0xff, 0xf1, 0x0, 0x0, 0xdf,
+    0xff, 0xff, 0xf3, 0x0, 0x0, 0xbf, 0xff, 0xff,
+    0xd0, 0x0, 0x0, 0x9, 0xff, 0xf1, 0x0, 0x0,
+    0x3f, 0xff, 0xff, 0xfa, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0x60, 0x0, 0x0, 0x9, 0xff, 0xf1, 0x0,
+    0x0, 0xc, 0xff, 0xff, 0xfe, 0x0, 0x3, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x9, 0xff, 0xf1,
+    0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0x20, 0x5,
+    0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xf1, 0x0, 0x0, 0x2, 0xff, 0xff, 0xec, 0x30,
+    0x6, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xf1, 0x0, 0x0, 0x0, 0x75, 0x30, 0x0,
+    0x0, 0x6, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
+    0x9, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xff, 0xfd, 0x0, 0x0,
+    0x0, 0x9, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0x20,
+    0x0, 0x0, 0x9, 0xff, 0xf1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
+    0x80, 0x0, 0x0, 0x9, 0xff, 0xf1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
+    0xff, 0xf2, 0x0, 0x0, 0x9, 0xff, 0xf1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0xff, 0xfd, 0x20, 0x0, 0x9, 0xff, 0xf1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xe, 0xff, 0xff, 0xff, 0xe5, 0x0, 0x9, 0xff,
+    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xd5, 0x9,
+    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfc, 0x84, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfd, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x6b, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xf4, 0x8e, 0xff, 0xff, 0xff, 0xff, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9, 0xff, 0xf1, 0x0, 0x6e, 0xff, 0xff, 0xff,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9, 0xff, 0xf1, 0x0, 0x0, 0x9f, 0xff,
+    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0xf1, 0x0, 0x0, 0x8,
+    0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0xf1, 0x0, 0x0,
+    0x0, 0xcf, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xf1, 0x0,
+    0x0, 0x0, 0x4f, 0xff, 0xff, 0xf4, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xf1,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x20, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xf1, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xf8,
+    0x14, 0x7a, 0xdf, 0xd0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xf1, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
+    0xfa, 0x6f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x9, 0xff, 0xf1, 0x0, 0x0, 0x0, 0xb, 0xff,
+    0xff, 0xf9, 0x4f, 0xff, 0xff, 0xf3, 0x0, 0x0,
+    0x0, 0x9, 0xff, 0xf1, 0x0, 0x0, 0x0, 0xc,
+    0xff, 0xff, 0xf8, 0x2f, 0xff, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0xf1, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0xff, 0xf6, 0xe, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0xf1, 0x0, 0x0,
+    0x0, 0x4f, 0xff, 0xff, 0xf3, 0xa, 0xff, 0xff,
+    0xff, 0x50, 0x0, 0x0, 0x9, 0xff, 0xf1, 0x0,
+    0x0, 0x0, 0xbf, 0xff, 0xff, 0xe0, 0x4, 0xff,
+    0xff, 0xff, 0xe0, 0x0, 0x0, 0x9, 0xff, 0xf1,
+    0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0x90, 0x0,
+    0xdf, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x9, 0xff,
+    0xf1, 0x0, 0x0, 0x2e, 0xff, 0xff, 0xff, 0x20,
+    0x0, 0x4f, 0xff, 0xff, 0xff, 0xb1, 0x0, 0x9,
+    0xff, 0xf1, 0x0, 0x3, 0xef, 0xff, 0xff, 0xfa,
+    0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xfe, 0x50,
+    0x9, 0xff, 0xf1, 0x1, 0x8f, 0xff, 0xff, 0xff,
+    0xe1, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff,
+    0xfe, 0xac, 0xff, 0xf8, 0xbf, 0xff, 0xff, 0xff,
+    0xff, 0x40, 0x0, 0x0, 0x0, 0x1d, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x1, 0xcf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xaf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x36, 0x8d, 0xff,
+    0xf8, 0x65, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0xf1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0xf1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xf1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    /* U+0025 "%" */
+    0x0, 0x0, 0x0, 0x28, 0xce, 0xfe, 0xd9, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xff, 0xff, 0xe0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1a, 0xff, 0xff,
+    0xff, 0xff, 0xfc, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
+    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1d, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9f, 0xff, 0xf6, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
+    0xd7, 0x45, 0x9f, 0xff, 0xff, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
+    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0xff, 0xfa, 0x0, 0x0, 0x3, 0xef, 0xff,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xa, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xa, 0xff, 0xff, 0xd0, 0x0, 0x0,
+    0x0, 0x4f, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2f, 0xff, 0xfd, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
+    0x50, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9f, 0xff, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xff, 0xff, 0xf1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
+    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xdf, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xbf, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
+    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
+    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
+    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xef, 0xff, 0xf6, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xf3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xff, 0xff, 0xf1, 0x0, 0x0,
+    0x0, 0xd, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
+    0xe0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1f, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
+    0xc, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0xdf,
+    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0x30, 0x0,
+    0x0, 0x6, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0xff, 0xfa, 0x0, 0x0, 0x2, 0xef, 0xff,
+    0xfb, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xd6, 0x44,
+    0x9f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x6f,
+    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0,
+    0x0, 0x0, 0xef, 0xff, 0xf1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x90,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
+    0xff, 0xff, 0xfc, 0x20, 0x0, 0x0, 0x0, 0xe,
+    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x27, 0xce, 0xfe, 0xd9, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x22, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xf1,
+    0x0, 0x0, 0x0, 0x0, 0x49, 0xef, 0xff, 0xfe,
+    0xa4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x1a, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xb2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1f, 0xff, 0xfe, 0x10, 0x0, 0x0,
+    0x1, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x6f, 0xff,
+    0xff, 0xd5, 0x10, 0x3a, 0xff, 0xff, 0xfc, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0xff, 0x70, 0x0, 0x0,
+    0x1, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x6f,
+    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xf1, 0x0,
+    0x0, 0x0, 0xa, 0xff, 0xff, 0xd0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xff, 0xf6, 0x0, 0x0, 0x0, 0xc, 0xff,
+    0xff, 0x90, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
+    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xff, 0xff, 0xe0, 0x0, 0x0,
+    0x0, 0xf, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0xdf, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
+    0x60, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x6f,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xbf, 0xff, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xfd, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
+    0xd0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xfd,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xff, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xff, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0xfd, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
+    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2f, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0xbf, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x4, 0xff,
+    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xdf, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xff, 0xf3, 0x0, 0x0,
+    0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
+    0xfe, 0x20, 0x0, 0x0, 0x9f, 0xff, 0xff, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
+    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5f, 0xff, 0xff, 0xf9, 0x44, 0x7d, 0xff,
+    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xf2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
+    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xef, 0xff, 0xff, 0xff,
+    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xe, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xad, 0xff, 0xdb, 0x61, 0x0, 0x0, 0x0,
+    /* U+0026 "&" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x59,
+    0xde, 0xfe, 0xdb, 0x72, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7, 0xef, 0xff, 0xff, 0xff,
+    0xff, 0xfa, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
+    0xff, 0xff, 0xff, 0xc5, 0x21, 0x26, 0xdf, 0xff,
+    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff,
+    0x70, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0xff, 0xd0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
+    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
+    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xaf, 0xff, 0xff, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
+    0xf1, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
+    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2f, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
+    0xe, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
+    0xff, 0xfd, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
+    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xfb,
+    0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x3d,
+    0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e,
+    0xff, 0xff, 0xff, 0xf7, 0x9f, 0xff, 0xff, 0xff,
+    0xe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0xff, 0xff, 0xff, 0xfa, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7e, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xff,
+    0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
+    0xff, 0xff, 0xfe, 0x50, 0x1d, 0xff, 0xff, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0x5, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xfc,
+    0x10, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xf4, 0x0,
+    0x0, 0x0, 0xff, 0xfd, 0x96, 0x20, 0x0, 0x0,
+    0x6, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
+    0x5f, 0xff, 0xff, 0xff, 0xe1, 0x0, 0x0, 0x3f,
+    0xff, 0xff, 0xf8, 0x0, 0x0, 0x2, 0xff, 0xff,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
+    0xff, 0xff, 0xc0, 0x0, 0x8, 0xff, 0xff, 0xff,
+    0x30, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff,
+    0x90, 0x0, 0xdf, 0xff, 0xff, 0xe0, 0x0, 0x0,
+    0x1f, 0xff, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xdf, 0xff, 0xff, 0xff, 0x50, 0x3f,
+    0xff, 0xff, 0xfa, 0x0, 0x0, 0x6, 0xff, 0xff,
+    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xff, 0xff, 0xff, 0xff, 0x2a, 0xff, 0xff, 0xff,
+    0x40, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xf1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
+    0xff, 0xfe, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
+    0xd, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0xef, 0xff,
+    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x10, 0x0, 0x0, 0xf, 0xff, 0xff, 0xfb, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0xef, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
+    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0xc, 0xff,
+    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xcf, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0xe,
+    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x90, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
+    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xff, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xbf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
+    0x4, 0xff, 0xff, 0xff, 0xff, 0x91, 0x0, 0x0,
+    0x0, 0x28, 0xff, 0xff, 0xff, 0xff, 0xe9, 0xff,
+    0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x8, 0xff,
+    0xff, 0xff, 0xff, 0xfb, 0x87, 0x79, 0xcf, 0xff,
+    0xff, 0xff, 0xff, 0xe2, 0xa, 0xff, 0xff, 0xff,
+    0xff, 0xc1, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xc1, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xd0,
+    0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0,
+    0xa, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
+    0x5, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfd, 0x40, 0x0, 0x0, 0x0, 0xa, 0xff,
+    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7e,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x8b, 0xdf,
+    0xff, 0xec, 0xa6, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xea, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x0, 0x0, 0x0,
+    /* U+0027 "'" */
+    0x9a, 0xaa, 0xaa, 0xa0, 0xef, 0xff, 0xff, 0xf1,
+    0xef, 0xff, 0xff, 0xf1, 0xef, 0xff, 0xff, 0xf1,
+    0xef, 0xff, 0xff, 0xf1, 0xef, 0xff, 0xff, 0xf1,
+    0xef, 0xff, 0xff, 0xf1, 0xef, 0xff, 0xff, 0xf1,
+    0xef, 0xff, 0xff, 0xf1, 0xcf, 0xff, 0xff, 0xe0,
+    0x9f, 0xff, 0xff, 0xc0, 0x7f, 0xff, 0xff, 0x90,
+    0x4f, 0xff, 0xff, 0x60, 0x1f, 0xff, 0xff, 0x30,
+    0xe, 0xff, 0xff, 0x0, 0xc, 0xff, 0xfe, 0x0,
+    0x9, 0xff, 0xfb, 0x0, 0x6, 0xff, 0xf8, 0x0,
+    /* U+0028 "(" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x68, 0x88,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
+    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xff,
+    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
+    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
+    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
+    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
+    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xe, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xdf, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3f, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xff, 0xff, 0x90, 0x0, 0x0,
+    0x0, 0x0, 0xb, 0xff, 0xff, 0xf4, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xf9, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0x60,
+    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xf4,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
+    0xf0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
+    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xbf, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xff, 0xff, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xff, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff,
+    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
+    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
+    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xcf, 0xff, 0xff, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xff, 0xff, 0xf6, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
+    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
+    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xff, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xcf, 0xff, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfd,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xff,
+    0xf7,
+    /* U+0029 ")" */
+    0x48, 0x88, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1f, 0xff, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xf1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
+    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
+    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xe, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0xff, 0xff, 0xd0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xf1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
+    0x60, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
+    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
+    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
+    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0xd, 0xff, 0xff, 0xf6, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
+    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
+    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x3f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xff, 0xff, 0x90, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0xff, 0xff, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
+    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
+    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
+    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
+    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
+    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
+    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xd, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0,
+    /* U+002A "*" */
+    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfe, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xe, 0xff, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
+    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xb, 0xff, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x48, 0x20, 0x0, 0x0, 0xaf, 0xff,
+    0x70, 0x0, 0x0, 0x39, 0x40, 0xa, 0xff, 0xc6,
+    0x0, 0x8, 0xff, 0xf6, 0x0, 0x17, 0xdf, 0xfa,
+    0x0, 0xff, 0xff, 0xff, 0x92, 0x7f, 0xff, 0x43,
+    0xaf, 0xff, 0xff, 0xe0, 0x5f, 0xff, 0xff, 0xff,
+    0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x4a,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf9, 0x15, 0x9d, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0xa5, 0x10, 0x0,
+    0x1, 0x47, 0xbe, 0xff, 0xff, 0xfe, 0xb8, 0x63,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0xff,
+    0xff, 0xc1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xdf, 0xff, 0xff, 0xff, 0xd1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xf6, 0xff,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
+    0xff, 0xf8, 0xb, 0xff, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xff, 0xfe, 0x0, 0x2f, 0xff,
+    0xff, 0x90, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
+    0x50, 0x0, 0x7f, 0xff, 0xff, 0x60, 0x0, 0x0,
+    0xc, 0xff, 0xff, 0xc0, 0x0, 0x0, 0xdf, 0xff,
+    0xfc, 0x0, 0x0, 0x0, 0x8, 0xff, 0xf2, 0x0,
+    0x0, 0x3, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xe7, 0x0, 0x0, 0x0, 0x7, 0xe4, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0,
+    /* U+002B "+" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xff, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xff, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1b, 0xbb, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xdf, 0xff, 0xff, 0xdb,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x1f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xff, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xff, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0,
+    /* U+002C "," */
+    0xc, 0xff, 0xff, 0xff, 0x30, 0xcf, 0xff, 0xff,
+    0xf3, 0xc, 0xff, 0xff, 0xff, 0x30, 0xcf, 0xff,
+    0xff, 0xf3, 0xc, 0xff, 0xff, 0xff, 0x30, 0xcf,
+    0xff, 0xff, 0xf3, 0xc, 0xff, 0xff, 0xff, 0x30,
+    0x0, 0x5, 0xff, 0xf3, 0x0, 0x0, 0x6f, 0xff,
+    0x20, 0x0, 0x9, 0xff, 0xf0, 0x0, 0x0, 0xdf,
+    0xfd, 0x0, 0x0, 0x3f, 0xff, 0x90, 0x0, 0xc,
+    0xff, 0xf3, 0x0, 0x2c, 0xff, 0xfa, 0x0, 0xe,
+    0xff, 0xfd, 0x10, 0x0, 0x6f, 0xfb, 0x10, 0x0,
+    0x0, 0x95, 0x0, 0x0, 0x0,
+    /* U+002D "-" */
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x20, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf2, 0xcf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xcf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
+    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf2, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf2, 0xcf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
+    /* U+002E "." */
+    0xaf, 0xff, 0xff, 0xf5, 0xaf, 0xff, 0xff, 0xf5,
+    0xaf, 0xff, 0xff, 0xf5, 0xaf, 0xff, 0xff, 0xf5,
+    0xaf, 0xff, 0xff, 0xf5, 0xaf, 0xff, 0xff, 0xf5,
+    0xaf, 0xff, 0xff, 0xf5,
+    /* U+002F "/" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x48,
+    0x88, 0x83, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xcf, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0xff, 0xe0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x90,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xe, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2f, 0xff, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
+    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xbf, 0xff, 0xf3, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xe0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
+    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xd, 0xff, 0xff, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xfd, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
+    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1f, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xff, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
+    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
+    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5f, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xaf, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xfa,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
+    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xef, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xff, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
+    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xff, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
+    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    /* U+0030 "0" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x58, 0xce,
+    0xff, 0xed, 0xa7, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8e, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfb, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xd1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0xff, 0xff, 0xfe, 0x84, 0x21, 0x36, 0xcf,
+    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x1e, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
+    0x5, 0xef, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2e, 0xff, 0xff, 0xff, 0x10, 0x0,
+    0x0, 0x2, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0x90,
+    0x0, 0x0, 0x8, 0xff, 0xff, 0xfd, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
+    0xf1, 0x0, 0x0, 0xe, 0xff, 0xff, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
+    0xff, 0xf6, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xf0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xff, 0xfc, 0x0, 0x0, 0x9f, 0xff, 0xff,
+    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xff, 0xff, 0xff, 0x10, 0x0, 0xef, 0xff,
+    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0xff, 0x60, 0x1, 0xff,
+    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0x90, 0x4,
+    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xd0,
+    0x7, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
+    0xf0, 0xa, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
+    0xff, 0xf1, 0xb, 0xff, 0xff, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0xff, 0xf4, 0xd, 0xff, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0xff, 0xf5, 0xe, 0xff, 0xff, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xe, 0xff, 0xff, 0xf6, 0xf, 0xff, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xd, 0xff, 0xff, 0xf7, 0xf, 0xff,
+    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xf8, 0xf,
+    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xf8,
+    0x1f, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
+    0xf8, 0x1f, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
+    0xff, 0xf9, 0x1f, 0xff, 0xff, 0xf3, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0xff, 0xff, 0xf8, 0xf, 0xff, 0xff, 0xf4, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0xff, 0xff, 0xf8, 0xf, 0xff, 0xff, 0xf4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0xff, 0xff, 0xf7, 0xf, 0xff, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xd, 0xff, 0xff, 0xf7, 0xe, 0xff,
+    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xf6, 0xd,
+    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf4,
+    0xb, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
+    0xf3, 0x9, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
+    0xff, 0xf1, 0x7, 0xff, 0xff, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xff, 0xff, 0xf0, 0x4, 0xff, 0xff, 0xfe, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xff, 0xff, 0xc0, 0x1, 0xff, 0xff, 0xff,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0xff, 0xff, 0x90, 0x0, 0xef, 0xff,
+    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0xff, 0x50, 0x0, 0x9f,
+    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0x10, 0x0,
+    0x5f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xfd, 0x0,
+    0x0, 0xf, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xf7,
+    0x0, 0x0, 0x9, 0xff, 0xff, 0xfd, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
+    0xf1, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0x90,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
+    0xff, 0x90, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff,
+    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x1f, 0xff,
+    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x4, 0xef,
+    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0xff, 0xff, 0xfe, 0x83, 0x11, 0x26, 0xcf,
+    0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfd, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xd1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5e, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x8f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfb, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x59, 0xce, 0xff, 0xed, 0xa7, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+    /* U+0031 "1" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0x22, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xdf, 0xff, 0xf1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xf1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
+    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xff, 0xf1,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
+    0xff, 0xf1, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x5, 0xef,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x2,
+    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
+    0x1, 0x9f, 0xff, 0xff, 0xff, 0xff, 0x6f, 0xff,
+    0xff, 0xf1, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xe3,
+    0x1f, 0xff, 0xff, 0xf1, 0x6f, 0xff, 0xff, 0xff,
+    0xfa, 0x10, 0x1f, 0xff, 0xff, 0xf1, 0x6f, 0xff,
+    0xff, 0xfe, 0x40, 0x0, 0x1f, 0xff, 0xff, 0xf1,
+    0x6f, 0xff, 0xff, 0x80, 0x0, 0x0, 0x1f, 0xff,
+    0xff, 0xf1, 0x6f, 0xff, 0x91, 0x0, 0x0, 0x0,
+    0x1f, 0xff, 0xff, 0xf1, 0x6f, 0x81, 0x0, 0x0,
+    0x0, 0x0, 0x1f, 0xff, 0xff, 0xf1, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
+    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1f, 0xff, 0xff, 0xf1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
+    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1f, 0xff, 0xff, 0xf1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
+    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1f, 0xff, 0xff, 0xf1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
+    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1f, 0xff, 0xff, 0xf1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
+    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1f, 0xff, 0xff, 0xf1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
+    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1f, 0xff, 0xff, 0xf1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
+    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1f, 0xff, 0xff, 0xf1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
+    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1f, 0xff, 0xff, 0xf1,
+    /* U+0032 "2" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x7b,
+    0xde, 0xff, 0xfe, 0xdb, 0x73, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xdf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xef,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xe3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xff, 0xff, 0xff, 0xfa, 0x62, 0x10, 0x13,
+    0x7c, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0,
+    0x3, 0xff, 0xff, 0xff, 0xfb, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x4d, 0xff, 0xff, 0xff, 0xf2, 0x0,
+    0x0, 0xc, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xcf, 0xff, 0xff, 0xfb,
+    0x0, 0x0, 0x4f, 0xff, 0xff, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xff, 0xff,
+    0xff, 0x20, 0x0, 0xaf, 0xff, 0xff, 0xe0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0xff, 0xff, 0x80, 0x0, 0xff, 0xff, 0xff, 0x70,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xcf, 0xff, 0xff, 0xc0, 0x3, 0xff, 0xff, 0xff,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xff, 0xf0, 0x6, 0xff, 0xff,
+    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xff, 0xff, 0xf1, 0x9, 0xff,
+    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf2, 0x4,
+    0x79, 0xbc, 0xea, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
+    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
+    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
+    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xbf, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xff, 0xff, 0xff, 0xe1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3e, 0xff, 0xff, 0xff, 0xd0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xef, 0xff, 0xff, 0xfe,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff,
+    0xe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff,
+    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
+    0xff, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
+    0xff, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
+    0xff, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xff,
+    0xff, 0xff, 0xfc, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xef,
+    0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
+    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xff, 0xff, 0xff, 0xe4, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9, 0xff, 0xff, 0xff, 0xfd, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0xff, 0xff, 0xff, 0xc1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff,
+    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
+    0xff, 0xfe, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xe3, 0x1f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x5f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
+    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf3, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf3, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf3,
+    /* U+0033 "3" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x8c,
+    0xef, 0xff, 0xec, 0x95, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xef,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xef,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xc1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x5f, 0xff, 0xff, 0xff, 0xf9, 0x41, 0x0, 0x26,
+    0xcf, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x1, 0xef, 0xff, 0xff, 0xfa, 0x10, 0x0, 0x0,
+    0x0, 0x5, 0xef, 0xff, 0xff, 0xf7, 0x0, 0x0,
+    0x0, 0x9, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2e, 0xff, 0xff, 0xff, 0x10,
+    0x0, 0x0, 0x1f, 0xff, 0xff, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff,
+    0x70, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xf2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
+    0xff, 0xc0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
+    0xff, 0xff, 0xf0, 0x0, 0x1, 0xff, 0xff, 0xff,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2f, 0xff, 0xff, 0xf3, 0x0, 0x4, 0xff, 0xff,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xf, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x2,
+    0x58, 0xba, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1f, 0xff, 0xff, 0xf4, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xf0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff,
+    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
+    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
+    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4d, 0xff,
+    0xff, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x14, 0x8e, 0xff,
+    0xff, 0xff, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xb1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xd5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfb, 0x60, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x60,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xd, 0xfc, 0xba, 0xbd, 0xff, 0xff, 0xff, 0xff,
+    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0x0, 0x0, 0x0, 0x16, 0xef, 0xff,
+    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
+    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
+    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xd, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0xff, 0xff, 0xfb, 0x3, 0x57, 0xac,
+    0xe3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xe, 0xff, 0xff, 0xfb, 0xf, 0xff,
+    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf9, 0xc,
+    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf6,
+    0x9, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
+    0xf2, 0x4, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
+    0xff, 0xd0, 0x0, 0xef, 0xff, 0xff, 0xf1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
+    0xff, 0xff, 0x70, 0x0, 0x7f, 0xff, 0xff, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0xff, 0xfe, 0x0, 0x0, 0xe, 0xff, 0xff,
+    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x4, 0xff,
+    0xff, 0xff, 0xfc, 0x20, 0x0, 0x0, 0x0, 0x2,
+    0xbf, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
+    0x8f, 0xff, 0xff, 0xff, 0xfb, 0x63, 0x12, 0x36,
+    0xbf, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xef, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xdf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0x7b, 0xde, 0xff, 0xed, 0xa7, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0,
+    /* U+0034 "4" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xa, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0x9f,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
+    0xf8, 0x6f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e,
+    0xff, 0xff, 0xc0, 0x6f, 0xff, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xbf, 0xff, 0xff, 0x20, 0x6f, 0xff, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0xff, 0xf6, 0x0, 0x6f,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xb0,
+    0x0, 0x6f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
+    0xfe, 0x10, 0x0, 0x6f, 0xff, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xff, 0xf5, 0x0, 0x0, 0x6f, 0xff, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xff, 0xff, 0x90, 0x0, 0x0, 0x6f,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xef, 0xff, 0xfd, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xf3,
+    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x6f,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0x60, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xff,
+    0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xe0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x1f, 0xff, 0xff, 0xfa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xcf, 0xff, 0xff, 0xea, 0xaa,
+    0xaa, 0xa5, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf8, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
+    0xc0, 0x0, 0x0, 0x0,
+    /* U+0035 "5" */
+    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0x3f, 0xff, 0xff, 0xfd, 0xdd, 0xdd,
+    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xa0,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
+    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
+    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xff, 0xfa, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0x60,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
+    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xff, 0xf9, 0x0, 0x2, 0x6a,
+    0xde, 0xff, 0xeb, 0x83, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x60, 0x4b,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x60, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xf5,
+    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xd3, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0x87,
+    0x78, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xfc, 0x50,
+    0x0, 0x0, 0x0, 0x5, 0xdf, 0xff, 0xff, 0xff,
+    0xf3, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
+    0xff, 0xff, 0xd0, 0x0, 0x0, 0xcf, 0xff, 0xff,
+    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xff, 0xff, 0xff, 0x60, 0x0, 0x8, 0xbd,
+    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0xff, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x13, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xf4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xcf, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xf1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
+    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xff, 0xff, 0x0, 0x1, 0x24, 0x56,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xaf, 0xff, 0xff, 0xd0, 0xf, 0xff,
+    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xf9, 0x0,
+    0xdf, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff,
+    0x60, 0xa, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
+    0xff, 0xf1, 0x0, 0x6f, 0xff, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
+    0xff, 0xff, 0xfb, 0x0, 0x0, 0xff, 0xff, 0xff,
+    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xa, 0xff, 0xff, 0xff, 0x40, 0x0, 0xa, 0xff,
+    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
+    0x1f, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xf2, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xc2, 0x0,
+    0x0, 0x0, 0x0, 0x2b, 0xff, 0xff, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff,
+    0xfb, 0x62, 0x11, 0x35, 0xbf, 0xff, 0xff, 0xff,
+    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xe4, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xef, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfd, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x37,
+    0xbd, 0xef, 0xfe, 0xdb, 0x73, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+    /* U+0036 "6" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x8b,
+    0xef, 0xfe, 0xdc, 0x84, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0xef,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1c,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xcf, 0xff, 0xff, 0xff, 0xd7, 0x31, 0x12, 0x5a,
+    0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
+    0x0, 0x3d, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0,
+    0x0, 0x4f, 0xff, 0xff, 0xfe, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xf6, 0x0,
+    0x0, 0x0, 0xcf, 0xff, 0xff, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xff, 0xfd,
+    0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
+    0xff, 0x30, 0x0, 0xc, 0xff, 0xff, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0xff, 0x70, 0x0, 0x2f, 0xff, 0xff, 0xf1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xff, 0xff, 0xa0, 0x0, 0x8f, 0xff, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5c, 0xa9, 0x87, 0x40, 0x0, 0xcf, 0xff,
+    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
+    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
+    0x0, 0x25, 0x66, 0x42, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xd, 0xff, 0xff, 0xf1, 0x0, 0x0,
+    0x5, 0xbf, 0xff, 0xff, 0xff, 0xfa, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x0,
+    0x5, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
+    0x30, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xe0,
+    0x1, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
+    0xd0, 0x1d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x3f, 0xff,
+    0xff, 0xd1, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x4f,
+    0xff, 0xff, 0xcb, 0xff, 0xff, 0xfe, 0x84, 0x10,
+    0x12, 0x7c, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
+    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x4e, 0xff, 0xff, 0xff, 0xf3,
+    0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xff, 0xff,
+    0xfc, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xff,
+    0xff, 0xff, 0x40, 0x5f, 0xff, 0xff, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0xff, 0xff, 0xa0, 0x5f, 0xff, 0xff, 0xff,
+    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xcf, 0xff, 0xff, 0xf0, 0x4f, 0xff, 0xff,
+    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5f, 0xff, 0xff, 0xf3, 0x4f, 0xff,
+    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf7, 0x2f,
+    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xf9,
+    0x1f, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
+    0xfa, 0xf, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
+    0xff, 0xfb, 0xd, 0xff, 0xff, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xff, 0xfa, 0xa, 0xff, 0xff, 0xfc, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xa, 0xff, 0xff, 0xfa, 0x7, 0xff, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xff, 0xf8, 0x3, 0xff, 0xff,
+    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xe, 0xff, 0xff, 0xf5, 0x0, 0xff,
+    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf2, 0x0,
+    0xaf, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xe0,
+    0x0, 0x4f, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff,
+    0x90, 0x0, 0xe, 0xff, 0xff, 0xfd, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
+    0xff, 0x20, 0x0, 0x6, 0xff, 0xff, 0xff, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
+    0xff, 0xfb, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
+    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xef,
+    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x3f, 0xff,
+    0xff, 0xff, 0xc3, 0x0, 0x0, 0x0, 0x0, 0x6f,
+    0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0xff, 0xff, 0xff, 0xb6, 0x21, 0x13, 0x7d,
+    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xd1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfc, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2c, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4c, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xa2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x26, 0xad, 0xef, 0xfe, 0xc9, 0x61, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+    /* U+0037 "7" */
+    0x9e, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xab, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfc, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xcb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfc, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
+    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e,
+    0xff, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xe, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3f, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xaf, 0xff, 0xff, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2f, 0xff, 0xff, 0xfa, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xf4, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xfd, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0x70,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xf1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
+    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff,
+    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
+    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
+    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
+    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
+    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1f, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xff, 0xff, 0xf0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0xff, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xfb, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x58, 0x88, 0x88, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0,
+    /* U+0038 "8" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x59, 0xcd,
+    0xff, 0xed, 0xb7, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xaf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfd, 0x60, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0xff, 0xff, 0xff, 0xfe, 0x83, 0x11, 0x25, 0xaf,
+    0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x2, 0xdf, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
+    0x0, 0xef, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0x70, 0x0,
+    0x0, 0x5, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xef, 0xff, 0xff, 0xe0,
+    0x0, 0x0, 0xa, 0xff, 0xff, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff,
+    0xf3, 0x0, 0x0, 0xe, 0xff, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
+    0xff, 0xf8, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xff, 0xfa, 0x0, 0x0, 0x1f, 0xff, 0xff,
+    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x1f, 0xff,
+    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0xff, 0xfc, 0x0, 0x0, 0xf,
+    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xa, 0xff, 0xff, 0xfb, 0x0, 0x0,
+    0xd, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xf8, 0x0,
+    0x0, 0x9, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xf5,
+    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff,
+    0xe0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xf4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
+    0xff, 0x70, 0x0, 0x0, 0x0, 0x1d, 0xff, 0xff,
+    0xff, 0x70, 0x0, 0x0, 0x0, 0x1, 0xbf, 0xff,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x2, 0xdf,
+    0xff, 0xff, 0xfd, 0x73, 0x10, 0x14, 0x9f, 0xff,
+    0xff, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3b, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfd, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4a, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xd3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4d, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff,
+    0xfa, 0x52, 0x10, 0x13, 0x8d, 0xff, 0xff, 0xff,
+    0xfd, 0x10, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff,
+    0xfa, 0x10, 0x0, 0x0, 0x0, 0x0, 0x5e, 0xff,
+    0xff, 0xff, 0xd0, 0x0, 0x0, 0x4f, 0xff, 0xff,
+    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xcf, 0xff, 0xff, 0xfa, 0x0, 0x0, 0xdf, 0xff,
+    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0xff, 0xff, 0xff, 0x40, 0x4, 0xff,
+    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xb0, 0x9,
+    0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf2,
+    0xd, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
+    0xf6, 0xf, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
+    0xff, 0xfa, 0x1f, 0xff, 0xff, 0xf4, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xff, 0xfc, 0x2f, 0xff, 0xff, 0xf3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xff, 0xfd, 0x1f, 0xff, 0xff, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xff, 0xfd, 0xf, 0xff, 0xff,
+    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0xff, 0xfc, 0xe, 0xff,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfa, 0xb,
+    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf7,
+    0x7, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
+    0xf3, 0x1, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xff,
+    0xff, 0xd0, 0x0, 0xaf, 0xff, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
+    0xff, 0xff, 0x60, 0x0, 0x2f, 0xff, 0xff, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xff, 0xff, 0xfd, 0x0, 0x0, 0x7, 0xff, 0xff,
+    0xff, 0xfc, 0x30, 0x0, 0x0, 0x0, 0x0, 0x4d,
+    0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0xaf,
+    0xff, 0xff, 0xff, 0xfc, 0x73, 0x11, 0x23, 0x7c,
+    0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xef, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xc2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xdf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xb4, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0x7a, 0xce, 0xff, 0xfe, 0xc9, 0x61, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+    /* U+0039 "9" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x7b, 0xdf,
+    0xff, 0xdb, 0x84, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xdf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xe8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x5f,
+    0xff, 0xff, 0xff, 0xfe, 0x94, 0x21, 0x35, 0xaf,
+    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x2,
+    0xff, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
+    0x2, 0xbf, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0x50, 0x0,
+    0x0, 0x4f, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xe0,
+    0x0, 0x0, 0xbf, 0xff, 0xff, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff,
+    0xf6, 0x0, 0x1, 0xff, 0xff, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0xff, 0xfe, 0x0, 0x6, 0xff, 0xff, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0xff, 0xff, 0x40, 0xa, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xff, 0xff, 0x90, 0xd, 0xff, 0xff,
+    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5f, 0xff, 0xff, 0xd0, 0xf, 0xff,
+    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0, 0xf,
+    0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf3,
+    0x1f, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
+    0xf6, 0x1f, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
+    0xff, 0xf8, 0xf, 0xff, 0xff, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
+    0xff, 0xff, 0xf9, 0xf, 0xff, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xff, 0xff, 0xfb, 0xd, 0xff, 0xff, 0xfa,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xff, 0xfc, 0x9, 0xff, 0xff,
+    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xbf, 0xff, 0xff, 0xfc, 0x5, 0xff,
+    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xfd, 0x1,
+    0xff, 0xff, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xfd,
+    0x0, 0xaf, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff,
+    0xfd, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xa0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff,
+    0xff, 0xfd, 0x0, 0xa, 0xff, 0xff, 0xff, 0xfc,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
+    0xff, 0xff, 0xfc, 0x0, 0x1, 0xef, 0xff, 0xff,
+    0xff, 0xfb, 0x62, 0x10, 0x14, 0x8e, 0xff, 0xff,
+    0xf8, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x2f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x64, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x3,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf7, 0x5, 0xff, 0xff, 0xfa, 0x0, 0x0,
+    0x0, 0x2d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0x50, 0x6, 0xff, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xa1, 0x0, 0x7, 0xff, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x7c, 0xff, 0xff,
+    0xff, 0xfe, 0x82, 0x0, 0x0, 0xa, 0xff, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x13,
+    0x56, 0x54, 0x10, 0x0, 0x0, 0x0, 0xd, 0xff,
+    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xcf, 0xff, 0xff, 0x50, 0x0, 0x56,
+    0x89, 0xba, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0x0, 0x0,
+    0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xfb, 0x0,
+    0x0, 0xdf, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf4,
+    0x0, 0x0, 0x9f, 0xff, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff,
+    0xd0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf4, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
+    0xff, 0x50, 0x0, 0x0, 0xd, 0xff, 0xff, 0xfe,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xff, 0xfb, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
+    0xff, 0xe4, 0x0, 0x0, 0x0, 0x0, 0x1b, 0xff,
+    0xff, 0xff, 0xe2, 0x0, 0x0, 0x0, 0x0, 0xbf,
+    0xff, 0xff, 0xff, 0xb6, 0x21, 0x12, 0x5a, 0xff,
+    0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x1d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xa1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4b, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xb4, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x26,
+    0xad, 0xef, 0xfe, 0xc9, 0x61, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+    /* U+003A ":" */
+    0xaf, 0xff, 0xff, 0xf5, 0xaf, 0xff, 0xff, 0xf5,
+    0xaf, 0xff, 0xff, 0xf5, 0xaf, 0xff, 0xff, 0xf5,
+    0xaf, 0xff, 0xff, 0xf5, 0xaf, 0xff, 0xff, 0xf5,
+    0xaf, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xf5,
+    0xaf, 0xff, 0xff, 0xf5, 0xaf, 0xff, 0xff, 0xf5,
+    0xaf, 0xff, 0xff, 0xf5, 0xaf, 0xff, 0xff, 0xf5,
+    0xaf, 0xff, 0xff, 0xf5, 0xaf, 0xff, 0xff, 0xf5,
+    /* U+003B ";" */
+    0xc, 0xff, 0xff, 0xff, 0x30, 0xcf, 0xff, 0xff,
+    0xf3, 0xc, 0xff, 0xff, 0xff, 0x30, 0xcf, 0xff,
+    0xff, 0xf3, 0xc, 0xff, 0xff, 0xff, 0x30, 0xcf,
+    0xff, 0xff, 0xf3, 0xc, 0xff, 0xff, 0xff, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xf3, 0xc,
+    0xff, 0xff, 0xff, 0x30, 0xcf, 0xff, 0xff, 0xf3,
+    0xc, 0xff, 0xff, 0xff, 0x30, 0xcf, 0xff, 0xff,
+    0xf3, 0xc, 0xff, 0xff, 0xff, 0x30, 0xcf, 0xff,
+    0xff, 0xf3, 0x0, 0x0, 0x5f, 0xff, 0x30, 0x0,
+    0x6, 0xff, 0xf2, 0x0, 0x0, 0x9f, 0xff, 0x0,
+    0x0, 0xd, 0xff, 0xd0, 0x0, 0x3, 0xff, 0xf9,
+    0x0, 0x0, 0xcf, 0xff, 0x30, 0x2, 0xcf, 0xff,
+    0xa0, 0x0, 0xef, 0xff, 0xd1, 0x0, 0x6, 0xff,
+    0xb1, 0x0, 0x0, 0x9, 0x50, 0x0, 0x0,
+    /* U+003C "<" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x7e, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3a, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xcf, 0xff, 0xff, 0xf0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x8e, 0xff, 0xff, 0xff, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xdf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0x9f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x93, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5b, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xd6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x17, 0xef, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfa, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xaf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfd, 0x71, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5c, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xb4, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x18, 0xef, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xe8, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xaf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfb, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0x92, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xc6, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2f, 0xff, 0xff, 0xff, 0xf9, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xfe,
+    0x81, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfa, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xdf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x93, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0x9f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfc, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xdf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xb4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0x9f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0x71, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xdf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xd6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0x8e, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xdf,
+    0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3a, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x8e, 0xff, 0xff, 0xf0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xcf,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3a, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x0,
+    /* U+003D "=" */
+    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x1b, 0xbb, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff,
+    /* U+003E ">" */
+    0x13, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xfd, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2f, 0xff, 0xf9, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff,
+    0xb4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
+    0xff, 0xff, 0xfd, 0x71, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xc5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xaf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0x81, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x17, 0xef,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xd6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0x8e, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x92, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xcf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x29, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xd7, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6d, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x93, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xaf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x17, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4a, 0xff, 0xff, 0xff,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x9f,
+    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5c,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x18,
+    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x81,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x39, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0x8e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0x81, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xc5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x17, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfa, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0x71, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xc5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
+    0xff, 0xf9, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
+    0xff, 0xfd, 0x71, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2f, 0xff, 0xb4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xf9, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0,
+    /* U+003F "?" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x26, 0xac, 0xdf,
+    0xfe, 0xdc, 0x95, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xdf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xb4, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3e, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
+    0xfd, 0x73, 0x21, 0x24, 0x8e, 0xff, 0xff, 0xff,
+    0xff, 0x60, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff,
+    0xe5, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
+    0xff, 0xff, 0x30, 0x0, 0xc, 0xff, 0xff, 0xff,
+    0xd1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xef,
+    0xff, 0xff, 0xfc, 0x0, 0x4, 0xff, 0xff, 0xff,
+    0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xef, 0xff, 0xff, 0xf5, 0x0, 0xaf, 0xff, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xff, 0xff, 0xff, 0xb0, 0x1f, 0xff, 0xff,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xff, 0xff, 0x5, 0xff, 0xff,
+    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5f, 0xff, 0xff, 0xf3, 0x8f, 0xff,
+    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0x5b, 0xff,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf6, 0x7a,
+    0xce, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x50,
+    0x0, 0x0, 0x11, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
+    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
+    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
+    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
+    0xff, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
+    0xff, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
+    0xff, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
+    0xff, 0xc1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
+    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff,
+    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
+    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
+    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
+    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xe, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xef, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9, 0xaa, 0xaa, 0xa0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+    /* U+0040 "@" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x25, 0x8a, 0xcd,
+    0xee, 0xfe, 0xdd, 0xca, 0x74, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x16, 0xbf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x94,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5b, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xe8, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6e, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfa, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4d, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1a, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfc, 0x96, 0x32, 0x10, 0x1, 0x12,
+    0x47, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xef, 0xff, 0xff,
+    0xff, 0xff, 0xa5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x27, 0xdf, 0xff, 0xff, 0xff,
+    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff,
+    0xff, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xaf, 0xff,
+    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
+    0xff, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xcf, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
+    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xef, 0xff, 0xff, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
+    0xff, 0xff, 0xe4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2d, 0xff, 0xff, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
+    0xff, 0xff, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff,
+    0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
+    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xcf, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xff, 0xff, 0xd1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0x8c, 0xef, 0xec, 0x94,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0xff, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xdf, 0xff, 0xff, 0xff,
+    0xff, 0xc4, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf0,
+    0x0, 0x0, 0x6, 0xff, 0xff, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xff, 0xff, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xdf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x90, 0x0, 0x4f, 0xff, 0xff,
+    0xd0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xfd, 0x0,
+    0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x8f, 0xff,
+    0xff, 0x90, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0xbf,
+    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0xd, 0xff,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0xef, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff,
+    0xff, 0xd7, 0x31, 0x23, 0x8e, 0xff, 0xff, 0xf5,
+    0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xff, 0xe0, 0x0, 0x0, 0x4, 0xff, 0xff,
+    0xf1, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
+    0xff, 0xf7, 0x0, 0x0, 0x0, 0x1, 0xaf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xff, 0xff, 0xf2, 0x0, 0x0, 0xa, 0xff,
+    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
+    0xff, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0xf5, 0x0, 0x0, 0x1f,
+    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x1, 0xef,
+    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xbf, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xff, 0xf8, 0x0, 0x0,
+    0x6f, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xfa, 0x0,
+    0x0, 0xaf, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xf1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xfb,
+    0x0, 0x0, 0xef, 0xff, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
+    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
+    0xfc, 0x0, 0x3, 0xff, 0xff, 0xd0, 0x0, 0x0,
+    0x0, 0x2, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
+    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xff, 0xfd, 0x0, 0x6, 0xff, 0xff, 0xa0, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
+    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xff, 0xfd, 0x0, 0x9, 0xff, 0xff, 0x70,
+    0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5f, 0xff, 0xfc, 0x0, 0xc, 0xff, 0xff,
+    0x40, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xfb, 0x0, 0xe, 0xff,
+    0xff, 0x10, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
+    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xff, 0xf8, 0x0, 0xf,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
+    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0xff, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xf6, 0x0,
+    0x1f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xef,
+    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xf2,
+    0x0, 0x1f, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
+    0xe0, 0x0, 0x2f, 0xff, 0xfd, 0x0, 0x0, 0x0,
+    0x1, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff,
+    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
+    0xff, 0x90, 0x0, 0x2f, 0xff, 0xfe, 0x0, 0x0,
+    0x0, 0x2, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
+    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xff, 0xff, 0x40, 0x0, 0x2f, 0xff, 0xff, 0x0,
+    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
+    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xcf, 0xff, 0xfd, 0x0, 0x0, 0x1f, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xff, 0xff, 0xf6, 0x0, 0x0, 0xf, 0xff,
+    0xff, 0x10, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x1e, 0xff, 0xff, 0xe0, 0x0, 0x0, 0xe,
+    0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0xdf, 0xff,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xbf, 0xff, 0xff, 0x50, 0x0, 0x0,
+    0xc, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x9f,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xbf, 0xff, 0xff, 0xfa, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xff, 0xfb, 0x0, 0x0,
+    0x0, 0x9, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
+    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xe1, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0xe, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xf4,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0x40,
+    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf1, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff,
+    0xf4, 0x0, 0x0, 0x2, 0xcf, 0xff, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x1, 0xef, 0xff, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x2, 0xcf, 0xff, 0xff, 0xff,
+    0xff, 0xfb, 0x0, 0x1, 0x8f, 0xff, 0xff, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
+    0xff, 0xc5, 0x10, 0x15, 0xaf, 0xff, 0xff, 0xcf,
+    0xff, 0xff, 0xff, 0xea, 0xbf, 0xff, 0xff, 0xff,
+    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
+    0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0xb, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xe, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x1,
+    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x80, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x1b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xe4, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfa, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xff, 0xff, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6e, 0xff, 0xff, 0xff, 0xff,
+    0xf9, 0x10, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xff,
+    0xff, 0xfb, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5a, 0xef, 0xff,
+    0xc7, 0x10, 0x0, 0x0, 0x0, 0x5, 0xae, 0xff,
+    0xfd, 0xb6, 0x20, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0xbb, 0xbb, 0xb3, 0x0, 0x0, 0x2f, 0xff, 0xff,
+    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x7, 0xff,
+    0xff, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
+    0xcf, 0xff, 0xff, 0xe2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x1e, 0xff, 0xff, 0xfe, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xcf, 0xff, 0xff, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff,
+    0xc3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xc1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
+    0xff, 0xff, 0xb3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4d, 0xff, 0xff, 0xff, 0xfc, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3e,
+    0xff, 0xff, 0xff, 0xff, 0xc6, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6d, 0xff, 0xff, 0xff, 0xff, 0x90,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x73,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x15, 0xae, 0xff, 0xff, 0xff, 0xff, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xef, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfb, 0x97, 0x53, 0x21, 0x10, 0x12, 0x33,
+    0x68, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x19, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x59, 0xdf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xb6,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x36, 0x8a,
+    0xcd, 0xef, 0xff, 0xfe, 0xed, 0xb9, 0x85, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+    /* U+0041 "A" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xd, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xff, 0xff, 0xf5, 0xff, 0xff, 0xfe, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xff, 0xf0, 0xcf, 0xff, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2f, 0xff, 0xff, 0xc0, 0x7f, 0xff, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xff, 0xff, 0x80, 0x1f, 0xff, 0xff, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0xff, 0x40, 0xc, 0xff, 0xff, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0xff, 0xfe, 0x0, 0x6, 0xff, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0xff, 0xff, 0xfa, 0x0, 0x1, 0xff, 0xff, 0xff,
+    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
+    0xff, 0xff, 0xf4, 0x0, 0x0, 0xbf, 0xff, 0xff,
+    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0xff, 0xf0, 0x0, 0x0, 0x5f, 0xff, 0xff,
+    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
+    0xff, 0xff, 0xa0, 0x0, 0x0, 0xe, 0xff, 0xff,
+    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0xff, 0xff, 0x40, 0x0, 0x0, 0x9, 0xff, 0xff,
+    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xff, 0xfd, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
+    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
+    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
+    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
+    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
+    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
+    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff,
+    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
+    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
+    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
+    0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff,
+    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
+    0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xfa,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0xdf, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xf4, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xe0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1f, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0,
+    0x0, 0x0, 0x1f, 0xff, 0xff, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0xff, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xff, 0xf6, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0xff, 0xf1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x40, 0x0,
+    0x0, 0x3, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xb0, 0x0,
+    0x0, 0x9, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xf2, 0x0,
+    0x0, 0xf, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xf8, 0x0,
+    0x0, 0x6f, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xfe, 0x0,
+    0x0, 0xcf, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0x50,
+    0x2, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xc0,
+    0x8, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xf2,
+    0xe, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xf9,
+    /* U+0042 "B" */
+    0xce, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xed, 0xdc, 0xb9, 0x63, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xe9, 0x30, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfa, 0x10, 0x0, 0x0,
+    0x0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xe3, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0xef,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe1,
+    0x0, 0x0, 0xef, 0xff, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x13, 0x57, 0xbf, 0xff,
+    0xff, 0xff, 0xfa, 0x0, 0x0, 0xef, 0xff, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xcf, 0xff, 0xff, 0xff, 0x30, 0x0,
+    0xef, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
+    0xff, 0xa0, 0x0, 0xef, 0xff, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xff, 0xff, 0xff, 0xf0, 0x0, 0xef, 0xff,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xf4,
+    0x0, 0xef, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xff, 0xff, 0xf6, 0x0, 0xef, 0xff, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1f, 0xff, 0xff, 0xf8, 0x0, 0xef,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
+    0xf7, 0x0, 0xef, 0xff, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0xff, 0xf6, 0x0, 0xef, 0xff, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf2, 0x0,
+    0xef, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xff, 0xe0, 0x0, 0xef, 0xff, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xef, 0xff, 0xff, 0x70, 0x0, 0xef, 0xff,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfe, 0x0,
+    0x0, 0xef, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xcf, 0xff,
+    0xff, 0xf4, 0x0, 0x0, 0xef, 0xff, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x12, 0x47,
+    0xcf, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0xef,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfd, 0x30, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xe4, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5,
+    0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xc2, 0x0, 0x0, 0xef, 0xff,
+    0xff, 0xfe, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x30,
+    0x0, 0xef, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x14, 0x6b, 0xff, 0xff,
+    0xff, 0xff, 0xe2, 0x0, 0xef, 0xff, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x19, 0xff, 0xff, 0xff, 0xfd, 0x0, 0xef,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff,
+    0xff, 0x70, 0xef, 0xff, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xff, 0xff, 0xe0, 0xef, 0xff, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xf5,
+    0xef, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
+    0xff, 0xff, 0xf9, 0xef, 0xff, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2f, 0xff, 0xff, 0xfc, 0xef, 0xff,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
+    0xfe, 0xef, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xe, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xfe, 0xef,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
+    0xff, 0xfd, 0xef, 0xff, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xff, 0xfa, 0xef, 0xff, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xf6,
+    0xef, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xff, 0xff, 0xf1, 0xef, 0xff, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xff, 0xff, 0xff, 0xb0, 0xef, 0xff,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff,
+    0x30, 0xef, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x59, 0xef, 0xff,
+    0xff, 0xff, 0xfa, 0x0, 0xef, 0xff, 0xff, 0xfe,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xe1, 0x0, 0xef,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0x20, 0x0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xd2, 0x0, 0x0, 0xef, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0x10,
+    0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0xa8,
+    0x51, 0x0, 0x0, 0x0, 0x0, 0x0,
+    /* U+0043 "C" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0x67, 0x89, 0xa9, 0x76, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x27, 0xcf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x82, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xcf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x91, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xaf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xe3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xef, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xc8, 0x52, 0x10, 0x1, 0x36, 0x9f, 0xff, 0xff,
+    0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6, 0xef, 0xff, 0xff,
+    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef,
+    0xff, 0xff, 0xff, 0xb1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xaf, 0xff, 0xff, 0xff,
+    0xd0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
+    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0x10, 0x0,
+    0x0, 0x2f, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xdf, 0xff, 0xff, 0xfa, 0x0, 0x0, 0xa,
+    0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0xff, 0xff, 0xf1, 0x0, 0x1, 0xff, 0xff,
+    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
+    0xff, 0xff, 0x60, 0x0, 0x8f, 0xff, 0xff, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff,
+    0xfb, 0x0, 0xe, 0xff, 0xff, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xef, 0xeb, 0x73, 0x0,
+    0x3, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0x20, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
+    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xf0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1f, 0xff, 0xff, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
+    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
+    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
+    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xe, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
+    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0xc8, 0x40, 0x0, 0x2f, 0xff, 0xff, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
+    0xff, 0xf8, 0x0, 0xdf, 0xff, 0xff, 0xf1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff,
+    0x60, 0x7, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf1, 0x0,
+    0x2f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xff, 0xff, 0xfb, 0x0, 0x0, 0xbf,
+    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
+    0xff, 0xff, 0xff, 0x50, 0x0, 0x3, 0xff, 0xff,
+    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
+    0xff, 0xd0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff,
+    0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xf5,
+    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xd2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0xbf, 0xff, 0xff, 0xff, 0xfb, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4d, 0xff, 0xff,
+    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xcf, 0xff, 0xff, 0xff, 0xff, 0xc7, 0x20, 0x0,
+    0x0, 0x0, 0x26, 0xdf, 0xff, 0xff, 0xff, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xba, 0xbc,
+    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x19, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x7c, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfd, 0x71, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x58, 0xad, 0xde, 0xff,
+    0xfe, 0xc9, 0x62, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+    /* U+0044 "D" */
+    0x8e, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xed, 0xdc, 0xba, 0x85, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0x93, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xc4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfd, 0x20, 0x0, 0x0,
+    0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xe2, 0x0, 0x0, 0x0, 0x9f, 0xff,
+    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x12, 0x36, 0x9d, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0x10, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3b, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
+    0x9f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
+    0xff, 0xff, 0xf9, 0x0, 0x0, 0x9f, 0xff, 0xff,
+    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xef, 0xff, 0xff, 0xff,
+    0x30, 0x0, 0x9f, 0xff, 0xff, 0xf0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3f, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x9f,
+    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
+    0xff, 0xff, 0xf3, 0x0, 0x9f, 0xff, 0xff, 0xf0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xfa,
+    0x0, 0x9f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3f, 0xff, 0xff, 0xff, 0x10, 0x9f, 0xff,
+    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
+    0xff, 0xff, 0x50, 0x9f, 0xff, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xa0,
+    0x9f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xff, 0xe0, 0x9f, 0xff, 0xff,
+    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
+    0xff, 0xf1, 0x9f, 0xff, 0xff, 0xf0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xf5, 0x9f,
+    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xff, 0xff, 0xf7, 0x9f, 0xff, 0xff, 0xf0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
+    0xf9, 0x9f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2f, 0xff, 0xff, 0xfb, 0x9f, 0xff,
+    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
+    0xff, 0xff, 0xfb, 0x9f, 0xff, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xfc,
+    0x9f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xf, 0xff, 0xff, 0xfd, 0x9f, 0xff, 0xff,
+    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
+    0xff, 0xfc, 0x9f, 0xff, 0xff, 0xf0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xfc, 0x9f,
+    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xff, 0xff, 0xfb, 0x9f, 0xff, 0xff, 0xf0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
+    0xfa, 0x9f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xff, 0xff, 0xf8, 0x9f, 0xff,
+    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0xff, 0xf6, 0x9f, 0xff, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xf4,
+    0x9f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xdf, 0xff, 0xff, 0xf1, 0x9f, 0xff, 0xff,
+    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
+    0xff, 0xd0, 0x9f, 0xff, 0xff, 0xf0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0x90, 0x9f,
+    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0xff, 0xff, 0xff, 0x40, 0x9f, 0xff, 0xff, 0xf0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xfe,
+    0x0, 0x9f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xbf, 0xff, 0xff, 0xf8, 0x0, 0x9f, 0xff,
+    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
+    0xff, 0xf2, 0x0, 0x9f, 0xff, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2e, 0xff, 0xff, 0xff, 0xa0, 0x0,
+    0x9f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf,
+    0xff, 0xff, 0xff, 0x20, 0x0, 0x9f, 0xff, 0xff,
+    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3e, 0xff, 0xff, 0xff, 0xf7,
+    0x0, 0x0, 0x9f, 0xff, 0xff, 0xf0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3a,
+    0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x9f,
+    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x25, 0x8d, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0x10, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xfe,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xe2, 0x0, 0x0,
+    0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x9f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0,
+    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xc3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x93, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0xcb, 0x85, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+    /* U+0045 "E" */
+    0x6e, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xa0, 0x7f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x7f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xc0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xc0, 0x7f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x7f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xc0, 0x7f, 0xff, 0xff, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
+    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xff, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
+    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0xff, 0xfe, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xc0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xe0, 0x0, 0x7f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0,
+    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xe0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x7f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
+    0x0, 0x7f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xff, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
+    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xff, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
+    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0x7f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    /* U+0046 "F" */
+    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf8, 0x4f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x84, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x4f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x84,
+    0xff, 0xff, 0xff, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xe7, 0x4f, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0x60, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
+    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xff, 0xff, 0xf6, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0x60,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
+    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
+    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff,
+    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
+    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0xff, 0xff, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xec, 0x0,
+    0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xe0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xe0, 0x0, 0x4, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x4f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0,
+    0x4, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xff, 0xff, 0xf6, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0x60,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
+    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
+    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff,
+    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
+    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0x60, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
+    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xff, 0xff, 0xf6, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0x60,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
+    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
+    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0x88, 0x88, 0x88, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+    /* U+0047 "G" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x25, 0x78, 0x9a, 0xa9, 0x86, 0x41,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x38, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xd9, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7e,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3d, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfc, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xe2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff,
+    0xff, 0xfd, 0x96, 0x31, 0x0, 0x1, 0x35, 0x9e,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xff,
+    0xf9, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4b, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xfa,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4d, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0x10, 0x0,
+    0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0xf3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf1, 0x0,
+    0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf7, 0x0,
+    0x0, 0x8, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xfc, 0x0,
+    0x0, 0xe, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0x10,
+    0x0, 0x5f, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xd8, 0x10,
+    0x0, 0xbf, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xba, 0x51, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xd, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2f, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2f, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
+    0x3f, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
+    0x2f, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
+    0x1f, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
+    0xf, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
+    0xd, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xdd, 0xdd, 0xdd,
+    0xdd, 0xdd, 0xdd, 0xdd, 0xef, 0xff, 0xff, 0xf1,
+    0xa, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xf1,
+    0x7, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xf1,
+    0x3, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xf1,
+    0x0, 0xef, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xf1,
+    0x0, 0x9f, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xf1,
+    0x0, 0x2f, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xf1,
+    0x0, 0xb, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xf1,
+    0x0, 0x4, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xf1,
+    0x0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xf1,
+    0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xe3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xef, 0xff, 0xff, 0xf1,
+    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0x60,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x9f, 0xff, 0xff, 0xff, 0xf1,
+    0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xfc,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xf1,
+    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0xff,
+    0xfb, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xb7, 0x41, 0x0, 0x0, 0x14, 0x7a,
+    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5e, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0x60, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x9f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x8f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfd, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xd8, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0x69, 0xcd, 0xef, 0xff, 0xed, 0xa8,
+    0x51, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    /* U+0048 "H" */
+    0x5f, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xa, 0xff, 0xff, 0xfd, 0x6f, 0xff, 0xff, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfe,
+    0x6f, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xff, 0xfe, 0x6f, 0xff, 0xff, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfe,
+    0x6f, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xff, 0xfe, 0x6f, 0xff, 0xff, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfe,
+    0x6f, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xff, 0xfe, 0x6f, 0xff, 0xff, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfe,
+    0x6f, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xff, 0xfe, 0x6f, 0xff, 0xff, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfe,
+    0x6f, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xff, 0xfe, 0x6f, 0xff, 0xff, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfe,
+    0x6f, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xff, 0xfe, 0x6f, 0xff, 0xff, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfe,
+    0x6f, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xff, 0xfe, 0x6f, 0xff, 0xff, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfe,
+    0x6f, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xff, 0xfe, 0x6f, 0xff, 0xff, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfe,
+    0x6f, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xff, 0xfe, 0x6f, 0xff, 0xff, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfe,
+    0x6f, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xff, 0xfe, 0x6f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0x6f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0x6f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0x6f, 0xff, 0xff, 0xfe, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xef, 0xff, 0xff, 0xfe, 0x6f, 0xff, 0xff, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfe,
+    0x6f, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xff, 0xfe, 0x6f, 0xff, 0xff, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfe,
+    0x6f, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xff, 0xfe, 0x6f, 0xff, 0xff, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfe,
+    0x6f, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xff, 0xfe, 0x6f, 0xff, 0xff, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfe,
+    0x6f, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xff, 0xfe, 0x6f, 0xff, 0xff, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfe,
+    0x6f, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xff, 0xfe, 0x6f, 0xff, 0xff, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfe,
+    0x6f, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xff, 0xfe, 0x6f, 0xff, 0xff, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfe,
+    0x6f, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xff, 0xfe, 0x6f, 0xff, 0xff, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfe,
+    0x6f, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xff, 0xfe, 0x6f, 0xff, 0xff, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfe,
+    0x6f, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xff, 0xfe, 0x6f, 0xff, 0xff, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfe,
+    0x6f, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xff, 0xfe, 0x6f, 0xff, 0xff, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfe,
+    0x6f, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xff, 0xfe, 0x6f, 0xff, 0xff, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfe,
+    /* U+0049 "I" */
+    0x7f, 0xff, 0xff, 0xf2, 0x7f, 0xff, 0xff, 0xf2,
+    0x7f, 0xff, 0xff, 0xf2, 0x7f, 0xff, 0xff, 0xf2,
+    0x7f, 0xff, 0xff, 0xf2, 0x7f, 0xff, 0xff, 0xf2,
+    0x7f, 0xff, 0xff, 0xf2, 0x7f, 0xff, 0xff, 0xf2,
+    0x7f, 0xff, 0xff, 0xf2, 0x7f, 0xff, 0xff, 0xf2,
+    0x7f, 0xff, 0xff, 0xf2, 0x7f, 0xff, 0xff, 0xf2,
+    0x7f, 0xff, 0xff, 0xf2, 0x7f, 0xff, 0xff, 0xf2,
+    0x7f, 0xff, 0xff, 0xf2, 0x7f, 0xff, 0xff, 0xf2,
+    0x7f, 0xff, 0xff, 0xf2, 0x7f, 0xff, 0xff, 0xf2,
+    0x7f, 0xff, 0xff, 0xf2, 0x7f, 0xff, 0xff, 0xf2,
+    0x7f, 0xff, 0xff, 0xf2, 0x7f, 0xff, 0xff, 0xf2,
+    0x7f, 0xff, 0xff, 0xf2, 0x7f, 0xff, 0xff, 0xf2,
+    0x7f, 0xff, 0xff, 0xf2, 0x7f, 0xff, 0xff, 0xf2,
+    0x7f, 0xff, 0xff, 0xf2, 0x7f, 0xff, 0xff, 0xf2,
+    0x7f, 0xff, 0xff, 0xf2, 0x7f, 0xff, 0xff, 0xf2,
+    0x7f, 0xff, 0xff, 0xf2, 0x7f, 0xff, 0xff, 0xf2,
+    0x7f, 0xff, 0xff, 0xf2, 0x7f, 0xff, 0xff, 0xf2,
+    0x7f, 0xff, 0xff, 0xf2, 0x7f, 0xff, 0xff, 0xf2,
+    0x7f, 0xff, 0xff, 0xf2, 0x7f, 0xff, 0xff, 0xf2,
+    0x7f, 0xff, 0xff, 0xf2, 0x7f, 0xff, 0xff, 0xf2,
+    0x7f, 0xff, 0xff, 0xf2, 0x7f, 0xff, 0xff, 0xf2,
+    0x7f, 0xff, 0xff, 0xf2, 0x7f, 0xff, 0xff, 0xf2,
+    0x7f, 0xff, 0xff, 0xf2, 0x7f, 0xff, 0xff, 0xf2,
+    0x7f, 0xff, 0xff, 0xf2, 0x7f, 0xff, 0xff, 0xf2,
+    0x7f, 0xff, 0xff, 0xf2, 0x7f, 0xff, 0xff, 0xf2,
+    /* U+004A "J" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1f, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
+    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf9, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
+    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
+    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0x90,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1f, 0xff, 0xff, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
+    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
+    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1f, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
+    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf9, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
+    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
+    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0x90,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1f, 0xff, 0xff, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
+    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
+    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1f, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0xff, 0xff, 0x80, 0x24, 0x68, 0xad, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
+    0xff, 0xf8, 0xf, 0xff, 0xff, 0xf1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
+    0x70, 0xef, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf6, 0xd,
+    0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xff, 0xff, 0x50, 0xcf, 0xff,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xff, 0xff, 0xf3, 0x9, 0xff, 0xff, 0xfd,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
+    0xff, 0xff, 0x0, 0x6f, 0xff, 0xff, 0xf3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
+    0xd0, 0x2, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xf8, 0x0,
+    0xc, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0xff, 0xff, 0xff, 0x20, 0x0, 0x6f,
+    0xff, 0xff, 0xff, 0xe6, 0x20, 0x0, 0x27, 0xef,
+    0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0xdf, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf3, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xef, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0x81, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0x8c, 0xde, 0xff, 0xeb, 0x84, 0x0,
+    0x0, 0x0, 0x0, 0x0,
+    /* U+004B "K" */
+    0xdf, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xff, 0xff, 0xfe, 0x30, 0xef, 0xff, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff,
+    0xe3, 0x0, 0xef, 0xff, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0xff, 0xff, 0xff, 0xfe, 0x20, 0x0, 0xef,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff,
+    0xff, 0xe2, 0x0, 0x0, 0xef, 0xff, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0xff, 0xff, 0xff, 0xfe, 0x20, 0x0,
+    0x0, 0xef, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
+    0xff, 0xff, 0xd1, 0x0, 0x0, 0x0, 0xef, 0xff,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0xfd, 0x10,
+    0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
+    0xff, 0xff, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0xfc,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xcf, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xef, 0xff, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff,
+    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xcf, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
+    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xef, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xcf, 0xff, 0xff, 0xff, 0xa0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xff,
+    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x1, 0xcf, 0xff, 0xff, 0xff, 0x90,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x1c,
+    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff,
+    0xc0, 0x0, 0x0, 0x1, 0xcf, 0xff, 0xff, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xef, 0xff, 0xff, 0xc0, 0x0, 0x0,
+    0x1c, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
+    0xff, 0xff, 0xc0, 0x0, 0x1, 0xcf, 0xff, 0xff,
+    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xc0,
+    0x0, 0x1c, 0xff, 0xff, 0xff, 0xfd, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xef, 0xff, 0xff, 0xc0, 0x1, 0xdf, 0xff,
+    0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
+    0xff, 0xc0, 0x1d, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xc1, 0xdf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0xff, 0xdd, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x37, 0xff, 0xff, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xe3, 0x0, 0xcf, 0xff, 0xff, 0xff, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0x30, 0x0, 0x2f,
+    0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xff,
+    0xff, 0xe2, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff,
+    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xef, 0xff, 0xff, 0xff, 0xfe, 0x20, 0x0,
+    0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0x60, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
+    0xff, 0xff, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x1e,
+    0xff, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xfd, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff,
+    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
+    0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xef, 0xff, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff,
+    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xef, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xff, 0xff,
+    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xe1, 0x0,
+    0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xf4, 0x0,
+    0x0, 0x0, 0xef, 0xff, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xff, 0xff, 0xfe, 0x10, 0x0, 0x0, 0xef,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff,
+    0xff, 0xb0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xf7, 0x0,
+    0x0, 0xef, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0xff, 0xff, 0xff, 0xff, 0x30, 0x0, 0xef, 0xff,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff,
+    0xff, 0xe1, 0x0, 0xef, 0xff, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1e, 0xff, 0xff, 0xff, 0xfb, 0x0,
+    0xef, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0xff, 0xff, 0xff, 0x60, 0xef, 0xff, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
+    0xff, 0xf3,
+    /* U+004C "L" */
+    0xef, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0xff, 0xfe, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe6,
+    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
+    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
+    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
+    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
+    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
+    /* U+004D "M" */
+    0xbf, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1e, 0xff, 0xff, 0xff, 0xff,
+    0xc, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xff,
+    0xf0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff,
+    0xff, 0xc, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
+    0xff, 0xf0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xfa,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xc, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff,
+    0xff, 0xff, 0xf0, 0xcf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xc, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf0, 0xcf, 0xff, 0xff, 0xaf,
+    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
+    0xfe, 0xff, 0xff, 0xff, 0xc, 0xff, 0xff, 0xf9,
+    0xbf, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
+    0xff, 0x8f, 0xff, 0xff, 0xf0, 0xcf, 0xff, 0xff,
+    0x96, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0xff, 0xd6, 0xff, 0xff, 0xff, 0xc, 0xff, 0xff,
+    0xf9, 0x1f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
+    0xff, 0xf7, 0x6f, 0xff, 0xff, 0xf0, 0xcf, 0xff,
+    0xff, 0x90, 0xbf, 0xff, 0xff, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xff, 0xff, 0x26, 0xff, 0xff, 0xff, 0xc, 0xff,
+    0xff, 0xf9, 0x5, 0xff, 0xff, 0xfa, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0xff, 0xc0, 0x6f, 0xff, 0xff, 0xf0, 0xcf,
+    0xff, 0xff, 0x90, 0xf, 0xff, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0xf6, 0x6, 0xff, 0xff, 0xff, 0xc,
+    0xff, 0xff, 0xf9, 0x0, 0xaf, 0xff, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xff, 0xff, 0x10, 0x6f, 0xff, 0xff, 0xf0,
+    0xcf, 0xff, 0xff, 0x90, 0x5, 0xff, 0xff, 0xfa,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9, 0xff, 0xff, 0xb0, 0x6, 0xff, 0xff, 0xff,
+    0xc, 0xff, 0xff, 0xf9, 0x0, 0xf, 0xff, 0xff,
+    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xef, 0xff, 0xf6, 0x0, 0x6f, 0xff, 0xff,
+    0xf0, 0xcf, 0xff, 0xff, 0x90, 0x0, 0xaf, 0xff,
+    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xff, 0xff, 0x10, 0x6, 0xff, 0xff,
+    0xff, 0xc, 0xff, 0xff, 0xf9, 0x0, 0x5, 0xff,
+    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9, 0xff, 0xff, 0xa0, 0x0, 0x6f, 0xff,
+    0xff, 0xf0, 0xcf, 0xff, 0xff, 0x90, 0x0, 0xf,
+    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xef, 0xff, 0xf5, 0x0, 0x6, 0xff,
+    0xff, 0xff, 0xc, 0xff, 0xff, 0xf9, 0x0, 0x0,
+    0xaf, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xff, 0xff, 0x0, 0x0, 0x6f,
+    0xff, 0xff, 0xf0, 0xcf, 0xff, 0xff, 0x90, 0x0,
+    0x4, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xa, 0xff, 0xff, 0xa0, 0x0, 0x6,
+    0xff, 0xff, 0xff, 0xc, 0xff, 0xff, 0xf9, 0x0,
+    0x0, 0xe, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0xff, 0xf4, 0x0, 0x0,
+    0x6f, 0xff, 0xff, 0xf0, 0xcf, 0xff, 0xff, 0x90,
+    0x0, 0x0, 0x9f, 0xff, 0xff, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xff, 0xfe, 0x0, 0x0,
+    0x6, 0xff, 0xff, 0xff, 0xc, 0xff, 0xff, 0xf9,
+    0x0, 0x0, 0x4, 0xff, 0xff, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0x90, 0x0,
+    0x0, 0x6f, 0xff, 0xff, 0xf0, 0xcf, 0xff, 0xff,
+    0x90, 0x0, 0x0, 0xe, 0xff, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xf3, 0x0,
+    0x0, 0x6, 0xff, 0xff, 0xff, 0xc, 0xff, 0xff,
+    0xf9, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xfe, 0x0,
+    0x0, 0x0, 0x6f, 0xff, 0xff, 0xf0, 0xcf, 0xff,
+    0xff, 0x90, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0x80,
+    0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xc, 0xff,
+    0xff, 0xf9, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff,
+    0xf1, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xf3,
+    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xf0, 0xcf,
+    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x9f, 0xff,
+    0xff, 0x60, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xfd,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xc,
+    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0xff, 0xfb, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xf0,
+    0xcf, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0xe,
+    0xff, 0xff, 0xf1, 0x0, 0x0, 0x1, 0xff, 0xff,
+    0xf2, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff,
+    0xc, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xff, 0xff, 0x60, 0x0, 0x0, 0x7f, 0xff,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
+    0xf0, 0xcf, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0xff, 0xfb, 0x0, 0x0, 0xc, 0xff,
+    0xff, 0x70, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
+    0xff, 0xc, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0xd, 0xff, 0xff, 0xf1, 0x0, 0x2, 0xff,
+    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
+    0xff, 0xf0, 0xcf, 0xff, 0xff, 0x90, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0xff, 0x60, 0x0, 0x7f,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
+    0xff, 0xff, 0xc, 0xff, 0xff, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xff, 0xff, 0xfb, 0x0, 0xd,
+    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x6f,
+    0xff, 0xff, 0xf0, 0xcf, 0xff, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xf1, 0x2,
+    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0xff, 0xff, 0xff, 0xc, 0xff, 0xff, 0xf9, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0x50,
+    0x7f, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xff, 0xff, 0xf0, 0xcf, 0xff, 0xff, 0x90,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xfb,
+    0xd, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0xff, 0xff, 0xc, 0xff, 0xff, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff,
+    0xf3, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0xff, 0xf0, 0xcf, 0xff, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xff, 0xcf, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xff, 0xff, 0xff, 0xc, 0xff, 0xff,
+    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xff, 0xff, 0xf0, 0xcf, 0xff,
+    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xc, 0xff,
+    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xf0, 0xcf,
+    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xc,
+    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xf0,
+    0xcf, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xff, 0xff, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff,
+    0xc, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
+    0xf0,
+    /* U+004E "N" */
+    0xaf, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xff, 0xfc, 0xaf, 0xff, 0xff, 0xff,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xfd,
+    0xaf, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xff, 0xfd, 0xaf, 0xff, 0xff, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xfd,
+    0xaf, 0xff, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xff, 0xfd, 0xaf, 0xff, 0xff, 0xff,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xfd,
+    0xaf, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xff, 0xfd, 0xaf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xfd,
+    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xff, 0xfd, 0xaf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xfd,
+    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xff, 0xfd, 0xaf, 0xff, 0xff, 0xbc,
+    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xfd,
+    0xaf, 0xff, 0xff, 0xb2, 0xff, 0xff, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xff, 0xfd, 0xaf, 0xff, 0xff, 0xb0,
+    0x7f, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xfd,
+    0xaf, 0xff, 0xff, 0xb0, 0xc, 0xff, 0xff, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xff, 0xfd, 0xaf, 0xff, 0xff, 0xb0,
+    0x2, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xfd,
+    0xaf, 0xff, 0xff, 0xb0, 0x0, 0x7f, 0xff, 0xff,
+    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xff, 0xfd, 0xaf, 0xff, 0xff, 0xb0,
+    0x0, 0xc, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xfd,
+    0xaf, 0xff, 0xff, 0xb0, 0x0, 0x2, 0xff, 0xff,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xff, 0xfd, 0xaf, 0xff, 0xff, 0xb0,
+    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xfd,
+    0xaf, 0xff, 0xff, 0xb0, 0x0, 0x0, 0xc, 0xff,
+    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xff, 0xfd, 0xaf, 0xff, 0xff, 0xb0,
+    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xfd,
+    0xaf, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xff, 0xfd, 0xaf, 0xff, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0xd0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xfd,
+    0xaf, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x2,
+    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xff, 0xfd, 0xaf, 0xff, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xfd,
+    0xaf, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xff, 0xfd, 0xaf, 0xff, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xfd,
+    0xaf, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0,
+    0x8, 0xff, 0xff, 0xfd, 0xaf, 0xff, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
+    0xff, 0xd0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xfd,
+    0xaf, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0,
+    0x8, 0xff, 0xff, 0xfd, 0xaf, 0xff, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
+    0xff, 0xff, 0x30, 0x0, 0x8, 0xff, 0xff, 0xfd,
+    0xaf, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xd0, 0x0,
+    0x8, 0xff, 0xff, 0xfd, 0xaf, 0xff, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
+    0xff, 0xff, 0xf9, 0x0, 0x8, 0xff, 0xff, 0xfd,
+    0xaf, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0x40,
+    0x8, 0xff, 0xff, 0xfd, 0xaf, 0xff, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xff, 0xff, 0xd0, 0x8, 0xff, 0xff, 0xfd,
+    0xaf, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xef, 0xff, 0xff, 0xf9,
+    0x8, 0xff, 0xff, 0xfd, 0xaf, 0xff, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xff, 0xff, 0xff, 0x48, 0xff, 0xff, 0xfd,
+    0xaf, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff,
+    0xe9, 0xff, 0xff, 0xfd, 0xaf, 0xff, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
+    0xaf, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfd, 0xaf, 0xff, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
+    0xaf, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xff,
+    0xff, 0xff, 0xff, 0xfd, 0xaf, 0xff, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xfd,
+    0xaf, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
+    0xff, 0xff, 0xff, 0xfd, 0xaf, 0xff, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xef, 0xff, 0xff, 0xff, 0xfd,
+    0xaf, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
+    0xff, 0xff, 0xff, 0xfd, 0xaf, 0xff, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xfd,
+    0xaf, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xef, 0xff, 0xff, 0xfd, 0xaf, 0xff, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xfd,
+    /* U+004F "O" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0x68, 0x9a, 0xa9, 0x87, 0x52, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x28, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xa5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x91, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3d,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xcf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef,
+    0xff, 0xff, 0xff, 0xff, 0xfa, 0x63, 0x10, 0x1,
+    0x24, 0x8c, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef,
+    0xff, 0xff, 0xff, 0xfd, 0x60, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0x8f, 0xff, 0xff, 0xff, 0xff,
+    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
+    0xff, 0xff, 0xff, 0xe6, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1a, 0xff, 0xff, 0xff,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
+    0xff, 0xff, 0xff, 0xc1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
+    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x5f,
+    0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0xff, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x1e,
+    0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x1,
+    0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0,
+    0x7f, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0x10, 0x0,
+    0xd, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xf7, 0x0,
+    0x2, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xd0,
+    0x0, 0x7f, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xff,
+    0x10, 0xb, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
+    0xf6, 0x0, 0xef, 0xff, 0xff, 0xe0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
+    0xff, 0x90, 0x1f, 0xff, 0xff, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
+    0xff, 0xfc, 0x4, 0xff, 0xff, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
+    0xff, 0xff, 0xf0, 0x5f, 0xff, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0xff, 0xff, 0xff, 0x17, 0xff, 0xff, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xff, 0xff, 0xf2, 0x8f, 0xff, 0xff, 0xf4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9, 0xff, 0xff, 0xff, 0x39, 0xff, 0xff, 0xff,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0xff, 0xff, 0xf4, 0x9f, 0xff, 0xff,
+    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0xff, 0xff, 0x49, 0xff, 0xff,
+    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xff, 0xff, 0xf3, 0x8f, 0xff,
+    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0x27, 0xff,
+    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xf1, 0x5f,
+    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0x3,
+    0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xd0,
+    0xf, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xfa,
+    0x0, 0xcf, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff,
+    0x70, 0x8, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff,
+    0xf3, 0x0, 0x3f, 0xff, 0xff, 0xfa, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
+    0xfe, 0x0, 0x0, 0xef, 0xff, 0xff, 0xf1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
+    0xff, 0x90, 0x0, 0x8, 0xff, 0xff, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
+    0xff, 0xf3, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
+    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
+    0xff, 0xff, 0x50, 0x0, 0x0, 0x1, 0xff, 0xff,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
+    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xff,
+    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1e, 0xff, 0xff, 0xff, 0xfb, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xff,
+    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xaf, 0xff,
+    0xff, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xf9,
+    0x40, 0x0, 0x0, 0x0, 0x2, 0x6b, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3e, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0xbb, 0xab, 0xce, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfa, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xe4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x8f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfd, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x16, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0xa4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x15, 0x8b, 0xde, 0xff, 0xed, 0xca,
+    0x74, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+    /* U+0050 "P" */
+    0x8e, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xdd, 0xdc, 0xb9, 0x74, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xc6, 0x0, 0x0, 0x0, 0x0, 0x9f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x60,
+    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xb1, 0x0, 0x0, 0x9f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
+    0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xb0, 0x0, 0x9f, 0xff, 0xff,
+    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x35, 0x9f, 0xff, 0xff, 0xff, 0xff, 0x60,
+    0x9, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1a, 0xff,
+    0xff, 0xff, 0xfe, 0x0, 0x9f, 0xff, 0xff, 0xf0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xf6, 0x9,
+    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
+    0xff, 0xff, 0xc0, 0x9f, 0xff, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0x19, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
+    0xff, 0xf5, 0x9f, 0xff, 0xff, 0xf0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xff, 0xff, 0x79, 0xff, 0xff,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
+    0xf9, 0x9f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0xff, 0xff, 0x99, 0xff, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf9,
+    0x9f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0xff, 0xff, 0x89, 0xff, 0xff, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xf6, 0x9f,
+    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
+    0xff, 0xff, 0x39, 0xff, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xff, 0xff, 0xf0, 0x9f, 0xff,
+    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
+    0xfa, 0x9, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0xff, 0xff, 0xff, 0x30, 0x9f, 0xff, 0xff,
+    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xdf, 0xff, 0xff, 0xff, 0xb0,
+    0x9, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x25, 0x8e, 0xff, 0xff,
+    0xff, 0xff, 0xf2, 0x0, 0x9f, 0xff, 0xff, 0xfe,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x9,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf9, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x9, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc4, 0x0,
+    0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfa, 0x40, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0xdb, 0x97, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
+    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
+    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
+    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xf0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xff, 0xff, 0xf0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x48,
+    0x88, 0x88, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+    /* U+0051 "Q" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x14, 0x78, 0x9a, 0xa9, 0x87, 0x41, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x49, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
+    0x83, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfd, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7e,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xd5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xcf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfb, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xd8, 0x52, 0x10, 0x1,
+    0x26, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
+    0xff, 0xff, 0xff, 0xfa, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xbf, 0xff, 0xff, 0xff, 0xff,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0xff, 0xff, 0xff, 0xc2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4d, 0xff, 0xff, 0xff,
+    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef,
+    0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
+    0xff, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0xbf,
+    0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0xd,
+    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x5,
+    0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2f, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0,
+    0xbf, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0xff, 0xfb, 0x0, 0x0,
+    0x2f, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf2, 0x0,
+    0x7, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0x70,
+    0x0, 0xcf, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xfb,
+    0x0, 0x1f, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff,
+    0xf0, 0x4, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
+    0xff, 0x40, 0x7f, 0xff, 0xff, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
+    0xff, 0xf6, 0xa, 0xff, 0xff, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
+    0xff, 0xff, 0x90, 0xcf, 0xff, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
+    0xff, 0xff, 0xfb, 0xd, 0xff, 0xff, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xff, 0xc0, 0xef, 0xff, 0xff, 0xe0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0xff, 0xfd, 0xf, 0xff, 0xff, 0xfd,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xff,
+    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xe, 0xff, 0xff, 0xfe, 0xe, 0xff, 0xff,
+    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xff, 0xff, 0xd0, 0xdf, 0xff,
+    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xf, 0xff, 0xff, 0xfd, 0xd, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xc0, 0xbf,
+    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xfa, 0x8,
+    0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0x80,
+    0x5f, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xf5,
+    0x2, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff,
+    0x20, 0xd, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
+    0xe0, 0x0, 0x9f, 0xff, 0xff, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
+    0xf9, 0x0, 0x4, 0xff, 0xff, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
+    0xff, 0x40, 0x0, 0xd, 0xff, 0xff, 0xff, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x36,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
+    0xff, 0xe0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xb4, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
+    0xff, 0xf7, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff,
+    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0xfd, 0x50, 0x0, 0x0, 0x7f, 0xff,
+    0xff, 0xff, 0x10, 0x0, 0x0, 0x6, 0xff, 0xff,
+    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xff, 0xff, 0xff, 0xc3, 0x0, 0x3f, 0xff,
+    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0xd, 0xff,
+    0xff, 0xff, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x3f, 0xff,
+    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xff, 0xff, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x38, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4c, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0xff, 0xff, 0xff, 0xfc, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xdf, 0xff, 0xff,
+    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xd7,
+    0x30, 0x0, 0x0, 0x0, 0x3, 0x8e, 0xff, 0xff,
+    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfd, 0xba, 0xab, 0xdf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5e, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfc, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xbf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfb, 0x32, 0xdf, 0xff, 0xff, 0xff, 0xf9,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x38, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfd, 0x82, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff,
+    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x36, 0x9c, 0xde, 0xff, 0xed, 0xb8,
+    0x62, 0x0, 0x0, 0x0, 0x0, 0x4d, 0xff, 0xff,
+    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0x8f, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x17, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0,
+    /* U+0052 "R" */
+    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0xdc, 0xa7, 0x51,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xff, 0xff, 0x98, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x89, 0xad, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x8f,
+    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5c, 0xff, 0xff,
+    0xff, 0xff, 0xa0, 0x0, 0x0, 0x8, 0xff, 0xff,
+    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff,
+    0xff, 0x20, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xf9,
+    0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0,
+    0x0, 0x8f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xe, 0xff, 0xff, 0xff, 0x20, 0x0, 0x8,
+    0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x8f, 0xff,
+    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
+    0xff, 0xff, 0x70, 0x0, 0x8, 0xff, 0xff, 0xff,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
+    0xf8, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xf2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0x70,
+    0x0, 0x8, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xff, 0xf6, 0x0, 0x0,
+    0x8f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0xff, 0xff, 0xff, 0x40, 0x0, 0x8, 0xff,
+    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
+    0xff, 0xff, 0xf0, 0x0, 0x0, 0x8f, 0xff, 0xff,
+    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff,
+    0xfb, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0x40,
+    0x0, 0x0, 0x8f, 0xff, 0xff, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xbf, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
+    0x8, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x6b, 0xff,
+    0xff, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x8f,
+    0xff, 0xff, 0xfc, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xbb, 0xcc, 0xef, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf5, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfd, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
+    0x83, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
+    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x1, 0x49,
+    0xef, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x9f,
+    0xff, 0xff, 0xff, 0xc1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xf2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
+    0xff, 0xff, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
+    0xff, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff,
+    0xd1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
+    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0xff, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
+    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
+    0xff, 0xf3, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
+    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
+    0xd0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0x80,
+    0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xff, 0xff, 0xff, 0xff, 0x20, 0x0,
+    0x0, 0x8f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x8,
+    0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
+    0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x8f, 0xff,
+    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
+    0xff, 0xff, 0xf2, 0x0, 0x8, 0xff, 0xff, 0xff,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
+    0xff, 0xb0, 0x0, 0x8f, 0xff, 0xff, 0xf2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xff,
+    0x60, 0x8, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0x10,
+    0x8f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0xff, 0xff, 0xfa, 0x8, 0xff,
+    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1e, 0xff, 0xff, 0xff, 0xf5,
+    /* U+0053 "S" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x47,
+    0x9b, 0xcd, 0xcc, 0xb9, 0x63, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x7c, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xb6, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x29, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x81, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xe5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
+    0xff, 0xff, 0xa6, 0x42, 0x10, 0x1, 0x25, 0x8c,
+    0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x2f, 0xff, 0xff, 0xff, 0xe6, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xaf, 0xff, 0xff,
+    0xff, 0xf3, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
+    0xff, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xc0, 0x0,
+    0x0, 0x1, 0xff, 0xff, 0xff, 0xd1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x7f, 0xff,
+    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xfa,
+    0x0, 0x0, 0xa, 0xff, 0xff, 0xfd, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xef, 0xff, 0xff, 0xf0, 0x0, 0x0, 0xdf,
+    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
+    0xff, 0x30, 0x0, 0xe, 0xff, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3f, 0xff, 0xff, 0xf5, 0x0, 0x0,
+    0xef, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0xff, 0x70, 0x0, 0xd, 0xff, 0xff, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0x87, 0x54, 0x31, 0x0,
+    0x0, 0xaf, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
+    0xff, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xe4, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
+    0xff, 0xff, 0xff, 0xfc, 0x61, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xef, 0xff, 0xff, 0xff,
+    0xff, 0xfb, 0x62, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0xa6, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x73,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xdf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0xa5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xa3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0xef, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfb, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x49, 0xef, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x27, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0x6a, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x37, 0xbf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x16, 0xcf, 0xff, 0xff,
+    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4d, 0xff, 0xff, 0xff, 0xfd, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff,
+    0x90, 0x1, 0x23, 0x56, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1f, 0xff, 0xff, 0xfc, 0xc, 0xff, 0xff,
+    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
+    0xff, 0xe0, 0xbf, 0xff, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0x9, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
+    0xff, 0xff, 0xf0, 0x6f, 0xff, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xfe, 0x2,
+    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xff, 0xff, 0xc0, 0xd, 0xff, 0xff, 0xff,
+    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf8,
+    0x0, 0x7f, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9, 0xff, 0xff, 0xff, 0x30, 0x1, 0xef, 0xff,
+    0xff, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff,
+    0xd0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0, 0xc,
+    0xff, 0xff, 0xff, 0xff, 0xe7, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5d, 0xff, 0xff, 0xff,
+    0xfb, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xb7, 0x41, 0x0, 0x0, 0x2, 0x69,
+    0xef, 0xff, 0xff, 0xff, 0xfe, 0x10, 0x0, 0x0,
+    0x0, 0x2e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfb, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xd5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x28, 0xdf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x15, 0x8a, 0xce, 0xef,
+    0xff, 0xed, 0xa8, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+    /* U+0054 "T" */
+    0x5e, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0x55, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf5, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf5, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xfc, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xdf, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
+    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xd, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xd, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xd, 0xff, 0xff, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xfc, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xdf, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
+    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xd, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xd, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xd, 0xff, 0xff, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xfc, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xdf, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
+    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xd, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0,
+    /* U+0055 "U" */
+    0x8f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xff, 0xfe, 0x8f, 0xff, 0xff, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfe,
+    0x8f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xff, 0xfe, 0x8f, 0xff, 0xff, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfe,
+    0x8f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xff, 0xfe, 0x8f, 0xff, 0xff, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfe,
+    0x8f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xff, 0xfe, 0x8f, 0xff, 0xff, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfe,
+    0x8f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xff, 0xfe, 0x8f, 0xff, 0xff, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfe,
+    0x8f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xff, 0xfe, 0x8f, 0xff, 0xff, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfe,
+    0x8f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xff, 0xfe, 0x8f, 0xff, 0xff, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfe,
+    0x8f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xff, 0xfe, 0x8f, 0xff, 0xff, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfe,
+    0x8f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xff, 0xfe, 0x8f, 0xff, 0xff, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfe,
+    0x8f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xff, 0xfe, 0x8f, 0xff, 0xff, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfe,
+    0x8f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xff, 0xfe, 0x8f, 0xff, 0xff, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfe,
+    0x8f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xff, 0xfe, 0x8f, 0xff, 0xff, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfe,
+    0x8f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xff, 0xfe, 0x8f, 0xff, 0xff, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfe,
+    0x8f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xff, 0xfe, 0x8f, 0xff, 0xff, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfe,
+    0x8f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfe,
+    0x7f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0xff, 0xff, 0xfd, 0x6f, 0xff, 0xff, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xfd,
+    0x6f, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xd, 0xff, 0xff, 0xfc, 0x4f, 0xff, 0xff, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xfb,
+    0x3f, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xff, 0xff, 0xf9, 0x1f, 0xff, 0xff, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf7,
+    0xe, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xff, 0xff, 0xf5, 0xb, 0xff, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xf2,
+    0x8, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xff, 0xe0, 0x4, 0xff, 0xff, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xa0,
+    0x0, 0xef, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
+    0xff, 0xff, 0xff, 0x50, 0x0, 0x9f, 0xff, 0xff,
+    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xfe, 0x0,
+    0x0, 0x1f, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
+    0xff, 0xff, 0xf7, 0x0, 0x0, 0x9, 0xff, 0xff,
+    0xff, 0xff, 0xa2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xef, 0xff, 0xff, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xc7,
+    0x41, 0x0, 0x0, 0x13, 0x6a, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x2e, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xef, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xd2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6e, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xc7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x7a,
+    0xce, 0xef, 0xff, 0xed, 0xb8, 0x51, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0,
+    /* U+0056 "V" */
+    0x7f, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xfe, 0x1,
+    0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0x80, 0xb,
+    0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0xff, 0xf2, 0x0, 0x5f,
+    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xe, 0xff, 0xff, 0xfc, 0x0, 0x0, 0xef,
+    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0xff, 0xff, 0x50, 0x0, 0x8, 0xff,
+    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x2f, 0xff,
+    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
+    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0xcf, 0xff,
+    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
+    0xff, 0xff, 0x30, 0x0, 0x0, 0x6, 0xff, 0xff,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
+    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
+    0xf6, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
+    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xf3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xa, 0xff, 0xff, 0xfd, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2f, 0xff, 0xff, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
+    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xbf, 0xff, 0xff, 0xd0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
+    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff,
+    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xe, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xfe, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2f, 0xff, 0xff, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xdf, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
+    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
+    0xff, 0xf2, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
+    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
+    0xff, 0x80, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
+    0xfd, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x90,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff,
+    0xf3, 0x0, 0x0, 0xd, 0xff, 0xff, 0xf3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
+    0x90, 0x0, 0x3, 0xff, 0xff, 0xfd, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x9f, 0xff, 0xff, 0x60, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xf4,
+    0x0, 0xe, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0x90,
+    0x4, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xfe, 0x0,
+    0xaf, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xf3, 0xe,
+    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x83, 0xff,
+    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xcf, 0xff, 0xfd, 0x8f, 0xff,
+    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xff, 0xff, 0xfe, 0xff, 0xff,
+    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xf4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xfe, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xd, 0xff, 0xff, 0xff, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    /* U+0057 "W" */
+    0xf, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
+    0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
+    0xf2, 0xb, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
+    0xff, 0xd0, 0x7, 0xff, 0xff, 0xff, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0xff, 0x90, 0x3, 0xff, 0xff, 0xff, 0x70,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0xff, 0xff, 0x50, 0x0, 0xef, 0xff, 0xff,
+    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xff, 0xff, 0x0, 0x0, 0xaf, 0xff,
+    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x6f,
+    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xed, 0xff,
+    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xf, 0xff, 0xff, 0xf7, 0x0, 0x0,
+    0x2f, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xa9,
+    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf3, 0x0,
+    0x0, 0xe, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
+    0x65, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xe0,
+    0x0, 0x0, 0x9, 0xff, 0xff, 0xfd, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xff, 0x21, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff,
+    0xa0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
+    0xff, 0xfe, 0x0, 0xcf, 0xff, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0x60, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0xff, 0xfa, 0x0, 0x8f, 0xff, 0xff, 0x70,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0xdf, 0xff,
+    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xff, 0xff, 0xf6, 0x0, 0x3f, 0xff, 0xff,
+    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0xff, 0xf1, 0x0, 0xf, 0xff,
+    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xa, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xe, 0xff, 0xff, 0xd0, 0x0, 0xb,
+    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xe, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
+    0x0, 0xf, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x80, 0x0,
+    0x6, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0xff, 0xff, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x40,
+    0x0, 0x2, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xfb, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0x70,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xfb, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0x60,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0xff, 0xf6, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
+    0xb0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
+    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
+    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0xf, 0xff,
+    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
+    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0xe, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
+    0x0, 0x2f, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0xe, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xe, 0xff, 0xff, 0xf1, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xff, 0x40, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
+    0x0, 0x2f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0x6f, 0xff, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xfc, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0x60,
+    0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
+    0xfd, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff,
+    0xa0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
+    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
+    0xff, 0xf0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xff, 0xff, 0x40, 0x0, 0x0, 0xd, 0xff,
+    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0xff, 0xff, 0xf3, 0x0, 0x0, 0x5, 0xff, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xff, 0xff, 0x80, 0x0, 0x0, 0x2f,
+    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x9, 0xff,
+    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xf, 0xff, 0xff, 0xb0, 0x0, 0x0,
+    0x6f, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xff, 0xfb, 0x0, 0x0, 0xd,
+    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xf0, 0x0,
+    0x0, 0xbf, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x0, 0x0,
+    0x1f, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xf3,
+    0x0, 0x0, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0x30,
+    0x0, 0x5f, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
+    0xf7, 0x0, 0x4, 0xff, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
+    0x70, 0x0, 0x9f, 0xff, 0xff, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0xfa, 0x0, 0x8, 0xff, 0xff, 0xf3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
+    0xff, 0xb0, 0x0, 0xdf, 0xff, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0xff, 0xfe, 0x0, 0xc, 0xff, 0xff, 0xf0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
+    0xff, 0xff, 0xe0, 0x1, 0xff, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xff, 0x10, 0xf, 0xff, 0xff,
+    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9, 0xff, 0xff, 0xf1, 0x4, 0xff, 0xff, 0xf4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2f, 0xff, 0xff, 0x50, 0x4f, 0xff,
+    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xff, 0xf4, 0x8, 0xff, 0xff,
+    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0x80, 0x8f,
+    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0xff, 0xf8, 0xc, 0xff,
+    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xb0,
+    0xcf, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xfa, 0xf,
+    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
+    0xe0, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xfd,
+    0x3f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
+    0xff, 0xf5, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
+    0xff, 0x7f, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0xff, 0xfc, 0xff, 0xff, 0xf0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
+    0xff, 0xff, 0xcf, 0xff, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xa, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0x70,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff,
+    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
+    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
+    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+    /* U+0058 "X" */
+    0x0, 0x1e, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0x70, 0x0,
+    0x0, 0x6f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0xaf, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0xff, 0xff, 0xe1, 0x0, 0x0, 0x0,
+    0x1, 0xef, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xef, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
+    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
+    0xfe, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2f, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xff, 0xff,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0x90,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xef, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xff, 0xff, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xef, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0xcf, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0xff, 0xff, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x8f,
+    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
+    0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x4f, 0xff,
+    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
+    0xff, 0xff, 0xff, 0x60, 0x0, 0x1e, 0xff, 0xff,
+    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xff, 0xff, 0xff, 0x10, 0xb, 0xff, 0xff, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
+    0xff, 0xff, 0xfb, 0x6, 0xff, 0xff, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0xff, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xf2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
+    0xff, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
+    0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
+    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
+    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
+    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xdf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0xff, 0xfd, 0x5f, 0xff, 0xff,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xff, 0xff, 0xff, 0x30, 0xbf, 0xff, 0xff,
+    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
+    0xff, 0xff, 0xff, 0x90, 0x1, 0xef, 0xff, 0xff,
+    0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
+    0xff, 0xff, 0xd0, 0x0, 0x5, 0xff, 0xff, 0xff,
+    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
+    0xff, 0xf3, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff,
+    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xff,
+    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xfe, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2f, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xfe,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xd, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1e, 0xff, 0xff, 0xff, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
+    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xd0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
+    0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0x90,
+    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0x40,
+    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xfe, 0x10,
+    0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xfb, 0x0,
+    0x0, 0xc, 0xff, 0xff, 0xff, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xf7, 0x0,
+    0x9, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1e, 0xff, 0xff, 0xff, 0xf3, 0x5,
+    0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xd0,
+    /* U+0059 "Y" */
+    0x7f, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xfc, 0x0,
+    0xcf, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0x20, 0x2,
+    0xff, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3f, 0xff, 0xff, 0xff, 0x60, 0x0, 0x7,
+    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xd, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0xc,
+    0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0xff, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x2f,
+    0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
+    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
+    0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
+    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
+    0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
+    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
+    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xff, 0xff, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
+    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xcf, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
+    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
+    0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
+    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
+    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
+    0xff, 0xf1, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
+    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
+    0xff, 0xa0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff,
+    0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
+    0xff, 0x40, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xf4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff,
+    0xfd, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xf9, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
+    0xf7, 0x0, 0xe, 0xff, 0xff, 0xfd, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff,
+    0xf1, 0x8, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff,
+    0xa2, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
+    0xdf, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff,
+    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xef, 0xff, 0xff, 0xff,
+    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xfe,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xff, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
+    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
+    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xff, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    /* U+005A "Z" */
+    0x0, 0x9, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xe2, 0x0, 0x0, 0xbf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x30, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0xbf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x30, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0,
+    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff,
+    0xff, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2e, 0xff, 0xff, 0xff, 0xf3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
+    0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xfd, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xef, 0xff, 0xff, 0xff, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
+    0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
+    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xe1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e,
+    0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0xff, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xef, 0xff, 0xff, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xcf, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff,
+    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1e, 0xff, 0xff, 0xff, 0xe2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff,
+    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xa, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
+    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0xff, 0xff,
+    0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xdf, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff,
+    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
+    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2e, 0xff, 0xff, 0xff, 0xd1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff,
+    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
+    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
+    0xff, 0xff, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x9f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x9, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x9, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf0,
+    /* U+005B "[" */
+    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x54,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x4f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x54, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x4f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x54, 0xff, 0xff,
+    0xfe, 0x11, 0x11, 0x11, 0x10, 0x4f, 0xff, 0xff,
+    0xe0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xe0,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfe, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xe0, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0xff, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xff, 0xff, 0xe0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x4, 0xff,
+    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
+    0xff, 0xe0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
+    0xfe, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
+    0xe0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xe0,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfe, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xe0, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0xff, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xff, 0xff, 0xe0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x4, 0xff,
+    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
+    0xff, 0xe0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
+    0xfe, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
+    0xe0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xe0,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfe, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xe0, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0xff, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xff, 0xff, 0xe0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x4, 0xff,
+    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
+    0xff, 0xe0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
+    0xfe, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
+    0xe0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xe0,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfe, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xe1, 0x11,
+    0x11, 0x11, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf5, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x54, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf5, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x54, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
+    /* U+005C "\\" */
+    0x78, 0x88, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xbf, 0xff, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xd, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0xff, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xbf, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
+    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
+    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xcf, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xfb, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xa, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xff, 0x90, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xd0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
+    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0xff, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
+    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xff, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
+    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xff, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xf1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
+    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xf1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xf, 0xff, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xef, 0xff, 0xf0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf4,
+    /* U+005D "]" */
+    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xaf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xaf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0xaf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0xaf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0x1, 0x11, 0x11, 0x14, 0xff,
+    0xff, 0xfe, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
+    0xfe, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfe, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0xff, 0xfe, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x4, 0xff,
+    0xff, 0xfe, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
+    0xfe, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfe, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0xff, 0xfe, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x4, 0xff,
+    0xff, 0xfe, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
+    0xfe, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfe, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0xff, 0xfe, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x4, 0xff,
+    0xff, 0xfe, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
+    0xfe, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfe, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0xff, 0xfe, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x4, 0xff,
+    0xff, 0xfe, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
+    0xfe, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfe, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0xff, 0xfe, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x4, 0xff,
+    0xff, 0xfe, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
+    0xfe, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfe, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0xff, 0xfe, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x4, 0xff,
+    0xff, 0xfe, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
+    0xfe, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfe, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0xff, 0xfe, 0x1, 0x11,
+    0x11, 0x14, 0xff, 0xff, 0xfe, 0xaf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0xaf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0xaf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    /* U+005E "^" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0x88,
+    0x87, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xf3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xd, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xff, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
+    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
+    0xfe, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xe4,
+    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x90, 0xcf,
+    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xff, 0x20, 0x6f, 0xff,
+    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xef, 0xff, 0xfc, 0x0, 0xf, 0xff, 0xff,
+    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0xff, 0xf5, 0x0, 0x9, 0xff, 0xff, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
+    0xff, 0xe0, 0x0, 0x2, 0xff, 0xff, 0xf9, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
+    0x90, 0x0, 0x0, 0xbf, 0xff, 0xff, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0x20,
+    0x0, 0x0, 0x5f, 0xff, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xff, 0xff, 0xfc, 0x0, 0x0,
+    0x0, 0xe, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x6f,
+    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0xbf,
+    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0xdf, 0xff,
+    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
+    0xff, 0xb0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff,
+    0xf2, 0x0, 0x0, 0xb, 0xff, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf9,
+    0x0, 0x0, 0x2f, 0xff, 0xff, 0xe0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0x10,
+    0x0, 0x9f, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0x70, 0x1,
+    0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3f, 0xff, 0xff, 0xe0, 0x8, 0xff,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0xff, 0xff, 0xf5, 0xe, 0xff, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0xff, 0xfc,
+    /* U+005F "_" */
+    0x6, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x64, 0x1f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfb, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x1f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfb, 0x1f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfb,
+    /* U+0060 "`" */
+    0x68, 0x88, 0x88, 0x88, 0x30, 0x0, 0x2, 0xef,
+    0xff, 0xff, 0xfc, 0x0, 0x0, 0x4, 0xff, 0xff,
+    0xff, 0xf4, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
+    0xc0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0x30,
+    0x0, 0x0, 0xc, 0xff, 0xff, 0xfb, 0x0, 0x0,
+    0x0, 0x1d, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
+    0x2f, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x4f,
+    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xfa,
+    /* U+0061 "a" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x7a, 0xce,
+    0xff, 0xff, 0xec, 0xa7, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x29, 0xef, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2a, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x2, 0xff,
+    0xff, 0xff, 0xff, 0xb6, 0x42, 0x11, 0x24, 0x7b,
+    0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0xb,
+    0xff, 0xff, 0xff, 0xc2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2c, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0,
+    0x3f, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xf8, 0x0,
+    0x0, 0xaf, 0xff, 0xff, 0xe1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xfc,
+    0x0, 0x0, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
+    0xfe, 0x0, 0x3, 0xff, 0xff, 0xff, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0xff, 0xff, 0x0, 0x1, 0x57, 0x9b, 0xdb, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0x8d, 0xff, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0x47, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x14, 0x79, 0xbd,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0x8e, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x0, 0x0, 0x0, 0x2, 0xbf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x64,
+    0xff, 0xff, 0xff, 0x0, 0x0, 0x9, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0x63, 0x0,
+    0x3, 0xff, 0xff, 0xff, 0x0, 0x0, 0x6f, 0xff,
+    0xff, 0xff, 0xff, 0xda, 0x74, 0x20, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xff, 0xff, 0x0, 0x2, 0xff,
+    0xff, 0xff, 0xff, 0x71, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0x0, 0xa,
+    0xff, 0xff, 0xff, 0xc1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0x0,
+    0xf, 0xff, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff,
+    0x0, 0x4f, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
+    0xff, 0x0, 0x6f, 0xff, 0xff, 0xf3, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
+    0xff, 0xff, 0x0, 0x7f, 0xff, 0xff, 0xf1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xff, 0xff, 0xff, 0x10, 0x6f, 0xff, 0xff, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0xff, 0xff, 0xff, 0x10, 0x4f, 0xff, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9, 0xff, 0xff, 0xff, 0xff, 0x20, 0x1f, 0xff,
+    0xff, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0x20, 0xb,
+    0xff, 0xff, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40,
+    0x3, 0xff, 0xff, 0xff, 0xff, 0x82, 0x0, 0x0,
+    0x2, 0x6c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x50, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xfd,
+    0xcd, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x8f, 0xff,
+    0xff, 0x90, 0x0, 0xc, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x20, 0x5f,
+    0xff, 0xff, 0xd0, 0x0, 0x0, 0xaf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x70, 0x0,
+    0x1f, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x5, 0xcf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x71, 0x0,
+    0x0, 0xb, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
+    0x3, 0x7a, 0xde, 0xff, 0xed, 0xa7, 0x30, 0x0,
+    0x0, 0x0, 0x1, 0x33, 0x33, 0x32,
+    /* U+0062 "b" */
+    0x6f, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xff, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xff, 0xff, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xfb, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
+    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
+    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
+    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
+    0xff, 0xfb, 0x0, 0x0, 0x5, 0x9c, 0xef, 0xfe,
+    0xb8, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
+    0xff, 0xff, 0xb0, 0x0, 0x6e, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xd6, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0xff, 0xff, 0xfb, 0x1, 0xcf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfd, 0x30, 0x0, 0x0, 0x0,
+    0x6f, 0xff, 0xff, 0xb2, 0xdf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0,
+    0x6, 0xff, 0xff, 0xfc, 0xdf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0,
+    0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8,
+    0x31, 0x13, 0x6c, 0xff, 0xff, 0xff, 0xff, 0x30,
+    0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,
+    0x0, 0x0, 0x0, 0x5, 0xef, 0xff, 0xff, 0xfd,
+    0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0xff, 0xff,
+    0xf7, 0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0xff,
+    0xff, 0xe0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
+    0xff, 0xff, 0x60, 0x6, 0xff, 0xff, 0xff, 0xe0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0xff, 0xff, 0xfc, 0x0, 0x6f, 0xff, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xff, 0xff, 0xf1, 0x6, 0xff, 0xff, 0xff,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xff, 0xff, 0xff, 0x50, 0x6f, 0xff, 0xff,
+    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0xff, 0xff, 0xf9, 0x6, 0xff, 0xff,
+    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xaf, 0xff, 0xff, 0xc0, 0x6f, 0xff,
+    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0xff, 0xfe, 0x6, 0xff,
+    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xf0, 0x6f,
+    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0x6,
+    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xf0,
+    0x6f, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff,
+    0x6, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff,
+    0xf0, 0x6f, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
+    0xfe, 0x6, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xff, 0xc0, 0x6f, 0xff, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
+    0xff, 0xfa, 0x6, 0xff, 0xff, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
+    0xff, 0xff, 0x70, 0x6f, 0xff, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
+    0xff, 0xff, 0xf3, 0x6, 0xff, 0xff, 0xff, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0xff, 0xff, 0x0, 0x6f, 0xff, 0xff, 0xfa,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0xff, 0x90, 0x6, 0xff, 0xff, 0xff,
+    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xff, 0xff, 0xf3, 0x0, 0x6f, 0xff, 0xff,
+    0xff, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xff, 0xff, 0xfc, 0x0, 0x6, 0xff, 0xff,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xff, 0xff, 0xff, 0x30, 0x0, 0x6f, 0xff,
+    0xff, 0xff, 0xff, 0xd3, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x6, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfb, 0x52, 0x1, 0x38,
+    0xdf, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x6f,
+    0xff, 0xff, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x6,
+    0xff, 0xff, 0xf4, 0x3f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x6f, 0xff, 0xff, 0x40, 0x3e, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0xff, 0xf4, 0x0, 0x9, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfa, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x6b,
+    0xdf, 0xff, 0xda, 0x61, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+    /* U+0063 "c" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x59, 0xce,
+    0xff, 0xed, 0xb8, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3a, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xe7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xbf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xef, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x70, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff,
+    0xff, 0xd8, 0x32, 0x12, 0x49, 0xff, 0xff, 0xff,
+    0xff, 0x30, 0x0, 0x0, 0x1, 0xef, 0xff, 0xff,
+    0xfe, 0x50, 0x0, 0x0, 0x0, 0x1, 0xbf, 0xff,
+    0xff, 0xfe, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
+    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xff, 0xff, 0xf6, 0x0, 0x0, 0x2f, 0xff, 0xff,
+    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0xff, 0xff, 0xd0, 0x0, 0x9, 0xff, 0xff,
+    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0xff, 0xff, 0x30, 0x0, 0xef, 0xff,
+    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xd, 0xff, 0xff, 0xf7, 0x0, 0x4f, 0xff,
+    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xdb, 0x60, 0x8, 0xff,
+    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x52, 0x0, 0x0, 0x0, 0xbf,
+    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
+    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2f, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3f, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3f, 0xff, 0xff, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf4, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x60,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xdf, 0xdb, 0x96, 0x10, 0x9f, 0xff, 0xff,
+    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xf, 0xff, 0xff, 0xf2, 0x5, 0xff, 0xff,
+    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xff, 0xfe, 0x0, 0xf, 0xff,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xaf, 0xff, 0xff, 0xa0, 0x0, 0xaf,
+    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2f, 0xff, 0xff, 0xf4, 0x0, 0x3,
+    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xb, 0xff, 0xff, 0xfe, 0x0, 0x0,
+    0xa, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0x60, 0x0,
+    0x0, 0x1e, 0xff, 0xff, 0xff, 0xc3, 0x0, 0x0,
+    0x0, 0x0, 0x1b, 0xff, 0xff, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xfb, 0x63,
+    0x10, 0x25, 0x9f, 0xff, 0xff, 0xff, 0xf2, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2b, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xcf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x26, 0xac, 0xef, 0xfe, 0xda, 0x62, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+    /* U+0064 "d" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfd,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x16, 0xad, 0xef,
+    0xfe, 0xb7, 0x10, 0x0, 0x4, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x2a, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfa, 0x10, 0x4, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xe5, 0x4, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x1, 0xbf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x64, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xe9, 0x42,
+    0x13, 0x5b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0x0, 0x6, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x2c, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0x0, 0xe, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xfe,
+    0x0, 0x7f, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xfe,
+    0x0, 0xef, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xef, 0xff, 0xff, 0xfe,
+    0x4, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xfe,
+    0x9, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xfe,
+    0xd, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xfe,
+    0x1f, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xfe,
+    0x3f, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfe,
+    0x6f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xfe,
+    0x7f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xfe,
+    0x8f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xfe,
+    0x9f, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xfe,
+    0x9f, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xfe,
+    0x8f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xfe,
+    0x7f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xfe,
+    0x6f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xfe,
+    0x3f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfe,
+    0x1f, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfe,
+    0xc, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xfe,
+    0x8, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xfe,
+    0x2, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xfe,
+    0x0, 0xcf, 0xff, 0xff, 0xe1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xfe,
+    0x0, 0x4f, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xfe,
+    0x0, 0xb, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xfe,
+    0x0, 0x2, 0xff, 0xff, 0xff, 0xfc, 0x20, 0x0,
+    0x0, 0x0, 0x19, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xfa, 0x52,
+    0x2, 0x49, 0xef, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf8, 0xdf, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xa0, 0xdf, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x3, 0xdf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf9, 0x0, 0xdf, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x6, 0xef, 0xff, 0xff,
+    0xff, 0xff, 0xfd, 0x40, 0x0, 0xdf, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x8c, 0xef,
+    0xfe, 0xc9, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
+    /* U+0065 "e" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x59, 0xce,
+    0xff, 0xfe, 0xb8, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2a, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xef, 0xff, 0xff, 0xff, 0xe8, 0x42,
+    0x12, 0x48, 0xdf, 0xff, 0xff, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0x70,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xfe,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff,
+    0xff, 0xff, 0x30, 0x0, 0x0, 0x2f, 0xff, 0xff,
+    0xfe, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2e, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x9, 0xff,
+    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5f, 0xff, 0xff, 0xf3, 0x0, 0x0,
+    0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0x90,
+    0x0, 0x5f, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
+    0xff, 0x0, 0xa, 0xff, 0xff, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
+    0xff, 0xff, 0xf3, 0x0, 0xdf, 0xff, 0xff, 0x90,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xdf, 0xff, 0xff, 0x70, 0xf, 0xff, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xa, 0xff, 0xff, 0xfa, 0x3, 0xff,
+    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xc0,
+    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf0, 0x6f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x6, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x6f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5,
+    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x22, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xec, 0xa6,
+    0x0, 0x2f, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
+    0xff, 0x70, 0x0, 0xcf, 0xff, 0xff, 0xf3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
+    0xff, 0xff, 0xf1, 0x0, 0x4, 0xff, 0xff, 0xff,
+    0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xff, 0xff, 0xfa, 0x0, 0x0, 0xb, 0xff,
+    0xff, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0,
+    0x2f, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xaf, 0xff, 0xff, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xfe, 0x94,
+    0x21, 0x12, 0x5a, 0xff, 0xff, 0xff, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xd1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xaf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xe8, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0x9b, 0xdf,
+    0xff, 0xed, 0xa7, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0,
+    /* U+0066 "f" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x36, 0x89,
+    0x98, 0x76, 0x31, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7e, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0x1c, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf9, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0,
+    0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf1, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
+    0xff, 0x73, 0x0, 0x2, 0x40, 0x0, 0x0, 0x0,
+    0xaf, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xa0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
+    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xef, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
+    0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xef, 0xff, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x4c, 0xcc, 0xcc,
+    0xff, 0xff, 0xff, 0xdc, 0xcc, 0xcc, 0xc3, 0x0,
+    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf4, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x5f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,
+    0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xef,
+    0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xef, 0xff, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
+    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xef, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
+    0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xef, 0xff, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
+    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xef, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
+    0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xef, 0xff, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
+    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xef, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
+    0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xef, 0xff, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
+    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xef, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x78, 0x88, 0x88, 0x10,
+    0x0, 0x0, 0x0, 0x0,
+    /* U+0067 "g" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x16, 0x9c, 0xef,
+    0xfe, 0xc8, 0x30, 0x0, 0x0, 0x12, 0x22, 0x22,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xaf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xd5, 0x0, 0x6, 0xff, 0xff,
+    0xf4, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfb, 0x10, 0x6f, 0xff,
+    0xff, 0x40, 0x0, 0x0, 0x1b, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x26, 0xff,
+    0xff, 0xf4, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x8f,
+    0xff, 0xff, 0x40, 0x0, 0xb, 0xff, 0xff, 0xff,
+    0xff, 0x94, 0x21, 0x35, 0xaf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf4, 0x0, 0x6, 0xff, 0xff, 0xff,
+    0xf9, 0x10, 0x0, 0x0, 0x0, 0x1a, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x40, 0x1, 0xff, 0xff, 0xff,
+    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xff, 0xff, 0xff, 0xf4, 0x0, 0x8f, 0xff, 0xff,
+    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xff, 0xff, 0xff, 0x40, 0xf, 0xff, 0xff,
+    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xff, 0xff, 0xf4, 0x5, 0xff, 0xff,
+    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2f, 0xff, 0xff, 0xff, 0x40, 0xbf, 0xff,
+    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xbf, 0xff, 0xff, 0xf4, 0xf, 0xff,
+    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0x43, 0xff,
+    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf4, 0x6f,
+    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0x48,
+    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xf4,
+    0xaf, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
+    0x4b, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
+    0xf4, 0xbf, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
+    0xff, 0x4b, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0xff, 0xf4, 0xaf, 0xff, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
+    0xff, 0xff, 0x49, 0xff, 0xff, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0xff, 0xff, 0xf4, 0x7f, 0xff, 0xff, 0xe0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0xff, 0xff, 0x44, 0xff, 0xff, 0xff, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0xff, 0xf4, 0x1f, 0xff, 0xff, 0xf4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0xff, 0xff, 0x40, 0xcf, 0xff, 0xff,
+    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0xff, 0xff, 0xf4, 0x7, 0xff, 0xff,
+    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xe, 0xff, 0xff, 0xff, 0x40, 0x1f, 0xff,
+    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x9f,
+    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0x40, 0x1,
+    0xff, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0,
+    0x7, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40,
+    0x0, 0xc, 0xff, 0xff, 0xff, 0xfe, 0x83, 0x10,
+    0x13, 0x8d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,
+    0x0, 0x0, 0x1e, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff,
+    0x30, 0x0, 0x0, 0x2d, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfc, 0x1f, 0xff, 0xff,
+    0xf3, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0xff, 0xff,
+    0xff, 0x30, 0x0, 0x0, 0x0, 0x4, 0xcf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xd5, 0x0, 0xf, 0xff,
+    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x38,
+    0xbe, 0xff, 0xff, 0xd9, 0x40, 0x0, 0x0, 0xff,
+    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
+    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xff, 0xff, 0xd0, 0x6, 0xb8, 0x63, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xff, 0xfa, 0x0, 0x7f, 0xff, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xdf, 0xff, 0xff, 0x70, 0x6, 0xff, 0xff,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5f, 0xff, 0xff, 0xf3, 0x0, 0x3f, 0xff,
+    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1e, 0xff, 0xff, 0xfd, 0x0, 0x0, 0xef,
+    0xff, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1c, 0xff, 0xff, 0xff, 0x60, 0x0, 0x8,
+    0xff, 0xff, 0xff, 0xd3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4d, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0,
+    0x1e, 0xff, 0xff, 0xff, 0xfc, 0x74, 0x21, 0x12,
+    0x48, 0xdf, 0xff, 0xff, 0xff, 0xf2, 0x0, 0x0,
+    0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0,
+    0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2b, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xa1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xbf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfa, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x15, 0x9c,
+    0xde, 0xff, 0xed, 0xb8, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+    /* U+0068 "h" */
+    0x5f, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xfc, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xff, 0xff, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xff, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x1,
+    0x6a, 0xdf, 0xff, 0xeb, 0x84, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0xff, 0xc0, 0x0, 0x2a, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0x70, 0x0, 0x0,
+    0x6, 0xff, 0xff, 0xfc, 0x0, 0x7f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0x0, 0x0,
+    0x6f, 0xff, 0xff, 0xc0, 0xbf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x6,
+    0xff, 0xff, 0xfc, 0xbf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xe1, 0x0, 0x6f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x75, 0x45,
+    0x8c, 0xff, 0xff, 0xff, 0xff, 0x90, 0x6, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x91, 0x0, 0x0, 0x0,
+    0x3, 0xdf, 0xff, 0xff, 0xff, 0x10, 0x6f, 0xff,
+    0xff, 0xff, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xdf, 0xff, 0xff, 0xf6, 0x6, 0xff, 0xff,
+    0xff, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0xff, 0xff, 0xa0, 0x6f, 0xff, 0xff,
+    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xff, 0xfd, 0x6, 0xff, 0xff, 0xff,
+    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xff, 0xff, 0xf0, 0x6f, 0xff, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xff, 0xff, 0xff, 0x16, 0xff, 0xff, 0xff, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
+    0xff, 0xff, 0xf2, 0x6f, 0xff, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0xff, 0x26, 0xff, 0xff, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
+    0xff, 0xf2, 0x6f, 0xff, 0xff, 0xd0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0x36, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
+    0xf3, 0x6f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
+    0x36, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf3,
+    0x6f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x36,
+    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf3, 0x6f,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x36, 0xff,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xf, 0xff, 0xff, 0xf3, 0x6f, 0xff,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xff, 0xff, 0x36, 0xff, 0xff,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xf, 0xff, 0xff, 0xf3, 0x6f, 0xff, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xff, 0x36, 0xff, 0xff, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0xff, 0xf3, 0x6f, 0xff, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xff, 0x36, 0xff, 0xff, 0xfc, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0xff, 0xf3, 0x6f, 0xff, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0xff, 0x36, 0xff, 0xff, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
+    0xff, 0xf3, 0x6f, 0xff, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0x36, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
+    0xf3, 0x6f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
+    0x36, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf3,
+    0x6f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x36,
+    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf3,
+    /* U+0069 "i" */
+    0x5f, 0xff, 0xff, 0xc5, 0xff, 0xff, 0xfc, 0x5f,
+    0xff, 0xff, 0xc5, 0xff, 0xff, 0xfc, 0x5f, 0xff,
+    0xff, 0xc5, 0xff, 0xff, 0xfc, 0x5f, 0xff, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x22, 0x22,
+    0x22, 0x5f, 0xff, 0xff, 0xc5, 0xff, 0xff, 0xfc,
+    0x5f, 0xff, 0xff, 0xc5, 0xff, 0xff, 0xfc, 0x5f,
+    0xff, 0xff, 0xc5, 0xff, 0xff, 0xfc, 0x5f, 0xff,
+    0xff, 0xc5, 0xff, 0xff, 0xfc, 0x5f, 0xff, 0xff,
+    0xc5, 0xff, 0xff, 0xfc, 0x5f, 0xff, 0xff, 0xc5,
+    0xff, 0xff, 0xfc, 0x5f, 0xff, 0xff, 0xc5, 0xff,
+    0xff, 0xfc, 0x5f, 0xff, 0xff, 0xc5, 0xff, 0xff,
+    0xfc, 0x5f, 0xff, 0xff, 0xc5, 0xff, 0xff, 0xfc,
+    0x5f, 0xff, 0xff, 0xc5, 0xff, 0xff, 0xfc, 0x5f,
+    0xff, 0xff, 0xc5, 0xff, 0xff, 0xfc, 0x5f, 0xff,
+    0xff, 0xc5, 0xff, 0xff, 0xfc, 0x5f, 0xff, 0xff,
+    0xc5, 0xff, 0xff, 0xfc, 0x5f, 0xff, 0xff, 0xc5,
+    0xff, 0xff, 0xfc, 0x5f, 0xff, 0xff, 0xc5, 0xff,
+    0xff, 0xfc, 0x5f, 0xff, 0xff, 0xc5, 0xff, 0xff,
+    0xfc, 0x5f, 0xff, 0xff, 0xc5, 0xff, 0xff, 0xfc,
+    0x5f, 0xff, 0xff, 0xc5, 0xff, 0xff, 0xfc,
+    /* U+006A "j" */
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xfb, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0x6, 0xff, 0xff, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xff, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0x6, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0x22, 0x22, 0x21, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x33, 0x33,
+    0x32, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
+    0xb0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xfb, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0x6, 0xff, 0xff, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xff, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0x6, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x6,
+    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x6f,
+    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x6, 0xff,
+    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
+    0xff, 0xb0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
+    0xfb, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
+    0xb0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xfb, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0x6, 0xff, 0xff, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xff, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0x6, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x6,
+    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x6f,
+    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x6, 0xff,
+    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
+    0xff, 0xb0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
+    0xfb, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
+    0xb0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xfb, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0x6, 0xff, 0xff, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xff, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
+    0x9, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0xff, 0xff, 0x20, 0x2c, 0x86, 0x7b, 0xff, 0xff,
+    0xff, 0xe0, 0x5, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf8, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0x10, 0xc, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30,
+    0x0, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x30, 0x0,
+    0x17, 0xbd, 0xef, 0xed, 0xa5, 0x0, 0x0, 0x0,
+    /* U+006B "k" */
+    0x5f, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xfc, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xff, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5f, 0xff, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x12, 0x22, 0x22, 0x22,
+    0x0, 0x5f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0x90,
+    0x5, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0x90, 0x0,
+    0x5f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xff, 0xff, 0xff, 0x90, 0x0, 0x5,
+    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x5f,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x5, 0xff,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
+    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x5f, 0xff,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
+    0xff, 0x60, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
+    0xfc, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff,
+    0x60, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff,
+    0xc0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0x60,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xfc,
+    0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xc0,
+    0x0, 0x3f, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xfc, 0x0,
+    0x3f, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xc0, 0x3f,
+    0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xff, 0xfc, 0x3f, 0xff,
+    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5f, 0xff, 0xff, 0xef, 0xff, 0xff,
+    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xdf, 0xff,
+    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5f, 0xff, 0xff, 0xff, 0xfe, 0x23, 0xff, 0xff,
+    0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0xff, 0xff, 0xfe, 0x20, 0x9, 0xff, 0xff,
+    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
+    0xff, 0xff, 0xfd, 0x20, 0x0, 0xd, 0xff, 0xff,
+    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0xff, 0xfe, 0x10, 0x0, 0x0, 0x4f, 0xff, 0xff,
+    0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
+    0xfa, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
+    0xfc, 0x0, 0x0, 0x0, 0x1, 0xef, 0xff, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff,
+    0xe1, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff,
+    0xa0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xff, 0xff,
+    0x50, 0x0, 0x0, 0x5, 0xff, 0xff, 0xfc, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xfe,
+    0x10, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xfb,
+    0x0, 0x0, 0x5, 0xff, 0xff, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf5,
+    0x0, 0x0, 0x5f, 0xff, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xe1,
+    0x0, 0x5, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0xb0,
+    0x0, 0x5f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0x60,
+    0x5, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0x10,
+    0x5f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xfb, 0x5,
+    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xf6,
+    /* U+006C "l" */
+    0x7f, 0xff, 0xff, 0x98, 0xff, 0xff, 0xfa, 0x8f,
+    0xff, 0xff, 0xa8, 0xff, 0xff, 0xfa, 0x8f, 0xff,
+    0xff, 0xa8, 0xff, 0xff, 0xfa, 0x8f, 0xff, 0xff,
+    0xa8, 0xff, 0xff, 0xfa, 0x8f, 0xff, 0xff, 0xa8,
+    0xff, 0xff, 0xfa, 0x8f, 0xff, 0xff, 0xa8, 0xff,
+    0xff, 0xfa, 0x8f, 0xff, 0xff, 0xa8, 0xff, 0xff,
+    0xfa, 0x8f, 0xff, 0xff, 0xa8, 0xff, 0xff, 0xfa,
+    0x8f, 0xff, 0xff, 0xa8, 0xff, 0xff, 0xfa, 0x8f,
+    0xff, 0xff, 0xa8, 0xff, 0xff, 0xfa, 0x8f, 0xff,
+    0xff, 0xa8, 0xff, 0xff, 0xfa, 0x8f, 0xff, 0xff,
+    0xa8, 0xff, 0xff, 0xfa, 0x8f, 0xff, 0xff, 0xa8,
+    0xff, 0xff, 0xfa, 0x8f, 0xff, 0xff, 0xa8, 0xff,
+    0xff, 0xfa, 0x8f, 0xff, 0xff, 0xa8, 0xff, 0xff,
+    0xfa, 0x8f, 0xff, 0xff, 0xa8, 0xff, 0xff, 0xfa,
+    0x8f, 0xff, 0xff, 0xa8, 0xff, 0xff, 0xfa, 0x8f,
+    0xff, 0xff, 0xa8, 0xff, 0xff, 0xfa, 0x8f, 0xff,
+    0xff, 0xa8, 0xff, 0xff, 0xfa, 0x8f, 0xff, 0xff,
+    0xa8, 0xff, 0xff, 0xfa, 0x8f, 0xff, 0xff, 0xa8,
+    0xff, 0xff, 0xfa, 0x8f, 0xff, 0xff, 0xa8, 0xff,
+    0xff, 0xfa, 0x8f, 0xff, 0xff, 0xa8, 0xff, 0xff,
+    0xfa, 0x8f, 0xff, 0xff, 0xa8, 0xff, 0xff, 0xfa,
+    0x8f, 0xff, 0xff, 0xa8, 0xff, 0xff, 0xfa,
+    /* U+006D "m" */
+    0x12, 0x22, 0x22, 0x0, 0x0, 0x0, 0x38, 0xbe,
+    0xff, 0xed, 0xa5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5a, 0xde, 0xfe, 0xdb, 0x72, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0xff, 0x20, 0x0, 0x4c, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xe7, 0x0, 0x0, 0x0,
+    0x0, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb2,
+    0x0, 0x0, 0x6f, 0xff, 0xff, 0x20, 0xa, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0,
+    0x0, 0x2d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x50, 0x0, 0x6f, 0xff, 0xff, 0x21, 0xcf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
+    0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf4, 0x0, 0x6f, 0xff, 0xff, 0x2c,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x70, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0x10, 0x6f, 0xff, 0xff,
+    0xbf, 0xff, 0xff, 0xe9, 0x65, 0x67, 0xcf, 0xff,
+    0xff, 0xff, 0xf2, 0xef, 0xff, 0xff, 0xb7, 0x65,
+    0x7b, 0xff, 0xff, 0xff, 0xff, 0x80, 0x6f, 0xff,
+    0xff, 0xff, 0xff, 0xe6, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x91, 0x0,
+    0x0, 0x0, 0x2c, 0xff, 0xff, 0xff, 0xe0, 0x6f,
+    0xff, 0xff, 0xff, 0xfc, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xf3,
+    0x6f, 0xff, 0xff, 0xff, 0xe1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
+    0xf7, 0x6f, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xfa,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
+    0xff, 0xf9, 0x6f, 0xff, 0xff, 0xfd, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
+    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0xff, 0xfb, 0x6f, 0xff, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
+    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0xff, 0xfc, 0x6f, 0xff, 0xff, 0xf4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
+    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0xff, 0xfc, 0x6f, 0xff, 0xff,
+    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xff, 0xfc, 0x6f, 0xff,
+    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xdf, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xfc, 0x6f,
+    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0xff, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xfc,
+    0x6f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
+    0xfc, 0x6f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0xff, 0xfc, 0x6f, 0xff, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0xff, 0xfc, 0x6f, 0xff, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
+    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xff, 0xff, 0xfc, 0x6f, 0xff, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
+    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0xff, 0xfc, 0x6f, 0xff, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xff, 0xfc, 0x6f, 0xff,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xdf, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xfc, 0x6f,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0xff, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xfc,
+    0x6f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
+    0xfc, 0x6f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0xff, 0xfc, 0x6f, 0xff, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0xff, 0xfc, 0x6f, 0xff, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
+    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xff, 0xff, 0xfc, 0x6f, 0xff, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
+    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0xff, 0xfc, 0x6f, 0xff, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xff, 0xfc, 0x6f, 0xff,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xdf, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xfc, 0x6f,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0xff, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xfc,
+    0x6f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
+    0xfc, 0x6f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0xff, 0xfc, 0x6f, 0xff, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0xff, 0xfc, 0x6f, 0xff, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
+    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xff, 0xff, 0xfc, 0x6f, 0xff, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
+    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0xff, 0xfc,
+    /* U+006E "n" */
+    0x12, 0x22, 0x22, 0x0, 0x0, 0x0, 0x27, 0xad,
+    0xef, 0xfe, 0xc8, 0x40, 0x0, 0x0, 0x0, 0x6,
+    0xff, 0xff, 0xf2, 0x0, 0x3, 0xbf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xe6, 0x0, 0x0, 0x0, 0x6f,
+    0xff, 0xff, 0x20, 0x8, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfd, 0x30, 0x0, 0x6, 0xff,
+    0xff, 0xf2, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x30, 0x0, 0x6f, 0xff,
+    0xff, 0x2b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0x0, 0x6, 0xff, 0xff,
+    0xfa, 0xff, 0xff, 0xff, 0xb7, 0x65, 0x68, 0xdf,
+    0xff, 0xff, 0xff, 0xf8, 0x0, 0x6f, 0xff, 0xff,
+    0xff, 0xff, 0xf8, 0x10, 0x0, 0x0, 0x0, 0x5e,
+    0xff, 0xff, 0xff, 0xf1, 0x6, 0xff, 0xff, 0xff,
+    0xff, 0xd3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d,
+    0xff, 0xff, 0xff, 0x50, 0x6f, 0xff, 0xff, 0xff,
+    0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xff, 0xff, 0xfa, 0x6, 0xff, 0xff, 0xff, 0xf4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
+    0xff, 0xff, 0xd0, 0x6f, 0xff, 0xff, 0xfc, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xff, 0xff, 0x6, 0xff, 0xff, 0xff, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
+    0xff, 0xf0, 0x6f, 0xff, 0xff, 0xf3, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
+    0xff, 0x16, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
+    0xf1, 0x6f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
+    0x16, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf1,
+    0x6f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x16,
+    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf1, 0x6f,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x16, 0xff,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xf, 0xff, 0xff, 0xf1, 0x6f, 0xff,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xff, 0xff, 0x16, 0xff, 0xff,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xf, 0xff, 0xff, 0xf1, 0x6f, 0xff, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xff, 0x16, 0xff, 0xff, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0xff, 0xf1, 0x6f, 0xff, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xff, 0x16, 0xff, 0xff, 0xfc, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0xff, 0xf1, 0x6f, 0xff, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0xff, 0x16, 0xff, 0xff, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
+    0xff, 0xf1, 0x6f, 0xff, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0x16, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
+    0xf1, 0x6f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
+    0x16, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf1,
+    0x6f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x16,
+    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf1, 0x6f,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x16, 0xff,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xf, 0xff, 0xff, 0xf1, 0x6f, 0xff,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xff, 0xff, 0x10,
+    /* U+006F "o" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x59, 0xcd,
+    0xef, 0xfe, 0xb8, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3b, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xbf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xe3, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xd8, 0x42,
+    0x13, 0x59, 0xef, 0xff, 0xff, 0xff, 0xe2, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xfe, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
+    0xd0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
+    0xff, 0xff, 0x90, 0x0, 0x0, 0x8f, 0xff, 0xff,
+    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xff, 0xff, 0xff, 0x20, 0x0, 0xe, 0xff,
+    0xff, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xff, 0xff, 0xf9, 0x0, 0x5,
+    0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xf1,
+    0x0, 0xaf, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
+    0xff, 0x50, 0xf, 0xff, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
+    0xff, 0xff, 0xfa, 0x2, 0xff, 0xff, 0xff, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0xff, 0xff, 0xd0, 0x5f, 0xff, 0xff,
+    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0x7, 0xff,
+    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf2,
+    0x9f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
+    0xff, 0x49, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
+    0xff, 0xff, 0xf4, 0xaf, 0xff, 0xff, 0xa0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xff, 0x5a, 0xff, 0xff, 0xfa,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xf, 0xff, 0xff, 0xf4, 0xaf, 0xff,
+    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0x39,
+    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
+    0xf3, 0x7f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0xff, 0xff, 0x15, 0xff, 0xff, 0xff, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xff, 0xf0, 0x2f, 0xff, 0xff, 0xf4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0xff, 0xfd, 0x0, 0xff, 0xff,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0x90, 0xa,
+    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xf5,
+    0x0, 0x5f, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
+    0xff, 0x10, 0x0, 0xef, 0xff, 0xff, 0xe1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
+    0xff, 0xff, 0xa0, 0x0, 0x8, 0xff, 0xff, 0xff,
+    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0xe, 0xff,
+    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xef, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
+    0x4f, 0xff, 0xff, 0xff, 0xd4, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xff, 0xff, 0xfe, 0x10, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xfc, 0x73,
+    0x10, 0x24, 0x9e, 0xff, 0xff, 0xff, 0xff, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfd, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xcf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0x81, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x26, 0xac, 0xef,
+    0xfe, 0xdb, 0x84, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0,
+    /* U+0070 "p" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x27, 0xab,
+    0xcc, 0xb8, 0x51, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0xff, 0xf3, 0x0, 0x4, 0xcf, 0xff,
+    0xff, 0xff, 0xff, 0xfb, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0xff, 0x30, 0xa, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xa1, 0x0, 0x0,
+    0x0, 0x6, 0xff, 0xff, 0xf3, 0xc, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0x0,
+    0x0, 0x0, 0x6f, 0xff, 0xff, 0x3c, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
+    0x0, 0x0, 0x6, 0xff, 0xff, 0xfc, 0xff, 0xff,
+    0xfe, 0x83, 0x10, 0x25, 0xbf, 0xff, 0xff, 0xff,
+    0xe2, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff,
+    0xf9, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xff, 0xff,
+    0xff, 0xc0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xff,
+    0xff, 0xff, 0x60, 0x0, 0x6f, 0xff, 0xff, 0xff,
+    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e,
+    0xff, 0xff, 0xfe, 0x0, 0x6, 0xff, 0xff, 0xff,
+    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5f, 0xff, 0xff, 0xf5, 0x0, 0x6f, 0xff, 0xff,
+    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xbf, 0xff, 0xff, 0xb0, 0x6, 0xff, 0xff,
+    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0xff, 0xff, 0x10, 0x6f, 0xff,
+    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xf, 0xff, 0xff, 0xf5, 0x6, 0xff,
+    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0x90, 0x6f,
+    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xfc, 0x6,
+    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xe0,
+    0x6f, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff,
+    0x6, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
+    0xf1, 0x6f, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
+    0xff, 0x16, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
+    0xff, 0xf1, 0x6f, 0xff, 0xff, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
+    0xff, 0xff, 0x6, 0xff, 0xff, 0xf4, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xff, 0xff, 0xf0, 0x6f, 0xff, 0xff, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0xff, 0xff, 0xfd, 0x6, 0xff, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xff, 0xff, 0xb0, 0x6f, 0xff, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0xff, 0xff, 0xf8, 0x6, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xff, 0xff, 0xff, 0x40, 0x6f, 0xff, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0xff, 0xf0, 0x6, 0xff, 0xff,
+    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0xff, 0xff, 0xfa, 0x0, 0x6f, 0xff,
+    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xff, 0xff, 0xff, 0x30, 0x6, 0xff,
+    0xff, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x6f,
+    0xff, 0xff, 0xff, 0xfd, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xef, 0xff, 0xff, 0xf3, 0x0, 0x6,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0x40, 0x0, 0x0,
+    0x0, 0x6, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0,
+    0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0x21,
+    0x13, 0x7d, 0xff, 0xff, 0xff, 0xfd, 0x0, 0x0,
+    0x6, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x10, 0x0,
+    0x0, 0x6f, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x10, 0x0,
+    0x0, 0x6, 0xff, 0xff, 0xfc, 0x3, 0xdf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xff, 0xff, 0xc0, 0x0, 0x8f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x91, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xff, 0xff, 0xfc, 0x0, 0x0,
+    0x16, 0xbd, 0xff, 0xed, 0x95, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xfc, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+    /* U+0071 "q" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x7a, 0xcd,
+    0xcb, 0x95, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xdf, 0xff, 0xff,
+    0xff, 0xff, 0xf8, 0x10, 0x0, 0xaf, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x5, 0xef, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xe4, 0x0, 0xaf, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x60, 0xaf, 0xff, 0xfe,
+    0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf5, 0xaf, 0xff, 0xfe,
+    0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xe8, 0x31,
+    0x2, 0x5a, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xfe,
+    0x0, 0x4, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0x0, 0xd, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xfe,
+    0x0, 0x6f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0xfe,
+    0x0, 0xdf, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xfe,
+    0x3, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe,
+    0x8, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xfe,
+    0xc, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xfe,
+    0xf, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xfe,
+    0x3f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xfe,
+    0x5f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xfe,
+    0x6f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xfe,
+    0x7f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xfe,
+    0x8f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xfe,
+    0x8f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xfe,
+    0x7f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xfe,
+    0x6f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xfe,
+    0x4f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xfe,
+    0x2f, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xfe,
+    0xf, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xfe,
+    0xb, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xfe,
+    0x6, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfe,
+    0x1, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xfe,
+    0x0, 0xaf, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xfe,
+    0x0, 0x3f, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xfe,
+    0x0, 0x9, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xfe,
+    0x0, 0x1, 0xef, 0xff, 0xff, 0xfd, 0x30, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xfb, 0x52,
+    0x11, 0x38, 0xef, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x3e, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xb4, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x1, 0xbf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf9, 0x4, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xdf, 0xff, 0xff,
+    0xff, 0xff, 0xfc, 0x30, 0x4, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x8b, 0xef,
+    0xfe, 0xc8, 0x30, 0x0, 0x4, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfe,
+    /* U+0072 "r" */
+    0x12, 0x22, 0x22, 0x0, 0x0, 0x18, 0xdf, 0xfd,
+    0xa5, 0x0, 0x7, 0xff, 0xff, 0xf1, 0x0, 0x5f,
+    0xff, 0xff, 0xff, 0xfe, 0x60, 0x7f, 0xff, 0xff,
+    0x10, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x17,
+    0xff, 0xff, 0xf1, 0x2f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xb0, 0x7f, 0xff, 0xff, 0x1d, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf5, 0x7, 0xff, 0xff, 0xf8,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x7f,
+    0xff, 0xff, 0xff, 0xff, 0xfc, 0x75, 0x69, 0xef,
+    0x90, 0x7, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x0,
+    0x0, 0x0, 0x52, 0x0, 0x7f, 0xff, 0xff, 0xff,
+    0xe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
+    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0xff, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
+    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xfb, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
+    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0xff, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
+    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0,
+    /* U+0073 "s" */
+    0x0, 0x0, 0x0, 0x0, 0x4, 0x8b, 0xde, 0xff,
+    0xed, 0xa7, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xaf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xe9, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0xa,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x6, 0xff,
+    0xff, 0xff, 0xfa, 0x63, 0x11, 0x12, 0x59, 0xef,
+    0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0xef, 0xff,
+    0xff, 0xc2, 0x0, 0x0, 0x0, 0x0, 0x1, 0xaf,
+    0xff, 0xff, 0xfd, 0x0, 0x0, 0x5f, 0xff, 0xff,
+    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xff, 0xff, 0xf4, 0x0, 0x9, 0xff, 0xff, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
+    0xff, 0xff, 0x90, 0x0, 0xcf, 0xff, 0xff, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xff, 0xfc, 0x0, 0xd, 0xff, 0xff, 0xf4, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xca,
+    0x86, 0x30, 0x0, 0xcf, 0xff, 0xff, 0xa0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xd5, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xc7,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xea, 0x51, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfc, 0x83, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfd, 0x82, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfa, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x49, 0xef, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x27, 0xbf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x8c, 0xff,
+    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x8f,
+    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xff, 0xff, 0xff, 0x10, 0x0, 0x25, 0x72, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
+    0xff, 0xff, 0xf3, 0x8d, 0xff, 0xff, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
+    0xff, 0xff, 0x48, 0xff, 0xff, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
+    0xff, 0xf3, 0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
+    0xff, 0x10, 0xef, 0xff, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff,
+    0xd0, 0x8, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xf7,
+    0x0, 0x1f, 0xff, 0xff, 0xff, 0xb1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0,
+    0x0, 0x6f, 0xff, 0xff, 0xff, 0xfa, 0x63, 0x10,
+    0x12, 0x48, 0xef, 0xff, 0xff, 0xff, 0x50, 0x0,
+    0x0, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x18, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xd6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x47, 0xad, 0xef, 0xff, 0xec, 0xa7,
+    0x20, 0x0, 0x0, 0x0, 0x0,
+    /* U+0074 "t" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x19, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xef, 0xd0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xcf, 0xff,
+    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
+    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xff, 0xff, 0xd0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xd0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
+    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
+    0xff, 0xd0, 0x0, 0x0, 0x0, 0x9c, 0xcc, 0xdf,
+    0xff, 0xff, 0xfc, 0xcc, 0xcc, 0xc0, 0xcf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xcf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xd0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
+    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
+    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xff, 0xff, 0xd0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xd0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
+    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
+    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xff, 0xff, 0xd0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xd0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
+    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
+    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3f, 0xff, 0xff, 0xe0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
+    0xfc, 0x10, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
+    0xff, 0xff, 0xfc, 0xbc, 0xe1, 0x0, 0x0, 0xb,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0,
+    0x4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xf9,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0x28, 0xce, 0xff,
+    0xed, 0xb7,
+    /* U+0075 "u" */
+    0x8f, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfe, 0x8f,
+    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0xff, 0xfe, 0x8f, 0xff,
+    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xff, 0xfe, 0x8f, 0xff, 0xff,
+    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0xff, 0xfe, 0x8f, 0xff, 0xff, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0xff, 0xfe, 0x8f, 0xff, 0xff, 0xa0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
+    0xff, 0xfe, 0x8f, 0xff, 0xff, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
+    0xfe, 0x8f, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfe,
+    0x8f, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfe, 0x8f,
+    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0xff, 0xfe, 0x8f, 0xff,
+    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xff, 0xfe, 0x8f, 0xff, 0xff,
+    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0xff, 0xfe, 0x8f, 0xff, 0xff, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0xff, 0xfe, 0x8f, 0xff, 0xff, 0xa0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
+    0xff, 0xfe, 0x8f, 0xff, 0xff, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
+    0xfe, 0x8f, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfe,
+    0x8f, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfe, 0x8f,
+    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0xff, 0xfe, 0x8f, 0xff,
+    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xff, 0xfe, 0x8f, 0xff, 0xff,
+    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0xff, 0xfe, 0x8f, 0xff, 0xff, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0xff, 0xfe, 0x8f, 0xff, 0xff, 0xa0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0xff, 0xfe, 0x8f, 0xff, 0xff, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
+    0xfe, 0x8f, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xfe,
+    0x7f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfe, 0x6f,
+    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xe, 0xff, 0xff, 0xfe, 0x5f, 0xff,
+    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xcf, 0xff, 0xff, 0xfe, 0xf, 0xff, 0xff, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0xff, 0xff, 0xfe, 0xb, 0xff, 0xff, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
+    0xff, 0xfe, 0x6, 0xff, 0xff, 0xff, 0xfa, 0x10,
+    0x0, 0x0, 0x0, 0x4c, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0x0, 0xef, 0xff, 0xff, 0xff, 0xfa, 0x65,
+    0x46, 0x9d, 0xff, 0xff, 0xfd, 0xaf, 0xff, 0xfe,
+    0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xe2, 0x9f, 0xff, 0xfe, 0x0,
+    0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0x30, 0x9f, 0xff, 0xfe, 0x0, 0x0,
+    0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xc1, 0x0, 0x9f, 0xff, 0xfe, 0x0, 0x0, 0x1,
+    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x0,
+    0x0, 0x9f, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
+    0x59, 0xce, 0xff, 0xec, 0x94, 0x0, 0x0, 0x0,
+    0x12, 0x22, 0x22,
+    /* U+0076 "v" */
+    0xe, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
+    0xff, 0x0, 0x8f, 0xff, 0xff, 0xe0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
+    0xff, 0xff, 0x90, 0x2, 0xff, 0xff, 0xff, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xff, 0xff, 0xf3, 0x0, 0xc, 0xff, 0xff,
+    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x6f,
+    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0x70, 0x0,
+    0x0, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf1,
+    0x0, 0x0, 0x9, 0xff, 0xff, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
+    0xfb, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
+    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0xdf, 0xff,
+    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x1f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
+    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
+    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
+    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0xd, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x3, 0xff, 0xff, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
+    0xb0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0xff, 0x10, 0x0, 0x0, 0xe, 0xff, 0xff,
+    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xa, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x4, 0xff,
+    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0,
+    0xaf, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0x20,
+    0x0, 0x1f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
+    0xf7, 0x0, 0x6, 0xff, 0xff, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
+    0xff, 0xff, 0xd0, 0x0, 0xcf, 0xff, 0xff, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xbf, 0xff, 0xff, 0x20, 0x1f, 0xff, 0xff,
+    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xff, 0xf8, 0x7, 0xff,
+    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xc0,
+    0xcf, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
+    0xff, 0x3f, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xff, 0xff, 0xfc, 0xff, 0xff, 0xf4, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
+    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
+    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0xff, 0xf0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    /* U+0077 "w" */
+    0xaf, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
+    0xfd, 0x5f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xd0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
+    0xff, 0xf8, 0xf, 0xff, 0xff, 0xf4, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff,
+    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xff, 0xf3, 0xb, 0xff, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
+    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0xff, 0xe0, 0x6, 0xff, 0xff, 0xfd,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
+    0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5f, 0xff, 0xff, 0x90, 0x1, 0xff, 0xff,
+    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
+    0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xff, 0xff, 0x40, 0x0, 0xcf,
+    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xff, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xef, 0xff, 0xfe, 0x0, 0x0,
+    0x7f, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xef, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfa, 0x0,
+    0x0, 0x2f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xf5,
+    0x0, 0x0, 0xd, 0xff, 0xff, 0xf3, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0xff, 0xca, 0xff, 0xff,
+    0xe0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff,
+    0xf0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0x86, 0xff,
+    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
+    0xff, 0xb0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0x32,
+    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x6f,
+    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0xef, 0xff,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
+    0x0, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0xaf,
+    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x8f, 0xff,
+    0xfb, 0x0, 0xbf, 0xff, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0x5f, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0xdf,
+    0xff, 0xf7, 0x0, 0x7f, 0xff, 0xff, 0x30, 0x0,
+    0x0, 0x5, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
+    0x0, 0xf, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x1,
+    0xff, 0xff, 0xf2, 0x0, 0x3f, 0xff, 0xff, 0x80,
+    0x0, 0x0, 0x9, 0xff, 0xff, 0xf1, 0x0, 0x0,
+    0x0, 0x0, 0xb, 0xff, 0xff, 0xf2, 0x0, 0x0,
+    0x5, 0xff, 0xff, 0xe0, 0x0, 0xf, 0xff, 0xff,
+    0xc0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xf6, 0x0,
+    0x0, 0xa, 0xff, 0xff, 0xa0, 0x0, 0xb, 0xff,
+    0xff, 0xf0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x70,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfb,
+    0x0, 0x0, 0xe, 0xff, 0xff, 0x60, 0x0, 0x6,
+    0xff, 0xff, 0xf4, 0x0, 0x0, 0x8f, 0xff, 0xff,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
+    0xff, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x10, 0x0,
+    0x2, 0xff, 0xff, 0xf8, 0x0, 0x0, 0xdf, 0xff,
+    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0xff, 0x40, 0x0, 0x7f, 0xff, 0xfd, 0x0,
+    0x0, 0x0, 0xef, 0xff, 0xfc, 0x0, 0x1, 0xff,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2f, 0xff, 0xff, 0x80, 0x0, 0xbf, 0xff, 0xf9,
+    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0x10, 0x6,
+    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xd, 0xff, 0xff, 0xd0, 0x0, 0xff, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0x50,
+    0xb, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xff, 0xf1, 0x3, 0xff,
+    0xff, 0xf1, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
+    0x90, 0xf, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf6, 0x7,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0xd, 0xff,
+    0xff, 0xd0, 0x4f, 0xff, 0xff, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xfa,
+    0xc, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0xff, 0xf1, 0x9f, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
+    0xfe, 0xf, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0xff, 0xf6, 0xef, 0xff, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
+    0xff, 0xff, 0x7f, 0xff, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0xff, 0xef, 0xff, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xff,
+    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
+    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
+    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff,
+    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
+    0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff,
+    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
+    0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xff, 0xff, 0xff, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xd, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x0,
+    /* U+0078 "x" */
+    0x1, 0x22, 0x22, 0x22, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x22, 0x22, 0x22,
+    0x21, 0x0, 0x1e, 0xff, 0xff, 0xff, 0xa0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
+    0xff, 0xfe, 0x10, 0x0, 0x5f, 0xff, 0xff, 0xff,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e,
+    0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x9f, 0xff,
+    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0xdf, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xf2, 0x0,
+    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xd0,
+    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
+    0xff, 0x90, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
+    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
+    0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x4f, 0xff,
+    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5f, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x1e,
+    0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xf8, 0x0,
+    0xb, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xff, 0xff,
+    0xf2, 0x7, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
+    0xff, 0xff, 0xc2, 0xff, 0xff, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff,
+    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
+    0xff, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff,
+    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e,
+    0xff, 0xff, 0xfe, 0x2e, 0xff, 0xff, 0xfe, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xa, 0xff, 0xff, 0xff, 0x50, 0x5f, 0xff, 0xff,
+    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0xff, 0xff, 0xa0, 0x0, 0xbf,
+    0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xe1, 0x0,
+    0x1, 0xef, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xf5,
+    0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
+    0xfa, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff,
+    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
+    0xff, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x1e, 0xff,
+    0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0xd,
+    0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
+    0x9, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xbf, 0xff, 0xff, 0xf9, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xff, 0xff, 0xe1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf4,
+    0x0, 0x0, 0x1, 0xef, 0xff, 0xff, 0xf4, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
+    0xff, 0xe1, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xfa,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xff, 0xff, 0xb0, 0x0, 0x6f, 0xff, 0xff,
+    0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1f, 0xff, 0xff, 0xff, 0x60, 0x2f, 0xff,
+    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0x20,
+    /* U+0079 "y" */
+    0xbf, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff,
+    0xf3, 0x4f, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
+    0xff, 0xd0, 0xe, 0xff, 0xff, 0xfa, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
+    0xff, 0xff, 0x70, 0x8, 0xff, 0xff, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0xff, 0xff, 0x10, 0x2, 0xff, 0xff, 0xff,
+    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0xff, 0xfb, 0x0, 0x0, 0xcf, 0xff,
+    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x6f,
+    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2f, 0xff, 0xff, 0xe0, 0x0, 0x0,
+    0x1f, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0x90, 0x0,
+    0x0, 0xa, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0x30,
+    0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfd,
+    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
+    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
+    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
+    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
+    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0xd, 0xff, 0xff, 0xf3, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf1,
+    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff,
+    0xf6, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0x70,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0xff, 0xff, 0x20, 0x0, 0x4, 0xff, 0xff,
+    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xbf, 0xff, 0xff, 0x70, 0x0, 0xa, 0xff,
+    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5f, 0xff, 0xff, 0xd0, 0x0, 0xf,
+    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xf2, 0x0,
+    0x5f, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xf7,
+    0x0, 0xaf, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
+    0xfd, 0x0, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
+    0xff, 0xff, 0x14, 0xff, 0xff, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xff, 0x68, 0xff, 0xff, 0xf1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1f, 0xff, 0xff, 0xac, 0xff, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff,
+    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
+    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
+    0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xff, 0xff, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xe0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
+    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x25, 0x20, 0x1,
+    0x4b, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xd, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0x70,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0x9c, 0xef, 0xec, 0x71,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+    /* U+007A "z" */
+    0x4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
+    0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x60, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf6, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x60, 0x3, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xff, 0xff,
+    0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0xff,
+    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xff,
+    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
+    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
+    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
+    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
+    0xff, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
+    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
+    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff,
+    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xff,
+    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
+    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xff, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xff, 0xff, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef,
+    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef,
+    0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
+    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
+    0xff, 0xff, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
+    0xff, 0xff, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
+    0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xff, 0xff, 0xff, 0x70, 0x12, 0x33, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x29,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x8a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf8, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x8a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf8,
+    /* U+007B "{" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0x45, 0x55, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0x9f, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff,
+    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x0,
+    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xfd, 0x62,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xb, 0xff, 0xff, 0xf1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
+    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xef, 0xff, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xf, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xfc, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
+    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xff, 0xff, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
+    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xff, 0xff, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xd0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0xcf, 0xff, 0xff, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0xff, 0xfc, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
+    0xff, 0xc2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x26, 0xdf, 0xff, 0xff, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xbf, 0xff, 0xff, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xf, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xfc, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xe, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xdf, 0xff, 0xfd, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
+    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xa, 0xff, 0xff, 0xf1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
+    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0xff, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xb8, 0x65,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
+    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xef, 0xff, 0xff, 0xff, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xbf, 0xff,
+    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x39, 0xce, 0xff, 0xfb,
+    /* U+007C "|" */
+    0x48, 0x88, 0x86, 0x9f, 0xff, 0xfc, 0x9f, 0xff,
+    0xfc, 0x9f, 0xff, 0xfc, 0x9f, 0xff, 0xfc, 0x9f,
+    0xff, 0xfc, 0x9f, 0xff, 0xfc, 0x9f, 0xff, 0xfc,
+    0x9f, 0xff, 0xfc, 0x9f, 0xff, 0xfc, 0x9f, 0xff,
+    0xfc, 0x9f, 0xff, 0xfc, 0x9f, 0xff, 0xfc, 0x9f,
+    0xff, 0xfc, 0x9f, 0xff, 0xfc, 0x9f, 0xff, 0xfc,
+    0x9f, 0xff, 0xfc, 0x9f, 0xff, 0xfc, 0x9f, 0xff,
+    0xfc, 0x9f, 0xff, 0xfc, 0x9f, 0xff, 0xfc, 0x9f,
+    0xff, 0xfc, 0x9f, 0xff, 0xfc, 0x9f, 0xff, 0xfc,
+    0x9f, 0xff, 0xfc, 0x9f, 0xff, 0xfc, 0x9f, 0xff,
+    0xfc, 0x9f, 0xff, 0xfc, 0x9f, 0xff, 0xfc, 0x9f,
+    0xff, 0xfc, 0x9f, 0xff, 0xfc, 0x9f, 0xff, 0xfc,
+    0x9f, 0xff, 0xfc, 0x9f, 0xff, 0xfc, 0x9f, 0xff,
+    0xfc, 0x9f, 0xff, 0xfc, 0x9f, 0xff, 0xfc, 0x9f,
+    0xff, 0xfc, 0x9f, 0xff, 0xfc, 0x9f, 0xff, 0xfc,
+    0x9f, 0xff, 0xfc, 0x9f, 0xff, 0xfc, 0x9f, 0xff,
+    0xfc, 0x9f, 0xff, 0xfc, 0x9f, 0xff, 0xfc, 0x9f,
+    0xff, 0xfc, 0x9f, 0xff, 0xfc, 0x9f, 0xff, 0xfc,
+    0x9f, 0xff, 0xfc, 0x9f, 0xff, 0xfc, 0x9f, 0xff,
+    0xfc, 0x9f, 0xff, 0xfc, 0x9f, 0xff, 0xfc, 0x9f,
+    0xff, 0xfc, 0x9f, 0xff, 0xfc, 0x9f, 0xff, 0xfc,
+    0x9f, 0xff, 0xfc, 0x9f, 0xff, 0xfc, 0x9f, 0xff,
+    0xfc, 0x9f, 0xff, 0xfc, 0x9f, 0xff, 0xfc, 0x9f,
+    0xff, 0xfc, 0x9f, 0xff, 0xfc, 0x9f, 0xff, 0xfc,
+    0x9f, 0xff, 0xfc, 0x9f, 0xff, 0xfc,
+    /* U+007D "}" */
+    0x25, 0x55, 0x43, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xb4, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
+    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x49, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xbf, 0xff, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xf1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf4, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
+    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5f, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0xff, 0xff, 0xf0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xb, 0xff, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xff,
+    0xfb, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xff, 0xff, 0xff, 0xda, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3d, 0xff, 0xff, 0xff, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x19, 0xff,
+    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3c, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0x60,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff,
+    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
+    0xff, 0xff, 0xf8, 0x31, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0xff, 0xd2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xf2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xe, 0xff, 0xff, 0xd0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfa,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0x60,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
+    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
+    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0xff, 0xf3, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xd0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xff,
+    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x25, 0x67,
+    0xaf, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff,
+    0xf3, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
+    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xff, 0xff, 0xff, 0xe4, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xff, 0xff, 0xda, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0,
+    /* U+007E "~" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x7b, 0xdf, 0xfe,
+    0xda, 0x73, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0x0, 0x1, 0xaf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xd8, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xbf, 0x0, 0x5f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xff,
+    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0x82, 0x0, 0x0, 0x0, 0x2a,
+    0xff, 0xff, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc9, 0x77,
+    0x9d, 0xff, 0xff, 0xff, 0xf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf, 0xff,
+    0xff, 0xfc, 0x97, 0x79, 0xcf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf, 0xff, 0xf8, 0x10, 0x0, 0x0, 0x1, 0x6c,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf7, 0xf, 0xfd, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x39, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0x50, 0xf, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x17, 0xdf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x91, 0x0, 0x9, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0x8b, 0xdf, 0xfe, 0xda, 0x61, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+    /* U+00C4 "Ä" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0xff, 0x50, 0x0, 0x0, 0x4f, 0xff, 0xff,
+    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0xff, 0x60, 0x0, 0x0, 0x4f, 0xff, 0xff,
+    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0xff, 0x60, 0x0, 0x0, 0x4f, 0xff, 0xff,
+    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0xff, 0x60, 0x0, 0x0, 0x4f, 0xff, 0xff,
+    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0xff, 0x60, 0x0, 0x0, 0x4f, 0xff, 0xff,
+    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0xff, 0x60, 0x0, 0x0, 0x4f, 0xff, 0xff,
+    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0xff, 0x60, 0x0, 0x0, 0x4f, 0xff, 0xff,
+    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xee, 0xee, 0xee, 0xe6, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xff, 0xff, 0xff, 0xfd, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xef, 0xff, 0xfe, 0xff, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xff, 0xff, 0xf6, 0xff, 0xff, 0xfe, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xff, 0xf0, 0xcf, 0xff, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xff, 0xff, 0xc0, 0x7f, 0xff, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xff, 0x90, 0x2f, 0xff, 0xff, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0xff, 0xff, 0x40, 0xc, 0xff, 0xff, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0xff, 0xff, 0x0, 0x7, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0xff, 0xff, 0xfa, 0x0, 0x1, 0xff, 0xff, 0xff,
+    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
+    0xff, 0xff, 0xf5, 0x0, 0x0, 0xbf, 0xff, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
+    0xff, 0xff, 0xf0, 0x0, 0x0, 0x5f, 0xff, 0xff,
+    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
+    0xff, 0xff, 0xa0, 0x0, 0x0, 0xf, 0xff, 0xff,
+    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0xff, 0xff, 0x40, 0x0, 0x0, 0x9, 0xff, 0xff,
+    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xff, 0xfe, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
+    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
+    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
+    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
+    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
+    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
+    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff,
+    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
+    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
+    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
+    0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff,
+    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
+    0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xfa,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0xdf, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xf4, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xe0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1f, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0,
+    0x0, 0x0, 0x1f, 0xff, 0xff, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0xff, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xff, 0xf6, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0xff, 0xf1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x40, 0x0,
+    0x0, 0x3, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xb0, 0x0,
+    0x0, 0x9, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xf2, 0x0,
+    0x0, 0xf, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xf8, 0x0,
+    0x0, 0x6f, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xfe, 0x0,
+    0x0, 0xcf, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0x50,
+    0x2, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xc0,
+    0x8, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xf2,
+    0xe, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xf9,
+    /* U+00C5 "Å" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x67, 0x62, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xaf, 0xff, 0xff, 0xb1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xd, 0xff, 0xff, 0xff, 0xfe, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0xfc, 0x30, 0x18, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xff, 0xc0, 0x0, 0x0, 0x7f, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0x30, 0x0, 0x0, 0xe, 0xf9, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0x0, 0x0, 0x0, 0xb, 0xfb, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0x20, 0x0, 0x0, 0xd, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0x80, 0x0, 0x0, 0x3f, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xef, 0xf5, 0x0, 0x2, 0xdf, 0xf2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xff, 0xc9, 0xaf, 0xff, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xef, 0xff, 0xfe, 0xff, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xfd, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xa, 0xff, 0xff, 0xf1, 0xdf, 0xff, 0xff, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xff, 0xff, 0xd0, 0x7f, 0xff, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xff, 0x90, 0x2f, 0xff, 0xff, 0xf1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0xff, 0xff, 0x50, 0xd, 0xff, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0xff, 0xff, 0x0, 0x7, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xff, 0xfa, 0x0, 0x1, 0xff, 0xff, 0xff,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0xff, 0xf5, 0x0, 0x0, 0xcf, 0xff, 0xff,
+    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
+    0xff, 0xff, 0xf0, 0x0, 0x0, 0x6f, 0xff, 0xff,
+    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
+    0xff, 0xff, 0xa0, 0x0, 0x0, 0xf, 0xff, 0xff,
+    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
+    0xff, 0xff, 0x40, 0x0, 0x0, 0xa, 0xff, 0xff,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0xff, 0xfe, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
+    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
+    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
+    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
+    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
+    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
+    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff,
+    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
+    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
+    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff,
+    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
+    0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xfa,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0xdf, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xf4, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xe0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1f, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0,
+    0x0, 0x0, 0x1f, 0xff, 0xff, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0xff, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xff, 0xff, 0xf6, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xff, 0xfd, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0xff, 0xf1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x40, 0x0,
+    0x0, 0x3, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xb0, 0x0,
+    0x0, 0x9, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xf2, 0x0,
+    0x0, 0xf, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xf8, 0x0,
+    0x0, 0x5f, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xfe, 0x0,
+    0x0, 0xcf, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0x50,
+    0x2, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xc0,
+    0x8, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xf2,
+    0xe, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xf9,
+    /* U+00C9 "É" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x38, 0x88, 0x88, 0x88, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xfe,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xfa,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xff, 0xff, 0xfe, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xf4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
+    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6e,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xa0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xc0, 0x7f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
+    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xc0, 0x7f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x7f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xc0, 0x7f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xff, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
+    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xff, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
+    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xff, 0xfe, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xc0,
+    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xe0, 0x0, 0x7f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x7f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xe0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xe0, 0x0, 0x7f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0,
+    0x7f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xff, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
+    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xff, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
+    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0x7f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff,
+    /* U+00D6 "Ö" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
+    0xff, 0xff, 0xf0, 0x0, 0x0, 0x9, 0xff, 0xff,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x9f, 0xff,
+    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5f, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x9, 0xff,
+    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x9f,
+    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5f, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x9,
+    0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0,
+    0x9f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5f, 0xff, 0xff, 0xf1, 0x0, 0x0,
+    0x9, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x46, 0x89,
+    0xaa, 0x98, 0x75, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0x8d, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfa, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5c, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xdf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xe4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1c, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2e, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xa6, 0x31, 0x0, 0x12, 0x48, 0xcf, 0xff,
+    0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2e, 0xff, 0xff, 0xff, 0xff,
+    0xd6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x28,
+    0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0xfe,
+    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xaf, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xfc,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xfa,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xe1,
+    0x0, 0x0, 0x0, 0x1, 0xef, 0xff, 0xff, 0xfa,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xfd,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
+    0xff, 0x20, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
+    0xff, 0xfa, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
+    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0xff, 0xff, 0xf1, 0x0, 0x0, 0xdf, 0xff, 0xff,
+    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0xff, 0xff, 0xff, 0x70, 0x0, 0x2f, 0xff, 0xff,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xff, 0xff, 0xfd, 0x0, 0x7, 0xff, 0xff,
+    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xdf, 0xff, 0xff, 0xf1, 0x0, 0xbf, 0xff,
+    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0xff, 0xff, 0x60, 0xe, 0xff,
+    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xff, 0xff, 0xf9, 0x1, 0xff,
+    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xc0, 0x4f,
+    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xff, 0x5,
+    0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xf1,
+    0x7f, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff,
+    0x28, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
+    0xf3, 0x9f, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
+    0xff, 0x49, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
+    0xff, 0xf4, 0x9f, 0xff, 0xff, 0xf3, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xff, 0xff, 0x38, 0xff, 0xff, 0xff, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
+    0xff, 0xff, 0xf2, 0x7f, 0xff, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xff, 0xff, 0x15, 0xff, 0xff, 0xff, 0x70,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0xff, 0xfd, 0x0, 0xff, 0xff, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xff, 0xff, 0xff, 0xa0, 0xc, 0xff, 0xff,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0xff, 0xf7, 0x0, 0x8f, 0xff,
+    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0xff, 0xff, 0x30, 0x3, 0xff,
+    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0xff, 0xff, 0xe0, 0x0, 0xe,
+    0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xff, 0xff, 0xf9, 0x0, 0x0,
+    0x8f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xe, 0xff, 0xff, 0xff, 0x30, 0x0,
+    0x1, 0xff, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xc0, 0x0,
+    0x0, 0x9, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xfc, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0x70,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xcf, 0xff, 0xff, 0xff, 0x90,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xff, 0xff,
+    0xff, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xef, 0xff, 0xff, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
+    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2a, 0xff, 0xff, 0xff, 0xff, 0xe1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x94, 0x0, 0x0, 0x0,
+    0x0, 0x26, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xe2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0xba,
+    0xbc, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x18, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x6c, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x58,
+    0xbd, 0xef, 0xfe, 0xdc, 0xa7, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    /* U+00DC "Ü" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
+    0xe0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0xb,
+    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
+    0xf0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfb, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0xb,
+    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
+    0xf0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfb, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0xb,
+    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
+    0xf0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfb, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7e, 0xee, 0xee, 0xe2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xa, 0xee, 0xee, 0xed, 0x8f, 0xff, 0xff, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfe,
+    0x8f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xff, 0xfe, 0x8f, 0xff, 0xff, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfe,
+    0x8f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xff, 0xfe, 0x8f, 0xff, 0xff, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfe,
+    0x8f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xff, 0xfe, 0x8f, 0xff, 0xff, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfe,
+    0x8f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xff, 0xfe, 0x8f, 0xff, 0xff, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfe,
+    0x8f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xff, 0xfe, 0x8f, 0xff, 0xff, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfe,
+    0x8f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xff, 0xfe, 0x8f, 0xff, 0xff, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfe,
+    0x8f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xff, 0xfe, 0x8f, 0xff, 0xff, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfe,
+    0x8f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xff, 0xfe, 0x8f, 0xff, 0xff, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfe,
+    0x8f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xff, 0xfe, 0x8f, 0xff, 0xff, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfe,
+    0x8f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xff, 0xfe, 0x8f, 0xff, 0xff, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfe,
+    0x8f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xff, 0xfe, 0x8f, 0xff, 0xff, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfe,
+    0x8f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xff, 0xfe, 0x8f, 0xff, 0xff, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfe,
+    0x8f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xff, 0xfe, 0x8f, 0xff, 0xff, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfe,
+    0x8f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfe,
+    0x7f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0xff, 0xff, 0xfd, 0x6f, 0xff, 0xff, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xfd,
+    0x6f, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xd, 0xff, 0xff, 0xfc, 0x4f, 0xff, 0xff, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xfb,
+    0x3f, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xff, 0xff, 0xf9, 0x1f, 0xff, 0xff, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf8,
+    0xf, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xff, 0xff, 0xf5, 0xb, 0xff, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xf2,
+    0x8, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xff, 0xf0, 0x4, 0xff, 0xff, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xa0,
+    0x0, 0xef, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
+    0xff, 0xff, 0xff, 0x50, 0x0, 0x9f, 0xff, 0xff,
+    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xfe, 0x0,
+    0x0, 0x2f, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
+    0xff, 0xff, 0xf7, 0x0, 0x0, 0x9, 0xff, 0xff,
+    0xff, 0xff, 0xa2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xef, 0xff, 0xff, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xc7,
+    0x41, 0x0, 0x0, 0x13, 0x6a, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x2e, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xef, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xd2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6e, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xc7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x7a,
+    0xce, 0xef, 0xff, 0xed, 0xb8, 0x51, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0,
+    /* U+00E4 "ä" */
+    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0x10,
+    0x0, 0x0, 0x9f, 0xff, 0xff, 0xd0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff,
+    0x10, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
+    0xff, 0x10, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xd0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0xff, 0xff, 0x10, 0x0, 0x0, 0x9f, 0xff, 0xff,
+    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x9f, 0xff,
+    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x9f,
+    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0,
+    0x9f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0x7a, 0xce, 0xff, 0xff, 0xec,
+    0xa7, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x29, 0xef, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2a, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x30, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff,
+    0xb6, 0x42, 0x11, 0x24, 0x7b, 0xff, 0xff, 0xff,
+    0xff, 0xc0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff,
+    0xc2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2c, 0xff,
+    0xff, 0xff, 0xf3, 0x0, 0x0, 0x3f, 0xff, 0xff,
+    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xff, 0xff, 0xf8, 0x0, 0x0, 0xaf, 0xff,
+    0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xe, 0xff, 0xff, 0xfc, 0x0, 0x0, 0xff,
+    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0xff, 0xfe, 0x0, 0x3,
+    0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0x0,
+    0x1, 0x57, 0x9b, 0xdb, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x8d,
+    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0x47, 0xad, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x14, 0x79, 0xbd, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0x8e, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x2, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfb, 0x64, 0xff, 0xff, 0xff,
+    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xda, 0x63, 0x0, 0x3, 0xff, 0xff,
+    0xff, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff,
+    0xda, 0x74, 0x20, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0xff, 0xff, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff,
+    0x71, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0xff, 0xff, 0x0, 0xa, 0xff, 0xff, 0xff,
+    0xc1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xff, 0xff, 0xff, 0x0, 0xf, 0xff, 0xff,
+    0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xff, 0xff, 0xff, 0x0, 0x4f, 0xff,
+    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0x0, 0x6f,
+    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xff, 0x0,
+    0x7f, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff,
+    0x10, 0x6f, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
+    0xff, 0x10, 0x4f, 0xff, 0xff, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
+    0xff, 0xff, 0x20, 0x1f, 0xff, 0xff, 0xfe, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
+    0xff, 0xff, 0xff, 0x20, 0xb, 0xff, 0xff, 0xff,
+    0xd1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3d, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x40, 0x3, 0xff, 0xff,
+    0xff, 0xff, 0x82, 0x0, 0x0, 0x2, 0x6c, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0xaf,
+    0xff, 0xff, 0xff, 0xff, 0xfd, 0xcd, 0xff, 0xff,
+    0xff, 0xff, 0xf5, 0x8f, 0xff, 0xff, 0x90, 0x0,
+    0xc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfc, 0x20, 0x5f, 0xff, 0xff, 0xd0,
+    0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0x70, 0x0, 0x1f, 0xff, 0xff,
+    0xf3, 0x0, 0x0, 0x5, 0xcf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0x71, 0x0, 0x0, 0xb, 0xff,
+    0xff, 0xfa, 0x0, 0x0, 0x0, 0x3, 0x7a, 0xde,
+    0xff, 0xed, 0xa7, 0x30, 0x0, 0x0, 0x0, 0x1,
+    0x33, 0x33, 0x32,
+    /* U+00E5 "å" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0x67, 0x51, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xcf, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xef, 0xf8, 0x10, 0x3c, 0xff, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0x60, 0x0, 0x0, 0xcf, 0xe0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0xfe, 0x0, 0x0, 0x0, 0x4f,
+    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xe, 0xfb, 0x0, 0x0, 0x0,
+    0x1f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xd, 0xfc, 0x0, 0x0,
+    0x0, 0x2f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0x20,
+    0x0, 0x0, 0x8f, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
+    0xd2, 0x0, 0x5, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xff, 0xa9, 0xcf, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5b, 0xef, 0xd8, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0x7a, 0xce, 0xff,
+    0xff, 0xec, 0xa7, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x29, 0xef, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2a, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf6, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x30, 0x0, 0x0, 0x2, 0xff, 0xff,
+    0xff, 0xff, 0xb6, 0x42, 0x11, 0x24, 0x7b, 0xff,
+    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0xb, 0xff,
+    0xff, 0xff, 0xc2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2c, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x3f,
+    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xaf, 0xff, 0xff, 0xf8, 0x0, 0x0,
+    0xaf, 0xff, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xfc, 0x0,
+    0x0, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xfe,
+    0x0, 0x3, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
+    0xff, 0x0, 0x1, 0x57, 0x9b, 0xdb, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0x8d, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x47,
+    0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x14, 0x79, 0xbd, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0x8e, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x2, 0xbf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x64, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xda, 0x63, 0x0, 0x3,
+    0xff, 0xff, 0xff, 0x0, 0x0, 0x6f, 0xff, 0xff,
+    0xff, 0xff, 0xda, 0x74, 0x20, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0xff, 0xff, 0x0, 0x2, 0xff, 0xff,
+    0xff, 0xff, 0x71, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xff, 0xff, 0x0, 0xa, 0xff,
+    0xff, 0xff, 0xc1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0x0, 0xf,
+    0xff, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0x0,
+    0x4f, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff,
+    0x0, 0x6f, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff,
+    0xff, 0x0, 0x7f, 0xff, 0xff, 0xf1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
+    0xff, 0xff, 0x10, 0x6f, 0xff, 0xff, 0xf3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
+    0xff, 0xff, 0xff, 0x10, 0x4f, 0xff, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xff, 0xff, 0xff, 0x20, 0x1f, 0xff, 0xff,
+    0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xff, 0xff, 0xff, 0xff, 0x20, 0xb, 0xff,
+    0xff, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x3,
+    0xff, 0xff, 0xff, 0xff, 0x82, 0x0, 0x0, 0x2,
+    0x6c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50,
+    0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xcd,
+    0xff, 0xff, 0xff, 0xff, 0xf5, 0x8f, 0xff, 0xff,
+    0x90, 0x0, 0xc, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfc, 0x20, 0x5f, 0xff,
+    0xff, 0xd0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0x70, 0x0, 0x1f,
+    0xff, 0xff, 0xf3, 0x0, 0x0, 0x5, 0xcf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0x71, 0x0, 0x0,
+    0xb, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x3,
+    0x7a, 0xde, 0xff, 0xed, 0xa7, 0x30, 0x0, 0x0,
+    0x0, 0x1, 0x33, 0x33, 0x32,
+    /* U+00E9 "é" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xcf, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
+    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
+    0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
+    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xa, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9f, 0xff, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0x88, 0x88, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0x9c, 0xef, 0xff, 0xeb, 0x84, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0x81, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2d, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3e, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xff,
+    0xff, 0xfe, 0x84, 0x21, 0x24, 0x8d, 0xff, 0xff,
+    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
+    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0xff, 0xff, 0xe2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xef, 0xff, 0xff, 0xf3, 0x0, 0x0,
+    0x2, 0xff, 0xff, 0xff, 0xe2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xef, 0xff, 0xff, 0xb0,
+    0x0, 0x0, 0x9f, 0xff, 0xff, 0xf4, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
+    0xff, 0x30, 0x0, 0xf, 0xff, 0xff, 0xfb, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0xff, 0xff, 0xf9, 0x0, 0x5, 0xff, 0xff, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5f, 0xff, 0xff, 0xf0, 0x0, 0xaf, 0xff,
+    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0x30, 0xd,
+    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xf7,
+    0x0, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
+    0xff, 0xa0, 0x3f, 0xff, 0xff, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0xff, 0xfc, 0x4, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xe0, 0x6f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf0, 0x5f, 0xff, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
+    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x20,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0xfe, 0xca, 0x60, 0x2, 0xff, 0xff, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5f, 0xff, 0xff, 0xf7, 0x0, 0xc, 0xff,
+    0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0x10, 0x0,
+    0x4f, 0xff, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xa0,
+    0x0, 0x0, 0xbf, 0xff, 0xff, 0xfd, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
+    0xf2, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff,
+    0x70, 0x0, 0x0, 0x0, 0x0, 0x1a, 0xff, 0xff,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
+    0xff, 0xff, 0xe9, 0x42, 0x11, 0x25, 0xaf, 0xff,
+    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfd, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xaf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3a, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x81, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x59, 0xbd, 0xff, 0xfe, 0xda, 0x74, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0,
+    /* U+00F6 "ö" */
+    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0x20,
+    0x0, 0x0, 0x8f, 0xff, 0xff, 0xe0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
+    0xf2, 0x0, 0x0, 0x8, 0xff, 0xff, 0xfe, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
+    0xff, 0xff, 0x20, 0x0, 0x0, 0x8f, 0xff, 0xff,
+    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x8, 0xff,
+    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0,
+    0x8f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xf2, 0x0,
+    0x0, 0x8, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff,
+    0x20, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xe0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x15, 0x9c, 0xde, 0xff, 0xeb, 0x84, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2b, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
+    0xff, 0xfd, 0x84, 0x21, 0x35, 0x9e, 0xff, 0xff,
+    0xff, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x4f, 0xff,
+    0xff, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0xe,
+    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0,
+    0x8, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xf2,
+    0x0, 0x0, 0xef, 0xff, 0xff, 0xe1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
+    0xff, 0x90, 0x0, 0x5f, 0xff, 0xff, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xff, 0xff, 0x10, 0xa, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xff, 0xff, 0xf5, 0x0, 0xff, 0xff,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xa0, 0x2f,
+    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xfd,
+    0x5, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
+    0xff, 0xf0, 0x7f, 0xff, 0xff, 0xe0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0xff, 0xff, 0x29, 0xff, 0xff, 0xfc, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2f, 0xff, 0xff, 0xf4, 0x9f, 0xff, 0xff,
+    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0x4a, 0xff,
+    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf5,
+    0xaf, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0x4a, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
+    0xff, 0xff, 0xf3, 0x9f, 0xff, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xff, 0xff, 0xff, 0x37, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3f, 0xff, 0xff, 0xf1, 0x5f, 0xff,
+    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0x2,
+    0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff,
+    0xd0, 0xf, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
+    0xff, 0xf9, 0x0, 0xaf, 0xff, 0xff, 0xe0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0xff, 0xff, 0x50, 0x5, 0xff, 0xff, 0xff,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xbf, 0xff, 0xff, 0xf1, 0x0, 0xe, 0xff,
+    0xff, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xff, 0xff, 0xfa, 0x0, 0x0,
+    0x8f, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0x30,
+    0x0, 0x0, 0xef, 0xff, 0xff, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3e, 0xff, 0xff, 0xff,
+    0xa0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xfd,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
+    0xff, 0xe1, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
+    0xff, 0xff, 0xc7, 0x31, 0x2, 0x49, 0xef, 0xff,
+    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xd2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xcf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5c, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0x6a, 0xce, 0xff, 0xed, 0xb8, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0,
+    /* U+00FC "ü" */
+    0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0xaf, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
+    0xaf, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0xaf,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0xaf, 0xff,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
+    0xff, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0xff, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
+    0xfe, 0x8f, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfe,
+    0x8f, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfe, 0x8f,
+    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0xff, 0xfe, 0x8f, 0xff,
+    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xff, 0xfe, 0x8f, 0xff, 0xff,
+    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0xff, 0xfe, 0x8f, 0xff, 0xff, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0xff, 0xfe, 0x8f, 0xff, 0xff, 0xa0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
+    0xff, 0xfe, 0x8f, 0xff, 0xff, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
+    0xfe, 0x8f, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfe,
+    0x8f, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfe, 0x8f,
+    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0xff, 0xfe, 0x8f, 0xff,
+    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xff, 0xfe, 0x8f, 0xff, 0xff,
+    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0xff, 0xfe, 0x8f, 0xff, 0xff, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0xff, 0xfe, 0x8f, 0xff, 0xff, 0xa0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
+    0xff, 0xfe, 0x8f, 0xff, 0xff, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
+    0xfe, 0x8f, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfe,
+    0x8f, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfe, 0x8f,
+    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0xff, 0xfe, 0x8f, 0xff,
+    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xff, 0xfe, 0x8f, 0xff, 0xff,
+    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xff, 0xff, 0xfe, 0x8f, 0xff, 0xff, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0xff, 0xff, 0xfe, 0x8f, 0xff, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0xff, 0xfe, 0x7f, 0xff, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
+    0xfe, 0x6f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xfe,
+    0x5f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xfe, 0x3f,
+    0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xcf, 0xff, 0xff, 0xfe, 0xf, 0xff,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xff, 0xff, 0xfe, 0xb, 0xff, 0xff,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xff, 0xff, 0xff, 0xfe, 0x6, 0xff, 0xff, 0xff,
+    0xfa, 0x10, 0x0, 0x0, 0x0, 0x4c, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0x0, 0xef, 0xff, 0xff, 0xff,
+    0xfa, 0x65, 0x46, 0x9d, 0xff, 0xff, 0xfd, 0xaf,
+    0xff, 0xfe, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xe2, 0x9f, 0xff,
+    0xfe, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0x30, 0x9f, 0xff, 0xfe,
+    0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xc1, 0x0, 0x9f, 0xff, 0xfe, 0x0,
+    0x0, 0x1, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xd6, 0x0, 0x0, 0x9f, 0xff, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x59, 0xce, 0xff, 0xec, 0x94, 0x0,
+    0x0, 0x0, 0x12, 0x22, 0x22,
+};
+
+static const lv_font_fmt_txt_glyph_dsc_t arial_70_glyph_dsc[] = {
+    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
+    {.bitmap_index = 0, .adv_w = 311, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 0, .adv_w = 311, .box_w = 8, .box_h = 50, .ofs_x = 6, .ofs_y = 0},
+    {.bitmap_index = 200, .adv_w = 398, .box_w = 19, .box_h = 18, .ofs_x = 3, .ofs_y = 32},
+    {.bitmap_index = 371, .adv_w = 623, .box_w = 39, .box_h = 52, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 1385, .adv_w = 623, .box_w = 34, .box_h = 62, .ofs_x = 2, .ofs_y = -7},
+    {.bitmap_index = 2439, .adv_w = 996, .box_w = 54, .box_h = 53, .ofs_x = 4, .ofs_y = -2},
+    {.bitmap_index = 3870, .adv_w = 747, .box_w = 43, .box_h = 53, .ofs_x = 3, .ofs_y = -2},
+    {.bitmap_index = 5010, .adv_w = 214, .box_w = 8, .box_h = 18, .ofs_x = 3, .ofs_y = 32},
+    {.bitmap_index = 5082, .adv_w = 373, .box_w = 17, .box_h = 66, .ofs_x = 4, .ofs_y = -15},
+    {.bitmap_index = 5643, .adv_w = 373, .box_w = 17, .box_h = 66, .ofs_x = 4, .ofs_y = -15},
+    {.bitmap_index = 6204, .adv_w = 436, .box_w = 23, .box_h = 22, .ofs_x = 2, .ofs_y = 29},
+    {.bitmap_index = 6457, .adv_w = 654, .box_w = 34, .box_h = 33, .ofs_x = 3, .ofs_y = 8},
+    {.bitmap_index = 7018, .adv_w = 311, .box_w = 9, .box_h = 17, .ofs_x = 5, .ofs_y = -10},
+    {.bitmap_index = 7095, .adv_w = 373, .box_w = 20, .box_h = 7, .ofs_x = 2, .ofs_y = 15},
+    {.bitmap_index = 7165, .adv_w = 311, .box_w = 8, .box_h = 7, .ofs_x = 6, .ofs_y = 0},
+    {.bitmap_index = 7193, .adv_w = 311, .box_w = 20, .box_h = 52, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 7713, .adv_w = 623, .box_w = 34, .box_h = 51, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 8580, .adv_w = 623, .box_w = 20, .box_h = 51, .ofs_x = 7, .ofs_y = 0},
+    {.bitmap_index = 9090, .adv_w = 623, .box_w = 34, .box_h = 51, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 9957, .adv_w = 623, .box_w = 34, .box_h = 52, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 10841, .adv_w = 623, .box_w = 36, .box_h = 50, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11741, .adv_w = 623, .box_w = 35, .box_h = 50, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 12616, .adv_w = 623, .box_w = 34, .box_h = 51, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 13483, .adv_w = 623, .box_w = 33, .box_h = 50, .ofs_x = 3, .ofs_y = -1},
+    {.bitmap_index = 14308, .adv_w = 623, .box_w = 34, .box_h = 51, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 15175, .adv_w = 623, .box_w = 34, .box_h = 51, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 16042, .adv_w = 311, .box_w = 8, .box_h = 36, .ofs_x = 6, .ofs_y = 0},
+    {.bitmap_index = 16186, .adv_w = 311, .box_w = 9, .box_h = 46, .ofs_x = 5, .ofs_y = -10},
+    {.bitmap_index = 16393, .adv_w = 654, .box_w = 35, .box_h = 35, .ofs_x = 3, .ofs_y = 7},
+    {.bitmap_index = 17006, .adv_w = 654, .box_w = 34, .box_h = 21, .ofs_x = 3, .ofs_y = 14},
+    {.bitmap_index = 17363, .adv_w = 654, .box_w = 35, .box_h = 35, .ofs_x = 3, .ofs_y = 7},
+    {.bitmap_index = 17976, .adv_w = 623, .box_w = 33, .box_h = 51, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 18818, .adv_w = 1137, .box_w = 66, .box_h = 66, .ofs_x = 3, .ofs_y = -15},
+    {.bitmap_index = 20996, .adv_w = 747, .box_w = 48, .box_h = 50, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 22196, .adv_w = 747, .box_w = 38, .box_h = 50, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 23146, .adv_w = 809, .box_w = 45, .box_h = 52, .ofs_x = 3, .ofs_y = -1},
+    {.bitmap_index = 24316, .adv_w = 809, .box_w = 42, .box_h = 50, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 25366, .adv_w = 747, .box_w = 38, .box_h = 50, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 26316, .adv_w = 684, .box_w = 35, .box_h = 50, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 27191, .adv_w = 871, .box_w = 48, .box_h = 52, .ofs_x = 3, .ofs_y = -1},
+    {.bitmap_index = 28439, .adv_w = 809, .box_w = 40, .box_h = 50, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 29439, .adv_w = 311, .box_w = 8, .box_h = 50, .ofs_x = 6, .ofs_y = 0},
+    {.bitmap_index = 29639, .adv_w = 560, .box_w = 29, .box_h = 51, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 30379, .adv_w = 747, .box_w = 42, .box_h = 50, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 31429, .adv_w = 623, .box_w = 32, .box_h = 50, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 32229, .adv_w = 933, .box_w = 49, .box_h = 50, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 33454, .adv_w = 809, .box_w = 40, .box_h = 50, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 34454, .adv_w = 871, .box_w = 49, .box_h = 52, .ofs_x = 3, .ofs_y = -1},
+    {.bitmap_index = 35728, .adv_w = 747, .box_w = 39, .box_h = 51, .ofs_x = 5, .ofs_y = -1},
+    {.bitmap_index = 36723, .adv_w = 871, .box_w = 49, .box_h = 56, .ofs_x = 3, .ofs_y = -5},
+    {.bitmap_index = 38095, .adv_w = 809, .box_w = 45, .box_h = 50, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 39220, .adv_w = 747, .box_w = 41, .box_h = 52, .ofs_x = 3, .ofs_y = -1},
+    {.bitmap_index = 40286, .adv_w = 684, .box_w = 41, .box_h = 50, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 41311, .adv_w = 809, .box_w = 40, .box_h = 51, .ofs_x = 5, .ofs_y = -1},
+    {.bitmap_index = 42331, .adv_w = 747, .box_w = 47, .box_h = 50, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 43506, .adv_w = 1057, .box_w = 66, .box_h = 50, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 45156, .adv_w = 747, .box_w = 47, .box_h = 50, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 46331, .adv_w = 747, .box_w = 47, .box_h = 50, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 47506, .adv_w = 684, .box_w = 41, .box_h = 50, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 48531, .adv_w = 311, .box_w = 15, .box_h = 64, .ofs_x = 4, .ofs_y = -14},
+    {.bitmap_index = 49011, .adv_w = 311, .box_w = 20, .box_h = 52, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 49531, .adv_w = 311, .box_w = 14, .box_h = 64, .ofs_x = 1, .ofs_y = -14},
+    {.bitmap_index = 49979, .adv_w = 526, .box_w = 30, .box_h = 28, .ofs_x = 1, .ofs_y = 24},
+    {.bitmap_index = 50399, .adv_w = 623, .box_w = 42, .box_h = 5, .ofs_x = -2, .ofs_y = -14},
+    {.bitmap_index = 50504, .adv_w = 373, .box_w = 13, .box_h = 10, .ofs_x = 3, .ofs_y = 41},
+    {.bitmap_index = 50569, .adv_w = 623, .box_w = 34, .box_h = 38, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 51215, .adv_w = 623, .box_w = 33, .box_h = 51, .ofs_x = 4, .ofs_y = -1},
+    {.bitmap_index = 52057, .adv_w = 560, .box_w = 33, .box_h = 38, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 52684, .adv_w = 623, .box_w = 32, .box_h = 51, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 53500, .adv_w = 623, .box_w = 35, .box_h = 38, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 54165, .adv_w = 311, .box_w = 22, .box_h = 52, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 54737, .adv_w = 623, .box_w = 33, .box_h = 52, .ofs_x = 2, .ofs_y = -15},
+    {.bitmap_index = 55595, .adv_w = 623, .box_w = 31, .box_h = 50, .ofs_x = 4, .ofs_y = 0},
+    {.bitmap_index = 56370, .adv_w = 249, .box_w = 7, .box_h = 50, .ofs_x = 4, .ofs_y = 0},
+    {.bitmap_index = 56545, .adv_w = 249, .box_w = 15, .box_h = 65, .ofs_x = -4, .ofs_y = -15},
+    {.bitmap_index = 57033, .adv_w = 560, .box_w = 31, .box_h = 50, .ofs_x = 4, .ofs_y = 0},
+    {.bitmap_index = 57808, .adv_w = 249, .box_w = 7, .box_h = 50, .ofs_x = 4, .ofs_y = 0},
+    {.bitmap_index = 57983, .adv_w = 933, .box_w = 50, .box_h = 37, .ofs_x = 4, .ofs_y = 0},
+    {.bitmap_index = 58908, .adv_w = 623, .box_w = 31, .box_h = 37, .ofs_x = 4, .ofs_y = 0},
+    {.bitmap_index = 59482, .adv_w = 623, .box_w = 35, .box_h = 38, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 60147, .adv_w = 623, .box_w = 33, .box_h = 51, .ofs_x = 4, .ofs_y = -14},
+    {.bitmap_index = 60989, .adv_w = 623, .box_w = 32, .box_h = 51, .ofs_x = 2, .ofs_y = -14},
+    {.bitmap_index = 61805, .adv_w = 373, .box_w = 21, .box_h = 37, .ofs_x = 4, .ofs_y = 0},
+    {.bitmap_index = 62194, .adv_w = 560, .box_w = 31, .box_h = 38, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 62783, .adv_w = 311, .box_w = 18, .box_h = 50, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 63233, .adv_w = 623, .box_w = 30, .box_h = 37, .ofs_x = 4, .ofs_y = -1},
+    {.bitmap_index = 63788, .adv_w = 560, .box_w = 35, .box_h = 36, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 64418, .adv_w = 809, .box_w = 50, .box_h = 36, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 65318, .adv_w = 560, .box_w = 35, .box_h = 37, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 65966, .adv_w = 560, .box_w = 34, .box_h = 51, .ofs_x = 1, .ofs_y = -15},
+    {.bitmap_index = 66833, .adv_w = 560, .box_w = 33, .box_h = 36, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 67427, .adv_w = 374, .box_w = 21, .box_h = 66, .ofs_x = 1, .ofs_y = -15},
+    {.bitmap_index = 68120, .adv_w = 291, .box_w = 6, .box_h = 66, .ofs_x = 6, .ofs_y = -15},
+    {.bitmap_index = 68318, .adv_w = 374, .box_w = 21, .box_h = 66, .ofs_x = 1, .ofs_y = -15},
+    {.bitmap_index = 69011, .adv_w = 654, .box_w = 36, .box_h = 13, .ofs_x = 2, .ofs_y = 18},
+    {.bitmap_index = 69245, .adv_w = 747, .box_w = 48, .box_h = 60, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 70685, .adv_w = 747, .box_w = 48, .box_h = 61, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 72149, .adv_w = 747, .box_w = 38, .box_h = 63, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 73346, .adv_w = 871, .box_w = 49, .box_h = 61, .ofs_x = 3, .ofs_y = -1},
+    {.bitmap_index = 74841, .adv_w = 809, .box_w = 40, .box_h = 61, .ofs_x = 5, .ofs_y = -1},
+    {.bitmap_index = 76061, .adv_w = 623, .box_w = 34, .box_h = 51, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 76928, .adv_w = 623, .box_w = 34, .box_h = 53, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 77829, .adv_w = 623, .box_w = 35, .box_h = 51, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 78722, .adv_w = 623, .box_w = 35, .box_h = 51, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 79615, .adv_w = 623, .box_w = 30, .box_h = 51, .ofs_x = 4, .ofs_y = -1}
+};
+
+static const lv_font_fmt_txt_dsc_t arial_70_dsc = {
+    .glyph_bitmap = arial_70_bitmap,
+    .glyph_dsc = arial_70_glyph_dsc,
+    .cmaps = ui_font_cmaps,
+    .kern_dsc = NULL,
+    .kern_scale = 0,
+    .cmap_num = UI_FONT_CMAP_NUM,
+    .bpp = 4,
+    .kern_classes = 0,
+    .bitmap_format = 0,
+};
+
+const lv_font_t Arial_70 = {
+    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
+    .line_height = 78,          /*The maximum line height required by the font*/
+    .base_line = 15,             /*Baseline measured from the bottom of the line*/
+    .subpx = LV_FONT_SUBPX_NONE,
+    .underline_position = -7,
+    .underline_thickness = 5,
+    .dsc = &arial_70_dsc,          /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
+    .fallback = &lv_font_montserrat_14,
+    .user_data = NULL,
+};
@@ -0,0 +1,481 @@
+// Generoitu tiedostoista ui/layout.json ja ui/strings.json: python3 tools/gen_ui.py. Älä muokkaa käsin.
+#include "ui_gen.h"
+
+LV_FONT_DECLARE(Arial_24);
+LV_FONT_DECLARE(Arial_70);
+
+const char *const ui_strings[UI_LANG_COUNT][UI_STR_COUNT] = {
+    [UI_LANG_FI] = {
+        [UI_STR_LANG_NAME] = "Suomi",
+        [UI_STR_OTTO] = "Otto",
+        [UI_STR_PALAUTUS] = "Palautus",
+        [UI_STR_PROMPT_OTTO] = "Lue tuote",
+        [UI_STR_PROMPT_PALAUTUS] = "Lue palautus",
+        [UI_STR_PRODUCT] = "Tuote",
+        [UI_STR_OK] = "OK",
+        [UI_STR_CANCEL] = "Peru",
+        [UI_STR_CONFIRM] = "Vahvista?",
+        [UI_STR_YES] = "Kyllä",
+        [UI_STR_NO] = "Ei",
+        [UI_STR_ERROR] = "Virhe",
+        [UI_STR_UNKNOWN_PRODUCT] = "Tuntematon tuote",
+        [UI_STR_SAVE_FAILED] = "Tallennus ei onnistu",
+        [UI_STR_ADMIN] = "Ylläpito",
+        [UI_STR_ADMIN_INFO] = "Jonossa %lu\nLähetetty %lu\nLuettelo v%lu\nKäynnistys %lu ms\nUI-jonosta pudotettu %lu",
+        [UI_STR_STATUS_QUEUED] = "Lähettämättä %lu",
+        [UI_STR_STATUS_OFFLINE] = "Ei verkkoa, jonossa %lu",
+        [UI_STR_STATUS_FAILED] = "Lähetys ei onnistu (%d), jonossa %lu",
+        [UI_STR_SNAPPY] = "Nopea",
+        [UI_STR_BACK] = "Takaisin",
+    },
+    [UI_LANG_SV] = {
+        [UI_STR_LANG_NAME] = "Svenska",
+        [UI_STR_OTTO] = "Uttag",
+        [UI_STR_PALAUTUS] = "Retur",
+        [UI_STR_PROMPT_OTTO] = "Läs produkt",
+        [UI_STR_PROMPT_PALAUTUS] = "Läs retur",
+        [UI_STR_PRODUCT] = "Produkt",
+        [UI_STR_OK] = "OK",
+        [UI_STR_CANCEL] = "Avbryt",
+        [UI_STR_CONFIRM] = "Bekräfta?",
+        [UI_STR_YES] = "Ja",
+        [UI_STR_NO] = "Nej",
+        [UI_STR_ERROR] = "Fel",
+        [UI_STR_UNKNOWN_PRODUCT] = "Okänd produkt",
+        [UI_STR_SAVE_FAILED] = "Kan inte spara",
+        [UI_STR_ADMIN] = "Underhåll",
+        [UI_STR_ADMIN_INFO] = "I kö %lu\nSkickade %lu\nKatalog v%lu\nStart %lu ms\nUI-kö, tappade %lu",
+        [UI_STR_STATUS_QUEUED] = "Oskickade %lu",
+        [UI_STR_STATUS_OFFLINE] = "Inget nät, i kö %lu",
+        [UI_STR_STATUS_FAILED] = "Sändning misslyckas (%d), i kö %lu",
+        [UI_STR_SNAPPY] = "Snabb",
+        [UI_STR_BACK] = "Tillbaka",
+    },
+    [UI_LANG_EN] = {
+        [UI_STR_LANG_NAME] = "English",
+        [UI_STR_OTTO] = "Take",
+        [UI_STR_PALAUTUS] = "Return",
+        [UI_STR_PROMPT_OTTO] = "Scan item",
+        [UI_STR_PROMPT_PALAUTUS] = "Scan return",
+        [UI_STR_PRODUCT] = "Item",
+        [UI_STR_OK] = "OK",
+        [UI_STR_CANCEL] = "Cancel",
+        [UI_STR_CONFIRM] = "Confirm?",
+        [UI_STR_YES] = "Yes",
+        [UI_STR_NO] = "No",
+        [UI_STR_ERROR] = "Error",
+        [UI_STR_UNKNOWN_PRODUCT] = "Unknown item",
+        [UI_STR_SAVE_FAILED] = "Cannot save",
+        [UI_STR_ADMIN] = "Service",
+        [UI_STR_ADMIN_INFO] = "Queued %lu\nSent %lu\nCatalog v%lu\nBoot %lu ms\nUI queue dropped %lu",
+        [UI_STR_STATUS_QUEUED] = "Unsent %lu",
+        [UI_STR_STATUS_OFFLINE] = "Offline, %lu queued",
+        [UI_STR_STATUS_FAILED] = "Send failed (%d), %lu queued",
+        [UI_STR_SNAPPY] = "Fast",
+        [UI_STR_BACK] = "Back",
+    },
+};
+
+static const lv_style_const_prop_t ui_style_screen_props[] = {
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0x00, 0x00, 0x00)),
+    LV_STYLE_CONST_BORDER_WIDTH(0),
+    LV_STYLE_CONST_PAD_TOP(0),
+    LV_STYLE_CONST_PAD_BOTTOM(0),
+    LV_STYLE_CONST_PAD_LEFT(0),
+    LV_STYLE_CONST_PAD_RIGHT(0),
+    LV_STYLE_CONST_RADIUS(0),
+    LV_STYLE_CONST_TEXT_FONT(&Arial_70),
+    LV_STYLE_CONST_TEXT_COLOR(LV_COLOR_MAKE(0xff, 0xff, 0xff)),
+    LV_STYLE_CONST_PROPS_END
+};
+LV_STYLE_CONST_INIT(ui_style_screen, ui_style_screen_props);
+
+static const lv_style_const_prop_t ui_style_text_props[] = {
+    LV_STYLE_CONST_TEXT_FONT(&Arial_70),
+    LV_STYLE_CONST_TEXT_COLOR(LV_COLOR_MAKE(0xff, 0xff, 0xff)),
+    LV_STYLE_CONST_PROPS_END
+};
+LV_STYLE_CONST_INIT(ui_style_text, ui_style_text_props);
+
+static const lv_style_const_prop_t ui_style_text_small_props[] = {
+    LV_STYLE_CONST_TEXT_FONT(&Arial_24),
+    LV_STYLE_CONST_TEXT_COLOR(LV_COLOR_MAKE(0xff, 0xff, 0xff)),
+    LV_STYLE_CONST_PROPS_END
+};
+LV_STYLE_CONST_INIT(ui_style_text_small, ui_style_text_small_props);
+
+static const lv_style_const_prop_t ui_style_text_dim_props[] = {
+    LV_STYLE_CONST_TEXT_COLOR(LV_COLOR_MAKE(0x80, 0x80, 0x80)),
+    LV_STYLE_CONST_PROPS_END
+};
+LV_STYLE_CONST_INIT(ui_style_text_dim, ui_style_text_dim_props);
+
+static const lv_style_const_prop_t ui_style_text_center_props[] = {
+    LV_STYLE_CONST_TEXT_ALIGN(LV_TEXT_ALIGN_CENTER),
+    LV_STYLE_CONST_PROPS_END
+};
+LV_STYLE_CONST_INIT(ui_style_text_center, ui_style_text_center_props);
+
+static const lv_style_const_prop_t ui_style_btn_props[] = {
+    LV_STYLE_CONST_RADIUS(LV_RADIUS_CIRCLE),
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0x00, 0x00, 0x00)),
+    LV_STYLE_CONST_TEXT_FONT(&Arial_70),
+    LV_STYLE_CONST_TEXT_COLOR(LV_COLOR_MAKE(0xff, 0xff, 0xff)),
+    LV_STYLE_CONST_BORDER_COLOR(LV_COLOR_MAKE(0xff, 0xff, 0xff)),
+    LV_STYLE_CONST_BORDER_WIDTH(2),
+    LV_STYLE_CONST_PAD_TOP(0),
+    LV_STYLE_CONST_PAD_BOTTOM(0),
+    LV_STYLE_CONST_PAD_LEFT(0),
+    LV_STYLE_CONST_PAD_RIGHT(0),
+    LV_STYLE_CONST_PROPS_END
+};
+LV_STYLE_CONST_INIT(ui_style_btn, ui_style_btn_props);
+
+static const lv_style_const_prop_t ui_style_btn_checked_props[] = {
+    LV_STYLE_CONST_RADIUS(LV_RADIUS_CIRCLE),
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0xff, 0xc8, 0x00)),
+    LV_STYLE_CONST_TEXT_FONT(&Arial_70),
+    LV_STYLE_CONST_TEXT_COLOR(LV_COLOR_MAKE(0x00, 0x00, 0x00)),
+    LV_STYLE_CONST_BORDER_COLOR(LV_COLOR_MAKE(0xff, 0xff, 0xff)),
+    LV_STYLE_CONST_BORDER_WIDTH(2),
+    LV_STYLE_CONST_PAD_TOP(0),
+    LV_STYLE_CONST_PAD_BOTTOM(0),
+    LV_STYLE_CONST_PAD_LEFT(0),
+    LV_STYLE_CONST_PAD_RIGHT(0),
+    LV_STYLE_CONST_PROPS_END
+};
+LV_STYLE_CONST_INIT(ui_style_btn_checked, ui_style_btn_checked_props);
+
+static const lv_style_const_prop_t ui_style_snappy_props[] = {
+    LV_STYLE_CONST_TRANSITION(NULL),
+    LV_STYLE_CONST_TRANSFORM_WIDTH(0),
+    LV_STYLE_CONST_TRANSFORM_HEIGHT(0),
+    LV_STYLE_CONST_PROPS_END
+};
+LV_STYLE_CONST_INIT(ui_style_snappy, ui_style_snappy_props);
+
+static const lv_style_const_prop_t ui_style_prerendered_props[] = {
+    LV_STYLE_CONST_BG_OPA(0),
+    LV_STYLE_CONST_BORDER_WIDTH(0),
+    LV_STYLE_CONST_RADIUS(0),
+    LV_STYLE_CONST_PROPS_END
+};
+LV_STYLE_CONST_INIT(ui_style_prerendered, ui_style_prerendered_props);
+
+static const lv_style_const_prop_t ui_geom_0_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_TOP_MID),
+    LV_STYLE_CONST_X(0),
+    LV_STYLE_CONST_Y(10),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(ui_geom_0, ui_geom_0_props);
+
+static const lv_style_const_prop_t ui_geom_1_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_X(0),
+    LV_STYLE_CONST_Y(-100),
+    LV_STYLE_CONST_WIDTH(400),
+    LV_STYLE_CONST_HEIGHT(160),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(ui_geom_1, ui_geom_1_props);
+
+static const lv_style_const_prop_t ui_geom_2_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_X(0),
+    LV_STYLE_CONST_Y(0),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(ui_geom_2, ui_geom_2_props);
+
+static const lv_style_const_prop_t ui_geom_3_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_X(0),
+    LV_STYLE_CONST_Y(100),
+    LV_STYLE_CONST_WIDTH(400),
+    LV_STYLE_CONST_HEIGHT(160),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(ui_geom_3, ui_geom_3_props);
+
+static const lv_style_const_prop_t ui_geom_4_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_BOTTOM_MID),
+    LV_STYLE_CONST_X(0),
+    LV_STYLE_CONST_Y(-20),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(ui_geom_4, ui_geom_4_props);
+
+static const lv_style_const_prop_t ui_geom_5_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_TOP_MID),
+    LV_STYLE_CONST_X(0),
+    LV_STYLE_CONST_Y(120),
+    LV_STYLE_CONST_WIDTH(460),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(ui_geom_5, ui_geom_5_props);
+
+static const lv_style_const_prop_t ui_geom_6_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_X(0),
+    LV_STYLE_CONST_Y(40),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(ui_geom_6, ui_geom_6_props);
+
+static const lv_style_const_prop_t ui_geom_7_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_BOTTOM_LEFT),
+    LV_STYLE_CONST_X(20),
+    LV_STYLE_CONST_Y(-40),
+    LV_STYLE_CONST_WIDTH(200),
+    LV_STYLE_CONST_HEIGHT(160),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(ui_geom_7, ui_geom_7_props);
+
+static const lv_style_const_prop_t ui_geom_8_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_BOTTOM_RIGHT),
+    LV_STYLE_CONST_X(-20),
+    LV_STYLE_CONST_Y(-40),
+    LV_STYLE_CONST_WIDTH(200),
+    LV_STYLE_CONST_HEIGHT(160),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(ui_geom_8, ui_geom_8_props);
+
+static const lv_style_const_prop_t ui_geom_9_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_X(0),
+    LV_STYLE_CONST_Y(-60),
+    LV_STYLE_CONST_WIDTH(460),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(ui_geom_9, ui_geom_9_props);
+
+static const lv_style_const_prop_t ui_geom_10_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_BOTTOM_MID),
+    LV_STYLE_CONST_X(0),
+    LV_STYLE_CONST_Y(-40),
+    LV_STYLE_CONST_WIDTH(400),
+    LV_STYLE_CONST_HEIGHT(160),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(ui_geom_10, ui_geom_10_props);
+
+static const lv_style_const_prop_t ui_geom_11_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_TOP_LEFT),
+    LV_STYLE_CONST_X(10),
+    LV_STYLE_CONST_Y(100),
+    LV_STYLE_CONST_WIDTH(460),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(ui_geom_11, ui_geom_11_props);
+
+static const lv_style_const_prop_t ui_geom_12_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_BOTTOM_MID),
+    LV_STYLE_CONST_X(0),
+    LV_STYLE_CONST_Y(-400),
+    LV_STYLE_CONST_WIDTH(400),
+    LV_STYLE_CONST_HEIGHT(160),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(ui_geom_12, ui_geom_12_props);
+
+static const lv_style_const_prop_t ui_geom_13_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_BOTTOM_MID),
+    LV_STYLE_CONST_X(0),
+    LV_STYLE_CONST_Y(-220),
+    LV_STYLE_CONST_WIDTH(400),
+    LV_STYLE_CONST_HEIGHT(160),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(ui_geom_13, ui_geom_13_props);
+
+lv_obj_t *ui_main_create(ui_main_t *ui) {
+    lv_obj_t *scr = lv_obj_create(NULL);
+    lv_obj_t *l;
+    lv_obj_add_style(scr, UI_STYLE(ui_style_screen), 0);
+
+    ui->prompt = lv_label_create(scr);
+    lv_label_set_text_static(ui->prompt, "");
+    lv_obj_add_style(ui->prompt, UI_STYLE(ui_style_text), 0);
+    lv_obj_add_style(ui->prompt, UI_STYLE(ui_geom_0), 0);
+
+    ui->btn_otto = lv_button_create(scr);
+    lv_obj_add_style(ui->btn_otto, UI_STYLE(ui_style_btn), 0);
+    lv_obj_add_style(ui->btn_otto, UI_STYLE(ui_style_btn_checked), LV_STATE_CHECKED);
+    lv_obj_add_style(ui->btn_otto, UI_STYLE(ui_geom_1), 0);
+    l = lv_label_create(ui->btn_otto);
+    ui_text_bind(l, UI_STR_OTTO);
+    lv_obj_add_style(l, UI_STYLE(ui_style_text), 0);
+    lv_obj_add_style(l, UI_STYLE(ui_geom_2), 0);
+
+    ui->btn_palautus = lv_button_create(scr);
+    lv_obj_add_style(ui->btn_palautus, UI_STYLE(ui_style_btn), 0);
+    lv_obj_add_style(ui->btn_palautus, UI_STYLE(ui_style_btn_checked), LV_STATE_CHECKED);
+    lv_obj_add_style(ui->btn_palautus, UI_STYLE(ui_geom_3), 0);
+    l = lv_label_create(ui->btn_palautus);
+    ui_text_bind(l, UI_STR_PALAUTUS);
+    lv_obj_add_style(l, UI_STYLE(ui_style_text), 0);
+    lv_obj_add_style(l, UI_STYLE(ui_geom_2), 0);
+
+    ui->status = lv_label_create(scr);
+    lv_label_set_text_static(ui->status, "");
+    lv_obj_add_style(ui->status, UI_STYLE(ui_style_text_small), 0);
+    lv_obj_add_style(ui->status, UI_STYLE(ui_style_text_dim), LV_STATE_DISABLED);
+    lv_obj_add_style(ui->status, UI_STYLE(ui_geom_4), 0);
+
+    ui->screen = scr;
+    return scr;
+}
+
+lv_obj_t *ui_scan_create(ui_scan_t *ui) {
+    lv_obj_t *scr = lv_obj_create(NULL);
+    lv_obj_t *o, *l;
+    lv_obj_add_style(scr, UI_STYLE(ui_style_screen), 0);
+
+    o = lv_label_create(scr);
+    ui_text_bind(o, UI_STR_PRODUCT);
+    lv_obj_add_style(o, UI_STYLE(ui_style_text), 0);
+    lv_obj_add_style(o, UI_STYLE(ui_geom_0), 0);
+
+    ui->name = lv_label_create(scr);
+    lv_label_set_text_static(ui->name, "");
+    lv_obj_add_style(ui->name, UI_STYLE(ui_style_text), 0);
+    lv_obj_add_style(ui->name, UI_STYLE(ui_style_text_center), 0);
+    lv_obj_add_style(ui->name, UI_STYLE(ui_geom_5), 0);
+
+    ui->price = lv_label_create(scr);
+    lv_label_set_text_static(ui->price, "");
+    lv_obj_add_style(ui->price, UI_STYLE(ui_style_text), 0);
+    lv_obj_add_style(ui->price, UI_STYLE(ui_geom_6), 0);
+
+    ui->btn_ok = lv_button_create(scr);
+    lv_obj_add_style(ui->btn_ok, UI_STYLE(ui_style_btn), 0);
+    lv_obj_add_style(ui->btn_ok, UI_STYLE(ui_style_btn_checked), LV_STATE_CHECKED);
+    lv_obj_add_style(ui->btn_ok, UI_STYLE(ui_geom_7), 0);
+    l = lv_label_create(ui->btn_ok);
+    ui_text_bind(l, UI_STR_OK);
+    lv_obj_add_style(l, UI_STYLE(ui_style_text), 0);
+    lv_obj_add_style(l, UI_STYLE(ui_geom_2), 0);
+
+    ui->btn_cancel = lv_button_create(scr);
+    lv_obj_add_style(ui->btn_cancel, UI_STYLE(ui_style_btn), 0);
+    lv_obj_add_style(ui->btn_cancel, UI_STYLE(ui_style_btn_checked), LV_STATE_CHECKED);
+    lv_obj_add_style(ui->btn_cancel, UI_STYLE(ui_geom_8), 0);
+    l = lv_label_create(ui->btn_cancel);
+    ui_text_bind(l, UI_STR_CANCEL);
+    lv_obj_add_style(l, UI_STYLE(ui_style_text), 0);
+    lv_obj_add_style(l, UI_STYLE(ui_geom_2), 0);
+
+    ui->screen = scr;
+    return scr;
+}
+
+lv_obj_t *ui_confirm_create(ui_confirm_t *ui) {
+    lv_obj_t *scr = lv_obj_create(NULL);
+    lv_obj_t *o, *l;
+    lv_obj_add_style(scr, UI_STYLE(ui_style_screen), 0);
+
+    o = lv_label_create(scr);
+    ui_text_bind(o, UI_STR_CONFIRM);
+    lv_obj_add_style(o, UI_STYLE(ui_style_text), 0);
+    lv_obj_add_style(o, UI_STYLE(ui_geom_0), 0);
+
+    ui->btn_yes = lv_button_create(scr);
+    lv_obj_add_style(ui->btn_yes, UI_STYLE(ui_style_btn), 0);
+    lv_obj_add_style(ui->btn_yes, UI_STYLE(ui_style_btn_checked), LV_STATE_CHECKED);
+    lv_obj_add_style(ui->btn_yes, UI_STYLE(ui_geom_1), 0);
+    l = lv_label_create(ui->btn_yes);
+    ui_text_bind(l, UI_STR_YES);
+    lv_obj_add_style(l, UI_STYLE(ui_style_text), 0);
+    lv_obj_add_style(l, UI_STYLE(ui_geom_2), 0);
+
+    ui->btn_no = lv_button_create(scr);
+    lv_obj_add_style(ui->btn_no, UI_STYLE(ui_style_btn), 0);
+    lv_obj_add_style(ui->btn_no, UI_STYLE(ui_style_btn_checked), LV_STATE_CHECKED);
+    lv_obj_add_style(ui->btn_no, UI_STYLE(ui_geom_3), 0);
+    l = lv_label_create(ui->btn_no);
+    ui_text_bind(l, UI_STR_NO);
+    lv_obj_add_style(l, UI_STYLE(ui_style_text), 0);
+    lv_obj_add_style(l, UI_STYLE(ui_geom_2), 0);
+
+    ui->screen = scr;
+    return scr;
+}
+
+lv_obj_t *ui_error_create(ui_error_t *ui) {
+    lv_obj_t *scr = lv_obj_create(NULL);
+    lv_obj_t *o, *l;
+    lv_obj_add_style(scr, UI_STYLE(ui_style_screen), 0);
+
+    o = lv_label_create(scr);
+    ui_text_bind(o, UI_STR_ERROR);
+    lv_obj_add_style(o, UI_STYLE(ui_style_text), 0);
+    lv_obj_add_style(o, UI_STYLE(ui_geom_0), 0);
+
+    ui->message = lv_label_create(scr);
+    lv_label_set_text_static(ui->message, "");
+    lv_obj_add_style(ui->message, UI_STYLE(ui_style_text), 0);
+    lv_obj_add_style(ui->message, UI_STYLE(ui_style_text_center), 0);
+    lv_obj_add_style(ui->message, UI_STYLE(ui_geom_9), 0);
+
+    ui->btn_ok = lv_button_create(scr);
+    lv_obj_add_style(ui->btn_ok, UI_STYLE(ui_style_btn), 0);
+    lv_obj_add_style(ui->btn_ok, UI_STYLE(ui_style_btn_checked), LV_STATE_CHECKED);
+    lv_obj_add_style(ui->btn_ok, UI_STYLE(ui_geom_10), 0);
+    l = lv_label_create(ui->btn_ok);
+    ui_text_bind(l, UI_STR_OK);
+    lv_obj_add_style(l, UI_STYLE(ui_style_text), 0);
+    lv_obj_add_style(l, UI_STYLE(ui_geom_2), 0);
+
+    ui->screen = scr;
+    return scr;
+}
+
+lv_obj_t *ui_admin_create(ui_admin_t *ui) {
+    lv_obj_t *scr = lv_obj_create(NULL);
+    lv_obj_t *o, *l;
+    lv_obj_add_style(scr, UI_STYLE(ui_style_screen), 0);
+
+    o = lv_label_create(scr);
+    ui_text_bind(o, UI_STR_ADMIN);
+    lv_obj_add_style(o, UI_STYLE(ui_style_text), 0);
+    lv_obj_add_style(o, UI_STYLE(ui_geom_0), 0);
+
+    ui->info = lv_label_create(scr);
+    lv_label_set_text_static(ui->info, "");
+    lv_obj_add_style(ui->info, UI_STYLE(ui_style_text_small), 0);
+    lv_obj_add_style(ui->info, UI_STYLE(ui_geom_11), 0);
+
+    ui->btn_lang = lv_button_create(scr);
+    lv_obj_add_style(ui->btn_lang, UI_STYLE(ui_style_btn), 0);
+    lv_obj_add_style(ui->btn_lang, UI_STYLE(ui_style_btn_checked), LV_STATE_CHECKED);
+    lv_obj_add_style(ui->btn_lang, UI_STYLE(ui_geom_12), 0);
+    l = lv_label_create(ui->btn_lang);
+    ui_text_bind(l, UI_STR_LANG_NAME);
+    lv_obj_add_style(l, UI_STYLE(ui_style_text), 0);
+    lv_obj_add_style(l, UI_STYLE(ui_geom_2), 0);
+
+    ui->btn_snappy = lv_button_create(scr);
+    lv_obj_add_style(ui->btn_snappy, UI_STYLE(ui_style_btn), 0);
+    lv_obj_add_style(ui->btn_snappy, UI_STYLE(ui_style_btn_checked), LV_STATE_CHECKED);
+    lv_obj_add_style(ui->btn_snappy, UI_STYLE(ui_geom_13), 0);
+    lv_obj_add_flag(ui->btn_snappy, LV_OBJ_FLAG_CHECKABLE);
+    l = lv_label_create(ui->btn_snappy);
+    ui_text_bind(l, UI_STR_SNAPPY);
+    lv_obj_add_style(l, UI_STYLE(ui_style_text), 0);
+    lv_obj_add_style(l, UI_STYLE(ui_geom_2), 0);
+
+    ui->btn_back = lv_button_create(scr);
+    lv_obj_add_style(ui->btn_back, UI_STYLE(ui_style_btn), 0);
+    lv_obj_add_style(ui->btn_back, UI_STYLE(ui_style_btn_checked), LV_STATE_CHECKED);
+    lv_obj_add_style(ui->btn_back, UI_STYLE(ui_geom_10), 0);
+    l = lv_label_create(ui->btn_back);
+    ui_text_bind(l, UI_STR_BACK);
+    lv_obj_add_style(l, UI_STYLE(ui_style_text), 0);
+    lv_obj_add_style(l, UI_STYLE(ui_geom_2), 0);
+
+    ui->screen = scr;
+    return scr;
+}
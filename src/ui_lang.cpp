@@ -0,0 +1,40 @@
+#include "ui_lang.h"
+
+#include <string.h>
+
+lv_subject_t ui_lang_subject;
+
+void ui_lang_init(ui_lang_t initial) {
+    lv_subject_init_int(&ui_lang_subject, initial);
+}
+
+ui_lang_t ui_lang_get() {
+    return (ui_lang_t)lv_subject_get_int(&ui_lang_subject);
+}
+
+void ui_lang_set(ui_lang_t lang) {
+    // lv_subject_set_int ilmoittaa tarkkailijoille myös samasta arvosta
+    if (lang >= UI_LANG_COUNT || lang == ui_lang_get()) return;
+    lv_subject_set_int(&ui_lang_subject, lang);
+}
+
+void ui_lang_next() {
+    ui_lang_set((ui_lang_t)((ui_lang_get() + 1) % UI_LANG_COUNT));
+}
+
+const char *ui_tr(ui_str_t id) {
+    return ui_strings[ui_lang_get()][id];
+}
+
+static void text_observer(lv_observer_t *observer, lv_subject_t *subject) {
+    lv_obj_t *label = lv_observer_get_target_obj(observer);
+    int32_t lang = lv_subject_get_int(subject);
+    if (lang < 0 || lang >= UI_LANG_COUNT) return;
+    const char *text = ui_strings[lang][(uintptr_t)lv_observer_get_user_data(observer)];
+    if (strcmp(lv_label_get_text(label), text) != 0) lv_label_set_text_static(label, text);
+}
+
+extern "C" void ui_text_bind(lv_obj_t *label, ui_str_t id) {
+    // Tarkkailija poistuu labelin mukana, kun LRU poistaa näkymän
+    lv_subject_add_observer_obj(&ui_lang_subject, text_observer, label, (void *)(uintptr_t)id);
+}
@@ -0,0 +1,134 @@
+#include "ui_prerender.h"
+#include "kiosk_port.h"
+#include "ui_gen.h"
+#include "ui_snappy.h"
+
+#include <stdio.h>
+
+#define EXT_MARGIN 16   // Varaa tilaa olion ulkopuolelle piirtyville osille (ääriviiva, varjo)
+
+struct prerendered_t {
+    lv_obj_t *btn;
+    lv_draw_buf_t img[2];     // 0 = ei valittu, 1 = valittu
+    void *data[2];
+    size_t size;
+};
+
+static prerendered_t slots[UI_PRERENDER_MAX];
+
+// Tilojen kuvat taustakuvaksi vakiotyyleillä: puskurit ovat slots-taulukossa, joten
+// osoitteet tunnetaan käännösaikana eikä painikkeelle varata paikallista tyyliä
+#define IMG_STYLE(i, s)                                                                               \
+    static const lv_style_const_prop_t img_##i##_##s##_props[] = {                                    \
+        LV_STYLE_CONST_BG_IMAGE_SRC(&slots[i].img[s]), LV_STYLE_CONST_PROPS_END };                    \
+    static LV_STYLE_CONST_INIT(img_##i##_##s, img_##i##_##s##_props)
+
+IMG_STYLE(0, 0); IMG_STYLE(0, 1);
+IMG_STYLE(1, 0); IMG_STYLE(1, 1);
+IMG_STYLE(2, 0); IMG_STYLE(2, 1);
+IMG_STYLE(3, 0); IMG_STYLE(3, 1);
+
+static_assert(UI_PRERENDER_MAX == 4, "IMG_STYLE jokaiselle paikalle");
+static const lv_style_t *const img_styles[UI_PRERENDER_MAX][2] = {
+    { &img_0_0, &img_0_1 }, { &img_1_0, &img_1_1 }, { &img_2_0, &img_2_1 }, { &img_3_0, &img_3_1 },
+};
+
+// Molempiin tiloihin, jotta ne ohittavat painikkeen ui_style_btn_checked-tyylin
+static const lv_style_selector_t selectors[2] = { 0, LV_STATE_CHECKED };
+
+static void add_styles(lv_obj_t *btn, int slot) {
+    for (int i = 0; i < 2; i++) {
+        lv_obj_add_style(btn, UI_STYLE(ui_style_prerendered), selectors[i]);
+        lv_obj_add_style(btn, UI_STYLE(*img_styles[slot][i]), selectors[i]);
+    }
+}
+
+static void remove_styles(lv_obj_t *btn, int slot) {
+    for (int i = 0; i < 2; i++) {
+        lv_obj_remove_style(btn, UI_STYLE(*img_styles[slot][i]), selectors[i]);
+        lv_obj_remove_style(btn, UI_STYLE(ui_style_prerendered), selectors[i]);
+    }
+}
+
+static prerendered_t *find(lv_obj_t *btn) {
+    for (prerendered_t &p : slots) {
+        if (p.btn == btn) return &p;
+    }
+    return NULL;
+}
+
+static void free_slot(prerendered_t *p) {
+    for (int i = 0; i < 2; i++) {
+        kiosk_psram_free(p->data[i]);
+        p->data[i] = NULL;
+    }
+    p->btn = NULL;
+    p->size = 0;
+}
+
+static void delete_cb(lv_event_t *e) {
+    prerendered_t *p = find((lv_obj_t *)lv_event_get_target(e));
+    if (p) free_slot(p);
+}
+
+static bool snapshot(lv_obj_t *btn, lv_draw_buf_t *buf, void **data, size_t *size) {
+    int32_t w = lv_obj_get_width(btn) + 2 * EXT_MARGIN;
+    int32_t h = lv_obj_get_height(btn) + 2 * EXT_MARGIN;
+    uint32_t stride = lv_draw_buf_width_to_stride(w, LV_COLOR_FORMAT_RGB565);
+    size_t bytes = (size_t)stride * h;
+    *data = kiosk_psram_alloc(bytes);
+    if (!*data) return false;
+    lv_draw_buf_init(buf, w, h, LV_COLOR_FORMAT_RGB565, stride, *data, bytes);
+    // Kaventaa puskurin olion todelliseen piirtoalueeseen
+    if (lv_snapshot_take_to_draw_buf(btn, LV_COLOR_FORMAT_RGB565, buf) != LV_RESULT_OK) return false;
+    *size += bytes;
+    return true;
+}
+
+bool ui_prerender_button(lv_obj_t *btn) {
+    if (find(btn)) return true;
+    prerendered_t *p = find(NULL);
+    if (!p) return false;
+    lv_obj_update_layout(btn);
+
+    // Tilanvaihto ilman teeman siirtymää, jotta kuva on lopullinen ulkoasu
+    bool snappy = ui_snappy_get();
+    if (!snappy) lv_obj_add_style(btn, UI_STYLE(ui_style_snappy), 0);
+    bool checked = lv_obj_has_state(btn, LV_STATE_CHECKED);
+    bool ok = true;
+    for (int i = 0; i < 2 && ok; i++) {
+        lv_obj_set_state(btn, LV_STATE_CHECKED, i == 1);
+        ok = snapshot(btn, &p->img[i], &p->data[i], &p->size);
+    }
+    lv_obj_set_state(btn, LV_STATE_CHECKED, checked);
+    if (!snappy) lv_obj_remove_style(btn, UI_STYLE(ui_style_snappy), 0);
+    if (!ok) {
+        free_slot(p);
+        printf("[prerender] kuvan otto epäonnistui\n");
+        return false;
+    }
+    p->btn = btn;
+
+    // Tausta = kuva; oma tausta, reuna ja teksti pois, kulmat ovat jo kuvassa (ei maskia).
+    // Kuva on tallennettu olion kokoisena (+ ulkopuoliset osat), ja taustakuva piirtyy
+    // keskitettynä samaan kohtaan.
+    add_styles(btn, (int)(p - slots));
+    for (uint32_t i = 0; i < lv_obj_get_child_count(btn); i++) lv_obj_add_flag(lv_obj_get_child(btn, i), LV_OBJ_FLAG_HIDDEN);
+    lv_obj_add_event_cb(btn, delete_cb, LV_EVENT_DELETE, NULL);
+    return true;
+}
+
+void ui_prerender_release(lv_obj_t *btn) {
+    prerendered_t *p = find(btn);
+    if (!p) return;
+    remove_styles(btn, (int)(p - slots));
+    for (uint32_t i = 0; i < lv_obj_get_child_count(btn); i++) lv_obj_remove_flag(lv_obj_get_child(btn, i), LV_OBJ_FLAG_HIDDEN);
+    lv_obj_remove_event_cb(btn, delete_cb);
+    free_slot(p);
+}
+
+size_t ui_prerender_bytes() {
+    size_t total = 0;
+    for (const prerendered_t &p : slots) total += p.size;
+    return total;
+}
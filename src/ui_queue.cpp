@@ -0,0 +1,145 @@
+#include "ui_queue.h"
+
+#include <string.h>
+#include <atomic>
+
+// Rajattu MPSC-rengas: jokaisella paikalla on järjestysnumero, joka kertoo onko
+// paikka vapaa kirjoittajalle (seq == pos) vai valmis lukijalle (seq == pos + 1).
+// Kirjoittajat varaavat paikan CAS-operaatiolla, lukija ei tarvitse atomisia vaihtoja.
+// Paikkaan tallennetaan seq - indeksi, jolloin nollattu taulukko on valmiiksi alustettu
+// eikä jonoa tarvitse erikseen käynnistää ennen kuin taustatehtävät alkavat kirjoittaa.
+
+struct ui_slot_t {
+    std::atomic<uint32_t> seq;
+    ui_cmd_t cmd;
+};
+
+static ui_slot_t slots[UI_QUEUE_LEN];
+static std::atomic<uint32_t> enqueue_pos(0);
+static uint32_t dequeue_pos = 0;
+static std::atomic<uint32_t> dropped(0);
+
+static lv_obj_t *targets[UI_TARGET_COUNT];
+
+static bool push(const ui_cmd_t &cmd) {
+    uint32_t pos = enqueue_pos.load(std::memory_order_relaxed);
+    for (;;) {
+        uint32_t index = pos & (UI_QUEUE_LEN - 1);
+        ui_slot_t &slot = slots[index];
+        uint32_t seq = slot.seq.load(std::memory_order_acquire) + index;
+        int32_t diff = (int32_t)(seq - pos);
+        if (diff == 0) {
+            if (enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                slot.cmd = cmd;
+                slot.seq.store(pos + 1 - index, std::memory_order_release);
+                return true;
+            }
+        } else if (diff < 0) {
+            dropped.fetch_add(1, std::memory_order_relaxed); // Täynnä
+            return false;
+        } else {
+            pos = enqueue_pos.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+static bool pop(ui_cmd_t *out) {
+    uint32_t index = dequeue_pos & (UI_QUEUE_LEN - 1);
+    ui_slot_t &slot = slots[index];
+    if ((int32_t)(slot.seq.load(std::memory_order_acquire) + index - (dequeue_pos + 1)) < 0) return false;
+    *out = slot.cmd;
+    slot.seq.store(dequeue_pos + UI_QUEUE_LEN - index, std::memory_order_release);
+    dequeue_pos++;
+    return true;
+}
+
+bool ui_post_text(ui_target_t target, const char *text) {
+    ui_cmd_t cmd;
+    cmd.type = UI_CMD_SET_TEXT;
+    cmd.target = target;
+    cmd.state = 0;
+    strncpy(cmd.text, text, UI_TEXT_MAX - 1);
+    cmd.text[UI_TEXT_MAX - 1] = '\0';
+    return push(cmd);
+}
+
+bool ui_post_state(ui_target_t target, lv_state_t state, bool on) {
+    ui_cmd_t cmd;
+    cmd.type = on ? UI_CMD_ADD_STATE : UI_CMD_CLEAR_STATE;
+    cmd.target = target;
+    cmd.state = state;
+    cmd.text[0] = '\0';
+    return push(cmd);
+}
+
+bool ui_post_mode(kiosk_mode_t mode) {
+    ui_cmd_t cmd;
+    cmd.type = UI_CMD_SET_MODE;
+    cmd.target = 0;
+    cmd.state = (uint16_t)mode;
+    cmd.text[0] = '\0';
+    return push(cmd);
+}
+
+void ui_queue_register(ui_target_t target, lv_obj_t *obj) {
+    targets[target] = obj;
+}
+
+// SET_TEXT-kohde: label itse tai painikkeen ensimmäinen lapsi, jos se on label
+static lv_obj_t *text_obj(lv_obj_t *obj) {
+    if (lv_obj_check_type(obj, &lv_label_class)) return obj;
+    lv_obj_t *child = lv_obj_get_child(obj, 0);
+    return child && lv_obj_check_type(child, &lv_label_class) ? child : NULL;
+}
+
+void ui_queue_drain() {
+    // Kerätään kohteittain lopputila, sovelletaan kerran
+    static char text[UI_TARGET_COUNT][UI_TEXT_MAX];
+    bool has_text[UI_TARGET_COUNT] = {};
+    uint16_t add[UI_TARGET_COUNT] = {}, clear[UI_TARGET_COUNT] = {};
+    int mode = -1;
+
+    ui_cmd_t cmd;
+    bool any = false;
+    for (int n = 0; n < UI_QUEUE_LEN && pop(&cmd); n++) { // Ei jäädä kiertämään, jos kirjoittajat täyttävät jonoa
+        if (cmd.target >= UI_TARGET_COUNT) continue;
+        any = true;
+        switch (cmd.type) {
+        case UI_CMD_SET_MODE:
+            mode = cmd.state;
+            break;
+        case UI_CMD_SET_TEXT:
+            memcpy(text[cmd.target], cmd.text, UI_TEXT_MAX);
+            has_text[cmd.target] = true;
+            break;
+        case UI_CMD_ADD_STATE:
+            add[cmd.target] |= cmd.state;
+            clear[cmd.target] &= ~cmd.state;
+            break;
+        case UI_CMD_CLEAR_STATE:
+            clear[cmd.target] |= cmd.state;
+            add[cmd.target] &= ~cmd.state;
+            break;
+        }
+    }
+    if (!any) return;
+
+    // Subjekti päivittää sidotut painikkeet ja labelin
+    if (mode >= 0) kiosk_mode_set((kiosk_mode_t)mode);
+
+    for (int t = 0; t < UI_TARGET_COUNT; t++) {
+        lv_obj_t *obj = targets[t];
+        if (!obj) continue;
+        // Sama teksti tai tila ei mitätöi aluetta uudelleen
+        lv_obj_t *label = has_text[t] ? text_obj(obj) : NULL;
+        if (label && strcmp(lv_label_get_text(label), text[t]) != 0) lv_label_set_text(label, text[t]);
+        lv_state_t set = add[t] & ~lv_obj_get_state(obj);
+        lv_state_t unset = clear[t] & lv_obj_get_state(obj);
+        if (set) lv_obj_add_state(obj, set);
+        if (unset) lv_obj_remove_state(obj, unset);
+    }
+}
+
+uint32_t ui_queue_dropped() {
+    return dropped.load(std::memory_order_relaxed);
+}
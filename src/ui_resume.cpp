@@ -0,0 +1,91 @@
+#include "ui_resume.h"
+#include "kiosk_mode.h"
+#include "kiosk_port.h"
+#include "klog.h"
+
+#include <stdio.h>
+
+#define UI_RESUME_MAGIC 0x55493031u // "UI01"
+
+struct ui_resume_region_t {
+    uint32_t magic;
+    ui_resume_state_t state;
+    uint32_t tries;        // Peräkkäiset palautukset ilman vakaata ajoa
+    uint32_t crc;          // magic..tries, kirjoitetaan viimeisenä
+};
+
+static KIOSK_RETAINED ui_resume_region_t region;
+static uint32_t boot_ms;
+
+static uint32_t region_crc() {
+    return kiosk_crc32(&region, offsetof(ui_resume_region_t, crc));
+}
+
+static void save() {
+    region.magic = UI_RESUME_MAGIC;
+    region.crc = region_crc();
+}
+
+bool ui_resume_load(ui_resume_state_t *out) {
+    bool valid = kiosk_warm_reset() && region.magic == UI_RESUME_MAGIC && region.crc == region_crc() &&
+                 region.state.mode < KIOSK_MODE_COUNT && region.state.screen < SCREEN_COUNT;
+    if (valid && region.tries >= UI_RESUME_MAX_TRIES) {
+        printf("[resume] tila kaatui %lu kertaa peräkkäin, aloitetaan alusta\n", (unsigned long)region.tries);
+        valid = false;
+    }
+    if (!valid) {
+        region.state = {};
+        region.tries = 0;
+        save();
+        return false;
+    }
+    region.tries++;
+    save();
+    *out = region.state;
+    return true;
+}
+
+static void mode_observer(lv_observer_t *observer, lv_subject_t *subject) {
+    (void)observer;
+    region.state.mode = (uint8_t)lv_subject_get_int(subject);
+    save();
+}
+
+static void screen_shown(screen_id_t id) {
+    region.state.screen = (uint8_t)id;
+    if (id == SCREEN_MAIN) region.state.product_id = 0; // Tapahtuma valmis tai peruttu
+    save();
+}
+
+void ui_resume_set_product(uint32_t product_id) {
+    region.state.product_id = product_id;
+    save();
+}
+
+static void stable_cb(lv_timer_t *t) {
+    (void)t;
+    region.tries = 0;
+    save();
+}
+
+static void refr_ready_cb(lv_event_t *e) {
+    (void)e;
+    if (boot_ms) return;
+    boot_ms = (uint32_t)(kiosk_time_us() / 1000);
+    printf("[resume] ensimmäinen ruutu %lu ms käynnistyksestä (%s, näkymä %s)\n", (unsigned long)boot_ms,
+           region.tries ? "palautettu" : "alusta", screens_name(screens_current()));
+    klog(KLOG_BOOT_READY, boot_ms, region.tries, screens_current());
+}
+
+void ui_resume_attach(lv_display_t *disp) {
+    region.state.screen = (uint8_t)screens_current();
+    lv_subject_add_observer(&kiosk_mode_subject, mode_observer, NULL); // Kutsuu heti nykyisellä tilalla
+    screens_set_show_hook(screen_shown);
+    lv_display_add_event_cb(disp, refr_ready_cb, LV_EVENT_REFR_READY, NULL);
+    lv_timer_t *t = lv_timer_create(stable_cb, UI_RESUME_STABLE_MS, NULL);
+    lv_timer_set_repeat_count(t, 1);
+}
+
+uint32_t ui_resume_boot_ms() {
+    return boot_ms;
+}
@@ -0,0 +1,221 @@
+#include "ui_screens.h"
+#include "draw_stats.h"
+#include "input_trace.h"
+#include "kiosk_config.h"
+#include "kiosk_idle.h"
+#include "kiosk_mode.h"
+#include "klog.h"
+#include "perf_overlay.h"
+#include "postmortem.h"
+#include "screens.h"
+#include "sync.h"
+#include "tx_queue.h"
+#include "ui_assets.h"
+#include "ui_gen.h"
+#include "ui_lang.h"
+#include "ui_prerender.h"
+#include "ui_queue.h"
+#include "ui_resume.h"
+#include "ui_snappy.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+// Generoitujen näkymien oliot (ui/layout.json). Päivittyvät rakentajissa, koska LRU voi poistaa näkymän.
+ui_main_t ui_main;
+static ui_scan_t scan_ui;
+static ui_confirm_t confirm_ui;
+static ui_error_t error_ui;
+static ui_admin_t admin_ui;
+
+static catalog_item_t pending_item; // Vahvistusta odottava tuote
+
+static void go_main_cb(lv_event_t *e) {
+    (void)e;
+    screens_show(SCREEN_MAIN);
+}
+
+static void go_confirm_cb(lv_event_t *e) {
+    (void)e;
+    screens_show(SCREEN_CONFIRM);
+}
+
+static void confirm_cb(lv_event_t *e) {
+    (void)e;
+    bool palautus = kiosk_mode_get() == KIOSK_MODE_PALAUTUS;
+    tx_record_t r = {};
+    r.timestamp = (uint32_t)time(NULL);
+    r.product_id = pending_item.id;
+    r.amount_cents = palautus ? -pending_item.price_cents : pending_item.price_cents;
+    r.qty = 1;
+    r.mode = palautus ? TX_MODE_PALAUTUS : TX_MODE_OTTO;
+    ui_resume_set_product(0); // Kaatuminen tallennuksen jälkeen ei saa palauttaa vahvistusta uudelleen
+    uint32_t seq = txq_push(&r);
+    if (seq) {
+        klog(KLOG_TX_PUSH, seq, r.product_id, (uint32_t)r.amount_cents);
+        screens_show(SCREEN_MAIN);
+    } else {
+        klog(KLOG_TX_PUSH_FAIL, r.product_id);
+        ui_show_error(UI_STR_SAVE_FAILED);
+    }
+}
+
+// Esipiirretyt tilapainikkeet kuvataan uudelleen kielen vaihduttua. Kuvaus vasta
+// seuraavalla kierroksella, kun painikkeiden labelien observerit ovat vaihtaneet tekstit.
+static void prerender_mode_buttons(void *arg) {
+    (void)arg;
+    ui_prerender_button(ui_main.btn_otto);
+    ui_prerender_button(ui_main.btn_palautus);
+}
+
+static void prerender_lang_observer(lv_observer_t *observer, lv_subject_t *subject) {
+    (void)observer;
+    (void)subject;
+    ui_prerender_release(ui_main.btn_otto);
+    ui_prerender_release(ui_main.btn_palautus);
+    lv_async_call(prerender_mode_buttons, NULL);
+}
+
+// Piilotettu pääsy ylläpitoon: ADMIN_TAPS napautusta kehotteeseen ADMIN_TAP_WINDOW_MS:n sisällä
+static void admin_tap_cb(lv_event_t *e) {
+    (void)e;
+    static uint32_t first_ms;
+    static uint32_t taps;
+    uint32_t now = lv_tick_get();
+    if (taps == 0 || lv_tick_diff(now, first_ms) > ADMIN_TAP_WINDOW_MS) {
+        first_ms = now;
+        taps = 0;
+    }
+    if (++taps < ADMIN_TAPS) return;
+    taps = 0;
+    screens_show(SCREEN_ADMIN);
+}
+
+// Päänäkymä: kehote ylhäällä ja tilapainikkeet (Otto/Palautus) keskellä
+static lv_obj_t *build_main() {
+    lv_obj_t *scr = ui_main_create(&ui_main);
+    kiosk_mode_bind_prompt(ui_main.prompt); // Teksti tulee tilan kehotteesta
+    kiosk_mode_bind_button(ui_main.btn_otto, KIOSK_MODE_OTTO); // Valittuna, kun tila on Otto
+    kiosk_mode_bind_button(ui_main.btn_palautus, KIOSK_MODE_PALAUTUS); // Valittuna, kun tila on Palautus
+    perf_overlay_bind_toggle(ui_main.prompt); // Piilotettu: pitkä painallus näyttää suorituskykyruudun
+    lv_obj_add_event_cb(ui_main.prompt, admin_tap_cb, LV_EVENT_SHORT_CLICKED, NULL); // Piilotettu: ylläpitonäkymä
+    if (KIOSK_PRERENDER_BUTTONS) {
+        // Kutsuu heti; valmiiksi esipiirrettyihin painikkeisiin myöhempi kuvaus ei koske
+        lv_subject_add_observer_obj(&ui_lang_subject, prerender_lang_observer, ui_main.btn_otto, NULL);
+        prerender_mode_buttons(NULL);
+    }
+    return scr;
+}
+
+static lv_obj_t *build_scan_result() {
+    lv_obj_t *scr = ui_scan_create(&scan_ui);
+    lv_obj_add_event_cb(scan_ui.btn_ok, go_confirm_cb, LV_EVENT_CLICKED, NULL);
+    lv_obj_add_event_cb(scan_ui.btn_cancel, go_main_cb, LV_EVENT_CLICKED, NULL);
+    return scr;
+}
+
+static lv_obj_t *build_confirm() {
+    lv_obj_t *scr = ui_confirm_create(&confirm_ui);
+    lv_obj_add_event_cb(confirm_ui.btn_yes, confirm_cb, LV_EVENT_CLICKED, NULL);
+    lv_obj_add_event_cb(confirm_ui.btn_no, go_main_cb, LV_EVENT_CLICKED, NULL);
+    return scr;
+}
+
+static lv_obj_t *build_error() {
+    lv_obj_t *scr = ui_error_create(&error_ui);
+    lv_obj_add_event_cb(error_ui.btn_ok, go_main_cb, LV_EVENT_CLICKED, NULL);
+    return scr;
+}
+
+static void admin_refresh_cb(lv_event_t *e) {
+    (void)e;
+    sync_stats_t s;
+    sync_get_stats(&s);
+    lv_label_set_text_fmt(admin_ui.info, ui_tr(UI_STR_ADMIN_INFO),
+                          (unsigned long)txq_pending(), (unsigned long)s.records, (unsigned long)catalog_version(),
+                          (unsigned long)ui_resume_boot_ms(), (unsigned long)ui_queue_dropped());
+    screens_print_metrics();
+    draw_stats_print();
+    kiosk_idle_print_stats();
+    ui_assets_print_stats();
+}
+
+static void klog_dump_cb(lv_event_t *e) {
+    (void)e;
+    klog_dump_console(); // tools/klog_decode.py --port tai tallennettu sarjaloki
+}
+
+static void lang_cb(lv_event_t *e) {
+    ui_lang_next(); // Sidotut tekstit vaihtuvat kaikissa muistissa olevissa näkymissä
+    admin_refresh_cb(e);
+}
+
+static void snappy_cb(lv_event_t *e) {
+    ui_snappy_set(lv_obj_has_state((lv_obj_t *)lv_event_get_target(e), LV_STATE_CHECKED));
+}
+
+static lv_obj_t *build_admin() {
+    lv_obj_t *scr = ui_admin_create(&admin_ui);
+    lv_obj_add_event_cb(scr, admin_refresh_cb, LV_EVENT_SCREEN_LOAD_START, NULL);
+    lv_obj_add_flag(admin_ui.info, LV_OBJ_FLAG_CLICKABLE);
+    lv_obj_add_event_cb(admin_ui.info, klog_dump_cb, LV_EVENT_LONG_PRESSED, NULL); // Pitkä painallus purkaa lokin
+    lv_obj_add_event_cb(admin_ui.btn_back, go_main_cb, LV_EVENT_CLICKED, NULL);
+    lv_obj_add_event_cb(admin_ui.btn_lang, lang_cb, LV_EVENT_CLICKED, NULL);
+    lv_obj_set_state(admin_ui.btn_snappy, LV_STATE_CHECKED, ui_snappy_get());
+    lv_obj_add_event_cb(admin_ui.btn_snappy, snappy_cb, LV_EVENT_VALUE_CHANGED, NULL);
+    return scr;
+}
+
+void ui_screens_register() {
+    screens_set_build_hook(ui_snappy_apply); // Nopea tila myös myöhemmin rakennettaviin näkymiin
+    screens_register(SCREEN_MAIN, build_main, true); // Aina muistissa
+    screens_register(SCREEN_SCAN_RESULT, build_scan_result, false);
+    screens_register(SCREEN_CONFIRM, build_confirm, false);
+    screens_register(SCREEN_ERROR, build_error, false);
+    screens_register(SCREEN_ADMIN, build_admin, false);
+}
+
+// Tuotenäkymän tekstit pending_item-tuotteesta ja näkymä esiin
+static void show_scan_result() {
+    ui_resume_set_product(pending_item.id);
+    screens_get(SCREEN_SCAN_RESULT);
+    lv_label_set_text_fmt(scan_ui.name, "%.*s", CATALOG_NAME_LEN, pending_item.name);
+    int32_t cents = pending_item.price_cents;
+    lv_label_set_text_fmt(scan_ui.price, "%ld,%02ld EUR", (long)(cents / 100), (long)(cents % 100));
+    screens_show(SCREEN_SCAN_RESULT);
+}
+
+void ui_scan(uint32_t product_id) {
+    input_trace_scan(product_id); // Tallennetaan vain, jos tallennus on päällä
+    klog(KLOG_SCAN, product_id);
+    postmortem_scan(product_id);
+    lv_display_trigger_activity(NULL); // Viivakoodi on aktiivisuutta siinä missä kosketus (kiosk_idle.h)
+    if (!catalog_lookup(product_id, &pending_item)) {
+        klog(KLOG_SCAN_UNKNOWN, product_id);
+        ui_show_error(UI_STR_UNKNOWN_PRODUCT);
+        return;
+    }
+    show_scan_result();
+}
+
+void ui_show_error(ui_str_t message) {
+    screens_get(SCREEN_ERROR);
+    lv_label_set_text_static(error_ui.message, ui_tr(message));
+    screens_show(SCREEN_ERROR);
+}
+
+void ui_screens_restore(const ui_resume_state_t *state) {
+    kiosk_mode_set((kiosk_mode_t)state->mode);
+    screen_id_t screen = (screen_id_t)state->screen;
+    // Virhe- ja ylläpitonäkymän sisältöä ei säilytetä; tuotenäkymät vain, jos tuote löytyy yhä
+    bool has_item = state->product_id && catalog_lookup(state->product_id, &pending_item);
+    if (screen == SCREEN_SCAN_RESULT && has_item) {
+        show_scan_result();
+    } else if (screen == SCREEN_CONFIRM && has_item) {
+        ui_resume_set_product(pending_item.id);
+        screens_show(SCREEN_CONFIRM); // Vahvistus ei näytä tuotetta, tuotenäkymää ei tarvitse rakentaa
+    } else {
+        screens_show(SCREEN_MAIN);
+    }
+}
@@ -0,0 +1,58 @@
+#include "ui_snappy.h"
+#include "kiosk_config.h"
+#include "kiosk_port.h"
+#include "screens.h"
+#include "ui_gen.h"
+
+#include <stdio.h>
+
+static bool snappy = KIOSK_SNAPPY_DEFAULT;
+
+void ui_snappy_apply(lv_obj_t *root) {
+    if (lv_obj_check_type(root, &lv_button_class)) {
+        lv_obj_remove_style(root, UI_STYLE(ui_style_snappy), LV_PART_ANY | LV_STATE_ANY);
+        if (snappy) {
+            // Teema asettaa siirtymät oletus- ja painettu-tiloille; sama valitsin voittaa, koska lisätään viimeisenä
+            lv_obj_add_style(root, UI_STYLE(ui_style_snappy), 0);
+            lv_obj_add_style(root, UI_STYLE(ui_style_snappy), LV_STATE_PRESSED);
+        }
+    }
+    uint32_t n = lv_obj_get_child_count(root);
+    for (uint32_t i = 0; i < n; i++) ui_snappy_apply(lv_obj_get_child(root, i));
+}
+
+static void apply_all() {
+    for (int i = 0; i < SCREEN_COUNT; i++) {
+        lv_obj_t *scr = screens_peek((screen_id_t)i);
+        if (scr) ui_snappy_apply(scr);
+    }
+}
+
+void ui_snappy_load() {
+    char path[64];
+    kiosk_fs_path(path, sizeof(path), "snappy");
+    FILE *f = fopen(path, "r");
+    if (!f) return; // Ei tallennettua valintaa: oletus
+    int c = fgetc(f);
+    fclose(f);
+    bool on = c == '1';
+    if (on == snappy) return;
+    snappy = on;
+    apply_all();
+}
+
+void ui_snappy_set(bool on) {
+    if (on == snappy) return;
+    snappy = on;
+    apply_all();
+    char path[64];
+    kiosk_fs_path(path, sizeof(path), "snappy");
+    FILE *f = fopen(path, "w");
+    if (!f) return;
+    fputc(on ? '1' : '0', f);
+    fclose(f);
+}
+
+bool ui_snappy_get() {
+    return snappy;
+}
@@ -0,0 +1,115 @@
+#!/usr/bin/env python3
+"""Tuoteluettelon indeksi- ja erotustiedostot (ks. include/catalog.h).
+
+    # CSV (id;hinta_senteissä;nimi) -> catalog.idx
+    python3 tools/catalog_delta.py build tuotteet.csv catalog.idx --version 7
+
+    # Erotus kahden luettelon välillä (CSV tai .idx)
+    python3 tools/catalog_delta.py diff vanha.idx uusi.csv delta.bin --new-version 8
+
+    # Erotus tyhjästä = koko luettelo (kioski ilman luetteloa, versio 0)
+    python3 tools/catalog_delta.py diff - uusi.csv delta-0.bin --new-version 8
+
+mock_backend.py --catalog-dir DIR tarjoaa tiedostot DIR/delta-<versio>.bin.
+"""
+
+import argparse
+import csv
+import struct
+import sys
+import zlib
+
+NAME_LEN = 24
+ITEM = struct.Struct("<Ii%ds" % NAME_LEN)
+INDEX_HEADER = struct.Struct("<4sIII")
+DELTA_HEADER = struct.Struct("<4sIIII")
+OP = struct.Struct("<I")
+OP_REMOVE, OP_UPSERT = 0, 1
+
+
+def pack_item(item_id, price, name):
+    raw = name.encode("utf-8")[:NAME_LEN]
+    return ITEM.pack(item_id, price, raw)
+
+
+def load(path):
+    """Palauttaa (versio, {id: (hinta, nimi)})"""
+    if path == "-":
+        return 0, {}
+    if path.endswith(".idx"):
+        with open(path, "rb") as f:
+            data = f.read()
+        magic, version, count, crc = INDEX_HEADER.unpack_from(data)
+        if magic != b"KCI1":
+            sys.exit(f"{path}: ei luettelotiedosto")
+        body = data[INDEX_HEADER.size:INDEX_HEADER.size + count * ITEM.size]
+        if zlib.crc32(body) != crc:
+            sys.exit(f"{path}: CRC ei täsmää")
+        items = {}
+        for i in range(count):
+            item_id, price, name = ITEM.unpack_from(body, i * ITEM.size)
+            items[item_id] = (price, name.rstrip(b"\0").decode("utf-8", "replace"))
+        return version, items
+    items = {}
+    with open(path, newline="", encoding="utf-8") as f:
+        for row in csv.reader(f, delimiter=";"):
+            if not row or row[0].startswith("#"):
+                continue
+            items[int(row[0])] = (int(row[1]), row[2])
+    return None, items
+
+
+def cmd_build(args):
+    _, items = load(args.csv)
+    body = b"".join(pack_item(i, *items[i]) for i in sorted(items))
+    with open(args.out, "wb") as f:
+        f.write(INDEX_HEADER.pack(b"KCI1", args.version, len(items), zlib.crc32(body)))
+        f.write(body)
+    print(f"{args.out}: {len(items)} tuotetta, {INDEX_HEADER.size + len(body)} tavua")
+
+
+def cmd_diff(args):
+    old_version, old = load(args.old)
+    new_version, new = load(args.new)
+    base = args.base_version if args.base_version is not None else old_version
+    target = args.new_version if args.new_version is not None else new_version
+    if base is None or target is None:
+        sys.exit("CSV-syötteelle anna --base-version / --new-version")
+
+    ops = []
+    for item_id in sorted(set(old) | set(new)):
+        if item_id not in new:
+            ops.append(OP.pack(OP_REMOVE) + pack_item(item_id, 0, ""))
+        elif old.get(item_id) != new[item_id]:
+            ops.append(OP.pack(OP_UPSERT) + pack_item(item_id, *new[item_id]))
+    body = b"".join(ops)
+    with open(args.out, "wb") as f:
+        f.write(DELTA_HEADER.pack(b"KCD1", base, target, len(ops), zlib.crc32(body)))
+        f.write(body)
+    full = INDEX_HEADER.size + len(new) * ITEM.size
+    size = DELTA_HEADER.size + len(body)
+    print(f"{args.out}: versio {base} -> {target}, {len(ops)} muutosta, "
+          f"{size} tavua ({100.0 * size / full:.1f} % koko luettelosta)")
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    sub = ap.add_subparsers(dest="cmd", required=True)
+    b = sub.add_parser("build")
+    b.add_argument("csv")
+    b.add_argument("out")
+    b.add_argument("--version", type=int, required=True)
+    b.set_defaults(fn=cmd_build)
+    d = sub.add_parser("diff")
+    d.add_argument("old")
+    d.add_argument("new")
+    d.add_argument("out")
+    d.add_argument("--base-version", type=int)
+    d.add_argument("--new-version", type=int)
+    d.set_defaults(fn=cmd_diff)
+    args = ap.parse_args()
+    args.fn(args)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,586 @@
+#!/usr/bin/env python3
+"""Käyttöliittymän fontit: kaikki koot yhdestä TTF:stä, karsittuina ja yhdeksi lähdetiedostoksi.
+
+    python3 tools/font_build.py                       # ui/strings.json "font" -> src/ui_fonts.c, include/ui_fonts.h
+    python3 tools/font_build.py --check               # virhe, jos generoidut eivät ole ajan tasalla
+    python3 tools/font_build.py --report --sizes 24,32,48,70 --budget-kb 400
+    python3 tools/font_build.py --catalog tuotteet.csv   # luettelon nimien merkit mukaan
+
+Vaiheet:
+  1. Jokaiselle koolle lv_font_conv-tuloste fonts/<nimi>_<koko>.c (koko Latin-1,
+     --range 32-255). Puuttuva tuotetaan TTF:stä (fonts/arial.ttf, ei versionhallinnassa)
+     komennolla lv_font_conv tai npx lv_font_conv; --regen tuottaa kaikki uudelleen.
+     Ilman TTF:ää puuttuva koko skaalataan suurimmasta olemassa olevasta lähteestä
+     (pinta-alakeskiarvo, ei vihjeistystä); otsakkeen Opts-rivi kertoo sen, ja --regen
+     korvaa tiedoston TTF:stä rasteroidulla, kun fontti on kopioitu.
+  2. Mukaan vain tarvittavat merkit: "font"-kohdan välit (ASCII: hinnat, koodit),
+     "catalog"-tiedoston merkit (luettelon tuotenimet) sekä kaikkien kielten tekstien
+     merkit. Uusi kieli tai tuotenimi lisää vain merkit, joita fontissa ei vielä
+     ollut. --catalog lukee luettelon (CSV tai .idx, tools/catalog_delta.py) ja lisää
+     nimien ASCII:n ulkopuoliset merkit tiedostoon; merkkejä ei poisteta, jotta
+     vanhan luettelon nimet näkyvät yhä.
+  3. Kaikilla koilla on sama merkistö, joten merkistötaulukko (cmaps) on yhteinen.
+     Saman koon identtiset bittikartat tallennetaan kerran.
+  4. Raportti koko kerrallaan: merkit, bittikartat, glyfikuvaajat ja yhteensä,
+     jotta koot voi valita flash-budjettia vasten.
+  5. include/ui_fonts.h: fonttien esittely ja metriikat X-makrona UI_FONTS, josta
+     ui_font_proxy.c tekee välittäjät, kun fontit tulevat ajonaikaisesti.
+  6. "assets"-hakemistoon samat fontit LVGL:n binäärimuodossa (<nimi>_<koko>.bin)
+     assets-osiota varten (include/ui_assets.h).
+
+Ajetaan myös PlatformIO:n pre-skriptinä kuten gen_ui.py; tulos on versionhallinnassa.
+"""
+
+import argparse
+import json
+import math
+import os
+import re
+import shutil
+import struct
+import subprocess
+import sys
+
+STRINGS = os.path.join("ui", "strings.json")
+LAYOUT = os.path.join("ui", "layout.json")
+
+# LVGL 9.2, 32-bittinen kohde: lv_font_fmt_txt_glyph_dsc_t, lv_font_fmt_txt_cmap_t, dsc + lv_font_t
+GLYPH_DSC_BYTES = 8
+CMAP_BYTES = 20
+FONT_FIXED_BYTES = 80
+
+GLYPH_DSC = re.compile(r"\{\.bitmap_index = (\d+), \.adv_w = (\d+), \.box_w = (\d+), \.box_h = (\d+), "
+                       r"\.ofs_x = (-?\d+), \.ofs_y = (-?\d+)\}")
+CMAP = re.compile(r"\.range_start = (\d+), \.range_length = (\d+), \.glyph_id_start = (\d+),\s*"
+                  r"\.unicode_list = NULL, \.glyph_id_ofs_list = NULL, \.list_length = 0, "
+                  r"\.type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY")
+
+
+def field(text, name):
+    m = re.search(r"\.%s = (-?\w+)" % name, text)
+    if not m:
+        raise ValueError("lähdefontista puuttuu .%s" % name)
+    return m.group(1)
+
+
+def parse_font(text):
+    """Lähdefontin glyfit {koodipiste: (dsc, bittikartta)} ja metriikat."""
+    start = text.index("glyph_bitmap[] = {")
+    end = text.index("};", start)
+    body = re.sub(r"/\*.*?\*/", "", text[start + len("glyph_bitmap[] = {"):end], flags=re.S)
+    bitmap = bytes(int(v, 0) for v in re.findall(r"0x[0-9a-fA-F]+|\d+", body))
+
+    dsc_start = text.index("glyph_dsc[] = {")
+    dscs = [tuple(int(v) for v in m) for m in GLYPH_DSC.findall(text[dsc_start:text.index("};", dsc_start)])]
+    if field(text, "kern_dsc") != "NULL":
+        raise ValueError("kerning-taulukoita ei tueta")
+    bpp = int(field(text, "bpp"))
+
+    glyphs = {}
+    for range_start, range_length, glyph_id_start in (tuple(int(v) for v in m) for m in CMAP.findall(text)):
+        for i in range(range_length):
+            index, adv_w, box_w, box_h, ofs_x, ofs_y = dscs[glyph_id_start + i]
+            size = (box_w * box_h * bpp + 7) // 8
+            glyphs[range_start + i] = (dscs[glyph_id_start + i], bitmap[index:index + size])
+    if int(field(text, "cmap_num")) != len(re.findall(r"\.range_start", text)) or not glyphs:
+        raise ValueError("vain LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY-merkistöt tuetaan (--no-compress --range)")
+
+    opts = re.search(r"^ \* Opts: (.*)$", text, re.M)
+    fallback = re.search(r"\.fallback = &(\w+)", text)
+    return {
+        "opts": opts.group(1) if opts else "",
+        "bpp": bpp,
+        "line_height": field(text, "line_height"),
+        "base_line": field(text, "base_line"),
+        "underline_position": field(text, "underline_position"),
+        "underline_thickness": field(text, "underline_thickness"),
+        "fallback": fallback.group(1) if fallback else None,
+        "glyphs": glyphs,
+    }
+
+
+def read_catalog_chars(project_dir, cfg):
+    if "catalog" not in cfg:
+        return set()
+    path = os.path.join(project_dir, cfg["catalog"])
+    if not os.path.exists(path):
+        return set()
+    with open(path, encoding="utf-8") as f:
+        return set(f.read()) - {"\n"}
+
+
+def add_catalog_chars(project_dir, cfg, catalog):
+    """Luettelon nimien ASCII:n ulkopuoliset merkit "catalog"-tiedostoon; palauttaa uudet."""
+    from catalog_delta import load  # tools/ on sys.pathissa
+    _, items = load(catalog)
+    old = read_catalog_chars(project_dir, cfg)
+    new = {c for _, name in items.values() for c in name if ord(c) > 126} - old
+    if new:
+        with open(os.path.join(project_dir, cfg["catalog"]), "w", encoding="utf-8", newline="\n") as f:
+            f.write("".join(sorted(old | new)) + "\n")
+    return new
+
+
+def needed_chars(strings, layout, catalog_chars):
+    """Perusmerkistö ja kielten tekstien merkit kielittäin."""
+    font = strings["font"]
+    base = set(catalog_chars)
+    for lo, hi in font.get("ranges", []):
+        base.update(chr(c) for c in range(lo, hi + 1))
+    for widgets in layout.get("screens", {}).values():
+        for w in widgets:
+            if not w.get("text", "@").startswith("@"):
+                base.update(w["text"])
+    per_lang = {}
+    for lang in strings["languages"]:
+        per_lang[lang] = set("".join(tr[lang] for tr in strings["strings"].values()))
+    for chars in [base] + list(per_lang.values()):
+        chars.discard("\n")
+    return base, per_lang
+
+
+def font_conv(project_dir, cfg, size, out_path):
+    ttf = os.path.join(project_dir, cfg["ttf"])
+    if not os.path.exists(ttf):
+        raise ValueError("%s puuttuu eikä %s ole saatavilla (kopioi fontti, sitä ei jaeta versionhallinnassa)"
+                         % (os.path.relpath(out_path, project_dir), cfg["ttf"]))
+    conv = ["lv_font_conv"] if shutil.which("lv_font_conv") else ["npx", "--yes", "lv_font_conv"]
+    # Sama komento kuin alkuperäisen Arial_70.c:n otsakkeessa, koko ja tiedosto vaihtuvat
+    cmd = conv + ["--bpp", str(cfg["bpp"]), "--size", str(size), "--no-compress", "--font", ttf,
+                  "--range", cfg.get("source_range", "32-255"), "--format", "lvgl", "-o", out_path]
+    print("font_build: " + " ".join(cmd))
+    subprocess.run(cmd, check=True)
+
+
+def unpack(bitmap, count, bpp):
+    """Pakattu bittivirta (rivejä ei tasata tavuihin) -> arvot 0..2^bpp-1"""
+    per = 8 // bpp
+    mask = (1 << bpp) - 1
+    return [(bitmap[i // per] >> (8 - bpp * (i % per + 1))) & mask for i in range(count)]
+
+
+def pack(values, bpp):
+    per = 8 // bpp
+    out = bytearray((len(values) * bpp + 7) // 8)
+    for i, v in enumerate(values):
+        out[i // per] |= v << (8 - bpp * (i % per + 1))
+    return bytes(out)
+
+
+def overlap(lo, hi, n):
+    """Kohdepikselin [lo, hi) painot lähdepikseleille 0..n-1: [(indeksi, paino)]"""
+    return [(k, min(hi, k + 1) - max(lo, k)) for k in range(max(0, int(lo)), min(n, int(hi) + 1))
+            if min(hi, k + 1) > max(lo, k)]
+
+
+def scale_glyph(dsc, bitmap, bpp, s):
+    """Glyfi koossa s * lähde. Laatikko on y ylöspäin perusviivasta (ofs_y = alareuna)."""
+    _, adv_w, box_w, box_h, ofs_x, ofs_y = dsc
+    adv = int(round(adv_w * s))
+    if not box_w or not box_h:
+        return (0, adv, 0, 0, 0, 0), b""
+    top = (1 << bpp) - 1
+    src = unpack(bitmap, box_w * box_h, bpp)
+    x0, x1 = math.floor(ofs_x * s), math.ceil((ofs_x + box_w) * s)
+    y0, y1 = math.floor(ofs_y * s), math.ceil((ofs_y + box_h) * s)
+    w, h = x1 - x0, y1 - y0
+    # Kohdepikselin reunat lähteen pikseleinä; rivit ylhäältä alas kuten bittikartassa
+    cols = [overlap((x0 + i) / s - ofs_x, (x0 + i + 1) / s - ofs_x, box_w) for i in range(w)]
+    rows = [overlap(ofs_y + box_h - (y1 - j) / s, ofs_y + box_h - (y1 - j - 1) / s, box_h) for j in range(h)]
+    area = s * s / top
+    px = [[0] * w for _ in range(h)]
+    for j, row in enumerate(rows):
+        acc = [0.0] * box_w
+        for k, wy in row:
+            line = src[k * box_w:(k + 1) * box_w]
+            for x in range(box_w):
+                acc[x] += line[x] * wy
+        for i, col in enumerate(cols):
+            v = sum(acc[k] * wx for k, wx in col) * area
+            px[j][i] = min(top, int(v * top + 0.5))
+    # Tyhjät reunarivit ja -sarakkeet pois kuten lv_font_conv
+    while h and not any(px[0]):
+        px.pop(0)
+        h -= 1
+    while h and not any(px[-1]):
+        px.pop()
+        h -= 1
+        y0 += 1
+    if not h:
+        return (0, adv, 0, 0, 0, 0), b""
+    while not any(r[0] for r in px):
+        px = [r[1:] for r in px]
+        x0 += 1
+        w -= 1
+    while not any(r[-1] for r in px):
+        px = [r[:-1] for r in px]
+        w -= 1
+    return (0, adv, w, h, x0, y0), pack([v for r in px for v in r], bpp)
+
+
+def scale_font(src, src_size, size):
+    """Lähdefontti koossa size; metriikat skaalataan samalla kertoimella."""
+    s = size / src_size
+    glyphs = {cp: scale_glyph(dsc, bitmap, src["bpp"], s) for cp, (dsc, bitmap) in src["glyphs"].items()}
+    return dict(src, glyphs=glyphs,
+                opts="skaalattu %s_%d.c:stä (tools/font_build.py, ei TTF:ää)" % (src["name"], src_size),
+                line_height=str(int(math.ceil(int(src["line_height"]) * s))),
+                base_line=str(int(round(int(src["base_line"]) * s))),
+                underline_position=str(int(round(int(src["underline_position"]) * s))),
+                underline_thickness=str(max(1, int(round(int(src["underline_thickness"]) * s)))))
+
+
+def write_source(path, name, size, font):
+    """Fontti lv_font_conv:n C-muodossa (parse_font() lukee tämän kuten alkuperäisen)."""
+    cps = sorted(font["glyphs"])
+    sym = "%s_%d" % (name, size)
+    out = ["/*******************************************************************************",
+           " * Size: %d px" % size, " * Bpp: %d" % font["bpp"], " * Opts: %s" % font["opts"],
+           " ******************************************************************************/", "",
+           '#include "lvgl.h"', "",
+           "#ifndef %s" % sym.upper(), "#define %s 1" % sym.upper(), "#endif", "",
+           "#if %s" % sym.upper(), "",
+           "/*Store the image of the glyphs*/",
+           "static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {"]
+    dsc = ["    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */"]
+    index = 0
+    for cp in cps:
+        (_, adv_w, box_w, box_h, ofs_x, ofs_y), bitmap = font["glyphs"][cp]
+        out.append("    /* U+%04X \"%s\" */" % (cp, char_comment(cp)))
+        for i in range(0, len(bitmap), 8):
+            out.append("    " + " ".join("0x%x," % b for b in bitmap[i:i + 8]))
+        out.append("")
+        dsc.append("    {.bitmap_index = %d, .adv_w = %d, .box_w = %d, .box_h = %d, .ofs_x = %d, .ofs_y = %d}"
+                   % (index, adv_w, box_w, box_h, ofs_x, ofs_y))
+        index += len(bitmap)
+    out += ["};", "", "static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {", ",\n".join(dsc), "};", "",
+            "static const lv_font_fmt_txt_cmap_t cmaps[] =", "{"]
+    cmaps = []
+    glyph_id = 1
+    for lo, hi in runs(cps):
+        cmaps.append("    {\n"
+                     "        .range_start = %d, .range_length = %d, .glyph_id_start = %d,\n"
+                     "        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, "
+                     ".type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY\n"
+                     "    }" % (lo, hi - lo + 1, glyph_id))
+        glyph_id += hi - lo + 1
+    out += [",\n".join(cmaps), "};", "",
+            "static const lv_font_fmt_txt_dsc_t font_dsc = {",
+            "    .glyph_bitmap = glyph_bitmap,",
+            "    .glyph_dsc = glyph_dsc,",
+            "    .cmaps = cmaps,",
+            "    .kern_dsc = NULL,",
+            "    .kern_scale = 0,",
+            "    .cmap_num = %d," % len(cmaps),
+            "    .bpp = %d," % font["bpp"],
+            "    .kern_classes = 0,",
+            "    .bitmap_format = 0,",
+            "};", ""]
+    if font["fallback"]:
+        out += ["extern const lv_font_t %s;" % font["fallback"], ""]
+    out += ["const lv_font_t %s = {" % sym,
+            "    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/",
+            "    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/",
+            "    .line_height = %s,          /*The maximum line height required by the font*/" % font["line_height"],
+            "    .base_line = %s,             /*Baseline measured from the bottom of the line*/" % font["base_line"],
+            "    .subpx = LV_FONT_SUBPX_NONE,",
+            "    .underline_position = %s," % font["underline_position"],
+            "    .underline_thickness = %s," % font["underline_thickness"],
+            "    .dsc = &font_dsc,          /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */"]
+    if font["fallback"]:
+        out.append("    .fallback = &%s," % font["fallback"])
+    out += ["    .user_data = NULL,", "};", "", "#endif /*#if %s*/" % sym.upper(), ""]
+    with open(path, "w", encoding="utf-8", newline="\n") as f:
+        f.write("\n".join(out))
+
+
+def scale_source(project_dir, cfg, size, out_path):
+    """Lähde suurimmasta olemassa olevasta koosta, kun TTF:ää ei ole (ks. vaihe 1)."""
+    pattern = re.compile(r"%s_(\d+)\.c$" % re.escape(cfg["name"]))
+    sources_dir = os.path.join(project_dir, cfg["sources"])
+    have = sorted(int(m.group(1)) for m in (pattern.match(n) for n in os.listdir(sources_dir)) if m)
+    larger = [s for s in have if s > size]
+    if not larger:
+        raise ValueError("%s puuttuu eikä %s ole saatavilla (kopioi fontti, sitä ei jaeta versionhallinnassa)"
+                         % (os.path.relpath(out_path, project_dir), cfg["ttf"]))
+    src_size = larger[-1]
+    with open(os.path.join(sources_dir, "%s_%d.c" % (cfg["name"], src_size)), encoding="utf-8") as f:
+        src = dict(parse_font(f.read()), name=cfg["name"])
+    print("font_build: %s ei ole, %s skaalataan %d px:stä" % (cfg["ttf"], os.path.relpath(out_path, project_dir),
+                                                              src_size))
+    write_source(out_path, cfg["name"], size, scale_font(src, src_size, size))
+
+
+def runs(cps):
+    out = []
+    for cp in cps:
+        if out and out[-1][1] == cp - 1:
+            out[-1][1] = cp
+        else:
+            out.append([cp, cp])
+    return out
+
+
+def char_comment(cp):
+    ch = chr(cp)
+    return "\\\"" if ch == '"' else ("\\\\" if ch == "\\" else ch)
+
+
+def emit_size(name, font, cps, out):
+    """Yhden koon bittikartat, kuvaajat ja fontti; palauttaa (bittikartat, säästetyt) tavuina."""
+    sym = name.lower()
+    glyphs = font["glyphs"]
+    out += ["/*-----------------", " *  %s" % name, " *----------------*/", "",
+            "static LV_ATTRIBUTE_LARGE_CONST const uint8_t %s_bitmap[] = {" % sym]
+    dsc = ["    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */"]
+    seen = {}
+    index = saved = 0
+    for cp in cps:
+        (_, adv_w, box_w, box_h, ofs_x, ofs_y), bitmap = glyphs[cp]
+        if bitmap and bitmap in seen:
+            # Sama kuva kuin aiemmalla merkillä (esim. l / I tai välilyönnit)
+            at, first = seen[bitmap]
+            out.append("    /* U+%04X \"%s\" = U+%04X */" % (cp, char_comment(cp), first))
+            saved += len(bitmap)
+        else:
+            at = index
+            seen[bitmap] = (at, cp)
+            out.append("    /* U+%04X \"%s\" */" % (cp, char_comment(cp)))
+            for i in range(0, len(bitmap), 8):
+                out.append("    " + " ".join("0x%x," % b for b in bitmap[i:i + 8]))
+            index += len(bitmap)
+        dsc.append("    {.bitmap_index = %d, .adv_w = %d, .box_w = %d, .box_h = %d, .ofs_x = %d, .ofs_y = %d}"
+                   % (at, adv_w, box_w, box_h, ofs_x, ofs_y))
+    out += ["};", "",
+            "static const lv_font_fmt_txt_glyph_dsc_t %s_glyph_dsc[] = {" % sym, ",\n".join(dsc), "};", "",
+            "static const lv_font_fmt_txt_dsc_t %s_dsc = {" % sym,
+            "    .glyph_bitmap = %s_bitmap," % sym,
+            "    .glyph_dsc = %s_glyph_dsc," % sym,
+            "    .cmaps = ui_font_cmaps,",
+            "    .kern_dsc = NULL,",
+            "    .kern_scale = 0,",
+            "    .cmap_num = UI_FONT_CMAP_NUM,",
+            "    .bpp = %d," % font["bpp"],
+            "    .kern_classes = 0,",
+            "    .bitmap_format = 0,",
+            "};", "",
+            "const lv_font_t %s = {" % name,
+            "    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/",
+            "    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/",
+            "    .line_height = %s,          /*The maximum line height required by the font*/" % font["line_height"],
+            "    .base_line = %s,             /*Baseline measured from the bottom of the line*/" % font["base_line"],
+            "    .subpx = LV_FONT_SUBPX_NONE,",
+            "    .underline_position = %s," % font["underline_position"],
+            "    .underline_thickness = %s," % font["underline_thickness"],
+            "    .dsc = &%s_dsc,          /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */" % sym]
+    if font["fallback"]:
+        out.append("    .fallback = &%s," % font["fallback"])
+    out += ["    .user_data = NULL,", "};", ""]
+    return index, saved
+
+
+def generate(cfg, fonts, cps):
+    """fonts: [(koko, fontti)]; palauttaa (teksti, [(koko, bittikartat, säästetty)], cmap-määrä)."""
+    out = ["/*******************************************************************************",
+           " * Käyttöliittymän fontit %s, %d merkkiä (ui/strings.json)" % (
+               ", ".join("%s_%d" % (cfg["name"], s) for s, _ in fonts), len(cps)),
+           " * Generoitu: python3 tools/font_build.py. Älä muokkaa käsin."]
+    for size, font in fonts:
+        out.append(" * %d px: %s" % (size, font["opts"]))
+    out += [" ******************************************************************************/", "",
+            '#include "lvgl.h"', ""]
+    fallbacks = sorted({f["fallback"] for _, f in fonts if f["fallback"]})
+    for fb in fallbacks:
+        out.append("extern const lv_font_t %s;" % fb)
+    if fallbacks:
+        out.append("")
+
+    cmaps = []
+    glyph_id = 1
+    for lo, hi in runs(cps):
+        cmaps.append("    {\n"
+                     "        .range_start = %d, .range_length = %d, .glyph_id_start = %d,\n"
+                     "        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, "
+                     ".type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY\n"
+                     "    }" % (lo, hi - lo + 1, glyph_id))
+        glyph_id += hi - lo + 1
+    out += ["/*Kaikilla koilla sama merkistö ja glyfien järjestys; yhtenäiset välit suoraan, ei hakua*/",
+            "#define UI_FONT_CMAP_NUM %d" % len(cmaps),
+            "static const lv_font_fmt_txt_cmap_t ui_font_cmaps[UI_FONT_CMAP_NUM] = {",
+            ",\n".join(cmaps), "};", ""]
+
+    sizes = []
+    for size, font in fonts:
+        bitmap_bytes, saved = emit_size("%s_%d" % (cfg["name"], size), font, cps, out)
+        sizes.append((size, bitmap_bytes, saved))
+    return "\n".join(out), sizes, len(cmaps)
+
+
+def header(cfg, fonts):
+    """Fonttien esittely ja metriikat X-makrona (välittäjät, ui_font_proxy.h)."""
+    out = ["// Generoitu tiedostosta ui/strings.json: python3 tools/font_build.py. Älä muokkaa käsin.",
+           "#pragma once", "", "#include <lvgl.h>", "",
+           "// Käyttöliittymän fontit (src/ui_fonts.c), pienimmästä suurimpaan:",
+           "// X(nimi, koko, rivikorkeus, perusviiva, alleviivauksen kohta, alleviivauksen paksuus)",
+           "#define UI_FONTS(X) \\"]
+    for i, (size, font) in enumerate(fonts):
+        out.append("    X(%s_%d, %d, %s, %s, %s, %s)%s" % (
+            cfg["name"], size, size, font["line_height"], font["base_line"], font["underline_position"],
+            font["underline_thickness"], " \\" if i + 1 < len(fonts) else ""))
+    out += ["", "#define UI_FONT_DECLARE(name, size, line_height, base_line, ul_pos, ul_thickness) "
+            "LV_FONT_DECLARE(name)", "UI_FONTS(UI_FONT_DECLARE)", ""]
+    return "\n".join(out)
+
+
+def binfont(font, size, cps):
+    """Sama karsittu fontti LVGL:n binäärimuodossa (lv_binfont_create, lv_font_conv --format bin).
+
+    Taulukot head, cmap, loca ja glyf, ei kerningiä. Glyfin otsake on 48 bittiä
+    (adv_w 16, ofs_x/ofs_y 8, box_w/box_h 8), jolloin lataaja lukee bittikartan suoraan.
+    """
+    def table(label, body):
+        return struct.pack("<I", 8 + len(body)) + label + body
+
+    line_height, base_line = int(font["line_height"]), int(font["base_line"])
+    ascent, descent = line_height - base_line, -base_line
+    head = struct.pack("<IHHHhHhHhhHHBBBBBBBBBBhH",
+                       1, 3, size, ascent, descent, ascent, descent, 0, descent, ascent, 0, 0,
+                       1,   # index_to_loc_format: 32-bittiset siirrot
+                       1,   # glyph_id_format
+                       1,   # advance_width_format: 1/16 px kuten C-muodossa
+                       font["bpp"], 8, 8, 16,
+                       0,   # compression_id
+                       0, 0,
+                       int(font["underline_position"]), int(font["underline_thickness"]))
+
+    cmaps = runs(cps)
+    cmap = struct.pack("<I", len(cmaps))
+    glyph_id = 1
+    for lo, hi in cmaps:
+        cmap += struct.pack("<IIHHHBB", 0, lo, hi - lo + 1, glyph_id, 0, 2, 0)  # 2 = FORMAT0_TINY
+        glyph_id += hi - lo + 1
+
+    glyphs = [bytes(6)]  # id 0 varattu
+    for cp in cps:
+        (_, adv_w, box_w, box_h, ofs_x, ofs_y), bitmap = font["glyphs"][cp]
+        glyphs.append(struct.pack(">HbbBB", adv_w, ofs_x, ofs_y, box_w, box_h) + bitmap)
+    offsets, at = [], 8
+    for g in glyphs:
+        offsets.append(at)
+        at += len(g)
+    loca = struct.pack("<I", len(glyphs)) + b"".join(struct.pack("<I", o) for o in offsets)
+    return table(b"head", head) + table(b"cmap", cmap) + table(b"loca", loca) + table(b"glyf", b"".join(glyphs))
+
+
+def write_assets(project_dir, cfg, fonts, cps, quiet):
+    """Binäärifontit assets-osion hakemistoon (ui_assets.h); kirjoitetaan vain muuttuneet."""
+    out_dir = os.path.join(project_dir, cfg["assets"])
+    os.makedirs(out_dir, exist_ok=True)
+    for size, font in fonts:
+        data = binfont(font, size, cps)
+        path = os.path.join(out_dir, "%s_%d.bin" % (cfg["name"], size))
+        if os.path.exists(path):
+            with open(path, "rb") as f:
+                if f.read() == data:
+                    continue
+        with open(path, "wb") as f:
+            f.write(data)
+        if not quiet:
+            print("font_build: päivitetty %s (%d tavua)" % (os.path.relpath(path, project_dir), len(data)))
+
+
+def report(sizes, cps, cmap_num, budget_kb):
+    print("  koko  merkkejä  bittikartat  kuvaajat  yhteensä  (samat kuvat)")
+    total = cmap_num * CMAP_BYTES
+    for size, bitmap_bytes, saved in sizes:
+        dsc_bytes = (len(cps) + 1) * GLYPH_DSC_BYTES + FONT_FIXED_BYTES
+        total += bitmap_bytes + dsc_bytes
+        print("  %4d  %8d  %9d B  %6d B  %6.1f kt  (-%d B)" % (size, len(cps), bitmap_bytes, dsc_bytes,
+                                                             (bitmap_bytes + dsc_bytes) / 1024, saved))
+    print("  yhteinen merkistö %d B, kaikki koot %.1f kt%s" % (
+        cmap_num * CMAP_BYTES, total / 1024,
+        "" if not budget_kb else (" / budjetti %d kt%s" % (budget_kb, " YLITTYY" if total > budget_kb * 1024 else ""))))
+    return not budget_kb or total <= budget_kb * 1024
+
+
+def run(project_dir, check=False, quiet=False, sizes=None, regen=False, report_only=False, budget_kb=0,
+        catalog=None):
+    with open(os.path.join(project_dir, STRINGS), encoding="utf-8") as f:
+        strings = json.load(f)
+    with open(os.path.join(project_dir, LAYOUT), encoding="utf-8") as f:
+        layout = json.load(f)
+    cfg = strings["font"]
+    if catalog:
+        new = add_catalog_chars(project_dir, cfg, catalog)
+        print("font_build: %s: %s" % (cfg["catalog"], "lisätty " + "".join(sorted(new)) if new else "ei uusia merkkejä"))
+    base, per_lang = needed_chars(strings, layout, read_catalog_chars(project_dir, cfg))
+    wanted = set(base).union(*per_lang.values())
+    cps = sorted(ord(c) for c in wanted)
+
+    fonts = []
+    sizes = sorted(sizes or cfg["sizes"])
+    have_ttf = os.path.exists(os.path.join(project_dir, cfg["ttf"]))
+    for size in sizes:
+        src = os.path.join(project_dir, cfg["sources"], "%s_%d.c" % (cfg["name"], size))
+        if regen or not os.path.exists(src):
+            if have_ttf:
+                font_conv(project_dir, cfg, size, src)
+            else:
+                scale_source(project_dir, cfg, size, src)
+        with open(src, encoding="utf-8") as f:
+            font = parse_font(f.read())
+        missing = [cp for cp in cps if cp not in font["glyphs"]]
+        if missing:
+            raise ValueError("lähdefontista %s puuttuu: %s" % (os.path.relpath(src, project_dir),
+                                                               " ".join("U+%04X" % cp for cp in missing)))
+        fonts.append((size, font))
+    text, size_stats, cmap_num = generate(cfg, fonts, cps)
+
+    if report_only:
+        for lang, chars in per_lang.items():
+            extra = "".join(sorted(chars - base))
+            print("%s: %d merkkiä perusmerkistön lisäksi %s" % (lang, len(extra), extra))
+        return report(size_stats, cps, cmap_num, budget_kb)
+
+    if "assets" in cfg and not check:
+        write_assets(project_dir, cfg, fonts, cps, quiet)
+
+    changed = []
+    for rel, data in ((cfg["output"], text), (cfg["header"], header(cfg, fonts))):
+        path = os.path.join(project_dir, rel)
+        old = None
+        if os.path.exists(path):
+            with open(path, encoding="utf-8") as f:
+                old = f.read()
+        if old == data:
+            continue
+        changed.append(rel)
+        if not check:
+            with open(path, "w", encoding="utf-8", newline="\n") as f:
+                f.write(data)
+    if not changed:
+        return True
+    if not quiet:
+        print("font_build: %s %s" % ("vanhentunut" if check else "päivitetty", ", ".join(changed)))
+        report(size_stats, cps, cmap_num, budget_kb)
+    return not check
+
+
+if "Import" in globals():
+    # PlatformIO: extra_scripts = pre:tools/font_build.py
+    Import("env")  # noqa: F821
+    run(env.subst("$PROJECT_DIR"))  # noqa: F821
+elif __name__ == "__main__":
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("--check", action="store_true", help="älä kirjoita, palauta 1 jos tulos muuttuisi")
+    ap.add_argument("--report", action="store_true", help="vain raportti, ei kirjoiteta")
+    ap.add_argument("--sizes", help="pilkuilla erotetut koot strings.json:n sijaan (esim. 24,32,48,70)")
+    ap.add_argument("--budget-kb", type=int, default=0, help="flash-budjetti fonteille, ylitys = paluukoodi 1")
+    ap.add_argument("--regen", action="store_true", help="tuota lv_font_conv-lähteet uudelleen TTF:stä")
+    ap.add_argument("--catalog", help="luettelo (CSV tai .idx), jonka nimien merkit lisätään fonttiin")
+    ap.add_argument("--project-dir", default=os.path.join(os.path.dirname(os.path.abspath(__file__)), ".."))
+    args = ap.parse_args()
+    sizes = [int(s) for s in args.sizes.split(",")] if args.sizes else None
+    ok = run(args.project_dir, args.check, sizes=sizes, regen=args.regen, report_only=args.report,
+             budget_kb=args.budget_kb, catalog=args.catalog)
+    sys.exit(0 if ok else 1)
@@ -0,0 +1,136 @@
+#!/usr/bin/env python3
+"""Osiotaulun vaihdon vahti: tapahtumajono ei katoa vaihdettaessa ympäristöä.
+
+    pio run -e esp32-8048S043C-assets -t upload     # ajetaan automaattisesti ennen latausta
+    python3 tools/fs_guard.py laitteen_taulu.bin partitions_assets.csv
+
+Tapahtumajono ja luettelo ovat LittleFS-osiolla "spiffs" (kiosk_fs). Oletusympäristön
+ja assets-ympäristön (partitions_assets.csv) osiotauluissa se on eri kohdassa ja eri
+kokoinen, joten toisen ympäristön ohjelman lataus alustaa osion: lähettämättömät
+tapahtumat katoavat. Ennen latausta skripti lukee laitteen nykyisen osiotaulun
+(esptool read_flash 0x8000) ja vertaa "spiffs"-osiota ladattavaan tauluun:
+
+  sama kohta ja koko       lataus jatkuu
+  eri kohta tai koko       lataus keskeytetään, ellei KIOSK_FS_DROP=1: jono on
+                           ensin tyhjennettävä (ylläpitonäkymä, "jonossa 0")
+                           ja luettelo haetaan uudelleen ensimmäisellä synkronoinnilla
+  taulua ei voi lukea      lataus jatkuu (uusi laite tai portti varattu), varoitus
+
+uploadfs kirjoittaa assets-osion kohtaan ladattavan taulun mukaan, joten se
+keskeytetään, jos laitteen taulu on eri: ohjelma ladataan ensin (-t upload).
+"""
+
+import os
+import struct
+import subprocess
+import sys
+import tempfile
+
+TABLE_OFFSET = 0x8000
+TABLE_SIZE = 0xC00
+ENTRY_MAGIC = 0x50AA
+FS_LABEL = "spiffs"
+TYPES = {"app": 0x00, "data": 0x01}
+DATA_SUBTYPES = {"ota": 0x00, "phy": 0x01, "nvs": 0x02, "coredump": 0x03, "nvs_keys": 0x04,
+                 "efuse": 0x05, "fat": 0x81, "spiffs": 0x82}
+
+
+def parse_table(data):
+    """Binäärinen osiotaulu -> {nimi: (tyyppi, alityyppi, kohta, koko)}"""
+    parts = {}
+    for pos in range(0, len(data) - 31, 32):
+        magic, ptype, subtype, offset, size, label, _ = struct.unpack_from("<HBBII16sI", data, pos)
+        if magic != ENTRY_MAGIC:
+            break  # 0xFFFF = loppu, 0xEBEB = MD5
+        parts[label.split(b"\0", 1)[0].decode("ascii", "replace")] = (ptype, subtype, offset, size)
+    return parts
+
+
+def csv_number(v):
+    v = v.strip().upper()
+    scale = 1
+    if v.endswith("K"):
+        scale, v = 1024, v[:-1]
+    elif v.endswith("M"):
+        scale, v = 1024 * 1024, v[:-1]
+    return int(v, 0) * scale
+
+
+def parse_csv(path):
+    """Osiotaulun CSV (kohdat kirjoitettu auki) -> {nimi: (tyyppi, alityyppi, kohta, koko)}"""
+    parts = {}
+    with open(path, encoding="utf-8") as f:
+        for line in f:
+            line = line.split("#", 1)[0].strip()
+            if not line:
+                continue
+            name, ptype, subtype, offset, size = [c.strip() for c in line.split(",")[:5]]
+            if not offset:
+                raise ValueError("%s: osion %s kohta puuttuu (kirjoita auki)" % (path, name))
+            ptype_n = TYPES.get(ptype, None)
+            sub_n = DATA_SUBTYPES.get(subtype) if ptype == "data" else None
+            parts[name] = (ptype_n, sub_n, csv_number(offset), csv_number(size))
+    return parts
+
+
+def check(device, target, uploadfs=False, drop=False):
+    """Palauttaa (ok, viesti)"""
+    if uploadfs:
+        if {k: v[2:] for k, v in device.items()} != {k: v[2:] for k, v in target.items()}:
+            return False, ("laitteen osiotaulu on eri kuin ladattava; lataa ensin ohjelma (-t upload), "
+                           "muuten uploadfs kirjoittaa vanhan taulun osioiden päälle")
+        return True, "osiotaulu sama"
+    old, new = device.get(FS_LABEL), target.get(FS_LABEL)
+    if not old or not new:
+        return True, "laitteella ei ole %s-osiota, ei siirrettävää" % FS_LABEL
+    if old[2:] == new[2:]:
+        return True, "%s-osio samassa kohdassa" % FS_LABEL
+    msg = ("%s-osio siirtyy (0x%x, %d kt -> 0x%x, %d kt): tapahtumajono ja luettelo alustetaan" %
+           (FS_LABEL, old[2], old[3] // 1024, new[2], new[3] // 1024))
+    if drop:
+        return True, msg + " (KIOSK_FS_DROP=1)"
+    return False, (msg + ".\nTyhjennä jono ensin (ylläpitonäkymä näyttää \"jonossa 0\", verkko ylhäällä) "
+                   "ja lataa sitten uudelleen: KIOSK_FS_DROP=1 pio run -e <ympäristö> -t upload")
+
+
+def read_device_table(env):
+    fd, path = tempfile.mkstemp(suffix=".bin")
+    os.close(fd)
+    try:
+        cmd = env.subst('"$PYTHONEXE" "$UPLOADER" --chip $BOARD_MCU --port "$UPLOAD_PORT" '
+                        '--baud $UPLOAD_SPEED read_flash 0x%x 0x%x' % (TABLE_OFFSET, TABLE_SIZE))
+        if subprocess.call(cmd + ' "%s"' % path, shell=True, stdout=subprocess.DEVNULL) != 0:
+            return None
+        with open(path, "rb") as f:
+            return parse_table(f.read())
+    finally:
+        os.remove(path)
+
+
+def pio_guard(env, uploadfs):
+    env.AutodetectUploadPort()
+    device = read_device_table(env)
+    if device is None:
+        print("fs_guard: laitteen osiotaulua ei voitu lukea, tarkistus ohitetaan")
+        return
+    ok, msg = check(device, parse_csv(env.subst("$PARTITIONS_TABLE_CSV")), uploadfs,
+                    os.environ.get("KIOSK_FS_DROP") == "1")
+    print("fs_guard: " + msg)
+    if not ok:
+        env.Exit(1)
+
+
+if "Import" in globals():
+    # PlatformIO: extra_scripts = pre:tools/fs_guard.py (laiteympäristöt)
+    Import("env")  # noqa: F821
+    if env.get("PIOPLATFORM") == "espressif32":  # noqa: F821
+        env.AddPreAction("upload", lambda target, source, env: pio_guard(env, False))  # noqa: F821
+        env.AddPreAction("uploadfs", lambda target, source, env: pio_guard(env, True))  # noqa: F821
+elif __name__ == "__main__":
+    if len(sys.argv) != 3:
+        sys.exit(__doc__)
+    with open(sys.argv[1], "rb") as f:
+        dev = parse_table(f.read())
+    ok, msg = check(dev, parse_csv(sys.argv[2]), drop=os.environ.get("KIOSK_FS_DROP") == "1")
+    print(msg)
+    sys.exit(0 if ok else 1)
@@ -0,0 +1,381 @@
+#!/usr/bin/env python3
+"""Generoi näkymien rakennuskoodin kuvauksesta ui/layout.json.
+
+    python3 tools/gen_ui.py                # ui/layout.json + ui/strings.json -> include/ui_gen.h, src/ui_gen.c
+    python3 tools/gen_ui.py --check        # virhe, jos generoitu koodi ei ole ajan tasalla
+
+Ajetaan myös PlatformIO:n pre-skriptinä (extra_scripts), jolloin koodi
+generoidaan uudelleen vain, jos layout.json on muuttunut. Tulos on
+versionhallinnassa, joten käännös ei tarvitse tätä skriptiä.
+
+Tyylit ja oliokohtainen sijainti/koko tulevat LV_STYLE_CONST_INIT-tyyleinä
+flashiin: rakentaminen ei kutsu lv_style_set_*- eikä lv_obj_set_size/align-
+funktioita, jotka varaisivat jokaiselle oliolle paikallisen tyylin heapista.
+
+Käännettävät tekstit ovat tiedostossa ui/strings.json (kielet ja merkkijonot).
+Teksti "@avain" layout.jsonissa sidotaan kieleen (ui_text_bind, ui_lang.h), ja
+taulukko ui_strings[kieli][UI_STR_AVAIN] generoidaan samaan tiedostoon.
+"""
+
+import argparse
+import json
+import os
+import sys
+
+LAYOUT = os.path.join("ui", "layout.json")
+STRINGS = os.path.join("ui", "strings.json")
+OUT_H = os.path.join("include", "ui_gen.h")
+OUT_C = os.path.join("src", "ui_gen.c")
+
+ALIGNS = {
+    "default": "LV_ALIGN_DEFAULT",
+    "top_left": "LV_ALIGN_TOP_LEFT",
+    "top_mid": "LV_ALIGN_TOP_MID",
+    "top_right": "LV_ALIGN_TOP_RIGHT",
+    "bottom_left": "LV_ALIGN_BOTTOM_LEFT",
+    "bottom_mid": "LV_ALIGN_BOTTOM_MID",
+    "bottom_right": "LV_ALIGN_BOTTOM_RIGHT",
+    "left_mid": "LV_ALIGN_LEFT_MID",
+    "right_mid": "LV_ALIGN_RIGHT_MID",
+    "center": "LV_ALIGN_CENTER",
+}
+
+STATES = {
+    "default": "0",
+    "checked": "LV_STATE_CHECKED",
+    "pressed": "LV_STATE_PRESSED",
+    "focused": "LV_STATE_FOCUSED",
+    "disabled": "LV_STATE_DISABLED",
+}
+
+TEXT_ALIGNS = {
+    "auto": "LV_TEXT_ALIGN_AUTO",
+    "left": "LV_TEXT_ALIGN_LEFT",
+    "center": "LV_TEXT_ALIGN_CENTER",
+    "right": "LV_TEXT_ALIGN_RIGHT",
+}
+
+
+def color(v):
+    v = v.lstrip("#")
+    if len(v) != 6:
+        raise ValueError("väri muodossa #rrggbb: %r" % v)
+    return "LV_COLOR_MAKE(0x%s, 0x%s, 0x%s)" % (v[0:2], v[2:4], v[4:6])
+
+
+def num(v):
+    if v == "circle":
+        return "LV_RADIUS_CIRCLE"
+    if v == "content":
+        return "LV_SIZE_CONTENT"
+    return str(int(v))
+
+
+def font(v):
+    return "&" + v
+
+
+def opa(v):
+    return str(int(v))
+
+
+def text_align(v):
+    return TEXT_ALIGNS[v]
+
+
+def transition(v):
+    if v != "none":
+        raise ValueError("transition: vain \"none\" (ei siirtymää) tuettu")
+    return "NULL"
+
+
+# Tyyliominaisuus -> (LV_STYLE_CONST_*-makrot, arvon muunnos)
+PROPS = {
+    "bg_color": (["BG_COLOR"], color),
+    "bg_opa": (["BG_OPA"], opa),
+    "border_color": (["BORDER_COLOR"], color),
+    "border_width": (["BORDER_WIDTH"], num),
+    "radius": (["RADIUS"], num),
+    "pad_all": (["PAD_TOP", "PAD_BOTTOM", "PAD_LEFT", "PAD_RIGHT"], num),
+    "pad_hor": (["PAD_LEFT", "PAD_RIGHT"], num),
+    "pad_ver": (["PAD_TOP", "PAD_BOTTOM"], num),
+    "text_font": (["TEXT_FONT"], font),
+    "text_color": (["TEXT_COLOR"], color),
+    "text_align": (["TEXT_ALIGN"], text_align),
+    "shadow_width": (["SHADOW_WIDTH"], num),
+    "transform_width": (["TRANSFORM_WIDTH"], num),
+    "transform_height": (["TRANSFORM_HEIGHT"], num),
+    "transition": (["TRANSITION"], transition),
+}
+
+
+def c_str(s):
+    out = []
+    for ch in s:
+        if ch in '"\\':
+            out.append("\\" + ch)
+        elif ch == "\n":
+            out.append("\\n")
+        else:
+            out.append(ch)  # UTF-8 sellaisenaan, kuten muissakin lähdetiedostoissa
+    return '"' + "".join(out) + '"'
+
+
+def ident(s):
+    if not s.replace("_", "").isalnum() or s[0].isdigit():
+        raise ValueError("virheellinen tunniste: %r" % s)
+    return s
+
+
+class Generator:
+    def __init__(self, layout, strings=None):
+        self.layout = layout
+        self.strings = strings or {"languages": [], "strings": {}}
+        self.languages = [ident(l) for l in self.strings["languages"]]
+        for key, tr in self.strings["strings"].items():
+            ident(key)
+            missing = [l for l in self.languages if l not in tr]
+            if missing:
+                raise ValueError("merkkijono %s: käännös puuttuu (%s)" % (key, ", ".join(missing)))
+        self.defaults = layout.get("defaults", {})
+        self.styles = layout.get("styles", {})
+        self.geoms = {}      # (align, x, y, w, h) -> nimi
+        self.geom_order = []
+
+    def style_ref(self, name):
+        if name not in self.styles:
+            raise ValueError("tuntematon tyyli: %r" % name)
+        return "UI_STYLE(ui_style_%s)" % ident(name)
+
+    def style_list(self, spec, obj, out):
+        for s in spec:
+            name, state = (s, "default") if isinstance(s, str) else s
+            out.append("    lv_obj_add_style(%s, %s, %s);" % (obj, self.style_ref(name), STATES[state]))
+
+    def geom(self, w):
+        align = w.get("align")
+        x, y = w.get("pos", [None, None])
+        width, height = w.get("size", [w.get("width"), w.get("height")])
+        key = (align, x, y, width, height)
+        if key == (None, None, None, None, None):
+            return None
+        if key not in self.geoms:
+            self.geoms[key] = "ui_geom_%d" % len(self.geoms)
+            self.geom_order.append(key)
+        return self.geoms[key]
+
+    def text(self, target, text, out):
+        """Kiinteä teksti tai "@avain" kieleen sidottuna."""
+        if text.startswith("@"):
+            key = text[1:]
+            if key not in self.strings["strings"]:
+                raise ValueError("tuntematon merkkijono: %r (ui/strings.json)" % text)
+            out.append("    ui_text_bind(%s, UI_STR_%s);" % (target, key.upper()))
+        else:
+            out.append("    lv_label_set_text_static(%s, %s);" % (target, c_str(text)))
+
+    def emit_strings(self, out):
+        keys = list(self.strings["strings"])
+        out.append("const char *const ui_strings[UI_LANG_COUNT][UI_STR_COUNT] = {")
+        for lang in self.languages:
+            out.append("    [UI_LANG_%s] = {" % lang.upper())
+            for key in keys:
+                out.append("        [UI_STR_%s] = %s," % (key.upper(), c_str(self.strings["strings"][key][lang])))
+            out.append("    },")
+        out.append("};")
+        out.append("")
+
+    def emit_styles(self, out):
+        for name, props in self.styles.items():
+            out.append("static const lv_style_const_prop_t ui_style_%s_props[] = {" % ident(name))
+            for prop, value in props.items():
+                if prop not in PROPS:
+                    raise ValueError("tyyli %s: tuntematon ominaisuus %r" % (name, prop))
+                macros, conv = PROPS[prop]
+                for m in macros:
+                    out.append("    LV_STYLE_CONST_%s(%s)," % (m, conv(value)))
+            out.append("    LV_STYLE_CONST_PROPS_END")
+            out.append("};")
+            out.append("LV_STYLE_CONST_INIT(ui_style_%s, ui_style_%s_props);" % (name, name))
+            out.append("")
+
+    def emit_geoms(self, out):
+        for key in self.geom_order:
+            align, x, y, width, height = key
+            name = self.geoms[key]
+            out.append("static const lv_style_const_prop_t %s_props[] = {" % name)
+            if align is not None:
+                out.append("    LV_STYLE_CONST_ALIGN(%s)," % ALIGNS[align])
+            if x is not None:
+                out.append("    LV_STYLE_CONST_X(%s)," % num(x))
+            if y is not None:
+                out.append("    LV_STYLE_CONST_Y(%s)," % num(y))
+            if width is not None:
+                out.append("    LV_STYLE_CONST_WIDTH(%s)," % num(width))
+            if height is not None:
+                out.append("    LV_STYLE_CONST_HEIGHT(%s)," % num(height))
+            out.append("    LV_STYLE_CONST_PROPS_END")
+            out.append("};")
+            out.append("static LV_STYLE_CONST_INIT(%s, %s_props);" % (name, name))
+            out.append("")
+
+    def emit_widget(self, screen, w, out, ids):
+        kind = w["type"]
+        d = self.defaults.get(kind, {})
+        wid = w.get("id")
+        if wid:
+            ident(wid)
+            if wid in ids:
+                raise ValueError("näkymä %s: id %r kahdesti" % (screen, wid))
+            ids.append(wid)
+        target = "ui->%s" % wid if wid else "o"
+        if kind == "label":
+            out.append("    %s = lv_label_create(scr);" % target)
+            self.text(target, w.get("text", ""), out)
+        elif kind == "button":
+            out.append("    %s = lv_button_create(scr);" % target)
+        else:
+            raise ValueError("näkymä %s: tuntematon tyyppi %r" % (screen, kind))
+
+        self.style_list(w.get("styles", d.get("styles", [])), target, out)
+        g = self.geom(w)
+        if g:
+            out.append("    lv_obj_add_style(%s, UI_STYLE(%s), 0);" % (target, g))
+        for flag in w.get("flags", []):
+            out.append("    lv_obj_add_flag(%s, LV_OBJ_FLAG_%s);" % (target, flag.upper()))
+
+        if kind == "button" and "text" in w:
+            # Painikkeen teksti omana labelinaan keskellä painiketta
+            out.append("    l = lv_label_create(%s);" % target)
+            self.text("l", w["text"], out)
+            self.style_list(w.get("label_styles", d.get("label_styles", [])), "l", out)
+            out.append("    lv_obj_add_style(l, UI_STYLE(%s), 0);" % self.geom({"align": "center", "pos": [0, 0]}))
+
+    def generate(self):
+        sources = "tiedostoista ui/layout.json ja ui/strings.json" if self.languages else "tiedostosta ui/layout.json"
+        banner = "// Generoitu %s: python3 tools/gen_ui.py. Älä muokkaa käsin." % sources
+        screens = self.layout["screens"]
+        body = []
+        for screen, widgets in screens.items():
+            ident(screen)
+            ids = []
+            fn = []
+            fn.append("lv_obj_t *ui_%s_create(ui_%s_t *ui) {" % (screen, screen))
+            fn.append("    lv_obj_t *scr = lv_obj_create(NULL);")
+            self.style_list(self.defaults.get("screen", {}).get("styles", []), "scr", fn)
+            widget_code = []
+            for w in widgets:
+                widget_code.append("")
+                self.emit_widget(screen, w, widget_code, ids)
+            temps = [t for t in ("o", "l") if any(line.startswith("    %s = " % t) for line in widget_code)]
+            if temps:
+                fn.insert(2, "    lv_obj_t %s;" % ", ".join("*" + t for t in temps))
+            fn += widget_code
+            fn.append("")
+            fn.append("    ui->screen = scr;")
+            fn.append("    return scr;")
+            fn.append("}")
+            fn.append("")
+            body.append((screen, ids, fn))
+
+        h = [
+            banner,
+            "#pragma once",
+            "",
+            "#include <lvgl.h>",
+            "",
+            "#ifdef __cplusplus",
+            'extern "C" {',
+            "#endif",
+            "",
+            "// Vakiotyylit (flashissa). lv_obj_add_style() ei muokkaa tyyliä, cast on turvallinen.",
+            "#define UI_STYLE(s) ((lv_style_t *)&(s))",
+            "",
+        ]
+        for name in self.styles:
+            h.append("extern const lv_style_t ui_style_%s;" % name)
+        h.append("")
+        if self.languages:
+            h.append("// Kielet ja käännettävät tekstit (ui/strings.json), ks. ui_lang.h")
+            h.append("typedef enum {")
+            for lang in self.languages:
+                h.append("    UI_LANG_%s," % lang.upper())
+            h.append("    UI_LANG_COUNT")
+            h.append("} ui_lang_t;")
+            h.append("")
+            h.append("typedef enum {")
+            for key in self.strings["strings"]:
+                h.append("    UI_STR_%s," % key.upper())
+            h.append("    UI_STR_COUNT")
+            h.append("} ui_str_t;")
+            h.append("")
+            h.append("extern const char *const ui_strings[UI_LANG_COUNT][UI_STR_COUNT];")
+            h.append("// Labelin teksti seuraa valittua kieltä (toteutus ui_lang.cpp)")
+            h.append("void ui_text_bind(lv_obj_t *label, ui_str_t id);")
+            h.append("")
+        for screen, ids, _ in body:
+            h.append("typedef struct {")
+            h.append("    lv_obj_t *screen;")
+            for i in ids:
+                h.append("    lv_obj_t *%s;" % i)
+            h.append("} ui_%s_t;" % screen)
+            h.append("")
+        for screen, _, _ in body:
+            h.append("lv_obj_t *ui_%s_create(ui_%s_t *ui);" % (screen, screen))
+        h += ["", "#ifdef __cplusplus", "}", "#endif", ""]
+
+        c = [
+            banner,
+            '#include "ui_gen.h"',
+            "",
+        ]
+        for f in self.layout.get("fonts", []):
+            c.append("LV_FONT_DECLARE(%s);" % ident(f))
+        c.append("")
+        if self.languages:
+            self.emit_strings(c)
+        self.emit_styles(c)
+        self.emit_geoms(c)
+        for _, _, fn in body:
+            c += fn
+        return "\n".join(h), "\n".join(c)
+
+
+def run(project_dir, check=False, quiet=False):
+    layout_path = os.path.join(project_dir, LAYOUT)
+    with open(layout_path, encoding="utf-8") as f:
+        layout = json.load(f)
+    strings = None
+    strings_path = os.path.join(project_dir, STRINGS)
+    if os.path.exists(strings_path):
+        with open(strings_path, encoding="utf-8") as f:
+            strings = json.load(f)
+    header, source = Generator(layout, strings).generate()
+    changed = []
+    for rel, text in ((OUT_H, header), (OUT_C, source)):
+        path = os.path.join(project_dir, rel)
+        old = None
+        if os.path.exists(path):
+            with open(path, encoding="utf-8") as f:
+                old = f.read()
+        if old == text:
+            continue
+        changed.append(rel)
+        if not check:
+            with open(path, "w", encoding="utf-8", newline="\n") as f:
+                f.write(text)
+    if changed and not quiet:
+        print("gen_ui: %s %s" % ("vanhentunut" if check else "päivitetty", ", ".join(changed)))
+    return not (check and changed)
+
+
+if "Import" in globals():
+    # PlatformIO: extra_scripts = pre:tools/gen_ui.py
+    Import("env")  # noqa: F821
+    run(env.subst("$PROJECT_DIR"))  # noqa: F821
+elif __name__ == "__main__":
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("--check", action="store_true", help="älä kirjoita, palauta 1 jos tulos muuttuisi")
+    ap.add_argument("--project-dir", default=os.path.join(os.path.dirname(os.path.abspath(__file__)), ".."))
+    args = ap.parse_args()
+    sys.exit(0 if run(args.project_dir, args.check) else 1)
@@ -0,0 +1,178 @@
+#!/usr/bin/env python3
+"""Kultaisten kuvien regressiotesti native-buildille.
+
+    pio run -e native
+    python3 tools/golden.py check            # kuvaa ja vertaa test/golden/*.png
+    python3 tools/golden.py update           # hyväksy nykyiset kuvat kultaisiksi
+
+Ohjelma (.pio/build/native/program --screenshots DIR) kirjoittaa PNG:t
+hakemistoon kiosk_fs/screenshots. Kuva hyväksytään, jos korkeintaan
+--max-pixels pikseliä eroaa yli --tolerance väriyksikköä jossakin kanavassa.
+Eroista kirjoitetaan <nimi>.diff.png (eroavat pikselit punaisella). check
+epäonnistuu myös, jos kultaiselle kuvalle ei synny kuvaa.
+
+EXPECTED luettelee kuvat, jotka --screenshots tuottaa (screenshots.cpp). Jos niistä
+puuttuu kultainen kuva, check kopioi tämän ajon kuvan test/golden-hakemistoon ja
+epäonnistuu: kuva katsotaan ja lisätään versionhallintaan (git add test/golden).
+"""
+
+import argparse
+import glob
+import os
+import shutil
+import struct
+import subprocess
+import sys
+import zlib
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+PROGRAM = os.path.join(ROOT, ".pio", "build", "native", "program")
+GOLDEN_DIR = os.path.join(ROOT, "test", "golden")
+OUT_DIR = os.path.join(ROOT, "kiosk_fs", "screenshots")
+# Päänäkymä käynnistyksen jälkeen ja kummassakin tilassa (src/native/screenshots.cpp)
+EXPECTED = ["main_start.png", "main_palautus.png", "main_otto.png"]
+
+
+def read_png(path):
+    """Palauttaa (w, h, rivit RGB-tavuina). Tukee 8-bit RGB/RGBA, kaikki suodattimet."""
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        raise ValueError("%s: ei PNG" % path)
+    pos, idat = 8, b""
+    while pos < len(data):
+        n, kind = struct.unpack(">I4s", data[pos:pos + 8])
+        body = data[pos + 8:pos + 8 + n]
+        if kind == b"IHDR":
+            w, h, depth, ctype, _, _, interlace = struct.unpack(">IIBBBBB", body)
+            if depth != 8 or ctype not in (2, 6) or interlace:
+                raise ValueError("%s: vain 8-bit RGB/RGBA ilman lomitusta" % path)
+        elif kind == b"IDAT":
+            idat += body
+        pos += 12 + n
+    bpp = 3 if ctype == 2 else 4
+    raw = zlib.decompress(idat)
+    stride = w * bpp
+    rows, prev = [], bytearray(stride)
+    for y in range(h):
+        ft = raw[y * (stride + 1)]
+        line = bytearray(raw[y * (stride + 1) + 1:(y + 1) * (stride + 1)])
+        for i in range(stride):
+            a = line[i - bpp] if i >= bpp else 0
+            b = prev[i]
+            c = prev[i - bpp] if i >= bpp else 0
+            if ft == 1:
+                line[i] = (line[i] + a) & 0xff
+            elif ft == 2:
+                line[i] = (line[i] + b) & 0xff
+            elif ft == 3:
+                line[i] = (line[i] + (a + b) // 2) & 0xff
+            elif ft == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                line[i] = (line[i] + (a if pa <= pb and pa <= pc else b if pb <= pc else c)) & 0xff
+        prev = line
+        if bpp == 4:
+            line = bytearray(v for i, v in enumerate(line) if i % 4 != 3)
+        rows.append(bytes(line))
+    return w, h, rows
+
+
+def write_png(path, w, h, rows):
+    def chunk(kind, body):
+        return struct.pack(">I", len(body)) + kind + body + struct.pack(">I", zlib.crc32(kind + body))
+    raw = b"".join(b"\0" + r for r in rows)
+    with open(path, "wb") as f:
+        f.write(b"\x89PNG\r\n\x1a\n" + chunk(b"IHDR", struct.pack(">IIBBBBB", w, h, 8, 2, 0, 0, 0))
+                + chunk(b"IDAT", zlib.compress(raw, 6)) + chunk(b"IEND", b""))
+
+
+def compare(golden, actual, diff_path, tolerance):
+    gw, gh, grows = read_png(golden)
+    aw, ah, arows = read_png(actual)
+    if (gw, gh) != (aw, ah):
+        return None
+    bad, diff_rows = 0, []
+    for g, a in zip(grows, arows):
+        out = bytearray(len(a))
+        for i in range(0, len(a), 3):
+            if max(abs(g[i] - a[i]), abs(g[i + 1] - a[i + 1]), abs(g[i + 2] - a[i + 2])) > tolerance:
+                bad += 1
+                out[i] = 255
+            else:
+                # Ehjät pikselit himmennettynä harmaana
+                out[i] = out[i + 1] = out[i + 2] = (a[i] + a[i + 1] + a[i + 2]) // 12
+        diff_rows.append(bytes(out))
+    if bad:
+        write_png(diff_path, aw, ah, diff_rows)
+    return bad
+
+
+def capture():
+    if not os.path.exists(PROGRAM):
+        sys.exit("%s puuttuu, aja ensin: pio run -e native" % PROGRAM)
+    shutil.rmtree(OUT_DIR, ignore_errors=True)
+    os.makedirs(OUT_DIR)
+    subprocess.run([PROGRAM, "--screenshots", OUT_DIR], check=True)
+    return sorted(p for p in glob.glob(os.path.join(OUT_DIR, "*.png")) if not p.endswith(".diff.png"))
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("command", choices=["check", "update"])
+    ap.add_argument("--tolerance", type=int, default=8, help="sallittu ero kanavaa kohden (0-255)")
+    ap.add_argument("--max-pixels", type=int, default=0, help="sallittu määrä eroavia pikseleitä")
+    ap.add_argument("--no-run", action="store_true", help="käytä olemassa olevia kuvia hakemistossa kiosk_fs/screenshots")
+    args = ap.parse_args()
+
+    shots = sorted(glob.glob(os.path.join(OUT_DIR, "*.png"))) if args.no_run else capture()
+    shots = [p for p in shots if not p.endswith(".diff.png")]
+    if args.command == "update":
+        os.makedirs(GOLDEN_DIR, exist_ok=True)
+        for p in shots:
+            shutil.copy(p, GOLDEN_DIR)
+            print("päivitetty", os.path.relpath(os.path.join(GOLDEN_DIR, os.path.basename(p)), ROOT))
+        return 0
+
+    failed = 0
+    names = set(os.path.basename(p) for p in shots)
+    for name in EXPECTED:
+        golden = os.path.join(GOLDEN_DIR, name)
+        if os.path.exists(golden):
+            continue
+        if name not in names:
+            print("%-24s KUVA PUUTTUU (ohjelma ei kirjoittanut sitä)" % name)
+        else:
+            os.makedirs(GOLDEN_DIR, exist_ok=True)
+            shutil.copy(os.path.join(OUT_DIR, name), golden)
+            print("%-24s EI KULTAISTA KUVAA: kirjoitettu %s, tarkista ja lisää versionhallintaan"
+                  % (name, os.path.relpath(golden, ROOT)))
+        failed += 1
+    if failed:
+        return 1
+    goldens = sorted(glob.glob(os.path.join(GOLDEN_DIR, "*.png")))
+    for g in goldens:
+        if os.path.basename(g) not in names:
+            print("%-24s KUVA PUUTTUU (ohjelma ei kirjoittanut sitä)" % os.path.basename(g))
+            failed += 1
+    for p in shots:
+        name = os.path.basename(p)
+        golden = os.path.join(GOLDEN_DIR, name)
+        if not os.path.exists(golden):
+            print("%-24s EI KULTAISTA KUVAA (aja: golden.py update)" % name)
+            failed += 1
+            continue
+        bad = compare(golden, p, p[:-4] + ".diff.png", args.tolerance)
+        if bad is None:
+            print("%-24s KOKO ERI" % name)
+            failed += 1
+        elif bad > args.max_pixels:
+            print("%-24s %d pikseliä eroaa -> %s" % (name, bad, os.path.relpath(p[:-4] + ".diff.png", ROOT)))
+            failed += 1
+        else:
+            print("%-24s ok (%d)" % (name, bad))
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,82 @@
+#!/usr/bin/env python3
+"""Assets-osion kuvat: ui/images/*.png -> assets/images/*.bin (LVGL 9:n binäärikuva, RGB565).
+
+    python3 tools/image_build.py             # muunna muuttuneet
+    python3 tools/image_build.py --check     # virhe, jos jokin .bin puuttuu tai on vanhentunut
+
+Kuvat luetaan osiolta piirrettäessä (ui_assets_image(), include/ui_assets.h).
+Tiedosto on lv_image_header_t (12 tavua) ja rivit RGB565:nä ilman täytettä.
+Läpinäkyvyys ei säily: alfa-kanava pudotetaan kuten esipiirretyissä painikkeissa
+(ui_prerender.h), joten läpinäkyvät kohdat piirretään PNG:n värillä.
+
+Ajetaan PlatformIO:n pre-skriptinä assets-ympäristössä (env:esp32-8048S043C-assets);
+tulos ei ole versionhallinnassa.
+"""
+
+import argparse
+import glob
+import os
+import struct
+import sys
+
+SOURCES = os.path.join("ui", "images")
+OUT_DIR = os.path.join("assets", "images")
+
+# LVGL 9.2: LV_IMAGE_HEADER_MAGIC, LV_COLOR_FORMAT_RGB565
+IMAGE_MAGIC = 0x19
+CF_RGB565 = 0x12
+
+
+def rgb565(path):
+    from golden import read_png  # Sama PNG-lukija kuin kultaisilla kuvilla; tools/ on sys.pathissa
+    w, h, rows = read_png(path)
+    if w > 0xFFFF or h > 0xFFFF:
+        raise ValueError("%s: liian suuri (%dx%d)" % (path, w, h))
+    stride = w * 2
+    # magic:8 cf:8 flags:16 | w:16 h:16 | stride:16 reserved:16
+    out = [struct.pack("<BBHHHHH", IMAGE_MAGIC, CF_RGB565, 0, w, h, stride, 0)]
+    for row in rows:
+        px = bytearray(stride)
+        for x in range(w):
+            r, g, b = row[3 * x], row[3 * x + 1], row[3 * x + 2]
+            struct.pack_into("<H", px, 2 * x, (r >> 3) << 11 | (g >> 2) << 5 | b >> 3)
+        out.append(bytes(px))
+    return b"".join(out)
+
+
+def run(project_dir, check=False, quiet=False):
+    sources = sorted(glob.glob(os.path.join(project_dir, SOURCES, "*.png")))
+    out_dir = os.path.join(project_dir, OUT_DIR)
+    ok = True
+    for src in sources:
+        name = os.path.splitext(os.path.basename(src))[0]
+        path = os.path.join(out_dir, name + ".bin")
+        data = rgb565(src)
+        if os.path.exists(path):
+            with open(path, "rb") as f:
+                if f.read() == data:
+                    continue
+        if check:
+            print("image_build: vanhentunut %s" % os.path.relpath(path, project_dir))
+            ok = False
+            continue
+        os.makedirs(out_dir, exist_ok=True)
+        with open(path, "wb") as f:
+            f.write(data)
+        if not quiet:
+            print("image_build: päivitetty %s (%d tavua)" % (os.path.relpath(path, project_dir), len(data)))
+    return ok
+
+
+if "Import" in globals():
+    # PlatformIO: extra_scripts = pre:tools/image_build.py
+    Import("env")  # noqa: F821
+    sys.path.insert(0, os.path.join(env.subst("$PROJECT_DIR"), "tools"))  # noqa: F821
+    run(env.subst("$PROJECT_DIR"))  # noqa: F821
+elif __name__ == "__main__":
+    sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("--check", action="store_true", help="älä kirjoita, palauta 1 jos tulos muuttuisi")
+    ap.add_argument("--project-dir", default=os.path.join(os.path.dirname(os.path.abspath(__file__)), ".."))
+    args = ap.parse_args()
+    sys.exit(0 if run(args.project_dir, args.check) else 1)
@@ -0,0 +1,128 @@
+#!/usr/bin/env python3
+"""Binäärilokin (include/klog.h) purkaja.
+
+    python3 tools/klog_decode.py kiosk_fs/klog.bin          # klog_dump_file()
+    python3 tools/klog_decode.py serial.log                 # "@KLOG ..." -rivit sarjalokista
+    python3 tools/klog_decode.py --port /dev/ttyUSB0        # pyytää purun ja odottaa sitä
+
+Tapahtumien tekstit luetaan include/klog_events.h:sta samassa järjestyksessä
+kuin laiteohjelma numeroi ne. Jos otsakkeen tapahtumamäärä ei täsmää, loki on
+eri versiosta ja tekstit voivat olla väärin (varoitus, purku jatkuu).
+"""
+
+import argparse
+import base64
+import os
+import re
+import struct
+import sys
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+EVENTS_H = os.path.join(ROOT, "include", "klog_events.h")
+
+DUMP_REQUEST = b"K"                  # KLOG_DUMP_REQUEST
+HEADER = struct.Struct("<4sHHIII")   # klog_header_t
+ENTRY = struct.Struct("<IHH3I")      # klog_entry_t
+CONV = re.compile(r"%[-+ 0#]*\d*([udx])")
+
+
+def load_events(path):
+    with open(path, encoding="utf-8") as f:
+        text = f.read()
+    text = text[text.index("#define KLOG_EVENTS"):]  # Ohitetaan kommentin esimerkki
+    return re.findall(r'X\(\s*(\w+)\s*,\s*"((?:[^"\\]|\\.)*)"\s*\)', text)
+
+
+def format_entry(fmt, args):
+    """%d etumerkillisenä, %u / %x etumerkittömänä; ylimääräiset argumentit ohitetaan."""
+    convs = CONV.findall(fmt)
+    vals = []
+    for conv, v in zip(convs, args):
+        vals.append(v - (1 << 32) if conv == "d" and v & 0x80000000 else v)
+    return CONV.sub(lambda m: m.group(0)[:-1] + ("d" if m.group(1) == "u" else m.group(1)), fmt) % tuple(vals)
+
+
+def decode(data, events):
+    magic, event_count, entry_size, head, entries, dropped = HEADER.unpack_from(data)
+    if magic != b"KLG1" or entry_size != ENTRY.size:
+        sys.exit("ei klog-purku (magic %r, merkintä %d tavua)" % (magic, entry_size))
+    if event_count != len(events):
+        print("VAROITUS: lokissa %d tapahtumatyyppiä, klog_events.h:ssa %d" % (event_count, len(events)))
+    n = min(head, entries)
+    print("%d merkintää (kirjoitettu %d, rajoitin pudotti %d)" % (n, head, dropped))
+    pos = HEADER.size
+    for _ in range(n):
+        if pos + ENTRY.size > len(data):
+            print("(purku katkesi)")
+            break
+        t_ms, ev, suppressed, a, b, c = ENTRY.unpack_from(data, pos)
+        pos += ENTRY.size
+        if ev < len(events):
+            name, fmt = events[ev]
+            text = format_entry(fmt, (a, b, c))
+        else:
+            name, text = "?%d" % ev, "%u %u %u" % (a, b, c)
+        extra = "  (+%d pudotettu)" % suppressed if suppressed else ""
+        print("%10.3f  %-14s %s%s" % (t_ms / 1000.0, name, text, extra))
+
+
+def from_console(lines):
+    """Viimeisin täydellinen "@KLOG"-purku tavuina."""
+    dumps, cur = [], None
+    for line in lines:
+        i = line.find("@KLOG ")
+        if i < 0:
+            continue
+        body = line[i + 6:].strip()
+        if body == "end":
+            if cur is not None:
+                dumps.append(b"".join(cur))
+            cur = None
+        else:
+            cur = (cur or []) + [base64.b64decode(body)]
+    return dumps[-1] if dumps else None
+
+
+def read_serial(port, baud):
+    try:
+        import serial
+    except ImportError:
+        sys.exit("sarjaporttiin tarvitaan pyserial (pip install pyserial)")
+    lines = []
+    s = serial.Serial(None, baud, timeout=1)
+    s.port = port
+    s.dtr = s.rts = False  # Ei resetoida laitetta avattaessa: loki on RAMissa
+    with s:  # Avaa portin
+        s.write(DUMP_REQUEST)
+        while True:
+            line = s.readline().decode("utf-8", "replace")
+            lines.append(line)
+            if "@KLOG end" in line:
+                return lines
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("input", nargs="?", help="binääripurku tai sarjaloki")
+    ap.add_argument("--port", help="odota purkua sarjaportista")
+    ap.add_argument("--baud", type=int, default=115200)
+    ap.add_argument("--events", default=EVENTS_H, help="klog_events.h")
+    args = ap.parse_args()
+
+    events = load_events(args.events)
+    if args.port:
+        data = from_console(read_serial(args.port, args.baud))
+    elif args.input:
+        with open(args.input, "rb") as f:
+            data = f.read()
+        if not data.startswith(b"KLG1"):
+            data = from_console(data.decode("utf-8", "replace").splitlines())
+    else:
+        ap.error("anna tiedosto tai --port")
+    if not data:
+        sys.exit("ei purkua syötteessä")
+    decode(data, events)
+
+
+if __name__ == "__main__":
+    main()
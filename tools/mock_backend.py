@@ -0,0 +1,189 @@
+#!/usr/bin/env python3
+"""Paikallinen korvike kioskin taustajärjestelmälle Linux-testejä varten.
+
+Vastaanottaa tapahtumaerät (application/x-kiosk-batch, myös Content-Encoding:
+deflate), purkaa ne ja hylkää
+tuplat tietueittain (laitetunnus, seq): kadonneen vastauksen jälkeinen uusinta voi
+sisältää jo vastaanotettuja tietueita eri Idempotency-Key-avaimella, jos jonoon
+tuli välissä lisää. Täsmälleen sama erä (sama avain) saa vastauksen 409. Tarjoaa luettelon erotustiedostot
+hakemistosta (delta-<versio>.bin, ks. tools/catalog_delta.py).
+
+    python3 tools/mock_backend.py --port 8080 [--fail-rate 0.2] [--delay-ms 50] [--catalog-dir DIR]
+
+POST /api/postmortem tulostaa laitteen kaatumisraportin (include/postmortem.h).
+GET /stats palauttaa vastaanotetut määrät JSONina.
+"""
+
+import argparse
+import json
+import os
+import random
+import threading
+import time
+import zlib
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+from urllib.parse import parse_qs, urlparse
+
+
+def read_varint(buf, pos):
+    value = shift = 0
+    while True:
+        b = buf[pos]
+        pos += 1
+        value |= (b & 0x7F) << shift
+        if b < 0x80:
+            return value, pos
+        shift += 7
+
+
+def unzigzag(v):
+    return (v >> 1) ^ -(v & 1)
+
+
+def decode_batch(buf):
+    if buf[:4] != b"KTB1":
+        raise ValueError("bad magic")
+    id_len = buf[4]
+    device = buf[5:5 + id_len].decode()
+    pos = 5 + id_len
+    count, pos = read_varint(buf, pos)
+    seq, pos = read_varint(buf, pos)
+    ts, pos = read_varint(buf, pos)
+    product = 0
+    records = []
+    for _ in range(count):
+        d, pos = read_varint(buf, pos)
+        seq += d
+        d, pos = read_varint(buf, pos)
+        ts += unzigzag(d)
+        d, pos = read_varint(buf, pos)
+        product += unzigzag(d)
+        amount, pos = read_varint(buf, pos)
+        qty, pos = read_varint(buf, pos)
+        mode = buf[pos]
+        pos += 1
+        records.append({"seq": seq, "ts": ts, "product": product,
+                        "amount": unzigzag(amount), "qty": qty, "mode": mode})
+    if pos != len(buf):
+        raise ValueError("trailing bytes")
+    return device, records
+
+
+class State:
+    lock = threading.Lock()
+    keys = set()
+    records = {}
+    batches = 0
+    duplicates = 0
+    bytes = 0
+    postmortems = 0
+
+
+class Handler(BaseHTTPRequestHandler):
+    fail_rate = 0.0
+    delay_ms = 0
+    catalog_dir = None
+
+    def log_message(self, fmt, *args):
+        pass
+
+    def reply(self, code, obj):
+        data = json.dumps(obj).encode()
+        self.send_response(code)
+        self.send_header("Content-Type", "application/json")
+        self.send_header("Content-Length", str(len(data)))
+        self.end_headers()
+        self.wfile.write(data)
+
+    def send_catalog_delta(self, query):
+        version = int(parse_qs(query).get("from", ["0"])[0])
+        path = os.path.join(self.catalog_dir or "", f"delta-{version}.bin")
+        if not self.catalog_dir or not os.path.exists(path):
+            self.send_response(204)  # Ajan tasalla
+            self.end_headers()
+            return
+        with open(path, "rb") as f:
+            data = f.read()
+        self.send_response(200)
+        self.send_header("Content-Type", "application/octet-stream")
+        self.send_header("Content-Length", str(len(data)))
+        self.end_headers()
+        self.wfile.write(data)
+
+    def do_GET(self):
+        url = urlparse(self.path)
+        if url.path == "/api/catalog/delta":
+            self.send_catalog_delta(url.query)
+        elif self.path == "/stats":
+            with State.lock:
+                self.reply(200, {"batches": State.batches, "records": len(State.records),
+                                 "duplicates": State.duplicates, "bytes": State.bytes,
+                                 "postmortems": State.postmortems})
+        else:
+            self.reply(404, {})
+
+    def do_POST(self):
+        body = self.rfile.read(int(self.headers.get("Content-Length", 0)))
+        if self.delay_ms:
+            time.sleep(self.delay_ms / 1000)
+        if self.path not in ("/api/tx/batch", "/api/postmortem"):
+            self.reply(404, {})
+            return
+        if random.random() < self.fail_rate:
+            self.reply(503, {"error": "simulated"})
+            return
+        key = self.headers.get("Idempotency-Key")
+        if not key:
+            self.reply(400, {"error": "missing Idempotency-Key"})
+            return
+        if self.path == "/api/postmortem":
+            with State.lock:
+                if key in State.keys:
+                    self.reply(409, {"duplicate": key})
+                    return
+                State.keys.add(key)
+                State.postmortems += 1
+            print("--- post-mortem %s ---\n%s" % (key, body.decode("utf-8", "replace")), flush=True)
+            self.reply(200, {})
+            return
+        try:
+            raw = zlib.decompress(body) if self.headers.get("Content-Encoding") == "deflate" else body
+            device, records = decode_batch(raw)
+        except (ValueError, IndexError, zlib.error) as e:
+            self.reply(400, {"error": str(e)})
+            return
+        with State.lock:
+            if key in State.keys:
+                State.duplicates += 1
+                self.reply(409, {"duplicate": key})
+                return
+            State.keys.add(key)
+            State.batches += 1
+            State.bytes += len(body)
+            accepted = 0
+            for r in records:
+                if (device, r["seq"]) in State.records:
+                    State.duplicates += 1
+                    continue
+                State.records[(device, r["seq"])] = r
+                accepted += 1
+        self.reply(200, {"accepted": accepted, "duplicates": len(records) - accepted})
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("--port", type=int, default=8080)
+    ap.add_argument("--fail-rate", type=float, default=0.0, help="osuus pyynnöistä, joihin vastataan 503")
+    ap.add_argument("--delay-ms", type=int, default=0, help="keinotekoinen viive per pyyntö")
+    ap.add_argument("--catalog-dir", help="hakemisto, jossa delta-<versio>.bin -tiedostot")
+    args = ap.parse_args()
+    Handler.fail_rate = args.fail_rate
+    Handler.delay_ms = args.delay_ms
+    Handler.catalog_dir = args.catalog_dir
+    server = ThreadingHTTPServer(("127.0.0.1", args.port), Handler)
+    print(f"mock backend: http://127.0.0.1:{args.port}")
+    server.serve_forever()
+
+
+if __name__ == "__main__":
+    main()
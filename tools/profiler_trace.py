@@ -0,0 +1,155 @@
+#!/usr/bin/env python3
+"""LVGL:n profiloijan jäljet Chrome/Perfetto-muotoon (chrome://tracing, ui.perfetto.dev).
+
+    pio run -e native-profile
+    .pio/build/native-profile/program --trace out.trace --toggle-bench 20
+    python3 tools/profiler_trace.py out.trace -o out.json
+
+    pio run -e esp32-8048S043C-profile -t upload
+    python3 tools/profiler_trace.py --port /dev/ttyUSB0 --seconds 10 -o device.json
+
+Syöte on include/profiler_export.h:n kirjoittamia "@lvp"-rivejä: nimet (N), tapahtumat
+base64:nä (E) ja pudotukset (D). Muut rivit (sarjaportin lokit) ohitetaan, samoin
+tapahtumat, joiden nimeä ei ole vielä nähty (luku aloitettu kesken; nimet toistuvat
+kahden sekunnin välein). Pudotuksen jälkeen avoimet jaksot hylätään, koska niiden
+loput voivat puuttua. Aikaleimat ovat 32-bittisiä mikrosekunteja, joten ympärimeno
+(~71 min) korjataan. Lopuksi tulostetaan raskaimmat jaksot ja pudotukset.
+"""
+
+import argparse
+import base64
+import binascii
+import json
+import sys
+import time
+
+PREFIX = "@lvp "
+END_BIT = 0x80
+WRAP_US = 1 << 32
+TID = 1  # Vain LVGL:n tehtävä kirjoittaa jälkiä
+
+
+def decode_events(data):
+    """E-rivin tavut -> [(aikaleima, id, loppu)]"""
+    ts = int.from_bytes(data[:4], "little")
+    out, pos = [], 4
+    while pos < len(data):
+        b = data[pos]
+        pos += 1
+        dt, shift = 0, 0
+        while True:
+            v = data[pos]
+            pos += 1
+            dt |= (v & 0x7F) << shift
+            shift += 7
+            if v < 0x80:
+                break
+        ts = (ts + dt) & (WRAP_US - 1)
+        out.append((ts, b & ~END_BIT, bool(b & END_BIT)))
+    return out
+
+
+def parse(lines):
+    """Palauttaa (Chrome-tapahtumat listana, pudotettujen määrä)."""
+    events = []
+    names = {}
+    dropped = 0
+    offset, last = 0, None
+    for line in lines:
+        i = line.find(PREFIX)
+        if i < 0:
+            continue
+        kind, _, rest = line[i + len(PREFIX):].rstrip("\r\n").partition(" ")
+        if kind == "N":
+            sid, _, name = rest.partition(" ")
+            if sid.isdigit():
+                names[int(sid)] = name
+            continue
+        if kind == "D":
+            if rest.strip().isdigit():
+                dropped += int(rest)
+                events.append({"ph": "D"})  # Merkki summarize():lle, ei Chrome-tapahtuma
+            continue
+        if kind != "E":
+            continue
+        try:
+            decoded = decode_events(base64.b64decode(rest.strip(), validate=True))
+        except (binascii.Error, IndexError):
+            continue  # Katkennut rivi
+        for ts, eid, end in decoded:
+            # Profiloijan kello on 32-bittinen mikrosekuntilaskuri
+            if last is not None and ts + offset < last - WRAP_US // 2:
+                offset += WRAP_US
+            ts += offset
+            last = ts
+            if eid not in names:
+                continue
+            events.append({"name": names[eid], "ph": "E" if end else "B", "ts": ts, "pid": 1, "tid": TID})
+    return events, dropped
+
+
+def summarize(events, top):
+    """Jaksojen kesto nimen mukaan: (nimi, kpl, yhteensä, suurin) kestoltaan suurimmasta."""
+    stacks, totals = {}, {}
+    for e in events:
+        if e["ph"] == "D":
+            stacks.clear()
+            continue
+        stack = stacks.setdefault(e["tid"], [])
+        if e["ph"] == "B":
+            stack.append(e)
+        elif stack:
+            b = stack.pop()
+            d = e["ts"] - b["ts"]
+            n, total, longest = totals.get(b["name"], (0, 0, 0))
+            totals[b["name"]] = (n + 1, total + d, max(longest, d))
+    rows = sorted(totals.items(), key=lambda kv: -kv[1][1])[:top]
+    return [(name, n, total, longest) for name, (n, total, longest) in rows]
+
+
+def read_serial(port, baud, seconds):
+    try:
+        import serial
+    except ImportError:
+        sys.exit("sarjaporttiin tarvitaan pyserial (pip install pyserial)")
+    lines = []
+    end = time.time() + seconds
+    with serial.Serial(port, baud, timeout=0.5) as s:
+        while time.time() < end:
+            lines.append(s.readline().decode("utf-8", "replace"))
+    return lines
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("input", nargs="?", help="jälkitiedosto (- = stdin)")
+    ap.add_argument("--port", help="lue sarjaportista tiedoston sijaan")
+    ap.add_argument("--baud", type=int, default=921600, help="KIOSK_SERIAL_BAUD profiloijaympäristössä")
+    ap.add_argument("--seconds", type=float, default=10.0, help="sarjaportin lukuaika")
+    ap.add_argument("-o", "--output", default="trace.json")
+    ap.add_argument("--top", type=int, default=15, help="yhteenvedon rivit")
+    args = ap.parse_args()
+
+    if args.port:
+        lines = read_serial(args.port, args.baud, args.seconds)
+    elif args.input == "-" or args.input is None:
+        lines = sys.stdin
+    else:
+        with open(args.input, encoding="utf-8", errors="replace") as f:
+            lines = f.readlines()
+
+    events, dropped = parse(lines)
+    trace = [e for e in events if e["ph"] != "D"]
+    if not trace:
+        sys.exit("ei profiloijan rivejä")
+    with open(args.output, "w") as f:
+        json.dump({"traceEvents": trace, "displayTimeUnit": "ms"}, f)
+    span = (trace[-1]["ts"] - trace[0]["ts"]) / 1e3
+    print("%d tapahtumaa, %.1f ms, %d pudotettu -> %s" % (len(trace), span, dropped, args.output))
+    print("%-40s %7s %11s %9s" % ("jakso", "kpl", "yht. ms", "max ms"))
+    for name, n, total, longest in summarize(events, args.top):
+        print("%-40s %7d %11.2f %9.2f" % (name[:40], n, total / 1e3, longest / 1e3))
+
+
+if __name__ == "__main__":
+    main()